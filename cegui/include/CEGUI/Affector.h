@@ -30,8 +30,9 @@
 #define _CEGUIAffector_h_
 
 #include "CEGUI/String.h"
+#include "CEGUI/InternedName.h"
 #include "CEGUI/KeyFrame.h"
-#include <map>
+#include <vector>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -238,6 +239,47 @@ public:
     */
     void apply(AnimationInstance* instance);
 
+    /*!
+    \brief
+        Applies this Affector's definition with parameters from given
+        Animation Instance
+
+    \param keyFrameCursor
+        Index of the key frame found as the left neighbour of the position
+        the last time. The search for the neighbouring key frames starts
+        there and the cursor is updated, so instances stepping forward find
+        them in constant time.
+
+    \par
+        This function is internal so unless you know what you're doing, don't
+        touch!
+    */
+    void apply(AnimationInstance* instance, size_t& keyFrameCursor);
+
+    /*!
+    \brief
+        Finds the native values of the key frames surrounding the position of
+        \a instance, as apply does, without setting anything to the target.
+
+    \param keyFrameCursor
+        Key frame cursor as passed to apply.
+
+    \param left
+        Receives the native value of the key frame before the position.
+
+    \param right
+        Receives the native value of the key frame after the position.
+
+    \return
+        The position between \a left and \a right, altered by the progression
+        of the right key frame, or a negative value if the key frame values
+        are not available natively, e.g. because the interpolator is not a
+        NativeInterpolator or a key frame takes its value from a property.
+    */
+    float getNativeKeyFrameValues(AnimationInstance* instance, size_t& keyFrameCursor,
+                                  const InterpolatorValue*& left,
+                                  const InterpolatorValue*& right);
+
     /*!
     \brief
         Writes an xml representation of this Affector to \a out_stream.
@@ -248,20 +290,39 @@ public:
     void writeXMLToStream(XMLSerializer& xml_stream) const;
 
 private:
+    /*!
+    \brief
+        Moves \a keyFrameCursor to the key frames surrounding \a position and
+        returns the altered interpolation position between \a left and
+        \a right. There must be at least one key frame.
+    */
+    float findKeyFrames(float position, size_t& keyFrameCursor,
+                        KeyFrame*& left, KeyFrame*& right) const;
+
     //! parent animation definition
     Animation* d_parent;
     //! application method
     ApplicationMethod d_applicationMethod;
     //! property that gets affected by this affector
     String d_targetProperty;
+    //! d_targetProperty interned, to look up the Property when applying
+    InternedName d_targetPropertyName;
     //! curently used interpolator (has to be set for the Affector to work!)
     Interpolator* d_interpolator;
+    //! d_interpolator if it can work on native values, nullptr otherwise
+    NativeInterpolator* d_nativeInterpolator;
 
-    typedef std::map<float, KeyFrame*, std::less<float> > KeyFrameMap;
+    //! key frames sorted by their position
+    typedef std::vector<KeyFrame*> KeyFrameList;
     /** keyframes of this affector (if there are no keyframes, this affector
      * won't do anything!)
      */
-    KeyFrameMap d_keyFrames;
+    KeyFrameList d_keyFrames;
+
+    //! Return the first key frame at or after \a position.
+    KeyFrameList::const_iterator lowerBoundKeyFrame(float position) const;
+    //! Return the key frame at \a position or end of d_keyFrames.
+    KeyFrameList::const_iterator findKeyFrame(float position) const;
 };
 
 } // End of  CEGUI namespace section
@@ -0,0 +1,118 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIAndroidAssetResourceProvider_h_
+#define _CEGUIAndroidAssetResourceProvider_h_
+
+#ifndef __ANDROID__
+#   error "do not include AndroidAssetResourceProvider.h unless compiling for android"
+#endif
+
+#include "CEGUI/DefaultResourceProvider.h"
+
+#include <mutex>
+#include <unordered_map>
+
+struct AAsset;
+struct AAssetManager;
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    ResourceProvider loading the assets of an Android application through its
+    AAssetManager, with the resource group directories of the
+    DefaultResourceProvider as asset directories.
+
+    Assets stored uncompressed in the APK are not copied: the container is
+    given the data of the memory mapped asset as borrowed data, and the asset
+    is kept open until the container is passed to unloadRawDataContainer.
+    Compressed assets are inflated straight into the container. Loads may run
+    in parallel, so loadRawDataContainerAsync inflates them on the
+    TaskScheduler of the System instead of the thread that requested them.
+*/
+class CEGUIEXPORT AndroidAssetResourceProvider : public DefaultResourceProvider
+{
+public:
+    /*!
+    \brief
+        Constructor.
+
+    \param assetManager
+        AAssetManager to load the assets from. If null, the one of the
+        android_app set via AndroidUtils::setAndroidApp is used.
+    */
+    AndroidAssetResourceProvider(AAssetManager* assetManager = nullptr);
+    //! Closes the assets whose data is still in use.
+    ~AndroidAssetResourceProvider() override;
+
+    void loadRawDataContainer(const String& filename, RawDataContainer& output,
+                              const String& resourceGroup) override;
+    void unloadRawDataContainer(RawDataContainer& data) override;
+
+    /*!
+    \brief
+        Reads the asset in chunks of getReadChunkSize bytes, inflating
+        compressed assets while they are read.
+    */
+    void readRawDataChunks(const String& filename, const ReadChunkCallback& callback,
+                           const String& resourceGroup) override;
+    size_t getResourceGroupFileNames(std::vector<String>& out_vec,
+                                     const String& file_pattern,
+                                     const String& resource_group) override;
+    bool isResourceAvailable(const String& filename, const String& resourceGroup) override;
+
+    //! Returns the number of assets kept open for the data they lend.
+    size_t getOpenAssetCount() const;
+
+protected:
+    //! Opens the asset \a filename of \a resourceGroup in \a mode, or returns null.
+    AAsset* openAsset(const String& filename, const String& resourceGroup, int mode) const;
+
+    //! Returns the AAssetManager the assets are loaded from.
+    AAssetManager* getAssetManager() const;
+
+    //! AAssetManager set at construction, or null to use the one of AndroidUtils.
+    AAssetManager* d_assetManager;
+    //! Open assets, by the start of the data lent to a RawDataContainer.
+    std::unordered_map<const void*, AAsset*> d_openAssets;
+    //! Guards d_openAssets, which loads on other threads change.
+    mutable std::mutex d_openAssetsMutex;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
+#endif	// end of guard _CEGUIAndroidAssetResourceProvider_h_
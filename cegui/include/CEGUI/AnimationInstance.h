@@ -312,6 +312,43 @@ public:
     */
     bool isAutoSteppingEnabled() const;
 
+    /*!
+    \brief
+        Controls whether this animation instance is played on the render side
+        when possible (disabled by default).
+
+    \par
+        When enabled, the target is a Window drawing to a RenderingWindow of
+        its own (see Window::setUsingAutoRenderingSurface) and every Affector
+        linearly interpolates the "Position", "Alpha" or "Rotation" property
+        in absolute mode, the animation is shown by moving, rotating and
+        fading the RenderingWindow quad on each step. No property is set, so
+        there are no events, no layout and no redraw of the window contents.
+        Key frame progressions (easing) are supported.
+
+    \par
+        The properties are set to the animated values when the instance is
+        paused, stopped, finished or ends, when reconcile is called, and
+        whenever the animation stops being eligible. Until then, getProperty
+        returns the values from before the animation and input is still hit
+        tested against them.
+    */
+    void setRenderSideEvaluationEnabled(bool enabled);
+
+    //! Returns whether render side evaluation is enabled.
+    bool isRenderSideEvaluationEnabled() const;
+
+    //! Returns whether the last step was shown on the render side.
+    bool isEvaluatedOnRenderSide() const;
+
+    /*!
+    \brief
+        Sets the properties of the target to the values of the current
+        position if they are only shown on the render side, see
+        setRenderSideEvaluationEnabled.
+    */
+    void reconcile();
+
     /*!
     \brief
         Steps the animation forward by the given delta
@@ -401,7 +438,24 @@ public:
 	*/
     void apply();
 
+    /*!
+    \brief
+        Internal method, returns the key frame cursors of the Affectors of
+        the definition, see Affector::apply.
+    */
+    std::vector<size_t>& getKeyFrameCursors() { return d_keyFrameCursors; }
+
 private:
+    /*!
+    \brief
+        Shows the current position through the RenderingWindow of the target,
+        returns false if the animation is not eligible, without changing anything.
+    */
+    bool applyOnRenderSide();
+
+    //! Removes the render side transform without setting the properties.
+    void endRenderSideEvaluation();
+
     //! this is called when animation starts
     void onAnimationStarted();
     //! this is called when animation stops
@@ -449,12 +503,18 @@ private:
     float d_maxStepDeltaClamp;
     //! true if auto stepping is enabled
     bool d_autoSteppingEnabled;
+    //! whether the instance may be played on the render side
+    bool d_renderSideEvaluationEnabled;
+    //! Window whose RenderingWindow shows the animation, null when properties are applied
+    Window* d_renderSideWindow;
 
     typedef std::map<String, String, std::less<String> > PropertyValueMap;
     /** cached saved values, used for relative application method
      *  and keyframe property source, see Affector and KeyFrame classes
      */
     PropertyValueMap d_savedPropertyValues;
+    //! key frame cursor of each Affector, indexed like the Affectors
+    std::vector<size_t> d_keyFrameCursors;
 
     typedef std::vector<Event::Connection> ConnectionTracker;
     //! tracks auto event connections we make.
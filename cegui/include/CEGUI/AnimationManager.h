@@ -218,6 +218,9 @@ public:
     */
     void autoStepInstances(float delta);
 
+    //! Returns whether any running animation instance is stepped automatically.
+    bool hasAutoSteppedRunningInstances() const;
+
     /*!
     \brief
         Parses an XML file containing animation specifications to create
@@ -0,0 +1,178 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIBakedFont_h_
+#define _CEGUIBakedFont_h_
+
+#include "CEGUI/Font.h"
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class Texture;
+
+/*!
+\brief
+    Implementation of the Font class interface using a baked font file.
+
+    A baked font file holds the metrics, kerning pairs and pre-rasterised
+    atlas pages of a set of glyphs, as written by
+    FreeTypeFont::writeBakedFont. Loading it needs neither FreeType nor any
+    rasterisation, while the text is still laid out with kerning.
+
+    The file is little-endian and consists of 32 bit fields only:
+    - the header: the magic bytes "CEGUIBFT", the format version, the
+      ascender, descender and line spacing in pixels, followed by the number
+      of glyphs, of kerning pairs and of pages and the size of the pages.
+    - the glyphs, sorted by code point: the code point, the page index, the
+      x, y, width and height of the glyph on its page, followed by the x and
+      y offset of the glyph image and its advance in pixels.
+    - the kerning pairs, sorted by code points: the left and right code
+      points followed by the adjustment of the advance in pixels.
+    - the pixels of the pages, as square ARGB images.
+
+    Since every field is aligned and stored in its final form, the file can be
+    used in place, e.g. when memory mapped by a ResourceProvider.
+*/
+class CEGUIEXPORT BakedFont : public Font
+{
+public:
+    //! The magic bytes starting every baked font file.
+    static const char FileMagic[8];
+    //! The version of the baked font file format.
+    static const std::uint32_t FileVersion;
+
+    /*!
+    \brief
+        Constructor for baked fonts.
+
+    \param font_name
+        The name that the font will use within the CEGUI system.
+
+    \param filename
+        The filename of the baked font file to load.
+
+    \param resource_group
+        The resource group identifier to use when loading the file.
+
+    \param auto_scaled
+        Specifies whether the font imagery should be automatically scaled to
+        maintain the same physical size (which is calculated by using the
+        native resolution setting).
+
+    \param native_res
+        The native resolution value.  This is only significant when
+        auto scaling is enabled.
+
+    \exception FileIOException
+        thrown if the file is not a valid baked font file.
+    */
+    BakedFont(const String& font_name, const String& filename,
+              const String& resource_group = "",
+              const AutoScaledMode auto_scaled = AutoScaledMode::Disabled,
+              const Sizef& native_res = Sizef(640.0f, 480.0f));
+
+    //! Destructor.
+    ~BakedFont();
+
+    void updateFont() override;
+    bool isCodepointAvailable(char32_t codePoint) const override;
+    FontGlyph* getGlyphForCodepoint(const char32_t codePoint) const override;
+    float getTextExtent(const String& text) const override;
+    float getTextAdvance(const String& text) const override;
+    using Font::getCharAtPixel;
+    size_t getCharAtPixel(const String& text, size_t start_char, float pixel) const override;
+
+    /*!
+    \brief
+        Returns the adjustment of the advance between two code points, in
+        pixels at the current scaling, or 0 if there is no kerning pair for
+        them.
+    */
+    float getKerning(char32_t left, char32_t right) const;
+
+    //! Returns the number of kerning pairs of the font.
+    size_t getKerningPairCount() const { return d_kerning.size(); }
+
+protected:
+    //! A glyph of the font along with its unscaled advance.
+    struct BakedGlyph
+    {
+        FontGlyph* d_glyph;
+        float d_nativeAdvance;
+    };
+
+    //! Definition of CodePointToGlyphMap type.
+    typedef std::unordered_map<char32_t, BakedGlyph> CodePointToGlyphMap;
+    //! Definition of the type mapping pairs of code points to unscaled kerning.
+    typedef std::unordered_map<std::uint64_t, float> KerningMap;
+
+    //! Loads the glyphs, kerning pairs and pages from the file.
+    void load();
+    //! Destroys the glyphs, their images and the page textures.
+    void free();
+
+    // override of functions in Font base class.
+    std::vector<GeometryBuffer*> layoutAndCreateGlyphRenderGeometry(
+        const String& text, const Rectf* clip_rect,
+        const ColourRect& colours, const float space_extra,
+        ImageRenderSettings imgRenderSettings, DefaultParagraphDirection defaultParagraphDir,
+        glm::vec2& glyphPos) const override;
+    void writeXMLToStream_impl(XMLSerializer& xml_stream) const override;
+
+    //! Returns the key of a pair of code points in d_kerning.
+    static std::uint64_t getKerningKey(char32_t left, char32_t right)
+    { return (static_cast<std::uint64_t>(left) << 32) | right; }
+
+    //! Contains mappings from code points to glyphs
+    CodePointToGlyphMap d_codePointToGlyphMap;
+    //! Unscaled adjustments of the advance between pairs of code points.
+    KerningMap d_kerning;
+    //! Textures holding the pages of the font.
+    std::vector<Texture*> d_pages;
+    //! Unscaled metrics of the font, as stored in the file.
+    float d_nativeAscender;
+    float d_nativeDescender;
+    float d_nativeHeight;
+    //! Current factor by which the advances and kerning are scaled.
+    float d_advanceScale;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIBakedFont_h_
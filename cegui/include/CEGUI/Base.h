@@ -101,6 +101,19 @@
 //! Prevent an "unused parameter/variable" warning.
 #define CEGUI_UNUSED(var) (static_cast<void>(var))
 
+/*************************************************************************
+    SIMD instruction set used for the colour maths. Both are part of the
+    baseline of the architectures they are enabled for, so the choice is
+    made at compile time. Define CEGUI_NO_SIMD to use plain floats.
+*************************************************************************/
+#if !defined(CEGUI_NO_SIMD)
+#   if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#       define CEGUI_SIMD_SSE2
+#   elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#       define CEGUI_SIMD_NEON
+#   endif
+#endif
+
 /*************************************************************************
 	Documentation for the CEGUI namespace itself
 *************************************************************************/
@@ -34,6 +34,7 @@
 #include "CEGUI/String.h"
 #include "CEGUI/falagard/Enums.h"
 #include <unordered_map>
+#include <list>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -60,6 +61,12 @@ namespace CEGUI
     - 'image-width' value is a float.
     - 'image-height' value is a float.
     - 'aspect-lock' value is a boolean (NB: this currently has no effect).
+
+    The results of the most recent parses are kept, keyed by the hash of the
+    input string along with the active font and colours, so that parsing the
+    same markup again only copies the stored RenderedString. Strings holding
+    an 'image' tag are not kept, since the cached result would refer to an
+    Image that may be destroyed in the meantime.
 */
 class CEGUIEXPORT BasicRenderedStringParser : public RenderedStringParser
 {
@@ -85,12 +92,34 @@ public:
     //! Destructor.
     virtual ~BasicRenderedStringParser();
 
+    //! Maximum number of parse results kept by the parser.
+    static const size_t ParseCacheCapacity = 64;
+
     // implement required interface from RenderedStringParser
     RenderedString parse(const String& input_string,
                          const Font* active_font,
                          const ColourRect* active_colours) override;
 
+    //! Discards all the parse results kept by the parser.
+    void clearParseCache();
+
+    //! Returns the number of parse results kept by the parser.
+    size_t getParseCacheSize() const { return d_parseCache.size(); }
+
 protected:
+    //! A parse result kept for reuse.
+    struct ParseCacheEntry
+    {
+        size_t d_hash;
+        String d_text;
+        String d_fontName;
+        ColourRect d_colours;
+        RenderedString d_result;
+    };
+
+    //! Parses \a input_string into \a rs, starting from the current state.
+    void parseMarkup(RenderedString& rs, const String& input_string);
+
     //! append the text string \a text to the RenderedString \a rs.
     virtual void appendRenderedText(RenderedString& rs, const String& text) const;
 
@@ -134,6 +163,20 @@ protected:
 
     //! true if handlers have been registered
     bool d_initialised;
+    /*!
+        false if the result of the current parse must not be kept, e.g.
+        because it refers to objects that may be destroyed. Reset to true
+        before each parse; subclasses adding handlers with such results
+        should clear it.
+    */
+    bool d_cacheable;
+    //! Parse results, most recently used first.
+    std::list<ParseCacheEntry> d_parseCache;
+    //! Buffers for the sections of the input string, reused between parses.
+    String d_sectionBuffer;
+    String d_tagBuffer;
+    String d_variableBuffer;
+    String d_valueBuffer;
     //! definition of type used for handler functions
     typedef void (BasicRenderedStringParser::*TagHandler)(RenderedString&,
                                                           const String&);
@@ -46,13 +46,23 @@ enum BidiCharType : int
     NEUTRAL
 };
 
-//! Abstract class to wrap a Bidi visual mapping of a text string.
+/*!
+\brief
+    Abstract class to wrap a Bidi visual mapping of a text string.
+
+    The results of updateVisual() are kept in a cache shared by all the
+    mappings of the same type, keyed by the logical string, so that windows
+    showing the same text reorder it only once.
+*/
 class CEGUIEXPORT BidiVisualMapping
 {
 public:
     //! type definition for collection used to hold mapping index lists.
     typedef std::vector<int> StrIndexList;
 
+    //! Maximum number of logical strings whose visual mapping is cached.
+    static const size_t VisualCacheCapacity = 1024;
+
     //! Destructor.
     virtual ~BidiVisualMapping();
 
@@ -111,11 +121,37 @@ public:
     */
     bool updateVisual(const String& logical);
 
+    /*!
+    \brief
+        Reorder many strings from logical to visual order at once, through the
+        shared cache, e.g. when populating a list with localised items.
+
+        Strings not found in the cache are reordered and added to it, so that
+        windows showing them later do not reorder them again.
+
+    \param logical
+        The strings to be reordered.
+
+    \param visual
+        Receives the reordered strings, in the order of \a logical.
+
+    \return
+        - true if all the strings were reordered successfully.
+        - false if the operation failed for any of them.
+    */
+    bool updateVisuals(const std::vector<String>& logical,
+                       std::vector<String>& visual) const;
+
+    //! Discards the visual mappings cached for all the logical strings.
+    static void clearVisualCache();
+
+    //! Returns the number of logical strings whose visual mapping is cached.
+    static size_t getVisualCacheSize();
 
-    StrIndexList getL2vMapping() const
+    const StrIndexList& getL2vMapping() const
         {return d_l2vMapping;}
 
-    StrIndexList getV2lMapping() const
+    const StrIndexList& getV2lMapping() const
         {return d_v2lMapping;}
 
     const String& getTextVisual() const
@@ -30,6 +30,7 @@
 #include "CEGUI/Image.h"
 #include "CEGUI/String.h"
 #include "CEGUI/Rectf.h"
+#include "CEGUI/Renderer.h"
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -52,6 +53,9 @@ public:
     std::vector<GeometryBuffer*> createRenderGeometry(
         const ImageRenderSettings& render_settings) const override;
 
+    void appendRenderGeometry(std::vector<GeometryBuffer*>& geomBuffers,
+        const ImageRenderSettings& render_settings) const override;
+
     void addToRenderGeometry(
         GeometryBuffer& geomBuffer,
         const Rectf& renderArea,
@@ -76,30 +80,37 @@ public:
     */
     const Texture* getTexture() const;
 
-protected:
     /*!
     \brief
-        Fills the vertices data for the textured quad based on the supplied
-        parameters. The supplied pointer must point to an array of size 6
-        for the quad.
+        Sets the default shader type of the GeometryBuffers created for this
+        Image, DefaultShaderType::Textured unless set otherwise.
+
+        Images whose Texture holds a signed distance field in the alpha
+        channel use DefaultShaderType::DistanceField.
     */
-    void createTexturedQuadVertices(
-        TexturedColouredVertex* vbuffer,
-        const CEGUI::ColourRect& colours,
-        Rectf& finalRect,
-        const Rectf& texRect) const;
+    void setShaderType(DefaultShaderType shaderType) { d_shaderType = shaderType; }
+
+    //! Returns the default shader type of the GeometryBuffers created for this Image.
+    DefaultShaderType getShaderType() const { return d_shaderType; }
 
     /*!
     \brief
-        Helper function for calculating the tecture and render areas.
+        Calculates the unclipped quad that draws this Image to \a renderArea,
+        as passed to GeometryBuffer::appendTexturedQuads.
+
+    \param destArea
+        Receives \a renderArea moved by the rendering offset of the Image.
+
+    \param texArea
+        Receives the texture coordinates of the Image.
     */
-    bool calculateTextureAreaAndRenderArea(
-        const Rectf& renderSettingDestArea,
-        const Rectf* clippingArea,
-        Rectf &finalRect, Rectf &texRect) const;
+    void getQuadAreas(const Rectf& renderArea, Rectf& destArea, Rectf& texArea) const;
 
+protected:
     //! Texture used by this image.
     Texture* d_texture;
+    //! Default shader type of the GeometryBuffers created for this image.
+    DefaultShaderType d_shaderType;
 };
 
 } // End of  CEGUI namespace section
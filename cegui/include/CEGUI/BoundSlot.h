@@ -29,6 +29,7 @@
 
 #include "CEGUI/Base.h"
 #include "CEGUI/SubscriberSlot.h"
+#include "CEGUI/SmallObjectPool.h"
 
 namespace CEGUI
 {
@@ -40,7 +41,8 @@ namespace CEGUI
     reference counted pointer.  When a BoundSlot is deleted, the connection is
     unsubscribed and the SubscriberSlot is deleted.
 */
-class CEGUIEXPORT BoundSlot final
+class CEGUIEXPORT BoundSlot final :
+    public PoolAllocatedObject<MemoryCategory::Event>
 {
 public:
     typedef unsigned int Group;
@@ -70,7 +72,7 @@ public:
         Returns whether the slot which this object is tracking is still
         internally connected to the event.
     */
-    bool connected() const { return d_subscriber && d_subscriber->connected(); }
+    bool connected() const { return d_subscriber.connected(); }
 
     /*!
     \brief
@@ -92,7 +94,7 @@ public:
         - true if the BoundSlot objects represent the same connection.
         - false if the BoundSlot objects represent different connections.
     */
-    bool operator ==(const BoundSlot& other) const { return d_subscriber == other.d_subscriber; }
+    bool operator ==(const BoundSlot& other) const { return this == &other; }
 
     /*!
     \brief
@@ -112,7 +114,7 @@ private:
     friend class Event;
 
     Group           d_group;        //! The group the slot subscription used.
-    SubscriberSlot* d_subscriber;   //! The actual slot object.
+    SubscriberSlot  d_subscriber;   //! The actual slot object.
     Event*          d_event;        //! The event to which the slot was attached
 };
 
@@ -0,0 +1,176 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIBundleResourceProvider_h_
+#define _CEGUIBundleResourceProvider_h_
+
+#include "CEGUI/DefaultResourceProvider.h"
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    DefaultResourceProvider that also serves the files of resource bundles,
+    as written by ResourceBundleWriter.
+
+    A bundle holds a scheme and the files it depends on in one file, which is
+    mapped into memory when mounted. Files the bundle stores as they are,
+    such as images and fonts, are lent from the mapping without copying.
+    XML files are stored as PreparsedXML recordings, which
+    XMLParser::parseXMLFile replays through loadPreparsedXML instead of
+    parsing them. Files that are not in a mounted bundle are loaded as the
+    DefaultResourceProvider loads them.
+
+    A bundle is laid out as follows, all numbers little endian:
+    - the magic "CEGUIBND" and the format version as a 32 bit number.
+    - the string table: its size followed by every string as its size and
+      its UTF-8 bytes.
+    - the string indices of the filename and resource group of the scheme.
+    - the file table: its size followed by, for each file, the string
+      indices of its resource group and filename, its EntryType, padding and
+      the 64 bit offset of its data from the start of the bundle and size.
+    - the data of the files, each starting on a multiple of DataAlignment.
+*/
+class CEGUIEXPORT BundleResourceProvider : public DefaultResourceProvider
+{
+public:
+    //! Version of the format, bundles of other versions are rejected.
+    static const std::uint32_t FormatVersion;
+    //! Bytes every bundle starts with.
+    static const char FormatMagic[8];
+    //! Alignment in bytes of the data of the files in a bundle.
+    static const size_t DataAlignment;
+    //! String index standing for no string, used for bundles without a scheme.
+    static const std::uint32_t NoString;
+
+    //! How a file is stored in a bundle.
+    enum class EntryType : std::uint32_t
+    {
+        //! The bytes of the file as they are.
+        Raw,
+        //! The recording of an XML file written by PreparsedXML::write.
+        Recording
+    };
+
+    //! The scheme a bundle was made for.
+    struct BundledScheme
+    {
+        String d_filename;
+        String d_resourceGroup;
+    };
+
+    BundleResourceProvider();
+    ~BundleResourceProvider() override;
+
+    BundleResourceProvider(const BundleResourceProvider&) = delete;
+    BundleResourceProvider& operator=(const BundleResourceProvider&) = delete;
+
+    /*!
+    \brief
+        Maps the bundle \a filename of \a resourceGroup into memory and
+        serves its files from then on. Files of later bundles take
+        precedence over files of the same name in earlier ones.
+
+        The bundle is read rather than mapped where files can not be mapped.
+        It is kept until the provider is destroyed, as loaded data may refer
+        to it. Bundles must not be mounted while files are loaded on other
+        threads.
+
+    \return
+        The scheme the bundle was made for, with an empty filename if none.
+
+    \exception FileIOException
+        thrown if the bundle can not be loaded or is not a valid bundle of
+        the current format version.
+    */
+    BundledScheme mountBundle(const String& filename, const String& resourceGroup = "");
+
+    //! Returns the number of bundles mounted.
+    size_t getMountedBundleCount() const { return d_bundles.size(); }
+
+    //! Returns whether a mounted bundle holds \a filename of \a resourceGroup.
+    bool isBundled(const String& filename, const String& resourceGroup) const;
+
+    /*!
+    \brief
+        Lends the data of bundled files from the bundle. Bundled XML files
+        are handed out as their recording, as written by
+        PreparsedXML::write.
+    */
+    void loadRawDataContainer(const String& filename, RawDataContainer& output,
+                              const String& resourceGroup) override;
+    bool loadPreparsedXML(const String& filename, PreparsedXML& output,
+                          const String& resourceGroup) override;
+    void readRawDataChunks(const String& filename, const ReadChunkCallback& callback,
+                           const String& resourceGroup) override;
+    size_t getResourceGroupFileNames(std::vector<String>& out_vec,
+                                     const String& file_pattern,
+                                     const String& resource_group) override;
+    bool isResourceAvailable(const String& filename, const String& resourceGroup) override;
+
+    //! Returns 0 for bundled files, which do not change while mounted.
+    std::uint64_t getResourceVersion(const String& filename, const String& resourceGroup) override;
+
+protected:
+    //! A file in a mounted bundle.
+    struct Entry
+    {
+        String d_resourceGroup;
+        String d_filename;
+        const std::uint8_t* d_data;
+        size_t d_size;
+        EntryType d_type;
+    };
+
+    //! Returns the key of \a filename of \a resourceGroup in d_entries.
+    String makeKey(const String& filename, const String& resourceGroup) const;
+    //! Returns the bundled file \a filename of \a resourceGroup, or nullptr.
+    const Entry* findEntry(const String& filename, const String& resourceGroup) const;
+
+    //! The data of the mounted bundles.
+    std::vector<std::unique_ptr<RawDataContainer>> d_bundles;
+    //! Files of the mounted bundles by resource group and filename.
+    std::unordered_map<String, Entry> d_entries;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIBundleResourceProvider_h_
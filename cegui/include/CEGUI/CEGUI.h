@@ -62,8 +62,10 @@
 #include "CEGUI/FormattedRenderedString.h"
 #include "CEGUI/GeometryBuffer.h"
 #include "CEGUI/GlobalEventSet.h"
+#include "CEGUI/GradientImage.h"
 #include "CEGUI/GUIContext.h"
 #include "CEGUI/HorizontalAlignment.h"
+#include "CEGUI/HotReloader.h"
 #include "CEGUI/Image.h"
 #include "CEGUI/ImageCodec.h"
 #include "CEGUI/ImageManager.h"
@@ -79,6 +81,7 @@
 #include "CEGUI/Logger.h"
 #include "CEGUI/Cursor.h"
 #include "CEGUI/NamedElement.h"
+#include "CEGUI/Observable.h"
 #include "CEGUI/Property.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/PropertySet.h"
@@ -93,6 +96,7 @@
 #include "CEGUI/RenderedStringWidgetComponent.h"
 #include "CEGUI/RenderedStringWordWrapper.h"
 #include "CEGUI/RenderEffect.h"
+#include "CEGUI/InPlaceRenderEffect.h"
 #include "CEGUI/RenderEffectManager.h"
 #include "CEGUI/Renderer.h"
 #include "CEGUI/RenderingContext.h"
@@ -107,6 +111,7 @@
 #include "CEGUI/SemanticInputEvent.h"
 #include "CEGUI/SimpleTimer.h"
 #include "CEGUI/Sizef.h"
+#include "CEGUI/SpatialNavigationStrategy.h"
 #include "CEGUI/USize.h"
 #include "CEGUI/String.h"
 #include "CEGUI/StringTranscoder.h"
@@ -0,0 +1,191 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUICachingResourceProvider_h_
+#define _CEGUICachingResourceProvider_h_
+
+#include "CEGUI/ResourceProvider.h"
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    ResourceProvider keeping the files loaded through another provider in
+    memory, so that loading the same file again does not read it again.
+
+    The files are kept in least recently used order up to a memory budget.
+    A cached file is shared by everyone loading it: loadShared returns a
+    reference counted container and loadRawDataContainer lends the cached
+    data, which is then read-only, until it is passed to
+    unloadRawDataContainer. Files evicted from the cache stay alive as long as
+    they are referenced. Data that the wrapped provider already lends out,
+    such as stored entries of a MinizipResourceProvider, is not cached.
+
+    The provider may wrap any other, including a CompositeResourceProvider.
+    Files changed on disk are only read again once they were evicted, or
+    after a call to invalidate or clear.
+*/
+class CEGUIEXPORT CachingResourceProvider : public ResourceProvider
+{
+public:
+    //! Default value of the memory budget in bytes.
+    static const size_t DefaultMemoryBudget;
+
+    /*!
+    \brief
+        Constructor.
+
+    \param provider
+        The provider loading the files, ownership is taken.
+
+    \param memoryBudget
+        Number of bytes of file data the cache may keep.
+    */
+    explicit CachingResourceProvider(ResourceProvider* provider,
+                                     size_t memoryBudget = DefaultMemoryBudget);
+    ~CachingResourceProvider() override;
+
+    CachingResourceProvider(const CachingResourceProvider&) = delete;
+    CachingResourceProvider& operator=(const CachingResourceProvider&) = delete;
+
+    //! Returns the provider loading the files.
+    ResourceProvider* getProvider() const { return d_provider; }
+
+    /*!
+    \brief
+        Returns the data of a file, loading it if it is not cached.
+
+        The container must be released before this provider is destroyed.
+
+    \exception
+        Any exception thrown by the wrapped provider while loading the file.
+    */
+    std::shared_ptr<const RawDataContainer> loadShared(const String& filename,
+                                                       const String& resourceGroup);
+
+    void loadRawDataContainer(const String& filename, RawDataContainer& output,
+                              const String& resourceGroup) override;
+    void unloadRawDataContainer(RawDataContainer& data) override;
+    size_t getResourceGroupFileNames(std::vector<String>& out_vec,
+                                     const String& file_pattern,
+                                     const String& resource_group) override;
+    bool isResourceAvailable(const String& filename, const String& resourceGroup) override;
+
+    //! Passes the call on to the wrapped provider, recordings are not cached.
+    bool loadPreparsedXML(const String& filename, PreparsedXML& output,
+                          const String& resourceGroup) override
+    {
+        return d_provider->loadPreparsedXML(filename, output, resourceGroup);
+    }
+
+    bool isThreadSafe() const override { return d_provider->isThreadSafe(); }
+
+    /*!
+    \brief
+        Sets the number of bytes of file data the cache may keep, evicting
+        the least recently used files that no longer fit.
+    */
+    void setMemoryBudget(size_t bytes);
+    //! Returns the number of bytes of file data the cache may keep.
+    size_t getMemoryBudget() const;
+    //! Returns the number of bytes of file data the cache keeps.
+    size_t getMemoryUsage() const;
+    //! Returns the number of files the cache keeps.
+    size_t getCachedFileCount() const;
+
+    //! Removes a file from the cache, so that it is read again on its next load.
+    void invalidate(const String& filename, const String& resourceGroup);
+    //! Removes all files from the cache.
+    void clear();
+
+    //! Returns the number of loads served from the cache.
+    std::size_t getHitCount() const;
+    //! Returns the number of loads that had to read the file.
+    std::size_t getMissCount() const;
+    //! Returns the number of files evicted to stay within the memory budget.
+    std::size_t getEvictionCount() const;
+
+    /*!
+    \brief
+        Returns the ratio of loads served from the cache, in the range [0, 1].
+        Returns 0 if no loads were made yet.
+    */
+    float getHitRate() const;
+
+    //! Resets the hit, miss and eviction counters.
+    void resetStatistics();
+
+private:
+    //! A cached file, the list of them is kept in most recently used order.
+    struct CachedFile
+    {
+        String d_key;
+        std::shared_ptr<const RawDataContainer> d_data;
+    };
+
+    typedef std::list<CachedFile> CachedFileList;
+    //! Data lent by loadRawDataContainer along with the number of loans.
+    typedef std::pair<std::shared_ptr<const RawDataContainer>, size_t> Loan;
+
+    //! Returns the cache key of a file.
+    String makeKey(const String& filename, const String& resourceGroup) const;
+    //! Evicts files until the memory budget is met. d_mutex must be locked.
+    void evict(CachedFileList& evicted);
+
+    ResourceProvider* d_provider;
+    size_t d_memoryBudget;
+    size_t d_memoryUsage;
+
+    CachedFileList d_files;
+    std::unordered_map<String, CachedFileList::iterator> d_index;
+    std::unordered_map<const std::uint8_t*, Loan> d_loans;
+
+    std::size_t d_hitCount;
+    std::size_t d_missCount;
+    std::size_t d_evictionCount;
+
+    //! Guards all of the above except d_provider.
+    mutable std::mutex d_mutex;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUICachingResourceProvider_h_
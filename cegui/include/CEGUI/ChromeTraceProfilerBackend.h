@@ -0,0 +1,89 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIChromeTraceProfilerBackend_h_
+#define _CEGUIChromeTraceProfilerBackend_h_
+
+#include "CEGUI/Profiler.h"
+#include <chrono>
+#include <iosfwd>
+#include <mutex>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    ProfilerBackend recording the zones in memory and writing them out in
+    the JSON trace event format read by chrome://tracing and Perfetto.
+*/
+class CEGUIEXPORT ChromeTraceProfilerBackend : public ProfilerBackend
+{
+public:
+    ChromeTraceProfilerBackend();
+
+    std::uint64_t beginZone(const ProfileZone& zone) override;
+    void endZone(const ProfileZone& zone, std::uint64_t token) override;
+
+    //! Writes all zones recorded so far as a JSON trace to \a out.
+    void writeTrace(std::ostream& out) const;
+
+    //! Returns the number of zones recorded so far.
+    std::size_t getEventCount() const;
+
+    //! Discards the recorded zones.
+    void clear();
+
+private:
+    //! A zone that was left, times in nanoseconds since construction.
+    struct Event
+    {
+        const ProfileZone* d_zone;
+        std::uint64_t d_start;
+        std::uint64_t d_duration;
+        std::uint32_t d_thread;
+    };
+
+    std::uint64_t getElapsedTime() const;
+
+    std::chrono::steady_clock::time_point d_origin;
+    std::vector<Event> d_events;
+    mutable std::mutex d_mutex;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIChromeTraceProfilerBackend_h_
@@ -0,0 +1,75 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIClipRegion_h_
+#define _CEGUIClipRegion_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/Rectf.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Clipping region shared by all the GeometryBuffers of a Window.
+
+    A Window owns one ClipRegion per rendering surface and hands it to each of
+    its buffers via GeometryBuffer::setClipRegion. When the clipping of the
+    window changes only the ClipRegion is updated; the buffers see the new
+    region without being touched. Windows clipped exactly like their parent
+    share the ClipRegion of the parent, so a change of the parent's clipping
+    reaches all such descendants at once, and renderers can batch buffers
+    using the same ClipRegion without comparing their rectangles.
+*/
+class CEGUIEXPORT ClipRegion
+{
+public:
+    ClipRegion();
+
+    /*!
+    \brief
+        Sets the clipping region. The region used for rendering is prepared
+        once here by clamping negative values to 0.
+    */
+    void setRegion(const Rectf& region);
+
+    //! Returns the clipping region as it was set.
+    const Rectf& getRegion() const { return d_region; }
+
+    //! Returns the clipping region clamped to 0, for use in rendering.
+    const Rectf& getPreparedRegion() const { return d_preparedRegion; }
+
+private:
+    //! The region that was set, may contain negative values.
+    Rectf d_region;
+    //! The region clamped to 0.
+    Rectf d_preparedRegion;
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIClipRegion_h_
@@ -32,6 +32,12 @@
 
 #include "CEGUI/Base.h"
 
+#if defined(CEGUI_SIMD_SSE2)
+#   include <emmintrin.h>
+#elif defined(CEGUI_SIMD_NEON)
+#   include <arm_neon.h>
+#endif
+
 namespace CEGUI
 {
 typedef std::uint32_t argb_t;    //!< 32 bit ARGB representation of a colour.
@@ -46,9 +52,33 @@ public:
 	/*************************************************************************
 		Construction & Destruction
 	*************************************************************************/
-	Colour(void);
-	Colour(const Colour& val);
-	Colour(float red, float green, float blue, float alpha = 1.0f);
+	Colour(void) :
+        d_alpha(1.0f),
+        d_red(0.0f),
+        d_green(0.0f),
+        d_blue(0.0f),
+        d_argb(0xFF000000),
+        d_argbValid(true)
+    {}
+
+	Colour(const Colour& val) :
+        d_alpha(val.d_alpha),
+        d_red(val.d_red),
+        d_green(val.d_green),
+        d_blue(val.d_blue),
+        d_argb(val.d_argb),
+        d_argbValid(val.d_argbValid)
+    {}
+
+	Colour(float red, float green, float blue, float alpha = 1.0f) :
+        d_alpha(alpha),
+        d_red(red),
+        d_green(green),
+        d_blue(blue),
+        d_argb(0x00000000),
+        d_argbValid(false)
+    {}
+
 	Colour(argb_t argb);
 
 	/*************************************************************************
@@ -70,6 +100,27 @@ public:
 	float	getGreen(void) const	{return d_green;}
 	float	getBlue(void) const		{return d_blue;}
 
+    /*!
+    \brief
+        Writes the components in red, green, blue, alpha order to \a rgba,
+        which is the layout of the colour of the vertices.
+    */
+    inline void getRGBA(float* rgba) const
+    {
+#if defined(CEGUI_SIMD_SSE2)
+        const Components c = loadComponents();
+        _mm_storeu_ps(rgba, _mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 3, 2, 1)));
+#elif defined(CEGUI_SIMD_NEON)
+        const Components c = loadComponents();
+        vst1q_f32(rgba, vextq_f32(c, c, 1));
+#else
+        rgba[0] = d_red;
+        rgba[1] = d_green;
+        rgba[2] = d_blue;
+        rgba[3] = d_alpha;
+#endif
+    }
+
     /*!
     \brief
         Calculates and returns the hue value based on the Colour
@@ -220,46 +271,36 @@ public:
 
 	inline Colour operator+(const Colour& val) const
     {
-        return Colour(
-            d_red   + val.d_red, 
-            d_green + val.d_green, 
-            d_blue  + val.d_blue,
-            d_alpha + val.d_alpha
-        );
+        return Colour(add(loadComponents(), val.loadComponents()));
     }
 
 	inline Colour operator-(const Colour& val) const
     {
-        return Colour(
-            d_red   - val.d_red,
-            d_green - val.d_green,
-            d_blue  - val.d_blue,
-            d_alpha - val.d_alpha
-        );
+        return Colour(sub(loadComponents(), val.loadComponents()));
     }
 
 	inline Colour operator*(const float val) const
     {       
-        return Colour(
-            d_red   * val, 
-            d_green * val, 
-            d_blue  * val,
-            d_alpha * val 
-        );  
+        return Colour(mul(loadComponents(), val));
     }
 
     inline Colour& operator*=(const Colour& val)
     {
-        d_red *= val.d_red;
-        d_blue *= val.d_blue;
-        d_green *= val.d_green;
-        d_alpha *= val.d_alpha;
-
-		d_argbValid = false;
-
+        storeComponents(mul(loadComponents(), val.loadComponents()));
         return *this;
     }
 
+    /*!
+    \brief
+        Returns the colour at \a t on the way from \a from to \a to,
+        i.e. (to - from) * t + from.
+    */
+    static inline Colour lerp(const Colour& from, const Colour& to, float t)
+    {
+        const Components start = from.loadComponents();
+        return Colour(add(mul(sub(to.loadComponents(), start), t), start));
+    }
+
 	/*************************************************************************
 		Compare operators
 	*************************************************************************/
@@ -304,6 +345,95 @@ public:
 
 
 private:
+	/*************************************************************************
+		Component vector, holding the four components in member order
+		(alpha, red, green, blue) so that they are loaded and stored at once.
+	*************************************************************************/
+#if defined(CEGUI_SIMD_SSE2)
+    typedef __m128 Components;
+
+    Components loadComponents() const { return _mm_loadu_ps(&d_alpha); }
+    void storeComponents(Components c)
+    {
+        _mm_storeu_ps(&d_alpha, c);
+        d_argbValid = false;
+    }
+
+    static Components add(Components a, Components b) { return _mm_add_ps(a, b); }
+    static Components sub(Components a, Components b) { return _mm_sub_ps(a, b); }
+    static Components mul(Components a, Components b) { return _mm_mul_ps(a, b); }
+    static Components mul(Components a, float b) { return _mm_mul_ps(a, _mm_set1_ps(b)); }
+#elif defined(CEGUI_SIMD_NEON)
+    typedef float32x4_t Components;
+
+    Components loadComponents() const { return vld1q_f32(&d_alpha); }
+    void storeComponents(Components c)
+    {
+        vst1q_f32(&d_alpha, c);
+        d_argbValid = false;
+    }
+
+    static Components add(Components a, Components b) { return vaddq_f32(a, b); }
+    static Components sub(Components a, Components b) { return vsubq_f32(a, b); }
+    static Components mul(Components a, Components b) { return vmulq_f32(a, b); }
+    static Components mul(Components a, float b) { return vmulq_n_f32(a, b); }
+#else
+    struct Components
+    {
+        float d_alpha, d_red, d_green, d_blue;
+    };
+
+    Components loadComponents() const
+    {
+        const Components c = { d_alpha, d_red, d_green, d_blue };
+        return c;
+    }
+
+    void storeComponents(const Components& c)
+    {
+        d_alpha = c.d_alpha;
+        d_red = c.d_red;
+        d_green = c.d_green;
+        d_blue = c.d_blue;
+        d_argbValid = false;
+    }
+
+    static Components add(const Components& a, const Components& b)
+    {
+        const Components c = { a.d_alpha + b.d_alpha, a.d_red + b.d_red,
+                               a.d_green + b.d_green, a.d_blue + b.d_blue };
+        return c;
+    }
+
+    static Components sub(const Components& a, const Components& b)
+    {
+        const Components c = { a.d_alpha - b.d_alpha, a.d_red - b.d_red,
+                               a.d_green - b.d_green, a.d_blue - b.d_blue };
+        return c;
+    }
+
+    static Components mul(const Components& a, const Components& b)
+    {
+        const Components c = { a.d_alpha * b.d_alpha, a.d_red * b.d_red,
+                               a.d_green * b.d_green, a.d_blue * b.d_blue };
+        return c;
+    }
+
+    static Components mul(const Components& a, float b)
+    {
+        const Components c = { a.d_alpha * b, a.d_red * b,
+                               a.d_green * b, a.d_blue * b };
+        return c;
+    }
+#endif
+
+    //! Constructs the colour from a component vector.
+    explicit Colour(const Components& c) :
+        d_argb(0x00000000)
+    {
+        storeComponents(c);
+    }
+
 	/*************************************************************************
 		Implementation Methods
 	*************************************************************************/
@@ -316,7 +446,8 @@ private:
 	/*************************************************************************
 		Implementation Data
 	*************************************************************************/
-	float d_alpha, d_red, d_green, d_blue;		//!< Colour components.
+	//! Colour components, contiguous as the component vector relies on.
+	float d_alpha, d_red, d_green, d_blue;
 	mutable argb_t d_argb;						//!< Colour as ARGB value.
 	mutable bool d_argbValid;					//!< True if argb value is valid.
 };
@@ -162,14 +162,17 @@ protected:
     static const float LAB_B_DIFF;
 
     void initColourPickerControlsImageSet();
-    void deinitColourPickerControlsTexture();
-    void refreshColourPickerControlsTextures();
+    void deinitColourPickerControlsImages();
+    void refreshColourPickerControlsImages();
 
     void refreshColourSliderImage();
     void refreshColourPickingImage();
     void refreshAlphaSliderImage();
 
-    void reloadColourPickerControlsTexture();
+    //! Colour functions of the gradient images, see GradientImage::ColourFunction
+    Colour getColourPickingImageColour(const glm::vec2& relPos);
+    Colour getColourSliderImageColour(const glm::vec2& relPos);
+    Colour getAlphaSliderImageColour(const glm::vec2& relPos);
 
     Lab_Colour getColourSliderPositionColourLAB(float value);
     Lab_Colour getColourPickingPositionColourLAB(float xAbs, float yAbs);
@@ -177,8 +180,6 @@ protected:
     HSV_Colour getColourSliderPositionColourHSV(float value);
     HSV_Colour getColourPickingPositionColourHSV(float xAbs, float yAbs);
 
-    RGB_Colour getAlphaSliderPositionColour(int x, int y);
-
     glm::vec2 getColourPickingColourPosition();
     void getColourPickingColourPositionHSV(float& x, float& y);
 
@@ -209,7 +210,6 @@ protected:
     void refreshColourPickerIndicatorPosition(const CursorInputEventArgs& pointerEventArgs);
     void refreshAlpha();
 
-    void refreshOnlyColourSliderImage();
     bool handleColourPickerSliderValueChanged(const EventArgs& args);
     bool handleAlphaSliderValueChanged(const EventArgs& args);
 
@@ -284,9 +284,11 @@ protected:
     //! Previously selected colour of the ColourPickerControls
     Colour d_previouslySelectedColour;
 
-    TextureTarget* d_colourPickerControlsTextureTarget;
+    //! Procedural images drawing the picking area and the slider gradients
+    GradientImage* d_colourPickingImage;
+    GradientImage* d_colourSliderImage;
+    GradientImage* d_alphaSliderImage;
 
-    int d_colourPickerImageOffset;
     int d_colourPickerPickingImageHeight;
     int d_colourPickerPickingImageWidth;
     int d_colourPickerColourSliderImageWidth;
@@ -294,12 +296,8 @@ protected:
     int d_colourPickerAlphaSliderImageWidth;
     int d_colourPickerAlphaSliderImageHeight;
 
-    int d_colourPickerControlsTextureSize;
-
     bool d_draggingColourPickerIndicator;
 
-    RGB_Colour* d_colourPickingTexture;
-
     bool d_ignoreEvents;
     RegexMatcher& d_regexMatcher;
 };
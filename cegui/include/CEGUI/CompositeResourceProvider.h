@@ -115,6 +115,9 @@ public:
   size_t getResourceGroupFileNames(std::vector<String>& out_vec,
          const String& file_pattern,
          const String& resource_group) override;
+  //! Returns the recording of the first provider that holds one of the file.
+  bool loadPreparsedXML(const String& filename, PreparsedXML& output,
+        const String& resourceGroup) override;
 protected:
   typedef std::unordered_map<String, ResourceProvider*> Providermap;
   Providermap  d_providerlist;
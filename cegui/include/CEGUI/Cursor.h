@@ -45,6 +45,44 @@ namespace CEGUI
 {
 class GUIContext;
 
+/*!
+\brief
+    Interface for showing the cursor image through the windowing system, e.g.
+    with SDL_CreateColorCursor or CreateIconIndirect, instead of drawing it as
+    CEGUI geometry.
+
+    A native cursor moves at the rate of the OS rather than at the frame rate
+    of the application. CEGUI still tracks the cursor position and its
+    constraint area for input handling.
+*/
+class CEGUIEXPORT NativeCursorProvider
+{
+public:
+    virtual ~NativeCursorProvider();
+
+    /*!
+    \brief
+        Shows \a image as the native cursor.
+
+    \param image
+        The Image to show, or 0 to hide the native cursor.
+
+    \param size
+        Size in pixels the image is to be shown at.
+
+    \param hotSpot
+        Position within the image, in pixels of \a size, which is at the
+        cursor position.
+
+    \return
+        true if the native cursor shows \a image. false to have the Cursor
+        draw the image as geometry instead; the provider should then hide
+        the native cursor.
+    */
+    virtual bool setCursorImage(const Image* image, const Sizef& size,
+                                const glm::vec2& hotSpot) = 0;
+};
+
 //!	Class that provides cursor support.
 class CEGUIEXPORT Cursor : public EventSet
 {
@@ -227,7 +265,7 @@ public:
 	\return
 		Nothing.
 	*/
-	void	hide(void)		{d_visible = false;}
+	void	hide(void)		{setVisible(false);}
 
 
 	/*!
@@ -237,7 +275,7 @@ public:
 	\return
 		Nothing.
 	*/
-	void	show(void)		{d_visible = true;}
+	void	show(void)		{setVisible(true);}
 
 
     /*!
@@ -250,7 +288,7 @@ public:
     \return
         Nothing.
     */
-    void    setVisible(bool visible)    {d_visible = visible;}
+    void    setVisible(bool visible);
 
 
 	/*!
@@ -368,6 +406,27 @@ public:
     */
     void invalidate();
 
+    /*!
+    \brief
+        Set the provider used to show the cursor image through the windowing
+        system.
+
+        While the provider accepts the image, the cursor creates no geometry
+        and draw() does nothing; only the position and the constraint area
+        are maintained.
+
+    \param provider
+        The NativeCursorProvider to use, or 0 to draw the cursor as geometry.
+        The provider is not owned by the Cursor.
+    */
+    void setNativeProvider(NativeCursorProvider* provider);
+
+    //! Return the provider of the native cursor, or 0 if none is set.
+    NativeCursorProvider* getNativeProvider() const { return d_nativeProvider; }
+
+    //! Return whether the cursor image is currently shown by the native provider.
+    bool isUsingNativeCursor() const { return d_nativeCursorActive; }
+
 protected:
 	/*************************************************************************
 		New event handlers
@@ -415,6 +474,9 @@ private:
     */
     void updateGeometryBuffersClipping(const Rectf& clipping_area);
 
+    //! Passes the current image and visibility to the native provider, if any.
+    void updateNativeCursor();
+
 
 	/*************************************************************************
 		Implementation Data
@@ -443,6 +505,10 @@ private:
     static glm::vec2 s_initialPosition;
     //! boolean indicating whether cached cursor geometry is valid.
     mutable bool d_cachedGeometryValid;
+    //! Provider showing the cursor through the windowing system, if any.
+    NativeCursorProvider* d_nativeProvider;
+    //! true if d_nativeProvider shows the cursor image.
+    bool d_nativeCursorActive;
 };
 
 } // End of  CEGUI namespace section
@@ -51,7 +51,9 @@ public:
 	*/
     RawDataContainer()
       : mData(nullptr),
-        mSize(0)
+        mSize(0),
+        mMapped(false),
+        mBorrowed(false)
     {
     }
 
@@ -74,7 +76,55 @@ public:
 	\param data
         Pointer to the uint8 data buffer.
 	*/
-    void setData(std::uint8_t* data) { mData = data; }
+    void setData(std::uint8_t* data) { mData = data; mMapped = false; mBorrowed = false; }
+
+	/*!
+	\brief
+		Set a copy-on-write view of a file mapped into memory as the data.
+
+		release() unmaps the view instead of deleting the data, so the data
+		may only come from mapping a file with MapViewOfFile on Windows or
+		mmap elsewhere.
+
+	\param data
+		Start of the mapped view.
+
+	\param size
+		Size of the mapped view in bytes.
+	*/
+    void setMappedData(std::uint8_t* data, size_t size)
+    {
+        mData = data;
+        mSize = size;
+        mMapped = true;
+        mBorrowed = false;
+    }
+
+	/*!
+	\brief
+		Set data owned by someone else, such as a range of a file mapped by
+		the ResourceProvider. release() only forgets the data, which must
+		stay valid until then and must not be written to.
+
+	\param data
+		Start of the data.
+
+	\param size
+		Size of the data in bytes.
+	*/
+    void setBorrowedData(const std::uint8_t* data, size_t size)
+    {
+        mData = const_cast<std::uint8_t*>(data);
+        mSize = size;
+        mMapped = false;
+        mBorrowed = true;
+    }
+
+	//! Return whether the data is owned by someone else.
+    bool isBorrowed() const { return mBorrowed; }
+
+	//! Return whether the data is a mapped view of a file.
+    bool isMapped() const { return mMapped; }
 
 	/*!
 	\brief
@@ -116,6 +166,10 @@ private:
 	*************************************************************************/
     std::uint8_t* mData;
     size_t mSize;
+    //! Whether mData is a mapped view of a file rather than a new[] array.
+    bool mMapped;
+    //! Whether mData is owned by someone else and must not be freed.
+    bool mBorrowed;
 };
 
 } // End of  CEGUI namespace section
@@ -31,8 +31,13 @@
 
 #include "CEGUI/Logger.h"
 #include <vector>
+#include <atomic>
+#include <condition_variable>
 #include <fstream>
+#include <mutex>
 #include <sstream>
+#include <string>
+#include <thread>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -55,11 +60,45 @@ public:
     DefaultLogger(void);
     ~DefaultLogger(void);
 
-    // overridden from Logger
+    // overridden from Logger, logEvent may be called from several threads
     void logEvent(const String& message, LoggingLevel level = LoggingLevel::Standard) override;
     void setLogFilename(const String& filename, bool append = false) override;
 
+    /*!
+    \brief
+        Sets whether log entries are written by a background thread.
+
+        In asynchronous mode logEvent only formats the entry and pushes it
+        onto a lock free queue; a writer thread takes the queued entries in
+        batches and writes them to the log file, flushing once per batch.
+        Entries logged before the log file is set are still cached as usual.
+
+        Disabling the mode stops the writer thread after all queued entries
+        were written. This function itself must not be called concurrently.
+    */
+    void setAsynchronous(bool enabled);
+
+    //! Returns whether log entries are written by a background thread.
+    bool isAsynchronous() const { return d_asynchronous; }
+
 protected:
+    //! A formatted log entry waiting for the writer thread.
+    struct QueuedEntry
+    {
+        QueuedEntry* d_next;
+        std::string d_text;
+        LoggingLevel d_level;
+    };
+
+    //! Writes a formatted entry to the log file, d_logMutex must be held.
+    void writeEntry(const std::string& text, LoggingLevel level);
+    //! Writes all queued entries in logging order, d_logMutex must be held.
+    void writeQueuedEntries();
+    //! Body of the writer thread.
+    void runWriter();
+    //! Stops the writer thread and writes what it left in the queue.
+    void stopWriter();
+
     //! Stream used to implement the logger
     std::ofstream d_ostream;
     //! Used to build log entry strings. 
@@ -70,7 +109,19 @@ protected:
     //! Used to cache log entries before log file is created. 
     Cache d_cache;
     //! true while log entries are being cached (prior to logfile creation)
-    bool d_caching;
+    std::atomic<bool> d_caching;
+    //! Serialises logEvent, which is reached from loading threads by exceptions.
+    std::mutex d_logMutex;
+
+    //! Whether logEvent queues the entries for the writer thread.
+    std::atomic<bool> d_asynchronous;
+    //! Queued entries, most recent first.
+    std::atomic<QueuedEntry*> d_queueHead;
+    std::thread d_writerThread;
+    //! Guards d_stopWriterRequested and the waiting of the writer thread.
+    std::mutex d_writerMutex;
+    std::condition_variable d_writerCondition;
+    bool d_stopWriterRequested;
 };
 
 }
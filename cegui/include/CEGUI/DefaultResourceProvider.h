@@ -45,6 +45,13 @@ namespace CEGUI
 class CEGUIEXPORT DefaultResourceProvider : public ResourceProvider
 {
 public:
+    //! Default value of the memory mapping threshold in bytes.
+    static const size_t DefaultMemoryMappingThreshold;
+    //! Default size in bytes of the chunks readRawDataChunks reads.
+    static const size_t DefaultReadChunkSize;
+
+    DefaultResourceProvider();
+    ~DefaultResourceProvider() override;
 
     /*!
     \brief
@@ -95,9 +102,58 @@ public:
 
     void loadRawDataContainer(const String& filename, RawDataContainer& output, const String& resourceGroup) override;
     void unloadRawDataContainer(RawDataContainer& data) override;
+
+    /*!
+    \brief
+        Reads the file in chunks of getReadChunkSize bytes, reusing one buffer
+        for all of them. Android assets are loaded completely and passed as a
+        single chunk.
+    */
+    void readRawDataChunks(const String& filename, const ReadChunkCallback& callback,
+                           const String& resourceGroup) override;
     size_t getResourceGroupFileNames(std::vector<String>& out_vec,
                                      const String& file_pattern,
                                      const String& resource_group) override;
+    bool isResourceAvailable(const String& filename, const String& resourceGroup) override;
+
+    /*!
+    \brief
+        Returns the modification time of the file combined with its size, 0 if
+        the file does not exist and always for Android assets.
+    */
+    std::uint64_t getResourceVersion(const String& filename, const String& resourceGroup) override;
+
+    /*!
+    \brief
+        Returns true: files are loaded on the TaskScheduler of the System by
+        loadRawDataContainerAsync. The resource group directories must not be
+        changed while such loads are pending.
+    */
+    bool isThreadSafe() const override { return true; }
+
+    /*!
+    \brief
+        Sets whether loadRawDataContainer maps large files into memory
+        instead of reading them into a new buffer. Enabled by default.
+
+        A mapped file is backed by the page cache of the system and its pages
+        are only copied when written to. The file must not be truncated while
+        the RawDataContainer holding it is loaded. Files of Android assets are
+        never mapped.
+    */
+    void setMemoryMappingEnabled(bool enabled) { d_memoryMappingEnabled = enabled; }
+    //! Returns whether loadRawDataContainer maps large files into memory.
+    bool isMemoryMappingEnabled() const { return d_memoryMappingEnabled; }
+
+    //! Sets the size in bytes from which files are mapped rather than read.
+    void setMemoryMappingThreshold(size_t bytes) { d_memoryMappingThreshold = bytes; }
+    //! Returns the size in bytes from which files are mapped rather than read.
+    size_t getMemoryMappingThreshold() const { return d_memoryMappingThreshold; }
+
+    //! Sets the size in bytes of the chunks readRawDataChunks reads, at least 1.
+    void setReadChunkSize(size_t bytes) { d_readChunkSize = bytes ? bytes : 1; }
+    //! Returns the size in bytes of the chunks readRawDataChunks reads.
+    size_t getReadChunkSize() const { return d_readChunkSize; }
 
 protected:
     /*!
@@ -108,8 +164,25 @@ protected:
     */
     String getFinalFilename(const String& filename, const String& resourceGroup) const;
 
+    /*!
+    \brief
+        Maps the file into memory as a copy-on-write view if it is at least
+        \a minSize bytes large.
+
+    \return
+        true if \a output holds the mapped file, false if the file should be
+        read instead. Always false on Android.
+    */
+    static bool mapFile(const String& filename, size_t minSize, RawDataContainer& output);
+
     typedef std::unordered_map<String, String> ResourceGroupMap;
     ResourceGroupMap    d_resourceGroups;
+    //! Whether large files are mapped into memory.
+    bool d_memoryMappingEnabled;
+    //! Size from which files are mapped into memory.
+    size_t d_memoryMappingThreshold;
+    //! Size of the chunks readRawDataChunks reads.
+    size_t d_readChunkSize;
 };
 
 } // End of  CEGUI namespace section
@@ -1150,9 +1150,29 @@ public:
 
     \param forceLayoutChildren
         - true - call children layout code even if we are not resized.
+
+    \note
+        When the element belongs to a GUIContext with deferred layout enabled,
+        the recomputation is postponed until GUIContext::updateLayout and
+        repeated notifications in between are merged into one.
     */
     void notifyScreenAreaChanged(bool adjust_size_to_content, bool forceLayoutChildren = false);
 
+    //! Return whether an area change of this element waits for the next layout pass.
+    bool isScreenAreaChangePending() const { return d_screenAreaChangePending; }
+
+    //! Return whether an area change of a descendant waits for the next layout pass.
+    bool isChildScreenAreaChangePending() const { return d_childScreenAreaChangePending; }
+
+    /*!
+    \brief
+        Apply the area changes that were deferred for this element and its
+        descendants, parents before their children.
+
+        Only the branches leading to elements with pending changes are visited.
+    */
+    void updatePendingScreenAreaChanges();
+
     /*!
     \brief Return the size of the root container (such as screen size).
 
@@ -1598,6 +1618,19 @@ protected:
     */
     void handleAreaChangesRecursively(bool moved);
 
+    /*!
+    \brief
+        Return whether notifyScreenAreaChanged should only mark this element
+        for the next layout pass instead of recomputing the area immediately.
+    */
+    virtual bool isScreenAreaChangeDeferred() const { return false; }
+
+    //! Recompute the area immediately, see notifyScreenAreaChanged.
+    void notifyScreenAreaChanged_impl(bool adjust_size_to_content, bool forceLayoutChildren);
+
+    //! Remember a deferred area change and mark the ancestors for the layout pass.
+    void markScreenAreaChangePending(bool adjust_size_to_content, bool forceLayoutChildren);
+
     /*************************************************************************
         Event trigger methods
     *************************************************************************/    
@@ -1780,6 +1813,14 @@ protected:
 
     //! If true, the position and size are pixel aligned
     bool d_pixelAligned;
+
+    //! true if a deferred area change of this element waits for the layout pass
+    bool d_screenAreaChangePending = false;
+    //! Arguments of the deferred notifyScreenAreaChanged calls, merged together
+    bool d_pendingAdjustSizeToContent = false;
+    bool d_pendingForceLayoutChildren = false;
+    //! true if some descendant of this element has a deferred area change
+    bool d_childScreenAreaChangePending = false;
 };
 
 } // End of  CEGUI namespace section
@@ -30,7 +30,9 @@
 #include "CEGUI/String.h"
 #include "CEGUI/BoundSlot.h"
 #include "CEGUI/RefCounted.h"
+#include "CEGUI/MemoryAllocator.h"
 #include <map>
+#include <vector>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -52,7 +54,8 @@ namespace CEGUI
     \note
         An Event object may not be copied.
 */
-class CEGUIEXPORT Event
+class CEGUIEXPORT Event :
+    public AllocatedObject<MemoryCategory::Event>
 {
 public:
     /*!
@@ -225,7 +228,7 @@ public:
     void operator()(EventArgs& args);
 
     //! \brief Returns the number of connections to this event
-    bool getConnectionCount() const { return d_slots.size(); }
+    std::size_t getConnectionCount() const { return d_slots.size() + d_pendingSlots.size(); }
 
 protected:
     friend void CEGUI::BoundSlot::disconnect();
@@ -245,9 +248,21 @@ protected:
     Event(const Event&) = default;
     Event& operator =(const Event&) = delete;
 
-    std::multimap<Group, Connection, std::less<Group>> d_slots;  //!< Collection holding ref-counted bound slots
+    //! Type of the collection of ref-counted bound slots with their group.
+    typedef std::vector<std::pair<Group, Connection>> SlotList;
+
+    //! Moves the slots subscribed while invoking into d_slots and drops disconnected ones.
+    void updateSlots();
+
+    //! Bound slots sorted by group, in subscription order within a group
+    SlotList d_slots;
+    //! Slots subscribed while invoking, merged into d_slots once that's done
+    SlotList d_pendingSlots;
     const String d_name;    //!< Name of this event
-    bool d_isBeingInvoked = false;
+    //! Number of nested invocations of operator() currently running
+    unsigned int d_invocationDepth = 0;
+    //! Whether slots in d_slots were disconnected while invoking
+    bool d_hasDisconnectedSlots = false;
 };
 
 } // End of  CEGUI namespace section
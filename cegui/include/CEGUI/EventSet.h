@@ -31,6 +31,7 @@
 
 #include "CEGUI/Event.h"
 #include "CEGUI/IteratorBase.h"
+#include "CEGUI/InternedName.h"
 #include <unordered_map>
 
 #if defined (_MSC_VER)
@@ -173,7 +174,7 @@ public:
     \brief
         Destructor for EventSet objects
     */
-    virtual ~EventSet() { removeAllEvents(); }
+    virtual ~EventSet();
 
     /*!
     \brief
@@ -215,7 +216,7 @@ public:
         String object containing the name of the Event to remove.  If no such
         Event exists, nothing happens.
     */
-    void removeEvent(const String& name) { d_events.erase(name); }
+    void removeEvent(const String& name) { d_events.erase(InternedName::find(name)); }
 
     /*!
     \brief
@@ -244,7 +245,10 @@ public:
         - true if an Event named \a name is defined for this EventSet.
         - false if no Event named \a name is defined for this EventSet.
     */
-    bool isEventPresent(const String& name) const { return d_events.find(name) != d_events.end(); }
+    bool isEventPresent(const String& name) const { return isEventPresent(InternedName::find(name)); }
+
+    //! \copydoc EventSet::isEventPresent
+    bool isEventPresent(const InternedName& name) const { return d_events.find(name) != d_events.end(); }
 
     /*!
     \brief
@@ -371,6 +375,73 @@ public:
     virtual void fireEvent(const String& name, EventArgs& args,
                            const String& eventNamespace = "");
 
+    /*!
+    \copydoc EventSet::fireEvent
+
+        This overload saves hashing the name of the Event to look it up.
+    */
+    void fireEvent(const InternedName& name, EventArgs& args,
+                   const String& eventNamespace = "");
+
+    /*!
+    \brief
+        Fires the named event like fireEvent, unless a BatchScope is active.
+        In that case a copy of \a args is queued and fired when the outermost
+        BatchScope ends. Firing the same event of the same EventSet again
+        while it is queued replaces the queued args, so subscribers see the
+        event only once, with the latest args, at the position where it was
+        first queued.
+
+        This is meant for notifications like EventSized or EventTextChanged,
+        where only the final state matters to subscribers. The 'handled' field
+        of \a args is not updated when the event is queued.
+
+    \param name
+        String object holding the name of the Event that is to be fired.
+
+    \param args
+        The EventArgs (or derived) object that is to be passed to each
+        subscriber of the Event. Args must be copy constructible.
+
+    \param eventNamespace
+        String object describing the global event namespace prefix for this
+        event.
+    */
+    template<typename Args>
+    void fireCoalescedEvent(const String& name, Args& args,
+                            const String& eventNamespace = "")
+    {
+        if (isBatching())
+            queueCoalescedEvent(name, new Args(args), eventNamespace);
+        else
+            fireEvent(name, args, eventNamespace);
+    }
+
+    /*!
+    \brief
+        Scope object which defers the events fired via fireCoalescedEvent
+        until it is destroyed.
+
+        Scopes nest, the queued events are fired when the outermost scope
+        ends. Events fired by subscribers while the queue is being flushed
+        are fired immediately. Queued events of an EventSet that is destroyed
+        before the flush are dropped.
+
+        Batching is per thread: a scope only defers the events fired on the
+        thread it was created on.
+    */
+    class CEGUIEXPORT BatchScope
+    {
+    public:
+        BatchScope();
+        ~BatchScope();
+        BatchScope(const BatchScope&) = delete;
+        BatchScope& operator=(const BatchScope&) = delete;
+    };
+
+    //! Return whether events fired via fireCoalescedEvent on the calling thread are currently queued.
+    static bool isBatching();
+
 
     /*!
     \brief
@@ -417,13 +488,28 @@ public:
     */
     Event* getEventObject(const String& name, bool autoAdd = false);
 
+    /*!
+    \copydoc EventSet::getEventObject
+
+        This overload saves hashing the name of the Event to look it up. No
+        Event is added for a name that is not interned.
+    */
+    Event* getEventObject(const InternedName& name, bool autoAdd = false);
+
 protected:
     //! Implementation event firing member
     void fireEvent_impl(const String& name, EventArgs& args);
+    //! \copydoc EventSet::fireEvent_impl
+    void fireEvent_impl(const InternedName& name, EventArgs& args);
     //! Helper to return the script module pointer or throw.
     ScriptModule* getScriptModule() const;
+    //! Queue \a args for firing \a name when the outermost BatchScope ends.
+    void queueCoalescedEvent(const String& name, EventArgs* args,
+                             const String& eventNamespace);
+    //! Called whenever an Event was added to the set, explicitly or on demand.
+    virtual void notifyEventAdded(const Event& /*event*/) {}
 
-    std::unordered_map<String, std::unique_ptr<Event>> d_events;
+    std::unordered_map<InternedName, std::unique_ptr<Event>> d_events;
 
     bool d_muted = false;    //!< true if events for this EventSet have been muted.
 
@@ -431,7 +517,7 @@ public:
     /*************************************************************************
         Iterator stuff
     *************************************************************************/
-    typedef ConstMapIterator<std::unordered_map<String, std::unique_ptr<Event>>> EventIterator;
+    typedef ConstMapIterator<std::unordered_map<InternedName, std::unique_ptr<Event>>> EventIterator;
 
     /*!
     \brief
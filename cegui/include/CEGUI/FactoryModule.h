@@ -53,6 +53,8 @@ public:
     void unregisterFactory(const String& type_name);
     //! Unregister factories for all object types in the module.
     unsigned int unregisterAllFactories();
+    //! Return whether the module has a factory for objects of the specified type.
+    bool isFactoryAvailable(const String& type_name) const;
 
 protected:
     //! Collection type that holds pointers to the factory registerer objects.
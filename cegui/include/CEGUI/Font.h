@@ -30,6 +30,11 @@
 #include "CEGUI/PropertySet.h"
 #include "CEGUI/EventSet.h"
 #include "CEGUI/Image.h"
+#include "CEGUI/MemoryAllocator.h"
+
+#include <bitset>
+#include <mutex>
+#include <string>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -51,7 +56,8 @@ namespace CEGUI
 */
 class CEGUIEXPORT Font :
     public PropertySet,
-    public EventSet
+    public EventSet,
+    public AllocatedObject<MemoryCategory::Font>
 {
 public:
     //! Colour value used whenever a colour is not specified.
@@ -140,6 +146,22 @@ public:
     */
     virtual bool isCodepointAvailable(char32_t codePoint) const = 0;
 
+    /*!
+    \brief
+        Prepares the glyphs of all code points in \a charset ahead of their
+        first use, e.g. while a loading screen is shown, so that the first
+        frames drawing such text do not have to rasterise them.
+
+        The glyphs are prepared in a single batch; fonts rasterising their
+        glyphs asynchronously queue the whole batch for the TaskScheduler.
+        The number of glyphs and the time taken are logged at the
+        Informative level.
+    */
+    void prepareGlyphs(const String& charset) const;
+
+    //! Prepares the glyphs of all available code points in [\a first, \a last] ahead of their first use.
+    void prepareGlyphRange(char32_t first, char32_t last) const;
+
     /*!
     \brief
         Create render geometry for the text that should be rendered into a
@@ -210,6 +232,40 @@ public:
         const glm::vec2& position, const Rectf* clip_rect,
         const bool clipping_enabled, const ColourRect& colours, const DefaultParagraphDirection defaultParagraphDir,
         const float space_extra = 0.0f) const;
+
+    //! Maximum number of text layouts kept for createTextRenderGeometry.
+    static const size_t TextLayoutCacheCapacity = 1024;
+
+    /*!
+    \brief
+        Removes all the text layouts cached by createTextRenderGeometry.
+
+        The layout of a text, i.e. the glyph images and their positions, is
+        kept per font, text, paragraph direction, extra spacing and sub-pixel
+        part of the position, so that drawing the same text again, such as the
+        many identical labels of a grid or a label whose colour changes on
+        hover, only needs to translate, clip and colour the cached glyphs into
+        new GeometryBuffers. The layouts are shared by all GUIContexts and
+        threads generating geometry. Fonts drop their
+        own layouts whenever their glyphs change; this function has to be
+        called when glyph images are destroyed behind the back of their font.
+    */
+    static void clearTextLayoutCache();
+
+    //! Returns the number of text layouts cached by createTextRenderGeometry.
+    static size_t getTextLayoutCount();
+
+    //! A glyph image placed by a text layout cached for createTextRenderGeometry.
+    struct TextLayoutGlyph
+    {
+        const Image* d_image;
+        //! Area of the glyph relative to the whole pixel the text is drawn at.
+        Rectf d_destArea;
+        //! Colours of the glyph, unless d_textColoured is set.
+        ColourRect d_colours;
+        //! Whether the glyph is drawn in the colours passed for the text.
+        bool d_textColoured;
+    };
   
     /*!
       \brief
@@ -331,7 +387,7 @@ public:
 
     \see getTextAdvance
     */
-    float getTextExtent(const String& text) const;
+    virtual float getTextExtent(const String& text) const;
 
     /*!
     \brief
@@ -367,7 +423,7 @@ public:
 
     \see getTextExtent
     */
-    float getTextAdvance(const String& text) const;
+    virtual float getTextAdvance(const String& text) const;
 
     /*!
     \brief
@@ -415,7 +471,7 @@ public:
         0 to text.length(), so may actually return an index past the end of
         the string, which indicates \a pixel was beyond the last character.
     */
-    size_t getCharAtPixel(const String& text, size_t start_char, float pixel) const;
+    virtual size_t getCharAtPixel(const String& text, size_t start_char, float pixel) const;
 
     /*!
     \brief
@@ -462,6 +518,16 @@ public:
     */
     virtual void updateFont() = 0;
 
+    /*!
+    \brief
+        Update the font after only the size it is rendered at changed, i.e.
+        its auto scaling factors or the font scale of the Renderer.
+
+        Like updateFont, this fires no events. The default implementation
+        calls updateFont, fonts able to keep their loaded data override it.
+    */
+    virtual void updateFontScale();
+
 protected:
     //! Constructor.
     Font(const String& name, const String& type_name, const String& filename,
@@ -487,14 +553,36 @@ protected:
         ImageRenderSettings imgRenderSettings,
         glm::vec2& glyph_pos) const;
 
+    //! Glyph quads waiting to be appended to an existing GeometryBuffer.
+    struct GlyphQuadBatch
+    {
+        GeometryBuffer* d_buffer;
+        const Rectf* d_clipArea;
+        std::vector<Rectf> d_destAreas;
+        std::vector<Rectf> d_texAreas;
+        std::vector<ColourRect> d_colours;
+    };
+
     /*! 
     \brief
         Adds the render geometry data to the supplied vector. A new GeometryBuffer
         might be added if necessary or data might be added to an existing one.
+
+        Glyphs added to an existing GeometryBuffer are collected and only
+        appended by flushGlyphQuadBatches, as a single batch per buffer.
+
+    \param textColoured
+        Whether \a colours are the colours the text is drawn with, as opposed
+        to colours of their own, such as those of an outline. Cached layouts
+        replace the former when the same text is drawn in other colours.
     */
     void addGlyphRenderGeometry(std::vector<GeometryBuffer*> &textGeometryBuffers,
                                 const Image* image, ImageRenderSettings &imgRenderSettings,
-                                const Rectf* clip_rect, const ColourRect& colours) const;
+                                const Rectf* clip_rect, const ColourRect& colours,
+                                bool textColoured = true) const;
+
+    //! Appends the glyphs collected by addGlyphRenderGeometry to their GeometryBuffers.
+    void flushGlyphQuadBatches() const;
 
     //! Manages the glyph layout and and creates the RenderGeometry for the text.
     virtual std::vector<GeometryBuffer*> layoutAndCreateGlyphRenderGeometry(
@@ -524,6 +612,61 @@ protected:
     */
     virtual const FontGlyph* getPreparedGlyph(char32_t currentCodePoint) const;
 
+    /*!
+    \brief
+        Prepares the glyphs of a batch of code points for prepareGlyphs and
+        prepareGlyphRange. Calls getPreparedGlyph for each of them by default.
+    */
+    virtual void prepareGlyphs_impl(const std::u32string& codePoints) const;
+    //! Prepares a batch of code points with prepareGlyphs_impl and logs the time taken.
+    void prepareCodePoints(const std::u32string& codePoints) const;
+
+    /*!
+    \brief
+        Called for every glyph image drawn from a cached text layout, in place
+        of laying the text out again. Does nothing by default.
+    */
+    virtual void notifyGlyphImageUsed(const Image& /*image*/) const {}
+
+    /*!
+    \brief
+        Called by addGlyphRenderGeometry for every GeometryBuffer it creates
+        for the glyphs of a text, including texts drawn from a cached layout.
+        Does nothing by default.
+    */
+    virtual void prepareGlyphGeometryBuffer(GeometryBuffer& /*buffer*/) const {}
+
+    //! Removes the text layouts of this font cached by createTextRenderGeometry.
+    void releaseTextLayouts() const;
+
+    //! Metrics of the glyph of a code point below 256, as cached by getLatin1GlyphMetrics.
+    struct Latin1GlyphMetrics
+    {
+        float d_advance;
+        float d_renderedAdvance;
+        //! Whether the font has a glyph for the code point.
+        bool d_available;
+    };
+
+    /*!
+    \brief
+        Returns the metrics of the glyph for a code point below 256 from a
+        table filled on demand, so that measuring ASCII and Latin-1 text needs
+        no glyph lookups.
+
+    \return
+        The metrics, or nullptr if the glyph is still waiting for its image and
+        its metrics can not be cached yet.
+    */
+    const Latin1GlyphMetrics* getLatin1GlyphMetrics(char32_t codePoint) const;
+
+    /*!
+    \brief
+        Empties the table of getLatin1GlyphMetrics. Has to be called by
+        implementations whenever glyphs are added or their metrics change.
+    */
+    void invalidateLatin1GlyphMetrics() const;
+
     //! Name of this font.
     String d_name;
     //! Type name string for this font (not used internally)
@@ -550,6 +693,18 @@ protected:
     float d_horzScaling;
     //! current vertical scaling factor.
     float d_vertScaling;
+
+    //! Metrics of the glyphs of the code points below 256, see getLatin1GlyphMetrics.
+    mutable Latin1GlyphMetrics d_latin1GlyphMetrics[256];
+    //! Which entries of d_latin1GlyphMetrics are filled.
+    mutable std::bitset<256> d_latin1GlyphMetricsKnown;
+    //! Glyphs placed by addGlyphRenderGeometry while a text layout is recorded.
+    mutable std::vector<TextLayoutGlyph>* d_recordedTextLayout;
+    //! Batches of glyph quads, of which the first d_glyphQuadBatchCount are in use.
+    mutable std::vector<GlyphQuadBatch> d_glyphQuadBatches;
+    mutable size_t d_glyphQuadBatchCount;
+    //! Serialises createTextRenderGeometry, which uses the batches and the recorded layout.
+    mutable std::mutex d_textGeometryMutex;
 };
 
 
@@ -28,6 +28,7 @@
 #define _CEGUIFontGlyph_h_
 
 #include "CEGUI/Image.h"
+#include "CEGUI/MemoryAllocator.h"
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -44,7 +45,8 @@ namespace CEGUI
     For TrueType fonts initially all FontGlyphs are empty
     (getImage() will return nullptr), but they are filled by demand.
 */
-class CEGUIEXPORT FontGlyph
+class CEGUIEXPORT FontGlyph :
+    public AllocatedObject<MemoryCategory::Font>
 {
 public:
     //! Constructor.
@@ -34,6 +34,8 @@
 #include "CEGUI/Image.h" // for AutoScaledMode
 #include "CEGUI/FreeTypeFontLayer.h"
 #include <unordered_map>
+#include <functional>
+#include <cstdint>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -71,6 +73,8 @@ public:
 
     //! List of fonts
     typedef std::vector<Font*> FontList;
+    //! Function called with the fonts created by createFromFileAsync.
+    typedef std::function<void(const FontList& fonts)> FontsCreatedCallback;
 
     /*!
     \brief
@@ -116,6 +120,37 @@ public:
     static FontList createFromFile(const String& xml_filename, const String& resource_group = "",
         XmlResourceExistsAction resourceExistsAction = XmlResourceExistsAction::Return);
 
+    /*!
+    \brief
+        Creates new Font instances from an XML file without waiting for the
+        file to be read.
+
+        The file is loaded by ResourceProvider::loadRawDataContainerAsync.
+        The fonts are created, and \a callback is called, from
+        System::injectTimePulse once the file was read. If the file can not
+        be loaded or parsed the error is logged and \a callback receives an
+        empty list.
+
+    \param xml_filename
+        String holding the filename of the XML file to be used when creating the
+        new Font instances.
+
+    \param resource_group
+        String holding the name of the resource group identifier to be used
+        when loading the XML file described by \a xml_filename.
+
+    \param callback
+        Function called with the created fonts, may be empty.
+
+    \param resourceExistsAction
+        One of the XmlResourceExistsAction enumerated values indicating what
+        action should be taken when a Font with the specified name already
+        exists within the collection.
+    */
+    static void createFromFileAsync(const String& xml_filename, const String& resource_group,
+        FontsCreatedCallback callback,
+        XmlResourceExistsAction resourceExistsAction = XmlResourceExistsAction::Return);
+
     /*!
     \brief
         Creates Font instances from a string and adds them to the collection.
@@ -175,6 +210,16 @@ public:
     //! Return whether an object named \a font_name exists.
     bool isDefined(const String& font_name) const;
 
+    /*!
+    \brief
+        Returns a number that changes whenever a Font is created or destroyed.
+
+        Code keeping a Font looked up by name, such as a ResourceHandle, only
+        needs to look it up again once the generation changed. The number
+        keeps counting across instances of the manager.
+    */
+    std::uint32_t getGeneration() const;
+
     //! Create new Font instances from files with names matching \a pattern in \a resource_group
     void createAll(const String& pattern, const String& resource_group);
 
@@ -287,6 +332,45 @@ public:
                            const Sizef& native_res = Sizef(640.0f, 480.0f),
                            XmlResourceExistsAction resourceExistsAction = XmlResourceExistsAction::Return);
 
+    /*!
+    \brief
+        Creates a Baked type font, loading the glyphs, kerning pairs and
+        pre-rasterised pages from a file written by
+        FreeTypeFont::writeBakedFont.
+
+    \param font_name
+        The name that the font will use within the CEGUI system.
+
+    \param filename
+        The filename of the baked font file to load.
+
+    \param resource_group
+        The resource group identifier to use when loading the file.
+
+    \param auto_scaled
+        Specifies whether the font imagery should be automatically scaled to
+        maintain the same physical size (which is calculated by using the
+        native resolution setting).
+
+    \param native_res
+        The native resolution value.  This is only significant when
+        auto scaling is enabled.
+
+    \param resourceExistsAction
+        One of the XmlResourceExistsAction enumerated values indicating what
+        action should be taken when a Font with the specified name
+        already exists.
+
+    \return
+        Reference to the newly create Font object.
+    */
+    Font& createBakedFont(const String& font_name,
+                          const String& filename,
+                          const String& resource_group = "",
+                          const AutoScaledMode auto_scaled = AutoScaledMode::Disabled,
+                          const Sizef& native_res = Sizef(640.0f, 480.0f),
+                          XmlResourceExistsAction resourceExistsAction = XmlResourceExistsAction::Return);
+
     /*!
     \brief
         Notify the FontManager that display size may have changed.
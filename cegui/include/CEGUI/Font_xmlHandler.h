@@ -86,6 +86,8 @@ public:
     static const String FontTypeFreeType;
     //! Type name of Pixmap fonts.
     static const String FontTypePixmap;
+    //! Type name of Baked fonts.
+    static const String FontTypeBaked;
     //! Font format version native for the current CEGUI implementation.
     static const String NativeVersion;
 
@@ -121,6 +123,8 @@ private:
     void createFreeTypeFont(const XMLAttributes& attributes);
     //! creates a PixmapFont
     void createPixmapFont(const XMLAttributes& attributes);
+    //! creates a BakedFont
+    void createBakedFont(const XMLAttributes& attributes);
 
     //! throw exception if file version is not supported.
     void validateFontFileVersion(const XMLAttributes& attrs);
@@ -63,13 +63,19 @@ class FontGlyph;
 class FontManager;
 class FormattedRenderedString;
 class GeometryBuffer;
+class GeometryBufferPool;
+class GeometryJobSystem;
 class GlobalEventSet;
+class GradientImage;
 class GUIContext;
 class Image;
 class ImageCodec;
 class ImageManager;
 class ImagerySection;
+class InPlaceRenderEffect;
 class Interpolator;
+class InterpolatorValue;
+class InternedName;
 class InputAggregator;
 class InputEvent;
 class JustifiedRenderedString;
@@ -82,6 +88,7 @@ class Cursor;
 class NamedElement;
 class NamedElementEventArgs;
 class NativeClipboardProvider;
+class NativeInterpolator;
 class Property;
 template<typename T> class PropertyHelper;
 class PropertyReceiver;
@@ -116,8 +123,11 @@ class SVGImage;
 class String;
 class StringTranscoder;
 class System;
+class SerialTaskScheduler;
+class TaskScheduler;
 class Texture;
 class TextureTarget;
+class TextureTargetPool;
 class TextUtils;
 class UBox;
 class UDim;
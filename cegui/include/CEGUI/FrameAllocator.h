@@ -0,0 +1,188 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIFrameAllocator_h_
+#define _CEGUIFrameAllocator_h_
+
+#include "CEGUI/Base.h"
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Linear allocator for data that lives no longer than a single frame.
+
+    Allocations are carved out of large memory blocks by advancing an offset,
+    individual deallocations are no-ops and all memory is released in bulk by
+    reset(). A reset merges the blocks into a single one of their combined size,
+    so a frame that needs no more memory than the previous ones allocates
+    nothing from the heap.
+
+    Every GUIContext owns a FrameAllocator that is active on the thread calling
+    GUIContext::draw while it runs and is reset when it returns. Code building
+    geometry can obtain it with getActive(), or simply use FrameVector, which
+    falls back to the heap when no allocator is active.
+
+    The allocator is not thread safe and must only be used by the thread it is
+    active on.
+*/
+class CEGUIEXPORT FrameAllocator
+{
+public:
+    //! Size of the first block allocated, in bytes.
+    static const std::size_t DefaultBlockSize;
+
+    FrameAllocator();
+    ~FrameAllocator();
+
+    FrameAllocator(const FrameAllocator&) = delete;
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+    /*!
+    \brief
+        Returns \a size bytes of memory aligned to \a alignment, which must be
+        a power of two. The memory stays valid until the next reset().
+    */
+    void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+    //! Releases all memory handed out since the last reset at once.
+    void reset();
+
+    //! Returns the number of bytes handed out since the last reset.
+    std::size_t getUsedSize() const { return d_usedSize; }
+
+    //! Returns the number of bytes reserved in blocks.
+    std::size_t getCapacity() const;
+
+    //! Returns the largest number of bytes handed out between two resets.
+    std::size_t getPeakSize() const { return d_peakSize; }
+
+    //! Returns the FrameAllocator active on the calling thread, or nullptr.
+    static FrameAllocator* getActive();
+
+    /*!
+    \brief
+        Makes \a allocator the FrameAllocator of the calling thread and
+        returns the previously active one, so that it can be restored.
+    */
+    static FrameAllocator* setActive(FrameAllocator* allocator);
+
+private:
+    struct Block
+    {
+        char* d_memory;
+        std::size_t d_size;
+    };
+
+    void addBlock(std::size_t minimumSize);
+
+    std::vector<Block> d_blocks;
+    //! Offset of the free memory in the last block.
+    std::size_t d_offset;
+    std::size_t d_usedSize;
+    std::size_t d_peakSize;
+};
+
+/*!
+\brief
+    Standard library allocator taking its memory from the FrameAllocator that
+    was active on the thread when it was created, or from the heap if there
+    was none.
+
+    Containers using it must not outlive the frame they were created in.
+*/
+template<typename T>
+class FrameAllocatorAdapter
+{
+public:
+    typedef T value_type;
+
+    FrameAllocatorAdapter() :
+        d_allocator(FrameAllocator::getActive())
+    {}
+
+    explicit FrameAllocatorAdapter(FrameAllocator* allocator) :
+        d_allocator(allocator)
+    {}
+
+    template<typename U>
+    FrameAllocatorAdapter(const FrameAllocatorAdapter<U>& other) :
+        d_allocator(other.getFrameAllocator())
+    {}
+
+    T* allocate(std::size_t count)
+    {
+        if (d_allocator)
+            return static_cast<T*>(d_allocator->allocate(count * sizeof(T), alignof(T)));
+
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+
+    void deallocate(T* memory, std::size_t)
+    {
+        // memory of a FrameAllocator is released in bulk by its reset
+        if (!d_allocator)
+            ::operator delete(memory);
+    }
+
+    FrameAllocator* getFrameAllocator() const { return d_allocator; }
+
+private:
+    FrameAllocator* d_allocator;
+};
+
+template<typename T, typename U>
+bool operator==(const FrameAllocatorAdapter<T>& lhs, const FrameAllocatorAdapter<U>& rhs)
+{
+    return lhs.getFrameAllocator() == rhs.getFrameAllocator();
+}
+
+template<typename T, typename U>
+bool operator!=(const FrameAllocatorAdapter<T>& lhs, const FrameAllocatorAdapter<U>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+//! A std::vector for transient per-frame data, see FrameAllocatorAdapter.
+template<typename T>
+using FrameVector = std::vector<T, FrameAllocatorAdapter<T> >;
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIFrameAllocator_h_
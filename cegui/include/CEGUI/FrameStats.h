@@ -0,0 +1,148 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIFrameStats_h_
+#define _CEGUIFrameStats_h_
+
+#include "CEGUI/Base.h"
+#include <chrono>
+#include <cstddef>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Counters and timings describing the cost of a single frame.
+
+    GUIContext::getFrameStats returns the figures of the last frame drawn by
+    a context: the work done by its windows along with the work the Renderer
+    did while the context was drawn. Renderer::getFrameStats returns the
+    totals of the last frame over all contexts.
+
+    The counters filled in by the renderer module (vertices uploaded and
+    drawn, draw calls, texture uploads and state changes) stay zero for
+    modules that do not report them. Times are CPU times in seconds.
+*/
+struct CEGUIEXPORT FrameStats
+{
+    //! Windows whose update was run by GUIContext::injectTimePulse.
+    std::size_t d_windowsUpdated = 0;
+    //! Windows that rebuilt their geometry.
+    std::size_t d_windowsRedrawn = 0;
+    //! Windows or whole subtrees skipped because they are clipped away entirely.
+    std::size_t d_windowsCulled = 0;
+    //! GeometryBuffers drawn from render queues.
+    std::size_t d_geometryBuffersQueued = 0;
+    //! Vertices uploaded to the graphics API.
+    std::size_t d_verticesUploaded = 0;
+    //! Vertices drawn by the draw calls.
+    std::size_t d_verticesDrawn = 0;
+    //! Draw calls issued to the graphics API.
+    std::size_t d_drawCalls = 0;
+    //! Texture updates sent to the graphics API.
+    std::size_t d_textureUploads = 0;
+    //! Render state changes sent to the graphics API.
+    std::size_t d_stateChanges = 0;
+    //! Passes applying pending area changes, see GUIContext::updateLayout.
+    std::size_t d_layoutPasses = 0;
+
+    //! Time spent updating windows.
+    double d_updateTime = 0.0;
+    //! Time spent applying pending area changes.
+    double d_layoutTime = 0.0;
+    //! Time spent building and queueing geometry, including RenderingWindows.
+    double d_geometryTime = 0.0;
+    //! Time spent drawing the render queues of the contexts.
+    double d_submissionTime = 0.0;
+
+    //! Sets all counters and times to zero.
+    void reset() { *this = FrameStats(); }
+
+    /*!
+    \brief
+        Returns the FrameStats the windows of the current thread report to,
+        or nullptr if none is active.
+
+        GUIContext activates its statistics while it updates and draws its
+        windows.
+    */
+    static FrameStats* getActive();
+
+    //! Makes \a stats the active FrameStats of the current thread, returns the previous one.
+    static FrameStats* setActive(FrameStats* stats);
+};
+
+/*!
+\brief
+    Adds the time elapsed during its lifetime to a FrameStats time.
+*/
+class FrameStatsTimer
+{
+public:
+    explicit FrameStatsTimer(double& target) :
+        d_target(target),
+        d_start(std::chrono::steady_clock::now())
+    {}
+
+    ~FrameStatsTimer()
+    {
+        d_target += std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - d_start).count();
+    }
+
+    FrameStatsTimer(const FrameStatsTimer&) = delete;
+    FrameStatsTimer& operator=(const FrameStatsTimer&) = delete;
+
+private:
+    double& d_target;
+    std::chrono::steady_clock::time_point d_start;
+};
+
+/*!
+\brief
+    Makes a FrameStats active on the current thread during its lifetime and
+    restores the previously active one afterwards.
+*/
+class FrameStatsActivation
+{
+public:
+    explicit FrameStatsActivation(FrameStats* stats) :
+        d_previous(FrameStats::setActive(stats))
+    {}
+
+    ~FrameStatsActivation() { FrameStats::setActive(d_previous); }
+
+    FrameStatsActivation(const FrameStatsActivation&) = delete;
+    FrameStatsActivation& operator=(const FrameStatsActivation&) = delete;
+
+private:
+    FrameStats* d_previous;
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIFrameStats_h_
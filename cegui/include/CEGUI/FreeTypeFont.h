@@ -33,11 +33,16 @@
 #include "CEGUI/DataContainer.h"
 #include "CEGUI/FreeTypeFontGlyph.h"
 #include "CEGUI/FreeTypeFontLayer.h"
+#include "CEGUI/TaskScheduler.h"
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
 #include FT_STROKER_H
 
+#include <memory>
+#include <iosfwd>
+#include <string>
+
 #if defined(_MSC_VER)
 #   pragma warning(push)
 #   pragma warning(disable : 4251) // STL classes in API
@@ -57,7 +62,10 @@ class BitmapImage;
     like TTF and PS as well as on bitmap font formats like PCF and FON.
 
     Glyphs are rendered dynamically on demand, so a large font with lots
-    of glyphs won't slow application startup time.
+    of glyphs won't slow application startup time. With asynchronous
+    rasterisation enabled, the bitmaps of new glyphs are rendered through the
+    System's TaskScheduler instead, and the glyphs are left blank until their
+    images arrive.
 */
 class CEGUIEXPORT FreeTypeFont : public Font
 {
@@ -113,6 +121,7 @@ public:
     virtual ~FreeTypeFont();
     
     void updateFont() override;
+    void updateFontScale() override;
     bool isCodepointAvailable(char32_t codePoint) const override;
     FreeTypeFontGlyph* getGlyphForCodepoint(const char32_t codePoint) const override;
 
@@ -205,68 +214,201 @@ public:
     //! Returns the Freetype font face
     const FT_Face& getFontFace() const;
 
-    //! Returns the initial size to be used for any new glyph atlas texture.
+    /*!
+    \brief
+        Returns the initial size to be used for any new glyph atlas texture.
+
+        The glyph atlas is shared by all FreeType fonts, so this only applies
+        to the pages created while rasterising glyphs of this font.
+    */
     int getInitialGlyphAtlasSize() const;
 
     //! Sets the initial size to be used for any new glyph atlas texture.
     void setInitialGlyphAtlasSize(int val);
 
-protected:
     /*!
-        A data structure containing info about one horizontal line inside
-        a glyph atlas. The data is used when deciding where to place a new glyph.
+    \brief
+        Sets whether the bitmaps of new glyphs are rasterised in the background.
+
+        When enabled, laying out text only loads the metrics of glyphs seen
+        for the first time, so the text keeps its final layout, and queues
+        their bitmaps for rasterisation on the TaskScheduler registered with
+        the System. Such glyphs are drawn blank until
+        processRasterisedGlyphs picks up their images, which invalidates all
+        windows so the text gets redrawn.
     */
-    struct TextureGlyphLine
-    {
-        TextureGlyphLine()
-        {
-        }
-
-        TextureGlyphLine(int lastPosX, int lastPosY, int maximumExtentY)
-            : d_lastXPos(lastPosX)
-            , d_lastYPos(lastPosY)
-            , d_maximumExtentY(maximumExtentY)
-        {
-        }
-
-        //! The x position where we last ended drawing (including padding)
-        mutable int d_lastXPos = 0;
-        //! The y position where we last ended drawing (including padding)
-        mutable int d_lastYPos = 0;
-        //! The maximum extent that a glyph of this line can take in the y-dimension
-        //! If the line is the last line, this value may increase while rendering to the line
-        mutable int d_maximumExtentY = 0;
-    };
+    void setAsynchronousRasterisation(bool enabled);
 
-    //! Type for mapping codepoints to the corresponding Freetype Font glyphs
-    typedef std::unordered_map<char32_t, FreeTypeFontGlyph*> CodePointToGlyphMap;
-    //! Type for mapping Freetype indices to the corresponding Freetype Font glyphs
-    typedef std::unordered_map<FT_UInt, char32_t> IndexToCodePointMap;
+    //! Returns whether the bitmaps of new glyphs are rasterised in the background.
+    bool isAsynchronousRasterisation() const;
+
+    //! Returns the number of glyph layers rasterised for this font so far, packed layers count once.
+    size_t getRasterisedGlyphLayerCount() const;
+
+    /*!
+    \brief
+        Returns the time in seconds spent rasterising the glyphs of this font
+        so far, including the time spent by background tasks.
+    */
+    double getRasterisationTime() const;
+
+    /*!
+    \brief
+        Sets whether the glyphs are rendered as signed distance fields.
+
+        Distance field glyphs are rasterised once at DistanceFieldBaseSize and
+        drawn scaled to the size of the font with the
+        DefaultShaderType::DistanceField shader, which keeps their edges sharp.
+        Changing the size of the font, including auto scaling after the
+        display size changed, then keeps the glyph images and only reloads the
+        metrics, which makes fonts cheap to resize or animate.
+
+        The mode only takes effect for scalable faces, if FreeType supports
+        FT_RENDER_MODE_SDF (2.11 and later) and if the Renderer supports the
+        distance field shader; the glyphs are rendered as bitmaps otherwise.
+        Only the standard layers of the font are drawn in this mode.
+    */
+    void setDistanceField(bool enabled);
+
+    //! Returns whether the glyphs are requested to be rendered as signed distance fields.
+    bool isDistanceField() const;
+
+    //! Returns whether the glyphs are actually rendered as signed distance fields.
+    bool isDistanceFieldActive() const;
+
+    //! The pixel size at which distance field glyphs are rasterised.
+    static const unsigned int DistanceFieldBaseSize = 48;
+
+    /*!
+    \brief
+        Returns whether the layers of each glyph are packed into the channels
+        of a single atlas image and drawn in one pass.
+
+        Fonts with two to MaxPackedLayerCount layers pack them if the Renderer
+        supports DefaultShaderType::LayeredGlyph and the glyphs are not
+        rendered as distance fields. Layer 0 is then drawn in the text colour
+        and the other layers in the top left colour of their ColourRect,
+        without gradients. Otherwise each layer is an image of its own, drawn
+        by a separate quad.
+    */
+    bool isLayerPackingActive() const;
+
+    //! The maximum number of layers that are packed into one glyph image.
+    static const unsigned int MaxPackedLayerCount = 4;
+
+    /*!
+    \brief
+        Writes the given glyphs of the font, as currently sized, to a baked
+        font file that can be loaded by BakedFont.
+
+        The standard layer of each glyph is rasterised as a bitmap and packed
+        into pages of \a pageSize pixels, and the kerning pairs between all
+        the given code points are stored along with the glyph metrics. Code
+        points the face has no glyph for are skipped.
+
+    \param out
+        The binary stream the file is written to.
+
+    \param codePoints
+        The code points of the glyphs to bake.
+
+    \param pageSize
+        The width and height of the atlas pages in pixels.
+
+    \exception InvalidRequestException
+        thrown if a glyph does not fit a page of the given size.
+    */
+    void writeBakedFont(std::ostream& out, const std::vector<char32_t>& codePoints,
+                        int pageSize = 1024) const;
+
+    /*!
+    \brief
+        Adds the glyph images rasterised in the background since the last call
+        to the glyph atlas and starts rasterising the glyphs queued meanwhile.
 
+        Called by System::renderAllGUIContexts before drawing; applications
+        drawing their GUIContexts directly should call it once per frame.
+    */
+    static void processRasterisedGlyphs();
+
+#ifdef CEGUI_USE_RAQM
     /*!
     \brief
-        Updates a part of the buffer data, which equates to a sub-image inside the 
-        texture the buffer data represents, based on the supplied subimage data.
+        Measures and hit tests the text as shaped by raqm, so that ligatures,
+        kerning and combining marks are accounted for. The shaped text is
+        taken from the cache shared with the geometry creation.
+    */
+    float getTextExtent(const String& text) const override;
+    float getTextAdvance(const String& text) const override;
+    using Font::getCharAtPixel;
+    size_t getCharAtPixel(const String& text, size_t start_char, float pixel) const override;
 
-    \param bitmapWidth
-        Width of the source subimage
+    //! Maximum number of shaped texts kept by the cache shared by all fonts.
+    static const size_t ShapedRunCacheCapacity = 512;
 
-    \param bitmapHeight
-        Height of the source subimage
+    //! Returns the number of shaped texts currently kept by the cache.
+    static size_t getShapedRunCount();
 
-    \param subImageData
-        The pixel data of the subimage 
+    //! A glyph of a text shaped by raqm, in visual order.
+    struct ShapedGlyph
+    {
+        //! Index of the glyph in the face.
+        FT_UInt d_index;
+        //! Index of the first code point of the text the glyph belongs to.
+        std::uint32_t d_cluster;
+        //! Pen advance after the glyph.
+        float d_advance;
+        //! Offset of the glyph from the pen position.
+        glm::vec2 d_offset;
+    };
+    typedef std::vector<ShapedGlyph> ShapedRun;
+#else
+    /*!
+    \brief
+        Measures the text with the same kerning as the FreeType layout, taken
+        from the kerning cache of the font.
     */
-    void updateTextureBufferSubImage(argb_t* buffer, unsigned int bitmapWidth,
-        unsigned int bitmapHeight, const std::vector<argb_t>& subImageData) const;
+    float getTextExtent(const String& text) const override;
+    float getTextAdvance(const String& text) const override;
+#endif
 
-    /*
+    //! Returns the number of glyph pairs whose kerning is currently cached.
+    size_t getCachedKerningPairCount() const;
+
+protected:
+    //! Bitmap of one layer of a glyph, which may be rasterised on any thread.
+    struct RasterisedGlyphLayer
+    {
+        char32_t d_codePoint;
+        unsigned int d_layer;
+        std::vector<argb_t> d_pixels;
+        int d_width;
+        int d_height;
+        int d_left;
+        int d_top;
+    };
+
+#ifdef CEGUI_USE_RAQM
+    /*!
     \brief
-        Changes the size of the texture and updates the data in it based on the old
-        texture's data. The size must be larger than the original one.
-     */
-    void resizeAndUpdateTexture(Texture* texture, int newSize) const;
-    void createTextureSpaceForGlyphRasterisation(Texture* texture, int glyphWidth, int glyphHeight) const;
+        Returns the glyphs of \a text shaped with the current size of the font.
+
+        Shaping runs BiDi and HarfBuzz over the whole text, so the results are
+        kept in a least recently used cache shared by all fonts, keyed on the
+        font, the text and the paragraph direction. The entries of a font are
+        dropped whenever its size or face changes.
+    */
+    std::shared_ptr<const ShapedRun> getShapedRun(const std::u32string& text,
+        DefaultParagraphDirection defaultParagraphDir) const;
+    //! Drops the shaped texts of this font from the cache.
+    void releaseShapedRuns() const;
+#endif
+
+    //! Type for mapping codepoints to the corresponding Freetype Font glyphs
+    typedef std::unordered_map<char32_t, FreeTypeFontGlyph*> CodePointToGlyphMap;
+    //! Type for mapping Freetype indices to the corresponding Freetype Font glyphs
+    typedef std::unordered_map<FT_UInt, char32_t> IndexToCodePointMap;
+
    //! Register all properties of this class.
     void addFreeTypeFontProperties();
     //! Free all allocated font data.
@@ -286,27 +428,55 @@ protected:
 
     void handleFontSizeOrFontUnitChange();
 
-    //! Rasterises the glyph and adds it into a glyph atlas texture
-    void rasterise(FreeTypeFontGlyph* glyph, FT_Bitmap& ft_bitmap,
-        int glyphLeft, int glyphTop, int glyphWidth, int glyphHeight,
-        unsigned int layer) const;
-    
-    //! Helper functions for rasterisation
-    void addRasterisedGlyphToTextureAndSetupGlyphImage(
-        FreeTypeFontGlyph* glyph, Texture* texture,
-        FT_Bitmap& glyphBitmap, int glyphLeft, int glyphTop,
-        int glyphWidth, int glyphHeight, unsigned int layer,
-        const TextureGlyphLine& glyphTexLine) const;
+    //! Loads the glyph into the glyph slot of the face and sets up its advance.
+    bool loadGlyphMetrics(FreeTypeFontGlyph* glyph) const;
 
-    void findFittingSpotInGlyphTextureLines(int glyphWidth, int glyphHeight,
-        bool &fittingLineWasFound, size_t &fittingLineIndex) const;
+    /*!
+    \brief
+        Rasterises one layer of a glyph with the given face. Only touches
+        \a face and its arguments, so it can run on any thread as long as no
+        other thread uses \a face meanwhile.
+    */
+    static bool rasteriseGlyphLayer(FT_Face face, FT_UInt glyphIndex,
+        const FreeTypeFontLayer& fontLayer, bool antiAliased, bool distanceField,
+        RasterisedGlyphLayer& rasterised);
 
-    //! Adds a new glyph atlas line if the glyph would fit into there.
-    bool addNewLineIfFitting(unsigned int glyphHeight, unsigned int glyphWidth,
-        size_t & fittingLineIndex) const;
+    /*!
+    \brief
+        Packs the coverage of the rasterised layers of a glyph into a single
+        layer 0 image covering all of them, layer 0 in the alpha channel and
+        layers 1 to 3 in red, green and blue. Can run on any thread.
 
-    void createGlyphAtlasTexture() const;
-    static std::vector<argb_t> createGlyphTextureData(FT_Bitmap& glyph_bitmap);
+    \return
+        false if \a layers is empty.
+    */
+    static bool packGlyphLayers(const std::vector<RasterisedGlyphLayer>& layers,
+        RasterisedGlyphLayer& packed);
+
+    //! Sets the size of d_fontFace from the font size and sets up the font metrics.
+    void updateFontFaceSize();
+    //! Creates the face distance fields are rasterised with, if they are supported.
+    void initialiseDistanceField();
+    //! Decides whether the glyph layers are packed, see isLayerPackingActive.
+    void initialiseLayerPacking();
+    //! Returns the area to draw a glyph image to, which is scaled for distance fields.
+    Rectf getGlyphDestArea(const FreeTypeFontGlyph& glyph, const Image& image,
+        const glm::vec2& position) const;
+
+    //! Adds a rasterised glyph layer into the shared glyph atlas
+    void addRasterisedGlyphLayer(FreeTypeFontGlyph& glyph,
+        const RasterisedGlyphLayer& rasterised) const;
+
+    //! Queues the bitmaps of the glyph for background rasterisation.
+    void queueGlyphRasterisation(const FreeTypeFontGlyph* glyph) const;
+    //! Submits the queued glyphs as one task, unless a task is still running.
+    void submitQueuedGlyphRasterisation() const;
+    //! Takes over the results of a finished task, returns whether there were any.
+    bool collectRasterisedGlyphs() const;
+    //! Waits for the running task and drops all queued and rasterised glyphs.
+    void cancelGlyphRasterisation();
+
+    static std::vector<argb_t> createGlyphTextureData(const FT_Bitmap& glyph_bitmap);
 
     //! Converts the FreeTypeLineCap to the assocated freetype library data type value
     static FT_Stroker_LineCap getLineCap(FreeTypeLineCap line_cap);
@@ -314,6 +484,9 @@ protected:
     static FT_Stroker_LineJoin getLineJoin(FreeTypeLineJoin line_join);
 
     const FreeTypeFontGlyph* getPreparedGlyph(char32_t currentCodePoint) const override;
+    void prepareGlyphs_impl(const std::u32string& codePoints) const override;
+    void notifyGlyphImageUsed(const Image& image) const override;
+    void prepareGlyphGeometryBuffer(GeometryBuffer& buffer) const override;
     void writeXMLToStream_impl(XMLSerializer& xml_stream) const override;
 
     std::vector<GeometryBuffer*> layoutAndCreateGlyphRenderGeometry(
@@ -345,6 +518,18 @@ protected:
         float space_extra, ImageRenderSettings imgRenderSettings,
         glm::vec2& penPosition) const;
 
+    /*!
+    \brief
+        Returns the kerning between two glyphs in pixels, 0 if the face has no
+        kerning table. FreeType is only asked once per pair and size, the
+        results are cached until the size or face changes. The caller must
+        hold d_kerningMutex.
+    */
+    float getKerning(FT_UInt leftGlyphIndex, FT_UInt rightGlyphIndex) const;
+
+    //! Drops the cached kerning and checks whether the face has kerning.
+    void resetKerningCache();
+
     //! If non-zero, the overridden line spacing that we're to report.
     float d_specificLineSpacing;
     //! Specified font size for this font.
@@ -357,16 +542,6 @@ protected:
     FT_Face d_fontFace;
     //! Font file data
     RawDataContainer d_fontData;
-    //! Type definition for TextureVector.
-    typedef std::vector<Texture*> TextureVector;
-
-    typedef std::vector<BitmapImage*> ImageVector;
-    //! collection of images defined for this font.
-    mutable ImageVector d_glyphImages;
-
-    //! Textures that hold the glyph imagery for this font.
-    mutable TextureVector d_glyphTextures;
-
     //! Contains mappings from code points to Font glyphs
     mutable CodePointToGlyphMap d_codePointToGlyphMap;
     //! Contains mappings from freetype indices to Font glyphs
@@ -374,15 +549,49 @@ protected:
 
     //! The size with which new texture atlases for glyphs are going to be initialised
     int d_initialGlyphAtlasSize = 32;
-    //! The size of the last texture that has been created
-    mutable int d_lastTextureSize = 0;
-    //! Memory buffer for rendering the glyphs, this contains the data of the latest texture
-    mutable std::vector<argb_t> d_lastTextureBuffer;
-    //! Contains information about the extents of each line of glyphs of the latest texture
-    mutable std::vector<TextureGlyphLine> d_textureGlyphLines;
 
     //! collection of outline image layers defined for this font.
     mutable FreeTypeFontLayerVector d_fontLayers;
+
+    //! Whether the bitmaps of new glyphs are rasterised in the background.
+    bool d_asynchronousRasterisation = false;
+    //! Face used by the background tasks, so they never share d_fontFace.
+    mutable FT_Face d_rasterisationFontFace = nullptr;
+    //! Code points waiting for the next background task.
+    mutable std::vector<char32_t> d_queuedCodePoints;
+    //! Scheduler running the background task and its id, 0 if there is none.
+    mutable TaskScheduler* d_rasterisationScheduler = nullptr;
+    mutable TaskScheduler::TaskId d_rasterisationTask = 0;
+    //! Glyph layers rasterised by the background task, guarded by d_rasterisationMutex.
+    mutable std::vector<RasterisedGlyphLayer> d_rasterisedGlyphs;
+    //! Set by the background task once it is done, guarded by d_rasterisationMutex.
+    mutable bool d_rasterisationFinished = false;
+    //! Time the background task took in seconds, guarded by d_rasterisationMutex.
+    mutable double d_backgroundRasterisationTime = 0.0;
+    mutable std::mutex d_rasterisationMutex;
+
+    //! Number of glyph layers rasterised so far, on any thread.
+    mutable size_t d_rasterisedGlyphLayerCount = 0;
+    //! Time spent rasterising glyphs so far in seconds, on any thread.
+    mutable double d_rasterisationTime = 0.0;
+
+    //! Whether the glyphs are requested to be rendered as signed distance fields.
+    bool d_distanceField = false;
+    //! Whether the glyphs are actually rendered as signed distance fields.
+    bool d_distanceFieldActive = false;
+    //! Whether the glyph layers are packed into a single image.
+    bool d_layersPacked = false;
+    //! Face at DistanceFieldBaseSize that distance fields are rasterised with.
+    FT_Face d_distanceFieldFontFace = nullptr;
+    //! The factor by which the distance field glyphs are scaled to the font size.
+    float d_distanceFieldScale = 1.0f;
+
+    //! Whether the face has a kerning table FT_Get_Kerning can use.
+    bool d_hasKerning = false;
+    //! Kerning in pixels keyed on the pair of glyph indices, see getKerning.
+    mutable std::unordered_map<std::uint64_t, float> d_kerningCache;
+    //! Guards d_kerningCache, layout and measurement may run on other threads.
+    mutable std::mutex d_kerningMutex;
 };
 
 } // End of  CEGUI namespace section
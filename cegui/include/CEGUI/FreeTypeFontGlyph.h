@@ -67,6 +67,9 @@ public:
     //! mark the FontGlyph as initialised
     void markAsInitialised();
 
+    //! mark the FontGlyph as needing to be prepared again, e.g. after its images were evicted
+    void markAsUninitialised();
+
     //! return whether the glyph is valid
     bool isInitialised() const;
 
@@ -77,6 +80,14 @@ public:
 
     unsigned int getGlyphIndex() const;
 
+    /*!
+    \brief
+        Sets the factor by which the images of the glyph are scaled when drawn,
+        which differs from 1 for distance field glyphs rasterised at another size.
+    */
+    void setImageScale(float scale) { d_imageScale = scale; }
+    //! Returns the factor by which the images of the glyph are scaled when drawn.
+    float getImageScale() const { return d_imageScale; }
 
 private:
     //! The difference between hinted and unhinted left side bearing while auto-hinting is active. Zero otherwise.
@@ -88,6 +99,9 @@ private:
 
     //! Says whether this glyph is initialised or not
     bool d_initialised = false;
+
+    //! The factor by which the images of the glyph are scaled when drawn
+    float d_imageScale = 1.0f;
 };
 
 }
@@ -0,0 +1,224 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIFreeTypeGlyphAtlas_h_
+#define _CEGUIFreeTypeGlyphAtlas_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/Colour.h"
+#include "CEGUI/MemoryAllocator.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Sizef.h"
+#include "CEGUI/SkylinePacker.h"
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251) // STL classes in API
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class BitmapImage;
+class FreeTypeFont;
+class FreeTypeFontGlyph;
+class Image;
+class String;
+class Texture;
+
+/*!
+\brief
+    Glyph cache shared by all FreeTypeFont instances.
+
+    Glyph bitmaps of every font are packed into a common set of atlas pages
+    using a skyline packer. Each page keeps a copy of its pixels in memory
+    and only the region touched since the last upload is sent to the texture,
+    so rasterising a run of new glyphs costs a single blit per page.
+
+    The pages are limited by a memory budget. Once the budget is exceeded,
+    whole pages that were not used during the current frame are evicted in
+    least recently used order at the end of the frame; the glyphs they held
+    lose their images and are rasterised again the next time they are laid
+    out. All windows are invalidated after an eviction so that no cached
+    geometry keeps referring to a destroyed page.
+
+    The atlas is created together with the first FreeTypeFont and destroyed
+    along with the last one.
+*/
+class CEGUIEXPORT FreeTypeGlyphAtlas
+{
+public:
+    //! Default value of the memory budget in bytes (one 2048x2048 RGBA page).
+    static const size_t DefaultMemoryBudget;
+
+    //! Creates the shared atlas instance. Called when the first font is created.
+    static void createInstance();
+    //! Destroys the shared atlas instance. Called when the last font is destroyed.
+    static void destroyInstance();
+    //! Returns the shared atlas, or nullptr if no FreeTypeFont exists.
+    static FreeTypeGlyphAtlas* getInstance();
+
+    /*!
+    \brief
+        Sets the amount of texture memory, in bytes, that the atlas pages may
+        take before unused pages get evicted.
+
+        The budget is a soft limit: pages used during the current frame are
+        never evicted, so a frame showing more glyphs than fit the budget
+        makes the atlas grow beyond it.
+    */
+    static void setMemoryBudget(size_t bytes);
+    //! Returns the memory budget of the atlas pages in bytes.
+    static size_t getMemoryBudget();
+
+    /*!
+    \brief
+        Notifies the atlas that a frame was completely rendered.
+
+        Uploads pending glyphs, evicts least recently used pages while the
+        memory budget is exceeded and starts a new frame. Does nothing when
+        no FreeTypeFont exists.
+    */
+    static void notifyFrameEnded();
+
+    /*!
+    \brief
+        Packs the pixels of a glyph layer into an atlas page and sets up the
+        image of the glyph for that layer.
+
+        The pixels are only copied into the memory of the page; they reach
+        the texture with the next call to flush().
+
+    \param font
+        The font owning \a glyph.
+
+    \param glyph
+        The glyph whose layer was rasterised. Its image for \a layer is set
+        to the returned image, which stays owned by the atlas.
+
+    \param pixels
+        The \a width times \a height pixels of the glyph, row by row.
+
+    \param initialPageSize
+        The size of the page to create if the glyph fits none of the
+        existing pages.
+
+    \param shaderType
+        The shader the images of the glyph are drawn with. Glyphs are only
+        packed onto pages with glyphs of the same shader type. Only the pixels
+        of DefaultShaderType::Textured glyphs are premultiplied, as the others
+        hold signed distances or packed layer coverage.
+
+    \exception InvalidRequestException
+        thrown if the glyph is larger than the maximum texture size.
+    */
+    BitmapImage* addGlyph(const FreeTypeFont& font, FreeTypeFontGlyph& glyph,
+        unsigned int layer, const std::vector<argb_t>& pixels, int width, int height,
+        const String& name, const glm::vec2& offset, const Sizef& nativeResolution,
+        int initialPageSize, DefaultShaderType shaderType = DefaultShaderType::Textured);
+
+    //! Marks the page holding the given glyph image as used in the current frame.
+    void markUsed(const Image& image);
+
+    //! Uploads the modified regions of all pages to their textures.
+    void flush();
+
+    //! Removes all the glyphs of \a font, destroying the pages left empty.
+    void releaseFont(const FreeTypeFont& font);
+
+    //! Returns the number of atlas pages.
+    size_t getPageCount() const { return d_pages.size(); }
+    //! Returns the amount of texture memory taken by the atlas pages in bytes.
+    size_t getMemoryUsage() const;
+
+private:
+    //! Pixel memory of the pages, accounted to the fonts.
+    typedef std::vector<argb_t, MemoryAllocatorAdapter<argb_t, MemoryCategory::Font> > PixelBuffer;
+
+    //! A glyph image packed into a page.
+    struct Entry
+    {
+        const FreeTypeFont* d_font;
+        FreeTypeFontGlyph* d_glyph;
+        unsigned int d_layer;
+        BitmapImage* d_image;
+    };
+
+    //! A single atlas texture along with its packing state.
+    struct Page
+    {
+        Texture* d_texture;
+        //! Current size of the page, may be ahead of the texture until uploaded.
+        int d_size;
+        //! The shader type of the glyphs held by the page.
+        DefaultShaderType d_shaderType;
+        //! Size the texture had when it was last uploaded.
+        int d_uploadedSize;
+        PixelBuffer d_buffer;
+        SkylinePacker d_packer;
+        std::vector<Entry> d_entries;
+        //! Frame in which a glyph of the page was last used.
+        std::uint64_t d_lastUsedFrame;
+        //! Region modified since the last upload, empty if d_dirtyMin >= d_dirtyMax.
+        glm::ivec2 d_dirtyMin;
+        glm::ivec2 d_dirtyMax;
+    };
+
+    FreeTypeGlyphAtlas();
+    ~FreeTypeGlyphAtlas();
+
+    Page* createPage(int size, DefaultShaderType shaderType);
+    void destroyPage(Page* page);
+    bool growPage(Page& page, int maxTextureSize);
+    void uploadPage(Page& page);
+    void evictUnusedPages();
+
+    //! The instance shared by all fonts.
+    static FreeTypeGlyphAtlas* s_instance;
+    //! Memory budget of the atlas pages in bytes.
+    static size_t s_memoryBudget;
+
+    std::vector<Page*> d_pages;
+    //! Page found by the last call to markUsed(), checked first by the next call.
+    Page* d_lastUsedPage;
+    //! Counter of the frames, used for the LRU order of the pages.
+    std::uint64_t d_frame;
+    //! Counter used to create unique texture names.
+    unsigned int d_createdPageCount;
+    //! Staging memory for uploading the modified region of a page.
+    PixelBuffer d_uploadBuffer;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIFreeTypeGlyphAtlas_h_
@@ -31,6 +31,10 @@
 #include "CEGUI/InputEventReceiver.h"
 #include "CEGUI/Cursor.h"
 #include "CEGUI/InputEvent.h"
+#include "CEGUI/FrameAllocator.h"
+#include "CEGUI/FrameStats.h"
+#include <cstdint>
+#include <vector>
 
 #if defined (_MSC_VER)
 #   pragma warning(push)
@@ -129,7 +133,15 @@ public:
     const Cursor& getCursor() const;
 
 
-    //! Tell the context to reconsider which window it thinks the cursor is in.
+    /*!
+    \brief
+        Tell the context to reconsider which window it thinks the cursor is in.
+
+        Windows call this when a change may move the cursor into another
+        window: a change of area, visibility, z-order or of the hierarchy.
+        Until then, cursor moves within the unoccluded area of the window
+        containing the cursor skip the search from the root window.
+    */
     void updateWindowContainingCursor();
 
     Window* getInputCaptureWindow() const;
@@ -211,6 +223,130 @@ public:
     */
     bool injectTimePulse(float timeElapsed);
 
+    /*!
+    \brief
+        Set whether area changes of the windows in this context are deferred.
+
+        When enabled, notifyScreenAreaChanged only marks the affected windows
+        and the area recomputation of the whole hierarchy happens in a single
+        top-down pass in updateLayout, which is run by draw and injectTimePulse.
+        Any number of area changes of a window in between cost one recomputation.
+        Rects and pixel sizes of pending windows are not up to date until then.
+        Disabled by default.
+
+    \param setting
+        - true to defer layouting to updateLayout.
+        - false to recompute areas immediately. Pending changes are applied.
+    */
+    void setLayoutDeferred(bool setting);
+
+    //! Return whether area changes are currently deferred, see setLayoutDeferred.
+    bool isLayoutDeferred() const { return d_layoutDeferred && !d_updatingLayout; }
+
+    //! Apply all pending area changes of the windows in this context.
+    void updateLayout();
+
+    /*!
+    \brief
+        Set whether injectTimePulse only updates the windows that asked for it.
+
+        By default every time pulse walks the whole window tree and updates
+        each window whose WindowUpdateMode allows it. With selective updating
+        enabled, the context keeps a list of windows that need time pulses,
+        e.g. for cursor autorepeat, a blinking caret, a tooltip timer or a
+        WindowRenderer that asks for it (see Window::isUpdateRequired), and
+        only updates those. Windows that are shown, attached or get a new
+        update mode are updated once along with their children.
+
+        Windows that override Window::updateSelf must override
+        Window::isUpdateRequired and call Window::requestUpdates when their
+        work starts to take part. Disabled by default.
+
+    \param setting
+        - true to update only the windows on the update list.
+        - false to update the whole window tree on every time pulse.
+    */
+    void setSelectiveUpdateEnabled(bool setting);
+
+    //! Return whether selective updating is enabled, see setSelectiveUpdateEnabled.
+    bool isSelectiveUpdateEnabled() const { return d_selectiveUpdate; }
+
+    /*!
+    \brief
+        Add a window to the update list of this context.
+
+        Called by Window::requestUpdates; does nothing unless selective
+        updating is enabled.
+
+    \param window
+        The window to update on the next time pulse.
+
+    \param subtree
+        Whether the children of \a window are to be updated too.
+    */
+    void requestWindowUpdate(Window& window, bool subtree);
+
+    //! Remove a window from the update list of this context.
+    void cancelWindowUpdate(Window& window);
+
+    /*!
+    \brief
+        Return whether the windows of this context have nothing left to do.
+
+        This is the case when selective updating is enabled, no window is
+        waiting for time pulses, no layout is pending and nothing needs to be
+        redrawn. Hosts may then lower their frame rate or wait for input.
+        Always false when selective updating is disabled.
+    */
+    bool isIdle() const;
+
+    /*!
+    \brief
+        Return whether the next call to draw would show anything different
+        from the previous one.
+
+        This is the case when windows were invalidated or have pending area
+        changes, a RenderingWindow must be redrawn, e.g. for an animated
+        RenderEffect, or the cursor was moved, shown, hidden or given another
+        image. Hosts may skip rendering and presenting frames while this
+        returns false.
+    */
+    bool needsRedraw() const;
+
+    /*!
+    \brief
+        Set whether draw does nothing at all while needsRedraw returns false.
+
+        Only enable this when the contents of the render target survive
+        between frames, e.g. the host does not clear it and keeps presenting
+        the last image. Hosts that clear the target on every frame should use
+        setContentCachingEnabled instead. Disabled by default.
+    */
+    void setDrawOnDemandEnabled(bool setting);
+
+    //! Return whether draw is skipped for clean frames, see setDrawOnDemandEnabled.
+    bool isDrawOnDemandEnabled() const { return d_drawOnDemand; }
+
+    /*!
+    \brief
+        Set whether the windows are drawn to a persistent TextureTarget which
+        is then drawn to the render target as a single quad.
+
+        The windows are only drawn again when needsRedraw reports a change, so
+        a frame without changes costs one quad plus the cursor. This needs a
+        texture the size of the render target. The RenderQueue events of this
+        context are only fired for frames that redraw the windows. Disabled by
+        default.
+
+    \param setting
+        - true to draw the windows through the cache.
+        - false to draw the windows straight to the render target.
+    */
+    void setContentCachingEnabled(bool setting);
+
+    //! Return whether the windows are drawn through a cache, see setContentCachingEnabled.
+    bool isContentCachingEnabled() const { return d_contentCache != nullptr; }
+
     // Implementation of InputEventReceiver interface
     bool injectInputEvent(const InputEvent& event) override;
 
@@ -223,8 +359,85 @@ public:
     */
     void setWindowNavigator(WindowNavigator* navigator);
 
+    /*!
+    \brief
+        Sets the GeometryJobSystem used to generate the geometry of invalidated
+        RenderingWindow subtrees in parallel during draw.
+
+    \param jobSystem
+        Pointer to the job system, or nullptr to generate all geometry on the
+        thread calling draw, which is the default. The job system is not owned
+        by the GUIContext. It is ignored while the Renderer does not report
+        Renderer::isGeometryGenerationThreadSafe.
+
+        Without a GeometryJobSystem the jobs are run through the TaskScheduler
+        registered on the System, if it has a concurrency above one.
+    */
+    void setGeometryJobSystem(GeometryJobSystem* jobSystem) { d_geometryJobSystem = jobSystem; }
+
+    //! Returns the GeometryJobSystem used for parallel geometry generation, or nullptr.
+    GeometryJobSystem* getGeometryJobSystem() const { return d_geometryJobSystem; }
+
+    /*!
+    \brief
+        Generates the geometry the next draw of each of \a contexts would
+        regenerate, spreading the invalidated RenderingWindow subtrees of all
+        of them over the TaskScheduler registered on the System at once. The
+        following calls to draw then only queue and submit that geometry.
+
+        The layouts of the contexts are updated on the calling thread first.
+        Does nothing unless the Renderer reports
+        Renderer::isGeometryGenerationThreadSafe and the TaskScheduler has a
+        concurrency above one. System::renderAllGUIContexts calls this before
+        drawing its contexts one after the other.
+
+        Imagery drawn alike in several contexts is only laid out once, see
+        GeometryTemplateCache and Font::clearTextLayoutCache.
+    */
+    static void bufferGeometryInParallel(const std::vector<GUIContext*>& contexts,
+                                         std::uint32_t drawModeMask = DrawModeMaskAll);
+
+    /*!
+    \brief
+        Returns the FrameAllocator for transient data of this context.
+
+        It is active on the thread calling draw while draw runs (see
+        FrameAllocator::getActive) and all its memory is released when draw
+        returns. Other threads generating geometry during draw use the heap.
+    */
+    FrameAllocator& getFrameAllocator() { return d_frameAllocator; }
+
+    /*!
+    \brief
+        Returns the statistics of the last frame of this context.
+
+        A frame covers the calls to injectTimePulse and updateLayout since the
+        previous call to draw and ends with the next call to draw. The counters
+        of the Renderer cover the work done while this context was drawn.
+    */
+    const FrameStats& getFrameStats() const { return d_frameStats; }
+
 protected:
     void drawWindowContentToTarget(std::uint32_t drawModeMask);
+    //! Generates the geometry of invalidated RenderingWindow subtrees in parallel.
+    void bufferSurfaceGeometryInParallel(std::uint32_t drawModeMask);
+    /*!
+    \brief
+        Updates the layout and appends the windows whose subtrees the next
+        draw regenerates the geometry of to \a roots.
+    */
+    void collectGeometryRoots(std::vector<Window*>& roots, std::uint32_t drawModeMask);
+    /*!
+    \brief
+        Generates the geometry of the subtrees of \a roots in parallel,
+        counting their windows in \a stats, which holds one entry per root.
+    */
+    static void runGeometryJobs(const std::vector<Window*>& roots,
+                                const std::vector<FrameStats*>& stats,
+                                std::uint32_t drawModeMask,
+                                GeometryJobSystem* jobSystem);
+    //! Exchanges the figures of the finished frame with the Renderer's statistics.
+    void finishFrameStats(FrameStats& rendererStats, const FrameStats& rendererStatsBefore);
 
     void createDefaultTooltipWindowInstance() const;
     void destroyDefaultTooltipWindowInstance();
@@ -243,6 +456,26 @@ protected:
 
     //! returns whether the window containing the cursor had changed.
     bool updateWindowContainingCursor_impl() const;
+    //! returns the window containing the cursor if it can be found below the previous one.
+    Window* getCachedCursorTarget(const glm::vec2& pt) const;
+    //! returns whether no window drawn above \a target can be hit in its hit test area.
+    bool isUnoccluded(const Window& target) const;
+    //! returns whether \a wnd or one of its descendants may be hit within \a area.
+    static bool mayBeHitWithin(const Window& wnd, const Rectf& area);
+    //! returns whether a full update of the root would update \a window.
+    bool isUpdateReachable(const Window& window) const;
+    //! updates the windows on the update list, see setSelectiveUpdateEnabled.
+    void updateSelectedWindows(float timeElapsed);
+    //! removes all windows from the update list.
+    void clearUpdateList();
+    //! draws the cached windows and the cursor, redrawing the cache if \a contentChanged.
+    void drawCachedContent(std::uint32_t drawModeMask, bool contentChanged);
+    //! sizes the content cache to the render target and rebuilds its quad.
+    void resizeContentCache();
+    //! remembers the cursor state that was drawn, see needsRedraw.
+    void storeDrawnCursorState();
+    //! returns whether the cursor is drawn as geometry rather than natively.
+    bool isCursorDrawn() const;
     void resetWindowContainingCursor();
 
     // event trigger functions.
@@ -286,12 +519,44 @@ protected:
 
     mutable Window* d_windowContainingCursor;
     mutable bool d_windowContainingCursorIsUpToDate;
+    //! Incremented by every change that may move the cursor into another window.
+    std::uint64_t d_windowTreeGeneration = 0;
+    //! Value of d_windowTreeGeneration when d_windowContainingCursor was found.
+    mutable std::uint64_t d_cursorTargetGeneration = 0;
+    //! Whether no other window can be hit within d_windowContainingCursor's hit test area.
+    mutable bool d_cursorTargetUnoccluded = false;
     Window* d_modalWindow = nullptr;
     Window* d_captureWindow = nullptr;
 
     //! The mask of draw modes that must be redrawn
     std::uint32_t d_dirtyDrawModeMask = 0;
 
+    //! Whether area changes are deferred to updateLayout
+    bool d_layoutDeferred = false;
+    //! Whether injectTimePulse only updates the windows on d_updateList
+    bool d_selectiveUpdate = false;
+    //! Windows waiting for the next time pulse
+    std::vector<Window*> d_updateList;
+    //! Windows being updated by the current time pulse, destroyed ones are nulled
+    std::vector<std::pair<Window*, bool>> d_updatingList;
+
+    //! Whether draw is skipped while needsRedraw returns false
+    bool d_drawOnDemand = false;
+    //! Whether the next frame must be drawn regardless of the dirty state
+    bool d_redrawForced = true;
+    //! Cursor state shown by the last frame; visible only if drawn as geometry
+    glm::vec2 d_drawnCursorPosition = glm::vec2(0, 0);
+    const Image* d_drawnCursorImage = nullptr;
+    bool d_drawnCursorVisible = false;
+    //! Persistent target the windows are drawn to, if content caching is enabled
+    TextureTarget* d_contentCache = nullptr;
+    //! The quad showing d_contentCache on the render target
+    std::vector<GeometryBuffer*> d_contentCacheGeometry;
+    //! Whether d_contentCache holds the current windows
+    bool d_contentCacheValid = false;
+    //! Whether updateLayout is currently applying the pending area changes
+    bool d_updatingLayout = false;
+
     CursorsState d_cursorsState;
 
     Event::ScopedConnection d_areaChangedEventConnection;
@@ -300,6 +565,16 @@ protected:
 
     //! the window navigator (if any) used to navigate the GUI
     WindowNavigator* d_windowNavigator = nullptr;
+    //! the job system (if any) used to generate geometry in parallel
+    GeometryJobSystem* d_geometryJobSystem = nullptr;
+    //! whether bufferGeometryInParallel generated the geometry of the next draw
+    bool d_geometryBuffered = false;
+    //! memory for data that lives no longer than a call to draw
+    FrameAllocator d_frameAllocator;
+    //! statistics of the last frame
+    FrameStats d_frameStats;
+    //! statistics of the frame in progress, finished by draw
+    FrameStats d_currentFrameStats;
 };
 
 }
@@ -31,7 +31,9 @@
 #include "CEGUI/Base.h"
 #include "CEGUI/Rectf.h"
 #include "CEGUI/RefCounted.h"
+#include "CEGUI/MemoryAllocator.h"
 #include <glm/gtc/quaternion.hpp>
+#include <memory>
 #include <vector>
 
 #if defined(_MSC_VER)
@@ -42,6 +44,7 @@
 namespace CEGUI
 {
 
+class ClipRegion;
 class RenderMaterial;
 enum class BlendMode : int;
 
@@ -83,12 +86,31 @@ enum class PolygonFillRule : int
 
 //----------------------------------------------------------------------------//
 
+/*!
+\brief
+    Enumerated type that contains the valid shapes of the clipping mask of a
+    GeometryBuffer. The mask is applied by the shader in the same pass as the
+    geometry, so unlike fill rules it requires no stencil buffer.
+*/
+enum class ClippingMaskType : int
+{
+    //! No mask, only the clipping region applies.
+    NoMask,
+    //! A rectangle with rounded corners, evaluated as a signed distance.
+    RoundedRect,
+    //! The alpha channel of an area of a texture, such as an image of an atlas.
+    Texture
+};
+
+//----------------------------------------------------------------------------//
+
 /*!
 \brief
     Abstract class defining the interface for objects that buffer geometry for
     later rendering.
 */
-class CEGUIEXPORT GeometryBuffer
+class CEGUIEXPORT GeometryBuffer :
+    public AllocatedObject<MemoryCategory::Geometry>
 {
 public:
     virtual ~GeometryBuffer();
@@ -99,6 +121,53 @@ public:
     */
     virtual void draw(std::uint32_t drawModeMask = DrawModeMaskAll) const = 0;
 
+    /*!
+    \brief
+        Returns whether the geometry of \a next can be drawn together with the
+        geometry of this GeometryBuffer using a single draw submission.
+
+        This is used by the RenderQueue to merge neighbouring GeometryBuffers
+        of a queue into batches. Two buffers may only be merged if they are
+        rendered using identical state (material, textures, blend mode,
+        clipping, transformation, alpha) and if the vertex data of \a next
+        directly follows the vertex data of this buffer in the underlying
+        renderer specific vertex storage.
+
+        The default implementation returns false, which means that every
+        GeometryBuffer is drawn on its own.
+
+    \param next
+        The GeometryBuffer that directly follows this one in a RenderQueue.
+
+    \return
+        - true if \a next can be drawn as part of the same batch.
+        - false if \a next must be drawn separately.
+    */
+    virtual bool isBatchableWith(const GeometryBuffer& next) const;
+
+    /*!
+    \brief
+        Draw the geometry of a batch of GeometryBuffers that was started by
+        this GeometryBuffer. The batch consists of this buffer and the
+        \a bufferCount - 1 buffers that directly follow it in the RenderQueue,
+        each of which has been confirmed as compatible via isBatchableWith.
+
+        The default implementation simply calls draw, which is correct for all
+        renderers that never report buffers as batchable.
+
+    \param bufferCount
+        The number of GeometryBuffers that are part of the batch, including
+        this one.
+
+    \param vertexCount
+        The total number of vertices of all GeometryBuffers in the batch.
+
+    \param drawModeMask
+        The draw mode mask that was passed to the RenderQueue.
+    */
+    virtual void drawBatch(std::size_t bufferCount, std::size_t vertexCount,
+                           std::uint32_t drawModeMask = DrawModeMaskAll) const;
+
     /*!
     \brief
         Set the translation to be applied to the geometry in the buffer when it
@@ -159,14 +228,46 @@ public:
     */
     void setCustomTransform(const glm::mat4x4& transformation);
 
+    //! Returns the custom transformation matrix set via setCustomTransform.
+    const glm::mat4x4& getCustomTransform() const { return d_customTransform; }
+
+    /*!
+    \brief
+        Set the colours of glyph layers 1 to 3 for buffers drawn with
+        DefaultShaderType::LayeredGlyph, as the columns 1 to 3 of \a colours.
+        Column 0 is unused, layer 0 is drawn in the vertex colour.
+
+        Buffers with different layer colours are never merged.
+    */
+    void setLayerColours(const glm::mat4& colours) { d_layerColours = colours; }
+
+    //! Returns the glyph layer colours set via setLayerColours.
+    const glm::mat4& getLayerColours() const { return d_layerColours; }
+
     /*!
     \brief
         Set the clipping region to be used when rendering this buffer. The
         clipping region for actual rendering will be stored extra after 
         clamping the input region.
+
+        Any ClipRegion set via setClipRegion is released.
     */
     virtual void setClippingRegion(const Rectf& region);
 
+    /*!
+    \brief
+        Makes the buffer use a ClipRegion shared with other buffers. Later
+        changes of \a clipRegion apply to the buffer without touching it.
+
+    \param clipRegion
+        The shared region, or nullptr to go back to the region last set via
+        setClippingRegion.
+    */
+    void setClipRegion(const RefCounted<const ClipRegion>& clipRegion);
+
+    //! Returns the shared ClipRegion of the buffer, or nullptr if it has none.
+    const RefCounted<const ClipRegion>& getClipRegion() const { return d_clipRegion; }
+
     /*!
     \brief
         Gets the set clipping region for this buffer.
@@ -179,6 +280,14 @@ public:
     */
     const Rectf& getPreparedClippingRegion() const;
 
+    /*!
+    \brief
+        Returns whether this buffer is clipped to the same region as \a other,
+        comparing the shared ClipRegion first and the rectangles only when the
+        buffers use different ones.
+    */
+    bool hasEquivalentClipping(const GeometryBuffer& other) const;
+
     /*!
     \brief
         Sets the fill rule that should be used when rendering the geometry.
@@ -197,6 +306,63 @@ public:
     */
     void setStencilPostRenderingVertexCount(unsigned int vertex_count);
 
+    /*!
+    \brief
+        Sets a rounded rectangle as the clipping mask of this buffer. Fragments
+        outside of it are discarded with anti-aliased edges, in the same pass
+        as the geometry and without a stencil buffer.
+
+    \param area
+        The rectangle, in the same coordinates as the vertices of the buffer.
+
+    \param cornerRadius
+        The radius of the corners, limited to half the size of \a area.
+
+    \exception InvalidRequestException
+        thrown if isClippingMaskSupported returns false.
+    */
+    void setClippingMask(const Rectf& area, float cornerRadius);
+
+    /*!
+    \brief
+        Sets an area of a texture as the clipping mask of this buffer. The
+        alpha channel of the texture is multiplied with the alpha of the
+        geometry, and everything outside of \a area is discarded.
+
+    \param area
+        The area the mask covers, in the same coordinates as the vertices of
+        the buffer.
+
+    \param texture
+        The texture holding the mask, for example the atlas texture of an image.
+
+    \param texArea
+        The texture coordinates of the mask within \a texture.
+
+    \exception InvalidRequestException
+        thrown if isClippingMaskSupported returns false.
+    */
+    void setClippingMask(const Rectf& area, const Texture* texture, const Rectf& texArea);
+
+    //! Removes the clipping mask of this buffer.
+    void clearClippingMask();
+
+    //! Returns the shape of the clipping mask of this buffer.
+    ClippingMaskType getClippingMaskType() const { return d_clippingMaskType; }
+
+    //! Returns the area covered by the clipping mask of this buffer.
+    const Rectf& getClippingMaskArea() const { return d_clippingMaskArea; }
+
+    /*!
+    \brief
+        Returns whether the shader of this buffer is able to apply a clipping
+        mask. The default implementation returns false.
+    */
+    virtual bool isClippingMaskSupported() const;
+
+    //! Returns whether \a other has the same clipping mask as this buffer.
+    bool hasEquivalentClippingMask(const GeometryBuffer& other) const;
+
     /*!
     \brief
         Append the geometry data to the existing data
@@ -274,6 +440,130 @@ public:
     */
     virtual void appendGeometry(const TexturedColouredVertex* vertex_array, std::size_t vertex_count);
 
+    /*!
+    \brief
+        Append a textured quad, given by its four corners, to a GeometryBuffer
+        with texture coordinate and colour attributes.
+
+        If quad indices are in use only the four corners are stored, otherwise
+        the quad is appended as two triangles split along the top-left to
+        bottom-right diagonal.
+
+    \param corners
+        Pointer to an array of the four corners of the quad, in the order
+        top-left, bottom-left, bottom-right, top-right.
+    */
+    void appendQuad(const TexturedColouredVertex* corners);
+
+    /*!
+    \brief
+        Sets whether quads appended via appendQuad may be stored as four
+        vertices, which the renderer draws through a shared index buffer. This
+        only has an effect if isQuadIndexingSupported returns true.
+
+        Appending any other geometry, or setting a fill rule, converts the
+        stored quads back to triangles, so that the buffer can hold any kind
+        of geometry. Disabling quad indexing converts them as well.
+    */
+    void setQuadIndexingEnabled(bool enabled);
+
+    //! Returns whether quad indexing was enabled via setQuadIndexingEnabled.
+    bool isQuadIndexingEnabled() const { return d_quadIndexingEnabled; }
+
+    /*!
+    \brief
+        Returns whether the vertex data currently consists solely of quads of
+        four vertices each, which have to be drawn using the indices created
+        by appendQuadIndices.
+    */
+    bool isUsingQuadIndices() const { return d_usingQuadIndices; }
+
+    /*!
+    \brief
+        Returns whether the renderer of this GeometryBuffer is able to draw
+        quads stored as four vertices. The default implementation returns false.
+    */
+    virtual bool isQuadIndexingSupported() const;
+
+    /*!
+    \brief
+        Appends the triangle list indices for another \a quad_count quads of
+        four vertices to \a indices, continuing after the quads it already
+        contains. Renderers use this to fill their shared index buffer.
+    */
+    static void appendQuadIndices(std::vector<std::uint32_t>& indices,
+                                  std::size_t quad_count);
+
+    /*!
+    \brief
+        Append a textured quad of a single colour to a GeometryBuffer with
+        texture coordinate and colour attributes.
+
+        Renderers that support instancing store the quad as a compact instance
+        which is drawn from shared quad vertices, as long as the GeometryBuffer
+        holds no vertices. Appending vertices turns the stored instances back
+        into vertices, so that the quads keep the order they were added in.
+        Otherwise, as done by this default implementation, the quad is appended
+        via appendQuad.
+
+    \param destRect
+        The area the quad covers.
+
+    \param texRect
+        The texture coordinates of the quad.
+
+    \param colour
+        The colour the texture is multiplied with.
+    */
+    virtual void appendQuadInstance(const Rectf& destRect, const Rectf& texRect,
+                                    const Colour& colour);
+
+    /*!
+    \brief
+        Returns the number of quads stored as instances by appendQuadInstance.
+        Their vertices are not included in getVertexCount.
+    */
+    virtual std::size_t getQuadInstanceCount() const;
+
+    /*!
+    \brief
+        Returns whether appendQuadInstance stores quads as instances rather
+        than as vertices. The default implementation returns false.
+    */
+    virtual bool isQuadInstancingSupported() const;
+
+    /*!
+    \brief
+        Append a batch of textured quads to a GeometryBuffer with texture
+        coordinate and colour attributes.
+
+        The quads are clipped in SIMD registers, with their texture
+        coordinates adjusted to the clipped area, and their positions are
+        aligned to whole pixels. Quads left empty by clipping are skipped.
+        The vertices of the whole batch are written into a single array that
+        is appended at once, so renderers update their buffers once per batch
+        instead of once per quad. Quads of a single colour are appended via
+        appendQuadInstance if isQuadInstancingSupported returns true.
+
+    \param destAreas
+        Array of the areas the quads cover, before clipping.
+
+    \param texAreas
+        Array of the texture coordinates matching \a destAreas.
+
+    \param colours
+        Array of the colours of the corners of the quads.
+
+    \param count
+        The number of quads in each of the arrays.
+
+    \param clipArea
+        The area to clip the quads to, or nullptr to not clip them.
+    */
+    void appendTexturedQuads(const Rectf* destAreas, const Rectf* texAreas,
+                             const ColourRect* colours, std::size_t count,
+                             const Rectf* clipArea);
+
     /*!
     \brief
         A helper function that sets a texture parameter of the RenderMaterial of this
@@ -311,6 +601,114 @@ public:
     */
     virtual void reset();
 
+    /*!
+    \brief
+        Clears all buffered data via reset and restores the transformation,
+        clipping, alpha, blend mode, fill rule and RenderEffect to the values
+        of a newly created GeometryBuffer, so that it can be refilled by a new
+        user. Renderer resources, such as vertex buffer capacity, are kept.
+    */
+    void resetForReuse();
+
+    /*!
+    \brief
+        Replaces the geometry of this GeometryBuffer with a copy of the
+        geometry of \a source, along with its textures, blend mode, clipping
+        flag and fill rule. The transformation, clipping region and alpha are
+        left unchanged.
+
+        Both buffers must have been created by the same Renderer for the same
+        vertex layout and shader.
+    */
+    virtual void copyGeometryFrom(const GeometryBuffer& source);
+
+    /*!
+    \brief
+        Same as copyGeometryFrom, except that the copied geometry is clipped
+        to \a clip_rect.
+
+        This is meant for the geometry of imagery, which is made of axis
+        aligned rectangles: every triangle, quad or quad instance is clipped
+        by clamping its corners to \a clip_rect and interpolating their other
+        attributes, such as texture coordinates, over the primitive.
+        Primitives lying completely outside of \a clip_rect are dropped.
+
+    \param clip_rect
+        The rectangle to clip to, in the coordinates of the vertices.
+    */
+    virtual void copyClippedGeometryFrom(const GeometryBuffer& source, const Rectf& clip_rect);
+
+    /*!
+    \brief
+        Returns whether the geometry of this GeometryBuffer can be merged into
+        another buffer by appendMergedGeometryFrom. This requires the buffer to
+        be drawn without RenderEffect, stencil fill rule or quad instances and
+        to be transformed by a translation only.
+    */
+    bool isMergeable() const;
+
+    /*!
+    \brief
+        Returns whether both this buffer and \a other are mergeable and are
+        drawn with the same shader, textures, blend mode and vertex layout, so
+        that their geometry can be drawn as part of one buffer.
+    */
+    bool isMergeableWith(const GeometryBuffer& other) const;
+
+    /*!
+    \brief
+        Computes the area of the render target the geometry of this buffer is
+        drawn to, taking the translation and the clipping region into account.
+
+    \param area
+        Rectf that receives the area. It is empty if nothing is drawn.
+
+    \return
+        - true if \a area was computed.
+        - false if the area can not be determined cheaply, which is the case
+          for buffers that are not mergeable.
+    */
+    bool getDrawnArea(Rectf& area) const;
+
+    /*!
+    \brief
+        Computes the area of the render target that the geometry of this
+        buffer covers completely with opaque pixels, hiding whatever was drawn
+        there before.
+
+        This is only found for a buffer drawing a single axis aligned quad,
+        with opaque vertex colours and either no texture or one reporting
+        Texture::isOpaque, at full alpha and with normal blending, without a
+        clipping mask and without the conditions that make getDrawnArea fail.
+
+    \param area
+        Rectf that receives the covered area.
+
+    \return
+        true if the buffer covers \a area completely, false otherwise.
+    */
+    bool getOpaqueArea(Rectf& area) const;
+
+    /*!
+    \brief
+        Returns whether this buffer and \a other are blended the same way,
+        which is always the case while the Renderer uses premultiplied alpha.
+    */
+    bool hasEquivalentBlendMode(const GeometryBuffer& other) const;
+
+    /*!
+    \brief
+        Appends the geometry of the mergeable buffer \a source with its
+        translation and alpha applied to the vertices. If this buffer holds no
+        geometry yet, it takes on the textures and blend mode of \a source.
+
+        The clipping of \a source is not applied, so its geometry should lie
+        within its clipping region as well as within the clipping region of
+        this buffer. Both buffers must have been created by the same Renderer
+        for the same vertex layout and shader.
+    */
+    void appendMergedGeometryFrom(const GeometryBuffer& source);
+
     /*!
     \brief
         Returns the vertex count of this GeometryBuffer, which is determined based
@@ -490,6 +888,25 @@ public:
     */
     glm::mat4 getModelMatrix() const;
 
+    /*!
+    \brief
+        Returns the model matrix of this GeometryBuffer combined with the view
+        projection matrix \a viewProjMatrix.
+
+        The result and its inverse are cached until the transformation of this
+        GeometryBuffer or \a viewProjMatrix change, so that repeatedly
+        unprojecting points, e.g. when hit testing a rotated RenderingWindow
+        on every cursor move, does not rebuild and invert the matrices.
+    */
+    const glm::mat4& getModelViewProjMatrix(const glm::mat4& viewProjMatrix) const;
+
+    /*!
+    \brief
+        Returns the inverse of getModelViewProjMatrix for \a viewProjMatrix,
+        which is cached the same way.
+    */
+    const glm::mat4& getInverseModelViewProjMatrix(const glm::mat4& viewProjMatrix) const;
+
     /*!
     \brief
         Scales the texture coordinates of this geometry buffer by the supplied factor, if the
@@ -502,6 +919,35 @@ public:
 protected:  
     GeometryBuffer(RefCounted<RenderMaterial> renderMaterial);
 
+    /*!
+    \brief
+        Appends the quads stored as instances by appendQuadInstance as vertices,
+        in the order they were added, and removes the instances. This is done
+        before vertices are appended, as instances can not be drawn in between
+        them. The default implementation does nothing, as it stores no instances.
+    */
+    virtual void convertQuadInstancesToVertices();
+
+    /*!
+    \brief
+        Returns the clipping mask packed into a matrix for the shaders: the
+        first column holds the mask area, the second the texture area and the
+        third the ClippingMaskType and the corner radius.
+    */
+    glm::mat4 getClippingMaskMatrix() const;
+
+    //! Matrices cached for unprojecting points onto the geometry.
+    struct TransformCache
+    {
+        //! View projection matrix the other matrices were calculated for.
+        glm::mat4 d_viewProjMatrix;
+        glm::mat4 d_modelViewProjMatrix;
+        glm::mat4 d_inverseModelViewProjMatrix;
+    };
+
+    //! Recalculates d_transformCache if it does not match \a viewProjMatrix.
+    void updateTransformCache(const glm::mat4& viewProjMatrix) const;
+
     //! Reference to the RenderMaterial used for this GeometryBuffer
     RefCounted<RenderMaterial>  d_renderMaterial;
 
@@ -529,6 +975,8 @@ protected:
     glm::vec3       d_pivot;
     //! custom transformation matrix
     glm::mat4x4     d_customTransform;
+    //! colours of glyph layers 1 to 3, used by the layered glyph shader
+    glm::mat4       d_layerColours;
     /*
     \brief
         true, when there have been no translations, rotations or other transformations applied to the GeometryBuffer,
@@ -536,6 +984,10 @@ protected:
         since the last update.
     */
     mutable bool    d_matrixValid;
+    //! Matrices for unprojecting points, allocated when first needed.
+    mutable std::unique_ptr<TransformCache> d_transformCache;
+    //! false when the transformation changed since d_transformCache was calculated.
+    mutable bool    d_transformCacheValid;
     //! The RenderTarget that this GeometryBuffer's matrix was last updated for
     mutable const RenderTarget*   d_lastRenderTarget;
     //! The activation number of the RenderTarget that this GeometryBuffer's matrix was last updated for
@@ -555,11 +1007,34 @@ protected:
     Rectf           d_clippingRegion;
     //! Clipping region clamped to 0, for usage in rendering
     Rectf           d_preparedClippingRegion;
+    //! Shared clipping region, used instead of the two above when set.
+    RefCounted<const ClipRegion> d_clipRegion;
     //! True if clipping will be active for the current batch
     bool            d_clippingActive;
     //! The alpha value which will be applied to the whole buffer when rendering
     float           d_alpha;
-
+    //! True if quads may be stored as four indexed vertices
+    bool            d_quadIndexingEnabled;
+    //! True if the vertex data consists solely of quads of four vertices
+    bool            d_usingQuadIndices;
+    //! Shape of the clipping mask.
+    ClippingMaskType d_clippingMaskType;
+    //! Area covered by the clipping mask.
+    Rectf           d_clippingMaskArea;
+    //! Radius of the corners of a rounded rectangle mask.
+    float           d_clippingMaskCornerRadius;
+    //! Texture holding the mask of a texture mask.
+    const Texture*  d_clippingMaskTexture;
+    //! Texture coordinates of a texture mask.
+    Rectf           d_clippingMaskTexArea;
+
+private:
+    //! Returns whether the next quads can be stored as four indexed vertices.
+    bool canAppendIndexedQuads() const;
+    //! Converts the stored quads of four vertices into two triangles each.
+    void convertQuadsToTriangles();
+    //! Sets the textures of \a source on our RenderMaterial.
+    void copyTexturesFrom(const GeometryBuffer& source);
 };
 
 }
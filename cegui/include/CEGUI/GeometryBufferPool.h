@@ -0,0 +1,145 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIGeometryBufferPool_h_
+#define _CEGUIGeometryBufferPool_h_
+
+#include "CEGUI/Renderer.h"
+#include <unordered_map>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Pool of GeometryBuffers that keeps buffers of a previous geometry pass
+    around so that they can be refilled instead of being recreated.
+
+    While a pool is active on the Renderer (see Renderer::setActiveGeometryBufferPool)
+    the Renderer::createGeometryBufferTextured and
+    Renderer::createGeometryBufferColoured overloads taking no RenderMaterial
+    hand out recycled buffers, cleared via GeometryBuffer::resetForReuse, before
+    creating new ones. Buffers created with a custom RenderMaterial are never
+    pooled.
+
+    A pass is started with beginPass, which takes the buffers that resulted
+    from the previous pass, and is finished with endPass, which receives the
+    buffers resulting from the new one.
+*/
+class CEGUIEXPORT GeometryBufferPool
+{
+public:
+    GeometryBufferPool();
+    ~GeometryBufferPool();
+
+    GeometryBufferPool(const GeometryBufferPool&) = delete;
+    GeometryBufferPool& operator=(const GeometryBufferPool&) = delete;
+
+    /*!
+    \brief
+        Starts a geometry pass. Buffers in \a buffers that were handed out by
+        this pool are made available for reuse, all others are destroyed.
+        \a buffers is cleared afterwards.
+    */
+    void beginPass(std::vector<GeometryBuffer*>& buffers);
+
+    /*!
+    \brief
+        Ends a geometry pass. Records which of the buffers handed out during
+        the pass ended up in \a buffers, so they can be reused by the next pass.
+    */
+    void endPass(const std::vector<GeometryBuffer*>& buffers);
+
+    /*!
+    \brief
+        Returns a free buffer of the given default shader type, or nullptr if
+        there is none. The buffer is cleared and counts as a hit, otherwise a
+        miss is counted.
+    */
+    GeometryBuffer* acquire(DefaultShaderType shaderType);
+
+    //! Records that \a buffer of the given type was handed out by the Renderer.
+    void notifyIssued(GeometryBuffer& buffer, DefaultShaderType shaderType);
+
+    /*!
+    \brief
+        Returns whether \a buffer was handed out during the current pass and
+        if so, sets \a shaderType to the type it was created for.
+    */
+    bool getIssuedShaderType(const GeometryBuffer& buffer, DefaultShaderType& shaderType) const;
+
+    //! Forgets about \a buffer, which is about to be destroyed.
+    void notifyDestroyed(const GeometryBuffer& buffer);
+
+    //! Destroys all buffers that are free for reuse.
+    void clear();
+
+    //! Returns the number of requests that were served with a recycled buffer.
+    std::size_t getHitCount() const { return d_hitCount; }
+
+    //! Returns the number of requests that required a new buffer.
+    std::size_t getMissCount() const { return d_missCount; }
+
+    /*!
+    \brief
+        Returns the ratio of requests served with a recycled buffer, in the
+        range [0, 1]. Returns 0 if no requests were made yet.
+    */
+    float getHitRate() const;
+
+    //! Returns the number of buffers that are currently free for reuse.
+    std::size_t getFreeBufferCount() const;
+
+    //! Resets the hit and miss counters.
+    void resetStatistics();
+
+private:
+    typedef std::unordered_map<const GeometryBuffer*, DefaultShaderType> BufferTypeMap;
+
+    //! Buffers free for reuse, one list per DefaultShaderType.
+    std::vector<GeometryBuffer*> d_freeBuffers[static_cast<int>(DefaultShaderType::Count)];
+    //! Buffers handed out during the current pass.
+    BufferTypeMap d_issuedBuffers;
+    //! Buffers of the last finished pass that can be recycled.
+    BufferTypeMap d_ownedBuffers;
+
+    std::size_t d_hitCount;
+    std::size_t d_missCount;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIGeometryBufferPool_h_
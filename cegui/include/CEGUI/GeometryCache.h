@@ -0,0 +1,268 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIGeometryCache_h_
+#define _CEGUIGeometryCache_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/Rectf.h"
+#include "CEGUI/Renderer.h"
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class GeometryBuffer;
+
+/*!
+\brief
+    Key identifying the geometry produced by some piece of imagery.
+
+    The key is made of the object that produced the geometry and all the
+    values its geometry depends on, such as the destination areas, colours
+    and images that were resolved for the window being drawn.
+*/
+class CEGUIEXPORT GeometryCacheKey
+{
+public:
+    //! Creates an empty key for geometry produced by \a source.
+    explicit GeometryCacheKey(const void* source);
+
+    void add(std::uint32_t value);
+    void add(float value);
+    void add(const void* pointer);
+    void add(const Rectf& rect);
+    void add(const ColourRect& colours);
+
+    bool operator==(const GeometryCacheKey& rhs) const;
+    bool operator!=(const GeometryCacheKey& rhs) const { return !(*this == rhs); }
+
+private:
+    void addValue(std::uintptr_t value);
+
+    std::vector<std::uintptr_t> d_values;
+    std::size_t d_hash;
+};
+
+/*!
+\brief
+    Per window cache of GeometryBuffers built for imagery that was already
+    drawn with the same inputs, such as the imagery of a previous state.
+
+    Buffers stored in the cache are owned by it: they are removed from the
+    active GeometryBufferPool and are appended to the window again, without
+    being rebuilt, when geometry with an equal key is requested. Entries
+    that were not used recently are destroyed at the start of a geometry
+    pass once the cache holds more than its capacity.
+*/
+class CEGUIEXPORT GeometryCache
+{
+public:
+    //! Default number of entries a cache keeps across geometry passes.
+    static const std::size_t DefaultCapacity;
+
+    GeometryCache();
+    ~GeometryCache();
+
+    GeometryCache(const GeometryCache&) = delete;
+    GeometryCache& operator=(const GeometryCache&) = delete;
+
+    /*!
+    \brief
+        Starts a geometry pass. Removes the buffers owned by the cache from
+        \a buffers, so that the pass does not recycle nor destroy them, and
+        evicts the least recently used entries above the capacity.
+    */
+    void beginPass(std::vector<GeometryBuffer*>& buffers);
+
+    //! Removes the buffers owned by the cache from \a buffers.
+    void detach(std::vector<GeometryBuffer*>& buffers) const;
+
+    /*!
+    \brief
+        Returns the buffers stored for \a key, or nullptr if there are none.
+        Counts as a hit or a miss.
+    */
+    const std::vector<GeometryBuffer*>* find(const GeometryCacheKey& key);
+
+    /*!
+    \brief
+        Takes ownership of the buffers in \a buffers starting at index
+        \a first and stores them for \a key. Does nothing if the capacity
+        is zero.
+    */
+    void store(const GeometryCacheKey& key,
+               const std::vector<GeometryBuffer*>& buffers, std::size_t first);
+
+    //! Destroys all entries. Their buffers must have been detached already.
+    void clear();
+
+    /*!
+    \brief
+        Sets the number of entries kept across geometry passes. A capacity of
+        zero disables the cache.
+    */
+    void setCapacity(std::size_t capacity);
+    //! Returns the number of entries kept across geometry passes.
+    std::size_t getCapacity() const { return d_capacity; }
+
+    //! Returns the number of entries currently held.
+    std::size_t getEntryCount() const { return d_entries.size(); }
+
+    //! Returns the number of lookups that found stored geometry.
+    std::size_t getHitCount() const { return d_hitCount; }
+    //! Returns the number of lookups that required building the geometry.
+    std::size_t getMissCount() const { return d_missCount; }
+    //! Resets the hit and miss counters.
+    void resetStatistics();
+
+private:
+    struct Entry
+    {
+        GeometryCacheKey d_key;
+        std::vector<GeometryBuffer*> d_buffers;
+        //! Pass in which the entry was last used.
+        std::uint64_t d_lastUsedPass;
+    };
+
+    void destroyEntry(Entry& entry);
+
+    std::vector<Entry> d_entries;
+    //! All buffers held by d_entries.
+    std::unordered_set<const GeometryBuffer*> d_ownedBuffers;
+    std::size_t d_capacity;
+    std::uint64_t d_pass;
+    std::size_t d_hitCount;
+    std::size_t d_missCount;
+};
+
+/*!
+\brief
+    Cache of geometry templates shared by all windows.
+
+    Windows that share a look and a size, such as the buttons of a toolbar,
+    draw identical imagery. The geometry of imagery is relative to its window,
+    so the geometry built for one window is stored here as a template and
+    copied into new GeometryBuffers for the next window drawing the same
+    imagery with an equal key, which skips computing it again. Each window
+    then applies its own translation, clipping and alpha to the copies.
+
+    Only geometry made of buffers handed out by the active GeometryBufferPool
+    can be stored, as their shader type is needed to create the copies.
+    Templates are evicted in least recently used order once the capacity is
+    reached. The cache may be used by several threads at once.
+*/
+class CEGUIEXPORT GeometryTemplateCache
+{
+public:
+    //! Default number of templates the cache holds.
+    static const std::size_t DefaultCapacity;
+
+    GeometryTemplateCache();
+    ~GeometryTemplateCache();
+
+    GeometryTemplateCache(const GeometryTemplateCache&) = delete;
+    GeometryTemplateCache& operator=(const GeometryTemplateCache&) = delete;
+
+    /*!
+    \brief
+        Appends copies of the template stored for \a key to \a buffers.
+
+    \return
+        true if a template was found, false otherwise.
+    */
+    bool instantiate(const GeometryCacheKey& key, std::vector<GeometryBuffer*>& buffers);
+
+    /*!
+    \brief
+        Stores copies of the buffers in \a buffers starting at index \a first
+        as the template for \a key. Nothing is stored if one of the buffers
+        was not handed out by the active GeometryBufferPool.
+    */
+    void store(const GeometryCacheKey& key,
+               const std::vector<GeometryBuffer*>& buffers, std::size_t first);
+
+    //! Destroys all templates.
+    void clear();
+
+    //! Sets the number of templates held. A capacity of zero disables the cache.
+    void setCapacity(std::size_t capacity);
+    //! Returns the number of templates held at most.
+    std::size_t getCapacity() const { return d_capacity; }
+
+    //! Returns the number of templates currently held.
+    std::size_t getEntryCount() const;
+
+    //! Returns the number of lookups that found a template.
+    std::size_t getHitCount() const { return d_hitCount; }
+    //! Returns the number of lookups that found no template.
+    std::size_t getMissCount() const { return d_missCount; }
+    //! Resets the hit and miss counters.
+    void resetStatistics();
+
+private:
+    struct TemplateBuffer
+    {
+        GeometryBuffer* d_buffer;
+        DefaultShaderType d_shaderType;
+    };
+
+    struct Entry
+    {
+        GeometryCacheKey d_key;
+        std::vector<TemplateBuffer> d_buffers;
+        //! Value of d_useCounter when the entry was last used.
+        std::uint64_t d_lastUsed;
+    };
+
+    void destroyEntry(Entry& entry);
+    //! Destroys the entry that was not used for the longest time.
+    void evictLeastRecentlyUsed();
+
+    std::vector<Entry> d_entries;
+    std::size_t d_capacity;
+    std::uint64_t d_useCounter;
+    std::size_t d_hitCount;
+    std::size_t d_missCount;
+    mutable std::mutex d_mutex;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIGeometryCache_h_
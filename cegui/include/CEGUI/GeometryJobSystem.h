@@ -0,0 +1,78 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIGeometryJobSystem_h_
+#define _CEGUIGeometryJobSystem_h_
+
+#include "CEGUI/Base.h"
+#include <functional>
+#include <vector>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Interface through which the host application lets a GUIContext generate
+    the geometry of independent window subtrees in parallel.
+
+    When a GeometryJobSystem is set via GUIContext::setGeometryJobSystem, the
+    GUIContext hands one job per invalidated RenderingWindow subtree to
+    runJobs before it draws the window hierarchy. A job only builds the CPU
+    side geometry of the windows in its subtree (Window::bufferGeometry);
+    queueing and submitting that geometry to the GPU still happens on the
+    thread calling GUIContext::draw.
+
+\note
+    The jobs run the Window::EventRenderingStarted and
+    Window::EventRenderingEnded handlers and the WindowRenderers of the windows
+    involved. Falagard geometry generation does not touch the GPU, but glyphs
+    of dynamically rasterised fonts that are not yet prepared will be
+    uploaded from the job's thread. Prepare the text of parallel subtrees up
+    front, or do not use this mode with such fonts.
+*/
+class CEGUIEXPORT GeometryJobSystem
+{
+public:
+    //! Type of a single job.
+    typedef std::function<void()> Job;
+
+    virtual ~GeometryJobSystem() {}
+
+    /*!
+    \brief
+        Runs all of \a jobs and returns once every one of them has finished.
+
+        The jobs are independent of each other and may be run in any order,
+        on any thread, including the calling one. A job never throws; errors
+        are collected and rethrown by the GUIContext after runJobs returns.
+    */
+    virtual void runJobs(const std::vector<Job>& jobs) = 0;
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIGeometryJobSystem_h_
@@ -30,6 +30,8 @@
 #include "CEGUI/EventSet.h"
 #include "CEGUI/Singleton.h"
 
+#include <cstdint>
+
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -93,6 +95,27 @@ public:
 		Nothing.
 	*/
     void fireEvent(const String& name, EventArgs& args, const String& eventNamespace = "") override;
+    using EventSet::fireEvent;
+
+protected:
+    void notifyEventAdded(const Event& event) override;
+
+    /*!
+    \brief
+        Return the bit of the filter of subscribed event names that \a name
+        maps to. Computed from the length and the first and last characters
+        only, so that checking the filter costs next to nothing.
+    */
+    static std::uint64_t getNameFilterBit(const String& name);
+
+    /*!
+    \brief
+        Bloom filter of the names, without namespace, of the events in this
+        set. An event whose name's bit isn't set has no global subscribers,
+        so firing it can skip building the "Namespace/Name" key and the lookup.
+        Bits are never cleared, as a removed event only costs a false positive.
+    */
+    std::uint64_t d_subscribedNameFilter = 0;
 };
 
 } // End of  CEGUI namespace section
@@ -0,0 +1,179 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIGradientImage_h_
+#define _CEGUIGradientImage_h_
+
+#include "CEGUI/Image.h"
+#include "CEGUI/ColourRect.h"
+
+#include <glm/glm.hpp>
+#include <functional>
+#include <vector>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Image that is not backed by a texture but generated procedurally as
+    vertex-coloured geometry.
+
+    The area of the Image is subdivided into a grid of cells and the colour
+    function is only evaluated at the corners of those cells; the colours
+    in between are interpolated by the GPU. This allows large, frequently
+    changing gradients to be drawn without generating and uploading any
+    pixel data. When no colour function is set, the corner colours set via
+    setColours are interpolated across the Image.
+
+    An optional checkerboard can be drawn behind the gradient, which is
+    useful to visualise translucent colours.
+*/
+class CEGUIEXPORT GradientImage : public Image
+{
+public:
+    /*!
+    \brief
+        Function returning the colour of the gradient at a position given
+        relative to the Image area, where (0, 0) is the top-left and (1, 1)
+        the bottom-right corner.
+    */
+    typedef std::function<Colour(const glm::vec2&)> ColourFunction;
+
+    GradientImage(const String& name);
+    GradientImage(const XMLAttributes& attributes);
+
+    // Implement CEGUI::Image interface
+    std::vector<GeometryBuffer*> createRenderGeometry(
+        const ImageRenderSettings& render_settings) const override;
+
+    void appendRenderGeometry(std::vector<GeometryBuffer*>& geomBuffers,
+        const ImageRenderSettings& render_settings) const override;
+
+    /*!
+    \brief
+        Adds the gradient to an existing GeometryBuffer.
+
+    \exception InvalidRequestException
+        thrown if \a geomBuffer does not use the vertex layout of coloured
+        geometry.
+    */
+    void addToRenderGeometry(
+        GeometryBuffer& geomBuffer,
+        const Rectf& renderArea,
+        const Rectf* clipArea,
+        const ColourRect& colours) const override;
+
+    /*!
+    \brief
+        Sets the function the gradient colours are evaluated with. An empty
+        function interpolates the colours set via setColours instead.
+    */
+    void setColourFunction(const ColourFunction& colour_function);
+
+    //! Returns the function the gradient colours are evaluated with.
+    const ColourFunction& getColourFunction() const;
+
+    //! Sets the corner colours used when no colour function is set.
+    void setColours(const ColourRect& colours);
+
+    //! Returns the corner colours used when no colour function is set.
+    const ColourRect& getColours() const;
+
+    /*!
+    \brief
+        Sets the number of grid cells the Image is split into horizontally and
+        vertically. More cells follow non-linear colour functions more closely
+        at the cost of more vertices. Both values are clamped to at least 1.
+    */
+    void setSubdivisions(unsigned int horizontal, unsigned int vertical);
+
+    //! Returns the number of grid cells the Image is split into horizontally.
+    unsigned int getHorizontalSubdivisions() const;
+
+    //! Returns the number of grid cells the Image is split into vertically.
+    unsigned int getVerticalSubdivisions() const;
+
+    /*!
+    \brief
+        Sets a checkerboard to be drawn behind the gradient.
+
+    \param cell_size
+        Size of the checkerboard squares in the units of the Image area. A
+        size of 0 disables the checkerboard.
+    \param colour1
+        Colour of the square at the top-left corner.
+    \param colour2
+        Colour of the alternating squares.
+    */
+    void setCheckerboard(float cell_size, const Colour& colour1,
+                         const Colour& colour2);
+
+    //! Returns the size of the checkerboard squares, 0 if it is disabled.
+    float getCheckerboardCellSize() const;
+
+protected:
+    //! Appends the vertices of the checkerboard and the gradient.
+    void appendVertices(std::vector<ColouredVertex>& vertices,
+                        const Rectf& renderArea, const Rectf* clipArea,
+                        const ColourRect& colours) const;
+
+    //! Appends the squares of the checkerboard behind the gradient.
+    void appendCheckerboardVertices(std::vector<ColouredVertex>& vertices,
+                                    const Rectf& destArea, const Rectf& finalArea,
+                                    const ColourRect& colours) const;
+
+    //! Returns the gradient colour at the given position relative to the Image.
+    Colour getGradientColour(const glm::vec2& rel_pos) const;
+
+    //! Function the gradient colours are evaluated with.
+    ColourFunction d_colourFunction;
+    //! Corner colours interpolated when no colour function is set.
+    ColourRect d_colours;
+    //! Number of grid cells the Image is split into horizontally.
+    unsigned int d_horizontalSubdivisions;
+    //! Number of grid cells the Image is split into vertically.
+    unsigned int d_verticalSubdivisions;
+    //! Size of the checkerboard squares in Image units, 0 if disabled.
+    float d_checkerboardCellSize;
+    //! Colour of the top-left checkerboard square.
+    Colour d_checkerboardColour1;
+    //! Colour of the alternating checkerboard squares.
+    Colour d_checkerboardColour2;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIGradientImage_h_
@@ -0,0 +1,152 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIHotReloader_h_
+#define _CEGUIHotReloader_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/String.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Watches look & feel, imageset and layout files and reloads the ones that
+    changed, to iterate on a skin without restarting the application.
+
+    checkForChanges asks the ResourceProvider for the version of every watched
+    file (see ResourceProvider::getResourceVersion) and reloads the changed
+    ones incrementally:
+    - imagesets via ImageManager::reloadImageset, which loads the texture in
+      place and updates the existing images;
+    - look & feel files via WidgetLookManager::reloadLookNFeelSpecificationFromFile,
+      which only reassigns the looks that changed to the windows using them;
+    - layouts by loading the file again and putting the new windows in place
+      of the previous ones, which are destroyed.
+
+    Files that fail to reload are logged and keep their previous content, so
+    a file saved halfway does not bring the application down.
+*/
+class CEGUIEXPORT HotReloader
+{
+public:
+    /*!
+    \brief
+        Function called with the root of a layout that was loaded again. The
+        previous root was destroyed, pointers to its windows must be updated.
+    */
+    typedef std::function<void(Window& reloaded)> LayoutReloadedCallback;
+
+    //! Watches a look & feel file loaded before.
+    void watchLookNFeel(const String& filename, const String& resourceGroup = "");
+
+    //! Watches an imageset file loaded before.
+    void watchImageset(const String& filename, const String& resourceGroup = "");
+
+    //! Watches the look & feel and imageset files of \a scheme.
+    void watchScheme(const Scheme& scheme);
+
+    /*!
+    \brief
+        Watches the layout file \a root was loaded from.
+
+        When the file changes, its windows are loaded again and replace \a root
+        in its parent, or as root window of its GUIContext, and \a callback is
+        called. The watch ends once the root is destroyed elsewhere.
+    */
+    void watchLayout(Window& root, const String& filename, const String& resourceGroup = "",
+                     LayoutReloadedCallback callback = LayoutReloadedCallback());
+
+    //! Stops watching all files.
+    void unwatchAll();
+
+    //! Returns the number of watched files.
+    size_t getWatchedFileCount() const { return d_files.size(); }
+
+    /*!
+    \brief
+        Reloads the watched files that changed since they were watched or last
+        reloaded, imagesets first, then look & feels, then layouts.
+
+    \return
+        The number of files that were reloaded.
+    */
+    size_t checkForChanges();
+
+private:
+    //! Kinds of watched files, in the order they are reloaded.
+    enum class FileType
+    {
+        Imageset,
+        LookNFeel,
+        Layout
+    };
+
+    //! A watched file.
+    struct WatchedFile
+    {
+        FileType d_type;
+        String d_filename;
+        String d_resourceGroup;
+        //! Version when the file was last loaded.
+        std::uint64_t d_version;
+        //! Root of the layout, for FileType::Layout.
+        Window* d_layoutRoot;
+        LayoutReloadedCallback d_layoutReloaded;
+    };
+
+    //! Adds a file to the watched files, replacing an earlier watch of it.
+    void watch(FileType type, const String& filename, const String& resourceGroup,
+               Window* layoutRoot, LayoutReloadedCallback callback);
+
+    //! Loads \a file again, returns false if this failed.
+    bool reload(WatchedFile& file);
+
+    //! Replaces the root of a layout by the windows loaded again from the file.
+    void reloadLayout(WatchedFile& file);
+
+    //! Returns the version of \a file, as reported by the ResourceProvider.
+    static std::uint64_t getVersion(const WatchedFile& file);
+
+    std::vector<WatchedFile> d_files;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
+#endif	// end of guard _CEGUIHotReloader_h_
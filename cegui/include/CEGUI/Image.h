@@ -229,6 +229,22 @@ public:
     virtual std::vector<GeometryBuffer*> createRenderGeometry(
         const ImageRenderSettings& render_settings) const = 0;
 
+    /*!
+    \brief
+        Creates the GeometryBuffers of the Image like createRenderGeometry, but
+        appends them to an existing container instead of returning a new one.
+        This avoids allocating a container per image when the geometry is
+        collected into the list of a Window anyway.
+
+    \param geomBuffers
+        The container the new GeometryBuffers are appended to.
+
+    \param render_settings
+        The ImageRenderSettings that contain render settings for new GeometryBuffers.
+    */
+    virtual void appendRenderGeometry(std::vector<GeometryBuffer*>& geomBuffers,
+        const ImageRenderSettings& render_settings) const;
+
     /*!
     \brief
         Appends additional render geometry for this image to an GeometryBuffers.
@@ -318,6 +334,9 @@ public:
     */
     void setOffset(const glm::vec2& pixel_offset);
 
+    //! Gets the pixel offset of this Image, before auto scaling.
+    const glm::vec2& getOffset() const { return d_pixelOffset; }
+
     
     /*!
     \brief
@@ -328,12 +347,18 @@ public:
     */
     void setAutoScaled(const AutoScaledMode autoscaled);
 
+    //! Gets the autoscale mode of this Image.
+    AutoScaledMode getAutoScaled() const { return d_autoScaled; }
+
     /*!
     \brief
         Sets the autoscale native resolution of this Image.
     */
     void setNativeResolution(const Sizef& native_res);
 
+    //! Gets the autoscale native resolution of this Image.
+    const Sizef& getNativeResolution() const { return d_nativeResolution; }
+
 
     /*!
     \brief
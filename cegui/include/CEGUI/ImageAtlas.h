@@ -0,0 +1,154 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIImageAtlas_h_
+#define _CEGUIImageAtlas_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/String.h"
+#include "CEGUI/Rectf.h"
+#include "CEGUI/SkylinePacker.h"
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251) // STL classes in API
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class Texture;
+
+/*!
+\brief
+    Packs small images into shared atlas textures.
+
+    Images drawn from the same texture can be batched together, so packing
+    the many small images of a UI, such as icons loaded from individual image
+    files, into a few pages saves most of the texture switches between them.
+
+    The pixels of each image are uploaded to its page as soon as it is added
+    and not kept in memory. The space of released images is not reused; a page
+    is destroyed once all of its images were released.
+*/
+class CEGUIEXPORT ImageAtlas
+{
+public:
+    //! Default width and height of the atlas pages in pixels.
+    static const int DefaultPageSize;
+    //! Default largest width or height of the images packed into pages.
+    static const int DefaultMaxImageSize;
+
+    ImageAtlas();
+    ~ImageAtlas();
+
+    /*!
+    \brief
+        Packs an image into an atlas page and uploads its pixels.
+
+    \param name
+        Name identifying the image when it is released.
+
+    \param pixels
+        The \a width times \a height pixels of the image, row by row, 4 bytes
+        per pixel in RGBA order.
+
+    \param texture
+        Receives the texture of the page the image was packed into.
+
+    \param area
+        Receives the area of the image within \a texture.
+
+    \return
+        true if the image was packed, false if it is larger than the maximum
+        image size.
+
+    \exception AlreadyExistsException
+        thrown if an image named \a name was already packed.
+    */
+    bool addImage(const String& name, const std::uint8_t* pixels, int width, int height,
+                  Texture*& texture, Rectf& area);
+
+    /*!
+    \brief
+        Releases the image with the given name, destroying its page if no
+        other image is left on it.
+
+    \return
+        true if the image was packed in the atlas, false otherwise.
+    */
+    bool releaseImage(const String& name);
+
+    //! Returns whether the image with the given name was packed in the atlas.
+    bool isImagePacked(const String& name) const;
+
+    //! Sets the size of the pages created from now on, limited by the Renderer.
+    void setPageSize(int size);
+    //! Returns the size of newly created pages in pixels.
+    int getPageSize() const { return d_pageSize; }
+
+    //! Sets the largest width or height of the images packed from now on.
+    void setMaxImageSize(int size);
+    //! Returns the largest width or height of the images packed into pages.
+    int getMaxImageSize() const { return d_maxImageSize; }
+
+    //! Returns the number of atlas pages.
+    size_t getPageCount() const { return d_pages.size(); }
+    //! Returns the number of images packed into the pages.
+    size_t getImageCount() const { return d_imagePages.size(); }
+
+private:
+    //! A single atlas texture along with its packing state.
+    struct Page
+    {
+        Texture* d_texture;
+        SkylinePacker d_packer;
+        //! Number of images packed into the page and not yet released.
+        size_t d_imageCount;
+    };
+
+    Page* createPage();
+    void destroyPage(Page* page);
+
+    std::vector<Page*> d_pages;
+    //! Page of each packed image.
+    std::unordered_map<String, Page*> d_imagePages;
+    int d_pageSize;
+    int d_maxImageSize;
+    //! Counter used to create unique texture names.
+    unsigned int d_createdPageCount;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIImageAtlas_h_
@@ -95,6 +95,18 @@ public:
     */
     virtual Texture* load(const RawDataContainer& data, Texture* result) = 0;
 
+    /*!
+      \brief
+      Return whether load may be called from several threads at once
+
+      The texture passed to load is then never a Renderer texture, its
+      loadFromMemory only keeps a copy of the decoded pixels. Codecs
+      returning true must not use any shared state while decoding.
+
+      \return true if load is thread safe, false by default
+    */
+    virtual bool isThreadSafe() const { return false; }
+
 private:
     String d_identifierString;   //!< display the name of the codec 
 
@@ -0,0 +1,101 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CompressedImageCodec_h_
+#define _CompressedImageCodec_h_
+#include "../../ImageCodec.h"
+#include "../../Texture.h"
+#include <cstdint>
+
+#if (defined( __WIN32__ ) || defined( _WIN32 )) && !defined(CEGUI_STATIC)
+#   ifdef CEGUICOMPRESSEDIMAGECODEC_EXPORTS
+#       define CEGUICOMPRESSEDIMAGECODEC_API __declspec(dllexport)
+#   else
+#       define CEGUICOMPRESSEDIMAGECODEC_API __declspec(dllimport)
+#   endif
+#else
+#   define CEGUICOMPRESSEDIMAGECODEC_API
+#endif
+
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Implementation of ImageCodec interface for loading GPU compressed textures
+    from DDS and KTX2 files.
+
+    The block compressed data (BC1-BC3, BC7, ETC2 and ASTC 4x4, 6x6 and 8x8)
+    is passed to Texture::loadFromMemory as it is stored in the file, so the
+    texture is never decompressed on the CPU. Only the first mip level of the
+    first layer or face is loaded. KTX2 files using supercompression are not
+    supported.
+
+    As with the PVR codec, files of other formats cannot be loaded unless a
+    fallback codec is set with setFallbackCodec().
+*/
+class CEGUICOMPRESSEDIMAGECODEC_API CompressedImageCodec : public ImageCodec
+{
+public:
+    CompressedImageCodec();
+    ~CompressedImageCodec();
+
+    /*!
+    \brief
+        Sets the codec used to load files that are neither DDS nor KTX2.
+
+    \param codec
+        The codec to use, or nullptr to fail loading such files. The codec is
+        not owned and must outlive this codec.
+    */
+    void setFallbackCodec(ImageCodec* codec);
+    //! Returns the codec used to load files that are neither DDS nor KTX2.
+    ImageCodec* getFallbackCodec() const { return d_fallbackCodec; }
+
+    Texture* load(const RawDataContainer& data, Texture* result) override;
+    bool isThreadSafe() const override;
+
+private:
+    Texture* loadDDS(const RawDataContainer& data, Texture* result) const;
+    Texture* loadKTX2(const RawDataContainer& data, Texture* result) const;
+
+    /*!
+    \brief
+        Passes the pixel data at \a offset within \a data to \a result after
+        checking that the file holds all of it and that the texture supports
+        the format.
+    */
+    static Texture* loadPixels(const RawDataContainer& data, size_t offset,
+        std::uint32_t width, std::uint32_t height, Texture::PixelFormat format,
+        Texture* result);
+
+    ImageCodec* d_fallbackCodec;
+};
+
+} // End of CEGUI namespace section
+
+#endif // end of guard _CompressedImageCodec_h_
@@ -1,9 +1,9 @@
 /***********************************************************************
-    created:    Sunday, 21st August 2014
-    author:     Lukas E Meindl
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
 *************************************************************************/
 /***************************************************************************
- *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
  *
  *   Permission is hereby granted, free of charge, to any person obtaining
  *   a copy of this software and associated documentation files (the
@@ -24,21 +24,12 @@
  *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
-#include "CEGUI/Vertex.h"
+#ifndef _CompressedImageCodecModule_h_
+#define _CompressedImageCodecModule_h_
 
-#include <glm/glm.hpp>
+#include "CEGUI/ImageCodecModules/Compressed/ImageCodec.h"
 
-namespace CEGUI
-{
+extern "C" CEGUICOMPRESSEDIMAGECODEC_API CEGUI::ImageCodec* createImageCodec(void);
+extern "C" CEGUICOMPRESSEDIMAGECODEC_API void destroyImageCodec(CEGUI::ImageCodec* imageCodec);
 
-void TexturedColouredVertex::setColour(const Colour& colour)
-{ 
-    d_colour = glm::vec4(colour.getRed(), colour.getGreen(), colour.getBlue(), colour.getAlpha());
-}
-
-void ColouredVertex::setColour(const Colour& colour)
-{
-    d_colour = glm::vec4(colour.getRed(), colour.getGreen(), colour.getBlue(), colour.getAlpha());
-}
-
-}
\ No newline at end of file
+#endif
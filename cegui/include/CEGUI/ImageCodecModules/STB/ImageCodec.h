@@ -56,6 +56,7 @@ public:
     ~STBImageCodec();
 
     Texture* load(const RawDataContainer& data, Texture* result);
+    bool isThreadSafe() const { return true; }
 };    
 
 } // End of CEGUI namespace section 
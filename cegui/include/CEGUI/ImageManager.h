@@ -34,7 +34,12 @@
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/ImageFactory.h"
+#include "CEGUI/SharedMutex.h"
 #include <unordered_map>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <cstdint>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -43,7 +48,9 @@
 
 namespace CEGUI
 {
+class ImageAtlas;
 class ImageFactory;
+class Texture;
 
 class CEGUIEXPORT ImageManager :
         public Singleton<ImageManager>,
@@ -136,14 +143,61 @@ public:
     void destroy(const String& name);
     void destroyAll();
 
+    /*!
+    \brief
+        Returns the Image named \a name.
+
+        get, isDefined, isImageTypeAvailable and getImageCount may be called
+        on several threads at once, images are only created and destroyed on
+        the main thread. See WindowManager for the complete threading rules.
+
+    \exception UnknownObjectException thrown if no such Image exists.
+    */
     Image& get(const String& name) const;
     bool isDefined(const String& name) const;
 
     unsigned int getImageCount() const;
 
+    /*!
+    \brief
+        Returns a number that changes whenever an Image is created or destroyed.
+
+        Code keeping an Image looked up by name, such as a ResourceHandle, only
+        needs to look it up again once the generation changed. The number
+        keeps counting across instances of the manager.
+    */
+    std::uint32_t getGeneration() const;
+
     void loadImageset(const String& filename, const String& resource_group = "");
     void loadImagesetFromString(const String& source);
 
+    /*!
+    \brief
+        Parses an imageset file loaded before again and applies the changes in
+        place: the texture is loaded again from its file into the same Texture
+        and existing images take the new areas, offsets and scaling, so windows
+        and looks referring to them need not be recreated. Images added to the
+        file are created, images no longer in it are kept.
+
+        SVG imagesets only get their new images.
+    */
+    void reloadImageset(const String& filename, const String& resource_group = "");
+
+    //! Function called by loadImagesetAsync with whether the imageset was loaded.
+    typedef std::function<void(bool loaded)> ImagesetLoadedCallback;
+
+    /*!
+    \brief
+        Loads an imageset without waiting for its file to be read.
+
+        The imageset file is loaded by
+        ResourceProvider::loadRawDataContainerAsync; its images, and the
+        texture they use, are created from System::injectTimePulse once the
+        file was read, followed by the call to \a callback. Errors are logged.
+    */
+    void loadImagesetAsync(const String& filename, const String& resource_group,
+                           ImagesetLoadedCallback callback);
+
     void destroyImageCollection(const String& prefix,
                                 const bool delete_texture = true);
 
@@ -151,10 +205,90 @@ public:
                           const String& filename,
                           const String& resource_group = "");
 
+    /*!
+    \brief
+        Starts deferring the loading of textures created from image files.
+
+        Until the matching call to endTextureLoadBatch, addBitmapImageFromFile
+        and loadImageset create their textures empty and only record the image
+        files to load into them. Batches may be nested; the textures are loaded
+        when the outermost batch ends, so wrapping the creation of several
+        schemes in one batch decodes the images of all of them together.
+    */
+    void beginTextureLoadBatch();
+
+    /*!
+    \brief
+        Loads the image files of all textures created since the outermost
+        call to beginTextureLoadBatch.
+
+        When the ImageCodec is thread safe the files are decoded in parallel
+        on the System's TaskScheduler, and also read there if the
+        ResourceProvider is thread safe. The decoded pixels are still passed to
+        the textures on the calling thread, so the Renderer is only ever used
+        from there; each texture is loaded as soon as its own file is decoded,
+        overlapping the uploads with the remaining decoding. Otherwise each
+        texture loads its file as it would have done outside of a batch.
+
+    \exception InvalidRequestException
+        thrown if no batch was started.
+    */
+    void endTextureLoadBatch();
+
+    //! Returns whether the loading of textures is currently deferred.
+    bool isTextureLoadBatchActive() const { return d_textureLoadBatchDepth != 0; }
+
+    /*!
+    \brief
+        Sets whether addBitmapImageFromFile packs the images into the pages of
+        the ImageAtlas instead of creating a texture for each of them.
+
+        Images larger than the maximum image size of the atlas, and files in a
+        format other than RGB or RGBA, still get a texture of their own. Images
+        added before the call are left as they are. Disabled by default.
+    */
+    void setImageAtlasEnabled(bool enabled) { d_imageAtlasEnabled = enabled; }
+    //! Returns whether addBitmapImageFromFile packs images into the ImageAtlas.
+    bool isImageAtlasEnabled() const { return d_imageAtlasEnabled; }
+    //! Returns the atlas images from image files are packed into.
+    ImageAtlas& getImageAtlas() const { return *d_imageAtlas; }
+
+    /*!
+    \brief
+        Sets whether the textures created from image files by imagesets and
+        addBitmapImageFromFile get a mip chain, so that images drawn scaled
+        down are filtered properly. Textures created before the call are left
+        as they are. Disabled by default.
+    */
+    void setTextureMipmapsEnabled(bool enabled) { d_textureMipmapsEnabled = enabled; }
+    //! Returns whether textures created from image files get a mip chain.
+    bool isTextureMipmapsEnabled() const { return d_textureMipmapsEnabled; }
+
+    /*!
+    \brief
+        Sets whether the mipmapped textures of auto scaled imagesets keep only
+        the mip levels needed at the current display size resident.
+
+        The resident scale of each such texture is the largest auto scaling
+        factor of its imageset, clamped to 1. When the display grows so that
+        a larger level is needed, notifyDisplaySizeChanged loads the image
+        file again; shrinking the display never drops levels already loaded.
+        Only has an effect along with setTextureMipmapsEnabled, and only for
+        textures created after the call. Disabled by default.
+    */
+    void setTextureStreamingEnabled(bool enabled) { d_textureStreamingEnabled = enabled; }
+    //! Returns whether textures of auto scaled imagesets are streamed.
+    bool isTextureStreamingEnabled() const { return d_textureStreamingEnabled; }
+
     /*!
     \brief
         Notify the ImageManager that the display size may have changed.
 
+        Streamed textures needing larger mip levels at the new size load
+        their image files again. The cached rendering of all windows is
+        invalidated only when the rendered size of an auto scaled image
+        actually changed.
+
     \param size
         Size object describing the display resolution
     */
@@ -225,13 +359,70 @@ private:
     //! throw exception if file version is not supported.
     void validateImagesetFileVersion(const XMLAttributes& attrs);
 
+    /*!
+    \brief
+        Creates a texture from an image file, deferring its loading during a
+        batch. The texture is streamed if auto_scaled is not Disabled and
+        streaming is enabled.
+    */
+    Texture& createTextureFromFile(const String& name, const String& filename,
+                                   const String& resource_group,
+                                   const String& image_name = "",
+                                   AutoScaledMode auto_scaled = AutoScaledMode::Disabled,
+                                   const Sizef& native_resolution = Sizef(640.0f, 480.0f));
+
+    /*!
+    \brief
+        Registers a texture created from an image file with the
+        TextureResidencyManager, which may release its data to meet the texture
+        budget and loads it again from the file when it is drawn.
+    */
+    void trackTextureResidency(Texture& texture, const String& filename,
+                               const String& resource_group);
+
+    //! The image file of a texture keeping only the mip levels it needs resident.
+    struct StreamedTexture
+    {
+        String d_filename;
+        String d_resourceGroup;
+        AutoScaledMode d_autoScaled;
+        Sizef d_nativeResolution;
+    };
+
+    //! A texture whose image file is loaded at the end of the current batch.
+    struct PendingTextureLoad
+    {
+        String d_textureName;
+        String d_filename;
+        String d_resourceGroup;
+        //! Image whose area is set to the size of the loaded file, may be empty.
+        String d_imageName;
+        //! Whether the image is packed into the atlas, no texture was created then.
+        bool d_packIntoAtlas;
+    };
+
     //! Default resource group specifically for Imagesets.
     static String d_imagesetDefaultResourceGroup;
 
+    //! Guards d_factories and d_images, taken exclusively only while they are modified.
+    mutable SharedMutex d_registryMutex;
     //! container holding the factories.
     ImageFactoryRegistry d_factories;
     //! container holding the images.
     ImageMap d_images;
+    //! Nesting depth of the texture load batches.
+    unsigned int d_textureLoadBatchDepth = 0;
+    //! Textures to load when the outermost batch ends.
+    std::vector<PendingTextureLoad> d_pendingTextureLoads;
+    //! Atlas the images added from image files may be packed into.
+    std::unique_ptr<ImageAtlas> d_imageAtlas;
+    bool d_imageAtlasEnabled = false;
+    bool d_textureMipmapsEnabled = false;
+    bool d_textureStreamingEnabled = false;
+    //! Streamed textures by name, reloaded when the display grows.
+    std::unordered_map<String, StreamedTexture> d_streamedTextures;
+    //! Whether the imageset being parsed updates the existing texture and images.
+    bool d_reloadingImageset = false;
 };
 
 //---------------------------------------------------------------------------//
@@ -242,7 +433,11 @@ void ImageManager::addImageType(const String& name)
         throw AlreadyExistsException(
             "Image type already exists: " + name);
 
-    d_factories[name] = new TplImageFactory<T>;
+    ImageFactory* const factory = new TplImageFactory<T>;
+    {
+        std::lock_guard<SharedMutex> guard(d_registryMutex);
+        d_factories[name] = factory;
+    }
 
     Logger::getSingleton().logEvent(
         "[ImageManager] Registered Image type: " + name);
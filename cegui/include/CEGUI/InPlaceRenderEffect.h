@@ -0,0 +1,129 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIInPlaceRenderEffect_h_
+#define _CEGUIInPlaceRenderEffect_h_
+
+#include "CEGUI/RenderEffect.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Base class for RenderEffects that are applied directly to the geometry of
+    a Window, in the same pass it is drawn in.
+
+    Unlike a plain RenderEffect, which post-processes the texture of a
+    RenderingWindow, an in-place effect needs no TextureTarget and no extra
+    composite pass. It has two stages:
+    - the vertex stage, modifyGeometry, is called for every GeometryBuffer of
+      the window each time the window regenerates its geometry, and may change
+      the vertex data of the buffer.
+    - the parameter stage, prepareGeometry, is called for every GeometryBuffer
+      each time the window applies its translation, clipping and alpha to the
+      buffers, and may change the transformation, alpha, clipping mask or
+      shader parameters of the buffer.
+
+    Effects are registered with RenderEffectManager like any other. When such
+    an effect is requested for a window, WindowManager sets it on the window
+    itself via Window::setInPlaceRenderEffect instead of creating a
+    RenderingWindow. Effects that really need the rendered output of the
+    window as a texture, such as blurs, should stay plain RenderEffects.
+*/
+class CEGUIEXPORT InPlaceRenderEffect : public RenderEffect
+{
+public:
+    //! What an update of the effect invalidated.
+    enum class Change : int
+    {
+        //! Nothing changed, the window is drawn as before.
+        Nothing,
+        //! The parameter stage must run again, the geometry is kept.
+        Parameters,
+        //! The window must regenerate its geometry and run both stages again.
+        Geometry
+    };
+
+    /*!
+    \brief
+        Function called to perform any time based updates on the effect state.
+
+    \param elapsed
+        The number of seconds that have elapsed since the last time this
+        function was called.
+
+    \param window
+        The Window the effect is applied to.
+
+    \return
+        The stages that need to run again because of the update.
+    */
+    virtual Change update(const float elapsed, Window& window) = 0;
+
+    /*!
+    \brief
+        Vertex stage of the effect, called for each GeometryBuffer of \a window
+        after the window regenerated its geometry.
+
+        The default implementation does nothing. Effects overriding it must
+        also return true from modifiesGeometry.
+    */
+    virtual void modifyGeometry(Window& window, GeometryBuffer& buffer);
+
+    /*!
+    \brief
+        Parameter stage of the effect, called for each GeometryBuffer of
+        \a window after the window set the translation, clipping region and
+        alpha of the buffer.
+
+        The default implementation does nothing.
+    */
+    virtual void prepareGeometry(Window& window, GeometryBuffer& buffer);
+
+    /*!
+    \brief
+        Returns whether modifyGeometry changes the vertex data of the buffers.
+
+        The geometry of windows using such an effect is always regenerated
+        rather than taken from the imagery geometry cache of the window, which
+        would otherwise keep the modified vertices. Returns false by default.
+    */
+    virtual bool modifiesGeometry() const;
+
+    // Implement RenderEffect interface, an in-place effect takes a single
+    // pass and needs no state changes or geometry of its own.
+    bool isAppliedInPlace() const override;
+    int getPassCount() const override;
+    void performPreRenderFunctions(const int pass) override;
+    void performPostRenderFunctions() override;
+    bool realiseGeometry(RenderingWindow& window, GeometryBuffer& geometry) override;
+    bool update(const float elapsed, RenderingWindow& window) override;
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIInPlaceRenderEffect_h_
@@ -164,6 +164,38 @@ public:
     void setMouseMoveScalingFactor(float factor);
     float getMouseMoveScalingFactor() const;
 
+    /*!
+    \brief
+        Sets whether consecutive cursor moves and scrolls are coalesced.
+
+        A high rate pointing device reports many moves per frame and each of
+        them makes the receiver hit test and fire enter and leave events. With
+        coalescing enabled, moves and scrolls are held back until
+        flushPendingInput is called or any other input is injected: the
+        receiver then gets a single move to the latest position followed by a
+        single scroll of the summed delta. Button and key events are thus
+        always received after the move that preceded them. Injections that
+        are held back return false.
+
+        Disabling coalescing sends the pending events. Disabled by default.
+    */
+    void setEventCoalescingEnabled(bool enabled);
+
+    //! Returns whether consecutive cursor moves and scrolls are coalesced.
+    bool isEventCoalescingEnabled() const { return d_coalesceEvents; }
+
+    /*!
+    \brief
+        Sends the cursor move and scroll held back by event coalescing.
+
+        Call this once per frame, before the GUIContext is updated and drawn,
+        when coalescing is enabled.
+
+    \return
+        true if the move or the scroll was handled.
+    */
+    bool flushPendingInput();
+
     /*!
     \brief
         Returns a semantic action matching the scan_code
@@ -236,6 +268,11 @@ protected:
     void recomputeMultiClickAbsoluteTolerance();
     virtual bool onDisplaySizeChanged(const EventArgs& args);
 
+    //! Sends a CursorMove to d_pointerPosition.
+    bool sendCursorMove();
+    //! Sends a VerticalScroll of \a delta.
+    bool sendScroll(float delta);
+
     Event::Connection d_displaySizeChangedConnection;
 
     InputEventReceiver* d_inputReceiver;
@@ -259,6 +296,16 @@ protected:
     float d_mouseMovementScalingFactor;
 
     glm::vec2 d_pointerPosition;
+
+    //! Whether cursor moves and scrolls are coalesced.
+    bool d_coalesceEvents;
+    //! Whether a cursor move to d_pointerPosition is held back.
+    bool d_hasPendingCursorMove;
+    //! Whether a scroll is held back. It always happened after the pending move.
+    bool d_hasPendingScroll;
+    //! Summed delta of the held back scrolls.
+    float d_pendingScrollDelta;
+
     //! Mapping from a key to its semantic value
     SemanticValue d_keyValuesMappings[UCHAR_MAX]; 
     bool d_keysPressed[UCHAR_MAX];
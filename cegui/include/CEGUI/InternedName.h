@@ -0,0 +1,101 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIInternedName_h_
+#define _CEGUIInternedName_h_
+
+#include "CEGUI/String.h"
+#include <functional>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Name that has been interned, i.e. looked up once in a global table of
+    names, so that it can be compared and hashed by pointer afterwards.
+
+    Used as key for the Events of an EventSet and the Properties of a
+    PropertySet. Code firing an event or accessing a property on a hot path
+    can keep an InternedName around and use the matching overloads, which
+    skip hashing and comparing the characters of the name. The String
+    overloads intern on the way in.
+
+\note
+    Interned names are never freed, so only names of things that exist, like
+    the events and properties themselves, should be interned. Lookups taking
+    a String use InternedName::find, which doesn't add to the table.
+*/
+class CEGUIEXPORT InternedName
+{
+public:
+    //! Construct a name that is not interned and equals no interned name.
+    InternedName() : d_string(nullptr) {}
+
+    //! Intern \a name, adding it to the global table if needed.
+    explicit InternedName(const String& name);
+
+    /*!
+    \brief
+        Return the already interned name equal to \a name, or a name that is
+        not interned (see isInterned) if there is none.
+    */
+    static InternedName find(const String& name);
+
+    //! Return whether this is an interned name.
+    bool isInterned() const { return d_string != nullptr; }
+
+    //! Return the characters of the name.
+    const String& getString() const;
+
+    //! Return a hash of the name, computed from its address in the table.
+    std::size_t getHash() const { return std::hash<const String*>()(d_string); }
+
+    operator const String&() const { return getString(); }
+
+    bool operator==(const InternedName& other) const { return d_string == other.d_string; }
+    bool operator!=(const InternedName& other) const { return d_string != other.d_string; }
+    //! Order by address, which is stable but not alphabetical.
+    bool operator<(const InternedName& other) const { return std::less<const String*>()(d_string, other.d_string); }
+
+private:
+    explicit InternedName(const String* string) : d_string(string) {}
+
+    //! The entry of this name in the global table, nullptr if not interned.
+    const String* d_string;
+};
+
+} // End of  CEGUI namespace section
+
+namespace std
+{
+template<> struct hash<CEGUI::InternedName>
+{
+    std::size_t operator()(const CEGUI::InternedName& name) const { return name.getHash(); }
+};
+}
+
+#endif  // end of guard _CEGUIInternedName_h_
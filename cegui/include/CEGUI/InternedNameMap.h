@@ -0,0 +1,141 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIInternedNameMap_h_
+#define _CEGUIInternedNameMap_h_
+
+#include "CEGUI/InternedName.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Map from InternedName keys to values, stored as a single vector of pairs
+    sorted by key.
+
+    Meant for small collections that are mostly built once and then looked up,
+    like the elements of a WidgetLookFeel. Compared to a hash map there are no
+    buckets and no node allocations, and a lookup is a binary search over
+    pointer-sized keys. Since InternedName orders by address, iterating yields
+    the entries in no particular order.
+
+\note
+    Inserting and erasing invalidate all iterators and all pointers to the
+    values held by the map.
+*/
+template<typename T>
+class InternedNameMap
+{
+public:
+    typedef InternedName key_type;
+    typedef T mapped_type;
+    typedef std::pair<InternedName, T> value_type;
+    typedef typename std::vector<value_type>::iterator iterator;
+    typedef typename std::vector<value_type>::const_iterator const_iterator;
+    typedef typename std::vector<value_type>::size_type size_type;
+
+    iterator begin() { return d_entries.begin(); }
+    const_iterator begin() const { return d_entries.begin(); }
+    iterator end() { return d_entries.end(); }
+    const_iterator end() const { return d_entries.end(); }
+
+    bool empty() const { return d_entries.empty(); }
+    size_type size() const { return d_entries.size(); }
+    void clear() { d_entries.clear(); }
+    void reserve(size_type count) { d_entries.reserve(count); }
+
+    iterator find(const InternedName& key)
+    {
+        const iterator i = lowerBound(key);
+        return (i != d_entries.end() && i->first == key) ? i : d_entries.end();
+    }
+
+    const_iterator find(const InternedName& key) const
+    {
+        return const_cast<InternedNameMap*>(this)->find(key);
+    }
+
+    //! Find by name without interning it; a name never interned has no entry.
+    iterator find(const String& name)
+    {
+        const InternedName key(InternedName::find(name));
+        return key.isInterned() ? find(key) : d_entries.end();
+    }
+
+    const_iterator find(const String& name) const
+    {
+        return const_cast<InternedNameMap*>(this)->find(name);
+    }
+
+    //! Insert \a value unless its key is present; same semantics as std::map.
+    std::pair<iterator, bool> insert(value_type value)
+    {
+        iterator i = lowerBound(value.first);
+        if (i != d_entries.end() && i->first == value.first)
+            return std::make_pair(i, false);
+
+        i = d_entries.insert(i, std::move(value));
+        return std::make_pair(i, true);
+    }
+
+    T& operator[](const InternedName& key)
+    {
+        return insert(value_type(key, T())).first->second;
+    }
+
+    iterator erase(const_iterator position)
+    {
+        return d_entries.erase(position);
+    }
+
+    size_type erase(const InternedName& key)
+    {
+        const iterator i = find(key);
+        if (i == d_entries.end())
+            return 0;
+
+        d_entries.erase(i);
+        return 1;
+    }
+
+private:
+    iterator lowerBound(const InternedName& key)
+    {
+        return std::lower_bound(d_entries.begin(), d_entries.end(), key,
+            [](const value_type& entry, const InternedName& k) { return entry.first < k; });
+    }
+
+    //! The entries, sorted by key.
+    std::vector<value_type> d_entries;
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIInternedNameMap_h_
@@ -85,6 +85,55 @@ public:
             float position) = 0;
 };
 
+/*!
+\brief
+    Base class of the key frame values parsed by a NativeInterpolator.
+*/
+class CEGUIEXPORT InterpolatorValue
+{
+public:
+    virtual ~InterpolatorValue() = default;
+};
+
+/*!
+\brief
+    Interface of interpolators able to work on native values.
+
+    Interpolators implementing it besides Interpolator have their key frame
+    values parsed once and kept by the KeyFrame. Affectors with absolute and
+    relative application methods then interpolate the native values and set
+    the result without converting it to String and back.
+*/
+class CEGUIEXPORT NativeInterpolator
+{
+public:
+    virtual ~NativeInterpolator() = default;
+
+    //! Parse \a value into a value that can be passed to the apply methods.
+    virtual InterpolatorValue* createValue(const String& value) const = 0;
+
+    /*!
+    \brief
+        Native counterpart of Interpolator::interpolateAbsolute, sets the
+        result to \a property of \a target.
+    */
+    virtual void applyAbsolute(PropertyReceiver* target, Property* property,
+                               const InterpolatorValue& value1,
+                               const InterpolatorValue& value2,
+                               float position) = 0;
+
+    /*!
+    \brief
+        Native counterpart of Interpolator::interpolateRelative, sets the
+        result to \a property of \a target.
+    */
+    virtual void applyRelative(PropertyReceiver* target, Property* property,
+                               const String& base,
+                               const InterpolatorValue& value1,
+                               const InterpolatorValue& value2,
+                               float position) = 0;
+};
+
 } // End of  CEGUI namespace section
 
 #endif  // end of guard _CEGUIInterpolator_h_
@@ -30,6 +30,7 @@
 #define _CEGUIKeyFrame_h_
 
 #include "CEGUI/String.h"
+#include <memory>
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -151,6 +152,20 @@ public:
     */
     const String& getValueForAnimation(AnimationInstance* instance) const;
 
+    /*!
+    \brief
+        Retrieves the value of this key frame parsed by \a interpolator
+
+    \par
+        This is an internal method! Only use if you know what you're doing!
+
+    \par
+        The value is parsed on first use and kept until the value or the
+        interpolator change. Returns nullptr if this key frame has a source
+        property, as its value then differs between animation instances.
+    */
+    const InterpolatorValue* getNativeValue(const NativeInterpolator& interpolator);
+
     /*!
     \brief
         Sets the progression method of this key frame
@@ -216,6 +231,10 @@ private:
     String d_value;
     //! source property
     String d_sourceProperty;
+    //! d_value parsed by d_nativeValueInterpolator, created on demand
+    std::unique_ptr<InterpolatorValue> d_nativeValue;
+    //! interpolator d_nativeValue was created with
+    const NativeInterpolator* d_nativeValueInterpolator;
     //! progression method used towards this key frame
     Progression d_progression;
 };
@@ -96,6 +96,15 @@ public:
 	*/
 	LoggingLevel	getLoggingLevel(void) const		{return d_level;}
 
+    /*!
+    \brief
+        Return whether messages of the given level currently get logged.
+
+        Callers building expensive messages should check this first, or use
+        the CEGUI_LOG macro which does so.
+    */
+    bool isLoggable(LoggingLevel level) const { return level <= d_level; }
+
 
 	/*!
 	\brief
@@ -135,6 +144,31 @@ protected:
 	LoggingLevel	d_level;		//!< Holds current logging level
 };
 
+/*************************************************************************
+	Highest level of the messages logged through CEGUI_LOG. Messages of
+	higher levels are compiled out, define it in the build to strip
+	for example LoggingLevel::Informative tracing from release binaries.
+*************************************************************************/
+#ifndef CEGUI_MAX_LOGGING_LEVEL
+#	define CEGUI_MAX_LOGGING_LEVEL CEGUI::LoggingLevel::Insane
+#endif
+
+/*************************************************************************
+	Logs \a message at \a level if a Logger exists and the level is
+	enabled. The message is only built when it gets logged, so a filtered
+	call costs no more than checking the logging level.
+*************************************************************************/
+#define CEGUI_LOG( level, message ) \
+	do \
+	{ \
+		if (static_cast<int>(level) <= static_cast<int>(CEGUI_MAX_LOGGING_LEVEL)) \
+		{ \
+			CEGUI::Logger* const ceguiLogger_ = CEGUI::Logger::getSingletonPtr(); \
+			if (ceguiLogger_ && ceguiLogger_->isLoggable(level)) \
+				ceguiLogger_->logEvent((message), (level)); \
+		} \
+	} while (false)
+
 /*************************************************************************
 	This macro is used for 'LoggingLevel::Insane' level logging so that those items are
 	excluded from non-debug builds
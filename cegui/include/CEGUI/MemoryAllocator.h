@@ -0,0 +1,204 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIMemoryAllocator_h_
+#define _CEGUIMemoryAllocator_h_
+
+#include "CEGUI/Base.h"
+#include <cstddef>
+#include <limits>
+#include <new>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//! Categories the memory allocated by CEGUI is accounted to.
+enum class MemoryCategory : int
+{
+    //! Allocations not falling into any other category.
+    General,
+    //! Windows and WindowRenderers.
+    Window,
+    //! GeometryBuffers.
+    Geometry,
+    //! Fonts, their glyphs and glyph atlas pages.
+    Font,
+    //! Components of RenderedStrings.
+    String,
+    //! Events, their connections and subscriber functors.
+    Event,
+
+    Count
+};
+
+/*!
+\brief
+    Interface through which CEGUI allocates the memory of its objects, so that
+    it can be routed to the allocators of the host application.
+
+    Classes derived from AllocatedObject, such as Window, GeometryBuffer, Font,
+    FontGlyph, RenderedStringComponent, Event and BoundSlot, as well as
+    containers using MemoryAllocatorAdapter, allocate from the allocator set by
+    System::setMemoryAllocator. Without one, a default allocator using
+    std::malloc and std::free is used.
+
+    The memory allocated through the allocator is accounted per
+    MemoryCategory, see getAllocatedSize.
+
+    Implementations must be thread safe, since geometry may be generated on
+    several threads at once.
+*/
+class CEGUIEXPORT MemoryAllocator
+{
+public:
+    virtual ~MemoryAllocator();
+
+    /*!
+    \brief
+        Returns \a size bytes of memory suitably aligned for any fundamental
+        type. Must not return nullptr; throw std::bad_alloc instead.
+    */
+    virtual void* allocate(std::size_t size, MemoryCategory category) = 0;
+
+    //! Releases memory returned by allocate with the same size and category.
+    virtual void deallocate(void* memory, std::size_t size, MemoryCategory category) = 0;
+
+    //! Returns the allocator currently used by CEGUI.
+    static MemoryAllocator& getCurrent();
+
+    /*!
+    \brief
+        Sets the allocator used by CEGUI, or restores the default one if
+        \a allocator is nullptr. Use System::setMemoryAllocator, which checks
+        that no memory of the previous allocator is still in use.
+    */
+    static void setCurrent(MemoryAllocator* allocator);
+
+    //! Allocates memory from the current allocator and accounts it to \a category.
+    static void* allocateTracked(std::size_t size, MemoryCategory category);
+
+    //! Releases memory obtained from allocateTracked.
+    static void deallocateTracked(void* memory, std::size_t size, MemoryCategory category);
+
+    //! Returns the number of bytes currently allocated for \a category.
+    static std::size_t getAllocatedSize(MemoryCategory category);
+
+    //! Returns the number of allocations currently alive for \a category.
+    static std::size_t getAllocationCount(MemoryCategory category);
+
+    //! Returns the number of allocations currently alive over all categories.
+    static std::size_t getTotalAllocationCount();
+};
+
+/*!
+\brief
+    Base class routing the dynamic allocations of derived classes through the
+    current MemoryAllocator, accounted to \a Category.
+*/
+template<MemoryCategory Category>
+class AllocatedObject
+{
+public:
+    static void* operator new(std::size_t size)
+    {
+        return MemoryAllocator::allocateTracked(size, Category);
+    }
+
+    static void* operator new[](std::size_t size)
+    {
+        return MemoryAllocator::allocateTracked(size, Category);
+    }
+
+    static void operator delete(void* memory, std::size_t size)
+    {
+        MemoryAllocator::deallocateTracked(memory, size, Category);
+    }
+
+    static void operator delete[](void* memory, std::size_t size)
+    {
+        MemoryAllocator::deallocateTracked(memory, size, Category);
+    }
+
+    // placement forms, hidden by the ones above otherwise
+    static void* operator new(std::size_t, void* place) { return place; }
+    static void operator delete(void*, void*) {}
+
+protected:
+    AllocatedObject() {}
+    ~AllocatedObject() {}
+};
+
+/*!
+\brief
+    Standard library allocator taking its memory from the current
+    MemoryAllocator, accounted to \a Category.
+*/
+template<typename T, MemoryCategory Category>
+class MemoryAllocatorAdapter
+{
+public:
+    typedef T value_type;
+
+    template<typename U>
+    struct rebind
+    {
+        typedef MemoryAllocatorAdapter<U, Category> other;
+    };
+
+    MemoryAllocatorAdapter() {}
+
+    template<typename U>
+    MemoryAllocatorAdapter(const MemoryAllocatorAdapter<U, Category>&) {}
+
+    T* allocate(std::size_t count)
+    {
+        if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            throw std::bad_alloc();
+
+        return static_cast<T*>(MemoryAllocator::allocateTracked(count * sizeof(T), Category));
+    }
+
+    void deallocate(T* memory, std::size_t count)
+    {
+        MemoryAllocator::deallocateTracked(memory, count * sizeof(T), Category);
+    }
+};
+
+template<typename T, typename U, MemoryCategory Category>
+bool operator==(const MemoryAllocatorAdapter<T, Category>&, const MemoryAllocatorAdapter<U, Category>&)
+{
+    return true;
+}
+
+template<typename T, typename U, MemoryCategory Category>
+bool operator!=(const MemoryAllocatorAdapter<T, Category>&, const MemoryAllocatorAdapter<U, Category>&)
+{
+    return false;
+}
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIMemoryAllocator_h_
@@ -54,6 +54,13 @@ public:
     \brief
         sets the archive from which files are retrieved.
 
+        The central directory of the archive is indexed once. If memory
+        mapping is enabled the archive is mapped into memory: its stored
+        entries are then loaded without copying, as data borrowed from the
+        mapping, and its deflated entries are inflated straight from it. The
+        mapping is kept until the provider is destroyed, as loaded data may
+        refer to it.
+
     \param archive
         The filepath to the archive
     */
@@ -67,6 +74,13 @@ public:
     size_t getResourceGroupFileNames(std::vector<String>& out_vec,
                                      const String& file_pattern,
                                      const String& resource_group) override;
+    /*!
+    \brief
+        Returns true: entries of a mapped archive that are stored or deflated
+        are read without the zip handle, so they may be loaded in parallel.
+        The archive must not be changed while loads are pending.
+    */
+    bool isThreadSafe() const override { return true; }
 protected:
     bool doesFileExist(const String& filename);
     void openArchive();
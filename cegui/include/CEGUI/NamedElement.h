@@ -31,6 +31,13 @@
 #define _CEGUINamedElement_h_
 
 #include "CEGUI/Element.h"
+#include <memory>
+#include <unordered_map>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -64,6 +71,9 @@ you can check for the element "Okay" from this element by using the
 name path "Panel/Okay".  To check for "Panel", you would simply pass
 the name "Panel".
 
+Elements with many children keep an index of them by name, so that each step
+of a name path is a hash lookup rather than a scan of the children.
+
 \see Element
 */
 class CEGUIEXPORT NamedElement :
@@ -210,10 +220,20 @@ public:
     */
     void removeChild(const String& name_path);
 
+    /*!
+    \brief
+        Number of children from which on an element keeps an index of its
+        children by name. Elements with fewer children search them in order.
+    */
+    static const size_t ChildNameIndexThreshold = 8;
+
 protected:
     //! \copydoc Element::addChild_impl
     void addChild_impl(Element* element) override;
 
+    //! \copydoc Element::removeChild_impl
+    void removeChild_impl(Element* element) override;
+
     /*!
     \brief Retrieves a child at \a name_path or 0 if none such exists
     */
@@ -241,8 +261,38 @@ protected:
 
     //! The name of the element, unique in the parent of this element
     String d_name;
+
+private:
+    //! Named children by the hash of their name, see hashName.
+    typedef std::unordered_multimap<std::size_t, NamedElement*> ChildNameIndex;
+
+    //! Returns the hash of the name of \a length code units at \a name.
+    static std::size_t hashName(const String::value_type* name, size_t length);
+
+    /*!
+    \brief
+        Returns the child named as the \a length code units at \a name, or
+        nullptr if there is none. Uses the index if there is one.
+    */
+    NamedElement* getChildByName(const String::value_type* name, size_t length) const;
+
+    //! Returns the child of \a parent named as given, searching in order.
+    static NamedElement* findChildByName(const Element& parent,
+                                         const String::value_type* name, size_t length);
+
+    //! Adds \a child to the index of the children by name.
+    void indexChild(NamedElement* child);
+    //! Removes \a child from the index of the children by name.
+    void unindexChild(const NamedElement* child);
+
+    //! Index of the named children, only allocated for elements with many children.
+    std::unique_ptr<ChildNameIndex> d_childNameIndex;
 };
 
 } // End of  CEGUI namespace section
 
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
 #endif  // end of guard _CEGUINamedElement_h_
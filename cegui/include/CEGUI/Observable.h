@@ -0,0 +1,217 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIObservable_h_
+#define _CEGUIObservable_h_
+
+#include "CEGUI/PropertySet.h"
+#include "CEGUI/Event.h"
+#include <memory>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class Window;
+class ObservableBase;
+
+/*!
+\brief
+    Binding of a Property of a Window to an Observable, see
+    Window::bindProperty. Owned by the Observable, which removes it when the
+    Window is destroyed.
+*/
+class CEGUIEXPORT PropertyBindingBase
+{
+public:
+    PropertyBindingBase(ObservableBase& observable, Window& window, Property& property);
+    virtual ~PropertyBindingBase() {}
+
+    PropertyBindingBase(const PropertyBindingBase&) = delete;
+    PropertyBindingBase& operator=(const PropertyBindingBase&) = delete;
+
+    //! Returns the Window whose Property is bound.
+    Window& getWindow() const { return d_window; }
+
+    //! Returns the bound Property.
+    Property& getProperty() const { return d_property; }
+
+    //! Sets the Property to the value of the Observable, unless it already has it.
+    virtual void apply() = 0;
+
+private:
+    //! Removes the binding from its Observable.
+    bool handleDestructionStarted(const EventArgs& args);
+
+    ObservableBase& d_observable;
+    Window& d_window;
+    Property& d_property;
+    Event::ScopedConnection d_destructionConnection;
+};
+
+/*!
+\brief
+    Untyped part of Observable, keeps the bindings and the queue of changed
+    observables.
+
+    Changing the value of an Observable does not touch the bound properties
+    right away. The Observable is queued instead and applyPendingChanges sets
+    the properties once, to the latest value, no matter how often it changed
+    since. GUIContext calls it at the start of injectTimePulse and draw, before
+    the layout is updated.
+
+    Observables are meant to be used from the thread the GUI runs in.
+*/
+class CEGUIEXPORT ObservableBase
+{
+public:
+    ObservableBase() = default;
+    virtual ~ObservableBase();
+
+    ObservableBase(const ObservableBase&) = delete;
+    ObservableBase& operator=(const ObservableBase&) = delete;
+
+    //! Adds \a binding, and sets its Property to the current value.
+    void addBinding(std::unique_ptr<PropertyBindingBase> binding);
+
+    //! Removes the binding of the Property \a propertyName of \a window, if any.
+    void removeBinding(const Window& window, const String& propertyName);
+
+    //! Removes all bindings of \a window.
+    void removeBindings(const Window& window);
+
+    //! Returns the number of bound properties.
+    size_t getBindingCount() const { return d_bindings.size(); }
+
+    //! Returns whether the bound properties are waiting for a change to be applied.
+    bool isChangePending() const { return d_pending; }
+
+    /*!
+    \brief
+        Sets the properties bound to all observables that changed since the
+        last call. Observables changed by this call are applied on the next one.
+    */
+    static void applyPendingChanges();
+
+protected:
+    //! Queues the Observable for applyPendingChanges, if it is not yet.
+    void notifyChanged();
+
+private:
+    friend class PropertyBindingBase;
+
+    //! Removes \a binding, called when its Window is destroyed.
+    void removeBinding(const PropertyBindingBase& binding);
+
+    std::vector<std::unique_ptr<PropertyBindingBase>> d_bindings;
+    //! Whether the Observable is in s_pending.
+    bool d_pending = false;
+
+    //! Observables changed since the last applyPendingChanges, destroyed ones are nullptr.
+    static std::vector<ObservableBase*> s_pending;
+};
+
+/*!
+\brief
+    Value of type \a T that properties of windows can be bound to, see
+    Window::bindProperty.
+
+    Setting the value to what it already is does nothing. Other changes are
+    applied to the bound properties in a batch, see ObservableBase. \a T must
+    be comparable with operator== and have a PropertyHelper.
+*/
+template<typename T>
+class Observable : public ObservableBase
+{
+public:
+    Observable() :
+        d_value()
+    {}
+
+    explicit Observable(const T& value) :
+        d_value(value)
+    {}
+
+    //! Returns the current value.
+    const T& get() const { return d_value; }
+
+    //! Sets the value and queues its bound properties for updating if it changed.
+    void set(const T& value)
+    {
+        if (d_value == value)
+            return;
+
+        d_value = value;
+        notifyChanged();
+    }
+
+    Observable& operator=(const T& value)
+    {
+        set(value);
+        return *this;
+    }
+
+private:
+    T d_value;
+};
+
+//! Binding of a Property of type \a T to an Observable<T>.
+template<typename T>
+class PropertyBinding : public PropertyBindingBase
+{
+public:
+    PropertyBinding(Observable<T>& observable, Window& window, const PropertyHandle<T>& handle) :
+        PropertyBindingBase(observable, window, *handle.getProperty()),
+        d_source(observable),
+        d_handle(handle)
+    {}
+
+    void apply() override
+    {
+        // reading a converted value back would cost as much as setting it
+        if (d_handle.isNative() && d_handle.get() == d_source.get())
+            return;
+
+        d_handle.set(d_source.get());
+    }
+
+private:
+    const Observable<T>& d_source;
+    PropertyHandle<T> d_handle;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIObservable_h_
@@ -43,6 +43,10 @@ namespace CEGUI
     http://www.pcre.org/pcre.txt (scroll / search "PCREPATTERN(3)").
     Alternatively, see the perl regex documentation at
     http://perldoc.perl.org/perlre.html
+
+    Patterns are compiled anchored and, with PCRE 8.20 or newer built with
+    JIT support, also to machine code for the soft partial matching done by
+    getMatchStateOfString.
 */
 class PCRERegexMatcher : public RegexMatcher
 {
@@ -65,6 +69,8 @@ private:
     String d_string;
     //! Pointer to PCRE compiled RegEx.
     pcre* d_regex;
+    //! Study data of d_regex, holding the JIT compiled code where available.
+    pcre_extra* d_extra;
 };
 
 } // End of  CEGUI namespace section
@@ -0,0 +1,163 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIPreparsedXML_h_
+#define _CEGUIPreparsedXML_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/String.h"
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251) // STL classes in API
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class RawDataContainer;
+class XMLHandler;
+
+/*!
+\brief
+    Compact binary recording of the events an XML parser produces for a
+    document, which can be passed to an XMLHandler again without parsing
+    the XML.
+
+    Element names, attribute names and values and text are stored once each
+    in a string table, the document itself is a stream of indices into that
+    table. A recording carries a hash of the XML it was made from, so that a
+    recording that no longer matches its source is detected when read and
+    the source can be parsed instead.
+*/
+class CEGUIEXPORT PreparsedXML
+{
+public:
+    //! Version of the binary format, recordings of other versions are rejected.
+    static const std::uint32_t FormatVersion;
+
+    //! Returns the hash of the XML in \a source that recordings of it carry.
+    static std::uint64_t computeSourceHash(const RawDataContainer& source);
+
+    //! Returns whether \a data starts like a recording written by write().
+    static bool isPreparsedData(const RawDataContainer& data);
+
+    PreparsedXML();
+
+    /*!
+    \brief
+        Parses the XML in \a source with the XML parser of the System and
+        records the events it produces, replacing any previous recording.
+
+    \param schemaName
+        Name of the schema to validate \a source against, as given to
+        XMLParser::parseXML.
+    */
+    void record(const RawDataContainer& source, const String& schemaName);
+
+    //! Writes the recording in binary form to \a out_stream.
+    void write(OutStream& out_stream) const;
+
+    /*!
+    \brief
+        Reads a recording written by write().
+
+    \param sourceHash
+        Hash of the XML the recording is expected to be made from, as
+        returned by computeSourceHash().
+
+    \return
+        - true if the recording was read.
+        - false if \a data holds no valid recording of the current format
+          version or one made from different XML. The recording is empty
+          then.
+    */
+    bool read(const RawDataContainer& data, std::uint64_t sourceHash);
+
+    /*!
+    \brief
+        Reads a recording written by write(), whatever XML it was made from.
+
+    \return
+        - true if the recording was read.
+        - false if \a data holds no valid recording of the current format
+          version. The recording is empty then.
+    */
+    bool read(const RawDataContainer& data);
+
+    //! Passes the recorded events to \a handler in document order.
+    void replay(XMLHandler& handler) const;
+
+    //! Removes the recording.
+    void clear();
+
+    //! Returns whether nothing is recorded.
+    bool empty() const { return d_events.empty(); }
+
+    //! Returns the hash of the XML the recording was made from.
+    std::uint64_t getSourceHash() const { return d_sourceHash; }
+
+private:
+    class Recorder;
+
+    //! Kinds of the events in d_events.
+    enum EventType : std::uint32_t
+    {
+        //! Followed by the name, the attribute count and name/value pairs.
+        ElementStartEvent,
+        //! Followed by the name.
+        ElementEndEvent,
+        //! Followed by the text.
+        TextEvent
+    };
+
+    //! Returns the index of \a str in the string table, adding it if needed.
+    std::uint32_t addString(const String& str);
+    //! Reads a recording, rejecting it if \a sourceHash is given and differs.
+    bool readData(const RawDataContainer& data, const std::uint64_t* sourceHash);
+    //! Returns whether d_events is well formed and refers to existing strings only.
+    bool validateEvents() const;
+
+    //! Hash of the XML the recording was made from.
+    std::uint64_t d_sourceHash;
+    //! Strings referred to by the events.
+    std::vector<String> d_strings;
+    //! Index of every string in d_strings, only used while recording.
+    std::unordered_map<String, std::uint32_t> d_stringIndices;
+    //! The events, as event types followed by their string indices and counts.
+    std::vector<std::uint32_t> d_events;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIPreparsedXML_h_
@@ -0,0 +1,140 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIProfiler_h_
+#define _CEGUIProfiler_h_
+
+#include "CEGUI/Base.h"
+#include <cstdint>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Static description of an instrumented zone, see CEGUI_PROFILE_SCOPE.
+
+    The layout matches the source location data of the Tracy profiler, so
+    a backend forwarding zones to Tracy can hand it over as is.
+*/
+struct ProfileZone
+{
+    const char* d_name;
+    const char* d_function;
+    const char* d_file;
+    std::uint32_t d_line;
+    //! Colour of the zone as 0xRRGGBB, 0 for the default colour.
+    std::uint32_t d_colour;
+};
+
+/*!
+\brief
+    Interface of the receivers of instrumented zones.
+
+    Zones are entered and left by any thread that runs instrumented code, so
+    implementations must be thread safe. Zones are properly nested per thread.
+*/
+class CEGUIEXPORT ProfilerBackend
+{
+public:
+    virtual ~ProfilerBackend();
+
+    //! Called when \a zone is entered, the result is passed to the matching endZone.
+    virtual std::uint64_t beginZone(const ProfileZone& zone) = 0;
+
+    //! Called when \a zone is left.
+    virtual void endZone(const ProfileZone& zone, std::uint64_t token) = 0;
+};
+
+/*!
+\brief
+    Holds the ProfilerBackend receiving the zones of CEGUI_PROFILE_SCOPE.
+
+    Instrumentation is compiled in only when CEGUI is built with
+    CEGUI_ENABLE_PROFILING, otherwise the macro expands to nothing and no
+    backend is ever called.
+*/
+class CEGUIEXPORT Profiler
+{
+public:
+    /*!
+    \brief
+        Sets the backend receiving the zones, or nullptr to stop profiling.
+
+        Zones already entered are still left with the backend they were
+        entered with, so a replaced backend must outlive them.
+    */
+    static void setBackend(ProfilerBackend* backend);
+
+    //! Returns the backend receiving the zones, or nullptr.
+    static ProfilerBackend* getBackend();
+};
+
+//! Enters a zone on construction and leaves it on destruction.
+class ProfileScope
+{
+public:
+    explicit ProfileScope(const ProfileZone& zone) :
+        d_zone(zone),
+        d_backend(Profiler::getBackend()),
+        d_token(d_backend ? d_backend->beginZone(zone) : 0)
+    {}
+
+    ~ProfileScope()
+    {
+        if (d_backend)
+            d_backend->endZone(d_zone, d_token);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const ProfileZone& d_zone;
+    ProfilerBackend* d_backend;
+    std::uint64_t d_token;
+};
+
+} // End of  CEGUI namespace section
+
+/*************************************************************************
+    Marks the rest of the enclosing scope as a zone named \a name, which
+    must be a string literal. Compiles to nothing unless CEGUI is built
+    with CEGUI_ENABLE_PROFILING.
+*************************************************************************/
+#ifdef CEGUI_ENABLE_PROFILING
+#   define CEGUI_PROFILE_CONCAT_IMPL(a, b) a##b
+#   define CEGUI_PROFILE_CONCAT(a, b) CEGUI_PROFILE_CONCAT_IMPL(a, b)
+#   define CEGUI_PROFILE_SCOPE(name) \
+        static const CEGUI::ProfileZone CEGUI_PROFILE_CONCAT(ceguiProfileZone, __LINE__) = \
+            { name, __func__, __FILE__, static_cast<std::uint32_t>(__LINE__), 0 }; \
+        CEGUI::ProfileScope CEGUI_PROFILE_CONCAT(ceguiProfileScope, __LINE__)( \
+            CEGUI_PROFILE_CONCAT(ceguiProfileZone, __LINE__))
+#else
+#   define CEGUI_PROFILE_SCOPE(name) (void)0
+#endif
+
+#endif  // end of guard _CEGUIProfiler_h_
@@ -31,6 +31,7 @@
 #define _CEGUIProperty_h_
 
 #include "CEGUI/String.h"
+#include "CEGUI/InternedName.h"
 
 namespace CEGUI
 {
@@ -86,6 +87,7 @@ public:
 	*/
 	Property(const String& name, const String& help, const String& defaultValue = "", bool writesXML = true, const String& dataType = "Unknown", const String& origin = "Unknown") :
 	  d_name(name),
+	  d_internedName(name),
 	  d_help(help),
 	  d_default(defaultValue),
 	  d_writeXML(writesXML),
@@ -119,6 +121,13 @@ public:
 	*/
 	const String& getName(void) const		{return d_name;}
 
+    /*!
+    \brief
+        Return the name of this Property, interned when the Property was
+        constructed so that adding it to a PropertySet needs no hashing.
+    */
+    const InternedName& getInternedName() const { return d_internedName; }
+
     /*!
 	\brief
 		Return string data type of this Property
@@ -167,6 +176,22 @@ public:
 	*/
 	virtual void	set(PropertyReceiver* receiver, const String& value) = 0;
 
+    /*!
+    \brief
+        Copies the value of the property from one receiver to another.
+
+        The default implementation goes through get and set; typed properties
+        copy the native value without converting it to a String.
+
+    \param source
+        Pointer to the object to read the value from.
+
+    \param target
+        Pointer to the object to assign the value to.  The property must be
+        present on \a target as well.
+    */
+    virtual void copyValue(const PropertyReceiver* source, PropertyReceiver* target);
+
 
 	/*!
 	\brief
@@ -238,6 +263,7 @@ public:
 
 protected:
 	String d_name;		//!< String that stores the Property name.
+	InternedName d_internedName; //!< d_name, interned.
 	String d_help;		//!< String that stores the Property help text.
 	String d_default;	//!< String that stores the Property default value string.
 	bool d_writeXML; //!< Specifies whether writeXMLToStream should do anything for this property.
@@ -31,8 +31,13 @@
 
 #include "CEGUI/Property.h"
 #include "CEGUI/IteratorBase.h"
+#include "CEGUI/InternedName.h"
 #include "CEGUI/TplWindowProperty.h" // for CEGUI_DEFINE_PROPERTY, see below //???move both out of here?
 #include <unordered_map>
+#include <map>
+#include <memory>
+#include <vector>
+#include <utility>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -41,6 +46,73 @@
 
 namespace CEGUI
 {
+/*!
+\brief
+    Property of a PropertyReceiver, resolved once for repeated native access.
+
+    Obtained from PropertySet::getPropertyHandle. Getting and setting the value
+    through a handle skips the name lookup and the type check done by
+    PropertySet::getProperty<T> and PropertySet::setProperty<T>, which makes it
+    suitable for values updated every frame. If the Property is not a
+    TypedProperty of \a T the handle falls back to string conversion, like
+    the templated PropertySet methods do.
+
+    A handle stays valid as long as its receiver exists and the Property is
+    not removed from it.
+*/
+template<typename T>
+class PropertyHandle
+{
+public:
+    typedef PropertyHelper<T> Helper;
+
+    //! Construct a null handle, see isValid.
+    PropertyHandle() :
+        d_receiver(nullptr),
+        d_property(nullptr),
+        d_typedProperty(nullptr)
+    {}
+
+    PropertyHandle(PropertyReceiver* receiver, Property* property) :
+        d_receiver(receiver),
+        d_property(property),
+        d_typedProperty(dynamic_cast<TypedProperty<T>*>(property))
+    {}
+
+    //! Return whether the handle refers to a Property.
+    bool isValid() const { return d_property != nullptr; }
+
+    //! Return whether the value is accessed without string conversion.
+    bool isNative() const { return d_typedProperty != nullptr; }
+
+    //! Return the Property the handle refers to.
+    Property* getProperty() const { return d_property; }
+
+    //! Return the current value of the Property.
+    typename Helper::safe_method_return_type get() const
+    {
+        if (d_typedProperty)
+            return d_typedProperty->getNative(d_receiver);
+
+        return Helper::fromString(d_property->get(d_receiver));
+    }
+
+    //! Set the value of the Property.
+    void set(typename Helper::pass_type value) const
+    {
+        if (d_typedProperty)
+            d_typedProperty->setNative(d_receiver, value);
+        else
+            d_property->set(d_receiver, Helper::toString(value));
+    }
+
+private:
+    PropertyReceiver* d_receiver;
+    Property* d_property;
+    //! d_property if it is a TypedProperty of T, nullptr otherwise.
+    TypedProperty<T>* d_typedProperty;
+};
+
 /*!
 \brief
 	Interface providing introspection capabilities
@@ -92,6 +164,12 @@ variables in the scope of the constructor or a method called from there.
 It's unusual but multiple instances of the same class can have different
 Properties added to them.
 
+The tables mapping names to Properties are shared as well. All PropertySets
+that had the same Properties added in the same order, i.e. usually all
+instances of a class, point to the same immutable table, which is only built
+once. Adding or removing a Property moves the PropertySet to another shared
+table.
+
 It is recommended to use the \a CEGUI_DEFINE_PROPERTY macro instead of using
 PropertySet::addProperty directly. This takes care of property initialisation
 as well as it's addition to the PropertySet instance.
@@ -99,11 +177,16 @@ as well as it's addition to the PropertySet instance.
 class CEGUIEXPORT PropertySet : public PropertyReceiver
 {
 public:
+    //! Names of properties paired with the values to set, see setProperties.
+    typedef std::vector<std::pair<String, String> > PropertyValueList;
+
     /*!
 	\brief
 		Constructs a new PropertySet object
 	*/
-    PropertySet(void) {}
+    PropertySet(void) :
+        d_propertyTable(&PropertyTable::getEmptyTable())
+    {}
 
 
     /*!
@@ -152,6 +235,9 @@ public:
     */
     Property* getPropertyInstance(const String& name) const;
 
+    //! \copydoc PropertySet::getPropertyInstance
+    Property* getPropertyInstance(const InternedName& name) const;
+
 
     /*!
 	\brief
@@ -172,6 +258,9 @@ public:
 	*/
     bool isPropertyPresent(const String& name) const;
 
+    //! \copydoc PropertySet::isPropertyPresent
+    bool isPropertyPresent(const InternedName& name) const;
+
 
     /*!
 	\brief
@@ -202,6 +291,13 @@ public:
 	*/
     String getProperty(const String& name) const;
 
+    /*!
+    \copydoc PropertySet::getProperty
+
+        This overload saves hashing the name of the Property to look it up.
+    */
+    String getProperty(const InternedName& name) const;
+
     /*!
     \copydoc PropertySet::getProperty
     
@@ -211,26 +307,14 @@ public:
     template<typename T>
     typename PropertyHelper<T>::return_type getProperty(const String& name) const
     {
-        PropertyRegistry::const_iterator pos = d_properties.find(name);
-
-        if (pos == d_properties.end())
-        {
-            throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
-        }
-
-        Property* baseProperty = pos->second;
-        TypedProperty<T>* typedProperty = dynamic_cast<TypedProperty<T>* >(baseProperty);
+        return getPropertyValue<T>(getPropertyInstance(name));
+    }
 
-        if (typedProperty)
-        {
-            // yay, we can get native!
-            return typedProperty->getNative(this);
-        }
-        else
-        {
-            // fall back to string get
-            return PropertyHelper<T>::fromString(baseProperty->get(this));
-        }
+    //! \copydoc PropertySet::getProperty
+    template<typename T>
+    typename PropertyHelper<T>::return_type getProperty(const InternedName& name) const
+    {
+        return getPropertyValue<T>(getPropertyInstance(name));
     }
 
     /*!
@@ -248,6 +332,30 @@ public:
 	*/
     void setProperty(const String& name, const String& value);
 
+    /*!
+    \copydoc PropertySet::setProperty
+
+        This overload saves hashing the name of the Property to look it up.
+    */
+    void setProperty(const InternedName& name, const String& value);
+
+    /*!
+    \brief
+        Sets the values of several properties, in the order given.
+
+        Equivalent to calling setProperty for each pair of \a values, but
+        takes a single call, which matters for the script bindings.
+        Subclasses may apply the values as a batch, e.g. Window recomputes its
+        layout once afterwards.
+
+    \exception UnknownObjectException
+        Thrown if one of the properties is not in the PropertySet. The values
+        before it are set, those after it are not.
+    \exception InvalidRequestException
+        Thrown when a Property was unable to interpret its value.
+    */
+    virtual void setProperties(const PropertyValueList& values);
+
     /*!
     \copydoc PropertySet::setProperty
     
@@ -257,26 +365,37 @@ public:
     template<typename T>
     void    setProperty(const String& name, typename PropertyHelper<T>::pass_type value)
     {
-        PropertyRegistry::iterator pos = d_properties.find(name);
+        setPropertyValue<T>(getPropertyInstance(name), value);
+    }
 
-        if (pos == d_properties.end())
-        {
-            throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
-        }
+    //! \copydoc PropertySet::setProperty
+    template<typename T>
+    void    setProperty(const InternedName& name, typename PropertyHelper<T>::pass_type value)
+    {
+        setPropertyValue<T>(getPropertyInstance(name), value);
+    }
 
-        Property* baseProperty = pos->second;
-        TypedProperty<T>* typedProperty = dynamic_cast<TypedProperty<T>* >(baseProperty);
+    /*!
+    \brief
+        Return a handle for getting and setting the value of a Property
+        repeatedly without looking it up or converting it to String.
 
-        if (typedProperty)
-        {
-            // yay, we can set native!
-            typedProperty->setNative(this, value);
-        }
-        else
-        {
-            // fall back to string set
-            baseProperty->set(this, PropertyHelper<T>::toString(value));
-        }
+    \param name
+        String containing the name of the Property.
+
+    \exception UnknownObjectException	Thrown if no Property named \a name is in the PropertySet.
+    */
+    template<typename T>
+    PropertyHandle<T> getPropertyHandle(const String& name)
+    {
+        return PropertyHandle<T>(this, getPropertyInstance(name));
+    }
+
+    //! \copydoc PropertySet::getPropertyHandle
+    template<typename T>
+    PropertyHandle<T> getPropertyHandle(const InternedName& name)
+    {
+        return PropertyHandle<T>(this, getPropertyInstance(name));
     }
 
     /*!
@@ -306,8 +425,106 @@ public:
     String getPropertyDefault(const String& name) const;
 
 private:
-    typedef std::unordered_map<String, Property*> PropertyRegistry;
-    PropertyRegistry	d_properties;
+    typedef std::unordered_map<InternedName, Property*> PropertyRegistry;
+
+    //! Get the value of \a baseProperty natively if possible.
+    template<typename T>
+    typename PropertyHelper<T>::return_type getPropertyValue(Property* baseProperty) const
+    {
+        TypedProperty<T>* typedProperty = dynamic_cast<TypedProperty<T>* >(baseProperty);
+
+        if (typedProperty)
+        {
+            // yay, we can get native!
+            return typedProperty->getNative(this);
+        }
+        else
+        {
+            // fall back to string get
+            return PropertyHelper<T>::fromString(baseProperty->get(this));
+        }
+    }
+
+    //! Set the value of \a baseProperty natively if possible.
+    template<typename T>
+    void setPropertyValue(Property* baseProperty, typename PropertyHelper<T>::pass_type value)
+    {
+        TypedProperty<T>* typedProperty = dynamic_cast<TypedProperty<T>* >(baseProperty);
+
+        if (typedProperty)
+        {
+            // yay, we can set native!
+            typedProperty->setNative(this, value);
+        }
+        else
+        {
+            // fall back to string set
+            baseProperty->set(this, PropertyHelper<T>::toString(value));
+        }
+    }
+
+    /*!
+    \brief
+        Immutable table of the Properties of all PropertySets to which the same
+        Properties were added in the same order.
+
+        Each table is the table of its parent plus one Property. The tables
+        extending a table are created on first use and kept, so PropertySets
+        built the same way end up sharing one table. The name lookup registry
+        of a table is only built when it is first used.
+    */
+    class CEGUIEXPORT PropertyTable
+    {
+    public:
+        PropertyTable();
+        PropertyTable(PropertyTable* parent, Property* property);
+
+        //! Return the table holding no Properties.
+        static PropertyTable& getEmptyTable();
+
+        /*!
+        \brief
+            Return the table holding our Properties plus \a property, creating
+            it if needed, or nullptr if we hold a Property of the same name.
+        */
+        PropertyTable* getExtendedTable(Property* property);
+        //! Return the table holding our Properties but the one named \a name, or nullptr.
+        PropertyTable* getReducedTable(const InternedName& name);
+        //! Return whether this table holds a Property named \a name.
+        bool contains(const InternedName& name);
+
+        const PropertyRegistry& getRegistry()
+        {
+            if (!d_registryValid)
+                buildRegistry();
+            return d_registry;
+        }
+
+    private:
+        void buildRegistry();
+
+        typedef std::map<std::pair<Property*, InternedName>, std::unique_ptr<PropertyTable>> TableMap;
+
+        //! The table we extend, nullptr for the empty table.
+        PropertyTable* d_parent;
+        //! Property added to the parent's Properties and its name when added.
+        Property* d_property;
+        InternedName d_propertyName;
+        //! Tables extending this one, keyed by the added Property and its name.
+        TableMap d_extendedTables;
+        //! Name lookup registry of all Properties of this table, built on demand.
+        PropertyRegistry d_registry;
+        bool d_registryValid;
+        /*!
+            The table last returned by getExtendedTable. Instances of a class
+            add the same Properties in the same order, so this is almost always
+            the next table and saves the lookup in d_extendedTables.
+        */
+        PropertyTable* d_lastExtended;
+    };
+
+    //! The shared table of the Properties in this set.
+    PropertyTable* d_propertyTable;
 
 
 public:
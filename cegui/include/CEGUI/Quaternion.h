@@ -46,7 +46,7 @@ namespace CEGUI
  Quaternions can't be interpolated as floats and/or vectors, we have to use
  "Spherical linear interpolator" instead.
  */
-class QuaternionSlerpInterpolator : public Interpolator
+class QuaternionSlerpInterpolator : public Interpolator, public NativeInterpolator
 {
 public:
     typedef PropertyHelper<glm::quat> Helper;
@@ -70,6 +70,22 @@ public:
                                                const String& value1,
                                                const String& value2,
                                                float position) override;
+
+    //! \copydoc NativeInterpolator::createValue
+    InterpolatorValue* createValue(const String& value) const override;
+
+    //! \copydoc NativeInterpolator::applyAbsolute
+    void applyAbsolute(PropertyReceiver* target, Property* property,
+                       const InterpolatorValue& value1,
+                       const InterpolatorValue& value2,
+                       float position) override;
+
+    //! \copydoc NativeInterpolator::applyRelative
+    void applyRelative(PropertyReceiver* target, Property* property,
+                       const String& base,
+                       const InterpolatorValue& value1,
+                       const InterpolatorValue& value2,
+                       float position) override;
 };
 
 }
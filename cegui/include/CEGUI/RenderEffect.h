@@ -125,6 +125,16 @@ public:
         after the update.
     */
     virtual bool update(const float elapsed, RenderingWindow& window) = 0;
+
+    /*!
+    \brief
+        Return whether the effect is applied directly to the geometry of a
+        Window rather than to the output of a RenderingWindow.
+
+    \return
+        true for InPlaceRenderEffect based effects, false otherwise.
+    */
+    virtual bool isAppliedInPlace() const { return false; }
 };
 
 } // End of  CEGUI namespace section
@@ -28,6 +28,7 @@
 #define _CEGUIRenderQueue_h_
 
 #include "CEGUI/Base.h"
+#include "CEGUI/Rectf.h"
 #include <vector>
 
 #if defined(_MSC_VER)
@@ -57,9 +58,71 @@ public:
         Draw all GeometryBuffer objects currently listed in the RenderQueue.
         The GeometryBuffer objects remain in the queue after drawing has taken
         place.
+
+        Neighbouring GeometryBuffers that report each other as compatible via
+        GeometryBuffer::isBatchableWith are drawn as one batch through
+        GeometryBuffer::drawBatch of the first buffer of the run.
+
+        The buffers are drawn in the order returned by getDrawOrder.
     */
     void draw(std::uint32_t drawModeMask = DrawModeMaskAll) const;
 
+    /*!
+    \brief
+        Sets whether the buffers may be drawn in a different order than they
+        were added in, so that buffers drawn with the same material and
+        textures end up next to each other and can be batched.
+
+        Only buffers whose drawn areas do not overlap are moved past each
+        other, so the rendered result is the same as in submission order.
+        Reordering is disabled by default.
+    */
+    void setReorderingEnabled(bool enabled);
+
+    //! Returns whether the buffers may be drawn in a different order than they were added in.
+    bool isReorderingEnabled() const { return d_reorderingEnabled; }
+
+    /*!
+    \brief
+        Sets whether buffers that are completely hidden behind opaque
+        geometry drawn after them are left out of the draw order, so that
+        stacked full screen panels do not draw pixels that are overdrawn
+        anyway. See GeometryBuffer::getOpaqueArea for the geometry considered
+        opaque. Occlusion culling is disabled by default.
+    */
+    void setOcclusionCullingEnabled(bool enabled);
+
+    //! Returns whether buffers hidden behind opaque geometry are left out of the draw order.
+    bool isOcclusionCullingEnabled() const { return d_occlusionCullingEnabled; }
+
+    /*!
+    \brief
+        Computes the order the buffers are drawn in from the buffers currently
+        in the queue and their drawn areas.
+
+        Each buffer is moved back behind the closest earlier buffer it may be
+        merged with (see GeometryBuffer::isMergeableWith) if none of the buffers
+        in between overlaps it. Buffers whose drawn area is unknown are never
+        moved and are never moved past. If occlusion culling is enabled, the
+        buffers hidden behind opaque buffers drawn after them are then left
+        out. Does nothing if both are disabled.
+
+        This has to be called after the buffers were updated for the frame and
+        before the Renderer uploads them, so that the vertex data of buffers
+        that end up next to each other is uploaded next to each other as well.
+        RenderingSurface does so for each of its queues.
+    */
+    void updateDrawOrder();
+
+    /*!
+    \brief
+        Returns the buffers in the order they are drawn in. This is the order
+        computed by the last call to updateDrawOrder, or the order the buffers
+        were added in if reordering is disabled or the queue was modified since.
+    */
+    const std::vector<GeometryBuffer*>& getDrawOrder() const
+        { return d_drawOrderValid ? d_drawOrder : d_buffers; }
+
     /*!
     \brief
         Add a list of GeometryBuffers to the RenderQueue. Ownership of the
@@ -104,9 +167,23 @@ public:
     BufferList& getBuffers()         {return d_buffers;}
 
 private:
+    //! Removes the buffers hidden behind opaque buffers drawn later from d_drawOrder.
+    void cullOccludedBuffers();
 
     //! Collection of GeometryBuffer objects that comprise this RenderQueue.
     BufferList d_buffers;
+    //! The buffers of d_buffers in the order they are drawn in, if d_drawOrderValid.
+    BufferList d_drawOrder;
+    //! Drawn areas of the buffers of d_drawOrder, used while it is computed.
+    std::vector<Rectf> d_drawOrderAreas;
+    //! Whether d_drawOrder matches the current content of d_buffers.
+    bool d_drawOrderValid = false;
+    //! Whether updateDrawOrder may reorder the buffers.
+    bool d_reorderingEnabled = false;
+    //! Opaque areas of the buffers drawn later, used while culling.
+    std::vector<Rectf> d_occluders;
+    //! Whether updateDrawOrder leaves out buffers hidden behind opaque ones.
+    bool d_occlusionCullingEnabled = false;
 };
 
 } // End of  CEGUI namespace section
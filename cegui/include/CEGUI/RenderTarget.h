@@ -241,7 +241,39 @@ public:
     */
     void setFovY(const float fovY);
 
+    /*!
+    \brief
+        Sets the number of pixels of the RenderTarget per unit of the
+        coordinates the geometry drawn to it is specified in. With 0.5, content
+        laid out for an area of 200 x 100 is rendered into 100 x 50 pixels.
+        Defaults to 1.
+    */
+    void setRenderScale(float scale);
+
+    //! Returns the number of pixels per unit of the geometry coordinates.
+    float getRenderScale() const { return d_renderScale; }
+
+    /*!
+    \brief
+        Returns \a region, given in the coordinates of the geometry, in pixels
+        of the RenderTarget, rounded outwards to whole pixels when scaled.
+        Renderer modules use this for scissor rectangles.
+    */
+    Rectf getPixelRegion(const Rectf& region) const;
+
 protected:
+    /*!
+    \brief
+        Unprojects \a p_in onto the plane of the GeometryBuffer \a buff using
+        the view projection matrix of this RenderTarget, which must be up to
+        date. The result is local to \a buff.
+
+        The model view projection matrix of \a buff and its inverse are cached
+        by the GeometryBuffer, so a repeated call only transforms a few points.
+    */
+    void unprojectPointOnBuffer(const GeometryBuffer& buff,
+                                const glm::vec2& p_in, glm::vec2& p_out) const;
+
     /*!
     \brief
         The current number of activation of this RenderTarget. This is increased on every call to activate() and
@@ -269,6 +301,9 @@ protected:
 
     //! The tangent of the y-axis FOV half-angle; used to calculate viewing distance.
     float d_fovY_halftan;
+
+    //! Pixels of the target per unit of the geometry coordinates.
+    float d_renderScale;
 };
 
 } // End of  CEGUI namespace section
@@ -117,6 +117,22 @@ public:
     */
     Sizef getPixelSize(const Window* ref_wnd, const size_t line) const;
 
+    /*!
+    \brief
+        Return the pixel width of a specified line for the RenderedString,
+        measuring no more of it than needed to tell whether it exceeds
+        \a limit.
+
+    \return
+        The width of the line if it does not exceed \a limit, otherwise some
+        value greater than \a limit.
+
+    \exception InvalidRequestException
+        thrown if \a line is out of range.
+    */
+    float getPixelWidthUpTo(const Window* ref_wnd, const size_t line,
+                            float limit) const;
+
     //! Return the maximum horizontal extent of all lines, in pixels.
     float getHorizontalExtent(const Window* ref_wnd) const;
 
@@ -29,6 +29,7 @@
 
 #include "CEGUI/Rectf.h"
 #include "CEGUI/falagard/Enums.h"
+#include "CEGUI/MemoryAllocator.h"
 #include <vector>
 
 #if defined(_MSC_VER)
@@ -44,7 +45,8 @@ namespace CEGUI
     Base class representing a part of a rendered string.  The 'part' represented
     may be a text string, an image or some other entity.
 */
-class CEGUIEXPORT RenderedStringComponent
+class CEGUIEXPORT RenderedStringComponent :
+    public AllocatedObject<MemoryCategory::String>
 {
 public:
     //! Destructor.
@@ -85,6 +87,17 @@ public:
     //! return the pixel size of the rendered component.
     virtual Sizef getPixelSize(const Window* ref_wnd) const = 0;
 
+    /*!
+    \brief
+        return the pixel width of the rendered component, measuring no more of
+        it than needed to tell whether it exceeds \a limit.
+
+    \return
+        The width of the component if it does not exceed \a limit, otherwise
+        some value greater than \a limit.
+    */
+    virtual float getPixelWidthUpTo(const Window* ref_wnd, float limit) const;
+
     //! return whether the component can be split
     virtual bool canSplit() const = 0;
 
@@ -70,6 +70,7 @@ public:
         const Rectf* clip_rect, const float vertical_space,
         const float space_extra) const override;
     Sizef getPixelSize(const Window* ref_wnd) const override;
+    float getPixelWidthUpTo(const Window* ref_wnd, float limit) const override;
     bool canSplit() const override;
     RenderedStringTextComponent* split(const Window* ref_wnd,
       float split_point, bool first_component, bool& was_word_split) override;
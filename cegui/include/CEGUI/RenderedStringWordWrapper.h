@@ -30,6 +30,7 @@
 #include "CEGUI/FormattedRenderedString.h"
 #include "CEGUI/JustifiedRenderedString.h"
 #include <vector>
+#include <algorithm>
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -97,23 +98,21 @@ void RenderedStringWordWrapper<T>::format(const Window* ref_wnd,
 
     bool was_word_split = false;
 
-    RenderedString rstring, lstring;
-    rstring = *d_renderedString;
-    float rs_width;
+    RenderedString rstring(*d_renderedString);
+    // lines are only measured up to the area width, so that the remainder of
+    // a long line is not measured again after every split.
+    const float width_limit = std::max(area_size.d_width, 0.0f);
 
     T* frs;
 
     for (size_t line = 0; line < rstring.getLineCount(); ++line)
     {
-        while ((rs_width = rstring.getPixelSize(ref_wnd, line).d_width) > 0)
+        while (rstring.getPixelWidthUpTo(ref_wnd, line, width_limit) > width_limit)
         {
-            // skip line if no wrapping occurs
-            if (rs_width <= area_size.d_width)
-                break;
-
-            // split rstring at width into lstring and remaining rstring
-            was_word_split = rstring.split(ref_wnd, line, area_size.d_width, lstring) || was_word_split;
-            frs = new T(*new RenderedString(lstring));
+            // split rstring at width into a new lstring and remaining rstring
+            RenderedString* lstring = new RenderedString();
+            was_word_split = rstring.split(ref_wnd, line, area_size.d_width, *lstring) || was_word_split;
+            frs = new T(*lstring);
             frs->format(ref_wnd, area_size);
             d_lines.push_back(frs);
             line = 0;
@@ -30,8 +30,12 @@
 #define _CEGUIRenderer_h_
 
 #include "CEGUI/Base.h"
+#include "CEGUI/FrameStats.h"
 #include "CEGUI/RefCounted.h"
+#include "CEGUI/TextureResidencyManager.h"
+#include "CEGUI/TextureTargetPool.h"
 #include <glm/glm.hpp>
+#include <mutex>
 #include <set>
 #include <vector>
 
@@ -60,7 +64,11 @@ enum class BlendMode : int
     Invalid,
     //! Use normal blending mode.
     Normal,
-    //! Use blending mode suitable for textures with premultiplied colours.
+    /*!
+        Use blending mode suitable for textures with premultiplied colours.
+        Equivalent to Normal while premultiplied alpha is enabled on the
+        Renderer.
+    */
     RttPremultiplied
 };
 
@@ -77,6 +85,21 @@ enum class DefaultShaderType : int
     Solid,
     //! A shader for textured geometry, used in most CEGUI widgets
     Textured,
+    /*!
+        A shader for textured geometry whose texture alpha holds a signed
+        distance field, with the edge at 0.5. Not offered by every Renderer,
+        see Renderer::isDefaultShaderTypeSupported.
+    */
+    DistanceField,
+    /*!
+        A shader for textured geometry whose texture holds the coverage of up
+        to four glyph layers, layer 0 in alpha and layers 1 to 3 in red, green
+        and blue. The layers are drawn from the highest down, layer 0 in the
+        vertex colour and the others in the colours set with
+        GeometryBuffer::setLayerColours. Not offered by every Renderer, see
+        Renderer::isDefaultShaderTypeSupported.
+    */
+    LayeredGlyph,
     //! Count of types
     Count
 };
@@ -130,10 +153,14 @@ public:
         You should remove the GeometryBuffer from any RenderQueues and call destroyGeometryBuffer
         when you want to destroy the GeometryBuffer.
 
+    \param shaderType
+        The default shader type of the RenderMaterial, DefaultShaderType::Textured,
+        DefaultShaderType::DistanceField or DefaultShaderType::LayeredGlyph.
+
     \return
         GeometryBuffer object.
     */
-    GeometryBuffer& createGeometryBufferTextured();
+    GeometryBuffer& createGeometryBufferTextured(DefaultShaderType shaderType = DefaultShaderType::Textured);
 
     /*!
     \brief
@@ -170,6 +197,49 @@ public:
     */
     void destroyGeometryBuffer(GeometryBuffer& buffer);
 
+    /*!
+    \brief
+        Sets the GeometryBufferPool that the createGeometryBufferTextured and
+        createGeometryBufferColoured overloads without a RenderMaterial take
+        recycled buffers from.
+
+    \param pool
+        Pointer to the pool to use, or nullptr to always create new buffers.
+        The pool is not owned by the Renderer.
+
+    \note
+        The active pool is tracked per thread, so that geometry generation
+        of several windows can run in parallel (see isGeometryGenerationThreadSafe).
+    */
+    void setActiveGeometryBufferPool(GeometryBufferPool* pool);
+
+    //! Returns the GeometryBufferPool that is currently active on the calling thread, or nullptr.
+    GeometryBufferPool* getActiveGeometryBufferPool() const;
+
+    /*!
+    \brief
+        Returns whether GeometryBuffers of this Renderer may be created, filled
+        and destroyed from threads other than the rendering thread while the
+        rendering thread waits. This is required to generate window geometry
+        in parallel, see GUIContext::setGeometryJobSystem.
+
+        Renderers that touch the GPU when creating or filling GeometryBuffers
+        return false, which is the default.
+    */
+    virtual bool isGeometryGenerationThreadSafe() const { return false; }
+
+    /*!
+    \brief
+        Sets whether destroyGeometryBuffer defers deleting the buffers. While
+        deferred, destroyed buffers are only detached from the Renderer; they
+        are deleted on the calling thread once deferral is switched off again.
+        This keeps GPU resource destruction out of parallel geometry generation.
+    */
+    void setGeometryBufferDestructionDeferred(bool deferred);
+
+    //! Returns whether destroyGeometryBuffer defers deleting the buffers.
+    bool isGeometryBufferDestructionDeferred() const { return d_geometryBufferDestructionDeferred; }
+
     /*!
     \brief
         Destroys all GeometryBuffer objects created by this Renderer.
@@ -217,6 +287,21 @@ public:
     */
     virtual void destroyAllTextureTargets() = 0;
 
+    /*!
+    \brief
+        Returns the pool recycling TextureTargets of this Renderer. Targets from
+        the pool are created with createTextureTarget and must be handed back
+        with TextureTargetPool::release instead of being destroyed.
+    */
+    TextureTargetPool& getTextureTargetPool() { return d_textureTargetPool; }
+
+    /*!
+    \brief
+        Returns the manager keeping track of the memory taken by the textures
+        of this Renderer and keeping it within a budget.
+    */
+    TextureResidencyManager& getTextureResidencyManager() { return d_textureResidencyManager; }
+
     /*!
     \brief
         Creates a 'null' Texture object.
@@ -411,6 +496,19 @@ public:
     */
     virtual RefCounted<RenderMaterial> createRenderMaterial(const DefaultShaderType shaderType) const = 0;
 
+    /*!
+    \brief
+        Returns whether createRenderMaterial can create a RenderMaterial of the
+        specified default shader type.
+
+        DefaultShaderType::Solid and DefaultShaderType::Textured are offered by
+        all Renderers, the other types only by the Renderers overriding this.
+    */
+    virtual bool isDefaultShaderTypeSupported(const DefaultShaderType shaderType) const
+    {
+        return shaderType == DefaultShaderType::Solid || shaderType == DefaultShaderType::Textured;
+    }
+
     /*!
     \brief
         Marks all matrices of all GeometryBuffers as dirty, so that they will be updated before their next usage.
@@ -520,6 +618,60 @@ public:
          return dpiValue / static_cast<float>(ReferenceDpiValue);
     }
 
+    /*!
+    \brief
+        Sets whether all rendering uses premultiplied alpha.
+
+        When enabled, the pixels ImageCodecs decode and the glyphs of
+        FreeTypeFonts are premultiplied before reaching their textures, the
+        colours of the vertices are premultiplied when drawing, and every
+        GeometryBuffer is blended the way BlendMode::RttPremultiplied blends
+        render to texture content. All geometry then shares a single blend
+        state, so buffers of normal and render to texture content can be
+        batched together, and filtering scaled images no longer bleeds the
+        colour of transparent texels into their edges.
+
+        This should be set right after creating the Renderer; textures loaded
+        before the call keep their straight alpha. Data passed directly to
+        Texture::loadFromMemory or Texture::blitFromMemory, and compressed
+        texture data, has to be premultiplied by the caller.
+
+    \exception InvalidRequestException
+        thrown if \a enabled is true and isPremultipliedAlphaSupported
+        returns false.
+    */
+    void setPremultipliedAlphaEnabled(bool enabled);
+
+    //! Returns whether all rendering uses premultiplied alpha.
+    bool isPremultipliedAlphaEnabled() const { return d_premultipliedAlphaEnabled; }
+
+    //! Returns whether the Renderer can render with premultiplied alpha throughout.
+    virtual bool isPremultipliedAlphaSupported() const { return false; }
+
+    /*!
+    \brief
+        Returns the statistics of the last finished frame, summed up over all
+        GUIContexts drawn in it.
+    */
+    const FrameStats& getFrameStats() const { return d_frameStats; }
+
+    /*!
+    \brief
+        Returns the statistics of the frame in progress. Renderer modules and
+        GUIContexts add their figures to it.
+    */
+    FrameStats& getCurrentFrameStats() { return d_currentFrameStats; }
+
+    /*!
+    \brief
+        Finishes the frame in progress, whose statistics are returned by
+        getFrameStats from then on.
+
+        System::renderAllGUIContexts calls this after endRendering. Applications
+        drawing their GUIContexts themselves should call it once per frame.
+    */
+    void finishFrameStats();
+
 protected:
     /*!
     \brief
@@ -539,8 +691,24 @@ protected:
 private:
     //! Container used to track geometry buffers.
     std::set<GeometryBuffer*> d_geometryBuffers;
+    //! Guards d_geometryBuffers during parallel geometry generation.
+    std::mutex d_geometryBuffersMutex;
+    //! Whether destroyGeometryBuffer defers deleting buffers.
+    bool d_geometryBufferDestructionDeferred = false;
+    //! Buffers destroyed while destruction was deferred.
+    std::vector<GeometryBuffer*> d_deferredGeometryBufferDestructions;
     //! The Font scale factor to be used when rendering Fonts (except Bitmap Fonts).
     float d_fontScale;
+    //! Pool recycling the TextureTargets of automatic RenderingWindows.
+    TextureTargetPool d_textureTargetPool;
+    //! Manager tracking the memory taken by the textures.
+    TextureResidencyManager d_textureResidencyManager;
+    //! Whether all rendering uses premultiplied alpha.
+    bool d_premultipliedAlphaEnabled = false;
+    //! Statistics of the last finished frame.
+    FrameStats d_frameStats;
+    //! Statistics of the frame in progress.
+    FrameStats d_currentFrameStats;
 };
 
 }
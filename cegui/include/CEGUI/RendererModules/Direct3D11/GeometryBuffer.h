@@ -54,7 +54,8 @@ public:
 
     // Implement GeometryBuffer interface.
     virtual void draw(std::uint32_t drawModeMask = DrawModeMaskAll) const;
-    virtual void appendGeometry(const float* vertex_data, std::size_t array_size);
+    bool isQuadIndexingSupported() const override;
+    bool isClippingMaskSupported() const override;
 
     /*
     \brief
@@ -68,24 +69,12 @@ public:
 protected:
     //! Update the cached matrices
     void updateMatrix() const;
-    //! Synchronise data in the hardware buffer with what's been added
-    void updateVertexBuffer() const;
-    //! Allocates a hardware vertex buffer of size 'dataSize' (size in bytes).
-    void allocateVertexBuffer(const UINT dataSize) const;
-    //! cleanup the hardware vertex buffer.
-    void cleanupVertexBuffer() const;
     //! Draws the vertex data depending on the fill rule that was set for this object.
     void drawDependingOnFillRule() const;
     // Direct3D11Renderer object that created and owns this GeometryBuffer.
     Direct3D11Renderer& d_owner;
     //! The D3D Device
     ID3D11Device* d_device;
-    //! The D3D DeviceContext
-    ID3D11DeviceContext* d_deviceContext;
-    //! hardware buffer where vertices will be drawn from.
-    mutable ID3D11Buffer* d_vertexBuffer;
-    //! Size of the currently allocated vertex buffer.
-    mutable UINT d_bufferSize;
     //! Cache of the model view projection matrix
     mutable glm::mat4 d_matrix;
     //! D3D11 input layout describing the vertex format we use.
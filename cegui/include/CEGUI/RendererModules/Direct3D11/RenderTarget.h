@@ -66,8 +66,6 @@ protected:
 
     //! The D3D Device
     ID3D11Device& d_device;
-    //! The D3D DeviceContext
-    ID3D11DeviceContext& d_deviceContext;
 };
 
 }
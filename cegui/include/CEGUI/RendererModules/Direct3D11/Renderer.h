@@ -165,6 +165,30 @@ public:
     //Returns Direct3D context
 	ID3D11DeviceContext* getDirect3DDeviceContext(); 
 
+    /*!
+    \brief
+        Sets the device context the GUI rendering is recorded on.
+
+        By default the GUI is rendered on the immediate context passed to
+        create. Setting a deferred context allows the rendering of the GUI to
+        be recorded on a worker thread; the application then calls
+        FinishCommandList on it and executes the command list on the
+        immediate context. Textures are still created and updated on the
+        immediate context, so they must be loaded outside of the recording.
+
+        The context must have the render target of the GUI bound before
+        System::renderAllGUIContexts is called, since deferred contexts do not
+        inherit the state of the immediate context.
+
+    \param context
+        The context to render on, or nullptr to render on the immediate
+        context again.
+    */
+    void setRenderingDeviceContext(ID3D11DeviceContext* context);
+
+    //! Returns the device context the GUI rendering is recorded on.
+    ID3D11DeviceContext* getRenderingDeviceContext() const { return d_renderingContext; }
+
     /*!
     \brief
         Binds the corresponding D3D11 blend mode.
@@ -177,9 +201,40 @@ public:
     */
     void bindRasterizerState(bool scissorEnabled);
 
+    /*!
+    \brief
+        Binds the index buffer used to draw quads of four vertices, after
+        growing it to hold the indices of at least \a quad_count quads.
+    */
+    void bindQuadIndexBuffer(std::size_t quad_count);
+
+    /*!
+    \brief
+        Copies vertex data to the vertex ring buffer shared by all
+        GeometryBuffers and binds it as the vertex source.
+
+        The data is appended to the ring buffer, which is mapped with
+        D3D11_MAP_WRITE_NO_OVERWRITE. When the data does not fit the remaining
+        space the buffer is mapped with D3D11_MAP_WRITE_DISCARD and filled from
+        the start again, and it is grown when the data is larger than the
+        whole buffer.
+    */
+    void bindVertexData(const float* vertex_data, UINT data_size, UINT stride);
+
+    /*!
+    \brief
+        Returns whether \a shaderWrapper is one of the shaders created by the
+        renderer, all of which evaluate the clipping mask of GeometryBuffers.
+    */
+    bool isStandardShaderWrapper(const ShaderWrapper* shaderWrapper) const;
+
+    //! Returns whether \a shaderWrapper is the shader for glyphs with packed layers.
+    bool isLayeredGlyphShaderWrapper(const ShaderWrapper* shaderWrapper) const;
+
     // Implement interface from Renderer
     virtual RenderTarget& getDefaultRenderTarget();
     virtual RefCounted<RenderMaterial> createRenderMaterial(const DefaultShaderType shaderType) const;
+    virtual bool isDefaultShaderTypeSupported(const DefaultShaderType shaderType) const;
     virtual GeometryBuffer& createGeometryBufferColoured(CEGUI::RefCounted<RenderMaterial> renderMaterial);
     virtual GeometryBuffer& createGeometryBufferTextured(CEGUI::RefCounted<RenderMaterial> renderMaterial);
     virtual TextureTarget* createTextureTarget(bool addStencilBuffer);
@@ -222,10 +277,18 @@ protected:
     void initialiseStandardTexturedShaderWrapper();
     //! Initialises the D3D11 ShaderWrapper for coloured objects
     void initialiseStandardColouredShaderWrapper();
+    //! Initialises the D3D11 ShaderWrapper for distance field textured objects
+    void initialiseDistanceFieldShaderWrapper();
+    //! Initialises the D3D11 ShaderWrapper for glyphs with packed layers
+    void initialiseLayeredGlyphShaderWrapper();
     //! Wrapper of the OpenGL shader we will use for textured geometry
     Direct3D11ShaderWrapper* d_shaderWrapperTextured;
     //! Wrapper of the OpenGL shader we will use for solid geometry
     Direct3D11ShaderWrapper* d_shaderWrapperSolid;
+    //! Wrapper of the shader we will use for distance field geometry
+    Direct3D11ShaderWrapper* d_shaderWrapperDistanceField;
+    //! Wrapper of the shader we will use for glyphs with packed layers
+    Direct3D11ShaderWrapper* d_shaderWrapperLayeredGlyph;
 
     //! return size of the D3D device viewport.
     Sizef getViewportSize();
@@ -241,8 +304,10 @@ protected:
     const static String d_rendererID;
 	//! The D3D device context we're using to create various resources with.
 	ID3D11Device* d_device;
-	//! The D3D device context we're using to render
+	//! The immediate D3D device context, used to create and update resources
 	ID3D11DeviceContext* d_deviceContext;
+    //! The D3D device context we're using to render, immediate or deferred
+    ID3D11DeviceContext* d_renderingContext;
     //! BlendState for regular blending in CEGUI
     ID3D11BlendState* d_blendStateNormal;
     //! BlendState for premultiplied blending in CEGUI
@@ -273,6 +338,16 @@ protected:
 
     //! Variable containing the sampler state for CEGUI textures
     ID3D11SamplerState* d_samplerState;
+    //! Index buffer shared by all GeometryBuffers that store quads of four vertices
+    ID3D11Buffer* d_quadIndexBuffer;
+    //! Number of quads d_quadIndexBuffer contains indices for
+    std::size_t d_quadIndexBufferQuadCount;
+    //! Dynamic vertex buffer the vertices of all GeometryBuffers are streamed to
+    ID3D11Buffer* d_vertexRingBuffer;
+    //! Size of d_vertexRingBuffer in bytes
+    UINT d_vertexRingBufferSize;
+    //! Offset in bytes at which the next vertex data is written
+    UINT d_vertexRingBufferOffset;
 };
 
 
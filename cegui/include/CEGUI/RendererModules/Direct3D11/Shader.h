@@ -98,10 +98,10 @@ private:
     //! Returns the highest pixel shader version available that CEGUI supports
     std::string getPixelShaderVersion() const;
 
+    //! Renderer that created the shader, providing the context to bind it on
+    Direct3D11Renderer& d_owner;
     //! The D3D Device
     ID3D11Device* d_device;
-    //! The D3D DeviceContext
-    ID3D11DeviceContext* d_deviceContext;
 
     //! The D3D VertexShader of this shader program
     ID3D11VertexShader* d_vertShader;
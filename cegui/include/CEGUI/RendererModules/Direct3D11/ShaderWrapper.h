@@ -84,8 +84,8 @@ protected:
     //! Finish the uniform variable mapping
     void finishUniformVariableMapping();
 
-    //! The D3D DeviceContext
-    ID3D11DeviceContext* d_deviceContext;
+    //! Renderer that created the wrapper, providing the context to render on
+    Direct3D11Renderer* d_owner;
     //! The D3D Device
     ID3D11Device* d_device;
 
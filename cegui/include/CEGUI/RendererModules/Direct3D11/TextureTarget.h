@@ -60,6 +60,7 @@ public:
     bool isImageryCache() const;
     // implementation of TextureTarget interface
     void clear();
+    bool isRenderScaleSupported() const { return true; }
     Texture& getTexture() const;
     void declareRenderSize(const Sizef& sz);
 
@@ -48,6 +48,8 @@ public:
     void loadRawDataContainer(const String& filename, RawDataContainer& output,
                               const String& resourceGroup);
     void unloadRawDataContainer(RawDataContainer& data);
+    //! Returns false, the Irrlicht file system is used from one thread only.
+    bool isThreadSafe() const { return false; }
 };
 
 } // End of  CEGUI namespace section
@@ -49,13 +49,23 @@ class NULL_GUIRENDERER_API NullGeometryBuffer : public GeometryBuffer
 {
 public:
     //! Constructor
-    NullGeometryBuffer(CEGUI::RefCounted<RenderMaterial> renderMaterial);
+    NullGeometryBuffer(NullRenderer& owner, CEGUI::RefCounted<RenderMaterial> renderMaterial);
     //! Destructor
     virtual ~NullGeometryBuffer();
 
     // Implementation/overrides of member functions inherited from GeometryBuffer
     void draw(std::uint32_t drawModeMask = DrawModeMaskAll) const override;
     void appendGeometry(const std::vector<float>& vertex_data);
+    void appendGeometry(const float* vertex_data, std::size_t array_size) override;
+    bool isQuadIndexingSupported() const override;
+    bool isClippingMaskSupported() const override;
+    void reset() override;
+
+protected:
+    //! Renderer the draw calls are accounted to.
+    NullRenderer& d_owner;
+    //! Whether the vertex data changed since it was last drawn, i.e. uploaded.
+    mutable bool d_dataChanged;
 };
 
 
@@ -28,6 +28,7 @@
 #define _CEGUINullRenderer_h_
 
 #include "../../Renderer.h"
+#include "../../Rectf.h"
 #include "../../Sizef.h"
 
 #include <vector>
@@ -55,8 +56,18 @@ namespace CEGUI
 class NullGeometryBuffer;
 class NullTexture;
 class NullShaderWrapper;
-
-//! CEGUI::Renderer implementation for no particular engine
+class ShaderWrapper;
+
+/*!
+\brief
+    CEGUI::Renderer implementation for no particular engine.
+
+    Nothing is drawn, but the work a renderer would submit is accounted in the
+    FrameStats of the renderer: draw calls, vertices drawn and uploaded,
+    changes of render state between draw calls and texture uploads. This
+    makes the NullRenderer suitable for measuring the CPU side of rendering
+    without a GPU.
+*/
 class NULL_GUIRENDERER_API NullRenderer : public Renderer
 {
 public:
@@ -130,6 +141,36 @@ public:
     unsigned int getMaxTextureSize() const override;
     const String& getIdentifierString() const override;
     bool isTexCoordSystemFlipped() const override;
+    bool isGeometryGenerationThreadSafe() const override;
+
+    /*!
+    \brief
+        Sets whether uploads to the graphics API are simulated.
+
+        When enabled, the vertex data of a GeometryBuffer is copied to a
+        staging buffer whenever the buffer is drawn after its data changed,
+        and so are the pixels loaded or blitted into a Texture, so that the
+        CPU cost of preparing the uploads is part of what gets measured. The
+        uploads are counted either way. Disabled by default.
+    */
+    void setUploadSimulationEnabled(bool enabled) { d_uploadSimulationEnabled = enabled; }
+
+    //! Returns whether uploads to the graphics API are simulated.
+    bool isUploadSimulationEnabled() const { return d_uploadSimulationEnabled; }
+
+    //! Returns the memory the pixels of all the textures holding data would take, in bytes.
+    std::size_t getTextureMemoryUsage() const;
+
+    /*!
+    \brief
+        Accounts a draw call of \a buffer: the vertices drawn, the changes of
+        render state since the previous draw call and, if \a upload, the
+        upload of the vertex data. Called by NullGeometryBuffer.
+    */
+    void notifyGeometryDrawn(const NullGeometryBuffer& buffer, bool upload);
+
+    //! Accounts a texture upload of \a size bytes. Called by NullTexture.
+    void notifyTextureUploaded(const void* data, std::size_t size);
 
 protected:
     //! default constructor.
@@ -145,6 +186,8 @@ protected:
     static void logTextureCreation(const String& name);
     //! helper to safely log the destruction of a named texture
     static void logTextureDestruction(const String& name);
+    //! copies data to the staging buffer if uploads are simulated.
+    void simulateUpload(const void* data, std::size_t size);
 
     //! String holding the renderer identification text.
     static String d_rendererID;
@@ -171,6 +214,22 @@ protected:
     NullShaderWrapper* d_shaderWrapperTextured;
     //! Shaderwrapper for coloured vertices
     NullShaderWrapper* d_shaderWrapperSolid;
+    //! Whether uploads are simulated by copying the data.
+    bool d_uploadSimulationEnabled;
+    //! Staging memory the simulated uploads are copied to.
+    std::vector<std::uint8_t> d_uploadBuffer;
+    //! Shader of the previous draw call, nullptr at the start of a frame.
+    const ShaderWrapper* d_lastShader;
+    //! Texture of the previous draw call.
+    const Texture* d_lastTexture;
+    //! Blend mode of the previous draw call.
+    BlendMode d_lastBlendMode;
+    //! Whether clipping was active for the previous draw call.
+    bool d_lastClippingActive;
+    //! Clipping region of the previous draw call.
+    Rectf d_lastClippingRegion;
+    //! Alpha of the previous draw call.
+    float d_lastAlpha;
 };
 
 
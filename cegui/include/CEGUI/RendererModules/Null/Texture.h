@@ -53,6 +53,9 @@ public:
     void blitFromMemory(const void* sourceData, const Rectf& area) override;
     void blitToMemory(void* targetData) override;
     bool isPixelFormatSupported(const PixelFormat fmt) const override;
+    bool releaseData() override;
+    bool isDataReleased() const override;
+    bool isOpaque() const override;
 
 protected:
     // we all need a little help from out friends ;)
@@ -63,12 +66,12 @@ protected:
     friend void NullRenderer::destroyTexture(const String&);
 
     //! standard constructor
-    NullTexture(const String& name);
+    NullTexture(NullRenderer& owner, const String& name);
     //! construct texture via an image file.
-    NullTexture(const String& name, const String& filename,
+    NullTexture(NullRenderer& owner, const String& name, const String& filename,
                 const String& resourceGroup);
     //! construct texture with a specified initial size.
-    NullTexture(const String& name, const Sizef& sz);
+    NullTexture(NullRenderer& owner, const String& name, const Sizef& sz);
 
     //! destructor.
     virtual ~NullTexture();
@@ -83,6 +86,16 @@ protected:
     glm::vec2 d_texelScaling;
     //! Name this texture was created with.
     const String d_name;
+    //! Renderer the uploads are accounted to.
+    NullRenderer& d_owner;
+    //! Format of the pixels, used to compute the memory they take.
+    PixelFormat d_pixelFormat;
+    //! Whether the data was released with releaseData.
+    bool d_dataReleased;
+    //! Whether all the pixels loaded or blitted into the texture are opaque.
+    bool d_opaque;
+
+    friend std::size_t NullRenderer::getTextureMemoryUsage() const;
 };
 
 } // End of  CEGUI namespace section
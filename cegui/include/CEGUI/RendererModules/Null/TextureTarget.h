@@ -51,6 +51,9 @@ public:
     bool isImageryCache() const override;
     // implement CEGUI::TextureTarget interface.
     void clear() override;
+    void clearArea(const Rectf& area) override;
+    bool isAreaClearSupported() const override;
+    bool isRenderScaleSupported() const override;
     Texture& getTexture() const override;
     void declareRenderSize(const Sizef& sz) override;
 
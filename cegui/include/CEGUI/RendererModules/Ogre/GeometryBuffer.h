@@ -74,10 +74,12 @@ public:
     virtual ~OgreGeometryBuffer();
 
     virtual void draw(std::uint32_t drawModeMask = DrawModeMaskAll) const override;
-    virtual void appendGeometry(const float* vertex_data,
-        std::size_t array_size) override;
+    virtual bool isBatchableWith(const GeometryBuffer& next) const override;
+    virtual void drawBatch(std::size_t bufferCount, std::size_t vertexCount,
+        std::uint32_t drawModeMask = DrawModeMaskAll) const override;
     virtual void reset() override;
     virtual int getVertexAttributeElementCount() const override;
+    virtual bool isQuadIndexingSupported() const override;
 
     void finaliseVertexAttributes(MANUALOBJECT_TYPE type);
 
@@ -95,9 +97,16 @@ protected:
 #endif //CEGUI_USE_OGRE_HLMS
 
 
-    void syncVertexData() const;
+    /*!
+    \brief
+        Copies the vertices of this buffer and of the \a bufferCount - 1
+        buffers batched with it into the shared vertex buffer of the renderer
+        and draws them with a single render operation.
+    */
+    void drawVertices(std::size_t bufferCount, std::size_t vertexCount) const;
 
-    void setVertexBuffer(size_t count) const;
+    //! Returns whether both buffers can be drawn with the same shader parameters.
+    bool hasEquivalentMaterial(const OgreGeometryBuffer& other) const;
 
     void cleanUpVertexAttributes();
 
@@ -115,19 +124,16 @@ protected:
 #ifdef CEGUI_USE_OGRE_HLMS
     //! Render operation for this buffer.
     mutable Ogre::v1::RenderOperation d_renderOp;
-
-    //! H/W buffer where the vertices are rendered from.
-    mutable Ogre::v1::HardwareVertexBufferSharedPtr d_hwBuffer;
 #else
     //! Render operation for this buffer.
     mutable Ogre::RenderOperation d_renderOp;
-
-    //! H/W buffer where the vertices are rendered from.
-    mutable Ogre::HardwareVertexBufferSharedPtr d_hwBuffer;    
 #endif //CEGUI_USE_OGRE_HLMS
 
-    //! Marks the d_hwBuffer as being out of date
-    mutable bool d_dataAppended;
+    /*!
+        The buffer that last passed isBatchableWith, which is the buffer
+        following this one in the batch being drawn by the RenderQueue.
+    */
+    mutable const OgreGeometryBuffer* d_nextInBatch;
 
     //! The old alpha value
     mutable float d_previousAlphaValue;
@@ -87,6 +87,16 @@ class HardwareVertexBuffer;
 typedef SharedPtr<HardwareVertexBuffer> HardwareVertexBufferSharedPtr;
 #endif //CEGUI_USE_OGRE_HLMS
 #endif
+#ifdef CEGUI_USE_OGRE_HLMS
+namespace v1
+{
+class IndexData;
+class VertexData;
+}
+#else
+class IndexData;
+class VertexData;
+#endif //CEGUI_USE_OGRE_HLMS
 class Matrix4;
 }
 
@@ -351,6 +361,9 @@ public:
         This is a low-level function intended for certain advanced concepts; in
         general it will not be required to call this function directly, since it
         is called automatically by the system when rendering is done.
+
+        The states are only set by the first call after beginRendering, later
+        calls within the same frame merely disable the scissor test.
     */
     void initialiseRenderStateSettings();
 #endif
@@ -379,31 +392,43 @@ public:
 #ifdef CEGUI_USE_OGRE_HLMS
     /*!
     \brief
-    Returns a vertex buffer larger than size if any exist
-
-    This function also cleans the pool and discards large buffers that
-    aren't used
+        Reserves \a vertex_count vertices in the vertex buffer shared by all
+        GeometryBuffers with vertices of \a vertex_size bytes, sets up
+        \a vertex_data to draw them and returns the locked memory to copy the
+        vertices to. unlockVertexData must be called before drawing.
     */
-    Ogre::v1::HardwareVertexBufferSharedPtr getVertexBuffer(size_t min_size);
-
-    //! \brief Puts a vertex buffer back in to the pool
-    void returnVertexBuffer(Ogre::v1::HardwareVertexBufferSharedPtr buffer);
+    void* lockVertexData(Ogre::v1::VertexData& vertex_data, size_t vertex_count,
+        size_t vertex_size);
 #else
     /*!
     \brief
-        Returns a vertex buffer larger than size if any exist
-
-        This function also cleans the pool and discards large buffers that
-        aren't used
+        Reserves \a vertex_count vertices in the vertex buffer shared by all
+        GeometryBuffers with vertices of \a vertex_size bytes, sets up
+        \a vertex_data to draw them and returns the locked memory to copy the
+        vertices to. unlockVertexData must be called before drawing.
     */
-    Ogre::HardwareVertexBufferSharedPtr getVertexBuffer(size_t min_size);
-
-    //! \brief Puts a vertex buffer back in to the pool
-    void returnVertexBuffer(Ogre::HardwareVertexBufferSharedPtr buffer);
+    void* lockVertexData(Ogre::VertexData& vertex_data, size_t vertex_count,
+        size_t vertex_size);
 #endif //CEGUI_USE_OGRE_HLMS
 
-    //! \brief Clears vertex buffer pool
-    void clearVertexBufferPool();
+    //! \brief Unlocks the vertex buffer locked by lockVertexData
+    void unlockVertexData();
+
+#ifdef CEGUI_USE_OGRE_HLMS
+    /*!
+    \brief
+        Sets up \a index_data to draw \a quad_count quads of four vertices
+        from the index buffer shared by all GeometryBuffers.
+    */
+    void setupQuadIndexData(Ogre::v1::IndexData& index_data, size_t quad_count);
+#else
+    /*!
+    \brief
+        Sets up \a index_data to draw \a quad_count quads of four vertices
+        from the index buffer shared by all GeometryBuffers.
+    */
+    void setupQuadIndexData(Ogre::IndexData& index_data, size_t quad_count);
+#endif //CEGUI_USE_OGRE_HLMS
 
     // implement CEGUI::Renderer interface
     virtual void setViewProjectionMatrix(const glm::mat4& viewProjMatrix);
@@ -483,8 +508,6 @@ protected:
     //! helper to clean up shaders
     void cleanupShaders();
 
-    //! Deletes count number of largest vertex buffers
-    void cleanLargestVertexBufferPool(size_t count);
     //! Pointer to the hidden implementation data
     OgreRenderer_impl* d_pimpl;
 };
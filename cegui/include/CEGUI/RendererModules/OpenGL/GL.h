@@ -59,6 +59,30 @@
 #define GL_RGB565  0x8D62
 #endif
 
+#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM
+#define GL_COMPRESSED_RGBA_BPTC_UNORM  0x8E8C
+#endif
+
+#ifndef GL_COMPRESSED_RGB8_ETC2
+#define GL_COMPRESSED_RGB8_ETC2  0x9274
+#endif
+
+#ifndef GL_COMPRESSED_RGBA8_ETC2_EAC
+#define GL_COMPRESSED_RGBA8_ETC2_EAC  0x9278
+#endif
+
+#ifndef GL_COMPRESSED_RGBA_ASTC_4x4_KHR
+#define GL_COMPRESSED_RGBA_ASTC_4x4_KHR  0x93B0
+#endif
+
+#ifndef GL_COMPRESSED_RGBA_ASTC_6x6_KHR
+#define GL_COMPRESSED_RGBA_ASTC_6x6_KHR  0x93B4
+#endif
+
+#ifndef GL_COMPRESSED_RGBA_ASTC_8x8_KHR
+#define GL_COMPRESSED_RGBA_ASTC_8x8_KHR  0x93B7
+#endif
+
 #if (defined( __WIN32__ ) || defined( _WIN32 )) && !defined(CEGUI_STATIC)
 #   if defined(CEGUIOPENGLRENDERER_EXPORTS) || defined(CEGUIOPENGLES2RENDERER_EXPORTS)
 #       define OPENGL_GUIRENDERER_API __declspec(dllexport)
@@ -152,6 +176,31 @@ public:
     */
     bool isS3tcSupported() const { return d_isS3tcSupported; }
 
+    /*!
+    \brief
+        Returns true if "BPTC" (BC7) texture compression is supported.
+
+        Note: Works only with Epoxy OR with desktop OpenGL >= 3.0. Otherwise
+              returns false.
+    */
+    bool isBptcSupported() const { return d_isBptcSupported; }
+
+    /*!
+    \brief
+        Returns true if "ETC2" texture compression is supported, which is
+        always the case for OpenGL ES >= 3.0 and desktop OpenGL >= 4.3.
+    */
+    bool isEtc2Supported() const { return d_isEtc2Supported; }
+
+    /*!
+    \brief
+        Returns true if "ASTC" LDR texture compression is supported.
+
+        Note: Works only with Epoxy OR with desktop OpenGL >= 3.0. Otherwise
+              returns false.
+    */
+    bool isAstcSupported() const { return d_isAstcSupported; }
+
     /*!
     \brief
         Returns true if NPOT (non-power-of-two) textures are supported.
@@ -189,6 +238,62 @@ public:
     bool isSizedInternalFormatSupported() const
       { return d_isSizedInternalFormatSupported; }
 
+    /*!
+    \brief
+        Returns true if immutable buffer storage ("glBufferStorage") is
+        supported, which allows persistently mapped buffers.
+    */
+    bool isBufferStorageSupported() const
+      { return d_isBufferStorageSupported; }
+
+    /*!
+    \brief
+        Returns true if instanced drawing with per-instance vertex attributes
+        ("glDrawArraysInstanced" and "glVertexAttribDivisor") is supported.
+    */
+    bool isInstancedArraysSupported() const
+      { return d_isInstancedArraysSupported; }
+
+    /*!
+    \brief
+        Returns true if ranges of a buffer can be mapped ("glMapBufferRange"),
+        which is always the case for OpenGL ES >= 3.0 and desktop OpenGL >= 3.0.
+    */
+    bool isMapBufferRangeSupported() const
+      { return d_isMapBufferRangeSupported; }
+
+    /*!
+    \brief
+        Returns true if fence sync objects ("glFenceSync") are supported,
+        which is always the case for OpenGL ES >= 3.0 and desktop OpenGL >= 3.2.
+    */
+    bool isFenceSyncSupported() const
+      { return d_isFenceSyncSupported; }
+
+    /*!
+    \brief
+        Returns true if 32 bit indices ("GL_UNSIGNED_INT") can be used for
+        indexed drawing.
+    */
+    bool isElementIndexUintSupported() const
+      { return d_isElementIndexUintSupported; }
+
+    /*!
+    \brief
+        Returns true if the mip levels of a texture can be generated from its
+        base level ("glGenerateMipmap").
+    */
+    bool isGenerateMipmapSupported() const
+      { return d_isGenerateMipmapSupported; }
+
+    /*!
+    \brief
+        Returns true if texture data can be uploaded from a buffer object
+        bound to "GL_PIXEL_UNPACK_BUFFER".
+    */
+    bool isPixelBufferObjectSupported() const
+      { return d_isPixelBufferObjectSupported; }
+
     /* For internal use. Used to force the object to act is if we're using a
        context of the specificed "verMajor_.verMinor_". This is useful to
        check that an OpenGL (desktop/ES) version lower than the actual one
@@ -211,12 +316,22 @@ private:
     GLint d_verMajorForce;
     GLint d_verMinorForce;
     bool d_isS3tcSupported;
+    bool d_isBptcSupported;
+    bool d_isEtc2Supported;
+    bool d_isAstcSupported;
     bool d_isNpotTextureSupported;
     bool d_isReadBufferSupported;
     bool d_isPolygonModeSupported;
     bool d_isSeperateReadAndDrawFramebufferSupported;
     bool d_isVaoSupported;
     bool d_isSizedInternalFormatSupported;
+    bool d_isBufferStorageSupported;
+    bool d_isInstancedArraysSupported;
+    bool d_isMapBufferRangeSupported;
+    bool d_isFenceSyncSupported;
+    bool d_isElementIndexUintSupported;
+    bool d_isGenerateMipmapSupported;
+    bool d_isPixelBufferObjectSupported;
 };
 
 } // namespace CEGUI
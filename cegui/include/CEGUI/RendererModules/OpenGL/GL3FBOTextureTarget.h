@@ -56,6 +56,9 @@ public:
     void deactivate() override;
     // implementation of TextureTarget interface
     void clear() override;
+    void clearArea(const Rectf& area) override;
+    bool isAreaClearSupported() const override { return true; }
+    bool isRenderScaleSupported() const override { return true; }
     void declareRenderSize(const Sizef& sz) override;
     // specialise functions from OpenGL3TextureTarget
     void grabTexture() override;
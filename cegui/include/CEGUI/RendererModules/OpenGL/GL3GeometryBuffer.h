@@ -47,21 +47,52 @@ public:
 
     // Overrides of virtual and abstract methods from GeometryBuffer
     void draw(std::uint32_t drawModeMask = DrawModeMaskAll) const override;
+    bool isBatchableWith(const GeometryBuffer& next) const override;
+    void drawBatch(std::size_t bufferCount, std::size_t vertexCount,
+                   std::uint32_t drawModeMask = DrawModeMaskAll) const override;
     void appendGeometry(const float* vertex_data, std::size_t array_size) override;
+    void appendQuadInstance(const Rectf& destRect, const Rectf& texRect,
+                            const Colour& colour) override;
+    std::size_t getQuadInstanceCount() const override;
+    bool isQuadInstancingSupported() const override;
+    bool isClippingMaskSupported() const override;
+    bool isQuadIndexingSupported() const override;
     void reset() override;
+    void copyGeometryFrom(const GeometryBuffer& source) override;
+    void copyClippedGeometryFrom(const GeometryBuffer& source, const Rectf& clip_rect) override;
 
     // Implementation/overrides of member functions inherited from OpenGLGeometryBufferBase
     void finaliseVertexAttributes() const override;
 
+    //! Returns the up to date model view projection matrix of this buffer.
+    const glm::mat4& getModelViewProjectionMatrix() const;
+
     std::size_t d_verticesVBOPosition = 0;
+    //! Entry of this buffer in the renderer's per-draw data, valid if the generations match
+    std::size_t d_perDrawEntry = 0;
+    std::uint32_t d_perDrawGeneration = 0;
 
 protected:
     void initialiseVertexBuffers();
     void deinitialiseOpenGLBuffers();
     //! Update the OpenGL buffer objects containing the vertex data.
     void updateOpenGLBuffers();
+    /*!
+    \brief
+        Sets up the OpenGL state for this buffer and draws \a vertexCount
+        vertices starting at this buffer's first vertex. \a bufferCount is the
+        number of GeometryBuffers these vertices belong to.
+    */
+    void drawVertices(std::size_t bufferCount, std::size_t vertexCount) const;
     //! Draws the vertex data depending on the fill rule that was set for this object.
-    void drawDependingOnFillRule() const;
+    void drawDependingOnFillRule(std::size_t vertexCount) const;
+    //! Returns whether the material of \a other has the same shader and parameters as ours.
+    bool hasEquivalentMaterial(const OpenGL3GeometryBuffer& other) const;
+    //! Draws the quads appended via appendQuadInstance with a single instanced draw call.
+    void drawQuadInstances() const;
+    //! Creates the vao and vbo for the quad instances and sets up their attributes.
+    void initialiseQuadInstanceBuffers() const;
+    void convertQuadInstancesToVertices() override;
 
 #ifndef CEGUI_OPENGL_BIG_BUFFER
     //! OpenGL vao used for the vertices
@@ -73,6 +104,18 @@ protected:
 #endif
     //! Pointer to the OpenGL state changer wrapper that was created inside the Renderer
     OpenGLBaseStateChangeWrapper* d_glStateChanger;
+
+    //! Number of floats stored per quad instance: rect, texture rect and colour
+    static const std::size_t QuadInstanceElementCount = 12;
+    //! Per instance data of the quads appended via appendQuadInstance
+    std::vector<float> d_quadInstanceData;
+    //! OpenGL vao and vbo used for the quad instances, created on first use
+    mutable GLuint d_quadInstanceVAO = 0;
+    mutable GLuint d_quadInstanceVBO = 0;
+    //! Size in bytes of the quad instance vbo
+    mutable std::size_t d_quadInstanceVBOSize = 0;
+    //! Whether d_quadInstanceData changed since it was last uploaded
+    mutable bool d_quadInstanceDataDirty = false;
 };
 
 }
@@ -39,6 +39,7 @@ namespace CEGUI
     class OpenGLBaseShaderWrapper;
     class OpenGLBaseShaderManager;
     class OpenGLBaseStateChangeWrapper;
+    class OpenGL3GeometryBuffer;
 
 /*!
 \brief
@@ -59,6 +60,52 @@ namespace CEGUI
 class OPENGL_GUIRENDERER_API OpenGL3Renderer : public OpenGLRendererBase
 {
 public:
+    //! Enumeration of the ways vertex data can be uploaded to the shared vertex buffers.
+    enum class VertexUploadMode : int
+    {
+        /*!
+            Grow the buffers with glBufferData and otherwise overwrite them with
+            glBufferSubData. May stall if the GPU still reads the buffer.
+        */
+        SubData,
+        //! Orphan the previous storage with glBufferData on every upload.
+        Orphaning,
+        /*!
+            Write into a triple-buffered ring of persistently mapped storage
+            guarded by fences. Requires GL_ARB_buffer_storage or OpenGL 4.4
+            and falls back to Orphaning otherwise.
+        */
+        PersistentMappedRing,
+        /*!
+            Write into the same triple-buffered ring, mapping the written range
+            with glMapBufferRange and GL_MAP_UNSYNCHRONIZED_BIT on every upload.
+            Requires map buffer range and fence syncs, as available with OpenGL
+            ES 3.0, and falls back to Orphaning otherwise. This is the default
+            mode on OpenGL ES 3.0 and later.
+        */
+        UnsynchronisedMapRange
+    };
+
+    /*!
+    \brief
+        Enumeration of the layouts in which vertices are stored in the shared
+        vertex buffers. GeometryBuffers always keep their vertices as floats,
+        the layout only affects the uploaded data.
+    */
+    enum class VertexFormat : int
+    {
+        //! All attributes as floats: 28 bytes per solid and 36 bytes per textured vertex.
+        Float,
+        //! Colour packed as normalised RGBA8: 16 bytes per solid and 24 bytes per textured vertex.
+        PackedColour,
+        /*!
+            Colour packed as normalised RGBA8 and texture coordinates as
+            normalised 16 bit integers: 16 bytes per solid and 20 bytes per
+            textured vertex. Texture coordinates are clamped to [0, 1].
+        */
+        PackedColourAndTexCoords
+    };
+
     /*!
     \brief
         Convenience function that creates the required objects to initialise the
@@ -178,6 +225,82 @@ public:
     void setupRenderingBlendMode(const BlendMode mode,
                                  const bool force = false) override;
     RefCounted<RenderMaterial> createRenderMaterial(const DefaultShaderType shaderType) const override;
+    bool isDefaultShaderTypeSupported(const DefaultShaderType shaderType) const override;
+    bool isGeometryGenerationThreadSafe() const override;
+    bool isPremultipliedAlphaSupported() const override { return true; }
+
+    /*!
+    \brief
+        Returns the number of OpenGL draw calls that were issued for
+        GeometryBuffers since the last call to beginRendering.
+    */
+    std::size_t getDrawCallCount() const { return d_drawCallCount; }
+
+    /*!
+    \brief
+        Returns the number of batches that were drawn since the last call to
+        beginRendering. A batch is either a single GeometryBuffer or a run of
+        neighbouring, compatible GeometryBuffers that were merged by the
+        RenderQueue.
+    */
+    std::size_t getBatchCount() const { return d_batchCount; }
+
+    /*!
+    \brief
+        Returns the number of GeometryBuffers that were drawn since the last
+        call to beginRendering, regardless of whether they were merged into
+        batches.
+    */
+    std::size_t getDrawnGeometryBufferCount() const { return d_drawnGeometryBufferCount; }
+
+    /*!
+    \brief
+        Sets the way vertex data is uploaded to the shared vertex buffers.
+
+    \param mode
+        The requested VertexUploadMode. VertexUploadMode::PersistentMappedRing
+        and VertexUploadMode::UnsynchronisedMapRange are replaced by
+        VertexUploadMode::Orphaning if the current context does not support
+        them.
+    */
+    void setVertexUploadMode(VertexUploadMode mode);
+
+    /*!
+    \brief
+        Returns the VertexUploadMode that is in use, which may differ from the
+        requested one if it was not supported.
+    */
+    VertexUploadMode getVertexUploadMode() const { return d_vertexUploadMode; }
+
+    //! Sets the layout in which vertices are stored in the shared vertex buffers.
+    void setVertexFormat(VertexFormat format);
+
+    //! Returns the layout in which vertices are stored in the shared vertex buffers.
+    VertexFormat getVertexFormat() const { return d_vertexFormat; }
+
+    /*!
+    \brief
+        Returns whether GeometryBuffers of this renderer store quads appended
+        via GeometryBuffer::appendQuadInstance as instances.
+    */
+    bool isQuadInstancingSupported() const { return d_shaderWrapperTexturedInstanced != nullptr; }
+
+    /*!
+    \brief
+        Sets whether the model view projection matrix and alpha of the
+        GeometryBuffers drawn with the standard shaders are written into one
+        uniform buffer per upload of a RenderingSurface, instead of being set
+        as separate uniforms for every draw. Each draw then only selects its
+        entry in that buffer.
+
+        Requires desktop OpenGL and the shared vertex buffers; the request is
+        ignored otherwise. GeometryBuffers with a RenderEffect keep using the
+        separate uniforms, since effects may change them between passes.
+    */
+    void setPerDrawDataBufferEnabled(bool enabled);
+
+    //! Returns whether per-draw data is written into a shared uniform buffer.
+    bool isPerDrawDataBufferEnabled() const { return d_perDrawDataBufferEnabled; }
 
 #ifdef CEGUI_OPENGL_BIG_BUFFER
     //! OpenGL vao used for the vertices
@@ -189,6 +312,10 @@ public:
     //! Size of the vertex data buffer that is currently in use
     GLuint d_verticesSolidVBOSize = 0;
     GLuint d_verticesTexturedVBOSize = 0;
+    //! OpenGL buffer with the indices for quads of four vertices, 0 if unsupported
+    GLuint d_quadIndexBuffer = 0;
+    //! Number of quads the index buffer contains indices for
+    std::size_t d_quadIndexBufferQuadCount = 0;
 #endif
 
 protected:
@@ -225,6 +352,12 @@ protected:
     void initialiseStandardTexturedShaderWrapper();
     //! Initialises the OpenGL ShaderWrapper for coloured objects
     void initialiseStandardColouredShaderWrapper();
+    //! Initialises the OpenGL ShaderWrapper and quad corners for instanced textured quads, if supported
+    void initialiseTexturedInstancedShaderWrapper();
+    //! Initialises the OpenGL ShaderWrapper for distance field textured objects, if supported
+    void initialiseDistanceFieldShaderWrapper();
+    //! Initialises the OpenGL ShaderWrapper for glyphs with packed layers, if supported
+    void initialiseLayeredGlyphShaderWrapper();
 
     void initialiseStandardTexturedVAO();
     void initialiseStandardColouredVAO();
@@ -238,19 +371,99 @@ protected:
     virtual ~OpenGL3Renderer();
 
 private:
+    friend class OpenGL3GeometryBuffer;
+
     //! initialise OGL3TextureTargetFactory that will generate TextureTargets
     void initialiseTextureTargetFactory();
 
     //! restores all relevant OpenGL States CEGUI touches to their default value
     void restoreChangedStatesToDefaults(bool isAfterRendering);
 
+    //! Number of segments of a PersistentVertexRing.
+    static const std::size_t RingSegmentCount = 3;
+
+    /*!
+        Vertex storage split into segments used by successive frames. The
+        storage is persistently mapped in the PersistentMappedRing mode and
+        mapped per upload in the UnsynchronisedMapRange mode.
+    */
+    struct PersistentVertexRing
+    {
+        //! Start of the persistently mapped storage of the VBO, if any
+        std::uint8_t* d_mappedData = nullptr;
+        //! Size in bytes of each segment, 0 if the ring was not created
+        std::size_t d_segmentSize = 0;
+        //! Segment written to during the current frame
+        std::size_t d_currentSegment = 0;
+        //! Offset in bytes of the next write within the current segment
+        std::size_t d_writeOffset = 0;
+        //! Fences signalled once the GPU finished reading the respective segment
+        GLsync d_fences[RingSegmentCount] = {};
+    };
+
     void addGeometry(const std::vector<GeometryBuffer*>& buffers);
-    void uploadVertexData(std::vector<float>& vertex_data, GLuint vbo_id, GLuint& vbo_max_size);
+    //! Moves the VBO positions of \a buffers by the first vertex of the uploaded data.
+    void offsetVertexPositions(const std::vector<GeometryBuffer*>& buffers,
+                               std::size_t solid_base, std::size_t textured_base);
+    /*!
+    \brief
+        Uploads \a vertex_data according to the VertexUploadMode in use.
+
+    \return
+        Index of the vertex in the VBO at which the data starts.
+    */
+    std::size_t uploadVertexData(std::vector<float>& vertex_data, bool textured);
+    //! Writes \a vertex_data into the current segment of the ring of the given layout.
+    std::size_t uploadVertexDataToRing(std::vector<float>& vertex_data, bool textured);
+    //! (Re)creates the VBO of the given layout and attaches it to its VAO.
+    void createVertexBuffer(bool textured, std::size_t ring_segment_size);
+    //! Deletes the VBO of the given layout together with its ring state.
+    void destroyVertexBuffer(bool textured);
+    //! Moves the rings to their next segment, waiting for the GPU if needed.
+    void advanceVertexRings();
+    //! Inserts fences for the segments of the rings written during this frame.
+    void fenceVertexRings();
+    //! Grows the quad index buffer to cover the indexed quads of the last upload.
+    void updateQuadIndexBuffer(std::size_t solid_base, std::size_t textured_base);
+    //! Returns the number of 4 byte words per vertex of the given layout in the VertexFormat in use.
+    std::size_t getVertexWordCount(bool textured) const;
+    //! Appends \a vertex_count float vertices to \a dest, converted to the VertexFormat in use.
+    void appendPackedVertices(std::vector<float>& dest, const float* vertex_data,
+                              std::size_t vertex_count, bool textured) const;
+    //! Starts a new upload of per-draw data, forgetting the entries of the previous one.
+    void resetPerDrawData();
+    //! Adds entries of per-draw data for the buffers of \a buffers that can use them.
+    void addPerDrawData(const std::vector<GeometryBuffer*>& buffers);
+    //! Uploads the per-draw data added since resetPerDrawData to the uniform buffer.
+    void uploadPerDrawData();
+    /*!
+    \brief
+        Returns the value of the drawSlot uniform for drawing \a buffer: -1 if
+        its shader has no such uniform, 0 if it has no current per-draw entry
+        and the 1-based slot of its entry otherwise. Binds the chunk of the
+        uniform buffer containing the entry.
+    */
+    GLint preparePerDrawSlot(const OpenGL3GeometryBuffer& buffer);
+
+    //! Number of entries in the PerDrawData uniform block of the standard shaders.
+    static const std::size_t PerDrawChunkEntryCount = 128;
+    //! Number of floats per entry: the matrix and a vector holding the alpha, in std140 layout.
+    static const std::size_t PerDrawEntryFloatCount = 20;
+    //! Uniform buffer binding point the PerDrawData block is assigned to.
+    static const GLuint PerDrawDataBindingPoint = 0;
 
     //! Wrapper of the OpenGL shader we will use for textured geometry
     OpenGLBaseShaderWrapper* d_shaderWrapperTextured = nullptr;
     //! Wrapper of the OpenGL shader we will use for solid geometry
     OpenGLBaseShaderWrapper* d_shaderWrapperSolid = nullptr;
+    //! Wrapper of the OpenGL shader we will use for instanced textured quads, null if unsupported
+    OpenGLBaseShaderWrapper* d_shaderWrapperTexturedInstanced = nullptr;
+    //! Wrapper of the OpenGL shader we will use for distance field geometry, null if unsupported
+    OpenGLBaseShaderWrapper* d_shaderWrapperDistanceField = nullptr;
+    //! Wrapper of the OpenGL shader we will use for glyphs with packed layers, null if unsupported
+    OpenGLBaseShaderWrapper* d_shaderWrapperLayeredGlyph = nullptr;
+    //! OpenGL vbo containing the corners of the two triangles of an instanced quad
+    GLuint d_quadCornerVBO = 0;
 
     //! The wrapper we use for OpenGL calls, to detect redundant state changes and prevent them
     OpenGLBaseStateChangeWrapper* d_openGLStateChanger = nullptr;
@@ -261,6 +474,43 @@ private:
 
     std::vector<float> d_vertex_data_solid;
     std::vector<float> d_vertex_data_textured;
+    //! End of the last indexed quads within the uploaded vertex data, in vertices
+    std::size_t d_indexedSolidVertexEnd = 0;
+    std::size_t d_indexedTexturedVertexEnd = 0;
+
+    //! The way vertex data is uploaded to the shared VBOs
+    VertexUploadMode d_vertexUploadMode = VertexUploadMode::SubData;
+    //! The layout of the vertices in the shared VBOs
+    VertexFormat d_vertexFormat = VertexFormat::Float;
+    //! Ring state of the solid and textured VBOs in the ring based upload modes
+    PersistentVertexRing d_solidRing;
+    PersistentVertexRing d_texturedRing;
+
+    //! Whether the standard shaders support reading per-draw data from a uniform buffer
+    bool d_perDrawDataBufferSupported = false;
+    //! Whether per-draw data is written into the uniform buffer
+    bool d_perDrawDataBufferEnabled = false;
+    //! Uniform buffer holding the per-draw data, created on first use
+    GLuint d_perDrawUBO = 0;
+    //! Size in bytes of the storage of d_perDrawUBO
+    std::size_t d_perDrawUBOSize = 0;
+    //! Distance in floats between chunks of per-draw data, honouring the offset alignment
+    std::size_t d_perDrawChunkStride = 0;
+    //! Per-draw data of the current upload, chunk by chunk
+    std::vector<float> d_perDrawData;
+    //! Number of per-draw entries of the current upload
+    std::size_t d_perDrawEntryCount = 0;
+    //! Incremented per upload, identifies GeometryBuffer entries of the current upload
+    std::uint32_t d_perDrawGeneration = 0;
+    //! Chunk of d_perDrawUBO bound to the binding point, or -1
+    std::ptrdiff_t d_boundPerDrawChunk = -1;
+
+    //! Number of OpenGL draw calls issued since beginRendering
+    std::size_t d_drawCallCount = 0;
+    //! Number of batches drawn since beginRendering
+    std::size_t d_batchCount = 0;
+    //! Number of GeometryBuffers drawn since beginRendering
+    std::size_t d_drawnGeometryBufferCount = 0;
 };
 
 }
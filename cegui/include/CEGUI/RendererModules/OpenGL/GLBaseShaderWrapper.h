@@ -67,16 +67,30 @@ public:
     GLint getUniformLocation(const std::string& uniformName) const;
 
 protected:
+    //! A uniform variable together with the value last uploaded to it.
+    struct UniformVariable
+    {
+        //! Location of the variable, or the texture unit for texture uniforms
+        GLint d_location;
+        //! Value last uploaded to the program, nullptr if none yet
+        ShaderParameter* d_lastValue;
+    };
+
+    //! Uploads \a parameter to \a variable unless it still holds that value.
+    void updateUniform(UniformVariable& variable, const ShaderParameter& parameter);
+
     //! The underlying GLSL shader that this class wraps the access to
     OpenGLBaseShader& d_shader;
-    //! A map of parameter names and the related uniform variable locations
-    std::map<std::string, GLint> d_uniformVariables;
+    /*!
+        A map of parameter names and the related uniform variables. Uniforms
+        are state of the program, so the cached values stay valid across
+        frames and across draws using other programs.
+    */
+    std::map<std::string, UniformVariable> d_uniformVariables;
     //! A map of parameter names and the related attribute variable locations
     std::map<std::string, GLint> d_attributeVariables;
     //! OpenGL state change wrapper
     OpenGLBaseStateChangeWrapper* d_glStateChangeWrapper;
-    //! Last states of the set shader parameters
-    std::map<std::string, ShaderParameter*> d_shaderParameterStates;
 };
 
 
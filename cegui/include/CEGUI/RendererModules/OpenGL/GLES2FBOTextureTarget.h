@@ -56,6 +56,7 @@ public:
     void deactivate() override;
     // implementation of TextureTarget interface
     void clear() override;
+    bool isRenderScaleSupported() const override { return true; }
     void declareRenderSize(const Sizef& sz) override;
     // specialise functions from GLES2TextureTarget
     void grabTexture() override;
@@ -56,9 +56,6 @@ protected:
 
     //! internal texture resize function (does not reset format or other fields)
     void setTextureSize_impl(const Sizef& sz) override;
-
-    GLsizei getCompressedTextureSize(const Sizef& pixel_size) const override;
-
 };
 
 } // End of  CEGUI namespace section
@@ -40,6 +40,7 @@
 
 #include <vector>
 #include <unordered_map>
+#include <cstdint>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -181,6 +182,44 @@ public:
     */
     const CEGUI::Rectf& getActiveViewPort();
 
+    /*!
+    \brief
+        Sets whether texture updates are gathered instead of being uploaded
+        when they are requested.
+
+        Gathered updates are copied into one staging buffer, which is handed
+        to OpenGL as a single pixel buffer object where supported, and are
+        uploaded together when rendering begins or geometry is drawn.
+        Updates of a texture that a later update covers are dropped, and
+        updates of consecutive rows are merged into one upload. Disabling
+        the option uploads the pending updates.
+    */
+    void setTextureUploadDeferred(bool deferred);
+
+    //! Returns whether texture updates are gathered and uploaded together.
+    bool isTextureUploadDeferred() const { return d_textureUploadDeferred; }
+
+    //! Uploads all the texture updates gathered so far.
+    void flushTextureUploads();
+
+    /*!
+    \brief
+        Gathers an update of \a area of \a texture, copying \a size bytes from
+        \a data. For use by OpenGLTexture.
+
+    \param mergeable
+        Whether the update may be merged with one of the adjacent rows, which
+        is the case for uncompressed data.
+
+    \return
+        false if updates are not deferred, the caller has to upload the data.
+    */
+    bool queueTextureUpload(OpenGLTexture& texture, const void* data,
+                            const Rectf& area, std::size_t size, bool mergeable);
+
+    //! Drops the gathered updates of \a texture. For use by OpenGLTexture.
+    void discardTextureUploads(const OpenGLTexture& texture);
+
 
 protected:
     OpenGLRendererBase();
@@ -252,6 +291,27 @@ protected:
     bool d_isStateResettingEnabled;
     //! What blend mode we think is active.
     BlendMode d_activeBlendMode;
+
+private:
+    //! A texture update waiting in the staging buffer.
+    struct PendingTextureUpload
+    {
+        OpenGLTexture* d_texture;
+        Rectf d_area;
+        //! Position of the data in the staging buffer.
+        std::size_t d_offset;
+        std::size_t d_size;
+        bool d_mergeable;
+    };
+
+    //! Whether texture updates are gathered.
+    bool d_textureUploadDeferred = false;
+    //! Texture updates in the order they were requested.
+    std::vector<PendingTextureUpload> d_pendingTextureUploads;
+    //! Data of the pending texture updates.
+    std::vector<std::uint8_t> d_textureUploadStaging;
+    //! Pixel buffer object the staging buffer is uploaded through.
+    GLuint d_textureUploadBuffer = 0;
 };
 
 /**
@@ -73,6 +73,16 @@ public:
     */
     GLint getUniformLocation(const std::string &name) const;
 
+    /*!
+    \brief
+        Assigns the uniform block \a name of the shader to the given uniform
+        buffer binding point.
+
+    \return
+        false if the shader has no active uniform block of that name.
+    */
+    bool bindUniformBlock(const std::string &name, GLuint bindingPoint);
+
     /*!
     \brief
         Defines the name of the variable inside the shader which represents the
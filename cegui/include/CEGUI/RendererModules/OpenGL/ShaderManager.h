@@ -49,6 +49,12 @@ namespace CEGUI
     {
         StandardTextured,
         StandardSolid,
+        //! Textured quads drawn through instancing, only available if supported
+        StandardTexturedInstanced,
+        //! Textured geometry with a signed distance field, not available with OpenGL ES 2
+        StandardDistanceField,
+        //! Textured glyphs with layers packed into the channels, not available with OpenGL ES 2
+        StandardLayeredGlyph,
 
         Count
     };
@@ -83,6 +83,19 @@ public:
         GLenum d_target;
         GLuint d_texture;
     };
+    //! Counters of the state changes requested through the wrapper.
+    struct Statistics
+    {
+        Statistics();
+        //! State changes that were passed on to OpenGL.
+        std::size_t d_issuedStateChanges;
+        //! Redundant state changes that were filtered out.
+        std::size_t d_filteredStateChanges;
+        //! Uniform updates that were passed on to OpenGL.
+        std::size_t d_issuedUniformUpdates;
+        //! Uniform updates that were filtered out since the value was unchanged.
+        std::size_t d_filteredUniformUpdates;
+    };
 
 
     OpenGLBaseStateChangeWrapper();
@@ -210,7 +223,24 @@ public:
     */
     int isStateEnabled(GLenum capability) const;
 
+    /*
+    \brief
+        Returns the counters of issued and filtered state changes and uniform
+        updates. The counters are kept across calls of reset, so they cover
+        whole frames, and are only cleared by resetStatistics.
+    */
+    const Statistics& getStatistics() const { return d_statistics; }
+
+    //! Clears the counters returned by getStatistics.
+    void resetStatistics();
+
+    //! Records a uniform update requested by a shader wrapper using this state changer.
+    void recordUniformUpdate(bool issued);
+
 protected:
+    //! Records a state change that was either issued or filtered out.
+    void recordStateChange(bool issued);
+
     GLuint                      d_vertexArrayObject;
     GLuint                      d_shaderProgram;
     BlendFuncSeperateParams     d_blendFuncSeperateParams;
@@ -223,6 +253,8 @@ protected:
     unsigned int                d_activeTexturePosition;
     //! List of bound textures, the position in the vector defines the active texture it is bound to
     std::vector<BoundTexture>   d_boundTextures;
+    //! Counters of issued and filtered state changes
+    Statistics                  d_statistics;
 };
 
 } // End of  CEGUI namespace section
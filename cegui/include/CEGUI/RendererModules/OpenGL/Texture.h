@@ -123,6 +123,24 @@ public:
     void blitFromMemory(const void* sourceData, const Rectf& area) override;
     void blitToMemory(void* targetData) override = 0;
     bool isPixelFormatSupported(const PixelFormat fmt) const override;
+    void setMipmapsEnabled(bool enabled) override;
+    bool isMipmapsEnabled() const override;
+    void setResidentScale(float scale) override;
+    float getResidentScale() const override;
+    bool releaseData() override;
+    bool isDataReleased() const override;
+    bool isOpaque() const override;
+
+    /*!
+    \brief
+        Uploads data to \a area of the resident base level right away. Used by
+        OpenGLRendererBase to upload the updates it gathered.
+
+    \param generate_mipmaps
+        Whether to regenerate the mip levels after the upload.
+    */
+    void uploadResidentData(const void* sourceData, const Rectf& area,
+                            bool generate_mipmaps);
 
 protected:
 
@@ -140,6 +158,16 @@ protected:
     //! initialise the internal format flags for the given CEGUI::PixelFormat.
     virtual void initInternalPixelFormatFields(const PixelFormat fmt) = 0;
 
+    /*!
+    \brief
+        Initialises the internal format fields for a GPU compressed format
+        shared by desktop OpenGL and OpenGL ES.
+
+    \return
+        true if \a fmt is one of these formats, false otherwise.
+    */
+    bool initCompressedPixelFormatFields(const PixelFormat fmt);
+
     //! internal texture resize function (does not reset format or other fields)
     virtual void setTextureSize_impl(const Sizef& sz) = 0;
 
@@ -151,6 +179,33 @@ protected:
 
     virtual GLsizei getCompressedTextureSize(const Sizef& pixel_size) const;
 
+    /*!
+    \brief
+        uploads data to the resident base level, regenerating the mip levels,
+        or hands it to the owner if texture uploads are deferred.
+    */
+    void blitResidentData(const void* sourceData, const Rectf& area);
+
+    //! set the minification filter according to whether mip levels exist.
+    void updateMinFilter();
+
+    /*!
+    \brief
+        return the number of mip levels to drop when loading data of the
+        given format, based on the resident scale.
+    */
+    GLint getDroppedLevelCount(const PixelFormat fmt) const;
+
+    //! return \a size reduced to the largest mip level kept resident.
+    Sizef getResidentSize(const Sizef& size) const;
+
+    /*!
+    \brief
+        allocate the resident base level with the given size, keeping d_size
+        at the size of the full resolution data.
+    */
+    void setResidentTextureSize(const Sizef& resident_size);
+
     //! OpenGL method to set glTexEnv which is deprecated in GL 3.2 and GLES 2.0 and above
     virtual void setTextureEnvironment();
 
@@ -174,6 +229,22 @@ protected:
     GLenum d_pixelDataType;
     //! Whether Texture format is a compressed format
     bool d_isCompressed;
+    //! The CEGUI pixel format the internal format fields were set up for.
+    PixelFormat d_pixelFormat;
+    //! Whether a mip chain is generated for loaded data.
+    bool d_mipmapsEnabled;
+    //! Whether the current contents of the texture have mip levels.
+    bool d_hasMipmaps;
+    //! Largest scale the texture is expected to be drawn at.
+    float d_residentScale;
+    //! Number of mip levels of the loaded data not resident on the GPU.
+    GLint d_droppedLevels;
+    //! Whether data loaded from memory is decoded from a file with straight alpha.
+    bool d_loadingFromFile;
+    //! Whether the data was released with releaseData.
+    bool d_dataReleased;
+    //! Whether all the pixels loaded or blitted into the texture are opaque.
+    bool d_opaque;
 };
 
 } // End of  CEGUI namespace section
@@ -284,7 +284,7 @@ public:
         Note that some surface types can never be in a 'valid' state and so
         will always return true.
     */
-    bool isInvalidated() const;
+    virtual bool isInvalidated() const;
 
     /*!
     \brief
@@ -297,6 +297,14 @@ public:
     */
     virtual bool isRenderingWindow() const;
 
+    /*!
+    \brief
+        Return whether one of the RenderingWindows attached to this surface,
+        directly or further down, was invalidated or has to regenerate its
+        geometry, e.g. for an animated RenderEffect.
+    */
+    virtual bool isRedrawRequired() const;
+
     /*!
     \brief
         Create and return a reference to a child RenderingWindow object that
@@ -361,6 +369,35 @@ public:
     const RenderTarget& getRenderTarget() const;
     RenderTarget& getRenderTarget();
 
+    /*!
+    \brief
+        Sets whether the GeometryBuffers of the rendering queues of this
+        surface may be drawn out of submission order where they do not
+        overlap, grouping buffers that share material and textures so that
+        the Renderer can batch them. See RenderQueue::setReorderingEnabled.
+
+        The setting applies to this surface only, not to the RenderingWindows
+        attached to it. It is disabled by default.
+    */
+    void setRenderQueueReorderingEnabled(bool enabled);
+
+    //! Returns whether the rendering queues of this surface may be reordered.
+    bool isRenderQueueReorderingEnabled() const { return d_reorderRenderQueues; }
+
+    /*!
+    \brief
+        Sets whether the GeometryBuffers of the rendering queues of this
+        surface that are completely hidden behind opaque geometry drawn after
+        them are skipped. See RenderQueue::setOcclusionCullingEnabled.
+
+        The setting applies to this surface only, not to the RenderingWindows
+        attached to it. It is disabled by default.
+    */
+    void setRenderQueueOcclusionCullingEnabled(bool enabled);
+
+    //! Returns whether hidden buffers of the rendering queues of this surface are skipped.
+    bool isRenderQueueOcclusionCullingEnabled() const { return d_cullOccludedBuffers; }
+
 	//! collection type for the queues
 	typedef std::map<RenderQueueID, RenderQueue> RenderQueueList;
 	RenderQueueList& getRenderQueueList()         {return d_queues;}
@@ -371,6 +408,9 @@ protected:
      */
     virtual void drawContent(std::uint32_t drawModeMask);
 
+    //! update the draw order of all rendering queues, called before uploading them.
+    void updateDrawOrders();
+
     //! draw a rendering queue, firing events before and after.
     void draw(const RenderQueue& queue, RenderQueueEventArgs& args, std::uint32_t drawModeMask);
 
@@ -390,6 +430,10 @@ protected:
     RenderTarget* d_target;
     //! holds invalidated state of target (as far as we are concerned)
     bool d_invalidated;
+    //! whether the rendering queues may be drawn out of submission order.
+    bool d_reorderRenderQueues;
+    //! whether buffers hidden behind opaque ones are left out of the rendering queues.
+    bool d_cullOccludedBuffers;
 };
 
 } // End of  CEGUI namespace section
@@ -29,6 +29,7 @@
 
 #include "CEGUI/RenderingSurface.h"
 #include "CEGUI/Rectf.h"
+#include <chrono>
 #include <glm/gtc/quaternion.hpp>
 
 #if defined(_MSC_VER)
@@ -138,6 +139,30 @@ public:
     */
     void setPivot(const glm::vec3& pivot);
 
+    /*!
+    \brief
+        Sets a transform applied on top of the position, rotation and alpha
+        when the RenderingWindow is drawn back onto its owner. The content is
+        not redrawn, which makes this cheap enough to change every frame.
+
+    \param offset
+        Offset in pixels added to the position.
+
+    \param rotation
+        Rotation applied after the rotation set via setRotation.
+
+    \param alpha
+        Alpha the quad is drawn with.
+    */
+    void setPresentationTransform(const glm::vec2& offset,
+                                  const glm::quat& rotation, float alpha);
+
+    //! Removes the transform set via setPresentationTransform.
+    void resetPresentationTransform();
+
+    //! Returns whether a transform set via setPresentationTransform is active.
+    bool hasPresentationTransform() const { return d_presentationTransformed; }
+
     /*!
     \brief
         Return the current pixel position of the RenderingWindow.  The origin is
@@ -269,6 +294,16 @@ public:
     const RenderingSurface& getOwner() const;
     RenderingSurface& getOwner();
 
+    /*!
+    \brief
+        Set the queue of the owner RenderingSurface that the RenderingWindow
+        adds its cached imagery to when drawn. Defaults to RenderQueueID::Base.
+    */
+    void setOwnerQueue(RenderQueueID queue) { d_ownerQueue = queue; }
+
+    //! Return the queue of the owner that the RenderingWindow is drawn to.
+    RenderQueueID getOwnerQueue() const { return d_ownerQueue; }
+
     /*!
     \brief
         Fill in Vector2 object \a p_out with an unprojected version of the
@@ -278,15 +313,97 @@ public:
 
     Rectf getTextureRect() const;
 
+    /*!
+    \brief
+        Invalidates only \a area of the cached imagery, so that the next draw
+        clears and redraws just the damaged areas instead of the whole surface.
+
+        Falls back to invalidate() when the TextureTarget can not clear parts
+        of itself, or when the damage covers more than the partial redraw
+        threshold of the surface.
+
+    \param area
+        The damaged area, in pixels relative to the top left corner of the
+        RenderingWindow.
+    */
+    void invalidateArea(const Rectf& area);
+
+    //! Returns the areas that will be redrawn, empty if the whole surface is.
+    const std::vector<Rectf>& getDamagedAreas() const { return d_damagedAreas; }
+
+    /*!
+    \brief
+        Sets the fraction of the surface that damaged areas may cover before
+        invalidateArea falls back to a full redraw. 0 disables partial redraws.
+        The default is 0.5.
+    */
+    void setPartialRedrawThreshold(float threshold) { d_partialRedrawThreshold = threshold; }
+
+    //! Returns the fraction of the surface above which damage causes a full redraw.
+    float getPartialRedrawThreshold() const { return d_partialRedrawThreshold; }
+
+    //! Maximum number of separate damaged areas; more are merged into one.
+    static const std::size_t MaxDamagedAreas = 4;
+
+    /*!
+    \brief
+        Sets the resolution the content is rendered at, relative to the size of
+        the RenderingWindow. With 0.5 the content is rendered into a quarter of
+        the pixels and stretched, with bilinear filtering, when drawn back onto
+        the owner. Scales are ignored when the TextureTarget does not support
+        them. The default is 1.
+    \exception InvalidRequestException
+        thrown if \a scale is not positive.
+    */
+    void setResolutionScale(float scale);
+    //! Returns the resolution the content is rendered at, relative to the size.
+    float getResolutionScale() const { return d_resolutionScale; }
+
+    /*!
+    \brief
+        Sets the maximum rate, in Hz, at which the content is redrawn.
+        Invalidations arriving sooner than 1 / \a rate seconds after the last
+        redraw are coalesced into one redraw once that time has passed, and the
+        previous imagery is drawn back until then. 0, the default, redraws the
+        content whenever it is invalidated.
+    */
+    void setMaximumRefreshRate(float rate);
+    //! Returns the maximum rate, in Hz, at which the content is redrawn; 0 for no limit.
+    float getMaximumRefreshRate() const { return d_maximumRefreshRate; }
+    //! Returns whether a redraw of the content would now be held back by the maximum refresh rate.
+    bool isRefreshDeferred() const;
+
     // overrides from base
     void draw(std::uint32_t drawModeMask = DrawModeMaskAll) override;
     void invalidate() override;
+    bool isInvalidated() const override;
     bool isRenderingWindow() const override;
+    bool isRedrawRequired() const override;
 
 protected:
     //! default generates geometry to draw window as a single quad.
     virtual void realiseGeometry_impl();
 
+    //! Clears and redraws the queued geometry within each damaged area.
+    void drawDamagedAreas(std::uint32_t drawModeMask);
+
+    //! Adds \a area to the damaged areas, merging it with overlapping ones.
+    void addDamagedArea(const Rectf& area);
+
+    /*!
+    \brief
+        Invalidates \a area, relative to this RenderingWindow, of the owner.
+        Owners that are not RenderingWindows, or cases where the area can not be
+        mapped because of rotation or a RenderEffect, are invalidated fully.
+    */
+    void invalidateOwnerArea(const Rectf& area);
+
+    //! Invalidates the area of the owner the quad currently covers.
+    void invalidatePresentedArea();
+
+    //! Declares the size of the content, at the resolution scale, to the TextureTarget.
+    void declareTargetSize();
+
     //! set a new owner for this RenderingWindow object
     void setOwner(RenderingSurface& owner);
     // friend is so that RenderingSurface can call setOwner to xfer ownership.
@@ -298,6 +415,8 @@ protected:
     TextureTarget& d_textarget;
     //! RenderingSurface that owns this object, we render back to this object.
     RenderingSurface* d_owner;
+    //! Queue of d_owner our geometry is added to.
+    RenderQueueID d_ownerQueue;
     //! The geometry buffers that cache the geometry drawn by this Window.
     GeometryBuffer& d_geometryBuffer;
     //! indicates whether data in GeometryBuffer is up-to-date
@@ -310,6 +429,26 @@ protected:
     glm::quat d_rotation;
     //! Pivot point used for the rotation.
     glm::vec3 d_pivot;
+    //! Areas to redraw on the next draw; empty while invalidated means everything.
+    std::vector<Rectf> d_damagedAreas;
+    //! Fraction of the surface the damaged areas may cover before a full redraw.
+    float d_partialRedrawThreshold;
+    //! Offset of the presentation transform.
+    glm::vec2 d_presentationOffset;
+    //! Rotation of the presentation transform.
+    glm::quat d_presentationRotation;
+    //! Alpha of the presentation transform.
+    float d_presentationAlpha;
+    //! Whether a presentation transform is active.
+    bool d_presentationTransformed;
+    //! Resolution of the content relative to the size.
+    float d_resolutionScale;
+    //! Maximum rate the content is redrawn at, 0 for no limit.
+    float d_maximumRefreshRate;
+    //! When the content was last redrawn, only tracked with a maximum refresh rate.
+    std::chrono::steady_clock::time_point d_lastRefresh;
+    //! Whether the current invalidation was held back by the maximum refresh rate.
+    bool d_refreshDeferred;
 };
 
 } // End of  CEGUI namespace section
@@ -0,0 +1,153 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIResourceBundleWriter_h_
+#define _CEGUIResourceBundleWriter_h_
+
+#include "CEGUI/BundleResourceProvider.h"
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class PreparsedXML;
+
+/*!
+\brief
+    Collects a scheme and the files it depends on and writes them as a
+    resource bundle, which a BundleResourceProvider serves from a single
+    mapped file.
+
+    The files are loaded with the ResourceProvider of the System. XML files
+    are recorded with the XMLParser of the System, which validates them
+    against their schema, so that loading them from the bundle only replays
+    the recording. All other files are stored as they are. Each file is
+    added once, whatever refers to it.
+*/
+class CEGUIEXPORT ResourceBundleWriter
+{
+public:
+    ResourceBundleWriter();
+
+    /*!
+    \brief
+        Adds the scheme \a filename and the files it refers to: its
+        imagesets and their image files, the image files of its images, its
+        fonts and the font files or imagesets they use, and its looknfeels.
+        The scheme is the one SchemeManager::createFromBundle creates,
+        replacing a scheme added before.
+
+    \param resourceGroup
+        Resource group of the scheme, Scheme::getDefaultResourceGroup() if
+        empty.
+
+    \exception
+        Any exception thrown while loading or parsing one of the files.
+    */
+    void addScheme(const String& filename, const String& resourceGroup = "");
+
+    //! Adds the imageset \a filename and its image file.
+    void addImageset(const String& filename, const String& resourceGroup = "");
+
+    //! Adds the font file \a filename and the font files or imagesets of its fonts.
+    void addFont(const String& filename, const String& resourceGroup = "");
+
+    //! Adds the looknfeel file \a filename.
+    void addLookNFeel(const String& filename, const String& resourceGroup = "");
+
+    //! Adds the layout \a filename.
+    void addLayout(const String& filename, const String& resourceGroup = "");
+
+    /*!
+    \brief
+        Adds the XML file \a filename as a recording, validated against
+        \a schemaName, for example an animation file.
+    */
+    void addXMLFile(const String& filename, const String& resourceGroup,
+                    const String& schemaName);
+
+    //! Adds the file \a filename as it is.
+    void addFile(const String& filename, const String& resourceGroup);
+
+    //! Returns whether \a filename of \a resourceGroup was added.
+    bool contains(const String& filename, const String& resourceGroup) const;
+
+    //! Returns the number of files added.
+    size_t getFileCount() const { return d_files.size(); }
+
+    //! Writes the bundle to \a out_stream.
+    void write(OutStream& out_stream) const;
+
+    //! Removes all files and the scheme.
+    void clear();
+
+private:
+    //! A file to be written to the bundle.
+    struct File
+    {
+        String d_resourceGroup;
+        String d_filename;
+        BundleResourceProvider::EntryType d_type;
+        std::string d_data;
+    };
+
+    //! Returns the key of \a filename of \a resourceGroup in d_keys.
+    static String makeKey(const String& filename, const String& resourceGroup);
+
+    /*!
+    \brief
+        Records the XML file \a filename into \a recording and adds it.
+    \return
+        false if the file was added before, \a recording is empty then.
+    */
+    bool addRecording(const String& filename, const String& resourceGroup,
+                      const String& schemaName, PreparsedXML& recording);
+
+    //! The files in the order they were added.
+    std::vector<File> d_files;
+    //! Keys of the files added.
+    std::unordered_set<String> d_keys;
+    //! Filename of the scheme, empty if there is none.
+    String d_schemeFilename;
+    //! Resource group of the scheme.
+    String d_schemeResourceGroup;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIResourceBundleWriter_h_
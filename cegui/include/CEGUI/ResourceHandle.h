@@ -0,0 +1,135 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIResourceHandle_h_
+#define _CEGUIResourceHandle_h_
+
+#include "CEGUI/String.h"
+#include <cstdint>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class Font;
+class FontManager;
+class Image;
+class ImageManager;
+
+/*!
+\brief
+    Reference to a resource by name which keeps the result of looking the name
+    up in its manager.
+
+    The lookup is only repeated after the manager reported a new generation,
+    i.e. after any resource of its type was created or destroyed, so
+    resolving the handle over and over again does not hash the name.
+
+\tparam T
+    The type of the resource.
+
+\tparam Manager
+    The Singleton manager of the resources, providing getGeneration(),
+    isDefined(const String&) and get(const String&).
+*/
+template <typename T, typename Manager>
+class ResourceHandle
+{
+public:
+    ResourceHandle() :
+        d_resource(nullptr),
+        d_generation(0)
+    {}
+
+    explicit ResourceHandle(const String& name) :
+        d_name(name),
+        d_resource(nullptr),
+        d_generation(0)
+    {}
+
+    //! Returns the name of the resource referred to.
+    const String& getName() const
+    {
+        return d_name;
+    }
+
+    //! Sets the name of the resource referred to.
+    void setName(const String& name)
+    {
+        d_name = name;
+        d_generation = 0;
+    }
+
+    /*!
+    \brief
+        Returns the resource referred to, or nullptr if the name is empty or no
+        such resource exists.
+    */
+    T* get() const
+    {
+        const std::uint32_t generation = Manager::getSingleton().getGeneration();
+        if (d_generation != generation)
+        {
+            const Manager& manager = Manager::getSingleton();
+            d_resource = (!d_name.empty() && manager.isDefined(d_name)) ?
+                &manager.get(d_name) : nullptr;
+            d_generation = generation;
+        }
+
+        return d_resource;
+    }
+
+    /*!
+    \brief
+        Refers the handle to \a name, unless it already does, and returns the
+        resource. Only compares the names when the name stays the same, which
+        suits names taken from properties of different windows.
+    */
+    T* get(const String& name) const
+    {
+        if (name != d_name)
+        {
+            d_name = name;
+            d_generation = 0;
+        }
+
+        return get();
+    }
+
+private:
+    mutable String d_name;
+    mutable T* d_resource;
+    //! Generation of the manager d_resource was looked up in, 0 if never.
+    mutable std::uint32_t d_generation;
+};
+
+//! Handle of an Image managed by the ImageManager.
+typedef ResourceHandle<Image, ImageManager> ImageHandle;
+//! Handle of a Font managed by the FontManager.
+typedef ResourceHandle<Font, FontManager> FontHandle;
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIResourceHandle_h_
@@ -30,10 +30,22 @@
 #define _CEGUIResourceProvider_h_
 
 #include "CEGUI/String.h"
+#include "CEGUI/TaskScheduler.h"
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <vector>
 
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
 namespace CEGUI
 {
+class PreparsedXML;
 class RawDataContainer;
 
 /*!
@@ -46,7 +58,23 @@ class CEGUIEXPORT ResourceProvider
 {
 public:
 
-    virtual ~ResourceProvider() = default;
+    /*!
+    \brief
+        Function called with the data of an asynchronous load, or with the
+        exception that prevented loading it. The data is unloaded once the
+        function returns.
+    */
+    typedef std::function<void(RawDataContainer& data, std::exception_ptr error)> LoadCallback;
+
+    /*!
+    \brief
+        Function receiving the data of a resource read by readRawDataChunks,
+        one chunk after the other. The data is only valid during the call.
+    */
+    typedef std::function<void(const std::uint8_t* data, size_t size)> ReadChunkCallback;
+
+    //! Cancels the pending asynchronous loads, see cancelPendingLoads.
+    virtual ~ResourceProvider();
 
     /*************************************************************************
         Accessor functions
@@ -92,6 +120,29 @@ public:
     */
     virtual void unloadRawDataContainer(RawDataContainer&)  { }
 
+    /*!
+    \brief
+        Reads raw binary data and passes it to \a callback in consecutive
+        chunks, so that it can be processed while the rest is still being read
+        and without holding all of it in memory.
+
+        The default implementation loads the data via loadRawDataContainer and
+        passes it as a single chunk. An exception thrown by \a callback stops
+        the reading and is passed on.
+
+    \param filename
+        String containing a filename of the resource to be read.
+
+    \param callback
+        Function called with each chunk of the data, in order.
+
+    \param resourceGroup
+        Optional String that may be used by implementations to identify the group from
+        which the resource should be loaded.
+    */
+    virtual void readRawDataChunks(const String& filename, const ReadChunkCallback& callback,
+                                   const String& resourceGroup);
+
     /*!
     \brief
         Return the current default resource group identifier.
@@ -119,8 +170,127 @@ public:
     virtual size_t getResourceGroupFileNames(std::vector<String>& out_vec,
                                              const String& file_pattern,
                                              const String& resource_group) = 0;
+
+    /*!
+    \brief
+        Return whether the resource \a filename can be loaded from
+        \a resourceGroup, without the exception loadRawDataContainer throws
+        for missing resources.
+
+        The default implementation looks for \a filename among the names
+        returned by getResourceGroupFileNames(), so it only finds resources
+        placed directly in the location of the group.
+    */
+    virtual bool isResourceAvailable(const String& filename, const String& resourceGroup)
+    {
+        std::vector<String> names;
+        return getResourceGroupFileNames(names, filename, resourceGroup) != 0;
+    }
+
+    /*!
+    \brief
+        Return a value that changes whenever the resource \a filename in
+        \a resourceGroup is modified, such as its modification time, or 0 if
+        this can not be told. Used by HotReloader to find the changed files.
+
+        The default implementation returns 0.
+    */
+    virtual std::uint64_t getResourceVersion(const String& /*filename*/,
+                                             const String& /*resourceGroup*/)
+    {
+        return 0;
+    }
+
+    /*!
+    \brief
+        Loads the XML file \a filename as a recording of the events parsing
+        it produces, if the provider holds it in that form.
+        XMLParser::parseXMLFile replays such recordings instead of parsing
+        the file. The default implementation returns false.
+    \return
+        - true if \a output holds the recording of the file.
+        - false if the file has to be loaded with loadRawDataContainer and
+          parsed.
+    */
+    virtual bool loadPreparsedXML(const String& /*filename*/, PreparsedXML& /*output*/,
+                                  const String& /*resourceGroup*/)
+    {
+        return false;
+    }
+
+    /*!
+    \brief
+        Loads raw binary data without blocking the calling thread.
+
+        If isThreadSafe returns true, loadRawDataContainer is called on the
+        TaskScheduler of the System, otherwise it is called right away.
+        Either way \a callback is only called from dispatchCompletedLoads, on
+        the thread calling it, so it may create textures, fonts and windows.
+
+    \param filename
+        String containing a filename of the resource to be loaded.
+
+    \param resourceGroup
+        Resource group identifier passed to loadRawDataContainer.
+
+    \param callback
+        Function called with the data once it is loaded.
+    */
+    void loadRawDataContainerAsync(const String& filename, const String& resourceGroup,
+                                   LoadCallback callback);
+
+    /*!
+    \brief
+        Return whether loadRawDataContainer may be called from several threads
+        at once, which lets loadRawDataContainerAsync load on other threads.
+        False by default.
+    */
+    virtual bool isThreadSafe() const { return false; }
+
+    /*!
+    \brief
+        Calls the callbacks of the asynchronous loads that have finished.
+
+        Called by System::injectTimePulse. An exception thrown by a callback
+        is passed on; the loads not dispatched yet are kept for the next call.
+    */
+    void dispatchCompletedLoads();
+
+    /*!
+    \brief
+        Waits until all asynchronous loads have finished and calls their
+        callbacks, for example at the end of a loading screen.
+    */
+    void waitForPendingLoads();
+
+    //! Returns the number of asynchronous loads whose callback was not called yet.
+    size_t getPendingLoadCount() const;
+
+    /*!
+    \brief
+        Waits until the running asynchronous loads have finished and drops
+        all pending loads without calling their callbacks.
+
+        Implementations must call this from their destructor if they return
+        true from isThreadSafe, as loads may still be running in them. The
+        TaskScheduler of the System must not be replaced while loads run.
+    */
+    void cancelPendingLoads();
+
 protected:
     String  d_defaultResourceGroup;     //!< Default resource group identifier.
+
+private:
+    //! State of a call to loadRawDataContainerAsync.
+    struct AsyncLoad;
+
+    //! Waits for the task of \a load unless it was waited for already.
+    static void waitForTask(AsyncLoad& load);
+
+    //! Asynchronous loads whose callbacks were not called yet, oldest first.
+    std::vector<std::shared_ptr<AsyncLoad>> d_asyncLoads;
+    //! Guards d_asyncLoads and the finished flags of the loads.
+    mutable std::mutex d_asyncLoadMutex;
 };
 
 } // End of  CEGUI namespace section
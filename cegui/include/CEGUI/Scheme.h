@@ -80,6 +80,13 @@ public:
 	\brief
 		Loads all resources for this scheme.
 
+		The resources are loaded in the order of their dependencies: the
+		imagesets first, then the fonts that may use their images, the
+		LookNFeels, the window renderer and window factories and finally the
+		aliases and mappings referring to them. The image files of all
+		imagesets are loaded in one texture load batch, so they are decoded in
+		parallel when the ImageCodec allows it.
+
 	\return
 		Nothing.
 	*/
@@ -31,6 +31,7 @@
 #include "CEGUI/XmlResourceExistsAction.h"
 #include "CEGUI/ResourceEventSet.h"
 #include <unordered_map>
+#include <functional>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -58,6 +59,8 @@ public:
 
     //! type of collection used to store and manage instances
     typedef std::unordered_map<String, Scheme*> SchemeRegistry;
+    //! Function called with the Scheme created by createFromFileAsync.
+    typedef std::function<void(Scheme* scheme)> SchemeCreatedCallback;
 
     /*!
     \brief
@@ -104,6 +107,63 @@ public:
     Scheme& createFromFile(const String& xml_filename, const String& resource_group = "",
         XmlResourceExistsAction resourceExistsAction = XmlResourceExistsAction::Return);
 
+    /*!
+    \brief
+        Mounts the resource bundle \a bundle_filename and creates the Scheme
+        it was made for, as written by ResourceBundleWriter::addScheme.
+        The scheme and the files it refers to are then served from the
+        bundle, which stays mounted.
+
+    \param bundle_filename
+        String holding the filename of the bundle.
+
+    \param resource_group
+        String holding the name of the resource group identifier to be used
+        when loading the bundle.
+
+    \param resourceExistsAction
+        One of the XmlResourceExistsAction enumerated values indicating what
+        action should be taken when a Scheme with the specified name
+        already exists within the collection.
+
+    \exception InvalidRequestException
+        thrown if the ResourceProvider of the System is not a
+        BundleResourceProvider or the bundle holds no scheme.
+    */
+    Scheme& createFromBundle(const String& bundle_filename, const String& resource_group = "",
+        XmlResourceExistsAction resourceExistsAction = XmlResourceExistsAction::Return);
+
+    /*!
+    \brief
+        Creates a new Scheme instance from an XML file without waiting for
+        the file to be read.
+
+        The file is loaded by ResourceProvider::loadRawDataContainerAsync.
+        The Scheme is created, and \a callback is called, from
+        System::injectTimePulse once the file was read. The resources the
+        Scheme refers to are then loaded synchronously. If the Scheme can not
+        be created the error is logged and \a callback receives nullptr.
+
+    \param xml_filename
+        String holding the filename of the XML file to be used when creating the
+        new Scheme instance.
+
+    \param resource_group
+        String holding the name of the resource group identifier to be used
+        when loading the XML file described by \a xml_filename.
+
+    \param callback
+        Function called with the created Scheme, may be empty.
+
+    \param resourceExistsAction
+        One of the XmlResourceExistsAction enumerated values indicating what
+        action should be taken when a Scheme with the specified name
+        already exists within the collection.
+    */
+    void createFromFileAsync(const String& xml_filename, const String& resource_group,
+        SchemeCreatedCallback callback,
+        XmlResourceExistsAction resourceExistsAction = XmlResourceExistsAction::Return);
+
     /*!
     \brief
         Creates a new Scheme instance from a string and adds it to the collection.
@@ -84,6 +84,17 @@ public:
     */
     static void pushNamedFunction(lua_State* L, const String& name);
 
+    /*!
+    \brief
+        Pushes \a args on top of the Lua stack for passing to an event handler.
+
+        Arguments of the common EventArgs based classes, such as
+        WindowEventArgs, CursorInputEventArgs or TextEventArgs, are pushed as
+        their own type when the bindings know it, so handlers can use their
+        members without casting first. All others are pushed as EventArgs.
+    */
+    static void pushEventArgs(lua_State* L, const EventArgs& args);
+
 private:
     /*!
     \brief
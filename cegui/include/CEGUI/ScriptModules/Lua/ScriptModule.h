@@ -45,6 +45,7 @@
 
 
 #include "CEGUI/ScriptModule.h"
+#include <unordered_map>
 
 struct lua_State;
 
@@ -585,6 +586,18 @@ public:
     */
     int getActivePCallErrorHandlerReference() const;
 
+    /*!
+    \brief
+        Releases the functions cached for the scripted event handlers.
+
+        executeScriptedEventHandler resolves a handler name to the Lua
+        function only once and keeps a registry reference to it. The cache is
+        cleared whenever the module executes a script file, a string or a
+        global function, since those may define the handlers anew; call this
+        after replacing a handler function in any other way.
+    */
+    void clearEventHandlerCache();
+
 private:
     /*************************************************************************
         Implementation Functions
@@ -647,6 +660,9 @@ private:
     //! Implementation function that executes script contained in a String.
     void executeString_impl(const String& str, const int err_idx, const int top);
 
+    //! Pushes the named event handler function, resolving it on first use.
+    void pushEventHandler(const String& handler_name);
+
     /*************************************************************************
         Implementation Data
     *************************************************************************/
@@ -666,6 +682,8 @@ private:
         call to initErrorHandlerFunc)
     */
     int d_activeErrFuncIndex;
+    //! Registry references of the event handler functions, by handler name.
+    std::unordered_map<String, int> d_eventHandlerRefs;
 };
 
 } // namespace CEGUI
@@ -275,6 +275,19 @@ public:
     void setParameter(const std::string& parameter_name, 
         const float fvalue);
 
+    /*!
+    \brief
+        Adds an integer shader parameter to the parameter bindings
+
+    \param parameter_name
+        The name of the parameter as used by the shader
+
+    \param ivalue
+        The value of the integer parameter
+    */
+    void setParameter(const std::string& parameter_name, 
+        const int ivalue);
+
     /*!
     \brief
         Returns a pointer to the shader_parameter with the specified parameter name
@@ -0,0 +1,110 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISharedMutex_h_
+#define _CEGUISharedMutex_h_
+
+#include "CEGUI/Base.h"
+#include <condition_variable>
+#include <mutex>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251) // STL classes in API
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Reader-writer lock protecting the registries of the managers.
+
+    Any number of threads may hold the lock shared, while an exclusive owner
+    excludes all other threads. Readers are preferred: a thread may take the
+    lock shared again while it already holds it shared, as happens when a
+    lookup of one manager ends up in another lookup of the same manager, and
+    a waiting writer never blocks such a reader. Registries are modified
+    rarely, so writers starving is not a concern.
+
+    The exclusive side has the names of std::mutex, so std::lock_guard and
+    std::unique_lock can be used with it; SharedLock takes it shared.
+*/
+class CEGUIEXPORT SharedMutex
+{
+public:
+    SharedMutex();
+
+    SharedMutex(const SharedMutex&) = delete;
+    SharedMutex& operator=(const SharedMutex&) = delete;
+
+    //! Takes the lock exclusively, blocking while any thread holds it.
+    void lock();
+    //! Releases the lock taken with lock().
+    void unlock();
+    //! Takes the lock shared, blocking only while a thread holds it exclusively.
+    void lock_shared();
+    //! Releases the lock taken with lock_shared().
+    void unlock_shared();
+
+private:
+    std::mutex d_mutex;
+    std::condition_variable d_released;
+    //! Number of threads holding the lock shared, counting nested locks.
+    unsigned int d_readers;
+    //! Whether a thread holds the lock exclusively.
+    bool d_writer;
+};
+
+//! Holds a SharedMutex shared for the lifetime of the object.
+class SharedLock
+{
+public:
+    explicit SharedLock(SharedMutex& mutex) :
+        d_mutex(mutex)
+    {
+        d_mutex.lock_shared();
+    }
+
+    ~SharedLock()
+    {
+        d_mutex.unlock_shared();
+    }
+
+    SharedLock(const SharedLock&) = delete;
+    SharedLock& operator=(const SharedLock&) = delete;
+
+private:
+    SharedMutex& d_mutex;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISharedMutex_h_
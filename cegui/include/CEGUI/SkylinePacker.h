@@ -0,0 +1,117 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISkylinePacker_h_
+#define _CEGUISkylinePacker_h_
+
+#include "CEGUI/Base.h"
+#include <glm/glm.hpp>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251) // STL classes in API
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Packs rectangles into a square area using the skyline bottom-left
+    heuristic.
+
+    The packer only tracks the top edge of the packed rectangles, so it is
+    cheap and well suited to rectangles added one at a time, such as glyphs
+    and images loaded on demand. Space is never reclaimed; the whole area is
+    reset at once.
+*/
+class CEGUIEXPORT SkylinePacker
+{
+public:
+    //! Creates a packer for an empty square area of \a size pixels.
+    explicit SkylinePacker(int size = 0);
+
+    //! Empties the area and sets its size.
+    void reset(int size);
+
+    /*!
+    \brief
+        Enlarges the area to \a size pixels, keeping the rectangles packed so
+        far where they are.
+    */
+    void grow(int size);
+
+    //! Returns the size of the square area in pixels.
+    int getSize() const { return d_size; }
+
+    /*!
+    \brief
+        Finds the bottom-left position for a rectangle of the given size,
+        preferring the lowest resulting top edge.
+
+    \return
+        The index of the skyline node the rectangle starts at, to be passed to
+        addRectangle(), or -1 if the rectangle fits nowhere.
+    */
+    int findPosition(int width, int height, glm::ivec2& position) const;
+
+    //! Raises the skyline over a rectangle placed at a position found by findPosition().
+    void addRectangle(int nodeIndex, const glm::ivec2& position, int width, int height);
+
+    /*!
+    \brief
+        Finds a position for a rectangle and adds it there.
+
+    \return
+        true if the rectangle was packed at \a position, false if it does not
+        fit.
+    */
+    bool pack(int width, int height, glm::ivec2& position);
+
+private:
+    //! One segment of the skyline: the top of the packed area over [x, x + width).
+    struct Node
+    {
+        int d_x;
+        int d_y;
+        int d_width;
+    };
+
+    //! Returns the y position for a rectangle starting at a skyline node, or -1.
+    int fitAtNode(size_t nodeIndex, int width, int height) const;
+
+    int d_size;
+    std::vector<Node> d_skyline;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISkylinePacker_h_
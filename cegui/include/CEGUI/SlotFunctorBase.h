@@ -27,6 +27,8 @@
 #ifndef _CEGUISlotFunctorBase_h_
 #define _CEGUISlotFunctorBase_h_
 
+#include "CEGUI/SmallObjectPool.h"
+
 // Start of CEGUI namespace section
 namespace CEGUI
 {
@@ -40,7 +42,8 @@ namespace CEGUI
     The type of the argument this functor takes
 */
 template<typename TArg>
-class SlotFunctorBase
+class SlotFunctorBase :
+    public PoolAllocatedObject<MemoryCategory::Event>
 {
 public:
     virtual ~SlotFunctorBase() {}
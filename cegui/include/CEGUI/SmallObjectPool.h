@@ -0,0 +1,151 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISmallObjectPool_h_
+#define _CEGUISmallObjectPool_h_
+
+#include "CEGUI/MemoryAllocator.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Recycles small fixed-size memory blocks of the objects CEGUI creates in
+    large numbers, such as event connections and their subscriber functors.
+
+    Sizes up to MaxBlockSize are rounded up to a multiple of BlockGranularity
+    and served from a free list of that size, shared by all threads. Freed
+    blocks are kept on their list, up to MaxCachedBlocks per size, instead of
+    being returned to the MemoryAllocator. Larger sizes are passed through to
+    the MemoryAllocator directly.
+
+    Cached blocks remain accounted to their MemoryCategory until
+    releaseCachedBlocks is called.
+*/
+class CEGUIEXPORT SmallObjectPool
+{
+public:
+    //! Sizes are rounded up to multiples of this.
+    static const std::size_t BlockGranularity = 16;
+    //! Largest size served from the pool.
+    static const std::size_t MaxBlockSize = 128;
+    //! Largest number of free blocks kept per size and category.
+    static const std::size_t MaxCachedBlocks = 256;
+
+    //! Returns a block of at least \a size bytes accounted to \a category.
+    static void* allocate(std::size_t size, MemoryCategory category);
+
+    //! Returns a block obtained from allocate with the same size and category.
+    static void deallocate(void* memory, std::size_t size, MemoryCategory category);
+
+    //! Returns all cached free blocks to the MemoryAllocator.
+    static void releaseCachedBlocks();
+
+    //! Returns the number of free blocks currently cached for \a category.
+    static std::size_t getCachedBlockCount(MemoryCategory category);
+};
+
+/*!
+\brief
+    Base class allocating derived objects from the SmallObjectPool, accounted
+    to \a Category.
+*/
+template<MemoryCategory Category>
+class PoolAllocatedObject
+{
+public:
+    static void* operator new(std::size_t size)
+    {
+        return SmallObjectPool::allocate(size, Category);
+    }
+
+    static void operator delete(void* memory, std::size_t size)
+    {
+        SmallObjectPool::deallocate(memory, size, Category);
+    }
+
+    // placement forms, hidden by the ones above otherwise
+    static void* operator new(std::size_t, void* place) { return place; }
+    static void operator delete(void*, void*) {}
+
+protected:
+    PoolAllocatedObject() {}
+    ~PoolAllocatedObject() {}
+};
+
+/*!
+\brief
+    Standard library allocator taking its memory from the SmallObjectPool,
+    accounted to \a Category. Intended for std::allocate_shared and node
+    based containers, which allocate one object at a time.
+*/
+template<typename T, MemoryCategory Category>
+class PoolAllocatorAdapter
+{
+public:
+    typedef T value_type;
+
+    template<typename U>
+    struct rebind
+    {
+        typedef PoolAllocatorAdapter<U, Category> other;
+    };
+
+    PoolAllocatorAdapter() {}
+
+    template<typename U>
+    PoolAllocatorAdapter(const PoolAllocatorAdapter<U, Category>&) {}
+
+    T* allocate(std::size_t count)
+    {
+        if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            throw std::bad_alloc();
+
+        return static_cast<T*>(SmallObjectPool::allocate(count * sizeof(T), Category));
+    }
+
+    void deallocate(T* memory, std::size_t count)
+    {
+        SmallObjectPool::deallocate(memory, count * sizeof(T), Category);
+    }
+};
+
+template<typename T, typename U, MemoryCategory Category>
+bool operator==(const PoolAllocatorAdapter<T, Category>&, const PoolAllocatorAdapter<U, Category>&)
+{
+    return true;
+}
+
+template<typename T, typename U, MemoryCategory Category>
+bool operator!=(const PoolAllocatorAdapter<T, Category>&, const PoolAllocatorAdapter<U, Category>&)
+{
+    return false;
+}
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUISmallObjectPool_h_
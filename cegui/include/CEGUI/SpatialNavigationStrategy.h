@@ -0,0 +1,175 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISpatialNavigationStrategy_h_
+#define _CEGUISpatialNavigationStrategy_h_
+
+#include "CEGUI/WindowNavigator.h"
+#include "CEGUI/Event.h"
+#include "CEGUI/Rectf.h"
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+
+/*!
+\brief
+    NavigationStrategy that moves the focus to the nearest window in the
+    direction given by the payload, which is one of NavigateLeft,
+    NavigateRight, NavigateUp or NavigateDown.
+
+    The registered windows are kept sorted by the horizontal and the vertical
+    position of their centres, so a query walks outwards from the current
+    window along the axis of the direction and stops as soon as the distance
+    along that axis alone exceeds the best score found, instead of testing
+    every window. The score of a candidate is its distance along the axis plus
+    its distance across it weighted by the cross axis weight.
+
+    Windows are re-sorted on the next query after they moved or were resized,
+    and are removed when they are destroyed. Windows that are hidden, disabled
+    or can not be focused at the time of a query are skipped.
+
+    For a brief tutorial on how to use the GUI navigation please refer
+    to the @ref gui_navigation_tutorial
+*/
+class CEGUIEXPORT SpatialNavigationStrategy : public NavigationStrategy
+{
+public:
+    //! Payload moving the focus to the nearest window on the left.
+    static const String NavigateLeft;
+    //! Payload moving the focus to the nearest window on the right.
+    static const String NavigateRight;
+    //! Payload moving the focus to the nearest window above.
+    static const String NavigateUp;
+    //! Payload moving the focus to the nearest window below.
+    static const String NavigateDown;
+
+    SpatialNavigationStrategy() = default;
+    ~SpatialNavigationStrategy() override;
+
+    SpatialNavigationStrategy(const SpatialNavigationStrategy&) = delete;
+    SpatialNavigationStrategy& operator=(const SpatialNavigationStrategy&) = delete;
+
+    //! Registers \a window as a navigation target, does nothing if it already is one.
+    void addWindow(Window* window);
+
+    //! Unregisters \a window, does nothing if it is not a navigation target.
+    void removeWindow(Window* window);
+
+    /*!
+    \brief
+        Registers all descendants of \a root that can be focused, and \a root
+        itself if \a includeRoot is true and it can be focused.
+    */
+    void addFocusableWindows(Window* root, bool includeRoot = false);
+
+    //! Unregisters all windows.
+    void clear();
+
+    //! Returns whether \a window is a navigation target.
+    bool isWindowAdded(const Window* window) const;
+
+    //! Returns the number of registered windows.
+    size_t getWindowCount() const { return d_entries.size(); }
+
+    /*!
+    \brief
+        Sets the weight of the distance across the direction of navigation,
+        relative to the distance along it. Higher values prefer windows that
+        are in line with the current one over closer windows that are not.
+        The default is 2.
+    */
+    void setCrossAxisWeight(float weight) { d_crossAxisWeight = weight; }
+
+    //! Returns the weight of the distance across the direction of navigation.
+    float getCrossAxisWeight() const { return d_crossAxisWeight; }
+
+    /*!
+    \copydoc NavigationStrategy::getWindow
+
+        Returns the topmost window that can be focused if \a neighbour is not
+        a navigation target, and \a neighbour itself if there is no window in
+        the requested direction or the payload is not a direction.
+    */
+    Window* getWindow(Window* neighbour, const String& payload) override;
+
+private:
+    typedef std::multimap<float, Window*> AxisIndex;
+
+    //! Index entry of one window.
+    struct Entry
+    {
+        //! Centre of the window's unclipped outer rect, valid unless dirty.
+        glm::vec2 d_centre;
+        AxisIndex::iterator d_xPosition;
+        AxisIndex::iterator d_yPosition;
+        //! Whether the window is listed in d_dirtyWindows.
+        bool d_dirty;
+        Event::ScopedConnection d_movedConnection;
+        Event::ScopedConnection d_sizedConnection;
+        Event::ScopedConnection d_destructionConnection;
+    };
+
+    typedef std::unordered_map<const Window*, Entry> EntryMap;
+
+    //! Re-sorts the windows that moved or were resized since the last query.
+    void updateDirtyEntries();
+    //! Marks the entry of the window in \a args for re-sorting.
+    bool handleAreaChanged(const EventArgs& args);
+    //! Unregisters the window in \a args.
+    bool handleDestructionStarted(const EventArgs& args);
+    //! Returns whether \a window can currently receive the focus.
+    static bool isNavigable(const Window& window);
+    //! Returns the topmost navigable window.
+    Window* getFirstNavigableWindow() const;
+
+    //! Registered windows.
+    EntryMap d_entries;
+    //! Registered windows sorted by the horizontal position of their centre.
+    AxisIndex d_xIndex;
+    //! Registered windows sorted by the vertical position of their centre.
+    AxisIndex d_yIndex;
+    //! Windows to re-sort before the next query.
+    std::vector<const Window*> d_dirtyWindows;
+    //! Weight of the distance across the direction of navigation.
+    float d_crossAxisWeight = 2.0f;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISpatialNavigationStrategy_h_
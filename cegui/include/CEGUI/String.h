@@ -2142,7 +2142,7 @@ public:
     */
     String& append(const std::string& str)
     {
-        d_string.append(convertUtf8ToUtf32(str));
+        appendUtf8ToUtf32(d_string, str.data(), str.size());
         return *this;
     }
 #endif
@@ -2287,7 +2287,7 @@ public:
     */
     String& append(const char* charArray, size_type count)
     {
-        d_string.append(convertUtf8ToUtf32(charArray, charArray + count));
+        appendUtf8ToUtf32(d_string, charArray, count);
         return *this;
     }
 #endif
@@ -2341,7 +2341,8 @@ public:
     */
     String& append(const char* charArray)
     {
-        d_string.append(convertUtf8ToUtf32(charArray));
+        appendUtf8ToUtf32(d_string, charArray,
+                          charArray ? std::char_traits<char>::length(charArray) : 0);
         return *this;
     }
 #endif
@@ -2587,7 +2588,7 @@ public:
     */
     int compare(const std::string& str) const
     {
-        return d_string.compare(convertUtf8ToUtf32(str));
+        return compareUtf32ToUtf8(d_string.data(), d_string.size(), str.data(), str.size());
     }
 #endif
 
@@ -2841,7 +2842,8 @@ public:
     */
     int compare(const char* charArray) const
     {
-        return d_string.compare(convertUtf8ToUtf32(charArray).data());
+        return compareUtf32ToUtf8(d_string.data(), d_string.size(),
+                                  charArray, charArray ? std::char_traits<char>::length(charArray) : 0);
     }
 #endif
 
@@ -4639,6 +4641,22 @@ private:
     */
     friend CEGUIEXPORT std::basic_istream<char>& operator>>(std::basic_istream<char>& inputStream, String& str);
 
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32)
+    //! Decodes UTF-8 code units and appends the code points to \a utf32String, without temporaries.
+    static void appendUtf8ToUtf32(std::u32string& utf32String, const char* utf8String,
+                                  const size_t stringLength);
+
+    /*!
+    \brief
+        Compares UTF-32 code units to UTF-8 encoded code units, decoding the
+        latter on the fly instead of converting them to a temporary string.
+    \return
+        The result of comparing the code points, as returned by compare().
+    */
+    static int compareUtf32ToUtf8(const char32_t* utf32String, const size_t utf32Length,
+                                  const char* utf8String, const size_t utf8Length);
+#endif
+
     //! The wrapped basic_string object holding the unicode encoded code units.
     std::basic_string<value_type> d_string;
 };
@@ -5390,7 +5408,7 @@ struct hash<CEGUI::String>
 {
     std::size_t operator()(const CEGUI::String& str) const
     {
-        return std::hash<std::basic_string<CEGUI::String::value_type>>()(str.c_str());
+        return std::hash<std::basic_string<CEGUI::String::value_type>>()(str.getString());
     }
 };
 
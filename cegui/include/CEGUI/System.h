@@ -31,7 +31,9 @@
 
 #include "CEGUI/Singleton.h"
 #include "CEGUI/EventSet.h"
+#include "CEGUI/MemoryAllocator.h"
 #include <vector>
+#include <unordered_map>
 
 #if defined(__WIN32__) || defined(_WIN32)
 #   include "CEGUI/Win32StringTranscoder.h"
@@ -123,6 +125,28 @@ public:
     //! Destroy the System object.
     static void destroy();
 
+    /*!
+    \brief
+        Sets the MemoryAllocator that CEGUI allocates its objects from.
+
+        This must be done before the System is created, and again only after
+        it was destroyed and all objects allocated through the previous
+        allocator were released.
+
+    \param allocator
+        The allocator to use, or nullptr to use the default allocator based
+        on std::malloc. The allocator is not owned by CEGUI and must outlive
+        every object allocated from it.
+
+    \exception InvalidRequestException
+        thrown if the System exists, or if memory allocated through the
+        current allocator is still in use.
+    */
+    static void setMemoryAllocator(MemoryAllocator* allocator);
+
+    //! Returns the MemoryAllocator that CEGUI allocates its objects from.
+    static MemoryAllocator& getMemoryAllocator();
+
     /*!
     \brief
         Retrieves CEGUI's major version as an integer
@@ -509,6 +533,26 @@ public:
     */
     void setDefaultCustomRenderedStringParser(RenderedStringParser* parser);
 
+    /*!
+    \brief
+        Registers the TaskScheduler CEGUI uses to run work in parallel, such as
+        the geometry generation of RenderingWindow subtrees in GUIContext::draw.
+
+    \param scheduler
+        Pointer to the TaskScheduler to use, or nullptr to run all tasks
+        serially on the calling thread, which is the default. The scheduler is
+        not owned by the System and must outlive its registration. Use
+        ThreadPoolTaskScheduler when the host has no job system of its own.
+    */
+    void setTaskScheduler(TaskScheduler* scheduler);
+
+    /*!
+    \brief
+        Returns the registered TaskScheduler, or a SerialTaskScheduler if none
+        is registered.
+    */
+    TaskScheduler& getTaskScheduler() const;
+
     /*!
     \brief
         Invalidate all imagery and geometry caches for CEGUI managed elements.
@@ -539,12 +583,69 @@ public:
     //! destroy a RegexMatcher instance returned by System::createRegexMatcher.
     void destroyRegexMatcher(RegexMatcher* rm) const;
 
-    //! call this to ensure system-level time based updates occur.
+    /*!
+    \brief
+        Return a RegexMatcher for \a regex that is shared with everyone else
+        acquiring the same pattern, if support is available.
+
+        The pattern is compiled once for all its users, e.g. all the numeric
+        Editboxes of a form, instead of once per user. The returned matcher
+        must be treated as read only, calling setRegexString on it would
+        change it for all its users.
+
+    
+eturn
+        Pointer to the shared RegexMatcher, or 0 if the system has no built in
+        support for RegexMatcher creation. Each pointer returned must be given
+        back to System::releaseRegexMatcher once it is no longer needed.
+
+    \exception InvalidRequestException
+        thrown if \a regex can not be compiled.
+    */
+    RegexMatcher* acquireRegexMatcher(const String& regex);
+
+    //! Release a RegexMatcher returned by acquireRegexMatcher, destroying it with its last user.
+    void releaseRegexMatcher(RegexMatcher* rm);
+
+    /*!
+    \brief
+        call this to ensure system-level time based updates occur.
+
+        Steps the animations and dispatches the asynchronous loads of the
+        ResourceProvider that have finished.
+    */
     bool injectTimePulse(float timeElapsed);
 
+    /*!
+    \brief
+        Return whether the whole GUI has nothing left to do until the next input.
+
+        This is the case when no animation is running, no asynchronous load is
+        pending and every GUIContext is idle, see GUIContext::isIdle. Hosts may
+        then lower their frame rate or block waiting for input. Always false
+        unless selective updating is enabled on all GUI contexts.
+    */
+    bool isIdle() const;
+
     GUIContext& createGUIContext(RenderTarget& rt);
     void destroyGUIContext(GUIContext& context);
 
+    //! Time a subsystem took to initialise while the System was created.
+    struct StartupTime
+    {
+        String d_subsystem;
+        double d_milliseconds;
+    };
+    typedef std::vector<StartupTime> StartupTimeList;
+
+    /*!
+    \brief
+        Returns how long each subsystem took to initialise while the System
+        was created, in the order they were initialised. The times are also
+        written to the log.
+    */
+    const StartupTimeList& getStartupTimes() const { return d_startupTimes; }
+
     /*!
     \brief adds factories for all the basic window types
 
@@ -669,12 +770,28 @@ protected:
     bool d_ourLogger;
     //! currently set global RenderedStringParser.
     RenderedStringParser* d_customRenderedStringParser;
+    //! TaskScheduler registered by the host, if any.
+    TaskScheduler* d_taskScheduler;
+    //! TaskScheduler used while none is registered.
+    SerialTaskScheduler* d_serialTaskScheduler;
 
     String d_defaultFontName;
     String d_defaultCursorName;
     String d_defaultTooltipType;
 
     GUIContextCollection d_guiContexts;
+
+    //! A RegexMatcher shared by the users of its pattern.
+    struct SharedRegexMatcher
+    {
+        RegexMatcher* d_matcher;
+        unsigned int d_users;
+    };
+    //! RegexMatchers returned by acquireRegexMatcher, by pattern.
+    std::unordered_map<String, SharedRegexMatcher> d_sharedRegexMatchers;
+    //! Times the subsystems took to initialise in the constructor.
+    StartupTimeList d_startupTimes;
+
     //! instance of class that can convert string encodings
 #if defined(__WIN32__) || defined(_WIN32)
     static const Win32StringTranscoder d_stringTranscoder;
@@ -0,0 +1,185 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITaskScheduler_h_
+#define _CEGUITaskScheduler_h_
+
+#include "CEGUI/Base.h"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Interface through which CEGUI hands work to the host application's job
+    system. An implementation is registered via System::setTaskScheduler;
+    while none is registered CEGUI runs all tasks serially on the calling
+    thread (see SerialTaskScheduler).
+
+    Tasks submitted by CEGUI may submit and wait for further tasks, so
+    implementations must not block a worker thread in wait without letting it
+    execute other tasks.
+*/
+class CEGUIEXPORT TaskScheduler
+{
+public:
+    //! Type of a single task.
+    typedef std::function<void()> Task;
+    //! Type of the body of a parallelFor, called with the index to process.
+    typedef std::function<void(std::size_t)> IndexedTask;
+    //! Identifies a submitted task until it has been waited for.
+    typedef std::uint64_t TaskId;
+
+    virtual ~TaskScheduler() {}
+
+    /*!
+    \brief
+        Queues \a task for execution on any thread and returns its id, which
+        must be passed to wait exactly once.
+    */
+    virtual TaskId submit(Task task) = 0;
+
+    /*!
+    \brief
+        Returns once the task identified by \a id has finished. If the task
+        threw an exception, it is rethrown here.
+    */
+    virtual void wait(TaskId id) = 0;
+
+    //! Returns the number of tasks the scheduler can run at the same time.
+    virtual std::size_t getConcurrency() const = 0;
+
+    /*!
+    \brief
+        Calls \a body for every index in [\a begin, \a end) and returns once
+        all calls have finished. The calls may happen concurrently and in any
+        order. The first exception thrown by any call is rethrown.
+
+        The default implementation splits the range into one contiguous chunk
+        per getConcurrency, submits all but the last chunk and runs the last
+        one on the calling thread.
+    */
+    virtual void parallelFor(std::size_t begin, std::size_t end, const IndexedTask& body);
+};
+
+/*!
+\brief
+    TaskScheduler that runs every task immediately on the thread submitting
+    it. This is what CEGUI uses while no TaskScheduler is registered.
+*/
+class CEGUIEXPORT SerialTaskScheduler : public TaskScheduler
+{
+public:
+    TaskId submit(Task task) override;
+    void wait(TaskId id) override;
+    std::size_t getConcurrency() const override { return 1; }
+    void parallelFor(std::size_t begin, std::size_t end, const IndexedTask& body) override;
+
+private:
+    //! Id given to the next task.
+    TaskId d_nextTaskId = 1;
+    //! Exceptions thrown by tasks that were not waited for yet.
+    std::unordered_map<TaskId, std::exception_ptr> d_failedTasks;
+};
+
+/*!
+\brief
+    Simple built-in TaskScheduler running tasks on a fixed set of worker
+    threads, for hosts that do not have a job system of their own.
+
+    Tasks are run in submission order. A thread waiting for a task that has
+    not finished yet runs queued tasks in the meantime, so tasks may wait for
+    tasks they submitted themselves.
+*/
+class CEGUIEXPORT ThreadPoolTaskScheduler : public TaskScheduler
+{
+public:
+    /*!
+    \brief
+        Constructor.
+
+    \param threadCount
+        The number of worker threads to start. 0 starts one thread less than
+        the hardware supports concurrently, but at least one.
+    */
+    explicit ThreadPoolTaskScheduler(std::size_t threadCount = 0);
+    //! Finishes all queued tasks and joins the worker threads.
+    ~ThreadPoolTaskScheduler();
+
+    ThreadPoolTaskScheduler(const ThreadPoolTaskScheduler&) = delete;
+    ThreadPoolTaskScheduler& operator=(const ThreadPoolTaskScheduler&) = delete;
+
+    TaskId submit(Task task) override;
+    void wait(TaskId id) override;
+    //! Returns the number of worker threads plus one for the waiting thread.
+    std::size_t getConcurrency() const override { return d_workers.size() + 1; }
+
+private:
+    //! State of a task that was submitted but not waited for yet.
+    struct TaskState
+    {
+        bool d_finished = false;
+        std::exception_ptr d_error;
+    };
+
+    //! Runs the front task of the queue, \a lock is released while it runs.
+    void runQueuedTask(std::unique_lock<std::mutex>& lock);
+    //! Main function of the worker threads.
+    void workerMain();
+
+    std::vector<std::thread> d_workers;
+    std::deque<std::pair<TaskId, Task>> d_queue;
+    std::unordered_map<TaskId, TaskState> d_tasks;
+    TaskId d_nextTaskId = 1;
+    bool d_stopping = false;
+    std::mutex d_mutex;
+    //! Signalled when a task is queued or the workers are asked to stop.
+    std::condition_variable d_taskQueued;
+    //! Signalled when a task has finished.
+    std::condition_variable d_taskFinished;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUITaskScheduler_h_
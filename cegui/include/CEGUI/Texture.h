@@ -32,6 +32,8 @@
 
 #include "CEGUI/Base.h"
 #include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
 
 namespace CEGUI
 {
@@ -78,9 +80,137 @@ public:
         //! S3 DXT1 texture compression (RGBA).
         RgbaDxt3,
         //! S3 DXT1 texture compression (RGBA).
-        RgbaDxt5
+        RgbaDxt5,
+        //! BPTC (BC7) texture compression (RGBA). Each 4x4 block is 16 bytes.
+        RgbaBc7,
+        //! ETC2 texture compression (RGB). Each 4x4 block is 8 bytes.
+        RgbEtc2,
+        //! ETC2 EAC texture compression (RGBA). Each 4x4 block is 16 bytes.
+        RgbaEtc2,
+        //! ASTC texture compression with 4x4 blocks of 16 bytes (RGBA).
+        RgbaAstc4x4,
+        //! ASTC texture compression with 6x6 blocks of 16 bytes (RGBA).
+        RgbaAstc6x6,
+        //! ASTC texture compression with 8x8 blocks of 16 bytes (RGBA).
+        RgbaAstc8x8
     };
 
+    //! Returns whether \a fmt is a GPU compressed (block based) format.
+    static bool isCompressedFormat(PixelFormat fmt)
+    {
+        return fmt >= PixelFormat::Pvrtc2;
+    }
+
+    /*!
+    \brief
+        Multiplies the colour channels of 8 bit RGBA pixels by their alpha,
+        turning straight alpha into premultiplied alpha.
+    */
+    static void premultiplyAlpha(std::uint8_t* pixels, size_t pixel_count)
+    {
+        for (size_t i = 0; i < pixel_count; ++i, pixels += 4)
+        {
+            const unsigned int alpha = pixels[3];
+            pixels[0] = static_cast<std::uint8_t>((pixels[0] * alpha + 127) / 255);
+            pixels[1] = static_cast<std::uint8_t>((pixels[1] * alpha + 127) / 255);
+            pixels[2] = static_cast<std::uint8_t>((pixels[2] * alpha + 127) / 255);
+        }
+    }
+
+    /*!
+    \brief
+        Returns whether all \a pixel_count pixels of \a pixels in the format
+        \a fmt are fully opaque. Formats without an alpha channel always are,
+        compressed formats with an alpha channel are never reported as opaque.
+    */
+    static bool isDataOpaque(const void* pixels, size_t pixel_count, PixelFormat fmt)
+    {
+        switch (fmt)
+        {
+        case PixelFormat::Rgb:
+        case PixelFormat::Rgb565:
+        case PixelFormat::RgbDxt1:
+        case PixelFormat::RgbEtc2:
+            return true;
+        case PixelFormat::Rgba:
+        {
+            const std::uint8_t* bytes = static_cast<const std::uint8_t*>(pixels);
+            for (size_t i = 0; i < pixel_count; ++i)
+                if (bytes[i * 4 + 3] != 0xFF)
+                    return false;
+            return true;
+        }
+        case PixelFormat::Rgba4444:
+        {
+            const std::uint16_t* texels = static_cast<const std::uint16_t*>(pixels);
+            for (size_t i = 0; i < pixel_count; ++i)
+                if ((texels[i] & 0xF) != 0xF)
+                    return false;
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    /*!
+    \brief
+        Returns the number of bytes taken by image data of the given size in
+        the given pixel format.
+
+        For block compressed formats the size is rounded up to whole blocks,
+        using the minimum block count required by the PVRTC formats.
+    */
+    static size_t calculateDataSize(PixelFormat fmt, size_t width, size_t height)
+    {
+        size_t blockWidth = 4;
+        size_t blockHeight = 4;
+        size_t blockBytes = 16;
+        size_t minBlocks = 1;
+
+        switch (fmt)
+        {
+        case PixelFormat::Rgb:
+            return width * height * 3;
+        case PixelFormat::Rgba:
+            return width * height * 4;
+        case PixelFormat::Rgba4444:
+        case PixelFormat::Rgb565:
+            return width * height * 2;
+        case PixelFormat::Pvrtc2:
+            blockWidth = 8;
+            blockBytes = 8;
+            minBlocks = 2;
+            break;
+        case PixelFormat::Pvrtc4:
+            blockBytes = 8;
+            minBlocks = 2;
+            break;
+        case PixelFormat::RgbDxt1:
+        case PixelFormat::RgbaDxt1:
+        case PixelFormat::RgbEtc2:
+            blockBytes = 8;
+            break;
+        case PixelFormat::RgbaAstc6x6:
+            blockWidth = blockHeight = 6;
+            break;
+        case PixelFormat::RgbaAstc8x8:
+            blockWidth = blockHeight = 8;
+            break;
+        default:
+            break;
+        }
+
+        size_t blocksX = (width + blockWidth - 1) / blockWidth;
+        size_t blocksY = (height + blockHeight - 1) / blockHeight;
+        if (blocksX < minBlocks)
+            blocksX = minBlocks;
+        if (blocksY < minBlocks)
+            blocksY = minBlocks;
+
+        return blocksX * blocksY * blockBytes;
+    }
+
     /*!
     \brief
         Destructor for Texture base class.
@@ -215,6 +345,74 @@ public:
         - false if the specified PixelFormat is not supported.
     */
     virtual bool isPixelFormatSupported(const PixelFormat fmt) const = 0;
+
+    /*!
+    \brief
+        Sets whether a mip chain is generated for the data loaded into the
+        texture, so that it is filtered properly when drawn scaled down.
+
+        The setting takes effect with the next call to loadFromMemory or
+        loadFromFile. Only uncompressed 8 bit RGB and RGBA data get mip
+        levels. Implementations without mipmap support ignore the setting.
+    */
+    virtual void setMipmapsEnabled(bool /*enabled*/) {}
+
+    //! Returns whether a mip chain is generated for the loaded data.
+    virtual bool isMipmapsEnabled() const { return false; }
+
+    /*!
+    \brief
+        Sets the largest scale, between 0 and 1, at which the texture is
+        expected to be drawn.
+
+        When mipmaps are enabled, the next load keeps only the mip levels
+        needed at that scale resident on the GPU: each halving of the scale
+        drops the largest level. The size of the texture and its texel
+        scaling are unaffected, so images defined on it stay valid. Blitting
+        into a texture that dropped levels is not supported; load the data
+        again after raising the scale instead.
+
+        Implementations without mipmap support ignore the setting.
+    */
+    virtual void setResidentScale(float /*scale*/) {}
+
+    //! Returns the scale set by setResidentScale, 1 by default.
+    virtual float getResidentScale() const { return 1.0f; }
+
+    /*!
+    \brief
+        Frees the memory taken by the data of the texture while keeping the
+        texture itself, so that it can be filled again with loadFromFile or
+        loadFromMemory later on.
+
+        The size of the texture and its texel scaling are unaffected, so images
+        defined on it stay valid; drawing them before the data was loaded again
+        shows undefined content. Used by TextureResidencyManager to evict
+        textures of imagesets.
+
+    \return
+        true if the data was released, false if this is not supported for the
+        texture, in which case nothing changed.
+    */
+    virtual bool releaseData() { return false; }
+
+    /*!
+    \brief
+        Returns whether the data of the texture was released with releaseData
+        and not loaded again since.
+    */
+    virtual bool isDataReleased() const { return false; }
+
+    /*!
+    \brief
+        Returns whether every pixel of the texture is fully opaque, as found
+        from the data it was loaded with.
+
+        Geometry hidden behind opaque geometry drawn with such a texture may
+        be skipped by a RenderQueue, see RenderQueue::setOcclusionCullingEnabled.
+        Textures whose data is not inspected report false, which is always safe.
+    */
+    virtual bool isOpaque() const { return false; }
 };
 
 } // End of  CEGUI namespace section
@@ -0,0 +1,249 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITextureResidencyManager_h_
+#define _CEGUITextureResidencyManager_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/String.h"
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//! Categories the texture memory tracked by TextureResidencyManager is accounted to.
+enum class TextureCategory : int
+{
+    //! Textures of imagesets and pages of the ImageAtlas.
+    Imageset,
+    //! Glyph pages of fonts.
+    GlyphAtlas,
+    //! TextureTargets, such as the caches of automatic RenderingWindows.
+    RenderTarget,
+
+    Count
+};
+
+/*!
+\brief
+    Keeps track of the GPU memory taken by the textures of CEGUI and keeps it
+    within a budget.
+
+    Every Renderer owns one of these (see Renderer::getTextureResidencyManager).
+    The parts of CEGUI creating textures register them along with a category
+    and, where possible, a way to evict them:
+    - Windows register the TextureTargets of their automatic RenderingWindows,
+      which are evicted by releasing the RenderingWindow; it is created again
+      the next time the window is drawn. Content caches of GUIContexts are
+      registered too, but never evicted.
+    - FreeTypeGlyphAtlas registers its pages; evicting one destroys it and the
+      glyphs it held are rasterised again when next laid out.
+    - ImageManager registers the textures of imagesets loaded from files;
+      evicting one releases its data through Texture::releaseData and it is
+      loaded again from the file the next time it is drawn.
+
+    Textures are marked as drawn by the RenderQueues and the cursor while a
+    budget is set. At the end of each frame in which something was drawn, the
+    memory beyond the budget is freed: first the idle targets of the
+    TextureTargetPool, then the least recently drawn render targets and glyph
+    pages, and last the least recently drawn imagesets. Textures drawn during
+    that frame are never evicted, so the budget is a soft limit.
+
+    The memory of a texture is estimated from its size at 4 bytes per pixel,
+    plus a third for textures with mipmaps and 4 more bytes per pixel for
+    TextureTargets using a stencil buffer.
+
+\note
+    Textures should be removed before they are destroyed. Textures destroyed
+    directly through the Renderer are noticed by their name and forgotten at
+    the end of the frame.
+*/
+class CEGUIEXPORT TextureResidencyManager
+{
+public:
+    //! Function releasing the memory of a texture, returns whether it did.
+    typedef std::function<bool()> EvictFunction;
+    //! Function loading the data of a texture released by Texture::releaseData again.
+    typedef std::function<void()> RestoreFunction;
+
+    //! Budget value meaning that the memory of the textures is not limited.
+    static const std::size_t NoBudget;
+
+    TextureResidencyManager(Renderer& owner);
+
+    TextureResidencyManager(const TextureResidencyManager&) = delete;
+    TextureResidencyManager& operator=(const TextureResidencyManager&) = delete;
+
+    /*!
+    \brief
+        Starts tracking \a texture, or updates how it is tracked.
+
+    \param texture
+        The texture to track.
+
+    \param category
+        The category the memory of the texture is accounted to.
+
+    \param evict
+        Function releasing the memory of the texture, or an empty function if
+        the texture can not be evicted. The function may remove the texture.
+
+    \param restore
+        Function loading the data of the texture again after \a evict released
+        it through Texture::releaseData. Called before the texture is drawn.
+    */
+    void addTexture(Texture& texture, TextureCategory category,
+                    EvictFunction evict = EvictFunction(),
+                    RestoreFunction restore = RestoreFunction());
+
+    /*!
+    \brief
+        Starts tracking the texture of \a target as TextureCategory::RenderTarget,
+        accounting the stencil buffer of the target as well.
+    */
+    void addTextureTarget(const TextureTarget& target, EvictFunction evict = EvictFunction());
+
+    //! Stops tracking \a texture. Does nothing if it is not tracked.
+    void removeTexture(const Texture& texture);
+
+    //! Returns whether \a texture is tracked.
+    bool isTextureTracked(const Texture& texture) const;
+
+    /*!
+    \brief
+        Marks \a texture as drawn in the current frame, loading its data again
+        if it was evicted. Does nothing for textures that are not tracked.
+    */
+    void markUsed(const Texture& texture);
+
+    //! Marks the texture of \a buffer as drawn in the current frame, see markUsed.
+    void markUsed(const GeometryBuffer& buffer);
+
+    //! Marks the textures of \a buffers as drawn in the current frame, see markUsed.
+    void markUsed(const std::vector<GeometryBuffer*>& buffers);
+
+    /*!
+    \brief
+        Returns whether the drawn textures have to be marked via markUsed,
+        which is the case while a budget is set or textures were evicted.
+    */
+    bool isTrackingUsage() const { return d_memoryBudget != NoBudget || d_evictionCount != 0; }
+
+    /*!
+    \brief
+        Sets the amount of texture memory, in bytes, beyond which textures are
+        evicted at the end of a frame. NoBudget, the default, disables eviction.
+    */
+    void setMemoryBudget(std::size_t bytes);
+
+    //! Returns the texture memory budget in bytes, NoBudget if there is none.
+    std::size_t getMemoryBudget() const { return d_memoryBudget; }
+
+    /*!
+    \brief
+        Returns the estimated memory, in bytes, taken by the tracked textures
+        of \a category. The render targets include the idle targets of the
+        TextureTargetPool.
+    */
+    std::size_t getMemoryUsage(TextureCategory category) const;
+
+    //! Returns the estimated memory, in bytes, taken by all tracked textures.
+    std::size_t getMemoryUsage() const;
+
+    //! Returns the number of textures evicted so far.
+    std::size_t getEvictionCount() const { return d_evictionCount; }
+
+    //! Returns the number of evicted textures that were loaded again so far.
+    std::size_t getRestoreCount() const { return d_restoreCount; }
+
+    /*!
+    \brief
+        Notifies the manager that a frame was completely rendered. Evicts
+        textures while the budget is exceeded and starts a new frame.
+
+        Frames in which nothing was drawn, for example because all contexts
+        were drawn on demand and did not change, are not counted.
+    */
+    void notifyFrameEnded();
+
+    //! Returns the estimated memory, in bytes, taken by the data of \a texture.
+    static std::size_t estimateMemoryUsage(const Texture& texture);
+
+private:
+    struct Entry
+    {
+        Texture* d_texture;
+        //! Name the texture is known by to the Renderer.
+        String d_name;
+        //! Target the texture belongs to, if any.
+        const TextureTarget* d_target;
+        TextureCategory d_category;
+        EvictFunction d_evict;
+        RestoreFunction d_restore;
+        //! Frame in which the texture was last drawn.
+        std::uint64_t d_lastUsedFrame;
+    };
+
+    /*!
+    \brief
+        Returns whether the texture of \a entry still exists. Targets are
+        removed by the pool, other textures must still be known by name.
+    */
+    bool isTextureAlive(const Entry& entry) const;
+    //! Forgets about the textures destroyed without being removed.
+    void removeDestroyedTextures();
+    std::size_t getMemoryUsage(const Entry& entry) const;
+    //! Evicts the least recently drawn textures until the budget is met.
+    void enforceMemoryBudget();
+
+    //! Renderer owning the textures.
+    Renderer& d_owner;
+    //! The tracked textures.
+    std::unordered_map<const Texture*, Entry> d_entries;
+    std::size_t d_memoryBudget;
+    //! Counter of the frames in which something was drawn.
+    std::uint64_t d_frame;
+    //! Whether a texture was marked as drawn during the current frame.
+    bool d_usedThisFrame;
+    std::size_t d_evictionCount;
+    std::size_t d_restoreCount;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUITextureResidencyManager_h_
@@ -31,6 +31,49 @@
 
 namespace CEGUI
 {
+/*!
+\brief
+    Decides the size of the storage of a TextureTarget, so that targets whose
+    content size changes often, such as the ones of RenderingWindows being
+    resized or animated, do not reallocate their texture every time.
+
+    Storage sizes are multiples of Granularity. When the content outgrows the
+    storage, the exceeded dimensions grow by at least half of their size, and
+    content that fits is rendered into the top left part of the storage. The
+    storage only shrinks once the content has used less than a quarter of it
+    for ShrinkDelay declarations in a row.
+*/
+class CEGUIEXPORT TextureTargetGrowthPolicy
+{
+public:
+    //! Size, in pixels, storage dimensions are a multiple of.
+    static const std::uint32_t Granularity = 64;
+    //! Number of consecutive under-using declarations after which the storage shrinks.
+    static const std::uint32_t ShrinkDelay = 60;
+
+    /*!
+    \brief
+        Returns the size the storage, which is currently \a current, should
+        have for content of \a required size. \a required itself is returned
+        if the policy is disabled.
+    */
+    Sizef getStorageSize(const Sizef& current, const Sizef& required);
+
+    //! Sets whether the policy is applied, otherwise the storage has the exact content size.
+    void setEnabled(bool setting) { d_enabled = setting; }
+
+    //! Returns whether the policy is applied.
+    bool isEnabled() const { return d_enabled; }
+
+private:
+    //! Returns \a extent rounded up to a multiple of Granularity.
+    static float roundUp(float extent);
+
+    bool d_enabled = true;
+    //! Declarations in a row that used less than a quarter of the storage.
+    std::uint32_t d_underusedDeclarations = 0;
+};
+
 /*!
 \brief
     Specialisation of RenderTarget interface that should be used as the base
@@ -48,6 +91,28 @@ public:
     */
     virtual void clear() = 0;
 
+    /*!
+    \brief
+        Clear \a area of the surface of the underlying texture. The area is in
+        the coordinates of the geometry, which are pixels unless a render scale
+        is set, relative to the top left corner of the TextureTarget.
+
+        The default implementation clears the whole surface; check
+        isAreaClearSupported to know whether content outside \a area is kept.
+    */
+    virtual void clearArea(const Rectf& area);
+
+    //! Return whether clearArea keeps the content outside the given area.
+    virtual bool isAreaClearSupported() const { return false; }
+
+    /*!
+    \brief
+        Return whether the TextureTarget honours its render scale, see
+        RenderTarget::setRenderScale, when clipping geometry and clearing
+        areas. Only then may content be rendered at a reduced resolution.
+    */
+    virtual bool isRenderScaleSupported() const { return false; }
+
     /*!
     \brief
         Return a pointer to the CEGUI::Texture that the TextureTarget is using.
@@ -77,6 +142,15 @@ public:
     */
     virtual void declareRenderSize(const Sizef& sz) = 0;
 
+    /*!
+    \brief
+        Return the policy deciding the size of the underlying texture for the
+        sizes passed to declareRenderSize. Targets that apply it may keep a
+        texture larger than the declared size, whose top left part is then
+        rendered to.
+    */
+    TextureTargetGrowthPolicy& getGrowthPolicy() { return d_growthPolicy; }
+
     /*!
     \brief
         Return whether this TextureTarget has a stencil buffer attached or not.
@@ -89,6 +163,8 @@ public:
 protected:
     //! Determines if the instance has a stencil buffer attached or not
     bool d_usesStencil;
+    //! Decides the size of the texture for the declared render sizes.
+    TextureTargetGrowthPolicy d_growthPolicy;
 };
 
 } // End of  CEGUI namespace section
@@ -0,0 +1,160 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITextureTargetPool_h_
+#define _CEGUITextureTargetPool_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/Sizef.h"
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Pool of TextureTargets that keeps released targets around so that they can
+    be handed out again instead of being destroyed and recreated.
+
+    Every Renderer owns one of these (see Renderer::getTextureTargetPool), it is
+    used for the TextureTargets of automatically created RenderingWindows.
+    Targets are recycled by stencil usage and size bucket: a released target is
+    handed out again for any request whose size falls into the same bucket,
+    preferring targets of exactly the requested size.
+
+    The memory held by idle targets is limited by a budget; when it is exceeded
+    the targets released the longest time ago are destroyed.
+*/
+class CEGUIEXPORT TextureTargetPool
+{
+public:
+    //! Default value for the memory budget of idle targets, in bytes.
+    static const std::size_t DefaultMemoryBudget = 32 * 1024 * 1024;
+    //! Default size, in pixels, of the size buckets.
+    static const std::uint32_t DefaultBucketGranularity = 64;
+
+    TextureTargetPool(Renderer& owner);
+    ~TextureTargetPool();
+
+    TextureTargetPool(const TextureTargetPool&) = delete;
+    TextureTargetPool& operator=(const TextureTargetPool&) = delete;
+
+    /*!
+    \brief
+        Returns a cleared TextureTarget for rendering content of \a size.
+
+        An idle target with the same stencil usage in the same size bucket is
+        preferred, otherwise a new one is created via
+        Renderer::createTextureTarget. The caller still declares the actual
+        size to the target.
+
+    \return
+        The TextureTarget, or nullptr if the Renderer can not create one.
+    */
+    TextureTarget* acquire(bool addStencilBuffer, const Sizef& size);
+
+    /*!
+    \brief
+        Returns \a target, which must have been created by the owning Renderer,
+        to the pool for later reuse. Idle targets are destroyed if the memory
+        budget is exceeded.
+    */
+    void release(TextureTarget* target);
+
+    //! Destroys all idle targets.
+    void clear();
+
+    /*!
+    \brief
+        Forgets about all idle targets without destroying them. This is for
+        Renderers destroying all their TextureTargets by other means.
+    */
+    void forgetAll();
+
+    //! Sets the maximum memory, in bytes, that idle targets may hold.
+    void setMemoryBudget(std::size_t budget);
+
+    //! Returns the maximum memory, in bytes, that idle targets may hold.
+    std::size_t getMemoryBudget() const { return d_memoryBudget; }
+
+    //! Sets the size, in pixels, of the size buckets. 0 only matches exact sizes.
+    void setBucketGranularity(std::uint32_t granularity) { d_bucketGranularity = granularity; }
+
+    //! Returns the size, in pixels, of the size buckets.
+    std::uint32_t getBucketGranularity() const { return d_bucketGranularity; }
+
+    //! Returns the estimated memory, in bytes, held by idle targets.
+    std::size_t getIdleMemoryUsage() const { return d_idleMemoryUsage; }
+
+    //! Returns the number of idle targets.
+    std::size_t getIdleTargetCount() const { return d_idleTargets.size(); }
+
+    //! Returns the number of requests that were served with an idle target.
+    std::size_t getHitCount() const { return d_hitCount; }
+
+    //! Returns the number of requests that required a new target.
+    std::size_t getMissCount() const { return d_missCount; }
+
+    //! Returns the estimated memory of \a target, in bytes.
+    static std::size_t estimateMemoryUsage(const TextureTarget& target);
+
+protected:
+    struct IdleTarget
+    {
+        TextureTarget* d_target;
+        //! Estimated memory used by the target, in bytes.
+        std::size_t d_memoryUsage;
+    };
+
+    //! Returns the bucket index of a single dimension.
+    std::uint32_t getBucket(float extent) const;
+    //! Destroys oldest idle targets until the budget is met.
+    void enforceMemoryBudget();
+
+    //! Renderer creating and destroying the targets.
+    Renderer& d_owner;
+    //! Idle targets, the least recently released ones first.
+    std::vector<IdleTarget> d_idleTargets;
+    std::size_t d_idleMemoryUsage;
+    std::size_t d_memoryBudget;
+    std::uint32_t d_bucketGranularity;
+    std::size_t d_hitCount;
+    std::size_t d_missCount;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUITextureTargetPool_h_
@@ -31,6 +31,7 @@
 
 #include "CEGUI/Interpolator.h"
 #include "CEGUI/PropertyHelper.h"
+#include "CEGUI/PropertySet.h"
 
 namespace CEGUI
 {
@@ -41,58 +42,121 @@ public:
     TplInterpolatorBase(const String& type):
         d_type(type)
     {}
-    
+
     //! \copydoc Interpolator::getType
     const String& getType() const override { return d_type; }
-    
+
 private:
     const String d_type;
 };
 
+//! Key frame value of type T, parsed by the templated interpolators.
+template<typename T>
+class TplInterpolatorValue : public InterpolatorValue
+{
+public:
+    TplInterpolatorValue(const String& value):
+        d_value(PropertyHelper<T>::fromString(value))
+    {}
+
+    const T d_value;
+};
+
 /*!
- \brief Generic linear interpolator class
- 
- This class works on a simple formula: result = val1 * (1.0f - position) + val2 * (position);
- You can only use it on types that have operator*(float) and operator+(T) overloaded!
+ \brief Base class of templated interpolators able to work on native values
+
+ Implements NativeInterpolator in terms of two typed methods, the result is
+ written through a PropertyHandle, so no string conversion happens if the
+ target property is a TypedProperty of T.
  */
 template<typename T>
-class TplLinearInterpolator : public TplInterpolatorBase
+class TplNativeInterpolatorBase : public TplInterpolatorBase,
+                                  public NativeInterpolator
 {
 public:
     typedef PropertyHelper<T> Helper;
-    
-    TplLinearInterpolator(const String& type):
+    typedef TplInterpolatorValue<T> Value;
+
+    TplNativeInterpolatorBase(const String& type):
         TplInterpolatorBase(type)
     {}
-    
+
+    //! \copydoc NativeInterpolator::createValue
+    InterpolatorValue* createValue(const String& value) const override
+    {
+        return new Value(value);
+    }
+
+    //! \copydoc NativeInterpolator::applyAbsolute
+    void applyAbsolute(PropertyReceiver* target, Property* property,
+                       const InterpolatorValue& value1,
+                       const InterpolatorValue& value2,
+                       float position) override
+    {
+        PropertyHandle<T>(target, property).set(interpolateAbsoluteNative(
+            static_cast<const Value&>(value1).d_value,
+            static_cast<const Value&>(value2).d_value, position));
+    }
+
+    //! \copydoc NativeInterpolator::applyRelative
+    void applyRelative(PropertyReceiver* target, Property* property,
+                       const String& base,
+                       const InterpolatorValue& value1,
+                       const InterpolatorValue& value2,
+                       float position) override
+    {
+        PropertyHandle<T>(target, property).set(interpolateRelativeNative(
+            Helper::fromString(base),
+            static_cast<const Value&>(value1).d_value,
+            static_cast<const Value&>(value2).d_value, position));
+    }
+
     //! \copydoc Interpolator::interpolateAbsolute
     String interpolateAbsolute(const String& value1,
                                const String& value2,
                                float position) override
     {
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-
-        const T result = static_cast<const T>(val1 * (1.0f - position) + val2 * (position));
-
-        return Helper::toString(result);
+        return Helper::toString(interpolateAbsoluteNative(
+            Helper::fromString(value1), Helper::fromString(value2), position));
     }
-    
+
     //! \copydoc Interpolator::interpolateRelative
     String interpolateRelative(const String& base,
                                const String& value1,
                                const String& value2,
                                float position) override
     {
-        typename Helper::return_type bas = Helper::fromString(base);
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
+        return Helper::toString(interpolateRelativeNative(
+            Helper::fromString(base), Helper::fromString(value1),
+            Helper::fromString(value2), position));
+    }
 
-        const T result = static_cast<const T>(bas + (val1 * (1.0f - position) + val2 * (position)));
+protected:
+    //! Interpolate between \a value1 and \a value2 in absolute mode.
+    virtual T interpolateAbsoluteNative(const T& value1, const T& value2,
+                                        float position) const = 0;
+
+    //! Interpolate between \a value1 and \a value2 relatively to \a base.
+    virtual T interpolateRelativeNative(const T& base, const T& value1,
+                                        const T& value2, float position) const = 0;
+};
+
+/*!
+ \brief Generic linear interpolator class
+
+ This class works on a simple formula: result = val1 * (1.0f - position) + val2 * (position);
+ You can only use it on types that have operator*(float) and operator+(T) overloaded!
+ */
+template<typename T>
+class TplLinearInterpolator : public TplNativeInterpolatorBase<T>
+{
+public:
+    typedef PropertyHelper<T> Helper;
+
+    TplLinearInterpolator(const String& type):
+        TplNativeInterpolatorBase<T>(type)
+    {}
 
-        return Helper::toString(result);
-    }
-    
     //! \copydoc Interpolator::interpolateRelativeMultiply
     String interpolateRelativeMultiply(const String& base,
                                        const String& value1,
@@ -106,57 +170,40 @@ public:
         const float mul = val1 * (1.0f - position) + val2 * (position);
 
         const T result = static_cast<const T>(bas * mul);
-
         return Helper::toString(result);
     }
+
+protected:
+    T interpolateAbsoluteNative(const T& val1, const T& val2,
+                                float position) const override
+    {
+        return static_cast<const T>(val1 * (1.0f - position) + val2 * (position));
+    }
+
+    T interpolateRelativeNative(const T& bas, const T& val1, const T& val2,
+                                float position) const override
+    {
+        return static_cast<const T>(bas + (val1 * (1.0f - position) + val2 * (position)));
+    }
 };
 
 /*!
  \brief Generic discrete interpolator class
- 
+
  This class returns the value the position is closest to.
  You can only use it on any types (they must have a PropertyHelper of course).
  No requirements on operators 
  */
 template<typename T>
-class TplDiscreteInterpolator : public TplInterpolatorBase
+class TplDiscreteInterpolator : public TplNativeInterpolatorBase<T>
 {
 public:
     typedef PropertyHelper<T> Helper;
-    
+
     TplDiscreteInterpolator(const String& type):
-        TplInterpolatorBase(type)
+        TplNativeInterpolatorBase<T>(type)
     {}
-    
-    //! \copydoc Interpolator::interpolateAbsolute
-    String interpolateAbsolute(const String& value1,
-                               const String& value2,
-                               float position) override
-    {
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-
-        typename Helper::return_type result = position < 0.5 ? val1 : val2;
 
-        return Helper::toString(result);
-    }
-    
-    //! \copydoc Interpolator::interpolateRelative
-    String interpolateRelative(const String& /*base*/,
-                               const String& value1,
-                               const String& value2,
-                               float position) override
-    {
-        // NB: TplDiscreteRelativeInterpolator below implements this as expected
-        //typename Helper::return_type bas = Helper::fromString(base);
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-        
-        typename Helper::return_type result = position < 0.5 ? val1 : val2;
-        
-        return Helper::toString(result);
-    }
-    
     //! \copydoc Interpolator::interpolateRelativeMultiply
     String interpolateRelativeMultiply(const String& base,
                                        const String& /*value1*/,
@@ -166,45 +213,48 @@ public:
         typename Helper::return_type bas = Helper::fromString(base);
         /*const float val1 = PropertyHelper<float>::fromString(value1);
         const float val2 = PropertyHelper<float>::fromString(value2);
-
         const float mul = val1 * (1.0f - position) + val2 * (position);*/
 
         // there is nothing we can do, we have no idea what operators T has overloaded
         return Helper::toString(bas);
     }
+
+protected:
+    T interpolateAbsoluteNative(const T& val1, const T& val2,
+                                float position) const override
+    {
+        return position < 0.5 ? val1 : val2;
+    }
+
+    T interpolateRelativeNative(const T& /*bas*/, const T& val1, const T& val2,
+                                float position) const override
+    {
+        // NB: TplDiscreteRelativeInterpolator below implements this as expected
+        return position < 0.5 ? val1 : val2;
+    }
 };
 
 /*!
  \brief Generic discrete relative interpolator class
- 
+
  This class returns the value the position is closest to. It is different to discrete
  interpolator in interpolateRelative. It adds the resulting value to the base value.
- 
+
  You can use this on types that have operator+(T) overloaded
  */
 template<typename T>
 class TplDiscreteRelativeInterpolator : public TplDiscreteInterpolator<T>
 {
 public:
-    typedef PropertyHelper<T> Helper;
-    
     TplDiscreteRelativeInterpolator(const String& type):
         TplDiscreteInterpolator<T>(type)
     {}
-    
-    //! \copydoc Interpolator::interpolateRelative
-    String interpolateRelative(const String& base,
-                               const String& value1,
-                               const String& value2,
-                               float position) override
+
+protected:
+    T interpolateRelativeNative(const T& bas, const T& val1, const T& val2,
+                                float position) const override
     {
-        typename Helper::return_type bas = Helper::fromString(base);
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-        
-        typename Helper::return_type result = bas + (position < 0.5 ? val1 : val2);
-        
-        return Helper::toString(result);
+        return bas + (position < 0.5 ? val1 : val2);
     }
 };
 
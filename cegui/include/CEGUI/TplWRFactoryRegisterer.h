@@ -76,7 +76,7 @@ void TplWRFactoryRegisterer<T>::doFactoryAdd() const
 template <typename T>
 bool TplWRFactoryRegisterer<T>::isAlreadyRegistered() const
 {
-    return WindowRendererManager::getSingleton().isFactoryPresent(d_type);
+    return WindowRendererManager::getSingleton().isFactoryRegistered(d_type);
 }
 
 //----------------------------------------------------------------------------//
@@ -0,0 +1,73 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITracyProfilerBackend_h_
+#define _CEGUITracyProfilerBackend_h_
+
+#include "CEGUI/Profiler.h"
+#include <tracy/TracyC.h>
+#include <cstring>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    ProfilerBackend emitting the zones to the Tracy profiler.
+
+    This backend is header only so that CEGUI itself does not depend on
+    Tracy: include it in the application that links Tracy and builds with
+    TRACY_ENABLE, then pass an instance to Profiler::setBackend.
+*/
+class TracyProfilerBackend : public ProfilerBackend
+{
+public:
+    std::uint64_t beginZone(const ProfileZone& zone) override
+    {
+        static_assert(sizeof(ProfileZone) == sizeof(___tracy_source_location_data),
+                      "ProfileZone must match the Tracy source location layout");
+        static_assert(sizeof(TracyCZoneCtx) <= sizeof(std::uint64_t),
+                      "the Tracy zone context must fit the zone token");
+
+        const TracyCZoneCtx ctx = ___tracy_emit_zone_begin(
+            reinterpret_cast<const ___tracy_source_location_data*>(&zone), 1);
+
+        std::uint64_t token = 0;
+        std::memcpy(&token, &ctx, sizeof(ctx));
+        return token;
+    }
+
+    void endZone(const ProfileZone&, std::uint64_t token) override
+    {
+        TracyCZoneCtx ctx;
+        std::memcpy(&ctx, &token, sizeof(ctx));
+        ___tracy_emit_zone_end(ctx);
+    }
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUITracyProfilerBackend_h_
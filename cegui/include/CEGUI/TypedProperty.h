@@ -35,8 +35,21 @@
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/Exceptions.h"
 
+#include <type_traits>
+#include <utility>
+
 namespace CEGUI
 {
+namespace detail
+{
+//! Evaluates to std::true_type when two const T values can be compared via operator==.
+template<typename T, typename = void>
+struct IsEqualityComparable : std::false_type {};
+
+template<typename T>
+struct IsEqualityComparable<T,
+    decltype(void(std::declval<const T&>() == std::declval<const T&>()))> : std::true_type {};
+}
 
 /*!
 \brief base class for properties able to do native set/get
@@ -55,7 +68,8 @@ public:
     //       but more typo prone (passing string default value)?
     TypedProperty(const String& name, const String& help, const String& origin = "Unknown",
                   typename Helper::pass_type defaultValue = T(), bool writesXML = true):
-        Property(name, help, Helper::toString(defaultValue), writesXML, Helper::getDataTypeName(), origin)
+        Property(name, help, Helper::toString(defaultValue), writesXML, Helper::getDataTypeName(), origin),
+        d_defaultValue(defaultValue)
     {}
     
     virtual ~TypedProperty()
@@ -73,6 +87,31 @@ public:
         setNative(receiver, Helper::fromString(value));
     }
 
+    //! \copydoc Property::copyValue
+    void copyValue(const PropertyReceiver* source, PropertyReceiver* target) override
+    {
+        setNative(target, getNative(source));
+    }
+
+    /*!
+    \copydoc Property::isDefault
+
+    When the native type supports operator== the current value is compared
+    against the native default directly, skipping the two String conversions
+    Property::isDefault would need. Other types fall back to the String
+    comparison.
+    */
+    bool isDefault(const PropertyReceiver* receiver) const override
+    {
+        return isDefault_impl(receiver, detail::IsEqualityComparable<DefaultValueType>());
+    }
+
+    //! Returns the default value of this property in its native type.
+    typename Helper::safe_method_return_type getNativeDefault() const
+    {
+        return d_defaultValue;
+    }
+
     /*!
     \brief native set method, sets the property given a native type
     
@@ -98,8 +137,24 @@ public:
             throw InvalidRequestException(String("Property ") + d_origin + ":" + d_name+" is not readable!");
     }
 protected:
+    //! Type used to store the native default; the same type getNative returns.
+    typedef typename std::decay<typename Helper::safe_method_return_type>::type DefaultValueType;
+
+    bool isDefault_impl(const PropertyReceiver* receiver, std::true_type) const
+    {
+        return getNative(receiver) == d_defaultValue;
+    }
+
+    bool isDefault_impl(const PropertyReceiver* receiver, std::false_type) const
+    {
+        return Property::isDefault(receiver);
+    }
+
     virtual void setNative_impl(PropertyReceiver* receiver, typename Helper::pass_type value) = 0;
     virtual typename Helper::safe_method_return_type getNative_impl(const PropertyReceiver* receiver) const = 0;
+
+    //! Native copy of the default value, used by isDefault to avoid String comparisons.
+    DefaultValueType d_defaultValue;
 };
 
 } // End of  CEGUI namespace section
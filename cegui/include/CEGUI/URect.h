@@ -221,7 +221,7 @@ public:
         return URect(d_min * vector.d_x, d_max * vector.d_y);
     }
 
-    inline URect operator * (const float c)
+    inline URect operator * (const float c) const
     {
         return URect(d_min * c, d_max * c);
     }
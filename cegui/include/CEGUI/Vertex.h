@@ -57,7 +57,10 @@ struct CEGUIEXPORT TexturedColouredVertex
     {}
 
     //! Sets the colour of the struct
-    void setColour(const Colour& colour);
+    void setColour(const Colour& colour)
+    {
+        colour.getRGBA(&d_colour.x);
+    }
 
     //! Position of the vertex in 3D space.
     glm::vec3   d_position;
@@ -85,7 +88,10 @@ struct CEGUIEXPORT ColouredVertex
     {}
 
     //! Sets the colour of the struct
-    void setColour(const Colour& colour);
+    void setColour(const Colour& colour)
+    {
+        colour.getRGBA(&d_colour.x);
+    }
 
     //! Position of the vertex in 3D space.
     glm::vec3   d_position;
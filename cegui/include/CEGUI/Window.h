@@ -33,6 +33,13 @@
 #include "CEGUI/NamedElement.h"
 #include "CEGUI/RenderedString.h"
 #include "CEGUI/InputEvent.h"
+#include "CEGUI/MemoryAllocator.h"
+#include "CEGUI/GeometryBufferPool.h"
+#include "CEGUI/GeometryCache.h"
+#include "CEGUI/InternedName.h"
+#include "CEGUI/Observable.h"
+#include <memory>
+#include <unordered_map>
 #include <unordered_set>
 
 #if defined(_MSC_VER)
@@ -43,6 +50,9 @@
 
 namespace CEGUI
 {
+class ClipRegion;
+class WindowHitTestIndex;
+class WindowStaticGroup;
 
 /*!
 \brief
@@ -132,7 +142,8 @@ public:
     classes.
 */
 class CEGUIEXPORT Window :
-    public NamedElement
+    public NamedElement,
+    public AllocatedObject<MemoryCategory::Window>
 {
 public:
     /*************************************************************************
@@ -202,6 +213,12 @@ public:
     static const String AutoWindowPropertyName;
     //! Name of property to access the DrawMode that is set for this Window, which decides in what draw call it will or will not be drawn.
     static const String DrawModeMaskPropertyName;
+    //! Name of property to access whether the Window indexes its children for hit testing.
+    static const String HitTestIndexEnabledPropertyName;
+    //! Name of property to access whether the Window draws its subtree as a static group.
+    static const String StaticGroupEnabledPropertyName;
+    //! Name of property to access whether the rotation of the Window is applied to its geometry.
+    static const String RotationUsingGeometryPropertyName;
 
     /*************************************************************************
         Event name constants
@@ -339,6 +356,14 @@ public:
      * WindowEventArgs::window set to the Window that is about to be destroyed.
      */
     static const String EventDestructionStarted;
+    /** Event fired when the Window is taken back by the WindowManager's pool
+     * of recycled windows instead of being destroyed, see
+     * WindowManager::setWindowPoolCapacity. Subscribe to this to reset state
+     * that a window handed out again should not keep.
+     * Handlers are passed a const WindowEventArgs reference with
+     * WindowEventArgs::window set to the Window that was recycled.
+     */
+    static const String EventRecycled;
     /** Event fired when a DragContainer is dragged in to the window's area.
      * Handlers are passed a const DragDropEventArgs reference with
      * WindowEventArgs::window set to the window over which a DragContainer has
@@ -504,7 +529,8 @@ public:
     */
     inline const String& getType() const
     {
-        return d_falagardType.empty() ? d_type : d_falagardType;
+        const String& falagardType = d_falagardType.getString();
+        return falagardType.empty() ? d_type.getString() : falagardType;
     }
 
     /*!
@@ -513,7 +539,7 @@ public:
     */
     inline const String& getFactoryType() const
     {
-        return d_type;
+        return d_type.getString();
     }
 
     /*!
@@ -831,7 +857,8 @@ public:
     \note
         WARNING! This function can be very expensive and should only be used
         when you have no other option available. If you decide to use it anyway,
-        make sure the window hierarchy from the entry point is small.
+        make sure the window hierarchy from the entry point is small, or that
+        it or one of its ancestors keeps an index by ID, see setIDIndexEnabled.
 
     \param ID
         unsigned int value specifying the ID code of the window to return a pointer to.
@@ -843,6 +870,38 @@ public:
     */
     Window* getChildRecursive(unsigned int ID) const;
 
+    /*!
+    \brief
+        Sets whether the Window keeps an index of all windows below it by ID.
+
+        With the index, the functions looking up children by ID are hash
+        lookups on this window and on every window below it, instead of
+        searching the children or the whole subtree. The index follows
+        windows below this one changing their ID or being attached and
+        detached. This pays off on the roots of large layouts that are
+        addressed by ID.
+
+        Windows with the ID 0, the default, are not indexed, so looking up
+        the ID 0 still searches in order.
+
+    \param setting
+        - true to keep and use the index.
+        - false to search the children, the default.
+    */
+    void setIDIndexEnabled(bool setting);
+
+    //! Returns whether the Window keeps an index of all windows below it by ID.
+    bool isIDIndexEnabled() const { return d_idIndex != nullptr; }
+
+    /*!
+    \brief
+        Return all windows attached below this one, in breadth-first order.
+
+        Meant for the script bindings, where walking the tree one child at a
+        time costs a crossing into C++ per window.
+    */
+    std::vector<Window*> getChildrenRecursive() const;
+
     /*!
     \brief
         return a pointer to the Window that currently has input focus starting
@@ -973,6 +1032,19 @@ public:
     */
     const Rectf& getInnerRectClipper() const;
 
+    /*!
+    \brief
+        Return whether the given child window may be seen within the area this
+        window shows its content in.
+
+        Children for which this returns false are skipped when drawing, and
+        also when updating unless their WindowUpdateMode is
+        WindowUpdateMode::Always. Their geometry is only built once they come
+        into view. The default implementation always returns true; windows
+        that scroll their content override it.
+    */
+    virtual bool isChildInView(const Window& child) const;
+
     /*!
     \brief
         Return a Rect that describes the rendering clipping rect for the Window.
@@ -1011,6 +1083,30 @@ public:
     */
     const Rectf& getHitTestRect() const;
 
+    /*!
+    \brief
+        Return the generation of the clipping state this window's clipper and
+        hit test rects depend on.
+
+        This is the latest generation of this window and of the ancestors it is
+        clipped by, so it changes whenever any of them is invalidated. Every
+        invalidation takes a new value from a global counter, which also lets
+        the result be reused while nothing at all was invalidated.
+    */
+    std::uint64_t getClippingGeneration() const;
+
+    /*!
+    \brief
+        Return whether geometry covering \a area, given relative to this
+        window, can be skipped because it would be clipped away entirely.
+
+        Only geometry created while the window buffers its geometry is culled;
+        at any other time this returns false. The window remembers that some
+        geometry was skipped and regenerates its geometry once a change of its
+        position or clipping may have made that area visible.
+    */
+    bool cullGeometry(const Rectf& area) const;
+
     /*!
     \brief
         return the Window that currently has inputs captured.
@@ -1109,6 +1205,84 @@ public:
                                      const bool allow_disabled = false,
                                      const Window* const exclude = nullptr) const;
 
+    /*!
+    \brief
+        Sets whether the Window keeps a spatial index of the hit test areas of
+        its children, see WindowHitTestIndex.
+
+        With the index getChildAtPosition and getTargetChildAtPosition only
+        test the children that can be hit at a position, instead of scanning
+        all of them. This pays off on windows with many children, such as
+        inventories or item views with thousands of item widgets.
+
+    \param setting
+        - true to keep and use the index.
+        - false to scan all children, the default.
+    */
+    void setHitTestIndexEnabled(bool setting);
+
+    //! Returns whether the Window keeps a spatial index of its children for hit testing.
+    bool isHitTestIndexEnabled() const { return d_hitTestIndex != nullptr; }
+
+    /*!
+    \brief
+        Sets whether the Window draws itself and all of its descendants as a
+        static group, see WindowStaticGroup.
+
+        The geometry of the whole subtree is then merged into a few combined
+        GeometryBuffers, which are queued instead of the buffers of every
+        single window. They are rebuilt whenever anything within the subtree
+        needs to be redrawn, so this pays off for mostly static content, such
+        as HUDs, without the memory and fill rate cost of a RenderingWindow.
+
+    \param setting
+        - true to draw the subtree as a static group.
+        - false to draw every window on its own, the default.
+    */
+    void setStaticGroupEnabled(bool setting);
+
+    //! Returns whether the Window draws itself and its descendants as a static group.
+    bool isStaticGroupEnabled() const { return d_staticGroup != nullptr; }
+
+    //! Returns the static group of the Window, or nullptr if it is not drawn as one.
+    const WindowStaticGroup* getStaticGroup() const { return d_staticGroup.get(); }
+
+    /*!
+    \brief
+        Sets whether the rotation of the Window is applied to the transforms
+        of its GeometryBuffers and those of its descendants, instead of
+        through a RenderingWindow.
+
+        By default a rotated Window gets an automatic RenderingWindow, so its
+        contents are drawn to a texture that is then rotated, which costs a
+        TextureTarget and a composition pass per rotated Window. With this
+        setting the geometry itself is rotated around the pivot, which suits
+        spinning icons and rotated HUD elements. Hit testing maps positions
+        through the inverse rotation.
+
+        The rotated geometry cannot be clipped to the rotated area of the
+        Window, so the Window and its descendants are clipped to the clipping
+        area of its parent instead. Rotations out of the screen plane are hit
+        tested without perspective. A Window that has a RenderingWindow anyway
+        keeps rotating it, and descendants with their own RenderingWindow are
+        composited unrotated.
+
+    \param setting
+        - true to rotate the geometry.
+        - false to rotate through an automatic RenderingWindow, the default.
+    */
+    void setRotationUsingGeometry(bool setting);
+
+    //! Returns whether the rotation of the Window is applied to its geometry.
+    bool isRotationUsingGeometry() const { return d_rotationUsingGeometry; }
+
+    /*!
+    \brief
+        Returns whether the Window currently applies a rotation of its own to
+        its geometry, see setRotationUsingGeometry.
+    */
+    bool isRotatingGeometry() const;
+
     /*!
     \brief
         return the parent of this Window.
@@ -1213,7 +1387,7 @@ public:
     */
     inline float getAutoRepeatDelay() const
     {
-        return d_repeatDelay;
+        return d_autoRepeatState ? d_autoRepeatState->d_delay : AutoRepeatState().d_delay;
     }
 
     /*!
@@ -1226,7 +1400,7 @@ public:
     */
     inline float getAutoRepeatRate() const
     {
-        return d_repeatRate;
+        return d_autoRepeatState ? d_autoRepeatState->d_rate : AutoRepeatState().d_rate;
     }
 
     /*!
@@ -1254,7 +1428,7 @@ public:
     */
     inline bool isUsingDefaultTooltip() const
     {
-        return !d_customTip;
+        return !d_tooltipData || !d_tooltipData->d_customTip;
     }
 
     /*!
@@ -1285,10 +1459,7 @@ public:
     \return
         String object holding the current tooltip text set for this window.
      */
-    inline const String& getTooltipText() const
-    {
-        return d_tooltipText;
-    }
+    const String& getTooltipText() const;
 
     /*!
     \brief
@@ -1351,6 +1522,54 @@ public:
     {
         return d_geometryBuffers;
     }
+
+    /*!
+    \brief
+        Return the pool that recycles the GeometryBuffers of this Window when
+        its geometry is rebuilt. Can be used to query pool hit rates.
+    */
+    const GeometryBufferPool& getGeometryBufferPool() const
+    {
+        return d_geometryBufferPool;
+    }
+
+    /*!
+    \brief
+        Return the cache holding the geometry of imagery this Window already
+        drew, such as the imagery of states it was in before. Falagard
+        ImagerySections append their geometry from this cache instead of
+        rebuilding it when they are drawn with the same inputs again.
+    */
+    GeometryCache& getGeometryCache()
+    {
+        return d_geometryCache;
+    }
+
+    //! \copydoc getGeometryCache
+    const GeometryCache& getGeometryCache() const
+    {
+        return d_geometryCache;
+    }
+
+    /*!
+    \brief
+        Set the effect applied directly to the geometry of this Window.
+
+        The effect modifies the vertices or parameters of the GeometryBuffers
+        of the window in the pass they are drawn in, so no RenderingWindow is
+        needed. The effect is not destroyed along with the window.
+
+    \param effect
+        Pointer to the InPlaceRenderEffect to use, or nullptr to remove the
+        current effect.
+    */
+    void setInPlaceRenderEffect(InPlaceRenderEffect* effect);
+
+    //! Returns the effect applied to the geometry of this Window, or nullptr.
+    InPlaceRenderEffect* getInPlaceRenderEffect() const
+    {
+        return d_inPlaceRenderEffect;
+    }
     
     /*!
     \brief
@@ -1359,7 +1578,7 @@ public:
     \param appendingGeomBuffers
         The GeometryBuffers that will be appended to the window's GeometryBuffers
     */
-    void appendGeometryBuffers(std::vector<GeometryBuffer*>& geomBuffers);
+    void appendGeometryBuffers(const std::vector<GeometryBuffer*>& geomBuffers);
 
     /*!
     \brief
@@ -1369,7 +1588,7 @@ public:
         String object holding the name of the look assigned to this window.
         Returns the empty string if no look is assigned.
     */
-    inline const String& getLookNFeel() const { return d_lookName; }
+    inline const String& getLookNFeel() const { return d_lookName.getString(); }
 
     /*!
     \brief
@@ -1736,6 +1955,42 @@ public:
     */
     void insertText(const String& text, const String::size_type position);
 
+    /*!
+    \brief
+        Erase \a length code units of the current text string of the Window,
+        starting at \a position.
+
+        Unlike modifying a copy of getText and passing it to setText, the text
+        is modified in place, which matters for large texts.
+
+    \param position
+        The index of the first code unit to be erased.
+
+    \param length
+        The number of code units to be erased.
+    */
+    void eraseText(const String::size_type position, const String::size_type length);
+
+    /*!
+    \brief
+        Replace \a length code units of the current text string of the Window,
+        starting at \a position, with \a text.
+
+        The text is modified in place and a single text changed notification
+        is fired.
+
+    \param position
+        The index of the first code unit to be replaced.
+
+    \param length
+        The number of code units to be replaced.
+
+    \param text
+        String object holding the text that replaces the erased code units.
+    */
+    void replaceText(const String::size_type position, const String::size_type length,
+                     const String& text);
+
     /*!
     \brief
         Append the string \a text to the currect text string for the Window
@@ -2284,6 +2539,18 @@ public:
     */
     virtual void setLookNFeel(const String& look);
 
+    /*!
+    \brief
+        Removes the current look'n'feel from the window, cleaning up everything
+        it added, including its AutoWindows. The window is left without a look
+        until setLookNFeel is called.
+
+    \note
+        This is intended for WidgetLookManager, which needs to clean windows up
+        with the previous definition of a look it reloads.
+    */
+    void releaseLookNFeel();
+
     /*!
     \brief
         Set the modal state for this Window.
@@ -2326,6 +2593,27 @@ public:
     */
     void draw(std::uint32_t drawModeMask = DrawModeMaskAll);
 
+    /*!
+    \brief
+        Appends to \a roots every window in this subtree, including this one,
+        that owns an invalidated RenderingWindow and will therefore regenerate
+        its content on the next draw. The geometry of each of these subtrees
+        can be generated independently via bufferSurfaceGeometry.
+    */
+    void collectInvalidatedSurfaceOwners(std::vector<Window*>& roots);
+
+    /*!
+    \brief
+        Generates the CPU side geometry of this window and all of its
+        descendants that draw to the same RenderingSurface, without queueing
+        it. Descendants owning a RenderingSurface of their own are skipped.
+        The next draw then only queues the geometry generated here.
+
+    \param drawModeMask
+        The draw mode mask the next draw will use.
+    */
+    void bufferSurfaceGeometry(std::uint32_t drawModeMask);
+
     /*!
     \brief
         Cause window to update itself and any attached children.  Client code
@@ -2346,6 +2634,41 @@ public:
     */
     virtual void update(float elapsed);
 
+    /*!
+    \brief
+        Update this window alone, leaving its children alone.
+
+        Used by GUIContext when selective updating is enabled and only this
+        window, rather than the whole subtree, asked for time pulses.
+
+    \param elapsed
+        float value indicating the number of seconds passed since the last
+        update.
+    */
+    virtual void updateWithoutChildren(float elapsed);
+
+    /*!
+    \brief
+        Return whether this window has ongoing work that needs time pulses,
+        such as cursor autorepeat, a RenderEffect or InPlaceRenderEffect,
+        subscribers of EventUpdated or a WindowRenderer that asks for updates.
+
+        When selective updating is enabled on the GUIContext, a window stays on
+        the update list for as long as this returns true. Subclasses that
+        override updateSelf should override this too.
+    */
+    virtual bool isUpdateRequired() const;
+
+    /*!
+    \brief
+        Ask the GUIContext to update this window on the next time pulses.
+
+        Has no effect unless selective updating is enabled on the context,
+        see GUIContext::setSelectiveUpdateEnabled. Call this whenever work
+        that makes isUpdateRequired return true is started.
+    */
+    void requestUpdates();
+
     /*!
     \brief
         Asks the widget to perform a clipboard copy to the provided clipboard
@@ -2459,7 +2782,7 @@ public:
         true if cursor pass through is enabled.
         false if cursor pass through is not enabled.
     */
-    void setCursorPassThroughEnabled(bool setting)   {d_cursorPassThroughEnabled = setting;}
+    void setCursorPassThroughEnabled(bool setting);
 
     /*!
     \brief
@@ -2706,6 +3029,64 @@ public:
         Name of the property you want to unban
     */
     void unbanPropertyFromXMLRecursive(const String& property_name);
+
+    /*!
+    \copydoc PropertySet::setProperties
+
+        Area changes caused by the values are deferred while they are set, so
+        the layout of the GUIContext is recomputed once afterwards.
+    */
+    void setProperties(const PropertyValueList& values) override;
+
+    //! A property value to set on a window of a tree, see applyPropertyChanges.
+    struct PropertyChange
+    {
+        //! Path of the window relative to the one applying the change, empty for itself.
+        String d_windowPath;
+        String d_propertyName;
+        String d_value;
+    };
+
+    /*!
+    \brief
+        Sets property values on this window and its descendants, in the order
+        given, e.g. to apply the difference between two versions of a layout.
+
+        Like setProperties, the layout is recomputed once after all values
+        were set. Consecutive changes of the same window look it up once.
+
+    \exception UnknownObjectException
+        Thrown if a window path or property does not exist. The changes before
+        it are applied, those after it are not.
+    */
+    void applyPropertyChanges(const std::vector<PropertyChange>& changes);
+
+    /*!
+    \brief
+        Binds the Property \a name of this Window to \a observable, replacing
+        an earlier binding of the Property to it.
+
+        The Property is set to the value of \a observable right away. Later
+        changes of the value are applied once per frame, before the layout is
+        updated, and only if the Property does not already hold the value, see
+        ObservableBase. The binding is removed when this Window or
+        \a observable is destroyed.
+
+    \exception UnknownObjectException
+        Thrown if the Window has no Property named \a name.
+    */
+    template<typename T>
+    void bindProperty(const String& name, Observable<T>& observable)
+    {
+        observable.addBinding(std::unique_ptr<PropertyBindingBase>(
+            new PropertyBinding<T>(observable, *this, getPropertyHandle<T>(name))));
+    }
+
+    //! Removes the binding of the Property \a name of this Window to \a observable.
+    void unbindProperty(const String& name, ObservableBase& observable)
+    {
+        observable.removeBinding(*this, name);
+    }
     
 
     /*!
@@ -2734,6 +3115,42 @@ public:
     */
     bool isPropertyBannedFromXML(const Property* property) const;
 
+    //! Target of a property link definition, resolved for one window.
+    struct PropertyLinkTarget
+    {
+        //! The target window, nullptr if it does not currently exist.
+        Window* d_window;
+        //! The target property of d_window.
+        Property* d_property;
+    };
+    //! Targets of a property link definition, in the order they were defined.
+    typedef std::vector<PropertyLinkTarget> PropertyLinkTargetList;
+
+    /*!
+    \brief
+        Return the targets the property link \a link resolved to for this
+        window, or nullptr if they are not cached.
+
+        Property link definitions are shared by all windows of a look, so
+        they cache their resolved targets on the window. The cache is
+        cleared whenever children are added to, removed from or renamed
+        within this window or any of its descendants, when the parent
+        changes and when the properties of a window change with its window
+        renderer or look.
+    */
+    std::shared_ptr<const PropertyLinkTargetList> getPropertyLinkTargets(const Property* link) const;
+
+    //! Cache the targets the property link \a link resolved to for this window.
+    void setPropertyLinkTargets(const Property* link,
+                                std::shared_ptr<const PropertyLinkTargetList> targets) const;
+
+    /*!
+    \brief
+        Clear the property link targets cached on this window and its
+        ancestors, which may link to properties of this window by name path.
+    */
+    void invalidatePropertyLinkTargets();
+
     /*!
     \brief
         Set the window update mode.  This mode controls the behaviour of the
@@ -2798,6 +3215,10 @@ public:
     \brief
         Clones this Window and returns the result
 
+        Property values, including those of auto windows, and user strings
+        are copied directly rather than through XML; properties shared by
+        both windows copy their native values without string conversions.
+
     \param
         deepCopy if true, even children are copied
 
@@ -2813,6 +3234,8 @@ public:
 
     //! return the GUIContext this window is associated with.
     GUIContext& getGUIContext() const;
+    //! return whether this window is associated with a GUIContext.
+    bool isInGUIContext() const { return getGUIContextPtr() != nullptr; }
     //! function used internally.  Do not call this from client code.
     void setGUIContext(GUIContext* context);
 
@@ -2959,6 +3382,8 @@ protected:
     // friend classes for construction / initialisation purposes (for now)
     friend class WindowManager; // FIXME for d_falagardType only
     friend class GUIContext;
+    friend class WindowHitTestIndex; // for d_drawList
+    friend class WindowStaticGroup; // for drawing the subtree
 
     /*************************************************************************
         Event trigger methods
@@ -2967,6 +3392,9 @@ protected:
     //! \copydoc Element::handleAreaChanges
     virtual uint8_t handleAreaChanges(bool moved, bool sized) override;
 
+    //! \copydoc Element::isScreenAreaChangeDeferred
+    bool isScreenAreaChangeDeferred() const override;
+
     /*!
     \brief
         Handler called when the window's position changes.
@@ -3192,6 +3620,18 @@ protected:
     */
     virtual void onDestructionStarted(WindowEventArgs& e);
 
+    /*!
+    \brief
+        Handler called when this window was taken back by the WindowManager's
+        pool of recycled windows instead of being destroyed.
+
+    \param e
+        WindowEventArgs object whose 'window' pointer field is set to the window
+        that triggered the event.  For this event the trigger window is always
+        'this'.
+    */
+    virtual void onRecycled(WindowEventArgs& e);
+
     /*!
     \brief
         Handler called when this window has become the active window.
@@ -3233,6 +3673,8 @@ protected:
     */
     void onChildRemoved(ElementEventArgs& e) override;
 
+    void onNameChanged(NamedElementEventArgs& e) override;
+
     /*!
     \brief
         Handler called when the cursor has entered this window's area.
@@ -3446,6 +3888,15 @@ protected:
     */
     virtual void updateSelf(float elapsed);
 
+    //! Updates this window without its children, see update.
+    void update_impl(float elapsed);
+
+    //! Asks the GUIContext to update this window along with all its children.
+    void requestSubtreeUpdates();
+
+    // overridden from EventSet, subscribing to EventUpdated needs updates
+    void notifyEventAdded(const Event& event) override;
+
     /*!
     \brief
         Perform the actual rendering for this Window.
@@ -3471,6 +3922,14 @@ protected:
     */
     void bufferGeometry(const RenderingContext& ctx, std::uint32_t drawModeMask);
 
+    /*!
+    \brief
+        Generates geometry ahead of drawSelf, as part of bufferSurfaceGeometry.
+        The default calls bufferGeometry; windows overriding drawSelf to not
+        draw themselves should override this to do nothing as well.
+    */
+    virtual void prepareGeometry(const RenderingContext& ctx, std::uint32_t drawModeMask);
+
     /*!
     \brief
         Perform drawing operations concerned with positioning, clipping and
@@ -3526,8 +3985,12 @@ protected:
 
     /*!
     \brief
-        Recursively inform all children that the clipping has changed and screen rects
-        need to be recached.
+        Inform the window that its clipping has changed and screen rects need
+        to be recached.
+
+        This does not visit the children. Windows clipped by this one compare
+        the clipping generation of their ancestors with the one their rects
+        were cached at and recache lazily, see getClippingGeneration.
     */
     void notifyClippingChanged();
 
@@ -3555,6 +4018,15 @@ protected:
     */
     virtual void cleanupChildren();
 
+    /*!
+    \brief
+        Bring the window back to a state in which it can be handed out again by
+        the WindowManager's pool of recycled windows: detach it from its parent,
+        release input and tooltips, clean up all children that are not auto
+        windows and finally fire EventRecycled.
+    */
+    void recycle();
+
     /*!
     \copydoc Element::addChild_impl
     */
@@ -3610,9 +4082,9 @@ protected:
         front of other windows in the group.
 
     \return
-        Nothing.
+        Index at which \a wnd was inserted into the drawing list.
     */
-    void addWindowToDrawList(Window& wnd, bool at_back = false);
+    size_t addWindowToDrawList(Window& wnd, bool at_back = false);
 
     /*!
     \brief
@@ -3640,6 +4112,24 @@ protected:
     */
     bool isTopOfZOrder() const;
 
+    //! Return the index of child \a wnd in the drawing list.
+    size_t getDrawListIndex(const Window& wnd) const;
+
+    /*!
+    \brief
+        Move the child at index \a from of the drawing list to index \a to,
+        shifting the children in between by one, and notify the children
+        whose position changed about the z-order change.
+    */
+    void moveInDrawList(size_t from, size_t to);
+
+    /*!
+    \brief
+        Notify the children at indices \a first to \a last of the drawing list
+        of a z-order change.
+    */
+    void notifyZChanged(size_t first, size_t last);
+
     //! transfer RenderingSurfaces to be owned by our target RenderingSurface.
     void transferChildSurfaces();
 
@@ -3682,6 +4172,39 @@ protected:
 
     bool isHitTargetWindow(const glm::vec2& position, bool allow_disabled) const;
 
+    /*!
+    \brief
+        Informs the hit test index of our parent that our hit area changed. If
+        \a ancestors is true the indices of all further ancestors are informed
+        too, as needed when our subtree changed. The GUIContext is told to
+        reconsider the window containing the cursor.
+    */
+    void invalidateHitTestIndexEntry(bool ancestors);
+
+    //! Informs the static groups of this window and its ancestors that the subtree changed.
+    void invalidateStaticGroups();
+
+    //! Windows by their ID, see setIDIndexEnabled.
+    typedef std::unordered_multimap<unsigned int, Window*> IDIndex;
+
+    //! Returns the closest window from this one up that keeps an index by ID, or nullptr.
+    const Window* getIDIndexOwner() const;
+
+    /*!
+    \brief
+        Returns the first window below this one with the ID \a ID in breadth
+        first order, or nullptr if there is none, using the index of \a owner,
+        which is this window or one of its ancestors. Only the children are
+        considered if \a childrenOnly is true.
+    */
+    Window* findIndexedDescendant(const Window& owner, unsigned int ID, bool childrenOnly) const;
+
+    //! Adds \a wnd and the windows below it to \a index.
+    static void addToIDIndex(IDIndex& index, Window& wnd);
+
+    //! Removes \a wnd and the windows below it from \a index.
+    static void removeFromIDIndex(IDIndex& index, const Window& wnd);
+
     /*************************************************************************
         Properties for Window base class
     *************************************************************************/
@@ -3730,6 +4253,63 @@ protected:
         Implementation Data
     *************************************************************************/
 
+    //! Tooltip settings of a window, see d_tooltipData.
+    struct TooltipData
+    {
+        //! Text string used as tip for this window.
+        String d_text;
+        //! Possible custom Tooltip for this window.
+        Tooltip* d_customTip = nullptr;
+        //! true if this Window created the custom Tooltip.
+        bool d_weOwnTip = false;
+    };
+
+    //! Auto-repeat settings and state of a window, see d_autoRepeatState.
+    struct AutoRepeatState
+    {
+        //! seconds before first repeat event is fired
+        float d_delay = 0.3f;
+        //! seconds between further repeats after delay has expired.
+        float d_rate = 0.06f;
+        //! implements repeating - tracks time elapsed.
+        float d_elapsed = 0.0f;
+        //! Cursor source we're tracking for auto-repeat purposes.
+        CursorInputSource d_pointerSource = CursorInputSource::NotSpecified;
+        //! implements repeating - is true after delay has elapsed.
+        bool d_repeating = false;
+    };
+
+    /*!
+        Rotation of the geometry on the target surface, combined from this
+        window and the ancestors rotating their geometry, see
+        d_geometryRotation. A position p on the surface is mapped to
+        d_rotation * (p - d_pivot) + d_pivot + d_offset.
+    */
+    struct GeometryRotation
+    {
+        glm::quat d_rotation;
+        glm::vec3 d_pivot;
+        //! Translation left by nested rotations around different pivots.
+        glm::vec3 d_offset;
+        //! Clipping region of the outermost window rotating the geometry.
+        Rectf d_clipRect;
+
+        bool operator==(const GeometryRotation& other) const
+        {
+            return d_rotation == other.d_rotation && d_pivot == other.d_pivot &&
+                d_offset == other.d_offset && d_clipRect == other.d_clipRect;
+        }
+    };
+
+    //! Returns the tooltip settings, allocating them if needed.
+    TooltipData& getTooltipData();
+    //! Returns the auto-repeat state, allocating it if needed.
+    AutoRepeatState& getAutoRepeatState();
+    //! Returns whether auto-repeat tracks a pressed cursor source.
+    bool isAutoRepeatTracking() const;
+    //! Returns the user strings, an empty collection if none was set.
+    const std::unordered_map<String, String>& getUserStrings() const;
+
     //! GUIContext.  Set when this window is used as a root window.
     GUIContext* d_guiContext;
     //! The WindowRenderer module that implements the Look'N'Feel specification
@@ -3738,8 +4318,6 @@ protected:
     RenderingSurface* d_surface;
     //! Holds pointer to the Window objects current cursor image.
     const Image* d_cursor;
-    //! Possible custom Tooltip for this window.
-    Tooltip* d_customTip;
     //! Holds pointer to the Window objects current Font.
     const Font* d_font;
     //! Pointer to a custom (user assigned) RenderedStringParser object.
@@ -3769,8 +4347,43 @@ protected:
     mutable Rectf d_innerRectClipper;
     //! area rect used for hit-testing against this window
     mutable Rectf d_hitTestRect;
+    //! Clipping generations the above rects were cached at, 0 if never cached
+    mutable std::uint64_t d_outerRectClipperGeneration = 0;
+    mutable std::uint64_t d_innerRectClipperGeneration = 0;
+    mutable std::uint64_t d_hitTestRectGeneration = 0;
+    //! Generation of the last invalidation of this window's own clipping
+    std::uint64_t d_clippingGeneration;
+    //! Cached result of getClippingGeneration and the global generation it was computed at
+    mutable std::uint64_t d_effectiveClippingGeneration = 0;
+    mutable std::uint64_t d_effectiveClippingGenerationCheck = 0;
+    //! Global source of clipping generations, increased by every invalidation
+    static std::uint64_t s_clippingGeneration;
+    //! The context running a selective update, nullptr outside of it.
+    static GUIContext* s_updatingContext;
+    //! Incremented by every selective update.
+    static std::uint64_t s_updatePulse;
     //! The clipping region which was set for this window.
     Rectf d_clippingRegion;
+    //! Returns d_clippingRegion relative to the window instead of its surface.
+    Rectf getLocalClippingRegion() const;
+    /*!
+        Returns whether nothing of the window itself can be seen, because its
+        clipping region is empty and none of its geometry ignores clipping.
+        Windows owning a RenderingWindow are never culled.
+    */
+    bool isDrawCulled() const;
+    //! Returns whether the window and all its visible descendants are culled.
+    bool isSubtreeCulled() const;
+    /*!
+        d_clippingRegion as shared with the GeometryBuffers of the window, or
+        the ClipRegion of the parent when both are clipped the same.
+    */
+    RefCounted<ClipRegion> d_clipRegion;
+
+    //! Visible area, relative to the window, geometry is culled against.
+    Rectf d_geometryCullRect;
+    //! Area covered on the parent's surface when this window was last drawn.
+    Rectf d_drawnSurfaceArea = Rectf(0, 0, 0, 0);
     //! Margin, only used when the Window is inside LayoutContainer class
     //!!!FIXME: move to LC? Too much memory wasted.
     UBox d_margin;
@@ -3782,29 +4395,51 @@ protected:
     std::uint32_t d_drawModeMask;
     //! User ID assigned to this Window
     unsigned int d_ID;
-    //! Cursor source we're tracking for auto-repeat purposes.
-    CursorInputSource d_repeatPointerSource;
     //! The mode to use for calling Window::update
     WindowUpdateMode d_updateMode;
+    //! The context whose update list holds this window, if any.
+    GUIContext* d_updateListContext = nullptr;
+    //! Value of s_updatePulse when this window was last updated.
+    std::uint64_t d_updatePulse = 0;
     //! The translation which was set for this window.
     glm::vec3 d_translation;
     //! Alpha transparency setting for the Window
     float d_alpha;
-    //! seconds before first repeat event is fired
-    float d_repeatDelay;
-    //! seconds between further repeats after delay has expired.
-    float d_repeatRate;
-    //! implements repeating - tracks time elapsed.
-    float d_repeatElapsed;
-
-    //! Holds a collection of named user string values.
-    std::unordered_map<String, String> d_userStrings;
+
+    //! Tooltip settings, allocated when the text or a custom tooltip is set.
+    std::unique_ptr<TooltipData> d_tooltipData;
+    //! Auto-repeat timing and state, allocated when first changed or used.
+    std::unique_ptr<AutoRepeatState> d_autoRepeatState;
+    //! Rotation of the geometry, allocated while the geometry is rotated.
+    std::unique_ptr<GeometryRotation> d_geometryRotation;
+    //! Holds a collection of named user string values, allocated on first set.
+    std::unique_ptr<std::unordered_map<String, String>> d_userStrings;
     //! collection of properties not to be written to XML for this window.
-    std::unordered_set<String> d_bannedXMLProperties;
+    std::unique_ptr<std::unordered_set<String>> d_bannedXMLProperties;
+    //! Targets of the property link definitions resolved for this window.
+    mutable std::unordered_map<const Property*,
+        std::shared_ptr<const PropertyLinkTargetList>> d_propertyLinkTargets;
     //! List of geometry buffers that cache the geometry drawn by this Window.
     std::vector<GeometryBuffer*> d_geometryBuffers;
+    //! Pool refilling the geometry buffers of a previous redraw.
+    GeometryBufferPool d_geometryBufferPool;
+    //! Geometry of imagery drawn before, kept across redraws.
+    GeometryCache d_geometryCache;
+    //! Effect applied to the geometry of this Window in the pass it is drawn in.
+    InPlaceRenderEffect* d_inPlaceRenderEffect = nullptr;
     //! Child window objects arranged in rendering order.
     std::vector<Window*> d_drawList;
+    /*!
+        Index of the first 'always on top' child in d_drawList, these follow
+        all other children.
+    */
+    size_t d_drawListTopmostBegin;
+    //! Spatial index of the children for hit testing, if enabled.
+    std::unique_ptr<WindowHitTestIndex> d_hitTestIndex;
+    //! Flattened geometry of the subtree, if drawn as a static group.
+    std::unique_ptr<WindowStaticGroup> d_staticGroup;
+    //! Windows below this one with a non zero ID by their ID, if enabled.
+    std::unique_ptr<IDIndex> d_idIndex;
 
     //! RenderedString representation of text string as ouput from a parser.
     mutable RenderedString d_renderedString;
@@ -3813,17 +4448,19 @@ protected:
     //! Shared instance of a parser to be used when rendering text verbatim.
     static DefaultRenderedStringParser d_defaultStringParser;
 
+    /*
+        The type and look names are shared by many windows, so they are kept
+        interned rather than copied into each window.
+    */
     //! type of Window (also the name of the WindowFactory that created us)
-    const String d_type;
+    const InternedName d_type;
     //! Type name of the window as defined in a Falagard mapping.
-    String d_falagardType;
+    InternedName d_falagardType;
     //! Name of the Look assigned to this window (if any).
-    String d_lookName;
+    InternedName d_lookName;
 
     //! Holds the text / label / caption for this Window.
     String d_textLogical;
-    //! Text string used as tip for this window.
-    String d_tooltipText;
 
     //! true when this window is an auto-window
     bool d_autoWindow : 1;
@@ -3843,8 +4480,26 @@ protected:
     bool d_clippedByParent : 1;
     //! true if window geometry cache needs to be regenerated.
     bool d_needsRedraw : 1;
+    /*!
+        true if only the translation, clipping or alpha of the cached geometry
+        changed, which is applied to the existing GeometryBuffers without
+        regenerating them.
+    */
+    bool d_needsTransformUpdate : 1;
+    //! true while the window buffers its geometry, see cullGeometry.
+    bool d_cullingGeometry : 1;
+    //! true if geometry was culled since the window last buffered its geometry.
+    mutable bool d_geometryCulled : 1;
+    //! Whether the children are to be updated along with this window.
+    bool d_subtreeUpdateRequested : 1;
+    //! true if the last geometry of the window had buffers drawn without clipping.
+    bool d_hasUnclippedGeometry : 1;
+    //! true if the rotation of the window is applied to the geometry.
+    bool d_rotationUsingGeometry : 1;
     //! holds setting for automatic creation of of surface (RenderingWindow)
     bool d_autoRenderingWindow : 1;
+    //! true if the auto RenderingWindow was evicted by the TextureResidencyManager.
+    bool d_autoRenderingWindowEvicted : 1;
     //! holds setting for stencil buffer usage in texture caching
     bool d_autoRenderingSurfaceStencilEnabled : 1;
     //! true if the Window inherits alpha from the parent Window
@@ -3870,14 +4525,10 @@ protected:
     bool d_cursorPassThroughEnabled : 1;
     //! whether pressed cursor will auto-repeat the down event.
     bool d_autoRepeat : 1;
-    //! implements repeating - is true after delay has elapsed,
-    bool d_repeating : 1;
 
     //! true if window will receive drag and drop related notifications
     bool d_dragDropTarget : 1;
 
-    //! true if this Window created the custom Tooltip.
-    bool d_weOwnTip : 1;
     //! whether tooltip text may be inherited from parent.
     bool d_inheritsTipText : 1;
     bool d_tooltipEnabled : 1;
@@ -3885,10 +4536,6 @@ protected:
     //! true if this window is allowed to write XML, false if not
     bool d_allowWriteXML : 1;
 
-    mutable bool d_outerRectClipperValid : 1;
-    mutable bool d_innerRectClipperValid : 1;
-    mutable bool d_hitTestRectValid : 1;
-
     //! specifies whether cursor inputs should be propagated to parent(s)
     bool d_propagatePointerInputs : 1;
 
@@ -3913,7 +4560,42 @@ protected:
 private:
 
     void updateTransformAndClipping();
+    /*!
+        Stores d_clippingRegion in d_clipRegion, sharing the ClipRegion of the
+        parent if it holds the same region and \a ownsSurface is false.
+    */
+    void updateClipRegion(bool ownsSurface);
     void updatePivot();
+    //! Returns the pivot in pixels, relative to the window.
+    glm::vec3 getPivotPixels() const;
+    //! Applies the rotation through the geometry or through a RenderingWindow.
+    void applyRotation();
+    /*!
+        Combines the geometry rotation of the parent with our own rotation,
+        if we rotate our geometry; \a ctx is our rendering context.
+    */
+    void updateGeometryRotation(const RenderingContext& ctx);
+    //! Updates the transforms of the subtree drawn to our target surface.
+    void updateSubtreeGeometryRotation();
+    /*!
+        Maps \a position through the inverse of our own rotation. Returns
+        false if the window is seen edge-on.
+    */
+    bool unrotatePosition(const glm::vec2& position, glm::vec2& out) const;
+    //! Applies translation, clipping region and effective alpha to all GeometryBuffers.
+    void updateGeometryBuffersTransform();
+    //! Returns the area this window covers on the surface its parent draws to.
+    Rectf getSurfaceArea(const RenderingContext& parentCtx) const;
+    /*!
+        Invalidates the areas of the parent's RenderingWindow that this window
+        covers now and covered when it was last drawn, optionally for all
+        descendants drawn along with it.
+    */
+    void invalidateSurfaceArea(bool includeChildren);
+    //! Implementation of invalidateSurfaceArea for a known target surface.
+    void invalidateSurfaceArea_impl(RenderingWindow& surface,
+                                    const RenderingContext& parentCtx,
+                                    bool includeChildren);
 };
 
 } // End of  CEGUI namespace section
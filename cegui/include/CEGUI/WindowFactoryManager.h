@@ -32,6 +32,8 @@
 #include "CEGUI/Singleton.h"
 #include "CEGUI/IteratorBase.h"
 #include "CEGUI/TplWindowFactory.h"
+#include "CEGUI/SharedMutex.h"
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -46,6 +48,11 @@ namespace CEGUI
 \brief
 	Class that manages WindowFactory objects
 
+    The lookups may be called from several threads at once, for instance by
+    layouts being loaded on other threads; factories, aliases and mappings
+    are only added and removed on the main thread. See WindowManager for the
+    complete threading rules.
+
 \todo
     I think we could clean up the mapping stuff a bit. Possibly make it more generic now
     with the window renderers and all.
@@ -440,6 +447,37 @@ public:
     */
     const FalagardWindowMapping& getFalagardMappingForType(const String& type) const;
 
+    /*!
+    \brief
+        The result of resolving a window type through aliases and falagard
+        mappings, as returned by resolveWindowType.
+    */
+    struct CEGUIEXPORT ResolvedWindowType
+    {
+        //! Factory creating the windows of the type.
+        WindowFactory* d_factory;
+        //! Falagard mapping of the type, nullptr if it is not a mapped type.
+        const FalagardWindowMapping* d_mapping;
+    };
+
+    /*!
+    \brief
+        Resolves the window type \a type to the factory creating its windows
+        and its falagard mapping, if any.
+
+        This gives in one call what getFactory, isFalagardMappedType and
+        getFalagardMappingForType return. The result is cached per type name
+        until a factory, alias or falagard mapping is added or removed, so
+        creating many windows of the same type only resolves it once.
+
+    \return
+        Reference to the cached result, valid until the next change of the
+        factories, aliases or falagard mappings.
+
+    \exception UnknownObjectException thrown if no factory, alias or mapping for \a type is registered.
+    */
+    const ResolvedWindowType& resolveWindowType(const String& type) const;
+
 private:
 	/*************************************************************************
 		Implementation Data
@@ -450,11 +488,20 @@ private:
     //! Type used for list of WindowFacory objects that we created ourselves
     typedef std::vector<WindowFactory*> OwnedWindowFactoryList;
 
+    //! Type used to cache the results of resolveWindowType.
+    typedef std::unordered_map<String, ResolvedWindowType> ResolvedTypeCache;
+
     static void addFactoryInternal(WindowFactory* factory);
 
 	WindowFactoryRegistry	d_factoryRegistry;			//!< The container that forms the WindowFactory registry
 	TypeAliasRegistry		d_aliasRegistry;			//!< The container that forms the window type alias registry.
     FalagardMapRegistry     d_falagardRegistry;         //!< Container that hold all the falagard window mappings.
+    //! Guards the registries, taken exclusively only while they are modified.
+    mutable SharedMutex d_registryMutex;
+    //! Results of resolveWindowType, cleared whenever the registries change.
+    mutable ResolvedTypeCache d_resolvedTypes;
+    //! Guards d_resolvedTypes between concurrent calls to resolveWindowType.
+    mutable std::mutex d_resolvedTypesMutex;
     //! Container that tracks WindowFactory objects we created ourselves.
     static OwnedWindowFactoryList  d_ownedFactories;
 
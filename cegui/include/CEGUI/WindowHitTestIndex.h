@@ -0,0 +1,163 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIWindowHitTestIndex_h_
+#define _CEGUIWindowHitTestIndex_h_
+
+#include "CEGUI/Rectf.h"
+#include <unordered_map>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class Window;
+
+/*!
+\brief
+    Uniform grid over the hit test areas of the children of a Window, used by
+    Window::getChildAtPosition to only test the children that can be hit at a
+    position instead of all of them.
+
+    A child is binned by its unclipped outer rect, extended by its hit test
+    rect (see Window::getHitTestRect) where that goes beyond it, when none of
+    its descendants can be hit outside of it, that is when all of them are
+    clipped by their parent and none of them, including the child itself,
+    renders to a RenderingWindow. Other children are tested at every position.
+    This relies on overrides of Window::isHit only ever narrowing the hit test
+    rect, and on overrides of Window::getHitTestRect_impl of clipped windows
+    staying within their parent's hit test rect, which holds for all of the
+    windows shipped with CEGUI.
+
+    The bounds are kept relative to the owner and are not clipped, so moving
+    the owner or changing its clipping, as scrolling a ScrolledContainer does,
+    leaves the cells as they are. The index is owned by its Window, which
+    reports changes to it. Children whose area changed are re-binned on the
+    next query, while changes to the draw order rebuild the whole index.
+*/
+class CEGUIEXPORT WindowHitTestIndex
+{
+public:
+    //! Constructor, \a owner is the Window whose children are indexed.
+    explicit WindowHitTestIndex(const Window& owner);
+
+    WindowHitTestIndex(const WindowHitTestIndex&) = delete;
+    WindowHitTestIndex& operator=(const WindowHitTestIndex&) = delete;
+
+    //! Marks the whole index for rebuilding, e.g. after the draw order changed.
+    void invalidate();
+
+    /*!
+    \brief
+        Marks the entry of \a child for updating, after its hit test rect or
+        anything within its subtree that may affect its hit area changed.
+    */
+    void invalidateChild(const Window& child);
+
+    /*!
+    \brief
+        Returns the children that may be hit at \a position, which is in the
+        coordinate space the children's hit test rects are in. The children
+        are ordered from front to back, like a reverse iteration of the draw
+        list. The list is valid until the next call.
+    */
+    const std::vector<Window*>& getCandidates(const glm::vec2& position);
+
+    //! Returns the number of grid cells, 0 if the index was not built yet.
+    std::size_t getCellCount() const { return d_cells.size(); }
+
+private:
+    //! Index entry of one child.
+    struct Entry
+    {
+        Window* d_window;
+        //! Area the child can be hit in relative to the owner, only meaningful if d_bounded
+        Rectf d_bounds;
+        //! Whether the child and its descendants can only be hit within d_bounds
+        bool d_bounded;
+        //! Whether the entry is listed in d_dirtyEntries
+        bool d_dirty;
+        //! Range of cells the entry was added to, if d_bounded
+        std::size_t d_firstColumn, d_lastColumn, d_firstRow, d_lastRow;
+    };
+
+    //! Rebuilds the index from the draw list of the owner.
+    void rebuild();
+    //! Re-bins the dirty entries whose bounds changed, or rebuilds the index if most did.
+    void updateDirtyEntries();
+    //! Returns the position of the owner the bounds of the entries are relative to.
+    glm::vec2 getOrigin() const;
+    //! Returns the bounds of the entry of \a child relative to \a origin.
+    static Rectf getEntryBounds(const Window& child, bool bounded, const glm::vec2& origin);
+    //! Adds entry \a index to the cells covered by its bounds.
+    void insertEntry(std::size_t index);
+    //! Removes entry \a index from the cells it was added to.
+    void removeEntry(std::size_t index);
+    //! Returns the column of the cell covering \a x, clamped to the grid.
+    std::size_t getColumn(float x) const;
+    //! Returns the row of the cell covering \a y, clamped to the grid.
+    std::size_t getRow(float y) const;
+    //! Returns whether \a wnd and its descendants can only be hit within its hit test rect.
+    static bool isSubtreeBounded(const Window& wnd);
+
+    //! Window whose children are indexed.
+    const Window& d_owner;
+    //! Entries in the order of the owner's draw list.
+    std::vector<Entry> d_entries;
+    //! Maps the children to their entries.
+    std::unordered_map<const Window*, std::size_t> d_entryIndices;
+    //! Indices of the entries overlapping each cell, ascending, row by row.
+    std::vector<std::vector<std::size_t>> d_cells;
+    //! Indices of the entries that have to be tested everywhere, ascending.
+    std::vector<std::size_t> d_unboundedEntries;
+    //! Indices of the entries to update before the next query.
+    std::vector<std::size_t> d_dirtyEntries;
+    //! Result of the last query.
+    std::vector<Window*> d_candidates;
+    //! Area covered by the grid relative to the owner, positions outside map to the border cells.
+    Rectf d_area;
+    //! Size of a single cell.
+    glm::vec2 d_cellSize;
+    std::size_t d_columns;
+    std::size_t d_rows;
+    //! Whether the index reflects the owner's draw list.
+    bool d_valid;
+    //! Clipping generation of the owner the index was built at.
+    std::uint64_t d_clippingGeneration;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIWindowHitTestIndex_h_
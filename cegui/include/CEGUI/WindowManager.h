@@ -31,8 +31,15 @@
 
 #include "CEGUI/Singleton.h"
 #include "CEGUI/EventSet.h"
+#include "CEGUI/PreparsedXML.h"
 
 #include <vector>
+#include <map>
+#include <unordered_map>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -41,6 +48,8 @@
 
 namespace CEGUI
 {
+class GUILayout_xmlHandler;
+
 /*!
 \brief
 	The WindowManager class describes an object that manages creation and lifetime of Window objects.
@@ -49,6 +58,26 @@ namespace CEGUI
 	of Window that is to be created, there must exist a WindowFactory object which is registered with the
 	WindowFactoryManager.  Additionally, the WindowManager tracks every Window object created, and can be
 	used to access those Window objects by name.
+
+    Threading: CEGUI is driven from a single thread, the main thread, with one
+    exception. Window trees that are not attached to anything may be built on
+    other threads by calling loadLayoutFromFile, loadLayoutFromContainer,
+    loadLayoutFromString or createWindow there. The root returned must then be
+    passed to the main thread, which alone may attach it to a GUIContext,
+    destroy it or otherwise use it along with the rest of the GUI.  For this to
+    be safe:
+    - the lookups of WindowManager, WindowFactoryManager, ImageManager and
+      WidgetLookManager may run concurrently; their registries are guarded by
+      SharedMutex and only modified on the main thread.
+    - the schemes, imagesets, fonts and looks used by a layout must be loaded
+      before a thread starts loading it, and may not be destroyed or replaced
+      while it does.
+    - the iterators of the managers are not guarded and may only be used on
+      the main thread while no layout is being loaded.
+    - loadLayoutFromFile reads the file through the ResourceProvider, which
+      must then report ResourceProvider::isThreadSafe.
+    - EventWindowCreated, and the events of the windows being built, are fired
+      on the loading thread; EventSet::BatchScope is per thread.
 */
 class CEGUIEXPORT WindowManager : public Singleton<WindowManager>,
                                   public EventSet
@@ -178,8 +207,12 @@ public:
     \brief
         Creates a set of windows (a GUI layout) from the information in the specified XML.
 
+        \a source may also hold a compiled layout as written by
+        writePreparsedLayoutToStream, which is then used without parsing
+        any XML.
+
     \param source
-        RawDataContainer holding the XML source
+        RawDataContainer holding the XML source or the compiled layout
 
     \param callback
         PropertyCallback function to be called for each Property element loaded from the layout.  This is
@@ -198,6 +231,14 @@ public:
 	\brief
 		Creates a set of windows (a GUI layout) from the information in the specified XML file.
 
+        If pre-parsed files are enabled and a file named \a filename followed
+        by PreparsedFileSuffix is available in the resource group, the layout
+        compiled into it is used instead of parsing the XML.  Otherwise, if
+        the layout cache is enabled, the layout is compiled on its first load
+        and kept, so loading it again skips the XML parser.  The XML is read
+        either way and any compiled layout not made from its current content
+        is ignored.
+
 	\param filename
 		String object holding the filename of the XML file to be processed.
 
@@ -215,11 +256,51 @@ public:
 	\return
 		Pointer to the root Window object defined in the layout.
 
+    \note
+        This may be called on a thread other than the main thread, see the
+        threading notes of WindowManager.
+
 	\exception FileIOException			thrown if something goes wrong while processing the file \a filename.
 	\exception InvalidRequestException	thrown if \a filename appears to be invalid.
 	*/
 	Window*	loadLayoutFromFile(const String& filename, const String& resourceGroup = "", PropertyCallback* callback = nullptr, void* userdata = nullptr);
 
+    //! Function called by loadLayoutFromFileAsync with the root of the loaded layout.
+    typedef std::function<void(Window* root)> LayoutLoadedCallback;
+
+    /*!
+    \brief
+        Creates a GUI layout from an XML file without waiting for the file to
+        be read.
+
+        The file is loaded by ResourceProvider::loadRawDataContainerAsync.
+        The windows are created, and \a callback is called, from
+        System::injectTimePulse once the file was read. The layout cache is
+        used as by loadLayoutFromFile, pre-parsed files are not. If the
+        layout can not be loaded the error is logged and \a callback
+        receives nullptr.
+
+    \param filename
+        String object holding the filename of the XML file to be processed.
+
+    \param resourceGroup
+        Resource group identifier to be passed to the resource provider when loading the layout file.
+
+    \param callback
+        Function called with the root Window of the layout, may be empty.
+
+    \param propertyCallback
+        PropertyCallback function to be called for each Property element loaded from the layout.
+
+    \param userdata
+        Client code data pointer passed to the PropertyCallback function.
+
+    \exception InvalidRequestException	thrown if \a filename appears to be invalid.
+    */
+    void loadLayoutFromFileAsync(const String& filename, const String& resourceGroup,
+        LayoutLoadedCallback callback, PropertyCallback* propertyCallback = nullptr,
+        void* userdata = nullptr);
+
     /*!
     \brief
         Creates a set of windows (a GUI layout) from the information in the specified XML.
@@ -263,6 +344,32 @@ public:
     */
     void cleanDeadPool(void);
 
+    /*!
+    \brief
+        Destroys windows placed in the dead pool until the time budget set
+        with setDeadPoolTimeBudget is used up. The remaining windows are
+        destroyed by later calls.
+
+        System calls this once per frame after rendering all GUIContexts, so
+        that destroying a large number of windows is spread over several
+        frames. At least one window is destroyed per call. The GeometryBuffers
+        of the destroyed windows are released together at the end of the call.
+    */
+    void cleanDeadPoolWithinBudget();
+
+    /*!
+    \brief
+        Sets the time, in microseconds, cleanDeadPoolWithinBudget may spend
+        destroying windows. 0, the default, destroys all of them at once.
+    */
+    void setDeadPoolTimeBudget(std::uint32_t microseconds) { d_deadPoolTimeBudget = microseconds; }
+
+    //! Returns the time, in microseconds, cleanDeadPoolWithinBudget may spend.
+    std::uint32_t getDeadPoolTimeBudget() const { return d_deadPoolTimeBudget; }
+
+    //! Returns the number of windows in the dead pool awaiting destruction.
+    std::size_t getDeadPoolSize() const { return d_deathrow.size(); }
+
     /*!
     \brief
         Writes a full XML window layout, starting at the given Window to the given OutStream.
@@ -382,6 +489,100 @@ public:
     */
     bool isLocked() const;
 
+    /*!
+    \brief
+        Set how many destroyed windows of the given type are kept for reuse.
+
+        While the capacity for a type is not reached, destroying a window of
+        that type does not destroy it; the window is detached from its parent,
+        its non-auto children are cleaned up, Window::EventRecycled is fired
+        and it is put into a pool keyed by type and look.  The next
+        createWindow for the same type and look hands this window back under
+        the new name, skipping the factory, property and look initialisation.
+
+        Recycled windows keep their properties and event subscriptions, so
+        handlers of Window::EventRecycled should reset whatever the window
+        should not keep.  EventWindowDestroyed and EventWindowCreated are
+        fired as usual when a window enters and leaves the pool.
+
+    \param type
+        The type of the windows as returned by Window::getType, which is the
+        type passed to createWindow.
+
+    \param capacity
+        Maximum number of pooled windows of the type per look.  0, the
+        default, disables pooling for the type and destroys its pooled windows.
+    */
+    void setWindowPoolCapacity(const String& type, std::size_t capacity);
+
+    //! Return the maximum number of pooled windows of the given type per look.
+    std::size_t getWindowPoolCapacity(const String& type) const;
+
+    //! Return the number of windows of the given type currently pooled.
+    std::size_t getPooledWindowCount(const String& type) const;
+
+    //! Destroy all windows currently pooled, leaving the capacities as they are.
+    void clearWindowPool();
+
+    /*!
+    \brief
+        Parses the layout file \a filename and writes its compiled form to a
+        stream.  Store it as \a filename followed by PreparsedFileSuffix, next
+        to \a filename, to have it used by loadLayoutFromFile, or pass it to
+        loadLayoutFromContainer.
+
+    \param out_stream
+        OutStream where the binary data should be sent. It must be opened in
+        binary mode.
+
+    \exception FileIOException    thrown if there was some problem accessing or parsing the file \a filename
+    */
+    void writePreparsedLayoutToStream(const String& filename, OutStream& out_stream,
+                                      const String& resourceGroup = "") const;
+
+    //! Sets whether loadLayoutFromFile uses pre-parsed files. Enabled by default.
+    void setPreparsedFilesEnabled(bool enabled) { d_preparsedFilesEnabled = enabled; }
+    //! Returns whether loadLayoutFromFile uses pre-parsed files.
+    bool isPreparsedFilesEnabled() const { return d_preparsedFilesEnabled; }
+
+    /*!
+    \brief
+        Sets whether loadLayoutFromFile keeps the compiled form of every
+        layout file it loads. Enabled by default; disabling it also clears
+        the cache.
+    */
+    void setLayoutCacheEnabled(bool enabled);
+    //! Returns whether loadLayoutFromFile keeps the compiled layouts it loads.
+    bool isLayoutCacheEnabled() const { return d_layoutCacheEnabled; }
+    //! Removes all compiled layouts kept by loadLayoutFromFile.
+    void clearLayoutCache();
+
+    /*!
+    \brief
+        Creates a set of windows from the layout in the specified file by
+        cloning a template of it.
+
+        The first call for a file loads the layout with loadLayoutFromFile and
+        keeps the resulting windows as the template of the file, which is not
+        attached to any GUIContext.  Every call returns a Window::clone of the
+        template, so spawning the same layout many times neither parses XML
+        nor converts property values from strings.  Changes to the layout file
+        are not noticed once its template exists.
+
+    \return
+        Pointer to the root Window of the new copy of the layout.
+
+    \exception FileIOException          thrown if something goes wrong while processing the file \a filename.
+    \exception InvalidRequestException  thrown if \a filename appears to be invalid.
+    */
+    Window* createLayoutFromTemplate(const String& filename, const String& resourceGroup = "");
+
+    //! Destroys the templates kept by createLayoutFromTemplate.
+    void destroyLayoutTemplates();
+
+    //! Suffix appended to the name of a layout file to get the name of its compiled form.
+    static const String PreparsedFileSuffix;
+
 private:
     /*************************************************************************
         Implementation Methods
@@ -395,19 +596,66 @@ private:
     //! function to set up RenderEffect on a window
     void initialiseRenderEffect(Window* wnd, const String& effect) const;
 
+    //! Take a pooled window of the given type and look, or return nullptr.
+    Window* takeWindowFromPool(const String& type, const String& look);
+
+    //! Put the window into the pool if its type is pooled and there's room.
+    bool recycleWindow(Window* window);
+
+    //! Destroy the given pooled windows for good.
+    void destroyPooledWindows(std::vector<Window*>& windows);
+
+    /*!
+    \brief
+        Creates the windows of the layout in \a xmlData through \a handler,
+        using or filling the layout cache and, if \a usePreparsedFile is
+        true, the pre-parsed file of \a filename. A recording written by
+        PreparsedXML::write in \a xmlData is replayed as it is.
+    */
+    void buildLayout(GUILayout_xmlHandler& handler, const RawDataContainer& xmlData,
+        const String& filename, const String& group, bool usePreparsedFile);
+
+    //! Destroys the window added to the dead pool last.
+    void destroyDeadWindow();
+
     /*************************************************************************
 		Implementation Data
 	*************************************************************************/
     typedef std::vector<Window*> WindowVector; //!< Type to use for a collection of Window pointers.
 
+    //! Guards the registry, the pools and the name counter against loaders.
+    mutable std::mutex d_registryMutex;
     //! collection of created windows.
 	WindowVector d_windowRegistry;
     WindowVector d_deathrow; //!< Collection of 'destroyed' windows.
+    //! Time, in microseconds, cleanDeadPoolWithinBudget may spend, 0 for no limit.
+    std::uint32_t d_deadPoolTimeBudget;
 
     std::uint32_t d_uid_counter;  //!< Counter used to generate unique window names.
     static String d_defaultResourceGroup;   //!< holds default resource group
     //! count of times WM is locked against new window creation.
-    unsigned int    d_lockCount;
+    std::atomic<unsigned int> d_lockCount;
+
+    //! Type to use for the pools of recycled windows, keyed by type and look.
+    typedef std::map<std::pair<String, String>, WindowVector> WindowPoolMap;
+    //! Pools of recycled windows.
+    WindowPoolMap d_windowPool;
+    //! Maximum number of pooled windows per type and look, keyed by type.
+    std::map<String, std::size_t> d_windowPoolCapacities;
+    //! Whether windows being destroyed should bypass the pools.
+    bool d_windowPoolSuspended;
+
+    //! Whether loadLayoutFromFile uses pre-parsed files.
+    bool d_preparsedFilesEnabled;
+    //! Whether loadLayoutFromFile keeps the layouts it compiles.
+    bool d_layoutCacheEnabled;
+    //! Compiled layouts loaded from files, keyed by resource group and filename.
+    //! Entries are never modified, so loaders may keep replaying a replaced one.
+    std::unordered_map<String, std::shared_ptr<const PreparsedXML> > d_layoutCache;
+    //! Guards d_layoutCache.
+    std::mutex d_layoutCacheMutex;
+    //! Root windows of the layout templates, keyed by resource group and filename.
+    std::unordered_map<String, Window*> d_layoutTemplates;
 
 public:
 	/*************************************************************************
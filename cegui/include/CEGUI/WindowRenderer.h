@@ -30,6 +30,7 @@
 #define _CEGUIWindowRenderer_h_
 
 #include "CEGUI/String.h"
+#include "CEGUI/MemoryAllocator.h"
 #include <vector>
 
 #if defined(_MSC_VER)
@@ -43,7 +44,8 @@ namespace CEGUI
 \brief
     Base-class for the assignable WindowRenderer object
 */
-class CEGUIEXPORT WindowRenderer
+class CEGUIEXPORT WindowRenderer :
+    public AllocatedObject<MemoryCategory::Window>
 {
 public:
     /*************************************************************************
@@ -132,6 +134,14 @@ public:
     //! perform any time based updates for this WindowRenderer.
     virtual void update(float /*elapsed*/) {}
 
+    /*!
+    \brief
+        Return whether update needs to be called for ongoing work, such as an
+        animation. Renderers that start such work call Window::requestUpdates
+        on their window, see GUIContext::setSelectiveUpdateEnabled.
+    */
+    virtual bool isUpdateRequired() const { return false; }
+
     /*!
     \brief
         Perform any updates needed because the given font's render size has
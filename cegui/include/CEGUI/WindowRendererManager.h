@@ -31,7 +31,10 @@
 
 #include "CEGUI/Singleton.h"
 #include "CEGUI/TplWindowRendererFactory.h"
+#include "CEGUI/SharedMutex.h"
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -41,6 +44,8 @@
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+class FactoryModule;
+
 class CEGUIEXPORT WindowRendererManager :
     public Singleton<WindowRendererManager>
 {
@@ -61,6 +66,8 @@ public:
         Accessors
     *************************************************************************/
     bool isFactoryPresent(const String& name) const;
+    //! Return whether the factory for \a name was added, ignoring lazy modules.
+    bool isFactoryRegistered(const String& name) const;
     WindowRendererFactory* getFactory(const String& name) const;
 
     /*************************************************************************
@@ -102,6 +109,26 @@ public:
     void addFactory(WindowRendererFactory* wr);
     void removeFactory(const String& name);
 
+    /*!
+    \brief
+        Makes the WindowRenderer types of \a module available without creating
+        their factories.
+
+        The factory for a type of the module is only created and added when
+        the type is first looked up, so a window renderer set costs nothing
+        at load time for the types that are never used.  Modules are searched
+        in the order they were added.  The module must stay loaded until it
+        is removed with removeLazyFactoryModule.
+    */
+    void addLazyFactoryModule(FactoryModule& module);
+
+    /*!
+    \brief
+        Stops adding factories of \a module on demand.  Factories of the
+        module that were already added stay registered.
+    */
+    void removeLazyFactoryModule(FactoryModule& module);
+
     /*************************************************************************
         Factory usage
     *************************************************************************/
@@ -114,11 +141,21 @@ private:
     *************************************************************************/
     static void addFactoryInternal(WindowRendererFactory* factory);
 
+    //! Adds the factory for \a name from a lazy module, returns false if none has it.
+    bool addLazyFactory(const String& name) const;
+
     /*************************************************************************
         Implementation data
     *************************************************************************/
     typedef std::unordered_map<String, WindowRendererFactory*> WR_Registry;
     WR_Registry d_wrReg;
+    //! Guards d_wrReg, windows may be created on several threads.
+    mutable SharedMutex d_registryMutex;
+
+    //! Modules whose factories are added when first looked up.
+    std::vector<FactoryModule*> d_lazyModules;
+    //! Guards d_lazyModules, recursive as adding a factory looks it up first.
+    mutable std::recursive_mutex d_lazyModulesMutex;
 
     //! Container type to hold WindowRenderFacory objects that we created.
     typedef std::vector<WindowRendererFactory*> OwnedFactoryList;
@@ -29,6 +29,7 @@
 
 #include "CEGUI/WindowRendererSets/Core/Module.h"
 #include "CEGUI/widgets/Editbox.h"
+#include <vector>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -157,9 +158,12 @@ public:
 
     // overridden from EditboxWindowRenderer base class.
     size_t getTextIndexFromPosition(const glm::vec2& pt) const override;
+    bool updateCaretGeometry() override;
     // overridden from WindowRenderer class
     void update(float elapsed) override;
+    bool isUpdateRequired() const override;
     bool handleFontRenderSizeChange(const Font* const font) override;
+    void onDetach() override;
 
 protected:
     //! helper to draw the base imagery (container and what have you)
@@ -203,7 +207,13 @@ protected:
     void renderCaret(const ImagerySection& imagery,
                      const Rectf& text_area,
                      const float text_offset,
-                     const float extent_to_caret) const;
+                     const float extent_to_caret);
+    //! return whether the caret geometry can be moved from where it was created to \a caret_rect.
+    bool isCaretMovable(const ImagerySection& imagery,
+                        const Rectf& text_area,
+                        const Rectf& caret_rect) const;
+    //! show, hide and move the caret geometry through the transform of its buffers.
+    void updateCaretTransform();
 
     bool isUnsupportedFormat(const HorizontalTextFormatting format);
 
@@ -219,6 +229,12 @@ protected:
     bool d_showCaret;
     //! horizontal formatting.  Only supports left, right, and centred.
     HorizontalTextFormatting d_textFormatting;
+    //! buffers of the window holding the caret geometry, empty if not tracked.
+    std::vector<GeometryBuffer*> d_caretBuffers;
+    //! area the caret geometry was created for.
+    Rectf d_caretRenderedRect;
+    //! area the caret is currently shown at.
+    Rectf d_caretRect;
 };
 
 } // End of  CEGUI namespace section
@@ -29,6 +29,7 @@
 
 #include "CEGUI/WindowRendererSets/Core/Module.h"
 #include "CEGUI/widgets/MultiLineEditbox.h"
+#include <vector>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -96,6 +97,8 @@ public:
     Rectf getTextRenderArea(void) const override;
     void createRenderGeometry() override;
     void update(float elapsed) override;
+    bool isUpdateRequired() const override;
+    bool updateCaretGeometry() override;
 
     //! return whether the blinking caret is enabled.
     bool isCaretBlinkEnabled() const;
@@ -108,6 +111,7 @@ public:
 
     // overridden from base class
     bool handleFontRenderSizeChange(const Font* const font) override;
+    void onDetach() override;
 
 protected:
     /*!
@@ -131,6 +135,15 @@ protected:
     */
     void cacheCaretImagery(const Rectf& textArea);
 
+    //! Return the area of the caret, or false if it has none.
+    bool getCaretArea(const Rectf& textArea, Rectf& caretArea) const;
+
+    //! return whether the caret geometry can be moved from where it was created to \a caretArea.
+    bool isCaretMovable(const Rectf& textArea, const Rectf& caretArea) const;
+
+    //! show, hide and move the caret geometry through the transform of its buffers.
+    void updateCaretTransform();
+
     /*!
     \brief
         Render text lines.
@@ -188,6 +201,12 @@ protected:
     float d_caretBlinkElapsed;
     //! true if caret should be shown.
     bool d_showCaret;
+    //! buffers of the window holding the caret geometry, empty if not tracked.
+    std::vector<GeometryBuffer*> d_caretBuffers;
+    //! area the caret geometry was created for.
+    Rectf d_caretRenderedArea;
+    //! area the caret is currently shown at.
+    Rectf d_caretArea;
 };
 
 } // End of  CEGUI namespace section
@@ -28,6 +28,8 @@
 #define _FalProgressBar_h_
 
 #include "CEGUI/WindowRendererSets/Core/Module.h"
+#include "CEGUI/widgets/ProgressBar.h"
+#include <vector>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -37,6 +39,8 @@
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+    class StateImagery;
+
     /*!
     \brief
         ProgressBar class for the FalagardBase module.
@@ -61,8 +65,13 @@ namespace CEGUI
               Determines whether the progress grows in the opposite direction to
               what is considered 'usual'.  Set to "true" to have progress grow
               towards the left or bottom of the progress area.  Optional.
+
+        The progress imagery is drawn for the whole ProgressArea and then
+        clipped to the current progress, so that a change of the progress
+        only clips the existing geometry again instead of redrawing the
+        ProgressBar.
     */
-    class COREWRSET_API FalagardProgressBar : public WindowRenderer
+    class COREWRSET_API FalagardProgressBar : public ProgressBarWindowRenderer
     {
     public:
         static const String TypeName;     //! type name for this widget.
@@ -72,6 +81,7 @@ namespace CEGUI
             Constructor
         */
         FalagardProgressBar(const String& type);
+        ~FalagardProgressBar();
 
         bool isVertical() const;
         bool isReversed() const;
@@ -80,11 +90,31 @@ namespace CEGUI
         void setReversed(bool setting);
 
         void createRenderGeometry() override;
+        bool updateProgressGeometry() override;
 
     protected:
+        void onDetach() override;
+
+        //! Return the part of \a progressRect covered by the current progress.
+        Rectf getProgressClipper(const Rectf& progressRect) const;
+        //! Render the progress imagery, bypassing the geometry cache of the window.
+        void renderProgressImagery(const StateImagery& imagery, const Rectf& clipper);
+        //! Keep unclipped copies of d_progressBuffers, returns false if they can't be created.
+        bool createProgressTemplates();
+        void destroyProgressTemplates();
+        //! Clip the progress geometry to the current progress.
+        void clipProgressGeometry();
+
         // settings to make this class universal.
         bool d_vertical;    //!< True if progress bar operates on the vertical plane.
         bool d_reversed;    //!< True if progress grows in the opposite direction to usual (i.e. to the left / downwards).
+
+        //! Buffers of the window holding the progress imagery, valid until the next geometry pass.
+        std::vector<GeometryBuffer*> d_progressBuffers;
+        //! Unclipped copy of each buffer in d_progressBuffers.
+        std::vector<GeometryBuffer*> d_progressTemplates;
+        //! The ProgressArea the progress geometry was drawn for.
+        Rectf d_progressRect;
     };
 
 } // End of  CEGUI namespace section
@@ -626,8 +626,10 @@ namespace CEGUI
         void adjustSizeToContent_wordWrap_keepingAspectRatio(const LeftAlignedRenderedString& orig_str,
           USize& size_func, float content_max_width, float window_max_width,
           float epsilon);
-        void adjustSizeToContent_wordWrap_notKeepingAspectRatio(USize& size_func, float content_max_width,
-          float window_max_width, float epsilon);
+        void adjustSizeToContent_wordWrap_notKeepingAspectRatio(const LeftAlignedRenderedString& orig_str,
+          USize& size_func, float content_max_width, float window_max_width, float epsilon);
+        float getWindowWidthAdjustedToContent(float height, float content_max_width,
+          float content_max_height, float window_max_width, float epsilon);
         void adjustSizeToContent_direct();
     };
 
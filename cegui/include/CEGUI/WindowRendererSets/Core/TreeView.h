@@ -101,6 +101,9 @@ private:
     void renderTreeItem(TreeView* tree_view, const Rectf& items_area,
         glm::vec2& item_pos, const TreeViewItemRenderingState* item_to_render,
         size_t depth);
+    //! Renders a single item at \a item_pos and returns the indent of its text.
+    float renderItem(TreeView* tree_view, const Rectf& items_area,
+        const glm::vec2& item_pos, TreeViewItemRenderingState* item);
 
     const ImagerySection* d_subtreeExpanderImagery;
     const ImagerySection* d_subtreeCollapserImagery;
@@ -0,0 +1,139 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIWindowStaticGroup_h_
+#define _CEGUIWindowStaticGroup_h_
+
+#include "CEGUI/Base.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class GeometryBuffer;
+class Window;
+struct RenderingContext;
+
+/*!
+\brief
+    Flattened geometry of a Window and all of its descendants, used by windows
+    with Window::setStaticGroupEnabled to queue their whole subtree as a few
+    combined GeometryBuffers.
+
+    When built, the geometry buffers of the windows of the subtree are taken
+    in drawing order and neighbouring buffers drawn with the same shader,
+    textures and blend mode are merged into one combined buffer, with their
+    translation and alpha applied to the vertices. Since the clipping of the
+    merged buffers is replaced by the clipping of the owner, only buffers whose
+    geometry lies within both their own clipping region and the owner's are
+    merged; all others are queued as they are, between the combined buffers,
+    so the drawing order never changes.
+
+    The owner reports any change within the subtree that requires a redraw,
+    after which the group is built again the next time it is drawn. A subtree
+    containing windows that draw to a RenderingSurface or queue of their own
+    can not be flattened and is drawn normally.
+*/
+class CEGUIEXPORT WindowStaticGroup
+{
+public:
+    //! Constructor, \a owner is the Window whose subtree is flattened.
+    explicit WindowStaticGroup(Window& owner);
+    ~WindowStaticGroup();
+
+    WindowStaticGroup(const WindowStaticGroup&) = delete;
+    WindowStaticGroup& operator=(const WindowStaticGroup&) = delete;
+
+    //! Marks the group for rebuilding, after something within the subtree changed.
+    void invalidate() { d_valid = false; }
+
+    //! Returns whether the group reflects the current geometry of the subtree.
+    bool isValid() const { return d_valid; }
+
+    /*!
+    \brief
+        Queues the flattened geometry of the subtree on the surface of \a ctx,
+        building it first if needed.
+
+    \return
+        - true if the geometry was queued.
+        - false if the subtree can not be flattened, in which case nothing was
+          queued and the owner has to be drawn normally.
+    */
+    bool draw(const RenderingContext& ctx, std::uint32_t drawModeMask);
+
+    //! Returns the number of buffers queued by draw, including the combined ones.
+    std::size_t getBufferCount() const { return d_buffers.size(); }
+
+    //! Returns the number of combined buffers created by the group.
+    std::size_t getCombinedBufferCount() const { return d_combinedBuffers.size(); }
+
+private:
+    //! Builds the group, returns false if the subtree can not be flattened.
+    bool rebuild(const RenderingContext& ctx, std::uint32_t drawModeMask);
+    //! Returns whether the visible descendants of \a wnd all draw to the surface and queue of \a ctx.
+    bool isFlattenable(const Window& wnd, const RenderingContext& ctx) const;
+    //! Buffers the geometry of \a wnd and its descendants and appends it to the group.
+    void addWindow(Window& wnd, const RenderingContext& ctx, std::uint32_t drawModeMask);
+    /*!
+    \brief
+        Appends \a buffer, drawn at \a translation, to the group, merging it
+        into a combined buffer if possible.
+    */
+    void addBuffer(GeometryBuffer& buffer, const glm::vec3& translation);
+    //! Returns whether the geometry of \a buffer lies within its and the owner's clipping regions.
+    bool isWithinClippingRegions(const GeometryBuffer& buffer, const glm::vec3& translation) const;
+    //! Destroys the combined buffers and empties the group.
+    void clear();
+
+    //! Window whose subtree is flattened.
+    Window& d_owner;
+    //! Buffers queued by draw, combined ones and those that could not be merged.
+    std::vector<GeometryBuffer*> d_buffers;
+    //! Buffers created to hold merged geometry, owned by the group.
+    std::vector<GeometryBuffer*> d_combinedBuffers;
+    //! Whether the last entry of d_buffers is a combined buffer.
+    bool d_lastBufferCombined;
+    //! Draw mode mask the group was built for.
+    std::uint32_t d_drawModeMask;
+    //! Whether the group reflects the current geometry of the subtree.
+    bool d_valid;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIWindowStaticGroup_h_
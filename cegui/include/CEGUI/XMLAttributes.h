@@ -28,7 +28,7 @@
 #define _CEGUIXMLAttributes_h_
 
 #include "CEGUI/String.h"
-#include <unordered_map>
+#include <vector>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -56,6 +56,18 @@ namespace CEGUI
          */
         virtual ~XMLAttributes(void);
 
+        /*!
+        \brief
+            XMLAttributes copy constructor.
+
+            Attributes added with addView() are copied into String objects,
+            so the copy stays valid once the parser buffer is gone.
+         */
+        XMLAttributes(const XMLAttributes& other);
+
+        //! Copies the attributes of \a other, see the copy constructor.
+        XMLAttributes& operator=(const XMLAttributes& other);
+
         /*!
         \brief
             Adds an attribute to the attribute block.  If the attribute value already exists, it is replaced with
@@ -71,6 +83,28 @@ namespace CEGUI
             Nothing.
          */
         void add(const String& attrName, const String& attrValue);
+
+        /*!
+        \brief
+            Adds an attribute whose name and value are null terminated UTF-8
+            strings owned by the caller, typically pointing into the buffer of
+            an XML parser.  If the attribute already exists, its value is
+            replaced.
+
+            The strings are not copied; String objects are only created when
+            getName() or getValue() is called for the attribute, while the
+            getValueAs* functions read the value directly.  The strings must
+            therefore stay unchanged for as long as the attribute block is
+            used without being copied, which for parsers means until
+            XMLHandler::elementStart returns.
+
+        \param attrName
+            Null terminated UTF-8 name of the attribute.
+
+        \param attrValue
+            Null terminated UTF-8 value of the attribute.
+         */
+        void addView(const char* attrName, const char* attrValue);
         
         /*!
         \brief
@@ -111,8 +145,7 @@ namespace CEGUI
             Return the name of an attribute based upon its index within the attribute block.
 
         \note
-            Nothing is specified about the order of elements within the attribute block.  Elements
-            may not, for example, appear in the order they were specified in the XML file.
+            Attributes are kept in the order in which they were added.
 
         \param index
             zero based index of the attribute whos name is to be returned.
@@ -129,9 +162,8 @@ namespace CEGUI
             Return the value string of an attribute based upon its index within the attribute block.
 
         \note
-            Nothing is specified about the order of elements within the attribute block.  Elements
-            may not, for example, appear in the order they were specified in the XML file.
-        
+            Attributes are kept in the order in which they were added.
+
         \param index
             zero based index of the attribute whos value string is to be returned.
 
@@ -231,8 +263,39 @@ namespace CEGUI
         float getValueAsFloat(const String& attrName, float def = 0.0f) const;
 
     protected:
-        typedef std::unordered_map<String, String> AttributeMap;
-        AttributeMap    d_attrs;
+        /*!
+        \brief
+            A single attribute.  While a view pointer is set, it holds the
+            string and the matching String member is not yet created.
+        */
+        struct Attribute
+        {
+            mutable const char* d_nameView;
+            mutable const char* d_valueView;
+            mutable String d_name;
+            mutable String d_value;
+        };
+
+        typedef std::vector<Attribute> AttributeList;
+
+        /*!
+        \brief
+            Returns the index of the attribute named \a attrName, given as a
+            null terminated UTF-8 string, or getCount() if there is none.
+        */
+        size_t findIndex(const char* attrName) const;
+        //! Returns the index of the attribute named \a attrName, or getCount() if there is none.
+        size_t findIndex(const String& attrName) const;
+        //! Creates the String objects of all attributes still held as views.
+        void materialiseViews() const;
+        //! Returns the UTF-8 name of \a attr, using \a buffer if a conversion is needed.
+        static const char* getNameChars(const Attribute& attr, std::string& buffer);
+        //! Returns the UTF-8 value of \a attr, using \a buffer if a conversion is needed.
+        static const char* getValueChars(const Attribute& attr, std::string& buffer);
+        //! Throws the InvalidRequestException for a failed conversion of \a attrName.
+        void throwConversionError(const String& attrName, const char* typeName) const;
+
+        AttributeList   d_attrs;
     };
 
 } // End of  CEGUI namespace section
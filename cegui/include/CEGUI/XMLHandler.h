@@ -63,7 +63,8 @@ public:
 
     /*!
     \brief
-        Takes given RawDataContainer containing XML and handles it
+        Takes given RawDataContainer containing XML and handles it. A
+        recording written by PreparsedXML::write is replayed instead.
 
     This is basically a convenience function used by NamedXMLResourceManager
 
@@ -29,6 +29,9 @@
 
 #include "CEGUI/PropertySet.h"
 
+#include <cstdint>
+#include <memory>
+
 namespace CEGUI
 {
     /*!
@@ -124,6 +127,11 @@ namespace CEGUI
             defaulting to "true" to allow validation.
             Only needed if xml validation should be disallowed once.
 
+        \note
+            Parsers returning an object from createChunkedParse are fed with the
+            chunks the ResourceProvider reads, see ResourceProvider::readRawDataChunks.
+            The others get the whole file loaded into a RawDataContainer.
+
         \return
             Nothing.
          */
@@ -164,6 +172,36 @@ namespace CEGUI
         const String& getIdentifierString() const;
 
     protected:
+        /*!
+        \brief
+            State of a parse that is fed with consecutive chunks of the XML
+            data, see createChunkedParse.
+        */
+        class ChunkedParse
+        {
+        public:
+            virtual ~ChunkedParse() {}
+
+            //! Parses the next chunk of the XML data.
+            virtual void parseChunk(const std::uint8_t* data, size_t size) = 0;
+
+            //! Completes the parse after the last chunk was passed.
+            virtual void finish() = 0;
+        };
+
+        /*!
+        \brief
+            Creates the state for a parse of XML data that is passed in
+            consecutive chunks.
+
+            parseXMLFile streams files through the returned object, so that
+            parsing starts before the file was read completely and no copy of
+            the whole file is needed. The default returns nullptr, for parsers
+            that can only parse complete documents via parseXML.
+        */
+        virtual std::unique_ptr<ChunkedParse> createChunkedParse(XMLHandler& handler,
+            const String& schemaName, bool allowXmlValidation);
+
         /*!
         \brief
             abstract method which initialises the XMLParser ready for use.
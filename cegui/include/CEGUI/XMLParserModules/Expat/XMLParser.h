@@ -57,6 +57,12 @@ public:
     void parseXML(XMLHandler& handler, const RawDataContainer& source, const String& schemaName, bool /*allowXmlValidation*/) override;
 
 protected:
+    //! Chunked parse feeding the chunks to an Expat parser.
+    class ExpatChunkedParse;
+
+    std::unique_ptr<ChunkedParse> createChunkedParse(XMLHandler& handler,
+        const String& schemaName, bool allowXmlValidation) override;
+
     // Implementation of protected abstract interface.
     bool initialiseImpl(void) override;
     // Implementation of protected abstract interface.
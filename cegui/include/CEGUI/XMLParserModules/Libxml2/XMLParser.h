@@ -56,6 +56,12 @@ public:
     void parseXML(XMLHandler& handler, const RawDataContainer& source, const String& schemaName, bool /*allowXmlValidation*/);
 
 protected:
+    //! Chunked parse feeding the chunks to a libxml2 push parser.
+    class LibxmlChunkedParse;
+
+    std::unique_ptr<ChunkedParse> createChunkedParse(XMLHandler& handler,
+        const String& schemaName, bool allowXmlValidation);
+
     // implementation of abstract members of base class
     bool initialiseImpl(void);
     void cleanupImpl(void);
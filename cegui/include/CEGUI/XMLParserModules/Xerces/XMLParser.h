@@ -55,6 +55,9 @@
 #include <xercesc/sax2/DefaultHandler.hpp>
 #include <xercesc/sax2/SAX2XMLReader.hpp>
 #include <xercesc/sax2/XMLReaderFactory.hpp>
+#include <xercesc/framework/XMLGrammarPool.hpp>
+
+#include <unordered_map>
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -163,9 +166,36 @@ namespace CEGUI
         bool isXmlValidationEnabled(void) const
             { return d_xmlValidationEnabled; }
 
+        /*!
+        \brief
+            Returns whether xml validation is allowed by default.
+
+            This is the case in debug builds, and in release builds when CEGUI
+            was configured with CEGUI_XERCES_VALIDATE_IN_RELEASE. Validation can
+            still be switched at runtime via setXmlValidationEnabled.
+        */
+        static bool isXmlValidationEnabledByDefault();
+
+        /*!
+        \brief
+            Discards the compiled schema grammars cached by previous parses.
+
+            Each schema is loaded and compiled only once and the result is
+            reused by all later parses validating against it. Call this after
+            changing the schema files or the schema resource group, so that
+            they are loaded again.
+        */
+        void clearSchemaCache();
+
     protected:
-        static void initialiseSchema(XERCES_CPP_NAMESPACE::SAX2XMLReader* reader, const String& schemaName);
-        static XERCES_CPP_NAMESPACE::SAX2XMLReader* createReader(XERCES_CPP_NAMESPACE::DefaultHandler& handler);
+        //! Map of schema names to the grammar pool holding the compiled schema.
+        typedef std::unordered_map<String, XERCES_CPP_NAMESPACE::XMLGrammarPool*> GrammarPoolMap;
+
+        static void initialiseSchema(XERCES_CPP_NAMESPACE::SAX2XMLReader* reader, const String& schemaName, bool loadGrammar);
+        static XERCES_CPP_NAMESPACE::SAX2XMLReader* createReader(XERCES_CPP_NAMESPACE::DefaultHandler& handler,
+                                                                 XERCES_CPP_NAMESPACE::XMLGrammarPool* grammarPool);
+        static void destroyReader(XERCES_CPP_NAMESPACE::SAX2XMLReader* reader,
+                                  XERCES_CPP_NAMESPACE::XMLGrammarPool* grammarPool);
         static void doParse(XERCES_CPP_NAMESPACE::SAX2XMLReader* parser, const RawDataContainer& source);
 
         // Implementation of abstract interface.
@@ -176,6 +206,8 @@ namespace CEGUI
         static String d_defaultSchemaResourceGroup;
         //! holds whether xml validation is allowed or not.
         bool d_xmlValidationEnabled;
+        //! grammar pools of the schemas loaded so far.
+        GrammarPoolMap d_grammarPools;
         //! Property for accessing the default schema resource group ID.
         static XercesParserProperties::SchemaDefaultResourceGroup
             s_schemaDefaultResourceGroupProperty;
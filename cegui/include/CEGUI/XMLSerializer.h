@@ -45,7 +45,10 @@ namespace CEGUI
     This class hides the complexity of formatting valid XML files. The
     class provides automatic substitution of entities, XML indenting
     in respect of the spaces. It does not contains any codes specific
-    to CEGUI taking appart the CEGUI::String class. The following
+    to CEGUI taking appart the CEGUI::String class. The document is
+    composed as UTF-8 in an internal buffer, which is written to the
+    stream whenever the outermost tag is closed, when it grows large and
+    when the serializer is destroyed. The following
     example show the code needed to exports parts of an XML document
     similar to what can be found in a layout.
     
@@ -151,6 +154,48 @@ namespace CEGUI
         \return 
             True if all previous operations where successfull 
         */
+        /*!
+        \brief
+            A position in the document that the output can be rolled back to.
+
+        \see XMLSerializer::checkpoint
+        */
+        struct Checkpoint
+        {
+            size_t d_bufferSize;
+            unsigned int d_tagCount;
+            size_t d_depth;
+            bool d_needClose;
+            bool d_lastIsText;
+        };
+
+        /*!
+        \brief
+            Remembers the current position in the document, so that what is
+            written afterwards can be discarded with rollBack().
+
+            Nothing is written to the stream while a checkpoint is held. Every
+            checkpoint must be released by either rollBack() or commit(), in
+            the reverse order they were taken, and the tags opened after it
+            must be closed by then.
+        */
+        Checkpoint checkpoint();
+
+        //! Discards everything written since \a point was taken and releases it.
+        void rollBack(const Checkpoint& point);
+
+        //! Keeps everything written since \a point was taken and releases it.
+        void commit(const Checkpoint& point);
+
+        /*!
+        \brief
+            Writes the buffered document to the stream.
+
+        \return
+            A reference to the current object for chaining operation
+        */
+        XMLSerializer& flush();
+
         operator bool () const
         {
             return false == d_error;
@@ -174,20 +219,25 @@ namespace CEGUI
         bool d_needClose; //!< Store whether the next operation need to close the tag or not 
         bool d_lastIsText; //!< Store whether the last operation was a text node or not 
         OutStream& d_stream; //!< A reference to the stream object use
-        std::vector<String> d_tagStack; //!< Store the tag stack for correct closing of the tags. 
+        std::string d_buffer; //!< UTF-8 output not yet written to the stream
+        std::string d_tagNames; //!< UTF-8 names of the open tags, one after another
+        std::vector<size_t> d_tagStarts; //!< Offset of each open tag's name in d_tagNames
+        std::string d_scratch; //!< Conversion buffer for non UTF-8 strings
+        size_t d_checkpointCount; //!< Number of checkpoints held
   
         /*!
-        \brief put padding in the stream before line data 
+        \brief put padding in the buffer before line data 
         */
         void indentLine();
+        //! Returns \a str as UTF-8, converted into d_scratch if needed.
+        const std::string& toUtf8(const String& str);
         /*!
-        \brief convert special char to there corresponding entity in text data. 
-        */
-        static String convertEntityInText(const String& text);
-        /*!
-        \brief convert special char into entities including line ending for use in attributes.
+        \brief append text to the buffer, converting special chars to there
+            corresponding entities; line endings too for use in attributes.
         */
-        static String convertEntityInAttribute(const String& attributeValue);
+        void appendEscaped(const String& text, bool inAttribute);
+        //! Writes the buffer to the stream unless a checkpoint is held.
+        void flushBuffer();
         
 
         // Disabled operation 
@@ -138,6 +138,24 @@ public:
     virtual bool handleFontRenderSizeChange(Window& window,
                                             const Font* font) const;
 
+    //! Adds the names of the window properties this component reads to \a properties.
+    virtual void gatherPropertyReferences(std::unordered_set<String>& properties) const;
+
+    /*!
+    \brief
+        Adds the values the geometry of this component depends on when drawn
+        for \a srcWindow to \a key: the destination area, whether it is
+        culled, the final colours and whatever the component resolves through
+        the window.
+
+    \param baseRect
+        Rect used as the base for the ComponentArea, or nullptr to use the
+        area of \a srcWindow.
+    */
+    void addGeometryCacheKey(const Window& srcWindow, const Rectf* baseRect,
+                             const ColourRect* modColours, bool clipToDisplay,
+                             GeometryCacheKey& key) const;
+
 protected:
     /*!
     \brief
@@ -152,6 +170,10 @@ protected:
                          const ColourRect* modCols,
                          ColourRect& cr) const;
 
+    //! Adds the values resolved through \a srcWindow by the subclass to \a key.
+    virtual void addGeometryCacheKey_impl(const Window& srcWindow,
+                                          GeometryCacheKey& key) const;
+
     //! Function to do main render caching work.
     virtual void addImageRenderGeometryToWindow_impl(
         Window& srcWindow, Rectf& destRect,
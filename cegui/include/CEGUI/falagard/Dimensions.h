@@ -30,6 +30,10 @@
 #include "./Enums.h"
 #include "../UDim.h"
 #include "../Rectf.h"
+#include "../ResourceHandle.h"
+#include <vector>
+#include <unordered_set>
+#include <cstdint>
 
 namespace CEGUI
 {
@@ -97,6 +101,9 @@ public:
     virtual bool handleFontRenderSizeChange(Window& window,
                                             const Font* font) const;
 
+    //! Adds the names of the window properties this BaseDim reads to \a properties.
+    virtual void gatherPropertyReferences(std::unordered_set<String>& properties) const;
+
     /*!
     \brief
         Get a lower bound for this dimension as an affine function of "type".
@@ -194,6 +201,7 @@ public:
     void setNextOperand(const BaseDim* operand);
 
     bool handleFontRenderSizeChange(Window& window, const Font* font) const override;
+    void gatherPropertyReferences(std::unordered_set<String>& properties) const override;
 
     // Implementation of the base class interface
     float getValue(const Window& wnd) const override;
@@ -325,8 +333,10 @@ protected:
     void writeXMLElementName_impl(XMLSerializer& xml_stream) const override;
     void writeXMLElementAttributes_impl(XMLSerializer& xml_stream) const override;
 
-    //! name of the Image.
-    String d_imageName;
+    //! the Image, referred to by name.
+    ImageHandle d_image;
+
+    friend class DimensionProgram;
 };
 
 //! ImageDimBase subclass that accesses an image fetched via a property.
@@ -355,6 +365,8 @@ public:
     //! set the name of the property accessed by this ImagePropertyDim.
     void setSourceProperty(const String& property_name);
 
+    void gatherPropertyReferences(std::unordered_set<String>& properties) const override;
+
     // Implementation of the base class interface
     BaseDim* clone() const override;
 
@@ -366,6 +378,8 @@ protected:
 
     //! name of the property from which to fetch the image name.
     String d_propertyName;
+    //! the Image named by the property when it was last accessed.
+    ImageHandle d_image;
 };
 
 /*!
@@ -608,8 +622,8 @@ protected:
     const Font* getFontObject(const Window& window) const;
 
 private:
-    //! Name of Font.  If empty font will be taken from Window.
-    String d_font;
+    //! Font, referred to by name.  If the name is empty font will be taken from Window.
+    FontHandle d_font;
     //! String to measure for extents, if empty will use window text.
     String d_text;
     //! String to hold the name of the window to use for fetching missing font and/or text.
@@ -725,6 +739,8 @@ public:
     */
     void setSourceDimension(DimensionType dim);
 
+    void gatherPropertyReferences(std::unordered_set<String>& properties) const override;
+
     // Implementation of the base class interface
     float getValue(const Window& wnd) const override;
     float getValue(const Window& wnd, const Rectf& container) const override;
@@ -744,6 +760,81 @@ private:
     DimensionType d_type;
 };
 
+/*!
+\brief
+    A tree of BaseDim objects compiled into a flat program.
+
+    Operators, absolute and unified dimensions as well as dimensions of images
+    referred to by name are turned into instructions evaluated on a small
+    stack, without any virtual calls. Operators on constant operands are
+    folded into a single constant. All other dimensions, such as PropertyDim,
+    FontDim and WidgetDim, are kept as instructions calling
+    BaseDim::getValue of the node.
+
+    The program refers to the nodes of the compiled tree, which therefore has
+    to outlive the program and must not be modified while it is in use.
+*/
+class CEGUIEXPORT DimensionProgram
+{
+public:
+    DimensionProgram();
+
+    //! Compiles the tree of dimensions rooted at \a dim, which may be nullptr.
+    void compile(const BaseDim* dim);
+
+    //! Evaluates the program, same as BaseDim::getValue(wnd) of the compiled tree.
+    float evaluate(const Window& wnd) const;
+
+    //! Evaluates the program, same as BaseDim::getValue(wnd, container) of the compiled tree.
+    float evaluate(const Window& wnd, const Rectf& container) const;
+
+    //! Return whether the program was folded into a single constant.
+    bool isConstant() const;
+
+    //! Return the number of instructions of the program.
+    size_t getInstructionCount() const;
+
+    //! The largest stack that programs are evaluated with.
+    static const size_t MaxStackDepth = 32;
+
+private:
+    enum class OpCode : std::uint8_t
+    {
+        //! pushes d_value.
+        Constant,
+        //! pushes d_udim relative to the width of the window or container.
+        UnifiedWidth,
+        //! pushes d_udim relative to the height of the window or container.
+        UnifiedHeight,
+        //! pushes a dimension of the image of the ImageDim in d_node.
+        Image,
+        //! pops two values and pushes the result of d_operator.
+        Operator,
+        //! pushes the value of d_node.
+        Node
+    };
+
+    struct Instruction
+    {
+        OpCode d_opCode;
+        DimensionOperator d_operator;
+        float d_value;
+        UDim d_udim;
+        const BaseDim* d_node;
+    };
+
+    //! Appends the instructions for \a dim and returns the stack depth they need.
+    size_t compileNode(const BaseDim* dim);
+    void addConstant(float value);
+    float evaluate(const Window& wnd, const Rectf* container) const;
+
+    std::vector<Instruction> d_instructions;
+    //! Root of the compiled tree, evaluated directly if the stack would overflow.
+    const BaseDim* d_root;
+    //! Whether the program needs more than MaxStackDepth entries.
+    bool d_stackOverflow;
+};
+
 /*!
 \brief
     Class representing some kind of dimension.
@@ -822,11 +913,25 @@ public:
     bool handleFontRenderSizeChange(Window& window,
                                     const Font* font) const;
 
+    //! Adds the names of the window properties this Dimension reads to \a properties.
+    void gatherPropertyReferences(std::unordered_set<String>& properties) const;
+
+    //! Return the value of this Dimension, evaluated by its compiled program.
+    float getValue(const Window& wnd) const;
+
+    //! Return the value of this Dimension within \a container, evaluated by its compiled program.
+    float getValue(const Window& wnd, const Rectf& container) const;
+
+    //! Return the program the value of this Dimension is compiled into.
+    const DimensionProgram& getProgram() const;
+
 private:
     //! Pointer to the value for this Dimension.
     BaseDim* d_value;
     //! What we represent.
     DimensionType d_type;
+    //! d_value compiled into a flat program.
+    DimensionProgram d_program;
 };
 
 /*!
@@ -947,6 +1052,13 @@ public:
     //! perform any processing required due to the given font having changed.
     bool handleFontRenderSizeChange(Window& window, const Font* font) const;
 
+    /*!
+    \brief
+        Adds the names of the window properties this ComponentArea reads to
+        \a properties, following a named area source to its definition.
+    */
+    void gatherPropertyReferences(std::unordered_set<String>& properties) const;
+
     /*!
     \brief
         Get a lower bound for the width of this area as an affine function of
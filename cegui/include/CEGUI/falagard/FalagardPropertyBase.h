@@ -59,7 +59,8 @@ protected:
     void setNative_impl(PropertyReceiver* receiver,
                         typename Helper::pass_type /*value*/) override
     {
-        if (d_writeCausesLayout)
+        // only lay out again if an area of the look depends on the property
+        if (d_writeCausesLayout && isLayoutAffected(*static_cast<Window*>(receiver)))
             static_cast<Window*>(receiver)->performChildLayout(false, false);
 
         if (d_writeCausesRedraw)
@@ -29,6 +29,7 @@
 
 #include "CEGUI/Window.h"
 #include "CEGUI/falagard/XMLEnumHelper.h"
+#include <unordered_set>
 
 namespace CEGUI
 {
@@ -94,6 +95,13 @@ public:
         return !d_propertySource.empty();
     }
 
+    //------------------------------------------------------------------------//
+    void gatherPropertyReferences(std::unordered_set<String>& properties) const
+    {
+        if (isFetchedFromProperty())
+            properties.insert(d_propertySource);
+    }
+
     //------------------------------------------------------------------------//
     void writeXMLToStream(XMLSerializer& xml_stream) const
     {
@@ -38,6 +38,8 @@
 
 namespace CEGUI
 {
+struct ImageRenderSettings;
+
 /*!
 \brief
     Class that encapsulates information for a frame with background
@@ -47,6 +49,10 @@ namespace CEGUI
     (stretched, tiled or aligned) between the corner pieces for a particular
     edge, the background image will cover the inner rectangle formed by the edge
     images and can be formatted in both dimensions.
+
+    When consecutive frame images are BitmapImages sharing a texture, as is
+    usual for images of one imageset, all their quads, tiles included, are
+    written to a single GeometryBuffer.
 */
 class CEGUIEXPORT FrameComponent : public FalagardComponentBase
 {
@@ -349,6 +355,8 @@ public:
 
     bool operator==(const FrameComponent& rhs) const;
 
+    // overridden from ComponentBase.
+    void gatherPropertyReferences(std::unordered_set<String>& properties) const override;
 
     //! Default value for the HorzFormat elements of the FrameComponent
     static const HorizontalFormatting HorizontalFormattingDefault;
@@ -385,12 +393,27 @@ protected:
         const CEGUI::ColourRect* modColours,
         const Rectf* clipper, bool clipToDisplay) const override;
 
-    std::vector<GeometryBuffer*> createRenderGeometryForImage(
+    void addGeometryCacheKey_impl(const Window& srcWindow,
+                                  GeometryCacheKey& key) const override;
+
+    //! Geometry of the frame images created so far, see appendImageGeometry.
+    struct ImageBatch;
+
+    void createRenderGeometryForImage(
         const Image* image,
         VerticalImageFormatting vertFmt,
         HorizontalFormatting horzFmt,
         Rectf& destRect, const ColourRect& colours,
-        const Rectf* clipper, bool clipToDisplay) const;
+        const Rectf* clipper, bool clipToDisplay, ImageBatch& batch) const;
+
+    /*!
+    rief
+        Creates the geometry of a frame image, appending its quads to the
+        buffer of the previous image whenever both are BitmapImages with the
+        same texture and shader.
+    */
+    static void appendImageGeometry(const Image* image,
+        const ImageRenderSettings& renderSettings, ImageBatch& batch);
 
     FormattingSetting<VerticalImageFormatting>   d_leftEdgeFormatting;
     FormattingSetting<VerticalImageFormatting>   d_rightEdgeFormatting;
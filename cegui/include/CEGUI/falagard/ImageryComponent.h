@@ -223,12 +223,18 @@ namespace CEGUI
         */
         void setImagePropertySource(const String& property);
 
+        // overridden from ComponentBase.
+        void gatherPropertyReferences(std::unordered_set<String>& properties) const override;
+
     protected:
         void addImageRenderGeometryToWindow_impl(
             Window& srcWindow, Rectf& destRect,
             const CEGUI::ColourRect* modColours,
             const Rectf* clipper, bool clipToDisplay) const override;
 
+        void addGeometryCacheKey_impl(const Window& srcWindow,
+                                      GeometryCacheKey& key) const override;
+
         const Image*         d_image;           //!< CEGUI::Image to be drawn by this image component.
         //! Vertical formatting to be applied when rendering the image component.
         FormattingSetting<VerticalImageFormatting> d_vertFormatting;
@@ -282,6 +282,9 @@ namespace CEGUI
         //! perform any processing required due to the given font having changed.
         bool handleFontRenderSizeChange(Window& window, const Font* font) const;
 
+        //! Adds the names of the window properties read by this ImagerySection to \a properties.
+        void gatherPropertyReferences(std::unordered_set<String>& properties) const;
+
         /*!
         \brief
             Returns a vector of pointers to the ImageryComponents that are currently added to this ImagerySection. If an
@@ -358,6 +361,18 @@ namespace CEGUI
         */
         void initMasterColourRect(const Window& wnd, ColourRect& cr) const;
 
+        /*!
+        \brief
+            Renders the section, taking the geometry from the GeometryCache of
+            \a srcWindow when the section was drawn with the same inputs before,
+            or copying it from the GeometryTemplateCache when another window
+            drew it. Sections containing TextComponents are never cached.
+        */
+        void render_impl(Window& srcWindow, const Rectf* baseRect, const CEGUI::ColourRect* modColours, const Rectf* clipper, bool clipToDisplay) const;
+
+        //! Creates the geometry of all components and adds it to \a srcWindow.
+        void renderComponents(Window& srcWindow, const Rectf* baseRect, const CEGUI::ColourRect* modColours, const Rectf* clipper, bool clipToDisplay) const;
+
     private:
         CEGUI::String               d_name;             //!< Holds the name of the ImagerySection.
         CEGUI::ColourRect           d_masterColours;    //!< Naster colours for the the ImagerySection (combined with colours of each ImageryComponent).
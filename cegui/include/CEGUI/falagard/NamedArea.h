@@ -100,6 +100,9 @@ namespace CEGUI
         //! perform any processing required due to the given font having changed.
         bool handleFontRenderSizeChange(Window& window, const Font* font) const;
 
+        //! Adds the names of the window properties read by the area of this NamedArea to \a properties.
+        void gatherPropertyReferences(std::unordered_set<String>& properties) const;
+
     private:
         String d_name;
         ComponentArea d_area;
@@ -104,7 +104,15 @@ protected:
     //------------------------------------------------------------------------//
     void setNative_impl(PropertyReceiver* receiver,typename Helper::pass_type value) override
     {
-        setWindowUserString(static_cast<Window*>(receiver), Helper::toString(value));
+        Window* const wnd = static_cast<Window*>(receiver);
+        const String valueString(Helper::toString(value));
+
+        // writing the current value again invalidates nothing
+        if (wnd->isUserStringDefined(d_userStringName) &&
+            wnd->getUserString(d_userStringName) == valueString)
+            return;
+
+        setWindowUserString(wnd, valueString);
         FalagardPropertyBase<T>::setNative_impl(receiver, value);
     }
 
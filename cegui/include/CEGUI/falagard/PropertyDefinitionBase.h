@@ -32,6 +32,7 @@
 namespace CEGUI
 {
 class XMLSerializer;
+class Window;
 
 /*!
 \brief
@@ -108,6 +109,17 @@ protected:
     */
     virtual void writeDefinitionXMLAttributes(XMLSerializer& xml_stream) const;
 
+    /*!
+    \brief
+        Return whether writing the property may change the layout of the
+        child widgets of \a window.
+
+        This is the case if a named area or a widget component of the look of
+        \a window reads the property. Properties the look does not read at
+        all are assumed to be read by the window renderer.
+    */
+    bool isLayoutAffected(const Window& window) const;
+
     String d_propertyName;
     String d_initialValue;
     String d_helpString;
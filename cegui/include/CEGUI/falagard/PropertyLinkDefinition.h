@@ -30,6 +30,8 @@
 #include "CEGUI/falagard/FalagardPropertyBase.h"
 #include "CEGUI/falagard/XMLHandler.h"
 #include "CEGUI/IteratorBase.h"
+#include "CEGUI/Window.h"
+#include <memory>
 #include <vector>
 
 #if defined (_MSC_VER)
@@ -118,19 +120,17 @@ protected:
     typename Helper::safe_method_return_type
     getNative_impl(const PropertyReceiver* receiver) const override
     {
-        const LinkTargetCollection::const_iterator i(d_targets.begin());
-
-        const Window* const target_wnd =
-            getTargetWindow(receiver, i->first);
+        const std::shared_ptr<const Window::PropertyLinkTargetList> targets(
+            getLinkTargets(receiver));
 
         // if no target, or target (currently) invalid, return the default value
-        if (d_targets.empty() || !target_wnd)
+        if (targets->empty() || !targets->front().d_window)
             return Helper::fromString(FalagardPropertyBase<T>::d_initialValue);
 
         // otherwise return the value of the property for first target, since
         // this is considered the 'master' target for get operations.
-        return Helper::fromString(target_wnd->getProperty(i->second.empty() ?
-                TypedProperty<T>::d_name : i->second));
+        const Window::PropertyLinkTarget& target = targets->front();
+        return PropertyHandle<T>(target.d_window, target.d_property).get();
     }
 
     //------------------------------------------------------------------------//
@@ -147,20 +147,62 @@ protected:
     void updateLinkTargets(PropertyReceiver* receiver,
                            typename Helper::pass_type value) const
     {
+        // hold on to the targets, setting a property may modify the children
+        const std::shared_ptr<const Window::PropertyLinkTargetList> targets(
+            getLinkTargets(receiver));
+
+        Window::PropertyLinkTargetList::const_iterator i = targets->begin();
+        for ( ; i != targets->end(); ++i)
+        {
+            // only try to set property if target is currently valid.
+            if (i->d_window)
+                PropertyHandle<T>(i->d_window, i->d_property).set(value);
+        }
+    }
+
+    //------------------------------------------------------------------------//
+    /*!
+    \brief
+        Return the targets of this link for \a receiver, resolving the target
+        windows and properties on first use.
+
+        The targets are cached on the receiver, so writes only pay for name
+        lookups after the children of the receiver changed. Target properties
+        are banned from XML when resolved, since their values come from the
+        link.
+    */
+    std::shared_ptr<const Window::PropertyLinkTargetList>
+    getLinkTargets(const PropertyReceiver* receiver) const
+    {
+        const Window* const wnd = static_cast<const Window*>(receiver);
+
+        std::shared_ptr<const Window::PropertyLinkTargetList> targets(
+            wnd->getPropertyLinkTargets(this));
+        if (targets)
+            return targets;
+
+        std::shared_ptr<Window::PropertyLinkTargetList> resolved(
+            std::make_shared<Window::PropertyLinkTargetList>());
+        resolved->reserve(d_targets.size());
+
         LinkTargetCollection::const_iterator i = d_targets.begin();
         for ( ; i != d_targets.end(); ++i)
         {
-            Window* target_wnd = getTargetWindow(receiver, i->first);
+            Window::PropertyLinkTarget target = { nullptr, nullptr };
+            target.d_window = const_cast<Window*>(getTargetWindow(receiver, i->first));
 
-            // only try to set property if target is currently valid.
-            if (target_wnd)
+            if (target.d_window)
             {
-                const CEGUI::String& propertyName = i->second.empty() ? TypedProperty<T>::d_name : i->second;
-                CEGUI::String propertyValue = Helper::toString(value);
-                target_wnd->setProperty(propertyName, propertyValue);
-                target_wnd->banPropertyFromXML(propertyName);
+                target.d_property = target.d_window->getPropertyInstance(
+                    i->second.empty() ? TypedProperty<T>::d_name : i->second);
+                target.d_window->banPropertyFromXML(target.d_property);
             }
+
+            resolved->push_back(target);
         }
+
+        wnd->setPropertyLinkTargets(this, resolved);
+        return resolved;
     }
 
     //------------------------------------------------------------------------//
@@ -29,6 +29,7 @@
 
 #include "../Window.h"
 #include "../ColourRect.h"
+#include <unordered_set>
 
 
 // Start of CEGUI namespace section
@@ -346,6 +347,14 @@ namespace CEGUI
         */
         void writeXMLToStream(XMLSerializer& xml_stream) const;
 
+        /*!
+        \brief
+            Adds the names of the window properties read when rendering this
+            SectionSpecification, including those of the referenced section,
+            to \a properties.
+        */
+        void gatherPropertyReferences(std::unordered_set<String>& properties) const;
+
     protected:
         /*!
         \brief
@@ -29,6 +29,7 @@
 
 #include "./ComponentBase.h"
 #include "CEGUI/falagard/FormattingSetting.h"
+#include "CEGUI/ResourceHandle.h"
 
 #if defined(_MSC_VER)
 #  pragma warning(push)
@@ -321,6 +322,7 @@ public:
     
     // overridden from ComponentBase.
     bool handleFontRenderSizeChange(Window& window, const Font* font) const override;
+    void gatherPropertyReferences(std::unordered_set<String>& properties) const override;
 
 
     //! Update string formatting.
@@ -340,9 +342,9 @@ public:
         const CEGUI::ColourRect* modColours, const Rectf* clipper,
         bool clipToDisplay) const override;
 
-    //! helper to set up an appropriate FormattedRenderedString
-    void setupStringFormatter(const Window& window,
-                                const RenderedString& rendered_string) const;
+    //! helper to create an appropriate FormattedRenderedString
+    static FormattedRenderedString* createStringFormatter(
+        HorizontalTextFormatting horzFormatting, const RenderedString& rendered_string);
     //! helper to get the font object to use
     const Font* getFontObject(const Window& window) const;
 
@@ -366,20 +368,45 @@ public:
     mutable bool d_raqmTextNeedsUpdate;
 #endif
 
-    //! RenderedString used when not using the one from the target Window.
-    mutable RenderedString d_renderedString;
+    //! Number of formattings kept by updateFormatting.
+    static const size_t FormattingCacheSize = 8;
+
+    /*!
+    \brief
+        A text parsed and formatted for one width. Only the width decides the
+        wrapping and alignment of the lines, so sizing a window by bisection
+        or resizing it back and forth reuses the formatting of earlier widths.
+    */
+    struct CachedFormatting
+    {
+        const Window* d_window;
+        const RenderedStringParser* d_parser;
+        //! Font the text is measured with.
+        const Font* d_font;
+        //! Font passed to the parser, nullptr when the Window's font is used.
+        const Font* d_parseFont;
+        String d_text;
+        HorizontalTextFormatting d_horzFormatting;
+        float d_width;
+        RefCounted<RenderedString> d_renderedString;
+        RefCounted<FormattedRenderedString> d_formattedRenderedString;
+    };
+
+    //! Empty RenderedString formatted until the first call to updateFormatting.
+    RenderedString d_renderedString;
     //! FormattedRenderedString object that applies formatting to the string
     mutable RefCounted<FormattedRenderedString> d_formattedRenderedString;
-    //! Tracks last used horizontal formatting (in order to detect changes)
-    mutable HorizontalTextFormatting d_lastHorzFormatting;
+    //! Recently used formattings, the most recent first.
+    mutable std::vector<CachedFormatting> d_formattingCache;
 
-    String               d_font;            //!< name of font to use.
+    FontHandle           d_font;            //!< font to use, referred to by name.
     //! Vertical formatting to be applied when rendering the image component.
     FormattingSetting<VerticalTextFormatting> d_vertFormatting;
     //! Horizontal formatting to be applied when rendering the image component.
     FormattingSetting<HorizontalTextFormatting> d_horzFormatting;
     String  d_textPropertyName;             //!< Name of the property to access to obtain the text string to render.
     String  d_fontPropertyName;             //!< Name of the property to access to obtain the font to use for rendering.
+    FontHandle d_propertyFont;              //!< Font named by the font property when it was last accessed.
     };
 
 } // End of  CEGUI namespace section
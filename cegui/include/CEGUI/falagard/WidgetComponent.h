@@ -133,6 +133,9 @@ namespace CEGUI
         //! perform any processing required due to the given font having changed.
         bool handleFontRenderSizeChange(Window& window, const Font* font) const;
 
+        //! Adds the names of the window properties read by the area of this WidgetComponent to \a properties.
+        void gatherPropertyReferences(std::unordered_set<String>& properties) const;
+
         /*!
         \brief
             Returns the collection of PropertyInitialisers of this WidgetComponent
@@ -36,9 +36,13 @@
 #include "./NamedArea.h"
 #include "./NamedDefinitionCollator.h"
 #include "../String.h"
+#include "../InternedNameMap.h"
 #include <unordered_map>
 #include <unordered_set>
 #include <map>
+#include <cstdint>
+#include <atomic>
+#include <mutex>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -58,7 +62,10 @@ class CEGUIEXPORT WidgetLookFeel
 {
 public:
     WidgetLookFeel(const String& name, const String& inheritedLookName);
-    WidgetLookFeel() {}
+    WidgetLookFeel() :
+        d_propertyDependenciesGeneration(0),
+        d_resolvedElementsGeneration(0)
+    {}
     WidgetLookFeel(const WidgetLookFeel& other);
 
     WidgetLookFeel& operator=(const WidgetLookFeel& other);
@@ -532,6 +539,29 @@ public:
     //! perform any processing required due to the given font having changed.
     bool handleFontRenderSizeChange(Window& window, const Font* font) const;
 
+    //! Flag returned by getPropertyDependencies for properties read by imagery.
+    static const std::uint32_t ImageryDependency;
+    //! Flag returned by getPropertyDependencies for properties read by named areas.
+    static const std::uint32_t NamedAreaDependency;
+    //! Flag returned by getPropertyDependencies for properties read by child widget areas.
+    static const std::uint32_t WidgetComponentDependency;
+
+    /*!
+    \brief
+        Return which parts of this WidgetLookFeel, including the inherited
+        look, read the window property named \a propertyName.
+
+        The dependencies are gathered from the looks registered with the
+        WidgetLookManager when first asked for, and gathered again after the
+        set of registered looks or the elements of this look changed.
+
+    \return
+        Combination of ImageryDependency, NamedAreaDependency and
+        WidgetComponentDependency, or 0 if nothing in the look reads the
+        property.
+    */
+    std::uint32_t getPropertyDependencies(const String& propertyName) const;
+
 
 
     /*!
@@ -800,18 +830,24 @@ private:
     */
     void copyPropertyLinkDefinitionsFrom(const WidgetLookFeel& widgetLook);
 
+    //! Map of property names to the flags of the parts reading them.
+    typedef std::unordered_map<String, std::uint32_t> PropertyDependencyMap;
+
+    //! Adds the property dependencies of this and the inherited look to \a dependencies.
+    void gatherPropertyDependencies(PropertyDependencyMap& dependencies) const;
 
-    //! Map types for the Falagard elements that this WidgetLookFeel can own. The keys are the names of the corresponding elements, as CEGUI::String.
-    typedef std::unordered_map<String, StateImagery> StateImageryMap;
-    typedef std::unordered_map<String, ImagerySection> ImagerySectionMap;
-    typedef std::unordered_map<String, NamedArea> NamedAreaMap;
 
-    typedef std::unordered_map<String, PropertyInitialiser> PropertyInitialiserMap;
+    //! Map types for the Falagard elements that this WidgetLookFeel can own. The keys are the interned names of the corresponding elements.
+    typedef InternedNameMap<StateImagery> StateImageryMap;
+    typedef InternedNameMap<ImagerySection> ImagerySectionMap;
+    typedef InternedNameMap<NamedArea> NamedAreaMap;
+
+    typedef InternedNameMap<PropertyInitialiser> PropertyInitialiserMap;
     typedef std::unordered_map<String, PropertyDefinitionBase*> PropertyDefinitionMap;
     typedef std::unordered_map<String, PropertyDefinitionBase*> PropertyLinkDefinitionMap;
 
-    typedef std::unordered_map<String, WidgetComponent> WidgetComponentMap;
-    typedef std::unordered_map<String, EventLinkDefinition> EventLinkDefinitionMap;
+    typedef InternedNameMap<WidgetComponent> WidgetComponentMap;
+    typedef InternedNameMap<EventLinkDefinition> EventLinkDefinitionMap;
 
     //! List of animation names
     typedef std::vector<String> AnimationList;
@@ -842,6 +878,39 @@ private:
     mutable AnimationInstanceMap d_animationInstances;
     //! Collection of EventLinkDefinition objects.
     EventLinkDefinitionMap d_eventLinkDefinitionMap;
+    //! Parts of the look reading each property, see getPropertyDependencies.
+    mutable PropertyDependencyMap d_propertyDependencies;
+    //! Generation of the looks d_propertyDependencies was gathered at, 0 if never.
+    mutable std::uint64_t d_propertyDependenciesGeneration;
+
+    //! Elements of this and the inherited looks by name, the most derived one winning.
+    struct ResolvedElements
+    {
+        std::unordered_map<String, const StateImagery*> d_stateImagery;
+        std::unordered_map<String, const ImagerySection*> d_imagerySections;
+        std::unordered_map<String, const NamedArea*> d_namedAreas;
+        std::unordered_map<String, const WidgetComponent*> d_widgetComponents;
+    };
+
+    /*!
+    \brief
+        Returns the elements of this and the inherited looks, building them
+        first if the looks changed since they were last built.
+
+        Lookups including the inherited look are answered from these maps
+        with a single probe instead of walking the inheritance chain.
+    */
+    const ResolvedElements& getResolvedElements() const;
+
+    //! Returns a number that changes whenever any look is added, erased or modified.
+    static std::uint64_t getLooksGeneration();
+
+    //! Elements resolved through the inheritance chain, see getResolvedElements.
+    mutable ResolvedElements d_resolvedElements;
+    //! Generation of the looks d_resolvedElements was built at, 0 if never.
+    mutable std::atomic<std::uint64_t> d_resolvedElementsGeneration;
+    //! Serialises building d_resolvedElements when geometry is generated in parallel.
+    mutable std::mutex d_resolvedElementsMutex;
 
     // these are container types used when composing final collections of
     // objects that come via inheritence.
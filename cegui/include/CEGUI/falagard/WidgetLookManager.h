@@ -30,8 +30,14 @@
 #include "../Singleton.h"
 #include "../String.h"
 #include "WidgetLookFeel.h"
+#include "../GeometryCache.h"
+#include "../SharedMutex.h"
 #include <unordered_map>
 #include <unordered_set>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -40,6 +46,36 @@
 
 namespace CEGUI
 {
+    //! Rendering costs aggregated for one imagery of a look.
+    struct CEGUIEXPORT FalagardRenderStats
+    {
+        //! Number of times the imagery was rendered.
+        std::size_t d_renderCount = 0;
+        //! Total time spent rendering the imagery, in seconds.
+        double d_time = 0.0;
+        //! Total number of vertices of the geometry buffers added by the imagery.
+        std::size_t d_vertexCount = 0;
+        //! Total number of geometry buffers added by the imagery.
+        std::size_t d_bufferCount = 0;
+    };
+
+    /*!
+    \brief
+        Identifies the imagery that FalagardRenderStats were collected for.
+
+        Statistics with an empty section name are the totals of a whole
+        StateImagery, those with an empty state name belong to imagery sections
+        rendered directly by a window renderer rather than by a state.
+    */
+    struct CEGUIEXPORT FalagardRenderStatsKey
+    {
+        String d_look;
+        String d_state;
+        String d_section;
+
+        bool operator<(const FalagardRenderStatsKey& other) const;
+    };
+
     /*!
     \brief
         Manager class that gives top-level access to widget data based "look and feel" specifications loaded into the system.
@@ -110,7 +146,18 @@ namespace CEGUI
         void parseLookNFeelSpecificationFromContainer(const RawDataContainer& source);
 
         /*!
+        \brief
+            Parses a file containing window look & feel specifications.
+
+            If pre-parsed files are enabled and a file named \a filename
+            followed by PreparsedFileSuffix is available in the resource group,
+            the events recorded in it are passed to the look & feel handler
+            instead of parsing the XML. The pre-parsed file is ignored and the
+            XML parsed as usual if it was not written from the current content
+            of \a filename.
+
         \see WidgetLookManager::parseLookNFeelSpecificationFromContainer
+        \see WidgetLookManager::writePreparsedLookNFeelToStream
         */
         void parseLookNFeelSpecificationFromFile(const String& filename, const String& resourceGroup = "");
 
@@ -119,6 +166,24 @@ namespace CEGUI
         */
         void parseLookNFeelSpecificationFromString(const String& source);
 
+        /*!
+        \brief
+            Parses a look & feel file loaded before again and only applies the
+            WidgetLookFeels that differ from the current definitions.
+
+            Windows using a changed look, or a look inheriting from one, are
+            cleaned up with the previous definition and get the new one
+            assigned, which recreates their AutoWindows. Other windows and
+            looks are left untouched.
+
+        \return
+            The names of the WidgetLookFeels that were added or changed.
+
+        \see WidgetLookManager::parseLookNFeelSpecificationFromFile
+        */
+        WidgetLookNameSet reloadLookNFeelSpecificationFromFile(const String& filename,
+                                                               const String& resourceGroup = "");
+
         /*!
         \brief
             Return whether a WidgetLookFeel has been created with the specified name.
@@ -143,6 +208,11 @@ namespace CEGUI
         \return
             const reference to the requested WidgetLookFeel object.
 
+        \note
+            getWidgetLook and isWidgetLookAvailable may be called on several
+            threads at once, looks are only added and erased on the main
+            thread. See WindowManager for the complete threading rules.
+
         \exception UnknownObjectException   thrown if no WidgetLookFeel is available with the requested name.
         */
         const WidgetLookFeel& getWidgetLook(const String& widget) const;
@@ -256,6 +326,30 @@ namespace CEGUI
         */
         void writeWidgetLookSetToStream(const WidgetLookNameSet& widgetLookNameSet, OutStream& out_stream) const;
 
+        /*!
+        \brief
+            Parses the look & feel file \a filename and writes its pre-parsed
+            form to a stream. Store it as \a filename followed by
+            PreparsedFileSuffix, next to \a filename, to have it used by
+            parseLookNFeelSpecificationFromFile.
+
+        \param out_stream
+            OutStream where the binary data should be sent. It must be opened
+            in binary mode.
+
+        \exception FileIOException    thrown if there was some problem accessing or parsing the file \a filename
+        */
+        void writePreparsedLookNFeelToStream(const String& filename, OutStream& out_stream,
+                                             const String& resourceGroup = "") const;
+
+        //! Sets whether parseLookNFeelSpecificationFromFile uses pre-parsed files. Enabled by default.
+        void setPreparsedFilesEnabled(bool enabled) { d_preparsedFilesEnabled = enabled; }
+        //! Returns whether parseLookNFeelSpecificationFromFile uses pre-parsed files.
+        bool isPreparsedFilesEnabled() const { return d_preparsedFilesEnabled; }
+
+        //! Suffix appended to the name of a look & feel file to get the name of its pre-parsed form.
+        static const String PreparsedFileSuffix;
+
         /*!
         \brief
             Returns the default resource group currently set for LookNFeels.
@@ -267,6 +361,10 @@ namespace CEGUI
         static const String& getDefaultResourceGroup()
             { return d_defaultResourceGroup; }
 
+        //! Returns the name of the schema LookNFeel files are validated against.
+        static const String& getSchemaName()
+            { return FalagardSchemaName; }
+
         /*!
         \brief
             Sets the default resource group to be used when loading LookNFeel data
@@ -290,7 +388,90 @@ namespace CEGUI
         */
         WidgetLookPointerMap getWidgetLookPointerMap();
 
+        /*!
+        \brief
+            Returns a number that changes whenever a WidgetLookFeel is added or
+            erased. Geometry cached for the imagery of a look is only valid as
+            long as the generation did not change.
+        */
+        std::uint32_t getGeneration() const;
+
+        /*!
+        \brief
+            Returns the cache of geometry templates shared by all windows, which
+            lets windows with the same look and size copy the geometry of their
+            imagery instead of computing it. It is cleared whenever a
+            WidgetLookFeel is added or erased.
+        */
+        GeometryTemplateCache& getGeometryTemplateCache() { return d_geometryTemplates; }
+
+        //! Map of the rendering costs collected per look, state and section.
+        typedef std::map<FalagardRenderStatsKey, FalagardRenderStats> RenderStatsMap;
+
+        /*!
+        \brief
+            Sets whether the cost of rendering StateImagery and ImagerySection
+            objects is measured. Disabled by default.
+
+            While enabled, the time, vertex count and geometry buffer count of
+            every rendered state and section are aggregated per look, state and
+            section, and can be inspected with getRenderStats() or
+            logRenderStats(). Imagery reused from the geometry caches is
+            included, so the statistics show what windows cost as they are
+            actually drawn.
+        */
+        void setRenderStatsEnabled(bool enabled) { d_renderStatsEnabled = enabled; }
+        //! Returns whether the cost of rendering imagery is measured.
+        bool isRenderStatsEnabled() const { return d_renderStatsEnabled; }
+
+        //! Returns a copy of the rendering costs collected so far.
+        RenderStatsMap getRenderStats() const;
+        //! Discards the rendering costs collected so far.
+        void resetRenderStats();
+        /*!
+        \brief
+            Writes the rendering costs collected so far to the log, most
+            expensive imagery first.
+        */
+        void logRenderStats() const;
+
+        /*!
+        \brief
+            Measures the rendering of an imagery into a window for as long as it
+            exists, and adds the costs to the statistics of the manager when
+            destroyed. Does nothing when the statistics are disabled.
+
+            A scope created for a state is the state of the scopes created for
+            sections on the same thread while it exists.
+        */
+        class CEGUIEXPORT RenderStatsScope
+        {
+        public:
+            //! Starts measuring the rendering of a whole state.
+            RenderStatsScope(Window& window, const String& state);
+            //! Starts measuring the rendering of a section.
+            RenderStatsScope(const String& section, Window& window);
+            ~RenderStatsScope();
+
+            RenderStatsScope(const RenderStatsScope&) = delete;
+            RenderStatsScope& operator=(const RenderStatsScope&) = delete;
+
+        private:
+            void start(Window& window);
+
+            Window* d_window;
+            const String* d_state;
+            const String* d_section;
+            //! State being measured on this thread when the scope was created.
+            const String* d_previousState;
+            std::size_t d_firstBuffer;
+            std::chrono::steady_clock::time_point d_start;
+        };
+
     private:
+        //! Adds the costs of one rendering to the statistics.
+        void addRenderStats(const FalagardRenderStatsKey& key, const FalagardRenderStats& stats);
+
         //! Name of schema file used for XML validation.
         static const String FalagardSchemaName; 
         //! holds default resource group
@@ -302,6 +483,19 @@ namespace CEGUI
 
         //! List of WidgetLookFeels added to this Manager
         WidgetLookList  d_widgetLooks;  
+        //! Receives the looks parsed while reloading, instead of d_widgetLooks.
+        WidgetLookList* d_stagedWidgetLooks;
+        //! Guards d_widgetLooks, taken exclusively only while it is modified.
+        mutable SharedMutex d_widgetLooksMutex;
+        //! Geometry of imagery shared between windows.
+        GeometryTemplateCache d_geometryTemplates;
+        //! Whether pre-parsed look & feel files are looked for.
+        bool d_preparsedFilesEnabled;
+        //! Whether the cost of rendering imagery is measured.
+        std::atomic<bool> d_renderStatsEnabled;
+        //! Costs of rendering imagery, windows may be drawn on several threads.
+        RenderStatsMap d_renderStats;
+        mutable std::mutex d_renderStatsMutex;
     };
 
 } // End of  CEGUI namespace section
@@ -32,7 +32,10 @@
 #include "CEGUI/String.h"
 #include "CEGUI/svg/SVGPaintStyle.h"
 
+#include <glm/glm.hpp>
+
 #include <vector>
+#include <list>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -174,6 +177,61 @@ public:
     */
     void setHeight(float height);
 
+    //! Vertex data and transformation of a GeometryBuffer created by tesselating a shape.
+    struct TesselatedGeometry
+    {
+        //! The custom transformation of the GeometryBuffer.
+        glm::mat4 d_customTransform;
+        //! The vertex data of the GeometryBuffer.
+        std::vector<float> d_vertexData;
+    };
+
+    //! The number of tesselations kept by the cache of an SVGData.
+    static const size_t MaxCachedTesselations;
+
+    /*!
+    \brief
+        Returns the cached tesselation of the shapes for the given scale bucket.
+
+        SVGImage tesselates the shapes for a set of discrete scales, the scale
+        buckets, and keeps the results here so that redrawing the image does
+        not tesselate the shapes again. The cache holds the geometry of the
+        MaxCachedTesselations most recently used buckets.
+
+    \param scale_bucket
+        The horizontal and vertical scale bucket of the tesselation.
+    \param anti_aliasing
+        Whether the tesselation contains anti-aliasing geometry.
+
+    \return
+        The geometry of all shapes, in the order of the shapes, or nullptr if
+        no such tesselation is cached.
+    */
+    const std::vector<TesselatedGeometry>* getCachedTesselation(const glm::ivec2& scale_bucket,
+                                                                bool anti_aliasing);
+
+    /*!
+    \brief
+        Stores the tesselation of the shapes for the given scale bucket in the
+        cache, dropping the least recently used tesselation if the cache is full.
+
+    \return
+        The cached geometry.
+    */
+    const std::vector<TesselatedGeometry>& cacheTesselation(const glm::ivec2& scale_bucket,
+                                                            bool anti_aliasing,
+                                                            std::vector<TesselatedGeometry>&& geometry);
+
+    /*!
+    \brief
+        Removes all cached tesselations.
+
+        This is done automatically when shapes are added or destroyed. It must
+        be called after modifying the members of a shape, such as its paint
+        style, that was already rendered.
+    */
+    void invalidateTesselationCache();
+
 protected:
     // implement chained xml handler abstract interface
     void elementStartLocal(const String& element,
@@ -269,6 +327,17 @@ protected:
     //! The basic shapes that were added to the SVGData
     std::vector<SVGBasicShape*> d_svgBasicShapes;
 
+    //! A tesselation of the shapes for one scale bucket.
+    struct TesselationCacheEntry
+    {
+        glm::ivec2 d_scaleBucket;
+        bool d_antiAliasing;
+        std::vector<TesselatedGeometry> d_geometry;
+    };
+
+    //! The cached tesselations, the most recently used one first.
+    std::list<TesselationCacheEntry> d_tesselationCache;
+
 private:
     /*!
     \brief
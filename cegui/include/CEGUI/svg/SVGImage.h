@@ -114,6 +114,26 @@ public:
     */
     void setUseGeometryAntialiasing(bool use_geometry_antialiasing);
 
+    /*!
+    \brief
+        Returns the size in pixels below which no anti-aliasing geometry is
+        created, regardless of getUsesGeometryAntialiasing.
+    */
+    float getGeometryAntialiasingMinimumSize() const;
+
+    /*!
+    \brief
+        Sets the size in pixels below which no anti-aliasing geometry is created.
+
+        The Image is compared by the larger side of the area it is drawn to.
+        Skipping the anti-aliasing geometry of small icons considerably reduces
+        the amount of geometry created for them. The default of 0 always
+        creates the anti-aliasing geometry when it is enabled.
+    \param size
+        The minimum size in pixels.
+    */
+    void setGeometryAntialiasingMinimumSize(float size);
+
 protected:
     /*!
         \brief
@@ -130,6 +150,9 @@ protected:
         an alpha-blended transition to defeat aliasing artefacts
     */
     bool d_useGeometryAntialiasing;
+
+    //! The size in pixels below which no anti-aliasing geometry is created.
+    float d_geometryAntialiasingMinimumSize;
 };
 
 }
@@ -220,6 +220,27 @@ public:
         const SVGPolygon* polyline,
         const SVGImage::SVGImageRenderSettings& render_settings);
 
+    /*!
+    \brief
+        Creates a coloured GeometryBuffer from vertex data that was tesselated
+        before, applying the given render settings to it.
+
+    \param vertex_data
+            The vertex data as returned by GeometryBuffer::getVertexData for a
+            buffer created by one of the tesselate functions.
+    \param custom_transform
+            The custom transformation of the buffer the data was taken from.
+    \param render_settings
+            The ImageRenderSettings for the geometry that will be created.
+
+    \return
+            Returns the created GeometryBuffer.
+    */
+    static GeometryBuffer* createGeometryBuffer(
+        const std::vector<float>& vertex_data,
+        const glm::mat4& custom_transform,
+        const SVGImage::SVGImageRenderSettings& render_settings);
+
 private:
     /*!
 	\brief
@@ -392,6 +413,9 @@ private:
                                             const SVGImage::SVGImageRenderSettings &render_settings,
                                             const glm::mat4& cegui_transformation_matrix);
 
+    //! Returns the largest factor by which the geometry is scaled on screen, given the inverse scale factors of the shape
+    static float calculateMaxScale(const glm::vec2& scale_factors);
+
     //! Turns a matrix as defined by SVG into a matrix that can be used internally by the CEGUI Renderers
     static glm::mat4 createRenderableMatrixFromSVGMatrix(glm::mat3 svg_matrix);
 
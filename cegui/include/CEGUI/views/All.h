@@ -31,6 +31,7 @@
 #include "./ItemView.h"
 #include "./ListView.h"
 #include "./StandardItemModel.h"
+#include "./TableView.h"
 #include "./TreeView.h"
 
 #endif
@@ -0,0 +1,615 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIFlatItemModel_h_
+#define _CEGUIFlatItemModel_h_
+
+#include "CEGUI/views/ItemModel.h"
+#include "CEGUI/Exceptions.h"
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <cstdint>
+
+#if defined (_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+/*!
+\brief
+    Default item type of FlatItemModel: a text and an icon, stored by value.
+
+    Any copyable type providing getText(), getIcon(), getTooltipText() and
+    operator< can be used instead.
+*/
+class FlatItem
+{
+public:
+    FlatItem() {}
+    explicit FlatItem(const String& text, const String& icon = String()) :
+        d_text(text),
+        d_icon(icon)
+    {}
+
+    const String& getText() const { return d_text; }
+    void setText(const String& text) { d_text = text; }
+
+    const String& getIcon() const { return d_icon; }
+    void setIcon(const String& icon) { d_icon = icon; }
+
+    String getTooltipText() const { return {}; }
+
+    bool operator<(const FlatItem& other) const { return d_text < other.d_text; }
+
+protected:
+    String d_text;
+    String d_icon;
+};
+
+/*!
+\brief
+    An ItemModel that keeps its items by value in one contiguous array of
+    slots, as an alternative to GenericItemModel for very large models.
+
+    Each slot holds the item, the slot of its parent and, for items that have
+    children, the number of a list of child slots. Children lists are arrays
+    of slot ids, so a flat list of a million entries takes one array of items
+    and one array of ids, with no per-item heap allocation. Traversals such as
+    getChildCount() and makeIndex() are array lookups, and forEachItem() walks
+    all the items in memory order.
+
+    A ModelIndex refers to the slot of its item. Slots stay the same while
+    other items are added or removed; the slots of removed items are reused
+    by later additions, so indices of removed items must not be kept.
+
+\tparam TItem
+    The type of the stored items, see FlatItem for the requirements.
+*/
+template <typename TItem>
+class FlatItemModel : public ItemModel
+{
+public:
+    //! Stable identifier of the slot of an item.
+    typedef size_t SlotId;
+    //! The slot of the conceptual root, the parent of the top level items.
+    static const SlotId RootSlot = 0;
+
+    FlatItemModel();
+
+    //! Reserves storage for the specified number of items.
+    void reserve(size_t count);
+
+    //! Adds the item after the children of the root and returns its slot.
+    SlotId addItem(TItem item);
+
+    /*!
+    \brief
+        Adds the item as child of the specified parent, at the specified
+        position, and returns its slot.
+
+    \exception InvalidRequestException
+        thrown if the parent is not valid or the position is out of range.
+    */
+    SlotId addItemAtPosition(TItem item, const ModelIndex& parent, size_t position);
+
+    /*!
+    \brief
+        Adds the items in [\a first, \a last) as children of the specified
+        parent, starting at the specified position.
+
+        Storage is reserved once for the whole range and the listeners are
+        notified with a single pair of EventChildrenWillBeAdded and
+        EventChildrenAdded events.
+    */
+    template <typename TIterator>
+    void addItemsAtPosition(TIterator first, TIterator last,
+        const ModelIndex& parent, size_t position);
+
+    //! Adds the items in [\a first, \a last) after the children of the root.
+    template <typename TIterator>
+    void addItems(TIterator first, TIterator last);
+
+    //! Removes the item represented by \a index along with its children.
+    void removeItem(const ModelIndex& index);
+
+    /*!
+    \brief
+        Removes all the items of this model, optionally notifying any
+        listeners of the removal.
+    */
+    void clear(bool notify = true);
+
+    /*!
+    \brief
+        Replaces the item represented by \a index, notifying the listeners
+        via the EventChildrenDataWillChange and EventChildrenDataChanged events.
+    */
+    void updateItem(const ModelIndex& index, TItem item);
+
+    //! Returns the item represented by \a index, or NULL if the index is not valid.
+    TItem* getItemForIndex(const ModelIndex& index);
+    const TItem* getItemForIndex(const ModelIndex& index) const;
+
+    //! Returns the index of the item stored in \a slot.
+    ModelIndex getIndexForSlot(SlotId slot) const;
+    //! Returns the slot of the item represented by \a index.
+    SlotId getSlotForIndex(const ModelIndex& index) const;
+
+    //! Returns the number of items in the model, the root excluded.
+    size_t getItemCount() const { return d_itemCount; }
+
+    /*!
+    \brief
+        Calls \a visitor with the slot and the item of every item of the
+        model, in memory order rather than tree order.
+    */
+    template <typename TVisitor>
+    void forEachItem(TVisitor visitor) const;
+
+    bool isValidIndex(const ModelIndex& model_index) const override;
+    ModelIndex makeIndex(size_t child, const ModelIndex& parent_index) override;
+    bool areIndicesEqual(const ModelIndex& index1, const ModelIndex& index2) const override;
+    int compareIndices(const ModelIndex& index1, const ModelIndex& index2) const override;
+    ModelIndex getParentIndex(const ModelIndex& model_index) const override;
+    int getChildId(const ModelIndex& model_index) const override;
+    ModelIndex getRootIndex() const override;
+    size_t getChildCount(const ModelIndex& model_index) const override;
+    String getData(const ModelIndex& model_index, ItemDataRole role = ItemDataRole::Text) override;
+
+private:
+    static const size_t NoChildList = static_cast<size_t>(-1);
+
+    struct Slot
+    {
+        TItem d_item;
+        SlotId d_parent;
+        //! Index into d_childLists, or NoChildList if the item has no children.
+        size_t d_childList;
+        bool d_used;
+    };
+
+    //! Returns the slot of a valid index, throwing otherwise.
+    SlotId getValidSlot(const ModelIndex& index) const;
+    SlotId allocateSlot(TItem&& item, SlotId parent);
+    //! Returns the children list of \a parent, creating it if needed.
+    std::vector<SlotId>& getChildList(SlotId parent);
+    const std::vector<SlotId>* findChildList(SlotId parent) const;
+    //! Frees the slot and the slots of all its descendants.
+    void releaseSubtree(SlotId slot);
+
+    std::vector<Slot> d_slots;
+    std::vector<SlotId> d_freeSlots;
+    std::vector<std::vector<SlotId> > d_childLists;
+    std::vector<size_t> d_freeChildLists;
+    size_t d_itemCount;
+};
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+FlatItemModel<TItem>::FlatItemModel() :
+    d_itemCount(0)
+{
+    Slot root = { TItem(), RootSlot, NoChildList, true };
+    d_slots.push_back(std::move(root));
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+void FlatItemModel<TItem>::reserve(size_t count)
+{
+    d_slots.reserve(count + 1);
+    getChildList(RootSlot).reserve(count);
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+typename FlatItemModel<TItem>::SlotId FlatItemModel<TItem>::addItem(TItem item)
+{
+    return addItemAtPosition(std::move(item), getRootIndex(), getChildCount(getRootIndex()));
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+typename FlatItemModel<TItem>::SlotId FlatItemModel<TItem>::addItemAtPosition(
+    TItem item, const ModelIndex& parent_index, size_t position)
+{
+    const SlotId parent = getValidSlot(parent_index);
+    if (position > getChildCount(parent_index))
+        throw InvalidRequestException("The specified position is out of range.");
+
+    notifyChildrenWillBeAdded(parent_index, position, 1);
+
+    const SlotId slot = allocateSlot(std::move(item), parent);
+    std::vector<SlotId>& children = getChildList(parent);
+    children.insert(children.begin() + position, slot);
+
+    notifyChildrenAdded(parent_index, position, 1);
+    return slot;
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+template <typename TIterator>
+void FlatItemModel<TItem>::addItemsAtPosition(TIterator first, TIterator last,
+    const ModelIndex& parent_index, size_t position)
+{
+    const SlotId parent = getValidSlot(parent_index);
+    if (position > getChildCount(parent_index))
+        throw InvalidRequestException("The specified position is out of range.");
+
+    const size_t count = static_cast<size_t>(std::distance(first, last));
+    if (count == 0)
+        return;
+
+    notifyChildrenWillBeAdded(parent_index, position, count);
+
+    if (count > d_freeSlots.size())
+        d_slots.reserve(d_slots.size() + count - d_freeSlots.size());
+
+    std::vector<SlotId> new_slots;
+    new_slots.reserve(count);
+    for (TIterator itor = first; itor != last; ++itor)
+        new_slots.push_back(allocateSlot(TItem(*itor), parent));
+
+    std::vector<SlotId>& children = getChildList(parent);
+    children.insert(children.begin() + position, new_slots.begin(), new_slots.end());
+
+    notifyChildrenAdded(parent_index, position, count);
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+template <typename TIterator>
+void FlatItemModel<TItem>::addItems(TIterator first, TIterator last)
+{
+    addItemsAtPosition(first, last, getRootIndex(), getChildCount(getRootIndex()));
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+void FlatItemModel<TItem>::removeItem(const ModelIndex& index)
+{
+    const SlotId slot = getValidSlot(index);
+    if (slot == RootSlot)
+        throw InvalidRequestException("The root of the model cannot be removed.");
+
+    const ModelIndex parent_index = getParentIndex(index);
+    const size_t child_id = static_cast<size_t>(getChildId(index));
+
+    notifyChildrenWillBeRemoved(parent_index, child_id, 1);
+
+    std::vector<SlotId>& children = getChildList(d_slots[slot].d_parent);
+    children.erase(children.begin() + child_id);
+    releaseSubtree(slot);
+
+    notifyChildrenRemoved(parent_index, child_id, 1);
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+void FlatItemModel<TItem>::clear(bool notify /*= true*/)
+{
+    const ModelIndex root_index = getRootIndex();
+    const size_t count = getChildCount(root_index);
+
+    if (notify)
+        notifyChildrenWillBeRemoved(root_index, 0, count);
+
+    d_slots.resize(1);
+    d_slots.front().d_childList = NoChildList;
+    d_freeSlots.clear();
+    d_childLists.clear();
+    d_freeChildLists.clear();
+    d_itemCount = 0;
+
+    if (notify)
+        notifyChildrenRemoved(root_index, 0, count);
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+void FlatItemModel<TItem>::updateItem(const ModelIndex& index, TItem item)
+{
+    const SlotId slot = getValidSlot(index);
+    const ModelIndex parent_index = getParentIndex(index);
+    const size_t child_id = static_cast<size_t>(getChildId(index));
+
+    notifyChildrenDataWillChange(parent_index, child_id, 1);
+    d_slots[slot].d_item = std::move(item);
+    notifyChildrenDataChanged(parent_index, child_id, 1);
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+TItem* FlatItemModel<TItem>::getItemForIndex(const ModelIndex& index)
+{
+    return isValidIndex(index) ? &d_slots[getSlotForIndex(index)].d_item : nullptr;
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+const TItem* FlatItemModel<TItem>::getItemForIndex(const ModelIndex& index) const
+{
+    return isValidIndex(index) ? &d_slots[getSlotForIndex(index)].d_item : nullptr;
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+ModelIndex FlatItemModel<TItem>::getIndexForSlot(SlotId slot) const
+{
+    // slot ids are offset by one so that a valid index never holds NULL
+    return ModelIndex(reinterpret_cast<void*>(static_cast<std::uintptr_t>(slot) + 1));
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+typename FlatItemModel<TItem>::SlotId FlatItemModel<TItem>::getSlotForIndex(
+    const ModelIndex& index) const
+{
+    return static_cast<SlotId>(reinterpret_cast<std::uintptr_t>(index.d_modelData)) - 1;
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+template <typename TVisitor>
+void FlatItemModel<TItem>::forEachItem(TVisitor visitor) const
+{
+    for (SlotId slot = RootSlot + 1; slot < d_slots.size(); ++slot)
+    {
+        if (d_slots[slot].d_used)
+            visitor(slot, d_slots[slot].d_item);
+    }
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+bool FlatItemModel<TItem>::isValidIndex(const ModelIndex& model_index) const
+{
+    if (model_index.d_modelData == nullptr)
+        return false;
+
+    const SlotId slot = getSlotForIndex(model_index);
+    return slot < d_slots.size() && d_slots[slot].d_used;
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+ModelIndex FlatItemModel<TItem>::makeIndex(size_t child, const ModelIndex& parent_index)
+{
+    if (!isValidIndex(parent_index))
+        return ModelIndex();
+
+    const std::vector<SlotId>* children = findChildList(getSlotForIndex(parent_index));
+    if (children == nullptr || child >= children->size())
+        return ModelIndex();
+
+    return getIndexForSlot((*children)[child]);
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+bool FlatItemModel<TItem>::areIndicesEqual(const ModelIndex& index1,
+    const ModelIndex& index2) const
+{
+    return compareIndices(index1, index2) == 0;
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+int FlatItemModel<TItem>::compareIndices(const ModelIndex& index1,
+    const ModelIndex& index2) const
+{
+    if (!isValidIndex(index1) || !isValidIndex(index2) ||
+        index1.d_modelData == index2.d_modelData)
+        return 0;
+
+    const TItem& item1 = *getItemForIndex(index1);
+    const TItem& item2 = *getItemForIndex(index2);
+
+    if (item1 < item2)
+        return -1;
+
+    return item2 < item1 ? 1 : 0;
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+ModelIndex FlatItemModel<TItem>::getParentIndex(const ModelIndex& model_index) const
+{
+    if (!isValidIndex(model_index))
+        return ModelIndex();
+
+    const SlotId slot = getSlotForIndex(model_index);
+    if (slot == RootSlot)
+        return ModelIndex();
+
+    return getIndexForSlot(d_slots[slot].d_parent);
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+int FlatItemModel<TItem>::getChildId(const ModelIndex& model_index) const
+{
+    if (!isValidIndex(model_index))
+        return -1;
+
+    const SlotId slot = getSlotForIndex(model_index);
+    if (slot == RootSlot)
+        return -1;
+
+    const std::vector<SlotId>* children = findChildList(d_slots[slot].d_parent);
+    if (children == nullptr)
+        return -1;
+
+    typename std::vector<SlotId>::const_iterator itor =
+        std::find(children->begin(), children->end(), slot);
+
+    if (itor == children->end())
+        return -1;
+
+    return static_cast<int>(std::distance(children->begin(), itor));
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+ModelIndex FlatItemModel<TItem>::getRootIndex() const
+{
+    return getIndexForSlot(RootSlot);
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+size_t FlatItemModel<TItem>::getChildCount(const ModelIndex& model_index) const
+{
+    const SlotId parent = isValidIndex(model_index) ?
+        getSlotForIndex(model_index) : RootSlot;
+
+    const std::vector<SlotId>* children = findChildList(parent);
+    return children != nullptr ? children->size() : 0;
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+String FlatItemModel<TItem>::getData(const ModelIndex& model_index,
+    ItemDataRole role /*= ItemDataRole::Text*/)
+{
+    const TItem* item = getItemForIndex(model_index);
+    if (item == nullptr)
+        return "";
+
+    if (role == ItemDataRole::Text) return item->getText();
+    if (role == ItemDataRole::Icon) return item->getIcon();
+    if (role == ItemDataRole::Tooltip) return item->getTooltipText();
+
+    return "";
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+typename FlatItemModel<TItem>::SlotId FlatItemModel<TItem>::getValidSlot(
+    const ModelIndex& index) const
+{
+    if (!isValidIndex(index))
+        throw InvalidRequestException("The specified index is not a valid index of this model.");
+
+    return getSlotForIndex(index);
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+typename FlatItemModel<TItem>::SlotId FlatItemModel<TItem>::allocateSlot(
+    TItem&& item, SlotId parent)
+{
+    ++d_itemCount;
+
+    if (!d_freeSlots.empty())
+    {
+        const SlotId slot = d_freeSlots.back();
+        d_freeSlots.pop_back();
+
+        Slot& reused = d_slots[slot];
+        reused.d_item = std::move(item);
+        reused.d_parent = parent;
+        reused.d_childList = NoChildList;
+        reused.d_used = true;
+        return slot;
+    }
+
+    Slot slot = { std::move(item), parent, NoChildList, true };
+    d_slots.push_back(std::move(slot));
+    return d_slots.size() - 1;
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+std::vector<typename FlatItemModel<TItem>::SlotId>& FlatItemModel<TItem>::getChildList(
+    SlotId parent)
+{
+    size_t& list = d_slots[parent].d_childList;
+    if (list == NoChildList)
+    {
+        if (d_freeChildLists.empty())
+        {
+            list = d_childLists.size();
+            d_childLists.push_back(std::vector<SlotId>());
+        }
+        else
+        {
+            list = d_freeChildLists.back();
+            d_freeChildLists.pop_back();
+        }
+    }
+
+    return d_childLists[list];
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+const std::vector<typename FlatItemModel<TItem>::SlotId>* FlatItemModel<TItem>::findChildList(
+    SlotId parent) const
+{
+    const size_t list = d_slots[parent].d_childList;
+    return list == NoChildList ? nullptr : &d_childLists[list];
+}
+
+//----------------------------------------------------------------------------//
+template <typename TItem>
+void FlatItemModel<TItem>::releaseSubtree(SlotId slot)
+{
+    Slot& released = d_slots[slot];
+    if (released.d_childList != NoChildList)
+    {
+        const size_t list = released.d_childList;
+        released.d_childList = NoChildList;
+
+        // the list is swapped out first, releasing children may reuse it
+        std::vector<SlotId> children;
+        children.swap(d_childLists[list]);
+        d_freeChildLists.push_back(list);
+
+        for (typename std::vector<SlotId>::const_iterator itor = children.begin();
+            itor != children.end(); ++itor)
+        {
+            releaseSubtree(*itor);
+        }
+    }
+
+    d_slots[slot].d_item = TItem();
+    d_slots[slot].d_used = false;
+    d_freeSlots.push_back(slot);
+    --d_itemCount;
+}
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif
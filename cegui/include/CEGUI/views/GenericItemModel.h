@@ -31,6 +31,7 @@
 #include "CEGUI/Exceptions.h"
 #include <vector>
 #include <algorithm>
+#include <iterator>
 
 #if defined (_MSC_VER)
 #   pragma warning(push)
@@ -197,6 +198,35 @@ public:
     */
     virtual void insertItem(GenericItem* item, const GenericItem* position);
 
+    /*!
+    \brief
+        Adds the items in [\a first, \a last) as children of the specified
+        parent, starting at the specified position, and takes ownership of them.
+
+        The children list of the parent grows once for the whole range and the
+        listeners are notified with a single pair of EventChildrenWillBeAdded
+        and EventChildrenAdded events, so that views update in one go instead
+        of once per item.
+
+    \tparam TIterator
+        A forward iterator over pointers to GenericItem or a derived type.
+    */
+    template <typename TIterator>
+    void addItemsAtPosition(TIterator first, TIterator last,
+        const ModelIndex& parent, size_t position);
+
+    //! Adds the items in [\a first, \a last) after the children of the root.
+    template <typename TIterator>
+    void addItems(TIterator first, TIterator last);
+
+    /*!
+    \brief
+        Inserts the items in [\a first, \a last) before the specified
+        \a position item, with the semantics of insertItem(GenericItem*, const GenericItem*).
+    */
+    template <typename TIterator>
+    void insertItems(TIterator first, TIterator last, const GenericItem* position);
+
     virtual void removeItem(const GenericItem* item);
     virtual void removeItem(const ModelIndex& index);
 
@@ -460,6 +490,60 @@ void GenericItemModel<TGenericItem>::insertItem(GenericItem* item,
         child_id <= 0 ? 0 : static_cast<size_t>(child_id));
 }
 
+//----------------------------------------------------------------------------//
+template <typename TGenericItem>
+template <typename TIterator>
+void GenericItemModel<TGenericItem>::addItemsAtPosition(TIterator first,
+    TIterator last, const ModelIndex& parent_index, size_t position)
+{
+    GenericItem* parent = static_cast<GenericItem*>(parent_index.d_modelData);
+    std::vector<GenericItem*>& children = parent->getChildren();
+    if (position > children.size())
+        throw InvalidRequestException("The specified position is out of range.");
+
+    for (TIterator itor = first; itor != last; ++itor)
+    {
+        if (*itor == nullptr)
+            throw InvalidRequestException("Cannot add a NULL item to the model!");
+    }
+
+    const size_t count = static_cast<size_t>(std::distance(first, last));
+    if (count == 0)
+        return;
+
+    notifyChildrenWillBeAdded(parent_index, position, count);
+
+    children.insert(children.begin() + position, first, last);
+    for (size_t i = position; i < position + count; ++i)
+        children[i]->setParent(parent);
+
+    notifyChildrenAdded(parent_index, position, count);
+}
+
+//----------------------------------------------------------------------------//
+template <typename TGenericItem>
+template <typename TIterator>
+void GenericItemModel<TGenericItem>::addItems(TIterator first, TIterator last)
+{
+    addItemsAtPosition(first, last, getRootIndex(), d_root->getChildren().size());
+}
+
+//----------------------------------------------------------------------------//
+template <typename TGenericItem>
+template <typename TIterator>
+void GenericItemModel<TGenericItem>::insertItems(TIterator first, TIterator last,
+    const GenericItem* position)
+{
+    int child_id = position == nullptr ? -1 : getChildId(position);
+
+    ModelIndex parent_index = getRootIndex();
+    if (position != nullptr)
+        parent_index = getParentIndex(getIndexForItem(position));
+
+    addItemsAtPosition(first, last, parent_index,
+        child_id <= 0 ? 0 : static_cast<size_t>(child_id));
+}
+
 //----------------------------------------------------------------------------//
 template <typename TGenericItem>
 void GenericItemModel<TGenericItem>::removeItem(const ModelIndex& index)
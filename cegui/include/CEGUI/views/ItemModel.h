@@ -283,6 +283,42 @@ public:
     */
     virtual String getData(const ModelIndex& model_index, ItemDataRole role = ItemDataRole::Text) = 0;
 
+    /*!
+    \brief
+        Returns whether the data of the specified ModelIndex for the specified
+        role is not available yet, e.g. because it is still being fetched from
+        a remote backend.
+
+        While the data is pending, views do not use getData() and show a
+        placeholder instead (see ItemView::setPendingItemText). Once the data
+        arrives, the model must raise EventChildrenDataChanged for the affected
+        children (e.g. via notifyChildrenDataChanged) so that the views query
+        them again.
+
+        The default implementation returns false, all the data is available
+        synchronously.
+    */
+    virtual bool isDataPending(const ModelIndex& model_index,
+        ItemDataRole role = ItemDataRole::Text) const;
+
+    /*!
+    \brief
+        Hints that the data of \a count children of \a parent_index, starting
+        at \a start_id, is about to be shown.
+
+        Views call this from prepareForRender() for the children in or near the
+        visible area, so models backed by slow or remote storage can fetch
+        these children (usually as whole pages) without blocking getData().
+        The same children may be requested many times while they are shown, so
+        implementations should ignore those already available or being
+        fetched. The range is never empty and lies within
+        getChildCount(parent_index).
+
+        The default implementation does nothing.
+    */
+    virtual void requestData(const ModelIndex& parent_index, size_t start_id,
+        size_t count);
+
     /*!
     \brief
         Notifies any listeners of the EventChildrenWillBeAdded event that new children
@@ -146,6 +146,48 @@ struct CEGUIEXPORT ModelIndexSelectionState
 };
 typedef std::vector<ModelIndexSelectionState> SelectionStatesVector;
 
+/*!
+\brief
+    Set of child ids stored as sorted, disjoint and non adjacent ranges.
+
+    Used by ItemView to store the selected children of a parent, so that
+    selecting a whole range of children adds a single range and looking up a
+    child is a binary search.
+*/
+class CEGUIEXPORT ChildIdRangeSet
+{
+public:
+    //! Child ids from d_first up to, but excluding, d_end.
+    struct Range
+    {
+        size_t d_first;
+        size_t d_end;
+    };
+
+    ChildIdRangeSet() : d_count(0) {}
+
+    //! Returns whether the given child id is in the set.
+    bool contains(size_t id) const;
+    //! Adds the child ids [first, end) to the set.
+    void insert(size_t first, size_t end);
+    //! Removes the child ids [first, end) from the set.
+    void erase(size_t first, size_t end);
+    //! Shifts the ids for \a count children inserted at \a start.
+    void insertChildren(size_t start, size_t count);
+    //! Removes the ids of \a count children removed at \a start and shifts the others.
+    void removeChildren(size_t start, size_t count);
+    void clear();
+
+    bool empty() const { return d_ranges.empty(); }
+    //! Returns the number of child ids in the set.
+    size_t getCount() const { return d_count; }
+    const std::vector<Range>& getRanges() const { return d_ranges; }
+
+private:
+    std::vector<Range> d_ranges;
+    size_t d_count;
+};
+
 class CEGUIEXPORT ItemViewEventArgs : public WindowEventArgs
 {
 public:
@@ -173,6 +215,10 @@ public:
 
     static const Colour DefaultTextColour;
     static const Colour DefaultSelectionColour;
+    //! Default text shown for the items whose data is pending.
+    static const String DefaultPendingItemText;
+    //! Default number of children requested around the visible ones.
+    static const size_t DefaultDataPrefetchCount;
     //! Widget name for the vertical scrollbar component.
     static const String VertScrollbarName;
     //! Widget name for the horizontal scrollbar component.
@@ -180,6 +226,7 @@ public:
 
     static const String EventVertScrollbarDisplayModeChanged;
     static const String EventHorzScrollbarDisplayModeChanged;
+    //! Fired when the selection changes, once per EventSet::BatchScope.
     static const String EventSelectionChanged;
     static const String EventMultiselectModeChanged;
     static const String EventSortModeChanged;
@@ -221,13 +268,29 @@ public:
        that the next call to prepareForRender() will have to reconstruct it's
        rendering state.
 
-       This also calls the base Window::invalidate.
+       Unless d_partialInvalidation is set, the rendering states of all the
+       items are marked for an update as well. This also calls the base
+       Window::invalidate.
     */
     virtual void invalidateView(bool recursive);
 
     /*!
     \brief
-       Gets the current state of the indices used for selection.
+       Invalidates this view after a change that was already applied to the
+       rendering states of the affected items, so that the next call to
+       prepareForRender() only updates the scrollbars.
+    */
+    void invalidateViewPartially(bool recursive);
+
+    /*!
+    \brief
+       Gets the current state of the indices used for selection, ordered by
+       parent and then by child id.
+
+       The selection is stored as ranges of child ids; this vector is built
+       from them the first time it is requested after the selection changed.
+       Prefer isIndexSelected(), isChildSelected() and getSelectionCount() for
+       large selections.
 
     \remark
         This vector's iterator might get invalidated in the case when items are
@@ -272,6 +335,33 @@ public:
 
     virtual bool isIndexSelected(const ModelIndex& index) const;
 
+    /*!
+    \brief
+        Returns whether the child with the given id of \a parent_index is
+        selected. This does not need to look the child id up in the model.
+    */
+    bool isChildSelected(const ModelIndex& parent_index, size_t child_id) const;
+
+    //! Returns the number of selected indices.
+    size_t getSelectionCount() const;
+
+    /*!
+    \brief
+        Returns the selected child ids of \a parent_index, or nullptr if none
+        of its children is selected.
+    */
+    const ChildIdRangeSet* getSelectedChildIds(const ModelIndex& parent_index) const;
+
+    /*!
+    \brief
+        Selects all children of the model's root index as a single range, if
+        multi-selection is enabled.
+
+    \return
+        True if the selection was changed, false otherwise.
+    */
+    bool selectAll();
+
     /*!
     \brief
         Ensures that the item specified by the \a index is visible by setting
@@ -350,18 +440,81 @@ public:
     //! Setting a new sorting mode will trigger the instant sorting of this view.
     void setSortMode(ViewSortMode sort_mode);
 
+    /*!
+    \brief
+        Sets the text shown for the items whose data the model reports as
+        pending (see ItemModel::isDataPending), until the model notifies that
+        their data changed.
+    */
+    void setPendingItemText(const String& text);
+    const String& getPendingItemText() const { return d_pendingItemText; }
+
+    /*!
+    \brief
+        Sets how many children before and after the visible ones are passed
+        to ItemModel::requestData, so that models can fetch them before they
+        are scrolled into view.
+    */
+    void setDataPrefetchCount(size_t count);
+    size_t getDataPrefetchCount() const { return d_dataPrefetchCount; }
+
     //! Returns the width of the rendered contents.
     float getRenderedMaxWidth() const;
     //! Returns the height of the rendered contents.
     float getRenderedTotalHeight() const;
 
 protected:
+    /*!
+    \brief
+        Heights of the rows of a virtualised view in display order, along with
+        a Fenwick tree of their prefix sums, so that the offset of a row and
+        the row at an offset are found in logarithmic time.
+    */
+    class RowOffsets
+    {
+    public:
+        void reset(size_t count, float height);
+        void insert(size_t row, size_t count, float height);
+        void erase(size_t row, size_t count);
+        void setHeight(size_t row, float height);
+        float getHeight(size_t row) const { return d_heights[row]; }
+        //! Returns the sum of the heights of the rows before \a row.
+        float getOffset(size_t row) const;
+        //! Returns the row containing \a offset, or size() if it is past the last row.
+        size_t findRow(float offset) const;
+        size_t size() const { return d_heights.size(); }
+
+    private:
+        void rebuild();
+
+        std::vector<float> d_heights;
+        //! One-based Fenwick tree over d_heights.
+        std::vector<float> d_tree;
+    };
+
     ItemModel* d_itemModel;
     ColourRect d_textColourRect;
     ColourRect d_selectionColourRect;
     bool d_isDirty;
     bool d_needsFullRender;
-    std::vector<ModelIndexSelectionState> d_indexSelectionStates;
+    //! Whether prepareForRender() has to update the rendering state of every item.
+    bool d_needsItemsUpdate;
+    /*!
+        Set while the view is invalidated by a change that was already applied
+        to the rendering states, such as scrolling or a range of model changes.
+    */
+    bool d_partialInvalidation;
+    //! The selected child ids of a parent index.
+    struct SelectedChildren
+    {
+        ModelIndex d_parentIndex;
+        ChildIdRangeSet d_childIds;
+    };
+    //! The selection, with one entry per parent that has selected children.
+    std::vector<SelectedChildren> d_selection;
+    //! Built from d_selection by getIndexSelectionStates() when outdated.
+    mutable std::vector<ModelIndexSelectionState> d_indexSelectionStates;
+    mutable bool d_indexSelectionStatesOutdated;
     ModelIndex d_lastSelectedIndex;
     const Image* d_selectionBrush;
     ScrollbarDisplayMode d_vertScrollbarDisplayMode;
@@ -371,6 +524,8 @@ protected:
     ViewSortMode d_sortMode;
     bool d_isAutoResizeHeightEnabled;
     bool d_isAutoResizeWidthEnabled;
+    String d_pendingItemText;
+    size_t d_dataPrefetchCount;
 
     //TODO: move this into the renderer instead?
     float d_renderedMaxWidth;
@@ -417,9 +572,24 @@ protected:
     void connectToModelEvents(ItemModel* d_itemModel);
     void disconnectModelEvents();
 
+    /*!
+    \brief
+        Returns the data of \a index for \a role, or the placeholder when the
+        model has not got it yet: the pending item text, or an empty string
+        for icons.
+    */
+    String getItemData(const ModelIndex& index, ItemDataRole role = ItemDataRole::Text);
+    /*!
+    \brief
+        Passes the given children of \a parent_index, extended by the prefetch
+        count on both sides, to ItemModel::requestData as few ranges as
+        possible.
+    */
+    void requestItemData(const ModelIndex& parent_index, const ChildIdRangeSet& child_ids);
+
     void handleOnScroll(Scrollbar* scrollbar, float scroll);
     void setupTooltip(glm::vec2 position);
-    int getSelectedIndexPosition(const ModelIndex& index) const;
+    ChildIdRangeSet* findSelectedChildIds(const ModelIndex& parent_index, bool create);
     virtual bool handleSelection(const glm::vec2& position, bool should_select,
         bool is_cumulative, bool is_range);
     virtual bool handleSelection(const ModelIndex& index, bool should_select,
@@ -98,8 +98,19 @@ public:
     ListView(const String& type, const String& name);
     virtual ~ListView();
 
+    /*!
+    \brief
+        Returns the rendering states of the items, in display order.
+
+        In virtualised mode only the items around the visible area have a
+        rendering state; they start at getItemsOffset() instead of at the top
+        of the contents.
+    */
     const std::vector<ListViewItemRenderingState*>& getItems() const;
 
+    //! Returns the vertical position, in the contents, of the first item returned by getItems().
+    float getItemsOffset() const;
+
     void prepareForRender() override;
 
     ModelIndex indexAt(const glm::vec2& position) override;
@@ -116,9 +127,71 @@ public:
     */
     void    setHorizontalFormatting(HorizontalTextFormatting h_fmt);
 
+    /*!
+    \brief
+        Sets whether only the items around the visible area are laid out and
+        rendered.
+
+        In virtualised mode the heights of all items are kept in a prefix sum
+        structure, starting from the estimate returned by
+        getVirtualisedRowHeight(). Only the items within the scrolled view,
+        plus a few items above and below it, get a rendering state; their
+        measured heights replace the estimates. The rendering states are
+        recycled as the view scrolls, and items that stay visible are not
+        formatted again by a scroll. This keeps lists with a very large number
+        of items cheap to update and render.
+    */
+    void setVirtualised(bool virtualised);
+
+    //! Returns whether only the items around the visible area are laid out and rendered.
+    bool isVirtualised() const { return d_virtualised; }
+
+    /*!
+    \brief
+        Sets the height of the items in virtualised mode.
+
+        With a positive height all items are laid out with exactly this
+        height. With 0, the default, the line spacing of the font is used as
+        an estimate for the items that were not formatted yet.
+    */
+    void setVirtualisedRowHeight(float height);
+
+    //! Returns the height of the items in virtualised mode, 0 if it is estimated.
+    float getVirtualisedRowHeight() const { return d_virtualisedRowHeight; }
+
+    //! Number of items above and below the visible area formatted in virtualised mode.
+    static const size_t VirtualisedOverscanRows;
+
+    /*!
+    \brief
+        Shows only the items whose text starts with \a text, or all the items
+        if \a text is empty.
+
+        The matching items are looked up in an index of the item texts sorted
+        once per model change, so changing the filter as the user types only
+        costs a binary search plus the formatting of the rows shown; the
+        items stay in the model untouched.
+    */
+    void setFilterText(const String& text);
+
+    //! Returns the text that shown items must start with, empty if not filtering.
+    const String& getFilterText() const { return d_filterText; }
+
+    //! Returns whether the view currently hides items not matching the filter text.
+    bool isFiltered() const { return !d_filterText.empty(); }
+
+    /*!
+    \brief
+        Returns the lowest child id, not below \a start_id, of the items of the
+        root whose text is exactly \a text, or -1 if there is none. Uses the
+        same index as the filter.
+    */
+    int findChildIdWithText(const String& text, size_t start_id = 0);
+
 protected:
     bool onChildrenAdded(const EventArgs& args) override;
     bool onChildrenRemoved(const EventArgs& args) override;
+    bool onChildrenDataChanged(const EventArgs& args) override;
 
     //! Horizontal formatting to be applied to the text.
     HorizontalTextFormatting d_horzFormatting;
@@ -127,12 +200,51 @@ private:
     std::vector<ListViewItemRenderingState> d_items;
     std::vector<ListViewItemRenderingState*> d_sortedItems;
 
+    bool d_virtualised;
+    float d_virtualisedRowHeight;
+    RowOffsets d_rowOffsets;
+    /*!
+        Child ids of the items in display order, empty when not sorting. It
+        is sorted once and then kept in order by binary insertions as the
+        model reports added, removed or changed items.
+    */
+    std::vector<size_t> d_sortOrder;
+    //! Row of the first element of d_items in virtualised mode.
+    size_t d_firstVirtualRow;
+
+    String d_filterText;
+    //! Child ids of the items matching d_filterText, in display order.
+    std::vector<size_t> d_filteredRows;
+    //! Texts of the children of the root along with their ids, sorted by text.
+    std::vector<std::pair<String, size_t>> d_textIndex;
+    //! Model d_textIndex was built from, the index is rebuilt when it changes.
+    const ItemModel* d_textIndexModel;
+    bool d_textIndexOutdated;
+
+    void prepareVirtualisedRows();
+    float getVirtualisedRowEstimate() const;
+    size_t getChildIdForRow(size_t row) const;
+    //! Returns the number of rows displayed for the given number of children.
+    size_t getRowCount(size_t child_count) const;
+    void updateTextIndex();
+    void buildFilteredRows();
+    bool isChildBefore(size_t child1, size_t child2) const;
+    //! Returns the row at which the child would be inserted into d_sortOrder.
+    size_t getSortedInsertRow(size_t child_id) const;
+    void buildSortOrder(size_t child_count);
+    void insertIntoSortOrder(size_t start_id, size_t count);
+    void eraseFromSortOrder(size_t start_id, size_t count);
+    //! Moves the changed children to their new rows in d_sortOrder.
+    void updateSortOrder(size_t start_id, size_t count);
+    //! Points d_sortedItems to the items in display order.
+    void updateSortedItems();
+
     void resortListView();
     void resortView() override;
 
-    //! Updates the rendering state for the specified \a item using the specified
-    //! \a index as the data source.
-    void updateItem(ListViewItemRenderingState& item, ModelIndex index,
+    //! Updates the rendering state for the specified \a item using the child
+    //! of the root with the specified \a child_id as the data source.
+    void updateItem(ListViewItemRenderingState& item, size_t child_id,
         float& max_width, float& total_height);
 
     Rectf getIndexRect(const ModelIndex& index) override;
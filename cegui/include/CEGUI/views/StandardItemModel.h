@@ -65,6 +65,18 @@ class CEGUIEXPORT StandardItemModel : public GenericItemModel<StandardItem>
 public:
     StandardItemModel();
 
+    using GenericItemModel<StandardItem>::addItems;
+
+    /*!
+    \brief
+        Adds a new item for each of the given texts after the children of the
+        root, notifying the listeners once for all of them.
+
+        Unlike the iterator based overload this can be called from the script
+        bindings, which then cross into C++ once per list instead of per item.
+    */
+    void addItems(const std::vector<String>& texts);
+
     /*!
     \brief
         Updates the specified \a item's text with the new one.
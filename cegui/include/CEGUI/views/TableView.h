@@ -0,0 +1,275 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITableView_h_
+#define _CEGUITableView_h_
+
+#include "CEGUI/views/ItemView.h"
+
+#if defined (_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+
+/*!
+\brief
+    Describes a column of a TableView.
+
+    The cells of a column show the data of the column's role for each child of
+    the ItemModel::getRootIndex(), so a model exposes the fields of its rows
+    through ItemDataRole::Text and user defined roles starting at
+    ItemDataRole::User.
+*/
+struct CEGUIEXPORT TableViewColumn
+{
+    //! Text shown in the header of the column.
+    String d_header;
+    //! Width of the column in pixels.
+    float d_width;
+    //! Role whose data is shown in the cells of the column.
+    ItemDataRole d_role;
+};
+
+/*!
+\brief
+    Rendering state of a cell of the TableView.
+
+    Only the cells within the visible area, plus a few rows around it, have a
+    rendering state. The states are recycled as the view scrolls.
+*/
+struct CEGUIEXPORT TableViewCellRenderingState
+{
+    //! Held by pointer so that recycling a state does not copy the string.
+    RenderedString* d_string;
+    String d_text;
+    //! Row of the cell in display order.
+    size_t d_row;
+    size_t d_column;
+    bool d_isSelected;
+
+    TableViewCellRenderingState();
+    ~TableViewCellRenderingState();
+
+    TableViewCellRenderingState(TableViewCellRenderingState&&) noexcept;
+    TableViewCellRenderingState& operator=(TableViewCellRenderingState&&) noexcept;
+
+    TableViewCellRenderingState(const TableViewCellRenderingState&) = delete;
+    TableViewCellRenderingState& operator=(const TableViewCellRenderingState&) = delete;
+
+    void setString(const RenderedString& string);
+};
+
+/*!
+\brief
+    View that displays the children of the model's root as the rows of a
+    table, with one column per data role.
+
+    The view is virtualised in both directions: all rows have the same height
+    and the horizontal offsets of the columns are cached, so the visible range
+    of rows and columns is found without visiting the others. Only the cells
+    within that range, plus VirtualisedOverscanRows rows above and below it,
+    are laid out and rendered, which keeps wide tables with many rows cheap to
+    update and render. Cells that stay visible are not formatted again when
+    the view scrolls.
+
+    Sorting orders the rows by the data of the sort column through an index
+    of child ids; the model and the rendering states are never reordered.
+    Clicking the header of a column sorts by that column, clicking it again
+    reverses the order.
+*/
+class CEGUIEXPORT TableView : public ItemView
+{
+public:
+    //! Window factory name
+    static const String WidgetTypeName;
+    //! Namespace for global events
+    static const String EventNamespace;
+    //! Number of rows above and below the visible area that are laid out.
+    static const size_t VirtualisedOverscanRows;
+
+    TableView(const String& type, const String& name);
+    virtual ~TableView();
+
+    /*!
+    \brief
+        Appends a column to the table.
+
+    \param header
+        The text shown in the header of the column.
+
+    \param width
+        The width of the column in pixels.
+
+    \param role
+        The role whose data is shown in the cells of the column.
+
+    \return
+        The index of the new column.
+    */
+    size_t addColumn(const String& header, float width,
+        ItemDataRole role = ItemDataRole::Text);
+
+    /*!
+    \brief
+        Removes the column at the given index.
+
+    \exception InvalidRequestException
+        thrown if \a column is out of range.
+    */
+    void removeColumn(size_t column);
+
+    //! Returns the number of columns.
+    size_t getColumnCount() const { return d_columns.size(); }
+
+    /*!
+    \brief
+        Returns the column at the given index.
+
+    \exception InvalidRequestException
+        thrown if \a column is out of range.
+    */
+    const TableViewColumn& getColumn(size_t column) const;
+
+    /*!
+    \brief
+        Sets the width of the column at the given index, in pixels.
+
+    \exception InvalidRequestException
+        thrown if \a column is out of range.
+    */
+    void setColumnWidth(size_t column, float width);
+
+    /*!
+    \brief
+        Returns the horizontal position of the given column in the contents.
+        Passing getColumnCount() returns the total width of the columns.
+    */
+    float getColumnOffset(size_t column) const;
+
+    /*!
+    \brief
+        Returns the column at the given horizontal position in the contents,
+        or getColumnCount() if there is no column at that position.
+    */
+    size_t getColumnAt(float x) const;
+
+    /*!
+    \brief
+        Sets the height of the rows and of the header. With 0, the default,
+        the line spacing of the font is used.
+    */
+    void setRowHeight(float height);
+
+    //! Returns the height of the rows set by setRowHeight().
+    float getRowHeight() const { return d_rowHeight; }
+
+    //! Returns the height the rows and the header are laid out with.
+    float getEffectiveRowHeight() const;
+
+    /*!
+    \brief
+        Sets the column the rows are sorted by when the sort mode is not
+        ViewSortMode::NoSorting.
+    */
+    void setSortColumn(size_t column);
+
+    //! Returns the column the rows are sorted by.
+    size_t getSortColumn() const { return d_sortColumn; }
+
+    /*!
+    \brief
+        Returns the rendering states of the cells around the visible area,
+        row by row.
+    */
+    const std::vector<TableViewCellRenderingState>& getCells() const { return d_cells; }
+
+    //! Returns the rendering states of the headers of the visible columns.
+    const std::vector<TableViewCellRenderingState>& getHeaderCells() const { return d_headerCells; }
+
+    //! Returns the child id shown by the given row.
+    size_t getChildIdForRow(size_t row) const;
+
+    void prepareForRender() override;
+
+    ModelIndex indexAt(const glm::vec2& position) override;
+
+    void ensureIndexIsVisible(const ModelIndex& index) override;
+
+protected:
+    bool onChildrenAdded(const EventArgs& args) override;
+    bool onChildrenRemoved(const EventArgs& args) override;
+    bool onChildrenDataChanged(const EventArgs& args) override;
+
+    bool handleSelection(const glm::vec2& position, bool should_select,
+        bool is_cumulative, bool is_range) override;
+
+private:
+    std::vector<TableViewColumn> d_columns;
+    //! Offsets of the columns, with the total width as the last element.
+    std::vector<float> d_columnOffsets;
+    float d_rowHeight;
+    size_t d_sortColumn;
+    /*!
+        Child ids of the rows in display order, empty when not sorting. It is
+        kept in order by binary insertions as the model reports changes.
+    */
+    std::vector<size_t> d_sortOrder;
+
+    std::vector<TableViewCellRenderingState> d_cells;
+    std::vector<TableViewCellRenderingState> d_headerCells;
+    //! Rows [d_firstRow, d_endRow) and columns [d_firstColumn, d_endColumn) of d_cells.
+    size_t d_firstRow;
+    size_t d_endRow;
+    size_t d_firstColumn;
+    size_t d_endColumn;
+
+    void updateColumnOffsets();
+    void checkColumn(size_t column) const;
+    void updateCell(TableViewCellRenderingState& cell, size_t row, size_t column);
+    void updateHeaderCells();
+
+    bool isChildBefore(size_t child1, size_t child2) const;
+    size_t getSortedInsertRow(size_t child_id) const;
+    void buildSortOrder(size_t child_count);
+    void insertIntoSortOrder(size_t start_id, size_t count);
+    void eraseFromSortOrder(size_t start_id, size_t count);
+    void updateSortOrder(size_t start_id, size_t count);
+    size_t getRowForChildId(size_t child_id) const;
+
+    void resortView() override;
+    Rectf getIndexRect(const ModelIndex& index) override;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif
@@ -168,6 +168,46 @@ public:
     */
     void toggleSubtree(TreeViewItemRenderingState& item);
 
+    /*!
+    \brief
+        Sets whether only the rows around the visible area get a rendering
+        state.
+
+        In virtualised mode the expanded part of the tree is kept as a flat
+        list of rows with a prefix sum index of their heights, starting from
+        the estimate given by getVirtualisedRowHeight(). Only the rows within
+        the scrolled view, plus a few rows above and below it, are formatted;
+        they are returned by getVirtualisedItems() instead of being children
+        of getRootItemState(). Expanding or collapsing a subtree inserts or
+        removes the range of rows below it without rebuilding the others.
+    */
+    void setVirtualised(bool virtualised);
+
+    //! Returns whether only the rows around the visible area get a rendering state.
+    bool isVirtualised() const { return d_virtualised; }
+
+    /*!
+    \brief
+        Sets the height of the rows in virtualised mode.
+
+        With a positive height all rows are laid out with exactly this height.
+        With 0, the default, the line spacing of the font is used as an
+        estimate for the rows that were not formatted yet.
+    */
+    void setVirtualisedRowHeight(float height);
+
+    //! Returns the height of the rows in virtualised mode, 0 if it is estimated.
+    float getVirtualisedRowHeight() const { return d_virtualisedRowHeight; }
+
+    //! Returns the rendering states of the rows around the visible area in virtualised mode, in display order.
+    const std::vector<TreeViewItemRenderingState*>& getVirtualisedItems() const;
+
+    //! Returns the vertical position, in the contents, of the first item returned by getVirtualisedItems().
+    float getItemsOffset() const;
+
+    //! Number of rows above and below the visible area formatted in virtualised mode.
+    static const size_t VirtualisedOverscanRows;
+
 protected:
     TreeViewWindowRenderer* getViewRenderer() override;
     bool handleSelection(const glm::vec2& position, bool should_select,
@@ -177,6 +217,7 @@ protected:
 
     bool onChildrenRemoved(const EventArgs& args) override;
     bool onChildrenAdded(const EventArgs& args) override;
+    bool onChildrenDataChanged(const EventArgs& args) override;
 
     virtual void onSubtreeExpanded(ItemViewEventArgs& args);
     virtual void onSubtreeCollapsed(ItemViewEventArgs& args);
@@ -215,6 +256,43 @@ private:
     void resortView() override;
 
     Rectf getIndexRect(const ModelIndex& index) override;
+
+    //! A row of the flattened, expanded part of the tree in virtualised mode.
+    struct VirtualRow
+    {
+        ModelIndex d_parentIndex;
+        size_t d_childId;
+        int d_nestedLevel;
+        bool d_subtreeIsExpanded;
+    };
+    typedef std::vector<VirtualRow> VirtualRowVector;
+
+    bool d_virtualised;
+    float d_virtualisedRowHeight;
+    //! Rows in display order; the rows of a subtree follow the row of its parent.
+    VirtualRowVector d_virtualRows;
+    RowOffsets d_rowOffsets;
+    //! Rendering states of the rows from d_firstVirtualRow on.
+    ItemStateVector d_virtualItems;
+    std::vector<TreeViewItemRenderingState*> d_virtualItemPointers;
+    size_t d_firstVirtualRow;
+
+    void prepareVirtualisedRows();
+    float getVirtualisedRowEstimate() const;
+    void resetVirtualRowHeights();
+    static size_t getVirtualSubtreeEnd(const VirtualRowVector& rows, size_t row);
+    bool isVirtualRowBefore(const VirtualRow& row1, const VirtualRow& row2) const;
+    void appendVirtualChildren(VirtualRowVector& rows, const ModelIndex& parent_index,
+        int nested_level, bool expand_all);
+    void appendSortedVirtualRows(const VirtualRowVector& rows, size_t begin,
+        size_t end, VirtualRowVector& out) const;
+    void expandVirtualRows(size_t begin, size_t end);
+    void toggleVirtualRow(size_t row);
+    bool getVirtualRowOfItem(const TreeViewItemRenderingState& item, size_t& row) const;
+    bool getVirtualChildrenRange(const ModelIndex& parent_index, size_t& begin,
+        size_t& end, int& nested_level) const;
+    void onVirtualChildrenAdded(const ModelEventArgs& args);
+    void onVirtualChildrenRemoved(const ModelEventArgs& args);
 };
 
 };
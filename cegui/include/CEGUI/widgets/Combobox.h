@@ -248,6 +248,9 @@ public:
     //! return whether the drop-list will horizontally auto size to content.
     bool getAutoSizeListWidthToContent() const;
 
+    //! return whether typing in the editbox filters the items of the drop-list.
+    bool isListFilteringEnabled() const { return d_listFiltering; }
+
 	/*************************************************************************
 		Editbox Accessors
 	*************************************************************************/
@@ -559,6 +562,17 @@ public:
     //! update drop list size according to auto-size options.
     void updateAutoSizedDropList();
 
+    /*!
+    \brief
+        Sets whether the drop-down list only shows the items starting with the
+        text typed into the editbox.
+
+        The items are filtered by ListView::setFilterText, so no item is
+        recreated while typing. Showing the list with the button shows all the
+        items again.
+    */
+    void setListFilteringEnabled(bool setting);
+
 	/*************************************************************************
 		Editbox Manipulators
 	*************************************************************************/
@@ -1028,6 +1042,8 @@ protected:
 	bool			d_singleClickOperation;		//!< true if user can show and select from list in a single click.
     bool d_autoSizeHeight;
     bool d_autoSizeWidth;
+    //! true if typing in the editbox filters the items of the drop-list.
+    bool d_listFiltering;
 
 private:
 	/*************************************************************************
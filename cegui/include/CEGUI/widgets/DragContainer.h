@@ -215,6 +215,35 @@ public:
     */
     void setStickyModeEnabled(bool setting) { d_stickyMode = setting; }
 
+    /*!
+    \brief
+        Return whether the DragContainer is dragged as a cached image.
+
+    \see setDragImageEnabled
+    */
+    bool isDragImageEnabled() const { return d_dragImageEnabled; }
+
+    /*!
+    \brief
+        Enable or disable dragging the DragContainer as a cached image.
+
+        When enabled, the content of the DragContainer is rendered once to a
+        texture when dragging starts and only that image follows the cursor.
+        The DragContainer itself keeps its position, so neither it nor any of
+        its children are redrawn or laid out while being dragged. The
+        DragContainer is moved to the dragged position when it is dropped.
+
+        The image uses the automatic rendering surface of the DragContainer,
+        which is enabled for the duration of the drag if it is not already.
+        When texture targets are not available the DragContainer is dragged
+        as usual.
+
+    \param setting
+        - true to drag the DragContainer as a cached image.
+        - false to move the DragContainer itself while dragging (default).
+    */
+    void setDragImageEnabled(bool setting) { d_dragImageEnabled = setting; }
+
     /*!
     \brief
         Immediately pick up the DragContainer and optionally set the sticky
@@ -315,6 +344,15 @@ protected:
 
     void updateDropTarget();
 
+    //! Switch to drawing the cached drag image, if enabled and possible.
+    void beginDragImage();
+
+    //! Place the drag image at the current drag offset.
+    void updateDragImage();
+
+    //! Stop drawing the drag image and return the surface to its normal use.
+    void endDragImage();
+
     /*************************************************************************
         Overrides for Event handler methods
     *************************************************************************/
@@ -325,6 +363,7 @@ protected:
     void onAlphaChanged(WindowEventArgs& e) override;
     void onClippingChanged(WindowEventArgs& e) override;/*Window::drawSelf(z);*/
     void onMoved(ElementEventArgs& e) override;
+    uint8_t handleAreaChanges(bool moved, bool sized) override;
 
     /*************************************************************************
         New Event handler methods
@@ -414,6 +453,7 @@ protected:
     UVector2     d_dragPoint;                //!< point we are being dragged at.
     UVector2     d_startPosition;            //!< position prior to dragging.
     UVector2     d_fixedDragOffset;          //!< current fixed cursor offset value.
+    glm::vec2    d_dragImageOffset;          //!< Pixel offset of the drag image from the DragContainer.
     float        d_dragThreshold;            //!< Pixels cursor must move before dragging commences.
     float        d_dragAlpha;                //!< Alpha value to set when dragging.
     float        d_storedAlpha;              //!< Alpha value to re-set when dragging ends.
@@ -425,6 +465,9 @@ protected:
     bool         d_stickyMode : 1;           //!< true when we're in 'sticky' mode.
     bool         d_pickedUp : 1;             //!< true after been picked-up / dragged via sticky mode
     bool         d_usingFixedDragOffset : 1; //!< true if fixed cursor offset is used for dragging position.
+    bool         d_dragImageEnabled : 1;     //!< true when dragging is done with a cached image.
+    bool         d_dragImageActive : 1;      //!< true while the drag image is drawn instead of the DragContainer.
+    bool         d_dragImageOwnsSurface : 1; //!< true if the auto rendering surface was enabled for the drag image.
 
 private:
     /*!
@@ -63,6 +63,17 @@ public:
         position \a pt.
     */
     virtual size_t getTextIndexFromPosition(const glm::vec2& pt) const = 0;
+
+    /*!
+    \brief
+        Update the geometry of the caret for the current caret position and
+        blink state, without redrawing the rest of the Editbox.
+
+    \return
+        - true if the geometry was updated.
+        - false if the Editbox must be redrawn instead (default).
+    */
+    virtual bool updateCaretGeometry() { return false; }
 };
 
 //----------------------------------------------------------------------------//
@@ -166,6 +177,10 @@ public:
         Alternatively, see the perl regex documentation at
         http://perldoc.perl.org/perlre.html
 
+        The system supplied validator is shared by all Editboxes using the same
+        validation string (see System::acquireRegexMatcher), so the pattern is
+        only compiled by the first of them.
+
     \param validation_string
         String object containing the validation regex data to be used.
 
@@ -185,7 +200,7 @@ public:
 
     \note
         If the previous RegexMatcher validator is one supplied via the system,
-        it is deleted and replaced with the given RegexMatcher.  User supplied
+        it is released and replaced with the given RegexMatcher.  User supplied
         RegexMatcher objects will never be deleted by the system and you must
         ensure that the object is not deleted while the Editbox holds a pointer
         to it.  Once the Editbox is destroyed or the validator is set to
@@ -209,6 +224,9 @@ protected:
     //! validate window renderer
     bool validateWindowRenderer(const WindowRenderer* renderer) const override;    
 
+    // overridden from EditboxBase
+    bool updateCaretGeometry() override;
+
     
 
 
@@ -276,7 +294,9 @@ protected:
     String d_validationString;
     //! Pointer to class used for validation of text.
     RegexMatcher* d_validator;
-    //! specifies whether validator was created by us, or supplied by user.
+    /** specifies whether validator was acquired from the System, shared with
+     * other Editboxes using the same validation string, or supplied by user.
+     */
     bool d_weOwnValidator;
     //! Current match state of EditboxText
     MatchState d_validatorMatchState;
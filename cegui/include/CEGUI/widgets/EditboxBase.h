@@ -367,10 +367,31 @@ public:
     //! \copydoc Window::performRedo
     bool performRedo() override;
 
+    /*!
+    \brief
+        Redraw the caret after its position or blink state changed.
+
+        The caret is updated in place when the window renderer supports it
+        (see updateCaretGeometry), otherwise the whole edit box is redrawn.
+    */
+    void invalidateCaret();
+
 protected:
     // Inherited methods
     bool validateWindowRenderer(const WindowRenderer* renderer) const override = 0;
 
+    /*!
+    \brief
+        Let the window renderer update the geometry of the caret for the
+        current caret position and blink state, without redrawing the rest of
+        the edit box.
+
+    \return
+        - true if the caret geometry was updated.
+        - false if the edit box must be redrawn instead (default).
+    */
+    virtual bool updateCaretGeometry();
+
     /*!
     \brief
         Return the text code point index that is rendered closest to screen
@@ -32,6 +32,7 @@
 #include "../Window.h"
 
 #include <map>
+#include <vector>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -75,7 +76,7 @@ public:
     \brief
         marks this layout container for relayouting before drawing
     */
-    void markNeedsLayouting() { d_needsLayouting = true; }
+    void markNeedsLayouting() { d_needsLayouting = true; requestUpdates(); }
 
     /*!
     \brief
@@ -98,6 +99,8 @@ public:
 
     /// @copydoc Window::update
     void update(float elapsed) override;
+    void updateWithoutChildren(float elapsed) override;
+    bool isUpdateRequired() const override;
 
     const CachedRectf& getChildContentArea(const bool non_client = false) const override { (void)non_client; return d_childContentArea; }
 
@@ -176,6 +179,18 @@ protected:
     */
     virtual void layout_impl() = 0;
 
+    /*!
+    \brief
+        Moves the children to the positions layout_impl stored for them in
+        d_childPositions, in child order.
+
+        Each child gets at most one area change notification and children
+        already in place are skipped. The child events fired meanwhile do not
+        mark this container for relayouting, since moving a child never
+        changes the sizes the layout was computed from.
+    */
+    void applyChildPositions();
+
     // overridden from parent class
     void onChildOrderChanged(ElementEventArgs& e) override;
 
@@ -190,6 +205,11 @@ protected:
     ConnectionTracker d_eventConnections;
     
     CachedRectf d_childContentArea;
+
+    //! Positions computed by layout_impl, reused between layouts.
+    std::vector<UVector2> d_childPositions;
+    //! true while applyChildPositions is moving the children.
+    bool d_applyingChildPositions;
 };
 
 } // End of  CEGUI namespace section
@@ -102,6 +102,20 @@ public:
     void addItem(StandardItem* item);
     void insertItem(StandardItem* item, const StandardItem* position);
 
+    /*!
+    \brief
+        Adds an item for each of the \a texts at the end of the list.
+
+        All the items are added with a single model notification, which makes
+        this much faster than calling addItem for each text when populating
+        large lists.
+    */
+    void addItems(const std::vector<String>& texts);
+    //! Adds the \a items at the end of the list, taking ownership of them.
+    void addItems(const std::vector<StandardItem*>& items);
+    //! Inserts the \a items before the \a position item, taking ownership of them.
+    void insertItems(const std::vector<StandardItem*>& items, const StandardItem* position);
+
     void removeItem(const StandardItem* item);
     //! Clears the items in this list and deletes all associated items.
     void clearList();
@@ -281,6 +281,7 @@ protected:
     void    onCursorLeaves(CursorInputEventArgs& e) override;
     void    onTextChanged(WindowEventArgs& e) override;
     void    updateSelf(float elapsed) override;
+    bool    isUpdateRequired() const override;
 
 
     /*************************************************************************
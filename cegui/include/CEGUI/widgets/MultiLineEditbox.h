@@ -65,6 +65,17 @@ public:
     */
     virtual Rectf getTextRenderArea() const = 0;
 
+    /*!
+    \brief
+        Update the geometry of the caret for the current caret position and
+        blink state, without redrawing the rest of the MultiLineEditbox.
+
+    \return
+        - true if the geometry was updated.
+        - false if the MultiLineEditbox must be redrawn instead (default).
+    */
+    virtual bool updateCaretGeometry() { return false; }
+
 protected:
     // base class overrides
     void onLookNFeelAssigned() override;
@@ -412,6 +423,9 @@ protected:
     // validate window renderer
     bool validateWindowRenderer(const WindowRenderer* renderer) const override;
 
+    // overridden from EditboxBase
+    bool updateCaretGeometry() override;
+
     virtual void onTargetSurfaceChanged(RenderingSurface* newSurface) override;
 
 	/*!
@@ -426,6 +440,27 @@ protected:
 	*/
 	size_t getNextTokenLength(const String& text, size_t start_idx) const;
 
+    /*!
+    \brief
+        Format the text into lines like formatText, but only reformat the
+        paragraphs changed since the last formatting. Lines after the change
+        are kept, shifted to their new position, once a reformatted paragraph
+        ends where an old one did. Falls back to formatText whenever the
+        font, the render area width or the word wrap mode changed.
+    */
+    void formatChangedText(const bool update_scrollbars);
+
+    /*!
+    \brief
+        Append the lines of the paragraph \a para_text, which starts at index
+        \a para_start of the text, to \a lines.
+    */
+    void formatParagraph(const Font& fnt, const String& para_text, size_t para_start,
+                         float area_width, LineList& lines) const;
+
+    //! Store the state that formatChangedText compares against.
+    void storeFormattingState(const Font* fnt);
+
 
     /*!
 	\brief
@@ -466,6 +501,10 @@ protected:
 	LineList        d_lines;			//!< Holds the lines for the current formatting.
 	float           d_lastRenderWidth;  //!< Holds last render area width
 	float           d_widestExtent;	//!< Holds the extent of the widest line as calculated in the last formatting pass.
+    String          d_formattedText;    //!< Text as it was when it was last formatted.
+    const Font*     d_formattedFont;    //!< Font used by the last formatting.
+    float           d_formattedLineSpacing; //!< Line spacing of d_formattedFont at the last formatting.
+    bool            d_formattedWordWrap;    //!< Word wrap mode of the last formatting.
 
 	// component widget settings
 	bool d_forceVertScroll;		//!< true if vertical scrollbar should always be displayed
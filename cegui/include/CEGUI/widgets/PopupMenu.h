@@ -158,6 +158,9 @@ protected:
     */
     void updateSelf(float elapsed) override;
 
+    // keeps receiving time pulses while fading
+    bool isUpdateRequired() const override;
+
 
     /*!
     \brief
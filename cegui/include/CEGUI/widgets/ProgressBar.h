@@ -31,6 +31,7 @@
 
 #include "../Base.h"
 #include "../Window.h"
+#include "../WindowRenderer.h"
 
 
 #if defined(_MSC_VER)
@@ -42,6 +43,30 @@
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+/*!
+\brief
+	Base class for ProgressBar window renderers.
+
+	Window renderers that do not derive from this class are supported as well,
+	the whole ProgressBar is then redrawn whenever the progress changes.
+*/
+class CEGUIEXPORT ProgressBarWindowRenderer : public WindowRenderer
+{
+public:
+	ProgressBarWindowRenderer(const String& name);
+
+	/*!
+	\brief
+		Update the geometry showing the progress for the current progress
+		value, without redrawing the rest of the ProgressBar.
+
+	\return
+		- true if the geometry was updated.
+		- false if the ProgressBar must be redrawn instead (default).
+	*/
+	virtual bool updateProgressGeometry() { return false; }
+};
+
 /*!
 \brief
 	Base class for progress bars.
@@ -237,6 +237,26 @@ public:
     */
     void setSwipeScrollingEnabled(bool setting);
 
+    /*!
+    \brief
+        Returns whether content windows lying entirely outside the viewable
+        area are skipped when drawing and updating.
+    */
+    bool isContentCullingEnabled() const;
+
+    /*!
+    \brief
+        Set whether content windows lying entirely outside the viewable area
+        are skipped when drawing and updating. Enabled by default.
+
+        Skipped windows build their geometry once they are scrolled into
+        view, so panes holding many windows only pay for the visible ones.
+
+    \param setting
+        true if off-screen content must be skipped, false to draw it all
+    */
+    void setContentCullingEnabled(bool setting);
+
     /*!
     \brief
         Returns the horizontal scrollbar step size as a fraction of one
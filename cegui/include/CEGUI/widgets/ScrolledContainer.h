@@ -30,6 +30,7 @@
 #include "../Window.h"
 #include "../WindowFactory.h"
 #include <map>
+#include <unordered_map>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -80,6 +81,20 @@ public:
     Rectf getChildExtentsArea() const;
 
     virtual void adjustSizeToContent() override;
+
+    /*!
+    \brief
+        Set whether children lying entirely outside the viewport of the
+        parent ScrollablePane are skipped when drawing and updating.
+
+        Culling is enabled by default.
+    */
+    void setChildCullingEnabled(bool setting);
+
+    //! Return whether children outside the viewport are skipped.
+    bool isChildCullingEnabled() const { return d_childCullingEnabled; }
+
+    bool isChildInView(const Window& child) const override;
     
     const CachedRectf& getChildContentArea(const bool non_client = false) const override { (void)non_client; return d_childContentArea; }
 
@@ -89,6 +104,11 @@ protected:
     
     Rectf getChildContentArea_impl(bool skipAllPixelAlignment) const;
 
+    //! Returns the size relative child areas are calculated against.
+    Sizef getChildBaseSize() const;
+    //! Returns the area \a child occupies within the extents of the content.
+    static Rectf getChildExtentArea(const Window& child, const Sizef& baseSize);
+
     //! handles notifications about child windows being moved or sized.
     bool handleChildAreaChanged(const EventArgs& e);
     void subscribeOnChildAreaEvents(Window* child);
@@ -96,6 +116,7 @@ protected:
 
     // overridden from Window.
     void drawSelf(const RenderingContext&, std::uint32_t) override {}
+    void prepareGeometry(const RenderingContext&, std::uint32_t) override {}
     Rectf getInnerRectClipper_impl() const override;
     Rectf getHitTestRect_impl() const override;
     void onChildAdded(ElementEventArgs& e) override;
@@ -113,7 +134,17 @@ protected:
     // It is intentionally not exposed to user. Use positive coords when possible.
     glm::vec2 d_contentOffset;
 
+    /*!
+    \brief
+        Areas of the children the size was last adjusted to. Children moving
+        along with the container, e.g. when it is scrolled, keep their area
+        and need no recalculation of the extents.
+    */
+    std::unordered_map<const Window*, Rectf> d_childExtentAreas;
+
     CachedRectf d_childContentArea;
+    //! Whether children outside the viewport are skipped.
+    bool d_childCullingEnabled;
 };
 
 } // End of  CEGUI namespace section
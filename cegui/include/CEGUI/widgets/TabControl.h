@@ -31,6 +31,7 @@
 
 #include "../Window.h"
 #include "../WindowRenderer.h"
+#include <functional>
 
 
 #if defined(_MSC_VER)
@@ -80,6 +81,9 @@ public:
 	static const String EventNamespace;				//!< Namespace for global events
     static const String WidgetTypeName;             //!< Window factory name
 
+    //! Function creating the contents of a lazy tab, see addLazyTab.
+    typedef std::function<Window*()> TabContentsFactory;
+
 	enum class TabPanePosition : int
 	{
 		Top,
@@ -317,6 +321,67 @@ public:
     */
     void removeTab(unsigned int ID);
 
+    /*!
+    \brief
+        Add a new tab whose contents are only created when it is first
+        selected.
+
+        A placeholder window named \a name is added as the tab contents right
+        away, so the tab can be addressed by name like any other. The window
+        returned by \a factory is added to the placeholder the first time the
+        tab gets selected, or when loadTabContents is called.
+
+    \param name
+        Name of the placeholder window holding the tab contents.
+
+    \param text
+        Text shown on the tab button.
+
+    \param factory
+        Function creating the window to show in the tab.
+    */
+    void addLazyTab(const String& name, const String& text, TabContentsFactory factory);
+
+    /*!
+    \brief
+        Add a new tab whose contents are loaded from a layout file when it is
+        first selected.
+
+    \see addLazyTab(const String&, const String&, TabContentsFactory)
+    */
+    void addLazyTab(const String& name, const String& text,
+                    const String& layoutFilename, const String& resourceGroup = "");
+
+    /*!
+    \brief
+        Return whether the contents of the tab are created. Always true for
+        tabs added with addTab.
+
+    \exception	InvalidRequestException	thrown if \a wnd is not a valid tab contents window.
+    */
+    bool isTabContentsLoaded(Window* wnd) const;
+
+    //! Create the contents of a lazy tab now if they don't exist yet.
+    void loadTabContents(Window* wnd);
+
+    /*!
+    \brief
+        Destroy the contents of a lazy tab, they are created again on the next
+        selection. Does nothing for the selected tab and for tabs added with
+        addTab.
+    */
+    void unloadTabContents(Window* wnd);
+
+    /*!
+    \brief
+        Set after how many seconds without being selected the contents of lazy
+        tabs are destroyed again. Zero, the default, keeps them forever.
+    */
+    void setLazyTabUnloadDelay(float seconds) { d_lazyTabUnloadDelay = seconds; requestUpdates(); }
+
+    //! Return the delay after which unused lazy tab contents are destroyed.
+    float getLazyTabUnloadDelay() const { return d_lazyTabUnloadDelay; }
+
 
 	/*************************************************************************
 		Construction and Destruction
@@ -351,6 +416,7 @@ protected:
         Nothing
     */
     void drawSelf(const RenderingContext&, std::uint32_t) override { /* do nothing; rendering handled by children */ }
+    void prepareGeometry(const RenderingContext&, std::uint32_t) override { /* do nothing; rendering handled by children */ }
 
     /*!
     \brief
@@ -430,6 +496,10 @@ protected:
     //! Implementation function to do main work of removing a tab.
     void removeTab_impl(Window* window);
 
+    // counts how long the lazy tabs have been hidden and unloads them
+    void updateSelf(float elapsed) override;
+    bool isUpdateRequired() const override;
+
 	/*************************************************************************
 		New event handlers
 	*************************************************************************/
@@ -462,6 +532,20 @@ protected:
     float       d_btGrabPos;        //!< The position on the button tab where user grabbed
     //! Container used to track event subscriptions to added tab windows.
     std::map<Window*, Event::ScopedConnection> d_eventConnections;
+
+    //! State of a tab added with addLazyTab.
+    struct LazyTab
+    {
+        TabContentsFactory d_factory;
+        //! Window created by d_factory, nullptr while not loaded.
+        Window* d_contents;
+        //! Seconds elapsed since the tab was last selected.
+        float d_idleTime;
+    };
+    //! Lazy tabs by their placeholder window.
+    std::map<Window*, LazyTab> d_lazyTabs;
+    //! Seconds after which unused lazy tab contents are destroyed, 0 for never.
+    float d_lazyTabUnloadDelay;
     /*************************************************************************
     Abstract Implementation Functions (must be provided by derived class)
     *************************************************************************/
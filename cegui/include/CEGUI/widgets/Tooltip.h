@@ -29,6 +29,13 @@
 
 #include "../Window.h"
 #include "../WindowRenderer.h"
+#include <vector>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
 
 namespace CEGUI
 {
@@ -217,11 +224,29 @@ namespace CEGUI
         \brief
             Causes the tooltip to resize itself appropriately.
 
+            The measured size and the parsed text are remembered for the most
+            recently shown texts, keyed on the text and the font, so that
+            moving back and forth between the same targets does not measure
+            and parse their tooltip texts again.
+
         \return
             Nothing.
         */
         void sizeSelf();
 
+        /*!
+        \brief
+            Set how many tooltip texts have their size and parsed text
+            remembered by sizeSelf. Zero disables the cache.
+        */
+        void setSizeCacheCapacity(size_t capacity);
+
+        //! Return how many tooltip texts have their size remembered at most.
+        size_t getSizeCacheCapacity() const { return d_sizeCacheCapacity; }
+
+        //! Forget the remembered sizes, for example after changing the look.
+        void clearSizeCache();
+
         /*!
         \brief
             Return the size of the area that will be occupied by the tooltip text, given
@@ -313,6 +338,7 @@ namespace CEGUI
             Overridden from Window.
         ************************************************************************/
         void updateSelf(float elapsed) override;
+        bool isUpdateRequired() const override;
         void onHidden(WindowEventArgs& e) override;
         void onCursorEnters(CursorInputEventArgs& e) override;
         void onTextChanged(WindowEventArgs& e) override;
@@ -329,6 +355,21 @@ namespace CEGUI
         //! are in positionSelf function? (to avoid infinite recursion issues)
         bool d_inPositionSelf;
 
+        //! Size and parsed text of a recently shown tooltip text.
+        struct SizeCacheEntry
+        {
+            String d_text;
+            const Font* d_font;
+            Sizef d_size;
+            RenderedString d_renderedString;
+            //! Value of d_sizeCacheUseCounter when the entry was last used.
+            std::uint64_t d_lastUsed;
+        };
+
+        std::vector<SizeCacheEntry> d_sizeCache;
+        size_t d_sizeCacheCapacity;
+        std::uint64_t d_sizeCacheUseCounter;
+
     private:
         /*************************************************************************
             Private methods
@@ -337,4 +378,8 @@ namespace CEGUI
     };
 } // End of  CEGUI namespace section
 
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
 #endif  // end of guard _CEGUITooltip_h_
@@ -38,6 +38,8 @@
 #include "CEGUI/Logger.h"
 #include "CEGUI/Animation_xmlHandler.h"
 
+#include <algorithm>
+
 // Start of CEGUI namespace section
 namespace CEGUI
 {
@@ -47,7 +49,8 @@ Affector::Affector(Animation* parent):
     d_parent(parent),
     d_applicationMethod(ApplicationMethod::ApplyAbsolute),
     d_targetProperty(""),
-    d_interpolator(nullptr)
+    d_interpolator(nullptr),
+    d_nativeInterpolator(nullptr)
 {}
 
 //----------------------------------------------------------------------------//
@@ -92,6 +95,7 @@ Affector::ApplicationMethod Affector::getApplicationMethod() const
 void Affector::setTargetProperty(const String& target)
 {
     d_targetProperty = target;
+    d_targetPropertyName = InternedName(target);
 }
 
 //----------------------------------------------------------------------------//
@@ -104,12 +108,13 @@ const String& Affector::getTargetProperty() const
 void Affector::setInterpolator(Interpolator* interpolator)
 {
     d_interpolator = interpolator;
+    d_nativeInterpolator = dynamic_cast<NativeInterpolator*>(interpolator);
 }
 
 //----------------------------------------------------------------------------//
 void Affector::setInterpolator(const String& name)
 {
-    d_interpolator = AnimationManager::getSingleton().getInterpolator(name);
+    setInterpolator(AnimationManager::getSingleton().getInterpolator(name));
 }
 
 //----------------------------------------------------------------------------//
@@ -121,7 +126,9 @@ Interpolator* Affector::getInterpolator() const
 //----------------------------------------------------------------------------//
 KeyFrame* Affector::createKeyFrame(float position)
 {
-    if (d_keyFrames.find(position) != d_keyFrames.end())
+    const KeyFrameList::const_iterator pos = lowerBoundKeyFrame(position);
+
+    if (pos != d_keyFrames.end() && (*pos)->getPosition() == position)
     {
         throw InvalidRequestException(
                         "Unable to create KeyFrame at given position, there "
@@ -129,7 +136,7 @@ KeyFrame* Affector::createKeyFrame(float position)
     }
 
     KeyFrame* ret = new KeyFrame(this, position);
-    d_keyFrames.insert(std::make_pair(position, ret));
+    d_keyFrames.insert(pos, ret);
 
     return ret;
 }
@@ -149,9 +156,9 @@ KeyFrame* Affector::createKeyFrame(float position, const String& value,
 //----------------------------------------------------------------------------//
 void Affector::destroyKeyFrame(KeyFrame* keyframe)
 {
-    KeyFrameMap::iterator it = d_keyFrames.find(keyframe->getPosition());
+    const KeyFrameList::const_iterator it = findKeyFrame(keyframe->getPosition());
 
-    if (it == d_keyFrames.end())
+    if (it == d_keyFrames.end() || *it != keyframe)
     {
         throw InvalidRequestException(
                         "Unable to destroy given KeyFrame! "
@@ -165,7 +172,7 @@ void Affector::destroyKeyFrame(KeyFrame* keyframe)
 //----------------------------------------------------------------------------//
 KeyFrame* Affector::getKeyFrameAtPosition(float position) const
 {
-    KeyFrameMap::const_iterator it = d_keyFrames.find(position);
+    const KeyFrameList::const_iterator it = findKeyFrame(position);
 
     if (it == d_keyFrames.end())
     {
@@ -173,13 +180,13 @@ KeyFrame* Affector::getKeyFrameAtPosition(float position) const
                         "Can't find a KeyFrame with given position.");
     }
 
-    return it->second;
+    return *it;
 }
 
 //----------------------------------------------------------------------------//
 bool Affector::hasKeyFrameAtPosition(float position) const
 {
-	return d_keyFrames.find(position) != d_keyFrames.end();
+	return findKeyFrame(position) != d_keyFrames.end();
 }
 
 //----------------------------------------------------------------------------//
@@ -190,10 +197,7 @@ KeyFrame* Affector::getKeyFrameAtIndex(size_t index) const
         throw InvalidRequestException("Out of bounds!");
     }
 
-    KeyFrameMap::const_iterator it = d_keyFrames.begin();
-    std::advance(it, index);
-
-    return it->second;
+    return d_keyFrames[index];
 }
 
 //----------------------------------------------------------------------------//
@@ -208,23 +212,22 @@ void Affector::moveKeyFrameToPosition(KeyFrame* keyframe, float newPosition)
 	if (keyframe->getPosition() == newPosition)
 		return;
 
-    if (d_keyFrames.find(newPosition) != d_keyFrames.end())
+    if (hasKeyFrameAtPosition(newPosition))
     {
         throw InvalidRequestException(
                     "There is already a key frame at position: " +
                     PropertyHelper<float>::toString(newPosition) + ".");
 	}
 
-    for (KeyFrameMap::iterator it = d_keyFrames.begin(); it != d_keyFrames.end(); ++it)
+    const KeyFrameList::const_iterator it = findKeyFrame(keyframe->getPosition());
+
+    if (it != d_keyFrames.end() && *it == keyframe)
     {
-        if (it->second == keyframe)
-        {
-            d_keyFrames.erase(it);
-            d_keyFrames.insert(std::make_pair(newPosition, keyframe));
+        d_keyFrames.erase(it);
+        d_keyFrames.insert(lowerBoundKeyFrame(newPosition), keyframe);
 
-            keyframe->notifyPositionChanged(newPosition);
-            return;
-        }
+        keyframe->notifyPositionChanged(newPosition);
+        return;
     }
 
     throw UnknownObjectException(
@@ -254,15 +257,22 @@ void Affector::savePropertyValues(AnimationInstance* instance)
     }
 
     // now let all keyframes save their desired property values too
-    for (KeyFrameMap::const_iterator it = d_keyFrames.begin();
+    for (KeyFrameList::const_iterator it = d_keyFrames.begin();
          it != d_keyFrames.end(); ++it)
     {
-        it->second->savePropertyValue(instance);
+        (*it)->savePropertyValue(instance);
     }
 }
 
 //----------------------------------------------------------------------------//
 void Affector::apply(AnimationInstance* instance)
+{
+    size_t keyFrameCursor = 0;
+    apply(instance, keyFrameCursor);
+}
+
+//----------------------------------------------------------------------------//
+void Affector::apply(AnimationInstance* instance, size_t& keyFrameCursor)
 {
     PropertySet* target = instance->getTarget();
     const float position = instance->getPosition();
@@ -287,64 +297,38 @@ void Affector::apply(AnimationInstance* instance)
         return;
     }
 
-    KeyFrame* left = nullptr;
-    KeyFrame* right = nullptr;
-
-    // find 2 neighbouring keyframes
-    for (KeyFrameMap::const_iterator it = d_keyFrames.begin();
-         it != d_keyFrames.end(); ++it)
-    {
-        KeyFrame* current = it->second;
-
-        if (current->getPosition() <= position)
-        {
-            left = current;
-        }
-
-        if (current->getPosition() >= position && !right)
-        {
-            right = current;
-        }
-    }
+    KeyFrame* left;
+    KeyFrame* right;
+    const float interpolationPosition =
+        findKeyFrames(position, keyFrameCursor, left, right);
 
-    float leftDistance, rightDistance;
+    // key frame values parsed once by the interpolator save converting every
+    // value from and to String each frame. Relative multiply key frames hold
+    // factors rather than values of the property type, they use Strings.
+    const InterpolatorValue* leftValue = nullptr;
+    const InterpolatorValue* rightValue = nullptr;
 
-    if (left)
+    if (d_nativeInterpolator &&
+        d_applicationMethod != ApplicationMethod::ApplyRelativeMultiply)
     {
-        leftDistance = position - left->getPosition();
-    }
-    else
-        // if no keyframe is suitable for left neighbour, pick the first one
-    {
-        left = d_keyFrames.begin()->second;
-        leftDistance = 0;
-    }
-
-    if (right)
-    {
-        rightDistance = right->getPosition() - position;
-    }
-    else
-        // if no keyframe is suitable for the right neighbour, pick the last one
-    {
-        right = d_keyFrames.rbegin()->second;
-        rightDistance = 0;
+        leftValue = left->getNativeValue(*d_nativeInterpolator);
+        rightValue = right->getNativeValue(*d_nativeInterpolator);
     }
 
-    // if there is just one keyframe and we are right on it
-    if (leftDistance + rightDistance == 0)
+    if (leftValue && rightValue)
     {
-        leftDistance = rightDistance = 0.5;
+        Property* property = target->getPropertyInstance(d_targetPropertyName);
+
+        if (d_applicationMethod == ApplicationMethod::ApplyAbsolute)
+            d_nativeInterpolator->applyAbsolute(target, property,
+                *leftValue, *rightValue, interpolationPosition);
+        else
+            d_nativeInterpolator->applyRelative(target, property,
+                instance->getSavedPropertyValue(d_targetProperty),
+                *leftValue, *rightValue, interpolationPosition);
     }
-
-    // alter interpolation position using the right neighbours progression
-    // method
-    const float interpolationPosition =
-        right->alterInterpolationPosition(
-            leftDistance / (leftDistance + rightDistance));
-
     // absolute application method
-    if (d_applicationMethod == ApplicationMethod::ApplyAbsolute)
+    else if (d_applicationMethod == ApplicationMethod::ApplyAbsolute)
     {
         const String result = d_interpolator->interpolateAbsolute(
                                   left->getValueForAnimation(instance),
@@ -387,6 +371,89 @@ void Affector::apply(AnimationInstance* instance)
     }
 }
 
+//----------------------------------------------------------------------------//
+float Affector::getNativeKeyFrameValues(AnimationInstance* instance,
+                                        size_t& keyFrameCursor,
+                                        const InterpolatorValue*& left,
+                                        const InterpolatorValue*& right)
+{
+    if (d_keyFrames.empty() || !d_nativeInterpolator ||
+        d_applicationMethod == ApplicationMethod::ApplyRelativeMultiply)
+        return -1.0f;
+
+    KeyFrame* leftKeyFrame;
+    KeyFrame* rightKeyFrame;
+    const float interpolationPosition = findKeyFrames(
+        instance->getPosition(), keyFrameCursor, leftKeyFrame, rightKeyFrame);
+
+    left = leftKeyFrame->getNativeValue(*d_nativeInterpolator);
+    right = rightKeyFrame->getNativeValue(*d_nativeInterpolator);
+
+    return (left && right) ? interpolationPosition : -1.0f;
+}
+
+//----------------------------------------------------------------------------//
+float Affector::findKeyFrames(float position, size_t& keyFrameCursor,
+                              KeyFrame*& left, KeyFrame*& right) const
+{
+    const size_t count = d_keyFrames.size();
+    if (keyFrameCursor >= count)
+        keyFrameCursor = 0;
+
+    // move the cursor to the last key frame at or before the position, it
+    // usually is where it was left or one of the following key frames
+    while (keyFrameCursor > 0 &&
+           d_keyFrames[keyFrameCursor]->getPosition() > position)
+        --keyFrameCursor;
+
+    while (keyFrameCursor + 1 < count &&
+           d_keyFrames[keyFrameCursor + 1]->getPosition() <= position)
+        ++keyFrameCursor;
+
+    left = d_keyFrames[keyFrameCursor];
+    float leftDistance, rightDistance;
+
+    if (left->getPosition() <= position)
+    {
+        leftDistance = position - left->getPosition();
+
+        if (left->getPosition() == position)
+        {
+            right = left;
+            rightDistance = 0;
+        }
+        else if (keyFrameCursor + 1 < count)
+        {
+            right = d_keyFrames[keyFrameCursor + 1];
+            rightDistance = right->getPosition() - position;
+        }
+        else
+            // if no keyframe is suitable for the right neighbour, pick the last one
+        {
+            right = d_keyFrames.back();
+            rightDistance = 0;
+        }
+    }
+    else
+        // if no keyframe is suitable for left neighbour, pick the first one
+    {
+        leftDistance = 0;
+        right = left;
+        rightDistance = right->getPosition() - position;
+    }
+
+    // if there is just one keyframe and we are right on it
+    if (leftDistance + rightDistance == 0)
+    {
+        leftDistance = rightDistance = 0.5;
+    }
+
+    // alter interpolation position using the right neighbours progression
+    // method
+    return right->alterInterpolationPosition(
+        leftDistance / (leftDistance + rightDistance));
+}
+
 void Affector::writeXMLToStream(XMLSerializer& xml_stream) const
 {
     xml_stream.openTag(AnimationAffectorHandler::ElementName);
@@ -419,15 +486,38 @@ void Affector::writeXMLToStream(XMLSerializer& xml_stream) const
         xml_stream.attribute(AnimationAffectorHandler::InterpolatorAttribute, getInterpolator()->getType());
     }
 
-    for (KeyFrameMap::const_iterator it = d_keyFrames.begin();
+    for (KeyFrameList::const_iterator it = d_keyFrames.begin();
          it != d_keyFrames.end(); ++it)
     {
-        it->second->writeXMLToStream(xml_stream);
+        (*it)->writeXMLToStream(xml_stream);
     }
 
     xml_stream.closeTag();
 }
 
+//----------------------------------------------------------------------------//
+Affector::KeyFrameList::const_iterator Affector::lowerBoundKeyFrame(
+    float position) const
+{
+    return std::lower_bound(d_keyFrames.begin(), d_keyFrames.end(), position,
+        [](const KeyFrame* keyFrame, float pos)
+        {
+            return keyFrame->getPosition() < pos;
+        });
+}
+
+//----------------------------------------------------------------------------//
+Affector::KeyFrameList::const_iterator Affector::findKeyFrame(
+    float position) const
+{
+    const KeyFrameList::const_iterator it = lowerBoundKeyFrame(position);
+
+    if (it != d_keyFrames.end() && (*it)->getPosition() == position)
+        return it;
+
+    return d_keyFrames.end();
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
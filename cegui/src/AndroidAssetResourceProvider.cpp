@@ -0,0 +1,269 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/AndroidAssetResourceProvider.h"
+#include "CEGUI/AndroidUtils.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Exceptions.h"
+
+#include <android/asset_manager.h>
+#include <fnmatch.h>
+#include <vector>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//----------------------------------------------------------------------------//
+std::string toUtf8(const String& str)
+{
+#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+    return String::convertUtf32ToUtf8(str.getString());
+#else
+    return std::string(str.c_str());
+#endif
+}
+
+}
+
+//----------------------------------------------------------------------------//
+AndroidAssetResourceProvider::AndroidAssetResourceProvider(AAssetManager* assetManager) :
+    d_assetManager(assetManager)
+{
+}
+
+//----------------------------------------------------------------------------//
+AndroidAssetResourceProvider::~AndroidAssetResourceProvider()
+{
+    // pending loads may still be running in loadRawDataContainer
+    cancelPendingLoads();
+
+    for (auto& asset : d_openAssets)
+        AAsset_close(asset.second);
+}
+
+//----------------------------------------------------------------------------//
+AAssetManager* AndroidAssetResourceProvider::getAssetManager() const
+{
+    if (d_assetManager)
+        return d_assetManager;
+
+    const android_app* const app = AndroidUtils::getAndroidApp();
+    if (!app)
+        throw FileIOException("AndroidUtils::android_app has not been set for CEGUI");
+
+    if (!app->activity->assetManager)
+        throw FileIOException("Android AAssetManager is not valid");
+
+    return app->activity->assetManager;
+}
+
+//----------------------------------------------------------------------------//
+AAsset* AndroidAssetResourceProvider::openAsset(const String& filename,
+                                                const String& resourceGroup,
+                                                int mode) const
+{
+    return AAssetManager_open(getAssetManager(),
+        toUtf8(getFinalFilename(filename, resourceGroup)).c_str(), mode);
+}
+
+//----------------------------------------------------------------------------//
+void AndroidAssetResourceProvider::loadRawDataContainer(const String& filename,
+                                                        RawDataContainer& output,
+                                                        const String& resourceGroup)
+{
+    if (filename.empty())
+        throw InvalidRequestException(
+            "Filename supplied for data loading must be valid");
+
+    AAsset* const asset = openAsset(filename, resourceGroup, AASSET_MODE_BUFFER);
+    if (!asset)
+        throw FileIOException(getFinalFilename(filename, resourceGroup) +
+                              " does not exist");
+
+    const size_t size = static_cast<size_t>(AAsset_getLength64(asset));
+
+    // an uncompressed asset is a view of the APK mapped into memory, which is
+    // lent as it is rather than copied
+    if (size != 0 && !AAsset_isAllocated(asset))
+    {
+        const void* const data = AAsset_getBuffer(asset);
+        if (data)
+        {
+            {
+                std::lock_guard<std::mutex> lock(d_openAssetsMutex);
+                d_openAssets[data] = asset;
+            }
+
+            output.setBorrowedData(static_cast<const std::uint8_t*>(data), size);
+            return;
+        }
+    }
+
+    // compressed assets are inflated into the buffer of the container
+    std::uint8_t* const buffer = new std::uint8_t[size];
+    size_t size_read = 0;
+    while (size_read < size)
+    {
+        const int read = AAsset_read(asset, buffer + size_read, size - size_read);
+        if (read <= 0)
+            break;
+
+        size_read += static_cast<size_t>(read);
+    }
+    AAsset_close(asset);
+
+    if (size_read != size)
+    {
+        delete[] buffer;
+
+        throw FileIOException("A problem occurred while reading file: " +
+                              getFinalFilename(filename, resourceGroup));
+    }
+
+    output.setData(buffer);
+    output.setSize(size);
+}
+
+//----------------------------------------------------------------------------//
+void AndroidAssetResourceProvider::unloadRawDataContainer(RawDataContainer& data)
+{
+    if (data.isBorrowed())
+    {
+        AAsset* asset = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(d_openAssetsMutex);
+            const auto found = d_openAssets.find(data.getDataPtr());
+            if (found != d_openAssets.end())
+            {
+                asset = found->second;
+                d_openAssets.erase(found);
+            }
+        }
+
+        // the data belongs to the asset, so the container must forget it first
+        data.release();
+
+        if (asset)
+            AAsset_close(asset);
+
+        return;
+    }
+
+    data.release();
+}
+
+//----------------------------------------------------------------------------//
+void AndroidAssetResourceProvider::readRawDataChunks(const String& filename,
+                                                     const ReadChunkCallback& callback,
+                                                     const String& resourceGroup)
+{
+    if (filename.empty())
+        throw InvalidRequestException(
+            "Filename supplied for data loading must be valid");
+
+    AAsset* const asset = openAsset(filename, resourceGroup, AASSET_MODE_STREAMING);
+    if (!asset)
+        throw FileIOException(getFinalFilename(filename, resourceGroup) +
+                              " does not exist");
+
+    try
+    {
+        std::vector<std::uint8_t> buffer(getReadChunkSize());
+        int size_read;
+        while ((size_read = AAsset_read(asset, buffer.data(), buffer.size())) > 0)
+            callback(buffer.data(), static_cast<size_t>(size_read));
+
+        if (size_read < 0)
+            throw FileIOException("A problem occurred while reading file: " +
+                                  getFinalFilename(filename, resourceGroup));
+    }
+    catch (...)
+    {
+        AAsset_close(asset);
+        throw;
+    }
+
+    AAsset_close(asset);
+}
+
+//----------------------------------------------------------------------------//
+size_t AndroidAssetResourceProvider::getResourceGroupFileNames(
+    std::vector<String>& out_vec,
+    const String& file_pattern,
+    const String& resource_group)
+{
+    // the asset directories are named without a trailing slash
+    std::string dir_name(toUtf8(getFinalFilename("", resource_group)));
+    while (!dir_name.empty() && dir_name.back() == '/')
+        dir_name.pop_back();
+
+    AAssetDir* const dir = AAssetManager_openDir(getAssetManager(), dir_name.c_str());
+    if (!dir)
+        return 0;
+
+    const std::string pattern(toUtf8(file_pattern));
+    size_t entries = 0;
+    const char* name;
+    while ((name = AAssetDir_getNextFileName(dir)))
+    {
+        if (fnmatch(pattern.c_str(), name, 0) != 0)
+            continue;
+
+        out_vec.push_back(name);
+        ++entries;
+    }
+    AAssetDir_close(dir);
+
+    return entries;
+}
+
+//----------------------------------------------------------------------------//
+bool AndroidAssetResourceProvider::isResourceAvailable(const String& filename,
+                                                       const String& resourceGroup)
+{
+    if (filename.empty())
+        return false;
+
+    AAsset* const asset = openAsset(filename, resourceGroup, AASSET_MODE_UNKNOWN);
+    if (!asset)
+        return false;
+
+    AAsset_close(asset);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+size_t AndroidAssetResourceProvider::getOpenAssetCount() const
+{
+    std::lock_guard<std::mutex> lock(d_openAssetsMutex);
+    return d_openAssets.size();
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
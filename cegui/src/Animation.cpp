@@ -286,10 +286,12 @@ void Animation::savePropertyValues(AnimationInstance* instance)
 //----------------------------------------------------------------------------//
 void Animation::apply(AnimationInstance* instance)
 {
-    for (AffectorList::const_iterator it = d_affectors.begin();
-            it != d_affectors.end(); ++it)
+    std::vector<size_t>& cursors = instance->getKeyFrameCursors();
+    cursors.resize(d_affectors.size());
+
+    for (size_t i = 0; i < d_affectors.size(); ++i)
     {
-        (*it)->apply(instance);
+        d_affectors[i]->apply(instance, cursors[i]);
     }
 }
 
@@ -31,6 +31,12 @@
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Window.h"
 #include "CEGUI/Logger.h"
+#include "CEGUI/Affector.h"
+#include "CEGUI/TplInterpolators.h"
+#include "CEGUI/Quaternion.h"
+#include "CEGUI/RenderingWindow.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/CoordConverter.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -64,7 +70,9 @@ AnimationInstance::AnimationInstance(Animation* definition):
     d_maxStepDeltaSkip(-1.0f),
     // default behaviour is to never clamp
     d_maxStepDeltaClamp(-1.0f),
-    d_autoSteppingEnabled(true)
+    d_autoSteppingEnabled(true),
+    d_renderSideEvaluationEnabled(false),
+    d_renderSideWindow(nullptr)
 {}
 
 //----------------------------------------------------------------------------//
@@ -85,6 +93,8 @@ Animation* AnimationInstance::getDefinition() const
 //----------------------------------------------------------------------------//
 void AnimationInstance::setTarget(PropertySet* target)
 {
+    reconcile();
+
     d_target = target;
 
     purgeSavedPropertyValues();
@@ -250,6 +260,7 @@ void AnimationInstance::start(bool skipNextStep)
 //----------------------------------------------------------------------------//
 void AnimationInstance::stop()
 {
+    reconcile();
     setPosition(0.0);
     d_running = false;
     onAnimationStopped();
@@ -258,6 +269,7 @@ void AnimationInstance::stop()
 //----------------------------------------------------------------------------//
 void AnimationInstance::pause()
 {
+    reconcile();
     d_running = false;
     onAnimationPaused();
 }
@@ -300,6 +312,7 @@ void AnimationInstance::finish()
 {
     if (d_definition)
     {
+        endRenderSideEvaluation();
         setPosition(d_definition->getDuration());
         apply();
     }
@@ -390,6 +403,8 @@ void AnimationInstance::step(float delta)
         {
             newPosition = duration;
 
+            // the end position is applied below
+            endRenderSideEvaluation();
             stop();
             onAnimationEnded();
         }
@@ -441,9 +456,141 @@ void AnimationInstance::step(float delta)
         setPosition(newPosition);
     }
 
+    if (!d_renderSideEvaluationEnabled || !d_running || !applyOnRenderSide())
+    {
+        endRenderSideEvaluation();
+        apply();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void AnimationInstance::setRenderSideEvaluationEnabled(bool enabled)
+{
+    if (!enabled)
+        reconcile();
+
+    d_renderSideEvaluationEnabled = enabled;
+}
+
+//----------------------------------------------------------------------------//
+bool AnimationInstance::isRenderSideEvaluationEnabled() const
+{
+    return d_renderSideEvaluationEnabled;
+}
+
+//----------------------------------------------------------------------------//
+bool AnimationInstance::isEvaluatedOnRenderSide() const
+{
+    return d_renderSideWindow != nullptr;
+}
+
+//----------------------------------------------------------------------------//
+void AnimationInstance::reconcile()
+{
+    if (!d_renderSideWindow)
+        return;
+
+    endRenderSideEvaluation();
     apply();
 }
 
+//----------------------------------------------------------------------------//
+bool AnimationInstance::applyOnRenderSide()
+{
+    Window* const window = dynamic_cast<Window*>(d_target);
+    if (!window || !window->isUsingAutoRenderingSurface() ||
+        !window->getRenderingSurface() ||
+        !window->getRenderingSurface()->isRenderingWindow())
+        return false;
+
+    // the transform is relative to the current property values
+    glm::vec2 offset(0, 0);
+    glm::quat rotation(1, 0, 0, 0);
+    float alpha = 1.0f;
+
+    std::vector<size_t>& cursors = d_keyFrameCursors;
+    const size_t count = d_definition->getNumAffectors();
+    cursors.resize(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        Affector* const affector = d_definition->getAffectorAtIndex(i);
+        if (affector->getApplicationMethod() != Affector::ApplicationMethod::ApplyAbsolute)
+            return false;
+
+        const InterpolatorValue* left;
+        const InterpolatorValue* right;
+        const float position =
+            affector->getNativeKeyFrameValues(this, cursors[i], left, right);
+        if (position < 0.0f)
+            return false;
+
+        const String& property = affector->getTargetProperty();
+        Interpolator* const interpolator = affector->getInterpolator();
+
+        if (property == "Alpha" &&
+            dynamic_cast<TplLinearInterpolator<float>*>(interpolator))
+        {
+            if (window->getAlpha() <= 0.0f)
+                return false;
+
+            const float value =
+                static_cast<const TplInterpolatorValue<float>*>(left)->d_value * (1.0f - position) +
+                static_cast<const TplInterpolatorValue<float>*>(right)->d_value * position;
+            alpha = std::max(0.0f, std::min(value, 1.0f)) / window->getAlpha();
+        }
+        else if (property == "Position" &&
+                 dynamic_cast<TplLinearInterpolator<UVector2>*>(interpolator))
+        {
+            const UVector2 value =
+                static_cast<const TplInterpolatorValue<UVector2>*>(left)->d_value * (1.0f - position) +
+                static_cast<const TplInterpolatorValue<UVector2>*>(right)->d_value * position;
+            const Sizef base(window->getParentPixelSize());
+            offset = CoordConverter::asAbsolute(value, base) -
+                     CoordConverter::asAbsolute(window->getPosition(), base);
+        }
+        else if (property == "Rotation" &&
+                 dynamic_cast<QuaternionSlerpInterpolator*>(interpolator))
+        {
+            const glm::quat value = glm::slerp(
+                static_cast<const TplInterpolatorValue<glm::quat>*>(left)->d_value,
+                static_cast<const TplInterpolatorValue<glm::quat>*>(right)->d_value,
+                position);
+            rotation = value * glm::inverse(window->getRotation());
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    static_cast<RenderingWindow*>(window->getRenderingSurface())->
+        setPresentationTransform(offset, rotation, alpha);
+    d_renderSideWindow = window;
+
+    if (window->isInGUIContext())
+        window->getGUIContext().markAsDirty();
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void AnimationInstance::endRenderSideEvaluation()
+{
+    if (!d_renderSideWindow)
+        return;
+
+    // the window may have released its RenderingWindow meanwhile
+    RenderingSurface* const surface = d_renderSideWindow->getRenderingSurface();
+    if (surface && surface->isRenderingWindow())
+        static_cast<RenderingWindow*>(surface)->resetPresentationTransform();
+
+    if (d_renderSideWindow->isInGUIContext())
+        d_renderSideWindow->getGUIContext().markAsDirty();
+
+    d_renderSideWindow = nullptr;
+}
+
 //----------------------------------------------------------------------------//
 bool AnimationInstance::handleStart(const CEGUI::EventArgs&)
 {
@@ -547,6 +694,9 @@ void AnimationInstance::apply()
 {
     if (d_target)
     {
+        // affectors of the same target each fire its change notifications,
+        // have subscribers see them once all properties are set.
+        EventSet::BatchScope batch;
         d_definition->apply(this);
     }
 }
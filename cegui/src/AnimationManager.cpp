@@ -34,6 +34,7 @@
 #include "CEGUI/AnimationInstance.h"
 #include "CEGUI/TplInterpolators.h"
 #include "CEGUI/Exceptions.h"
+#include "CEGUI/EventSet.h"
 #include "CEGUI/System.h"
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/XMLSerializer.h"
@@ -346,6 +347,9 @@ size_t AnimationManager::getNumAnimationInstances() const
 //----------------------------------------------------------------------------//
 void AnimationManager::autoStepInstances(float delta)
 {
+    // notify about the properties changed by all instances only once
+    EventSet::BatchScope batch;
+
     for (AnimationInstanceMap::const_iterator it = d_animationInstances.begin();
          it != d_animationInstances.end(); ++it)
     {
@@ -354,6 +358,16 @@ void AnimationManager::autoStepInstances(float delta)
     }
 }
 
+//----------------------------------------------------------------------------//
+bool AnimationManager::hasAutoSteppedRunningInstances() const
+{
+    for (const auto& pair : d_animationInstances)
+        if (pair.second->isAutoSteppingEnabled() && pair.second->isRunning())
+            return true;
+
+    return false;
+}
+
 //----------------------------------------------------------------------------//
 void AnimationManager::loadAnimationsFromXML(const String& filename,
                                              const String& resourceGroup)
@@ -0,0 +1,451 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/BakedFont.h"
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/FontGlyph.h"
+#include "CEGUI/Font_xmlHandler.h"
+#include "CEGUI/PropertyHelper.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/DataContainer.h"
+
+#include <algorithm>
+#include <cstring>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const char BakedFont::FileMagic[8] = { 'C', 'E', 'G', 'U', 'I', 'B', 'F', 'T' };
+const std::uint32_t BakedFont::FileVersion = 1;
+
+//----------------------------------------------------------------------------//
+namespace
+{
+//! Reads the little-endian fields of a baked font file.
+class BakedFontReader
+{
+public:
+    BakedFontReader(const std::uint8_t* data, size_t size, const String& filename) :
+        d_data(data),
+        d_size(size),
+        d_position(0),
+        d_filename(filename)
+    {}
+
+    const std::uint8_t* read(size_t size)
+    {
+        if (d_size - d_position < size)
+            throw FileIOException("The baked font file '" + d_filename +
+                                  "' is truncated.");
+
+        const std::uint8_t* data = d_data + d_position;
+        d_position += size;
+        return data;
+    }
+
+    std::uint32_t readU32()
+    {
+        const std::uint8_t* data = read(4);
+        return static_cast<std::uint32_t>(data[0]) |
+               (static_cast<std::uint32_t>(data[1]) << 8) |
+               (static_cast<std::uint32_t>(data[2]) << 16) |
+               (static_cast<std::uint32_t>(data[3]) << 24);
+    }
+
+    float readF32()
+    {
+        const std::uint32_t bits = readU32();
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+private:
+    const std::uint8_t* d_data;
+    size_t d_size;
+    size_t d_position;
+    const String& d_filename;
+};
+}
+
+//----------------------------------------------------------------------------//
+BakedFont::BakedFont(const String& font_name, const String& filename,
+                     const String& resource_group,
+                     const AutoScaledMode auto_scaled,
+                     const Sizef& native_res) :
+    Font(font_name, Font_xmlHandler::FontTypeBaked, filename,
+         resource_group, auto_scaled, native_res),
+    d_nativeAscender(0.0f),
+    d_nativeDescender(0.0f),
+    d_nativeHeight(0.0f),
+    d_advanceScale(1.0f)
+{
+    load();
+    BakedFont::updateFont();
+}
+
+//----------------------------------------------------------------------------//
+BakedFont::~BakedFont()
+{
+    free();
+}
+
+//----------------------------------------------------------------------------//
+void BakedFont::load()
+{
+    RawDataContainer data;
+    System::getSingleton().getResourceProvider()->loadRawDataContainer(
+        d_filename, data, d_resourceGroup.empty() ?
+            getDefaultResourceGroup() : d_resourceGroup);
+
+    try
+    {
+        BakedFontReader reader(data.getDataPtr(), data.getSize(), d_filename);
+
+        if (std::memcmp(reader.read(sizeof(FileMagic)), FileMagic, sizeof(FileMagic)) != 0)
+            throw FileIOException("The file '" + d_filename +
+                                  "' is not a baked font file.");
+
+        const std::uint32_t version = reader.readU32();
+        if (version != FileVersion)
+            throw FileIOException("The baked font file '" + d_filename +
+                "' has version " + PropertyHelper<std::uint32_t>::toString(version) +
+                " but only version " + PropertyHelper<std::uint32_t>::toString(FileVersion) +
+                " is supported.");
+
+        d_nativeAscender = reader.readF32();
+        d_nativeDescender = reader.readF32();
+        d_nativeHeight = reader.readF32();
+        const std::uint32_t glyphCount = reader.readU32();
+        const std::uint32_t kerningCount = reader.readU32();
+        const std::uint32_t pageCount = reader.readU32();
+        const std::uint32_t pageSize = reader.readU32();
+
+        Renderer& renderer = *System::getSingleton().getRenderer();
+        const Sizef pageArea(static_cast<float>(pageSize), static_cast<float>(pageSize));
+
+        // The pages come last, so create their textures first to let the glyph
+        // images refer to them
+        for (std::uint32_t i = 0; i < pageCount; ++i)
+        {
+            d_pages.push_back(&renderer.createTexture(
+                "BakedFont_" + d_name + "_page_" + PropertyHelper<std::uint32_t>::toString(i),
+                pageArea));
+            renderer.getTextureResidencyManager().addTexture(*d_pages.back(),
+                                                             TextureCategory::GlyphAtlas);
+        }
+
+        for (std::uint32_t i = 0; i < glyphCount; ++i)
+        {
+            const char32_t codePoint = reader.readU32();
+            const std::uint32_t page = reader.readU32();
+            const float x = static_cast<float>(reader.readU32());
+            const float y = static_cast<float>(reader.readU32());
+            const float width = static_cast<float>(reader.readU32());
+            const float height = static_cast<float>(reader.readU32());
+            const glm::vec2 offset(reader.readF32(), reader.readF32());
+            const float advance = reader.readF32();
+
+            if (page >= pageCount)
+                throw FileIOException("The baked font file '" + d_filename +
+                                      "' refers to a page it does not contain.");
+
+            BakedGlyph& glyph = d_codePointToGlyphMap[codePoint];
+            if (glyph.d_glyph)
+                throw FileIOException("The baked font file '" + d_filename +
+                                      "' holds a code point twice.");
+
+            BitmapImage* image = new BitmapImage(
+                PropertyHelper<std::uint32_t>::toString(codePoint), d_pages[page],
+                Rectf(x, y, x + width, y + height), offset, d_autoScaled,
+                d_nativeResolution);
+
+            glyph.d_glyph = new FontGlyph(codePoint, advance, image);
+            glyph.d_nativeAdvance = advance;
+        }
+
+        for (std::uint32_t i = 0; i < kerningCount; ++i)
+        {
+            const char32_t left = reader.readU32();
+            const char32_t right = reader.readU32();
+            d_kerning[getKerningKey(left, right)] = reader.readF32();
+        }
+
+        const size_t pageBytes = static_cast<size_t>(pageSize) * pageSize * sizeof(argb_t);
+        for (Texture* page : d_pages)
+            page->loadFromMemory(reader.read(pageBytes), pageArea, Texture::PixelFormat::Rgba);
+    }
+    catch (...)
+    {
+        free();
+        System::getSingleton().getResourceProvider()->unloadRawDataContainer(data);
+        throw;
+    }
+
+    System::getSingleton().getResourceProvider()->unloadRawDataContainer(data);
+}
+
+//----------------------------------------------------------------------------//
+void BakedFont::free()
+{
+    for (auto& entry : d_codePointToGlyphMap)
+    {
+        if (entry.second.d_glyph)
+        {
+            delete entry.second.d_glyph->getImage();
+            delete entry.second.d_glyph;
+        }
+    }
+
+    d_codePointToGlyphMap.clear();
+    d_kerning.clear();
+
+    Renderer& renderer = *System::getSingleton().getRenderer();
+    for (Texture* page : d_pages)
+    {
+        renderer.getTextureResidencyManager().removeTexture(*page);
+        renderer.destroyTexture(*page);
+    }
+
+    d_pages.clear();
+
+    invalidateLatin1GlyphMetrics();
+    releaseTextLayouts();
+}
+
+//----------------------------------------------------------------------------//
+void BakedFont::updateFont()
+{
+    const bool scaled = d_autoScaled != AutoScaledMode::Disabled;
+    d_advanceScale = scaled ? d_horzScaling : 1.0f;
+    const float vertScale = scaled ? d_vertScaling : 1.0f;
+
+    d_ascender = d_nativeAscender * vertScale;
+    d_descender = d_nativeDescender * vertScale;
+    d_height = d_nativeHeight * vertScale;
+
+    for (auto& entry : d_codePointToGlyphMap)
+    {
+        FontGlyph* glyph = entry.second.d_glyph;
+        glyph->setAdvance(entry.second.d_nativeAdvance * d_advanceScale);
+
+        BitmapImage* image = static_cast<BitmapImage*>(glyph->getImage());
+        image->setAutoScaled(d_autoScaled);
+        image->setNativeResolution(d_nativeResolution);
+    }
+
+    invalidateLatin1GlyphMetrics();
+    releaseTextLayouts();
+}
+
+//----------------------------------------------------------------------------//
+bool BakedFont::isCodepointAvailable(char32_t codePoint) const
+{
+    return d_codePointToGlyphMap.find(codePoint) != d_codePointToGlyphMap.end();
+}
+
+//----------------------------------------------------------------------------//
+FontGlyph* BakedFont::getGlyphForCodepoint(const char32_t codePoint) const
+{
+    CodePointToGlyphMap::const_iterator pos = d_codePointToGlyphMap.find(codePoint);
+    return (pos != d_codePointToGlyphMap.end()) ? pos->second.d_glyph : nullptr;
+}
+
+//----------------------------------------------------------------------------//
+float BakedFont::getKerning(char32_t left, char32_t right) const
+{
+    if (d_kerning.empty())
+        return 0.0f;
+
+    KerningMap::const_iterator pos = d_kerning.find(getKerningKey(left, right));
+    return (pos != d_kerning.end()) ? pos->second * d_advanceScale : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+float BakedFont::getTextExtent(const String& text) const
+{
+    float cur_extent = 0.0f;
+    float adv_extent = 0.0f;
+    char32_t previousCodePoint = 0;
+
+#if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_8)
+    for (size_t c = 0; c < text.length(); ++c)
+    {
+        const char32_t currentCodePoint = text[c];
+#else
+    String::codepoint_iterator codePointIter(text.begin(), text.begin(), text.end());
+    for (; !codePointIter.isAtEnd(); ++codePointIter)
+    {
+        const char32_t currentCodePoint = *codePointIter;
+#endif
+        if (!isCodepointAvailable(currentCodePoint))
+            continue;
+
+        if (previousCodePoint)
+            adv_extent += getKerning(previousCodePoint, currentCodePoint);
+
+        getGlyphExtents(currentCodePoint, cur_extent, adv_extent);
+        previousCodePoint = currentCodePoint;
+    }
+
+    return std::max(adv_extent, cur_extent);
+}
+
+//----------------------------------------------------------------------------//
+float BakedFont::getTextAdvance(const String& text) const
+{
+    float advance = 0.0f;
+    char32_t previousCodePoint = 0;
+
+#if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_8)
+    for (size_t c = 0; c < text.length(); ++c)
+    {
+        const char32_t currentCodePoint = text[c];
+#else
+    String::codepoint_iterator codePointIter(text.begin(), text.begin(), text.end());
+    for (; !codePointIter.isAtEnd(); ++codePointIter)
+    {
+        const char32_t currentCodePoint = *codePointIter;
+#endif
+        const FontGlyph* glyph = getGlyphForCodepoint(currentCodePoint);
+        if (!glyph)
+            continue;
+
+        if (previousCodePoint)
+            advance += getKerning(previousCodePoint, currentCodePoint);
+
+        advance += glyph->getAdvance();
+        previousCodePoint = currentCodePoint;
+    }
+
+    return advance;
+}
+
+//----------------------------------------------------------------------------//
+size_t BakedFont::getCharAtPixel(const String& text, size_t start_char,
+                                 float pixel) const
+{
+    float cur_extent = 0;
+    const size_t char_count = text.length();
+    char32_t previousCodePoint = 0;
+
+    // handle simple cases
+    if ((pixel <= 0) || (char_count <= start_char))
+        return start_char;
+
+#if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_8)
+    for (size_t c = start_char; c < char_count; ++c)
+    {
+        const char32_t currentCodePoint = text[c];
+#else
+    String::codepoint_iterator currentCodePointIter(text.begin(), text.begin(), text.end());
+    currentCodePointIter.increment(start_char);
+
+    for (; !currentCodePointIter.isAtEnd(); ++currentCodePointIter)
+    {
+        const char32_t currentCodePoint = *currentCodePointIter;
+#endif
+        const FontGlyph* glyph = getGlyphForCodepoint(currentCodePoint);
+        if (!glyph)
+            continue;
+
+        if (previousCodePoint)
+            cur_extent += getKerning(previousCodePoint, currentCodePoint);
+
+        cur_extent += glyph->getAdvance();
+        previousCodePoint = currentCodePoint;
+
+        if (pixel < cur_extent)
+        {
+#if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_8)
+            return c;
+#else
+            return currentCodePointIter.getCodeUnitIndexFromStart();
+#endif
+        }
+    }
+
+    return char_count;
+}
+
+//----------------------------------------------------------------------------//
+std::vector<GeometryBuffer*> BakedFont::layoutAndCreateGlyphRenderGeometry(
+    const String& text, const Rectf* clip_rect, const ColourRect& colours,
+    const float space_extra, ImageRenderSettings imgRenderSettings,
+    DefaultParagraphDirection /*defaultParagraphDir*/, glm::vec2& glyphPos) const
+{
+    std::vector<GeometryBuffer*> textGeometryBuffers;
+
+    glyphPos.y += getBaseline();
+    char32_t previousCodePoint = 0;
+
+#if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_8)
+    for (size_t c = 0; c < text.length(); ++c)
+    {
+        const char32_t currentCodePoint = text[c];
+#else
+    String::codepoint_iterator codePointIter(text.begin(), text.begin(), text.end());
+    for (; !codePointIter.isAtEnd(); ++codePointIter)
+    {
+        const char32_t currentCodePoint = *codePointIter;
+#endif
+        const FontGlyph* glyph = getGlyphForCodepoint(currentCodePoint);
+        if (!glyph)
+            continue;
+
+        if (previousCodePoint)
+            glyphPos.x += getKerning(previousCodePoint, currentCodePoint);
+        previousCodePoint = currentCodePoint;
+
+        const Image* const image = glyph->getImage();
+        imgRenderSettings.d_destArea = Rectf(glyphPos, image->getRenderedSize());
+
+        addGlyphRenderGeometry(textGeometryBuffers, image, imgRenderSettings,
+            clip_rect, colours);
+
+        glyphPos.x += glyph->getAdvance();
+        // apply extra spacing to space chars
+        if (currentCodePoint == ' ')
+            glyphPos.x += space_extra;
+    }
+
+    return textGeometryBuffers;
+}
+
+//----------------------------------------------------------------------------//
+void BakedFont::writeXMLToStream_impl(XMLSerializer& /*xml_stream*/) const
+{
+    // everything is held by the baked font file itself
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -59,11 +59,13 @@ const String BasicRenderedStringParser::RightPaddingTagName("right-padding");
 const String BasicRenderedStringParser::ImageSizeTagName("image-size");
 const String BasicRenderedStringParser::ImageWidthTagName("image-width");
 const String BasicRenderedStringParser::ImageHeightTagName("image-height");
+const size_t BasicRenderedStringParser::ParseCacheCapacity;
 
 //----------------------------------------------------------------------------//
 BasicRenderedStringParser::BasicRenderedStringParser() :
     d_imageSize(0, 0),
-    d_initialised(false)
+    d_initialised(false),
+    d_cacheable(true)
 {
     BasicRenderedStringParser::initialiseDefaultState();
 }
@@ -92,32 +94,77 @@ RenderedString BasicRenderedStringParser::parse(const String& input_string,
     if (active_colours)
         d_colours = *active_colours;
 
+    // reuse the result of an earlier parse of the same markup if possible
+    const size_t hash = std::hash<String>()(input_string);
+    for (auto it = d_parseCache.begin(); it != d_parseCache.end(); ++it)
+    {
+        if (it->d_hash == hash && it->d_colours == d_colours &&
+            it->d_fontName == d_fontName && it->d_text == input_string)
+        {
+            d_parseCache.splice(d_parseCache.begin(), d_parseCache, it);
+            return it->d_result;
+        }
+    }
+
+    // the key state is modified by the tags, so keep it before parsing
+    const String font_name(d_fontName);
+    const ColourRect colours(d_colours);
+
     RenderedString rs;
-    String curr_section, tag_string;
+    d_cacheable = true;
+    parseMarkup(rs, input_string);
+
+    if (d_cacheable)
+    {
+        if (d_parseCache.size() >= ParseCacheCapacity)
+            d_parseCache.pop_back();
+
+        d_parseCache.push_front(
+            ParseCacheEntry{hash, input_string, font_name, colours, rs});
+    }
+
+    return rs;
+}
+
+//----------------------------------------------------------------------------//
+void BasicRenderedStringParser::clearParseCache()
+{
+    d_parseCache.clear();
+}
+
+//----------------------------------------------------------------------------//
+void BasicRenderedStringParser::parseMarkup(RenderedString& rs,
+                                            const String& input_string)
+{
+    // plain text needs no splitting into sections
+    if (input_string.find('[') == String::npos &&
+        input_string.find('\\') == String::npos)
+    {
+        appendRenderedText(rs, input_string);
+        return;
+    }
 
     for (String::const_iterator input_iter(input_string.begin());
          input_iter != input_string.end();
          /* no-op*/)
     {
-        const bool found_tag = parse_section(input_iter, input_string.end(), '[', curr_section);
-        appendRenderedText(rs, curr_section);
+        const bool found_tag = parse_section(input_iter, input_string.end(), '[', d_sectionBuffer);
+        appendRenderedText(rs, d_sectionBuffer);
 
         if (!found_tag)
-            return rs;
+            return;
 
-        if (!parse_section(input_iter, input_string.end(), ']', tag_string))
+        if (!parse_section(input_iter, input_string.end(), ']', d_tagBuffer))
         {
             Logger::getSingleton().logEvent(
                 "BasicRenderedStringParser::parse: Ignoring unterminated tag : [" +
-                tag_string);
+                d_tagBuffer);
 
-            return rs;
+            return;
         }
 
-        processControlString(rs, tag_string);
+        processControlString(rs, d_tagBuffer);
     }
-
-    return rs;
 }
 
 //----------------------------------------------------------------------------//
@@ -200,23 +247,25 @@ void BasicRenderedStringParser::processControlString(RenderedString& rs,
         return;
     }
 
-    String variable = ctrl_str.substr(0, findPos);
-    String value = ctrl_str.substr(findPos + 1); 
+    d_variableBuffer.assign(ctrl_str, 0, findPos);
 
     // We were able to split the variable and value, let's see if we get a
     // valid value:
+    const size_t valueLength = ctrl_str.length() - findPos - 1;
     bool correctValueFormat = true;
-    if ( (value.front() != '\'') || (value.back() != '\'' ) ||
-            ( value.length() < 3 ) )
-        correctValueFormat = false;
-    else
+    if ( (valueLength < 3) || (ctrl_str[findPos + 1] != '\'') ||
+            (ctrl_str.back() != '\'') )
     {
-        value.pop_back();
-        value.erase(0, 1);
+        correctValueFormat = false;
+        d_valueBuffer.assign(ctrl_str, findPos + 1, String::npos);
     }
+    else
+        d_valueBuffer.assign(ctrl_str, findPos + 2, valueLength - 2);
+
+    const String& value = d_valueBuffer;
 
     // look up handler function
-    TagHandlerMap::iterator i = d_tagHandlers.find(variable);
+    TagHandlerMap::iterator i = d_tagHandlers.find(d_variableBuffer);
     // dispatch handler, or log error
     if (i != d_tagHandlers.end())
     {
@@ -228,7 +277,7 @@ void BasicRenderedStringParser::processControlString(RenderedString& rs,
             // Otherwise, since the handler was found, we are sure that the
             // second variable couldn't be read, meaning it was empty. We will supply
             // and empty string
-            (this->*(*i).second)(rs, "");
+            (this->*(*i).second)(rs, String());
     }
     else
         Logger::getSingleton().logEvent(
@@ -243,6 +292,7 @@ void BasicRenderedStringParser::initialiseDefaultState()
     d_fontName = "";
     d_padding = Rectf(0, 0, 0, 0);
     d_imageSize.d_width = d_imageSize.d_height = 0.0f;
+    d_vertImageFormatting = VerticalImageFormatting::BottomAligned;
     d_vertTextFormatting = VerticalTextFormatting::BottomAligned;
 }
 
@@ -282,6 +332,9 @@ void BasicRenderedStringParser::handleFont(RenderedString&, const String& value)
 //----------------------------------------------------------------------------//
 void BasicRenderedStringParser::handleImage(RenderedString& rs, const String& value)
 {
+    // the image may be destroyed while the result is cached
+    d_cacheable = false;
+
     RenderedStringImageComponent ric(
         PropertyHelper<Image*>::fromString(value));
     ric.setPadding(d_padding);
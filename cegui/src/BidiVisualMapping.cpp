@@ -26,9 +26,84 @@
  ***************************************************************************/
 #include "CEGUI/BidiVisualMapping.h"
 
+#include <list>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+const size_t BidiVisualMapping::VisualCacheCapacity;
+
+//----------------------------------------------------------------------------//
+namespace
+{
+struct VisualKey
+{
+    //! Type of the mapping, as different implementations may differ in results.
+    std::type_index d_type;
+    String d_logical;
+
+    bool operator==(const VisualKey& other) const
+    {
+        return d_type == other.d_type && d_logical == other.d_logical;
+    }
+};
+
+struct VisualKeyHasher
+{
+    size_t operator()(const VisualKey& key) const
+    {
+        size_t hash = std::hash<String>()(key.d_logical);
+        hash ^= key.d_type.hash_code() + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+};
+
+struct Visual
+{
+    String d_text;
+    BidiVisualMapping::StrIndexList d_l2v;
+    BidiVisualMapping::StrIndexList d_v2l;
+    bool d_success;
+};
+
+typedef std::list<std::pair<VisualKey, Visual>> VisualList;
+// Visual mappings of all logical strings, the most recently used first
+VisualList s_visuals;
+std::unordered_map<VisualKey, VisualList::iterator, VisualKeyHasher> s_visualIndex;
+
+//! Returns the cached visual mapping of \a logical, reordering it if needed.
+const Visual& getVisual(const BidiVisualMapping& mapping, const String& logical)
+{
+    VisualKey key = { std::type_index(typeid(mapping)), logical };
+
+    auto found = s_visualIndex.find(key);
+    if (found != s_visualIndex.end())
+    {
+        s_visuals.splice(s_visuals.begin(), s_visuals, found->second);
+        return found->second->second;
+    }
+
+    Visual visual;
+    visual.d_success = mapping.reorderFromLogicalToVisual(
+        logical, visual.d_text, visual.d_l2v, visual.d_v2l);
+
+    s_visuals.emplace_front(key, std::move(visual));
+    s_visualIndex.emplace(std::move(key), s_visuals.begin());
+
+    while (s_visuals.size() > BidiVisualMapping::VisualCacheCapacity)
+    {
+        s_visualIndex.erase(s_visuals.back().first);
+        s_visuals.pop_back();
+    }
+
+    return s_visuals.front().second;
+}
+}
+
 //----------------------------------------------------------------------------//
 BidiVisualMapping::~BidiVisualMapping()
 {
@@ -37,8 +112,42 @@ BidiVisualMapping::~BidiVisualMapping()
 //----------------------------------------------------------------------------//
 bool BidiVisualMapping::updateVisual(const String& logical)
 {
-    return reorderFromLogicalToVisual(logical, d_textVisual,
-                                      d_l2vMapping, d_v2lMapping);
+    const Visual& visual = getVisual(*this, logical);
+
+    d_textVisual = visual.d_text;
+    d_l2vMapping = visual.d_l2v;
+    d_v2lMapping = visual.d_v2l;
+    return visual.d_success;
+}
+
+//----------------------------------------------------------------------------//
+bool BidiVisualMapping::updateVisuals(const std::vector<String>& logical,
+                                      std::vector<String>& visual) const
+{
+    bool success = true;
+
+    visual.resize(logical.size());
+    for (size_t i = 0; i < logical.size(); ++i)
+    {
+        const Visual& v = getVisual(*this, logical[i]);
+        visual[i] = v.d_text;
+        success = v.d_success && success;
+    }
+
+    return success;
+}
+
+//----------------------------------------------------------------------------//
+void BidiVisualMapping::clearVisualCache()
+{
+    s_visualIndex.clear();
+    s_visuals.clear();
+}
+
+//----------------------------------------------------------------------------//
+size_t BidiVisualMapping::getVisualCacheSize()
+{
+    return s_visuals.size();
 }
 
 //----------------------------------------------------------------------------//
@@ -28,11 +28,9 @@
 #include "CEGUI/GeometryBuffer.h"
 #include "CEGUI/Renderer.h"
 #include "CEGUI/Texture.h"
-#include "CEGUI/Vertex.h"
 #include "CEGUI/ColourRect.h"
 #include "CEGUI/XMLAttributes.h"
 #include "CEGUI/System.h" // this being here is a bit nasty IMO
-#include "CEGUI/CoordConverter.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -53,7 +51,8 @@ const String ImageNativeVertResAttribute( "nativeVertRes" );
 //----------------------------------------------------------------------------//
 BitmapImage::BitmapImage(const String& name) :
     Image(name),
-    d_texture(nullptr)
+    d_texture(nullptr),
+    d_shaderType(DefaultShaderType::Textured)
 {
 }
 
@@ -70,7 +69,8 @@ BitmapImage::BitmapImage(const XMLAttributes& attributes) :
           Sizef(static_cast<float>(attributes.getValueAsInteger(ImageNativeHorzResAttribute, 640)),
                 static_cast<float>(attributes.getValueAsInteger(ImageNativeVertResAttribute, 480)))),
     d_texture(&System::getSingleton().getRenderer()->getTexture(
-              attributes.getValueAsString(ImageTextureAttribute)))
+              attributes.getValueAsString(ImageTextureAttribute))),
+    d_shaderType(DefaultShaderType::Textured)
 {
 }
 
@@ -83,7 +83,8 @@ BitmapImage::BitmapImage(const String& name, Texture* texture,
           pixel_area,
           autoscaled,
           native_res),
-    d_texture(texture)
+    d_texture(texture),
+    d_shaderType(DefaultShaderType::Textured)
 {}
 
 //----------------------------------------------------------------------------//
@@ -95,142 +96,63 @@ void BitmapImage::setTexture(Texture* texture)
 //----------------------------------------------------------------------------//
 std::vector<GeometryBuffer*> BitmapImage::createRenderGeometry(const ImageRenderSettings& render_settings) const
 {
-    Rectf texRect;
-    Rectf finalRect;
-
-    bool isFullClipped = calculateTextureAreaAndRenderArea(
-        render_settings.d_destArea, render_settings.d_clipArea,
-        finalRect, texRect);
-
-    if(isFullClipped)
-    {
-        return std::vector<GeometryBuffer*>();
-    }
-
-    TexturedColouredVertex vbuffer[6];
-    const CEGUI::ColourRect& colours = render_settings.d_multiplyColours;
+    std::vector<GeometryBuffer*> geomBuffers;
+    appendRenderGeometry(geomBuffers, render_settings);
+    return geomBuffers;
+}
 
-    createTexturedQuadVertices(vbuffer, colours, finalRect, texRect);
+//----------------------------------------------------------------------------//
+void BitmapImage::appendRenderGeometry(std::vector<GeometryBuffer*>& geomBuffers,
+    const ImageRenderSettings& render_settings) const
+{
+    Rectf destArea;
+    Rectf texArea;
+    getQuadAreas(render_settings.d_destArea, destArea, texArea);
 
+    // check if rect was totally clipped, so that no buffer gets created
+    const Rectf finalRect(render_settings.d_clipArea ?
+        destArea.getIntersection(*render_settings.d_clipArea) : destArea);
+    if ((finalRect.getWidth() == 0) || (finalRect.getHeight() == 0))
+        return;
 
-    CEGUI::GeometryBuffer& buffer = System::getSingleton().getRenderer()->createGeometryBufferTextured();
+    CEGUI::GeometryBuffer& buffer = System::getSingleton().getRenderer()->createGeometryBufferTextured(d_shaderType);
 
     buffer.setClippingActive(render_settings.d_clippingEnabled);
     if(render_settings.d_clippingEnabled)
         buffer.setClippingRegion(*render_settings.d_clipArea);
     buffer.setTexture("texture0", d_texture);
-    buffer.appendGeometry(vbuffer, 6);
+    // further images are usually added as quads as well
+    buffer.setQuadIndexingEnabled(true);
+    buffer.appendTexturedQuads(&destArea, &texArea, &render_settings.d_multiplyColours,
+                               1, render_settings.d_clipArea);
     buffer.setAlpha(render_settings.d_alpha);
 
-    std::vector<GeometryBuffer*> geomBuffers;
     geomBuffers.push_back(&buffer);
-    return geomBuffers;
 }
 
-
+//----------------------------------------------------------------------------//
 void BitmapImage::addToRenderGeometry(
     GeometryBuffer& geomBuffer,
     const Rectf& renderArea,
     const Rectf* clipArea,
     const ColourRect& colours) const
 {
-    Rectf texRect;
-    Rectf finalRect;
+    Rectf destArea;
+    Rectf texArea;
+    getQuadAreas(renderArea, destArea, texArea);
 
-    bool isFullClipped = calculateTextureAreaAndRenderArea(
-        renderArea, clipArea,
-        finalRect, texRect);
-
-    if (isFullClipped)
-    {
-        return;
-    }
-    
-    TexturedColouredVertex vbuffer[6];
-    createTexturedQuadVertices(vbuffer, colours, finalRect, texRect);
-
-    geomBuffer.appendGeometry(vbuffer, 6);
+    geomBuffer.appendTexturedQuads(&destArea, &texArea, &colours, 1, clipArea);
 }
 
-
-bool BitmapImage::calculateTextureAreaAndRenderArea(
-    const Rectf& renderSettingDestArea,
-    const Rectf* clippingArea,
-    Rectf& finalRect, Rectf& texRect) const
+//----------------------------------------------------------------------------//
+void BitmapImage::getQuadAreas(const Rectf& renderArea, Rectf& destArea,
+                               Rectf& texArea) const
 {
-    Rectf dest(renderSettingDestArea);
     // apply rendering offset to the destination Rect
-    dest.offset(d_scaledOffset);
-
-    // get the rect area that we will actually draw to (i.e. perform clipping)
-    finalRect = Rectf(clippingArea ? dest.getIntersection(*clippingArea) : dest);
-
-    // check if rect was totally clipped
-    if ((finalRect.getWidth() == 0) || (finalRect.getHeight() == 0))
-        return true;
-
-    // Obtain correct scale values from the texture
-    const glm::vec2& texel_scale = d_texture->getTexelScaling();
-    const glm::vec2 tex_per_pix(d_imageArea.getWidth() / dest.getWidth(), d_imageArea.getHeight() / dest.getHeight());
-
-    // calculate final, clipped, texture co-ordinates
-    texRect = Rectf((d_imageArea + ((finalRect - dest) * tex_per_pix)) * texel_scale);
-
-    // Positions have to be rounded because the glyphs images have to be grid-aligned
-    finalRect.d_min.x = CoordConverter::alignToPixels(finalRect.d_min.x);
-    finalRect.d_min.y = CoordConverter::alignToPixels(finalRect.d_min.y);
-    finalRect.d_max.x = CoordConverter::alignToPixels(finalRect.d_max.x);
-    finalRect.d_max.y = CoordConverter::alignToPixels(finalRect.d_max.y);
+    destArea = renderArea;
+    destArea.offset(d_scaledOffset);
 
-    return false;
-}
-
-void BitmapImage::createTexturedQuadVertices(
-    TexturedColouredVertex* vbuffer,
-    const CEGUI::ColourRect &colours,
-    Rectf &finalRect,
-    const Rectf &texRect) const
-{
-    // vertex 0
-    vbuffer[0].setColour(colours.d_top_left);
-    vbuffer[0].d_position = glm::vec3(finalRect.left(), finalRect.top(), 0.0f);
-    vbuffer[0].d_texCoords = glm::vec2(texRect.left(), texRect.top());
-
-    // vertex 1
-    vbuffer[1].setColour(colours.d_bottom_left);
-    vbuffer[1].d_position = glm::vec3(finalRect.left(), finalRect.bottom(), 0.0f);
-    vbuffer[1].d_texCoords = glm::vec2(texRect.left(), texRect.bottom());
-
-    // vertex 2
-    vbuffer[2].setColour(colours.d_bottom_right);
-    vbuffer[2].d_position.x = finalRect.right();
-    vbuffer[2].d_position.z = 0.0f;
-    vbuffer[2].d_texCoords.x = texRect.right();
-
-    // Quad splitting done from top-left to bottom-right diagonal
-    vbuffer[2].d_position.y = finalRect.bottom();
-    vbuffer[2].d_texCoords.y = texRect.bottom();
-
-
-    // vertex 3
-    vbuffer[3].setColour(colours.d_top_right);
-    vbuffer[3].d_position = glm::vec3(finalRect.right(), finalRect.top(), 0.0f);
-    vbuffer[3].d_texCoords = glm::vec2(texRect.right(), texRect.top());
-
-    // vertex 4
-    vbuffer[4].setColour(colours.d_top_left);
-    vbuffer[4].d_position.x = finalRect.left();
-    vbuffer[4].d_position.z = 0.0f;
-    vbuffer[4].d_texCoords.x = texRect.left();
-
-    // Quad splitting done from top-left to bottom-right diagonal
-    vbuffer[4].d_position.y = finalRect.top();
-    vbuffer[4].d_texCoords.y = texRect.top();
-
-    // vertex 5
-    vbuffer[5].setColour(colours.d_bottom_right);
-    vbuffer[5].d_position = glm::vec3(finalRect.right(), finalRect.bottom(), 0.0f);
-    vbuffer[5].d_texCoords = glm::vec2(texRect.right(), texRect.bottom());
+    texArea = Rectf(d_imageArea * d_texture->getTexelScaling());
 }
 
 //----------------------------------------------------------------------------//
@@ -32,7 +32,7 @@ namespace CEGUI
 
 BoundSlot::BoundSlot(Group group, const SubscriberSlot& subscriber, Event& event) :
     d_group(group),
-    d_subscriber(new SubscriberSlot(subscriber)),
+    d_subscriber(subscriber),
     d_event(&event)
 {}
 
@@ -40,13 +40,12 @@ BoundSlot::BoundSlot(Group group, const SubscriberSlot& subscriber, Event& event
 BoundSlot::~BoundSlot()
 {
     disconnect();
-    delete d_subscriber;
 }
 
 //----------------------------------------------------------------------------//
 void BoundSlot::disconnect()
 {
-    // NB: don't delete d_subscriber here, we may still be inside its functor
+    // NB: don't clean d_subscriber up here, we may still be inside its functor
 
     // remove the owning Event's reference to us
     if (d_event)
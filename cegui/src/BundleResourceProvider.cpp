@@ -0,0 +1,394 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/BundleResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/PreparsedXML.h"
+
+#if defined(__WIN32__) || defined(_WIN32)
+#   include <windows.h>
+#   include <shlwapi.h>
+#   ifdef _MSC_VER
+#       pragma comment(lib, "shlwapi.lib")
+#   endif
+#else
+#   include <fnmatch.h>
+#endif
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const std::uint32_t BundleResourceProvider::FormatVersion = 1;
+const char BundleResourceProvider::FormatMagic[8] = { 'C', 'E', 'G', 'U', 'I', 'B', 'N', 'D' };
+const size_t BundleResourceProvider::DataAlignment = 16;
+const std::uint32_t BundleResourceProvider::NoString = 0xFFFFFFFF;
+
+namespace
+{
+//----------------------------------------------------------------------------//
+//! Bounds checked little endian reader over the data of a bundle.
+class Reader
+{
+public:
+    Reader(const std::uint8_t* data, size_t size) :
+        d_pos(data),
+        d_end(data + size)
+    {}
+
+    size_t remaining() const { return static_cast<size_t>(d_end - d_pos); }
+
+    bool readBytes(const std::uint8_t*& bytes, size_t count)
+    {
+        if (remaining() < count)
+            return false;
+
+        bytes = d_pos;
+        d_pos += count;
+        return true;
+    }
+
+    bool readUInt32(std::uint32_t& value)
+    {
+        const std::uint8_t* bytes;
+        if (!readBytes(bytes, 4))
+            return false;
+
+        value = static_cast<std::uint32_t>(bytes[0]) |
+                (static_cast<std::uint32_t>(bytes[1]) << 8) |
+                (static_cast<std::uint32_t>(bytes[2]) << 16) |
+                (static_cast<std::uint32_t>(bytes[3]) << 24);
+        return true;
+    }
+
+    bool readUInt64(std::uint64_t& value)
+    {
+        std::uint32_t low, high;
+        if (!readUInt32(low) || !readUInt32(high))
+            return false;
+
+        value = (static_cast<std::uint64_t>(high) << 32) | low;
+        return true;
+    }
+
+private:
+    const std::uint8_t* d_pos;
+    const std::uint8_t* d_end;
+};
+
+//----------------------------------------------------------------------------//
+//! A file of a bundle as found in its file table.
+struct TableEntry
+{
+    std::uint32_t d_resourceGroup;
+    std::uint32_t d_filename;
+    std::uint32_t d_type;
+    std::uint64_t d_offset;
+    std::uint64_t d_size;
+};
+
+//----------------------------------------------------------------------------//
+//! Reads the tables of a bundle, returning false if they are not valid.
+bool readTables(const RawDataContainer& data, std::vector<String>& strings,
+                std::uint32_t& schemeFilename, std::uint32_t& schemeGroup,
+                std::vector<TableEntry>& entries)
+{
+    Reader reader(data.getDataPtr(), data.getSize());
+
+    const std::uint8_t* magic;
+    std::uint32_t version;
+    std::uint32_t stringCount;
+    if (!reader.readBytes(magic, sizeof(BundleResourceProvider::FormatMagic)) ||
+        std::memcmp(magic, BundleResourceProvider::FormatMagic,
+                    sizeof(BundleResourceProvider::FormatMagic)) != 0 ||
+        !reader.readUInt32(version) || version != BundleResourceProvider::FormatVersion ||
+        !reader.readUInt32(stringCount) || stringCount > reader.remaining() / 4)
+    {
+        return false;
+    }
+
+    strings.reserve(stringCount);
+    for (std::uint32_t i = 0; i < stringCount; ++i)
+    {
+        std::uint32_t length;
+        const std::uint8_t* bytes;
+        if (!reader.readUInt32(length) || !reader.readBytes(bytes, length))
+            return false;
+
+        strings.push_back(String(std::string(
+            reinterpret_cast<const char*>(bytes), length)));
+    }
+
+    // the scheme is either given completely or not at all
+    std::uint32_t entryCount;
+    if (!reader.readUInt32(schemeFilename) || !reader.readUInt32(schemeGroup) ||
+        (schemeFilename == BundleResourceProvider::NoString) !=
+            (schemeGroup == BundleResourceProvider::NoString) ||
+        (schemeFilename != BundleResourceProvider::NoString &&
+            (schemeFilename >= stringCount || schemeGroup >= stringCount)) ||
+        !reader.readUInt32(entryCount) || entryCount > reader.remaining() / 32)
+    {
+        return false;
+    }
+
+    const std::uint64_t dataSize = data.getSize();
+    entries.resize(entryCount);
+    for (TableEntry& entry : entries)
+    {
+        std::uint32_t padding;
+        reader.readUInt32(entry.d_resourceGroup);
+        reader.readUInt32(entry.d_filename);
+        reader.readUInt32(entry.d_type);
+        reader.readUInt32(padding);
+        reader.readUInt64(entry.d_offset);
+        reader.readUInt64(entry.d_size);
+
+        if (entry.d_resourceGroup >= stringCount || entry.d_filename >= stringCount ||
+            entry.d_type > static_cast<std::uint32_t>(BundleResourceProvider::EntryType::Recording) ||
+            entry.d_offset > dataSize || entry.d_size > dataSize - entry.d_offset)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+//! Returns whether \a name matches the wildcard pattern \a pattern.
+bool nameMatchesPattern(const String& name, const String& pattern)
+{
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII)
+    const std::string utf8Name(name.c_str());
+    const std::string utf8Pattern(pattern.c_str());
+#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+    const std::string utf8Name(String::convertUtf32ToUtf8(name.getString()));
+    const std::string utf8Pattern(String::convertUtf32ToUtf8(pattern.getString()));
+#endif
+
+#if defined(__WIN32__) || defined(_WIN32)
+    return PathMatchSpecA(utf8Name.c_str(), utf8Pattern.c_str()) != FALSE;
+#else
+    return fnmatch(utf8Pattern.c_str(), utf8Name.c_str(), FNM_PATHNAME) == 0;
+#endif
+}
+
+}
+
+//----------------------------------------------------------------------------//
+BundleResourceProvider::BundleResourceProvider()
+{
+}
+
+//----------------------------------------------------------------------------//
+BundleResourceProvider::~BundleResourceProvider()
+{
+    // pending loads may still be reading the bundles
+    cancelPendingLoads();
+}
+
+//----------------------------------------------------------------------------//
+BundleResourceProvider::BundledScheme BundleResourceProvider::mountBundle(
+    const String& filename, const String& resourceGroup)
+{
+    std::unique_ptr<RawDataContainer> data(new RawDataContainer());
+
+    // the files are lent from the mapping, so only the pages of the files
+    // that are loaded are ever read
+    if (!d_memoryMappingEnabled ||
+        !mapFile(getFinalFilename(filename, resourceGroup), 0, *data))
+    {
+        DefaultResourceProvider::loadRawDataContainer(filename, *data, resourceGroup);
+    }
+
+    std::vector<String> strings;
+    std::uint32_t schemeFilename;
+    std::uint32_t schemeGroup;
+    std::vector<TableEntry> table;
+    if (!readTables(*data, strings, schemeFilename, schemeGroup, table))
+    {
+        throw FileIOException("'" + filename +
+            "' is not a resource bundle of the current format version.");
+    }
+
+    for (const TableEntry& tableEntry : table)
+    {
+        Entry entry;
+        entry.d_resourceGroup = strings[tableEntry.d_resourceGroup].empty() ?
+            d_defaultResourceGroup : strings[tableEntry.d_resourceGroup];
+        entry.d_filename = strings[tableEntry.d_filename];
+        entry.d_data = data->getDataPtr() + tableEntry.d_offset;
+        entry.d_size = static_cast<size_t>(tableEntry.d_size);
+        entry.d_type = static_cast<EntryType>(tableEntry.d_type);
+
+        d_entries[makeKey(entry.d_filename, entry.d_resourceGroup)] = entry;
+    }
+
+    d_bundles.push_back(std::move(data));
+
+    BundledScheme scheme;
+    if (schemeFilename != NoString)
+    {
+        scheme.d_filename = strings[schemeFilename];
+        scheme.d_resourceGroup = strings[schemeGroup];
+    }
+
+    return scheme;
+}
+
+//----------------------------------------------------------------------------//
+bool BundleResourceProvider::isBundled(const String& filename,
+                                       const String& resourceGroup) const
+{
+    return findEntry(filename, resourceGroup) != nullptr;
+}
+
+//----------------------------------------------------------------------------//
+void BundleResourceProvider::loadRawDataContainer(const String& filename,
+                                                  RawDataContainer& output,
+                                                  const String& resourceGroup)
+{
+    if (const Entry* const entry = findEntry(filename, resourceGroup))
+    {
+        output.setBorrowedData(entry->d_data, entry->d_size);
+        return;
+    }
+
+    DefaultResourceProvider::loadRawDataContainer(filename, output, resourceGroup);
+}
+
+//----------------------------------------------------------------------------//
+bool BundleResourceProvider::loadPreparsedXML(const String& filename,
+                                              PreparsedXML& output,
+                                              const String& resourceGroup)
+{
+    const Entry* const entry = findEntry(filename, resourceGroup);
+    if (!entry || entry->d_type != EntryType::Recording)
+        return false;
+
+    RawDataContainer data;
+    data.setBorrowedData(entry->d_data, entry->d_size);
+    if (!output.read(data))
+    {
+        throw FileIOException("'" + filename +
+            "' is bundled as a recording that can not be read.");
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void BundleResourceProvider::readRawDataChunks(const String& filename,
+                                               const ReadChunkCallback& callback,
+                                               const String& resourceGroup)
+{
+    if (const Entry* const entry = findEntry(filename, resourceGroup))
+    {
+        callback(entry->d_data, entry->d_size);
+        return;
+    }
+
+    DefaultResourceProvider::readRawDataChunks(filename, callback, resourceGroup);
+}
+
+//----------------------------------------------------------------------------//
+size_t BundleResourceProvider::getResourceGroupFileNames(
+    std::vector<String>& out_vec, const String& file_pattern,
+    const String& resource_group)
+{
+    const size_t first = out_vec.size();
+    size_t entries = DefaultResourceProvider::getResourceGroupFileNames(
+        out_vec, file_pattern, resource_group);
+    const size_t last = out_vec.size();
+
+    const String& group = resource_group.empty() ? d_defaultResourceGroup : resource_group;
+    for (const auto& pair : d_entries)
+    {
+        const Entry& entry = pair.second;
+        if (entry.d_resourceGroup != group ||
+            !nameMatchesPattern(entry.d_filename, file_pattern))
+        {
+            continue;
+        }
+
+        // files present both loose and bundled are listed once
+        if (std::find(out_vec.begin() + first, out_vec.begin() + last,
+                      entry.d_filename) != out_vec.begin() + last)
+        {
+            continue;
+        }
+
+        out_vec.push_back(entry.d_filename);
+        ++entries;
+    }
+
+    return entries;
+}
+
+//----------------------------------------------------------------------------//
+bool BundleResourceProvider::isResourceAvailable(const String& filename,
+                                                 const String& resourceGroup)
+{
+    return findEntry(filename, resourceGroup) ||
+        DefaultResourceProvider::isResourceAvailable(filename, resourceGroup);
+}
+
+//----------------------------------------------------------------------------//
+std::uint64_t BundleResourceProvider::getResourceVersion(const String& filename,
+                                                         const String& resourceGroup)
+{
+    if (findEntry(filename, resourceGroup))
+        return 0;
+
+    return DefaultResourceProvider::getResourceVersion(filename, resourceGroup);
+}
+
+//----------------------------------------------------------------------------//
+String BundleResourceProvider::makeKey(const String& filename,
+                                       const String& resourceGroup) const
+{
+    return (resourceGroup.empty() ? d_defaultResourceGroup : resourceGroup) +
+        "|" + filename;
+}
+
+//----------------------------------------------------------------------------//
+const BundleResourceProvider::Entry* BundleResourceProvider::findEntry(
+    const String& filename, const String& resourceGroup) const
+{
+    if (d_entries.empty())
+        return nullptr;
+
+    const auto found = d_entries.find(makeKey(filename, resourceGroup));
+    return found != d_entries.end() ? &found->second : nullptr;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,296 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/CachingResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include <iterator>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const size_t CachingResourceProvider::DefaultMemoryBudget = 16 * 1024 * 1024;
+
+//----------------------------------------------------------------------------//
+CachingResourceProvider::CachingResourceProvider(ResourceProvider* provider,
+                                                 size_t memoryBudget) :
+    d_provider(provider),
+    d_memoryBudget(memoryBudget),
+    d_memoryUsage(0),
+    d_hitCount(0),
+    d_missCount(0),
+    d_evictionCount(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+CachingResourceProvider::~CachingResourceProvider()
+{
+    // pending loads may still be running in loadRawDataContainer
+    cancelPendingLoads();
+
+    d_loans.clear();
+    clear();
+    delete d_provider;
+}
+
+//----------------------------------------------------------------------------//
+String CachingResourceProvider::makeKey(const String& filename,
+                                        const String& resourceGroup) const
+{
+    return (resourceGroup.empty() ? d_defaultResourceGroup : resourceGroup) +
+        "|" + filename;
+}
+
+//----------------------------------------------------------------------------//
+std::shared_ptr<const RawDataContainer> CachingResourceProvider::loadShared(
+    const String& filename, const String& resourceGroup)
+{
+    const String key(makeKey(filename, resourceGroup));
+
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+
+        const auto cached = d_index.find(key);
+        if (cached != d_index.end())
+        {
+            d_files.splice(d_files.begin(), d_files, cached->second);
+            ++d_hitCount;
+            return cached->second->d_data;
+        }
+
+        ++d_missCount;
+    }
+
+    // the data goes back to the provider that loaded it once unreferenced
+    ResourceProvider* const provider = d_provider;
+    std::shared_ptr<RawDataContainer> data(new RawDataContainer(),
+        [provider](RawDataContainer* container)
+    {
+        provider->unloadRawDataContainer(*container);
+        delete container;
+    });
+
+    d_provider->loadRawDataContainer(filename, *data,
+        resourceGroup.empty() ? d_defaultResourceGroup : resourceGroup);
+
+    // lent data costs nothing to load again, files larger than the whole
+    // budget would only flush the cache
+    if (data->isBorrowed() || data->getSize() > d_memoryBudget)
+        return data;
+
+    CachedFileList evicted;
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+
+        // another thread may have loaded the file in the meantime
+        if (d_index.find(key) != d_index.end())
+            return data;
+
+        CachedFile file;
+        file.d_key = key;
+        file.d_data = data;
+        d_files.push_front(std::move(file));
+        d_index[key] = d_files.begin();
+        d_memoryUsage += data->getSize();
+
+        evict(evicted);
+    }
+
+    return data;
+}
+
+//----------------------------------------------------------------------------//
+void CachingResourceProvider::evict(CachedFileList& evicted)
+{
+    while (d_memoryUsage > d_memoryBudget && !d_files.empty())
+    {
+        const auto last = std::prev(d_files.end());
+        d_memoryUsage -= last->d_data->getSize();
+        d_index.erase(last->d_key);
+        evicted.splice(evicted.end(), d_files, last);
+        ++d_evictionCount;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void CachingResourceProvider::loadRawDataContainer(const String& filename,
+                                                   RawDataContainer& output,
+                                                   const String& resourceGroup)
+{
+    const std::shared_ptr<const RawDataContainer> data(loadShared(filename, resourceGroup));
+
+    output.setBorrowedData(data->getDataPtr(), data->getSize());
+
+    if (!data->getDataPtr())
+        return;
+
+    std::lock_guard<std::mutex> lock(d_mutex);
+    Loan& loan = d_loans[data->getDataPtr()];
+    loan.first = data;
+    ++loan.second;
+}
+
+//----------------------------------------------------------------------------//
+void CachingResourceProvider::unloadRawDataContainer(RawDataContainer& data)
+{
+    std::shared_ptr<const RawDataContainer> released;
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+
+        const auto loan = d_loans.find(data.getDataPtr());
+        if (loan != d_loans.end() && --loan->second.second == 0)
+        {
+            released = std::move(loan->second.first);
+            d_loans.erase(loan);
+        }
+    }
+
+    data.release();
+}
+
+//----------------------------------------------------------------------------//
+size_t CachingResourceProvider::getResourceGroupFileNames(
+    std::vector<String>& out_vec, const String& file_pattern,
+    const String& resource_group)
+{
+    return d_provider->getResourceGroupFileNames(out_vec, file_pattern,
+        resource_group.empty() ? d_defaultResourceGroup : resource_group);
+}
+
+//----------------------------------------------------------------------------//
+bool CachingResourceProvider::isResourceAvailable(const String& filename,
+                                                  const String& resourceGroup)
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        if (d_index.find(makeKey(filename, resourceGroup)) != d_index.end())
+            return true;
+    }
+
+    return d_provider->isResourceAvailable(filename,
+        resourceGroup.empty() ? d_defaultResourceGroup : resourceGroup);
+}
+
+//----------------------------------------------------------------------------//
+void CachingResourceProvider::setMemoryBudget(size_t bytes)
+{
+    CachedFileList evicted;
+
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_memoryBudget = bytes;
+    evict(evicted);
+}
+
+//----------------------------------------------------------------------------//
+size_t CachingResourceProvider::getMemoryBudget() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_memoryBudget;
+}
+
+//----------------------------------------------------------------------------//
+size_t CachingResourceProvider::getMemoryUsage() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_memoryUsage;
+}
+
+//----------------------------------------------------------------------------//
+size_t CachingResourceProvider::getCachedFileCount() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_files.size();
+}
+
+//----------------------------------------------------------------------------//
+void CachingResourceProvider::invalidate(const String& filename,
+                                         const String& resourceGroup)
+{
+    CachedFileList removed;
+
+    std::lock_guard<std::mutex> lock(d_mutex);
+    const auto cached = d_index.find(makeKey(filename, resourceGroup));
+    if (cached == d_index.end())
+        return;
+
+    d_memoryUsage -= cached->second->d_data->getSize();
+    removed.splice(removed.end(), d_files, cached->second);
+    d_index.erase(cached);
+}
+
+//----------------------------------------------------------------------------//
+void CachingResourceProvider::clear()
+{
+    CachedFileList removed;
+
+    std::lock_guard<std::mutex> lock(d_mutex);
+    removed.swap(d_files);
+    d_index.clear();
+    d_memoryUsage = 0;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t CachingResourceProvider::getHitCount() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_hitCount;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t CachingResourceProvider::getMissCount() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_missCount;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t CachingResourceProvider::getEvictionCount() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_evictionCount;
+}
+
+//----------------------------------------------------------------------------//
+float CachingResourceProvider::getHitRate() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    const std::size_t requestCount = d_hitCount + d_missCount;
+    return requestCount ? static_cast<float>(d_hitCount) / requestCount : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+void CachingResourceProvider::resetStatistics()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_hitCount = 0;
+    d_missCount = 0;
+    d_evictionCount = 0;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
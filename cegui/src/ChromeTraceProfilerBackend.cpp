@@ -0,0 +1,141 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ChromeTraceProfilerBackend.h"
+#include <atomic>
+#include <ostream>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//----------------------------------------------------------------------------//
+// small sequential ids read better in trace viewers than hashed thread ids
+std::uint32_t getTraceThreadId()
+{
+    static std::atomic<std::uint32_t> nextId(1);
+    thread_local const std::uint32_t id = nextId++;
+    return id;
+}
+
+//----------------------------------------------------------------------------//
+void writeJsonString(std::ostream& out, const char* str)
+{
+    out << '"';
+    for (; str && *str; ++str)
+    {
+        if (*str == '"' || *str == '\\')
+            out << '\\';
+        out << *str;
+    }
+    out << '"';
+}
+
+//----------------------------------------------------------------------------//
+void writeMicroseconds(std::ostream& out, std::uint64_t nanoseconds)
+{
+    out << nanoseconds / 1000 << '.';
+    const std::uint64_t fraction = nanoseconds % 1000;
+    if (fraction < 100)
+        out << '0';
+    if (fraction < 10)
+        out << '0';
+    out << fraction;
+}
+
+}
+
+//----------------------------------------------------------------------------//
+ChromeTraceProfilerBackend::ChromeTraceProfilerBackend() :
+    d_origin(std::chrono::steady_clock::now())
+{
+}
+
+//----------------------------------------------------------------------------//
+std::uint64_t ChromeTraceProfilerBackend::getElapsedTime() const
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - d_origin).count());
+}
+
+//----------------------------------------------------------------------------//
+std::uint64_t ChromeTraceProfilerBackend::beginZone(const ProfileZone&)
+{
+    return getElapsedTime();
+}
+
+//----------------------------------------------------------------------------//
+void ChromeTraceProfilerBackend::endZone(const ProfileZone& zone, std::uint64_t token)
+{
+    const Event event = { &zone, token, getElapsedTime() - token, getTraceThreadId() };
+
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_events.push_back(event);
+}
+
+//----------------------------------------------------------------------------//
+void ChromeTraceProfilerBackend::writeTrace(std::ostream& out) const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+
+    out << "{\"traceEvents\":[";
+    for (std::size_t i = 0; i < d_events.size(); ++i)
+    {
+        const Event& event = d_events[i];
+
+        out << (i ? ",\n" : "\n") << "{\"name\":";
+        writeJsonString(out, event.d_zone->d_name);
+        out << ",\"cat\":\"CEGUI\",\"ph\":\"X\",\"ts\":";
+        writeMicroseconds(out, event.d_start);
+        out << ",\"dur\":";
+        writeMicroseconds(out, event.d_duration);
+        out << ",\"pid\":1,\"tid\":" << event.d_thread << ",\"args\":{\"function\":";
+        writeJsonString(out, event.d_zone->d_function);
+        out << ",\"file\":";
+        writeJsonString(out, event.d_zone->d_file);
+        out << ",\"line\":" << event.d_zone->d_line << "}}";
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+//----------------------------------------------------------------------------//
+std::size_t ChromeTraceProfilerBackend::getEventCount() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_events.size();
+}
+
+//----------------------------------------------------------------------------//
+void ChromeTraceProfilerBackend::clear()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_events.clear();
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
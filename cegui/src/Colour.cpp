@@ -31,37 +31,22 @@
 
 namespace CEGUI
 {
-/*************************************************************************
-	Construction & Destruction
-*************************************************************************/
-Colour::Colour(void) :
-	d_alpha(1.0f),
-	d_red(0.0f),
-	d_green(0.0f),
-	d_blue(0.0f),
-	d_argb(0xFF000000),
-	d_argbValid(true)
+#if !defined(CEGUI_SIMD_SSE2)
+namespace
 {
-}
-
-
-Colour::Colour(const Colour& val)
+//! Converts a colour component to a byte, saturating out of range values.
+inline argb_t toByte(float component)
 {
-	this->operator=(val);
+    const float value = component * 255.0f;
+    return value <= 0.0f ? 0 :
+           value >= 255.0f ? 255 : static_cast<argb_t>(value);
 }
-
-
-Colour::Colour(float red, float green, float blue, float alpha) :
-	d_alpha(alpha),
-	d_red(red),
-	d_green(green),
-	d_blue(blue), 
-    d_argb(0x00000000),
-    d_argbValid(false)
-{
 }
+#endif
 
-
+/*************************************************************************
+	Construction & Destruction
+*************************************************************************/
 Colour::Colour(argb_t argb)
 {
 	setARGB(argb);
@@ -232,12 +217,21 @@ void Colour::setHSL(float hue, float saturation, float luminance, float alpha)
 
 argb_t Colour::calculateARGB(void) const
 {
+#if defined(CEGUI_SIMD_SSE2)
+    // reorder to b, g, r, a so that the packed bytes form the argb value
+    const Components c = loadComponents();
+    const __m128i values = _mm_cvttps_epi32(_mm_mul_ps(
+        _mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 1, 2, 3)), _mm_set1_ps(255.0f)));
+    const __m128i words = _mm_packs_epi32(values, values);
+    return static_cast<argb_t>(_mm_cvtsi128_si32(_mm_packus_epi16(words, words)));
+#else
     return (
-		static_cast<argb_t>(d_alpha * 255) << 24 |
-		static_cast<argb_t>(d_red * 255) << 16 |
-		static_cast<argb_t>(d_green * 255) << 8 |
-		static_cast<argb_t>(d_blue * 255)
+		toByte(d_alpha) << 24 |
+		toByte(d_red) << 16 |
+		toByte(d_green) << 8 |
+		toByte(d_blue)
 	);
+#endif
 }
 
 
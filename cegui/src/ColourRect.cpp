@@ -133,9 +133,8 @@ bool ColourRect::isMonochromatic() const
 *************************************************************************/
 Colour ColourRect::getColourAtPoint( float x, float y ) const
 {
-    Colour h1((d_top_right - d_top_left) * x + d_top_left);
-	Colour h2((d_bottom_right - d_bottom_left) * x + d_bottom_left);
-	return Colour((h2 - h1) * y + h1);
+    return Colour::lerp(Colour::lerp(d_top_left, d_top_right, x),
+                        Colour::lerp(d_bottom_left, d_bottom_right, x), y);
 }
 
 /*************************************************************************
@@ -39,7 +39,7 @@
 #include "CEGUI/WindowManager.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/ImageManager.h"
-#include "CEGUI/BitmapImage.h"
+#include "CEGUI/GradientImage.h"
 #include "CEGUI/CoordConverter.h"
 #include "CEGUI/Logger.h"
 
@@ -47,8 +47,6 @@
 #include "CEGUI/CommonDialogs/ColourPicker/Controls.h"
 #include "CEGUI/CommonDialogs/ColourPicker/Conversions.h"
 
-#include "CEGUI/TextureTarget.h"
-#include "CEGUI/Texture.h"
 #include "CEGUI/PropertyHelper.h"
 
 #include "CEGUI/RegexMatcher.h"
@@ -70,6 +68,9 @@ const String ColourPickerControls::ColourPickerControlsPickingTextureImageName("
 const String ColourPickerControls::ColourPickerControlsColourSliderTextureImageName("ColourSliderTexture");
 const String ColourPickerControls::ColourPickerControlsAlphaSliderTextureImageName("AlphaSliderTexture");
 //----------------------------------------------------------------------------//
+// Number of grid cells per side the picking image gradient is evaluated at
+static const unsigned int ColourPickingImageSubdivisions = 32;
+//----------------------------------------------------------------------------//
 const float ColourPickerControls::LAB_L_MIN(0.0f);
 const float ColourPickerControls::LAB_L_MAX(100.0f);
 const float ColourPickerControls::LAB_L_DIFF(LAB_L_MAX - LAB_L_MIN);
@@ -129,18 +130,16 @@ ColourPickerControls::ColourPickerControls(const String& type, const String& nam
     d_colourPickerIndicator(nullptr),
     d_sliderMode(SliderMode::LAB_L),
     d_selectedColour(0.75f, 0.75f, 0.75f),
-    d_colourPickerControlsTextureTarget(nullptr),
-    d_colourPickerImageOffset(2),
+    d_colourPickingImage(nullptr),
+    d_colourSliderImage(nullptr),
+    d_alphaSliderImage(nullptr),
     d_colourPickerPickingImageHeight(260),
     d_colourPickerPickingImageWidth(260),
     d_colourPickerColourSliderImageWidth(1),
     d_colourPickerColourSliderImageHeight(260),
     d_colourPickerAlphaSliderImageWidth(260),
     d_colourPickerAlphaSliderImageHeight(60),
-    d_colourPickerControlsTextureSize(512),
     d_draggingColourPickerIndicator(false),
-    d_colourPickingTexture(new RGB_Colour[d_colourPickerControlsTextureSize *
-                                          d_colourPickerControlsTextureSize]),
     d_ignoreEvents(false),
     d_regexMatcher(*System::getSingleton().createRegexMatcher())
 {
@@ -358,90 +357,118 @@ HSV_Colour ColourPickerControls::getColourSliderPositionColourHSV(float value)
 //----------------------------------------------------------------------------//
 void ColourPickerControls::initColourPickerControlsImageSet()
 {
-    d_colourPickerControlsTextureTarget =
-        System::getSingleton().getRenderer()->createTextureTarget(false);
-
-    const String baseName(
-        d_colourPickerControlsTextureTarget->getTexture().getName());
+    // The gradients are generated as vertex-coloured geometry whenever the
+    // widgets are redrawn, so no pixel data has to be created or uploaded.
+    static std::uint32_t imageSetCount = 0;
+    const String baseName("ColourPickerControls" +
+        PropertyHelper<std::uint32_t>::toString(imageSetCount++));
 
-    BitmapImage* image = static_cast<BitmapImage*>(
-        &ImageManager::getSingleton().create("BitmapImage", baseName + '/' +
+    d_colourPickingImage = static_cast<GradientImage*>(
+        &ImageManager::getSingleton().create("GradientImage", baseName + '/' +
             ColourPickerControlsPickingTextureImageName));
 
-    image->setTexture(&d_colourPickerControlsTextureTarget->getTexture());
-    image->setImageArea(
+    d_colourPickingImage->setImageArea(
         Rectf(glm::vec2(0.0f, 0.0f),
               Sizef(static_cast<float>(d_colourPickerPickingImageWidth),
                     static_cast<float>(d_colourPickerPickingImageHeight))));
+    d_colourPickingImage->setSubdivisions(ColourPickingImageSubdivisions,
+                                          ColourPickingImageSubdivisions);
+    d_colourPickingImage->setColourFunction(
+        [this](const glm::vec2& relPos) { return getColourPickingImageColour(relPos); });
 
-    image = static_cast<BitmapImage*>(
-                &ImageManager::getSingleton().create("BitmapImage", baseName + '/' +
-                        ColourPickerControlsColourSliderTextureImageName));
+    d_colourSliderImage = static_cast<GradientImage*>(
+        &ImageManager::getSingleton().create("GradientImage", baseName + '/' +
+            ColourPickerControlsColourSliderTextureImageName));
 
-    image->setTexture(&d_colourPickerControlsTextureTarget->getTexture());
-    image->setImageArea(
-        Rectf(glm::vec2(static_cast<float>(d_colourPickerPickingImageWidth + d_colourPickerImageOffset), 0.0f),
+    d_colourSliderImage->setImageArea(
+        Rectf(glm::vec2(0.0f, 0.0f),
               Sizef(static_cast<float>(d_colourPickerColourSliderImageWidth),
                     static_cast<float>(d_colourPickerColourSliderImageHeight))));
+    d_colourSliderImage->setSubdivisions(1, ColourPickingImageSubdivisions);
+    d_colourSliderImage->setColourFunction(
+        [this](const glm::vec2& relPos) { return getColourSliderImageColour(relPos); });
 
-    image = static_cast<BitmapImage*>(
-                &ImageManager::getSingleton().create("BitmapImage", baseName + '/' +
-                        ColourPickerControlsAlphaSliderTextureImageName));
+    d_alphaSliderImage = static_cast<GradientImage*>(
+        &ImageManager::getSingleton().create("GradientImage", baseName + '/' +
+            ColourPickerControlsAlphaSliderTextureImageName));
 
-    image->setTexture(&d_colourPickerControlsTextureTarget->getTexture());
-    image->setImageArea(
-        Rectf(glm::vec2(0.0f, static_cast<float>(d_colourPickerPickingImageHeight + d_colourPickerImageOffset)),
+    d_alphaSliderImage->setImageArea(
+        Rectf(glm::vec2(0.0f, 0.0f),
               Sizef(static_cast<float>(d_colourPickerAlphaSliderImageWidth),
                     static_cast<float>(d_colourPickerAlphaSliderImageHeight))));
+    d_alphaSliderImage->setCheckerboard(15.0f,
+                                        Colour(1.0f, 1.0f, 1.0f),
+                                        Colour(122.0f / 255.0f, 122.0f / 255.0f, 122.0f / 255.0f));
+    d_alphaSliderImage->setColourFunction(
+        [this](const glm::vec2& relPos) { return getAlphaSliderImageColour(relPos); });
 
     getColourPickerStaticImage()->setProperty(
-        "Image", baseName + '/' + ColourPickerControlsPickingTextureImageName);
+        "Image", d_colourPickingImage->getName());
     getColourPickerImageSlider()->setProperty(
-        "ScrollImage", baseName + '/' + ColourPickerControlsColourSliderTextureImageName);
+        "ScrollImage", d_colourSliderImage->getName());
     getColourPickerAlphaSlider()->setProperty(
-        "ScrollImage", baseName + '/' + ColourPickerControlsAlphaSliderTextureImageName);
+        "ScrollImage", d_alphaSliderImage->getName());
 
-    refreshColourPickerControlsTextures();
+    refreshColourPickerControlsImages();
 }
 
 //----------------------------------------------------------------------------//
-void ColourPickerControls::deinitColourPickerControlsTexture()
+void ColourPickerControls::deinitColourPickerControlsImages()
 {
-    if (d_colourPickerControlsTextureTarget)
+    if (d_colourPickingImage)
     {
-        ImageManager::getSingleton().destroyImageCollection(
-            d_colourPickerControlsTextureTarget->getTexture().getName(), false);
+        ImageManager::getSingleton().destroy(*d_colourPickingImage);
+        ImageManager::getSingleton().destroy(*d_colourSliderImage);
+        ImageManager::getSingleton().destroy(*d_alphaSliderImage);
 
-        System::getSingleton().getRenderer()->
-        destroyTextureTarget(d_colourPickerControlsTextureTarget);
+        d_colourPickingImage = nullptr;
+        d_colourSliderImage = nullptr;
+        d_alphaSliderImage = nullptr;
     }
 }
 
 //----------------------------------------------------------------------------//
-void ColourPickerControls::refreshColourPickerControlsTextures()
+void ColourPickerControls::refreshColourPickerControlsImages()
 {
-    Logger::getSingleton().logEvent(
-        "[ColourPicker] Refreshing ColourPickerTexture");
-
     refreshColourPickingImage();
     refreshColourSliderImage();
     refreshAlphaSliderImage();
+}
+
+//----------------------------------------------------------------------------//
+Colour ColourPickerControls::getColourPickingImageColour(const glm::vec2& relPos)
+{
+    const float xAbs = relPos.x * static_cast<float>(d_colourPickerPickingImageWidth - 1);
+    const float yAbs = relPos.y * static_cast<float>(d_colourPickerPickingImageHeight - 1);
+
+    if (d_sliderMode & (LAB_L | LAB_A | SliderMode::LAB_B))
+        return ColourPickerConversions::toCeguiColour(
+            RGB_Colour(getColourPickingPositionColourLAB(xAbs, yAbs)));
 
-    reloadColourPickerControlsTexture();
+    return ColourPickerConversions::toCeguiColour(
+        RGB_Colour(getColourPickingPositionColourHSV(xAbs, yAbs)));
 }
 
 //----------------------------------------------------------------------------//
-void ColourPickerControls::reloadColourPickerControlsTexture()
+Colour ColourPickerControls::getColourSliderImageColour(const glm::vec2& relPos)
 {
-    d_colourPickerControlsTextureTarget->getTexture().loadFromMemory(
-        d_colourPickingTexture,
-        Sizef(static_cast<float>(d_colourPickerControlsTextureSize),
-              static_cast<float>(d_colourPickerControlsTextureSize)),
-        Texture::PixelFormat::Rgb);
+    if (d_sliderMode & (LAB_L | LAB_A | SliderMode::LAB_B))
+        return ColourPickerConversions::toCeguiColour(
+            RGB_Colour(getColourSliderPositionColourLAB(relPos.y)));
 
-    getColourPickerImageSlider()->invalidate();
-    getColourPickerAlphaSlider()->invalidate();
-    getColourPickerStaticImage()->invalidate();
+    return ColourPickerConversions::toCeguiColour(
+        RGB_Colour(getColourSliderPositionColourHSV(relPos.y)));
+}
+
+//----------------------------------------------------------------------------//
+Colour ColourPickerControls::getAlphaSliderImageColour(const glm::vec2& relPos)
+{
+    // The selected colour fades out towards the right, revealing the
+    // checkerboard drawn behind it.
+    Colour colour(ColourPickerConversions::toCeguiColour(d_selectedColourRGB));
+    colour.setAlpha(1.0f - relPos.x);
+
+    return colour;
 }
 
 //----------------------------------------------------------------------------//
@@ -598,7 +625,7 @@ void ColourPickerControls::initialiseComponents()
 
 void ColourPickerControls::destroy( void )
 {
-    deinitColourPickerControlsTexture();
+    deinitColourPickerControlsImages();
 
     if (d_colourPickerIndicator)
     {
@@ -606,9 +633,6 @@ void ColourPickerControls::destroy( void )
         d_colourPickerIndicator = nullptr;
     }
 
-    delete[] d_colourPickingTexture;
-    d_colourPickingTexture = nullptr;
-
     System::getSingleton().destroyRegexMatcher(&d_regexMatcher);
 
     Window::destroy();
@@ -1063,7 +1087,7 @@ bool ColourPickerControls::handleRadioButtonModeSelection(const EventArgs& args)
 
     refreshColourSliderPosition();
 
-    refreshColourPickerControlsTextures();
+    refreshColourPickerControlsImages();
 
     return true;
 }
@@ -1217,125 +1241,21 @@ void ColourPickerControls::onAcceptButtonClicked(WindowEventArgs& e)
 //----------------------------------------------------------------------------//
 void ColourPickerControls::refreshColourPickingImage()
 {
-    if (d_sliderMode &
-            (LAB_L | LAB_A | SliderMode::LAB_B))
-    {
-        for (int y = 0; y < d_colourPickerPickingImageHeight; ++y)
-        {
-            for (int x = 0; x < d_colourPickerPickingImageWidth; ++x)
-            {
-                int i = d_colourPickerControlsTextureSize * y + x;
-
-                Lab_Colour colour =
-                    getColourPickingPositionColourLAB(static_cast<float>(x),
-                                                      static_cast<float>(y));
-
-                d_colourPickingTexture[i] = RGB_Colour(colour);
-            }
-        }
-    }
-    else if (d_sliderMode &
-             (SliderMode::HSV_H | SliderMode::HSV_S | SliderMode::HSV_V))
-    {
-        for (int y = 0; y < d_colourPickerPickingImageHeight; ++y)
-        {
-            for (int x = 0; x < d_colourPickerPickingImageWidth; ++x)
-            {
-                int i = d_colourPickerControlsTextureSize * y + x;
-
-                HSV_Colour colour =
-                    getColourPickingPositionColourHSV(static_cast<float>(x),
-                                                      static_cast<float>(y));
-
-                d_colourPickingTexture[i] = RGB_Colour(colour);
-            }
-        }
-    }
+    getColourPickerStaticImage()->invalidate();
 }
 
 //----------------------------------------------------------------------------//
 void ColourPickerControls::refreshColourSliderImage()
 {
-    if (d_sliderMode &
-            (LAB_L | LAB_A | SliderMode::LAB_B))
-    {
-        for (int y = 0; y < d_colourPickerPickingImageHeight; ++y)
-        {
-            for (int x = 0; x < d_colourPickerColourSliderImageWidth; ++x)
-            {
-                int i = d_colourPickerControlsTextureSize * y +
-                        (x + d_colourPickerPickingImageWidth + 2);
-
-                Lab_Colour colour = getColourSliderPositionColourLAB(
-                    y / static_cast<float>(d_colourPickerPickingImageHeight - 1));
-
-                d_colourPickingTexture[i] = RGB_Colour(colour);
-            }
-        }
-    }
-    else if (d_sliderMode &
-             (SliderMode::HSV_H | SliderMode::HSV_S | SliderMode::HSV_V))
-    {
-        for (int y = 0; y < d_colourPickerPickingImageHeight; ++y)
-        {
-            for (int x = 0; x < d_colourPickerColourSliderImageWidth; ++x)
-            {
-                int i = d_colourPickerControlsTextureSize * y +
-                        (x + d_colourPickerPickingImageWidth + 2);
-
-                HSV_Colour colour = getColourSliderPositionColourHSV(
-                    y / static_cast<float>(d_colourPickerPickingImageHeight - 1));
-
-                d_colourPickingTexture[i] = RGB_Colour(colour);
-            }
-        }
-    }
+    getColourPickerImageSlider()->invalidate();
 }
 
 //----------------------------------------------------------------------------//
 void ColourPickerControls::refreshAlphaSliderImage()
 {
-    for (int y = 0; y < d_colourPickerAlphaSliderImageHeight; ++y)
-    {
-        for (int x = 0; x < d_colourPickerAlphaSliderImageWidth; ++x)
-        {
-            int i = x + d_colourPickerControlsTextureSize *
-                (y + d_colourPickerImageOffset + d_colourPickerPickingImageHeight);
-
-            RGB_Colour curColour = getAlphaSliderPositionColour(x, y);
-            d_colourPickingTexture[i] = curColour;
-        }
-    }
-}
-
-//----------------------------------------------------------------------------//
-RGB_Colour ColourPickerControls::getAlphaSliderPositionColour(int x, int y)
-{
-    static const RGB_Colour background1(255, 255, 255);
-    static const RGB_Colour background2(122, 122, 122);
-
-    float xRel = x / static_cast<float>(d_colourPickerAlphaSliderImageWidth - 1);
-    RGB_Colour final;
-
-    bool isBackground1;
-
-    if ((x % 30) >= 15)
-        isBackground1 = false;
-    else
-        isBackground1 = true;
-
-    if ((y % 30) >= 15)
-        isBackground1 = !isBackground1;
-
-    if (isBackground1)
-        final = d_selectedColourRGB * (1.0f - xRel) + background1 * xRel;
-    else
-        final = d_selectedColourRGB * (1.0f - xRel) + background2 * xRel;
-
-    return final;
+    getColourPickerAlphaSlider()->invalidate();
 }
 
-
 //----------------------------------------------------------------------------//
 void ColourPickerControls::initColourPicker()
 {
@@ -1538,7 +1458,7 @@ void ColourPickerControls::onColourSliderChanged()
 
     refreshColourPickerIndicatorPosition();
 
-    refreshColourPickerControlsTextures();
+    refreshColourPickerControlsImages();
 }
 
 //----------------------------------------------------------------------------//
@@ -1600,7 +1520,7 @@ void ColourPickerControls::refreshAllElements()
 
     refreshAlpha();
 
-    refreshColourPickerControlsTextures();
+    refreshColourPickerControlsImages();
 }
 
 //----------------------------------------------------------------------------//
@@ -1610,14 +1530,7 @@ void ColourPickerControls::onColourIndicatorPositionChanged()
 
     refreshAlphaSliderImage();
 
-    refreshOnlyColourSliderImage();
-}
-
-//----------------------------------------------------------------------------//
-void ColourPickerControls::refreshOnlyColourSliderImage()
-{
     refreshColourSliderImage();
-    reloadColourPickerControlsTexture();
 }
 
 //----------------------------------------------------------------------------//
@@ -100,6 +100,19 @@ size_t CompositeResourceProvider::getResourceGroupFileNames(std::vector<String>&
   }
   return entries;
 }
+bool CompositeResourceProvider::loadPreparsedXML(const String& filename,
+                         PreparsedXML& output,
+                         const String& resourceGroup)
+{
+  ProviderIterator it=getIterator();
+  for(it.toStart(); !it.isAtEnd(); ++it)
+  {
+    if (it.getCurrentValue()->loadPreparsedXML(filename,output,resourceGroup))
+      return true;
+  }
+  return false;
+}
+
 CompositeResourceProvider::ProviderIterator CompositeResourceProvider::getIterator(void) const
 {
   return ProviderIterator(d_providerlist.begin(), d_providerlist.end());
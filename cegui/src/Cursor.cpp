@@ -38,6 +38,10 @@
 
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+NativeCursorProvider::~NativeCursorProvider()
+{}
+
 /*************************************************************************
 	Static Data Definitions
 *************************************************************************/
@@ -63,7 +67,9 @@ Cursor::Cursor(const GUIContext& context) :
     d_visible(true),
     d_customSize(0.0f, 0.0f),
     d_customOffset(0.0f, 0.0f),
-    d_cachedGeometryValid(false)
+    d_cachedGeometryValid(false),
+    d_nativeProvider(nullptr),
+    d_nativeCursorActive(false)
 {
     // default constraint is to whole screen
     const URect screenArea(cegui_reldim(0.f), cegui_reldim(0.f), cegui_reldim(1.f), cegui_reldim(1.f));
@@ -90,6 +96,7 @@ void Cursor::setImage(const Image* image)
 
     d_indicatorImage = image;
     d_cachedGeometryValid = false;
+    updateNativeCursor();
 
 	CursorEventArgs args(this);
 	args.d_image = image;
@@ -146,13 +153,18 @@ const Image* Cursor::getDefaultImage() const
 *************************************************************************/
 void Cursor::draw(std::uint32_t drawModeMask)
 {
-    if (!d_visible || !d_indicatorImage)
+    if (!d_visible || !d_indicatorImage || d_nativeCursorActive)
         return;
 
     if (!d_cachedGeometryValid)
         cacheGeometry();
 
-    System::getSingleton().getRenderer()->uploadBuffers(d_geometryBuffers);
+    Renderer* const renderer = System::getSingleton().getRenderer();
+    TextureResidencyManager& residency = renderer->getTextureResidencyManager();
+    if (residency.isTrackingUsage())
+        residency.markUsed(d_geometryBuffers);
+
+    renderer->uploadBuffers(d_geometryBuffers);
     const size_t geom_buffer_count = d_geometryBuffers.size();
     for (size_t i = 0; i < geom_buffer_count; ++i)
         d_geometryBuffers[i]->draw(drawModeMask);
@@ -308,6 +320,7 @@ void Cursor::setExplicitRenderSize(const Sizef& size)
 {
     d_customSize = size;
     d_cachedGeometryValid = false;
+    updateNativeCursor();
 }
 
 //----------------------------------------------------------------------------//
@@ -375,6 +388,69 @@ void Cursor::setInitialPointerPosition(const glm::vec2& position)
 void Cursor::invalidate()
 {
     d_cachedGeometryValid = false;
+    updateNativeCursor();
+}
+
+//----------------------------------------------------------------------------//
+void Cursor::setVisible(bool visible)
+{
+    if (d_visible == visible)
+        return;
+
+    d_visible = visible;
+    updateNativeCursor();
+}
+
+//----------------------------------------------------------------------------//
+void Cursor::setNativeProvider(NativeCursorProvider* provider)
+{
+    if (provider == d_nativeProvider)
+        return;
+
+    // hand the cursor back from the previous provider
+    if (d_nativeProvider && d_nativeCursorActive)
+        d_nativeProvider->setCursorImage(nullptr, Sizef(0.0f, 0.0f), glm::vec2(0.0f, 0.0f));
+
+    d_nativeProvider = provider;
+    updateNativeCursor();
+}
+
+//----------------------------------------------------------------------------//
+void Cursor::updateNativeCursor()
+{
+    if (!d_nativeProvider)
+    {
+        d_nativeCursorActive = false;
+        return;
+    }
+
+    const Image* const image = d_visible ? d_indicatorImage : nullptr;
+    if (!image)
+    {
+        d_nativeCursorActive = d_nativeProvider->setCursorImage(
+            nullptr, Sizef(0.0f, 0.0f), glm::vec2(0.0f, 0.0f));
+        return;
+    }
+
+    // the rendered offset places the hot spot of the image at the position
+    const Sizef& imageSize(image->getRenderedSize());
+    glm::vec2 hotSpot(-image->getRenderedOffset());
+    Sizef size(imageSize);
+    if (d_customSize.d_width != 0.0f || d_customSize.d_height != 0.0f)
+    {
+        hotSpot.x *= d_customSize.d_width / imageSize.d_width;
+        hotSpot.y *= d_customSize.d_height / imageSize.d_height;
+        size = d_customSize;
+    }
+
+    d_nativeCursorActive = d_nativeProvider->setCursorImage(image, size, hotSpot);
+
+    // geometry is only needed again if the provider refuses an image
+    if (d_nativeCursorActive)
+    {
+        destroyGeometryBuffers();
+        d_cachedGeometryValid = false;
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -28,19 +28,40 @@
  ***************************************************************************/
 #include "CEGUI/DataContainer.h"
 
+#if defined(__WIN32__) || defined(_WIN32)
+#   define WIN32_LEAN_AND_MEAN
+#   include <windows.h>
+#elif !defined(__ANDROID__)
+#   include <sys/mman.h>
+#endif
+
 // Start of CEGUI namespace section
 namespace CEGUI
 {
 
 void RawDataContainer::release(void)
 {
-    if (mData)
-    {
-        delete[] mData;
+    if (!mData)
+        return;
 
-        mData = nullptr;
-        mSize = 0;
+    // borrowed data is freed by its owner
+    if (!mBorrowed)
+    {
+        if (!mMapped)
+            delete[] mData;
+#if defined(__WIN32__) || defined(_WIN32)
+        else
+            UnmapViewOfFile(mData);
+#elif !defined(__ANDROID__)
+        else
+            munmap(mData, mSize);
+#endif
     }
+
+    mData = nullptr;
+    mSize = 0;
+    mMapped = false;
+    mBorrowed = false;
 }
 
 } // End of  CEGUI namespace section
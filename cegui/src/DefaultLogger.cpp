@@ -38,9 +38,107 @@
 
 namespace CEGUI
 {
+namespace
+{
+//----------------------------------------------------------------------------//
+// localtime is not reentrant and entries are formatted by several threads.
+bool getLocalTime(std::tm& result)
+{
+    const std::time_t et = std::time(nullptr);
+#if defined(_WIN32)
+    return localtime_s(&result, &et) == 0;
+#else
+    return localtime_r(&et, &result) != nullptr;
+#endif
+}
+
+//----------------------------------------------------------------------------//
+bool formatEntry(std::ostream& out, const String& message, LoggingLevel level)
+{
+    using namespace std;
+
+    tm etm;
+    if (!getLocalTime(etm))
+        return false;
+
+    // write date
+    out << setfill('0') << setw(2) << etm.tm_mday << '/' <<
+    setfill('0') << setw(2) << 1 + etm.tm_mon << '/' <<
+    setw(4) << (1900 + etm.tm_year) << ' ';
+
+    // write time
+    out << setfill('0') << setw(2) << etm.tm_hour << ':' <<
+    setfill('0') << setw(2) << etm.tm_min << ':' <<
+    setfill('0') << setw(2) << etm.tm_sec << ' ';
+
+    // write event type code
+    switch(level)
+    {
+    case LoggingLevel::Error:
+        out << "(Error)\t";
+        break;
+
+    case LoggingLevel::Warning:
+        out << "(Warn)\t";
+        break;
+
+    case LoggingLevel::Standard:
+        out << "(Std) \t";
+        break;
+
+    case LoggingLevel::Informative:
+        out << "(Info) \t";
+        break;
+
+    case LoggingLevel::Insane:
+        out << "(Insan)\t";
+        break;
+
+    default:
+        out << "(Unkwn)\t";
+        break;
+    }
+
+    out << message << '\n';
+    return true;
+}
+
+#ifdef __ANDROID__
+//----------------------------------------------------------------------------//
+void writeToLogcat(const std::string& text, LoggingLevel level)
+{
+    int priority(ANDROID_LOG_UNKNOWN);
+    switch (level)
+    {
+    case LoggingLevel::Error:
+        priority = ANDROID_LOG_ERROR;
+        break;
+    case LoggingLevel::Warning:
+        priority = ANDROID_LOG_WARN;
+        break;
+    case LoggingLevel::Standard:
+        priority = ANDROID_LOG_INFO;
+        break;
+    case LoggingLevel::Informative:
+        priority = ANDROID_LOG_DEBUG;
+        break;
+    case LoggingLevel::Insane:
+    default:
+        priority = ANDROID_LOG_VERBOSE;
+        break;
+    }
+    __android_log_write(priority, "CEGUI_log", text.c_str());
+}
+#endif
+
+}
+
 //----------------------------------------------------------------------------//
 DefaultLogger::DefaultLogger(void) 
-   : d_caching(true)
+   : d_caching(true),
+     d_asynchronous(false),
+     d_queueHead(nullptr),
+     d_stopWriterRequested(false)
 {
     // create log header
     DefaultLogger::logEvent("+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+");
@@ -56,6 +154,8 @@ DefaultLogger::DefaultLogger(void)
 //----------------------------------------------------------------------------//
 DefaultLogger::~DefaultLogger(void)
 {
+    setAsynchronous(false);
+
     if (d_ostream.is_open())
     {
         String addressStr = SharedStringstream::GetPointerAddressAsString(this);
@@ -69,152 +169,222 @@ DefaultLogger::~DefaultLogger(void)
 void DefaultLogger::logEvent(const String& message,
                              LoggingLevel level)
 {
-    using namespace std;
+    // cached entries are filtered when the log file gets set
+    const bool caching = d_caching;
+    if (!caching && !isLoggable(level))
+        return;
 
-    time_t et;
-    time(&et);
-    tm* etm = localtime(&et);
+    if (!caching && d_asynchronous)
+    {
+        static thread_local std::ostringstream entryStream;
+        entryStream.str("");
+        if (!formatEntry(entryStream, message, level))
+            return;
+
+        // the entry may be written and deleted as soon as it is pushed
+        QueuedEntry* const entry = new QueuedEntry{ nullptr, entryStream.str(), level };
+        QueuedEntry* head = d_queueHead.load(std::memory_order_relaxed);
+        do
+        {
+            entry->d_next = head;
+        } while (!d_queueHead.compare_exchange_weak(head, entry,
+                                                    std::memory_order_release,
+                                                    std::memory_order_relaxed));
 
-    if (!etm)
+        // the writer only sleeps while the queue is empty
+        if (!head)
+        {
+            { std::lock_guard<std::mutex> lock(d_writerMutex); }
+            d_writerCondition.notify_one();
+        }
         return;
+    }
+
+    std::lock_guard<std::mutex> lock(d_logMutex);
+
+    // keep the order of entries queued before the mode was switched off
+    writeQueuedEntries();
 
     // clear sting stream
     d_workstream.str("");
+    if (!formatEntry(d_workstream, message, level))
+        return;
 
-    // write date
-    d_workstream << setfill('0') << setw(2) << etm->tm_mday << '/' <<
-    setfill('0') << setw(2) << 1 + etm->tm_mon << '/' <<
-    setw(4) << (1900 + etm->tm_year) << ' ';
+    if (d_caching)
+    {
+        d_cache.push_back(std::make_pair(String(d_workstream.str().c_str()), level));
+#ifdef __ANDROID__
+        if (isLoggable(level))
+            writeToLogcat(d_workstream.str(), level);
+#endif
+    }
+    else if (isLoggable(level))
+    {
+        writeEntry(d_workstream.str(), level);
+        // ensure new event is written to the file, rather than just being
+        // buffered.
+        d_ostream.flush();
+    }
+}
 
-    // write time
-    d_workstream << setfill('0') << setw(2) << etm->tm_hour << ':' <<
-    setfill('0') << setw(2) << etm->tm_min << ':' <<
-    setfill('0') << setw(2) << etm->tm_sec << ' ';
+//----------------------------------------------------------------------------//
+void DefaultLogger::writeEntry(const std::string& text, LoggingLevel level)
+{
+    d_ostream << text;
+#ifdef __ANDROID__
+    writeToLogcat(text, level);
+#else
+    (void)level;
+#endif
+}
 
-    // write event type code
-    switch(level)
+//----------------------------------------------------------------------------//
+void DefaultLogger::writeQueuedEntries()
+{
+    QueuedEntry* entry = d_queueHead.exchange(nullptr, std::memory_order_acquire);
+    if (!entry)
+        return;
+
+    // the queue is a stack, reverse it to write the entries in logging order
+    QueuedEntry* ordered = nullptr;
+    while (entry)
     {
-    case LoggingLevel::Error:
-        d_workstream << "(Error)\t";
-        break;
+        QueuedEntry* const next = entry->d_next;
+        entry->d_next = ordered;
+        ordered = entry;
+        entry = next;
+    }
 
-    case LoggingLevel::Warning:
-        d_workstream << "(Warn)\t";
-        break;
+    while (ordered)
+    {
+        QueuedEntry* const next = ordered->d_next;
+        writeEntry(ordered->d_text, ordered->d_level);
+        delete ordered;
+        ordered = next;
+    }
 
-    case LoggingLevel::Standard:
-        d_workstream << "(Std) \t";
-        break;
+    d_ostream.flush();
+}
 
-    case LoggingLevel::Informative:
-        d_workstream << "(Info) \t";
-        break;
+//----------------------------------------------------------------------------//
+void DefaultLogger::runWriter()
+{
+    std::unique_lock<std::mutex> lock(d_writerMutex);
+    while (true)
+    {
+        d_writerCondition.wait(lock, [this]
+        {
+            return d_stopWriterRequested ||
+                d_queueHead.load(std::memory_order_relaxed) != nullptr;
+        });
 
-    case LoggingLevel::Insane:
-        d_workstream << "(Insan)\t";
-        break;
+        if (d_stopWriterRequested)
+            return;
 
-    default:
-        d_workstream << "(Unkwn)\t";
-        break;
+        // let producers notify while the batch is being written
+        lock.unlock();
+        {
+            std::lock_guard<std::mutex> logLock(d_logMutex);
+            writeQueuedEntries();
+        }
+        lock.lock();
     }
+}
 
-    d_workstream << message << endl;
+//----------------------------------------------------------------------------//
+void DefaultLogger::stopWriter()
+{
+    if (!d_writerThread.joinable())
+        return;
 
-    if (d_caching)
     {
-        d_cache.push_back(std::make_pair(String(d_workstream.str().c_str()), level));
+        std::lock_guard<std::mutex> lock(d_writerMutex);
+        d_stopWriterRequested = true;
     }
-    if (d_level >= level)
+    d_writerCondition.notify_one();
+    d_writerThread.join();
+
+    std::lock_guard<std::mutex> logLock(d_logMutex);
+    writeQueuedEntries();
+}
+
+//----------------------------------------------------------------------------//
+void DefaultLogger::setAsynchronous(bool enabled)
+{
+    if (enabled == d_asynchronous)
+        return;
+
+    if (enabled)
     {
-        if (!d_caching)
-        {
-            // write message
-            d_ostream << d_workstream.str();
-            // ensure new event is written to the file, rather than just being
-            // buffered.
-            d_ostream.flush();
-        }
-        #ifdef __ANDROID__
-            int priority(ANDROID_LOG_UNKNOWN);
-            switch (level)
-            {
-            case LoggingLevel::Error:
-                priority = ANDROID_LOG_ERROR;
-                break;
-            case LoggingLevel::Warning:
-                priority = ANDROID_LOG_WARN;
-                break;
-            case LoggingLevel::Standard:
-                priority = ANDROID_LOG_INFO;
-                break;
-            case LoggingLevel::Informative:
-                priority = ANDROID_LOG_DEBUG;
-                break;
-            case LoggingLevel::Insane:
-            default:
-                priority = ANDROID_LOG_VERBOSE;
-                break;
-            }
-            __android_log_write(priority, "CEGUI_log", d_workstream.str().c_str());
-        #endif
+        d_stopWriterRequested = false;
+        d_writerThread = std::thread(&DefaultLogger::runWriter, this);
+        d_asynchronous = true;
+    }
+    else
+    {
+        d_asynchronous = false;
+        stopWriter();
     }
 }
 
 //----------------------------------------------------------------------------//
 void DefaultLogger::setLogFilename(const String& filename, bool append)
 {
-    // close current log file (if any)
-    if (d_ostream.is_open())
-        d_ostream.close();
+    {
+        std::lock_guard<std::mutex> lock(d_logMutex);
 
+        // close current log file (if any), queued entries still belong to it
+        if (d_ostream.is_open())
+        {
+            writeQueuedEntries();
+            d_ostream.close();
+        }
 
 #   if defined(_MSC_VER)
-    d_ostream.open(System::getStringTranscoder().stringToStdWString(filename).c_str(),
-                   std::ios_base::out |
-                   (append ? std::ios_base::app : std::ios_base::trunc));
+        d_ostream.open(System::getStringTranscoder().stringToStdWString(filename).c_str(),
+                       std::ios_base::out |
+                       (append ? std::ios_base::app : std::ios_base::trunc));
 #   else
 #       if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
-    d_ostream.open(String::convertUtf32ToUtf8(filename.getString()).c_str(),
-                   std::ios_base::out |
-                   (append ? std::ios_base::app : std::ios_base::trunc));
+        d_ostream.open(String::convertUtf32ToUtf8(filename.getString()).c_str(),
+                       std::ios_base::out |
+                       (append ? std::ios_base::app : std::ios_base::trunc));
 #       else
-    d_ostream.open(filename.c_str(),
-                   std::ios_base::out | 
-                   (append ? std::ios_base::app : std::ios_base::trunc));
+        d_ostream.open(filename.c_str(),
+                       std::ios_base::out | 
+                       (append ? std::ios_base::app : std::ios_base::trunc));
 #       endif
 #   endif
 
-    if (!d_ostream)
-        throw FileIOException(
-            "Failed to open file '" + filename + "' for writing");
-
-    // initialise width for date & time alignment.
-    d_ostream.width(2);
+        if (d_ostream)
+        {
+            // initialise width for date & time alignment.
+            d_ostream.width(2);
 
-    // write out cached log strings.
-    if (d_caching)
-    {
-        d_caching = false;
+            // write out cached log strings.
+            if (d_caching)
+            {
+                d_caching = false;
 
-        Cache::iterator iter = d_cache.begin();
+                for (const CacheItem& item : d_cache)
+                {
+                    if (isLoggable(item.second))
+                        d_ostream << item.first;
+                }
 
-        while (iter != d_cache.end())
-        {
-            if (d_level >= (*iter).second)
-            {
-                // write message
-                d_ostream << (*iter).first;
-                // ensure new event is written to the file, rather than just
-                // being buffered.
+                // ensure the cached events are written to the file, rather
+                // than just being buffered.
                 d_ostream.flush();
+                d_cache.clear();
             }
 
-            ++iter;
+            return;
         }
-
-        d_cache.clear();
     }
+
+    // thrown without holding d_logMutex, the exception logs itself
+    throw FileIOException(
+        "Failed to open file '" + filename + "' for writing");
 }
 
 //----------------------------------------------------------------------------//
@@ -31,19 +31,115 @@
 #if defined(__WIN32__) || defined(_WIN32)
 #   include "CEGUI/System.h"
 #   include <io.h>
+#   include <sys/types.h>
+#   include <sys/stat.h>
+#   define WIN32_LEAN_AND_MEAN
+#   include <windows.h>
 #elif defined(__ANDROID__)
 #   include "CEGUI/AndroidUtils.h" 
 #   include <android/asset_manager.h>
 #else
 #   include <sys/types.h>
 #   include <sys/stat.h>
+#   include <sys/mman.h>
+#   include <fcntl.h>
+#   include <unistd.h>
 #   include <dirent.h>
 #   include <fnmatch.h>
 #endif
+#include <cstdint>
+#include <cstdio>
+#include <vector>
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+const size_t DefaultResourceProvider::DefaultMemoryMappingThreshold = 64 * 1024;
+const size_t DefaultResourceProvider::DefaultReadChunkSize = 64 * 1024;
+
+//----------------------------------------------------------------------------//
+bool DefaultResourceProvider::mapFile(const String& filename, size_t minSize,
+                                      RawDataContainer& output)
+{
+#if defined(__ANDROID__)
+    return false;
+#else
+#   if defined(__WIN32__) || defined(_WIN32)
+    const HANDLE file = CreateFileW(
+        System::getStringTranscoder().stringToStdWString(filename).c_str(),
+        GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    void* view = nullptr;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0 &&
+        static_cast<unsigned long long>(fileSize.QuadPart) >= minSize &&
+        static_cast<unsigned long long>(fileSize.QuadPart) <= SIZE_MAX)
+    {
+        // the view keeps the mapping alive once its handle is closed
+        const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (mapping)
+        {
+            view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+
+    if (!view)
+        return false;
+
+    output.setMappedData(static_cast<std::uint8_t*>(view),
+                         static_cast<size_t>(fileSize.QuadPart));
+#   else
+#       if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+    const int file = open(String::convertUtf32ToUtf8(filename.getString()).c_str(), O_RDONLY);
+#       else
+    const int file = open(filename.c_str(), O_RDONLY);
+#       endif
+
+    if (file == -1)
+        return false;
+
+    struct stat info;
+    void* view = MAP_FAILED;
+    if (fstat(file, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0 &&
+        static_cast<std::uint64_t>(info.st_size) >= minSize)
+    {
+        view = mmap(nullptr, static_cast<size_t>(info.st_size),
+                    PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+    }
+    close(file);
+
+    if (view == MAP_FAILED)
+        return false;
+
+    output.setMappedData(static_cast<std::uint8_t*>(view),
+                         static_cast<size_t>(info.st_size));
+#   endif
+
+    return true;
+#endif
+}
+
+//----------------------------------------------------------------------------//
+DefaultResourceProvider::DefaultResourceProvider() :
+    d_memoryMappingEnabled(true),
+    d_memoryMappingThreshold(DefaultMemoryMappingThreshold),
+    d_readChunkSize(DefaultReadChunkSize)
+{
+}
+
+//----------------------------------------------------------------------------//
+DefaultResourceProvider::~DefaultResourceProvider()
+{
+    // pending loads may still be running in loadRawDataContainer
+    cancelPendingLoads();
+}
 
 //----------------------------------------------------------------------------//
 void DefaultResourceProvider::loadRawDataContainer(const String& filename,
@@ -78,6 +174,14 @@ void DefaultResourceProvider::loadRawDataContainer(const String& filename,
     const size_t size_read = AAsset_read(file, buffer, size);
     AAsset_close(file);
 #else
+    // large files are mapped rather than read, which leaves their data in the
+    // page cache instead of copying it to the heap
+    if (d_memoryMappingEnabled &&
+        mapFile(final_filename, d_memoryMappingThreshold, output))
+    {
+        return;
+    }
+
 #   if defined(__WIN32__) || defined(_WIN32)
     FILE* file = _wfopen(System::getStringTranscoder().stringToStdWString(final_filename).c_str(), L"rb");
 #   else
@@ -113,6 +217,134 @@ void DefaultResourceProvider::loadRawDataContainer(const String& filename,
     output.setSize(size);
 }
 
+//----------------------------------------------------------------------------//
+void DefaultResourceProvider::readRawDataChunks(const String& filename,
+                                                const ReadChunkCallback& callback,
+                                                const String& resourceGroup)
+{
+#ifdef __ANDROID__
+    ResourceProvider::readRawDataChunks(filename, callback, resourceGroup);
+#else
+    if (filename.empty())
+        throw InvalidRequestException(
+            "Filename supplied for data loading must be valid");
+
+    const String final_filename(getFinalFilename(filename, resourceGroup));
+
+#   if defined(__WIN32__) || defined(_WIN32)
+    FILE* file = _wfopen(System::getStringTranscoder().stringToStdWString(final_filename).c_str(), L"rb");
+#   else
+#       if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+        FILE* file = fopen(String::convertUtf32ToUtf8(final_filename.getString()).c_str(), "rb");
+#       else
+        FILE* file = fopen(final_filename.c_str(), "rb");
+#       endif
+#   endif
+
+    if (file == nullptr)
+        throw FileIOException(final_filename + " does not exist");
+
+    // the same buffer is passed for every chunk, so the memory needed does
+    // not depend on the size of the file
+    std::vector<std::uint8_t> buffer(d_readChunkSize);
+
+    try
+    {
+        size_t size_read;
+        while ((size_read = fread(buffer.data(), 1, buffer.size(), file)) != 0)
+            callback(buffer.data(), size_read);
+
+        if (ferror(file))
+            throw FileIOException(
+                "A problem occurred while reading file: " + final_filename);
+    }
+    catch (...)
+    {
+        fclose(file);
+        throw;
+    }
+
+    fclose(file);
+#endif
+}
+
+//----------------------------------------------------------------------------//
+bool DefaultResourceProvider::isResourceAvailable(const String& filename,
+                                                  const String& resourceGroup)
+{
+    if (filename.empty())
+        return false;
+
+    const String final_filename(getFinalFilename(filename, resourceGroup));
+
+#ifdef __ANDROID__
+    struct android_app* app = AndroidUtils::getAndroidApp();
+    if (!app || !app->activity->assetManager)
+        return false;
+#if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_32) 
+    AAsset *file = AAssetManager_open(app->activity->assetManager, final_filename.c_str(), AASSET_MODE_UNKNOWN);
+#else
+    AAsset *file = AAssetManager_open(app->activity->assetManager, String::convertUtf32ToUtf8(final_filename.getString()).c_str(), AASSET_MODE_UNKNOWN);
+#endif
+
+    if (file == 0)
+        return false;
+
+    AAsset_close(file);
+#else
+#   if defined(__WIN32__) || defined(_WIN32)
+    FILE* file = _wfopen(System::getStringTranscoder().stringToStdWString(final_filename).c_str(), L"rb");
+#   else
+#       if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+        FILE* file = fopen(String::convertUtf32ToUtf8(final_filename.getString()).c_str(), "rb");
+#       else
+        FILE* file = fopen(final_filename.c_str(), "rb");
+#       endif
+#   endif
+
+    if (file == nullptr)
+        return false;
+
+    fclose(file);
+#endif
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+std::uint64_t DefaultResourceProvider::getResourceVersion(const String& filename,
+                                                          const String& resourceGroup)
+{
+    if (filename.empty())
+        return 0;
+
+#if defined(__ANDROID__)
+    // assets are part of the package and never change
+    CEGUI_UNUSED(resourceGroup);
+    return 0;
+#else
+    const String final_filename(getFinalFilename(filename, resourceGroup));
+
+#   if defined(__WIN32__) || defined(_WIN32)
+    struct _stat64 info;
+    if (_wstat64(System::getStringTranscoder().stringToStdWString(final_filename).c_str(), &info) != 0)
+        return 0;
+#   else
+    struct stat info;
+#       if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+    if (stat(String::convertUtf32ToUtf8(final_filename.getString()).c_str(), &info) != 0)
+#       else
+    if (stat(final_filename.c_str(), &info) != 0)
+#       endif
+        return 0;
+#   endif
+
+    // the size catches most changes saved within the same second
+    return (static_cast<std::uint64_t>(info.st_mtime) << 24) ^
+           static_cast<std::uint64_t>(info.st_size);
+#endif
+}
+
 //----------------------------------------------------------------------------//
 void DefaultResourceProvider::unloadRawDataContainer(RawDataContainer& data)
 {
@@ -242,30 +474,33 @@ size_t DefaultResourceProvider::getResourceGroupFileNames(
 #else
     DIR* dirp;
 
+    // Encode the directory and the pattern once, rather than for every entry
 #if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
-    dirp = opendir(String::convertUtf32ToUtf8(dir_name.getString()).c_str());
+    const std::string dir_name_utf8(String::convertUtf32ToUtf8(dir_name.getString()));
+    const std::string file_pattern_utf8(String::convertUtf32ToUtf8(file_pattern.getString()));
 #else
-    dirp = opendir(dir_name.c_str());
+    const std::string dir_name_utf8(dir_name.c_str());
+    const std::string file_pattern_utf8(file_pattern.c_str());
 #endif
 
+    dirp = opendir(dir_name_utf8.c_str());
+
     if (dirp)
     {
         struct dirent* dp;
+        std::string filename(dir_name_utf8);
 
         while ((dp = readdir(dirp)))
         {
-            const String filename(dir_name + dp->d_name);
+            // Check the pattern first, it is much cheaper than a stat call
+            if (fnmatch(file_pattern_utf8.c_str(), dp->d_name, 0) != 0)
+                continue;
+
+            filename.resize(dir_name_utf8.size());
+            filename += dp->d_name;
             struct stat s;
 
-#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
-            if ((stat(String::convertUtf32ToUtf8(filename.getString()).c_str(), &s) == 0) &&
-                    S_ISREG(s.st_mode) &&
-                    (fnmatch(String::convertUtf32ToUtf8(file_pattern.getString()).c_str(), dp->d_name, 0) == 0))
-#else
-            if ((stat(filename.c_str(), &s) == 0) &&
-                    S_ISREG(s.st_mode) &&
-                    (fnmatch(file_pattern.c_str(), dp->d_name, 0) == 0))
-#endif
+            if ((stat(filename.c_str(), &s) == 0) && S_ISREG(s.st_mode))
             {
                 out_vec.push_back(dp->d_name);
                 ++entries;
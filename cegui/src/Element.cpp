@@ -100,6 +100,56 @@ void Element::setArea(const UVector2& pos, const USize& size, bool adjust_size_t
 //----------------------------------------------------------------------------//
 void Element::notifyScreenAreaChanged(bool adjust_size_to_content, bool forceLayoutChildren)
 {
+    if (isScreenAreaChangeDeferred())
+        markScreenAreaChangePending(adjust_size_to_content, forceLayoutChildren);
+    else
+        notifyScreenAreaChanged_impl(adjust_size_to_content, forceLayoutChildren);
+}
+
+//----------------------------------------------------------------------------//
+void Element::markScreenAreaChangePending(bool adjust_size_to_content, bool forceLayoutChildren)
+{
+    d_screenAreaChangePending = true;
+    d_pendingAdjustSizeToContent |= adjust_size_to_content;
+    d_pendingForceLayoutChildren |= forceLayoutChildren;
+
+    // Ancestors that are already marked have marked their own ancestors too
+    for (Element* ancestor = d_parent;
+         ancestor && !ancestor->d_childScreenAreaChangePending;
+         ancestor = ancestor->d_parent)
+    {
+        ancestor->d_childScreenAreaChangePending = true;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void Element::updatePendingScreenAreaChanges()
+{
+    if (d_screenAreaChangePending)
+        notifyScreenAreaChanged_impl(d_pendingAdjustSizeToContent, d_pendingForceLayoutChildren);
+
+    if (!d_childScreenAreaChangePending)
+        return;
+
+    d_childScreenAreaChangePending = false;
+
+    // NB: event handlers may add or remove children, so no iterators here
+    for (size_t i = 0; i < d_children.size(); ++i)
+    {
+        Element* const child = d_children[i];
+        if (child->d_screenAreaChangePending || child->d_childScreenAreaChangePending)
+            child->updatePendingScreenAreaChanges();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void Element::notifyScreenAreaChanged_impl(bool adjust_size_to_content, bool forceLayoutChildren)
+{
+    // Any deferred change is covered by this recomputation
+    d_screenAreaChangePending = false;
+    d_pendingAdjustSizeToContent = false;
+    d_pendingForceLayoutChildren = false;
+
     // Update pixel size and detect resizing
     const Sizef oldSize = d_pixelSize;
     d_pixelSize = calculatePixelSize();
@@ -1009,13 +1059,13 @@ Rectf Element::getUnclippedInnerRect_impl(bool skipAllPixelAlignment) const
 //----------------------------------------------------------------------------//
 void Element::onSized(ElementEventArgs& e)
 {
-    fireEvent(EventSized, e, EventNamespace);
+    fireCoalescedEvent(EventSized, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Element::onMoved(ElementEventArgs& e)
 {
-    fireEvent(EventMoved, e, EventNamespace);
+    fireCoalescedEvent(EventMoved, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1037,7 +1087,7 @@ void Element::onVerticalAlignmentChanged(ElementEventArgs& e)
 //----------------------------------------------------------------------------//
 void Element::onRotated(ElementEventArgs& e)
 {
-    fireEvent(EventRotated, e, EventNamespace);
+    fireCoalescedEvent(EventRotated, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -28,6 +28,7 @@
 #include "CEGUI/EventArgs.h"
 
 #include <algorithm>
+#include <memory>
 
 namespace CEGUI
 {
@@ -41,13 +42,20 @@ Event::Event(const String& name) :
 //----------------------------------------------------------------------------//
 Event::~Event()
 {
-    for (std::pair<const Group, Connection>& groupAndSlot : d_slots)
+    for (SlotList* slots : { &d_slots, &d_pendingSlots })
     {
-        groupAndSlot.second->d_event = nullptr;
-        groupAndSlot.second->d_subscriber->cleanup();
+        for (std::pair<Group, Connection>& groupAndSlot : *slots)
+        {
+            if (!groupAndSlot.second)
+                continue;
+
+            groupAndSlot.second->d_event = nullptr;
+            groupAndSlot.second->d_subscriber.cleanup();
+        }
     }
 
     d_slots.clear();
+    d_pendingSlots.clear();
 }
 
 //----------------------------------------------------------------------------//
@@ -60,55 +68,98 @@ Event::Connection Event::subscribe(const Event::Subscriber& slot)
 Event::Connection Event::subscribe(Event::Group group,
                                    const Event::Subscriber& slot)
 {
-    Event::Connection c(new BoundSlot(group, slot, *this));
-    d_slots.insert(std::pair<Group, Connection>(group, c));
+    // the BoundSlot and the reference count share a single pooled block
+    Event::Connection c(std::allocate_shared<BoundSlot>(
+        PoolAllocatorAdapter<BoundSlot, MemoryCategory::Event>(), group, slot, *this));
+
+    // Inserting into d_slots would shift the slots being invoked
+    if (d_invocationDepth)
+    {
+        d_pendingSlots.emplace_back(group, c);
+        return c;
+    }
+
+    const SlotList::iterator pos = std::upper_bound(d_slots.begin(), d_slots.end(), group,
+        [](Group g, const std::pair<Group, Connection>& groupAndSlot) { return g < groupAndSlot.first; });
+    d_slots.emplace(pos, group, c);
     return c;
 }
 
 //----------------------------------------------------------------------------//
 void Event::operator()(EventArgs& args)
 {
-    d_isBeingInvoked = true;
+    if (d_slots.empty())
+        return;
+
+    // Restores the invocation depth also when a handler throws
+    struct InvocationScope
+    {
+        InvocationScope(Event& event) : d_event(event) { ++d_event.d_invocationDepth; }
+        ~InvocationScope() { if (--d_event.d_invocationDepth == 0) d_event.updateSlots(); }
+        Event& d_event;
+    } scope(*this);
 
     // Execute all subscribers, updating the 'handled' state as we go.
-    // Erase unsubscribed slots.
-    const auto itLast = d_slots.cend();
-    for (auto it = d_slots.begin(); it != itLast; )
+    // The slots don't move while we are invoking, disconnected ones are only
+    // nulled, so indices stay valid even if handlers fire this event again.
+    for (std::size_t i = 0; i < d_slots.size(); ++i)
     {
         // Hold a strong reference to prevent self-destruction
-        Connection curr = it->second;
+        Connection curr = d_slots[i].second;
 
         // Call the handler
-        if (curr && (*curr->d_subscriber)(args))
+        if (curr && curr->d_subscriber(args))
             ++args.handled;
-
-        // Erase if unsubscribed
-        if (!it->second)
-            it = d_slots.erase(it);
-        else
-            ++it;
     }
-
-    d_isBeingInvoked = false;
 }
 
 //----------------------------------------------------------------------------//
 void Event::unsubscribe(const BoundSlot& slot)
 {
-    // Try to find the slot in our collection
-    auto it = std::find_if(d_slots.begin(), d_slots.end(), [&slot](const std::pair<const Group, Connection>& groupAndSlot)
+    const auto isSlot = [&slot](const std::pair<Group, Connection>& groupAndSlot)
     {
-        return (*groupAndSlot.second) == slot;
-    });
+        return groupAndSlot.second && *groupAndSlot.second == slot;
+    };
 
     // Erase our reference to the slot, if we had one.
     // Delay erasing if we are in the middle of the invocation loop.
+    SlotList::iterator it = std::find_if(d_slots.begin(), d_slots.end(), isSlot);
     if (it != d_slots.end())
     {
-        if (d_isBeingInvoked)
+        if (d_invocationDepth)
+        {
             it->second = nullptr;
+            d_hasDisconnectedSlots = true;
+        }
         else
             d_slots.erase(it);
+
+        return;
+    }
+
+    it = std::find_if(d_pendingSlots.begin(), d_pendingSlots.end(), isSlot);
+    if (it != d_pendingSlots.end())
+        d_pendingSlots.erase(it);
+}
+
+//----------------------------------------------------------------------------//
+void Event::updateSlots()
+{
+    if (d_hasDisconnectedSlots)
+    {
+        d_slots.erase(std::remove_if(d_slots.begin(), d_slots.end(),
+            [](const std::pair<Group, Connection>& groupAndSlot) { return !groupAndSlot.second; }),
+            d_slots.end());
+        d_hasDisconnectedSlots = false;
+    }
+
+    SlotList pendingSlots;
+    pendingSlots.swap(d_pendingSlots);
+    for (std::pair<Group, Connection>& groupAndSlot : pendingSlots)
+    {
+        const SlotList::iterator pos = std::upper_bound(d_slots.begin(), d_slots.end(), groupAndSlot.first,
+            [](Group g, const std::pair<Group, Connection>& other) { return g < other.first; });
+        d_slots.insert(pos, std::move(groupAndSlot));
     }
 }
 
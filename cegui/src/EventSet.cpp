@@ -29,26 +29,154 @@
 #include "CEGUI/EventSet.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/GlobalEventSet.h"
+#include "CEGUI/Logger.h"
 #include "CEGUI/ScriptModule.h"
 #include "CEGUI/System.h"
 
+#include <map>
+#include <memory>
+#include <vector>
+
 namespace CEGUI
 {
+namespace
+{
+//! Event queued by fireCoalescedEvent while a BatchScope is active.
+struct QueuedEvent
+{
+    //! EventSet to fire the event on, nullptr once that EventSet is destroyed.
+    EventSet* d_sender;
+    String d_name;
+    String d_eventNamespace;
+    std::unique_ptr<EventArgs> d_args;
+};
+
+//! State shared by all BatchScopes of a thread.
+struct EventBatch
+{
+    //! Number of BatchScopes currently alive.
+    unsigned int d_depth = 0;
+    //! Whether d_queue is currently being fired.
+    bool d_flushing = false;
+    //! Queued events in the order they were first fired.
+    std::vector<QueuedEvent> d_queue;
+    //! Position in d_queue of the event queued for a sender and event name.
+    std::map<std::pair<const EventSet*, String>, size_t> d_positions;
+};
+
+// Each thread batches on its own, so that a layout loaded on another thread
+// neither queues into nor flushes the batch of the main thread.
+EventBatch& getEventBatch()
+{
+    static thread_local EventBatch batch;
+    return batch;
+}
+
+//----------------------------------------------------------------------------//
+void flushEventBatch(EventBatch& batch)
+{
+    batch.d_flushing = true;
+
+    // Subscribers fire immediately during the flush, so the queue can not
+    // grow while we walk it.
+    for (QueuedEvent& queued : batch.d_queue)
+    {
+        if (!queued.d_sender)
+            continue;
+
+        try
+        {
+            queued.d_sender->fireEvent(queued.d_name, *queued.d_args,
+                                       queued.d_eventNamespace);
+        }
+        catch (const std::exception& e)
+        {
+            // there is no caller to report to, the scope is being destroyed
+            if (Logger* logger = Logger::getSingletonPtr())
+                logger->logEvent("EventSet::BatchScope - "
+                    "exception while firing deferred event '" + queued.d_name +
+                    "': " + e.what(), LoggingLevel::Error);
+        }
+    }
+
+    batch.d_queue.clear();
+    batch.d_positions.clear();
+    batch.d_flushing = false;
+}
+
+}
+
+//----------------------------------------------------------------------------//
+EventSet::BatchScope::BatchScope()
+{
+    ++getEventBatch().d_depth;
+}
+
+//----------------------------------------------------------------------------//
+EventSet::BatchScope::~BatchScope()
+{
+    EventBatch& batch = getEventBatch();
+    if (--batch.d_depth == 0 && !batch.d_flushing && !batch.d_queue.empty())
+        flushEventBatch(batch);
+}
+
+//----------------------------------------------------------------------------//
+bool EventSet::isBatching()
+{
+    const EventBatch& batch = getEventBatch();
+    return batch.d_depth != 0 && !batch.d_flushing;
+}
+
+//----------------------------------------------------------------------------//
+EventSet::~EventSet()
+{
+    EventBatch& batch = getEventBatch();
+    if (!batch.d_positions.empty())
+    {
+        auto it = batch.d_positions.lower_bound(std::make_pair(this, String()));
+        while (it != batch.d_positions.end() && it->first.first == this)
+        {
+            batch.d_queue[it->second].d_sender = nullptr;
+            it = batch.d_positions.erase(it);
+        }
+    }
+
+    removeAllEvents();
+}
+
+//----------------------------------------------------------------------------//
+void EventSet::queueCoalescedEvent(const String& name, EventArgs* args,
+                                   const String& eventNamespace)
+{
+    std::unique_ptr<EventArgs> queued_args(args);
+    EventBatch& batch = getEventBatch();
+
+    const auto inserted = batch.d_positions.emplace(
+        std::make_pair(static_cast<const EventSet*>(this), name),
+        batch.d_queue.size());
+
+    if (inserted.second)
+        batch.d_queue.push_back({ this, name, eventNamespace, std::move(queued_args) });
+    else
+        batch.d_queue[inserted.first->second].d_args = std::move(queued_args);
+}
 
 //----------------------------------------------------------------------------//
 void EventSet::addEvent(const String& name)
 {
-    if (isEventPresent(name))
+    const InternedName key(name);
+    if (isEventPresent(key))
         throw AlreadyExistsException(
             "An event named '" + name + "' already exists in the EventSet.");
 
-    d_events.emplace(name, new Event(name));
+    notifyEventAdded(*d_events.emplace(key, new Event(name)).first->second);
 }
 
 //----------------------------------------------------------------------------//
 void EventSet::addEvent(Event& event)
 {
-    if (isEventPresent(event.getName()))
+    const InternedName key(event.getName());
+    if (isEventPresent(key))
     {
         delete &event;
 
@@ -56,7 +184,8 @@ void EventSet::addEvent(Event& event)
             "An event named '" + event.getName() + "' already exists in the EventSet.");
     }
 
-    d_events.emplace(event.getName(), &event);
+    d_events.emplace(key, &event);
+    notifyEventAdded(event);
 }
 
 //----------------------------------------------------------------------------//
@@ -110,18 +239,47 @@ void EventSet::fireEvent(const String& name,
     fireEvent_impl(name, args);
 }
 
+//----------------------------------------------------------------------------//
+void EventSet::fireEvent(const InternedName& name,
+                         EventArgs& args,
+                         const String& eventNamespace)
+{
+    if (GlobalEventSet* ges = GlobalEventSet::getSingletonPtr())
+        ges->fireEvent(name.getString(), args, eventNamespace);
+
+    fireEvent_impl(name, args);
+}
+
 //----------------------------------------------------------------------------//
 Event* EventSet::getEventObject(const String& name, bool autoAdd)
+{
+    return getEventObject(autoAdd ? InternedName(name) : InternedName::find(name), autoAdd);
+}
+
+//----------------------------------------------------------------------------//
+Event* EventSet::getEventObject(const InternedName& name, bool autoAdd)
 {
     auto it = d_events.find(name);
     if (it != d_events.end())
         return it->second.get();
 
-    return autoAdd ? d_events.emplace(name, new Event(name)).first->second.get() : nullptr;
+    if (!autoAdd || !name.isInterned())
+        return nullptr;
+
+    Event* event = d_events.emplace(name, new Event(name.getString())).first->second.get();
+    notifyEventAdded(*event);
+    return event;
 }
 
 //----------------------------------------------------------------------------//
 void EventSet::fireEvent_impl(const String& name, EventArgs& args)
+{
+    if (!d_muted)
+        fireEvent_impl(InternedName::find(name), args);
+}
+
+//----------------------------------------------------------------------------//
+void EventSet::fireEvent_impl(const InternedName& name, EventArgs& args)
 {
     if (!d_muted)
         if (Event* ev = getEventObject(name))
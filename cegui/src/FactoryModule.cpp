@@ -86,6 +86,17 @@ unsigned int FactoryModule::unregisterAllFactories()
     return static_cast<unsigned int>(d_registry.size());
 }
 
+//----------------------------------------------------------------------------//
+bool FactoryModule::isFactoryAvailable(const String& type_name) const
+{
+    FactoryRegistry::const_iterator i = d_registry.begin();
+    for ( ; i != d_registry.end(); ++i)
+        if ((*i)->d_type == type_name)
+            return true;
+
+    return false;
+}
+
 //----------------------------------------------------------------------------//
 #if defined(CEGUI_STATIC) && defined(CEGUI_BUILD_STATIC_FACTORY_MODULE)
 extern "C"
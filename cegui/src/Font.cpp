@@ -33,6 +33,15 @@
 #include "CEGUI/BitmapImage.h"
 #include "CEGUI/GeometryBuffer.h"
 #include "CEGUI/InputEvent.h"
+#include "CEGUI/Logger.h"
+#include "CEGUI/SharedStringStream.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 namespace CEGUI
 {
@@ -49,6 +58,54 @@ const String Font::EventNamespace("Font");
 const String Font::EventRenderSizeChanged("RenderSizeChanged");
 const char32_t Font::UnicodeReplacementCharacter = 0xFFFD;
 
+//----------------------------------------------------------------------------//
+namespace
+{
+struct TextLayoutKey
+{
+    const Font* d_font;
+    String d_text;
+    //! Fractional part of the position, which decides the pixel rounding.
+    glm::vec2 d_subPixelPosition;
+    DefaultParagraphDirection d_direction;
+    float d_spaceExtra;
+
+    bool operator==(const TextLayoutKey& other) const
+    {
+        return d_font == other.d_font && d_text == other.d_text &&
+            d_subPixelPosition == other.d_subPixelPosition &&
+            d_direction == other.d_direction &&
+            d_spaceExtra == other.d_spaceExtra;
+    }
+};
+
+struct TextLayoutKeyHasher
+{
+    size_t operator()(const TextLayoutKey& key) const
+    {
+        size_t hash = std::hash<String>()(key.d_text);
+        hash ^= std::hash<const Font*>()(key.d_font) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<float>()(key.d_subPixelPosition.x) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+};
+
+struct TextLayout
+{
+    std::vector<Font::TextLayoutGlyph> d_glyphs;
+    //! Advance of the pen relative to the whole pixel the text is drawn at.
+    float d_advance;
+};
+
+// Layouts are shared, so that one evicted while it is being drawn stays alive
+typedef std::list<std::pair<TextLayoutKey, std::shared_ptr<const TextLayout>>> TextLayoutList;
+// Texts laid out by all fonts, the most recently used first
+TextLayoutList s_textLayouts;
+std::unordered_map<TextLayoutKey, TextLayoutList::iterator, TextLayoutKeyHasher> s_textLayoutIndex;
+// Guards the layouts, which windows generating geometry in parallel share
+std::mutex s_textLayoutMutex;
+}
+
 //----------------------------------------------------------------------------//
 Font::Font(const String& name, const String& type_name, const String& filename,
            const String& resource_group, const AutoScaledMode auto_scaled,
@@ -61,7 +118,9 @@ Font::Font(const String& name, const String& type_name, const String& filename,
     d_descender(0),
     d_height(0),
     d_autoScaled(auto_scaled),
-    d_nativeResolution(native_res)
+    d_nativeResolution(native_res),
+    d_recordedTextLayout(nullptr),
+    d_glyphQuadBatchCount(0)
 {
     addFontProperties();
 
@@ -73,6 +132,7 @@ Font::Font(const String& name, const String& type_name, const String& filename,
 //----------------------------------------------------------------------------//
 Font::~Font()
 {
+    releaseTextLayouts();
 }
 
 float Font::convertPointsToPixels(const float pointSize, const int dotsPerInch)
@@ -160,6 +220,20 @@ void Font::getGlyphExtents(
     float& cur_extent,
     float& adv_extent) const
 {
+    if (currentCodePoint < 256)
+    {
+        if (const Latin1GlyphMetrics* metrics = getLatin1GlyphMetrics(currentCodePoint))
+        {
+            if (metrics->d_available)
+            {
+                cur_extent = std::max(cur_extent, adv_extent + metrics->d_renderedAdvance);
+                adv_extent += metrics->d_advance;
+            }
+
+            return;
+        }
+    }
+
     const FontGlyph* currentGlyph = getPreparedGlyph(currentCodePoint);
 
     if (currentGlyph != nullptr)
@@ -183,24 +257,27 @@ float Font::getTextAdvance(const String& text) const
 #if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_8)
     for (size_t c = 0; c < text.length(); ++c)
     {
-        if (const FontGlyph* glyph = getPreparedGlyph(text[c]))
+        const char32_t currentCodePoint = text[c];
+#else
+    String::codepoint_iterator currentCodePointIter(text.begin(), text.begin(), text.end());
+    while (!currentCodePointIter.isAtEnd())
+    {
+        const char32_t currentCodePoint = *currentCodePointIter;
+        ++currentCodePointIter;
+#endif
+        const Latin1GlyphMetrics* metrics = (currentCodePoint < 256) ?
+            getLatin1GlyphMetrics(currentCodePoint) : nullptr;
+
+        if (metrics)
+        {
+            // Missing glyphs have an advance of zero
+            advance += metrics->d_advance;
+        }
+        else if (const FontGlyph* glyph = getPreparedGlyph(currentCodePoint))
         {
             advance += glyph->getAdvance();
         }
     }
-#else
-String::codepoint_iterator currentCodePointIter(text.begin(), text.begin(), text.end());
-while (!currentCodePointIter.isAtEnd())
-{
-    char32_t currentCodePoint = *currentCodePointIter;
-    if (const FontGlyph* glyph = getPreparedGlyph(currentCodePoint))
-    {
-        advance += glyph->getAdvance();
-    }
-
-    ++currentCodePointIter;
-}
-#endif
 
     return advance;
 }
@@ -208,7 +285,6 @@ while (!currentCodePointIter.isAtEnd())
 //----------------------------------------------------------------------------//
 size_t Font::getCharAtPixel(const String& text, size_t start_char, float pixel) const
 {
-    const FontGlyph* glyph;
     float cur_extent = 0;
     size_t char_count = text.length();
 
@@ -219,40 +295,82 @@ size_t Font::getCharAtPixel(const String& text, size_t start_char, float pixel)
 #if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_8)
     for (size_t c = start_char; c < char_count; ++c)
     {
-        glyph = getGlyphForCodepoint(text[c]);
-
-        if (glyph)
-        {
-            cur_extent += glyph->getAdvance();
-
-            if (pixel < cur_extent)
-                return c;
-        }
-    }
+        const char32_t currentCodePoint = text[c];
 #else
     String::codepoint_iterator currentCodePointIter(text.begin(), text.begin(), text.end());
     currentCodePointIter.increment(start_char);
 
-    while (!currentCodePointIter.isAtEnd())
+    for (; !currentCodePointIter.isAtEnd(); ++currentCodePointIter)
     {
-        char32_t currentCodePoint = *currentCodePointIter;
-        glyph = getGlyphForCodepoint(currentCodePoint);
+        const char32_t currentCodePoint = *currentCodePointIter;
+#endif
+        const Latin1GlyphMetrics* metrics = (currentCodePoint < 256) ?
+            getLatin1GlyphMetrics(currentCodePoint) : nullptr;
 
-        if (glyph)
+        if (metrics)
         {
-            cur_extent += glyph->getAdvance();
+            if (!metrics->d_available)
+                continue;
 
-            if (pixel < cur_extent)
-                return currentCodePointIter.getCodeUnitIndexFromStart();
+            cur_extent += metrics->d_advance;
+        }
+        else if (const FontGlyph* glyph = getGlyphForCodepoint(currentCodePoint))
+        {
+            cur_extent += glyph->getAdvance();
+        }
+        else
+        {
+            continue;
         }
 
-        ++currentCodePointIter;
-    }
+        if (pixel < cur_extent)
+        {
+#if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_8)
+            return c;
+#else
+            return currentCodePointIter.getCodeUnitIndexFromStart();
 #endif
+        }
+    }
 
     return char_count;
 }
 
+//----------------------------------------------------------------------------//
+const Font::Latin1GlyphMetrics* Font::getLatin1GlyphMetrics(char32_t codePoint) const
+{
+    Latin1GlyphMetrics& metrics = d_latin1GlyphMetrics[codePoint];
+    if (d_latin1GlyphMetricsKnown[codePoint])
+        return &metrics;
+
+    const FontGlyph* glyph = getPreparedGlyph(codePoint);
+    if (glyph == nullptr)
+    {
+        metrics.d_advance = 0.0f;
+        metrics.d_renderedAdvance = 0.0f;
+        metrics.d_available = false;
+    }
+    else
+    {
+        // The rendered advance is only final once the image is there
+        if (glyph->getImage() == nullptr)
+            return nullptr;
+
+        metrics.d_advance = glyph->getAdvance();
+        metrics.d_renderedAdvance = glyph->getRenderedAdvance();
+        metrics.d_available = true;
+    }
+
+    d_latin1GlyphMetricsKnown.set(codePoint);
+    return &metrics;
+}
+
+//----------------------------------------------------------------------------//
+void Font::invalidateLatin1GlyphMetrics() const
+{
+    d_latin1GlyphMetricsKnown.reset();
+}
+
 std::vector<GeometryBuffer*> Font::createTextRenderGeometry(
     const String& text, const glm::vec2& position,
     const Rectf* clip_rect, const bool clipping_enabled,
@@ -271,6 +389,57 @@ const FontGlyph* Font::getPreparedGlyph(char32_t currentCodePoint) const
    return getGlyphForCodepoint(currentCodePoint);
 }
 
+//----------------------------------------------------------------------------//
+void Font::prepareGlyphs(const String& charset) const
+{
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII)
+    std::u32string codePoints = String::convertUtf8ToUtf32(charset.c_str(), charset.length());
+#elif (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32)
+    std::u32string codePoints = charset.getString();
+#endif
+
+    std::sort(codePoints.begin(), codePoints.end());
+    codePoints.erase(std::unique(codePoints.begin(), codePoints.end()), codePoints.end());
+    prepareCodePoints(codePoints);
+}
+
+//----------------------------------------------------------------------------//
+void Font::prepareGlyphRange(char32_t first, char32_t last) const
+{
+    std::u32string codePoints;
+    for (char32_t codePoint = first; codePoint <= last && codePoint >= first; ++codePoint)
+    {
+        if (isCodepointAvailable(codePoint))
+            codePoints.push_back(codePoint);
+    }
+
+    prepareCodePoints(codePoints);
+}
+
+//----------------------------------------------------------------------------//
+void Font::prepareGlyphs_impl(const std::u32string& codePoints) const
+{
+    for (const char32_t codePoint : codePoints)
+        getPreparedGlyph(codePoint);
+}
+
+//----------------------------------------------------------------------------//
+void Font::prepareCodePoints(const std::u32string& codePoints) const
+{
+    const auto start = std::chrono::steady_clock::now();
+    prepareGlyphs_impl(codePoints);
+    const std::chrono::duration<double, std::milli> duration =
+        std::chrono::steady_clock::now() - start;
+
+    if (Logger* logger = Logger::getSingletonPtr())
+    {
+        std::stringstream& sstream = SharedStringstream::GetPreparedStream();
+        sstream << "Font '" << d_name << "': prepared " << codePoints.size()
+                << " glyphs in " << duration.count() << " ms";
+        logger->logEvent(sstream.str(), LoggingLevel::Informative);
+    }
+}
+
 std::vector<GeometryBuffer*> Font::layoutUsingFallbackAndCreateGlyphGeometry(
     const String& text,
     const Rectf* clip_rect, const ColourRect& colours,
@@ -339,18 +508,133 @@ std::vector<GeometryBuffer*> Font::createTextRenderGeometry(
         Rectf(), clip_rect,
         clipping_enabled, colours);
 
+    // Layouts are cached relative to the whole pixel the text starts at, so
+    // that the same text drawn elsewhere is only translated
+    const glm::vec2 origin(std::floor(position.x), std::floor(position.y));
+    TextLayoutKey key = { this, text, position - origin,
+                          defaultParagraphDir, space_extra };
+
+    // the glyph batches are per font, so a font lays out one text at a time
+    std::lock_guard<std::mutex> geometryLock(d_textGeometryMutex);
+
+    std::shared_ptr<const TextLayout> cached;
+    {
+        std::lock_guard<std::mutex> lock(s_textLayoutMutex);
+        auto found = s_textLayoutIndex.find(key);
+        if (found != s_textLayoutIndex.end())
+        {
+            s_textLayouts.splice(s_textLayouts.begin(), s_textLayouts, found->second);
+            cached = found->second->second;
+        }
+    }
+
+    if (cached)
+    {
+        const TextLayout& layout = *cached;
+
+        std::vector<GeometryBuffer*> geomBuffers;
+        for (const TextLayoutGlyph& glyph : layout.d_glyphs)
+        {
+            notifyGlyphImageUsed(*glyph.d_image);
+
+            imgRenderSettings.d_destArea = glyph.d_destArea;
+            imgRenderSettings.d_destArea.offset(origin);
+
+            addGlyphRenderGeometry(geomBuffers, glyph.d_image, imgRenderSettings,
+                clip_rect, glyph.d_textColoured ? colours : glyph.d_colours);
+        }
+        flushGlyphQuadBatches();
+
+        nextPenPosX = origin.x + layout.d_advance;
+        return geomBuffers;
+    }
+
     glm::vec2 penPosition = position;
 
-    std::vector<GeometryBuffer*> geomBuffers = layoutAndCreateGlyphRenderGeometry(
-        text, clip_rect, colours, space_extra,
-        imgRenderSettings, defaultParagraphDir, penPosition);
+    TextLayout layout;
+    d_recordedTextLayout = &layout.d_glyphs;
+
+    std::vector<GeometryBuffer*> geomBuffers;
+    try
+    {
+        geomBuffers = layoutAndCreateGlyphRenderGeometry(
+            text, clip_rect, colours, space_extra,
+            imgRenderSettings, defaultParagraphDir, penPosition);
+    }
+    catch (...)
+    {
+        d_recordedTextLayout = nullptr;
+        // drop the glyphs of the failed layout
+        for (size_t i = 0; i < d_glyphQuadBatchCount; ++i)
+        {
+            d_glyphQuadBatches[i].d_destAreas.clear();
+            d_glyphQuadBatches[i].d_texAreas.clear();
+            d_glyphQuadBatches[i].d_colours.clear();
+        }
+        d_glyphQuadBatchCount = 0;
+        throw;
+    }
 
+    d_recordedTextLayout = nullptr;
+    flushGlyphQuadBatches();
     nextPenPosX = penPosition.x;
 
+    for (TextLayoutGlyph& glyph : layout.d_glyphs)
+        glyph.d_destArea.offset(-origin);
+    layout.d_advance = penPosition.x - origin.x;
+
+    std::lock_guard<std::mutex> lock(s_textLayoutMutex);
+
+    // another thread may have laid out the same text meanwhile
+    if (s_textLayoutIndex.find(key) != s_textLayoutIndex.end())
+        return geomBuffers;
+
+    s_textLayouts.emplace_front(key, std::make_shared<const TextLayout>(std::move(layout)));
+    s_textLayoutIndex.emplace(std::move(key), s_textLayouts.begin());
+
+    while (s_textLayouts.size() > TextLayoutCacheCapacity)
+    {
+        s_textLayoutIndex.erase(s_textLayouts.back().first);
+        s_textLayouts.pop_back();
+    }
+
     // Adding a single geometry buffer containing the batched glyphs
     return geomBuffers;
 }
 
+//----------------------------------------------------------------------------//
+void Font::releaseTextLayouts() const
+{
+    std::lock_guard<std::mutex> lock(s_textLayoutMutex);
+    for (auto it = s_textLayouts.begin(); it != s_textLayouts.end(); )
+    {
+        if (it->first.d_font == this)
+        {
+            s_textLayoutIndex.erase(it->first);
+            it = s_textLayouts.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void Font::clearTextLayoutCache()
+{
+    std::lock_guard<std::mutex> lock(s_textLayoutMutex);
+    s_textLayoutIndex.clear();
+    s_textLayouts.clear();
+}
+
+//----------------------------------------------------------------------------//
+size_t Font::getTextLayoutCount()
+{
+    std::lock_guard<std::mutex> lock(s_textLayoutMutex);
+    return s_textLayouts.size();
+}
+
 //----------------------------------------------------------------------------//
 void Font::setNativeResolution(const Sizef& size)
 {
@@ -389,16 +673,26 @@ AutoScaledMode Font::getAutoScaled() const
 //----------------------------------------------------------------------------//
 void Font::notifyDisplaySizeChanged(const Sizef& size)
 {
+    const float oldHorzScaling = d_horzScaling;
+    const float oldVertScaling = d_vertScaling;
     Image::computeScalingFactors(d_autoScaled, size, d_nativeResolution,
         d_horzScaling, d_vertScaling);
 
-    if (d_autoScaled != AutoScaledMode::Disabled)
-    {
-        updateFont();
+    // e.g. a vertically scaled font is not affected by a change of width
+    if (d_autoScaled == AutoScaledMode::Disabled ||
+        (d_horzScaling == oldHorzScaling && d_vertScaling == oldVertScaling))
+        return;
 
-        FontEventArgs args(this);
-        onRenderSizeChanged(args);
-    }
+    updateFontScale();
+
+    FontEventArgs args(this);
+    onRenderSizeChanged(args);
+}
+
+//----------------------------------------------------------------------------//
+void Font::updateFontScale()
+{
+    updateFont();
 }
 
 //----------------------------------------------------------------------------//
@@ -465,31 +759,83 @@ GeometryBuffer* Font::findCombinableBuffer(const std::vector<GeometryBuffer*>& g
 
 void Font::addGlyphRenderGeometry(std::vector<GeometryBuffer*>& textGeometryBuffers,
     const Image* image, ImageRenderSettings& imgRenderSettings,
-    const Rectf* clip_rect, const ColourRect& colours) const
+    const Rectf* clip_rect, const ColourRect& colours, bool textColoured) const
 {
     // We only fully create a GeometryBuffer if no existing one
     // is found that we can combine this one with. Render order is irrelevant since
     // glyphs should never overlap
     GeometryBuffer* matchingGeomBuffer = findCombinableBuffer(textGeometryBuffers, image);
 
+    if (d_recordedTextLayout)
+    {
+        d_recordedTextLayout->push_back(
+            { image, imgRenderSettings.d_destArea, colours, textColoured });
+    }
+
     if (matchingGeomBuffer == nullptr)
     {
         imgRenderSettings.d_multiplyColours = colours;
-        std::vector<GeometryBuffer*> glyphGeomBuffer =
-            image->createRenderGeometry(imgRenderSettings);
-
-        assert(glyphGeomBuffer.size() <= 1 && "Glyphs are expected to "
-            "be built from a single GeometryBuffer (or none)");
+        const size_t firstGlyphBuffer = textGeometryBuffers.size();
+        image->appendRenderGeometry(textGeometryBuffers, imgRenderSettings);
 
-        textGeometryBuffers.insert(textGeometryBuffers.end(),
-            glyphGeomBuffer.begin(), glyphGeomBuffer.end());
+        assert(textGeometryBuffers.size() <= firstGlyphBuffer + 1 && "Glyphs are "
+            "expected to be built from a single GeometryBuffer (or none)");
+        if (textGeometryBuffers.size() > firstGlyphBuffer)
+            prepareGlyphGeometryBuffer(*textGeometryBuffers.back());
     }
     else
     {
-        // Else we add geometry to the rendering batch of the existing geometry
-        image->addToRenderGeometry(*matchingGeomBuffer, imgRenderSettings.d_destArea,
-            clip_rect, colours);
+        // Else we add the glyph to the batch of the existing geometry, which
+        // is appended once the whole text is laid out
+        GlyphQuadBatch* batch = nullptr;
+        for (size_t i = 0; i < d_glyphQuadBatchCount; ++i)
+        {
+            if (d_glyphQuadBatches[i].d_buffer == matchingGeomBuffer)
+            {
+                batch = &d_glyphQuadBatches[i];
+                break;
+            }
+        }
+
+        if (!batch)
+        {
+            if (d_glyphQuadBatchCount == d_glyphQuadBatches.size())
+                d_glyphQuadBatches.emplace_back();
+
+            batch = &d_glyphQuadBatches[d_glyphQuadBatchCount++];
+            batch->d_buffer = matchingGeomBuffer;
+            batch->d_clipArea = clip_rect;
+        }
+
+        Rectf destArea;
+        Rectf texArea;
+        static_cast<const BitmapImage*>(image)->getQuadAreas(
+            imgRenderSettings.d_destArea, destArea, texArea);
+
+        batch->d_destAreas.push_back(destArea);
+        batch->d_texAreas.push_back(texArea);
+        batch->d_colours.push_back(colours);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void Font::flushGlyphQuadBatches() const
+{
+    // the batches keep their memory for the next text
+    for (size_t i = 0; i < d_glyphQuadBatchCount; ++i)
+    {
+        GlyphQuadBatch& batch = d_glyphQuadBatches[i];
+
+        batch.d_buffer->appendTexturedQuads(batch.d_destAreas.data(),
+            batch.d_texAreas.data(), batch.d_colours.data(),
+            batch.d_destAreas.size(), batch.d_clipArea);
+
+        batch.d_destAreas.clear();
+        batch.d_texAreas.clear();
+        batch.d_colours.clear();
     }
+
+    d_glyphQuadBatchCount = 0;
 }
 
 } // End of  CEGUI namespace section
@@ -34,8 +34,10 @@
 #include "CEGUI/Logger.h"
 #include "CEGUI/System.h"
 #include "CEGUI/ResourceProvider.h"
+#include "CEGUI/DataContainer.h"
 #include "CEGUI/InputEvent.h"
 #include "CEGUI/PixmapFont.h"
+#include "CEGUI/BakedFont.h"
 #include "CEGUI/SharedStringStream.h"
 
 #ifdef CEGUI_HAS_FREETYPE
@@ -49,6 +51,8 @@ namespace CEGUI
 template<> FontManager* Singleton<FontManager>::ms_Singleton = nullptr;
 
 const String FontManager::ResourceTypeName = "Font";
+// generation of the fonts, shared by all instances of the manager
+static std::uint32_t s_generation = 1;
 
 
 FontManager::FontManager()
@@ -154,6 +158,7 @@ Font& FontManager::createFreeTypeFont(
         native_res, specificLineSpacing);
 
     d_registeredFonts[font_name] = fontObject;
+    ++s_generation;
 
     // fire event about this resource change
     ResourceEventArgs args(ResourceTypeName, font_name);
@@ -191,6 +196,7 @@ Font& FontManager::createPixmapFont(const String& font_name,
                                   auto_scaled, native_res);
 
     d_registeredFonts[font_name] = fontObject;
+    ++s_generation;
 
     // fire event about this resource change
     ResourceEventArgs args(ResourceTypeName, font_name);
@@ -200,6 +206,39 @@ Font& FontManager::createPixmapFont(const String& font_name,
     return *fontObject;
 }
 
+//----------------------------------------------------------------------------//
+Font& FontManager::createBakedFont(const String& font_name,
+                                   const String& filename,
+                                   const String& resource_group,
+                                   const AutoScaledMode auto_scaled,
+                                   const Sizef& native_res,
+                                   XmlResourceExistsAction resourceExistsAction)
+{
+    CEGUI_LOGINSANE("Attempting to create Baked font '" +
+        font_name + "' using font file '" + filename + "'.");
+
+    String event_name;
+    Font* fontObject = handleResourceExistsAction(
+        font_name, resourceExistsAction, event_name);
+
+    if (fontObject != nullptr)
+    {
+        return *fontObject;
+    }
+
+    fontObject = new BakedFont(font_name, filename, resource_group,
+                               auto_scaled, native_res);
+
+    d_registeredFonts[font_name] = fontObject;
+    ++s_generation;
+
+    // fire event about this resource change
+    ResourceEventArgs args(ResourceTypeName, font_name);
+    fireEvent(event_name, args, EventNamespace);
+
+    return *fontObject;
+}
+
 void FontManager::notifyDisplaySizeChanged(const Sizef& size)
 {
     // notify all attached Font objects of the change in resolution
@@ -238,6 +277,42 @@ FontManager::FontList FontManager::createFromFile(const String& xml_filename,
     return createdFonts;
 }
 
+void FontManager::createFromFileAsync(const String& xml_filename,
+    const String& resource_group, FontsCreatedCallback callback,
+    XmlResourceExistsAction resourceExistsAction)
+{
+    const String group(resource_group.empty() ?
+        Font::getDefaultResourceGroup() : resource_group);
+
+    System::getSingleton().getResourceProvider()->loadRawDataContainerAsync(
+        xml_filename, group,
+        [xml_filename, group, callback, resourceExistsAction]
+        (RawDataContainer& data, std::exception_ptr error)
+    {
+        FontList fonts;
+        bool failed = static_cast<bool>(error);
+        if (!failed)
+        {
+            try
+            {
+                fonts = createFromContainer(data, resourceExistsAction);
+            }
+            catch (...)
+            {
+                failed = true;
+            }
+        }
+
+        if (failed)
+            Logger::getSingleton().logEvent("FontManager::createFromFileAsync - "
+                "loading of fonts from file '" + xml_filename + "' of resource group '" +
+                group + "' failed.", LoggingLevel::Error);
+
+        if (callback)
+            callback(fonts);
+    });
+}
+
 FontManager::FontList FontManager::createFromString(const String& source,
     XmlResourceExistsAction resourceExistsAction)
 {
@@ -296,6 +371,11 @@ bool FontManager::isDefined(const String& font_name) const
     return d_registeredFonts.find(font_name) != d_registeredFonts.end();
 }
 
+std::uint32_t FontManager::getGeneration() const
+{
+    return s_generation;
+}
+
 void FontManager::destroyObject(
     FontRegistry::iterator ob)
 {
@@ -309,6 +389,7 @@ void FontManager::destroyObject(
 
     delete ob->second;
     d_registeredFonts.erase(ob);
+    ++s_generation;
 
     // fire event signaling an object has been destroyed
     fireEvent(EventResourceDestroyed, args, EventNamespace);
@@ -32,6 +32,7 @@
 #include "CEGUI/Logger.h"
 #include "CEGUI/XMLAttributes.h"
 #include "CEGUI/PixmapFont.h"
+#include "CEGUI/BakedFont.h"
 #include "CEGUI/SharedStringStream.h"
 #include "CEGUI/FontManager.h"
 
@@ -65,6 +66,7 @@ const String Font_xmlHandler::MappingHorzAdvanceAttribute("horzAdvance");
 const String Font_xmlHandler::FontVersionAttribute( "version" );
 const String Font_xmlHandler::FontTypeFreeType("FreeType");
 const String Font_xmlHandler::FontTypePixmap("Pixmap");
+const String Font_xmlHandler::FontTypeBaked("Baked");
 
 //----------------------------------------------------------------------------//
 // note: The assets' versions aren't usually the same as CEGUI version, they
@@ -175,6 +177,8 @@ void Font_xmlHandler::elementFontStart(const XMLAttributes& attributes)
         createFreeTypeFont(attributes);
     else if (font_type == FontTypePixmap)
         createPixmapFont(attributes);
+    else if (font_type == FontTypeBaked)
+        createBakedFont(attributes);
     else
         throw InvalidRequestException(
         "Encountered unknown font type of '" + font_type + "'");
@@ -321,5 +325,32 @@ void Font_xmlHandler::createPixmapFont(const XMLAttributes& attributes)
               attributes.getValueAsFloat(FontNativeVertResAttribute, 480.0f)));
 }
 
+//----------------------------------------------------------------------------//
+void Font_xmlHandler::createBakedFont(const XMLAttributes& attributes)
+{
+    const String name(attributes.getValueAsString(FontNameAttribute));
+    const String filename(attributes.getValueAsString(FontFilenameAttribute));
+    const String resource_group(attributes.getValueAsString(FontResourceGroupAttribute));
+
+    if (d_font != nullptr)
+    {
+        throw InvalidRequestException(
+            "Attempting to create a BakedFont but loading of a "
+            " previous font has not been finished.");
+    }
+
+    CEGUI_LOGINSANE("---- CEGUI font name: " + name);
+    CEGUI_LOGINSANE("----       Font type: Baked");
+    CEGUI_LOGINSANE("----     Source file: " + filename +
+                    " in resource group: " + (resource_group.empty() ? "(Default)" : resource_group));
+
+    d_font = &FontManager::getSingleton().createBakedFont(name, filename, resource_group,
+        PropertyHelper<AutoScaledMode>::fromString(
+                        attributes.getValueAsString(FontAutoScaledAttribute)),
+        Sizef(attributes.getValueAsFloat(FontNativeHorzResAttribute, 640.0f),
+              attributes.getValueAsFloat(FontNativeVertResAttribute, 480.0f)),
+        d_resourceExistsAction);
+}
+
 
 }
@@ -0,0 +1,153 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/FrameAllocator.h"
+#include <algorithm>
+#include <cstdint>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//! FrameAllocator active on this thread, if any.
+thread_local FrameAllocator* s_activeFrameAllocator = nullptr;
+}
+
+//----------------------------------------------------------------------------//
+const std::size_t FrameAllocator::DefaultBlockSize = 64 * 1024;
+
+//----------------------------------------------------------------------------//
+FrameAllocator::FrameAllocator() :
+    d_offset(0),
+    d_usedSize(0),
+    d_peakSize(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+FrameAllocator::~FrameAllocator()
+{
+    if (s_activeFrameAllocator == this)
+        s_activeFrameAllocator = nullptr;
+
+    for (const Block& block : d_blocks)
+        delete[] block.d_memory;
+}
+
+//----------------------------------------------------------------------------//
+void* FrameAllocator::allocate(std::size_t size, std::size_t alignment)
+{
+    // zero sized allocations still need a distinct address
+    size = std::max<std::size_t>(size, 1);
+
+    if (!d_blocks.empty())
+    {
+        const Block& block = d_blocks.back();
+        const std::uintptr_t address =
+            reinterpret_cast<std::uintptr_t>(block.d_memory) + d_offset;
+        const std::size_t padding = (alignment - (address % alignment)) % alignment;
+
+        if (d_offset + padding + size <= block.d_size)
+        {
+            d_offset += padding + size;
+            d_usedSize += padding + size;
+            d_peakSize = std::max(d_peakSize, d_usedSize);
+            return block.d_memory + d_offset - size;
+        }
+    }
+
+    // the memory of new[] is aligned for any fundamental type, so this only
+    // needs padding for over aligned types
+    addBlock(size + alignment);
+
+    const Block& block = d_blocks.back();
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(block.d_memory);
+    const std::size_t padding = (alignment - (address % alignment)) % alignment;
+
+    d_offset = padding + size;
+    d_usedSize += padding + size;
+    d_peakSize = std::max(d_peakSize, d_usedSize);
+    return block.d_memory + padding;
+}
+
+//----------------------------------------------------------------------------//
+void FrameAllocator::reset()
+{
+    // replace several blocks by a single one as large as all of them, so
+    // that the following frames fit into one block
+    if (d_blocks.size() > 1)
+    {
+        const std::size_t capacity = getCapacity();
+        for (const Block& block : d_blocks)
+            delete[] block.d_memory;
+
+        d_blocks.clear();
+        addBlock(capacity);
+    }
+
+    d_offset = 0;
+    d_usedSize = 0;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t FrameAllocator::getCapacity() const
+{
+    std::size_t capacity = 0;
+    for (const Block& block : d_blocks)
+        capacity += block.d_size;
+
+    return capacity;
+}
+
+//----------------------------------------------------------------------------//
+void FrameAllocator::addBlock(std::size_t minimumSize)
+{
+    // grow geometrically so that a frame needs few blocks while warming up
+    std::size_t size = d_blocks.empty() ? DefaultBlockSize : d_blocks.back().d_size * 2;
+    size = std::max(size, minimumSize);
+
+    Block block = { new char[size], size };
+    d_blocks.push_back(block);
+}
+
+//----------------------------------------------------------------------------//
+FrameAllocator* FrameAllocator::getActive()
+{
+    return s_activeFrameAllocator;
+}
+
+//----------------------------------------------------------------------------//
+FrameAllocator* FrameAllocator::setActive(FrameAllocator* allocator)
+{
+    FrameAllocator* previous = s_activeFrameAllocator;
+    s_activeFrameAllocator = allocator;
+    return previous;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
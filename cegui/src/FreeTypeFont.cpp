@@ -27,7 +27,9 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/FreeTypeFont.h"
+#include "CEGUI/FreeTypeGlyphAtlas.h"
 #include "CEGUI/Texture.h"
+#include "CEGUI/GeometryBuffer.h"
 #include "CEGUI/InputEvent.h"
 #include "CEGUI/System.h"
 #include "CEGUI/Renderer.h"
@@ -37,12 +39,25 @@
 #include "CEGUI/Font_xmlHandler.h"
 #include "CEGUI/XMLSerializer.h"
 #include "CEGUI/SharedStringStream.h"
+#include "CEGUI/BakedFont.h"
+#include "CEGUI/Profiler.h"
 
 #ifdef CEGUI_USE_RAQM
 #include <raqm.h>
+#include <list>
+#include <unordered_map>
 #endif
 
-#include <iostream>
+#include <algorithm>
+#include <iterator>
+#include <ostream>
+#include <chrono>
+#include <cstring>
+
+// FT_RENDER_MODE_SDF was introduced with FreeType 2.11
+#if FREETYPE_MAJOR > 2 || (FREETYPE_MAJOR == 2 && FREETYPE_MINOR >= 11)
+#   define CEGUI_FREETYPE_HAS_SDF
+#endif
 
 namespace
 {
@@ -111,8 +126,64 @@ raqm_t* createAndSetupRaqmTextObject(
 
     return raqmObject;
 }
+
+#endif
+
+std::u32string convertToUtf32(const CEGUI::String& text)
+{
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII)
+    return CEGUI::String::convertUtf8ToUtf32(text.c_str(), text.length());
+#elif (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32)
+    return text.getString();
+#endif
+}
+
+#ifdef CEGUI_USE_RAQM
+// Converts the index of a code point of the text into an index into the String
+size_t getCodeUnitIndex(const CEGUI::String& text, size_t codePointIndex)
+{
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
+    CEGUI::String::codepoint_iterator codePointIter(text.begin(), text.begin(), text.end());
+    codePointIter.increment(codePointIndex);
+    return codePointIter.getCodeUnitIndexFromStart();
+#else
+    CEGUI_UNUSED(text);
+    return codePointIndex;
+#endif
+}
 #endif
 
+// Writes a field of a baked font file, which are little-endian
+void writeBakedU32(std::ostream& out, std::uint32_t value)
+{
+    const char bytes[4] = {
+        static_cast<char>(value & 0xFF), static_cast<char>((value >> 8) & 0xFF),
+        static_cast<char>((value >> 16) & 0xFF), static_cast<char>((value >> 24) & 0xFF) };
+    out.write(bytes, sizeof(bytes));
+}
+
+void writeBakedF32(std::ostream& out, float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    writeBakedU32(out, bits);
+}
+
+// The colours of the packed layers 1 to 3 as the columns of a matrix, which is
+// how the layered glyph shader takes them. Layers without a colour are black.
+glm::mat4 getLayerColourMatrix(const std::vector<CEGUI::ColourRect>& layerColours)
+{
+    glm::mat4 matrix(0.0f);
+    for (std::size_t layer = 1; layer < CEGUI::FreeTypeFont::MaxPackedLayerCount; ++layer)
+    {
+        const CEGUI::Colour colour = (layer < layerColours.size()) ?
+            layerColours[layer].d_top_left : CEGUI::Colour();
+        matrix[static_cast<glm::length_t>(layer)] = glm::vec4(colour.getRed(),
+            colour.getGreen(), colour.getBlue(), colour.getAlpha());
+    }
+
+    return matrix;
+}
 
 }
 
@@ -120,14 +191,46 @@ raqm_t* createAndSetupRaqmTextObject(
 namespace CEGUI
 {
 //----------------------------------------------------------------------------//
-// Pixels to put between glyphs
-static const int s_glyphPadding = 1;
 // A multiplication coefficient to convert FT_Pos values into normal floats
 static const float s_conversionMultCoeff =  (1.0f/64.f);
 // Font objects usage count
 static int s_fontUsageCount = 0;
 // A handle to the FreeType library
 static FT_Library s_freetypeLibHandle;
+// Fonts with glyphs queued for or being rasterised in the background
+static std::vector<const FreeTypeFont*> s_fontsRasterisingGlyphs;
+
+#ifdef CEGUI_USE_RAQM
+// Identifies a text shaped by a font
+struct ShapedRunKey
+{
+    const FreeTypeFont* d_font;
+    DefaultParagraphDirection d_direction;
+    std::u32string d_text;
+
+    bool operator==(const ShapedRunKey& other) const
+    {
+        return d_font == other.d_font && d_direction == other.d_direction &&
+            d_text == other.d_text;
+    }
+};
+
+struct ShapedRunKeyHasher
+{
+    size_t operator()(const ShapedRunKey& key) const
+    {
+        size_t hash = std::hash<std::u32string>()(key.d_text);
+        hash ^= std::hash<const FreeTypeFont*>()(key.d_font) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash ^ static_cast<size_t>(key.d_direction);
+    }
+};
+
+typedef std::list<std::pair<ShapedRunKey, std::shared_ptr<const FreeTypeFont::ShapedRun>>>
+    ShapedRunList;
+// Texts shaped by all fonts, the most recently used first
+static ShapedRunList s_shapedRuns;
+static std::unordered_map<ShapedRunKey, ShapedRunList::iterator, ShapedRunKeyHasher> s_shapedRunIndex;
+#endif
 
 //----------------------------------------------------------------------------//
 
@@ -169,7 +272,10 @@ FreeTypeFont::FreeTypeFont(
     d_fontLayers(std::move(fontLayers))
 {
     if (!s_fontUsageCount++)
+    {
         FT_Init_FreeType(&s_freetypeLibHandle);
+        FreeTypeGlyphAtlas::createInstance();
+    }
 
     addFreeTypeFontProperties();
 
@@ -186,7 +292,10 @@ FreeTypeFont::~FreeTypeFont()
     free();
 
     if (!--s_fontUsageCount)
+    {
+        FreeTypeGlyphAtlas::destroyInstance();
         FT_Done_FreeType(s_freetypeLibHandle);
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -209,222 +318,40 @@ void FreeTypeFont::addFreeTypeFontProperties()
         "Value is either true or false.",
         &FreeTypeFont::setAntiAliased, &FreeTypeFont::isAntiAliased, false
     );
-}
-
-void FreeTypeFont::resizeAndUpdateTexture(Texture* texture, int newSize) const
-{
-    if(d_lastTextureSize >= newSize)
-    {
-        throw InvalidRequestException("Must supply a larger than previous size when "
-            "resizing the glyph atlas");
-    }
-
-    int oldTextureSize = d_lastTextureSize;
-    std::vector<argb_t> oldTextureData(d_lastTextureBuffer);
-
-    Sizef newTextureSize(static_cast<float>(newSize),
-                         static_cast<float>(newSize));
-    d_lastTextureSize = newSize;
-
-    d_lastTextureBuffer.resize(newSize * newSize);
-    std::fill(d_lastTextureBuffer.begin(), d_lastTextureBuffer.end(), 0);
-
-    // Copy our memory buffer into the texture and free it
-    updateTextureBufferSubImage(d_lastTextureBuffer.data(),
-        oldTextureSize, oldTextureSize, oldTextureData);
-
-    //TODO: why always RGBA if we, and Freetype, only support greyscale?
-    texture->loadFromMemory(d_lastTextureBuffer.data(), newTextureSize, Texture::PixelFormat::Rgba);
-
-    System::getSingleton().getRenderer()->updateGeometryBufferTexCoords(texture,
-        oldTextureSize / static_cast<float>(newSize));
-}
 
-void FreeTypeFont::createTextureSpaceForGlyphRasterisation(Texture* texture, int glyphWidth, int glyphHeight) const
-{
-    int maxTextureSize = System::getSingleton().getRenderer()->getMaxTextureSize();
-    const int scaleFactor = 2;
+    CEGUI_DEFINE_PROPERTY(FreeTypeFont, bool,
+        "AsynchronousRasterisation", "Property to get/set whether the bitmaps of new glyphs "
+        "are rasterised in the background. Value is either true or false.",
+        &FreeTypeFont::setAsynchronousRasterisation, &FreeTypeFont::isAsynchronousRasterisation, false
+    );
 
-    if(glyphWidth > maxTextureSize || glyphHeight > maxTextureSize)
-    {
-        throw InvalidRequestException("Can not rasterise a glyph that is larger "
-            "than the maximum supported texture size.");
-    }
-        
-    int newSize = d_lastTextureSize * scaleFactor;
-    if (newSize > maxTextureSize)
-    {
-        createGlyphAtlasTexture();
-    }
-    else
-    {
-        resizeAndUpdateTexture(texture, newSize);
-    }
+    CEGUI_DEFINE_PROPERTY(FreeTypeFont, bool,
+        "DistanceField", "Property to get/set whether the glyphs are rendered as signed distance "
+        "fields, which are scaled to any size. Value is either true or false.",
+        &FreeTypeFont::setDistanceField, &FreeTypeFont::isDistanceField, false
+    );
 }
 
-void FreeTypeFont::addRasterisedGlyphToTextureAndSetupGlyphImage(
-    FreeTypeFontGlyph* glyph, Texture* texture, FT_Bitmap& glyphBitmap, int glyphLeft, int glyphTop,
-    int glyphWidth, int glyphHeight, unsigned int layer,
-    const TextureGlyphLine& glyphTexLine) const
+//----------------------------------------------------------------------------//
+void FreeTypeFont::addRasterisedGlyphLayer(FreeTypeFontGlyph& glyph,
+    const RasterisedGlyphLayer& rasterised) const
 {
-    // Create the data containing the pixels of the glyph
-    std::vector<argb_t> subTextureData = createGlyphTextureData(glyphBitmap);
-
-    // Update the cached texture data in memory
-    size_t bufferDataGlyphPos = (glyphTexLine.d_lastYPos * d_lastTextureSize) + glyphTexLine.d_lastXPos;
-    updateTextureBufferSubImage(d_lastTextureBuffer.data() + bufferDataGlyphPos,
-        glyphWidth, glyphHeight, subTextureData);
-
-    // Update the sub-image in the texture on the GPU
-    glm::vec2 subImagePos(glyphTexLine.d_lastXPos, glyphTexLine.d_lastYPos);
-    Sizef subImageSize(static_cast<float>(glyphWidth), static_cast<float>(glyphHeight));
-    Rectf subImageArea(subImagePos, subImageSize);
-    texture->blitFromMemory(subTextureData.data(), subImageArea);
-
-    // Create a new image in the imageset
-    const Rectf area(static_cast<float>(glyphTexLine.d_lastXPos),
-        static_cast<float>(glyphTexLine.d_lastYPos),
-        static_cast<float>(glyphTexLine.d_lastXPos + glyphWidth),
-        static_cast<float>(glyphTexLine.d_lastYPos + glyphHeight));
-
     // This is the right bearing for bitmap glyphs, not d_fontFace->glyph->metrics.horiBearingX
     const glm::vec2 offset(
-        glyphLeft,
-        -glyphTop);
-
-    const String name(PropertyHelper<std::uint32_t>::toString(glyph->getCodePoint()));
-
-    BitmapImage* img = new BitmapImage(
-        name, texture, area,
-        offset, AutoScaledMode::Disabled, d_nativeResolution);
-    d_glyphImages.push_back(img);
-
-    glyph->setImage(img, layer);
-}
-
-void FreeTypeFont::findFittingSpotInGlyphTextureLines(
-    int glyphWidth, int glyphHeight,
-    bool &fittingLineWasFound, size_t &fittingLineIndex) const 
-{
-    // Go through the lines and find one that fits
-    size_t lineCount =  d_textureGlyphLines.size();
-    for(size_t i = 0; i < lineCount && !fittingLineWasFound; ++i)
-    {
-        const auto& currentGlyphLine = d_textureGlyphLines[i];
-
-        bool isLastLine = (i == (lineCount - 1));
-
-        // Check if glyph right margin exceeds texture size
-        int curGlyphXEnd = currentGlyphLine.d_lastXPos + glyphWidth;
-        int curGlyphYEnd = currentGlyphLine.d_lastYPos + glyphHeight;
-        if (curGlyphXEnd < d_lastTextureSize && curGlyphYEnd < d_lastTextureSize)
-        {
-            //Only the last line can be extended into the y-dimension
-            if (isLastLine)
-            {
-                if (curGlyphYEnd > currentGlyphLine.d_maximumExtentY)
-                {
-                    currentGlyphLine.d_maximumExtentY = curGlyphYEnd;
-                }
-
-                fittingLineIndex = i;
-                fittingLineWasFound = true;
-            }
-            else
-            {
-                if (curGlyphYEnd < currentGlyphLine.d_maximumExtentY)
-                {
-                    fittingLineIndex = i;
-                    fittingLineWasFound = true;
-                }
-            }
-        }
-    }
-}
+        rasterised.d_left,
+        -rasterised.d_top);
 
-//----------------------------------------------------------------------------//
-void FreeTypeFont::rasterise(FreeTypeFontGlyph* glyph, FT_Bitmap& ft_bitmap, int glyphLeft, int glyphTop,
-    int glyphWidth, int glyphHeight, int unsigned layer) const
-{
-    if(d_glyphTextures.empty())
-    {
-        createGlyphAtlasTexture();
-    }
-
-    bool fittingLineWasFound = false;
-    size_t fittingLineIndex = -1;
-
-    findFittingSpotInGlyphTextureLines(glyphWidth, glyphHeight,
-        fittingLineWasFound, fittingLineIndex);
-
-    if(!fittingLineWasFound)
-    {
-        fittingLineWasFound = addNewLineIfFitting(glyphHeight, glyphWidth, fittingLineIndex);
-    }
-
-    if(!fittingLineWasFound)
-    {
-        Texture* texture = d_glyphTextures.back();
-        createTextureSpaceForGlyphRasterisation(texture, glyphWidth, glyphHeight);
-
-        rasterise(glyph, ft_bitmap, glyphLeft, glyphTop, glyphWidth, glyphHeight, layer);
-        return;
-    }
-
-    const TextureGlyphLine& glyphTexLine = d_textureGlyphLines[fittingLineIndex];
-
-    // Retrieve the last texture created
-    Texture* texture = d_glyphTextures.back();
+    const String name(PropertyHelper<std::uint32_t>::toString(glyph.getCodePoint()));
 
-    addRasterisedGlyphToTextureAndSetupGlyphImage(glyph, texture, ft_bitmap,
-        glyphLeft, glyphTop, glyphWidth, glyphHeight, layer, glyphTexLine);
-
-    // Advance to next position, add padding
-    glyphTexLine.d_lastXPos += glyphWidth + s_glyphPadding;
-}
-
-bool FreeTypeFont::addNewLineIfFitting(unsigned int glyphHeight, unsigned int glyphWidth,
-    size_t& fittingLineIndex) const
-{
-    const auto& lastLine = d_textureGlyphLines.back();
-
-    unsigned int newLinePosY = lastLine.d_maximumExtentY + s_glyphPadding;
-    int newMaxYExtent = newLinePosY + glyphHeight;
-    
-    // Also skip if the texture isn't wide enough
-    const int curGlyphXEnd = glyphWidth;
-    
-    if (newMaxYExtent <= d_lastTextureSize && curGlyphXEnd < d_lastTextureSize)
-    {
-        // Add the glyph in a new line
-        d_textureGlyphLines.push_back(TextureGlyphLine(0, newLinePosY, newMaxYExtent));
-        fittingLineIndex = d_textureGlyphLines.size() - 1;
-        return true;
-    }
-
-    return false;
-}
-
-void FreeTypeFont::createGlyphAtlasTexture() const
-{
-    std::uint32_t newTextureIndex = d_glyphTextures.size();
-    const String texture_name(d_name + "_auto_glyph_images_texture_" +
-        PropertyHelper<std::uint32_t>::toString(newTextureIndex));
-
-    d_lastTextureSize = d_initialGlyphAtlasSize;
-    Sizef newTextureSize(static_cast<float>(d_initialGlyphAtlasSize),
-        static_cast<float>(d_initialGlyphAtlasSize));
-    Texture& texture = System::getSingleton().getRenderer()->createTexture(
-        texture_name, newTextureSize);
-    d_glyphTextures.push_back(&texture);
-
-    d_lastTextureBuffer = std::vector<argb_t>(d_lastTextureSize * d_lastTextureSize, 0);
-    d_textureGlyphLines.clear();
-    d_textureGlyphLines.push_back(TextureGlyphLine());
+    FreeTypeGlyphAtlas::getInstance()->addGlyph(*this, glyph, rasterised.d_layer,
+        rasterised.d_pixels, rasterised.d_width, rasterised.d_height,
+        name, offset, d_nativeResolution, d_initialGlyphAtlasSize,
+        d_layersPacked ? DefaultShaderType::LayeredGlyph :
+        d_distanceFieldActive ? DefaultShaderType::DistanceField : DefaultShaderType::Textured);
 }
 
 //----------------------------------------------------------------------------//
-std::vector<argb_t> FreeTypeFont::createGlyphTextureData(FT_Bitmap& glyphBitmap)
+std::vector<argb_t> FreeTypeFont::createGlyphTextureData(const FT_Bitmap& glyphBitmap)
 {
     unsigned int bitmapHeight = static_cast<unsigned int>(glyphBitmap.rows);
     unsigned int bitmapWidth = static_cast<unsigned int>(glyphBitmap.width);
@@ -491,32 +418,18 @@ FT_Stroker_LineJoin FreeTypeFont::getLineJoin(FreeTypeLineJoin line_join) {
     return FT_STROKER_LINEJOIN_ROUND;
 }
 
-//----------------------------------------------------------------------------//
-void FreeTypeFont::updateTextureBufferSubImage(argb_t* destTextureData, unsigned int bitmapWidth,
-    unsigned int bitmapHeight, const std::vector<argb_t>& subImageData) const
-{
-    argb_t* curDestPixelLine = destTextureData;
-
-    for (unsigned int i = 0;  i < bitmapHeight;  ++i)
-    {
-        argb_t* curDestPixel = curDestPixelLine;
-
-        for (unsigned int j = 0; j < bitmapWidth; ++j)
-        {
-            *curDestPixel = subImageData[bitmapWidth * i + j];
-            ++curDestPixel;
-        }
-
-        curDestPixelLine += d_lastTextureSize;
-    }
-}
-
 //----------------------------------------------------------------------------//
 void FreeTypeFont::free()
 {
     if (!d_fontFace)
         return;
 
+    cancelGlyphRasterisation();
+    FreeTypeGlyphAtlas::getInstance()->releaseFont(*this);
+#ifdef CEGUI_USE_RAQM
+    releaseShapedRuns();
+#endif
+
     for(auto codePointMapEntry : d_codePointToGlyphMap)
     {
         delete codePointMapEntry.second;
@@ -524,14 +437,15 @@ void FreeTypeFont::free()
 
     d_codePointToGlyphMap.clear();
     d_indexToGlyphMap.clear();
+    resetKerningCache();
 
-    for (size_t i = 0; i < d_glyphImages.size(); ++i)
-        delete d_glyphImages[i];
-    d_glyphImages.clear();
-
-    for (size_t i = 0; i < d_glyphTextures.size(); i++)
-        System::getSingleton().getRenderer()->destroyTexture(*d_glyphTextures[i]);
-    d_glyphTextures.clear();
+    if (d_distanceFieldFontFace)
+    {
+        FT_Done_Face(d_distanceFieldFontFace);
+        d_distanceFieldFontFace = nullptr;
+    }
+    d_distanceFieldActive = false;
+    d_layersPacked = false;
 
     FT_Done_Face(d_fontFace);
     d_fontFace = nullptr;
@@ -626,6 +540,17 @@ void FreeTypeFont::tryToCreateFontWithClosestFontHeight(
 //----------------------------------------------------------------------------//
 void FreeTypeFont::updateFont()
 {
+    invalidateLatin1GlyphMetrics();
+    releaseTextLayouts();
+
+    // The distance fields are independent of the size, so only the metrics
+    // have to be reloaded while the glyph images are kept
+    if (d_distanceFieldActive)
+    {
+        updateFontScale();
+        return;
+    }
+
     free();
 
     System::getSingleton().getResourceProvider()->loadRawDataContainer(
@@ -635,27 +560,93 @@ void FreeTypeFont::updateFont()
     createFreetypeMemoryFace();
 
     checkUnicodeCharMapAvailability();
-    
+
+    initialiseDistanceField();
+    initialiseLayerPacking();
+
+    updateFontFaceSize();
+
+    initialiseGlyphMap();
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::updateFontScale()
+{
+    if (!d_fontFace)
+    {
+        updateFont();
+        return;
+    }
+
+    invalidateLatin1GlyphMetrics();
+    releaseTextLayouts();
+#ifdef CEGUI_USE_RAQM
+    releaseShapedRuns();
+#endif
+
+    // The face and the glyph map stay loaded. Bitmap glyphs were rasterised
+    // at the old size, so their images go and each glyph is rasterised again
+    // when it is next drawn rather than all of them at once here.
+    if (!d_distanceFieldActive)
+    {
+        cancelGlyphRasterisation();
+
+        for (auto codePointMapEntry : d_codePointToGlyphMap)
+            for (unsigned int layer = 0; layer < d_fontLayers.size(); ++layer)
+                codePointMapEntry.second->setImage(nullptr, layer);
+
+        FreeTypeGlyphAtlas::getInstance()->releaseFont(*this);
+    }
+
+    updateFontFaceSize();
+
+    for (auto codePointMapEntry : d_codePointToGlyphMap)
+        codePointMapEntry.second->markAsUninitialised();
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::updateFontFaceSize()
+{
     float fontScaleFactor = System::getSingleton().getRenderer()->getFontScale();
     if (d_autoScaled != AutoScaledMode::Disabled)
     {
         fontScaleFactor *= d_vertScaling;
     }
-    
-    unsigned int requestedFontSizeInPixels = static_cast<unsigned int>(
-        std::lround(getSizeInPixels() * fontScaleFactor));
 
-    FT_Error errorResult = FT_Set_Pixel_Sizes(d_fontFace, 0, requestedFontSizeInPixels);
-    if(errorResult != 0)
+    if (d_distanceFieldActive)
+    {
+        // Fractional sizes are fine, the glyphs are scaled anyway
+        const float fontSizeInPixels = getSizeInPixels() * fontScaleFactor;
+        const FT_Error errorResult = FT_Set_Char_Size(d_fontFace, 0,
+            static_cast<FT_F26Dot6>(std::lround(fontSizeInPixels * 64.0f)), 72, 72);
+        if (errorResult != 0)
+        {
+            findAndThrowFreeTypeError(errorResult, "Failed to set the size of the font");
+        }
+
+        d_distanceFieldScale = fontSizeInPixels / DistanceFieldBaseSize;
+    }
+    else
     {
-        // Usually, an error occurs with a fixed-size font format (like FNT or PCF)
-        // when trying to set the pixel size to a value that is not listed in the
-        // face->fixed_sizes array.For bitmap fonts we can render only at specific
-        // point sizes.
-        // Try to find Font with closest pixel height and use it instead
-        tryToCreateFontWithClosestFontHeight(errorResult, requestedFontSizeInPixels);
+        unsigned int requestedFontSizeInPixels = static_cast<unsigned int>(
+            std::lround(getSizeInPixels() * fontScaleFactor));
+
+        FT_Error errorResult = FT_Set_Pixel_Sizes(d_fontFace, 0, requestedFontSizeInPixels);
+        if(errorResult != 0)
+        {
+            // Usually, an error occurs with a fixed-size font format (like FNT or PCF)
+            // when trying to set the pixel size to a value that is not listed in the
+            // face->fixed_sizes array.For bitmap fonts we can render only at specific
+            // point sizes.
+            // Try to find Font with closest pixel height and use it instead
+            tryToCreateFontWithClosestFontHeight(errorResult, requestedFontSizeInPixels);
+        }
+
+        d_distanceFieldScale = 1.0f;
     }
 
+    resetKerningCache();
+
     if (d_fontFace->face_flags & FT_FACE_FLAG_SCALABLE)
     {
         float y_scale = d_fontFace->size->metrics.y_scale * float(s_conversionMultCoeff) * (1.0f / 65536.0f);
@@ -674,8 +665,51 @@ void FreeTypeFont::updateFont()
     {
         d_height = d_specificLineSpacing;
     }
+}
 
-    initialiseGlyphMap();
+//----------------------------------------------------------------------------//
+void FreeTypeFont::initialiseDistanceField()
+{
+    d_distanceFieldActive = false;
+
+#ifdef CEGUI_FREETYPE_HAS_SDF
+    if (!d_distanceField || !(d_fontFace->face_flags & FT_FACE_FLAG_SCALABLE) ||
+        !System::getSingleton().getRenderer()->isDefaultShaderTypeSupported(
+            DefaultShaderType::DistanceField))
+    {
+        return;
+    }
+
+    FT_Error error = FT_New_Memory_Face(s_freetypeLibHandle, d_fontData.getDataPtr(),
+        static_cast<FT_Long>(d_fontData.getSize()), 0, &d_distanceFieldFontFace);
+    if (error == 0)
+        error = FT_Set_Pixel_Sizes(d_distanceFieldFontFace, 0, DistanceFieldBaseSize);
+
+    if (error != 0)
+    {
+        if (d_distanceFieldFontFace)
+        {
+            FT_Done_Face(d_distanceFieldFontFace);
+            d_distanceFieldFontFace = nullptr;
+        }
+        Logger::getSingleton().logEvent("FreeTypeFont '" + d_name + "': Failed to "
+            "create the face for distance fields, the glyphs are rendered as bitmaps.",
+            LoggingLevel::Warning);
+        return;
+    }
+
+    d_distanceFieldActive = true;
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::initialiseLayerPacking()
+{
+    // Distance fields only have a standard layer, so there is nothing to pack
+    d_layersPacked = !d_distanceFieldActive && d_fontLayers.size() > 1 &&
+        d_fontLayers.size() <= MaxPackedLayerCount &&
+        System::getSingleton().getRenderer()->isDefaultShaderTypeSupported(
+            DefaultShaderType::LayeredGlyph);
 }
 
 //----------------------------------------------------------------------------//
@@ -709,109 +743,249 @@ void FreeTypeFont::prepareGlyph(FreeTypeFontGlyph* glyph) const
         return;
     }
 
-    FT_Glyph ft_glyph;
-    FT_Bitmap ft_bitmap;
-    FT_Vector position;
-    position.x = 0L;
-    position.y = 0L;
-    int glyphWidth = 0;
-    int glyphHeight = 0;
-    int glyphLeft = 0;
-    int glyphTop = 0;
-    FT_Set_Transform(d_fontFace, nullptr, &position);
-    FT_UInt glyph_index = FT_Get_Char_Index(d_fontFace, glyph->getCodePoint());
-
-    unsigned int layerCount = d_fontLayers.size();  //retrieved from font somehow
-    //layer 0 is the top rendered layer (rendered last over the other layers)
-    for (unsigned int layer = 0; layer < layerCount; layer++) {
-
-    FontLayerType fontLayerType = d_fontLayers[layer].d_fontLayerType;
-    // Load the code point, "rendering" the glyph
-    FT_Int32 targetType = d_antiAliased ? FT_LOAD_TARGET_NORMAL : FT_LOAD_TARGET_MONO;
-    FT_Int32 loadType = (fontLayerType == FontLayerType::Standard) ? FT_LOAD_RENDER : FT_LOAD_NO_BITMAP;
-    auto loadBitmask = loadType | FT_LOAD_FORCE_AUTOHINT | targetType;
-    FT_Error error = FT_Load_Glyph(d_fontFace, glyph_index, loadBitmask);
-
     glyph->markAsInitialised();
+    glyph->setImageScale(d_distanceFieldScale);
 
-    if (error != 0)
+    if (!loadGlyphMetrics(glyph))
     {
         return;
     }
 
-    if (fontLayerType == FontLayerType::Standard) {
-        ft_bitmap = d_fontFace->glyph->bitmap;
-        glyphWidth = d_fontFace->glyph->bitmap.width;
-        glyphHeight = d_fontFace->glyph->bitmap.rows;
-        glyphTop = d_fontFace->glyph->bitmap_top;
-        glyphLeft = d_fontFace->glyph->bitmap_left;
-    } else {
-        unsigned int outlinePixels = d_fontLayers[layer].d_outlinePixels; // n * 64 result in n pixels outline
-        bool errorFlag = false;
-        FT_Stroker stroker;
-        FT_BitmapGlyph bitmapGlyph;
-        FT_Stroker_New(s_freetypeLibHandle, &stroker);
-        FT_Stroker_Set(stroker, outlinePixels * 64, getLineCap(d_fontLayers[layer].d_lineCap),
-            getLineJoin(d_fontLayers[layer].d_lineJoin), d_fontLayers[layer].d_miterLimit);
-        if (FT_Get_Glyph(d_fontFace->glyph, &ft_glyph)) {
-            errorFlag = true;
-        }
-        if (fontLayerType == FontLayerType::Outline)
-          error = FT_Glyph_Stroke(&ft_glyph, stroker, true);
-        if (fontLayerType == FontLayerType::Outer)
-          error = FT_Glyph_StrokeBorder(&ft_glyph, stroker, false, true);
-        if (fontLayerType == FontLayerType::Inner)
-          error = FT_Glyph_StrokeBorder(&ft_glyph, stroker, true, true);
-        if (error > 0) {
-            errorFlag = true;
-            std::cout << "!!!!!!!!!!!!!!!!failed Stroke " << std::endl;
-        }
-        error = FT_Glyph_To_Bitmap(&ft_glyph, FT_RENDER_MODE_NORMAL, 0, true);
-        if (error > 0) {
-            errorFlag = true;
-            std::cout << "failed to create glyph to bitmap" << std::endl;
-        }
-        bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(ft_glyph);
-        ft_bitmap = bitmapGlyph->bitmap;
-        glyphWidth = bitmapGlyph->bitmap.width;
-        glyphHeight = bitmapGlyph->bitmap.rows;
-        glyphTop = bitmapGlyph->top;
-        glyphLeft = bitmapGlyph->left;
-        FT_Stroker_Done(stroker);
-        if (errorFlag)
-        {
-        //  return;
-        }
+    if (d_asynchronousRasterisation)
+    {
+        queueGlyphRasterisation(glyph);
+        return;
     }
 
-    bool isRendered = glyph->getImage(layer) != nullptr;
-    if (!isRendered)
+    const auto start = std::chrono::steady_clock::now();
+
+    if (d_layersPacked)
     {
-#ifdef CEGUI_USE_RAQM
-        // Rasterise the 0 position glyph
-        rasterise(glyph, ft_bitmap, glyphLeft, glyphTop, glyphWidth, glyphHeight, layer);
+        // The packed image of all layers is kept as layer 0
+        if (glyph->getImage(0) == nullptr)
+        {
+            std::vector<RasterisedGlyphLayer> layers(d_fontLayers.size());
+            std::size_t layerCount = 0;
+            for (unsigned int layer = 0; layer < d_fontLayers.size(); ++layer)
+            {
+                RasterisedGlyphLayer& rasterised = layers[layerCount];
+                rasterised.d_codePoint = glyph->getCodePoint();
+                rasterised.d_layer = layer;
+                if (rasteriseGlyphLayer(d_fontFace, glyph->getGlyphIndex(), d_fontLayers[layer],
+                                        d_antiAliased, false, rasterised))
+                {
+                    ++layerCount;
+                }
+            }
+            layers.resize(layerCount);
 
-        glyph->setLsbDelta(d_fontFace->glyph->lsb_delta);
-        glyph->setRsbDelta(d_fontFace->glyph->rsb_delta);        
-#else
-        rasterise(glyph, ft_bitmap, glyphLeft, glyphTop, glyphWidth, glyphHeight, layer);
-#endif
-    }
+            RasterisedGlyphLayer packed;
+            if (packGlyphLayers(layers, packed))
+            {
+                addRasterisedGlyphLayer(*glyph, packed);
+                ++d_rasterisedGlyphLayerCount;
+            }
+        }
 
-    float adv;
-    if (fontLayerType == FontLayerType::Standard)
-    {
-        //adv = d_fontFace->glyph->advance.x * static_cast<float>(s_conversionMultCoeff);
-        adv = d_fontFace->glyph->metrics.horiAdvance * static_cast<float>(s_conversionMultCoeff);
+        d_rasterisationTime += std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        return;
     }
-    else
+
+    //layer 0 is the top rendered layer (rendered last over the other layers)
+    for (unsigned int layer = 0; layer < d_fontLayers.size(); ++layer)
     {
-        adv = d_fontFace->glyph->metrics.horiAdvance * static_cast<float>(s_conversionMultCoeff);
-        FT_Done_Glyph(ft_glyph);
-    }
-    glyph->setAdvance(adv);
+        // Layers on a page that was not evicted are still there
+        if (glyph->getImage(layer) != nullptr)
+        {
+            continue;
+        }
 
-    } //for layer loop
+        RasterisedGlyphLayer rasterised;
+        rasterised.d_codePoint = glyph->getCodePoint();
+        rasterised.d_layer = layer;
+        FT_Face face = d_distanceFieldActive ? d_distanceFieldFontFace : d_fontFace;
+        if (rasteriseGlyphLayer(face, glyph->getGlyphIndex(), d_fontLayers[layer],
+                                d_antiAliased, d_distanceFieldActive, rasterised))
+        {
+            addRasterisedGlyphLayer(*glyph, rasterised);
+            ++d_rasterisedGlyphLayerCount;
+        }
+    }
+
+    d_rasterisationTime += std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+//----------------------------------------------------------------------------//
+bool FreeTypeFont::loadGlyphMetrics(FreeTypeFontGlyph* glyph) const
+{
+    FT_Vector position;
+    position.x = 0L;
+    position.y = 0L;
+    FT_Set_Transform(d_fontFace, nullptr, &position);
+
+    // Hinting would make the advances of scaled distance fields inconsistent
+    FT_Int32 targetType = d_antiAliased ? FT_LOAD_TARGET_NORMAL : FT_LOAD_TARGET_MONO;
+    FT_Int32 loadType = d_distanceFieldActive ? FT_LOAD_NO_HINTING : FT_LOAD_FORCE_AUTOHINT | targetType;
+    if (FT_Load_Glyph(d_fontFace, glyph->getGlyphIndex(), loadType) != 0)
+    {
+        return false;
+    }
+
+#ifdef CEGUI_USE_RAQM
+    glyph->setLsbDelta(d_fontFace->glyph->lsb_delta);
+    glyph->setRsbDelta(d_fontFace->glyph->rsb_delta);
+#endif
+    glyph->setAdvance(d_fontFace->glyph->metrics.horiAdvance * static_cast<float>(s_conversionMultCoeff));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool FreeTypeFont::rasteriseGlyphLayer(FT_Face face, FT_UInt glyphIndex,
+    const FreeTypeFontLayer& fontLayer, bool antiAliased, bool distanceField,
+    RasterisedGlyphLayer& rasterised)
+{
+    CEGUI_PROFILE_SCOPE("FreeTypeFont::rasteriseGlyphLayer");
+
+    FT_Vector position;
+    position.x = 0L;
+    position.y = 0L;
+    FT_Set_Transform(face, nullptr, &position);
+
+    FontLayerType fontLayerType = fontLayer.d_fontLayerType;
+
+    if (distanceField)
+    {
+#ifdef CEGUI_FREETYPE_HAS_SDF
+        // Outlines and borders are not supported for distance fields
+        if (fontLayerType != FontLayerType::Standard ||
+            FT_Load_Glyph(face, glyphIndex, FT_LOAD_NO_HINTING | FT_LOAD_NO_BITMAP) != 0 ||
+            FT_Render_Glyph(face->glyph, FT_RENDER_MODE_SDF) != 0)
+        {
+            return false;
+        }
+
+        const FT_Bitmap& ft_bitmap = face->glyph->bitmap;
+        rasterised.d_pixels = createGlyphTextureData(ft_bitmap);
+        rasterised.d_width = ft_bitmap.width;
+        rasterised.d_height = ft_bitmap.rows;
+        rasterised.d_top = face->glyph->bitmap_top;
+        rasterised.d_left = face->glyph->bitmap_left;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Load the code point, "rendering" the glyph
+    FT_Int32 targetType = antiAliased ? FT_LOAD_TARGET_NORMAL : FT_LOAD_TARGET_MONO;
+    FT_Int32 loadType = (fontLayerType == FontLayerType::Standard) ? FT_LOAD_RENDER : FT_LOAD_NO_BITMAP;
+    auto loadBitmask = loadType | FT_LOAD_FORCE_AUTOHINT | targetType;
+    FT_Error error = FT_Load_Glyph(face, glyphIndex, loadBitmask);
+
+    if (error != 0)
+    {
+        return false;
+    }
+
+    if (fontLayerType == FontLayerType::Standard)
+    {
+        const FT_Bitmap& ft_bitmap = face->glyph->bitmap;
+        rasterised.d_pixels = createGlyphTextureData(ft_bitmap);
+        rasterised.d_width = ft_bitmap.width;
+        rasterised.d_height = ft_bitmap.rows;
+        rasterised.d_top = face->glyph->bitmap_top;
+        rasterised.d_left = face->glyph->bitmap_left;
+        return true;
+    }
+
+    unsigned int outlinePixels = fontLayer.d_outlinePixels; // n * 64 result in n pixels outline
+    FT_Glyph ft_glyph;
+    FT_Stroker stroker;
+    FT_Stroker_New(s_freetypeLibHandle, &stroker);
+    FT_Stroker_Set(stroker, outlinePixels * 64, getLineCap(fontLayer.d_lineCap),
+        getLineJoin(fontLayer.d_lineJoin), fontLayer.d_miterLimit);
+    if (FT_Get_Glyph(face->glyph, &ft_glyph))
+    {
+        FT_Stroker_Done(stroker);
+        return false;
+    }
+    if (fontLayerType == FontLayerType::Outline)
+        error = FT_Glyph_Stroke(&ft_glyph, stroker, true);
+    if (fontLayerType == FontLayerType::Outer)
+        error = FT_Glyph_StrokeBorder(&ft_glyph, stroker, false, true);
+    if (fontLayerType == FontLayerType::Inner)
+        error = FT_Glyph_StrokeBorder(&ft_glyph, stroker, true, true);
+    FT_Stroker_Done(stroker);
+
+    // A failed stroke leaves the plain outline, which is still rendered
+    error = FT_Glyph_To_Bitmap(&ft_glyph, FT_RENDER_MODE_NORMAL, 0, true);
+    if (error != 0)
+    {
+        FT_Done_Glyph(ft_glyph);
+        return false;
+    }
+
+    FT_BitmapGlyph bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(ft_glyph);
+    rasterised.d_pixels = createGlyphTextureData(bitmapGlyph->bitmap);
+    rasterised.d_width = bitmapGlyph->bitmap.width;
+    rasterised.d_height = bitmapGlyph->bitmap.rows;
+    rasterised.d_top = bitmapGlyph->top;
+    rasterised.d_left = bitmapGlyph->left;
+    FT_Done_Glyph(ft_glyph);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool FreeTypeFont::packGlyphLayers(const std::vector<RasterisedGlyphLayer>& layers,
+    RasterisedGlyphLayer& packed)
+{
+    if (layers.empty())
+        return false;
+
+    // The packed image covers the bitmaps of all the layers
+    int left = layers.front().d_left;
+    int top = layers.front().d_top;
+    int right = left + layers.front().d_width;
+    int bottom = top - layers.front().d_height;
+    for (const RasterisedGlyphLayer& layer : layers)
+    {
+        left = std::min(left, layer.d_left);
+        top = std::max(top, layer.d_top);
+        right = std::max(right, layer.d_left + layer.d_width);
+        bottom = std::min(bottom, layer.d_top - layer.d_height);
+    }
+
+    packed.d_codePoint = layers.front().d_codePoint;
+    packed.d_layer = 0;
+    packed.d_left = left;
+    packed.d_top = top;
+    packed.d_width = right - left;
+    packed.d_height = top - bottom;
+    packed.d_pixels.assign(static_cast<std::size_t>(packed.d_width) * packed.d_height, 0);
+
+    // The coverage is in the alpha of the rasterised pixels. Layer 0 goes to
+    // the alpha of the packed pixels and layers 1 to 3 to the low bytes, which
+    // the textures are uploaded with as red, green and blue (argb_t is stored
+    // little endian).
+    for (const RasterisedGlyphLayer& layer : layers)
+    {
+        const unsigned int shift = (layer.d_layer == 0) ? 24 : 8 * (layer.d_layer - 1);
+        const int offsetX = layer.d_left - left;
+        const int offsetY = top - layer.d_top;
+        for (int y = 0; y < layer.d_height; ++y)
+        {
+            const argb_t* source = layer.d_pixels.data() + y * layer.d_width;
+            argb_t* target = packed.d_pixels.data() + (offsetY + y) * packed.d_width + offsetX;
+            for (int x = 0; x < layer.d_width; ++x)
+                target[x] |= ((source[x] >> 24) & 0xFF) << shift;
+        }
+    }
+
+    return true;
 }
 
 //----------------------------------------------------------------------------//
@@ -948,13 +1122,19 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutAndCreateGlyphRenderGeometry(
     glm::vec2& penPosition) const
 {
 #ifdef CEGUI_USE_RAQM
-    return layoutUsingRaqmAndCreateRenderGeometry(text, clip_rect, colours,
-        space_extra, imgRenderSettings, defaultParagraphDir, penPosition);
+    std::vector<GeometryBuffer*> textGeometryBuffers = layoutUsingRaqmAndCreateRenderGeometry(
+        text, clip_rect, colours, space_extra, imgRenderSettings, defaultParagraphDir, penPosition);
 #else
     CEGUI_UNUSED(defaultParagraphDir);
-    return layoutUsingFreetypeAndCreateRenderGeometry(text, clip_rect, colours,
-        space_extra, imgRenderSettings, penPosition);
+    std::vector<GeometryBuffer*> textGeometryBuffers = layoutUsingFreetypeAndCreateRenderGeometry(
+        text, clip_rect, colours, space_extra, imgRenderSettings, penPosition);
 #endif
+
+    // Upload all the glyphs rasterised for this text at once
+    FreeTypeGlyphAtlas::getInstance()->flush();
+    submitQueuedGlyphRasterisation();
+
+    return textGeometryBuffers;
 }
 
 
@@ -986,8 +1166,10 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingFreetypeAndCreateRenderGeo
     const std::u32string& utf32Text = text.getString();
 #endif
     glm::vec2 penPositionStart = penPosition;
+    std::lock_guard<std::mutex> kerningLock(d_kerningMutex);
 
-    unsigned int layerCount = d_fontLayers.size();
+    // Packed layers are all drawn by the quad of layer 0
+    unsigned int layerCount = d_layersPacked ? 1 : d_fontLayers.size();
     for (int layerTmp = layerCount -1; layerTmp >= 0; layerTmp--) {
     unsigned int layer = static_cast<unsigned int>(layerTmp);
 
@@ -1027,29 +1209,23 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingFreetypeAndCreateRenderGeo
 
         if (i >= 1)
         {
-            FT_Vector kerning;
-
-            unsigned int rightGlyphIndex = glyph->getGlyphIndex();
-
-            FT_Get_Kerning(d_fontFace, previousGlyphIndex, rightGlyphIndex,
-                FT_KERNING_DEFAULT, &kerning);
-
-            penPosition.x += kerning.x * s_conversionMultCoeff;
+            penPosition.x += getKerning(previousGlyphIndex, glyph->getGlyphIndex());
         }
         previousGlyphIndex = glyph->getGlyphIndex();
 
             const Image* const image = glyph->getImage(layer);
             if (image)
             {
-                imgRenderSettings.d_destArea =
-                    Rectf(penPosition, image->getRenderedSize());
+                FreeTypeGlyphAtlas::getInstance()->markUsed(*image);
+
+                imgRenderSettings.d_destArea = getGlyphDestArea(*glyph, *image, penPosition);
 
                 const CEGUI::ColourRect fallbackColour;
                 const CEGUI::ColourRect& currentlayerColour = (layer < layerColours.size()) ?
                     layerColours[layer] : fallbackColour;
 
                 addGlyphRenderGeometry(textGeometryBuffers, image, imgRenderSettings,
-                    clip_rect, currentlayerColour);
+                    clip_rect, currentlayerColour, layer == 0);
             }
 
         penPosition.x += glyph->getAdvance();
@@ -1063,6 +1239,14 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingFreetypeAndCreateRenderGeo
     }
 
     } //for layers
+
+    if (d_layersPacked)
+    {
+        const glm::mat4 layerColourMatrix = getLayerColourMatrix(layerColours);
+        for (GeometryBuffer* buffer : textGeometryBuffers)
+            buffer->setLayerColours(layerColourMatrix);
+    }
+
     return textGeometryBuffers;
 }
 
@@ -1090,34 +1274,22 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingRaqmAndCreateRenderGeometr
         return textGeometryBuffers;
     }
 
-#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII)
-    std::u32string utf32Text = String::convertUtf8ToUtf32(text.c_str());
-    size_t origTextLength = utf32Text.length();
-    const uint32_t* originalTextArray = reinterpret_cast<const std::uint32_t*>(utf32Text.c_str());
-#elif (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32) 
-    size_t origTextLength = text.length();
-    const uint32_t* originalTextArray = reinterpret_cast<const std::uint32_t*>(text.c_str());
-#endif
+    const std::u32string utf32Text = convertToUtf32(text);
+    const std::shared_ptr<const ShapedRun> shapedRun = getShapedRun(utf32Text, defaultParagraphDir);
     glm::vec2 penPositionStart = penPosition;
 
-    raqm_t* raqmObject = createAndSetupRaqmTextObject(
-        originalTextArray, origTextLength, defaultParagraphDir, getFontFace());
-
-    const std::size_t layerCount = d_fontLayers.size();
+    // Packed layers are all drawn by the quad of layer 0
+    const std::size_t layerCount = d_layersPacked ? 1 : d_fontLayers.size();
     for (int layerTmp = layerCount - 1; layerTmp >= 0; layerTmp--) {
         unsigned int layer = static_cast<unsigned int>(layerTmp);
 
-        size_t count = 0;
-        raqm_glyph_t* glyphs = raqm_get_glyphs(raqmObject, &count);
         penPosition = penPositionStart;
         penPosition.y += getBaseline();
 
-        for (size_t i = 0; i < count; i++)
+        for (const ShapedGlyph& currentGlyph : *shapedRun)
         {
-            raqm_glyph_t& currentGlyph = glyphs[i];
-
             char32_t codePoint;
-            auto foundCodePointIter = d_indexToGlyphMap.find(currentGlyph.index);
+            auto foundCodePointIter = d_indexToGlyphMap.find(currentGlyph.d_index);
             if (foundCodePointIter != d_indexToGlyphMap.end())
             {
                 codePoint = foundCodePointIter->second;
@@ -1128,7 +1300,7 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingRaqmAndCreateRenderGeometr
             }
 
             // Ignore new line characters
-            if (originalTextArray[currentGlyph.cluster] == '\n')
+            if (utf32Text[currentGlyph.d_cluster] == '\n')
             {
                 continue;
             }
@@ -1149,28 +1321,24 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingRaqmAndCreateRenderGeometr
 
             const Image* const image = glyph->getImage(layer);
             if (image) {
-                imgRenderSettings.d_destArea =
-                    Rectf(penPosition, image->getRenderedSize());
+                FreeTypeGlyphAtlas::getInstance()->markUsed(*image);
 
                 penPosition.x = std::round(penPosition.x);
 
                 //The glyph pos will be rounded to full pixels internally
-                glm::vec2 renderGlyphPos(
-                    penPosition.x + currentGlyph.x_offset * s_conversionMultCoeff,
-                    penPosition.y + currentGlyph.y_offset * s_conversionMultCoeff);
+                const glm::vec2 renderGlyphPos(penPosition + currentGlyph.d_offset);
 
-                imgRenderSettings.d_destArea =
-                    Rectf(renderGlyphPos, image->getRenderedSize());
+                imgRenderSettings.d_destArea = getGlyphDestArea(*glyph, *image, renderGlyphPos);
 
                 const CEGUI::ColourRect fallbackColour;
                 const CEGUI::ColourRect& currentlayerColour = (layer < layerColours.size()) ?
                     layerColours[layer] : fallbackColour;
 
                 addGlyphRenderGeometry(textGeometryBuffers, image, imgRenderSettings,
-                    clip_rect, currentlayerColour);
+                    clip_rect, currentlayerColour, layer == 0);
             }
 
-            penPosition.x += currentGlyph.x_advance * s_conversionMultCoeff;
+            penPosition.x += currentGlyph.d_advance;
 
             if (codePoint == ' ')
             {
@@ -1179,14 +1347,246 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingRaqmAndCreateRenderGeometr
                 penPosition.x += space_extra;
             }
         }
+    }
 
-        raqm_destroy(raqmObject);
+    if (d_layersPacked)
+    {
+        const glm::mat4 layerColourMatrix = getLayerColourMatrix(layerColours);
+        for (GeometryBuffer* buffer : textGeometryBuffers)
+            buffer->setLayerColours(layerColourMatrix);
     }
 
     return textGeometryBuffers;
 }
+
+//----------------------------------------------------------------------------//
+std::shared_ptr<const FreeTypeFont::ShapedRun> FreeTypeFont::getShapedRun(
+    const std::u32string& text, DefaultParagraphDirection defaultParagraphDir) const
+{
+    ShapedRunKey key = { this, defaultParagraphDir, text };
+
+    auto found = s_shapedRunIndex.find(key);
+    if (found != s_shapedRunIndex.end())
+    {
+        s_shapedRuns.splice(s_shapedRuns.begin(), s_shapedRuns, found->second);
+        return found->second->second;
+    }
+
+    raqm_t* raqmObject = createAndSetupRaqmTextObject(
+        reinterpret_cast<const std::uint32_t*>(text.c_str()), text.length(),
+        defaultParagraphDir, d_fontFace);
+
+    size_t count = 0;
+    const raqm_glyph_t* glyphs = raqm_get_glyphs(raqmObject, &count);
+
+    std::shared_ptr<ShapedRun> shapedRun = std::make_shared<ShapedRun>();
+    shapedRun->reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const ShapedGlyph shapedGlyph = { glyphs[i].index, glyphs[i].cluster,
+            glyphs[i].x_advance * s_conversionMultCoeff,
+            glm::vec2(glyphs[i].x_offset, glyphs[i].y_offset) * s_conversionMultCoeff };
+        shapedRun->push_back(shapedGlyph);
+    }
+
+    raqm_destroy(raqmObject);
+
+    s_shapedRuns.emplace_front(key, shapedRun);
+    s_shapedRunIndex.emplace(std::move(key), s_shapedRuns.begin());
+
+    while (s_shapedRuns.size() > ShapedRunCacheCapacity)
+    {
+        s_shapedRunIndex.erase(s_shapedRuns.back().first);
+        s_shapedRuns.pop_back();
+    }
+
+    return shapedRun;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::releaseShapedRuns() const
+{
+    for (auto it = s_shapedRuns.begin(); it != s_shapedRuns.end(); )
+    {
+        if (it->first.d_font == this)
+        {
+            s_shapedRunIndex.erase(it->first);
+            it = s_shapedRuns.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+size_t FreeTypeFont::getShapedRunCount()
+{
+    return s_shapedRuns.size();
+}
+
+//----------------------------------------------------------------------------//
+float FreeTypeFont::getTextAdvance(const String& text) const
+{
+    if (text.empty())
+        return 0.0f;
+
+    float advance = 0.0f;
+    for (const ShapedGlyph& shapedGlyph :
+         *getShapedRun(convertToUtf32(text), DefaultParagraphDirection::LeftToRight))
+    {
+        advance += shapedGlyph.d_advance;
+    }
+
+    return advance;
+}
+
+//----------------------------------------------------------------------------//
+float FreeTypeFont::getTextExtent(const String& text) const
+{
+    if (text.empty())
+        return 0.0f;
+
+    float cur_extent = 0.0f;
+    float adv_extent = 0.0f;
+
+    for (const ShapedGlyph& shapedGlyph :
+         *getShapedRun(convertToUtf32(text), DefaultParagraphDirection::LeftToRight))
+    {
+        auto foundCodePointIter = d_indexToGlyphMap.find(shapedGlyph.d_index);
+        const FreeTypeFontGlyph* glyph = getPreparedGlyph(
+            foundCodePointIter != d_indexToGlyphMap.end() ?
+                foundCodePointIter->second : UnicodeReplacementCharacter);
+
+        if (glyph != nullptr)
+        {
+            cur_extent = std::max(cur_extent,
+                adv_extent + shapedGlyph.d_offset.x + glyph->getRenderedAdvance());
+        }
+
+        adv_extent += shapedGlyph.d_advance;
+    }
+
+    return std::max(adv_extent, cur_extent);
+}
+
+//----------------------------------------------------------------------------//
+size_t FreeTypeFont::getCharAtPixel(const String& text, size_t start_char, float pixel) const
+{
+    const size_t char_count = text.length();
+
+    // handle simple cases
+    if ((pixel <= 0) || (char_count <= start_char))
+        return start_char;
+
+    float cur_extent = 0.0f;
+    for (const ShapedGlyph& shapedGlyph :
+         *getShapedRun(convertToUtf32(text), DefaultParagraphDirection::LeftToRight))
+    {
+        if (shapedGlyph.d_cluster < start_char)
+            continue;
+
+        cur_extent += shapedGlyph.d_advance;
+
+        if (pixel < cur_extent)
+            return getCodeUnitIndex(text, shapedGlyph.d_cluster);
+    }
+
+    return char_count;
+}
+#else
+//----------------------------------------------------------------------------//
+float FreeTypeFont::getTextExtent(const String& text) const
+{
+    if (!d_hasKerning)
+        return Font::getTextExtent(text);
+
+    float cur_extent = 0.0f;
+    float adv_extent = 0.0f;
+    FT_UInt previousGlyphIndex = 0;
+
+    std::lock_guard<std::mutex> kerningLock(d_kerningMutex);
+    for (const char32_t codePoint : convertToUtf32(text))
+    {
+        const FreeTypeFontGlyph* glyph = getPreparedGlyph(codePoint);
+        if (glyph == nullptr)
+            continue;
+
+        if (previousGlyphIndex != 0)
+            adv_extent += getKerning(previousGlyphIndex, glyph->getGlyphIndex());
+
+        cur_extent = std::max(cur_extent, adv_extent + glyph->getRenderedAdvance());
+        adv_extent += glyph->getAdvance();
+        previousGlyphIndex = glyph->getGlyphIndex();
+    }
+
+    return std::max(adv_extent, cur_extent);
+}
+
+//----------------------------------------------------------------------------//
+float FreeTypeFont::getTextAdvance(const String& text) const
+{
+    if (!d_hasKerning)
+        return Font::getTextAdvance(text);
+
+    float advance = 0.0f;
+    FT_UInt previousGlyphIndex = 0;
+
+    std::lock_guard<std::mutex> kerningLock(d_kerningMutex);
+    for (const char32_t codePoint : convertToUtf32(text))
+    {
+        const FreeTypeFontGlyph* glyph = getPreparedGlyph(codePoint);
+        if (glyph == nullptr)
+            continue;
+
+        if (previousGlyphIndex != 0)
+            advance += getKerning(previousGlyphIndex, glyph->getGlyphIndex());
+
+        advance += glyph->getAdvance();
+        previousGlyphIndex = glyph->getGlyphIndex();
+    }
+
+    return advance;
+}
 #endif
 
+//----------------------------------------------------------------------------//
+float FreeTypeFont::getKerning(FT_UInt leftGlyphIndex, FT_UInt rightGlyphIndex) const
+{
+    if (!d_hasKerning)
+        return 0.0f;
+
+    const std::uint64_t key =
+        (static_cast<std::uint64_t>(leftGlyphIndex) << 32) | rightGlyphIndex;
+
+    auto found = d_kerningCache.find(key);
+    if (found != d_kerningCache.end())
+        return found->second;
+
+    FT_Vector kerning;
+    const float value = (FT_Get_Kerning(d_fontFace, leftGlyphIndex, rightGlyphIndex,
+        FT_KERNING_DEFAULT, &kerning) == 0) ? kerning.x * s_conversionMultCoeff : 0.0f;
+
+    d_kerningCache.emplace(key, value);
+    return value;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::resetKerningCache()
+{
+    std::lock_guard<std::mutex> kerningLock(d_kerningMutex);
+    d_kerningCache.clear();
+    d_hasKerning = d_fontFace && FT_HAS_KERNING(d_fontFace);
+}
+
+//----------------------------------------------------------------------------//
+size_t FreeTypeFont::getCachedKerningPairCount() const
+{
+    std::lock_guard<std::mutex> kerningLock(d_kerningMutex);
+    return d_kerningCache.size();
+}
+
 bool FreeTypeFont::isCodepointAvailable(char32_t codePoint) const
 {
     return d_codePointToGlyphMap.find(codePoint) != d_codePointToGlyphMap.end();
@@ -1213,6 +1613,20 @@ void FreeTypeFont::setInitialGlyphAtlasSize(int val)
     d_initialGlyphAtlasSize = val;
 }
 
+void FreeTypeFont::notifyGlyphImageUsed(const Image& image) const
+{
+    // Keeps the atlas page of a glyph drawn from a cached layout from eviction
+    FreeTypeGlyphAtlas::getInstance()->markUsed(image);
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::prepareGlyphGeometryBuffer(GeometryBuffer& buffer) const
+{
+    // Texts drawn in a single colour leave the other layers black
+    if (d_layersPacked)
+        buffer.setLayerColours(getLayerColourMatrix(std::vector<ColourRect>()));
+}
+
 const FreeTypeFontGlyph* FreeTypeFont::getPreparedGlyph(char32_t currentCodePoint) const
 {
     FreeTypeFontGlyph* glyph = getGlyphForCodepoint(currentCodePoint);
@@ -1225,5 +1639,437 @@ const FreeTypeFontGlyph* FreeTypeFont::getPreparedGlyph(char32_t currentCodePoin
     return glyph;
 }
 
+//----------------------------------------------------------------------------//
+void FreeTypeFont::setAsynchronousRasterisation(bool enabled)
+{
+    if (enabled == d_asynchronousRasterisation)
+        return;
+
+    // Glyphs already queued are still rasterised in the background
+    d_asynchronousRasterisation = enabled;
+}
+
+//----------------------------------------------------------------------------//
+bool FreeTypeFont::isAsynchronousRasterisation() const
+{
+    return d_asynchronousRasterisation;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::setDistanceField(bool enabled)
+{
+    if (enabled == d_distanceField)
+        return;
+
+    d_distanceField = enabled;
+
+    // The glyphs have to be rasterised again either way
+    free();
+    updateFont();
+
+    FontEventArgs args(this);
+    onRenderSizeChanged(args);
+}
+
+//----------------------------------------------------------------------------//
+bool FreeTypeFont::isDistanceField() const
+{
+    return d_distanceField;
+}
+
+//----------------------------------------------------------------------------//
+bool FreeTypeFont::isDistanceFieldActive() const
+{
+    return d_distanceFieldActive;
+}
+
+//----------------------------------------------------------------------------//
+bool FreeTypeFont::isLayerPackingActive() const
+{
+    return d_layersPacked;
+}
+
+//----------------------------------------------------------------------------//
+Rectf FreeTypeFont::getGlyphDestArea(const FreeTypeFontGlyph& glyph, const Image& image,
+    const glm::vec2& position) const
+{
+    // The image offset is applied unscaled when drawing, so add the difference
+    const float scale = glyph.getImageScale();
+    return Rectf(position + image.getRenderedOffset() * (scale - 1.0f),
+                 image.getRenderedSize() * scale);
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::prepareGlyphs_impl(const std::u32string& codePoints) const
+{
+    for (const char32_t codePoint : codePoints)
+        getPreparedGlyph(codePoint);
+
+    // Upload the whole batch at once, or hand it to the background as one task
+    FreeTypeGlyphAtlas::getInstance()->flush();
+    submitQueuedGlyphRasterisation();
+}
+
+//----------------------------------------------------------------------------//
+size_t FreeTypeFont::getRasterisedGlyphLayerCount() const
+{
+    return d_rasterisedGlyphLayerCount;
+}
+
+//----------------------------------------------------------------------------//
+double FreeTypeFont::getRasterisationTime() const
+{
+    return d_rasterisationTime;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::writeBakedFont(std::ostream& out,
+    const std::vector<char32_t>& codePoints, int pageSize) const
+{
+    struct BakedGlyphData
+    {
+        char32_t d_codePoint;
+        FT_UInt d_index;
+        RasterisedGlyphLayer d_layer;
+        float d_advance;
+        std::uint32_t d_page;
+        int d_x;
+        int d_y;
+    };
+
+    std::vector<char32_t> sortedCodePoints(codePoints);
+    std::sort(sortedCodePoints.begin(), sortedCodePoints.end());
+    sortedCodePoints.erase(std::unique(sortedCodePoints.begin(), sortedCodePoints.end()),
+                           sortedCodePoints.end());
+
+    // Rasterise the standard layer of every glyph as a bitmap
+    std::vector<BakedGlyphData> glyphs;
+    for (const char32_t codePoint : sortedCodePoints)
+    {
+        const auto glyphIter = d_codePointToGlyphMap.find(codePoint);
+        if (glyphIter == d_codePointToGlyphMap.end() || !loadGlyphMetrics(glyphIter->second))
+            continue;
+
+        BakedGlyphData glyph;
+        glyph.d_codePoint = codePoint;
+        glyph.d_index = glyphIter->second->getGlyphIndex();
+        glyph.d_advance = glyphIter->second->getAdvance();
+        glyph.d_layer.d_codePoint = codePoint;
+        glyph.d_layer.d_layer = 0;
+        if (!rasteriseGlyphLayer(d_fontFace, glyph.d_index, FreeTypeFontLayer(),
+                                 d_antiAliased, false, glyph.d_layer))
+        {
+            glyph.d_layer.d_width = glyph.d_layer.d_height = 0;
+            glyph.d_layer.d_left = glyph.d_layer.d_top = 0;
+        }
+        glyphs.push_back(std::move(glyph));
+    }
+
+    // Pack the bitmaps into pages by shelves, keeping a pixel between glyphs
+    std::uint32_t pageCount = 1;
+    int x = 1, y = 1, shelfHeight = 0;
+    for (BakedGlyphData& glyph : glyphs)
+    {
+        const int width = glyph.d_layer.d_width;
+        const int height = glyph.d_layer.d_height;
+        if (width + 2 > pageSize || height + 2 > pageSize)
+            throw InvalidRequestException("The glyph for code point " +
+                PropertyHelper<std::uint32_t>::toString(glyph.d_codePoint) +
+                " of font '" + d_name + "' does not fit a baked font page of size " +
+                PropertyHelper<int>::toString(pageSize) + ".");
+
+        if (x + width + 1 > pageSize)
+        {
+            x = 1;
+            y += shelfHeight + 1;
+            shelfHeight = 0;
+        }
+        if (y + height + 1 > pageSize)
+        {
+            ++pageCount;
+            x = y = 1;
+            shelfHeight = 0;
+        }
+
+        glyph.d_page = pageCount - 1;
+        glyph.d_x = x;
+        glyph.d_y = y;
+        x += width + 1;
+        shelfHeight = std::max(shelfHeight, height);
+    }
+
+    // Kerning pairs between all the baked glyphs
+    struct KerningPair
+    {
+        char32_t d_left;
+        char32_t d_right;
+        float d_adjustment;
+    };
+    std::vector<KerningPair> kerningPairs;
+    if (FT_HAS_KERNING(d_fontFace))
+    {
+        for (const BakedGlyphData& left : glyphs)
+        {
+            for (const BakedGlyphData& right : glyphs)
+            {
+                FT_Vector kerning;
+                if (FT_Get_Kerning(d_fontFace, left.d_index, right.d_index,
+                                   FT_KERNING_DEFAULT, &kerning) == 0 && kerning.x != 0)
+                {
+                    kerningPairs.push_back({ left.d_codePoint, right.d_codePoint,
+                                             kerning.x * s_conversionMultCoeff });
+                }
+            }
+        }
+    }
+
+    out.write(BakedFont::FileMagic, sizeof(BakedFont::FileMagic));
+    writeBakedU32(out, BakedFont::FileVersion);
+    writeBakedF32(out, d_ascender);
+    writeBakedF32(out, d_descender);
+    writeBakedF32(out, d_height);
+    writeBakedU32(out, static_cast<std::uint32_t>(glyphs.size()));
+    writeBakedU32(out, static_cast<std::uint32_t>(kerningPairs.size()));
+    writeBakedU32(out, pageCount);
+    writeBakedU32(out, static_cast<std::uint32_t>(pageSize));
+
+    for (const BakedGlyphData& glyph : glyphs)
+    {
+        writeBakedU32(out, glyph.d_codePoint);
+        writeBakedU32(out, glyph.d_page);
+        writeBakedU32(out, static_cast<std::uint32_t>(glyph.d_x));
+        writeBakedU32(out, static_cast<std::uint32_t>(glyph.d_y));
+        writeBakedU32(out, static_cast<std::uint32_t>(glyph.d_layer.d_width));
+        writeBakedU32(out, static_cast<std::uint32_t>(glyph.d_layer.d_height));
+        // Same offset as the one of the glyph images created for the atlas
+        writeBakedF32(out, static_cast<float>(glyph.d_layer.d_left));
+        writeBakedF32(out, static_cast<float>(-glyph.d_layer.d_top));
+        writeBakedF32(out, glyph.d_advance);
+    }
+
+    for (const KerningPair& pair : kerningPairs)
+    {
+        writeBakedU32(out, pair.d_left);
+        writeBakedU32(out, pair.d_right);
+        writeBakedF32(out, pair.d_adjustment);
+    }
+
+    std::vector<argb_t> page(static_cast<size_t>(pageSize) * pageSize);
+    for (std::uint32_t pageIndex = 0; pageIndex < pageCount; ++pageIndex)
+    {
+        std::fill(page.begin(), page.end(), 0);
+        for (const BakedGlyphData& glyph : glyphs)
+        {
+            if (glyph.d_page != pageIndex)
+                continue;
+
+            for (int row = 0; row < glyph.d_layer.d_height; ++row)
+                std::copy_n(glyph.d_layer.d_pixels.begin() + row * glyph.d_layer.d_width,
+                            glyph.d_layer.d_width,
+                            page.begin() + (glyph.d_y + row) * pageSize + glyph.d_x);
+        }
+
+        for (const argb_t pixel : page)
+            writeBakedU32(out, pixel);
+    }
+
+    if (!out)
+        throw FileIOException("Writing the baked font file of font '" + d_name + "' failed.");
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::processRasterisedGlyphs()
+{
+    if (s_fontsRasterisingGlyphs.empty())
+        return;
+
+    bool glyphsAdded = false;
+
+    // Collecting may finish the work of a font and remove it from the list
+    const std::vector<const FreeTypeFont*> fonts(s_fontsRasterisingGlyphs);
+    for (const FreeTypeFont* font : fonts)
+    {
+        glyphsAdded |= font->collectRasterisedGlyphs();
+        font->submitQueuedGlyphRasterisation();
+    }
+
+    if (glyphsAdded)
+    {
+        FreeTypeGlyphAtlas::getInstance()->flush();
+        // The text drawn with the blank glyphs is cached by the windows
+        System::getSingleton().invalidateAllCachedRendering();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::queueGlyphRasterisation(const FreeTypeFontGlyph* glyph) const
+{
+    d_queuedCodePoints.push_back(glyph->getCodePoint());
+
+    if (std::find(s_fontsRasterisingGlyphs.begin(), s_fontsRasterisingGlyphs.end(), this) ==
+        s_fontsRasterisingGlyphs.end())
+    {
+        s_fontsRasterisingGlyphs.push_back(this);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::submitQueuedGlyphRasterisation() const
+{
+    // A single task per font at a time, so that only it uses the face
+    if (d_rasterisationTask != 0 || d_queuedCodePoints.empty())
+        return;
+
+    if (!d_rasterisationFontFace)
+    {
+        FT_Error error = FT_New_Memory_Face(s_freetypeLibHandle, d_fontData.getDataPtr(),
+            static_cast<FT_Long>(d_fontData.getSize()), 0, &d_rasterisationFontFace);
+        if (error != 0)
+            findAndThrowFreeTypeError(error, "Failed to create the face for background rasterisation");
+
+        if (d_distanceFieldActive)
+            FT_Set_Pixel_Sizes(d_rasterisationFontFace, 0, DistanceFieldBaseSize);
+        else
+            FT_Set_Pixel_Sizes(d_rasterisationFontFace, d_fontFace->size->metrics.x_ppem,
+                               d_fontFace->size->metrics.y_ppem);
+    }
+
+    std::vector<std::pair<char32_t, FT_UInt>> glyphs;
+    glyphs.reserve(d_queuedCodePoints.size());
+    for (const char32_t codePoint : d_queuedCodePoints)
+    {
+        const FreeTypeFontGlyph* glyph = getGlyphForCodepoint(codePoint);
+        glyphs.emplace_back(codePoint, glyph->getGlyphIndex());
+    }
+    d_queuedCodePoints.clear();
+
+    d_rasterisationFinished = false;
+    d_rasterisationScheduler = &System::getSingleton().getTaskScheduler();
+
+    // The task works on copies, the font may be changed while it runs
+    FT_Face face = d_rasterisationFontFace;
+    const FreeTypeFontLayerVector fontLayers(d_fontLayers);
+    const bool antiAliased = d_antiAliased;
+    const bool distanceField = d_distanceFieldActive;
+    const bool layersPacked = d_layersPacked;
+    d_rasterisationTask = d_rasterisationScheduler->submit(
+        [this, face, fontLayers, antiAliased, distanceField, layersPacked, glyphs]()
+    {
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<RasterisedGlyphLayer> rasterisedGlyphs;
+        std::vector<RasterisedGlyphLayer> glyphLayers;
+        for (const auto& glyph : glyphs)
+        {
+            glyphLayers.clear();
+            for (unsigned int layer = 0; layer < fontLayers.size(); ++layer)
+            {
+                RasterisedGlyphLayer rasterised;
+                rasterised.d_codePoint = glyph.first;
+                rasterised.d_layer = layer;
+
+                // Unsupported pixel modes throw, such layers stay blank
+                try
+                {
+                    if (rasteriseGlyphLayer(face, glyph.second, fontLayers[layer],
+                                            antiAliased, distanceField, rasterised))
+                    {
+                        glyphLayers.push_back(std::move(rasterised));
+                    }
+                }
+                catch (const InvalidRequestException&)
+                {
+                }
+            }
+
+            if (layersPacked)
+            {
+                RasterisedGlyphLayer packed;
+                if (packGlyphLayers(glyphLayers, packed))
+                    rasterisedGlyphs.push_back(std::move(packed));
+            }
+            else
+            {
+                std::move(glyphLayers.begin(), glyphLayers.end(),
+                          std::back_inserter(rasterisedGlyphs));
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(d_rasterisationMutex);
+        d_rasterisedGlyphs = std::move(rasterisedGlyphs);
+        d_backgroundRasterisationTime = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        d_rasterisationFinished = true;
+    });
+}
+
+//----------------------------------------------------------------------------//
+bool FreeTypeFont::collectRasterisedGlyphs() const
+{
+    if (d_rasterisationTask == 0)
+        return false;
+
+    std::vector<RasterisedGlyphLayer> rasterisedGlyphs;
+    double rasterisationTime;
+    {
+        std::lock_guard<std::mutex> lock(d_rasterisationMutex);
+        if (!d_rasterisationFinished)
+            return false;
+
+        rasterisedGlyphs.swap(d_rasterisedGlyphs);
+        rasterisationTime = d_backgroundRasterisationTime;
+    }
+
+    d_rasterisationScheduler->wait(d_rasterisationTask);
+    d_rasterisationTask = 0;
+
+    d_rasterisedGlyphLayerCount += rasterisedGlyphs.size();
+    d_rasterisationTime += rasterisationTime;
+    if (Logger* logger = Logger::getSingletonPtr())
+    {
+        std::stringstream& sstream = SharedStringstream::GetPreparedStream();
+        sstream << "FreeTypeFont '" << d_name << "': rasterised " << rasterisedGlyphs.size()
+                << " glyph layers in the background in " << rasterisationTime * 1000.0 << " ms";
+        logger->logEvent(sstream.str(), LoggingLevel::Insane);
+    }
+
+    for (const RasterisedGlyphLayer& rasterised : rasterisedGlyphs)
+    {
+        FreeTypeFontGlyph* glyph = getGlyphForCodepoint(rasterised.d_codePoint);
+        // Skip layers which were rasterised synchronously meanwhile
+        if (glyph->isInitialised() && glyph->getImage(rasterised.d_layer) == nullptr)
+            addRasterisedGlyphLayer(*glyph, rasterised);
+    }
+
+    if (d_queuedCodePoints.empty())
+    {
+        s_fontsRasterisingGlyphs.erase(std::find(s_fontsRasterisingGlyphs.begin(),
+            s_fontsRasterisingGlyphs.end(), this));
+    }
+
+    return !rasterisedGlyphs.empty();
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::cancelGlyphRasterisation()
+{
+    if (d_rasterisationTask != 0)
+    {
+        d_rasterisationScheduler->wait(d_rasterisationTask);
+        d_rasterisationTask = 0;
+    }
+
+    d_rasterisedGlyphs.clear();
+    d_queuedCodePoints.clear();
+
+    auto it = std::find(s_fontsRasterisingGlyphs.begin(), s_fontsRasterisingGlyphs.end(), this);
+    if (it != s_fontsRasterisingGlyphs.end())
+        s_fontsRasterisingGlyphs.erase(it);
+
+    if (d_rasterisationFontFace)
+    {
+        FT_Done_Face(d_rasterisationFontFace);
+        d_rasterisationFontFace = nullptr;
+    }
+}
 
 } // End of  CEGUI namespace section
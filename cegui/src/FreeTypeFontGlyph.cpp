@@ -43,7 +43,7 @@ float FreeTypeFontGlyph::getRenderedAdvance() const
     float sizeX = img->getRenderedSize().d_width + img->getRenderedOffset().x;
 #endif
 
-    return sizeX;
+    return sizeX * d_imageScale;
 }
 
 void FreeTypeFontGlyph::markAsInitialised()
@@ -51,6 +51,11 @@ void FreeTypeFontGlyph::markAsInitialised()
     d_initialised = true;
 }
 
+void FreeTypeFontGlyph::markAsUninitialised()
+{
+    d_initialised = false;
+}
+
 bool FreeTypeFontGlyph::isInitialised() const
 {
     return d_initialised;
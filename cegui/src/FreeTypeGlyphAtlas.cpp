@@ -0,0 +1,442 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/FreeTypeGlyphAtlas.h"
+#include "CEGUI/FreeTypeFontGlyph.h"
+#include "CEGUI/Font.h"
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/PropertyHelper.h"
+#include <algorithm>
+#include <limits>
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// Pixels to put between glyphs
+static const int s_glyphPadding = 1;
+
+//----------------------------------------------------------------------------//
+// Multiplies the colour channels of a pixel by its alpha.
+static argb_t premultiplyArgb(argb_t pixel)
+{
+    const argb_t alpha = pixel >> 24;
+    const argb_t red = (((pixel >> 16) & 0xFF) * alpha + 127) / 255;
+    const argb_t green = (((pixel >> 8) & 0xFF) * alpha + 127) / 255;
+    const argb_t blue = ((pixel & 0xFF) * alpha + 127) / 255;
+
+    return (alpha << 24) | (red << 16) | (green << 8) | blue;
+}
+
+const size_t FreeTypeGlyphAtlas::DefaultMemoryBudget = 2048 * 2048 * sizeof(argb_t);
+FreeTypeGlyphAtlas* FreeTypeGlyphAtlas::s_instance = nullptr;
+size_t FreeTypeGlyphAtlas::s_memoryBudget = FreeTypeGlyphAtlas::DefaultMemoryBudget;
+
+//----------------------------------------------------------------------------//
+void FreeTypeGlyphAtlas::createInstance()
+{
+    if (!s_instance)
+        s_instance = new FreeTypeGlyphAtlas();
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeGlyphAtlas::destroyInstance()
+{
+    delete s_instance;
+    s_instance = nullptr;
+}
+
+//----------------------------------------------------------------------------//
+FreeTypeGlyphAtlas* FreeTypeGlyphAtlas::getInstance()
+{
+    return s_instance;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeGlyphAtlas::setMemoryBudget(size_t bytes)
+{
+    s_memoryBudget = bytes;
+}
+
+//----------------------------------------------------------------------------//
+size_t FreeTypeGlyphAtlas::getMemoryBudget()
+{
+    return s_memoryBudget;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeGlyphAtlas::notifyFrameEnded()
+{
+    if (!s_instance)
+        return;
+
+    s_instance->flush();
+
+    if (s_instance->getMemoryUsage() > s_memoryBudget)
+        s_instance->evictUnusedPages();
+
+    ++s_instance->d_frame;
+}
+
+//----------------------------------------------------------------------------//
+FreeTypeGlyphAtlas::FreeTypeGlyphAtlas() :
+    d_lastUsedPage(nullptr),
+    d_frame(0),
+    d_createdPageCount(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+FreeTypeGlyphAtlas::~FreeTypeGlyphAtlas()
+{
+    while (!d_pages.empty())
+        destroyPage(d_pages.back());
+}
+
+//----------------------------------------------------------------------------//
+BitmapImage* FreeTypeGlyphAtlas::addGlyph(const FreeTypeFont& font,
+    FreeTypeFontGlyph& glyph, unsigned int layer, const std::vector<argb_t>& pixels,
+    int width, int height, const String& name, const glm::vec2& offset,
+    const Sizef& nativeResolution, int initialPageSize, DefaultShaderType shaderType)
+{
+    const int maxTextureSize = static_cast<int>(
+        System::getSingleton().getRenderer()->getMaxTextureSize());
+
+    if (width > maxTextureSize || height > maxTextureSize)
+    {
+        throw InvalidRequestException("Can not rasterise a glyph that is larger "
+            "than the maximum supported texture size.");
+    }
+
+    const int paddedWidth = width + s_glyphPadding;
+    const int paddedHeight = height + s_glyphPadding;
+
+    // Prefer the page where the glyph raises the skyline the least, growing
+    // the most recent page and then creating a new one as a last resort.
+    // Distance fields and packed layers are drawn with other shaders, so they
+    // never share a page (and thus a GeometryBuffer) with plain glyphs.
+    Page* targetPage = nullptr;
+    Page* lastPage = nullptr;
+    int targetNode = -1;
+    glm::ivec2 position;
+    int bestTop = std::numeric_limits<int>::max();
+    for (Page* page : d_pages)
+    {
+        if (page->d_shaderType != shaderType)
+            continue;
+
+        lastPage = page;
+        glm::ivec2 pagePosition;
+        const int node = page->d_packer.findPosition(paddedWidth, paddedHeight, pagePosition);
+        if (node >= 0 && pagePosition.y + paddedHeight < bestTop)
+        {
+            bestTop = pagePosition.y + paddedHeight;
+            targetPage = page;
+            targetNode = node;
+            position = pagePosition;
+        }
+    }
+
+    while (!targetPage && lastPage && growPage(*lastPage, maxTextureSize))
+    {
+        targetNode = lastPage->d_packer.findPosition(paddedWidth, paddedHeight, position);
+        if (targetNode >= 0)
+            targetPage = lastPage;
+    }
+
+    if (!targetPage)
+    {
+        int pageSize = std::max(initialPageSize, 1);
+        while (pageSize < std::min(std::max(paddedWidth, paddedHeight), maxTextureSize))
+            pageSize = std::min(pageSize * 2, maxTextureSize);
+
+        targetPage = createPage(pageSize, shaderType);
+        targetNode = targetPage->d_packer.findPosition(std::min(paddedWidth, pageSize),
+                                                       std::min(paddedHeight, pageSize),
+                                                       position);
+    }
+
+    Page& page = *targetPage;
+    page.d_packer.addRectangle(targetNode, position,
+                               std::min(paddedWidth, page.d_size - position.x),
+                               std::min(paddedHeight, page.d_size - position.y));
+
+    // Copy the glyph into the memory of the page, the texture is updated on flush
+    const bool premultiply = shaderType == DefaultShaderType::Textured &&
+        System::getSingleton().getRenderer()->isPremultipliedAlphaEnabled();
+    for (int y = 0; y < height; ++y)
+    {
+        const auto rowBegin = pixels.begin() + y * width;
+        const auto target = page.d_buffer.begin() + (position.y + y) * page.d_size + position.x;
+
+        if (premultiply)
+            std::transform(rowBegin, rowBegin + width, target, premultiplyArgb);
+        else
+            std::copy(rowBegin, rowBegin + width, target);
+    }
+
+    page.d_dirtyMin = glm::min(page.d_dirtyMin, position);
+    page.d_dirtyMax = glm::max(page.d_dirtyMax, position + glm::ivec2(width, height));
+    page.d_lastUsedFrame = d_frame;
+
+    const Rectf area(static_cast<float>(position.x), static_cast<float>(position.y),
+                     static_cast<float>(position.x + width),
+                     static_cast<float>(position.y + height));
+
+    BitmapImage* image = new BitmapImage(name, page.d_texture, area, offset,
+                                         AutoScaledMode::Disabled, nativeResolution);
+    if (shaderType != DefaultShaderType::Textured)
+        image->setShaderType(shaderType);
+
+    page.d_entries.push_back({ &font, &glyph, layer, image });
+    glyph.setImage(image, layer);
+
+    // Cached text layouts may lack the glyph while it was being rasterised
+    Font::clearTextLayoutCache();
+
+    return image;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeGlyphAtlas::markUsed(const Image& image)
+{
+    // All glyph images are created by addGlyph, so they are BitmapImages
+    const Texture* texture = static_cast<const BitmapImage&>(image).getTexture();
+
+    if (!d_lastUsedPage || d_lastUsedPage->d_texture != texture)
+    {
+        auto it = std::find_if(d_pages.begin(), d_pages.end(),
+            [texture](const Page* page) { return page->d_texture == texture; });
+
+        if (it == d_pages.end())
+            return;
+
+        d_lastUsedPage = *it;
+    }
+
+    d_lastUsedPage->d_lastUsedFrame = d_frame;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeGlyphAtlas::flush()
+{
+    for (Page* page : d_pages)
+        uploadPage(*page);
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeGlyphAtlas::releaseFont(const FreeTypeFont& font)
+{
+    for (size_t i = 0; i < d_pages.size(); )
+    {
+        Page* page = d_pages[i];
+
+        auto firstReleased = std::stable_partition(page->d_entries.begin(), page->d_entries.end(),
+            [&font](const Entry& entry) { return entry.d_font != &font; });
+
+        // The glyphs are about to be deleted by the font, only the images are ours
+        for (auto it = firstReleased; it != page->d_entries.end(); ++it)
+            delete it->d_image;
+
+        if (firstReleased != page->d_entries.end())
+            Font::clearTextLayoutCache();
+
+        page->d_entries.erase(firstReleased, page->d_entries.end());
+
+        if (page->d_entries.empty())
+            destroyPage(page);
+        else
+            ++i;
+    }
+}
+
+//----------------------------------------------------------------------------//
+size_t FreeTypeGlyphAtlas::getMemoryUsage() const
+{
+    size_t usage = 0;
+    for (const Page* page : d_pages)
+        usage += page->d_buffer.size() * sizeof(argb_t);
+
+    return usage;
+}
+
+//----------------------------------------------------------------------------//
+FreeTypeGlyphAtlas::Page* FreeTypeGlyphAtlas::createPage(int size, DefaultShaderType shaderType)
+{
+    const String textureName("FreeTypeGlyphAtlas_page_" +
+        PropertyHelper<std::uint32_t>::toString(d_createdPageCount++));
+
+    Page* page = new Page();
+    page->d_texture = &System::getSingleton().getRenderer()->createTexture(
+        textureName, Sizef(static_cast<float>(size), static_cast<float>(size)));
+    page->d_size = size;
+    page->d_shaderType = shaderType;
+    page->d_uploadedSize = size;
+    page->d_buffer.assign(static_cast<size_t>(size) * size, 0);
+    page->d_packer.reset(size);
+    page->d_lastUsedFrame = d_frame;
+    // The whole page is uploaded once, clearing whatever the texture contained
+    page->d_dirtyMin = glm::ivec2(0, 0);
+    page->d_dirtyMax = glm::ivec2(size, size);
+
+    // Pages not drawn recently may be evicted to meet the texture budget, the
+    // glyphs on them are rasterised again when needed
+    System::getSingleton().getRenderer()->getTextureResidencyManager().addTexture(
+        *page->d_texture, TextureCategory::GlyphAtlas, [this, page]()
+        {
+            destroyPage(page);
+            System::getSingleton().invalidateAllCachedRendering();
+            return true;
+        });
+
+    d_pages.push_back(page);
+    return page;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeGlyphAtlas::destroyPage(Page* page)
+{
+    for (const Entry& entry : page->d_entries)
+    {
+        entry.d_glyph->setImage(nullptr, entry.d_layer);
+        entry.d_glyph->markAsUninitialised();
+        delete entry.d_image;
+    }
+
+    Font::clearTextLayoutCache();
+    Renderer* const renderer = System::getSingleton().getRenderer();
+    renderer->getTextureResidencyManager().removeTexture(*page->d_texture);
+    renderer->destroyTexture(*page->d_texture);
+
+    if (d_lastUsedPage == page)
+        d_lastUsedPage = nullptr;
+
+    d_pages.erase(std::find(d_pages.begin(), d_pages.end(), page));
+    delete page;
+}
+
+//----------------------------------------------------------------------------//
+bool FreeTypeGlyphAtlas::growPage(Page& page, int maxTextureSize)
+{
+    const int newSize = page.d_size * 2;
+    if (newSize > maxTextureSize)
+        return false;
+
+    PixelBuffer newBuffer(static_cast<size_t>(newSize) * newSize, 0);
+    for (int y = 0; y < page.d_size; ++y)
+    {
+        std::copy(page.d_buffer.begin() + y * page.d_size,
+                  page.d_buffer.begin() + (y + 1) * page.d_size,
+                  newBuffer.begin() + y * newSize);
+    }
+    page.d_buffer.swap(newBuffer);
+
+    page.d_packer.grow(newSize);
+    page.d_size = newSize;
+
+    page.d_dirtyMin = glm::ivec2(0, 0);
+    page.d_dirtyMax = glm::ivec2(newSize, newSize);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeGlyphAtlas::uploadPage(Page& page)
+{
+    if (page.d_dirtyMin.x >= page.d_dirtyMax.x || page.d_dirtyMin.y >= page.d_dirtyMax.y)
+        return;
+
+    if (page.d_uploadedSize != page.d_size ||
+        (page.d_dirtyMax - page.d_dirtyMin) == glm::ivec2(page.d_size, page.d_size))
+    {
+        //TODO: why always RGBA if we, and Freetype, only support greyscale?
+        page.d_texture->loadFromMemory(page.d_buffer.data(),
+            Sizef(static_cast<float>(page.d_size), static_cast<float>(page.d_size)),
+            Texture::PixelFormat::Rgba);
+
+        // Geometry created before the resize still uses the old texel scaling
+        if (page.d_uploadedSize != page.d_size)
+        {
+            System::getSingleton().getRenderer()->updateGeometryBufferTexCoords(page.d_texture,
+                page.d_uploadedSize / static_cast<float>(page.d_size));
+            page.d_uploadedSize = page.d_size;
+        }
+    }
+    else
+    {
+        const glm::ivec2 dirtySize = page.d_dirtyMax - page.d_dirtyMin;
+        d_uploadBuffer.resize(static_cast<size_t>(dirtySize.x) * dirtySize.y);
+
+        for (int y = 0; y < dirtySize.y; ++y)
+        {
+            auto rowBegin = page.d_buffer.begin() +
+                (page.d_dirtyMin.y + y) * page.d_size + page.d_dirtyMin.x;
+            std::copy(rowBegin, rowBegin + dirtySize.x, d_uploadBuffer.begin() + y * dirtySize.x);
+        }
+
+        page.d_texture->blitFromMemory(d_uploadBuffer.data(),
+            Rectf(glm::vec2(page.d_dirtyMin), glm::vec2(page.d_dirtyMax)));
+    }
+
+    page.d_dirtyMin = glm::ivec2(page.d_size, page.d_size);
+    page.d_dirtyMax = glm::ivec2(0, 0);
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeGlyphAtlas::evictUnusedPages()
+{
+    bool evicted = false;
+
+    while (getMemoryUsage() > s_memoryBudget)
+    {
+        Page* leastRecentlyUsed = nullptr;
+        for (Page* page : d_pages)
+        {
+            if (page->d_lastUsedFrame < d_frame && (!leastRecentlyUsed ||
+                page->d_lastUsedFrame < leastRecentlyUsed->d_lastUsedFrame))
+            {
+                leastRecentlyUsed = page;
+            }
+        }
+
+        if (!leastRecentlyUsed)
+            break;
+
+        destroyPage(leastRecentlyUsed);
+        evicted = true;
+    }
+
+    // Cached text geometry may still refer to the destroyed textures
+    if (evicted)
+        System::getSingleton().invalidateAllCachedRendering();
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -28,10 +28,22 @@
 #include "CEGUI/System.h"
 #include "CEGUI/RenderTarget.h"
 #include "CEGUI/RenderingWindow.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/TextureTarget.h"
+#include "CEGUI/TextureTargetPool.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Vertex.h"
+#include "CEGUI/Logger.h"
 #include "CEGUI/WindowManager.h"
 #include "CEGUI/FontManager.h"
 #include "CEGUI/widgets/Tooltip.h"
 #include "CEGUI/WindowNavigator.h"
+#include "CEGUI/GeometryJobSystem.h"
+#include "CEGUI/TaskScheduler.h"
+#include "CEGUI/Profiler.h"
+
+#include <algorithm>
 
 namespace CEGUI
 {
@@ -69,6 +81,8 @@ void GUIContext::resetWindowContainingCursor()
 //----------------------------------------------------------------------------//
 GUIContext::~GUIContext()
 {
+    setSelectiveUpdateEnabled(false);
+    setContentCachingEnabled(false);
     destroyDefaultTooltipWindowInstance();
     deleteSemanticEventHandlers();
 
@@ -95,6 +109,9 @@ void GUIContext::setRootWindow(Window* new_root)
     if (d_rootWindow)
         d_rootWindow->setGUIContext(nullptr);
 
+    // all listed windows belong to the previous root
+    clearUpdateList();
+
     // Remember previous root for the event
     WindowEventArgs args(d_rootWindow);
 
@@ -104,6 +121,7 @@ void GUIContext::setRootWindow(Window* new_root)
     {
         d_rootWindow->setGUIContext(this);
         d_rootWindow->notifyScreenAreaChanged(true);
+        requestWindowUpdate(*d_rootWindow, true);
     }
 
     markAsDirty();
@@ -121,6 +139,7 @@ Window* GUIContext::getInputCaptureWindow() const
 void GUIContext::setInputCaptureWindow(Window* window)
 {
     d_captureWindow = window;
+    ++d_windowTreeGeneration;
 }
 
 //----------------------------------------------------------------------------//
@@ -187,6 +206,7 @@ void GUIContext::createDefaultTooltipWindowInstance() const
 void GUIContext::setModalWindow(Window* window)
 {
     d_modalWindow = window;
+    ++d_windowTreeGeneration;
 }
 
 //----------------------------------------------------------------------------//
@@ -219,20 +239,439 @@ void GUIContext::markAsDirty(std::uint32_t drawModeMask)
     d_dirtyDrawModeMask |= drawModeMask;
 }
 
+//----------------------------------------------------------------------------//
+void GUIContext::setLayoutDeferred(bool setting)
+{
+    if (d_layoutDeferred == setting)
+        return;
+
+    if (!setting)
+        updateLayout();
+
+    d_layoutDeferred = setting;
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::updateLayout()
+{
+    if (!d_rootWindow || d_updatingLayout)
+        return;
+
+    if (!d_rootWindow->isScreenAreaChangePending() &&
+        !d_rootWindow->isChildScreenAreaChangePending())
+        return;
+
+    CEGUI_PROFILE_SCOPE("GUIContext::updateLayout");
+    ++d_currentFrameStats.d_layoutPasses;
+    FrameStatsTimer timer(d_currentFrameStats.d_layoutTime);
+
+    d_updatingLayout = true;
+    try
+    {
+        d_rootWindow->updatePendingScreenAreaChanges();
+    }
+    catch (...)
+    {
+        d_updatingLayout = false;
+        throw;
+    }
+    d_updatingLayout = false;
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::setSelectiveUpdateEnabled(bool setting)
+{
+    if (d_selectiveUpdate == setting)
+        return;
+
+    d_selectiveUpdate = setting;
+
+    if (setting)
+    {
+        // nothing is known about the windows yet, update all of them once
+        if (d_rootWindow)
+            requestWindowUpdate(*d_rootWindow, true);
+    }
+    else
+    {
+        clearUpdateList();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::clearUpdateList()
+{
+    for (Window* window : d_updateList)
+    {
+        window->d_updateListContext = nullptr;
+        window->d_subtreeUpdateRequested = false;
+    }
+    d_updateList.clear();
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::requestWindowUpdate(Window& window, bool subtree)
+{
+    if (!d_selectiveUpdate)
+        return;
+
+    if (window.d_updateListContext == this)
+    {
+        window.d_subtreeUpdateRequested |= subtree;
+        return;
+    }
+
+    // the window was moved over from another context
+    if (window.d_updateListContext)
+        window.d_updateListContext->cancelWindowUpdate(window);
+
+    window.d_updateListContext = this;
+    window.d_subtreeUpdateRequested = subtree;
+    d_updateList.push_back(&window);
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::cancelWindowUpdate(Window& window)
+{
+    if (window.d_updateListContext != this)
+        return;
+
+    d_updateList.erase(std::remove(d_updateList.begin(), d_updateList.end(), &window),
+                       d_updateList.end());
+    window.d_updateListContext = nullptr;
+    window.d_subtreeUpdateRequested = false;
+}
+
+//----------------------------------------------------------------------------//
+bool GUIContext::isIdle() const
+{
+    if (!d_selectiveUpdate || !d_updateList.empty() || isDirty())
+        return false;
+
+    return !d_rootWindow || (!d_rootWindow->isScreenAreaChangePending() &&
+                             !d_rootWindow->isChildScreenAreaChangePending());
+}
+
+//----------------------------------------------------------------------------//
+bool GUIContext::isUpdateReachable(const Window& window) const
+{
+    const Window* child = &window;
+    for (const Window* parent = window.getParent(); parent; parent = parent->getParent())
+    {
+        if (child->d_updateMode == WindowUpdateMode::Never ||
+            (child->d_updateMode == WindowUpdateMode::Visible &&
+             (!child->isVisible() || !parent->isChildInView(*child))))
+            return false;
+
+        child = parent;
+    }
+
+    // windows detached from our root are not ours to update
+    return child == d_rootWindow;
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::updateSelectedWindows(float timeElapsed)
+{
+    // requests made while updating are for the next time pulse
+    d_updatingList.clear();
+    d_updatingList.reserve(d_updateList.size());
+    for (Window* window : d_updateList)
+    {
+        d_updatingList.emplace_back(window, static_cast<bool>(window->d_subtreeUpdateRequested));
+        window->d_updateListContext = nullptr;
+        window->d_subtreeUpdateRequested = false;
+    }
+    d_updateList.clear();
+
+    ++Window::s_updatePulse;
+    GUIContext* const previousContext = Window::s_updatingContext;
+    Window::s_updatingContext = this;
+
+    try
+    {
+        // the list may grow and entries may be nulled while iterating
+        for (size_t i = 0; i < d_updatingList.size(); ++i)
+        {
+            Window* const window = d_updatingList[i].first;
+
+            // unreachable windows get requested again when shown or attached
+            if (!window || !isUpdateReachable(*window))
+                continue;
+
+            if (d_updatingList[i].second)
+                window->update(timeElapsed);
+            else
+                window->updateWithoutChildren(timeElapsed);
+        }
+    }
+    catch (...)
+    {
+        Window::s_updatingContext = previousContext;
+        d_updatingList.clear();
+        throw;
+    }
+
+    Window::s_updatingContext = previousContext;
+    d_updatingList.clear();
+}
+
+//----------------------------------------------------------------------------//
+bool GUIContext::needsRedraw() const
+{
+    if (d_redrawForced || isDirty() || RenderingSurface::isRedrawRequired())
+        return true;
+
+    if (d_rootWindow && (d_rootWindow->isScreenAreaChangePending() ||
+                         d_rootWindow->isChildScreenAreaChangePending()))
+        return true;
+
+    // the cursor is drawn on top of the windows in every frame, unless the
+    // windowing system shows it
+    const bool cursorDrawn = isCursorDrawn();
+    if (cursorDrawn != d_drawnCursorVisible)
+        return true;
+
+    return cursorDrawn &&
+        (d_cursor.getPosition() != d_drawnCursorPosition ||
+         d_cursor.getImage() != d_drawnCursorImage);
+}
+
+//----------------------------------------------------------------------------//
+bool GUIContext::isCursorDrawn() const
+{
+    return d_cursor.isVisible() && !d_cursor.isUsingNativeCursor();
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::setDrawOnDemandEnabled(bool setting)
+{
+    d_drawOnDemand = setting;
+    d_redrawForced = true;
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::storeDrawnCursorState()
+{
+    d_drawnCursorPosition = d_cursor.getPosition();
+    d_drawnCursorImage = d_cursor.getImage();
+    d_drawnCursorVisible = isCursorDrawn();
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::setContentCachingEnabled(bool setting)
+{
+    if (isContentCachingEnabled() == setting)
+        return;
+
+    Renderer& renderer = *System::getSingleton().getRenderer();
+
+    if (setting)
+    {
+        // windows drawn to the render target may rely on a stencil buffer
+        d_contentCache = renderer.getTextureTargetPool().acquire(true, d_surfaceSize);
+        if (!d_contentCache)
+        {
+            Logger::getSingleton().logEvent("GUIContext::setContentCachingEnabled - "
+                "Failed to create a TextureTarget for the content cache",
+                LoggingLevel::Error);
+            return;
+        }
+
+        // the cache is drawn every frame, so it is accounted for but kept
+        renderer.getTextureResidencyManager().addTextureTarget(*d_contentCache);
+
+        GeometryBuffer& buffer = renderer.createGeometryBufferTextured();
+        // the texture holds premultiplied colours, see RenderingWindow
+        buffer.setBlendMode(BlendMode::RttPremultiplied);
+        d_contentCacheGeometry.push_back(&buffer);
+        resizeContentCache();
+    }
+    else
+    {
+        for (GeometryBuffer* buffer : d_contentCacheGeometry)
+            renderer.destroyGeometryBuffer(*buffer);
+        d_contentCacheGeometry.clear();
+
+        renderer.getTextureResidencyManager().removeTexture(d_contentCache->getTexture());
+        renderer.getTextureTargetPool().release(d_contentCache);
+        d_contentCache = nullptr;
+    }
+
+    d_contentCacheValid = false;
+    d_redrawForced = true;
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::resizeContentCache()
+{
+    d_contentCache->declareRenderSize(d_surfaceSize);
+    d_contentCacheValid = false;
+
+    Texture& texture = d_contentCache->getTexture();
+    const float tu = d_surfaceSize.d_width * texture.getTexelScaling().x;
+    const float tv = d_surfaceSize.d_height * texture.getTexelScaling().y;
+    const Rectf texRect = d_contentCache->getOwner().isTexCoordSystemFlipped() ?
+        Rectf(0, 1, tu, 1 - tv) : Rectf(0, 0, tu, tv);
+    const Rectf area(glm::vec2(0, 0), d_surfaceSize);
+    const glm::vec4 colour(1.0f, 1.0f, 1.0f, 1.0f);
+
+    // two triangles covering the whole render target
+    const glm::vec2 corners[6][2] =
+    {
+        { area.d_min, texRect.d_min },
+        { glm::vec2(area.d_min.x, area.d_max.y), glm::vec2(texRect.d_min.x, texRect.d_max.y) },
+        { area.d_max, texRect.d_max },
+        { glm::vec2(area.d_max.x, area.d_min.y), glm::vec2(texRect.d_max.x, texRect.d_min.y) },
+        { area.d_min, texRect.d_min },
+        { area.d_max, texRect.d_max }
+    };
+
+    TexturedColouredVertex vbuffer[6];
+    for (int i = 0; i < 6; ++i)
+    {
+        vbuffer[i].d_position = glm::vec3(corners[i][0], 0.0f);
+        vbuffer[i].d_colour = colour;
+        vbuffer[i].d_texCoords = corners[i][1];
+    }
+
+    GeometryBuffer& buffer = *d_contentCacheGeometry.front();
+    buffer.reset();
+    buffer.setTexture("texture0", &texture);
+    buffer.appendGeometry(vbuffer, 6);
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::drawCachedContent(std::uint32_t drawModeMask, bool contentChanged)
+{
+    if (contentChanged || !d_contentCacheValid)
+    {
+        // the surface draws its queues to the cache instead of the render target
+        RenderTarget* const target = d_target;
+        d_target = d_contentCache;
+        d_contentCache->clear();
+
+        try
+        {
+            RenderingSurface::draw(~DrawModeFlagMouseCursor);
+        }
+        catch (...)
+        {
+            d_target = target;
+            throw;
+        }
+
+        d_target = target;
+        d_contentCacheValid = true;
+    }
+
+    d_target->activate();
+    d_target->getOwner().uploadBuffers(d_contentCacheGeometry);
+    d_contentCacheGeometry.front()->draw();
+
+    if (drawModeMask & DrawModeFlagMouseCursor)
+        d_cursor.draw(DrawModeFlagMouseCursor);
+
+    d_target->deactivate();
+}
+
 //----------------------------------------------------------------------------//
 void GUIContext::draw(std::uint32_t drawModeMask)
 {
-    // Cursor is always dirty because it must be redrawn each frame
-    const bool drawCursor = (drawModeMask & DrawModeFlagMouseCursor);
-    
-    drawModeMask &= d_dirtyDrawModeMask;
+    ObservableBase::applyPendingChanges();
+
+    // the previous frame is still shown and nothing changed since
+    if (d_drawOnDemand && !needsRedraw())
+        return;
 
-    drawWindowContentToTarget(drawModeMask);
+    CEGUI_PROFILE_SCOPE("GUIContext::draw");
 
-    if (drawCursor)
-        drawModeMask |= DrawModeFlagMouseCursor;
+    FrameStats& rendererStats = System::getSingleton().getRenderer()->getCurrentFrameStats();
+    const FrameStats rendererStatsBefore = rendererStats;
 
-    RenderingSurface::draw(drawModeMask);
+    FrameAllocator* previousAllocator = FrameAllocator::setActive(&d_frameAllocator);
+    try
+    {
+        FrameStatsActivation activation(&d_currentFrameStats);
+
+        updateLayout();
+
+        // Cursor is always dirty because it must be redrawn each frame
+        const bool drawCursor = (drawModeMask & DrawModeFlagMouseCursor);
+
+        // RenderingWindows are only drawn along with the window content, so a
+        // redraw held back by their refresh rate needs it once it is due
+        for (const RenderingWindow* window : d_windows)
+            if (window->isInvalidated())
+                markAsDirty(drawModeMask);
+
+        drawModeMask &= d_dirtyDrawModeMask;
+
+        // checked before drawing resets the state of the RenderingWindows
+        const bool contentChanged = drawModeMask != 0 || d_redrawForced ||
+            RenderingSurface::isRedrawRequired();
+
+        {
+            FrameStatsTimer timer(d_currentFrameStats.d_geometryTime);
+            drawWindowContentToTarget(drawModeMask);
+        }
+
+        if (drawCursor)
+            drawModeMask |= DrawModeFlagMouseCursor;
+
+        FrameStatsTimer timer(d_currentFrameStats.d_submissionTime);
+        if (d_contentCache)
+            drawCachedContent(drawModeMask, contentChanged);
+        else
+            RenderingSurface::draw(drawModeMask);
+    }
+    catch (...)
+    {
+        FrameAllocator::setActive(previousAllocator);
+        d_frameAllocator.reset();
+        throw;
+    }
+
+    // everything allocated during the frame is released at once
+    FrameAllocator::setActive(previousAllocator);
+    d_frameAllocator.reset();
+
+    d_redrawForced = false;
+    storeDrawnCursorState();
+
+    finishFrameStats(rendererStats, rendererStatsBefore);
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::finishFrameStats(FrameStats& rendererStats,
+                                  const FrameStats& rendererStatsBefore)
+{
+    // the renderer counted the work done while this context was drawn
+    d_currentFrameStats.d_geometryBuffersQueued +=
+        rendererStats.d_geometryBuffersQueued - rendererStatsBefore.d_geometryBuffersQueued;
+    d_currentFrameStats.d_verticesUploaded +=
+        rendererStats.d_verticesUploaded - rendererStatsBefore.d_verticesUploaded;
+    d_currentFrameStats.d_verticesDrawn +=
+        rendererStats.d_verticesDrawn - rendererStatsBefore.d_verticesDrawn;
+    d_currentFrameStats.d_drawCalls +=
+        rendererStats.d_drawCalls - rendererStatsBefore.d_drawCalls;
+    d_currentFrameStats.d_textureUploads +=
+        rendererStats.d_textureUploads - rendererStatsBefore.d_textureUploads;
+    d_currentFrameStats.d_stateChanges +=
+        rendererStats.d_stateChanges - rendererStatsBefore.d_stateChanges;
+
+    // while the work of the windows adds up to the renderer's frame
+    rendererStats.d_windowsUpdated += d_currentFrameStats.d_windowsUpdated;
+    rendererStats.d_windowsRedrawn += d_currentFrameStats.d_windowsRedrawn;
+    rendererStats.d_windowsCulled += d_currentFrameStats.d_windowsCulled;
+    rendererStats.d_layoutPasses += d_currentFrameStats.d_layoutPasses;
+    rendererStats.d_updateTime += d_currentFrameStats.d_updateTime;
+    rendererStats.d_layoutTime += d_currentFrameStats.d_layoutTime;
+    rendererStats.d_geometryTime += d_currentFrameStats.d_geometryTime;
+    rendererStats.d_submissionTime += d_currentFrameStats.d_submissionTime;
+
+    d_frameStats = d_currentFrameStats;
+    d_currentFrameStats.reset();
 }
 
 //----------------------------------------------------------------------------//
@@ -263,6 +702,11 @@ void GUIContext::drawWindowContentToTarget(std::uint32_t drawModeMask)
             if (rs->isRenderingWindow())
                 static_cast<RenderingWindow*>(rs)->getOwner().clearGeometry();
 
+            // the geometry may have been generated along with other contexts
+            if (!d_geometryBuffered && (d_geometryJobSystem ||
+                System::getSingleton().getTaskScheduler().getConcurrency() > 1))
+                bufferSurfaceGeometryInParallel(drawModeMask);
+
             d_rootWindow->draw(drawModeMask);
         }
     }
@@ -273,6 +717,162 @@ void GUIContext::drawWindowContentToTarget(std::uint32_t drawModeMask)
 
     // Mark all rendered modes as not dirty (cursor is always redrawn anyway)
     d_dirtyDrawModeMask &= (~drawModeMask);
+    d_geometryBuffered = false;
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::bufferSurfaceGeometryInParallel(std::uint32_t drawModeMask)
+{
+    Renderer* renderer = System::getSingleton().getRenderer();
+    if (!renderer->isGeometryGenerationThreadSafe())
+        return;
+
+    // the windows drawing directly to us form a subtree of their own
+    std::vector<Window*> roots;
+    if (!d_rootWindow->getTargetRenderingSurface()->isRenderingWindow())
+        roots.push_back(d_rootWindow);
+
+    d_rootWindow->collectInvalidatedSurfaceOwners(roots);
+
+    // nothing to gain from a job system for a single subtree
+    if (roots.size() < 2)
+        return;
+
+    runGeometryJobs(roots, std::vector<FrameStats*>(roots.size(), &d_currentFrameStats),
+                    drawModeMask, d_geometryJobSystem);
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::collectGeometryRoots(std::vector<Window*>& roots,
+                                      std::uint32_t drawModeMask)
+{
+    ObservableBase::applyPendingChanges();
+
+    // draw will do nothing at all
+    if (d_drawOnDemand && !needsRedraw())
+        return;
+
+    {
+        FrameStatsActivation activation(&d_currentFrameStats);
+        updateLayout();
+    }
+
+    if (!(drawModeMask & d_dirtyDrawModeMask) || !d_rootWindow)
+        return;
+
+    RenderingSurface* rs = d_rootWindow->getTargetRenderingSurface();
+    if (!rs)
+        return;
+
+    if (!rs->isRenderingWindow())
+        roots.push_back(d_rootWindow);
+
+    d_rootWindow->collectInvalidatedSurfaceOwners(roots);
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::bufferGeometryInParallel(const std::vector<GUIContext*>& contexts,
+                                          std::uint32_t drawModeMask)
+{
+    if (!System::getSingleton().getRenderer()->isGeometryGenerationThreadSafe() ||
+        System::getSingleton().getTaskScheduler().getConcurrency() < 2)
+        return;
+
+    CEGUI_PROFILE_SCOPE("GUIContext::bufferGeometryInParallel");
+
+    std::vector<Window*> roots;
+    std::vector<FrameStats*> stats;
+    std::vector<GUIContext*> buffered;
+    for (GUIContext* context : contexts)
+    {
+        const std::size_t first = roots.size();
+        context->collectGeometryRoots(roots, drawModeMask);
+        stats.resize(roots.size(), &context->d_currentFrameStats);
+
+        if (roots.size() != first)
+            buffered.push_back(context);
+    }
+
+    // a single subtree is generated by its draw as well as here
+    if (roots.size() < 2)
+        return;
+
+    runGeometryJobs(roots, stats, drawModeMask, nullptr);
+
+    for (GUIContext* context : buffered)
+        context->d_geometryBuffered = true;
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::runGeometryJobs(const std::vector<Window*>& roots,
+                                 const std::vector<FrameStats*>& stats,
+                                 std::uint32_t drawModeMask,
+                                 GeometryJobSystem* jobSystem)
+{
+    Renderer* renderer = System::getSingleton().getRenderer();
+
+    FrameVector<std::exception_ptr> errors(roots.size());
+    // the windows of each job report to their own statistics
+    FrameVector<FrameStats> jobStats(roots.size());
+    std::vector<GeometryJobSystem::Job> jobs;
+    jobs.reserve(roots.size());
+
+    for (std::size_t i = 0; i < roots.size(); ++i)
+    {
+        Window* root = roots[i];
+
+        // the jobs read the cached areas of shared ancestors, so compute them here
+        root->getOuterRectClipper();
+        root->getInnerRectClipper();
+        root->getUnclippedInnerRect().get();
+
+        std::exception_ptr& error = errors[i];
+        FrameStats* stats = &jobStats[i];
+        jobs.push_back([root, drawModeMask, &error, stats]()
+        {
+            try
+            {
+                FrameStatsActivation activation(stats);
+                root->bufferSurfaceGeometry(drawModeMask);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+        });
+    }
+
+    renderer->setGeometryBufferDestructionDeferred(true);
+    try
+    {
+        if (jobSystem)
+        {
+            jobSystem->runJobs(jobs);
+        }
+        else
+        {
+            System::getSingleton().getTaskScheduler().parallelFor(0, jobs.size(),
+                [&jobs](std::size_t i) { jobs[i](); });
+        }
+    }
+    catch (...)
+    {
+        renderer->setGeometryBufferDestructionDeferred(false);
+        throw;
+    }
+    renderer->setGeometryBufferDestructionDeferred(false);
+
+    for (std::size_t i = 0; i < roots.size(); ++i)
+    {
+        stats[i]->d_windowsRedrawn += jobStats[i].d_windowsRedrawn;
+        stats[i]->d_windowsCulled += jobStats[i].d_windowsCulled;
+    }
+
+    for (const std::exception_ptr& error : errors)
+    {
+        if (error)
+            std::rethrow_exception(error);
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -293,6 +893,10 @@ bool GUIContext::areaChangedHandler(const EventArgs&)
 {
     d_surfaceSize = d_target->getArea().getSize();
     d_cursor.notifyTargetSizeChanged(d_surfaceSize);
+    d_redrawForced = true;
+
+    if (d_contentCache)
+        resizeContentCache();
 
     if (d_rootWindow)
         d_rootWindow->notifyScreenAreaChanged(true);
@@ -324,6 +928,13 @@ bool GUIContext::windowDestroyedHandler(const EventArgs& args)
         d_weCreatedTooltipObject = false;
     }
 
+    if (window->d_updateListContext == this)
+        cancelWindowUpdate(*const_cast<Window*>(window));
+
+    for (auto& entry : d_updatingList)
+        if (entry.first == window)
+            entry.first = nullptr;
+
     return true;
 }
 
@@ -331,6 +942,7 @@ bool GUIContext::windowDestroyedHandler(const EventArgs& args)
 void GUIContext::updateWindowContainingCursor()
 {
     d_windowContainingCursorIsUpToDate = false;
+    ++d_windowTreeGeneration;
 }
 
 //----------------------------------------------------------------------------//
@@ -339,7 +951,18 @@ bool GUIContext::updateWindowContainingCursor_impl() const
     CursorInputEventArgs ciea(nullptr);
     const glm::vec2 cursor_pos(d_cursor.getPosition());
 
-    Window* const window_with_cursor = getTargetWindow(cursor_pos, true);
+    Window* window_with_cursor = getCachedCursorTarget(cursor_pos);
+    const bool found_below_previous = window_with_cursor != nullptr;
+    if (!found_below_previous)
+        window_with_cursor = getTargetWindow(cursor_pos, true);
+
+    // remember whether the next move may start from this window. This is done
+    // before firing any event, so changes made by handlers are noticed.
+    if (!found_below_previous || window_with_cursor != d_windowContainingCursor)
+    {
+        d_cursorTargetGeneration = d_windowTreeGeneration;
+        d_cursorTargetUnoccluded = window_with_cursor && isUnoccluded(*window_with_cursor);
+    }
 
     // exit if window containing cursor has not changed.
     if (window_with_cursor == d_windowContainingCursor)
@@ -380,6 +1003,78 @@ bool GUIContext::updateWindowContainingCursor_impl() const
     return true;
 }
 
+//----------------------------------------------------------------------------//
+Window* GUIContext::getCachedCursorTarget(const glm::vec2& pt) const
+{
+    Window* const previous = d_windowContainingCursor;
+
+    if (!previous || !d_cursorTargetUnoccluded || d_captureWindow ||
+        d_cursorTargetGeneration != d_windowTreeGeneration)
+        return nullptr;
+
+    if (!previous->getHitTestRect().isPointInRectf(pt) ||
+        !previous->isHit(pt, true))
+        return nullptr;
+
+    // nothing else can be hit here, but a child of the previous window can
+    Window* const child = previous->getTargetChildAtPosition(pt, true);
+    return child ? child : previous;
+}
+
+//----------------------------------------------------------------------------//
+bool GUIContext::isUnoccluded(const Window& target) const
+{
+    const Rectf& area = target.getHitTestRect();
+
+    for (const Window* wnd = &target; wnd; wnd = wnd->getParent())
+    {
+        // positions below a RenderingWindow are unprojected, and those below
+        // rotated geometry unrotated, which is not worth tracking here
+        if ((wnd->d_surface && wnd->d_surface->isRenderingWindow()) ||
+            wnd->isRotatingGeometry())
+            return false;
+
+        const Window* const parent = wnd->getParent();
+        if (!parent)
+            break;
+
+        // the windows drawn after this one are hit tested before it
+        const auto& draw_list = parent->d_drawList;
+        auto sibling = std::find(draw_list.begin(), draw_list.end(), wnd);
+        if (sibling == draw_list.end())
+            return false;
+
+        for (++sibling; sibling != draw_list.end(); ++sibling)
+            if (mayBeHitWithin(**sibling, area))
+                return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool GUIContext::mayBeHitWithin(const Window& wnd, const Rectf& area)
+{
+    if (!wnd.isVisible())
+        return false;
+
+    if ((wnd.d_surface && wnd.d_surface->isRenderingWindow()) ||
+        wnd.isRotatingGeometry())
+        return true;
+
+    const Rectf overlap(wnd.getHitTestRect().getIntersection(area));
+    if (overlap.getWidth() > 0.0f && overlap.getHeight() > 0.0f)
+        return true;
+
+    // children clipped by the window cannot be hit outside of its hit test
+    // area, only the others need checking
+    for (const Window* child : wnd.d_drawList)
+        if (!child->isClippedByParent() && mayBeHitWithin(*child, area))
+            return true;
+
+    return false;
+}
+
 //----------------------------------------------------------------------------//
 Window* GUIContext::getCommonAncestor(Window* w1, Window* w2) const
 {
@@ -500,15 +1195,28 @@ bool GUIContext::injectInputEvent(const InputEvent& event)
 //----------------------------------------------------------------------------//
 bool GUIContext::injectTimePulse(float timeElapsed)
 {
+    // bound values changed since the last frame, before any layout happens
+    ObservableBase::applyPendingChanges();
+
     // if no visible active sheet, input can't be handled
     if (!d_rootWindow || !d_rootWindow->isEffectiveVisible())
         return false;
 
+    CEGUI_PROFILE_SCOPE("GUIContext::injectTimePulse");
+
+    updateLayout();
+
+    FrameStatsActivation activation(&d_currentFrameStats);
+    FrameStatsTimer timer(d_currentFrameStats.d_updateTime);
+
     // ensure window containing cursor is now valid
     getWindowContainingCursor();
 
     // else pass to sheet for distribution.
-    d_rootWindow->update(timeElapsed);
+    if (d_selectiveUpdate)
+        updateSelectedWindows(timeElapsed);
+    else
+        d_rootWindow->update(timeElapsed);
     // this input is then /always/ considered handled.
     return true;
 }
@@ -835,7 +1543,9 @@ bool GUIContext::handleScrollEvent(const SemanticInputEvent& event)
 //----------------------------------------------------------------------------//
 bool GUIContext::handleCursorMove_impl(CursorInputEventArgs& pa)
 {
-    updateWindowContainingCursor();
+    // only the cursor moved, so the window containing it may be found below
+    // the previous one, see getCachedCursorTarget
+    d_windowContainingCursorIsUpToDate = false;
 
     // input can't be handled if there is no window to handle it.
     if (!getWindowContainingCursor())
@@ -25,15 +25,94 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/ClipRegion.h"
 #include "CEGUI/Vertex.h"
 #include "CEGUI/ShaderParameterBindings.h"
 #include "CEGUI/RenderTarget.h"
 #include "CEGUI/Renderer.h" // for BlendMode
 #include "CEGUI/RenderMaterial.h"
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/CoordConverter.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/Exceptions.h"
 #include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace CEGUI
 {
+namespace
+{
+/*!
+    Clips \a dest, whose texture coordinates are \a tex, to \a clip.
+    Returns false if nothing of the quad is left. A rect is held in a single
+    register as min.x, min.y, max.x, max.y.
+*/
+inline bool clipQuad(const Rectf& dest, const Rectf& tex, const Rectf* clip,
+                     Rectf& finalRect, Rectf& texRect)
+{
+#if defined(CEGUI_SIMD_SSE2)
+    const __m128 destArea = _mm_loadu_ps(&dest.d_min.x);
+    const __m128 texArea = _mm_loadu_ps(&tex.d_min.x);
+
+    if (!clip)
+    {
+        // only empty rects are skipped, mirrored ones are drawn as they are
+        const __m128 size = _mm_sub_ps(_mm_movehl_ps(destArea, destArea), destArea);
+        if (_mm_movemask_ps(_mm_cmpeq_ps(size, _mm_setzero_ps())) & 0x3)
+            return false;
+
+        _mm_storeu_ps(&finalRect.d_min.x, destArea);
+        _mm_storeu_ps(&texRect.d_min.x, texArea);
+        return true;
+    }
+
+    // the min corner takes the larger, the max corner the smaller coordinates
+    const __m128 clipArea = _mm_loadu_ps(&clip->d_min.x);
+    const __m128 minMask = _mm_castsi128_ps(_mm_set_epi32(0, 0, -1, -1));
+    const __m128 clipped = _mm_or_ps(
+        _mm_and_ps(minMask, _mm_max_ps(destArea, clipArea)),
+        _mm_andnot_ps(minMask, _mm_min_ps(destArea, clipArea)));
+
+    const __m128 clippedSize = _mm_sub_ps(_mm_movehl_ps(clipped, clipped), clipped);
+    if (_mm_movemask_ps(_mm_cmple_ps(clippedSize, _mm_setzero_ps())) & 0x3)
+        return false;
+
+    // texture units per pixel, for both the min and the max corner
+    const __m128 destSize = _mm_sub_ps(_mm_movehl_ps(destArea, destArea), destArea);
+    const __m128 texSize = _mm_sub_ps(_mm_movehl_ps(texArea, texArea), texArea);
+    const __m128 texPerPixel = _mm_div_ps(texSize, destSize);
+
+    _mm_storeu_ps(&finalRect.d_min.x, clipped);
+    _mm_storeu_ps(&texRect.d_min.x, _mm_add_ps(texArea, _mm_mul_ps(
+        _mm_sub_ps(clipped, destArea), _mm_movelh_ps(texPerPixel, texPerPixel))));
+    return true;
+#else
+    if (!clip)
+    {
+        if (dest.getWidth() == 0.0f || dest.getHeight() == 0.0f)
+            return false;
+
+        finalRect = dest;
+        texRect = tex;
+        return true;
+    }
+
+    finalRect = dest.getIntersection(*clip);
+    if (finalRect.getWidth() <= 0.0f || finalRect.getHeight() <= 0.0f)
+        return false;
+
+    const glm::vec2 texPerPixel(tex.getWidth() / dest.getWidth(),
+                                tex.getHeight() / dest.getHeight());
+    texRect = Rectf(tex.d_min + (finalRect.d_min - dest.d_min) * texPerPixel,
+                    tex.d_max + (finalRect.d_max - dest.d_max) * texPerPixel);
+    return true;
+#endif
+}
+}
+
 //---------------------------------------------------------------------------//
 GeometryBuffer::GeometryBuffer(RefCounted<RenderMaterial> renderMaterial):
     d_renderMaterial(renderMaterial),
@@ -43,7 +122,9 @@ GeometryBuffer::GeometryBuffer(RefCounted<RenderMaterial> renderMaterial):
     d_scale(1.0f, 1.0f, 1.0f),
     d_pivot(0, 0, 0),
     d_customTransform(1.0f),
+    d_layerColours(0.0f),
     d_matrixValid(false),
+    d_transformCacheValid(false),
     d_lastRenderTarget(nullptr),
     d_lastRenderTargetActivationCount(0),
     d_blendMode(BlendMode::Normal),
@@ -53,13 +134,34 @@ GeometryBuffer::GeometryBuffer(RefCounted<RenderMaterial> renderMaterial):
     d_clippingRegion(0, 0, 0, 0),
     d_preparedClippingRegion(0, 0, 0, 0),
     d_clippingActive(false),
-    d_alpha(1.0f)
+    d_alpha(1.0f),
+    d_quadIndexingEnabled(false),
+    d_usingQuadIndices(false),
+    d_clippingMaskType(ClippingMaskType::NoMask),
+    d_clippingMaskArea(0, 0, 0, 0),
+    d_clippingMaskCornerRadius(0.0f),
+    d_clippingMaskTexture(nullptr),
+    d_clippingMaskTexArea(0, 0, 0, 0)
 {}
 
 //---------------------------------------------------------------------------//
 GeometryBuffer::~GeometryBuffer()
 {}
 
+//---------------------------------------------------------------------------//
+bool GeometryBuffer::isBatchableWith(const GeometryBuffer& /*next*/) const
+{
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::drawBatch(std::size_t /*bufferCount*/,
+                               std::size_t /*vertexCount*/,
+                               std::uint32_t drawModeMask) const
+{
+    draw(drawModeMask);
+}
+
 //---------------------------------------------------------------------------//
 void GeometryBuffer::setBlendMode(const BlendMode mode)
 {
@@ -72,6 +174,77 @@ BlendMode GeometryBuffer::getBlendMode() const
     return d_blendMode;
 }
 
+//---------------------------------------------------------------------------//
+void GeometryBuffer::setClippingMask(const Rectf& area, float cornerRadius)
+{
+    if (!isClippingMaskSupported())
+        throw InvalidRequestException(
+            "The shader of this GeometryBuffer does not support clipping masks.");
+
+    const float maxRadius = std::min(std::abs(area.getWidth()), std::abs(area.getHeight())) * 0.5f;
+
+    d_clippingMaskType = ClippingMaskType::RoundedRect;
+    d_clippingMaskArea = area;
+    d_clippingMaskCornerRadius = std::max(0.0f, std::min(cornerRadius, maxRadius));
+    d_clippingMaskTexture = nullptr;
+    d_clippingMaskTexArea = Rectf(0, 0, 0, 0);
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::setClippingMask(const Rectf& area, const Texture* texture,
+                                     const Rectf& texArea)
+{
+    if (!isClippingMaskSupported())
+        throw InvalidRequestException(
+            "The shader of this GeometryBuffer does not support clipping masks.");
+
+    if (!texture)
+        throw InvalidRequestException("A texture is required for a texture clipping mask.");
+
+    d_clippingMaskType = ClippingMaskType::Texture;
+    d_clippingMaskArea = area;
+    d_clippingMaskCornerRadius = 0.0f;
+    d_clippingMaskTexture = texture;
+    d_clippingMaskTexArea = texArea;
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::clearClippingMask()
+{
+    d_clippingMaskType = ClippingMaskType::NoMask;
+    d_clippingMaskArea = Rectf(0, 0, 0, 0);
+    d_clippingMaskCornerRadius = 0.0f;
+    d_clippingMaskTexture = nullptr;
+    d_clippingMaskTexArea = Rectf(0, 0, 0, 0);
+}
+
+//---------------------------------------------------------------------------//
+bool GeometryBuffer::isClippingMaskSupported() const
+{
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+bool GeometryBuffer::hasEquivalentClippingMask(const GeometryBuffer& other) const
+{
+    return d_clippingMaskType == other.d_clippingMaskType &&
+           d_clippingMaskArea == other.d_clippingMaskArea &&
+           d_clippingMaskCornerRadius == other.d_clippingMaskCornerRadius &&
+           d_clippingMaskTexture == other.d_clippingMaskTexture &&
+           d_clippingMaskTexArea == other.d_clippingMaskTexArea;
+}
+
+//---------------------------------------------------------------------------//
+glm::mat4 GeometryBuffer::getClippingMaskMatrix() const
+{
+    glm::mat4 mask(0.0f);
+    mask[0] = glm::vec4(d_clippingMaskArea.d_min, d_clippingMaskArea.d_max);
+    mask[1] = glm::vec4(d_clippingMaskTexArea.d_min, d_clippingMaskTexArea.d_max);
+    mask[2] = glm::vec4(static_cast<float>(d_clippingMaskType),
+                        d_clippingMaskCornerRadius, 0.0f, 0.0f);
+    return mask;
+}
+
 //---------------------------------------------------------------------------//
 void GeometryBuffer::appendGeometry(const std::vector<ColouredVertex>& coloured_vertices)
 {
@@ -156,10 +329,228 @@ void GeometryBuffer::appendGeometry(const TexturedColouredVertex* vertex_array,
     delete[] vertexData;
 }
 
+//---------------------------------------------------------------------------//
+void GeometryBuffer::appendQuadInstance(const Rectf& destRect,
+                                        const Rectf& texRect,
+                                        const Colour& colour)
+{
+    TexturedColouredVertex corners[4];
+
+    corners[0].d_position = glm::vec3(destRect.left(), destRect.top(), 0.0f);
+    corners[0].d_texCoords = glm::vec2(texRect.left(), texRect.top());
+    corners[1].d_position = glm::vec3(destRect.left(), destRect.bottom(), 0.0f);
+    corners[1].d_texCoords = glm::vec2(texRect.left(), texRect.bottom());
+    corners[2].d_position = glm::vec3(destRect.right(), destRect.bottom(), 0.0f);
+    corners[2].d_texCoords = glm::vec2(texRect.right(), texRect.bottom());
+    corners[3].d_position = glm::vec3(destRect.right(), destRect.top(), 0.0f);
+    corners[3].d_texCoords = glm::vec2(texRect.right(), texRect.top());
+
+    for (TexturedColouredVertex& vertex : corners)
+        vertex.setColour(colour);
+
+    appendQuad(corners);
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::appendQuad(const TexturedColouredVertex* corners)
+{
+    // the instances are converted before the quad layout is chosen below
+    convertQuadInstancesToVertices();
+
+    if (canAppendIndexedQuads())
+    {
+        // the corners continue the quad layout, so it must not be converted
+        d_usingQuadIndices = false;
+        appendGeometry(corners, 4);
+        d_usingQuadIndices = true;
+        return;
+    }
+
+    // Quad splitting done from top-left to bottom-right diagonal
+    const TexturedColouredVertex vbuffer[6] =
+    {
+        corners[0], corners[1], corners[2], corners[3], corners[0], corners[2]
+    };
+
+    appendGeometry(vbuffer, 6);
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::appendTexturedQuads(const Rectf* destAreas,
+                                         const Rectf* texAreas,
+                                         const ColourRect* colours,
+                                         std::size_t count,
+                                         const Rectf* clipArea)
+{
+    // the corners in the order expected by appendQuad, followed by the
+    // second triangle when not using quad indices
+    static const int cornerOrder[6] = { 0, 1, 2, 3, 0, 2 };
+    constexpr std::size_t VERTEX_FLOAT_COUNT = 9;
+
+    const bool instancing = isQuadInstancingSupported();
+    const bool indexed = canAppendIndexedQuads();
+    const std::size_t quadVertexCount = indexed ? 4 : 6;
+
+    static thread_local std::vector<float> vertexData;
+    vertexData.resize(count * quadVertexCount * VERTEX_FLOAT_COUNT);
+    float* out = vertexData.data();
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Rectf finalRect;
+        Rectf texRect;
+        if (!clipQuad(destAreas[i], texAreas[i], clipArea, finalRect, texRect))
+            continue;
+
+        // Positions have to be rounded because the glyphs images have to be grid-aligned
+        finalRect.d_min.x = CoordConverter::alignToPixels(finalRect.d_min.x);
+        finalRect.d_min.y = CoordConverter::alignToPixels(finalRect.d_min.y);
+        finalRect.d_max.x = CoordConverter::alignToPixels(finalRect.d_max.x);
+        finalRect.d_max.y = CoordConverter::alignToPixels(finalRect.d_max.y);
+
+        // instances are only drawn in order while there are no vertices
+        const bool firstVertexQuad = out == vertexData.data();
+        const ColourRect& quadColours = colours[i];
+        if (instancing && firstVertexQuad && getVertexCount() == 0 &&
+            quadColours.isMonochromatic())
+        {
+            appendQuadInstance(finalRect, texRect, quadColours.d_top_left);
+            continue;
+        }
+
+        if (firstVertexQuad)
+            convertQuadInstancesToVertices();
+
+        // top-left, bottom-left, bottom-right, top-right
+        const float xs[4] = { finalRect.left(), finalRect.left(), finalRect.right(), finalRect.right() };
+        const float ys[4] = { finalRect.top(), finalRect.bottom(), finalRect.bottom(), finalRect.top() };
+        const float us[4] = { texRect.left(), texRect.left(), texRect.right(), texRect.right() };
+        const float vs[4] = { texRect.top(), texRect.bottom(), texRect.bottom(), texRect.top() };
+        const Colour* cornerColours[4] = { &quadColours.d_top_left, &quadColours.d_bottom_left,
+                                           &quadColours.d_bottom_right, &quadColours.d_top_right };
+
+        for (std::size_t v = 0; v < quadVertexCount; ++v, out += VERTEX_FLOAT_COUNT)
+        {
+            const int corner = cornerOrder[v];
+            out[0] = xs[corner];
+            out[1] = ys[corner];
+            out[2] = 0.0f;
+            cornerColours[corner]->getRGBA(out + 3);
+            out[7] = us[corner];
+            out[8] = vs[corner];
+        }
+    }
+
+    const std::size_t arraySize = out - vertexData.data();
+    if (arraySize == 0)
+        return;
+
+    if (indexed)
+    {
+        // the quads continue the quad layout, so it must not be converted
+        d_usingQuadIndices = false;
+        appendGeometry(vertexData.data(), arraySize);
+        d_usingQuadIndices = true;
+    }
+    else
+    {
+        appendGeometry(vertexData.data(), arraySize);
+    }
+}
+
+//---------------------------------------------------------------------------//
+bool GeometryBuffer::isQuadInstancingSupported() const
+{
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+bool GeometryBuffer::canAppendIndexedQuads() const
+{
+    return d_quadIndexingEnabled && isQuadIndexingSupported() &&
+           d_polygonFillRule == PolygonFillRule::NoFilling &&
+           (d_usingQuadIndices || d_vertexData.empty());
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::setQuadIndexingEnabled(bool enabled)
+{
+    d_quadIndexingEnabled = enabled;
+
+    if (!enabled)
+        convertQuadsToTriangles();
+}
+
+//---------------------------------------------------------------------------//
+bool GeometryBuffer::isQuadIndexingSupported() const
+{
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::appendQuadIndices(std::vector<std::uint32_t>& indices,
+                                       std::size_t quad_count)
+{
+    // same triangles as the ones appendQuad creates when not using indices
+    static const std::uint32_t quadIndices[6] = { 0, 1, 2, 3, 0, 2 };
+
+    std::uint32_t firstVertex = static_cast<std::uint32_t>(indices.size() / 6 * 4);
+    indices.reserve(indices.size() + quad_count * 6);
+    for (std::size_t quad = 0; quad < quad_count; ++quad, firstVertex += 4)
+    {
+        for (std::uint32_t index : quadIndices)
+            indices.push_back(firstVertex + index);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::convertQuadsToTriangles()
+{
+    if (!d_usingQuadIndices)
+        return;
+
+    d_usingQuadIndices = false;
+
+    static const std::size_t quadVertices[6] = { 0, 1, 2, 3, 0, 2 };
+    const std::size_t stride = getVertexAttributeElementCount();
+
+    std::vector<float> triangleData;
+    triangleData.reserve(d_vertexData.size() / 4 * 6);
+    for (std::size_t quad = 0; quad + 4 * stride <= d_vertexData.size(); quad += 4 * stride)
+    {
+        for (std::size_t vertex : quadVertices)
+        {
+            const float* vertexData = &d_vertexData[quad + vertex * stride];
+            triangleData.insert(triangleData.end(), vertexData, vertexData + stride);
+        }
+    }
+
+    // re-append so that the renderer specific buffers are updated as well
+    d_vertexData.clear();
+    appendGeometry(triangleData.data(), triangleData.size());
+}
+
+//---------------------------------------------------------------------------//
+std::size_t GeometryBuffer::getQuadInstanceCount() const
+{
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::convertQuadInstancesToVertices()
+{
+}
+
 //---------------------------------------------------------------------------//
 void GeometryBuffer::appendGeometry(const float* vertex_data,
                                     std::size_t array_size)
 {
+    // instances would be drawn after the vertices appended here
+    convertQuadInstancesToVertices();
+
+    // arbitrary geometry can not be drawn through quad indices
+    convertQuadsToTriangles();
+
     d_vertexData.reserve(d_vertexData.size() + array_size);
     std::copy(vertex_data, vertex_data + array_size, std::back_inserter(d_vertexData));
 
@@ -259,6 +650,10 @@ void GeometryBuffer::setRenderMaterial(RefCounted<RenderMaterial> render_materia
 //---------------------------------------------------------------------------//
 void GeometryBuffer::setStencilRenderingActive(PolygonFillRule fill_rule)
 {
+    // the stencil passes draw ranges of the triangle list
+    if (fill_rule != PolygonFillRule::NoFilling)
+        convertQuadsToTriangles();
+
     d_polygonFillRule = fill_rule;
 }
 
@@ -287,6 +682,7 @@ void GeometryBuffer::setTranslation(const glm::vec3& translation)
     {
         d_translation = translation;
         d_matrixValid = false;
+        d_transformCacheValid = false;
     }
 }
 
@@ -297,6 +693,7 @@ void GeometryBuffer::setRotation(const glm::quat& rotationQuat)
     {
         d_rotation = rotationQuat;
         d_matrixValid = false;
+        d_transformCacheValid = false;
     }
 }
 
@@ -307,6 +704,7 @@ void GeometryBuffer::setScale(const glm::vec3& scale)
     {
         d_scale = scale;
         d_matrixValid = false;
+        d_transformCacheValid = false;
     }
 }
 
@@ -323,6 +721,7 @@ void GeometryBuffer::setPivot(const glm::vec3& p)
     {
         d_pivot = p;
         d_matrixValid = false;
+        d_transformCacheValid = false;
     }
 }
 
@@ -333,11 +732,13 @@ void GeometryBuffer::setCustomTransform(const glm::mat4x4& transformation)
     {
         d_customTransform = transformation;
         d_matrixValid = false;
+        d_transformCacheValid = false;
     }
 }
 
 void GeometryBuffer::setClippingRegion(const Rectf& region)
 {
+    d_clipRegion.reset();
     d_clippingRegion = region;
 
     d_preparedClippingRegion.top(std::max(0.0f, region.top()));
@@ -346,14 +747,34 @@ void GeometryBuffer::setClippingRegion(const Rectf& region)
     d_preparedClippingRegion.right(std::max(0.0f, region.right()));
 }
 
+//----------------------------------------------------------------------------//
+void GeometryBuffer::setClipRegion(const RefCounted<const ClipRegion>& clipRegion)
+{
+    d_clipRegion = clipRegion;
+}
+
+//----------------------------------------------------------------------------//
 const Rectf& GeometryBuffer::getClippingRegion() const
 {
-    return d_clippingRegion;
+    return d_clipRegion ? d_clipRegion->getRegion() : d_clippingRegion;
 }
 
+//----------------------------------------------------------------------------//
 const Rectf& GeometryBuffer::getPreparedClippingRegion() const
 {
-    return d_preparedClippingRegion;
+    return d_clipRegion ? d_clipRegion->getPreparedRegion() : d_preparedClippingRegion;
+}
+
+//----------------------------------------------------------------------------//
+bool GeometryBuffer::hasEquivalentClipping(const GeometryBuffer& other) const
+{
+    if (d_clippingActive != other.d_clippingActive)
+        return false;
+
+    if (!d_clippingActive || (d_clipRegion && d_clipRegion == other.d_clipRegion))
+        return true;
+
+    return getPreparedClippingRegion() == other.getPreparedClippingRegion();
 }
 
 //----------------------------------------------------------------------------//
@@ -379,9 +800,418 @@ std::size_t GeometryBuffer::getVertexCount() const
 void GeometryBuffer::reset()
 {
     d_vertexData.clear();
+    d_vertexCount = 0;
+    d_usingQuadIndices = false;
     d_clippingActive = true;
 }
 
+//----------------------------------------------------------------------------//
+void GeometryBuffer::copyGeometryFrom(const GeometryBuffer& source)
+{
+    reset();
+
+    copyTexturesFrom(source);
+    setBlendMode(source.d_blendMode);
+    setClippingActive(source.d_clippingActive);
+    d_layerColours = source.d_layerColours;
+    d_polygonFillRule = source.d_polygonFillRule;
+    d_postStencilVertexCount = source.d_postStencilVertexCount;
+    d_quadIndexingEnabled = source.d_quadIndexingEnabled;
+    d_clippingMaskType = source.d_clippingMaskType;
+    d_clippingMaskArea = source.d_clippingMaskArea;
+    d_clippingMaskCornerRadius = source.d_clippingMaskCornerRadius;
+    d_clippingMaskTexture = source.d_clippingMaskTexture;
+    d_clippingMaskTexArea = source.d_clippingMaskTexArea;
+
+    // the vertices may be laid out as quads, which must be kept as they are
+    appendGeometry(source.d_vertexData.data(), source.d_vertexData.size());
+    d_usingQuadIndices = source.d_usingQuadIndices;
+}
+
+//----------------------------------------------------------------------------//
+void GeometryBuffer::copyClippedGeometryFrom(const GeometryBuffer& source,
+                                             const Rectf& clip_rect)
+{
+    GeometryBuffer::copyGeometryFrom(source);
+
+    const std::size_t stride = getVertexAttributeElementCount();
+    const std::size_t primitiveSize = (d_usingQuadIndices ? 4 : 3) * stride;
+    const std::vector<float>& vertexData = source.d_vertexData;
+
+    std::vector<float> clippedData;
+    clippedData.reserve(vertexData.size());
+
+    for (std::size_t first = 0; first + primitiveSize <= vertexData.size(); first += primitiveSize)
+    {
+        const float* v = &vertexData[first];
+
+        Rectf bounds(v[0], v[1], v[0], v[1]);
+        for (std::size_t i = stride; i < primitiveSize; i += stride)
+        {
+            bounds.d_min = glm::min(bounds.d_min, glm::vec2(v[i], v[i + 1]));
+            bounds.d_max = glm::max(bounds.d_max, glm::vec2(v[i], v[i + 1]));
+        }
+
+        // drop what is clipped away entirely, keep what is not clipped at all
+        if (bounds.right() <= clip_rect.left() || bounds.left() >= clip_rect.right() ||
+            bounds.bottom() <= clip_rect.top() || bounds.top() >= clip_rect.bottom())
+            continue;
+
+        clippedData.insert(clippedData.end(), v, v + primitiveSize);
+
+        if (bounds.left() >= clip_rect.left() && bounds.right() <= clip_rect.right() &&
+            bounds.top() >= clip_rect.top() && bounds.bottom() <= clip_rect.bottom())
+            continue;
+
+        // attributes are interpolated over the plane of the first three
+        // vertices, which is exact for the linear mapping of imagery.
+        const float* v0 = v;
+        const float* v1 = v + stride;
+        const float* v2 = v + 2 * stride;
+        const float det = (v1[1] - v2[1]) * (v0[0] - v2[0]) + (v2[0] - v1[0]) * (v0[1] - v2[1]);
+
+        float* out = &clippedData[clippedData.size() - primitiveSize];
+        for (std::size_t i = 0; i < primitiveSize; i += stride)
+        {
+            const float x = glm::clamp(out[i], clip_rect.left(), clip_rect.right());
+            const float y = glm::clamp(out[i + 1], clip_rect.top(), clip_rect.bottom());
+
+            if (det != 0.0f && (x != out[i] || y != out[i + 1]))
+            {
+                const float l0 = ((v1[1] - v2[1]) * (x - v2[0]) + (v2[0] - v1[0]) * (y - v2[1])) / det;
+                const float l1 = ((v2[1] - v0[1]) * (x - v2[0]) + (v0[0] - v2[0]) * (y - v2[1])) / det;
+                const float l2 = 1.0f - l0 - l1;
+
+                for (std::size_t attr = 2; attr < stride; ++attr)
+                    out[i + attr] = l0 * v0[attr] + l1 * v1[attr] + l2 * v2[attr];
+            }
+
+            out[i] = x;
+            out[i + 1] = y;
+        }
+    }
+
+    // the layout of the data stays the same, so stored quads are kept
+    const bool usingQuadIndices = d_usingQuadIndices;
+    d_vertexData.clear();
+    d_usingQuadIndices = false;
+    appendGeometry(clippedData.data(), clippedData.size());
+    d_usingQuadIndices = usingQuadIndices;
+}
+
+//----------------------------------------------------------------------------//
+void GeometryBuffer::copyTexturesFrom(const GeometryBuffer& source)
+{
+    const ShaderParameterBindings::ShaderParameterBindingsMap& parameters =
+        source.d_renderMaterial->getShaderParamBindings()->getShaderParameterBindings();
+    for (const auto& parameter : parameters)
+    {
+        if (parameter.second && parameter.second->getType() == ShaderParamType::Texture)
+            setTexture(parameter.first,
+                static_cast<const ShaderParameterTexture*>(parameter.second)->d_parameterValue);
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool GeometryBuffer::isMergeable() const
+{
+    return !d_effect && d_polygonFillRule == PolygonFillRule::NoFilling &&
+        getQuadInstanceCount() == 0 &&
+        d_rotation == glm::quat(1, 0, 0, 0) && d_scale == glm::vec3(1.0f, 1.0f, 1.0f) &&
+        d_customTransform == glm::mat4x4(1.0f);
+}
+
+//----------------------------------------------------------------------------//
+bool GeometryBuffer::getDrawnArea(Rectf& area) const
+{
+    if (!isMergeable())
+        return false;
+
+    std::size_t positionOffset = 0;
+    std::size_t offset = 0;
+    for (VertexAttributeType attribute : d_vertexAttributes)
+    {
+        if (attribute == VertexAttributeType::Position0)
+            positionOffset = offset;
+
+        offset += attribute == VertexAttributeType::Position0 ? 3 :
+                  attribute == VertexAttributeType::Colour0 ? 4 : 2;
+    }
+    const std::size_t stride = offset;
+
+    if (d_vertexData.empty() || stride == 0)
+    {
+        area = Rectf(0.0f, 0.0f, 0.0f, 0.0f);
+        return true;
+    }
+
+    glm::vec2 min(std::numeric_limits<float>::max());
+    glm::vec2 max(-std::numeric_limits<float>::max());
+    for (std::size_t vertex = 0; vertex + stride <= d_vertexData.size(); vertex += stride)
+    {
+        const glm::vec2 position(d_vertexData[vertex + positionOffset],
+                                 d_vertexData[vertex + positionOffset + 1]);
+        min = glm::min(min, position);
+        max = glm::max(max, position);
+    }
+
+    const glm::vec2 translation(d_translation.x, d_translation.y);
+    area = Rectf(min + translation, max + translation);
+
+    if (d_clippingActive)
+        area = area.getIntersection(getPreparedClippingRegion());
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool GeometryBuffer::getOpaqueArea(Rectf& area) const
+{
+    if (d_alpha < 1.0f || d_clippingMaskType != ClippingMaskType::NoMask ||
+        d_blendMode == BlendMode::Invalid)
+        return false;
+
+    // one quad, as two triangles or as four indexed vertices
+    if (d_vertexCount != (d_usingQuadIndices ? 4u : 6u))
+        return false;
+
+    const Texture* const texture = getTexture("texture0");
+    std::size_t positionOffset = 0;
+    std::size_t colourOffset = 0;
+    bool hasColour = false;
+    bool hasTexCoords = false;
+    std::size_t offset = 0;
+    for (VertexAttributeType attribute : d_vertexAttributes)
+    {
+        if (attribute == VertexAttributeType::Position0)
+            positionOffset = offset;
+        else if (attribute == VertexAttributeType::Colour0)
+        {
+            colourOffset = offset;
+            hasColour = true;
+        }
+        else
+            hasTexCoords = true;
+
+        offset += attribute == VertexAttributeType::Position0 ? 3 :
+                  attribute == VertexAttributeType::Colour0 ? 4 : 2;
+    }
+    const std::size_t stride = offset;
+
+    if (hasTexCoords && (!texture || !texture->isOpaque()))
+        return false;
+
+    if (!isMergeable())
+        return false;
+
+    // corner of the untranslated bounding box each vertex is at, as bit 0 for
+    // the right and bit 1 for the bottom edge
+    const glm::vec2 translation(d_translation.x, d_translation.y);
+    int corners[6];
+    glm::vec2 min(std::numeric_limits<float>::max());
+    glm::vec2 max(-std::numeric_limits<float>::max());
+    for (std::size_t vertex = 0; vertex < d_vertexCount; ++vertex)
+    {
+        const float* const data = &d_vertexData[vertex * stride];
+        if (hasColour && data[colourOffset + 3] < 1.0f)
+            return false;
+
+        const glm::vec2 position(data[positionOffset], data[positionOffset + 1]);
+        min = glm::min(min, position);
+        max = glm::max(max, position);
+    }
+
+    for (std::size_t vertex = 0; vertex < d_vertexCount; ++vertex)
+    {
+        const float* const data = &d_vertexData[vertex * stride];
+        const float x = data[positionOffset];
+        const float y = data[positionOffset + 1];
+        if ((x != min.x && x != max.x) || (y != min.y && y != max.y))
+            return false;
+
+        corners[vertex] = (x == max.x ? 1 : 0) | (y == max.y ? 2 : 0);
+    }
+
+    if (d_usingQuadIndices)
+    {
+        // same triangles as appendQuadIndices creates
+        static const int quadIndices[6] = { 0, 1, 2, 3, 0, 2 };
+        int quadCorners[4] = { corners[0], corners[1], corners[2], corners[3] };
+        for (int i = 0; i < 6; ++i)
+            corners[i] = quadCorners[quadIndices[i]];
+    }
+
+    // each triangle must span three corners, leaving out opposite corners,
+    // so that the two together cover the box
+    int missing[2];
+    for (int triangle = 0; triangle < 2; ++triangle)
+    {
+        const int* const c = &corners[triangle * 3];
+        if (c[0] == c[1] || c[1] == c[2] || c[0] == c[2])
+            return false;
+
+        missing[triangle] = 6 - c[0] - c[1] - c[2];
+    }
+
+    if (missing[0] != (missing[1] ^ 3))
+        return false;
+
+    area = Rectf(min + translation, max + translation);
+    if (d_clippingActive)
+        area = area.getIntersection(getPreparedClippingRegion());
+
+    return area.getWidth() > 0.0f && area.getHeight() > 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+bool GeometryBuffer::hasEquivalentBlendMode(const GeometryBuffer& other) const
+{
+    if (d_blendMode == other.d_blendMode)
+        return true;
+
+    const System* system = System::getSingletonPtr();
+    return system && system->getRenderer()->isPremultipliedAlphaEnabled();
+}
+
+//----------------------------------------------------------------------------//
+bool GeometryBuffer::isMergeableWith(const GeometryBuffer& other) const
+{
+    if (!isMergeable() || !other.isMergeable())
+        return false;
+
+    if (!hasEquivalentBlendMode(other) ||
+        d_vertexAttributes != other.d_vertexAttributes ||
+        d_renderMaterial->getShaderWrapper() != other.d_renderMaterial->getShaderWrapper() ||
+        d_layerColours != other.d_layerColours)
+        return false;
+
+    // every texture of one buffer must be bound to the other one as well
+    std::size_t textureCount = 0;
+    const ShaderParameterBindings::ShaderParameterBindingsMap& parameters =
+        d_renderMaterial->getShaderParamBindings()->getShaderParameterBindings();
+    for (const auto& parameter : parameters)
+    {
+        if (!parameter.second || parameter.second->getType() != ShaderParamType::Texture)
+            continue;
+
+        if (other.getTexture(parameter.first) !=
+            static_cast<const ShaderParameterTexture*>(parameter.second)->d_parameterValue)
+            return false;
+
+        ++textureCount;
+    }
+
+    const ShaderParameterBindings::ShaderParameterBindingsMap& otherParameters =
+        other.d_renderMaterial->getShaderParamBindings()->getShaderParameterBindings();
+    for (const auto& parameter : otherParameters)
+    {
+        if (parameter.second && parameter.second->getType() == ShaderParamType::Texture)
+        {
+            if (textureCount == 0)
+                return false;
+            --textureCount;
+        }
+    }
+
+    return textureCount == 0;
+}
+
+//----------------------------------------------------------------------------//
+void GeometryBuffer::appendMergedGeometryFrom(const GeometryBuffer& source)
+{
+    if (d_vertexData.empty())
+    {
+        copyTexturesFrom(source);
+        setBlendMode(source.d_blendMode);
+        d_quadIndexingEnabled = source.d_quadIndexingEnabled;
+        d_layerColours = source.d_layerColours;
+    }
+
+    std::size_t positionOffset = 0;
+    std::size_t colourOffset = 0;
+    std::size_t offset = 0;
+    for (VertexAttributeType attribute : d_vertexAttributes)
+    {
+        if (attribute == VertexAttributeType::Position0)
+            positionOffset = offset;
+        else if (attribute == VertexAttributeType::Colour0)
+            colourOffset = offset;
+
+        offset += attribute == VertexAttributeType::Position0 ? 3 :
+                  attribute == VertexAttributeType::Colour0 ? 4 : 2;
+    }
+    const std::size_t stride = offset;
+
+    // quads are kept as they are if our vertices may be laid out as quads too
+    const bool keepQuads = source.d_usingQuadIndices && d_quadIndexingEnabled &&
+        (d_usingQuadIndices || d_vertexData.empty());
+
+    std::vector<float> vertexData;
+    if (source.d_usingQuadIndices && !keepQuads)
+    {
+        static const std::size_t quadVertices[6] = { 0, 1, 2, 3, 0, 2 };
+        vertexData.reserve(source.d_vertexData.size() / 4 * 6);
+        for (std::size_t quad = 0; quad + 4 * stride <= source.d_vertexData.size(); quad += 4 * stride)
+        {
+            for (std::size_t vertex : quadVertices)
+            {
+                const float* data = &source.d_vertexData[quad + vertex * stride];
+                vertexData.insert(vertexData.end(), data, data + stride);
+            }
+        }
+    }
+    else
+    {
+        vertexData = source.d_vertexData;
+    }
+
+    for (std::size_t vertex = 0; vertex + stride <= vertexData.size(); vertex += stride)
+    {
+        vertexData[vertex + positionOffset] += source.d_translation.x;
+        vertexData[vertex + positionOffset + 1] += source.d_translation.y;
+        vertexData[vertex + positionOffset + 2] += source.d_translation.z;
+        vertexData[vertex + colourOffset + 3] *= source.d_alpha;
+    }
+
+    if (keepQuads)
+    {
+        // the vertices continue the quad layout, so it must not be converted
+        d_usingQuadIndices = false;
+        appendGeometry(vertexData.data(), vertexData.size());
+        d_usingQuadIndices = true;
+    }
+    else
+    {
+        appendGeometry(vertexData.data(), vertexData.size());
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GeometryBuffer::resetForReuse()
+{
+    reset();
+
+    d_translation = glm::vec3(0, 0, 0);
+    d_rotation = glm::quat(1, 0, 0, 0);
+    d_scale = glm::vec3(1.0f, 1.0f, 1.0f);
+    d_pivot = glm::vec3(0, 0, 0);
+    d_customTransform = glm::mat4x4(1.0f);
+    d_layerColours = glm::mat4(0.0f);
+    d_matrixValid = false;
+    d_transformCacheValid = false;
+    d_blendMode = BlendMode::Normal;
+    d_polygonFillRule = PolygonFillRule::NoFilling;
+    d_postStencilVertexCount = 0;
+    d_effect = nullptr;
+    d_clippingRegion = Rectf(0, 0, 0, 0);
+    d_preparedClippingRegion = Rectf(0, 0, 0, 0);
+    d_clipRegion.reset();
+    d_clippingActive = false;
+    d_alpha = 1.0f;
+    d_quadIndexingEnabled = false;
+    clearClippingMask();
+}
+
 //----------------------------------------------------------------------------//
 void GeometryBuffer::setTexture(const std::string& parameterName, const Texture* texture)
 {
@@ -405,6 +1235,7 @@ float GeometryBuffer::getAlpha() const
 void GeometryBuffer::invalidateMatrix()
 {
     d_matrixValid = false;
+    d_transformCacheValid = false;
 }
 
 //---------------------------------------------------------------------------//
@@ -444,6 +1275,38 @@ glm::mat4 GeometryBuffer::getModelMatrix() const
     return modelMatrix;
 }
 
+//----------------------------------------------------------------------------//
+const glm::mat4& GeometryBuffer::getModelViewProjMatrix(
+    const glm::mat4& viewProjMatrix) const
+{
+    updateTransformCache(viewProjMatrix);
+    return d_transformCache->d_modelViewProjMatrix;
+}
+
+//----------------------------------------------------------------------------//
+const glm::mat4& GeometryBuffer::getInverseModelViewProjMatrix(
+    const glm::mat4& viewProjMatrix) const
+{
+    updateTransformCache(viewProjMatrix);
+    return d_transformCache->d_inverseModelViewProjMatrix;
+}
+
+//----------------------------------------------------------------------------//
+void GeometryBuffer::updateTransformCache(const glm::mat4& viewProjMatrix) const
+{
+    if (!d_transformCache)
+        d_transformCache.reset(new TransformCache());
+    else if (d_transformCacheValid &&
+             d_transformCache->d_viewProjMatrix == viewProjMatrix)
+        return;
+
+    d_transformCache->d_viewProjMatrix = viewProjMatrix;
+    d_transformCache->d_modelViewProjMatrix = viewProjMatrix * getModelMatrix();
+    d_transformCache->d_inverseModelViewProjMatrix =
+        glm::inverse(d_transformCache->d_modelViewProjMatrix);
+    d_transformCacheValid = true;
+}
+
 const Texture* GeometryBuffer::getTexture(const std::string& parameterName) const
 {
     auto renderMaterial = getRenderMaterial();
@@ -474,7 +1337,12 @@ void GeometryBuffer::updateTextureCoordinates(const Texture* texture, const floa
 
     std::vector<float> tempVertexData;
     std::swap(tempVertexData, d_vertexData);
+
+    // the layout of the data stays the same, so stored quads are kept
+    const bool usingQuadIndices = d_usingQuadIndices;
+    d_usingQuadIndices = false;
     appendGeometry(tempVertexData.data(), tempVertexData.size());
+    d_usingQuadIndices = usingQuadIndices;
 }
 
 }
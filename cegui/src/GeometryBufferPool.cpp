@@ -0,0 +1,174 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/GeometryBufferPool.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/System.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+GeometryBufferPool::GeometryBufferPool() :
+    d_hitCount(0),
+    d_missCount(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+GeometryBufferPool::~GeometryBufferPool()
+{
+    clear();
+}
+
+//----------------------------------------------------------------------------//
+void GeometryBufferPool::beginPass(std::vector<GeometryBuffer*>& buffers)
+{
+    Renderer* renderer = System::getSingleton().getRenderer();
+
+    for (GeometryBuffer* buffer : buffers)
+    {
+        BufferTypeMap::iterator iter = d_ownedBuffers.find(buffer);
+        if (iter != d_ownedBuffers.end())
+        {
+            d_freeBuffers[static_cast<int>(iter->second)].push_back(buffer);
+            d_ownedBuffers.erase(iter);
+        }
+        else
+        {
+            renderer->destroyGeometryBuffer(*buffer);
+        }
+    }
+
+    buffers.clear();
+    d_issuedBuffers.clear();
+}
+
+//----------------------------------------------------------------------------//
+void GeometryBufferPool::endPass(const std::vector<GeometryBuffer*>& buffers)
+{
+    // buffers that were handed out but not kept by the caller are owned by
+    // someone else and must not be recycled by us
+    for (GeometryBuffer* buffer : buffers)
+    {
+        BufferTypeMap::const_iterator iter = d_issuedBuffers.find(buffer);
+        if (iter != d_issuedBuffers.end())
+            d_ownedBuffers.insert(*iter);
+    }
+
+    d_issuedBuffers.clear();
+}
+
+//----------------------------------------------------------------------------//
+GeometryBuffer* GeometryBufferPool::acquire(DefaultShaderType shaderType)
+{
+    std::vector<GeometryBuffer*>& freeBuffers = d_freeBuffers[static_cast<int>(shaderType)];
+
+    if (freeBuffers.empty())
+    {
+        ++d_missCount;
+        return nullptr;
+    }
+
+    ++d_hitCount;
+    GeometryBuffer* buffer = freeBuffers.back();
+    freeBuffers.pop_back();
+    buffer->resetForReuse();
+
+    return buffer;
+}
+
+//----------------------------------------------------------------------------//
+void GeometryBufferPool::notifyIssued(GeometryBuffer& buffer, DefaultShaderType shaderType)
+{
+    d_issuedBuffers[&buffer] = shaderType;
+}
+
+//----------------------------------------------------------------------------//
+bool GeometryBufferPool::getIssuedShaderType(const GeometryBuffer& buffer,
+                                             DefaultShaderType& shaderType) const
+{
+    BufferTypeMap::const_iterator iter = d_issuedBuffers.find(&buffer);
+    if (iter == d_issuedBuffers.end())
+        return false;
+
+    shaderType = iter->second;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void GeometryBufferPool::notifyDestroyed(const GeometryBuffer& buffer)
+{
+    d_issuedBuffers.erase(&buffer);
+    d_ownedBuffers.erase(&buffer);
+}
+
+//----------------------------------------------------------------------------//
+void GeometryBufferPool::clear()
+{
+    d_issuedBuffers.clear();
+    d_ownedBuffers.clear();
+
+    if (!System::getSingletonPtr())
+        return;
+
+    Renderer* renderer = System::getSingleton().getRenderer();
+    for (std::vector<GeometryBuffer*>& freeBuffers : d_freeBuffers)
+    {
+        for (GeometryBuffer* buffer : freeBuffers)
+            renderer->destroyGeometryBuffer(*buffer);
+
+        freeBuffers.clear();
+    }
+}
+
+//----------------------------------------------------------------------------//
+float GeometryBufferPool::getHitRate() const
+{
+    const std::size_t requestCount = d_hitCount + d_missCount;
+    return requestCount ? static_cast<float>(d_hitCount) / requestCount : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t GeometryBufferPool::getFreeBufferCount() const
+{
+    std::size_t count = 0;
+    for (const std::vector<GeometryBuffer*>& freeBuffers : d_freeBuffers)
+        count += freeBuffers.size();
+
+    return count;
+}
+
+//----------------------------------------------------------------------------//
+void GeometryBufferPool::resetStatistics()
+{
+    d_hitCount = 0;
+    d_missCount = 0;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,390 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/GeometryCache.h"
+#include "CEGUI/GeometryBufferPool.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/System.h"
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const std::size_t GeometryCache::DefaultCapacity = 16;
+const std::size_t GeometryTemplateCache::DefaultCapacity = 256;
+
+namespace
+{
+//----------------------------------------------------------------------------//
+GeometryBuffer& createGeometryBuffer(Renderer& renderer, DefaultShaderType shaderType)
+{
+    return shaderType == DefaultShaderType::Solid ?
+        renderer.createGeometryBufferColoured() :
+        renderer.createGeometryBufferTextured(shaderType);
+}
+
+}
+
+//----------------------------------------------------------------------------//
+GeometryCacheKey::GeometryCacheKey(const void* source) :
+    d_hash(0)
+{
+    add(source);
+}
+
+//----------------------------------------------------------------------------//
+void GeometryCacheKey::add(std::uint32_t value)
+{
+    addValue(value);
+}
+
+//----------------------------------------------------------------------------//
+void GeometryCacheKey::add(float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    addValue(bits);
+}
+
+//----------------------------------------------------------------------------//
+void GeometryCacheKey::add(const void* pointer)
+{
+    addValue(reinterpret_cast<std::uintptr_t>(pointer));
+}
+
+//----------------------------------------------------------------------------//
+void GeometryCacheKey::add(const Rectf& rect)
+{
+    add(rect.left());
+    add(rect.top());
+    add(rect.right());
+    add(rect.bottom());
+}
+
+//----------------------------------------------------------------------------//
+void GeometryCacheKey::add(const ColourRect& colours)
+{
+    add(colours.d_top_left.getARGB());
+    add(colours.d_top_right.getARGB());
+    add(colours.d_bottom_left.getARGB());
+    add(colours.d_bottom_right.getARGB());
+}
+
+//----------------------------------------------------------------------------//
+void GeometryCacheKey::addValue(std::uintptr_t value)
+{
+    d_values.push_back(value);
+    d_hash ^= std::hash<std::uintptr_t>()(value) + 0x9e3779b9 + (d_hash << 6) + (d_hash >> 2);
+}
+
+//----------------------------------------------------------------------------//
+bool GeometryCacheKey::operator==(const GeometryCacheKey& rhs) const
+{
+    return d_hash == rhs.d_hash && d_values == rhs.d_values;
+}
+
+//----------------------------------------------------------------------------//
+GeometryCache::GeometryCache() :
+    d_capacity(DefaultCapacity),
+    d_pass(0),
+    d_hitCount(0),
+    d_missCount(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+GeometryCache::~GeometryCache()
+{
+    clear();
+}
+
+//----------------------------------------------------------------------------//
+void GeometryCache::beginPass(std::vector<GeometryBuffer*>& buffers)
+{
+    detach(buffers);
+    ++d_pass;
+
+    if (d_entries.size() <= d_capacity)
+        return;
+
+    // most recently used entries first, the tail gets evicted
+    std::stable_sort(d_entries.begin(), d_entries.end(),
+        [](const Entry& a, const Entry& b) { return a.d_lastUsedPass > b.d_lastUsedPass; });
+
+    for (std::size_t i = d_capacity; i < d_entries.size(); ++i)
+        destroyEntry(d_entries[i]);
+
+    d_entries.erase(d_entries.begin() + d_capacity, d_entries.end());
+}
+
+//----------------------------------------------------------------------------//
+void GeometryCache::detach(std::vector<GeometryBuffer*>& buffers) const
+{
+    if (d_ownedBuffers.empty())
+        return;
+
+    buffers.erase(std::remove_if(buffers.begin(), buffers.end(),
+        [this](const GeometryBuffer* buffer) { return d_ownedBuffers.count(buffer) != 0; }),
+        buffers.end());
+}
+
+//----------------------------------------------------------------------------//
+const std::vector<GeometryBuffer*>* GeometryCache::find(const GeometryCacheKey& key)
+{
+    for (Entry& entry : d_entries)
+    {
+        if (entry.d_key == key)
+        {
+            ++d_hitCount;
+            entry.d_lastUsedPass = d_pass;
+            return &entry.d_buffers;
+        }
+    }
+
+    ++d_missCount;
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------//
+void GeometryCache::store(const GeometryCacheKey& key,
+                          const std::vector<GeometryBuffer*>& buffers, std::size_t first)
+{
+    if (!d_capacity)
+        return;
+
+    Entry entry{ key, {}, d_pass };
+    GeometryBufferPool* pool = System::getSingleton().getRenderer()->getActiveGeometryBufferPool();
+
+    for (std::size_t i = first; i < buffers.size(); ++i)
+    {
+        // a buffer may only belong to a single entry
+        if (!d_ownedBuffers.insert(buffers[i]).second)
+            continue;
+
+        // the pool must neither recycle nor destroy what we keep
+        if (pool)
+            pool->notifyDestroyed(*buffers[i]);
+
+        entry.d_buffers.push_back(buffers[i]);
+    }
+
+    d_entries.push_back(std::move(entry));
+}
+
+//----------------------------------------------------------------------------//
+void GeometryCache::clear()
+{
+    for (Entry& entry : d_entries)
+        destroyEntry(entry);
+
+    d_entries.clear();
+}
+
+//----------------------------------------------------------------------------//
+void GeometryCache::setCapacity(std::size_t capacity)
+{
+    d_capacity = capacity;
+}
+
+//----------------------------------------------------------------------------//
+void GeometryCache::resetStatistics()
+{
+    d_hitCount = 0;
+    d_missCount = 0;
+}
+
+//----------------------------------------------------------------------------//
+void GeometryCache::destroyEntry(Entry& entry)
+{
+    Renderer* renderer = System::getSingletonPtr() ?
+        System::getSingleton().getRenderer() : nullptr;
+
+    for (GeometryBuffer* buffer : entry.d_buffers)
+    {
+        d_ownedBuffers.erase(buffer);
+        if (renderer)
+            renderer->destroyGeometryBuffer(*buffer);
+    }
+
+    entry.d_buffers.clear();
+}
+
+//----------------------------------------------------------------------------//
+GeometryTemplateCache::GeometryTemplateCache() :
+    d_capacity(DefaultCapacity),
+    d_useCounter(0),
+    d_hitCount(0),
+    d_missCount(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+GeometryTemplateCache::~GeometryTemplateCache()
+{
+    clear();
+}
+
+//----------------------------------------------------------------------------//
+bool GeometryTemplateCache::instantiate(const GeometryCacheKey& key,
+                                        std::vector<GeometryBuffer*>& buffers)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+
+    for (Entry& entry : d_entries)
+    {
+        if (entry.d_key != key)
+            continue;
+
+        ++d_hitCount;
+        entry.d_lastUsed = ++d_useCounter;
+
+        Renderer& renderer = *System::getSingleton().getRenderer();
+        for (const TemplateBuffer& templateBuffer : entry.d_buffers)
+        {
+            GeometryBuffer& buffer = createGeometryBuffer(renderer, templateBuffer.d_shaderType);
+            buffer.copyGeometryFrom(*templateBuffer.d_buffer);
+            buffers.push_back(&buffer);
+        }
+
+        return true;
+    }
+
+    ++d_missCount;
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+void GeometryTemplateCache::store(const GeometryCacheKey& key,
+                                  const std::vector<GeometryBuffer*>& buffers,
+                                  std::size_t first)
+{
+    if (!d_capacity)
+        return;
+
+    Renderer& renderer = *System::getSingleton().getRenderer();
+    GeometryBufferPool* pool = renderer.getActiveGeometryBufferPool();
+    if (!pool)
+        return;
+
+    // buffers with a custom material can not be created again
+    std::vector<DefaultShaderType> shaderTypes(buffers.size() - first);
+    for (std::size_t i = first; i < buffers.size(); ++i)
+    {
+        if (!pool->getIssuedShaderType(*buffers[i], shaderTypes[i - first]))
+            return;
+    }
+
+    std::lock_guard<std::mutex> lock(d_mutex);
+
+    // another window may have stored the same template meanwhile
+    for (const Entry& entry : d_entries)
+    {
+        if (entry.d_key == key)
+            return;
+    }
+
+    if (d_entries.size() >= d_capacity)
+        evictLeastRecentlyUsed();
+
+    Entry entry{ key, {}, ++d_useCounter };
+
+    // the copies are ours, they must neither come from nor go to the pool
+    renderer.setActiveGeometryBufferPool(nullptr);
+    for (std::size_t i = first; i < buffers.size(); ++i)
+    {
+        const DefaultShaderType shaderType = shaderTypes[i - first];
+        GeometryBuffer& copy = createGeometryBuffer(renderer, shaderType);
+        copy.copyGeometryFrom(*buffers[i]);
+        entry.d_buffers.push_back({ &copy, shaderType });
+    }
+    renderer.setActiveGeometryBufferPool(pool);
+
+    d_entries.push_back(std::move(entry));
+}
+
+//----------------------------------------------------------------------------//
+void GeometryTemplateCache::clear()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+
+    for (Entry& entry : d_entries)
+        destroyEntry(entry);
+
+    d_entries.clear();
+}
+
+//----------------------------------------------------------------------------//
+void GeometryTemplateCache::setCapacity(std::size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+
+    d_capacity = capacity;
+    while (d_entries.size() > d_capacity)
+        evictLeastRecentlyUsed();
+}
+
+//----------------------------------------------------------------------------//
+std::size_t GeometryTemplateCache::getEntryCount() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_entries.size();
+}
+
+//----------------------------------------------------------------------------//
+void GeometryTemplateCache::resetStatistics()
+{
+    d_hitCount = 0;
+    d_missCount = 0;
+}
+
+//----------------------------------------------------------------------------//
+void GeometryTemplateCache::evictLeastRecentlyUsed()
+{
+    std::vector<Entry>::iterator oldest = std::min_element(d_entries.begin(), d_entries.end(),
+        [](const Entry& a, const Entry& b) { return a.d_lastUsed < b.d_lastUsed; });
+    destroyEntry(*oldest);
+    d_entries.erase(oldest);
+}
+
+//----------------------------------------------------------------------------//
+void GeometryTemplateCache::destroyEntry(Entry& entry)
+{
+    if (System::getSingletonPtr())
+    {
+        Renderer* renderer = System::getSingleton().getRenderer();
+        for (const TemplateBuffer& templateBuffer : entry.d_buffers)
+            renderer->destroyGeometryBuffer(*templateBuffer.d_buffer);
+    }
+
+    entry.d_buffers.clear();
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -85,6 +85,11 @@ namespace CEGUI
         // Doing it 'longhand' like this saves significant time when compared
         // to the obvious - and previous - implementation:
         //     fireEvent_impl(eventNamespace + "/" + name, args);
+        // Nothing is subscribed globally to most events, so we don't even
+        // build the string unless the name passes our filter.
+        if (!(d_subscribedNameFilter & getNameFilterBit(name)))
+            return;
+
         String evt_name;
         evt_name.reserve(eventNamespace.length() + name.length() + 1);
         evt_name.append(eventNamespace);
@@ -93,4 +98,30 @@ namespace CEGUI
         fireEvent_impl(evt_name, args);
 	}
 
+	/*************************************************************************
+		Record the name of an added event in the filter
+	*************************************************************************/
+	void GlobalEventSet::notifyEventAdded(const Event& event)
+	{
+        const String& fullName = event.getName();
+        const String::size_type separator = fullName.rfind('/');
+        d_subscribedNameFilter |= getNameFilterBit(
+            separator == String::npos ? fullName : fullName.substr(separator + 1));
+	}
+
+	/*************************************************************************
+		Return the filter bit for an event name
+	*************************************************************************/
+	std::uint64_t GlobalEventSet::getNameFilterBit(const String& name)
+	{
+        if (name.empty())
+            return 1;
+
+        const std::uint64_t hash = name.length() * 7 +
+            static_cast<std::uint64_t>(name[0]) * 3 +
+            static_cast<std::uint64_t>(name[name.length() - 1]);
+
+        return static_cast<std::uint64_t>(1) << (hash & 63);
+	}
+
 } // End of  CEGUI namespace section
@@ -0,0 +1,350 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/GradientImage.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Vertex.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/PropertyHelper.h"
+#include "CEGUI/System.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+const String ImageTypeAttribute( "type" );
+const String ImageNameAttribute( "name" );
+const String ImageXPosAttribute( "xPos" );
+const String ImageYPosAttribute( "yPos" );
+const String ImageWidthAttribute( "width" );
+const String ImageHeightAttribute( "height" );
+const String ImageXOffsetAttribute( "xOffset" );
+const String ImageYOffsetAttribute( "yOffset" );
+const String ImageAutoScaledAttribute( "autoScaled" );
+const String ImageNativeHorzResAttribute( "nativeHorzRes" );
+const String ImageNativeVertResAttribute( "nativeVertRes" );
+const String ImageColoursAttribute( "colours" );
+const String ImageHorzSubdivisionsAttribute( "horzSubdivisions" );
+const String ImageVertSubdivisionsAttribute( "vertSubdivisions" );
+
+namespace
+{
+//----------------------------------------------------------------------------//
+void appendColouredQuad(std::vector<ColouredVertex>& vertices,
+                        const Rectf& area, const ColourRect& colours)
+{
+    glm::vec4 tl, tr, bl, br;
+    colours.d_top_left.getRGBA(&tl.x);
+    colours.d_top_right.getRGBA(&tr.x);
+    colours.d_bottom_left.getRGBA(&bl.x);
+    colours.d_bottom_right.getRGBA(&br.x);
+
+    vertices.push_back(ColouredVertex(glm::vec3(area.left(), area.top(), 0.0f), tl));
+    vertices.push_back(ColouredVertex(glm::vec3(area.left(), area.bottom(), 0.0f), bl));
+    vertices.push_back(ColouredVertex(glm::vec3(area.right(), area.bottom(), 0.0f), br));
+    vertices.push_back(ColouredVertex(glm::vec3(area.right(), area.bottom(), 0.0f), br));
+    vertices.push_back(ColouredVertex(glm::vec3(area.right(), area.top(), 0.0f), tr));
+    vertices.push_back(ColouredVertex(glm::vec3(area.left(), area.top(), 0.0f), tl));
+}
+
+//----------------------------------------------------------------------------//
+glm::vec2 getRelativePosition(const Rectf& area, const glm::vec2& position)
+{
+    return glm::vec2((position.x - area.left()) / area.getWidth(),
+                     (position.y - area.top()) / area.getHeight());
+}
+
+}
+
+//----------------------------------------------------------------------------//
+GradientImage::GradientImage(const String& name) :
+    Image(name),
+    d_colours(0xFFFFFFFF),
+    d_horizontalSubdivisions(1),
+    d_verticalSubdivisions(1),
+    d_checkerboardCellSize(0.0f)
+{
+}
+
+//----------------------------------------------------------------------------//
+GradientImage::GradientImage(const XMLAttributes& attributes) :
+    Image(attributes.getValueAsString(ImageNameAttribute),
+          glm::vec2(static_cast<float>(attributes.getValueAsInteger(ImageXOffsetAttribute, 0)),
+                    static_cast<float>(attributes.getValueAsInteger(ImageYOffsetAttribute, 0))),
+          Rectf(glm::vec2(static_cast<float>(attributes.getValueAsInteger(ImageXPosAttribute, 0)),
+                          static_cast<float>(attributes.getValueAsInteger(ImageYPosAttribute, 0))),
+                Sizef(static_cast<float>(attributes.getValueAsInteger(ImageWidthAttribute, 0)),
+                      static_cast<float>(attributes.getValueAsInteger(ImageHeightAttribute, 0)))),
+          PropertyHelper<AutoScaledMode>::fromString(attributes.getValueAsString(ImageAutoScaledAttribute)),
+          Sizef(static_cast<float>(attributes.getValueAsInteger(ImageNativeHorzResAttribute, 640)),
+                static_cast<float>(attributes.getValueAsInteger(ImageNativeVertResAttribute, 480)))),
+    d_colours(attributes.exists(ImageColoursAttribute) ?
+              PropertyHelper<ColourRect>::fromString(attributes.getValueAsString(ImageColoursAttribute)) :
+              ColourRect(0xFFFFFFFF)),
+    d_horizontalSubdivisions(static_cast<unsigned int>(
+        std::max(attributes.getValueAsInteger(ImageHorzSubdivisionsAttribute, 1), 1))),
+    d_verticalSubdivisions(static_cast<unsigned int>(
+        std::max(attributes.getValueAsInteger(ImageVertSubdivisionsAttribute, 1), 1))),
+    d_checkerboardCellSize(0.0f)
+{
+}
+
+//----------------------------------------------------------------------------//
+std::vector<GeometryBuffer*> GradientImage::createRenderGeometry(
+    const ImageRenderSettings& render_settings) const
+{
+    std::vector<GeometryBuffer*> geomBuffers;
+    appendRenderGeometry(geomBuffers, render_settings);
+    return geomBuffers;
+}
+
+//----------------------------------------------------------------------------//
+void GradientImage::appendRenderGeometry(std::vector<GeometryBuffer*>& geomBuffers,
+    const ImageRenderSettings& render_settings) const
+{
+    std::vector<ColouredVertex> vertices;
+    appendVertices(vertices, render_settings.d_destArea, render_settings.d_clipArea,
+                   render_settings.d_multiplyColours);
+
+    // totally clipped, so no buffer gets created
+    if (vertices.empty())
+        return;
+
+    GeometryBuffer& buffer = System::getSingleton().getRenderer()->createGeometryBufferColoured();
+
+    buffer.setClippingActive(render_settings.d_clippingEnabled);
+    if (render_settings.d_clippingEnabled)
+        buffer.setClippingRegion(*render_settings.d_clipArea);
+    buffer.appendGeometry(vertices);
+    buffer.setAlpha(render_settings.d_alpha);
+
+    geomBuffers.push_back(&buffer);
+}
+
+//----------------------------------------------------------------------------//
+void GradientImage::addToRenderGeometry(
+    GeometryBuffer& geomBuffer,
+    const Rectf& renderArea,
+    const Rectf* clipArea,
+    const ColourRect& colours) const
+{
+    // position and colour only, see ColouredVertex
+    if (geomBuffer.getVertexAttributeElementCount() != 7)
+        throw InvalidRequestException("The GradientImage '" + d_name +
+            "' can only be added to GeometryBuffers for coloured geometry.");
+
+    std::vector<ColouredVertex> vertices;
+    appendVertices(vertices, renderArea, clipArea, colours);
+
+    if (!vertices.empty())
+        geomBuffer.appendGeometry(vertices);
+}
+
+//----------------------------------------------------------------------------//
+void GradientImage::appendVertices(std::vector<ColouredVertex>& vertices,
+                                   const Rectf& renderArea, const Rectf* clipArea,
+                                   const ColourRect& colours) const
+{
+    // apply rendering offset to the destination Rect
+    Rectf destArea(renderArea);
+    destArea.offset(d_scaledOffset);
+
+    const Rectf finalArea(clipArea ? destArea.getIntersection(*clipArea) : destArea);
+    if ((finalArea.getWidth() <= 0.0f) || (finalArea.getHeight() <= 0.0f))
+        return;
+
+    if (d_checkerboardCellSize > 0.0f)
+        appendCheckerboardVertices(vertices, destArea, finalArea, colours);
+
+    // The colours are evaluated once per grid point and shared by the cells
+    const unsigned int columns = d_horizontalSubdivisions;
+    const unsigned int rows = d_verticalSubdivisions;
+    std::vector<Colour> gridColours((columns + 1) * (rows + 1));
+
+    for (unsigned int y = 0; y <= rows; ++y)
+    {
+        for (unsigned int x = 0; x <= columns; ++x)
+        {
+            const glm::vec2 relPos(static_cast<float>(x) / columns,
+                                   static_cast<float>(y) / rows);
+
+            Colour colour(getGradientColour(relPos));
+            colour *= colours.getColourAtPoint(relPos.x, relPos.y);
+            gridColours[y * (columns + 1) + x] = colour;
+        }
+    }
+
+    vertices.reserve(vertices.size() + columns * rows * 6);
+
+    const float cellWidth = destArea.getWidth() / columns;
+    const float cellHeight = destArea.getHeight() / rows;
+
+    for (unsigned int y = 0; y < rows; ++y)
+    {
+        for (unsigned int x = 0; x < columns; ++x)
+        {
+            const Rectf cellArea(destArea.left() + cellWidth * x,
+                                 destArea.top() + cellHeight * y,
+                                 destArea.left() + cellWidth * (x + 1),
+                                 destArea.top() + cellHeight * (y + 1));
+
+            const Rectf clippedArea(cellArea.getIntersection(finalArea));
+            if ((clippedArea.getWidth() <= 0.0f) || (clippedArea.getHeight() <= 0.0f))
+                continue;
+
+            const std::size_t top = y * (columns + 1) + x;
+            const std::size_t bottom = top + columns + 1;
+            const ColourRect cellColours(gridColours[top], gridColours[top + 1],
+                                         gridColours[bottom], gridColours[bottom + 1]);
+
+            // Clipped cells get the colours the GPU would have interpolated
+            // at the clipped corners, so clipping does not distort the gradient.
+            const glm::vec2 min(getRelativePosition(cellArea, clippedArea.d_min));
+            const glm::vec2 max(getRelativePosition(cellArea, clippedArea.d_max));
+
+            appendColouredQuad(vertices, clippedArea,
+                cellColours.getSubRectangle(min.x, max.x, min.y, max.y));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GradientImage::appendCheckerboardVertices(std::vector<ColouredVertex>& vertices,
+                                               const Rectf& destArea, const Rectf& finalArea,
+                                               const ColourRect& colours) const
+{
+    const float scaleX = destArea.getWidth() / d_imageArea.getWidth();
+    const float scaleY = destArea.getHeight() / d_imageArea.getHeight();
+    const float cellWidth = d_checkerboardCellSize * scaleX;
+    const float cellHeight = d_checkerboardCellSize * scaleY;
+
+    if (!(cellWidth > 0.0f) || !(cellHeight > 0.0f))
+        return;
+
+    const int columns = static_cast<int>(std::ceil(destArea.getWidth() / cellWidth));
+    const int rows = static_cast<int>(std::ceil(destArea.getHeight() / cellHeight));
+
+    for (int y = 0; y < rows; ++y)
+    {
+        for (int x = 0; x < columns; ++x)
+        {
+            const Rectf cellArea(destArea.left() + cellWidth * x,
+                                 destArea.top() + cellHeight * y,
+                                 std::min(destArea.left() + cellWidth * (x + 1), destArea.right()),
+                                 std::min(destArea.top() + cellHeight * (y + 1), destArea.bottom()));
+
+            const Rectf clippedArea(cellArea.getIntersection(finalArea));
+            if ((clippedArea.getWidth() <= 0.0f) || (clippedArea.getHeight() <= 0.0f))
+                continue;
+
+            const glm::vec2 min(getRelativePosition(destArea, clippedArea.d_min));
+            const glm::vec2 max(getRelativePosition(destArea, clippedArea.d_max));
+
+            ColourRect cellColours(colours.getSubRectangle(min.x, max.x, min.y, max.y));
+            const Colour& squareColour =
+                ((x + y) % 2 == 0) ? d_checkerboardColour1 : d_checkerboardColour2;
+            cellColours.d_top_left *= squareColour;
+            cellColours.d_top_right *= squareColour;
+            cellColours.d_bottom_left *= squareColour;
+            cellColours.d_bottom_right *= squareColour;
+
+            appendColouredQuad(vertices, clippedArea, cellColours);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+Colour GradientImage::getGradientColour(const glm::vec2& rel_pos) const
+{
+    if (d_colourFunction)
+        return d_colourFunction(rel_pos);
+
+    return d_colours.getColourAtPoint(rel_pos.x, rel_pos.y);
+}
+
+//----------------------------------------------------------------------------//
+void GradientImage::setColourFunction(const ColourFunction& colour_function)
+{
+    d_colourFunction = colour_function;
+}
+
+//----------------------------------------------------------------------------//
+const GradientImage::ColourFunction& GradientImage::getColourFunction() const
+{
+    return d_colourFunction;
+}
+
+//----------------------------------------------------------------------------//
+void GradientImage::setColours(const ColourRect& colours)
+{
+    d_colours = colours;
+}
+
+//----------------------------------------------------------------------------//
+const ColourRect& GradientImage::getColours() const
+{
+    return d_colours;
+}
+
+//----------------------------------------------------------------------------//
+void GradientImage::setSubdivisions(unsigned int horizontal, unsigned int vertical)
+{
+    d_horizontalSubdivisions = std::max(horizontal, 1u);
+    d_verticalSubdivisions = std::max(vertical, 1u);
+}
+
+//----------------------------------------------------------------------------//
+unsigned int GradientImage::getHorizontalSubdivisions() const
+{
+    return d_horizontalSubdivisions;
+}
+
+//----------------------------------------------------------------------------//
+unsigned int GradientImage::getVerticalSubdivisions() const
+{
+    return d_verticalSubdivisions;
+}
+
+//----------------------------------------------------------------------------//
+void GradientImage::setCheckerboard(float cell_size, const Colour& colour1,
+                                    const Colour& colour2)
+{
+    d_checkerboardCellSize = std::max(cell_size, 0.0f);
+    d_checkerboardColour1 = colour1;
+    d_checkerboardColour2 = colour2;
+}
+
+//----------------------------------------------------------------------------//
+float GradientImage::getCheckerboardCellSize() const
+{
+    return d_checkerboardCellSize;
+}
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,230 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/HotReloader.h"
+#include "CEGUI/System.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/Scheme.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Logger.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+void HotReloader::watchLookNFeel(const String& filename, const String& resourceGroup)
+{
+    watch(FileType::LookNFeel, filename, resourceGroup, nullptr, LayoutReloadedCallback());
+}
+
+//----------------------------------------------------------------------------//
+void HotReloader::watchImageset(const String& filename, const String& resourceGroup)
+{
+    watch(FileType::Imageset, filename, resourceGroup, nullptr, LayoutReloadedCallback());
+}
+
+//----------------------------------------------------------------------------//
+void HotReloader::watchScheme(const Scheme& scheme)
+{
+    for (Scheme::LoadableUIElementIterator it = scheme.getXMLImagesets(); !it.isAtEnd(); ++it)
+        watchImageset(it.getCurrentValue().filename, it.getCurrentValue().resourceGroup);
+
+    for (Scheme::LoadableUIElementIterator it = scheme.getLookNFeels(); !it.isAtEnd(); ++it)
+        watchLookNFeel(it.getCurrentValue().filename, it.getCurrentValue().resourceGroup);
+}
+
+//----------------------------------------------------------------------------//
+void HotReloader::watchLayout(Window& root, const String& filename,
+                              const String& resourceGroup,
+                              LayoutReloadedCallback callback)
+{
+    watch(FileType::Layout, filename, resourceGroup, &root, callback);
+}
+
+//----------------------------------------------------------------------------//
+void HotReloader::unwatchAll()
+{
+    d_files.clear();
+}
+
+//----------------------------------------------------------------------------//
+void HotReloader::watch(FileType type, const String& filename,
+                        const String& resourceGroup, Window* layoutRoot,
+                        LayoutReloadedCallback callback)
+{
+    if (filename.empty())
+        throw InvalidRequestException("A watched file needs a name.");
+
+    WatchedFile file;
+    file.d_type = type;
+    file.d_filename = filename;
+    file.d_resourceGroup = resourceGroup;
+    file.d_layoutRoot = layoutRoot;
+    file.d_layoutReloaded = callback;
+    file.d_version = getVersion(file);
+
+    for (WatchedFile& watched : d_files)
+    {
+        if (watched.d_type == type && watched.d_filename == filename &&
+            watched.d_resourceGroup == resourceGroup)
+        {
+            watched = file;
+            return;
+        }
+    }
+
+    d_files.push_back(file);
+}
+
+//----------------------------------------------------------------------------//
+size_t HotReloader::checkForChanges()
+{
+    size_t reloaded = 0;
+
+    // the looks use the images and the layouts use both
+    for (FileType type : { FileType::Imageset, FileType::LookNFeel, FileType::Layout })
+    {
+        for (size_t i = 0; i < d_files.size(); ++i)
+        {
+            WatchedFile& file = d_files[i];
+            if (file.d_type != type)
+                continue;
+
+            if (type == FileType::Layout &&
+                !WindowManager::getSingleton().isAlive(file.d_layoutRoot))
+            {
+                d_files.erase(d_files.begin() + i--);
+                continue;
+            }
+
+            // 0 means the version is unknown, which is never treated as a change
+            const std::uint64_t version = getVersion(file);
+            if (version == 0 || version == file.d_version)
+                continue;
+
+            file.d_version = version;
+            if (reload(file))
+                ++reloaded;
+        }
+    }
+
+    return reloaded;
+}
+
+//----------------------------------------------------------------------------//
+bool HotReloader::reload(WatchedFile& file)
+{
+    Logger::getSingleton().logEvent("HotReloader::reload - reloading '" +
+        file.d_filename + "'.");
+
+    try
+    {
+        switch (file.d_type)
+        {
+        case FileType::Imageset:
+            ImageManager::getSingleton().reloadImageset(file.d_filename, file.d_resourceGroup);
+            break;
+
+        case FileType::LookNFeel:
+            WidgetLookManager::getSingleton().reloadLookNFeelSpecificationFromFile(
+                file.d_filename, file.d_resourceGroup);
+            break;
+
+        case FileType::Layout:
+            reloadLayout(file);
+            break;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        Logger::getSingleton().logEvent("HotReloader::reload - reloading '" +
+            file.d_filename + "' failed: " + e.what(), LoggingLevel::Error);
+        return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void HotReloader::reloadLayout(WatchedFile& file)
+{
+    WindowManager& winMgr = WindowManager::getSingleton();
+    Window* const previous = file.d_layoutRoot;
+    Window* const reloaded = winMgr.loadLayoutFromFile(file.d_filename, file.d_resourceGroup);
+
+    if (Window* const parent = previous->getParent())
+    {
+        const size_t index = parent->getChildIndex(previous);
+        parent->removeChild(previous);
+        parent->addChildAtIndex(reloaded, index);
+    }
+    else if (previous->isInGUIContext() &&
+             previous->getGUIContext().getRootWindow() == previous)
+    {
+        previous->getGUIContext().setRootWindow(reloaded);
+    }
+
+    winMgr.destroyWindow(previous);
+    file.d_layoutRoot = reloaded;
+
+    if (file.d_layoutReloaded)
+        file.d_layoutReloaded(*reloaded);
+}
+
+//----------------------------------------------------------------------------//
+std::uint64_t HotReloader::getVersion(const WatchedFile& file)
+{
+    String group(file.d_resourceGroup);
+    if (group.empty())
+    {
+        switch (file.d_type)
+        {
+        case FileType::Imageset:
+            group = ImageManager::getImagesetDefaultResourceGroup();
+            break;
+
+        case FileType::LookNFeel:
+            group = WidgetLookManager::getDefaultResourceGroup();
+            break;
+
+        case FileType::Layout:
+            group = WindowManager::getDefaultResourceGroup();
+            break;
+        }
+    }
+
+    return System::getSingleton().getResourceProvider()->getResourceVersion(
+        file.d_filename, group);
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
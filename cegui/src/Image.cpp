@@ -72,6 +72,17 @@ Image::~Image()
 {
 }
 
+//----------------------------------------------------------------------------//
+void Image::appendRenderGeometry(std::vector<GeometryBuffer*>& geomBuffers,
+    const ImageRenderSettings& render_settings) const
+{
+    const std::vector<GeometryBuffer*> imageGeomBuffers =
+        createRenderGeometry(render_settings);
+
+    geomBuffers.insert(geomBuffers.end(), imageGeomBuffers.begin(),
+        imageGeomBuffers.end());
+}
+
 //----------------------------------------------------------------------------//
 void Image::computeScalingFactors(AutoScaledMode mode,
                                   const Sizef& display_size,
@@ -0,0 +1,196 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ImageAtlas.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/PropertyHelper.h"
+#include <algorithm>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const int ImageAtlas::DefaultPageSize = 1024;
+const int ImageAtlas::DefaultMaxImageSize = 256;
+// transparent gap kept between images so filtering does not blend them
+static const int s_imagePadding = 1;
+
+//----------------------------------------------------------------------------//
+ImageAtlas::ImageAtlas() :
+    d_pageSize(DefaultPageSize),
+    d_maxImageSize(DefaultMaxImageSize),
+    d_createdPageCount(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+ImageAtlas::~ImageAtlas()
+{
+    while (!d_pages.empty())
+        destroyPage(d_pages.back());
+}
+
+//----------------------------------------------------------------------------//
+bool ImageAtlas::addImage(const String& name, const std::uint8_t* pixels,
+    int width, int height, Texture*& texture, Rectf& area)
+{
+    if (d_imagePages.find(name) != d_imagePages.end())
+        throw AlreadyExistsException("An image named '" + name +
+            "' is already packed in the atlas.");
+
+    const int pageSize = std::min(d_pageSize, static_cast<int>(
+        System::getSingleton().getRenderer()->getMaxTextureSize()));
+    if (width <= 0 || height <= 0 || width > d_maxImageSize || height > d_maxImageSize ||
+        width + s_imagePadding > pageSize || height + s_imagePadding > pageSize)
+        return false;
+
+    // Prefer the page where the image raises the skyline the least
+    Page* targetPage = nullptr;
+    int targetNode = -1;
+    glm::ivec2 position;
+    int bestTop = pageSize + 1;
+    for (Page* page : d_pages)
+    {
+        glm::ivec2 pagePosition;
+        const int node = page->d_packer.findPosition(width + s_imagePadding,
+            height + s_imagePadding, pagePosition);
+        if (node >= 0 && pagePosition.y + height < bestTop)
+        {
+            bestTop = pagePosition.y + height;
+            targetPage = page;
+            targetNode = node;
+            position = pagePosition;
+        }
+    }
+
+    if (!targetPage)
+    {
+        targetPage = createPage();
+        targetNode = targetPage->d_packer.findPosition(width + s_imagePadding,
+            height + s_imagePadding, position);
+    }
+
+    targetPage->d_packer.addRectangle(targetNode, position,
+        width + s_imagePadding, height + s_imagePadding);
+    ++targetPage->d_imageCount;
+    d_imagePages[name] = targetPage;
+
+    area = Rectf(static_cast<float>(position.x), static_cast<float>(position.y),
+                 static_cast<float>(position.x + width),
+                 static_cast<float>(position.y + height));
+    targetPage->d_texture->blitFromMemory(pixels, area);
+    texture = targetPage->d_texture;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool ImageAtlas::releaseImage(const String& name)
+{
+    const auto it = d_imagePages.find(name);
+    if (it == d_imagePages.end())
+        return false;
+
+    Page* page = it->second;
+    d_imagePages.erase(it);
+
+    if (--page->d_imageCount == 0)
+        destroyPage(page);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool ImageAtlas::isImagePacked(const String& name) const
+{
+    return d_imagePages.find(name) != d_imagePages.end();
+}
+
+//----------------------------------------------------------------------------//
+void ImageAtlas::setPageSize(int size)
+{
+    d_pageSize = std::max(size, 1);
+}
+
+//----------------------------------------------------------------------------//
+void ImageAtlas::setMaxImageSize(int size)
+{
+    d_maxImageSize = std::max(size, 0);
+}
+
+//----------------------------------------------------------------------------//
+ImageAtlas::Page* ImageAtlas::createPage()
+{
+    const int size = std::min(d_pageSize, static_cast<int>(
+        System::getSingleton().getRenderer()->getMaxTextureSize()));
+    const String textureName("ImageAtlas_page_" +
+        PropertyHelper<std::uint32_t>::toString(d_createdPageCount++));
+
+    Page* page = new Page();
+    page->d_texture = &System::getSingleton().getRenderer()->createTexture(textureName);
+    page->d_packer.reset(size);
+    page->d_imageCount = 0;
+
+    // Clear the whole page once, so the padding between images is transparent
+    const std::vector<std::uint8_t> clear(static_cast<size_t>(size) * size * 4, 0);
+    page->d_texture->loadFromMemory(clear.data(),
+        Sizef(static_cast<float>(size), static_cast<float>(size)),
+        Texture::PixelFormat::Rgba);
+
+    // Pages are accounted for but can not be evicted, their images were
+    // packed from many files
+    System::getSingleton().getRenderer()->getTextureResidencyManager().addTexture(
+        *page->d_texture, TextureCategory::Imageset);
+
+    d_pages.push_back(page);
+    return page;
+}
+
+//----------------------------------------------------------------------------//
+void ImageAtlas::destroyPage(Page* page)
+{
+    Renderer* const renderer = System::getSingleton().getRenderer();
+    renderer->getTextureResidencyManager().removeTexture(*page->d_texture);
+    renderer->destroyTexture(*page->d_texture);
+
+    for (auto it = d_imagePages.begin(); it != d_imagePages.end(); )
+    {
+        if (it->second == page)
+            it = d_imagePages.erase(it);
+        else
+            ++it;
+    }
+
+    d_pages.erase(std::find(d_pages.begin(), d_pages.end(), page));
+    delete page;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
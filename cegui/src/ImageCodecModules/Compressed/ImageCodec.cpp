@@ -0,0 +1,349 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ImageCodecModules/Compressed/ImageCodec.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Logger.h"
+#include "CEGUI/PropertyHelper.h"
+#include "CEGUI/Sizef.h"
+#include <cstring>
+#include <utility>
+#include <vector>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+const std::uint8_t KTX2Identifier[12] =
+    { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+// size of the KTX2 header and index up to the level index
+const size_t KTX2LevelIndexOffset = 80;
+
+const size_t DDSHeaderSize = 128;
+const size_t DDSHeaderDX10Size = 20;
+const std::uint32_t DDPF_FOURCC = 0x4;
+const std::uint32_t DDPF_RGB = 0x40;
+
+//----------------------------------------------------------------------------//
+// files store their fields in little endian order
+std::uint32_t readUInt32(const std::uint8_t* p)
+{
+    return static_cast<std::uint32_t>(p[0]) |
+           (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) |
+           (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+//----------------------------------------------------------------------------//
+std::uint64_t readUInt64(const std::uint8_t* p)
+{
+    return readUInt32(p) | (static_cast<std::uint64_t>(readUInt32(p + 4)) << 32);
+}
+
+//----------------------------------------------------------------------------//
+std::uint32_t makeFourCC(char a, char b, char c, char d)
+{
+    return static_cast<std::uint32_t>(a) |
+           (static_cast<std::uint32_t>(b) << 8) |
+           (static_cast<std::uint32_t>(c) << 16) |
+           (static_cast<std::uint32_t>(d) << 24);
+}
+
+//----------------------------------------------------------------------------//
+// The sRGB variants are loaded like their UNORM counterparts, as CEGUI does
+// not use sRGB textures anywhere else either.
+bool getKTX2PixelFormat(std::uint32_t vkFormat, Texture::PixelFormat& format)
+{
+    switch (vkFormat)
+    {
+    case 23: case 29:   // VK_FORMAT_R8G8B8_UNORM / _SRGB
+        format = Texture::PixelFormat::Rgb; return true;
+    case 37: case 43:   // VK_FORMAT_R8G8B8A8_UNORM / _SRGB
+        format = Texture::PixelFormat::Rgba; return true;
+    case 131: case 132: // VK_FORMAT_BC1_RGB_UNORM_BLOCK / _SRGB
+        format = Texture::PixelFormat::RgbDxt1; return true;
+    case 133: case 134: // VK_FORMAT_BC1_RGBA_UNORM_BLOCK / _SRGB
+        format = Texture::PixelFormat::RgbaDxt1; return true;
+    case 135: case 136: // VK_FORMAT_BC2_UNORM_BLOCK / _SRGB
+        format = Texture::PixelFormat::RgbaDxt3; return true;
+    case 137: case 138: // VK_FORMAT_BC3_UNORM_BLOCK / _SRGB
+        format = Texture::PixelFormat::RgbaDxt5; return true;
+    case 145: case 146: // VK_FORMAT_BC7_UNORM_BLOCK / _SRGB
+        format = Texture::PixelFormat::RgbaBc7; return true;
+    case 147: case 148: // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK / _SRGB
+        format = Texture::PixelFormat::RgbEtc2; return true;
+    case 151: case 152: // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK / _SRGB
+        format = Texture::PixelFormat::RgbaEtc2; return true;
+    case 157: case 158: // VK_FORMAT_ASTC_4x4_UNORM_BLOCK / _SRGB
+        format = Texture::PixelFormat::RgbaAstc4x4; return true;
+    case 165: case 166: // VK_FORMAT_ASTC_6x6_UNORM_BLOCK / _SRGB
+        format = Texture::PixelFormat::RgbaAstc6x6; return true;
+    case 171: case 172: // VK_FORMAT_ASTC_8x8_UNORM_BLOCK / _SRGB
+        format = Texture::PixelFormat::RgbaAstc8x8; return true;
+    default:
+        return false;
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool getDXGIPixelFormat(std::uint32_t dxgiFormat, Texture::PixelFormat& format)
+{
+    switch (dxgiFormat)
+    {
+    case 28: case 29:   // DXGI_FORMAT_R8G8B8A8_UNORM / _SRGB
+        format = Texture::PixelFormat::Rgba; return true;
+    case 71: case 72:   // DXGI_FORMAT_BC1_UNORM / _SRGB
+        format = Texture::PixelFormat::RgbaDxt1; return true;
+    case 74: case 75:   // DXGI_FORMAT_BC2_UNORM / _SRGB
+        format = Texture::PixelFormat::RgbaDxt3; return true;
+    case 77: case 78:   // DXGI_FORMAT_BC3_UNORM / _SRGB
+        format = Texture::PixelFormat::RgbaDxt5; return true;
+    case 98: case 99:   // DXGI_FORMAT_BC7_UNORM / _SRGB
+        format = Texture::PixelFormat::RgbaBc7; return true;
+    default:
+        return false;
+    }
+}
+
+}
+
+//----------------------------------------------------------------------------//
+CompressedImageCodec::CompressedImageCodec() :
+    ImageCodec("CompressedImageCodec - DDS and KTX2 loader for GPU compressed textures"),
+    d_fallbackCodec(nullptr)
+{
+    d_supportedFormat = "dds ktx2";
+}
+
+//----------------------------------------------------------------------------//
+CompressedImageCodec::~CompressedImageCodec()
+{
+}
+
+//----------------------------------------------------------------------------//
+void CompressedImageCodec::setFallbackCodec(ImageCodec* codec)
+{
+    d_fallbackCodec = codec;
+}
+
+//----------------------------------------------------------------------------//
+bool CompressedImageCodec::isThreadSafe() const
+{
+    // parsing uses no shared state, so only the fallback codec may prevent it
+    return !d_fallbackCodec || d_fallbackCodec->isThreadSafe();
+}
+
+//----------------------------------------------------------------------------//
+Texture* CompressedImageCodec::load(const RawDataContainer& data, Texture* result)
+{
+    const std::uint8_t* bytes = data.getDataPtr();
+    const size_t size = data.getSize();
+
+    if (size >= sizeof(KTX2Identifier) &&
+        !std::memcmp(bytes, KTX2Identifier, sizeof(KTX2Identifier)))
+        return loadKTX2(data, result);
+
+    if (size >= 4 && readUInt32(bytes) == makeFourCC('D', 'D', 'S', ' '))
+        return loadDDS(data, result);
+
+    if (d_fallbackCodec)
+        return d_fallbackCodec->load(data, result);
+
+    Logger::getSingleton().logEvent("CompressedImageCodec::load - "
+        "the data is neither a DDS nor a KTX2 file.", LoggingLevel::Error);
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------//
+Texture* CompressedImageCodec::loadKTX2(const RawDataContainer& data,
+                                        Texture* result) const
+{
+    const std::uint8_t* bytes = data.getDataPtr();
+    const size_t size = data.getSize();
+
+    // the index of the first (largest) mip level follows the header
+    if (size < KTX2LevelIndexOffset + 24)
+    {
+        Logger::getSingleton().logEvent("CompressedImageCodec::loadKTX2 - "
+            "the file is truncated.", LoggingLevel::Error);
+        return nullptr;
+    }
+
+    const std::uint32_t vkFormat = readUInt32(bytes + 12);
+    const std::uint32_t width = readUInt32(bytes + 20);
+    const std::uint32_t height = readUInt32(bytes + 24);
+    const std::uint32_t depth = readUInt32(bytes + 28);
+    const std::uint32_t supercompression = readUInt32(bytes + 44);
+
+    if (depth > 1 || height == 0)
+    {
+        Logger::getSingleton().logEvent("CompressedImageCodec::loadKTX2 - "
+            "only 2D textures are supported.", LoggingLevel::Error);
+        return nullptr;
+    }
+
+    if (supercompression != 0)
+    {
+        Logger::getSingleton().logEvent("CompressedImageCodec::loadKTX2 - "
+            "supercompressed files are not supported.", LoggingLevel::Error);
+        return nullptr;
+    }
+
+    Texture::PixelFormat format;
+    if (!getKTX2PixelFormat(vkFormat, format))
+    {
+        Logger::getSingleton().logEvent("CompressedImageCodec::loadKTX2 - "
+            "unsupported VkFormat " + PropertyHelper<std::uint32_t>::toString(vkFormat) +
+            ".", LoggingLevel::Error);
+        return nullptr;
+    }
+
+    const std::uint64_t offset = readUInt64(bytes + KTX2LevelIndexOffset);
+    if (offset > size)
+    {
+        Logger::getSingleton().logEvent("CompressedImageCodec::loadKTX2 - "
+            "the file is truncated.", LoggingLevel::Error);
+        return nullptr;
+    }
+
+    return loadPixels(data, static_cast<size_t>(offset), width, height, format, result);
+}
+
+//----------------------------------------------------------------------------//
+Texture* CompressedImageCodec::loadDDS(const RawDataContainer& data,
+                                       Texture* result) const
+{
+    const std::uint8_t* bytes = data.getDataPtr();
+    const size_t size = data.getSize();
+
+    if (size < DDSHeaderSize || readUInt32(bytes + 4) != 124)
+    {
+        Logger::getSingleton().logEvent("CompressedImageCodec::loadDDS - "
+            "invalid or truncated header.", LoggingLevel::Error);
+        return nullptr;
+    }
+
+    const std::uint32_t height = readUInt32(bytes + 12);
+    const std::uint32_t width = readUInt32(bytes + 16);
+    const std::uint32_t pixelFlags = readUInt32(bytes + 80);
+    const std::uint32_t fourCC = readUInt32(bytes + 84);
+
+    Texture::PixelFormat format;
+    size_t offset = DDSHeaderSize;
+
+    if (pixelFlags & DDPF_FOURCC)
+    {
+        if (fourCC == makeFourCC('D', 'X', 'T', '1'))
+            format = Texture::PixelFormat::RgbaDxt1;
+        else if (fourCC == makeFourCC('D', 'X', 'T', '3'))
+            format = Texture::PixelFormat::RgbaDxt3;
+        else if (fourCC == makeFourCC('D', 'X', 'T', '5'))
+            format = Texture::PixelFormat::RgbaDxt5;
+        else if (fourCC == makeFourCC('D', 'X', '1', '0') &&
+                 size >= DDSHeaderSize + DDSHeaderDX10Size &&
+                 getDXGIPixelFormat(readUInt32(bytes + DDSHeaderSize), format))
+            offset += DDSHeaderDX10Size;
+        else
+        {
+            Logger::getSingleton().logEvent("CompressedImageCodec::loadDDS - "
+                "unsupported compressed pixel format.", LoggingLevel::Error);
+            return nullptr;
+        }
+    }
+    else if ((pixelFlags & DDPF_RGB) && readUInt32(bytes + 88) == 32)
+    {
+        const std::uint32_t redMask = readUInt32(bytes + 92);
+
+        if (redMask == 0x000000FF)
+            format = Texture::PixelFormat::Rgba;
+        else if (redMask == 0x00FF0000)
+        {
+            // BGRA, the common layout of uncompressed DDS files
+            if (size < offset + static_cast<size_t>(width) * height * 4)
+            {
+                Logger::getSingleton().logEvent("CompressedImageCodec::loadDDS - "
+                    "the file is truncated.", LoggingLevel::Error);
+                return nullptr;
+            }
+
+            std::vector<std::uint8_t> pixels(bytes + offset,
+                bytes + offset + static_cast<size_t>(width) * height * 4);
+            for (size_t i = 0; i < pixels.size(); i += 4)
+                std::swap(pixels[i], pixels[i + 2]);
+
+            RawDataContainer swizzled;
+            swizzled.setBorrowedData(pixels.data(), pixels.size());
+            return loadPixels(swizzled, 0, width, height,
+                              Texture::PixelFormat::Rgba, result);
+        }
+        else
+        {
+            Logger::getSingleton().logEvent("CompressedImageCodec::loadDDS - "
+                "unsupported channel layout.", LoggingLevel::Error);
+            return nullptr;
+        }
+    }
+    else
+    {
+        Logger::getSingleton().logEvent("CompressedImageCodec::loadDDS - "
+            "unsupported pixel format.", LoggingLevel::Error);
+        return nullptr;
+    }
+
+    return loadPixels(data, offset, width, height, format, result);
+}
+
+//----------------------------------------------------------------------------//
+Texture* CompressedImageCodec::loadPixels(const RawDataContainer& data,
+    size_t offset, std::uint32_t width, std::uint32_t height,
+    Texture::PixelFormat format, Texture* result)
+{
+    const size_t byteCount = Texture::calculateDataSize(format, width, height);
+    if (offset > data.getSize() || data.getSize() - offset < byteCount)
+    {
+        Logger::getSingleton().logEvent("CompressedImageCodec::load - "
+            "the file is truncated.", LoggingLevel::Error);
+        return nullptr;
+    }
+
+    if (!result->isPixelFormatSupported(format))
+    {
+        Logger::getSingleton().logEvent("CompressedImageCodec::load - "
+            "the pixel format of the file is not supported by the renderer.",
+            LoggingLevel::Error);
+        return nullptr;
+    }
+
+    result->loadFromMemory(data.getDataPtr() + offset,
+                           Sizef(static_cast<float>(width),
+                                 static_cast<float>(height)),
+                           format);
+    return result;
+}
+
+} // End of CEGUI namespace section
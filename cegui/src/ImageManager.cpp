@@ -36,11 +36,20 @@
 #include "CEGUI/System.h"
 #include "CEGUI/Texture.h"
 #include "CEGUI/BitmapImage.h"
+#include "CEGUI/GradientImage.h"
 #include "CEGUI/svg/SVGImage.h"
 #include "CEGUI/svg/SVGData.h"
 #include "CEGUI/svg/SVGDataManager.h"
+#include "CEGUI/ImageCodec.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/TaskScheduler.h"
+#include "CEGUI/ImageAtlas.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
 
 namespace CEGUI
 {
@@ -50,6 +59,8 @@ template<> ImageManager* Singleton<ImageManager>::ms_Singleton = nullptr;
 
 //----------------------------------------------------------------------------//
 String ImageManager::d_imagesetDefaultResourceGroup;
+// generation of the images, shared by all instances of the manager
+static std::atomic<std::uint32_t> s_generation(1);
 
 //----------------------------------------------------------------------------//
 // predicate functor class to match items using a given prefix string.
@@ -64,6 +75,153 @@ public:
     { return v.first.find(d_prefix) == 0; }
 };
 
+//----------------------------------------------------------------------------//
+// Texture only keeping a copy of the pixels an ImageCodec decodes into it, so
+// that image files can be decoded away from the thread using the Renderer. The
+// pixels are premultiplied if the Renderer uses premultiplied alpha.
+class DecodedImageTexture : public Texture
+{
+public:
+    //! \a target is the texture the pixels are meant for, nullptr for the ImageAtlas.
+    DecodedImageTexture(const String& name, const Texture* target) :
+        d_name(name),
+        d_target(target),
+        d_size(0.0f, 0.0f),
+        d_format(PixelFormat::Rgba),
+        d_texelScaling(0.0f, 0.0f),
+        d_premultiplyAlpha(System::getSingleton().getRenderer()->isPremultipliedAlphaEnabled())
+    {}
+
+    const String& getName() const override { return d_name; }
+    const Sizef& getSize() const override { return d_size; }
+    const Sizef& getOriginalDataSize() const override { return d_size; }
+    const glm::vec2& getTexelScaling() const override { return d_texelScaling; }
+
+    void loadFromFile(const String&, const String&) override
+    {
+        throw InvalidRequestException("DecodedImageTexture can only be loaded from memory.");
+    }
+
+    void loadFromMemory(const void* buffer, const Sizef& buffer_size,
+                        PixelFormat pixel_format) override
+    {
+        const size_t byteCount = Texture::calculateDataSize(pixel_format,
+            static_cast<size_t>(buffer_size.d_width),
+            static_cast<size_t>(buffer_size.d_height));
+        d_pixels.resize(byteCount);
+        if (byteCount)
+            std::memcpy(d_pixels.data(), buffer, byteCount);
+
+        d_size = buffer_size;
+        d_format = pixel_format;
+
+        if (d_premultiplyAlpha && pixel_format == PixelFormat::Rgba)
+            Texture::premultiplyAlpha(d_pixels.data(), d_pixels.size() / 4);
+    }
+
+    void blitFromMemory(const void*, const Rectf&) override {}
+    void blitToMemory(void*) override {}
+
+    bool isPixelFormatSupported(const PixelFormat fmt) const override
+    {
+        return d_target ? d_target->isPixelFormatSupported(fmt) : !isCompressedFormat(fmt);
+    }
+
+    //! Passes the decoded pixels to \a texture.
+    void copyTo(Texture& texture) const
+    {
+        texture.loadFromMemory(d_pixels.data(), d_size, d_format);
+    }
+
+    //! Returns the decoded pixels as RGBA, or false if their format can not be converted.
+    bool getRgbaPixels(std::vector<std::uint8_t>& pixels) const
+    {
+        if (d_format == PixelFormat::Rgba)
+        {
+            pixels = d_pixels;
+            return true;
+        }
+
+        if (d_format != PixelFormat::Rgb)
+            return false;
+
+        pixels.resize(d_pixels.size() / 3 * 4);
+        for (size_t src = 0, dst = 0; src + 2 < d_pixels.size(); src += 3, dst += 4)
+        {
+            pixels[dst] = d_pixels[src];
+            pixels[dst + 1] = d_pixels[src + 1];
+            pixels[dst + 2] = d_pixels[src + 2];
+            pixels[dst + 3] = 0xFF;
+        }
+        return true;
+    }
+
+private:
+    const String d_name;
+    const Texture* d_target;
+    std::vector<std::uint8_t> d_pixels;
+    Sizef d_size;
+    PixelFormat d_format;
+    glm::vec2 d_texelScaling;
+    const bool d_premultiplyAlpha;
+};
+
+//----------------------------------------------------------------------------//
+// Reads and decodes an image file on the calling thread.
+static std::unique_ptr<DecodedImageTexture> decodeImageFile(const String& name,
+    const String& filename, const String& resource_group)
+{
+    System& system = System::getSingleton();
+    ResourceProvider* const resourceProvider = system.getResourceProvider();
+    ImageCodec& codec = system.getImageCodec();
+
+    RawDataContainer file;
+    resourceProvider->loadRawDataContainer(filename, file, resource_group);
+
+    std::unique_ptr<DecodedImageTexture> image(new DecodedImageTexture(name, nullptr));
+    Texture* result;
+    try
+    {
+        result = codec.load(file, image.get());
+    }
+    catch (...)
+    {
+        resourceProvider->unloadRawDataContainer(file);
+        throw;
+    }
+    resourceProvider->unloadRawDataContainer(file);
+
+    if (!result)
+        throw RendererException(codec.getIdentifierString() +
+            " failed to load image '" + filename + "'.");
+
+    return image;
+}
+
+//----------------------------------------------------------------------------//
+// Packs the decoded pixels of an image into the atlas, or gives the image a
+// texture of its own if they do not fit.
+static void setBitmapImagePixels(BitmapImage& image, const DecodedImageTexture& decoded,
+                                 ImageAtlas& atlas)
+{
+    const Sizef& size = decoded.getOriginalDataSize();
+    std::vector<std::uint8_t> pixels;
+    Texture* texture;
+    Rectf area;
+
+    if (!decoded.getRgbaPixels(pixels) ||
+        !atlas.addImage(image.getName(), pixels.data(), static_cast<int>(size.d_width),
+                        static_cast<int>(size.d_height), texture, area))
+    {
+        texture = &System::getSingleton().getRenderer()->createTexture(image.getName());
+        decoded.copyTo(*texture);
+        area = Rectf(glm::vec2(0.0f, 0.0f), texture->getOriginalDataSize());
+    }
+
+    image.setTexture(texture);
+    image.setImageArea(area);
+}
+
 //----------------------------------------------------------------------------//
 // Internal Strings holding XML element and attribute names
 const String ImagesetSchemaName("Imageset.xsd");
@@ -101,6 +259,30 @@ static CEGUI::String s_imagesetType = "";
 static AutoScaledMode s_autoScaled = AutoScaledMode::Disabled;
 static Sizef s_nativeResolution(640.0f, 480.0f);
 
+//----------------------------------------------------------------------------//
+// Returns the largest scale the images of an auto scaled imageset are drawn at.
+static float getAutoScaledTextureScale(AutoScaledMode mode,
+    const Sizef& native_resolution, const Sizef& display_size)
+{
+    float x_scale = 1.0f;
+    float y_scale = 1.0f;
+    Image::computeScalingFactors(mode, display_size, native_resolution,
+                                 x_scale, y_scale);
+
+    return std::min(std::max(x_scale, y_scale), 1.0f);
+}
+
+//----------------------------------------------------------------------------//
+// Returns the number of mip levels halving the resident scale drops.
+static int getDroppedLevelCount(float scale)
+{
+    int levels = 0;
+    for (; scale > 0.0f && scale <= 0.5f; scale *= 2.0f)
+        ++levels;
+
+    return levels;
+}
+
 //----------------------------------------------------------------------------//
 ImageManager::ImageManager()
 {
@@ -113,12 +295,17 @@ ImageManager::ImageManager()
     addImageType<BitmapImage>("BitmapImage");
     // self-register the built in 'SVGImage' type.
     addImageType<SVGImage>("SVGImage");
+    // self-register the built in 'GradientImage' type.
+    addImageType<GradientImage>("GradientImage");
+
+    d_imageAtlas.reset(new ImageAtlas());
 }
 
 //----------------------------------------------------------------------------//
 ImageManager::~ImageManager()
 {
     destroyAll();
+    d_imageAtlas.reset();
 
     while (!d_factories.empty())
         removeImageType(d_factories.begin()->first);
@@ -140,13 +327,19 @@ void ImageManager::removeImageType(const String& name)
     Logger::getSingleton().logEvent(
         "[ImageManager] Unregistered Image type: " + name);
 
-    delete i->second;
-	d_factories.erase(name);
+    ImageFactory* const factory = i->second;
+    {
+        std::lock_guard<SharedMutex> guard(d_registryMutex);
+        d_factories.erase(i);
+    }
+
+    delete factory;
 }
 
 //----------------------------------------------------------------------------//
 bool ImageManager::isImageTypeAvailable(const String& name) const
 {
+    SharedLock guard(d_registryMutex);
     return d_factories.find(name) != d_factories.end();
 }
 
@@ -165,7 +358,11 @@ Image& ImageManager::create(const String& type, const String& name)
 
     ImageFactory* factory = i->second;
     Image& image = factory->create(name);
-    d_images[name] = std::make_pair(&image, factory);
+    {
+        std::lock_guard<SharedMutex> guard(d_registryMutex);
+        d_images[name] = std::make_pair(&image, factory);
+        ++s_generation;
+    }
 
         String addressStr = SharedStringstream::GetPointerAddressAsString(&image);
 
@@ -211,7 +408,11 @@ Image& ImageManager::create(const XMLAttributes& attributes)
         throw InvalidRequestException(message);
     }
 
-    d_images[name] = std::make_pair(&image, factory);
+    {
+        std::lock_guard<SharedMutex> guard(d_registryMutex);
+        d_images[name] = std::make_pair(&image, factory);
+        ++s_generation;
+    }
 
     String addressStr = SharedStringstream::GetPointerAddressAsString(&image);
     Logger::getSingleton().logEvent(
@@ -242,10 +443,18 @@ void ImageManager::destroy(ImageMap::iterator& iter)
     Logger::getSingleton().logEvent(
         "[ImageManager] Deleted image: " + iter->first);
 
+    // the atlas page is destroyed along with its last image
+    d_imageAtlas->releaseImage(iter->first);
+
     // use the stored factory to destroy the image it created.
-    iter->second.second->destroy(*iter->second.first);
+    const std::pair<Image*, ImageFactory*> entry(iter->second);
+    {
+        std::lock_guard<SharedMutex> guard(d_registryMutex);
+        d_images.erase(iter);
+        ++s_generation;
+    }
 
-    d_images.erase(iter);
+    entry.second->destroy(*entry.first);
 }
 
 //----------------------------------------------------------------------------//
@@ -255,9 +464,16 @@ void ImageManager::destroyAll()
         destroy(d_images.begin()->first);
 }
 
+//----------------------------------------------------------------------------//
+std::uint32_t ImageManager::getGeneration() const
+{
+    return s_generation;
+}
+
 //----------------------------------------------------------------------------//
 Image& ImageManager::get(const String& name) const
 {
+    SharedLock guard(d_registryMutex);
     ImageMap::const_iterator i = d_images.find(name);
     
     if (i == d_images.end())
@@ -270,12 +486,14 @@ Image& ImageManager::get(const String& name) const
 //----------------------------------------------------------------------------//
 bool ImageManager::isDefined(const String& name) const
 {
+    SharedLock guard(d_registryMutex);
     return d_images.find(name) != d_images.end();
 }
 
 //----------------------------------------------------------------------------//
 unsigned int ImageManager::getImageCount() const
 {
+    SharedLock guard(d_registryMutex);
     return static_cast<unsigned int>(d_images.size());
 }
 
@@ -288,6 +506,63 @@ void ImageManager::loadImageset(const String& filename,
             resource_group.empty() ? d_imagesetDefaultResourceGroup : resource_group);
 }
 
+//----------------------------------------------------------------------------//
+void ImageManager::reloadImageset(const String& filename,
+                                  const String& resource_group)
+{
+    d_reloadingImageset = true;
+    try
+    {
+        loadImageset(filename, resource_group);
+    }
+    catch (...)
+    {
+        d_reloadingImageset = false;
+        throw;
+    }
+    d_reloadingImageset = false;
+    ++s_generation;
+
+    // geometry of the images is cached all over the place
+    System::getSingleton().invalidateAllCachedRendering();
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::loadImagesetAsync(const String& filename,
+                                     const String& resource_group,
+                                     ImagesetLoadedCallback callback)
+{
+    const String group(resource_group.empty() ?
+        d_imagesetDefaultResourceGroup : resource_group);
+
+    System::getSingleton().getResourceProvider()->loadRawDataContainerAsync(
+        filename, group,
+        [this, filename, group, callback](RawDataContainer& data, std::exception_ptr error)
+    {
+        bool loaded = false;
+        if (!error)
+        {
+            try
+            {
+                System::getSingleton().getXMLParser()->parseXML(
+                    *this, data, ImagesetSchemaName);
+                loaded = true;
+            }
+            catch (...)
+            {
+            }
+        }
+
+        if (!loaded)
+            Logger::getSingleton().logEvent("ImageManager::loadImagesetAsync - "
+                "loading of imageset from file '" + filename + "' of resource group '" +
+                group + "' failed.", LoggingLevel::Error);
+
+        if (callback)
+            callback(loaded);
+    });
+}
+
 //----------------------------------------------------------------------------//
 void ImageManager::loadImagesetFromString(const String& source)
 {
@@ -309,17 +584,50 @@ void ImageManager::destroyImageCollection(const String& prefix,
         destroy(i);
 
     if (delete_texture)
-        System::getSingleton().getRenderer()->destroyTexture(prefix);
+    {
+        Renderer* const renderer = System::getSingleton().getRenderer();
+        if (renderer->isTextureDefined(prefix))
+            renderer->getTextureResidencyManager().removeTexture(renderer->getTexture(prefix));
+
+        renderer->destroyTexture(prefix);
+        d_streamedTextures.erase(prefix);
+    }
 }
 
 //----------------------------------------------------------------------------//
 void ImageManager::addBitmapImageFromFile(const String& name, const String& filename,
                                     const String& resource_group)
 {
+    if (d_imageAtlasEnabled)
+    {
+        const String& group =
+            resource_group.empty() ? d_imagesetDefaultResourceGroup : resource_group;
+
+        if (d_textureLoadBatchDepth != 0)
+        {
+            // the image is given its pixels when the batch ends
+            create("BitmapImage", name);
+
+            PendingTextureLoad load;
+            load.d_textureName = name;
+            load.d_filename = filename;
+            load.d_resourceGroup = group;
+            load.d_imageName = name;
+            load.d_packIntoAtlas = true;
+            d_pendingTextureLoads.push_back(load);
+            return;
+        }
+
+        std::unique_ptr<DecodedImageTexture> decoded(decodeImageFile(name, filename, group));
+        setBitmapImagePixels(static_cast<BitmapImage&>(create("BitmapImage", name)),
+                             *decoded, *d_imageAtlas);
+        return;
+    }
+
     // create texture from image
-    Texture* tex = &System::getSingleton().getRenderer()->
-        createTexture(name, filename,
-            resource_group.empty() ? d_imagesetDefaultResourceGroup : resource_group);
+    Texture* tex = &createTextureFromFile(name, filename,
+        resource_group.empty() ? d_imagesetDefaultResourceGroup : resource_group,
+        name);
 
     BitmapImage& image = static_cast<BitmapImage&>(create("BitmapImage", name));
     image.setTexture(tex);
@@ -327,11 +635,302 @@ void ImageManager::addBitmapImageFromFile(const String& name, const String& file
     image.setImageArea(rect);
 }
 
+//----------------------------------------------------------------------------//
+void ImageManager::beginTextureLoadBatch()
+{
+    ++d_textureLoadBatchDepth;
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::endTextureLoadBatch()
+{
+    if (d_textureLoadBatchDepth == 0)
+        throw InvalidRequestException(
+            "endTextureLoadBatch was called without a matching beginTextureLoadBatch.");
+
+    if (--d_textureLoadBatchDepth != 0)
+        return;
+
+    std::vector<PendingTextureLoad> loads;
+    loads.swap(d_pendingTextureLoads);
+
+    System& system = System::getSingleton();
+    Renderer* const renderer = system.getRenderer();
+    ImageCodec& codec = system.getImageCodec();
+    TaskScheduler& scheduler = system.getTaskScheduler();
+
+    // textures and atlas images destroyed while the batch was open are skipped
+    std::vector<Texture*> textures(loads.size(), nullptr);
+    std::vector<bool> live(loads.size(), false);
+    for (size_t i = 0; i < loads.size(); ++i)
+    {
+        if (loads[i].d_packIntoAtlas)
+            live[i] = isDefined(loads[i].d_imageName);
+        else if (renderer->isTextureDefined(loads[i].d_textureName))
+        {
+            textures[i] = &renderer->getTexture(loads[i].d_textureName);
+            live[i] = true;
+        }
+    }
+
+    // loads the files decoded on the TaskScheduler into their textures
+    std::vector<std::unique_ptr<DecodedImageTexture>> decoded(loads.size());
+    std::vector<RawDataContainer> files(loads.size());
+    std::vector<TaskScheduler::TaskId> tasks(loads.size());
+    std::vector<bool> submitted(loads.size(), false);
+    ResourceProvider* const resourceProvider = system.getResourceProvider();
+    const bool parallel =
+        loads.size() > 1 && codec.isThreadSafe() && scheduler.getConcurrency() > 1;
+    // files are read on the calling thread unless the ResourceProvider allows otherwise
+    const bool readInTasks = parallel && resourceProvider->isThreadSafe();
+
+    const auto readFile = [&](std::size_t i)
+    {
+        try
+        {
+            resourceProvider->loadRawDataContainer(
+                loads[i].d_filename, files[i], loads[i].d_resourceGroup);
+        }
+        catch (...)
+        {
+            // loading the file again below reports the error
+        }
+    };
+
+    const auto decodeFile = [&](std::size_t i)
+    {
+        if (readInTasks)
+            readFile(i);
+
+        if (!files[i].getDataPtr())
+            return;
+
+        std::unique_ptr<DecodedImageTexture> image(
+            new DecodedImageTexture(loads[i].d_textureName, textures[i]));
+        try
+        {
+            if (codec.load(files[i], image.get()))
+                decoded[i] = std::move(image);
+        }
+        catch (...)
+        {
+            // failures are left to be reported on this thread
+        }
+    };
+
+    if (parallel)
+    {
+        for (size_t i = 0; i < loads.size(); ++i)
+        {
+            if (!live[i])
+                continue;
+
+            if (!readInTasks)
+                readFile(i);
+
+            tasks[i] = scheduler.submit([&decodeFile, i]() { decodeFile(i); });
+            submitted[i] = true;
+        }
+    }
+
+    // each texture is loaded as soon as its file is decoded, so the uploads
+    // overlap with the decoding of the files that follow
+    size_t next = 0;
+    try
+    {
+        for (; next < loads.size(); ++next)
+        {
+            if (!live[next])
+                continue;
+
+            if (submitted[next])
+            {
+                submitted[next] = false;
+                scheduler.wait(tasks[next]);
+                resourceProvider->unloadRawDataContainer(files[next]);
+            }
+
+            if (loads[next].d_packIntoAtlas)
+            {
+                if (!decoded[next])
+                    decoded[next] = decodeImageFile(loads[next].d_textureName,
+                        loads[next].d_filename, loads[next].d_resourceGroup);
+
+                setBitmapImagePixels(static_cast<BitmapImage&>(get(loads[next].d_imageName)),
+                                     *decoded[next], *d_imageAtlas);
+                decoded[next].reset();
+                continue;
+            }
+
+            if (decoded[next])
+            {
+                decoded[next]->copyTo(*textures[next]);
+                decoded[next].reset();
+            }
+            else
+                textures[next]->loadFromFile(loads[next].d_filename,
+                                             loads[next].d_resourceGroup);
+
+            if (!loads[next].d_imageName.empty() && isDefined(loads[next].d_imageName))
+            {
+                BitmapImage& image = static_cast<BitmapImage&>(get(loads[next].d_imageName));
+                image.setImageArea(Rectf(glm::vec2(0.0f, 0.0f),
+                                         textures[next]->getOriginalDataSize()));
+            }
+        }
+    }
+    catch (...)
+    {
+        // the remaining tasks use the locals of this function
+        for (size_t i = next; i < loads.size(); ++i)
+        {
+            if (submitted[i])
+            {
+                scheduler.wait(tasks[i]);
+                resourceProvider->unloadRawDataContainer(files[i]);
+            }
+        }
+        throw;
+    }
+}
+
+//----------------------------------------------------------------------------//
+Texture& ImageManager::createTextureFromFile(const String& name,
+    const String& filename, const String& resource_group, const String& image_name,
+    AutoScaledMode auto_scaled, const Sizef& native_resolution)
+{
+    Renderer* const renderer = System::getSingleton().getRenderer();
+
+    d_streamedTextures.erase(name);
+    if (d_textureLoadBatchDepth == 0 && !d_textureMipmapsEnabled)
+    {
+        Texture& texture = renderer->createTexture(name, filename, resource_group);
+        trackTextureResidency(texture, filename, resource_group);
+        return texture;
+    }
+
+    Texture& texture = renderer->createTexture(name);
+    texture.setMipmapsEnabled(d_textureMipmapsEnabled);
+
+    if (d_textureMipmapsEnabled && d_textureStreamingEnabled &&
+        auto_scaled != AutoScaledMode::Disabled)
+    {
+        StreamedTexture streamed;
+        streamed.d_filename = filename;
+        streamed.d_resourceGroup = resource_group;
+        streamed.d_autoScaled = auto_scaled;
+        streamed.d_nativeResolution = native_resolution;
+        d_streamedTextures[name] = streamed;
+
+        texture.setResidentScale(getAutoScaledTextureScale(
+            auto_scaled, native_resolution, renderer->getDisplaySize()));
+    }
+
+    if (d_textureLoadBatchDepth == 0)
+    {
+        try
+        {
+            texture.loadFromFile(filename, resource_group);
+        }
+        catch (...)
+        {
+            d_streamedTextures.erase(name);
+            renderer->destroyTexture(texture);
+            throw;
+        }
+
+        trackTextureResidency(texture, filename, resource_group);
+        return texture;
+    }
+
+    PendingTextureLoad load;
+    load.d_textureName = name;
+    load.d_filename = filename;
+    load.d_resourceGroup = resource_group;
+    load.d_imageName = image_name;
+    load.d_packIntoAtlas = false;
+    d_pendingTextureLoads.push_back(load);
+
+    trackTextureResidency(texture, filename, resource_group);
+    return texture;
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::trackTextureResidency(Texture& texture, const String& filename,
+                                         const String& resource_group)
+{
+    System::getSingleton().getRenderer()->getTextureResidencyManager().addTexture(
+        texture, TextureCategory::Imageset,
+        [&texture]()
+        {
+            return texture.releaseData();
+        },
+        [&texture, filename, resource_group]()
+        {
+            try
+            {
+                texture.loadFromFile(filename, resource_group);
+            }
+            catch (const Exception&)
+            {
+                // logged when thrown; the texture stays released
+            }
+        });
+}
+
 //----------------------------------------------------------------------------//
 void ImageManager::notifyDisplaySizeChanged(const Sizef& size)
 {
+    bool imagesResized = false;
     for (ImageMap::iterator i = d_images.begin() ; i != d_images.end(); ++i)
-        i->second.first->notifyDisplaySizeChanged(size);
+    {
+        Image* const image = i->second.first;
+        const Sizef oldSize(image->getRenderedSize());
+        const glm::vec2 oldOffset(image->getRenderedOffset());
+
+        image->notifyDisplaySizeChanged(size);
+
+        imagesResized |= image->getRenderedSize() != oldSize ||
+                         image->getRenderedOffset() != oldOffset;
+    }
+
+    // Any window may draw the resized images, the ones that were not
+    // auto scaled or are scaled along the other axis only keep their geometry
+    if (imagesResized)
+        System::getSingleton().invalidateAllCachedRendering();
+
+    // streamed textures drawn larger than their resident levels allow are
+    // loaded again; the images keep referring to the same textures
+    Renderer* const renderer = System::getSingleton().getRenderer();
+    for (auto i = d_streamedTextures.begin(); i != d_streamedTextures.end();)
+    {
+        if (!renderer->isTextureDefined(i->first))
+        {
+            i = d_streamedTextures.erase(i);
+            continue;
+        }
+
+        Texture& texture = renderer->getTexture(i->first);
+        const float scale = getAutoScaledTextureScale(
+            i->second.d_autoScaled, i->second.d_nativeResolution, size);
+
+        if (getDroppedLevelCount(scale) < getDroppedLevelCount(texture.getResidentScale()))
+        {
+            texture.setResidentScale(scale);
+
+            try
+            {
+                texture.loadFromFile(i->second.d_filename, i->second.d_resourceGroup);
+            }
+            catch (const Exception&)
+            {
+                // logged when thrown; the texture keeps its previous contents
+                // if the load failed before reaching it
+            }
+        }
+
+        ++i;
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -403,6 +1002,15 @@ void ImageManager::elementImagesetStart(const XMLAttributes& attributes)
 
     validateImagesetFileVersion(attributes);
 
+    // set native resolution for imageset
+    s_nativeResolution = Sizef(
+        attributes.getValueAsFloat(ImagesetNativeHorzResAttribute, 640),
+        attributes.getValueAsFloat(ImagesetNativeVertResAttribute, 480));
+
+    // set auto-scaling as needed
+    s_autoScaled = PropertyHelper<AutoScaledMode>::fromString(
+                attributes.getValueAsString(ImagesetAutoScaledAttribute, "false"));
+
     if(s_imagesetType == "BitmapImage")
         retrieveImagesetTexture(name, filename, resource_group);
     else if(s_imagesetType == "SVGImage")
@@ -412,16 +1020,6 @@ void ImageManager::elementImagesetStart(const XMLAttributes& attributes)
         CEGUI::String message = "Imageset type: \"" + s_imagesetType + "\" is unknown.";
         throw UnknownObjectException(message);
     }
-            
-
-    // set native resolution for imageset
-    s_nativeResolution = Sizef(
-        attributes.getValueAsFloat(ImagesetNativeHorzResAttribute, 640),
-        attributes.getValueAsFloat(ImagesetNativeVertResAttribute, 480));
-
-    // set auto-scaling as needed
-    s_autoScaled = PropertyHelper<AutoScaledMode>::fromString(
-                attributes.getValueAsString(ImagesetAutoScaledAttribute, "false"));
 }
 
 //----------------------------------------------------------------------------//
@@ -453,7 +1051,7 @@ void ImageManager::elementImageStart(const XMLAttributes& attributes)
     const String image_name(image_data_name + '/' +
         attributes.getValueAsString(ImageNameAttribute));
 
-    if (isDefined(image_name))
+    if (isDefined(image_name) && !(d_reloadingImageset && s_imagesetType == "BitmapImage"))
     {
         Logger::getSingleton().logEvent(
             "[ImageManager] WARNING: Using existing image :" + image_name);
@@ -489,6 +1087,23 @@ void ImageManager::elementImageStart(const XMLAttributes& attributes)
         rw_attrs.add(ImagesetNativeVertResAttribute,
                      PropertyHelper<std::uint32_t>::toString(static_cast<std::uint32_t>(s_nativeResolution.d_height)));
 
+    if (isDefined(image_name))
+    {
+        // reloading, the image keeps its address and only takes the new definition
+        BitmapImage* const image = dynamic_cast<BitmapImage*>(&get(image_name));
+        if (!image)
+            return;
+
+        const BitmapImage definition(rw_attrs);
+        image->setTexture(&System::getSingleton().getRenderer()->getTexture(
+            rw_attrs.getValueAsString(ImageTextureAttribute)));
+        image->setImageArea(definition.getImageArea());
+        image->setOffset(definition.getOffset());
+        image->setNativeResolution(definition.getNativeResolution());
+        image->setAutoScaled(definition.getAutoScaled());
+        return;
+    }
+
     d_deleteChainedHandler = false;
     d_chainedHandler = &create(rw_attrs);
 }
@@ -499,7 +1114,14 @@ void ImageManager::retrieveImagesetTexture(const String& name, const String& fil
     Renderer* const renderer = System::getSingleton().getRenderer();
 
     // if the texture already exists
-    if (renderer->isTextureDefined(name))
+    if (renderer->isTextureDefined(name) && d_reloadingImageset)
+    {
+        // loaded into the same texture, so everything using it stays valid
+        s_texture = &renderer->getTexture(name);
+        s_texture->loadFromFile(filename, resource_group.empty() ?
+            d_imagesetDefaultResourceGroup : resource_group);
+    }
+    else if (renderer->isTextureDefined(name))
     {
         Logger::getSingleton().logEvent(
             "[ImageManager] WARNING: Using existing texture: " + name);
@@ -508,9 +1130,9 @@ void ImageManager::retrieveImagesetTexture(const String& name, const String& fil
     else
     {
         // create texture from image
-        s_texture = &renderer->createTexture(name, filename,
+        s_texture = &createTextureFromFile(name, filename,
             resource_group.empty() ? d_imagesetDefaultResourceGroup :
-            resource_group);
+            resource_group, "", s_autoScaled, s_nativeResolution);
     }
 }
 
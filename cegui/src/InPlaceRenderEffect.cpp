@@ -0,0 +1,86 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/InPlaceRenderEffect.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+void InPlaceRenderEffect::modifyGeometry(Window& /*window*/, GeometryBuffer& /*buffer*/)
+{
+}
+
+//----------------------------------------------------------------------------//
+void InPlaceRenderEffect::prepareGeometry(Window& /*window*/, GeometryBuffer& /*buffer*/)
+{
+}
+
+//----------------------------------------------------------------------------//
+bool InPlaceRenderEffect::modifiesGeometry() const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool InPlaceRenderEffect::isAppliedInPlace() const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+int InPlaceRenderEffect::getPassCount() const
+{
+    return 1;
+}
+
+//----------------------------------------------------------------------------//
+void InPlaceRenderEffect::performPreRenderFunctions(const int /*pass*/)
+{
+}
+
+//----------------------------------------------------------------------------//
+void InPlaceRenderEffect::performPostRenderFunctions()
+{
+}
+
+//----------------------------------------------------------------------------//
+bool InPlaceRenderEffect::realiseGeometry(RenderingWindow& /*window*/,
+                                          GeometryBuffer& /*geometry*/)
+{
+    // the standard textured quad, if the effect is set on a RenderingWindow
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool InPlaceRenderEffect::update(const float /*elapsed*/, RenderingWindow& /*window*/)
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
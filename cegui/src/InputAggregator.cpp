@@ -93,6 +93,10 @@ InputAggregator::InputAggregator(InputEventReceiver* input_receiver) :
     d_handleInKeyUp(true),
     d_mouseMovementScalingFactor(1.0f),
     d_pointerPosition(0.0f, 0.0f),
+    d_coalesceEvents(false),
+    d_hasPendingCursorMove(false),
+    d_hasPendingScroll(false),
+    d_pendingScrollDelta(0.0f),
     d_keysPressed()
 {
     // Initialise the array
@@ -305,13 +309,19 @@ bool InputAggregator::injectMousePosition(float x_pos, float y_pos)
     if (d_inputReceiver == nullptr)
         return false;
 
-    d_pointerPosition = glm::vec2(x_pos, y_pos);
+    if (d_coalesceEvents)
+    {
+        // a pending scroll happened at the previous position, so it goes first
+        const bool handled = d_hasPendingScroll && flushPendingInput();
 
-    SemanticInputEvent semantic_event(SemanticValue::CursorMove);
-    semantic_event.d_payload.array[0] = x_pos;
-    semantic_event.d_payload.array[1] = y_pos;
+        d_pointerPosition = glm::vec2(x_pos, y_pos);
+        d_hasPendingCursorMove = true;
+        return handled;
+    }
 
-    return d_inputReceiver->injectInputEvent(semantic_event);
+    d_pointerPosition = glm::vec2(x_pos, y_pos);
+
+    return sendCursorMove();
 }
 
 bool InputAggregator::injectMouseLeaves()
@@ -319,6 +329,8 @@ bool InputAggregator::injectMouseLeaves()
     if (d_inputReceiver == nullptr)
         return false;
 
+    flushPendingInput();
+
     SemanticInputEvent semantic_event(SemanticValue::PointerLeave);
 
     return d_inputReceiver->injectInputEvent(semantic_event);
@@ -329,6 +341,8 @@ bool InputAggregator::injectMouseButtonDown(MouseButton button)
     if (d_inputReceiver == nullptr)
         return false;
 
+    flushPendingInput();
+
     //
     // Handling for multi-click generation
     //
@@ -384,6 +398,8 @@ bool InputAggregator::injectMouseButtonUp(MouseButton button)
     if (d_inputReceiver == nullptr)
         return false;
 
+    flushPendingInput();
+
     SemanticInputEvent semantic_event(SemanticValue::CursorActivate);
     semantic_event.d_payload.source = convertToCursorInputSource(button);
 
@@ -394,6 +410,8 @@ bool InputAggregator::injectKeyDown(Key::Scan scan_code)
 {
     if (d_inputReceiver == nullptr)
         return false;
+
+    flushPendingInput();
     
     d_keysPressed[static_cast<unsigned char>(scan_code)] = true;
 
@@ -408,6 +426,8 @@ bool InputAggregator::injectKeyUp(Key::Scan scan_code)
 {
     if (d_inputReceiver == nullptr)
         return false;
+
+    flushPendingInput();
     
     d_keysPressed[static_cast<unsigned char>(scan_code)] = false;
 
@@ -423,6 +443,8 @@ bool InputAggregator::injectChar(char32_t code_point)
     if (d_inputReceiver == nullptr)
         return false;
 
+    flushPendingInput();
+
     TextInputEvent text_event;
     text_event.d_character = code_point;
 
@@ -434,10 +456,14 @@ bool InputAggregator::injectMouseWheelChange(float delta)
     if (d_inputReceiver == nullptr)
         return false;
 
-    SemanticInputEvent semantic_event(SemanticValue::VerticalScroll);
-    semantic_event.d_payload.single = delta;
+    if (d_coalesceEvents)
+    {
+        d_pendingScrollDelta += delta;
+        d_hasPendingScroll = true;
+        return false;
+    }
 
-    return d_inputReceiver->injectInputEvent(semantic_event);
+    return sendScroll(delta);
 }
 
 bool InputAggregator::injectMouseButtonClick(const MouseButton button)
@@ -445,6 +471,8 @@ bool InputAggregator::injectMouseButtonClick(const MouseButton button)
     if (d_inputReceiver == nullptr)
         return false;
 
+    flushPendingInput();
+
     SemanticInputEvent semantic_event(SemanticValue::CursorActivate);
 
     if (isControlPressed())
@@ -460,6 +488,8 @@ bool InputAggregator::injectMouseButtonDoubleClick(const MouseButton button)
     if (d_inputReceiver == nullptr)
         return false;
 
+    flushPendingInput();
+
     SemanticInputEvent semantic_event(SemanticValue::SelectWord);
     semantic_event.d_payload.source = convertToCursorInputSource(button);
 
@@ -471,6 +501,8 @@ bool InputAggregator::injectMouseButtonTripleClick(const MouseButton button)
     if (d_inputReceiver == nullptr)
         return false;
 
+    flushPendingInput();
+
     SemanticInputEvent semantic_event(SemanticValue::SelectAll);
     semantic_event.d_payload.source = convertToCursorInputSource(button);
 
@@ -482,6 +514,8 @@ bool InputAggregator::injectCopyRequest()
     if (d_inputReceiver == nullptr)
         return false;
 
+    flushPendingInput();
+
     SemanticInputEvent semantic_event(SemanticValue::Copy);
 
     return d_inputReceiver->injectInputEvent(semantic_event);
@@ -492,6 +526,8 @@ bool InputAggregator::injectCutRequest()
     if (d_inputReceiver == nullptr)
         return false;
 
+    flushPendingInput();
+
     SemanticInputEvent semantic_event(SemanticValue::Cut);
 
     return d_inputReceiver->injectInputEvent(semantic_event);
@@ -502,6 +538,8 @@ bool InputAggregator::injectPasteRequest()
     if (d_inputReceiver == nullptr)
         return false;
 
+    flushPendingInput();
+
     SemanticInputEvent semantic_event(SemanticValue::Paste);
 
     return d_inputReceiver->injectInputEvent(semantic_event);
@@ -575,4 +613,57 @@ bool InputAggregator::onDisplaySizeChanged(const EventArgs&)
     return true;
 }
 
+//----------------------------------------------------------------------------//
+void InputAggregator::setEventCoalescingEnabled(bool enabled)
+{
+    if (!enabled)
+        flushPendingInput();
+
+    d_coalesceEvents = enabled;
+}
+
+//----------------------------------------------------------------------------//
+bool InputAggregator::flushPendingInput()
+{
+    if (d_inputReceiver == nullptr)
+        return false;
+
+    bool handled = false;
+
+    if (d_hasPendingCursorMove)
+    {
+        d_hasPendingCursorMove = false;
+        handled = sendCursorMove();
+    }
+
+    if (d_hasPendingScroll)
+    {
+        const float delta = d_pendingScrollDelta;
+        d_hasPendingScroll = false;
+        d_pendingScrollDelta = 0.0f;
+        handled = sendScroll(delta) || handled;
+    }
+
+    return handled;
+}
+
+//----------------------------------------------------------------------------//
+bool InputAggregator::sendCursorMove()
+{
+    SemanticInputEvent semantic_event(SemanticValue::CursorMove);
+    semantic_event.d_payload.array[0] = d_pointerPosition.x;
+    semantic_event.d_payload.array[1] = d_pointerPosition.y;
+
+    return d_inputReceiver->injectInputEvent(semantic_event);
+}
+
+//----------------------------------------------------------------------------//
+bool InputAggregator::sendScroll(float delta)
+{
+    SemanticInputEvent semantic_event(SemanticValue::VerticalScroll);
+    semantic_event.d_payload.single = delta;
+
+    return d_inputReceiver->injectInputEvent(semantic_event);
+}
+
 } // End of  CEGUI namespace section
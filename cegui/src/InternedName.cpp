@@ -0,0 +1,78 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/InternedName.h"
+
+#include <mutex>
+#include <unordered_set>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//----------------------------------------------------------------------------//
+// Constructed on first use, as names get interned during static initialisation.
+std::unordered_set<String>& getNameTable()
+{
+    static std::unordered_set<String> table;
+    return table;
+}
+
+//----------------------------------------------------------------------------//
+// Names may be interned by layouts being loaded on other threads.
+std::mutex& getNameTableMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+}
+
+//----------------------------------------------------------------------------//
+InternedName::InternedName(const String& name)
+{
+    std::lock_guard<std::mutex> guard(getNameTableMutex());
+    d_string = &*getNameTable().insert(name).first;
+}
+
+//----------------------------------------------------------------------------//
+InternedName InternedName::find(const String& name)
+{
+    std::lock_guard<std::mutex> guard(getNameTableMutex());
+    std::unordered_set<String>& table = getNameTable();
+    std::unordered_set<String>::const_iterator entry = table.find(name);
+
+    return InternedName(entry != table.end() ? &*entry : nullptr);
+}
+
+//----------------------------------------------------------------------------//
+const String& InternedName::getString() const
+{
+    static const String empty;
+    return d_string ? *d_string : empty;
+}
+
+} // End of  CEGUI namespace section
@@ -42,23 +42,21 @@ void RenderedStringWordWrapper<JustifiedRenderedString>::format(
 {
     deleteFormatters();
 
-    RenderedString rstring, lstring;
-    rstring = *d_renderedString;
-    float rs_width;
+    RenderedString rstring(*d_renderedString);
+    // lines are only measured up to the area width, so that the remainder of
+    // a long line is not measured again after every split.
+    const float width_limit = std::max(area_size.d_width, 0.0f);
 
     FormattedRenderedString* frs;
 
     for (size_t line = 0; line < rstring.getLineCount(); ++line)
     {
-        while ((rs_width = rstring.getPixelSize(ref_wnd, line).d_width) > 0)
+        while (rstring.getPixelWidthUpTo(ref_wnd, line, width_limit) > width_limit)
         {
-            // skip line if no wrapping occurs
-            if (rs_width <= area_size.d_width)
-                break;
-
-            // split rstring at width into lstring and remaining rstring
-            rstring.split(ref_wnd, line, area_size.d_width, lstring);
-            frs = new JustifiedRenderedString(*new RenderedString(lstring));
+            // split rstring at width into a new lstring and remaining rstring
+            RenderedString* lstring = new RenderedString();
+            rstring.split(ref_wnd, line, area_size.d_width, *lstring);
+            frs = new JustifiedRenderedString(*lstring);
             frs->format(ref_wnd, area_size);
             d_lines.push_back(frs);
             line = 0;
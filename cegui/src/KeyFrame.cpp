@@ -29,6 +29,7 @@
 #include "CEGUI/KeyFrame.h"
 #include "CEGUI/AnimationInstance.h"
 #include "CEGUI/Affector.h"
+#include "CEGUI/Interpolator.h"
 #include "CEGUI/Animation_xmlHandler.h"
 #include "CEGUI/XMLSerializer.h"
 #include "CEGUI/PropertyHelper.h"
@@ -43,7 +44,7 @@ namespace CEGUI
 KeyFrame::KeyFrame(Affector* parent, float position):
         d_parent(parent),
         d_position(position),
-
+        d_nativeValueInterpolator(nullptr),
         d_progression(Progression::Linear)
 {}
 
@@ -96,6 +97,8 @@ float KeyFrame::getPosition() const
 void KeyFrame::setValue(const String& value)
 {
     d_value = value;
+    d_nativeValue.reset();
+    d_nativeValueInterpolator = nullptr;
 }
 
 //----------------------------------------------------------------------------//
@@ -129,6 +132,22 @@ const String& KeyFrame::getValueForAnimation(AnimationInstance* instance) const
     }
 }
 
+//----------------------------------------------------------------------------//
+const InterpolatorValue* KeyFrame::getNativeValue(
+    const NativeInterpolator& interpolator)
+{
+    if (!d_sourceProperty.empty())
+        return nullptr;
+
+    if (d_nativeValueInterpolator != &interpolator)
+    {
+        d_nativeValue.reset(interpolator.createValue(d_value));
+        d_nativeValueInterpolator = &interpolator;
+    }
+
+    return d_nativeValue.get();
+}
+
 //----------------------------------------------------------------------------//
 void KeyFrame::setProgression(Progression p)
 {
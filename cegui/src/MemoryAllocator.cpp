@@ -0,0 +1,139 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/MemoryAllocator.h"
+#include <atomic>
+#include <cstdlib>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//! Allocator used when the host application set none.
+class DefaultMemoryAllocator : public MemoryAllocator
+{
+public:
+    void* allocate(std::size_t size, MemoryCategory) override
+    {
+        void* memory = std::malloc(size ? size : 1);
+        if (!memory)
+            throw std::bad_alloc();
+
+        return memory;
+    }
+
+    void deallocate(void* memory, std::size_t, MemoryCategory) override
+    {
+        std::free(memory);
+    }
+};
+
+// a function local static, so that objects created during static
+// initialisation can already use it
+MemoryAllocator& getDefaultAllocator()
+{
+    static DefaultMemoryAllocator defaultAllocator;
+    return defaultAllocator;
+}
+
+const int CategoryCount = static_cast<int>(MemoryCategory::Count);
+
+//! Allocator set by the host application, nullptr for the default one.
+std::atomic<MemoryAllocator*> s_currentAllocator(nullptr);
+std::atomic<std::size_t> s_allocatedSizes[CategoryCount];
+std::atomic<std::size_t> s_allocationCounts[CategoryCount];
+}
+
+//----------------------------------------------------------------------------//
+MemoryAllocator::~MemoryAllocator()
+{
+}
+
+//----------------------------------------------------------------------------//
+MemoryAllocator& MemoryAllocator::getCurrent()
+{
+    MemoryAllocator* allocator = s_currentAllocator.load(std::memory_order_relaxed);
+    return allocator ? *allocator : getDefaultAllocator();
+}
+
+//----------------------------------------------------------------------------//
+void MemoryAllocator::setCurrent(MemoryAllocator* allocator)
+{
+    s_currentAllocator = allocator;
+}
+
+//----------------------------------------------------------------------------//
+void* MemoryAllocator::allocateTracked(std::size_t size, MemoryCategory category)
+{
+    void* memory = getCurrent().allocate(size, category);
+
+    const int index = static_cast<int>(category);
+    s_allocatedSizes[index].fetch_add(size, std::memory_order_relaxed);
+    s_allocationCounts[index].fetch_add(1, std::memory_order_relaxed);
+
+    return memory;
+}
+
+//----------------------------------------------------------------------------//
+void MemoryAllocator::deallocateTracked(void* memory, std::size_t size,
+                                        MemoryCategory category)
+{
+    if (!memory)
+        return;
+
+    getCurrent().deallocate(memory, size, category);
+
+    const int index = static_cast<int>(category);
+    s_allocatedSizes[index].fetch_sub(size, std::memory_order_relaxed);
+    s_allocationCounts[index].fetch_sub(1, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------//
+std::size_t MemoryAllocator::getAllocatedSize(MemoryCategory category)
+{
+    return s_allocatedSizes[static_cast<int>(category)].load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------//
+std::size_t MemoryAllocator::getAllocationCount(MemoryCategory category)
+{
+    return s_allocationCounts[static_cast<int>(category)].load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------//
+std::size_t MemoryAllocator::getTotalAllocationCount()
+{
+    std::size_t count = 0;
+    for (int i = 0; i < CategoryCount; ++i)
+        count += s_allocationCounts[i].load(std::memory_order_relaxed);
+
+    return count;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -27,6 +27,7 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/MinizipResourceProvider.h"
+#include "CEGUI/DataContainer.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/Exceptions.h"
 
@@ -34,8 +35,13 @@
 #if !defined(__APPLE__) || defined(CEGUI_HAS_MINIZIP_RESOURCE_PROVIDER)
 
 #include "minizip/unzip.h"
+#include <zlib.h>
 
 #include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #if defined (__WIN32__) || defined(_WIN32)
 #   include <shlwapi.h>
@@ -55,6 +61,22 @@ namespace CEGUI
 // Impl struct: mainly used in order to keep unzip.h out of the public headers.
 struct MinizipResourceProvider::Impl
 {
+    //! Location and layout of an archive entry, taken from the central directory.
+    struct Entry
+    {
+        //! Position of the entry for unzGoToFilePos.
+        unz_file_pos d_position;
+        //! Offset of the entry data in d_archiveData, or NoDataOffset.
+        std::uint64_t d_dataOffset;
+        std::uint64_t d_compressedSize;
+        std::uint64_t d_uncompressedSize;
+        std::uint32_t d_crc;
+        int d_method;
+        bool d_encrypted;
+    };
+
+    static const std::uint64_t NoDataOffset = ~std::uint64_t(0);
+
     Impl(const bool loadLocal) :
         d_zfile(0),
         d_loadLocal(loadLocal)
@@ -65,8 +87,88 @@ struct MinizipResourceProvider::Impl
     String  d_archive;
     String  d_password;
     bool    d_loadLocal;
+
+    //! Entries of the archive by name.
+    std::unordered_map<String, Entry> d_index;
+    //! Names of the entries in the order of the central directory.
+    std::vector<String> d_names;
+    //! The archive mapped into memory, empty if it could not be mapped.
+    RawDataContainer d_archiveData;
+    //! Mappings of previously opened archives, still referenced by loaded data.
+    std::vector<std::unique_ptr<RawDataContainer>> d_retiredArchives;
+    //! Guards d_zfile, which reads entries that can not be taken from d_archiveData.
+    std::mutex d_zfileMutex;
 };
 
+namespace
+{
+//----------------------------------------------------------------------------//
+std::uint32_t readLE16(const std::uint8_t* data)
+{
+    return data[0] | (data[1] << 8);
+}
+
+//----------------------------------------------------------------------------//
+std::uint32_t readLE32(const std::uint8_t* data)
+{
+    return data[0] | (data[1] << 8) | (data[2] << 16) |
+        (static_cast<std::uint32_t>(data[3]) << 24);
+}
+
+//----------------------------------------------------------------------------//
+/*
+    Finds the data of an entry in the mapped archive by following its central
+    directory record to its local header. Returns false for archives with data
+    before the zip content and for zip64 entries, which are read by minizip.
+*/
+bool findEntryData(const RawDataContainer& archive, std::uint64_t centralRecord,
+                   std::uint64_t compressedSize, std::uint64_t& dataOffset)
+{
+    const std::uint8_t* const data = archive.getDataPtr();
+    const std::uint64_t size = archive.getSize();
+
+    if (centralRecord + 46 > size || readLE32(data + centralRecord) != 0x02014b50)
+        return false;
+
+    const std::uint64_t localHeader = readLE32(data + centralRecord + 42);
+    if (localHeader == 0xffffffff || localHeader + 30 > size ||
+        readLE32(data + localHeader) != 0x04034b50)
+    {
+        return false;
+    }
+
+    const std::uint64_t start = localHeader + 30 +
+        readLE16(data + localHeader + 26) + readLE16(data + localHeader + 28);
+
+    if (start > size || compressedSize > size - start)
+        return false;
+
+    dataOffset = start;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+// Inflates a raw deflate stream, returning false if it does not fill output.
+bool inflateEntry(const std::uint8_t* input, std::uint64_t inputSize,
+                  std::uint8_t* output, std::uint64_t outputSize)
+{
+    z_stream stream = z_stream();
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK)
+        return false;
+
+    stream.next_in = const_cast<Bytef*>(input);
+    stream.avail_in = static_cast<uInt>(inputSize);
+    stream.next_out = output;
+    stream.avail_out = static_cast<uInt>(outputSize);
+
+    const int result = inflate(&stream, Z_FINISH);
+    inflateEnd(&stream);
+
+    return result == Z_STREAM_END && stream.total_out == outputSize;
+}
+
+}
+
 //----------------------------------------------------------------------------//
 // Helper function that matches names against the pattern.
 bool nameMatchesPattern(const String& name, const String& pattern)
@@ -95,6 +197,9 @@ MinizipResourceProvider::MinizipResourceProvider(const String& archive,
 //----------------------------------------------------------------------------//
 MinizipResourceProvider::~MinizipResourceProvider()
 {
+    // pending loads may still be reading the archive
+    cancelPendingLoads();
+
     if (d_pimpl->d_zfile)
         closeArchive();
 
@@ -147,6 +252,54 @@ void MinizipResourceProvider::openArchive()
         throw InvalidRequestException(
             "'" + d_pimpl->d_archive + "' does not exist");
     }
+
+    // entries that are stored or deflated are then read from the mapping
+    // without going through the zip handle
+    if (d_memoryMappingEnabled)
+        mapFile(d_pimpl->d_archive, 0, d_pimpl->d_archiveData);
+
+    // index the central directory once, rather than searching it linearly
+    // with unzLocateFile for every load
+    char current_name[1024];
+    unz_file_info file_info;
+
+    if (unzGoToFirstFile(d_pimpl->d_zfile) != UNZ_OK)
+        return;
+
+    do
+    {
+        if (unzGetCurrentFileInfo(d_pimpl->d_zfile, &file_info,
+                                  current_name, 1024, 0, 0, 0, 0) != UNZ_OK)
+        {
+            Logger::getSingleton().logEvent(
+                "MinizipResourceProvider::openArchive: "
+                "unzGetCurrentFileInfo failed, terminating scan.", LoggingLevel::Error);
+
+            return;
+        }
+
+        Impl::Entry entry;
+        unzGetFilePos(d_pimpl->d_zfile, &entry.d_position);
+        entry.d_compressedSize = file_info.compressed_size;
+        entry.d_uncompressedSize = file_info.uncompressed_size;
+        entry.d_crc = static_cast<std::uint32_t>(file_info.crc);
+        entry.d_method = static_cast<int>(file_info.compression_method);
+        entry.d_encrypted = (file_info.flag & 1) != 0;
+        entry.d_dataOffset = Impl::NoDataOffset;
+
+        std::uint64_t dataOffset;
+        if (d_pimpl->d_archiveData.getDataPtr() &&
+            findEntryData(d_pimpl->d_archiveData, unzGetOffset(d_pimpl->d_zfile),
+                          entry.d_compressedSize, dataOffset))
+        {
+            entry.d_dataOffset = dataOffset;
+        }
+
+        const String name(current_name);
+        d_pimpl->d_names.push_back(name);
+        d_pimpl->d_index[name] = entry;
+    }
+    while (unzGoToNextFile(d_pimpl->d_zfile) == UNZ_OK);
 }
 
 //----------------------------------------------------------------------------//
@@ -164,6 +317,20 @@ void MinizipResourceProvider::closeArchive()
     }
 
     d_pimpl->d_zfile = 0;
+    d_pimpl->d_index.clear();
+    d_pimpl->d_names.clear();
+
+    // loaded data may still borrow from the mapping, so it is only unmapped
+    // along with the provider
+    if (d_pimpl->d_archiveData.getDataPtr())
+    {
+        std::unique_ptr<RawDataContainer> retired(new RawDataContainer());
+        retired->setMappedData(d_pimpl->d_archiveData.getDataPtr(),
+                               d_pimpl->d_archiveData.getSize());
+        d_pimpl->d_archiveData.setData(nullptr);
+        d_pimpl->d_archiveData.setSize(0);
+        d_pimpl->d_retiredArchives.push_back(std::move(retired));
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -188,20 +355,51 @@ void MinizipResourceProvider::loadRawDataContainer(const String& filename,
             "loaded because the archive has not been set");
     }
 
-#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII)
-    if (unzLocateFile(d_pimpl->d_zfile, final_filename.c_str(), 0) != UNZ_OK)
-#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
-    if (unzLocateFile(d_pimpl->d_zfile, String::convertUtf32ToUtf8(final_filename.getString()).c_str(), 0) != UNZ_OK)
-#endif
+    const auto found = d_pimpl->d_index.find(final_filename);
+    if (found == d_pimpl->d_index.end())
     {
         throw InvalidRequestException("'" + final_filename +
             "' does not exist");
     }
 
-    unz_file_info file_info;
+    const Impl::Entry& entry = found->second;
+    const std::uint64_t size = entry.d_uncompressedSize;
+
+    if (entry.d_dataOffset != Impl::NoDataOffset && !entry.d_encrypted)
+    {
+        const std::uint8_t* const data =
+            d_pimpl->d_archiveData.getDataPtr() + entry.d_dataOffset;
+
+        // stored entries are handed out in place
+        if (entry.d_method == 0 && entry.d_compressedSize == size)
+        {
+            output.setBorrowedData(data, static_cast<size_t>(size));
+            return;
+        }
+
+        if (entry.d_method == Z_DEFLATED)
+        {
+            std::uint8_t* const buffer = new std::uint8_t[size];
+
+            if (!inflateEntry(data, entry.d_compressedSize, buffer, size) ||
+                crc32(0, buffer, static_cast<uInt>(size)) != entry.d_crc)
+            {
+                delete[] buffer;
+                throw FileIOException("'" + final_filename +
+                    "' error reading file");
+            }
+
+            output.setData(buffer);
+            output.setSize(size);
+            return;
+        }
+    }
 
-    if (unzGetCurrentFileInfo(d_pimpl->d_zfile, &file_info,
-                              0, 0, 0, 0, 0, 0) != UNZ_OK)
+    // other entries are read through the zip handle, one at a time
+    std::lock_guard<std::mutex> lock(d_pimpl->d_zfileMutex);
+
+    unz_file_pos position = entry.d_position;
+    if (unzGoToFilePos(d_pimpl->d_zfile, &position) != UNZ_OK)
     {
         throw FileIOException("'" + final_filename +
             "' error reading file header");
@@ -213,17 +411,19 @@ void MinizipResourceProvider::loadRawDataContainer(const String& filename,
             "' error opening file");
     }
 
-    std::uint64_t size = file_info.uncompressed_size;
     std::uint8_t* buffer = new std::uint8_t[size];
 
     if (unzReadCurrentFile(d_pimpl->d_zfile, buffer, size) < 0)
     {
+        delete[] buffer;
+        unzCloseCurrentFile(d_pimpl->d_zfile);
         throw FileIOException("'" + final_filename +
             "' error reading file");
     }
 
     if (unzCloseCurrentFile(d_pimpl->d_zfile) != UNZ_OK)
     {
+        delete[] buffer;
         throw GenericException("'" + final_filename +
             "' error validating file");
     }
@@ -257,39 +457,16 @@ size_t MinizipResourceProvider::getResourceGroupFileNames(
     if (!d_pimpl->d_zfile)
         return entries;
 
-    char current_name[1024];
-    unz_file_info file_info;
-
-    if (unzGoToFirstFile(d_pimpl->d_zfile) != UNZ_OK)
+    for (const String& name : d_pimpl->d_names)
     {
-        Logger::getSingleton().logEvent(
-            "MinizipResourceProvider::getResourceGroupFileNames: "
-            "unzGoToFirstFile failed, skipping zip file scan.", LoggingLevel::Error);
-
-        return entries;
-    }
-
-    do
-    {
-        if (unzGetCurrentFileInfo(d_pimpl->d_zfile, &file_info,
-                                  current_name, 1024, 0, 0, 0, 0) != UNZ_OK)
-        {
-            Logger::getSingleton().logEvent(
-                "MinizipResourceProvider::getResourceGroupFileNames: "
-                "unzGetCurrentFileInfo failed, terminating scan.", LoggingLevel::Error);
-
-            return entries;
-        }
-
         // skip this file if it does not match the pattern.
-        if (!nameMatchesPattern(current_name, dir_name + file_pattern))
+        if (!nameMatchesPattern(name, dir_name + file_pattern))
             continue;
 
         // strip the resource directory name and append the matched file
-        out_vec.push_back(String(current_name).substr(dir_name.length()));
+        out_vec.push_back(name.substr(dir_name.length()));
         ++entries;
     }
-    while (unzGoToNextFile(d_pimpl->d_zfile) == UNZ_OK);
 
     return entries;
 }
@@ -32,7 +32,7 @@
 
 #include "CEGUI/NamedElement.h"
 #include "CEGUI/Logger.h"
-#include <queue>
+#include <algorithm>
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -64,11 +64,18 @@ void NamedElement::setName(const String& name)
     }
 
     // log this under informative level
-    Logger::getSingleton().logEvent("Renamed element at: " + getNamePath() +
-                                    " as: " + name, LoggingLevel::Informative);
+    CEGUI_LOG(LoggingLevel::Informative, "Renamed element at: " + getNamePath() +
+                                         " as: " + name);
+
+    NamedElement* const parent = dynamic_cast<NamedElement*>(d_parent);
+    if (parent)
+        parent->unindexChild(this);
 
     d_name = name;
 
+    if (parent)
+        parent->indexChild(this);
+
     NamedElementEventArgs args(this);
     onNameChanged(args);
 }
@@ -154,7 +161,8 @@ void NamedElement::removeChild(const String& name_path)
 //----------------------------------------------------------------------------//
 void NamedElement::addChild_impl(Element* element)
 {
-    if (NamedElement* named_element = dynamic_cast<NamedElement*>(element))
+    NamedElement* const named_element = dynamic_cast<NamedElement*>(element);
+    if (named_element)
     {
         const NamedElement* const existing = getChildByNamePath_impl(named_element->getName());
 
@@ -166,73 +174,183 @@ void NamedElement::addChild_impl(Element* element)
     }
 
     Element::addChild_impl(element);
+
+    if (d_childNameIndex)
+    {
+        if (named_element)
+        {
+            // the element may have been attached already
+            unindexChild(named_element);
+            indexChild(named_element);
+        }
+    }
+    else if (d_children.size() >= ChildNameIndexThreshold)
+    {
+        d_childNameIndex.reset(new ChildNameIndex());
+        for (Element* child : d_children)
+            if (NamedElement* named_child = dynamic_cast<NamedElement*>(child))
+                indexChild(named_child);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void NamedElement::removeChild_impl(Element* element)
+{
+    Element::removeChild_impl(element);
+
+    if (const NamedElement* named_element = dynamic_cast<const NamedElement*>(element))
+        if (named_element->getParentElement() != this)
+            unindexChild(named_element);
 }
 
 //----------------------------------------------------------------------------//
 NamedElement* NamedElement::getChildByNamePath_impl(const String& name_path) const
 {
-    const size_t sep = name_path.find_first_of('/');
-    const String base_child(name_path.substr(0, sep));
+    // walk the path segment by segment without copying any of them
+    const String::value_type* segment = name_path.data();
+    const String::value_type* const end = segment + name_path.length();
+    const NamedElement* element = this;
 
-    const size_t child_count = d_children.size();
+    while (true)
+    {
+        const String::value_type* sep = std::find(segment, end, '/');
 
-    for (size_t i = 0; i < child_count; ++i)
+        NamedElement* child = element->getChildByName(segment, sep - segment);
+        if (!child)
+            return nullptr;
+
+        // a trailing separator refers to the element itself
+        if (sep == end || sep + 1 == end)
+            return child;
+
+        element = child;
+        segment = sep + 1;
+    }
+}
+
+//----------------------------------------------------------------------------//
+NamedElement* NamedElement::getChildByNameRecursive_impl(const String& name) const
+{
+    // search breadth-first, level by level. Names are unique among siblings,
+    // so the first parent in a level that has a matching child yields the
+    // same element as visiting all elements of the level in order would.
+    const String::value_type* const name_data = name.data();
+    const size_t name_length = name.length();
+
+    std::vector<const Element*> level(1, this);
+    std::vector<const Element*> next_level;
+
+    while (!level.empty())
     {
-        Element* child = getChildElementAtIndex(i);
-        NamedElement* named_child = dynamic_cast<NamedElement*>(child);
+        for (const Element* parent : level)
+        {
+            const NamedElement* named_parent = dynamic_cast<const NamedElement*>(parent);
+            NamedElement* found = named_parent ?
+                named_parent->getChildByName(name_data, name_length) :
+                findChildByName(*parent, name_data, name_length);
 
-        if (!named_child)
-            continue;
+            if (found)
+                return found;
+        }
 
-        if (named_child->getName() == base_child)
+        next_level.clear();
+        for (const Element* parent : level)
         {
-            if (sep != String::npos && sep < name_path.length() - 1)
-                return named_child->getChildByNamePath_impl(name_path.substr(sep + 1));
-            else
-                return named_child;
+            const size_t child_count = parent->getChildCount();
+            for (size_t i = 0; i < child_count; ++i)
+                if (const Element* child = parent->getChildElementAtIndex(i))
+                    next_level.push_back(child);
         }
+
+        level.swap(next_level);
     }
 
     return nullptr;
 }
 
 //----------------------------------------------------------------------------//
-NamedElement* NamedElement::getChildByNameRecursive_impl(const String& name) const
+std::size_t NamedElement::hashName(const String::value_type* name, size_t length)
 {
-    const size_t child_count = d_children.size();
+    // FNV-1a over the code units
+    std::size_t hash = 2166136261u;
+    for (size_t i = 0; i < length; ++i)
+    {
+        hash ^= static_cast<std::size_t>(name[i]);
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
 
-    std::queue<Element*> ElementsToSearch;
+//----------------------------------------------------------------------------//
+NamedElement* NamedElement::getChildByName(const String::value_type* name,
+                                           size_t length) const
+{
+    if (!d_childNameIndex)
+        return findChildByName(*this, name, length);
 
-    for (size_t i = 0; i < child_count; ++i) // load all children into the queue
+    const auto range = d_childNameIndex->equal_range(hashName(name, length));
+    for (auto it = range.first; it != range.second; ++it)
     {
-        Element* child = getChildElementAtIndex(i);
-        ElementsToSearch.push(child);
+        const String& child_name = it->second->getName();
+        if (child_name.length() == length &&
+            std::equal(name, name + length, child_name.data()))
+            return it->second;
     }
 
-    while (!ElementsToSearch.empty()) // breadth-first search for the child to find
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------//
+NamedElement* NamedElement::findChildByName(const Element& parent,
+    const String::value_type* name, size_t length)
+{
+    const size_t child_count = parent.getChildCount();
+    for (size_t i = 0; i < child_count; ++i)
     {
-        Element* child = ElementsToSearch.front();
-        ElementsToSearch.pop();
+        NamedElement* named_child =
+            dynamic_cast<NamedElement*>(parent.getChildElementAtIndex(i));
 
-        NamedElement* named_child = dynamic_cast<NamedElement*>(child);
-        if (named_child)
-        {
-            if (named_child->getName() == name)
-            {
-                return named_child;
-            }
-        }
+        if (!named_child)
+            continue;
 
-        const size_t element_child_count = child->getChildCount();
-        for(size_t i = 0; i < element_child_count; ++i)
-        {
-            ElementsToSearch.push(child->getChildElementAtIndex(i));
-        }
+        const String& child_name = named_child->getName();
+        if (child_name.length() == length &&
+            std::equal(name, name + length, child_name.data()))
+            return named_child;
     }
 
     return nullptr;
 }
 
+//----------------------------------------------------------------------------//
+void NamedElement::indexChild(NamedElement* child)
+{
+    if (!d_childNameIndex)
+        return;
+
+    const String& name = child->getName();
+    d_childNameIndex->emplace(hashName(name.data(), name.length()), child);
+}
+
+//----------------------------------------------------------------------------//
+void NamedElement::unindexChild(const NamedElement* child)
+{
+    if (!d_childNameIndex)
+        return;
+
+    const String& name = child->getName();
+    const auto range = d_childNameIndex->equal_range(hashName(name.data(), name.length()));
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == child)
+        {
+            d_childNameIndex->erase(it);
+            return;
+        }
+    }
+}
+
 //----------------------------------------------------------------------------//
 void NamedElement::addNamedElementProperties()
 {
@@ -0,0 +1,140 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Observable.h"
+#include "CEGUI/Window.h"
+
+#include <algorithm>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+std::vector<ObservableBase*> ObservableBase::s_pending;
+
+//----------------------------------------------------------------------------//
+PropertyBindingBase::PropertyBindingBase(ObservableBase& observable, Window& window,
+                                         Property& property) :
+    d_observable(observable),
+    d_window(window),
+    d_property(property),
+    d_destructionConnection(window.subscribeEvent(Window::EventDestructionStarted,
+        Event::Subscriber(&PropertyBindingBase::handleDestructionStarted, this)))
+{
+}
+
+//----------------------------------------------------------------------------//
+bool PropertyBindingBase::handleDestructionStarted(const EventArgs&)
+{
+    // destroys this binding
+    d_observable.removeBinding(*this);
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+ObservableBase::~ObservableBase()
+{
+    if (d_pending)
+        *std::find(s_pending.begin(), s_pending.end(), this) = nullptr;
+}
+
+//----------------------------------------------------------------------------//
+void ObservableBase::addBinding(std::unique_ptr<PropertyBindingBase> binding)
+{
+    removeBinding(binding->getWindow(), binding->getProperty().getName());
+
+    binding->apply();
+    d_bindings.push_back(std::move(binding));
+}
+
+//----------------------------------------------------------------------------//
+void ObservableBase::removeBinding(const Window& window, const String& propertyName)
+{
+    for (auto it = d_bindings.begin(); it != d_bindings.end(); ++it)
+    {
+        if (&(*it)->getWindow() == &window && (*it)->getProperty().getName() == propertyName)
+        {
+            d_bindings.erase(it);
+            return;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ObservableBase::removeBindings(const Window& window)
+{
+    d_bindings.erase(std::remove_if(d_bindings.begin(), d_bindings.end(),
+        [&window](const std::unique_ptr<PropertyBindingBase>& binding)
+        {
+            return &binding->getWindow() == &window;
+        }), d_bindings.end());
+}
+
+//----------------------------------------------------------------------------//
+void ObservableBase::removeBinding(const PropertyBindingBase& binding)
+{
+    d_bindings.erase(std::find_if(d_bindings.begin(), d_bindings.end(),
+        [&binding](const std::unique_ptr<PropertyBindingBase>& candidate)
+        {
+            return candidate.get() == &binding;
+        }));
+}
+
+//----------------------------------------------------------------------------//
+void ObservableBase::notifyChanged()
+{
+    if (d_pending || d_bindings.empty())
+        return;
+
+    d_pending = true;
+    s_pending.push_back(this);
+}
+
+//----------------------------------------------------------------------------//
+void ObservableBase::applyPendingChanges()
+{
+    // observables changed by the property setters are appended and left for the next call
+    const size_t count = s_pending.size();
+    for (size_t i = 0; i < count; ++i)
+    {
+        ObservableBase* const observable = s_pending[i];
+        if (!observable)
+            continue;
+
+        s_pending[i] = nullptr;
+        observable->d_pending = false;
+
+        // NB: bindings may be removed while applying, when windows get destroyed
+        for (size_t j = 0; j < observable->d_bindings.size(); ++j)
+            observable->d_bindings[j]->apply();
+    }
+
+    s_pending.erase(s_pending.begin(), s_pending.begin() + count);
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
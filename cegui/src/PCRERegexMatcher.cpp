@@ -35,7 +35,8 @@ namespace CEGUI
 {
 //----------------------------------------------------------------------------//
 PCRERegexMatcher::PCRERegexMatcher() :
-    d_regex(nullptr)
+    d_regex(nullptr),
+    d_extra(nullptr)
 {
 }
 
@@ -51,23 +52,16 @@ void PCRERegexMatcher::setRegexString(const String& regex)
     // release old regex string.
     release();
     d_string.clear();
-    // try to compile this new regex string
+    // try to compile this new regex string. Matches are always anchored, and
+    // doing that at compile time rather than per match keeps the JIT usable.
     const char* prce_error;
     int pcre_erroff;
 #if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
-    d_regex = pcre_compile(regex.c_str(), PCRE_UTF8,
+    d_regex = pcre_compile(regex.c_str(), PCRE_UTF8 | PCRE_ANCHORED,
                            &prce_error, &pcre_erroff, 0);
 #elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
-    d_regex = pcre_compile(String::convertUtf32ToUtf8(regex.getString()).c_str(), PCRE_UTF8,
-        &prce_error, &pcre_erroff, nullptr);
-#endif
-
-#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
-    d_regex = pcre_compile(regex.c_str(), PCRE_UTF8,
-        &prce_error, &pcre_erroff, 0);
-#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
-    d_regex = pcre_compile(String::convertUtf32ToUtf8(regex.getString()).c_str(), PCRE_UTF8,
-        &prce_error, &pcre_erroff, nullptr);
+    d_regex = pcre_compile(String::convertUtf32ToUtf8(regex.getString()).c_str(),
+        PCRE_UTF8 | PCRE_ANCHORED, &prce_error, &pcre_erroff, nullptr);
 #endif
 
     // handle failure
@@ -76,6 +70,17 @@ void PCRERegexMatcher::setRegexString(const String& regex)
             "Bad RegEx set: '" + regex + "'.  Additional Information: " +
             prce_error);
 
+    // study the regex, JIT compiling it for partial matching where supported.
+    // a failed study only means matching without its speed up.
+#if defined(PCRE_STUDY_JIT_PARTIAL_SOFT_COMPILE)
+    d_extra = pcre_study(d_regex, PCRE_STUDY_JIT_PARTIAL_SOFT_COMPILE,
+                         &prce_error);
+#elif defined(PCRE_STUDY_JIT_COMPILE)
+    d_extra = pcre_study(d_regex, PCRE_STUDY_JIT_COMPILE, &prce_error);
+#else
+    d_extra = pcre_study(d_regex, 0, &prce_error);
+#endif
+
     // set this last so that upon failure object is in consistent state.
     d_string = regex;
 }
@@ -106,8 +111,8 @@ RegexMatcher::MatchState PCRERegexMatcher::getMatchStateOfString(
 
 #ifdef PCRE_PARTIAL_SOFT
     // we are using a new version of pcre
-    const std::int32_t result = pcre_exec(d_regex, nullptr, utf8_str, len, 0,
-                                 PCRE_PARTIAL_SOFT | PCRE_ANCHORED, match, 3);
+    const std::int32_t result = pcre_exec(d_regex, d_extra, utf8_str, len, 0,
+                                 PCRE_PARTIAL_SOFT, match, 3);
 #else
     // PCRE_PARTIAL is a backwards compatible synonym for PCRE_PARTIAL_SOFT
     // using it is a requirement if we want to support pcre < 8.0
@@ -116,8 +121,8 @@ RegexMatcher::MatchState PCRERegexMatcher::getMatchStateOfString(
     // single repeated characters if using pcre_exec,
     // It is suggested to use pcre_dfa_exec instead.
     int workspace[100]; // FIXME: persist the workspace between match attempts
-    const int result = pcre_dfa_exec(d_regex, 0, utf8_str, len, 0,
-                                     PCRE_PARTIAL | PCRE_ANCHORED, match, 3, workspace, 100);
+    const int result = pcre_dfa_exec(d_regex, d_extra, utf8_str, len, 0,
+                                     PCRE_PARTIAL, match, 3, workspace, 100);
 #endif
 
     if (result == PCRE_ERROR_PARTIAL)
@@ -141,6 +146,16 @@ RegexMatcher::MatchState PCRERegexMatcher::getMatchStateOfString(
 //----------------------------------------------------------------------------//
 void PCRERegexMatcher::release()
 {
+    if (d_extra)
+    {
+#if defined(PCRE_STUDY_JIT_COMPILE)
+        pcre_free_study(d_extra);
+#else
+        pcre_free(d_extra);
+#endif
+        d_extra = nullptr;
+    }
+
     if (d_regex)
     {
         pcre_free(d_regex);
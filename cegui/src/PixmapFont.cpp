@@ -136,6 +136,9 @@ void PixmapFont::updateFont()
     d_height = d_ascender - d_descender;
 
     d_origHorzScaling = d_autoScaled != AutoScaledMode::Disabled ? d_horzScaling : 1.0f;
+
+    invalidateLatin1GlyphMetrics();
+    releaseTextLayouts();
 }
 
 //----------------------------------------------------------------------------//
@@ -187,6 +190,8 @@ void PixmapFont::defineMapping(const char32_t codePoint, const String& imageName
     }
 
     d_codePointToGlyphMap[codePoint] = glyph;
+    invalidateLatin1GlyphMetrics();
+    releaseTextLayouts();
 }
 
 //----------------------------------------------------------------------------//
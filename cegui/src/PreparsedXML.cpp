@@ -0,0 +1,417 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/PreparsedXML.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/System.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/XMLParser.h"
+#include <sstream>
+#include <cstring>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const std::uint32_t PreparsedXML::FormatVersion = 1;
+
+namespace
+{
+//----------------------------------------------------------------------------//
+const char s_magic[8] = { 'C', 'E', 'G', 'U', 'I', 'P', 'X', 'M' };
+
+//----------------------------------------------------------------------------//
+void writeUInt32(OutStream& out_stream, std::uint32_t value)
+{
+    char bytes[4];
+    for (int i = 0; i < 4; ++i)
+        bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+
+    out_stream.write(bytes, sizeof(bytes));
+}
+
+//----------------------------------------------------------------------------//
+void writeUInt64(OutStream& out_stream, std::uint64_t value)
+{
+    writeUInt32(out_stream, static_cast<std::uint32_t>(value));
+    writeUInt32(out_stream, static_cast<std::uint32_t>(value >> 32));
+}
+
+//----------------------------------------------------------------------------//
+//! Bounds checked little endian reader over the data of a recording.
+class Reader
+{
+public:
+    Reader(const std::uint8_t* data, size_t size) :
+        d_pos(data),
+        d_end(data + size)
+    {}
+
+    size_t remaining() const { return static_cast<size_t>(d_end - d_pos); }
+
+    bool readBytes(const std::uint8_t*& bytes, size_t count)
+    {
+        if (remaining() < count)
+            return false;
+
+        bytes = d_pos;
+        d_pos += count;
+        return true;
+    }
+
+    bool readUInt32(std::uint32_t& value)
+    {
+        const std::uint8_t* bytes;
+        if (!readBytes(bytes, 4))
+            return false;
+
+        value = static_cast<std::uint32_t>(bytes[0]) |
+                (static_cast<std::uint32_t>(bytes[1]) << 8) |
+                (static_cast<std::uint32_t>(bytes[2]) << 16) |
+                (static_cast<std::uint32_t>(bytes[3]) << 24);
+        return true;
+    }
+
+    bool readUInt64(std::uint64_t& value)
+    {
+        std::uint32_t low, high;
+        if (!readUInt32(low) || !readUInt32(high))
+            return false;
+
+        value = (static_cast<std::uint64_t>(high) << 32) | low;
+        return true;
+    }
+
+private:
+    const std::uint8_t* d_pos;
+    const std::uint8_t* d_end;
+};
+
+}
+
+//----------------------------------------------------------------------------//
+//! XMLHandler appending the events of a parse to a PreparsedXML.
+class PreparsedXML::Recorder : public XMLHandler
+{
+public:
+    Recorder(PreparsedXML& target) :
+        d_target(target)
+    {}
+
+    const String& getDefaultResourceGroup() const override
+    {
+        return System::getSingleton().getResourceProvider()->getDefaultResourceGroup();
+    }
+
+    void elementStart(const String& element, const XMLAttributes& attributes) override
+    {
+        const size_t count = attributes.getCount();
+
+        d_target.d_events.push_back(ElementStartEvent);
+        d_target.d_events.push_back(d_target.addString(element));
+        d_target.d_events.push_back(static_cast<std::uint32_t>(count));
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            d_target.d_events.push_back(d_target.addString(attributes.getName(i)));
+            d_target.d_events.push_back(d_target.addString(attributes.getValue(i)));
+        }
+    }
+
+    void elementEnd(const String& element) override
+    {
+        d_target.d_events.push_back(ElementEndEvent);
+        d_target.d_events.push_back(d_target.addString(element));
+    }
+
+    void text(const String& text) override
+    {
+        d_target.d_events.push_back(TextEvent);
+        d_target.d_events.push_back(d_target.addString(text));
+    }
+
+private:
+    PreparsedXML& d_target;
+};
+
+//----------------------------------------------------------------------------//
+std::uint64_t PreparsedXML::computeSourceHash(const RawDataContainer& source)
+{
+    // 64 bit FNV-1a, seeded with the format version so that a change of the
+    // format also invalidates the recordings.
+    std::uint64_t hash = 14695981039346656037ULL ^ FormatVersion;
+    const std::uint8_t* const data = source.getDataPtr();
+    for (size_t i = 0; i < source.getSize(); ++i)
+    {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+//----------------------------------------------------------------------------//
+bool PreparsedXML::isPreparsedData(const RawDataContainer& data)
+{
+    return data.getSize() >= sizeof(s_magic) &&
+        std::memcmp(data.getDataPtr(), s_magic, sizeof(s_magic)) == 0;
+}
+
+//----------------------------------------------------------------------------//
+PreparsedXML::PreparsedXML() :
+    d_sourceHash(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+void PreparsedXML::record(const RawDataContainer& source, const String& schemaName)
+{
+    clear();
+
+    Recorder recorder(*this);
+    try
+    {
+        System::getSingleton().getXMLParser()->parseXML(recorder, source, schemaName);
+    }
+    catch (...)
+    {
+        clear();
+        throw;
+    }
+
+    d_sourceHash = computeSourceHash(source);
+    d_stringIndices.clear();
+}
+
+//----------------------------------------------------------------------------//
+void PreparsedXML::write(OutStream& out_stream) const
+{
+    out_stream.write(s_magic, sizeof(s_magic));
+    writeUInt32(out_stream, FormatVersion);
+    writeUInt64(out_stream, d_sourceHash);
+
+    writeUInt32(out_stream, static_cast<std::uint32_t>(d_strings.size()));
+    for (const String& str : d_strings)
+    {
+        std::ostringstream utf8;
+        utf8 << str;
+        const std::string bytes(utf8.str());
+
+        writeUInt32(out_stream, static_cast<std::uint32_t>(bytes.size()));
+        out_stream.write(bytes.data(), bytes.size());
+    }
+
+    writeUInt32(out_stream, static_cast<std::uint32_t>(d_events.size()));
+    for (const std::uint32_t word : d_events)
+        writeUInt32(out_stream, word);
+}
+
+//----------------------------------------------------------------------------//
+bool PreparsedXML::read(const RawDataContainer& data, std::uint64_t sourceHash)
+{
+    return readData(data, &sourceHash);
+}
+
+//----------------------------------------------------------------------------//
+bool PreparsedXML::read(const RawDataContainer& data)
+{
+    return readData(data, nullptr);
+}
+
+//----------------------------------------------------------------------------//
+bool PreparsedXML::readData(const RawDataContainer& data, const std::uint64_t* sourceHash)
+{
+    clear();
+
+    Reader reader(data.getDataPtr(), data.getSize());
+
+    const std::uint8_t* magic;
+    std::uint32_t version;
+    std::uint64_t hash;
+    if (!reader.readBytes(magic, sizeof(s_magic)) ||
+        std::memcmp(magic, s_magic, sizeof(s_magic)) != 0 ||
+        !reader.readUInt32(version) || version != FormatVersion ||
+        !reader.readUInt64(hash) || (sourceHash && hash != *sourceHash))
+    {
+        return false;
+    }
+
+    // every string and event takes at least 4 bytes, which bounds the
+    // counts before anything gets allocated for them.
+    std::uint32_t stringCount;
+    if (!reader.readUInt32(stringCount) || stringCount > reader.remaining() / 4)
+        return false;
+
+    d_strings.reserve(stringCount);
+    for (std::uint32_t i = 0; i < stringCount; ++i)
+    {
+        std::uint32_t length;
+        const std::uint8_t* bytes;
+        if (!reader.readUInt32(length) || !reader.readBytes(bytes, length))
+        {
+            clear();
+            return false;
+        }
+
+        d_strings.push_back(String(std::string(
+            reinterpret_cast<const char*>(bytes), length)));
+    }
+
+    std::uint32_t eventCount;
+    if (!reader.readUInt32(eventCount) || eventCount != reader.remaining() / 4)
+    {
+        clear();
+        return false;
+    }
+
+    d_events.resize(eventCount);
+    for (std::uint32_t& word : d_events)
+        reader.readUInt32(word);
+
+    if (reader.remaining() != 0 || !validateEvents())
+    {
+        clear();
+        return false;
+    }
+
+    d_sourceHash = hash;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void PreparsedXML::replay(XMLHandler& handler) const
+{
+    size_t i = 0;
+    while (i < d_events.size())
+    {
+        switch (d_events[i])
+        {
+        case ElementStartEvent:
+        {
+            const String& element = d_strings[d_events[i + 1]];
+            const std::uint32_t count = d_events[i + 2];
+            i += 3;
+
+            // the string table outlives the handler call, so narrow strings
+            // are referenced rather than copied into the attributes.
+            XMLAttributes attributes;
+            for (std::uint32_t a = 0; a < count; ++a, i += 2)
+            {
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
+                attributes.addView(d_strings[d_events[i]].c_str(), d_strings[d_events[i + 1]].c_str());
+#else
+                attributes.add(d_strings[d_events[i]], d_strings[d_events[i + 1]]);
+#endif
+            }
+
+            handler.elementStart(element, attributes);
+            break;
+        }
+
+        case ElementEndEvent:
+            handler.elementEnd(d_strings[d_events[i + 1]]);
+            i += 2;
+            break;
+
+        default:
+            handler.text(d_strings[d_events[i + 1]]);
+            i += 2;
+            break;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void PreparsedXML::clear()
+{
+    d_sourceHash = 0;
+    d_strings.clear();
+    d_stringIndices.clear();
+    d_events.clear();
+}
+
+//----------------------------------------------------------------------------//
+std::uint32_t PreparsedXML::addString(const String& str)
+{
+    const auto result = d_stringIndices.emplace(
+        str, static_cast<std::uint32_t>(d_strings.size()));
+
+    if (result.second)
+        d_strings.push_back(str);
+
+    return result.first->second;
+}
+
+//----------------------------------------------------------------------------//
+bool PreparsedXML::validateEvents() const
+{
+    const size_t size = d_events.size();
+    const size_t stringCount = d_strings.size();
+
+    size_t i = 0;
+    while (i < size)
+    {
+        switch (d_events[i])
+        {
+        case ElementStartEvent:
+        {
+            if (size - i < 3)
+                return false;
+
+            const size_t end = i + 3 + 2 * static_cast<size_t>(d_events[i + 2]);
+            if (end > size || d_events[i + 1] >= stringCount)
+                return false;
+
+            for (size_t s = i + 3; s < end; ++s)
+            {
+                if (d_events[s] >= stringCount)
+                    return false;
+            }
+
+            i = end;
+            break;
+        }
+
+        case ElementEndEvent:
+        case TextEvent:
+            if (size - i < 2 || d_events[i + 1] >= stringCount)
+                return false;
+            i += 2;
+            break;
+
+        default:
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
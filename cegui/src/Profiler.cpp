@@ -0,0 +1,57 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Profiler.h"
+#include <atomic>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+std::atomic<ProfilerBackend*> s_profilerBackend(nullptr);
+}
+
+//----------------------------------------------------------------------------//
+ProfilerBackend::~ProfilerBackend()
+{
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::setBackend(ProfilerBackend* backend)
+{
+    s_profilerBackend.store(backend, std::memory_order_release);
+}
+
+//----------------------------------------------------------------------------//
+ProfilerBackend* Profiler::getBackend()
+{
+    return s_profilerBackend.load(std::memory_order_acquire);
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -36,6 +36,12 @@ const String Property::XMLElementName("Property");
 const String Property::NameXMLAttributeName("name");
 const String Property::ValueXMLAttributeName("value");
 
+//----------------------------------------------------------------------------//
+void Property::copyValue(const PropertyReceiver* source, PropertyReceiver* target)
+{
+    set(target, get(source));
+}
+
 //----------------------------------------------------------------------------//
 bool Property::isDefault(const PropertyReceiver* receiver) const
 {
@@ -57,14 +63,14 @@ void Property::writeXMLToStream(const PropertyReceiver* receiver, XMLSerializer&
 			.attribute(NameXMLAttributeName,  d_name);
 		// Detect wether it is a long property or not
 		// Long property are needed if
-		const String& value = get(receiver);
+		const String value(get(receiver));
 		if (value.find(static_cast<String::value_type>('\n')) != String::npos)
 		{
 			xml_stream.text(value);
 		}
 		else
 		{
-			xml_stream.attribute(ValueXMLAttributeName, get(receiver));
+			xml_stream.attribute(ValueXMLAttributeName, value);
 		}
 		xml_stream.closeTag();
 	}
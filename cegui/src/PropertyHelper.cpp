@@ -37,6 +37,13 @@
 #include "CEGUI/AspectMode.h"
 
 #include <sstream>
+#include <algorithm>
+#include <limits>
+#include <clocale>
+#include <cstdlib>
+#include <cstdio>
+#include <cerrno>
+#include <cmath>
 
 
 namespace CEGUI
@@ -63,6 +70,376 @@ namespace
             "PropertyHelper::fromString could not parse the type " + typeName + " from the string: \"" + parsedstring +
             "\"");
     }
+
+    //! Returns whether the character is a whitespace in the "C" locale
+    bool isSpace(String::value_type c)
+    {
+        return c == ' ' || (c >= '\t' && c <= '\r');
+    }
+
+    //! Returns whether the character could continue a number or identifier
+    bool isWordCharacter(String::value_type c)
+    {
+        return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+            c == '.' || c == '_';
+    }
+
+    float convertFloatingPoint(const char* text, char** end, float)
+    {
+        return std::strtof(text, end);
+    }
+
+    double convertFloatingPoint(const char* text, char** end, double)
+    {
+        return std::strtod(text, end);
+    }
+
+    /*!
+    \brief
+        Parser for the property string formats that works directly on the String
+        instead of going through the shared stringstream.
+
+        The functions follow the rules of optionalChar, mandatoryChar and
+        MandatoryString. Numbers are only accepted in plain decimal notation;
+        anything unusual makes the parser fail, so that the caller can fall back
+        to the stream based parsing, which stays the reference for the accepted
+        formats and for the error handling.
+    */
+    class FastStringParser
+    {
+    public:
+        explicit FastStringParser(const String& str) :
+            d_string(str),
+            d_length(str.length()),
+            d_pos(0),
+            d_failed(false)
+        {}
+
+        bool succeeded() const { return !d_failed; }
+
+        FastStringParser& optionalChar(char c)
+        {
+            if (!d_failed)
+            {
+                skipWhitespace();
+                if (d_pos < d_length && d_string[d_pos] == static_cast<String::value_type>(c))
+                    ++d_pos;
+            }
+            return *this;
+        }
+
+        FastStringParser& mandatoryChar(char c)
+        {
+            if (!d_failed)
+            {
+                skipWhitespace();
+                if (d_pos < d_length && d_string[d_pos] == static_cast<String::value_type>(c))
+                    ++d_pos;
+                else
+                    d_failed = true;
+            }
+            return *this;
+        }
+
+        FastStringParser& mandatoryString(const char* chars)
+        {
+            for (; !d_failed && *chars != '\0'; ++chars)
+            {
+                if (*chars == ' ')
+                    skipWhitespace();
+                else if (d_pos < d_length && d_string[d_pos] == static_cast<String::value_type>(*chars))
+                    ++d_pos;
+                else
+                    d_failed = true;
+            }
+            return *this;
+        }
+
+        template<typename T>
+        FastStringParser& floatingPoint(T& value)
+        {
+            char buffer[MaxNumberLength + 1];
+            if (!readNumber(buffer, true))
+                return *this;
+
+            errno = 0;
+            char* end = nullptr;
+            const T result = convertFloatingPoint(buffer, &end, T());
+            if (errno == ERANGE || *end != '\0')
+                d_failed = true;
+            else
+                value = result;
+
+            return *this;
+        }
+
+        template<typename T>
+        FastStringParser& integer(T& value)
+        {
+            char buffer[MaxNumberLength + 1];
+            if (!readNumber(buffer, false))
+                return *this;
+
+            const bool negative = buffer[0] == '-';
+            const char* digit = (buffer[0] == '-' || buffer[0] == '+') ? buffer + 1 : buffer;
+
+            std::uint64_t magnitude = 0;
+            for (; *digit != '\0'; ++digit)
+            {
+                const std::uint64_t next = magnitude * 10 + static_cast<std::uint64_t>(*digit - '0');
+                if (magnitude > std::numeric_limits<std::uint64_t>::max() / 10 || next < magnitude)
+                {
+                    d_failed = true;
+                    return *this;
+                }
+                magnitude = next;
+            }
+
+            // Out of range values and negative unsigned ones are left to the stream
+            if (negative)
+            {
+                if (!std::numeric_limits<T>::is_signed ||
+                    magnitude > static_cast<std::uint64_t>(std::numeric_limits<T>::max()) + 1)
+                    d_failed = true;
+                else
+                    value = magnitude == 0 ? T(0) : static_cast<T>(-static_cast<std::int64_t>(magnitude - 1) - 1);
+            }
+            else if (magnitude > static_cast<std::uint64_t>(std::numeric_limits<T>::max()))
+                d_failed = true;
+            else
+                value = static_cast<T>(magnitude);
+
+            return *this;
+        }
+
+        FastStringParser& hexadecimal(argb_t& value)
+        {
+            if (d_failed)
+                return *this;
+
+            skipWhitespace();
+
+            argb_t result = 0;
+            size_t digitCount = 0;
+            for (; d_pos < d_length && digitCount <= 8; ++d_pos, ++digitCount)
+            {
+                const String::value_type c = d_string[d_pos];
+                if (c >= '0' && c <= '9')
+                    result = (result << 4) | static_cast<argb_t>(c - '0');
+                else if (c >= 'a' && c <= 'f')
+                    result = (result << 4) | static_cast<argb_t>(c - 'a' + 10);
+                else if (c >= 'A' && c <= 'F')
+                    result = (result << 4) | static_cast<argb_t>(c - 'A' + 10);
+                else
+                    break;
+            }
+
+            if (digitCount == 0 || digitCount > 8 || (d_pos < d_length && isWordCharacter(d_string[d_pos])))
+                d_failed = true;
+            else
+                value = result;
+
+            return *this;
+        }
+
+    private:
+        //! Longest number accepted, longer ones are left to the stream
+        static const size_t MaxNumberLength = 63;
+
+        void skipWhitespace()
+        {
+            while (d_pos < d_length && isSpace(d_string[d_pos]))
+                ++d_pos;
+        }
+
+        bool isDigitAt(size_t pos) const
+        {
+            return pos < d_length && d_string[pos] >= '0' && d_string[pos] <= '9';
+        }
+
+        //! Copies the next number into the buffer, failing on any unusual notation
+        bool readNumber(char* buffer, bool allowFraction)
+        {
+            if (d_failed)
+                return false;
+
+            skipWhitespace();
+            const size_t start = d_pos;
+            size_t pos = d_pos;
+
+            if (pos < d_length && (d_string[pos] == '-' || d_string[pos] == '+'))
+                ++pos;
+
+            size_t mantissaDigits = 0;
+            while (isDigitAt(pos))
+                ++pos, ++mantissaDigits;
+
+            if (allowFraction)
+            {
+                if (pos < d_length && d_string[pos] == '.')
+                {
+                    // The decimal point of strtod depends on the global C locale
+                    if (*std::localeconv()->decimal_point != '.')
+                        return d_failed = true, false;
+
+                    ++pos;
+                    while (isDigitAt(pos))
+                        ++pos, ++mantissaDigits;
+                }
+
+                if (mantissaDigits != 0 && pos < d_length && (d_string[pos] == 'e' || d_string[pos] == 'E'))
+                {
+                    ++pos;
+                    if (pos < d_length && (d_string[pos] == '-' || d_string[pos] == '+'))
+                        ++pos;
+                    if (!isDigitAt(pos))
+                        return d_failed = true, false;
+                    while (isDigitAt(pos))
+                        ++pos;
+                }
+            }
+
+            if (mantissaDigits == 0 || pos - start > MaxNumberLength ||
+                (pos < d_length && isWordCharacter(d_string[pos])))
+                return d_failed = true, false;
+
+            for (size_t i = start; i < pos; ++i)
+                buffer[i - start] = static_cast<char>(d_string[i]);
+            buffer[pos - start] = '\0';
+
+            d_pos = pos;
+            return true;
+        }
+
+        const String& d_string;
+        const size_t d_length;
+        size_t d_pos;
+        bool d_failed;
+    };
+
+    /*!
+    \brief
+        Writer for the property string formats that formats into a fixed buffer
+        instead of the shared stringstream. The output matches the one of the
+        stream operators, which write floating point values with a precision of 8.
+    */
+    class FastStringWriter
+    {
+    public:
+        FastStringWriter() :
+            d_length(0)
+        {}
+
+        FastStringWriter& operator<<(const char* text)
+        {
+            while (*text != '\0')
+                append(*text++);
+            return *this;
+        }
+
+        FastStringWriter& operator<<(float value)
+        {
+            return floatingPoint(value);
+        }
+
+        FastStringWriter& operator<<(double value)
+        {
+            return floatingPoint(value);
+        }
+
+        FastStringWriter& operator<<(const UDim& value)
+        {
+            return *this << "{" << value.d_scale << "," << value.d_offset << "}";
+        }
+
+        FastStringWriter& operator<<(const UVector2& value)
+        {
+            return *this << value.d_x << "," << value.d_y;
+        }
+
+        FastStringWriter& operator<<(const Colour& value)
+        {
+            static const char digits[] = "0123456789abcdef";
+            const argb_t argb = value.getARGB();
+            for (int shift = 28; shift >= 0; shift -= 4)
+                append(digits[(argb >> shift) & 0xF]);
+            return *this;
+        }
+
+        template<typename T>
+        FastStringWriter& integer(T value)
+        {
+            char digits[24];
+            size_t count = 0;
+
+            std::uint64_t magnitude = value < 0 ?
+                static_cast<std::uint64_t>(-(static_cast<std::int64_t>(value) + 1)) + 1 :
+                static_cast<std::uint64_t>(value);
+            do
+            {
+                digits[count++] = static_cast<char>('0' + magnitude % 10);
+                magnitude /= 10;
+            } while (magnitude != 0);
+
+            if (value < 0)
+                append('-');
+            while (count != 0)
+                append(digits[--count]);
+
+            return *this;
+        }
+
+        String toString() const
+        {
+            return String(d_buffer, d_length);
+        }
+
+    private:
+        //! Enough for the longest format, a UBox with eight floats in exponent notation
+        static const size_t Capacity = 256;
+
+        void append(char c)
+        {
+            assert(d_length < Capacity && "FastStringWriter buffer exceeded");
+            d_buffer[d_length++] = c;
+        }
+
+        FastStringWriter& floatingPoint(double value)
+        {
+            // Integral values, such as most offsets, are written without printf
+            if (value == std::floor(value) && std::abs(value) < 1e8 && !(value == 0.0 && std::signbit(value)))
+                return integer(static_cast<std::int64_t>(value));
+
+            const int written = std::snprintf(d_buffer + d_length, Capacity - d_length, "%.8g", value);
+            if (written <= 0)
+                return *this;
+
+            const size_t end = std::min(d_length + static_cast<size_t>(written), Capacity - 1);
+            // printf uses the decimal point of the global C locale, we always want '.'
+            const char decimalPoint = *std::localeconv()->decimal_point;
+            if (decimalPoint != '.')
+                std::replace(d_buffer + d_length, d_buffer + end, decimalPoint, '.');
+
+            d_length = end;
+            return *this;
+        }
+
+        char d_buffer[Capacity];
+        size_t d_length;
+    };
+
+    bool readUDim(FastStringParser& parser, UDim& val)
+    {
+        return parser.optionalChar('{').floatingPoint(val.d_scale).optionalChar(',')
+            .floatingPoint(val.d_offset).optionalChar('}').succeeded();
+    }
+
+    bool readUVector2(FastStringParser& parser, UVector2& val)
+    {
+        return parser.optionalChar('{').succeeded() && readUDim(parser, val.d_x) &&
+            parser.optionalChar(',').succeeded() && readUDim(parser, val.d_y) &&
+            parser.optionalChar('}').succeeded();
+    }
 }
 
 bool ParserHelper::IsEmptyOrContainingOnlyDecimalPointOrSign(const CEGUI::String& text)
@@ -270,6 +647,10 @@ PropertyHelper<float>::fromString(const String& str)
     }
     
     float val = 0.0f;
+    FastStringParser parser(str);
+    if (parser.floatingPoint(val).succeeded())
+        return val;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
 
     sstream >> val;
@@ -282,10 +663,10 @@ PropertyHelper<float>::fromString(const String& str)
 PropertyHelper<float>::string_return_type PropertyHelper<float>::toString(
     pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
+    FastStringWriter writer;
+    writer << val;
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<UDim>::getDataTypeName()
@@ -303,6 +684,10 @@ PropertyHelper<UDim>::fromString(const String& str)
     if (str.empty())
         return ud;
 
+    FastStringParser parser(str);
+    if (readUDim(parser, ud))
+        return ud;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
     sstream >> ud;
     if (sstream.fail())
@@ -314,10 +699,10 @@ PropertyHelper<UDim>::fromString(const String& str)
 PropertyHelper<UDim>::string_return_type PropertyHelper<UDim>::toString(
     PropertyHelper<UDim>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
+    FastStringWriter writer;
+    writer << val;
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<UVector2>::getDataTypeName()
@@ -335,6 +720,10 @@ PropertyHelper<UVector2>::fromString(const String& str)
     if (str.empty())
         return uv;
 
+    FastStringParser parser(str);
+    if (readUVector2(parser, uv))
+        return uv;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
     sstream >> uv;
     if (sstream.fail())
@@ -346,10 +735,10 @@ PropertyHelper<UVector2>::fromString(const String& str)
 PropertyHelper<UVector2>::string_return_type PropertyHelper<UVector2>::toString(
     PropertyHelper<UVector2>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
+    FastStringWriter writer;
+    writer << val;
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<UVector3>::getDataTypeName()
@@ -367,6 +756,13 @@ PropertyHelper<UVector3>::fromString(const String& str)
     if (str.empty())
         return uv;
 
+    FastStringParser parser(str);
+    if (parser.optionalChar('{').succeeded() && readUDim(parser, uv.d_x) &&
+        parser.optionalChar(',').succeeded() && readUDim(parser, uv.d_y) &&
+        parser.optionalChar(',').succeeded() && readUDim(parser, uv.d_z) &&
+        parser.optionalChar('}').succeeded())
+        return uv;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
     sstream >> uv;
     if (sstream.fail())
@@ -378,10 +774,10 @@ PropertyHelper<UVector3>::fromString(const String& str)
 PropertyHelper<UVector3>::string_return_type PropertyHelper<UVector3>::toString(
     PropertyHelper<UVector3>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
+    FastStringWriter writer;
+    writer << val.d_x << "," << val.d_y << "," << val.d_z;
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<USize>::getDataTypeName()
@@ -399,6 +795,12 @@ PropertyHelper<USize>::fromString(const String& str)
     if (str.empty())
         return uv;
 
+    FastStringParser parser(str);
+    if (parser.mandatoryChar('{').succeeded() && readUDim(parser, uv.d_width) &&
+        parser.optionalChar(',').succeeded() && readUDim(parser, uv.d_height) &&
+        parser.optionalChar('}').succeeded())
+        return uv;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
     sstream >> uv;
     if (sstream.fail())
@@ -410,10 +812,10 @@ PropertyHelper<USize>::fromString(const String& str)
 PropertyHelper<USize>::string_return_type PropertyHelper<USize>::toString(
     pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
+    FastStringWriter writer;
+    writer << "{" << val.d_width << "," << val.d_height << "}";
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<URect>::getDataTypeName()
@@ -431,6 +833,12 @@ PropertyHelper<URect>::fromString(const String& str)
     if (str.empty())
         return ur;
 
+    FastStringParser parser(str);
+    if (parser.optionalChar('{').succeeded() && readUVector2(parser, ur.d_min) &&
+        parser.optionalChar(',').succeeded() && readUVector2(parser, ur.d_max) &&
+        parser.optionalChar('}').succeeded())
+        return ur;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
     sstream >> ur;
     if (sstream.fail())
@@ -442,10 +850,10 @@ PropertyHelper<URect>::fromString(const String& str)
 PropertyHelper<URect>::string_return_type PropertyHelper<URect>::toString(
     PropertyHelper<URect>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
+    FastStringWriter writer;
+    writer << "{" << val.d_min << "," << val.d_max << "}";
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<UBox>::getDataTypeName()
@@ -463,6 +871,13 @@ PropertyHelper<UBox>::fromString(const String& str)
     if (str.empty())
         return ret;
 
+    FastStringParser parser(str);
+    if (parser.optionalChar('{').mandatoryString(" top : {").succeeded() && readUDim(parser, ret.d_top) &&
+        parser.mandatoryChar('}').optionalChar(',').mandatoryString(" left : {").succeeded() && readUDim(parser, ret.d_left) &&
+        parser.mandatoryChar('}').optionalChar(',').mandatoryString(" bottom : {").succeeded() && readUDim(parser, ret.d_bottom) &&
+        parser.mandatoryChar('}').optionalChar(',').mandatoryString(" right : {").succeeded() && readUDim(parser, ret.d_right))
+        return ret;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
     sstream >> ret;
     if (sstream.fail())
@@ -474,10 +889,13 @@ PropertyHelper<UBox>::fromString(const String& str)
 PropertyHelper<UBox>::string_return_type PropertyHelper<UBox>::toString(
     PropertyHelper<UBox>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
+    FastStringWriter writer;
+    writer << "{top:{" << val.d_top.d_scale << "," << val.d_top.d_offset << "},left:{" <<
+        val.d_left.d_scale << "," << val.d_left.d_offset << "},bottom:{" <<
+        val.d_bottom.d_scale << "," << val.d_bottom.d_offset << "},right:{" <<
+        val.d_right.d_scale << "," << val.d_right.d_offset << "}}";
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<ColourRect>::getDataTypeName()
@@ -495,6 +913,22 @@ PropertyHelper<ColourRect>::fromString(const String& str)
     if (str.empty())
          return val;
 
+    FastStringParser parser(str);
+    if (str.length() == 8)
+    {
+        argb_t argb = 0;
+        if (parser.hexadecimal(argb).succeeded())
+            return ColourRect(Colour(argb));
+    }
+    else
+    {
+        argb_t topLeft = 0, topRight = 0, bottomLeft = 0, bottomRight = 0;
+        if (parser.mandatoryString(" tl : ").hexadecimal(topLeft).mandatoryString(" tr : ").hexadecimal(topRight)
+            .mandatoryString(" bl : ").hexadecimal(bottomLeft).mandatoryString(" br : ").hexadecimal(bottomRight)
+            .succeeded())
+            return ColourRect(Colour(topLeft), Colour(topRight), Colour(bottomLeft), Colour(bottomRight));
+    }
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
 
     if (str.length() == 8)
@@ -522,14 +956,15 @@ PropertyHelper<ColourRect>::fromString(const String& str)
 PropertyHelper<ColourRect>::string_return_type PropertyHelper<ColourRect>::toString(
     PropertyHelper<ColourRect>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
+    FastStringWriter writer;
 
     if(val.isMonochromatic())
-        sstream << val.d_top_left;
+        writer << val.d_top_left;
     else
-        sstream << val;
+        writer << "tl:" << val.d_top_left << " tr:" << val.d_top_right <<
+            " bl:" << val.d_bottom_left << " br:" << val.d_bottom_right;
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<Colour>::getDataTypeName()
@@ -547,6 +982,11 @@ PropertyHelper<Colour>::fromString(const String& str)
     if (str.empty())
         return val;
 
+    FastStringParser parser(str);
+    argb_t argb = 0;
+    if (parser.hexadecimal(argb).succeeded())
+        return Colour(argb);
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
     sstream >> val;
     if (sstream.fail())
@@ -559,10 +999,10 @@ PropertyHelper<Colour>::fromString(const String& str)
 PropertyHelper<Colour>::string_return_type PropertyHelper<Colour>::toString(
     PropertyHelper<Colour>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
+    FastStringWriter writer;
+    writer << val;
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<Rectf>::getDataTypeName()
@@ -580,6 +1020,11 @@ PropertyHelper<Rectf>::fromString(const String& str)
     if (str.empty())
         return val;
 
+    FastStringParser parser(str);
+    if (parser.mandatoryString(" l :").floatingPoint(val.d_min.x).mandatoryString(" t :").floatingPoint(val.d_min.y)
+        .mandatoryString(" r :").floatingPoint(val.d_max.x).mandatoryString(" b :").floatingPoint(val.d_max.y).succeeded())
+        return val;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
     sstream >> val;
     if (sstream.fail())
@@ -591,10 +1036,10 @@ PropertyHelper<Rectf>::fromString(const String& str)
 PropertyHelper<Rectf>::string_return_type PropertyHelper<Rectf>::toString(
     PropertyHelper<Rectf>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
+    FastStringWriter writer;
+    writer << "l:" << val.d_min.x << " t:" << val.d_min.y << " r:" << val.d_max.x << " b:" << val.d_max.y;
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<Sizef>::getDataTypeName()
@@ -612,6 +1057,11 @@ PropertyHelper<Sizef>::fromString(const String& str)
     if (str.empty())
         return val;
 
+    FastStringParser parser(str);
+    if (parser.mandatoryString(" w :").floatingPoint(val.d_width)
+        .mandatoryString(" h :").floatingPoint(val.d_height).succeeded())
+        return val;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
     sstream >> val;
     if (sstream.fail())
@@ -623,10 +1073,10 @@ PropertyHelper<Sizef>::fromString(const String& str)
 PropertyHelper<Sizef>::string_return_type PropertyHelper<Sizef>::toString(
     PropertyHelper<Sizef>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
+    FastStringWriter writer;
+    writer << "w:" << val.d_width << " h:" << val.d_height;
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<double>::getDataTypeName()
@@ -645,6 +1095,10 @@ PropertyHelper<double>::fromString(const String& str)
     }
 
     double val;
+    FastStringParser parser(str);
+    if (parser.floatingPoint(val).succeeded())
+        return val;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
 
     sstream >> val;
@@ -658,10 +1112,10 @@ PropertyHelper<double>::fromString(const String& str)
 PropertyHelper<double>::string_return_type PropertyHelper<double>::toString(
     pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
+    FastStringWriter writer;
+    writer << val;
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 
@@ -681,6 +1135,10 @@ PropertyHelper<std::int16_t>::fromString(const String& str)
     }
     
     std::int16_t val = 0;
+    FastStringParser parser(str);
+    if (parser.integer(val).succeeded())
+        return val;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
 
     sstream >> val;
@@ -694,10 +1152,10 @@ PropertyHelper<std::int16_t>::fromString(const String& str)
 PropertyHelper<std::int16_t>::string_return_type PropertyHelper<std::int16_t>::toString(
     pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
+    FastStringWriter writer;
+    writer.integer(val);
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 
@@ -717,6 +1175,10 @@ PropertyHelper<std::int32_t>::fromString(const String& str)
     }
     
     std::int32_t val = 0;
+    FastStringParser parser(str);
+    if (parser.integer(val).succeeded())
+        return val;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
 
     sstream >> val;
@@ -730,10 +1192,10 @@ PropertyHelper<std::int32_t>::fromString(const String& str)
 PropertyHelper<std::int32_t>::string_return_type PropertyHelper<std::int32_t>::toString(
     PropertyHelper<std::int32_t>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
+    FastStringWriter writer;
+    writer.integer(val);
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<std::int64_t>::getDataTypeName()
@@ -752,6 +1214,10 @@ PropertyHelper<std::int64_t>::fromString(const String& str)
     }
     
     std::int64_t val = 0;
+    FastStringParser parser(str);
+    if (parser.integer(val).succeeded())
+        return val;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
 
     sstream >> val;
@@ -765,10 +1231,10 @@ PropertyHelper<std::int64_t>::fromString(const String& str)
 PropertyHelper<std::int64_t>::string_return_type PropertyHelper<std::int64_t>::toString(
     PropertyHelper<std::int64_t>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
+    FastStringWriter writer;
+    writer.integer(val);
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 
@@ -788,6 +1254,10 @@ PropertyHelper<std::uint32_t>::fromString(const String& str)
     }
     
     std::uint32_t val = 0;
+    FastStringParser parser(str);
+    if (parser.integer(val).succeeded())
+        return val;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
 
     sstream >> val;
@@ -801,10 +1271,10 @@ PropertyHelper<std::uint32_t>::fromString(const String& str)
 PropertyHelper<std::uint32_t>::string_return_type PropertyHelper<std::uint32_t>::toString(
     PropertyHelper<std::uint32_t>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
+    FastStringWriter writer;
+    writer.integer(val);
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<std::uint64_t>::getDataTypeName()
@@ -823,6 +1293,10 @@ PropertyHelper<std::uint64_t>::fromString(const String& str)
     }
     
     std::uint64_t val = 0;
+    FastStringParser parser(str);
+    if (parser.integer(val).succeeded())
+        return val;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
 
     sstream >> val;
@@ -836,10 +1310,10 @@ PropertyHelper<std::uint64_t>::fromString(const String& str)
 PropertyHelper<std::uint64_t>::string_return_type PropertyHelper<std::uint64_t>::toString(
     PropertyHelper<std::uint64_t>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
+    FastStringWriter writer;
+    writer.integer(val);
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<glm::vec2>::getDataTypeName()
@@ -857,6 +1331,11 @@ PropertyHelper<glm::vec2>::fromString(const String& str)
     if (str.empty())
         return val;
 
+    FastStringParser parser(str);
+    if (parser.mandatoryString(" x :").floatingPoint(val.x)
+        .mandatoryString(" y :").floatingPoint(val.y).succeeded())
+        return val;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
     sstream >> MandatoryString(" x :") >> val.x >> MandatoryString(" y :") >> val.y;
     if (sstream.fail())
@@ -868,10 +1347,10 @@ PropertyHelper<glm::vec2>::fromString(const String& str)
 PropertyHelper<glm::vec2>::string_return_type PropertyHelper<glm::vec2>::toString(
     PropertyHelper<glm::vec2>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << "x:" << val.x << " y:" << val.y;
+    FastStringWriter writer;
+    writer << "x:" << val.x << " y:" << val.y;
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<glm::vec3>::getDataTypeName()
@@ -889,6 +1368,11 @@ PropertyHelper<glm::vec3>::fromString(const String& str)
     if (str.empty())
         return val;
 
+    FastStringParser parser(str);
+    if (parser.mandatoryString(" x :").floatingPoint(val.x).mandatoryString(" y :").floatingPoint(val.y)
+        .mandatoryString(" z :").floatingPoint(val.z).succeeded())
+        return val;
+
     std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
     sstream >> MandatoryString(" x :") >> val.x >> MandatoryString(" y :") >> val.y >> MandatoryString(" z :") >> val.z;
     if (sstream.fail())
@@ -900,10 +1384,10 @@ PropertyHelper<glm::vec3>::fromString(const String& str)
 PropertyHelper<glm::vec3>::string_return_type PropertyHelper<glm::vec3>::toString(
     PropertyHelper<glm::vec3>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << "x:" << val.x << " y:" << val.y << " z:" << val.z;
+    FastStringWriter writer;
+    writer << "x:" << val.x << " y:" << val.y << " z:" << val.z;
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<glm::quat>::getDataTypeName()
@@ -928,6 +1412,11 @@ PropertyHelper<glm::quat>::fromString(const String& str)
              str.getString().find(String("W").c_str(), 0) != std::string::npos)
 #endif
     {
+        FastStringParser parser(str);
+        if (parser.mandatoryString(" w :").floatingPoint(val.w).mandatoryString(" x :").floatingPoint(val.x)
+            .mandatoryString(" y :").floatingPoint(val.y).mandatoryString(" z :").floatingPoint(val.z).succeeded())
+            return val;
+
         std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
         sstream >> MandatoryString(" w :") >> val.w >> MandatoryString(" x :") >> val.x >> MandatoryString(" y :") >> val.y >> MandatoryString(" z :") >> val.z;
         if (sstream.fail())
@@ -938,10 +1427,15 @@ PropertyHelper<glm::quat>::fromString(const String& str)
     {
         float x, y, z;
         // CEGUI takes degrees because it's easier to work with
-        std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-        sstream >> MandatoryString(" x :") >> x >> MandatoryString(" y :") >> y >> MandatoryString(" z :") >> z;
-        if (sstream.fail())
-            throwParsingException(getDataTypeName(), str);
+        FastStringParser parser(str);
+        if (!parser.mandatoryString(" x :").floatingPoint(x).mandatoryString(" y :").floatingPoint(y)
+            .mandatoryString(" z :").floatingPoint(z).succeeded())
+        {
+            std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
+            sstream >> MandatoryString(" x :") >> x >> MandatoryString(" y :") >> y >> MandatoryString(" z :") >> z;
+            if (sstream.fail())
+                throwParsingException(getDataTypeName(), str);
+        }
 
         // glm::radians converts from degrees to radians
         // Angles are negated to be consistent with pre-GLM rotation directions
@@ -952,10 +1446,10 @@ PropertyHelper<glm::quat>::fromString(const String& str)
 PropertyHelper<glm::quat>::string_return_type PropertyHelper<glm::quat>::toString(
     pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << "w:" << val.w << " x:" << val.x << " y:" << val.y << " z:" << val.z;
+    FastStringWriter writer;
+    writer << "w:" << val.w << " x:" << val.x << " y:" << val.y << " z:" << val.z;
 
-    return String(sstream.str());
+    return writer.toString();
 }
 
 const String& PropertyHelper<String>::getDataTypeName()
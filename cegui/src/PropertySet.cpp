@@ -29,6 +29,8 @@
 #include "CEGUI/PropertySet.h"
 #include "CEGUI/Exceptions.h"
 
+#include <vector>
+
 namespace CEGUI
 {
 
@@ -42,11 +44,14 @@ void PropertySet::addProperty(Property* property)
 		throw NullObjectException("The given Property object pointer is invalid.");
 	}
 
-	if (!d_properties.insert(std::make_pair(property->getName(), property)).second)
+	PropertyTable* table = d_propertyTable->getExtendedTable(property);
+	if (!table)
 	{
 		throw AlreadyExistsException("A Property named '" + property->getName() + "' already exists in the PropertySet.");
 	}
 
+	d_propertyTable = table;
+
     property->initialisePropertyReceiver(this);
 }
 
@@ -55,11 +60,11 @@ void PropertySet::addProperty(Property* property)
 *************************************************************************/
 void PropertySet::removeProperty(const String& name)
 {
-	PropertyRegistry::iterator pos = d_properties.find(name);
+	PropertyTable* table = d_propertyTable->getReducedTable(InternedName::find(name));
 
-	if (pos != d_properties.end())
+	if (table)
 	{
-		d_properties.erase(pos);
+		d_propertyTable = table;
 	}
 }
 
@@ -68,9 +73,10 @@ void PropertySet::removeProperty(const String& name)
 *************************************************************************/
 Property* PropertySet::getPropertyInstance(const String& name) const
 {
-    PropertyRegistry::const_iterator pos = d_properties.find(name);
+    const PropertyRegistry& properties = d_propertyTable->getRegistry();
+    PropertyRegistry::const_iterator pos = properties.find(InternedName::find(name));
 
-    if (pos == d_properties.end())
+    if (pos == properties.end())
     {
         throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
     }
@@ -78,12 +84,26 @@ Property* PropertySet::getPropertyInstance(const String& name) const
     return pos->second;
 }
 
+//----------------------------------------------------------------------------//
+Property* PropertySet::getPropertyInstance(const InternedName& name) const
+{
+    const PropertyRegistry& properties = d_propertyTable->getRegistry();
+    PropertyRegistry::const_iterator pos = properties.find(name);
+
+    if (pos == properties.end())
+    {
+        throw UnknownObjectException("There is no Property named '" + name.getString() + "' available in the set.");
+    }
+
+    return pos->second;
+}
+
 /*************************************************************************
 	Remove all properties from the set
 *************************************************************************/
 void PropertySet::clearProperties(void)
 {
-	d_properties.clear();
+	d_propertyTable = &PropertyTable::getEmptyTable();
 }
 
 /*************************************************************************
@@ -91,7 +111,13 @@ void PropertySet::clearProperties(void)
 *************************************************************************/
 bool PropertySet::isPropertyPresent(const String& name) const
 {
-	return (d_properties.find(name) != d_properties.end());
+	return d_propertyTable->contains(InternedName::find(name));
+}
+
+//----------------------------------------------------------------------------//
+bool PropertySet::isPropertyPresent(const InternedName& name) const
+{
+	return d_propertyTable->contains(name);
 }
 
 /*************************************************************************
@@ -99,14 +125,7 @@ bool PropertySet::isPropertyPresent(const String& name) const
 *************************************************************************/
 const String& PropertySet::getPropertyHelp(const String& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
-
-	if (pos == d_properties.end())
-	{
-		throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
-	}
-
-	return pos->second->getHelp();
+	return getPropertyInstance(name)->getHelp();
 }
 
 /*************************************************************************
@@ -114,14 +133,13 @@ const String& PropertySet::getPropertyHelp(const String& name) const
 *************************************************************************/
 String PropertySet::getProperty(const String& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
-
-	if (pos == d_properties.end())
-	{
-		throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
-	}
+	return getPropertyInstance(name)->get(this);
+}
 
-	return pos->second->get(this);
+//----------------------------------------------------------------------------//
+String PropertySet::getProperty(const InternedName& name) const
+{
+	return getPropertyInstance(name)->get(this);
 }
 
 /*************************************************************************
@@ -129,14 +147,20 @@ String PropertySet::getProperty(const String& name) const
 *************************************************************************/
 void PropertySet::setProperty(const String& name,const String& value)
 {
-	PropertyRegistry::iterator pos = d_properties.find(name);
+	getPropertyInstance(name)->set(this, value);
+}
 
-	if (pos == d_properties.end())
-	{
-		throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
-	}
+//----------------------------------------------------------------------------//
+void PropertySet::setProperty(const InternedName& name, const String& value)
+{
+	getPropertyInstance(name)->set(this, value);
+}
 
-	pos->second->set(this, value);
+//----------------------------------------------------------------------------//
+void PropertySet::setProperties(const PropertyValueList& values)
+{
+    for (const auto& value : values)
+        getPropertyInstance(value.first)->set(this, value.second);
 }
 
 
@@ -146,7 +170,8 @@ void PropertySet::setProperty(const String& name,const String& value)
 *************************************************************************/
 PropertySet::PropertyIterator PropertySet::getPropertyIterator(void) const
 {
-	return PropertyIterator(d_properties.begin(), d_properties.end());
+	const PropertyRegistry& properties = d_propertyTable->getRegistry();
+	return PropertyIterator(properties.begin(), properties.end());
 }
 
 
@@ -155,14 +180,7 @@ PropertySet::PropertyIterator PropertySet::getPropertyIterator(void) const
 *************************************************************************/
 bool PropertySet::isPropertyDefault(const String& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
-
-	if (pos == d_properties.end())
-	{
-		throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
-	}
-
-	return pos->second->isDefault(this);
+	return getPropertyInstance(name)->isDefault(this);
 }
 
 
@@ -171,14 +189,102 @@ bool PropertySet::isPropertyDefault(const String& name) const
 *************************************************************************/
 String PropertySet::getPropertyDefault(const String& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
+	return getPropertyInstance(name)->getDefault(this);
+}
 
-	if (pos == d_properties.end())
-	{
-		throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
-	}
+//----------------------------------------------------------------------------//
+PropertySet::PropertyTable::PropertyTable() :
+    d_parent(nullptr),
+    d_property(nullptr),
+    d_registryValid(true),
+    d_lastExtended(nullptr)
+{
+}
+
+//----------------------------------------------------------------------------//
+PropertySet::PropertyTable::PropertyTable(PropertyTable* parent, Property* property) :
+    d_parent(parent),
+    d_property(property),
+    d_propertyName(property->getInternedName()),
+    d_registryValid(false),
+    d_lastExtended(nullptr)
+{
+}
+
+//----------------------------------------------------------------------------//
+PropertySet::PropertyTable& PropertySet::PropertyTable::getEmptyTable()
+{
+    static PropertyTable emptyTable;
+    return emptyTable;
+}
+
+//----------------------------------------------------------------------------//
+PropertySet::PropertyTable* PropertySet::PropertyTable::getExtendedTable(Property* property)
+{
+    // The name is part of the key, so a Property created where a destroyed one
+    // used to live never gets a table that was made for the old one.
+    const std::pair<Property*, InternedName> key(property, property->getInternedName());
+    if (d_lastExtended && d_lastExtended->d_property == key.first &&
+        d_lastExtended->d_propertyName == key.second)
+        return d_lastExtended;
+
+    TableMap::iterator table = d_extendedTables.find(key);
+    if (table != d_extendedTables.end())
+    {
+        d_lastExtended = table->second.get();
+        return d_lastExtended;
+    }
+
+    // walk the tables instead of building a registry for each of them
+    for (const PropertyTable* owner = this; owner->d_parent; owner = owner->d_parent)
+        if (owner->d_propertyName == key.second)
+            return nullptr;
+
+    std::unique_ptr<PropertyTable>& extended = d_extendedTables[key];
+    extended.reset(new PropertyTable(this, property));
+    d_lastExtended = extended.get();
+    return d_lastExtended;
+}
+
+//----------------------------------------------------------------------------//
+PropertySet::PropertyTable* PropertySet::PropertyTable::getReducedTable(const InternedName& name)
+{
+    // collect the tables adding the Properties added after the one to remove
+    std::vector<PropertyTable*> laterTables;
+    PropertyTable* table = this;
+    for (; table->d_parent && table->d_propertyName != name; table = table->d_parent)
+        laterTables.push_back(table);
+
+    if (!table->d_parent)
+        return nullptr;
+
+    // and add those Properties again to the table without the removed one
+    PropertyTable* reduced = table->d_parent;
+    for (std::vector<PropertyTable*>::reverse_iterator later = laterTables.rbegin();
+         later != laterTables.rend(); ++later)
+        reduced = reduced->getExtendedTable((*later)->d_property);
+
+    return reduced;
+}
+
+//----------------------------------------------------------------------------//
+bool PropertySet::PropertyTable::contains(const InternedName& name)
+{
+    const PropertyRegistry& registry = getRegistry();
+    return registry.find(name) != registry.end();
+}
+
+//----------------------------------------------------------------------------//
+void PropertySet::PropertyTable::buildRegistry()
+{
+    if (d_parent->d_registryValid)
+        d_registry = d_parent->d_registry;
+    else
+        for (const PropertyTable* owner = d_parent; owner->d_parent; owner = owner->d_parent)
+            d_registry.insert(std::make_pair(owner->d_propertyName, owner->d_property));
 
-	return pos->second->getDefault(this);
+    d_registry.insert(std::make_pair(d_propertyName, d_property));
+    d_registryValid = true;
 }
 
 } // End of  CEGUI namespace section
@@ -30,6 +30,7 @@
 #include "CEGUI/Quaternion.h"
 #include "CEGUI/String.h"
 #include "CEGUI/PropertyHelper.h"
+#include "CEGUI/TplInterpolators.h"
 #include "CEGUI/Exceptions.h"
 #include <limits>
 
@@ -82,6 +83,42 @@ String QuaternionSlerpInterpolator::interpolateRelativeMultiply(
     return Helper::toString(glm::quat(1, 0, 0, 0));
 }
 
+//----------------------------------------------------------------------------//
+InterpolatorValue* QuaternionSlerpInterpolator::createValue(
+                                            const String& value) const
+{
+    return new TplInterpolatorValue<glm::quat>(value);
+}
+
+//----------------------------------------------------------------------------//
+void QuaternionSlerpInterpolator::applyAbsolute(PropertyReceiver* target,
+                                    Property* property,
+                                    const InterpolatorValue& value1,
+                                    const InterpolatorValue& value2,
+                                    float position)
+{
+    typedef TplInterpolatorValue<glm::quat> Value;
+
+    PropertyHandle<glm::quat>(target, property).set(glm::slerp(
+        static_cast<const Value&>(value1).d_value,
+        static_cast<const Value&>(value2).d_value, position));
+}
+
+//----------------------------------------------------------------------------//
+void QuaternionSlerpInterpolator::applyRelative(PropertyReceiver* target,
+                                    Property* property,
+                                    const String& base,
+                                    const InterpolatorValue& value1,
+                                    const InterpolatorValue& value2,
+                                    float position)
+{
+    typedef TplInterpolatorValue<glm::quat> Value;
+
+    PropertyHandle<glm::quat>(target, property).set(Helper::fromString(base) *
+        glm::slerp(static_cast<const Value&>(value1).d_value,
+                   static_cast<const Value&>(value2).d_value, position));
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
@@ -26,30 +26,198 @@
  ***************************************************************************/
 #include "CEGUI/RenderQueue.h"
 #include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Profiler.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
 #include <algorithm>
+#include <iterator>
+#include <limits>
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+namespace
+{
+//! Number of earlier buffers a buffer may be moved past when reordering.
+const std::size_t MaxReorderDistance = 64;
+//! Number of opaque areas a buffer is tested against when culling.
+const std::size_t MaxOccluders = 16;
+
+//! Returns whether the drawn areas \a a and \a b share any pixels.
+inline bool areasOverlap(const Rectf& a, const Rectf& b)
+{
+    return a.d_min.x < b.d_max.x && b.d_min.x < a.d_max.x &&
+           a.d_min.y < b.d_max.y && b.d_min.y < a.d_max.y;
+}
+}
+
 //----------------------------------------------------------------------------//
 void RenderQueue::draw(std::uint32_t drawModeMask) const
 {
-    // draw the buffers
-    BufferList::const_iterator i = d_buffers.begin();
-    for ( ; i != d_buffers.end(); ++i)
-        (*i)->draw(drawModeMask);
+    CEGUI_PROFILE_SCOPE("RenderQueue::draw");
+
+    if (System* system = System::getSingletonPtr())
+    {
+        Renderer* const renderer = system->getRenderer();
+        renderer->getCurrentFrameStats().d_geometryBuffersQueued += d_buffers.size();
+
+        // evicted textures are loaded again before they are drawn
+        TextureResidencyManager& residency = renderer->getTextureResidencyManager();
+        if (residency.isTrackingUsage())
+            residency.markUsed(d_buffers);
+    }
+
+    // draw the buffers, merging runs of neighbouring buffers that the renderer
+    // reports as compatible into a single batch. The order is kept intact.
+    const BufferList& buffers = getDrawOrder();
+    BufferList::const_iterator i = buffers.begin();
+    while (i != buffers.end())
+    {
+        BufferList::const_iterator last = i;
+        BufferList::const_iterator next = i + 1;
+        std::size_t vertex_count = (*i)->getVertexCount();
+
+        while (next != buffers.end() && (*last)->isBatchableWith(**next))
+        {
+            vertex_count += (*next)->getVertexCount();
+            last = next++;
+        }
+
+        if (last == i)
+            (*i)->draw(drawModeMask);
+        else
+            (*i)->drawBatch(std::distance(i, next), vertex_count, drawModeMask);
+
+        i = next;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::setReorderingEnabled(bool enabled)
+{
+    d_reorderingEnabled = enabled;
+
+    if (!enabled)
+        d_drawOrderValid = false;
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::setOcclusionCullingEnabled(bool enabled)
+{
+    d_occlusionCullingEnabled = enabled;
+
+    if (!enabled)
+        d_drawOrderValid = false;
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::updateDrawOrder()
+{
+    d_drawOrderValid = false;
+
+    if (!d_reorderingEnabled && !d_occlusionCullingEnabled)
+        return;
+
+    CEGUI_PROFILE_SCOPE("RenderQueue::updateDrawOrder");
+
+    if (!d_reorderingEnabled)
+    {
+        d_drawOrder = d_buffers;
+        cullOccludedBuffers();
+        d_drawOrderValid = true;
+        return;
+    }
+
+    // an unknown area overlaps every buffer that draws anything
+    const float maxFloat = std::numeric_limits<float>::max();
+    const Rectf unknownArea(-maxFloat, -maxFloat, maxFloat, maxFloat);
+
+    d_drawOrder.clear();
+    d_drawOrderAreas.clear();
+    for (GeometryBuffer* buffer : d_buffers)
+    {
+        Rectf area;
+        const bool areaKnown = buffer->getDrawnArea(area);
+        if (!areaKnown)
+            area = unknownArea;
+
+        // look for the closest earlier buffer sharing our material, stopping
+        // at the first one we overlap, which we must stay behind
+        std::size_t position = d_drawOrder.size();
+        if (areaKnown)
+        {
+            const std::size_t end = d_drawOrder.size() > MaxReorderDistance ?
+                d_drawOrder.size() - MaxReorderDistance : 0;
+            for (std::size_t i = d_drawOrder.size(); i > end; --i)
+            {
+                if (areasOverlap(area, d_drawOrderAreas[i - 1]))
+                    break;
+
+                if (d_drawOrder[i - 1]->isMergeableWith(*buffer))
+                {
+                    position = i;
+                    break;
+                }
+            }
+        }
+
+        d_drawOrder.insert(d_drawOrder.begin() + position, buffer);
+        d_drawOrderAreas.insert(d_drawOrderAreas.begin() + position, area);
+    }
+
+    if (d_occlusionCullingEnabled)
+        cullOccludedBuffers();
+
+    d_drawOrderValid = true;
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::cullOccludedBuffers()
+{
+    // walk from the front to the back, collecting the opaque areas of the
+    // buffers drawn later and dropping the buffers lying within one of them
+    d_occluders.clear();
+    std::size_t kept = d_drawOrder.size();
+    for (std::size_t i = d_drawOrder.size(); i > 0; --i)
+    {
+        GeometryBuffer* const buffer = d_drawOrder[i - 1];
+
+        Rectf area;
+        if (!d_occluders.empty() && buffer->getDrawnArea(area) &&
+            area.getWidth() > 0.0f && area.getHeight() > 0.0f)
+        {
+            const auto occluder = std::find_if(d_occluders.begin(), d_occluders.end(),
+                [&area](const Rectf& opaque)
+                {
+                    return area.d_min.x >= opaque.d_min.x && area.d_min.y >= opaque.d_min.y &&
+                           area.d_max.x <= opaque.d_max.x && area.d_max.y <= opaque.d_max.y;
+                });
+
+            if (occluder != d_occluders.end())
+                continue;
+        }
+
+        if (d_occluders.size() < MaxOccluders && buffer->getOpaqueArea(area))
+            d_occluders.push_back(area);
+
+        d_drawOrder[--kept] = buffer;
+    }
+
+    d_drawOrder.erase(d_drawOrder.begin(), d_drawOrder.begin() + kept);
 }
 
 //----------------------------------------------------------------------------//
 void RenderQueue::addGeometryBuffers(const std::vector<GeometryBuffer*>& geometry_buffers)
 {
     d_buffers.insert(d_buffers.end(), geometry_buffers.begin(), geometry_buffers.end());
+    d_drawOrderValid = false;
 }
 
 //----------------------------------------------------------------------------//
 void RenderQueue::addGeometryBuffer(GeometryBuffer& geometry_buffer)
 {
     d_buffers.push_back(&geometry_buffer);
+    d_drawOrderValid = false;
 }
 
 //----------------------------------------------------------------------------//
@@ -58,13 +226,17 @@ void RenderQueue::removeGeometryBuffer(const GeometryBuffer& geometry_buffer)
     BufferList::iterator i = std::find(d_buffers.begin(), d_buffers.end(),
                                        &geometry_buffer);
     if (i != d_buffers.end())
+    {
         d_buffers.erase(i);
+        d_drawOrderValid = false;
+    }
 }
 
 //----------------------------------------------------------------------------//
 void RenderQueue::reset()
 {
     d_buffers.clear();
+    d_drawOrderValid = false;
 }
 
 //----------------------------------------------------------------------------//
@@ -28,6 +28,7 @@
 #include "CEGUI/Renderer.h"
 #include "CEGUI/GeometryBuffer.h"
 #include "CEGUI/RenderQueue.h"
+#include "CEGUI/System.h"
 
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/glm.hpp>
@@ -37,9 +38,42 @@
     #include <glm/gtc/constants.hpp>
 #endif
 #include <glm/gtc/type_ptr.hpp>
+#include <cmath>
 
 namespace CEGUI
 {
+namespace
+{
+//----------------------------------------------------------------------------//
+// Same as glm::unProject, but using an already inverted matrix.
+glm::vec3 unprojectWithInverse(const glm::vec3& win, const glm::mat4& inverse,
+                               const glm::vec4& viewport)
+{
+    glm::vec4 tmp((win.x - viewport[0]) / viewport[2],
+                  (win.y - viewport[1]) / viewport[3],
+                  win.z, 1.0f);
+    tmp = tmp * 2.0f - 1.0f;
+
+    const glm::vec4 obj(inverse * tmp);
+    return glm::vec3(obj) / obj.w;
+}
+
+//----------------------------------------------------------------------------//
+// Same as glm::project, but using an already combined matrix.
+glm::vec3 projectWithMatrix(const glm::vec3& obj, const glm::mat4& matrix,
+                            const glm::vec4& viewport)
+{
+    glm::vec4 tmp(matrix * glm::vec4(obj, 1.0f));
+    tmp /= tmp.w;
+    tmp = tmp * 0.5f + 0.5f;
+
+    return glm::vec3(tmp.x * viewport[2] + viewport[0],
+                     tmp.y * viewport[3] + viewport[1],
+                     tmp.z);
+}
+
+}
+
 //----------------------------------------------------------------------------//
 
 const String RenderTarget::EventNamespace("RenderTarget");
@@ -52,7 +86,8 @@ RenderTarget::RenderTarget():
     d_matrixValid(false),
     d_matrix(1.0f),
     d_viewDistance(0),
-    d_fovY(glm::radians(30.0f))
+    d_fovY(glm::radians(30.0f)),
+    d_renderScale(1.0f)
 {
     // Call the setter function to ensure that the half-angle tangens value is set correctly
     setFovY(d_fovY);
@@ -84,6 +119,14 @@ void RenderTarget::deactivate()
 void RenderTarget::draw(const GeometryBuffer& buffer,
     std::uint32_t drawModeMask)
 {
+    if (System* system = System::getSingletonPtr())
+    {
+        TextureResidencyManager& residency =
+            system->getRenderer()->getTextureResidencyManager();
+        if (residency.isTrackingUsage())
+            residency.markUsed(buffer);
+    }
+
     buffer.draw(drawModeMask);
 }
 
@@ -119,8 +162,9 @@ const Rectf& RenderTarget::getArea() const
 //----------------------------------------------------------------------------//
 glm::mat4 RenderTarget::createViewProjMatrixForOpenGL() const
 {
-    const float w = d_area.getWidth();
-    const float h = d_area.getHeight();
+    // the projection covers the area in geometry coordinates
+    const float w = d_area.getWidth() / d_renderScale;
+    const float h = d_area.getHeight() / d_renderScale;
 
     // We need to check if width or height are zero and act accordingly to prevent running into issues
     // with divisions by zero which would lead to undefined values, as well as faulty clipping planes
@@ -155,8 +199,9 @@ glm::mat4 RenderTarget::createViewProjMatrixForOpenGL() const
 //----------------------------------------------------------------------------//
 glm::mat4 RenderTarget::createViewProjMatrixForDirect3D() const
 {
-    const float w = d_area.getWidth();
-    const float h = d_area.getHeight();
+    // the projection covers the area in geometry coordinates
+    const float w = d_area.getWidth() / d_renderScale;
+    const float h = d_area.getHeight() / d_renderScale;
 
     // We need to check if width or height are zero and act accordingly to prevent running into issues
     // with divisions by zero which would lead to undefined values, as well as faulty clipping planes
@@ -208,6 +253,50 @@ void RenderTarget::updateMatrix(const glm::mat4& matrix) const
     d_activationCounter = -1;
 }
 
+//----------------------------------------------------------------------------//
+void RenderTarget::unprojectPointOnBuffer(const GeometryBuffer& buff,
+    const glm::vec2& p_in, glm::vec2& p_out) const
+{
+    const glm::vec4 viewport(
+        static_cast<float>(static_cast<int>(d_area.left())),
+        static_cast<float>(static_cast<int>(d_area.top())),
+        static_cast<float>(static_cast<int>(d_area.getWidth() / d_renderScale)),
+        static_cast<float>(static_cast<int>(d_area.getHeight() / d_renderScale)));
+
+    const glm::mat4& matrix = buff.getModelViewProjMatrix(d_matrix);
+    const glm::mat4& inverse = buff.getInverseModelViewProjMatrix(d_matrix);
+
+    // unproject the ends of the ray
+    const glm::vec3 unprojected1(unprojectWithInverse(
+        glm::vec3(viewport[2] * 0.5f, viewport[3] * 0.5f, -d_viewDistance),
+        inverse, viewport));
+    const glm::vec3 unprojected2(unprojectWithInverse(
+        glm::vec3(p_in.x, viewport[3] - p_in.y, 0.0f), inverse, viewport));
+
+    // project points to orientate them with GeometryBuffer plane
+    const glm::vec3 projected1(projectWithMatrix(glm::vec3(0.0f, 0.0f, 0.0f), matrix, viewport));
+    const glm::vec3 projected2(projectWithMatrix(glm::vec3(1.0f, 0.0f, 0.0f), matrix, viewport));
+    const glm::vec3 projected3(projectWithMatrix(glm::vec3(0.0f, 1.0f, 0.0f), matrix, viewport));
+
+    // calculate vectors for generating the plane
+    const glm::vec3 pv1 = projected2 - projected1;
+    const glm::vec3 pv2 = projected3 - projected1;
+    // given the vectors, calculate the plane normal
+    const glm::vec3 planeNormal = glm::cross(pv1, pv2);
+    // calculate plane
+    const glm::vec3 planeNormalNormalized = glm::normalize(planeNormal);
+    const double pl_d = - glm::dot(projected1, planeNormalNormalized);
+    // calculate vector of picking ray
+    const glm::vec3 rv = unprojected1 - unprojected2;
+    // calculate intersection of ray and plane
+    const double pn_dot_r1 = glm::dot(unprojected1, planeNormal);
+    const double pn_dot_rv = glm::dot(rv, planeNormal);
+    const double tmp1 = pn_dot_rv != 0.0 ? (pn_dot_r1 + pl_d) / pn_dot_rv : 0.0;
+
+    p_out.x = static_cast<float>(unprojected1.x - rv.x * tmp1);
+    p_out.y = static_cast<float>(unprojected1.y - rv.y * tmp1);
+}
+
 //----------------------------------------------------------------------------//
 float RenderTarget::getFovY() const
 {
@@ -222,4 +311,26 @@ void RenderTarget::setFovY(const float fovY)
     d_fovY_halftan = std::tan(fovY * 0.5f);
 }
 
+//----------------------------------------------------------------------------//
+void RenderTarget::setRenderScale(float scale)
+{
+    if (scale == d_renderScale)
+        return;
+
+    d_renderScale = scale;
+    d_matrixValid = false;
+}
+
+//----------------------------------------------------------------------------//
+Rectf RenderTarget::getPixelRegion(const Rectf& region) const
+{
+    if (d_renderScale == 1.0f)
+        return region;
+
+    return Rectf(std::floor(region.left() * d_renderScale),
+                 std::floor(region.top() * d_renderScale),
+                 std::ceil(region.right() * d_renderScale),
+                 std::ceil(region.bottom() * d_renderScale));
+}
+
 }
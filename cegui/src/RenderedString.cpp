@@ -138,17 +138,22 @@ bool RenderedString::split(const Window* ref_wnd, const size_t line,
             d_lines.erase(lb, le);
         }
 
-        // find the component where the requested split point lies.
+        // find the component where the requested split point lies, measuring
+        // each component only up to the split point.
         float partial_extent = 0;
 
         size_t idx = 0;
         const size_t last_component = d_lines[0].second;
         for (; idx < last_component; ++idx)
         {
-            partial_extent += d_components[idx]->getPixelSize(ref_wnd).d_width;
+            const float remaining = split_point - partial_extent;
+            const float comp_width =
+                d_components[idx]->getPixelWidthUpTo(ref_wnd, remaining);
 
-            if (split_point <= partial_extent)
+            if (remaining <= comp_width)
                 break;
+
+            partial_extent += comp_width;
         }
 
         // case where split point is past the end
@@ -199,7 +204,7 @@ bool RenderedString::split(const Window* ref_wnd, const size_t line,
             {
                 RenderedStringComponent* lc = 
                     c->split(ref_wnd,
-                             split_point - (partial_extent - c->getPixelSize(ref_wnd).d_width),
+                             split_point - partial_extent,
                              idx == 0,
                              was_word_split);
 
@@ -270,6 +275,23 @@ Sizef RenderedString::getPixelSize(const Window* ref_wnd,
     return sz;
 }
 
+//----------------------------------------------------------------------------//
+float RenderedString::getPixelWidthUpTo(const Window* ref_wnd,
+                                        const size_t line, float limit) const
+{
+    if (line >= getLineCount())
+        throw InvalidRequestException(
+            "line number specified is invalid.");
+
+    float width = 0;
+
+    const size_t end_component = d_lines[line].first + d_lines[line].second;
+    for (size_t i = d_lines[line].first; i < end_component && width <= limit; ++i)
+        width += d_components[i]->getPixelWidthUpTo(ref_wnd, limit - width);
+
+    return width;
+}
+
 //----------------------------------------------------------------------------//
 size_t RenderedString::getSpaceCount(const size_t line) const
 {
@@ -40,6 +40,13 @@ RenderedStringComponent* RenderedStringComponent::split(
     return split(ref_wnd, split_point, first_component, was_word_split);
 }
 
+//----------------------------------------------------------------------------//
+float RenderedStringComponent::getPixelWidthUpTo(const Window* ref_wnd,
+                                                 float /*limit*/) const
+{
+    return getPixelSize(ref_wnd).d_width;
+}
+
 //----------------------------------------------------------------------------//
 RenderedStringComponent::RenderedStringComponent() :
     d_padding(0, 0, 0, 0),
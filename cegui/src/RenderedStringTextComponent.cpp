@@ -257,6 +257,42 @@ Sizef RenderedStringTextComponent::getPixelSize(const Window* ref_wnd) const
     return psz;
 }
 
+//----------------------------------------------------------------------------//
+float RenderedStringTextComponent::getPixelWidthUpTo(const Window* ref_wnd,
+                                                     float limit) const
+{
+    const Font* fnt = getEffectiveFont(ref_wnd);
+
+    const float padding = d_padding.d_min.x + d_padding.d_max.x;
+    if (!fnt)
+        return padding;
+
+    // measure the text token by token, the same way split() does, so that a
+    // long text is only measured up to the limit.
+    float width = padding;
+    for (size_t pos = 0; pos < d_text.length(); )
+    {
+        const size_t token_len = getNextTokenLength(d_text, pos);
+        if (token_len == 0)
+            break;
+
+        width += fnt->getTextExtent(d_text.substr(pos, token_len));
+        pos += token_len;
+
+        // the sum of the token extents may differ slightly from the extent of
+        // the text, so confirm with the exact extent of the measured part.
+        if (width > limit)
+        {
+            width = padding + fnt->getTextExtent(d_text.substr(0, pos));
+            if (width > limit)
+                return width;
+        }
+    }
+
+    // the text fits, so return its exact extent
+    return padding + fnt->getTextExtent(d_text);
+}
+
 //----------------------------------------------------------------------------//
 bool RenderedStringTextComponent::canSplit() const
 {
@@ -348,7 +384,7 @@ RenderedStringTextComponent* RenderedStringTextComponent::split(
             setSelection(ref_wnd, 0, 0);
     }
 
-    d_text = d_text.substr(rhs_start);
+    d_text.erase(0, rhs_start);
 
     return lhs;
 }
@@ -26,31 +26,78 @@
  ***************************************************************************/
 #include "CEGUI/Renderer.h"
 #include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/GeometryBufferPool.h"
 #include "CEGUI/FontManager.h"
+#include "CEGUI/Font.h"
+#include "CEGUI/Exceptions.h"
 
 namespace CEGUI
 {
+namespace
+{
+//! Pool recycled GeometryBuffers are taken from on this thread, if any.
+thread_local GeometryBufferPool* s_activeGeometryBufferPool = nullptr;
+}
 
 Renderer::Renderer(const float fontScale):
     d_activeRenderTarget(nullptr),
-    d_fontScale(fontScale)
+    d_fontScale(fontScale),
+    d_textureTargetPool(*this),
+    d_textureResidencyManager(*this)
 {}
 
 //----------------------------------------------------------------------------//
 void Renderer::addGeometryBuffer(GeometryBuffer& buffer) 
 {
+    std::lock_guard<std::mutex> lock(d_geometryBuffersMutex);
     d_geometryBuffers.insert(&buffer);
 }
 
 //----------------------------------------------------------------------------//
 void Renderer::destroyGeometryBuffer(GeometryBuffer& buffer)
 {
-    auto findIter = d_geometryBuffers.find(&buffer);
-    if (findIter != d_geometryBuffers.end())
     {
+        std::lock_guard<std::mutex> lock(d_geometryBuffersMutex);
+        auto findIter = d_geometryBuffers.find(&buffer);
+        if (findIter == d_geometryBuffers.end())
+            return;
+
         d_geometryBuffers.erase(findIter);
-        delete &buffer;
+
+        if (d_geometryBufferDestructionDeferred)
+            d_deferredGeometryBufferDestructions.push_back(&buffer);
     }
+
+    if (s_activeGeometryBufferPool)
+        s_activeGeometryBufferPool->notifyDestroyed(buffer);
+
+    if (!d_geometryBufferDestructionDeferred)
+        delete &buffer;
+}
+
+//----------------------------------------------------------------------------//
+void Renderer::setGeometryBufferDestructionDeferred(bool deferred)
+{
+    d_geometryBufferDestructionDeferred = deferred;
+    if (deferred)
+        return;
+
+    for (GeometryBuffer* buffer : d_deferredGeometryBufferDestructions)
+        delete buffer;
+
+    d_deferredGeometryBufferDestructions.clear();
+}
+
+//----------------------------------------------------------------------------//
+void Renderer::setActiveGeometryBufferPool(GeometryBufferPool* pool)
+{
+    s_activeGeometryBufferPool = pool;
+}
+
+//----------------------------------------------------------------------------//
+GeometryBufferPool* Renderer::getActiveGeometryBufferPool() const
+{
+    return s_activeGeometryBufferPool;
 }
 
 //----------------------------------------------------------------------------//
@@ -61,19 +108,31 @@ void Renderer::destroyAllGeometryBuffers()
 }
 
 //----------------------------------------------------------------------------//
-GeometryBuffer& Renderer::createGeometryBufferTextured()
+GeometryBuffer& Renderer::createGeometryBufferTextured(DefaultShaderType shaderType)
 {
-    GeometryBuffer& geometry_buffer = createGeometryBufferTextured(createRenderMaterial(DefaultShaderType::Textured));
+    if (!s_activeGeometryBufferPool)
+        return createGeometryBufferTextured(createRenderMaterial(shaderType));
+
+    GeometryBuffer* geometry_buffer = s_activeGeometryBufferPool->acquire(shaderType);
+    if (!geometry_buffer)
+        geometry_buffer = &createGeometryBufferTextured(createRenderMaterial(shaderType));
 
-    return geometry_buffer;
+    s_activeGeometryBufferPool->notifyIssued(*geometry_buffer, shaderType);
+    return *geometry_buffer;
 }
 
 //----------------------------------------------------------------------------//
 GeometryBuffer& Renderer::createGeometryBufferColoured()
 {
-    GeometryBuffer& geometry_buffer = createGeometryBufferColoured(createRenderMaterial(DefaultShaderType::Solid));
+    if (!s_activeGeometryBufferPool)
+        return createGeometryBufferColoured(createRenderMaterial(DefaultShaderType::Solid));
 
-    return geometry_buffer;
+    GeometryBuffer* geometry_buffer = s_activeGeometryBufferPool->acquire(DefaultShaderType::Solid);
+    if (!geometry_buffer)
+        geometry_buffer = &createGeometryBufferColoured(createRenderMaterial(DefaultShaderType::Solid));
+
+    s_activeGeometryBufferPool->notifyIssued(*geometry_buffer, DefaultShaderType::Solid);
+    return *geometry_buffer;
 }
 
 //----------------------------------------------------------------------------//
@@ -110,11 +169,34 @@ const glm::mat4& Renderer::getViewProjectionMatrix() const
 
 void Renderer::setFontScale(const float fontScale)
 {
+    if (d_fontScale == fontScale)
+        return;
+
     d_fontScale = fontScale;
 
-    FontManager::getSingleton().updateAllFonts();
+    for (const auto& font : FontManager::getSingleton().getRegisteredFonts())
+        font.second->updateFontScale();
+}
+
+//----------------------------------------------------------------------------//
+void Renderer::setPremultipliedAlphaEnabled(bool enabled)
+{
+    if (enabled && !isPremultipliedAlphaSupported())
+        throw InvalidRequestException(
+            "This Renderer does not support rendering with premultiplied alpha.");
+
+    d_premultipliedAlphaEnabled = enabled;
 }
 
+//----------------------------------------------------------------------------//
+void Renderer::finishFrameStats()
+{
+    d_frameStats = d_currentFrameStats;
+    d_currentFrameStats.reset();
+}
+
+//----------------------------------------------------------------------------//
+
 void Renderer::updateGeometryBufferTexCoords(const Texture* texture, const float scaleFactor)
 {
     for(auto& curGeomBuffer : d_geometryBuffers)
@@ -29,6 +29,7 @@
 #include "CEGUI/RendererModules/Direct3D11/ShaderWrapper.h"
 #include "CEGUI/ShaderParameterBindings.h"
 #include "CEGUI/RenderMaterial.h"
+#include "CEGUI/RenderTarget.h"
 #include "CEGUI/RenderEffect.h"
 #include "CEGUI/Vertex.h"
 #include "CEGUI/Exceptions.h"
@@ -45,9 +46,6 @@ Direct3D11GeometryBuffer::Direct3D11GeometryBuffer(Direct3D11Renderer& owner, CE
     : GeometryBuffer(renderMaterial)
     , d_owner(owner)
     , d_device(d_owner.getDirect3DDevice())
-    , d_deviceContext(d_owner.getDirect3DDeviceContext())
-    , d_vertexBuffer(0)
-    , d_bufferSize(0)
     , d_inputLayout(0)
 {
 }
@@ -55,8 +53,6 @@ Direct3D11GeometryBuffer::Direct3D11GeometryBuffer(Direct3D11Renderer& owner, CE
 //----------------------------------------------------------------------------//
 Direct3D11GeometryBuffer::~Direct3D11GeometryBuffer()
 {
-    cleanupVertexBuffer();
-
     if (d_inputLayout)
         d_inputLayout->Release();
 }
@@ -73,17 +69,19 @@ void Direct3D11GeometryBuffer::draw(std::uint32_t drawModeMask) const
     if (d_clippingActive)
     {
         // Skip completely clipped geometry
-        const LONG w = static_cast<LONG>(d_preparedClippingRegion.getWidth());
-        const LONG h = static_cast<LONG>(d_preparedClippingRegion.getHeight());
+        const Rectf clipRegion(d_owner.getActiveRenderTarget()->getPixelRegion(
+            getPreparedClippingRegion()));
+        const LONG w = static_cast<LONG>(clipRegion.getWidth());
+        const LONG h = static_cast<LONG>(clipRegion.getHeight());
         if (!w || !h)
             return;
 
         D3D11_RECT clip;
-        clip.left = static_cast<LONG>(d_preparedClippingRegion.left());
-        clip.top = static_cast<LONG>(d_preparedClippingRegion.top());
-        clip.right = static_cast<LONG>(d_preparedClippingRegion.right());
-        clip.bottom = static_cast<LONG>(d_preparedClippingRegion.bottom());
-        d_deviceContext->RSSetScissorRects(1, &clip);
+        clip.left = static_cast<LONG>(clipRegion.left());
+        clip.top = static_cast<LONG>(clipRegion.top());
+        clip.right = static_cast<LONG>(clipRegion.right());
+        clip.bottom = static_cast<LONG>(clipRegion.bottom());
+        d_owner.getRenderingDeviceContext()->RSSetScissorRects(1, &clip);
     }
 
     // Update the model view projection matrix
@@ -94,13 +92,23 @@ void Direct3D11GeometryBuffer::draw(std::uint32_t drawModeMask) const
     // Set the uniform variables for this GeometryBuffer in the Shader
     shaderParameterBindings->setParameter("modelViewProjMatrix", d_matrix);
     shaderParameterBindings->setParameter("alphaPercentage", d_alpha);
+    if (isClippingMaskSupported())
+    {
+        shaderParameterBindings->setParameter("clipMask", getClippingMaskMatrix());
+        if (d_clippingMaskType == ClippingMaskType::Texture)
+            shaderParameterBindings->setParameter("clipMaskTexture", d_clippingMaskTexture);
+        else
+            shaderParameterBindings->removeParameter("clipMaskTexture");
+    }
+    if (d_owner.isLayeredGlyphShaderWrapper(d_renderMaterial->getShaderWrapper()))
+        shaderParameterBindings->setParameter("layerColours", d_layerColours);
 
-    // set our buffer as the vertex source.
+    // stream our vertices to the shared ring buffer and use it as the source.
     const UINT stride = getVertexAttributeElementCount() * sizeof(float);
-    const UINT offset = 0;
-    d_deviceContext->IASetVertexBuffers(0, 1, &d_vertexBuffer, &stride, &offset);
+    d_owner.bindVertexData(d_vertexData.data(),
+        static_cast<UINT>(d_vertexData.size() * sizeof(float)), stride);
     //Update the input layout
-    d_deviceContext->IASetInputLayout(d_inputLayout);
+    d_owner.getRenderingDeviceContext()->IASetInputLayout(d_inputLayout);
 
     d_owner.bindBlendMode(d_blendMode);
     d_owner.bindRasterizerState(d_clippingActive);
@@ -127,11 +135,15 @@ void Direct3D11GeometryBuffer::draw(std::uint32_t drawModeMask) const
 }
 
 //----------------------------------------------------------------------------//
-void Direct3D11GeometryBuffer::appendGeometry(const float* vertex_data, std::size_t array_size)
+bool Direct3D11GeometryBuffer::isQuadIndexingSupported() const
 {
-    GeometryBuffer::appendGeometry(vertex_data, array_size);
+    return true;
+}
 
-    updateVertexBuffer();
+//----------------------------------------------------------------------------//
+bool Direct3D11GeometryBuffer::isClippingMaskSupported() const
+{
+    return d_owner.isStandardShaderWrapper(d_renderMaterial->getShaderWrapper());
 }
 
 //----------------------------------------------------------------------------//
@@ -147,76 +159,22 @@ void Direct3D11GeometryBuffer::updateMatrix() const
 }
 
 //----------------------------------------------------------------------------//
-void Direct3D11GeometryBuffer::updateVertexBuffer() const
-{
-    bool needNewBuffer = false;
-    size_t vertexCount = d_vertexData.size();
-    UINT dataSize = vertexCount * sizeof(float);
-
-    if(d_bufferSize < dataSize)
-    {
-        needNewBuffer = true;
-        d_bufferSize = dataSize;
-    }
-
-    const float* vertexData;
-    if(d_vertexData.empty())
-        vertexData = 0;
-    else
-        vertexData = &d_vertexData[0];
-
-
-    if(needNewBuffer)
-    {
-        cleanupVertexBuffer();
-        allocateVertexBuffer(dataSize);
-    }
-
-    D3D11_BOX box;
-    box.left  = 0; //We copy everything
-    box.right = dataSize; //Number of bytes to copy
-    box.top  = 0;
-    box.bottom = 1;
-    box.front = 0;
-    box.back  = 1;
-
-    d_deviceContext->UpdateSubresource( d_vertexBuffer, 0, &box, vertexData, 0, 0 );
-}
-
-//----------------------------------------------------------------------------//
-void Direct3D11GeometryBuffer::allocateVertexBuffer(const UINT dataSize) const
-{
-    D3D11_BUFFER_DESC buffer_desc;
-    buffer_desc.Usage          = D3D11_USAGE_DEFAULT;
-    buffer_desc.ByteWidth      = dataSize;
-    buffer_desc.BindFlags      = D3D11_BIND_VERTEX_BUFFER;
-    buffer_desc.CPUAccessFlags = 0;
-    buffer_desc.MiscFlags      = 0;
-
-    if (FAILED(d_device->CreateBuffer(&buffer_desc, 0, &d_vertexBuffer)))
-        throw RendererException("failed to allocate vertex buffer.");
-}
-
-//----------------------------------------------------------------------------//
-void Direct3D11GeometryBuffer::cleanupVertexBuffer() const
+void Direct3D11GeometryBuffer::drawDependingOnFillRule() const
 {
-    if (d_vertexBuffer)
+    if (isUsingQuadIndices())
     {
-        d_vertexBuffer->Release();
-        d_vertexBuffer = 0;
-        d_bufferSize = 0;
+        const std::size_t quad_count = d_vertexCount / 4;
+        d_owner.bindQuadIndexBuffer(quad_count);
+        d_owner.getRenderingDeviceContext()->DrawIndexed(static_cast<UINT>(quad_count * 6), 0, 0);
+        return;
     }
-}
 
-//----------------------------------------------------------------------------//
-void Direct3D11GeometryBuffer::drawDependingOnFillRule() const
-{
     //TODO IDENT
 /*    if(d_polygonFillRule == PolygonFillRule::NoFilling)
     {
     */
 
-        d_deviceContext->Draw(d_vertexCount, 0);
+        d_owner.getRenderingDeviceContext()->Draw(d_vertexCount, 0);
             /* 
     }
     else if(d_polygonFillRule == PolygonFillRule::EvenOdd)
@@ -37,8 +37,7 @@ namespace CEGUI
 
 Direct3D11RenderTarget::Direct3D11RenderTarget(Direct3D11Renderer& owner) :
     d_owner(owner),
-    d_device(*d_owner.getDirect3DDevice()),
-    d_deviceContext(*d_owner.getDirect3DDeviceContext())
+    d_device(*d_owner.getDirect3DDevice())
 {
 }
 
@@ -49,7 +48,7 @@ void Direct3D11RenderTarget::activate()
 
     D3D11_VIEWPORT vp;
     setupViewport(vp);
-    d_deviceContext.RSSetViewports(1, &vp);
+    d_owner.getRenderingDeviceContext()->RSSetViewports(1, &vp);
 
     d_owner.setViewProjectionMatrix(RenderTarget::d_matrix);
 
@@ -59,71 +58,10 @@ void Direct3D11RenderTarget::activate()
 void Direct3D11RenderTarget::unprojectPoint(const GeometryBuffer& buff,
     const glm::vec2& p_in, glm::vec2& p_out) const
 {
-    if (!d_matrixValid)
-        updateMatrix();
-    
-    const Direct3D11GeometryBuffer& gb =
-        static_cast<const Direct3D11GeometryBuffer&>(buff);
-
-    const int vp[4] = {
-        static_cast<int>(d_area.left()),
-        static_cast<int>(d_area.top()),
-        static_cast<int>(d_area.getWidth()),
-        static_cast<int>(d_area.getHeight())
-    };
-
-    double in_x, in_y, in_z;
-
-    glm::ivec4 viewPort = glm::ivec4(vp[0], vp[1], vp[2], vp[3]);
-    const glm::mat4& projMatrix = RenderTarget::d_matrix;
-    const glm::mat4& modelMatrix = gb.getModelMatrix();
-
-    // unproject the ends of the ray
-    glm::vec3 unprojected1;
-    glm::vec3 unprojected2;
-    in_x = vp[2] * 0.5;
-    in_y = vp[3] * 0.5;
-    in_z = -d_viewDistance;
-    unprojected1 =  glm::unProject(glm::vec3(in_x, in_y, in_z), modelMatrix, projMatrix, viewPort);
-    in_x = p_in.x;
-    in_y = vp[3] - p_in.y;
-    in_z = 0.0;
-    unprojected2 = glm::unProject(glm::vec3(in_x, in_y, in_z), modelMatrix, projMatrix, viewPort);
-
-    // project points to orientate them with GeometryBuffer plane
-    glm::vec3 projected1;
-    glm::vec3 projected2;
-    glm::vec3 projected3;
-    in_x = 0.0;
-    in_y = 0.0;
-    projected1 = glm::project(glm::vec3(in_x, in_y, in_z), modelMatrix, projMatrix, viewPort);
-    in_x = 1.0;
-    in_y = 0.0;
-    projected2 = glm::project(glm::vec3(in_x, in_y, in_z), modelMatrix, projMatrix, viewPort);
-    in_x = 0.0;
-    in_y = 1.0;
-    projected3 = glm::project(glm::vec3(in_x, in_y, in_z), modelMatrix, projMatrix, viewPort);
-
-    // calculate vectors for generating the plane
-    const glm::vec3 pv1 = projected2 - projected1;
-    const glm::vec3 pv2 = projected3 - projected1;
-    // given the vectors, calculate the plane normal
-    const glm::vec3 planeNormal = glm::cross(pv1, pv2);
-    // calculate plane
-    const glm::vec3 planeNormalNormalized = glm::normalize(planeNormal);
-    const double pl_d = - glm::dot(projected1, planeNormalNormalized);
-    // calculate vector of picking ray
-    const glm::vec3 rv = unprojected1 - unprojected2;
-    // calculate intersection of ray and plane
-    const double pn_dot_r1 = glm::dot(unprojected1, planeNormal);
-    const double pn_dot_rv = glm::dot(rv, planeNormal);
-    const double tmp1 = pn_dot_rv != 0.0 ? (pn_dot_r1 + pl_d) / pn_dot_rv : 0.0;
-    const double is_x = unprojected1.x - rv.x * tmp1;
-    const double is_y = unprojected1.y - rv.y * tmp1;
-
-    p_out.x = static_cast<float>(is_x);
-    p_out.y = static_cast<float>(is_y);
+    CEGUI_UNUSED(buff);
 
+    // points are not unprojected through rotations of the geometry, so skip
+    // the matrix work whose result used to be overwritten here
     p_out = p_in; // CrazyEddie wanted this
 }
 
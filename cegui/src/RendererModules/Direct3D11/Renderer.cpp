@@ -39,10 +39,15 @@
 #include "Shaders.inl"
 
 #include <algorithm>
+#include <cstring>
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+//! Size in bytes the vertex ring buffer is created with.
+static const UINT VertexRingBufferInitialSize = 1024 * 1024;
+
 //----------------------------------------------------------------------------//
 const String Direct3D11Renderer::d_rendererID(
 "CEGUI::Direct3D11Renderer - Official Direct3D 11 based 3rd generation renderer module.");
@@ -53,8 +58,11 @@ Direct3D11Renderer::Direct3D11Renderer(ID3D11Device* device,
                                        ID3D11DeviceContext*deviceContext)
     : d_shaderWrapperTextured(nullptr)
     , d_shaderWrapperSolid(nullptr)
+    , d_shaderWrapperDistanceField(nullptr)
+    , d_shaderWrapperLayeredGlyph(nullptr)
     , d_device(device)
     , d_deviceContext(deviceContext)
+    , d_renderingContext(deviceContext)
     , d_blendStateNormal(nullptr)
     , d_blendStatePreMultiplied(nullptr)
     , d_currentBlendState(nullptr)
@@ -64,6 +72,11 @@ Direct3D11Renderer::Direct3D11Renderer(ID3D11Device* device,
     , d_depthStencilStateDefault(nullptr)
     , d_defaultTarget(nullptr)
     , d_samplerState(nullptr)
+    , d_quadIndexBuffer(nullptr)
+    , d_quadIndexBufferQuadCount(0)
+    , d_vertexRingBuffer(nullptr)
+    , d_vertexRingBufferSize(0)
+    , d_vertexRingBufferOffset(0)
 {
  
 	if(!device || !deviceContext) 
@@ -95,6 +108,8 @@ Direct3D11Renderer::~Direct3D11Renderer()
 
     delete d_shaderWrapperTextured;
     delete d_shaderWrapperSolid;
+    delete d_shaderWrapperDistanceField;
+    delete d_shaderWrapperLayeredGlyph;
 
     if (d_blendStateNormal)
        d_blendStateNormal->Release();
@@ -108,6 +123,10 @@ Direct3D11Renderer::~Direct3D11Renderer()
         d_depthStencilStateDefault->Release();
     if (d_samplerState)
         d_samplerState->Release();
+    if (d_quadIndexBuffer)
+        d_quadIndexBuffer->Release();
+    if (d_vertexRingBuffer)
+        d_vertexRingBuffer->Release();
 }
 
 //----------------------------------------------------------------------------//
@@ -193,6 +212,8 @@ void Direct3D11Renderer::destroyTextureTarget(TextureTarget* target)
 //----------------------------------------------------------------------------//
 void Direct3D11Renderer::destroyAllTextureTargets()
 {
+    getTextureTargetPool().forgetAll();
+
     while (!d_textureTargets.empty())
         destroyTextureTarget(*d_textureTargets.begin());
 }
@@ -314,9 +335,13 @@ void Direct3D11Renderer::beginRendering()
     d_currentBlendState = 0;
     d_currentRasterizerState = 0;
 
-    d_deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-    d_deviceContext->OMSetDepthStencilState(d_depthStencilStateDefault, 0);
-    d_deviceContext->PSSetSamplers(0, 1, &d_samplerState);
+    // the first write of a frame discards the ring buffer, which a deferred
+    // context requires before writing without overwriting
+    d_vertexRingBufferOffset = d_vertexRingBufferSize;
+
+    d_renderingContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    d_renderingContext->OMSetDepthStencilState(d_depthStencilStateDefault, 0);
+    d_renderingContext->PSSetSamplers(0, 1, &d_samplerState);
 }
 
 //----------------------------------------------------------------------------//
@@ -439,6 +464,18 @@ RefCounted<RenderMaterial> Direct3D11Renderer::createRenderMaterial(const Defaul
 
         return render_material;
     }
+    else if(shaderType == DefaultShaderType::DistanceField)
+    {
+        RefCounted<RenderMaterial> render_material(new RenderMaterial(d_shaderWrapperDistanceField));
+
+        return render_material;
+    }
+    else if(shaderType == DefaultShaderType::LayeredGlyph)
+    {
+        RefCounted<RenderMaterial> render_material(new RenderMaterial(d_shaderWrapperLayeredGlyph));
+
+        return render_material;
+    }
     else
     {
         throw RendererException("A default shader of this type does not exist.");
@@ -447,6 +484,14 @@ RefCounted<RenderMaterial> Direct3D11Renderer::createRenderMaterial(const Defaul
     }
 }
 
+//----------------------------------------------------------------------------//
+bool Direct3D11Renderer::isDefaultShaderTypeSupported(const DefaultShaderType shaderType) const
+{
+    return shaderType == DefaultShaderType::DistanceField ||
+           shaderType == DefaultShaderType::LayeredGlyph ||
+           Renderer::isDefaultShaderTypeSupported(shaderType);
+}
+
 //----------------------------------------------------------------------------//
 void Direct3D11Renderer::initialiseStandardTexturedShaderWrapper()
 {
@@ -458,6 +503,8 @@ void Direct3D11Renderer::initialiseStandardTexturedShaderWrapper()
     d_shaderWrapperTextured->addUniformVariable("modelViewProjMatrix", ShaderType::VERTEX, ShaderParamType::Matrix4X4);
     d_shaderWrapperTextured->addUniformVariable("alphaPercentage", ShaderType::PIXEL, 
         ShaderParamType::Float);
+    d_shaderWrapperTextured->addUniformVariable("clipMask", ShaderType::PIXEL, ShaderParamType::Matrix4X4);
+    d_shaderWrapperTextured->addUniformVariable("clipMaskTexture", ShaderType::PIXEL, ShaderParamType::Texture);
 }
 
 //----------------------------------------------------------------------------//
@@ -469,6 +516,39 @@ void Direct3D11Renderer::initialiseStandardColouredShaderWrapper()
     d_shaderWrapperSolid->addUniformVariable("modelViewProjMatrix", ShaderType::VERTEX, ShaderParamType::Matrix4X4);
     d_shaderWrapperSolid->addUniformVariable("alphaPercentage", ShaderType::PIXEL, 
         ShaderParamType::Float);
+    d_shaderWrapperSolid->addUniformVariable("clipMask", ShaderType::PIXEL, ShaderParamType::Matrix4X4);
+    d_shaderWrapperSolid->addUniformVariable("clipMaskTexture", ShaderType::PIXEL, ShaderParamType::Texture);
+}
+
+//----------------------------------------------------------------------------//
+void Direct3D11Renderer::initialiseDistanceFieldShaderWrapper()
+{
+    Direct3D11ShaderPtr shader_distance_field(new Direct3D11Shader(*this, VertexShaderTextured, PixelShaderDistanceField));
+    d_shaderWrapperDistanceField = new Direct3D11ShaderWrapper(std::move(shader_distance_field), this);
+
+    d_shaderWrapperDistanceField->addUniformVariable("texture0", ShaderType::PIXEL, ShaderParamType::Texture);
+
+    d_shaderWrapperDistanceField->addUniformVariable("modelViewProjMatrix", ShaderType::VERTEX, ShaderParamType::Matrix4X4);
+    d_shaderWrapperDistanceField->addUniformVariable("alphaPercentage", ShaderType::PIXEL, 
+        ShaderParamType::Float);
+    d_shaderWrapperDistanceField->addUniformVariable("clipMask", ShaderType::PIXEL, ShaderParamType::Matrix4X4);
+    d_shaderWrapperDistanceField->addUniformVariable("clipMaskTexture", ShaderType::PIXEL, ShaderParamType::Texture);
+}
+
+//----------------------------------------------------------------------------//
+void Direct3D11Renderer::initialiseLayeredGlyphShaderWrapper()
+{
+    Direct3D11ShaderPtr shader_layered_glyph(new Direct3D11Shader(*this, VertexShaderTextured, PixelShaderLayeredGlyph));
+    d_shaderWrapperLayeredGlyph = new Direct3D11ShaderWrapper(std::move(shader_layered_glyph), this);
+
+    d_shaderWrapperLayeredGlyph->addUniformVariable("texture0", ShaderType::PIXEL, ShaderParamType::Texture);
+
+    d_shaderWrapperLayeredGlyph->addUniformVariable("modelViewProjMatrix", ShaderType::VERTEX, ShaderParamType::Matrix4X4);
+    d_shaderWrapperLayeredGlyph->addUniformVariable("alphaPercentage", ShaderType::PIXEL, 
+        ShaderParamType::Float);
+    d_shaderWrapperLayeredGlyph->addUniformVariable("layerColours", ShaderType::PIXEL, ShaderParamType::Matrix4X4);
+    d_shaderWrapperLayeredGlyph->addUniformVariable("clipMask", ShaderType::PIXEL, ShaderParamType::Matrix4X4);
+    d_shaderWrapperLayeredGlyph->addUniformVariable("clipMaskTexture", ShaderType::PIXEL, ShaderParamType::Texture);
 }
 
 //----------------------------------------------------------------------------//
@@ -476,6 +556,8 @@ void Direct3D11Renderer::initialiseShaders()
 {
     initialiseStandardColouredShaderWrapper();
     initialiseStandardTexturedShaderWrapper();
+    initialiseDistanceFieldShaderWrapper();
+    initialiseLayeredGlyphShaderWrapper();
 }
 
 //----------------------------------------------------------------------------//
@@ -548,7 +630,7 @@ void Direct3D11Renderer::bindBlendMode(BlendMode d_blendMode)
     {
         if (d_currentBlendState != d_blendStateNormal)
         {
-            d_deviceContext->OMSetBlendState(d_blendStateNormal, blendFactor, 0xFFFFFFFF);
+            d_renderingContext->OMSetBlendState(d_blendStateNormal, blendFactor, 0xFFFFFFFF);
             d_currentBlendState = d_blendStateNormal;
         }
     }
@@ -557,12 +639,131 @@ void Direct3D11Renderer::bindBlendMode(BlendMode d_blendMode)
     {
         if (d_currentBlendState != d_blendStatePreMultiplied)
         {
-            d_deviceContext->OMSetBlendState(d_blendStatePreMultiplied, blendFactor, 0xFFFFFFFF);
+            d_renderingContext->OMSetBlendState(d_blendStatePreMultiplied, blendFactor, 0xFFFFFFFF);
             d_currentBlendState = d_blendStatePreMultiplied;
         }
     }
 }
 
+//----------------------------------------------------------------------------//
+void Direct3D11Renderer::bindQuadIndexBuffer(std::size_t quad_count)
+{
+    if (quad_count > d_quadIndexBufferQuadCount)
+    {
+        // the indices never change, so the buffer is immutable and only grows
+        if (d_quadIndexBuffer)
+        {
+            d_quadIndexBuffer->Release();
+            d_quadIndexBuffer = nullptr;
+            d_quadIndexBufferQuadCount = 0;
+        }
+
+        const std::size_t new_quad_count = std::max(quad_count, d_quadIndexBufferQuadCount * 2);
+        std::vector<std::uint32_t> indices;
+        GeometryBuffer::appendQuadIndices(indices, new_quad_count);
+
+        D3D11_BUFFER_DESC buffer_desc;
+        buffer_desc.Usage          = D3D11_USAGE_IMMUTABLE;
+        buffer_desc.ByteWidth      = static_cast<UINT>(indices.size() * sizeof(std::uint32_t));
+        buffer_desc.BindFlags      = D3D11_BIND_INDEX_BUFFER;
+        buffer_desc.CPUAccessFlags = 0;
+        buffer_desc.MiscFlags      = 0;
+        buffer_desc.StructureByteStride = 0;
+
+        D3D11_SUBRESOURCE_DATA index_data;
+        index_data.pSysMem          = &indices[0];
+        index_data.SysMemPitch      = 0;
+        index_data.SysMemSlicePitch = 0;
+
+        if (FAILED(d_device->CreateBuffer(&buffer_desc, &index_data, &d_quadIndexBuffer)))
+            throw RendererException("failed to allocate quad index buffer.");
+
+        d_quadIndexBufferQuadCount = new_quad_count;
+    }
+
+    d_renderingContext->IASetIndexBuffer(d_quadIndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+}
+
+//----------------------------------------------------------------------------//
+void Direct3D11Renderer::bindVertexData(const float* vertex_data, UINT data_size, UINT stride)
+{
+    if (data_size > d_vertexRingBufferSize)
+    {
+        if (d_vertexRingBuffer)
+        {
+            d_vertexRingBuffer->Release();
+            d_vertexRingBuffer = nullptr;
+            d_vertexRingBufferSize = 0;
+        }
+
+        const UINT new_size = std::max(std::max(data_size, d_vertexRingBufferSize * 2),
+                                       VertexRingBufferInitialSize);
+
+        D3D11_BUFFER_DESC buffer_desc;
+        buffer_desc.Usage          = D3D11_USAGE_DYNAMIC;
+        buffer_desc.ByteWidth      = new_size;
+        buffer_desc.BindFlags      = D3D11_BIND_VERTEX_BUFFER;
+        buffer_desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        buffer_desc.MiscFlags      = 0;
+        buffer_desc.StructureByteStride = 0;
+
+        if (FAILED(d_device->CreateBuffer(&buffer_desc, 0, &d_vertexRingBuffer)))
+            throw RendererException("failed to allocate vertex ring buffer.");
+
+        d_vertexRingBufferSize = new_size;
+        d_vertexRingBufferOffset = new_size;
+    }
+
+    // keep the vertices of a draw together, wrapping around once the rest of
+    // the buffer is too small; the GPU may still read the previous contents,
+    // so the wrap discards them
+    D3D11_MAP map_type = D3D11_MAP_WRITE_NO_OVERWRITE;
+    if (d_vertexRingBufferSize - d_vertexRingBufferOffset < data_size)
+    {
+        map_type = D3D11_MAP_WRITE_DISCARD;
+        d_vertexRingBufferOffset = 0;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    if (FAILED(d_renderingContext->Map(d_vertexRingBuffer, 0, map_type, 0, &mapped)))
+        throw RendererException("failed to map vertex ring buffer.");
+
+    std::memcpy(static_cast<unsigned char*>(mapped.pData) + d_vertexRingBufferOffset,
+                vertex_data, data_size);
+    d_renderingContext->Unmap(d_vertexRingBuffer, 0);
+
+    const UINT offset = d_vertexRingBufferOffset;
+    d_renderingContext->IASetVertexBuffers(0, 1, &d_vertexRingBuffer, &stride, &offset);
+
+    d_vertexRingBufferOffset += data_size;
+}
+
+//----------------------------------------------------------------------------//
+void Direct3D11Renderer::setRenderingDeviceContext(ID3D11DeviceContext* context)
+{
+    d_renderingContext = context ? context : d_deviceContext;
+
+    // nothing is bound on the new context yet
+    d_currentBlendState = 0;
+    d_currentRasterizerState = 0;
+    d_vertexRingBufferOffset = d_vertexRingBufferSize;
+}
+
+//----------------------------------------------------------------------------//
+bool Direct3D11Renderer::isStandardShaderWrapper(const ShaderWrapper* shaderWrapper) const
+{
+    return shaderWrapper == d_shaderWrapperTextured ||
+           shaderWrapper == d_shaderWrapperSolid ||
+           shaderWrapper == d_shaderWrapperDistanceField ||
+           shaderWrapper == d_shaderWrapperLayeredGlyph;
+}
+
+//----------------------------------------------------------------------------//
+bool Direct3D11Renderer::isLayeredGlyphShaderWrapper(const ShaderWrapper* shaderWrapper) const
+{
+    return shaderWrapper == d_shaderWrapperLayeredGlyph;
+}
+
 //----------------------------------------------------------------------------//
 void Direct3D11Renderer::bindRasterizerState(bool scissorEnabled)
 {
@@ -570,7 +771,7 @@ void Direct3D11Renderer::bindRasterizerState(bool scissorEnabled)
     {
         if (d_currentRasterizerState != d_rasterizerStateScissorEnabled)
         {
-            d_deviceContext->RSSetState(d_rasterizerStateScissorEnabled);
+            d_renderingContext->RSSetState(d_rasterizerStateScissorEnabled);
             d_currentRasterizerState = d_rasterizerStateScissorEnabled;
         }
     }
@@ -578,7 +779,7 @@ void Direct3D11Renderer::bindRasterizerState(bool scissorEnabled)
     {
         if (d_currentRasterizerState != d_rasterizerStateScissorDisabled)
         {
-            d_deviceContext->RSSetState(d_rasterizerStateScissorDisabled);
+            d_renderingContext->RSSetState(d_rasterizerStateScissorDisabled);
             d_currentRasterizerState = d_rasterizerStateScissorDisabled;
         }
     }
@@ -43,8 +43,8 @@ static const size_t LOG_BUFFER_SIZE = 8096;
 Direct3D11Shader::Direct3D11Shader(Direct3D11Renderer& owner,
                                    const std::string& vertexShaderSource,
                                    const std::string& pixelShaderSource)
-    : d_device(owner.getDirect3DDevice())
-    , d_deviceContext(owner.getDirect3DDeviceContext())
+    : d_owner(owner)
+    , d_device(owner.getDirect3DDevice())
     , d_vertShader(0)
     , d_vertexShaderBuffer(0)
     , d_vertexShaderReflection(0)
@@ -81,12 +81,14 @@ Direct3D11Shader::~Direct3D11Shader()
 //----------------------------------------------------------------------------//
 void Direct3D11Shader::bind() const
 {
+    ID3D11DeviceContext* context = d_owner.getRenderingDeviceContext();
+
     //Set Vertex and Pixel Shaders
-	d_deviceContext->VSSetShader(d_vertShader, 0, 0);
-	d_deviceContext->PSSetShader(d_pixelShader, 0, 0);
-    d_deviceContext->CSSetShader(0, 0, 0);
-    d_deviceContext->DSSetShader(0, 0, 0);
-    d_deviceContext->GSSetShader(0, 0, 0);
+    context->VSSetShader(d_vertShader, 0, 0);
+    context->PSSetShader(d_pixelShader, 0, 0);
+    context->CSSetShader(0, 0, 0);
+    context->DSSetShader(0, 0, 0);
+    context->GSSetShader(0, 0, 0);
 }
 
 //----------------------------------------------------------------------------//
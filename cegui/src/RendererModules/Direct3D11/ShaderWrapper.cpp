@@ -39,7 +39,7 @@ namespace CEGUI
 //----------------------------------------------------------------------------//
 Direct3D11ShaderWrapper::Direct3D11ShaderWrapper(Direct3D11ShaderPtr&& shader,
                                                  Direct3D11Renderer* renderer)
-    : d_deviceContext(renderer->getDirect3DDeviceContext())
+    : d_owner(renderer)
     , d_device(renderer->getDirect3DDevice())
     , d_perObjectUniformVarBufferVert(0)
     , d_perObjectUniformVarBufferPixel(0)
@@ -178,9 +178,9 @@ void Direct3D11ShaderWrapper::prepareForRendering(const ShaderParameterBindings*
                 ID3D11ShaderResourceView* shaderResourceView = texture->getDirect3DShaderResourceView();
 
                 if (parameterDescription.d_shaderType == ShaderType::PIXEL)
-                    d_deviceContext->PSSetShaderResources(parameterDescription.d_boundLocation, 1, &shaderResourceView);
+                    d_owner->getRenderingDeviceContext()->PSSetShaderResources(parameterDescription.d_boundLocation, 1, &shaderResourceView);
                 else if (parameterDescription.d_shaderType == ShaderType::VERTEX)
-                    d_deviceContext->VSSetShaderResources(parameterDescription.d_boundLocation, 1, &shaderResourceView);
+                    d_owner->getRenderingDeviceContext()->VSSetShaderResources(parameterDescription.d_boundLocation, 1, &shaderResourceView);
             }
             break;
         default:
@@ -245,10 +245,10 @@ void Direct3D11ShaderWrapper::prepareUniformVariableMapping(unsigned char*& reso
 {
     if(d_perObjectUniformVarBufferVert != 0)
     {
-        d_deviceContext->VSSetConstantBuffers(0, 1, &d_perObjectUniformVarBufferVert);
+        d_owner->getRenderingDeviceContext()->VSSetConstantBuffers(0, 1, &d_perObjectUniformVarBufferVert);
 
         D3D11_MAPPED_SUBRESOURCE mappedResourceVertShader;
-        HRESULT result = d_deviceContext->Map(d_perObjectUniformVarBufferVert, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResourceVertShader);
+        HRESULT result = d_owner->getRenderingDeviceContext()->Map(d_perObjectUniformVarBufferVert, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResourceVertShader);
         if(FAILED(result))
             throw RendererException("Failed to map constant shader buffer.\n");
 
@@ -256,10 +256,10 @@ void Direct3D11ShaderWrapper::prepareUniformVariableMapping(unsigned char*& reso
     }
     if(d_perObjectUniformVarBufferPixel != 0)
     {
-        d_deviceContext->PSSetConstantBuffers(0, 1, &d_perObjectUniformVarBufferPixel);
+        d_owner->getRenderingDeviceContext()->PSSetConstantBuffers(0, 1, &d_perObjectUniformVarBufferPixel);
 
         D3D11_MAPPED_SUBRESOURCE mappedResourcePixelShader;
-        HRESULT result = d_deviceContext->Map(d_perObjectUniformVarBufferPixel, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResourcePixelShader);
+        HRESULT result = d_owner->getRenderingDeviceContext()->Map(d_perObjectUniformVarBufferPixel, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResourcePixelShader);
         if(FAILED(result))
             throw RendererException("Failed to map constant shader buffer.\n");
 
@@ -271,9 +271,9 @@ void Direct3D11ShaderWrapper::prepareUniformVariableMapping(unsigned char*& reso
 void Direct3D11ShaderWrapper::finishUniformVariableMapping()
 {
     if(d_perObjectUniformVarBufferVert != 0)
-        d_deviceContext->Unmap(d_perObjectUniformVarBufferVert, 0);
+        d_owner->getRenderingDeviceContext()->Unmap(d_perObjectUniformVarBufferVert, 0);
     if(d_perObjectUniformVarBufferPixel != 0)
-        d_deviceContext->Unmap(d_perObjectUniformVarBufferPixel, 0);
+        d_owner->getRenderingDeviceContext()->Unmap(d_perObjectUniformVarBufferPixel, 0);
 }
 
 //----------------------------------------------------------------------------//
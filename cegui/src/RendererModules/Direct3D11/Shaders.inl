@@ -28,6 +28,40 @@
 namespace CEGUI
 {
 
+/*!
+HLSL declarations and function shared by all pixel shaders, returning the
+coverage of the clipping mask of the GeometryBuffer at a position in geometry
+space. The columns of clipMask hold the mask area, the area of the mask texture
+sampled over it and the mask type along with the corner radius.
+*/
+#define CEGUI_HLSL_CLIP_MASK_FUNCTION \
+"float4x4 clipMask;\n" \
+"Texture2D clipMaskTexture;\n" \
+"\n" \
+"float clipMaskCoverage(float2 position, SamplerState maskSampler)\n" \
+"{\n" \
+"	float4x4 columns = transpose(clipMask);\n" \
+"	float4 area = columns[0];\n" \
+"	float mode = columns[2].x;\n" \
+"	if (mode < 0.5)\n" \
+"		return 1.0;\n" \
+"	if (mode < 1.5)\n" \
+"	{\n" \
+"		float radius = columns[2].y;\n" \
+"		float2 halfSize = (area.zw - area.xy) * 0.5;\n" \
+"		float2 d = abs(position - (area.xy + halfSize)) - halfSize + radius;\n" \
+"		float dist = length(max(d, 0.0)) + min(max(d.x, d.y), 0.0) - radius;\n" \
+"		float width = max(fwidth(dist), 0.0001);\n" \
+"		return saturate(0.5 - dist / width);\n" \
+"	}\n" \
+"	if (any(position < area.xy) || any(position > area.zw))\n" \
+"		return 0.0;\n" \
+"	float4 texArea = columns[1];\n" \
+"	float2 uv = lerp(texArea.xy, texArea.zw, (position - area.xy) / (area.zw - area.xy));\n" \
+"	return clipMaskTexture.SampleLevel(maskSampler, uv, 0).a;\n" \
+"}\n" \
+"\n"
+
 //! A string containing an HLSL vertex shader for solid colouring of a polygon
 const char VertexShaderColoured[] = ""
 "float4x4 modelViewProjMatrix;\n"
@@ -36,6 +70,7 @@ const char VertexShaderColoured[] = ""
 "{\n"
 "	float4 pos : SV_Position;\n"
 "	float4 colour : COLOR;\n"
+"	float2 position : TEXCOORD1;\n"
 "};\n"
 "\n"
 "VertOut main(float3 inPos : POSITION, float4 inColour : COLOR)\n"
@@ -44,6 +79,7 @@ const char VertexShaderColoured[] = ""
 "\n"
 "   output.pos = mul(modelViewProjMatrix, float4(inPos, 1.0));\n"
 "	output.colour = inColour;\n"
+"	output.position = inPos.xy;\n"
 "\n"
 "	return output;\n"
 "}\n"
@@ -52,18 +88,20 @@ const char VertexShaderColoured[] = ""
 //! A string containing an HLSL fragment shader for solid colouring of a polygon
 const char PixelShaderColoured[] = ""
 "Texture2D texture0;\n"
+"SamplerState textureSamplerState;\n"
 "uniform float alphaPercentage;\n"
-"\n"
+CEGUI_HLSL_CLIP_MASK_FUNCTION
 "struct VertOut\n"
 "{\n"
 "	float4 pos : SV_Position;\n"
 "	float4 colour : COLOR;\n"
+"	float2 position : TEXCOORD1;\n"
 "};\n"
 "\n"
 "float4 main(VertOut input) : SV_Target\n"
 "{\n"
 "   float4 colour = input.colour;\n"
-"   colour.a *= alphaPercentage;\n"
+"   colour.a *= alphaPercentage * clipMaskCoverage(input.position, textureSamplerState);\n"
 "	return colour;\n"
 "}\n"
 "\n"
@@ -83,6 +121,7 @@ const char VertexShaderTextured[] = ""
 "	float4 pos : SV_Position;\n"
 "	float4 colour : COLOR;\n"
 "	float2 texcoord0 : TEXCOORD;\n"
+"	float2 position : TEXCOORD1;\n"
 "};\n"
 "\n"
 "// Vertex shader\n"
@@ -93,6 +132,7 @@ const char VertexShaderTextured[] = ""
 "   output.pos = mul(modelViewProjMatrix, float4(inPos, 1.0));\n"
 "   output.texcoord0 = inTexCoord0;\n"
 "	output.colour = inColour;\n"
+"	output.position = inPos.xy;\n"
 "\n"
 "	return output;\n"
 "}\n"
@@ -107,18 +147,90 @@ const char PixelShaderTextured[] = ""
 "Texture2D texture0;\n"
 "SamplerState textureSamplerState;\n"
 "uniform float alphaPercentage;\n"
-"\n"
+CEGUI_HLSL_CLIP_MASK_FUNCTION
 "struct VertOut\n"
 "{\n"
 "	float4 pos : SV_Position;\n"
 "	float4 colour : COLOR;\n"
 "	float2 texcoord0 : TEXCOORD;\n"
+"	float2 position : TEXCOORD1;\n"
 "};\n"
 "\n"
 "float4 main(VertOut input) : SV_Target\n"
 "{\n"
 "	float4 colour =  texture0.Sample(textureSamplerState, input.texcoord0) * input.colour;\n"
-"   colour.a *= alphaPercentage;\n"
+"   colour.a *= alphaPercentage * clipMaskCoverage(input.position, textureSamplerState);\n"
+"	return colour;\n"
+"}\n"
+"\n"
+;
+
+/*!
+A string containing an HLSL pixel shader for geometry textured with a signed
+distance field. The texture alpha holds the distance with the edge at 0.5,
+which is turned into coverage over the width of a screen pixel.
+*/
+const char PixelShaderDistanceField[] = ""
+"Texture2D texture0;\n"
+"SamplerState textureSamplerState;\n"
+"uniform float alphaPercentage;\n"
+CEGUI_HLSL_CLIP_MASK_FUNCTION
+"struct VertOut\n"
+"{\n"
+"	float4 pos : SV_Position;\n"
+"	float4 colour : COLOR;\n"
+"	float2 texcoord0 : TEXCOORD;\n"
+"	float2 position : TEXCOORD1;\n"
+"};\n"
+"\n"
+"float4 main(VertOut input) : SV_Target\n"
+"{\n"
+"	float distance = texture0.Sample(textureSamplerState, input.texcoord0).a;\n"
+"	float width = max(fwidth(distance), 0.0001);\n"
+"	float4 colour = input.colour;\n"
+"	colour.a *= smoothstep(0.5 - width, 0.5 + width, distance) * alphaPercentage *\n"
+"		clipMaskCoverage(input.position, textureSamplerState);\n"
+"	return colour;\n"
+"}\n"
+"\n"
+;
+
+/*!
+A string containing an HLSL pixel shader for glyphs whose layers are packed
+into the channels of one texture, layer 0 in alpha and layers 1 to 3 in red,
+green and blue. The layers are composited from the highest down, layer 0 in
+the vertex colour and the others in the columns of layerColours.
+*/
+const char PixelShaderLayeredGlyph[] = ""
+"Texture2D texture0;\n"
+"SamplerState textureSamplerState;\n"
+"uniform float alphaPercentage;\n"
+"uniform float4x4 layerColours;\n"
+CEGUI_HLSL_CLIP_MASK_FUNCTION
+"struct VertOut\n"
+"{\n"
+"	float4 pos : SV_Position;\n"
+"	float4 colour : COLOR;\n"
+"	float2 texcoord0 : TEXCOORD;\n"
+"	float2 position : TEXCOORD1;\n"
+"};\n"
+"\n"
+"float4 over(float4 under, float4 colour, float coverage)\n"
+"{\n"
+"	float a = colour.a * coverage;\n"
+"	return float4(colour.rgb * a, a) + under * (1.0 - a);\n"
+"}\n"
+"\n"
+"float4 main(VertOut input) : SV_Target\n"
+"{\n"
+"	float4 coverage = texture0.Sample(textureSamplerState, input.texcoord0);\n"
+"	float4x4 colours = transpose(layerColours);\n"
+"	float4 layers = over(float4(0.0, 0.0, 0.0, 0.0), colours[3], coverage.b);\n"
+"	layers = over(layers, colours[2], coverage.g);\n"
+"	layers = over(layers, colours[1], coverage.r);\n"
+"	layers = over(layers, input.colour, coverage.a);\n"
+"	float4 colour = float4(layers.rgb / max(layers.a, 0.0001), layers.a);\n"
+"	colour.a *= alphaPercentage * clipMaskCoverage(input.position, textureSamplerState);\n"
 "	return colour;\n"
 "}\n"
 "\n"
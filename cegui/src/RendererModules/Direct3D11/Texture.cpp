@@ -49,9 +49,11 @@ static DXGI_FORMAT toD3DPixelFormat(const Texture::PixelFormat fmt)
     {
         case Texture::PixelFormat::Rgba:      return DXGI_FORMAT_R8G8B8A8_UNORM;
         case Texture::PixelFormat::Rgb:       return DXGI_FORMAT_R8G8B8A8_UNORM;
+        case Texture::PixelFormat::RgbDxt1:  return DXGI_FORMAT_BC1_UNORM;
         case Texture::PixelFormat::RgbaDxt1: return DXGI_FORMAT_BC1_UNORM;
         case Texture::PixelFormat::RgbaDxt3: return DXGI_FORMAT_BC2_UNORM;
         case Texture::PixelFormat::RgbaDxt5: return DXGI_FORMAT_BC3_UNORM;
+        case Texture::PixelFormat::RgbaBc7:  return DXGI_FORMAT_BC7_UNORM;
         default:                    return DXGI_FORMAT_UNKNOWN;
     }
 }
@@ -66,12 +68,13 @@ static size_t calculateDataWidth(const size_t width, Texture::PixelFormat fmt)
     case Texture::PixelFormat::Rgb: // also 4 because we convert to RGBA
         return width * 4;
 
+    case Texture::PixelFormat::RgbDxt1:
     case Texture::PixelFormat::RgbaDxt1:
-        return ((width + 3) / 4) * 8;
-
     case Texture::PixelFormat::RgbaDxt3:
     case Texture::PixelFormat::RgbaDxt5:
-        return ((width + 3) / 4) * 16;
+    case Texture::PixelFormat::RgbaBc7:
+        // one row of 4x4 blocks
+        return Texture::calculateDataSize(fmt, width, 4);
 
     default:
         return 0;
@@ -498,11 +501,20 @@ bool Direct3D11Texture::isPixelFormatSupported(const PixelFormat fmt) const
     {
         case PixelFormat::Rgba:
         case PixelFormat::Rgb:
+        case PixelFormat::RgbDxt1:
         case PixelFormat::RgbaDxt1:
         case PixelFormat::RgbaDxt3:
         case PixelFormat::RgbaDxt5:
             return true;
 
+        case PixelFormat::RgbaBc7:
+        {
+            // BC7 needs feature level 11.0 hardware
+            UINT support = 0;
+            return SUCCEEDED(d_device.CheckFormatSupport(DXGI_FORMAT_BC7_UNORM, &support)) &&
+                   (support & D3D11_FORMAT_SUPPORT_TEXTURE2D);
+        }
+
         default:
             return false;
     }
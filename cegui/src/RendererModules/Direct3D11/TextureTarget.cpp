@@ -83,7 +83,7 @@ bool Direct3D11TextureTarget::isImageryCache() const
 void Direct3D11TextureTarget::clear()
 {
     const float colour[] = { 0, 0, 0, 0 };
-    d_deviceContext.ClearRenderTargetView(d_renderTargetView, colour);
+    d_owner.getRenderingDeviceContext()->ClearRenderTargetView(d_renderTargetView, colour);
 }
 
 //----------------------------------------------------------------------------//
@@ -95,11 +95,13 @@ Texture& Direct3D11TextureTarget::getTexture() const
 //----------------------------------------------------------------------------//
 void Direct3D11TextureTarget::declareRenderSize(const Sizef& sz)
 {
-    // exit if current size is enough
-    if ((d_area.getWidth() >= sz.d_width) && (d_area.getHeight() >=sz.d_height))
+    const Sizef storageSize(d_growthPolicy.getStorageSize(d_area.getSize(), sz));
+
+    // exit if current size is enough, the content is drawn to its top left part
+    if (d_area.getSize() == storageSize)
         return;
 
-    setArea(Rectf(d_area.getPosition(), sz));
+    setArea(Rectf(d_area.getPosition(), storageSize));
     resizeRenderTexture();
     clear();
 }
@@ -171,10 +173,10 @@ void Direct3D11TextureTarget::resizeRenderTexture()
 //----------------------------------------------------------------------------//
 void Direct3D11TextureTarget::enableRenderTexture()
 {
-    d_deviceContext.OMGetRenderTargets(1, &d_previousRenderTargetView,
-                                &d_previousDepthStencilView);
+    d_owner.getRenderingDeviceContext()->OMGetRenderTargets(1,
+        &d_previousRenderTargetView, &d_previousDepthStencilView);
 
-    d_deviceContext.OMSetRenderTargets(1, &d_renderTargetView, 0);
+    d_owner.getRenderingDeviceContext()->OMSetRenderTargets(1, &d_renderTargetView, 0);
 }
 
 //----------------------------------------------------------------------------//
@@ -185,8 +187,8 @@ void Direct3D11TextureTarget::disableRenderTexture()
     if (d_previousDepthStencilView)
         d_previousDepthStencilView->Release();
 
-    d_deviceContext.OMSetRenderTargets(1, &d_previousRenderTargetView,
-                                d_previousDepthStencilView);
+    d_owner.getRenderingDeviceContext()->OMSetRenderTargets(1,
+        &d_previousRenderTargetView, d_previousDepthStencilView);
 
     d_previousRenderTargetView = 0;
     d_previousDepthStencilView = 0;
@@ -37,7 +37,7 @@ Direct3D11ViewportTarget::Direct3D11ViewportTarget(Direct3D11Renderer& owner) :
     // initialise renderer size
     D3D11_VIEWPORT vp;
     UINT vp_count = 1;
-    d_deviceContext.RSGetViewports(&vp_count, &vp);
+    d_owner.getDirect3DDeviceContext()->RSGetViewports(&vp_count, &vp);
     if (vp_count != 1)
         throw RendererException(
             "Unable to access required view port information from "
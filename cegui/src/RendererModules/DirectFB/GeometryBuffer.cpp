@@ -61,11 +61,12 @@ void DirectFBGeometryBuffer::draw(std::uint32_t drawModeMask) const
     target_surface->GetClip(target_surface, &saved_clip);
 
     // setup clip region
+    const Rectf& clipRegion = getPreparedClippingRegion();
     const DFBRegion clip_region = {
-        static_cast<int>(d_preparedClippingRegion.left()),
-        static_cast<int>(d_preparedClippingRegion.top()),
-        static_cast<int>(d_preparedClippingRegion.right()),
-        static_cast<int>(d_preparedClippingRegion.bottom()) };
+        static_cast<int>(clipRegion.left()),
+        static_cast<int>(clipRegion.top()),
+        static_cast<int>(clipRegion.right()),
+        static_cast<int>(clipRegion.bottom()) };
 
     // apply the transformations we need to use.
     if (!d_matrixValid)
@@ -130,6 +130,8 @@ void DirectFBRenderer::destroyTextureTarget(TextureTarget* target)
 //----------------------------------------------------------------------------//
 void DirectFBRenderer::destroyAllTextureTargets()
 {
+    getTextureTargetPool().forgetAll();
+
     while (!d_textureTargets.empty())
         destroyTextureTarget(*d_textureTargets.begin());
 }
@@ -113,7 +113,8 @@ void IrrlichtGeometryBuffer::setupClipping() const
     d_savedViewport = d_driver.getViewPort();
     d_savedProjection = d_driver.getTransform(irr::video::ETS_PROJECTION);
 
-    const Sizef csz(d_preparedClippingRegion.getSize());
+    const Rectf& clipRegion = getPreparedClippingRegion();
+    const Sizef csz(clipRegion.getSize());
     const Sizef tsz(static_cast<float>(d_savedViewport.getWidth()),
                      static_cast<float>(d_savedViewport.getHeight()));
 
@@ -124,20 +125,20 @@ void IrrlichtGeometryBuffer::setupClipping() const
     scsr(1, 1) = tsz.d_height / csz.d_height;
     scsr(3, 0) = d_xViewDir * (tsz.d_width + 2.0f *
                    (d_savedViewport.UpperLeftCorner.X -
-                     (d_preparedClippingRegion.left() + csz.d_width * 0.5f))) / csz.d_width;
+                     (clipRegion.left() + csz.d_width * 0.5f))) / csz.d_width;
     scsr(3, 1) = -(tsz.d_height + 2.0f *
                    (d_savedViewport.UpperLeftCorner.Y -
-                     (d_preparedClippingRegion.top() + csz.d_height * 0.5f))) / csz.d_height;
+                     (clipRegion.top() + csz.d_height * 0.5f))) / csz.d_height;
 
     scsr *= d_savedProjection;
     d_driver.setTransform(irr::video::ETS_PROJECTION, scsr);
 
     // set new viewport for the clipping area
     const irr::core::rect<irr::s32> vp(
-            static_cast<irr::s32>(d_preparedClippingRegion.left()),
-            static_cast<irr::s32>(d_preparedClippingRegion.top()),
-            static_cast<irr::s32>(d_preparedClippingRegion.right()),
-            static_cast<irr::s32>(d_preparedClippingRegion.bottom()));
+            static_cast<irr::s32>(clipRegion.left()),
+            static_cast<irr::s32>(clipRegion.top()),
+            static_cast<irr::s32>(clipRegion.right()),
+            static_cast<irr::s32>(clipRegion.bottom()));
     d_driver.setViewPort(vp);
 }
 
@@ -196,6 +196,8 @@ void IrrlichtRenderer::destroyTextureTarget(TextureTarget* target)
 //----------------------------------------------------------------------------//
 void IrrlichtRenderer::destroyAllTextureTargets()
 {
+    getTextureTargetPool().forgetAll();
+
     while (!d_textureTargets.empty())
         destroyTextureTarget(*d_textureTargets.begin());
 }
@@ -33,8 +33,11 @@
 namespace CEGUI
 {
 //----------------------------------------------------------------------------//
-NullGeometryBuffer::NullGeometryBuffer(CEGUI::RefCounted<RenderMaterial> renderMaterial)
-    : GeometryBuffer(renderMaterial)
+NullGeometryBuffer::NullGeometryBuffer(NullRenderer& owner,
+                                       CEGUI::RefCounted<RenderMaterial> renderMaterial)
+    : GeometryBuffer(renderMaterial),
+    d_owner(owner),
+    d_dataChanged(false)
 {
 }
 
@@ -54,6 +57,13 @@ void NullGeometryBuffer::draw(std::uint32_t drawModeMask) const
         // set up RenderEffect
         if (d_effect)
             d_effect->performPreRenderFunctions(pass);
+
+        // account the draw call, uploading the vertices with the first one
+        if (d_vertexCount > 0)
+        {
+            d_owner.notifyGeometryDrawn(*this, d_dataChanged);
+            d_dataChanged = false;
+        }
     }
 
     // clean up RenderEffect
@@ -64,9 +74,35 @@ void NullGeometryBuffer::draw(std::uint32_t drawModeMask) const
 //----------------------------------------------------------------------------//
 void NullGeometryBuffer::appendGeometry(const std::vector<float>& vertex_data)
 {
-    d_vertexData.insert(d_vertexData.end(), vertex_data.begin(), vertex_data.end());
-    // Update size of geometry buffer
-    d_vertexCount = d_vertexData.size();
+    appendGeometry(vertex_data.data(), vertex_data.size());
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::appendGeometry(const float* vertex_data, std::size_t array_size)
+{
+    GeometryBuffer::appendGeometry(vertex_data, array_size);
+    d_dataChanged = true;
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::reset()
+{
+    GeometryBuffer::reset();
+    d_dataChanged = true;
+}
+
+//----------------------------------------------------------------------------//
+bool NullGeometryBuffer::isQuadIndexingSupported() const
+{
+    // nothing is drawn, so any vertex layout is fine
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool NullGeometryBuffer::isClippingMaskSupported() const
+{
+    // nothing is drawn, so the mask is only kept as state
+    return true;
 }
 
 //----------------------------------------------------------------------------//
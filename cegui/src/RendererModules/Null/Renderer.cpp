@@ -34,6 +34,7 @@
 #include "CEGUI/System.h"
 #include "CEGUI/DefaultResourceProvider.h"
 #include "CEGUI/Logger.h"
+#include "CEGUI/RenderMaterial.h"
 
 #include <algorithm>
 
@@ -134,7 +135,7 @@ RefCounted<RenderMaterial> NullRenderer::createRenderMaterial(const DefaultShade
 //----------------------------------------------------------------------------//
 GeometryBuffer& NullRenderer::createGeometryBufferTextured(RefCounted<RenderMaterial> renderMaterial)
 {
-    NullGeometryBuffer* geom_buffer = new NullGeometryBuffer(renderMaterial);
+    NullGeometryBuffer* geom_buffer = new NullGeometryBuffer(*this, renderMaterial);
 
     geom_buffer->addVertexAttribute(VertexAttributeType::Position0);
     geom_buffer->addVertexAttribute(VertexAttributeType::Colour0);
@@ -147,7 +148,7 @@ GeometryBuffer& NullRenderer::createGeometryBufferTextured(RefCounted<RenderMate
 //----------------------------------------------------------------------------//
 GeometryBuffer& NullRenderer::createGeometryBufferColoured(RefCounted<RenderMaterial> renderMaterial)
 {
-    NullGeometryBuffer* geom_buffer = new NullGeometryBuffer(renderMaterial);
+    NullGeometryBuffer* geom_buffer = new NullGeometryBuffer(*this, renderMaterial);
 
     geom_buffer->addVertexAttribute(VertexAttributeType::Position0);
     geom_buffer->addVertexAttribute(VertexAttributeType::Colour0);
@@ -181,6 +182,8 @@ void NullRenderer::destroyTextureTarget(TextureTarget* target)
 //----------------------------------------------------------------------------//
 void NullRenderer::destroyAllTextureTargets()
 {
+    getTextureTargetPool().forgetAll();
+
     while (!d_textureTargets.empty())
         destroyTextureTarget(*d_textureTargets.begin());
 }
@@ -190,7 +193,7 @@ Texture& NullRenderer::createTexture(const String& name)
 {
     throwIfNameExists(name);
 
-    NullTexture* t = new NullTexture(name);
+    NullTexture* t = new NullTexture(*this, name);
     d_textures[name] = t;
 
     logTextureCreation(name);
@@ -204,7 +207,7 @@ Texture& NullRenderer::createTexture(const String& name, const String& filename,
 {
     throwIfNameExists(name);
 
-    NullTexture* t = new NullTexture(name, filename, resourceGroup);
+    NullTexture* t = new NullTexture(*this, name, filename, resourceGroup);
     d_textures[name] = t;
 
     logTextureCreation(name);
@@ -217,7 +220,7 @@ Texture& NullRenderer::createTexture(const String& name, const Sizef& size)
 {
     throwIfNameExists(name);
 
-    NullTexture* t = new NullTexture(name, size);
+    NullTexture* t = new NullTexture(*this, name, size);
     d_textures[name] = t;
 
     logTextureCreation(name);
@@ -296,6 +299,8 @@ bool NullRenderer::isTextureDefined(const String& name) const
 //----------------------------------------------------------------------------//
 void NullRenderer::beginRendering()
 {
+    // the first draw call of a frame sets all of the state
+    d_lastShader = nullptr;
 }
 
 //----------------------------------------------------------------------------//
@@ -324,7 +329,13 @@ const String& NullRenderer::getIdentifierString() const
 //----------------------------------------------------------------------------//
 NullRenderer::NullRenderer() :
     // TODO: should be set to correct value
-    d_maxTextureSize(2048)
+    d_maxTextureSize(2048),
+    d_uploadSimulationEnabled(false),
+    d_lastShader(nullptr),
+    d_lastTexture(nullptr),
+    d_lastBlendMode(BlendMode::Normal),
+    d_lastClippingActive(false),
+    d_lastAlpha(1.0f)
 {
     constructor_impl();
 }
@@ -372,6 +383,98 @@ bool NullRenderer::isTexCoordSystemFlipped() const
     return false;
 }
 
+//----------------------------------------------------------------------------//
+bool NullRenderer::isGeometryGenerationThreadSafe() const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t NullRenderer::getTextureMemoryUsage() const
+{
+    std::size_t usage = 0;
+    for (TextureMap::const_iterator i = d_textures.begin(); i != d_textures.end(); ++i)
+    {
+        const NullTexture& texture = *i->second;
+        if (texture.d_dataReleased)
+            continue;
+
+        usage += Texture::calculateDataSize(texture.d_pixelFormat,
+            static_cast<size_t>(texture.d_size.d_width),
+            static_cast<size_t>(texture.d_size.d_height));
+    }
+
+    return usage;
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::notifyGeometryDrawn(const NullGeometryBuffer& buffer, bool upload)
+{
+    FrameStats& stats = getCurrentFrameStats();
+    const std::size_t vertexCount = buffer.getVertexCount();
+
+    ++stats.d_drawCalls;
+    stats.d_verticesDrawn += vertexCount;
+
+    if (upload)
+    {
+        stats.d_verticesUploaded += vertexCount;
+        simulateUpload(buffer.getVertexData().data(),
+                       buffer.getVertexData().size() * sizeof(float));
+    }
+
+    // count the state a graphics API would have to change for this draw call
+    const ShaderWrapper* shader = buffer.getRenderMaterial()->getShaderWrapper();
+    const Texture* texture = buffer.getTexture("texture0");
+    const bool clippingActive = buffer.isClippingActive();
+
+    if (!d_lastShader)
+    {
+        // nothing is set at the start of a frame
+        stats.d_stateChanges += 4;
+    }
+    else
+    {
+        if (shader != d_lastShader)
+            ++stats.d_stateChanges;
+        if (texture != d_lastTexture)
+            ++stats.d_stateChanges;
+        if (buffer.getBlendMode() != d_lastBlendMode)
+            ++stats.d_stateChanges;
+        if (clippingActive != d_lastClippingActive ||
+            (clippingActive && buffer.getClippingRegion() != d_lastClippingRegion))
+            ++stats.d_stateChanges;
+    }
+
+    if (buffer.getAlpha() != d_lastAlpha)
+        ++stats.d_stateChanges;
+
+    d_lastShader = shader;
+    d_lastTexture = texture;
+    d_lastBlendMode = buffer.getBlendMode();
+    d_lastClippingActive = clippingActive;
+    d_lastClippingRegion = buffer.getClippingRegion();
+    d_lastAlpha = buffer.getAlpha();
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::notifyTextureUploaded(const void* data, std::size_t size)
+{
+    ++getCurrentFrameStats().d_textureUploads;
+    simulateUpload(data, size);
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::simulateUpload(const void* data, std::size_t size)
+{
+    if (!d_uploadSimulationEnabled || !data)
+        return;
+
+    // the staging memory is kept, as a driver would keep its buffers
+    const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+    d_uploadBuffer.assign(bytes, bytes + size);
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
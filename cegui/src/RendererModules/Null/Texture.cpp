@@ -26,7 +26,9 @@
  ***************************************************************************/
 #include "CEGUI/RendererModules/Null/Texture.h"
 #include "CEGUI/Exceptions.h"
+#include "CEGUI/DataContainer.h"
 #include "CEGUI/ImageCodec.h"
+#include "CEGUI/ResourceProvider.h"
 #include "CEGUI/System.h"
 
 #include <cstdint>
@@ -89,17 +91,30 @@ void NullTexture::loadFromFile(const String& filename,
 }
 
 //----------------------------------------------------------------------------//
-void NullTexture::loadFromMemory(const void* /*buffer*/,
+void NullTexture::loadFromMemory(const void* buffer,
                                  const Sizef& buffer_size,
-                                 PixelFormat)
+                                 PixelFormat pixel_format)
 {
     d_size = d_dataSize = buffer_size;
+    d_pixelFormat = pixel_format;
+    d_dataReleased = false;
+    d_opaque = Texture::isDataOpaque(buffer,
+        static_cast<size_t>(buffer_size.d_width) * static_cast<size_t>(buffer_size.d_height),
+        pixel_format);
+
+    d_owner.notifyTextureUploaded(buffer, calculateDataSize(d_pixelFormat,
+        static_cast<size_t>(buffer_size.d_width), static_cast<size_t>(buffer_size.d_height)));
 }
 
 //----------------------------------------------------------------------------//
-void NullTexture::blitFromMemory(const void* /*sourceData*/, const Rectf& /*area*/)
+void NullTexture::blitFromMemory(const void* sourceData, const Rectf& area)
 {
-    // do nothing
+    d_opaque = d_opaque && Texture::isDataOpaque(sourceData,
+        static_cast<size_t>(area.getWidth()) * static_cast<size_t>(area.getHeight()),
+        d_pixelFormat);
+
+    d_owner.notifyTextureUploaded(sourceData, calculateDataSize(d_pixelFormat,
+        static_cast<size_t>(area.getWidth()), static_cast<size_t>(area.getHeight())));
 }
 
 //----------------------------------------------------------------------------//
@@ -109,31 +124,43 @@ void NullTexture::blitToMemory(void* /*targetData*/)
 }
 
 //----------------------------------------------------------------------------//
-NullTexture::NullTexture(const String& name) :
+NullTexture::NullTexture(NullRenderer& owner, const String& name) :
     d_size(0, 0),
     d_dataSize(0, 0),
     d_texelScaling(0, 0),
-    d_name(name)
+    d_name(name),
+    d_owner(owner),
+    d_pixelFormat(PixelFormat::Rgba),
+    d_dataReleased(false),
+    d_opaque(false)
 {
 }
 
 //----------------------------------------------------------------------------//
-NullTexture::NullTexture(const String& name, const String& filename,
-                         const String& resourceGroup) :
+NullTexture::NullTexture(NullRenderer& owner, const String& name,
+                         const String& filename, const String& resourceGroup) :
     d_size(0, 0),
     d_dataSize(0, 0),
     d_texelScaling(0, 0),
-    d_name(name)
+    d_name(name),
+    d_owner(owner),
+    d_pixelFormat(PixelFormat::Rgba),
+    d_dataReleased(false),
+    d_opaque(false)
 {
     NullTexture::loadFromFile(filename, resourceGroup);
 }
 
 //----------------------------------------------------------------------------//
-NullTexture::NullTexture(const String& name, const Sizef& sz) :
+NullTexture::NullTexture(NullRenderer& owner, const String& name, const Sizef& sz) :
     d_size(0, 0),
     d_dataSize(0, 0),
     d_texelScaling(0, 0),
-    d_name(name)
+    d_name(name),
+    d_owner(owner),
+    d_pixelFormat(PixelFormat::Rgba),
+    d_dataReleased(false),
+    d_opaque(false)
 {
     d_size.d_width = sz.d_width;
     d_size.d_height = sz.d_height;
@@ -151,6 +178,25 @@ bool NullTexture::isPixelFormatSupported(const PixelFormat) const
     return true;
 }
 
+//----------------------------------------------------------------------------//
+bool NullTexture::releaseData()
+{
+    d_dataReleased = true;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool NullTexture::isDataReleased() const
+{
+    return d_dataReleased;
+}
+
+//----------------------------------------------------------------------------//
+bool NullTexture::isOpaque() const
+{
+    return d_opaque;
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
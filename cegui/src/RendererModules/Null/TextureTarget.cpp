@@ -65,6 +65,23 @@ void NullTextureTarget::clear()
 {
 }
 
+//----------------------------------------------------------------------------//
+void NullTextureTarget::clearArea(const Rectf&)
+{
+}
+
+//----------------------------------------------------------------------------//
+bool NullTextureTarget::isAreaClearSupported() const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool NullTextureTarget::isRenderScaleSupported() const
+{
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 Texture& NullTextureTarget::getTexture() const
 {
@@ -64,7 +64,7 @@ OgreGeometryBuffer::OgreGeometryBuffer(OgreRenderer& owner,
     d_renderSystem(rs),
     d_matrix(1.0),
     d_expectedData(MT_INVALID),
-    d_dataAppended(false),
+    d_nextInBatch(nullptr),
     d_previousAlphaValue(-1.f)
 {
 
@@ -84,11 +84,128 @@ void OgreGeometryBuffer::draw(std::uint32_t drawModeMask) const
     if (d_vertexData.empty())
         return;
 
-    if (d_dataAppended)
-        syncVertexData();
+    drawVertices(1, d_vertexCount);
+}
 
-    if (OGRE_ISNULL(d_hwBuffer))
-        return;
+//----------------------------------------------------------------------------//
+bool OgreGeometryBuffer::isBatchableWith(const GeometryBuffer& next) const
+{
+    const OgreGeometryBuffer& other = static_cast<const OgreGeometryBuffer&>(next);
+
+    if (d_vertexData.empty() || other.d_vertexData.empty())
+        return false;
+
+    // the vertices of a batch go to the same shared buffer with one layout
+    if (d_expectedData != other.d_expectedData ||
+        isUsingQuadIndices() != other.isUsingQuadIndices())
+        return false;
+
+    // effects may change states between their passes
+    if (d_effect || other.d_effect)
+        return false;
+
+    if (!hasEquivalentBlendMode(other) || d_alpha != other.d_alpha)
+        return false;
+
+    if (!hasEquivalentClipping(other))
+        return false;
+
+    if (!hasEquivalentClippingMask(other))
+        return false;
+
+    if (d_translation != other.d_translation || d_rotation != other.d_rotation ||
+        d_scale != other.d_scale || d_pivot != other.d_pivot ||
+        d_customTransform != other.d_customTransform)
+        return false;
+
+    if (!hasEquivalentMaterial(other))
+        return false;
+
+    d_nextInBatch = &other;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void OgreGeometryBuffer::drawBatch(std::size_t bufferCount,
+                                   std::size_t vertexCount,
+                                   std::uint32_t drawModeMask) const
+{
+    CEGUI_UNUSED(drawModeMask);
+
+    drawVertices(bufferCount, vertexCount);
+}
+
+//----------------------------------------------------------------------------//
+bool OgreGeometryBuffer::hasEquivalentMaterial(const OgreGeometryBuffer& other) const
+{
+    if (d_renderMaterial == other.d_renderMaterial)
+        return true;
+
+    if (d_renderMaterial->getShaderWrapper() != other.d_renderMaterial->getShaderWrapper())
+        return false;
+
+    // the matrix and alpha are set by each buffer from its own state, which
+    // was already compared
+    static const std::string matrixParamName("modelViewProjMatrix");
+    static const std::string alphaParamName("alphaPercentage");
+    const auto isBufferParameter = [&](const std::string& name)
+    {
+        return name == matrixParamName || name == alphaParamName;
+    };
+
+    const ShaderParameterBindings::ShaderParameterBindingsMap& ours =
+        d_renderMaterial->getShaderParamBindings()->getShaderParameterBindings();
+    const ShaderParameterBindings::ShaderParameterBindingsMap& theirs =
+        other.d_renderMaterial->getShaderParamBindings()->getShaderParameterBindings();
+
+    // both maps are sorted by name, which allows a single lockstep pass
+    auto ourIter = ours.begin();
+    auto theirIter = theirs.begin();
+    while (true)
+    {
+        while (ourIter != ours.end() && isBufferParameter(ourIter->first))
+            ++ourIter;
+        while (theirIter != theirs.end() && isBufferParameter(theirIter->first))
+            ++theirIter;
+
+        if (ourIter == ours.end() || theirIter == theirs.end())
+            return ourIter == ours.end() && theirIter == theirs.end();
+
+        if (ourIter->first != theirIter->first)
+            return false;
+
+        const ShaderParameter* ourParam = ourIter->second;
+        const ShaderParameter* theirParam = theirIter->second;
+        if (ourParam != theirParam &&
+            (!ourParam || !theirParam || !ourParam->equal(theirParam)))
+            return false;
+
+        ++ourIter;
+        ++theirIter;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void OgreGeometryBuffer::drawVertices(std::size_t bufferCount,
+                                      std::size_t vertexCount) const
+{
+    // copy the vertices of the whole batch behind each other into the
+    // shared vertex buffer of the renderer
+    const size_t vertex_size = getVertexAttributeElementCount() * sizeof(float);
+    char* copy_target = static_cast<char*>(
+        d_owner.lockVertexData(*d_renderOp.vertexData, vertexCount, vertex_size));
+
+    const OgreGeometryBuffer* buffer = this;
+    for (std::size_t i = 0; i < bufferCount; ++i)
+    {
+        const size_t byte_count = buffer->d_vertexData.size() * sizeof(float);
+        std::memcpy(copy_target, &buffer->d_vertexData[0], byte_count);
+        copy_target += byte_count;
+
+        buffer = buffer->d_nextInBatch;
+    }
+
+    d_owner.unlockVertexData();
 
 #ifdef CEGUI_USE_OGRE_HLMS
     //Ogre::Viewport* previousViewport = d_renderSystem._getViewport();
@@ -140,6 +257,22 @@ void OgreGeometryBuffer::draw(std::uint32_t drawModeMask) const
     // activate the desired blending mode
     d_owner.bindBlendMode(d_blendMode);
 
+    // quads of four vertices are drawn from the shared quad index buffer
+    d_renderOp.useIndexes = isUsingQuadIndices();
+    if (d_renderOp.useIndexes)
+    {
+        if (!d_renderOp.indexData)
+        {
+        #ifdef CEGUI_USE_OGRE_HLMS
+            d_renderOp.indexData = OGRE_NEW Ogre::v1::IndexData();
+        #else
+            d_renderOp.indexData = OGRE_NEW Ogre::IndexData();
+        #endif //CEGUI_USE_OGRE_HLMS
+        }
+
+        d_owner.setupQuadIndexData(*d_renderOp.indexData, vertexCount / 4);
+    }
+
     // get the impl specific shader wrapper so we can set the necessary render ops in the draw passes.
     OgreShaderWrapper *shaderWrapper = static_cast<OgreShaderWrapper*>( const_cast<ShaderWrapper*>( d_renderMaterial->getShaderWrapper() ) );
 
@@ -189,65 +322,6 @@ void OgreGeometryBuffer::draw(std::uint32_t drawModeMask) const
     updateRenderTargetData(d_owner.getActiveRenderTarget());
 }
 
-//----------------------------------------------------------------------------//
-void OgreGeometryBuffer::appendGeometry(const float* vertex_data, std::size_t array_size)
-{
-    GeometryBuffer::appendGeometry(vertex_data, array_size);
-
-    d_dataAppended = true;
-}
-
-void OgreGeometryBuffer::syncVertexData() const
-{
-    if (!d_dataAppended)
-        return;
-
-    // Make sure that our vertex buffer is large enough
-    size_t current_size;
-
-    if (!OGRE_ISNULL(d_hwBuffer) &&
-        (current_size = d_hwBuffer->getNumVertices()) < d_vertexCount)
-    {
-        size_t new_size = current_size;
-
-        // Reallocate the buffer to be large enough
-        while(new_size < d_vertexCount)
-            new_size *= 2;
-
-        setVertexBuffer(new_size);
-    }
-
-    // copy vertex data into the Ogre hardware buffer
-    if (d_vertexCount > 0)
-    {
-        if (OGRE_ISNULL(d_hwBuffer))
-        {
-
-            setVertexBuffer(d_vertexCount);
-        }
-    #ifdef CEGUI_USE_OGRE_HLMS
-        void* copy_target = d_hwBuffer->lock(
-            Ogre::v1::HardwareVertexBuffer::HBL_DISCARD);
-    #else
-        void* copy_target = d_hwBuffer->lock(
-            Ogre::HardwareVertexBuffer::HBL_DISCARD); 
-    #endif //CEGUI_USE_OGRE_HLMS
-
-        assert(copy_target && "Ogre vertex buffer is invalid");
-
-        std::memcpy(copy_target, &d_vertexData[0], d_vertexData.size()*
-            sizeof(float));
-
-        d_hwBuffer->unlock();
-    }
-
-    // Update rendering for the new vertices
-    d_renderOp.vertexData->vertexStart = 0;
-    d_renderOp.vertexData->vertexCount = d_vertexCount;
-
-    d_dataAppended = false;
-}
-
 //----------------------------------------------------------------------------//
 void OgreGeometryBuffer::updateMatrix() const
 {
@@ -317,55 +391,12 @@ void OgreGeometryBuffer::finaliseVertexAttributes(MANUALOBJECT_TYPE type)
 
 }
 
-void OgreGeometryBuffer::setVertexBuffer(size_t count) const
-{
-    // We first check if some other buffer has already allocated a suited buffer
-    // for us
-    // We use auto here because the return type depends on Ogre version
-    auto already_created = d_owner.getVertexBuffer(count);
-
-    if (!OGRE_ISNULL(already_created))
-    {
-
-        d_hwBuffer = already_created;
-
-    } else {
-
-        // Create a new vertex buffer
-    #ifdef CEGUI_USE_OGRE_HLMS
-        d_hwBuffer = Ogre::v1::HardwareBufferManager::getSingleton().
-            createVertexBuffer(getVertexAttributeElementCount()*sizeof(float), count,
-                Ogre::v1::HardwareBuffer::HBU_DYNAMIC_WRITE_ONLY_DISCARDABLE,
-                false);
-    #else
-        d_hwBuffer = Ogre::HardwareBufferManager::getSingleton().
-            createVertexBuffer(getVertexAttributeElementCount()*sizeof(float), count,
-                Ogre::HardwareBuffer::HBU_DYNAMIC_WRITE_ONLY_DISCARDABLE,
-                false);
-    #endif //CEGUI_USE_OGRE_HLMS
-    }
-
-    if (OGRE_ISNULL(d_hwBuffer))
-    {
-        throw RendererException("Failed to create Ogre vertex buffer, "
-            "probably because the vertex layout is invalid.");
-    }
-
-    // bind the vertex buffer for rendering
-    d_renderOp.vertexData->vertexBufferBinding->setBinding(0, d_hwBuffer);
-}
-
 void OgreGeometryBuffer::cleanUpVertexAttributes()
 {
     OGRE_DELETE d_renderOp.vertexData;
     d_renderOp.vertexData = 0;
-
-    // Store the hardware buffer so that other instances can use it later
-    // This check should also help prevent there being nullptrs in the pool
-    if (d_hwBuffer.get())
-        d_owner.returnVertexBuffer(d_hwBuffer);
-
-    OGRE_RESET(d_hwBuffer);
+    OGRE_DELETE d_renderOp.indexData;
+    d_renderOp.indexData = 0;
 }
 
 // ------------------------------------ //
@@ -374,12 +405,13 @@ void OgreGeometryBuffer::setScissorRects(Ogre::Viewport* current_viewport) const
 {
     int actualWidth = current_viewport->getActualWidth();
     int actualHeight = current_viewport->getActualHeight();
-    float scissorsLeft = d_preparedClippingRegion.left() / actualWidth;
-    float scissorsTop = d_preparedClippingRegion.top() / actualHeight;
-    float scissorsWidth = (d_preparedClippingRegion.right() -
-        d_preparedClippingRegion.left()) / actualWidth;
-    float scissorsHeight = (d_preparedClippingRegion.bottom() -
-        d_preparedClippingRegion.top()) / actualHeight;
+    const Rectf& clipRegion = getPreparedClippingRegion();
+    float scissorsLeft = clipRegion.left() / actualWidth;
+    float scissorsTop = clipRegion.top() / actualHeight;
+    float scissorsWidth = (clipRegion.right() -
+        clipRegion.left()) / actualWidth;
+    float scissorsHeight = (clipRegion.bottom() -
+        clipRegion.top()) / actualHeight;
     
     current_viewport->setScissors(scissorsLeft, scissorsTop, scissorsWidth,
         scissorsHeight);
@@ -388,11 +420,12 @@ void OgreGeometryBuffer::setScissorRects(Ogre::Viewport* current_viewport) const
 #else
 void OgreGeometryBuffer::setScissorRects() const
 {
+    const Rectf& clipRegion = getPreparedClippingRegion();
     d_renderSystem.setScissorTest(true,
-        static_cast<size_t>(d_preparedClippingRegion.left()), 
-        static_cast<size_t>(d_preparedClippingRegion.top()),
-        static_cast<size_t>(d_preparedClippingRegion.right()),
-        static_cast<size_t>(d_preparedClippingRegion.bottom()));
+        static_cast<size_t>(clipRegion.left()), 
+        static_cast<size_t>(clipRegion.top()),
+        static_cast<size_t>(clipRegion.right()),
+        static_cast<size_t>(clipRegion.bottom()));
 }
 #endif //CEGUI_USE_OGRE_HLMS
 
@@ -400,9 +433,16 @@ void OgreGeometryBuffer::setScissorRects() const
 void OgreGeometryBuffer::reset()
 {
     d_vertexData.clear();
+    d_usingQuadIndices = false;
     d_clippingActive = true;
 }
 
+// ------------------------------------ //
+bool OgreGeometryBuffer::isQuadIndexingSupported() const
+{
+    return true;
+}
+
 // ------------------------------------ //
 int OgreGeometryBuffer::getVertexAttributeElementCount() const
 {
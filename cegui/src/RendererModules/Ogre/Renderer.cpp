@@ -61,6 +61,8 @@
 #include <OgreViewport.h>
 #include <OgreCamera.h>
 #include <OgreHardwareVertexBuffer.h>
+#include <OgreHardwareIndexBuffer.h>
+#include <OgreHardwareBufferManager.h>
 
 #ifdef CEGUI_USE_OGRE_COMPOSITOR2
 #include "CEGUI/WindowManager.h"
@@ -100,7 +102,8 @@
 #include <unordered_map>
 #include <sstream>
 
-#define VERTEXBUFFER_POOL_SIZE_STARTCLEAR           60
+//! Number of vertices the shared vertex buffers are created with.
+#define VERTEX_RING_INITIAL_VERTEX_COUNT            65536
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -151,8 +154,20 @@ typedef std::unordered_map<String, OgreTexture*> TextureMap;
 
 #ifdef CEGUI_USE_OGRE_HLMS
 typedef Ogre::v1::HardwareVertexBufferSharedPtr UsedOgreHWBuffer;
+typedef Ogre::v1::HardwareBuffer UsedOgreHWBufferType;
+typedef Ogre::v1::VertexData UsedOgreVertexData;
+typedef Ogre::v1::HardwareIndexBufferSharedPtr UsedOgreHWIndexBuffer;
+typedef Ogre::v1::HardwareIndexBuffer UsedOgreHWIndexBufferType;
+typedef Ogre::v1::HardwareBufferManager UsedOgreHWBufferManager;
+typedef Ogre::v1::IndexData UsedOgreIndexData;
 #else
 typedef Ogre::HardwareVertexBufferSharedPtr UsedOgreHWBuffer;
+typedef Ogre::HardwareBuffer UsedOgreHWBufferType;
+typedef Ogre::VertexData UsedOgreVertexData;
+typedef Ogre::HardwareIndexBufferSharedPtr UsedOgreHWIndexBuffer;
+typedef Ogre::HardwareIndexBuffer UsedOgreHWIndexBufferType;
+typedef Ogre::HardwareBufferManager UsedOgreHWBufferManager;
+typedef Ogre::IndexData UsedOgreIndexData;
 #endif //CEGUI_USE_OGRE_HLMS
 
 //----------------------------------------------------------------------------//
@@ -184,10 +199,30 @@ struct OgreRenderer_impl
         d_useGLSLES(false),
         d_useHLSL(false),
         d_useGLSLCore(false),
+        d_lockedVertexRing(0),
         d_texturedShaderWrapper(0),
-        d_colouredShaderWrapper(0)
+        d_colouredShaderWrapper(0),
+        d_quadIndexBufferQuadCount(0),
+        d_renderStatesInitialised(false),
+        d_textureStatesInitialised(false)
         {}
 
+    /*!
+    \brief
+        Dynamic vertex buffer shared by all GeometryBuffers with the same
+        vertex size. Vertices are appended behind the ones already written
+        this cycle, so the GPU never waits for data still in use; the buffer
+        is discarded once it is full.
+    */
+    struct VertexRing
+    {
+        VertexRing() : d_nextVertex(0) {}
+
+        UsedOgreHWBuffer d_buffer;
+        //! First vertex of the buffer that was not written since the last discard.
+        size_t d_nextVertex;
+    };
+
 
     //! String holding the renderer identification text.
     static String d_rendererID;
@@ -265,17 +300,24 @@ struct OgreRenderer_impl
     //! Whether we use the ARB glsl shaders or the OpenGL 3.2 Core shader profile (140 core)
     bool d_useGLSLCore;
 
-#ifdef CEGUI_USE_OGRE_HLMS
-    //! Vector containing vertex buffers that can be reused
-    std::vector<Ogre::v1::HardwareVertexBufferSharedPtr> d_vbPool;
-#else
-    //! Vector containing vertex buffers that can be reused
-    std::vector<Ogre::HardwareVertexBufferSharedPtr> d_vbPool;
-#endif //CEGUI_USE_OGRE_HLMS
+    //! Vertex buffers shared by all GeometryBuffers, keyed by vertex size in bytes
+    std::unordered_map<size_t, VertexRing> d_vertexRings;
+    //! The ring locked by the last call to lockVertexData
+    VertexRing* d_lockedVertexRing;
 
     OgreShaderWrapper* d_texturedShaderWrapper;
     OgreShaderWrapper* d_colouredShaderWrapper;
 
+    //! Index buffer shared by all GeometryBuffers that store quads of four vertices
+    UsedOgreHWIndexBuffer d_quadIndexBuffer;
+    //! Number of quads d_quadIndexBuffer contains indices for
+    size_t d_quadIndexBufferQuadCount;
+
+    //! Whether the fixed render states were set since beginRendering.
+    bool d_renderStatesInitialised;
+    //! Whether the texture unit states were set since beginRendering.
+    bool d_textureStatesInitialised;
+
 #ifdef CEGUI_USE_OGRE_COMPOSITOR2
     OgreRenderer::RenderingModes d_RenderingMode;
     std::vector<CEGUI::GUIContext*> d_ManualRenderingEveryFrame;
@@ -298,46 +340,46 @@ bool OgreRenderer_impl::s_compositorResourcesInitialized = false;
 #endif
 
 //----------------------------------------------------------------------------//
-void OgreRenderer::configureCeguiWindowForRTT(CEGUI::Window* window, const std::string& ogreTextureName, float textureWidth, float textureHeight)
-{
-    // We create a CEGUI Texture using the renderer you use:
-    CEGUI::Texture* texture;
-    if(isTextureDefined(ogreTextureName + "_CEGUI"))
-        texture = &getTexture(ogreTextureName + "_CEGUI");
-    else
-        texture = &createTexture(ogreTextureName + "_CEGUI");
-
-    // Now we need to cast it to the CEGUI::Texture superclass which matches your Renderer. This can be CEGUI::OgreTexture or CEGUI::OpenGLTexture, depending on the renderer you use in your application
-    CEGUI::OgreTexture& rendererTexture = static_cast<CEGUI::OgreTexture&>(*texture);
-
-    // Now we can set the appropriate Ogre::Texture for our CEGUI Texture
-#ifdef CEGUI_USE_OGRE_TEXTURE_GPU
-    Ogre::TextureGpu* ogreTexture = Ogre::Root::getSingleton().getRenderSystem()->getTextureGpuManager()->findTextureNoThrow(ogreTextureName);
-    if(!ogreTexture)
-        throw std::runtime_error("could not find RTT-texture (OgreRenderer::configureCeguiWindowForRTT)");
-#else
-    Ogre::TexturePtr ogreTexture = Ogre::TextureManager::getSingletonPtr()->getByName(ogreTextureName);
-    if(ogreTexture.isNull())
-        throw std::runtime_error("could not find RTT-texture (OgreRenderer::configureCeguiWindowForRTT)");
-#endif
-
-    rendererTexture.setOgreTexture(ogreTexture, false);
-
-    // We create a BasicImage and set the Texture
-    CEGUI::BitmapImage* image;
-    if(CEGUI::ImageManager::getSingleton().isDefined(ogreTextureName))
-        image = static_cast<CEGUI::BitmapImage*>(&CEGUI::ImageManager::getSingleton().get(ogreTextureName));
-    else
-        image = static_cast<CEGUI::BitmapImage*>(&CEGUI::ImageManager::getSingleton().create("BitmapImage", ogreTextureName));
-
-    image->setTexture(&rendererTexture);
-
-    //Flipping is necessary due to differences between renderers regarding top or bottom being the origin
-    CEGUI::Rectf imageArea = CEGUI::Rectf(0.0f, 0.0f, textureWidth, textureHeight);
-    image->setImageArea(imageArea);
-    image->setAutoScaled(CEGUI::AutoScaledMode::Disabled);
-
-    window->setProperty("Image", ogreTextureName);
+void OgreRenderer::configureCeguiWindowForRTT(CEGUI::Window* window, const std::string& ogreTextureName, float textureWidth, float textureHeight)
+{
+    // We create a CEGUI Texture using the renderer you use:
+    CEGUI::Texture* texture;
+    if(isTextureDefined(ogreTextureName + "_CEGUI"))
+        texture = &getTexture(ogreTextureName + "_CEGUI");
+    else
+        texture = &createTexture(ogreTextureName + "_CEGUI");
+
+    // Now we need to cast it to the CEGUI::Texture superclass which matches your Renderer. This can be CEGUI::OgreTexture or CEGUI::OpenGLTexture, depending on the renderer you use in your application
+    CEGUI::OgreTexture& rendererTexture = static_cast<CEGUI::OgreTexture&>(*texture);
+
+    // Now we can set the appropriate Ogre::Texture for our CEGUI Texture
+#ifdef CEGUI_USE_OGRE_TEXTURE_GPU
+    Ogre::TextureGpu* ogreTexture = Ogre::Root::getSingleton().getRenderSystem()->getTextureGpuManager()->findTextureNoThrow(ogreTextureName);
+    if(!ogreTexture)
+        throw std::runtime_error("could not find RTT-texture (OgreRenderer::configureCeguiWindowForRTT)");
+#else
+    Ogre::TexturePtr ogreTexture = Ogre::TextureManager::getSingletonPtr()->getByName(ogreTextureName);
+    if(ogreTexture.isNull())
+        throw std::runtime_error("could not find RTT-texture (OgreRenderer::configureCeguiWindowForRTT)");
+#endif
+
+    rendererTexture.setOgreTexture(ogreTexture, false);
+
+    // We create a BasicImage and set the Texture
+    CEGUI::BitmapImage* image;
+    if(CEGUI::ImageManager::getSingleton().isDefined(ogreTextureName))
+        image = static_cast<CEGUI::BitmapImage*>(&CEGUI::ImageManager::getSingleton().get(ogreTextureName));
+    else
+        image = static_cast<CEGUI::BitmapImage*>(&CEGUI::ImageManager::getSingleton().create("BitmapImage", ogreTextureName));
+
+    image->setTexture(&rendererTexture);
+
+    //Flipping is necessary due to differences between renderers regarding top or bottom being the origin
+    CEGUI::Rectf imageArea = CEGUI::Rectf(0.0f, 0.0f, textureWidth, textureHeight);
+    image->setImageArea(imageArea);
+    image->setAutoScaled(CEGUI::AutoScaledMode::Disabled);
+
+    window->setProperty("Image", ogreTextureName);
 }
 //----------------------------------------------------------------------------//
 OgreRenderer& OgreRenderer::bootstrapSystem(const int abi)
@@ -622,6 +664,8 @@ void OgreRenderer::destroyTextureTarget(TextureTarget* target)
 //----------------------------------------------------------------------------//
 void OgreRenderer::destroyAllTextureTargets()
 {
+    getTextureTargetPool().forgetAll();
+
     while (!d_pimpl->d_textureTargets.empty())
         destroyTextureTarget(*d_pimpl->d_textureTargets.begin());
 }
@@ -772,6 +816,15 @@ void OgreRenderer::beginRendering()
 
     if (d_pimpl->d_makeFrameControlCalls)
         d_pimpl->d_renderSystem->_beginFrame();
+
+    // the application rendered in between, so the states are set again once
+    d_pimpl->d_renderStatesInitialised = false;
+    d_pimpl->d_textureStatesInitialised = false;
+
+    // the first vertices of the frame discard the shared buffers
+    for (auto& ring : d_pimpl->d_vertexRings)
+        if (!OGRE_ISNULL(ring.second.d_buffer))
+            ring.second.d_nextVertex = ring.second.d_buffer->getNumVertices();
 }
 
 //----------------------------------------------------------------------------//
@@ -892,7 +945,7 @@ OgreRenderer::~OgreRenderer()
     destroyAllGeometryBuffers();
     destroyAllTextureTargets();
     destroyAllTextures();
-    clearVertexBufferPool();
+    d_pimpl->d_vertexRings.clear();
 
     delete d_pimpl;
 }
@@ -1491,6 +1544,16 @@ void OgreRenderer::initialiseRenderStateSettings()
     // d_pimpl->d_hlmsCache->clearState();
     d_pimpl->d_hlmsCache->setRenderTarget(target);
 #else
+    // The fixed states are only touched by the application, which can not
+    // render between beginRendering and endRendering; later activations of
+    // render targets within the same frame only need the scissor test reset
+    d_pimpl->d_renderSystem->setScissorTest(false);
+
+    if (d_pimpl->d_renderStatesInitialised)
+        return;
+
+    d_pimpl->d_renderStatesInitialised = true;
+
     // initialise render settings
     d_pimpl->d_renderSystem->setLightingEnabled(false);
     d_pimpl->d_renderSystem->_setDepthBufferParams(false, false);
@@ -1500,7 +1563,6 @@ void OgreRenderer::initialiseRenderStateSettings()
     d_pimpl->d_renderSystem->_setColourBufferWriteEnabled(true, true, true, true);
     d_pimpl->d_renderSystem->setShadingType(SO_GOURAUD);
     d_pimpl->d_renderSystem->_setPolygonMode(PM_SOLID);
-    d_pimpl->d_renderSystem->setScissorTest(false);
 
     // set alpha blending to known state
     setupRenderingBlendMode(BlendMode::Normal, true);
@@ -1632,122 +1694,105 @@ Ogre::SceneManager& OgreRenderer::getDummyScene() const{
 #endif
 
 //----------------------------------------------------------------------------//
-UsedOgreHWBuffer OgreRenderer::getVertexBuffer(size_t
-    min_size)
+void* OgreRenderer::lockVertexData(UsedOgreVertexData& vertex_data,
+    size_t vertex_count, size_t vertex_size)
 {
-    UsedOgreHWBuffer result(0);
-
-    if (d_pimpl->d_vbPool.empty())
-        return result;
+    OgreRenderer_impl::VertexRing& ring = d_pimpl->d_vertexRings[vertex_size];
 
-    size_t best_found = -1;
-    size_t best_over = -1;
+    const size_t capacity =
+        OGRE_ISNULL(ring.d_buffer) ? 0 : ring.d_buffer->getNumVertices();
 
-    // The vector is searched in reverse to find exact matches from the end
-    // which will allow popping the last element which is faster then removing
-    // the first one
-
-    for (size_t i = d_pimpl->d_vbPool.size(); --i > 0;)
+    if (vertex_count > capacity)
     {
-        // It seems that there can be nullptrs in the pool
-        UsedOgreHWBuffer current = d_pimpl->d_vbPool[i];
+        const size_t new_capacity = std::max(vertex_count,
+            std::max<size_t>(capacity * 2, VERTEX_RING_INITIAL_VERTEX_COUNT));
 
-        if (!current.get()){
+        ring.d_buffer = UsedOgreHWBufferManager::getSingleton().
+            createVertexBuffer(vertex_size, new_capacity,
+                UsedOgreHWBufferType::HBU_DYNAMIC_WRITE_ONLY_DISCARDABLE, false);
 
-            d_pimpl->d_vbPool.erase(d_pimpl->d_vbPool.begin()+i);
-            continue;
-        }
+        if (OGRE_ISNULL(ring.d_buffer))
+            throw RendererException("Failed to create Ogre vertex buffer, "
+                "probably because the vertex layout is invalid.");
 
-        size_t current_over = current->getNumVertices()-min_size;
-
-        // Perfect match stops searching instantly
-        if (current_over == 0)
-        {
-
-            best_found = i;
-            best_over = 0;
-            break;
-        }
-
-        if (current_over <= best_over)
-        {
-
-            best_over = current_over;
-            best_found = i;
-        }
+        ring.d_nextVertex = new_capacity;
     }
 
-    // If the smallest buffer is too large then none is found
-    // This will also be true if all buffers are too small
-    if (best_over > min_size*1.5f || best_found >= d_pimpl->d_vbPool.size())
-    {
-        // Clear if there are too many buffers
-        int over_size = d_pimpl->d_vbPool.size()-
-            VERTEXBUFFER_POOL_SIZE_STARTCLEAR;
+    // start over at the front once the buffer is full; discarding lets the
+    // driver hand out fresh memory while the GPU still reads the old one
+    const bool discard =
+        ring.d_nextVertex + vertex_count > ring.d_buffer->getNumVertices();
+    if (discard)
+        ring.d_nextVertex = 0;
 
-        if (over_size > 2)
-            cleanLargestVertexBufferPool(over_size);
+    void* data = ring.d_buffer->lock(ring.d_nextVertex * vertex_size,
+        vertex_count * vertex_size, discard ?
+            UsedOgreHWBufferType::HBL_DISCARD :
+            UsedOgreHWBufferType::HBL_NO_OVERWRITE);
 
-    } else {
+    if (!data)
+        throw RendererException("Failed to lock Ogre vertex buffer.");
 
-        result = d_pimpl->d_vbPool[best_found];
+    vertex_data.vertexBufferBinding->setBinding(0, ring.d_buffer);
+    vertex_data.vertexStart = ring.d_nextVertex;
+    vertex_data.vertexCount = vertex_count;
 
-        d_pimpl->d_vbPool.erase(d_pimpl->d_vbPool.begin()+best_found);
+    ring.d_nextVertex += vertex_count;
+    d_pimpl->d_lockedVertexRing = &ring;
 
-        // We want to avoid using too much memory
-        // even if matches are always found
-        int over_size = d_pimpl->d_vbPool.size()-
-            (VERTEXBUFFER_POOL_SIZE_STARTCLEAR*5);
-
-        if (over_size > 5)
-            cleanLargestVertexBufferPool(over_size/2);
-    }
-
-    return result;
-}
-
-void OgreRenderer::returnVertexBuffer(UsedOgreHWBuffer
-    buffer)
-{
-    d_pimpl->d_vbPool.push_back(buffer);
+    return data;
 }
 
-void OgreRenderer::clearVertexBufferPool()
+//----------------------------------------------------------------------------//
+void OgreRenderer::unlockVertexData()
 {
-    d_pimpl->d_vbPool.clear();
-}
+    if (!d_pimpl->d_lockedVertexRing)
+        return;
 
-bool hardwareBufferSizeLess(const UsedOgreHWBuffer &first,
-    const UsedOgreHWBuffer &second)
-{
-    return first->getNumVertices() < second->getNumVertices();
+    d_pimpl->d_lockedVertexRing->d_buffer->unlock();
+    d_pimpl->d_lockedVertexRing = 0;
 }
 
-void OgreRenderer::cleanLargestVertexBufferPool(size_t count)
+//----------------------------------------------------------------------------//
+void OgreRenderer::setupQuadIndexData(UsedOgreIndexData& index_data,
+    size_t quad_count)
 {
-    // The easiest way might be to sort the vector and delete the last count
-    // elements
-    std::sort(d_pimpl->d_vbPool.begin(), d_pimpl->d_vbPool.end(),
-        &hardwareBufferSizeLess);
-
-    // Adjust the count if there aren't enough elements to delete to avoid
-    // asserting
-    if (count >= d_pimpl->d_vbPool.size())
+    if (quad_count > d_pimpl->d_quadIndexBufferQuadCount)
     {
+        // The indices never change, so the buffer only grows. GeometryBuffers
+        // still holding the old buffer release it when they are set up again.
+        const size_t new_quad_count = std::max(quad_count,
+            d_pimpl->d_quadIndexBufferQuadCount * 2);
 
-        d_pimpl->d_vbPool.clear();
-    }
+        std::vector<std::uint32_t> indices;
+        GeometryBuffer::appendQuadIndices(indices, new_quad_count);
 
-    for (size_t i = 0; i < count; i++)
-    {
+        d_pimpl->d_quadIndexBuffer = UsedOgreHWBufferManager::getSingleton().
+            createIndexBuffer(UsedOgreHWIndexBufferType::IT_32BIT, indices.size(),
+                UsedOgreHWIndexBufferType::HBU_STATIC_WRITE_ONLY, false);
 
-        d_pimpl->d_vbPool.pop_back();
+        if (OGRE_ISNULL(d_pimpl->d_quadIndexBuffer))
+            throw RendererException("Failed to create Ogre quad index buffer.");
+
+        d_pimpl->d_quadIndexBuffer->writeData(0,
+            indices.size() * sizeof(std::uint32_t), &indices[0], true);
+        d_pimpl->d_quadIndexBufferQuadCount = new_quad_count;
     }
+
+    index_data.indexBuffer = d_pimpl->d_quadIndexBuffer;
+    index_data.indexStart = 0;
+    index_data.indexCount = quad_count * 6;
 }
 
 //----------------------------------------------------------------------------//
 void OgreRenderer::initialiseTextureStates()
 {
+    // CEGUI only ever uses the first texture unit with the same settings
+    if (d_pimpl->d_textureStatesInitialised)
+        return;
+
+    d_pimpl->d_textureStatesInitialised = true;
+
 #ifndef CEGUI_USE_OGRE_HLMS
     d_pimpl->d_renderSystem->_setTextureCoordCalculation(0, Ogre::TEXCALC_NONE);
     d_pimpl->d_renderSystem->_setTextureCoordSet(0, 0);
@@ -1808,16 +1853,16 @@ void OgreRenderer::renderGuiContext(CEGUI::GUIContext* guiContext)
     d_pimpl->mGUIContextToRenderManually = guiContext;	//configure to render just that one guiContext
 
     //Manual Render workspace:
-    d_pimpl->d_dummyScene->updateSceneGraph();
-    d_pimpl->d_workspace->_beginUpdate(true);
-    d_pimpl->d_workspace->_update();
-    d_pimpl->d_workspace->_endUpdate(true);
-#ifdef CEGUI_USE_OGRE_TEXTURE_GPU
-    Ogre::vector<Ogre::TextureGpu*>::type swappedTargets;
-#else
-    Ogre::vector<Ogre::RenderTarget*>::type swappedTargets;
-#endif
-    d_pimpl->d_workspace->_swapFinalTarget(swappedTargets);
+    d_pimpl->d_dummyScene->updateSceneGraph();
+    d_pimpl->d_workspace->_beginUpdate(true);
+    d_pimpl->d_workspace->_update();
+    d_pimpl->d_workspace->_endUpdate(true);
+#ifdef CEGUI_USE_OGRE_TEXTURE_GPU
+    Ogre::vector<Ogre::TextureGpu*>::type swappedTargets;
+#else
+    Ogre::vector<Ogre::RenderTarget*>::type swappedTargets;
+#endif
+    d_pimpl->d_workspace->_swapFinalTarget(swappedTargets);
     d_pimpl->d_dummyScene->clearFrameData();
 
     d_pimpl->mGUIContextToRenderManually = 0;
@@ -1834,10 +1879,10 @@ void OgreRenderer::addGuiContextToRenderEveryFrame(CEGUI::GUIContext* guiContext
 void OgreRenderer::removeGuiContextToRenderEveryFrame(CEGUI::GUIContext* guiContext)
 {
     if(!guiContext)
-        return;
-
-    std::vector<CEGUI::GUIContext*>::iterator iter = std::find(d_pimpl->d_ManualRenderingEveryFrame.begin(), d_pimpl->d_ManualRenderingEveryFrame.end(), guiContext);
-    if(iter != d_pimpl->d_ManualRenderingEveryFrame.end())
+        return;
+
+    std::vector<CEGUI::GUIContext*>::iterator iter = std::find(d_pimpl->d_ManualRenderingEveryFrame.begin(), d_pimpl->d_ManualRenderingEveryFrame.end(), guiContext);
+    if(iter != d_pimpl->d_ManualRenderingEveryFrame.end())
         d_pimpl->d_ManualRenderingEveryFrame.erase(iter);
 }
 //----------------------------------------------------------------------------//
@@ -46,12 +46,22 @@ OpenGLInfo::OpenGLInfo() :
     d_verMajorForce(-1),
     d_verMinorForce(-1),
     d_isS3tcSupported(false),
+    d_isBptcSupported(false),
+    d_isEtc2Supported(false),
+    d_isAstcSupported(false),
     d_isNpotTextureSupported(false),
     d_isReadBufferSupported(false),
     d_isPolygonModeSupported(false),
     d_isSeperateReadAndDrawFramebufferSupported(false),
     d_isVaoSupported(false),
-    d_isSizedInternalFormatSupported(false)
+    d_isSizedInternalFormatSupported(false),
+    d_isBufferStorageSupported(false),
+    d_isInstancedArraysSupported(false),
+    d_isMapBufferRangeSupported(false),
+    d_isFenceSyncSupported(false),
+    d_isElementIndexUintSupported(false),
+    d_isGenerateMipmapSupported(false),
+    d_isPixelBufferObjectSupported(false)
 {
 }
 
@@ -107,6 +117,17 @@ void OpenGLInfo::initSupportedFeatures()
 #if defined CEGUI_USE_EPOXY
 
     d_isS3tcSupported = epoxy_has_gl_extension("GL_EXT_texture_compression_s3tc");
+    d_isBptcSupported =
+          (isUsingDesktopOpengl() && verAtLeast(4, 2))
+      ||  epoxy_has_gl_extension("GL_ARB_texture_compression_bptc")
+      ||  epoxy_has_gl_extension("GL_EXT_texture_compression_bptc");
+    d_isEtc2Supported =
+          (isUsingDesktopOpengl() && verAtLeast(4, 3))
+      ||  (isUsingOpenglEs() && verMajor() >= 3)
+      ||  epoxy_has_gl_extension("GL_ARB_ES3_compatibility");
+    d_isAstcSupported =
+          (isUsingOpenglEs() && verAtLeast(3, 2))
+      ||  epoxy_has_gl_extension("GL_KHR_texture_compression_astc_ldr");
     d_isNpotTextureSupported =
           (isUsingDesktopOpengl()  &&  verMajor() >= 2)
       ||  (isUsingOpenglEs() && verMajor() >= 3)
@@ -120,10 +141,40 @@ void OpenGLInfo::initSupportedFeatures()
       ||  (isUsingOpenglEs() && verMajor() >= 3);
     d_isVaoSupported =     (isUsingDesktopOpengl() && verAtLeast(3, 2))
                        ||  (isUsingOpenglEs() && verMajor() >= 3);
+    d_isBufferStorageSupported =
+          isUsingDesktopOpengl()
+      &&  (verAtLeast(4, 4) || epoxy_has_gl_extension("GL_ARB_buffer_storage"));
+    d_isInstancedArraysSupported =
+          (isUsingDesktopOpengl() && verAtLeast(3, 3))
+      ||  (isUsingOpenglEs() && verMajor() >= 3);
+    d_isMapBufferRangeSupported =
+          (isUsingDesktopOpengl() && verAtLeast(3, 0))
+      ||  (isUsingOpenglEs() && verMajor() >= 3)
+      ||  epoxy_has_gl_extension("GL_ARB_map_buffer_range")
+      ||  epoxy_has_gl_extension("GL_EXT_map_buffer_range");
+    d_isFenceSyncSupported =
+          (isUsingDesktopOpengl() && verAtLeast(3, 2))
+      ||  (isUsingOpenglEs() && verMajor() >= 3)
+      ||  epoxy_has_gl_extension("GL_ARB_sync");
+    d_isElementIndexUintSupported =
+          isUsingDesktopOpengl()
+      ||  verMajor() >= 3
+      ||  epoxy_has_gl_extension("GL_OES_element_index_uint");
+    d_isGenerateMipmapSupported =
+          (isUsingDesktopOpengl() && verAtLeast(3, 0))
+      ||  isUsingOpenglEs()
+      ||  epoxy_has_gl_extension("GL_ARB_framebuffer_object");
+    d_isPixelBufferObjectSupported =
+          (isUsingDesktopOpengl() && verAtLeast(2, 1))
+      ||  (isUsingOpenglEs() && verMajor() >= 3)
+      ||  epoxy_has_gl_extension("GL_ARB_pixel_buffer_object");
       
 #elif defined CEGUI_USE_GLEW
 
     d_isS3tcSupported = false;
+    d_isBptcSupported = (GLEW_VERSION_4_2 == GL_TRUE);
+    d_isEtc2Supported = (GLEW_VERSION_4_3 == GL_TRUE);
+    d_isAstcSupported = false;
     glGetError();
 
     // Why do we do this and not use GLEW_EXT_texture_compression_s3tc?
@@ -138,13 +189,17 @@ void OpenGLInfo::initSupportedFeatures()
         {
             const char* extension
               (reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i)));
-            if ((glGetError() == GL_NO_ERROR)  &&
-                extension  &&
-                !std::strcmp(extension, "GL_EXT_texture_compression_s3tc"))
-            {
+            if ((glGetError() != GL_NO_ERROR)  ||  !extension)
+                continue;
+
+            if (!std::strcmp(extension, "GL_EXT_texture_compression_s3tc"))
                 d_isS3tcSupported = true;
-                break;
-            }
+            else if (!std::strcmp(extension, "GL_ARB_texture_compression_bptc"))
+                d_isBptcSupported = true;
+            else if (!std::strcmp(extension, "GL_ARB_ES3_compatibility"))
+                d_isEtc2Supported = true;
+            else if (!std::strcmp(extension, "GL_KHR_texture_compression_astc_ldr"))
+                d_isAstcSupported = true;
         }
     }
     
@@ -155,6 +210,18 @@ void OpenGLInfo::initSupportedFeatures()
       = (GLEW_VERSION_1_3 == GL_TRUE);
     d_isSeperateReadAndDrawFramebufferSupported = (GLEW_VERSION_3_1 == GL_TRUE);
     d_isVaoSupported = (GLEW_VERSION_3_2 == GL_TRUE);
+    d_isBufferStorageSupported = (GLEW_VERSION_4_4 == GL_TRUE)
+      ||  (GLEW_ARB_buffer_storage == GL_TRUE);
+    d_isInstancedArraysSupported = (GLEW_VERSION_3_3 == GL_TRUE);
+    d_isMapBufferRangeSupported = (GLEW_VERSION_3_0 == GL_TRUE)
+      ||  (GLEW_ARB_map_buffer_range == GL_TRUE);
+    d_isFenceSyncSupported = (GLEW_VERSION_3_2 == GL_TRUE)
+      ||  (GLEW_ARB_sync == GL_TRUE);
+    d_isElementIndexUintSupported = true;
+    d_isGenerateMipmapSupported = (GLEW_VERSION_3_0 == GL_TRUE)
+      ||  (GLEW_ARB_framebuffer_object == GL_TRUE);
+    d_isPixelBufferObjectSupported = (GLEW_VERSION_2_1 == GL_TRUE)
+      ||  (GLEW_ARB_pixel_buffer_object == GL_TRUE);
     
 #endif
 
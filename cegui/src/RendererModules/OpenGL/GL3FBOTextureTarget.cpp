@@ -73,7 +73,15 @@ OpenGL3FBOTextureTarget::~OpenGL3FBOTextureTarget()
 //----------------------------------------------------------------------------//
 void OpenGL3FBOTextureTarget::declareRenderSize(const Sizef& sz)
 {
-    setArea(Rectf(d_area.getPosition(), d_owner.getAdjustedTextureSize(sz)));
+    const Sizef adjustedSize(d_owner.getAdjustedTextureSize(
+        d_growthPolicy.getStorageSize(d_area.getSize(), sz)));
+
+    // keep the texture while it can hold the content, e.g. during resizing or
+    // when reused from the pool; the content is drawn to its top left part
+    if (d_area.getSize() == adjustedSize)
+        return;
+
+    setArea(Rectf(d_area.getPosition(), adjustedSize));
     resizeRenderTexture();
 }
 
@@ -138,6 +146,44 @@ void OpenGL3FBOTextureTarget::clear()
     glClearColor(old_col[0], old_col[1], old_col[2], old_col[3]);
 }
 
+//----------------------------------------------------------------------------//
+void OpenGL3FBOTextureTarget::clearArea(const Rectf& area)
+{
+    const Rectf region(getPixelRegion(area).getIntersection(
+        Rectf(glm::vec2(0, 0), d_area.getSize())));
+    const GLint w = static_cast<GLint>(region.getWidth());
+    const GLint h = static_cast<GLint>(region.getHeight());
+    if (w < 1 || h < 1)
+        return;
+
+    // save old clear colour
+    GLfloat old_col[4];
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, old_col);
+
+    // remember previously bound FBO to make sure we set it back
+    GLuint previousFBO = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING,
+            reinterpret_cast<GLint*>(&previousFBO));
+
+    glBindFramebuffer(GL_FRAMEBUFFER, d_frameBuffer);
+
+    // same mapping as the scissor rectangles of the geometry buffers
+    d_glStateChanger->scissor(static_cast<GLint>(region.left()),
+        static_cast<GLint>(d_area.getHeight() - region.bottom()), w, h);
+    d_glStateChanger->enable(GL_SCISSOR_TEST);
+    glClearColor(0.f, 0.f, 0.f, 0.f);
+
+    if(!d_usesStencil)
+        glClear(GL_COLOR_BUFFER_BIT);
+    else
+        glClear(GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+
+    d_glStateChanger->disable(GL_SCISSOR_TEST);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, previousFBO);
+    glClearColor(old_col[0], old_col[1], old_col[2], old_col[3]);
+}
+
 //----------------------------------------------------------------------------//
 void OpenGL3FBOTextureTarget::initialiseRenderTexture()
 {
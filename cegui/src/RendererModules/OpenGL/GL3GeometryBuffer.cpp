@@ -28,6 +28,7 @@
 #include "CEGUI/RendererModules/OpenGL/GL3GeometryBuffer.h"
 #include "CEGUI/RendererModules/OpenGL/GL3Renderer.h"
 #include "CEGUI/RenderMaterial.h"
+#include "CEGUI/RenderTarget.h"
 #include "CEGUI/RenderEffect.h"
 #include "CEGUI/Vertex.h"
 #include "CEGUI/ShaderParameterBindings.h"
@@ -39,6 +40,7 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
 
 #define BUFFER_OFFSET(i) ((char *)NULL + (i))
 
@@ -63,20 +65,167 @@ OpenGL3GeometryBuffer::~OpenGL3GeometryBuffer()
 void OpenGL3GeometryBuffer::draw(std::uint32_t drawModeMask) const
 {
     CEGUI_UNUSED(drawModeMask);
-    
-    if (d_vertexData.empty())
+
+    if (d_vertexData.empty() && d_quadInstanceData.empty())
         return;
 
+    drawVertices(1, d_vertexCount);
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGL3GeometryBuffer::isBatchableWith(const GeometryBuffer& next) const
+{
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+    // batches are drawn from the renderer's shared VBO, so merging requires a
+    // VAO that is bound once for the whole run
+    if (!OpenGLInfo::getSingleton().isVaoSupported())
+        return false;
+
+    const OpenGL3GeometryBuffer& other = static_cast<const OpenGL3GeometryBuffer&>(next);
+
+    if (d_vertexData.empty() || other.d_vertexData.empty())
+        return false;
+
+    // instances are drawn with a draw call of their own
+    if (!d_quadInstanceData.empty() || !other.d_quadInstanceData.empty())
+        return false;
+
+    if (isUsingQuadIndices() != other.isUsingQuadIndices())
+        return false;
+
+    // effects and stencil based fill rules need per-buffer draw calls
+    if (d_effect || other.d_effect ||
+        d_polygonFillRule != PolygonFillRule::NoFilling ||
+        other.d_polygonFillRule != PolygonFillRule::NoFilling)
+        return false;
+
+    // the other buffer's vertices must directly follow ours in the shared VBO
+    if (getVertexAttributeElementCount() != other.getVertexAttributeElementCount() ||
+        d_verticesVBOPosition + d_vertexCount != other.d_verticesVBOPosition)
+        return false;
+
+    if (!hasEquivalentBlendMode(other) || d_alpha != other.d_alpha)
+        return false;
+
+    if (!hasEquivalentClipping(other))
+        return false;
+
+    if (!hasEquivalentClippingMask(other))
+        return false;
+
+    if (d_translation != other.d_translation || d_rotation != other.d_rotation ||
+        d_scale != other.d_scale || d_pivot != other.d_pivot ||
+        d_customTransform != other.d_customTransform ||
+        d_layerColours != other.d_layerColours)
+        return false;
+
+    return hasEquivalentMaterial(other);
+#else
+    CEGUI_UNUSED(next);
+    return false;
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::drawBatch(std::size_t bufferCount,
+                                      std::size_t vertexCount,
+                                      std::uint32_t drawModeMask) const
+{
+    CEGUI_UNUSED(drawModeMask);
+
+    drawVertices(bufferCount, vertexCount);
+}
+
+//----------------------------------------------------------------------------//
+const glm::mat4& OpenGL3GeometryBuffer::getModelViewProjectionMatrix() const
+{
+    updateMatrix();
+    return d_matrix;
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGL3GeometryBuffer::hasEquivalentMaterial(const OpenGL3GeometryBuffer& other) const
+{
+    if (d_renderMaterial == other.d_renderMaterial)
+        return true;
+
+    if (d_renderMaterial->getShaderWrapper() != other.d_renderMaterial->getShaderWrapper())
+        return false;
+
+    // the matrix, alpha, per-draw slot, clipping mask and layer colour uniforms
+    // are set by each buffer from its own state, which was already compared; the
+    // premultiplied alpha uniform is the same for all buffers
+    static const std::string matrixParamName("modelViewProjMatrix");
+    static const std::string alphaParamName("alphaFactor");
+    static const std::string drawSlotParamName("drawSlot");
+    static const std::string premultipliedParamName("premultipliedAlpha");
+    static const std::string clipMaskParamName("clipMask");
+    static const std::string clipMaskTextureParamName("clipMaskTexture");
+    static const std::string layerColoursParamName("layerColours");
+    const auto isBufferParameter = [&](const std::string& name)
+    {
+        return name == matrixParamName || name == alphaParamName ||
+               name == drawSlotParamName || name == premultipliedParamName ||
+               name == clipMaskParamName || name == clipMaskTextureParamName ||
+               name == layerColoursParamName;
+    };
+
+    const ShaderParameterBindings::ShaderParameterBindingsMap& ours =
+        d_renderMaterial->getShaderParamBindings()->getShaderParameterBindings();
+    const ShaderParameterBindings::ShaderParameterBindingsMap& theirs =
+        other.d_renderMaterial->getShaderParamBindings()->getShaderParameterBindings();
+
+    // both maps are sorted by name, which allows a single lockstep pass
+    auto ourIter = ours.begin();
+    auto theirIter = theirs.begin();
+    while (true)
+    {
+        while (ourIter != ours.end() && isBufferParameter(ourIter->first))
+            ++ourIter;
+        while (theirIter != theirs.end() && isBufferParameter(theirIter->first))
+            ++theirIter;
+
+        if (ourIter == ours.end() || theirIter == theirs.end())
+            return ourIter == ours.end() && theirIter == theirs.end();
+
+        if (ourIter->first != theirIter->first)
+            return false;
+
+        const ShaderParameter* ourParam = ourIter->second;
+        const ShaderParameter* theirParam = theirIter->second;
+        if (ourParam != theirParam &&
+            (!ourParam || !theirParam || !ourParam->equal(theirParam)))
+            return false;
+
+        ++ourIter;
+        ++theirIter;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::drawVertices(std::size_t bufferCount,
+                                         std::size_t vertexCount) const
+{
+    OpenGL3Renderer& owner = static_cast<OpenGL3Renderer&>(d_owner);
+
+    // textures updated during the frame, such as glyph pages, must be complete
+    owner.flushTextureUploads();
+
+    const std::size_t drawCallCount = owner.d_drawCallCount;
+    const std::size_t stateChangeCount = d_glStateChanger->getStatistics().d_issuedStateChanges;
+
     if (d_clippingActive)
     {
         // Skip completely clipped geometry
-        const GLint w = static_cast<GLint>(d_preparedClippingRegion.getWidth());
-        const GLint h = static_cast<GLint>(d_preparedClippingRegion.getHeight());
+        const Rectf clipRegion(owner.getActiveRenderTarget()->getPixelRegion(
+            getPreparedClippingRegion()));
+        const GLint w = static_cast<GLint>(clipRegion.getWidth());
+        const GLint h = static_cast<GLint>(clipRegion.getHeight());
         if (!w || !h)
             return;
 
-        d_glStateChanger->scissor(static_cast<GLint>(d_preparedClippingRegion.left()),
-            static_cast<GLint>(d_owner.getActiveViewPort().getHeight() - d_preparedClippingRegion.bottom()),
+        d_glStateChanger->scissor(static_cast<GLint>(clipRegion.left()),
+            static_cast<GLint>(d_owner.getActiveViewPort().getHeight() - clipRegion.bottom()),
             w, h);
 
         d_glStateChanger->enable(GL_SCISSOR_TEST);
@@ -84,40 +233,45 @@ void OpenGL3GeometryBuffer::draw(std::uint32_t drawModeMask) const
     else
         d_glStateChanger->disable(GL_SCISSOR_TEST);
 
-    // Update the model view projection matrix
-    updateMatrix();
+    ++owner.d_batchCount;
+    owner.d_drawnGeometryBufferCount += bufferCount;
 
     CEGUI::ShaderParameterBindings* shaderParameterBindings = (*d_renderMaterial).getShaderParamBindings();
 
-    // Set the uniform variables for this GeometryBuffer in the Shader
-    shaderParameterBindings->setParameter("modelViewProjMatrix", d_matrix);
-    shaderParameterBindings->setParameter("alphaFactor", d_alpha);
-
-    // activate desired blending mode
-    d_owner.setupRenderingBlendMode(d_blendMode);
+    // The matrix and alpha of buffers uploaded to the per-draw data buffer
+    // are selected by their slot, otherwise they are set as uniforms
+    const GLint drawSlot = owner.preparePerDrawSlot(*this);
+    shaderParameterBindings->setParameter("premultipliedAlpha",
+        owner.isPremultipliedAlphaEnabled() ? 1.0f : 0.0f);
+    if (drawSlot >= 0)
+        shaderParameterBindings->setParameter("drawSlot", drawSlot);
 
-    if (OpenGLInfo::getSingleton().isVaoSupported())
+    if (drawSlot <= 0)
     {
-#ifdef CEGUI_OPENGL_BIG_BUFFER
-        if(getVertexAttributeElementCount() == 9) // todo: d_renderMaterial->d_type?
-        {
-            d_glStateChanger->bindVertexArray(static_cast<OpenGL3Renderer&>(d_owner).d_verticesTexturedVAO);
-        }
-        else
-        {
-            d_glStateChanger->bindVertexArray(static_cast<OpenGL3Renderer&>(d_owner).d_verticesSolidVAO);
-        }
-#else
-        // Bind our vao
-        d_glStateChanger->bindVertexArray(d_verticesVAO);
-#endif
+        // Update the model view projection matrix
+        updateMatrix();
+
+        shaderParameterBindings->setParameter("modelViewProjMatrix", d_matrix);
+        shaderParameterBindings->setParameter("alphaFactor", d_alpha);
     }
-    else
+
+    // the mask uniforms are shared by all buffers using the shader, so buffers
+    // without a mask reset them as well
+    if (isClippingMaskSupported())
     {
-        // This binds and sets up a vbo for rendering
-        finaliseVertexAttributes();
+        shaderParameterBindings->setParameter("clipMask", getClippingMaskMatrix());
+        if (d_clippingMaskType == ClippingMaskType::Texture)
+            shaderParameterBindings->setParameter("clipMaskTexture", d_clippingMaskTexture);
+        else
+            shaderParameterBindings->removeParameter("clipMaskTexture");
     }
 
+    if (d_renderMaterial->getShaderWrapper() == owner.d_shaderWrapperLayeredGlyph)
+        shaderParameterBindings->setParameter("layerColours", d_layerColours);
+
+    // activate desired blending mode
+    d_owner.setupRenderingBlendMode(d_blendMode);
+
     const int pass_count = d_effect ? d_effect->getPassCount() : 1;
     for (int pass = 0; pass < pass_count; ++pass)
     {
@@ -125,26 +279,266 @@ void OpenGL3GeometryBuffer::draw(std::uint32_t drawModeMask) const
         if (d_effect)
             d_effect->performPreRenderFunctions(pass);
 
-        d_renderMaterial->prepareForRendering();
+        if (vertexCount > 0)
+        {
+            if (OpenGLInfo::getSingleton().isVaoSupported())
+            {
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+                if(getVertexAttributeElementCount() == 9) // todo: d_renderMaterial->d_type?
+                {
+                    d_glStateChanger->bindVertexArray(owner.d_verticesTexturedVAO);
+                }
+                else
+                {
+                    d_glStateChanger->bindVertexArray(owner.d_verticesSolidVAO);
+                }
+#else
+                // Bind our vao
+                d_glStateChanger->bindVertexArray(d_verticesVAO);
+#endif
+            }
+            else
+            {
+                // This binds and sets up a vbo for rendering
+                finaliseVertexAttributes();
+            }
+
+            d_renderMaterial->prepareForRendering();
+
+            // draw the geometry
+            drawDependingOnFillRule(vertexCount);
+        }
 
-        // draw the geometry
-        drawDependingOnFillRule();
+        if (!d_quadInstanceData.empty())
+            drawQuadInstances();
     }
 
     // clean up RenderEffect
     if (d_effect)
         d_effect->performPostRenderFunctions();
 
+    FrameStats& stats = owner.getCurrentFrameStats();
+    stats.d_drawCalls += owner.d_drawCallCount - drawCallCount;
+    stats.d_verticesDrawn += vertexCount * static_cast<std::size_t>(pass_count);
+    stats.d_stateChanges +=
+        d_glStateChanger->getStatistics().d_issuedStateChanges - stateChangeCount;
+
     updateRenderTargetData(d_owner.getActiveRenderTarget());
 }
 
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::drawQuadInstances() const
+{
+    OpenGL3Renderer& owner = static_cast<OpenGL3Renderer&>(d_owner);
+
+    if (!d_quadInstanceVAO)
+        initialiseQuadInstanceBuffers();
+
+    d_glStateChanger->bindVertexArray(d_quadInstanceVAO);
+
+    if (d_quadInstanceDataDirty)
+    {
+        const std::size_t dataSize = d_quadInstanceData.size() * sizeof(float);
+
+        d_glStateChanger->bindBuffer(GL_ARRAY_BUFFER, d_quadInstanceVBO);
+        if (dataSize > d_quadInstanceVBOSize)
+        {
+            glBufferData(GL_ARRAY_BUFFER, dataSize, d_quadInstanceData.data(), GL_DYNAMIC_DRAW);
+            d_quadInstanceVBOSize = dataSize;
+        }
+        else
+        {
+            glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, d_quadInstanceData.data());
+        }
+        d_glStateChanger->bindBuffer(GL_ARRAY_BUFFER, 0);
+
+        d_quadInstanceDataDirty = false;
+    }
+
+    // the instanced shader reads the same texture, matrix and alpha
+    // parameters as the standard textured one
+    owner.d_shaderWrapperTexturedInstanced->prepareForRendering(
+        d_renderMaterial->getShaderParamBindings());
+
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 6,
+        static_cast<GLsizei>(getQuadInstanceCount()));
+    ++owner.d_drawCallCount;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::initialiseQuadInstanceBuffers() const
+{
+    OpenGL3Renderer& owner = static_cast<OpenGL3Renderer&>(d_owner);
+    const OpenGLBaseShaderWrapper* shader_wrapper = owner.d_shaderWrapperTexturedInstanced;
+
+    glGenVertexArrays(1, &d_quadInstanceVAO);
+    d_glStateChanger->bindVertexArray(d_quadInstanceVAO);
+
+    // per vertex corner of the quad
+    d_glStateChanger->bindBuffer(GL_ARRAY_BUFFER, owner.d_quadCornerVBO);
+    GLint corner_loc = shader_wrapper->getAttributeLocation("inCorner");
+    glEnableVertexAttribArray(corner_loc);
+    glVertexAttribPointer(corner_loc, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GLfloat), BUFFER_OFFSET(0));
+
+    // per instance rects and colour
+    glGenBuffers(1, &d_quadInstanceVBO);
+    d_glStateChanger->bindBuffer(GL_ARRAY_BUFFER, d_quadInstanceVBO);
+
+    const GLsizei stride = QuadInstanceElementCount * sizeof(GLfloat);
+    static const char* const attributeNames[] = { "inRect", "inTexRect", "inColour" };
+    for (int i = 0; i < 3; ++i)
+    {
+        GLint attribute_loc = shader_wrapper->getAttributeLocation(attributeNames[i]);
+        glEnableVertexAttribArray(attribute_loc);
+        glVertexAttribPointer(attribute_loc, 4, GL_FLOAT, GL_FALSE, stride, BUFFER_OFFSET(i * 4 * sizeof(GLfloat)));
+        glVertexAttribDivisor(attribute_loc, 1);
+    }
+
+    d_glStateChanger->bindVertexArray(0);
+    d_glStateChanger->bindBuffer(GL_ARRAY_BUFFER, 0);
+
+    d_quadInstanceVBOSize = 0;
+    d_quadInstanceDataDirty = true;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::appendQuadInstance(const Rectf& destRect,
+                                               const Rectf& texRect,
+                                               const Colour& colour)
+{
+    // instances can not be drawn in between vertices
+    if (!isQuadInstancingSupported() || d_vertexCount != 0)
+    {
+        OpenGLGeometryBufferBase::appendQuadInstance(destRect, texRect, colour);
+        return;
+    }
+
+    const float instance[QuadInstanceElementCount] =
+    {
+        destRect.left(), destRect.top(), destRect.right(), destRect.bottom(),
+        texRect.left(), texRect.top(), texRect.right(), texRect.bottom(),
+        colour.getRed(), colour.getGreen(), colour.getBlue(), colour.getAlpha()
+    };
+
+    d_quadInstanceData.insert(d_quadInstanceData.end(), instance,
+                              instance + QuadInstanceElementCount);
+    d_quadInstanceDataDirty = true;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::convertQuadInstancesToVertices()
+{
+    if (d_quadInstanceData.empty())
+        return;
+
+    std::vector<float> instances;
+    instances.swap(d_quadInstanceData);
+    d_quadInstanceDataDirty = true;
+
+    for (std::size_t i = 0; i + QuadInstanceElementCount <= instances.size(); i += QuadInstanceElementCount)
+    {
+        const float* instance = &instances[i];
+        OpenGLGeometryBufferBase::appendQuadInstance(
+            Rectf(instance[0], instance[1], instance[2], instance[3]),
+            Rectf(instance[4], instance[5], instance[6], instance[7]),
+            Colour(instance[8], instance[9], instance[10], instance[11]));
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGL3GeometryBuffer::isQuadInstancingSupported() const
+{
+    // instances share the material of the textured vertices
+    const OpenGL3Renderer& owner = static_cast<OpenGL3Renderer&>(d_owner);
+    return owner.isQuadInstancingSupported() && getVertexAttributeElementCount() == 9 &&
+           d_renderMaterial->getShaderWrapper() == owner.d_shaderWrapperTextured;
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGL3GeometryBuffer::isClippingMaskSupported() const
+{
+    const OpenGL3Renderer& owner = static_cast<OpenGL3Renderer&>(d_owner);
+    const ShaderWrapper* shader_wrapper = d_renderMaterial->getShaderWrapper();
+    return shader_wrapper == owner.d_shaderWrapperTextured ||
+           shader_wrapper == owner.d_shaderWrapperSolid ||
+           (shader_wrapper && shader_wrapper == owner.d_shaderWrapperDistanceField) ||
+           (shader_wrapper && shader_wrapper == owner.d_shaderWrapperLayeredGlyph);
+}
+
+//----------------------------------------------------------------------------//
+std::size_t OpenGL3GeometryBuffer::getQuadInstanceCount() const
+{
+    return d_quadInstanceData.size() / QuadInstanceElementCount;
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGL3GeometryBuffer::isQuadIndexingSupported() const
+{
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+    return static_cast<OpenGL3Renderer&>(d_owner).d_quadIndexBuffer != 0;
+#else
+    return false;
+#endif
+}
+
 //----------------------------------------------------------------------------//
 void OpenGL3GeometryBuffer::reset()
 {
     OpenGLGeometryBufferBase::reset();
+    d_quadInstanceData.clear();
+    d_quadInstanceDataDirty = true;
     updateOpenGLBuffers();
 }
 
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::copyGeometryFrom(const GeometryBuffer& source)
+{
+    OpenGLGeometryBufferBase::copyGeometryFrom(source);
+
+    d_quadInstanceData = static_cast<const OpenGL3GeometryBuffer&>(source).d_quadInstanceData;
+    d_quadInstanceDataDirty = true;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::copyClippedGeometryFrom(const GeometryBuffer& source,
+                                                    const Rectf& clip_rect)
+{
+    OpenGLGeometryBufferBase::copyClippedGeometryFrom(source, clip_rect);
+
+    // instances are rectangles, so only their texture rects need adjusting
+    const std::vector<float>& instances =
+        static_cast<const OpenGL3GeometryBuffer&>(source).d_quadInstanceData;
+
+    d_quadInstanceData.clear();
+    for (std::size_t i = 0; i + QuadInstanceElementCount <= instances.size(); i += QuadInstanceElementCount)
+    {
+        const float* instance = &instances[i];
+        const Rectf dest(instance[0], instance[1], instance[2], instance[3]);
+        const Rectf clipped(dest.getIntersection(clip_rect));
+        if (clipped.getWidth() <= 0.0f || clipped.getHeight() <= 0.0f)
+            continue;
+
+        const float texScaleX = (instance[6] - instance[4]) / dest.getWidth();
+        const float texScaleY = (instance[7] - instance[5]) / dest.getHeight();
+
+        float clippedInstance[QuadInstanceElementCount];
+        std::copy(instance, instance + QuadInstanceElementCount, clippedInstance);
+        clippedInstance[0] = clipped.left();
+        clippedInstance[1] = clipped.top();
+        clippedInstance[2] = clipped.right();
+        clippedInstance[3] = clipped.bottom();
+        clippedInstance[4] = instance[4] + (clipped.left() - dest.left()) * texScaleX;
+        clippedInstance[5] = instance[5] + (clipped.top() - dest.top()) * texScaleY;
+        clippedInstance[6] = instance[4] + (clipped.right() - dest.left()) * texScaleX;
+        clippedInstance[7] = instance[5] + (clipped.bottom() - dest.top()) * texScaleY;
+
+        d_quadInstanceData.insert(d_quadInstanceData.end(), clippedInstance,
+                                  clippedInstance + QuadInstanceElementCount);
+    }
+
+    d_quadInstanceDataDirty = true;
+}
+
 //----------------------------------------------------------------------------//
 void OpenGL3GeometryBuffer::initialiseVertexBuffers()
 {
@@ -237,6 +631,17 @@ void OpenGL3GeometryBuffer::finaliseVertexAttributes() const
 //----------------------------------------------------------------------------//
 void OpenGL3GeometryBuffer::deinitialiseOpenGLBuffers()
 {
+    if (d_quadInstanceVAO)
+    {
+        d_glStateChanger->bindVertexArray(0);
+        glDeleteVertexArrays(1, &d_quadInstanceVAO);
+    }
+    if (d_quadInstanceVBO)
+    {
+        d_glStateChanger->bindBuffer(GL_ARRAY_BUFFER, 0);
+        glDeleteBuffers(1, &d_quadInstanceVBO);
+    }
+
 #ifndef CEGUI_OPENGL_BIG_BUFFER
     if (OpenGLInfo::getSingleton().isVaoSupported())
         glDeleteVertexArrays(1, &d_verticesVAO);
@@ -287,14 +692,37 @@ void OpenGL3GeometryBuffer::appendGeometry(const float* vertex_data, std::size_t
 }
 
 //----------------------------------------------------------------------------//
-void OpenGL3GeometryBuffer::drawDependingOnFillRule() const
+void OpenGL3GeometryBuffer::drawDependingOnFillRule(std::size_t vertexCount) const
 {
+    std::size_t& drawCallCount = static_cast<OpenGL3Renderer&>(d_owner).d_drawCallCount;
+
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+    if (isUsingQuadIndices())
+    {
+        d_glStateChanger->disable(GL_CULL_FACE);
+        d_glStateChanger->disable(GL_STENCIL_TEST);
+
+        // without a VAO the element array binding is not retained
+        if (!OpenGLInfo::getSingleton().isVaoSupported())
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,
+                         static_cast<OpenGL3Renderer&>(d_owner).d_quadIndexBuffer);
+
+        // indexed quads are placed at multiples of four vertices by the renderer
+        const std::size_t first_index = d_verticesVBOPosition / 4 * 6;
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(vertexCount / 4 * 6), GL_UNSIGNED_INT,
+                       BUFFER_OFFSET(first_index * sizeof(GLuint)));
+        ++drawCallCount;
+        return;
+    }
+#endif
+
     if(d_polygonFillRule == PolygonFillRule::NoFilling)
     {
         d_glStateChanger->disable(GL_CULL_FACE);
         d_glStateChanger->disable(GL_STENCIL_TEST);
 
-        glDrawArrays(GL_TRIANGLES, d_verticesVBOPosition, d_vertexCount);
+        glDrawArrays(GL_TRIANGLES, d_verticesVBOPosition, vertexCount);
+        ++drawCallCount;
     }
     else if(d_polygonFillRule == PolygonFillRule::EvenOdd)
     {
@@ -310,12 +738,14 @@ void OpenGL3GeometryBuffer::drawDependingOnFillRule() const
         glStencilFunc(GL_ALWAYS, 0x00, 0xFF);
         glStencilOp(GL_INVERT, GL_KEEP, GL_INVERT);
         glDrawArrays(GL_TRIANGLES, d_verticesVBOPosition, d_vertexCount - d_postStencilVertexCount);
+        ++drawCallCount;
 
         unsigned int postStencilStart = d_vertexCount - d_postStencilVertexCount;
         glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
         glStencilMask(0x00);
         glStencilFunc(GL_EQUAL, 0xFF, 0xFF);
         glDrawArrays(GL_TRIANGLES, d_verticesVBOPosition + postStencilStart, d_postStencilVertexCount);
+        ++drawCallCount;
     }
     else if(d_polygonFillRule == PolygonFillRule::NonZero)
     {
@@ -338,10 +768,12 @@ void OpenGL3GeometryBuffer::drawDependingOnFillRule() const
         glCullFace(GL_FRONT);
         glStencilOp(GL_KEEP, GL_KEEP, GL_INCR_WRAP);
         glDrawArrays(GL_TRIANGLES, d_verticesVBOPosition + vertex_pos, solid_fill_count);
+        ++drawCallCount;
 
         glCullFace(GL_BACK);
         glStencilOp(GL_KEEP, GL_KEEP, GL_DECR_WRAP);
         glDrawArrays(GL_TRIANGLES, d_verticesVBOPosition + vertex_pos, solid_fill_count);
+        ++drawCallCount;
 
         vertex_pos += solid_fill_count;
 
@@ -355,6 +787,7 @@ void OpenGL3GeometryBuffer::drawDependingOnFillRule() const
         {
             glStencilFunc(GL_NOTEQUAL, 0x00, 0xFF);
             glDrawArrays(GL_TRIANGLES, d_verticesVBOPosition + d_vertexCount - d_postStencilVertexCount, d_postStencilVertexCount);
+            ++drawCallCount;
         }
     }
 }
@@ -32,6 +32,7 @@
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/ImageCodec.h"
 #include "CEGUI/DynamicModule.h"
+#include "CEGUI/Profiler.h"
 #include "CEGUI/RendererModules/OpenGL/ViewportTarget.h"
 #include "CEGUI/RendererModules/OpenGL/GL3GeometryBuffer.h"
 #include "CEGUI/GUIContext.h"
@@ -44,11 +45,22 @@
 #include "CEGUI/RenderMaterial.h"
 #include "CEGUI/RendererModules/OpenGL/GLBaseShaderWrapper.h"
 
+#include <glm/gtc/type_ptr.hpp>
+
 #include <algorithm>
 #include <iterator>
+#include <cstring>
 
 #define BUFFER_OFFSET(i) ((char *)NULL + (i))
 
+namespace
+{
+//! Minimum size in bytes of a segment of a vertex ring
+const std::size_t MinRingSegmentSize = 64 * 1024;
+//! Time in nanoseconds to wait for a ring segment fence before retrying
+const GLuint64 RingFenceTimeout = 1000000000;
+}
+
 #ifdef DEBUG
 #ifdef GLEW_VERSION_4_3
 // The function must be a C method with the same calling convention as the GL API functions, here this is done using the GLAPIENTRY function prefix
@@ -237,9 +249,24 @@ void OpenGL3Renderer::init()
     initialiseTextureTargetFactory();
     initialiseOpenGLShaders();
 
+    // texture updates are gathered and uploaded together
+    setTextureUploadDeferred(true);
+
 #ifdef CEGUI_OPENGL_BIG_BUFFER
-    initialiseStandardTexturedVAO();
-    initialiseStandardColouredVAO();
+    // mobile drivers are mostly CPU bound, so OpenGL ES 3.0 contexts write
+    // their vertices into a ring without letting the driver synchronise
+    if (OpenGLInfo::getSingleton().isUsingOpenglEs() &&
+        OpenGLInfo::getSingleton().isMapBufferRangeSupported() &&
+        OpenGLInfo::getSingleton().isFenceSyncSupported())
+        setVertexUploadMode(VertexUploadMode::UnsynchronisedMapRange);
+
+    // quads stored as four vertices are drawn through a shared index buffer,
+    // which has to exist before the VAOs are set up
+    if (OpenGLInfo::getSingleton().isElementIndexUintSupported())
+        glGenBuffers(1, &d_quadIndexBuffer);
+
+    createVertexBuffer(true, 0);
+    createVertexBuffer(false, 0);
 #endif
 }
 
@@ -247,18 +274,28 @@ void OpenGL3Renderer::init()
 OpenGL3Renderer::~OpenGL3Renderer()
 {
 #ifdef CEGUI_OPENGL_BIG_BUFFER
+    destroyVertexBuffer(true);
+    destroyVertexBuffer(false);
     glDeleteVertexArrays(1, &d_verticesTexturedVAO);
     glDeleteVertexArrays(1, &d_verticesSolidVAO);
-    glDeleteBuffers(1, &d_verticesSolidVBO);
-    glDeleteBuffers(1, &d_verticesTexturedVBO);
+    if (d_quadIndexBuffer)
+        glDeleteBuffers(1, &d_quadIndexBuffer);
+    if (d_perDrawUBO)
+        glDeleteBuffers(1, &d_perDrawUBO);
 #endif
 
     delete d_textureTargetFactory;
     delete d_openGLStateChanger;
     delete d_shaderManager;
 
+    if (d_quadCornerVBO)
+        glDeleteBuffers(1, &d_quadCornerVBO);
+
     delete d_shaderWrapperTextured;
     delete d_shaderWrapperSolid;
+    delete d_shaderWrapperTexturedInstanced;
+    delete d_shaderWrapperDistanceField;
+    delete d_shaderWrapperLayeredGlyph;
 }
 
 //----------------------------------------------------------------------------//
@@ -290,6 +327,19 @@ void OpenGL3Renderer::beginRendering()
     // functions. In that case disable client states like this: glDisableClientState(GL_VERTEX_ARRAY);
 
     d_openGLStateChanger->reset();
+    // the application may have changed the uniform buffer bindings
+    d_boundPerDrawChunk = -1;
+
+    d_drawCallCount = 0;
+    d_batchCount = 0;
+    d_drawnGeometryBufferCount = 0;
+
+    // upload the texture updates requested since the last frame in one go
+    flushTextureUploads();
+
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+    advanceVertexRings();
+#endif
 
     // if enabled, restores a subset of the GL state back to default values.
     if (d_isStateResettingEnabled)
@@ -305,6 +355,10 @@ void OpenGL3Renderer::beginRendering()
 //----------------------------------------------------------------------------//
 void OpenGL3Renderer::endRendering()
 {
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+    fenceVertexRings();
+#endif
+
     if (d_isStateResettingEnabled)
         restoreChangedStatesToDefaults(true);
 
@@ -359,7 +413,9 @@ void OpenGL3Renderer::setupRenderingBlendMode(const BlendMode mode,
 
     d_activeBlendMode = mode;
 
-    if (d_activeBlendMode == BlendMode::RttPremultiplied)
+    // premultiplied content is blended the same way whatever its origin
+    if (d_activeBlendMode == BlendMode::RttPremultiplied ||
+        isPremultipliedAlphaEnabled())
     {
         d_openGLStateChanger->blendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
     }
@@ -390,6 +446,47 @@ void OpenGL3Renderer::initialiseOpenGLShaders()
 
     initialiseStandardTexturedShaderWrapper();
     initialiseStandardColouredShaderWrapper();
+    initialiseTexturedInstancedShaderWrapper();
+    initialiseDistanceFieldShaderWrapper();
+    initialiseLayeredGlyphShaderWrapper();
+
+    // the clipping mask is evaluated by all standard shaders, the mask
+    // texture is bound to the unit after the one of texture0
+    OpenGLBaseShaderWrapper* const mask_wrappers[] = { d_shaderWrapperTextured,
+        d_shaderWrapperSolid, d_shaderWrapperTexturedInstanced, d_shaderWrapperDistanceField,
+        d_shaderWrapperLayeredGlyph };
+    for (OpenGLBaseShaderWrapper* wrapper : mask_wrappers)
+    {
+        if (!wrapper)
+            continue;
+
+        wrapper->addUniformVariable("clipMask");
+        wrapper->addTextureUniformVariable("clipMaskTexture", 1);
+    }
+
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+    // only the desktop shaders read per-draw data from a uniform buffer
+    if (OpenGLInfo::getSingleton().isUsingDesktopOpengl())
+    {
+        const OpenGLBaseShaderID shader_ids[] = { OpenGLBaseShaderID::StandardTextured,
+            OpenGLBaseShaderID::StandardSolid, OpenGLBaseShaderID::StandardTexturedInstanced,
+            OpenGLBaseShaderID::StandardDistanceField, OpenGLBaseShaderID::StandardLayeredGlyph };
+        OpenGLBaseShaderWrapper* const wrappers[] = { d_shaderWrapperTextured,
+            d_shaderWrapperSolid, d_shaderWrapperTexturedInstanced, d_shaderWrapperDistanceField,
+            d_shaderWrapperLayeredGlyph };
+
+        for (int i = 0; i < 5; ++i)
+        {
+            if (!wrappers[i])
+                continue;
+
+            d_shaderManager->getShader(shader_ids[i])->bindUniformBlock("PerDrawData", PerDrawDataBindingPoint);
+            wrappers[i]->addUniformVariable("drawSlot");
+        }
+
+        d_perDrawDataBufferSupported = true;
+    }
+#endif
 }
 
 //----------------------------------------------------------------------------//
@@ -407,6 +504,18 @@ RefCounted<RenderMaterial> OpenGL3Renderer::createRenderMaterial(const DefaultSh
 
         return render_material;
     }
+    else if(shaderType == DefaultShaderType::DistanceField && d_shaderWrapperDistanceField)
+    {
+        RefCounted<RenderMaterial> render_material(new RenderMaterial(d_shaderWrapperDistanceField));
+
+        return render_material;
+    }
+    else if(shaderType == DefaultShaderType::LayeredGlyph && d_shaderWrapperLayeredGlyph)
+    {
+        RefCounted<RenderMaterial> render_material(new RenderMaterial(d_shaderWrapperLayeredGlyph));
+
+        return render_material;
+    }
     else
     {
         throw RendererException(
@@ -416,35 +525,79 @@ RefCounted<RenderMaterial> OpenGL3Renderer::createRenderMaterial(const DefaultSh
     }
 }
 
+//----------------------------------------------------------------------------//
+bool OpenGL3Renderer::isDefaultShaderTypeSupported(const DefaultShaderType shaderType) const
+{
+    if (shaderType == DefaultShaderType::DistanceField)
+        return d_shaderWrapperDistanceField != nullptr;
+    if (shaderType == DefaultShaderType::LayeredGlyph)
+        return d_shaderWrapperLayeredGlyph != nullptr;
+
+    return Renderer::isDefaultShaderTypeSupported(shaderType);
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGL3Renderer::isGeometryGenerationThreadSafe() const
+{
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+    // GeometryBuffers only hold CPU side data until the renderer uploads them
+    return true;
+#else
+    return false;
+#endif
+}
+
 //----------------------------------------------------------------------------//
 void OpenGL3Renderer::uploadBuffers(RenderingSurface& surface)
 {
+    CEGUI_PROFILE_SCOPE("OpenGL3Renderer::uploadBuffers");
+
 #ifdef CEGUI_OPENGL_BIG_BUFFER
     d_vertex_data_solid.clear();
     d_vertex_data_textured.clear();
+    d_indexedSolidVertexEnd = d_indexedTexturedVertexEnd = 0;
+    resetPerDrawData();
 
     for(auto &queue : surface.getRenderQueueList())
     {
-        addGeometry(queue.second.getBuffers());
+        addGeometry(queue.second.getDrawOrder());
+        addPerDrawData(queue.second.getDrawOrder());
     }
 
+    uploadPerDrawData();
 
-    uploadVertexData(d_vertex_data_solid, d_verticesSolidVBO, d_verticesSolidVBOSize);
-    uploadVertexData(d_vertex_data_textured, d_verticesTexturedVBO, d_verticesTexturedVBOSize);
+    const std::size_t solid_base = uploadVertexData(d_vertex_data_solid, false);
+    const std::size_t textured_base = uploadVertexData(d_vertex_data_textured, true);
+    updateQuadIndexBuffer(solid_base, textured_base);
 
+    if (solid_base || textured_base)
+    {
+        for(auto &queue : surface.getRenderQueueList())
+            offsetVertexPositions(queue.second.getDrawOrder(), solid_base, textured_base);
+    }
 #endif
 }
 
 //----------------------------------------------------------------------------//
 void OpenGL3Renderer::uploadBuffers(const std::vector<GeometryBuffer*>& buffers)
 {
+    CEGUI_PROFILE_SCOPE("OpenGL3Renderer::uploadBuffers");
+
     // keep the vertex vector reserved memory so it is not constantly recreated
     d_vertex_data_solid.clear();
     d_vertex_data_textured.clear();
+    d_indexedSolidVertexEnd = d_indexedTexturedVertexEnd = 0;
+    resetPerDrawData();
 
     addGeometry(buffers);
-    uploadVertexData(d_vertex_data_solid, d_verticesSolidVBO, d_verticesSolidVBOSize);
-    uploadVertexData(d_vertex_data_textured, d_verticesTexturedVBO, d_verticesTexturedVBOSize);
+    addPerDrawData(buffers);
+    uploadPerDrawData();
+    const std::size_t solid_base = uploadVertexData(d_vertex_data_solid, false);
+    const std::size_t textured_base = uploadVertexData(d_vertex_data_textured, true);
+    updateQuadIndexBuffer(solid_base, textured_base);
+
+    if (solid_base || textured_base)
+        offsetVertexPositions(buffers, solid_base, textured_base);
 }
 
 //----------------------------------------------------------------------------//
@@ -457,33 +610,519 @@ void OpenGL3Renderer::addGeometry(const std::vector<GeometryBuffer*>& buffers)
             continue;
 
         const auto element_count = buffer->getVertexAttributeElementCount();
-        auto& destBuffer = (element_count == 9) ? d_vertex_data_textured : d_vertex_data_solid;
+        const bool textured = (element_count == 9);
+        auto& destBuffer = textured ? d_vertex_data_textured : d_vertex_data_solid;
+        const std::size_t word_count = getVertexWordCount(textured);
+
+        // indexed quads start at a multiple of four vertices, so that their
+        // indices are found at a plain offset into the quad index buffer
+        if (buffer->isUsingQuadIndices())
+        {
+            const std::size_t quad_size = 4 * word_count;
+            destBuffer.resize((destBuffer.size() + quad_size - 1) / quad_size * quad_size, 0.0f);
+        }
+
+        const std::size_t position = destBuffer.size() / word_count;
+        static_cast<OpenGL3GeometryBuffer*>(buffer)->d_verticesVBOPosition = position;
+
+        if (d_vertexFormat == VertexFormat::Float)
+        {
+            destBuffer.reserve(destBuffer.size() + data.size());
+            std::copy(data.begin(), data.end(), std::back_inserter(destBuffer));
+        }
+        else
+        {
+            appendPackedVertices(destBuffer, data.data(), data.size() / element_count, textured);
+        }
+
+        if (buffer->isUsingQuadIndices())
+        {
+            (textured ? d_indexedTexturedVertexEnd : d_indexedSolidVertexEnd) =
+                position + buffer->getVertexCount();
+        }
+    }
+}
 
-        static_cast<OpenGL3GeometryBuffer*>(buffer)->d_verticesVBOPosition = destBuffer.size() / element_count;
-        destBuffer.reserve(destBuffer.size() + data.size());
-        std::copy(data.begin(), data.end(), std::back_inserter(destBuffer));
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::setPerDrawDataBufferEnabled(bool enabled)
+{
+    if (enabled && !d_perDrawDataBufferSupported)
+    {
+        Logger::getSingleton().logEvent("OpenGL3Renderer::setPerDrawDataBufferEnabled - "
+            "per-draw data buffers require desktop OpenGL and the shared vertex "
+            "buffers, keeping separate uniforms.", LoggingLevel::Warning);
+        return;
     }
+
+    d_perDrawDataBufferEnabled = enabled;
 }
 
 //----------------------------------------------------------------------------//
-void OpenGL3Renderer::uploadVertexData(std::vector<float>& vertex_data, GLuint vbo_id, GLuint &vbo_max_size)
+void OpenGL3Renderer::resetPerDrawData()
 {
-    if(vertex_data.empty())
+    d_perDrawData.clear();
+    d_perDrawEntryCount = 0;
+    // entries handed out by previous uploads are no longer valid
+    ++d_perDrawGeneration;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::addPerDrawData(const std::vector<GeometryBuffer*>& buffers)
+{
+    if (!d_perDrawDataBufferEnabled)
+        return;
+
+    if (!d_perDrawChunkStride)
     {
+        GLint alignment = 0;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        const std::size_t alignment_floats =
+            std::max<std::size_t>(static_cast<std::size_t>(alignment) / sizeof(float), 1);
+        const std::size_t chunk_floats = PerDrawChunkEntryCount * PerDrawEntryFloatCount;
+        d_perDrawChunkStride = (chunk_floats + alignment_floats - 1) / alignment_floats * alignment_floats;
+    }
+
+    for (auto geometry_buffer : buffers)
+    {
+        OpenGL3GeometryBuffer* buffer = static_cast<OpenGL3GeometryBuffer*>(geometry_buffer);
+        if (buffer->getVertexData().empty() && !buffer->getQuadInstanceCount())
+            continue;
+
+        // effects may change the matrix or alpha between passes
+        if (buffer->getRenderEffect())
+            continue;
+
+        const ShaderWrapper* shader_wrapper = buffer->getRenderMaterial()->getShaderWrapper();
+        if (shader_wrapper != d_shaderWrapperTextured && shader_wrapper != d_shaderWrapperSolid &&
+            shader_wrapper != d_shaderWrapperDistanceField && shader_wrapper != d_shaderWrapperLayeredGlyph)
+            continue;
+
+        const std::size_t entry = d_perDrawEntryCount++;
+        const std::size_t chunk = entry / PerDrawChunkEntryCount;
+        const std::size_t offset = chunk * d_perDrawChunkStride +
+                                   (entry % PerDrawChunkEntryCount) * PerDrawEntryFloatCount;
+        if (d_perDrawData.size() < offset + PerDrawEntryFloatCount)
+            d_perDrawData.resize(offset + PerDrawEntryFloatCount, 0.0f);
+
+        const float* matrix = glm::value_ptr(buffer->getModelViewProjectionMatrix());
+        std::copy(matrix, matrix + 16, &d_perDrawData[offset]);
+        d_perDrawData[offset + 16] = buffer->getAlpha();
+
+        buffer->d_perDrawEntry = entry;
+        buffer->d_perDrawGeneration = d_perDrawGeneration;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::uploadPerDrawData()
+{
+    if (d_perDrawData.empty())
         return;
+
+    if (!d_perDrawUBO)
+        glGenBuffers(1, &d_perDrawUBO);
+
+    // the last chunk is bound with its full size, so it must be backed completely
+    const std::size_t chunk_count =
+        (d_perDrawEntryCount + PerDrawChunkEntryCount - 1) / PerDrawChunkEntryCount;
+    d_perDrawData.resize((chunk_count - 1) * d_perDrawChunkStride +
+                         PerDrawChunkEntryCount * PerDrawEntryFloatCount, 0.0f);
+    const std::size_t data_size = d_perDrawData.size() * sizeof(float);
+
+    // orphan the previous storage, earlier draws may still read from it
+    d_perDrawUBOSize = std::max(d_perDrawUBOSize, data_size);
+    d_openGLStateChanger->bindBuffer(GL_UNIFORM_BUFFER, d_perDrawUBO);
+    glBufferData(GL_UNIFORM_BUFFER, d_perDrawUBOSize, nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, data_size, d_perDrawData.data());
+
+    d_boundPerDrawChunk = -1;
+}
+
+//----------------------------------------------------------------------------//
+GLint OpenGL3Renderer::preparePerDrawSlot(const OpenGL3GeometryBuffer& buffer)
+{
+    const ShaderWrapper* shader_wrapper = buffer.getRenderMaterial()->getShaderWrapper();
+    if (!d_perDrawDataBufferSupported ||
+        (shader_wrapper != d_shaderWrapperTextured && shader_wrapper != d_shaderWrapperSolid &&
+         shader_wrapper != d_shaderWrapperDistanceField && shader_wrapper != d_shaderWrapperLayeredGlyph))
+        return -1;
+
+    if (!d_perDrawDataBufferEnabled || buffer.d_perDrawGeneration != d_perDrawGeneration)
+        return 0;
+
+    const std::ptrdiff_t chunk = static_cast<std::ptrdiff_t>(buffer.d_perDrawEntry / PerDrawChunkEntryCount);
+    if (chunk != d_boundPerDrawChunk)
+    {
+        glBindBufferRange(GL_UNIFORM_BUFFER, PerDrawDataBindingPoint, d_perDrawUBO,
+            chunk * d_perDrawChunkStride * sizeof(float),
+            PerDrawChunkEntryCount * PerDrawEntryFloatCount * sizeof(float));
+        d_boundPerDrawChunk = chunk;
+    }
+
+    return static_cast<GLint>(buffer.d_perDrawEntry % PerDrawChunkEntryCount) + 1;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t OpenGL3Renderer::getVertexWordCount(bool textured) const
+{
+    switch (d_vertexFormat)
+    {
+    case VertexFormat::PackedColour:
+        return textured ? 3 + 1 + 2 : 3 + 1;
+    case VertexFormat::PackedColourAndTexCoords:
+        return textured ? 3 + 1 + 1 : 3 + 1;
+    default:
+        return textured ? 3 + 4 + 2 : 3 + 4;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::appendPackedVertices(std::vector<float>& dest,
+                                           const float* vertex_data,
+                                           std::size_t vertex_count,
+                                           bool textured) const
+{
+    const std::size_t src_count = textured ? 9 : 7;
+    const std::size_t word_count = getVertexWordCount(textured);
+    const bool pack_tex_coords = (d_vertexFormat == VertexFormat::PackedColourAndTexCoords);
+
+    std::size_t dest_pos = dest.size();
+    dest.resize(dest_pos + vertex_count * word_count);
+
+    for (std::size_t i = 0; i < vertex_count; ++i, vertex_data += src_count)
+    {
+        float* vertex = &dest[dest_pos];
+        dest_pos += word_count;
+
+        vertex[0] = vertex_data[0];
+        vertex[1] = vertex_data[1];
+        vertex[2] = vertex_data[2];
+
+        // the packed attributes are stored bitwise in the float words
+        std::uint8_t colour[4];
+        for (int c = 0; c < 4; ++c)
+            colour[c] = static_cast<std::uint8_t>(
+                std::min(std::max(vertex_data[3 + c], 0.0f), 1.0f) * 255.0f + 0.5f);
+        std::memcpy(&vertex[3], colour, sizeof(colour));
+
+        if (!textured)
+            continue;
+
+        if (pack_tex_coords)
+        {
+            std::uint16_t tex_coords[2];
+            for (int t = 0; t < 2; ++t)
+                tex_coords[t] = static_cast<std::uint16_t>(
+                    std::min(std::max(vertex_data[7 + t], 0.0f), 1.0f) * 65535.0f + 0.5f);
+            std::memcpy(&vertex[4], tex_coords, sizeof(tex_coords));
+        }
+        else
+        {
+            vertex[4] = vertex_data[7];
+            vertex[5] = vertex_data[8];
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::offsetVertexPositions(const std::vector<GeometryBuffer*>& buffers,
+                                            std::size_t solid_base,
+                                            std::size_t textured_base)
+{
+    for (auto buffer : buffers)
+    {
+        if (buffer->getVertexData().empty())
+            continue;
+
+        static_cast<OpenGL3GeometryBuffer*>(buffer)->d_verticesVBOPosition +=
+            (buffer->getVertexAttributeElementCount() == 9) ? textured_base : solid_base;
     }
+}
 
-    d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, vbo_id);
+//----------------------------------------------------------------------------//
+std::size_t OpenGL3Renderer::uploadVertexData(std::vector<float>& vertex_data, bool textured)
+{
+    if(vertex_data.empty())
+    {
+        return 0;
+    }
+
+    getCurrentFrameStats().d_verticesUploaded += vertex_data.size() / getVertexWordCount(textured);
+
+    if (d_vertexUploadMode == VertexUploadMode::PersistentMappedRing ||
+        d_vertexUploadMode == VertexUploadMode::UnsynchronisedMapRange)
+        return uploadVertexDataToRing(vertex_data, textured);
+
+    GLuint& vbo_max_size = textured ? d_verticesTexturedVBOSize : d_verticesSolidVBOSize;
+    const GLuint data_size = static_cast<GLuint>(vertex_data.size() * sizeof(float));
+
+    d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER,
+        textured ? d_verticesTexturedVBO : d_verticesSolidVBO);
+
+    if (d_vertexUploadMode == VertexUploadMode::Orphaning)
+    {
+        // hand the old storage over to the driver so any pending draws can
+        // still read from it while we write the new data into fresh storage
+        vbo_max_size = std::max(vbo_max_size, data_size);
+        glBufferData(GL_ARRAY_BUFFER, vbo_max_size, nullptr, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, data_size, &vertex_data[0]);
+    }
     // need a bigger buffer
-    if(vertex_data.size() * sizeof(float) > vbo_max_size)
+    else if(data_size > vbo_max_size)
     {
-        glBufferData(GL_ARRAY_BUFFER, vertex_data.size() * sizeof(float), &vertex_data[0], GL_DYNAMIC_DRAW);
-        vbo_max_size = vertex_data.size() * sizeof(float);
+        glBufferData(GL_ARRAY_BUFFER, data_size, &vertex_data[0], GL_DYNAMIC_DRAW);
+        vbo_max_size = data_size;
     }
     else
     {
-        glBufferSubData(GL_ARRAY_BUFFER, 0, vertex_data.size() * sizeof(float), &vertex_data[0]);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, data_size, &vertex_data[0]);
     }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t OpenGL3Renderer::uploadVertexDataToRing(std::vector<float>& vertex_data, bool textured)
+{
+    PersistentVertexRing& ring = textured ? d_texturedRing : d_solidRing;
+    const std::size_t stride = getVertexWordCount(textured) * sizeof(float);
+    const std::size_t quad_size = 4 * stride;
+    const std::size_t data_size = vertex_data.size() * sizeof(float);
+
+    // keep indexed quads at multiples of four vertices, see addGeometry
+    ring.d_writeOffset = (ring.d_writeOffset + quad_size - 1) / quad_size * quad_size;
+
+    if (ring.d_writeOffset + data_size > ring.d_segmentSize)
+    {
+        // The storage is replaced rather than resized, as resizing would
+        // discard the segments of the previous frames. The driver keeps the
+        // old storage alive until pending draws are done with it.
+        std::size_t segment_size = std::max(std::max(ring.d_segmentSize, data_size) * 2,
+                                            MinRingSegmentSize);
+        // segments must start at a quad boundary
+        segment_size = (segment_size + quad_size - 1) / quad_size * quad_size;
+
+        destroyVertexBuffer(textured);
+        createVertexBuffer(textured, segment_size);
+    }
+
+    const std::size_t offset = ring.d_currentSegment * ring.d_segmentSize + ring.d_writeOffset;
+    if (ring.d_mappedData)
+    {
+        std::memcpy(ring.d_mappedData + offset, &vertex_data[0], data_size);
+    }
+    else
+    {
+        // the range was neither written this frame nor is it read by a frame
+        // still in flight, see advanceVertexRings, so the driver need not wait
+        d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER,
+            textured ? d_verticesTexturedVBO : d_verticesSolidVBO);
+        void* const mapped = glMapBufferRange(GL_ARRAY_BUFFER, offset, data_size,
+            GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+
+        if (!mapped)
+            throw RendererException("Failed to map the vertex buffer range.");
+
+        std::memcpy(mapped, &vertex_data[0], data_size);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+    ring.d_writeOffset += data_size;
+
+    return offset / stride;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::createVertexBuffer(bool textured, std::size_t ring_segment_size)
+{
+    GLuint& vbo = textured ? d_verticesTexturedVBO : d_verticesSolidVBO;
+
+    glGenBuffers(1, &vbo);
+    d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, vbo);
+
+    if (ring_segment_size)
+    {
+        PersistentVertexRing& ring = textured ? d_texturedRing : d_solidRing;
+        const GLsizeiptr size = ring_segment_size * RingSegmentCount;
+
+        if (d_vertexUploadMode == VertexUploadMode::PersistentMappedRing)
+        {
+            const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+            glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+            ring.d_mappedData = static_cast<std::uint8_t*>(
+                glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags));
+
+            if (!ring.d_mappedData)
+                throw RendererException("Failed to persistently map the vertex buffer.");
+        }
+        else
+        {
+            glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+        }
+
+        ring.d_segmentSize = ring_segment_size;
+    }
+    else
+    {
+        glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_DYNAMIC_DRAW);
+    }
+
+    d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // the VAO refers to the VBO it was set up with, so it has to be updated
+    if (textured)
+        initialiseStandardTexturedVAO();
+    else
+        initialiseStandardColouredVAO();
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::destroyVertexBuffer(bool textured)
+{
+    GLuint& vbo = textured ? d_verticesTexturedVBO : d_verticesSolidVBO;
+    PersistentVertexRing& ring = textured ? d_texturedRing : d_solidRing;
+
+    for (GLsync& fence : ring.d_fences)
+    {
+        if (fence)
+            glDeleteSync(fence);
+    }
+
+    if (ring.d_mappedData)
+    {
+        d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, vbo);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+
+    ring = PersistentVertexRing();
+
+    // unbind through the state changer so that it does not consider a
+    // recycled buffer name as already bound
+    d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, 0);
+    glDeleteBuffers(1, &vbo);
+    vbo = 0;
+    (textured ? d_verticesTexturedVBOSize : d_verticesSolidVBOSize) = 0;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::advanceVertexRings()
+{
+    for (PersistentVertexRing* ring : { &d_solidRing, &d_texturedRing })
+    {
+        if (!ring->d_segmentSize)
+            continue;
+
+        ring->d_currentSegment = (ring->d_currentSegment + 1) % RingSegmentCount;
+        ring->d_writeOffset = 0;
+
+        // this only blocks when the GPU is more than RingSegmentCount - 1 frames behind
+        GLsync& fence = ring->d_fences[ring->d_currentSegment];
+        if (fence)
+        {
+            GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, RingFenceTimeout);
+            while (result == GL_TIMEOUT_EXPIRED)
+                result = glClientWaitSync(fence, 0, RingFenceTimeout);
+
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::fenceVertexRings()
+{
+    for (PersistentVertexRing* ring : { &d_solidRing, &d_texturedRing })
+    {
+        if (!ring->d_segmentSize || !ring->d_writeOffset)
+            continue;
+
+        GLsync& fence = ring->d_fences[ring->d_currentSegment];
+        if (fence)
+            glDeleteSync(fence);
+
+        fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::setVertexFormat(VertexFormat format)
+{
+    if (format == d_vertexFormat)
+        return;
+
+    d_vertexFormat = format;
+
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+    // the stride changes, so the VAOs and any ring segments are set up anew
+    destroyVertexBuffer(true);
+    destroyVertexBuffer(false);
+    createVertexBuffer(true, 0);
+    createVertexBuffer(false, 0);
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::updateQuadIndexBuffer(std::size_t solid_base, std::size_t textured_base)
+{
+    const std::size_t vertex_end = std::max(
+        d_indexedSolidVertexEnd ? solid_base + d_indexedSolidVertexEnd : 0,
+        d_indexedTexturedVertexEnd ? textured_base + d_indexedTexturedVertexEnd : 0);
+    const std::size_t quad_count = vertex_end / 4;
+
+    if (quad_count <= d_quadIndexBufferQuadCount)
+        return;
+
+    // the indices never change, so the buffer only grows
+    d_quadIndexBufferQuadCount = std::max(quad_count, d_quadIndexBufferQuadCount * 2);
+
+    std::vector<std::uint32_t> indices;
+    GeometryBuffer::appendQuadIndices(indices, d_quadIndexBufferQuadCount);
+
+    // uploaded through the array buffer target, as the element array binding
+    // belongs to whichever VAO is bound
+    d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, d_quadIndexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, indices.size() * sizeof(std::uint32_t),
+                 indices.data(), GL_STATIC_DRAW);
+    d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::setVertexUploadMode(VertexUploadMode mode)
+{
+    if (mode == VertexUploadMode::PersistentMappedRing &&
+        !OpenGLInfo::getSingleton().isBufferStorageSupported())
+    {
+        Logger::getSingleton().logEvent("OpenGL3Renderer: Buffer storage is not "
+            "supported, falling back to orphaning vertex buffers.", LoggingLevel::Warning);
+        mode = VertexUploadMode::Orphaning;
+    }
+    else if (mode == VertexUploadMode::UnsynchronisedMapRange &&
+        (!OpenGLInfo::getSingleton().isMapBufferRangeSupported() ||
+         !OpenGLInfo::getSingleton().isFenceSyncSupported()))
+    {
+        Logger::getSingleton().logEvent("OpenGL3Renderer: Mapping buffer ranges "
+            "is not supported, falling back to orphaning vertex buffers.", LoggingLevel::Warning);
+        mode = VertexUploadMode::Orphaning;
+    }
+
+    if (mode == d_vertexUploadMode)
+        return;
+
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+    // ring storage is laid out in segments and immutable in the persistent
+    // mode, so it is replaced; the ring itself is created on the first upload
+    if (d_vertexUploadMode == VertexUploadMode::PersistentMappedRing ||
+        d_vertexUploadMode == VertexUploadMode::UnsynchronisedMapRange)
+    {
+        destroyVertexBuffer(true);
+        destroyVertexBuffer(false);
+        createVertexBuffer(true, 0);
+        createVertexBuffer(false, 0);
+    }
+#endif
+
+    d_vertexUploadMode = mode;
 }
 
 //----------------------------------------------------------------------------//
@@ -496,6 +1135,7 @@ void OpenGL3Renderer::initialiseStandardTexturedShaderWrapper()
 
     d_shaderWrapperTextured->addUniformVariable("modelViewProjMatrix");
     d_shaderWrapperTextured->addUniformVariable("alphaFactor");
+    d_shaderWrapperTextured->addUniformVariable("premultipliedAlpha");
 
     d_shaderWrapperTextured->addAttributeVariable("inPosition");
     d_shaderWrapperTextured->addAttributeVariable("inTexCoord");
@@ -510,29 +1150,109 @@ void OpenGL3Renderer::initialiseStandardColouredShaderWrapper()
 
     d_shaderWrapperSolid->addUniformVariable("modelViewProjMatrix");
     d_shaderWrapperSolid->addUniformVariable("alphaFactor");
+    d_shaderWrapperSolid->addUniformVariable("premultipliedAlpha");
 
     d_shaderWrapperSolid->addAttributeVariable("inPosition");
     d_shaderWrapperSolid->addAttributeVariable("inColour");
 }
 
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::initialiseDistanceFieldShaderWrapper()
+{
+    OpenGLBaseShader* shader_distance_field = d_shaderManager->getShader(OpenGLBaseShaderID::StandardDistanceField);
+    if (!shader_distance_field || !shader_distance_field->isCreatedSuccessfully())
+        return;
+
+    // the vertex shader is the textured one, so the textured vertex layout applies
+    d_shaderWrapperDistanceField = new OpenGLBaseShaderWrapper(*shader_distance_field, d_openGLStateChanger);
+
+    d_shaderWrapperDistanceField->addTextureUniformVariable("texture0", 0);
+
+    d_shaderWrapperDistanceField->addUniformVariable("modelViewProjMatrix");
+    d_shaderWrapperDistanceField->addUniformVariable("alphaFactor");
+    d_shaderWrapperDistanceField->addUniformVariable("premultipliedAlpha");
+
+    d_shaderWrapperDistanceField->addAttributeVariable("inPosition");
+    d_shaderWrapperDistanceField->addAttributeVariable("inTexCoord");
+    d_shaderWrapperDistanceField->addAttributeVariable("inColour");
+}
 
 //----------------------------------------------------------------------------//
-// mostly a copy of OpenGL3GeometryBuffer::finaliseVertexAttributes()
-void OpenGL3Renderer::initialiseStandardTexturedVAO()
+void OpenGL3Renderer::initialiseLayeredGlyphShaderWrapper()
 {
-#ifdef CEGUI_OPENGL_BIG_BUFFER
-    glGenBuffers(1, &d_verticesTexturedVBO);
-    d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, d_verticesTexturedVBO);
-    glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_DYNAMIC_DRAW);
+    OpenGLBaseShader* shader_layered_glyph = d_shaderManager->getShader(OpenGLBaseShaderID::StandardLayeredGlyph);
+    if (!shader_layered_glyph || !shader_layered_glyph->isCreatedSuccessfully())
+        return;
+
+    // the vertex shader is the textured one, so the textured vertex layout applies
+    d_shaderWrapperLayeredGlyph = new OpenGLBaseShaderWrapper(*shader_layered_glyph, d_openGLStateChanger);
+
+    d_shaderWrapperLayeredGlyph->addTextureUniformVariable("texture0", 0);
+
+    d_shaderWrapperLayeredGlyph->addUniformVariable("modelViewProjMatrix");
+    d_shaderWrapperLayeredGlyph->addUniformVariable("alphaFactor");
+    d_shaderWrapperLayeredGlyph->addUniformVariable("premultipliedAlpha");
+    d_shaderWrapperLayeredGlyph->addUniformVariable("layerColours");
+
+    d_shaderWrapperLayeredGlyph->addAttributeVariable("inPosition");
+    d_shaderWrapperLayeredGlyph->addAttributeVariable("inTexCoord");
+    d_shaderWrapperLayeredGlyph->addAttributeVariable("inColour");
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::initialiseTexturedInstancedShaderWrapper()
+{
+    OpenGLBaseShader* shader_textured_instanced = d_shaderManager->getShader(OpenGLBaseShaderID::StandardTexturedInstanced);
+    if (!shader_textured_instanced || !shader_textured_instanced->isCreatedSuccessfully())
+        return;
+
+    d_shaderWrapperTexturedInstanced = new OpenGLBaseShaderWrapper(*shader_textured_instanced, d_openGLStateChanger);
+
+    d_shaderWrapperTexturedInstanced->addTextureUniformVariable("texture0", 0);
+
+    d_shaderWrapperTexturedInstanced->addUniformVariable("modelViewProjMatrix");
+    d_shaderWrapperTexturedInstanced->addUniformVariable("alphaFactor");
+    d_shaderWrapperTexturedInstanced->addUniformVariable("premultipliedAlpha");
+
+    d_shaderWrapperTexturedInstanced->addAttributeVariable("inCorner");
+    d_shaderWrapperTexturedInstanced->addAttributeVariable("inRect");
+    d_shaderWrapperTexturedInstanced->addAttributeVariable("inTexRect");
+    d_shaderWrapperTexturedInstanced->addAttributeVariable("inColour");
+
+    // same triangle order as the vertices created for quads by BitmapImage
+    static const GLfloat corners[] =
+    {
+        0.0f, 0.0f,
+        0.0f, 1.0f,
+        1.0f, 1.0f,
+        1.0f, 0.0f,
+        0.0f, 0.0f,
+        1.0f, 1.0f
+    };
+
+    glGenBuffers(1, &d_quadCornerVBO);
+    d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, d_quadCornerVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
     d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, 0);
+}
 
 
-    glGenVertexArrays(1, &d_verticesTexturedVAO);
+//----------------------------------------------------------------------------//
+// mostly a copy of OpenGL3GeometryBuffer::finaliseVertexAttributes()
+void OpenGL3Renderer::initialiseStandardTexturedVAO()
+{
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+    if (!d_verticesTexturedVAO)
+        glGenVertexArrays(1, &d_verticesTexturedVAO);
     d_openGLStateChanger->bindVertexArray(d_verticesTexturedVAO);
 
+    // the element array binding is VAO state, which the state changer does not track
+    if (d_quadIndexBuffer)
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, d_quadIndexBuffer);
+
     d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, d_verticesTexturedVBO);
 
-    GLsizei stride = (3 + 4 + 2) * sizeof(GLfloat);
+    GLsizei stride = static_cast<GLsizei>(getVertexWordCount(true) * sizeof(GLfloat));
     //Update the vertex attrib pointers of the vertex array object depending on the saved attributes
     int dataOffset = 0;
 
@@ -541,15 +1261,32 @@ void OpenGL3Renderer::initialiseStandardTexturedVAO()
     glVertexAttribPointer(shader_pos_loc, 3, GL_FLOAT, GL_FALSE, stride, BUFFER_OFFSET(dataOffset * sizeof(GLfloat)));
     dataOffset += 3;
 
+    // packed attributes are normalised, so the shaders receive them unchanged
     GLint shader_colour_loc = d_shaderWrapperTextured->getAttributeLocation("inColour");
     glEnableVertexAttribArray(shader_colour_loc);
-    glVertexAttribPointer(shader_colour_loc, 4, GL_FLOAT, GL_FALSE, stride, BUFFER_OFFSET(dataOffset * sizeof(GLfloat)));
-    dataOffset += 4;
+    if (d_vertexFormat == VertexFormat::Float)
+    {
+        glVertexAttribPointer(shader_colour_loc, 4, GL_FLOAT, GL_FALSE, stride, BUFFER_OFFSET(dataOffset * sizeof(GLfloat)));
+        dataOffset += 4;
+    }
+    else
+    {
+        glVertexAttribPointer(shader_colour_loc, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, BUFFER_OFFSET(dataOffset * sizeof(GLfloat)));
+        dataOffset += 1;
+    }
 
     GLint texture_coord_loc = d_shaderWrapperTextured->getAttributeLocation("inTexCoord");
     glEnableVertexAttribArray(texture_coord_loc);
-    glVertexAttribPointer(texture_coord_loc, 2, GL_FLOAT, GL_FALSE, stride, BUFFER_OFFSET(dataOffset * sizeof(GLfloat)));
-    dataOffset += 2;
+    if (d_vertexFormat == VertexFormat::PackedColourAndTexCoords)
+    {
+        glVertexAttribPointer(texture_coord_loc, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride, BUFFER_OFFSET(dataOffset * sizeof(GLfloat)));
+        dataOffset += 1;
+    }
+    else
+    {
+        glVertexAttribPointer(texture_coord_loc, 2, GL_FLOAT, GL_FALSE, stride, BUFFER_OFFSET(dataOffset * sizeof(GLfloat)));
+        dataOffset += 2;
+    }
 
     d_openGLStateChanger->bindVertexArray(0);
     d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, 0);
@@ -561,14 +1298,17 @@ void OpenGL3Renderer::initialiseStandardTexturedVAO()
 void OpenGL3Renderer::initialiseStandardColouredVAO()
 {
 #ifdef CEGUI_OPENGL_BIG_BUFFER
-    glGenVertexArrays(1, &d_verticesSolidVAO);
+    if (!d_verticesSolidVAO)
+        glGenVertexArrays(1, &d_verticesSolidVAO);
     d_openGLStateChanger->bindVertexArray(d_verticesSolidVAO);
 
-    glGenBuffers(1, &d_verticesSolidVBO);
+    // the element array binding is VAO state, which the state changer does not track
+    if (d_quadIndexBuffer)
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, d_quadIndexBuffer);
+
     d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, d_verticesSolidVBO);
-    glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_DYNAMIC_DRAW);
 
-    GLsizei stride = (3 + 4) * sizeof(GLfloat);
+    GLsizei stride = static_cast<GLsizei>(getVertexWordCount(false) * sizeof(GLfloat));
     //Update the vertex attrib pointers of the vertex array object depending on the saved attributes
     int dataOffset = 0;
 
@@ -579,8 +1319,16 @@ void OpenGL3Renderer::initialiseStandardColouredVAO()
 
     GLint shader_colour_loc = d_shaderWrapperSolid->getAttributeLocation("inColour");
     glEnableVertexAttribArray(shader_colour_loc);
-    glVertexAttribPointer(shader_colour_loc, 4, GL_FLOAT, GL_FALSE, stride, BUFFER_OFFSET(dataOffset * sizeof(GLfloat)));
-    dataOffset += 4;
+    if (d_vertexFormat == VertexFormat::Float)
+    {
+        glVertexAttribPointer(shader_colour_loc, 4, GL_FLOAT, GL_FALSE, stride, BUFFER_OFFSET(dataOffset * sizeof(GLfloat)));
+        dataOffset += 4;
+    }
+    else
+    {
+        glVertexAttribPointer(shader_colour_loc, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, BUFFER_OFFSET(dataOffset * sizeof(GLfloat)));
+        dataOffset += 1;
+    }
 
     d_openGLStateChanger->bindVertexArray(0);
     d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, 0);
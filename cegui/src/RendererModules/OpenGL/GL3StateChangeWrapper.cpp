@@ -44,6 +44,7 @@ OpenGL3StateChangeWrapper::~OpenGL3StateChangeWrapper()
 //----------------------------------------------------------------------------//
 void OpenGL3StateChangeWrapper::bindVertexArray(GLuint vertexArray)
 {
+    recordStateChange(vertexArray != d_vertexArrayObject);
     if (vertexArray != d_vertexArrayObject)
     {
         glBindVertexArray(vertexArray);
@@ -48,6 +48,8 @@ OpenGLBaseShaderWrapper::OpenGLBaseShaderWrapper(OpenGLBaseShader& shader, OpenG
 //----------------------------------------------------------------------------//
 OpenGLBaseShaderWrapper::~OpenGLBaseShaderWrapper()
 {
+    for (auto& variable : d_uniformVariables)
+        delete variable.second.d_lastValue;
 }
 
 //----------------------------------------------------------------------------//
@@ -59,7 +61,8 @@ void OpenGLBaseShaderWrapper::addUniformVariable(const std::string& uniformName)
         throw RendererException("OpenGLBaseShaderWrapper::addUniformVariable - A uniform variable with "
                                       "the name \"" + uniformName + "\" was not found in the OpenGL shader.");
 
-    d_uniformVariables.insert(std::pair<std::string, GLint>(uniformName, variable_location));
+    UniformVariable variable = { variable_location, nullptr };
+    d_uniformVariables.insert(std::make_pair(uniformName, variable));
 }
 
 //----------------------------------------------------------------------------//
@@ -71,7 +74,8 @@ void OpenGLBaseShaderWrapper::addTextureUniformVariable(const std::string& unifo
         throw RendererException("OpenGLBaseShaderWrapper::addTextureUniformVariable - A texture uniform variable with "
                                       "the name \"" + uniformName + "\" was not found in the OpenGL shader.");
 
-    d_uniformVariables.insert(std::pair<std::string, GLint>(uniformName, textureUnitIndex));
+    UniformVariable variable = { textureUnitIndex, nullptr };
+    d_uniformVariables.insert(std::make_pair(uniformName, variable));
 
     d_shader.bind();
     glUniform1i(variable_location, textureUnitIndex);
@@ -95,80 +99,80 @@ void OpenGLBaseShaderWrapper::prepareForRendering(const ShaderParameterBindings*
     d_shader.bind();
 
     const ShaderParameterBindings::ShaderParameterBindingsMap& shader_parameter_bindings = shaderParameterBindings->getShaderParameterBindings();
-    ShaderParameterBindings::ShaderParameterBindingsMap::const_iterator iter = shader_parameter_bindings.begin();
-    ShaderParameterBindings::ShaderParameterBindingsMap::const_iterator end = shader_parameter_bindings.end();
 
-    while(iter != end)
+    // both maps are sorted by name, which allows a single lockstep pass
+    std::map<std::string, UniformVariable>::iterator variable_iter = d_uniformVariables.begin();
+    for (const auto& binding : shader_parameter_bindings)
     {
-        const CEGUI::ShaderParameter* parameter = iter->second;
+        while (variable_iter != d_uniformVariables.end() && variable_iter->first < binding.first)
+            ++variable_iter;
 
-        if(parameter->getType() != ShaderParamType::Texture)
-        {
-            std::map<std::string, ShaderParameter*>::iterator found_iterator = d_shaderParameterStates.find(iter->first);
-            if(found_iterator != d_shaderParameterStates.end())
-            {
-                ShaderParameter* last_shader_parameter = found_iterator->second;
-                if(parameter->equal(last_shader_parameter))
-                {
-                    ++iter;
-                    continue;
-                }
-                else
-                {
-                    if(parameter->getType() == last_shader_parameter->getType())
-                        last_shader_parameter->takeOverParameterValue(parameter);
-                    else
-                    {
-                        delete found_iterator->second;
-                        found_iterator->second = parameter->clone();
-                    }
-                }
-            }
-            else
-            {
-                d_shaderParameterStates[iter->first] = parameter->clone();
-            }
-        }
+        if (variable_iter == d_uniformVariables.end() || variable_iter->first != binding.first)
+            throw RendererException("OpenGLBaseShaderWrapper::prepareForRendering: An uniform variable with the name \"" +
+                                    binding.first + "\" has not been added to the ShaderWrapper.");
 
-        const GLint& location = d_uniformVariables.find(iter->first)->second;
+        updateUniform(variable_iter->second, *binding.second);
+    }
+}
 
+//----------------------------------------------------------------------------//
+void OpenGLBaseShaderWrapper::updateUniform(UniformVariable& variable, const ShaderParameter& parameter)
+{
+    const CEGUI::ShaderParamType parameter_type = parameter.getType();
 
-        CEGUI::ShaderParamType parameter_type = parameter->getType();
+    // texture bindings are not program state, the state change wrapper
+    // filters them against what is currently bound to the texture unit
+    if (parameter_type == ShaderParamType::Texture)
+    {
+        const CEGUI::ShaderParameterTexture& parameterTexture = static_cast<const CEGUI::ShaderParameterTexture&>(parameter);
+        const CEGUI::OpenGLTexture* openglTexture = static_cast<const CEGUI::OpenGLTexture*>(parameterTexture.d_parameterValue);
 
-        switch(parameter_type)
+        d_glStateChangeWrapper->activeTexture(variable.d_location);
+        d_glStateChangeWrapper->bindTexture(GL_TEXTURE_2D, openglTexture->getOpenGLTexture());
+        return;
+    }
+
+    ShaderParameter*& last_value = variable.d_lastValue;
+    if (last_value && parameter.equal(last_value))
+    {
+        d_glStateChangeWrapper->recordUniformUpdate(false);
+        return;
+    }
+
+    if (last_value && last_value->getType() == parameter_type)
+    {
+        last_value->takeOverParameterValue(&parameter);
+    }
+    else
+    {
+        delete last_value;
+        last_value = parameter.clone();
+    }
+
+    d_glStateChangeWrapper->recordUniformUpdate(true);
+
+    switch(parameter_type)
+    {
+    case ShaderParamType::Int:
         {
-        case ShaderParamType::Int:
-            {
-                const CEGUI::ShaderParameterInt* parameterInt = static_cast<const CEGUI::ShaderParameterInt*>(parameter);
-                glUniform1i(location, parameterInt->d_parameterValue);
-            }
-            break;
-        case ShaderParamType::Float:
-            {
-                const CEGUI::ShaderParameterFloat* parameterFloat = static_cast<const CEGUI::ShaderParameterFloat*>(parameter);
-                glUniform1f(location, parameterFloat->d_parameterValue);
-            }
-            break;
-        case ShaderParamType::Matrix4X4:
-            {
-                const CEGUI::ShaderParameterMatrix* parameterMatrix = static_cast<const CEGUI::ShaderParameterMatrix*>(parameter);
-                glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(parameterMatrix->d_parameterValue));
-            }
-            break;
-        case ShaderParamType::Texture:
-            {
-                const CEGUI::ShaderParameterTexture* parameterTexture = static_cast<const CEGUI::ShaderParameterTexture*>(parameter);
-                const CEGUI::OpenGLTexture* openglTexture = static_cast<const CEGUI::OpenGLTexture*>(parameterTexture->d_parameterValue);
-
-                d_glStateChangeWrapper->activeTexture(location);
-                d_glStateChangeWrapper->bindTexture(GL_TEXTURE_2D, openglTexture->getOpenGLTexture());
-            }
-            break;
-        default:
-            break;
+            const CEGUI::ShaderParameterInt& parameterInt = static_cast<const CEGUI::ShaderParameterInt&>(parameter);
+            glUniform1i(variable.d_location, parameterInt.d_parameterValue);
         }
-
-        ++iter;
+        break;
+    case ShaderParamType::Float:
+        {
+            const CEGUI::ShaderParameterFloat& parameterFloat = static_cast<const CEGUI::ShaderParameterFloat&>(parameter);
+            glUniform1f(variable.d_location, parameterFloat.d_parameterValue);
+        }
+        break;
+    case ShaderParamType::Matrix4X4:
+        {
+            const CEGUI::ShaderParameterMatrix& parameterMatrix = static_cast<const CEGUI::ShaderParameterMatrix&>(parameter);
+            glUniformMatrix4fv(variable.d_location, 1, GL_FALSE, glm::value_ptr(parameterMatrix.d_parameterValue));
+        }
+        break;
+    default:
+        break;
     }
 }
 
@@ -185,9 +189,9 @@ GLint OpenGLBaseShaderWrapper::getAttributeLocation(const std::string& attribute
 //----------------------------------------------------------------------------//
 GLint OpenGLBaseShaderWrapper::getUniformLocation(const std::string& uniformName) const
 {
-    std::map<std::string, GLint>::const_iterator iter = d_uniformVariables.find(uniformName);
+    std::map<std::string, UniformVariable>::const_iterator iter = d_uniformVariables.find(uniformName);
     if(iter != d_uniformVariables.end())
-        return iter->second;
+        return iter->second.d_location;
 
     throw RendererException("OpenGLBaseShaderWrapper::getUniformLocation: An uniform variable with the name \"" + uniformName + "\" has not been added to the ShaderWrapper.");
 }
@@ -70,7 +70,15 @@ GLES2FBOTextureTarget::~GLES2FBOTextureTarget()
 //----------------------------------------------------------------------------//
 void GLES2FBOTextureTarget::declareRenderSize(const Sizef& sz)
 {
-    setArea(Rectf(d_area.getPosition(), d_owner.getAdjustedTextureSize(sz)));
+    const Sizef adjustedSize(d_owner.getAdjustedTextureSize(
+        d_growthPolicy.getStorageSize(d_area.getSize(), sz)));
+
+    // keep the texture while it can hold the content, e.g. during resizing or
+    // when reused from the pool; the content is drawn to its top left part
+    if (d_area.getSize() == adjustedSize)
+        return;
+
+    setArea(Rectf(d_area.getPosition(), adjustedSize));
     resizeRenderTexture();
 }
 
@@ -28,6 +28,7 @@
 #include "CEGUI/RendererModules/OpenGL/GLES2GeometryBuffer.h"
 #include "CEGUI/RendererModules/OpenGL/GLES2Renderer.h"
 #include "CEGUI/RenderEffect.h"
+#include "CEGUI/RenderTarget.h"
 #include "CEGUI/Vertex.h"
 #include "CEGUI/ShaderParameterBindings.h"
 #include "CEGUI/RendererModules/OpenGL/ShaderManager.h"
@@ -71,10 +72,12 @@ void GLES2GeometryBuffer::draw() const
 
     if (d_clippingActive)
     {
-        d_glStateChanger->scissor(static_cast<GLint>(d_preparedClippingRegion.left()),
-            static_cast<GLint>(viewPort.getHeight() - d_preparedClippingRegion.bottom()),
-            static_cast<GLint>(d_preparedClippingRegion.getWidth()),
-            static_cast<GLint>(d_preparedClippingRegion.getHeight()));
+        const Rectf clipRegion(d_owner.getActiveRenderTarget()->getPixelRegion(
+            getPreparedClippingRegion()));
+        d_glStateChanger->scissor(static_cast<GLint>(clipRegion.left()),
+            static_cast<GLint>(viewPort.getHeight() - clipRegion.bottom()),
+            static_cast<GLint>(clipRegion.getWidth()),
+            static_cast<GLint>(clipRegion.getHeight()));
 
         d_glStateChanger->enable(GL_SCISSOR_TEST);
     }
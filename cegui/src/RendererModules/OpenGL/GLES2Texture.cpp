@@ -50,28 +50,32 @@ GLES2Texture::~GLES2Texture()
 //----------------------------------------------------------------------------//
 void GLES2Texture::initInternalPixelFormatFields(const PixelFormat fmt)
 {
+    if (initCompressedPixelFormatFields(fmt))
+        return;
+
     d_isCompressed = false;
+    d_pixelFormat = fmt;
 
     switch(fmt)
     {
     case PixelFormat::Rgba:
-        d_format = GL_RGBA;
-        d_subpixelFormat = GL_UNSIGNED_BYTE;
+        d_pixelDataFormat = GL_RGBA;
+        d_pixelDataType = GL_UNSIGNED_BYTE;
         break;
 
     case PixelFormat::Rgb:
-        d_format = GL_RGB;
-        d_subpixelFormat = GL_UNSIGNED_BYTE;
+        d_pixelDataFormat = GL_RGB;
+        d_pixelDataType = GL_UNSIGNED_BYTE;
         break;
 
     case PixelFormat::Rgb565:
-        d_format = GL_RGB;
-        d_subpixelFormat = GL_UNSIGNED_SHORT_5_6_5;
+        d_pixelDataFormat = GL_RGB;
+        d_pixelDataType = GL_UNSIGNED_SHORT_5_6_5;
         break;
 
     case PixelFormat::Rgba4444:
-        d_format = GL_RGBA;
-        d_subpixelFormat = GL_UNSIGNED_SHORT_4_4_4_4;
+        d_pixelDataFormat = GL_RGBA;
+        d_pixelDataType = GL_UNSIGNED_SHORT_4_4_4_4;
         break;
 
     default:
@@ -80,19 +84,6 @@ void GLES2Texture::initInternalPixelFormatFields(const PixelFormat fmt)
     }
 }
 
-
-
-//----------------------------------------------------------------------------//
-GLsizei GLES2Texture::getCompressedTextureSize(const Sizef& pixel_size) const
-{
-    GLsizei blocksize = 16;
-    return (
-               static_cast<GLsizei>(
-                   std::ceil(pixel_size.d_width / 4) *
-                   std::ceil(pixel_size.d_height / 4) *
-                   blocksize));
-}
-
 //----------------------------------------------------------------------------//
 void GLES2Texture::setTextureSize_impl(const Sizef& sz)
 {
@@ -116,7 +107,7 @@ void GLES2Texture::setTextureSize_impl(const Sizef& sz)
     if(d_isCompressed)
     {
         const GLsizei image_size = getCompressedTextureSize(size);
-        glCompressedTexImage2D(GL_TEXTURE_2D, 0, d_format,
+        glCompressedTexImage2D(GL_TEXTURE_2D, 0, d_pixelDataFormat,
                                static_cast<GLsizei>(size.d_width),
                                static_cast<GLsizei>(size.d_height),
                                0, image_size, 0);
@@ -52,13 +52,14 @@ void OpenGLGeometryBuffer::draw(std::uint32_t /*drawModeMask*/) const
     if (d_clippingActive)
     {
         // Skip completely clipped geometry
-        const GLint w = static_cast<GLint>(d_preparedClippingRegion.getWidth());
-        const GLint h = static_cast<GLint>(d_preparedClippingRegion.getHeight());
+        const Rectf& clipRegion = getPreparedClippingRegion();
+        const GLint w = static_cast<GLint>(clipRegion.getWidth());
+        const GLint h = static_cast<GLint>(clipRegion.getHeight());
         if (!w || !h)
             return;
 
-        glScissor(static_cast<GLint>(d_preparedClippingRegion.left()),
-            static_cast<GLint>(d_owner.getActiveViewPort().getHeight() - d_preparedClippingRegion.bottom()),
+        glScissor(static_cast<GLint>(clipRegion.left()),
+            static_cast<GLint>(d_owner.getActiveViewPort().getHeight() - clipRegion.bottom()),
             w, h);
 
         glEnable(GL_SCISSOR_TEST);
@@ -45,7 +45,11 @@ OpenGL1Texture::OpenGL1Texture(OpenGLRendererBase& owner, const String& name)
 //----------------------------------------------------------------------------//
 void OpenGL1Texture::initInternalPixelFormatFields(const PixelFormat fmt)
 {
+    if (initCompressedPixelFormatFields(fmt))
+        return;
+
     d_isCompressed = false;
+    d_pixelFormat = fmt;
 
     switch(fmt)
     {
@@ -69,30 +73,6 @@ void OpenGL1Texture::initInternalPixelFormatFields(const PixelFormat fmt)
         d_pixelDataType = GL_UNSIGNED_SHORT_4_4_4_4;
         break;
 
-    case PixelFormat::RgbDxt1:
-        d_pixelDataFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
-        d_pixelDataType = GL_UNSIGNED_BYTE; // not used.
-        d_isCompressed = true;
-        break;
-
-    case PixelFormat::RgbaDxt1:
-        d_pixelDataFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
-        d_pixelDataType = GL_UNSIGNED_BYTE; // not used.
-        d_isCompressed = true;
-        break;
-
-    case PixelFormat::RgbaDxt3:
-        d_pixelDataFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
-        d_pixelDataType = GL_UNSIGNED_BYTE; // not used.
-        d_isCompressed = true;
-        break;
-
-    case PixelFormat::RgbaDxt5:
-        d_pixelDataFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
-        d_pixelDataType = GL_UNSIGNED_BYTE; // not used.
-        d_isCompressed = true;
-        break;
-
     default:
         throw RendererException(
                         "invalid or unsupported CEGUI::PixelFormat.");
@@ -104,24 +84,6 @@ OpenGL1Texture::~OpenGL1Texture()
 {
 }
 
-//----------------------------------------------------------------------------//
-GLsizei OpenGL1Texture::getCompressedTextureSize(const Sizef& pixel_size) const
-{
-    GLsizei blocksize = 16;
-
-    if(d_pixelDataFormat == GL_COMPRESSED_RGB_S3TC_DXT1_EXT ||
-            d_pixelDataFormat == GL_COMPRESSED_RGBA_S3TC_DXT1_EXT)
-    {
-        blocksize = 8;
-    }
-
-    return (
-               static_cast<GLsizei>(
-                   std::ceil(pixel_size.d_width / 4) *
-                   std::ceil(pixel_size.d_height / 4) *
-                   blocksize));
-}
-
 //----------------------------------------------------------------------------//
 void OpenGL1Texture::setTextureSize_impl(const Sizef& sz)
 {
@@ -164,6 +126,9 @@ void OpenGL1Texture::setTextureSize_impl(const Sizef& sz)
 //----------------------------------------------------------------------------//
 void OpenGL1Texture::blitToMemory(void* targetData)
 {
+    // the texture has to hold the updates that are still gathered
+    d_owner.flushTextureUploads();
+
     if (OpenGLInfo::getSingleton().isUsingOpenglEs())
     {
         /* OpenGL ES 3.1 or below doesn't support
@@ -200,8 +165,9 @@ void OpenGL1Texture::blitToMemory(void* targetData)
         }
         glGetIntegerv(GL_PACK_ALIGNMENT, &pack_alignment_old);
         glPixelStorei(GL_PACK_ALIGNMENT, 1);
-        glReadPixels(0, 0, static_cast<GLsizei>(d_dataSize.d_width),
-            static_cast<GLsizei>(d_dataSize.d_height), GL_RGBA, GL_UNSIGNED_BYTE, targetData);
+        const Sizef read_size(getResidentSize(d_dataSize));
+        glReadPixels(0, 0, static_cast<GLsizei>(read_size.d_width),
+            static_cast<GLsizei>(read_size.d_height), GL_RGBA, GL_UNSIGNED_BYTE, targetData);
         glPixelStorei(GL_PACK_ALIGNMENT, pack_alignment_old);
         if (OpenGLInfo::getSingleton().isReadBufferSupported())
         {
@@ -40,6 +40,8 @@
 #include <sstream>
 #include <iostream>
 #include <algorithm>
+#include <cstring>
+#include <unordered_set>
 
 namespace CEGUI
 {
@@ -121,6 +123,9 @@ OpenGLRendererBase::~OpenGLRendererBase()
     OpenGLRendererBase::destroyAllTextureTargets();
     OpenGLRendererBase::destroyAllTextures();
 
+    if (d_textureUploadBuffer)
+        glDeleteBuffers(1, &d_textureUploadBuffer);
+
     delete d_defaultTarget;
 }
 
@@ -203,6 +208,8 @@ void OpenGLRendererBase::destroyTextureTarget(TextureTarget* target)
 //----------------------------------------------------------------------------//
 void OpenGLRendererBase::destroyAllTextureTargets()
 {
+    getTextureTargetPool().forgetAll();
+
     while (!d_textureTargets.empty())
         destroyTextureTarget(*d_textureTargets.begin());
 }
@@ -378,6 +385,8 @@ bool OpenGLRendererBase::getStateResettingEnabled()
 //----------------------------------------------------------------------------//
 void OpenGLRendererBase::grabTextures()
 {
+    flushTextureUploads();
+
     // perform grab operations for texture targets
     TextureTargetList::iterator target_iterator = d_textureTargets.begin();
     for (; target_iterator != d_textureTargets.end(); ++target_iterator)
@@ -477,6 +486,125 @@ void OpenGLRendererBase::checkGLErrors(const String& fileName, int line, const S
     }
 }
 
+//----------------------------------------------------------------------------//
+void OpenGLRendererBase::setTextureUploadDeferred(bool deferred)
+{
+    if (!deferred)
+        flushTextureUploads();
+
+    d_textureUploadDeferred = deferred;
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGLRendererBase::queueTextureUpload(OpenGLTexture& texture,
+    const void* data, const Rectf& area, std::size_t size, bool mergeable)
+{
+    if (!d_textureUploadDeferred)
+        return false;
+
+    // earlier updates of the texture that this one covers need no upload
+    d_pendingTextureUploads.erase(std::remove_if(d_pendingTextureUploads.begin(),
+        d_pendingTextureUploads.end(), [&](const PendingTextureUpload& upload)
+        {
+            return upload.d_texture == &texture &&
+                area.left() <= upload.d_area.left() && area.top() <= upload.d_area.top() &&
+                area.right() >= upload.d_area.right() && area.bottom() >= upload.d_area.bottom();
+        }), d_pendingTextureUploads.end());
+
+    const std::size_t offset = d_textureUploadStaging.size();
+    d_textureUploadStaging.resize(offset + size);
+    std::memcpy(d_textureUploadStaging.data() + offset, data, size);
+
+    // rows continuing the last update directly follow its data, so both are
+    // uploaded as one rectangle
+    if (mergeable && !d_pendingTextureUploads.empty())
+    {
+        PendingTextureUpload& last = d_pendingTextureUploads.back();
+        if (last.d_texture == &texture && last.d_mergeable &&
+            last.d_offset + last.d_size == offset &&
+            last.d_area.left() == area.left() && last.d_area.right() == area.right() &&
+            last.d_area.bottom() == area.top())
+        {
+            last.d_area.bottom(area.bottom());
+            last.d_size += size;
+            return true;
+        }
+    }
+
+    PendingTextureUpload upload;
+    upload.d_texture = &texture;
+    upload.d_area = area;
+    upload.d_offset = offset;
+    upload.d_size = size;
+    upload.d_mergeable = mergeable;
+    d_pendingTextureUploads.push_back(upload);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGLRendererBase::discardTextureUploads(const OpenGLTexture& texture)
+{
+    d_pendingTextureUploads.erase(std::remove_if(d_pendingTextureUploads.begin(),
+        d_pendingTextureUploads.end(), [&](const PendingTextureUpload& upload)
+        {
+            return upload.d_texture == &texture;
+        }), d_pendingTextureUploads.end());
+}
+
+//----------------------------------------------------------------------------//
+void OpenGLRendererBase::flushTextureUploads()
+{
+    if (d_pendingTextureUploads.empty())
+    {
+        d_textureUploadStaging.clear();
+        return;
+    }
+
+    // the mip levels of a texture are generated along with its last update
+    std::vector<bool> last_update(d_pendingTextureUploads.size(), false);
+    std::unordered_set<const OpenGLTexture*> updated_textures;
+    for (std::size_t i = d_pendingTextureUploads.size(); i-- > 0;)
+        last_update[i] = updated_textures.insert(d_pendingTextureUploads[i].d_texture).second;
+
+    // a single copy of the staging data is handed to OpenGL, which then
+    // transfers the texture data from the buffer object asynchronously
+    const bool use_buffer_object = OpenGLInfo::getSingleton().isPixelBufferObjectSupported();
+    if (use_buffer_object)
+    {
+        if (!d_textureUploadBuffer)
+            glGenBuffers(1, &d_textureUploadBuffer);
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, d_textureUploadBuffer);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER,
+                     static_cast<GLsizeiptr>(d_textureUploadStaging.size()),
+                     d_textureUploadStaging.data(), GL_STREAM_DRAW);
+    }
+
+    for (std::size_t i = 0; i < d_pendingTextureUploads.size(); ++i)
+    {
+        const PendingTextureUpload& upload = d_pendingTextureUploads[i];
+        const void* data = use_buffer_object ?
+            reinterpret_cast<const void*>(static_cast<std::uintptr_t>(upload.d_offset)) :
+            d_textureUploadStaging.data() + upload.d_offset;
+
+        upload.d_texture->uploadResidentData(data, upload.d_area, last_update[i]);
+    }
+
+    if (use_buffer_object)
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    getCurrentFrameStats().d_textureUploads += d_pendingTextureUploads.size();
+    d_pendingTextureUploads.clear();
+
+    // don't hold on to the memory of large one-off uploads such as imagesets
+    static const std::size_t MaxRetainedStagingSize = 4 * 1024 * 1024;
+    if (d_textureUploadStaging.capacity() > MaxRetainedStagingSize)
+        std::vector<std::uint8_t>().swap(d_textureUploadStaging);
+    else
+        d_textureUploadStaging.clear();
+}
+
 //----------------------------------------------------------------------------//
 
 }
@@ -89,6 +89,17 @@ void OpenGLBaseShader::bind() const
     d_glStateChanger->useProgram(d_program);
 }
 
+//----------------------------------------------------------------------------//
+bool OpenGLBaseShader::bindUniformBlock(const std::string &name, GLuint bindingPoint)
+{
+    const GLuint block_index = glGetUniformBlockIndex(d_program, name.c_str());
+    if (block_index == GL_INVALID_INDEX)
+        return false;
+
+    glUniformBlockBinding(d_program, block_index, bindingPoint);
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 GLint OpenGLBaseShader::getAttribLocation(const std::string &name) const
 {
@@ -79,6 +79,10 @@ void OpenGLBaseShaderManager::initialiseShaders()
         {
             loadShader(OpenGLBaseShaderID::StandardTextured, StandardShaderTexturedVertDesktopOpengl3, StandardShaderTexturedFragDesktopOpengl3);
             loadShader(OpenGLBaseShaderID::StandardSolid, StandardShaderSolidVertDesktopOpengl3, StandardShaderSolidFragDesktopOpengl3);
+            if (OpenGLInfo::getSingleton().isInstancedArraysSupported())
+                loadShader(OpenGLBaseShaderID::StandardTexturedInstanced, StandardShaderTexturedInstancedVertDesktopOpengl3, StandardShaderTexturedFragDesktopOpengl3);
+            loadShader(OpenGLBaseShaderID::StandardDistanceField, StandardShaderTexturedVertDesktopOpengl3, StandardShaderDistanceFieldFragDesktopOpengl3);
+            loadShader(OpenGLBaseShaderID::StandardLayeredGlyph, StandardShaderTexturedVertDesktopOpengl3, StandardShaderLayeredGlyphFragDesktopOpengl3);
         }
         else if (OpenGLInfo::getSingleton().verMajor() <= 2) // Open GL ES < 3
         {
@@ -89,6 +93,10 @@ void OpenGLBaseShaderManager::initialiseShaders()
         {
             loadShader(OpenGLBaseShaderID::StandardTextured, StandardShaderTexturedVertOpenglEs3, StandardShaderTexturedFragOpenglEs3);
             loadShader(OpenGLBaseShaderID::StandardSolid, StandardShaderSolidVertOpenglEs3, StandardShaderSolidFragOpenglEs3);
+            if (OpenGLInfo::getSingleton().isInstancedArraysSupported())
+                loadShader(OpenGLBaseShaderID::StandardTexturedInstanced, StandardShaderTexturedInstancedVertOpenglEs3, StandardShaderTexturedFragOpenglEs3);
+            loadShader(OpenGLBaseShaderID::StandardDistanceField, StandardShaderTexturedVertOpenglEs3, StandardShaderDistanceFieldFragOpenglEs3);
+            loadShader(OpenGLBaseShaderID::StandardLayeredGlyph, StandardShaderTexturedVertOpenglEs3, StandardShaderLayeredGlyphFragOpenglEs3);
         }
 
             
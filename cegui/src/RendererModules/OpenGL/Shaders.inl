@@ -31,18 +31,62 @@
 namespace CEGUI
 {
 
+/*  The desktop OpenGL 3.2 shaders take their matrix and alpha from entry
+    drawSlot - 1 of the PerDrawData uniform block if drawSlot is positive, see
+    OpenGL3Renderer::setPerDrawDataBufferEnabled. The array size of the block
+    has to match OpenGL3Renderer::PerDrawChunkEntryCount.
+
+    The OpenGL 3.2 and OpenGL ES 3.0 fragment shaders premultiply their output
+    by its alpha when premultipliedAlpha is 1, see
+    Renderer::setPremultipliedAlphaEnabled. Vertex colours always have straight
+    alpha, textures then have premultiplied alpha.
+
+    The OpenGL 3.2 and OpenGL ES 3.0 fragment shaders multiply their alpha
+    with the clipping mask of the GeometryBuffer, see
+    GeometryBuffer::getClippingMaskMatrix for the layout of clipMask. The
+    vertex shaders pass the untransformed position on for this. */
+
+/*! The GLSL function evaluating the clipping mask at a vertex position. The
+    rounded rectangle distance is computed in any case, as fwidth must not be
+    used in non-uniform control flow. */
+#define CEGUI_GLSL_CLIP_MASK_FUNCTION \
+"uniform mat4 clipMask;\n" \
+"uniform sampler2D clipMaskTexture;\n" \
+"float clipMaskCoverage(vec2 position)\n" \
+"{\n" \
+    "vec4 area = clipMask[0];\n" \
+    "float radius = clipMask[2].y;\n" \
+    "vec2 q = abs(position - (area.xy + area.zw) * 0.5) - abs(area.zw - area.xy) * 0.5 + radius;\n" \
+    "float distance = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - radius;\n" \
+    "float rounded = clamp(0.5 - distance / max(fwidth(distance), 0.0001), 0.0, 1.0);\n" \
+    "if (clipMask[2].x < 0.5)\n" \
+        "return 1.0;\n" \
+    "if (clipMask[2].x < 1.5)\n" \
+        "return rounded;\n" \
+    "vec2 uv = (position - area.xy) / (area.zw - area.xy);\n" \
+    "if (any(lessThan(uv, vec2(0.0))) || any(greaterThan(uv, vec2(1.0))))\n" \
+        "return 0.0;\n" \
+    "return textureLod(clipMaskTexture, mix(clipMask[1].xy, clipMask[1].zw, uv), 0.0).a;\n" \
+"}\n"
+
 /*! A string containing a desktop OpenGL 3.2 vertex shader for solid colouring
     of a polygon. */
 static const char StandardShaderSolidVertDesktopOpengl3[] = 
 "#version 150 core\n"
 "uniform mat4 modelViewProjMatrix;\n"
+"struct PerDraw { mat4 modelViewProjMatrix; vec4 parameters; };\n"
+"layout(std140) uniform PerDrawData { PerDraw perDraw[128]; };\n"
+"uniform int drawSlot;\n"
 "in vec3 inPosition;\n"
 "in vec4 inColour;\n"
+"out vec2 exPosition;\n"
 "out vec4 exColour;\n"
 "void main(void)\n"
 "{\n"
+    "exPosition = inPosition.xy;\n"
     "exColour = inColour;\n"
-    "gl_Position = modelViewProjMatrix * vec4(inPosition, 1.0);\n"
+    "mat4 matrix = drawSlot > 0 ? perDraw[drawSlot - 1].modelViewProjMatrix : modelViewProjMatrix;\n"
+    "gl_Position = matrix * vec4(inPosition, 1.0);\n"
 "}"
 ;
 
@@ -51,12 +95,20 @@ static const char StandardShaderSolidVertDesktopOpengl3[] =
 static const char StandardShaderSolidFragDesktopOpengl3[] = 
 "#version 150 core\n"
 "in vec4 exColour;\n"
+"in vec2 exPosition;\n"
 "out vec4 out0;\n"
 "uniform float alphaFactor;\n"
+"uniform float premultipliedAlpha;\n"
+"struct PerDraw { mat4 modelViewProjMatrix; vec4 parameters; };\n"
+"layout(std140) uniform PerDrawData { PerDraw perDraw[128]; };\n"
+"uniform int drawSlot;\n"
+CEGUI_GLSL_CLIP_MASK_FUNCTION
 "void main(void)\n"
 "{\n"
     "out0 = exColour;\n"
-    "out0.a *= alphaFactor;\n"
+    "out0.a *= drawSlot > 0 ? perDraw[drawSlot - 1].parameters.x : alphaFactor;\n"
+    "out0.a *= clipMaskCoverage(exPosition);\n"
+    "out0.rgb *= mix(1.0, out0.a, premultipliedAlpha);\n"
 "}"
 ;
 
@@ -67,17 +119,23 @@ static const char StandardShaderSolidFragDesktopOpengl3[] =
 static const char StandardShaderTexturedVertDesktopOpengl3[] = 
 "#version 150 core\n"
 "uniform mat4 modelViewProjMatrix;\n"
+"struct PerDraw { mat4 modelViewProjMatrix; vec4 parameters; };\n"
+"layout(std140) uniform PerDrawData { PerDraw perDraw[128]; };\n"
+"uniform int drawSlot;\n"
 "in vec3 inPosition;\n"
 "in vec2 inTexCoord;\n"
 "in vec4 inColour;\n"
+"out vec2 exPosition;\n"
 "out vec2 exTexCoord;\n"
 "out vec4 exColour;\n"
 "void main(void)\n"
 "{\n"
+    "exPosition = inPosition.xy;\n"
     "exTexCoord = inTexCoord;\n"
     "exColour = inColour;\n"
 
-    "gl_Position = modelViewProjMatrix * vec4(inPosition, 1.0);\n"
+    "mat4 matrix = drawSlot > 0 ? perDraw[drawSlot - 1].modelViewProjMatrix : modelViewProjMatrix;\n"
+    "gl_Position = matrix * vec4(inPosition, 1.0);\n"
 "}"
 ;
 
@@ -90,12 +148,118 @@ static const char StandardShaderTexturedFragDesktopOpengl3[] =
 "uniform sampler2D texture0;\n"
 "in vec2 exTexCoord;\n"
 "in vec4 exColour;\n"
+"in vec2 exPosition;\n"
 "out vec4 out0;\n"
 "uniform float alphaFactor;\n"
+"uniform float premultipliedAlpha;\n"
+"struct PerDraw { mat4 modelViewProjMatrix; vec4 parameters; };\n"
+"layout(std140) uniform PerDrawData { PerDraw perDraw[128]; };\n"
+"uniform int drawSlot;\n"
+CEGUI_GLSL_CLIP_MASK_FUNCTION
 "void main(void)\n"
 "{\n"
+    "float alpha = drawSlot > 0 ? perDraw[drawSlot - 1].parameters.x : alphaFactor;\n"
+    "alpha *= clipMaskCoverage(exPosition);\n"
     "out0 = texture(texture0, exTexCoord) * exColour;\n"
-    "out0.a *= alphaFactor;\n"
+    "out0.a *= alpha;\n"
+    "out0.rgb *= mix(1.0, exColour.a * alpha, premultipliedAlpha);\n"
+"}"
+;
+
+/*! A string containing a desktop OpenGL 3.2 fragment shader for polygons
+    textured with a signed distance field, such as the glyphs of distance field
+    fonts. The texture alpha holds the distance with the edge at 0.5, which is
+    turned into coverage over the width of a screen pixel, so the edges stay
+    sharp at any scale. It is used together with the textured vertex shader. */
+static const char StandardShaderDistanceFieldFragDesktopOpengl3[] = 
+"#version 150 core\n"
+"uniform sampler2D texture0;\n"
+"in vec2 exTexCoord;\n"
+"in vec4 exColour;\n"
+"in vec2 exPosition;\n"
+"out vec4 out0;\n"
+"uniform float alphaFactor;\n"
+"uniform float premultipliedAlpha;\n"
+"struct PerDraw { mat4 modelViewProjMatrix; vec4 parameters; };\n"
+"layout(std140) uniform PerDrawData { PerDraw perDraw[128]; };\n"
+"uniform int drawSlot;\n"
+CEGUI_GLSL_CLIP_MASK_FUNCTION
+"void main(void)\n"
+"{\n"
+    "float distance = texture(texture0, exTexCoord).a;\n"
+    "float width = max(fwidth(distance), 0.0001);\n"
+    "out0 = exColour;\n"
+    "out0.a *= smoothstep(0.5 - width, 0.5 + width, distance);\n"
+    "out0.a *= drawSlot > 0 ? perDraw[drawSlot - 1].parameters.x : alphaFactor;\n"
+    "out0.a *= clipMaskCoverage(exPosition);\n"
+    "out0.rgb *= mix(1.0, out0.a, premultipliedAlpha);\n"
+"}"
+;
+
+/*! A string containing a desktop OpenGL 3.2 fragment shader for glyphs whose
+    layers are packed into the channels of one texture, layer 0 in alpha and
+    layers 1 to 3 in red, green and blue. The layers are composited from the
+    highest down, layer 0 in the vertex colour and the others in the columns
+    of layerColours. It is used together with the textured vertex shader. */
+static const char StandardShaderLayeredGlyphFragDesktopOpengl3[] = 
+"#version 150 core\n"
+"uniform sampler2D texture0;\n"
+"uniform mat4 layerColours;\n"
+"in vec2 exTexCoord;\n"
+"in vec4 exColour;\n"
+"in vec2 exPosition;\n"
+"out vec4 out0;\n"
+"uniform float alphaFactor;\n"
+"uniform float premultipliedAlpha;\n"
+"struct PerDraw { mat4 modelViewProjMatrix; vec4 parameters; };\n"
+"layout(std140) uniform PerDrawData { PerDraw perDraw[128]; };\n"
+"uniform int drawSlot;\n"
+CEGUI_GLSL_CLIP_MASK_FUNCTION
+"vec4 over(vec4 under, vec4 colour, float coverage)\n"
+"{\n"
+    "float a = colour.a * coverage;\n"
+    "return vec4(colour.rgb * a, a) + under * (1.0 - a);\n"
+"}\n"
+"void main(void)\n"
+"{\n"
+    "vec4 coverage = texture(texture0, exTexCoord);\n"
+    "vec4 layers = over(vec4(0.0), layerColours[3], coverage.b);\n"
+    "layers = over(layers, layerColours[2], coverage.g);\n"
+    "layers = over(layers, layerColours[1], coverage.r);\n"
+    "layers = over(layers, exColour, coverage.a);\n"
+    "float alpha = drawSlot > 0 ? perDraw[drawSlot - 1].parameters.x : alphaFactor;\n"
+    "alpha *= clipMaskCoverage(exPosition);\n"
+    "out0.a = layers.a * alpha;\n"
+    "out0.rgb = mix(layers.rgb / max(layers.a, 0.0001), layers.rgb * alpha, premultipliedAlpha);\n"
+"}"
+;
+
+/*! A string containing a desktop OpenGL 3.2 vertex shader for textured quads
+    that are drawn through instancing. Each instance supplies the destination
+    rect and texture rect as (left, top, right, bottom) and a single colour,
+    whose corners are selected by the shared per-vertex corner attribute. It
+    is used together with the textured fragment shader. */
+static const char StandardShaderTexturedInstancedVertDesktopOpengl3[] = 
+"#version 150 core\n"
+"uniform mat4 modelViewProjMatrix;\n"
+"struct PerDraw { mat4 modelViewProjMatrix; vec4 parameters; };\n"
+"layout(std140) uniform PerDrawData { PerDraw perDraw[128]; };\n"
+"uniform int drawSlot;\n"
+"in vec2 inCorner;\n"
+"in vec4 inRect;\n"
+"in vec4 inTexRect;\n"
+"in vec4 inColour;\n"
+"out vec2 exTexCoord;\n"
+"out vec4 exColour;\n"
+"out vec2 exPosition;\n"
+"void main(void)\n"
+"{\n"
+    "exTexCoord = mix(inTexRect.xy, inTexRect.zw, inCorner);\n"
+    "exColour = inColour;\n"
+
+    "mat4 matrix = drawSlot > 0 ? perDraw[drawSlot - 1].modelViewProjMatrix : modelViewProjMatrix;\n"
+    "exPosition = mix(inRect.xy, inRect.zw, inCorner);\n"
+    "gl_Position = matrix * vec4(exPosition, 0.0, 1.0);\n"
 "}"
 ;
 
@@ -106,9 +270,11 @@ static const char StandardShaderSolidVertOpenglEs3[] =
 "uniform mat4 modelViewProjMatrix;\n"
 "in vec3 inPosition;\n"
 "in vec4 inColour;\n"
+"out vec2 exPosition;\n"
 "out vec4 exColour;\n"
 "void main(void)\n"
 "{\n"
+    "exPosition = inPosition.xy;\n"
     "exColour = inColour;\n"
 
     "gl_Position = modelViewProjMatrix * vec4(inPosition, 1.0);\n"
@@ -121,12 +287,16 @@ static const char StandardShaderSolidFragOpenglEs3[] =
 "#version 300 es\n"
 "precision highp float;\n"
 "in vec4 exColour;\n"
+"in vec2 exPosition;\n"
 "layout(location = 0) out vec4 out0;\n"
 "uniform float alphaFactor;\n"
+"uniform float premultipliedAlpha;\n"
+CEGUI_GLSL_CLIP_MASK_FUNCTION
 "void main(void)\n"
 "{\n"
     "out0 = exColour;\n"
-    "out0.a *= alphaFactor;\n"
+    "out0.a *= alphaFactor * clipMaskCoverage(exPosition);\n"
+    "out0.rgb *= mix(1.0, out0.a, premultipliedAlpha);\n"
 "}"
 ;
 
@@ -140,10 +310,12 @@ static const char StandardShaderTexturedVertOpenglEs3[] =
 "in vec3 inPosition;\n"
 "in vec2 inTexCoord;\n"
 "in vec4 inColour;\n"
+"out vec2 exPosition;\n"
 "out vec2 exTexCoord;\n"
 "out vec4 exColour;\n"
 "void main(void)\n"
 "{\n"
+    "exPosition = inPosition.xy;\n"
     "exTexCoord = inTexCoord;\n"
     "exColour = inColour;\n"
 
@@ -161,12 +333,99 @@ static const char StandardShaderTexturedFragOpenglEs3[] =
 "uniform sampler2D texture0;\n"
 "in vec2 exTexCoord;\n"
 "in vec4 exColour;\n"
+"in vec2 exPosition;\n"
 "layout(location = 0) out vec4 out0;\n"
 "uniform float alphaFactor;\n"
+"uniform float premultipliedAlpha;\n"
+CEGUI_GLSL_CLIP_MASK_FUNCTION
 "void main(void)\n"
 "{\n"
+    "float alpha = alphaFactor * clipMaskCoverage(exPosition);\n"
     "out0 = texture(texture0, exTexCoord) * exColour;\n"
-    "out0.a *= alphaFactor;\n"
+    "out0.a *= alpha;\n"
+    "out0.rgb *= mix(1.0, exColour.a * alpha, premultipliedAlpha);\n"
+"}"
+;
+
+/*! A string containing an OpenGL ES 3.0 vertex shader for textured quads
+    that are drawn through instancing, see
+    StandardShaderTexturedInstancedVertDesktopOpengl3. It is used together
+    with the textured fragment shader. */
+static const char StandardShaderTexturedInstancedVertOpenglEs3[] = 
+"#version 300 es\n"
+"uniform mat4 modelViewProjMatrix;\n"
+"in vec2 inCorner;\n"
+"in vec4 inRect;\n"
+"in vec4 inTexRect;\n"
+"in vec4 inColour;\n"
+"out vec2 exTexCoord;\n"
+"out vec4 exColour;\n"
+"out vec2 exPosition;\n"
+"void main(void)\n"
+"{\n"
+    "exTexCoord = mix(inTexRect.xy, inTexRect.zw, inCorner);\n"
+    "exColour = inColour;\n"
+
+    "exPosition = mix(inRect.xy, inRect.zw, inCorner);\n"
+    "gl_Position = modelViewProjMatrix * vec4(exPosition, 0.0, 1.0);\n"
+"}"
+;
+
+/*! A string containing an OpenGL ES 3.0 fragment shader for polygons
+    textured with a signed distance field, with the edge at 0.5 in the texture
+    alpha. It is used together with the textured vertex shader. */
+static const char StandardShaderDistanceFieldFragOpenglEs3[] = 
+"#version 300 es\n"
+"precision highp float;\n"
+"uniform sampler2D texture0;\n"
+"in vec2 exTexCoord;\n"
+"in vec4 exColour;\n"
+"in vec2 exPosition;\n"
+"layout(location = 0) out vec4 out0;\n"
+"uniform float alphaFactor;\n"
+"uniform float premultipliedAlpha;\n"
+CEGUI_GLSL_CLIP_MASK_FUNCTION
+"void main(void)\n"
+"{\n"
+    "float distance = texture(texture0, exTexCoord).a;\n"
+    "float width = max(fwidth(distance), 0.0001);\n"
+    "out0 = exColour;\n"
+    "out0.a *= smoothstep(0.5 - width, 0.5 + width, distance) * alphaFactor * clipMaskCoverage(exPosition);\n"
+    "out0.rgb *= mix(1.0, out0.a, premultipliedAlpha);\n"
+"}"
+;
+
+/*! A string containing an OpenGL ES 3.0 fragment shader for glyphs whose
+    layers are packed into the channels of one texture, layer 0 in alpha and
+    layers 1 to 3 in red, green and blue. It is used together with the
+    textured vertex shader. */
+static const char StandardShaderLayeredGlyphFragOpenglEs3[] = 
+"#version 300 es\n"
+"precision highp float;\n"
+"uniform sampler2D texture0;\n"
+"uniform mat4 layerColours;\n"
+"in vec2 exTexCoord;\n"
+"in vec4 exColour;\n"
+"in vec2 exPosition;\n"
+"layout(location = 0) out vec4 out0;\n"
+"uniform float alphaFactor;\n"
+"uniform float premultipliedAlpha;\n"
+CEGUI_GLSL_CLIP_MASK_FUNCTION
+"vec4 over(vec4 under, vec4 colour, float coverage)\n"
+"{\n"
+    "float a = colour.a * coverage;\n"
+    "return vec4(colour.rgb * a, a) + under * (1.0 - a);\n"
+"}\n"
+"void main(void)\n"
+"{\n"
+    "vec4 coverage = texture(texture0, exTexCoord);\n"
+    "vec4 layers = over(vec4(0.0), layerColours[3], coverage.b);\n"
+    "layers = over(layers, layerColours[2], coverage.g);\n"
+    "layers = over(layers, layerColours[1], coverage.r);\n"
+    "layers = over(layers, exColour, coverage.a);\n"
+    "float alpha = alphaFactor * clipMaskCoverage(exPosition);\n"
+    "out0.a = layers.a * alpha;\n"
+    "out0.rgb = mix(layers.rgb / max(layers.a, 0.0001), layers.rgb * alpha, premultipliedAlpha);\n"
 "}"
 ;
 
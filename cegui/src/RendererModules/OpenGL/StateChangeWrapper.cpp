@@ -119,6 +119,14 @@ void OpenGLBaseStateChangeWrapper::BoundTexture::bindTexture(GLenum target, GLui
     d_texture = texture;
 }
 
+OpenGLBaseStateChangeWrapper::Statistics::Statistics() :
+    d_issuedStateChanges(0),
+    d_filteredStateChanges(0),
+    d_issuedUniformUpdates(0),
+    d_filteredUniformUpdates(0)
+{
+}
+
 
 
 
@@ -153,6 +161,7 @@ GLuint OpenGLBaseStateChangeWrapper::getBoundVertexArray() const
 
 void OpenGLBaseStateChangeWrapper::useProgram(GLuint program)
 {
+    recordStateChange(program != d_shaderProgram);
     if (program != d_shaderProgram)
     {
         glUseProgram(program);
@@ -167,6 +176,7 @@ GLuint OpenGLBaseStateChangeWrapper::getUsedProgram() const
 void OpenGLBaseStateChangeWrapper::blendFunc(GLenum sfactor, GLenum dfactor)
 {
     bool callIsRedundant = d_blendFuncSeperateParams.equal(sfactor, dfactor);
+    recordStateChange(!callIsRedundant);
     if (!callIsRedundant)
         glBlendFunc(sfactor, dfactor);
 }
@@ -179,6 +189,7 @@ OpenGLBaseStateChangeWrapper::BlendFuncSeperateParams OpenGLBaseStateChangeWrapp
 void OpenGLBaseStateChangeWrapper::blendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
 {
     bool callIsRedundant = d_blendFuncSeperateParams.equal(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    recordStateChange(!callIsRedundant);
     if (!callIsRedundant)
         glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
 }
@@ -186,6 +197,7 @@ void OpenGLBaseStateChangeWrapper::blendFuncSeparate(GLenum sfactorRGB, GLenum d
 void OpenGLBaseStateChangeWrapper::viewport(GLint x, GLint y, GLsizei width, GLsizei height)
 {
     bool callIsRedundant = d_viewPortParams.equal(x, y, width, height);
+    recordStateChange(!callIsRedundant);
     if(!callIsRedundant)
         glViewport(x, y, width, height);
 }
@@ -198,6 +210,7 @@ OpenGLBaseStateChangeWrapper::PortParams OpenGLBaseStateChangeWrapper::getViewpo
 void OpenGLBaseStateChangeWrapper::scissor(GLint x, GLint y, GLsizei width, GLsizei height)
 {
     bool callIsRedundant = d_scissorParams.equal(x, y, width, height);
+    recordStateChange(!callIsRedundant);
     if (!callIsRedundant)
         glScissor(x, y, width, height);
 }
@@ -210,6 +223,7 @@ OpenGLBaseStateChangeWrapper::PortParams OpenGLBaseStateChangeWrapper::getScisso
 void OpenGLBaseStateChangeWrapper::bindBuffer(GLenum target, GLuint buffer)
 {
     bool callIsRedundant = d_bindBufferParams.equal(target, buffer);
+    recordStateChange(!callIsRedundant);
     if (!callIsRedundant)
         glBindBuffer(target, buffer);
 }
@@ -221,6 +235,7 @@ OpenGLBaseStateChangeWrapper::BindBufferParams OpenGLBaseStateChangeWrapper::get
 
 void OpenGLBaseStateChangeWrapper::activeTexture(unsigned int texture_position)
 {
+    recordStateChange(d_activeTexturePosition != texture_position);
     if (d_activeTexturePosition != texture_position)
     {
         while (texture_position >= d_boundTextures.size())
@@ -242,7 +257,9 @@ void OpenGLBaseStateChangeWrapper::bindTexture(GLenum target, GLuint texture)
         return;
 
     BoundTexture& boundTexture = d_boundTextures[d_activeTexturePosition];
-    if (boundTexture.d_target != target || boundTexture.d_texture != texture)
+    const bool changed = boundTexture.d_target != target || boundTexture.d_texture != texture;
+    recordStateChange(changed);
+    if (changed)
     {
         glBindTexture(target, texture);
         boundTexture.bindTexture(target, texture);
@@ -254,6 +271,7 @@ void OpenGLBaseStateChangeWrapper::enable(GLenum capability)
     std::map<GLenum, bool>::iterator found_iterator = d_enabledOpenGLStates.find(capability);
     if(found_iterator != d_enabledOpenGLStates.end())
     {
+        recordStateChange(found_iterator->second != true);
         if(found_iterator->second != true)
         {
             glEnable(capability);
@@ -263,6 +281,7 @@ void OpenGLBaseStateChangeWrapper::enable(GLenum capability)
     else
     {
         d_enabledOpenGLStates[capability] = true;
+        recordStateChange(true);
         glEnable(capability);
     }
 }
@@ -272,6 +291,7 @@ void OpenGLBaseStateChangeWrapper::disable(GLenum capability)
     std::map<GLenum, bool>::iterator found_iterator = d_enabledOpenGLStates.find(capability);
     if(found_iterator != d_enabledOpenGLStates.end())
     {
+        recordStateChange(found_iterator->second != false);
         if(found_iterator->second != false)
         {
             glDisable(capability);
@@ -281,6 +301,7 @@ void OpenGLBaseStateChangeWrapper::disable(GLenum capability)
     else
     {
         d_enabledOpenGLStates[capability] = false;
+        recordStateChange(true);
         glDisable(capability);
     }
 }
@@ -300,5 +321,26 @@ int OpenGLBaseStateChangeWrapper::isStateEnabled(GLenum capability) const
         return -1;
 }
 
+void OpenGLBaseStateChangeWrapper::resetStatistics()
+{
+    d_statistics = Statistics();
+}
+
+void OpenGLBaseStateChangeWrapper::recordUniformUpdate(bool issued)
+{
+    if (issued)
+        ++d_statistics.d_issuedUniformUpdates;
+    else
+        ++d_statistics.d_filteredUniformUpdates;
+}
+
+void OpenGLBaseStateChangeWrapper::recordStateChange(bool issued)
+{
+    if (issued)
+        ++d_statistics.d_issuedStateChanges;
+    else
+        ++d_statistics.d_filteredStateChanges;
+}
+
 
 }
@@ -33,10 +33,76 @@
 #include "CEGUI/ImageCodec.h"
 #include "CEGUI/DataContainer.h"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace CEGUI
 {
+namespace
+{
+//----------------------------------------------------------------------------//
+/*
+    Box filters 8 bit RGB or RGBA pixels down by the given number of mip levels
+    into \a result, which always receives RGBA pixels.
+*/
+const void* downsamplePixels(const void* buffer, const Sizef& size,
+                             Texture::PixelFormat fmt, GLint levels,
+                             std::vector<std::uint8_t>& result)
+{
+    std::size_t width = static_cast<std::size_t>(size.d_width);
+    std::size_t height = static_cast<std::size_t>(size.d_height);
+    std::size_t channels = (fmt == Texture::PixelFormat::Rgb) ? 3 : 4;
+    const std::uint8_t* src = static_cast<const std::uint8_t*>(buffer);
+
+    std::vector<std::uint8_t> level;
+    for (GLint i = 0; i < levels; ++i)
+    {
+        const std::size_t w = std::max<std::size_t>(width / 2, 1);
+        const std::size_t h = std::max<std::size_t>(height / 2, 1);
+        level.resize(w * h * 4);
+
+        for (std::size_t y = 0; y < h; ++y)
+        {
+            const std::size_t row0 = std::min(y * 2, height - 1) * width;
+            const std::size_t row1 = std::min(y * 2 + 1, height - 1) * width;
+
+            for (std::size_t x = 0; x < w; ++x)
+            {
+                const std::size_t x0 = std::min(x * 2, width - 1);
+                const std::size_t x1 = std::min(x * 2 + 1, width - 1);
+                std::uint8_t* dst = &level[(y * w + x) * 4];
+
+                for (std::size_t c = 0; c < 4; ++c)
+                {
+                    if (c >= channels)
+                    {
+                        dst[c] = 0xFF;
+                        continue;
+                    }
+
+                    const unsigned int sum =
+                        src[(row0 + x0) * channels + c] +
+                        src[(row0 + x1) * channels + c] +
+                        src[(row1 + x0) * channels + c] +
+                        src[(row1 + x1) * channels + c];
+                    dst[c] = static_cast<std::uint8_t>((sum + 2) / 4);
+                }
+            }
+        }
+
+        result.swap(level);
+        src = result.data();
+        channels = 4;
+        width = w;
+        height = h;
+    }
+
+    return result.data();
+}
+
+}
+
 //----------------------------------------------------------------------------//
 OpenGLTexture::OpenGLTexture(OpenGLRendererBase& owner, const String& name) :
     d_ogltexture(0),
@@ -48,7 +114,15 @@ OpenGLTexture::OpenGLTexture(OpenGLRendererBase& owner, const String& name) :
     d_name(name),
     d_pixelDataFormat(GL_RGB),
     d_pixelDataType(GL_UNSIGNED_BYTE),
-    d_isCompressed(false)
+    d_isCompressed(false),
+    d_pixelFormat(PixelFormat::Rgb),
+    d_mipmapsEnabled(false),
+    d_hasMipmaps(false),
+    d_residentScale(1.0f),
+    d_droppedLevels(0),
+    d_loadingFromFile(false),
+    d_dataReleased(false),
+    d_opaque(false)
 {
 }
 
@@ -122,6 +196,8 @@ void OpenGLTexture::initialise(GLuint tex, const Sizef& size)
     d_ogltexture = tex;
     d_size = size;
     d_dataSize = size;
+    d_hasMipmaps = false;
+    d_droppedLevels = 0;
     initInternalPixelFormatFields(PixelFormat::Rgba);
     updateCachedScaleValues();
 }
@@ -167,7 +243,19 @@ void OpenGLTexture::loadFromFile(const String& filename,
     system.getResourceProvider()->
         loadRawDataContainer(filename, texFile, resourceGroup);
 
-    Texture* res = system.getImageCodec().load(texFile, this);
+    // the codec passes its straight alpha pixels to loadFromMemory
+    d_loadingFromFile = true;
+    Texture* res = nullptr;
+    try
+    {
+        res = system.getImageCodec().load(texFile, this);
+    }
+    catch (...)
+    {
+        d_loadingFromFile = false;
+        throw;
+    }
+    d_loadingFromFile = false;
 
     // unload file data buffer
     System::getSingleton().getResourceProvider()->
@@ -188,14 +276,49 @@ void OpenGLTexture::loadFromMemory(const void* buffer, const Sizef& buffer_size,
         throw InvalidRequestException(
             "Data was supplied in an unsupported pixel format.");
 
+    d_opaque = Texture::isDataOpaque(buffer,
+        static_cast<std::size_t>(buffer_size.d_width) *
+        static_cast<std::size_t>(buffer_size.d_height), pixel_format);
+
+    // decoded files are premultiplied here when rendering with premultiplied
+    // alpha, which also keeps the reduced mip levels free of colour fringes
+    std::vector<std::uint8_t> premultiplied;
+    if (d_loadingFromFile && pixel_format == PixelFormat::Rgba &&
+        d_owner.isPremultipliedAlphaEnabled())
+    {
+        const std::size_t pixel_count =
+            static_cast<std::size_t>(buffer_size.d_width) *
+            static_cast<std::size_t>(buffer_size.d_height);
+        const std::uint8_t* pixels = static_cast<const std::uint8_t*>(buffer);
+        premultiplied.assign(pixels, pixels + pixel_count * 4);
+        Texture::premultiplyAlpha(premultiplied.data(), pixel_count);
+        buffer = premultiplied.data();
+    }
+
+    // mip levels larger than needed at the resident scale are never uploaded
+    d_droppedLevels = getDroppedLevelCount(pixel_format);
+    std::vector<std::uint8_t> reduced;
+    if (d_droppedLevels > 0)
+    {
+        buffer = downsamplePixels(buffer, buffer_size, pixel_format,
+                                  d_droppedLevels, reduced);
+        pixel_format = PixelFormat::Rgba;
+    }
+
+    const Sizef resident_size(getResidentSize(buffer_size));
+
     initInternalPixelFormatFields(pixel_format);
-    setTextureSize_impl(buffer_size);
+    d_hasMipmaps = d_mipmapsEnabled && !d_isCompressed &&
+        OpenGLInfo::getSingleton().isGenerateMipmapSupported();
+    setResidentTextureSize(resident_size);
 
     // store size of original data we are loading
     d_dataSize = buffer_size;
     updateCachedScaleValues();
 
-    blitFromMemory(buffer, Rectf(glm::vec2(0, 0), buffer_size));
+    d_dataReleased = false;
+    blitResidentData(buffer, Rectf(glm::vec2(0, 0), resident_size));
+    updateMinFilter();
 }
 
 //----------------------------------------------------------------------------//
@@ -234,23 +357,71 @@ void OpenGLTexture::loadCompressedTextureBuffer(const Rectf& dest_area,
 //----------------------------------------------------------------------------//
 GLsizei OpenGLTexture::getCompressedTextureSize(const Sizef& pixel_size) const
 {
-    GLsizei blocksize = 16;
-    return (
-        static_cast<GLsizei>(
-        std::ceil(pixel_size.d_width / 4) *
-        std::ceil(pixel_size.d_height / 4) *
-        blocksize));
+    return static_cast<GLsizei>(Texture::calculateDataSize(d_pixelFormat,
+        static_cast<size_t>(pixel_size.d_width),
+        static_cast<size_t>(pixel_size.d_height)));
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGLTexture::initCompressedPixelFormatFields(const PixelFormat fmt)
+{
+    switch (fmt)
+    {
+    case PixelFormat::RgbDxt1:
+        d_pixelDataFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        break;
+    case PixelFormat::RgbaDxt1:
+        d_pixelDataFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+        break;
+    case PixelFormat::RgbaDxt3:
+        d_pixelDataFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+        break;
+    case PixelFormat::RgbaDxt5:
+        d_pixelDataFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        break;
+    case PixelFormat::RgbaBc7:
+        d_pixelDataFormat = GL_COMPRESSED_RGBA_BPTC_UNORM;
+        break;
+    case PixelFormat::RgbEtc2:
+        d_pixelDataFormat = GL_COMPRESSED_RGB8_ETC2;
+        break;
+    case PixelFormat::RgbaEtc2:
+        d_pixelDataFormat = GL_COMPRESSED_RGBA8_ETC2_EAC;
+        break;
+    case PixelFormat::RgbaAstc4x4:
+        d_pixelDataFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR;
+        break;
+    case PixelFormat::RgbaAstc6x6:
+        d_pixelDataFormat = GL_COMPRESSED_RGBA_ASTC_6x6_KHR;
+        break;
+    case PixelFormat::RgbaAstc8x8:
+        d_pixelDataFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR;
+        break;
+    default:
+        return false;
+    }
+
+    d_pixelDataType = GL_UNSIGNED_BYTE; // not used.
+    d_isCompressed = true;
+    d_pixelFormat = fmt;
+    return true;
 }
 
 //----------------------------------------------------------------------------//
 void OpenGLTexture::setTextureSize(const Sizef& sz)
 {
     initInternalPixelFormatFields(PixelFormat::Rgba);
+    d_hasMipmaps = false;
+    d_droppedLevels = 0;
 
+    d_owner.discardTextureUploads(*this);
     setTextureSize_impl(sz);
 
     d_dataSize = d_size;
+    d_dataReleased = false;
+    d_opaque = false;
     updateCachedScaleValues();
+    updateMinFilter();
 }
 
 //----------------------------------------------------------------------------//
@@ -267,15 +438,20 @@ void OpenGLTexture::grabTexture()
            "glGetTexImage"/"glGetCompressedTexImage", so we need to emulate it
            with "glReadPixels", which will return the data in (umcompressed)
            format (GL_RGBA, GL_UNSIGNED_BYTE). */
-        buffer_size = static_cast<std::size_t>(d_dataSize.d_width)
-          *static_cast<std::size_t>(d_dataSize.d_height) *4;
+        const Sizef read_size(getResidentSize(d_dataSize));
+        buffer_size = static_cast<std::size_t>(read_size.d_width)
+          *static_cast<std::size_t>(read_size.d_height) *4;
         d_isCompressed = false;
         d_pixelDataFormat = GL_RGBA;
         d_pixelDataType = GL_UNSIGNED_BYTE;
+        d_pixelFormat = PixelFormat::Rgba;
     }
     else // Desktop OpenGL
-        buffer_size = static_cast<std::size_t>(d_size.d_width)
-          *static_cast<std::size_t>(d_size.d_height) *4;
+    {
+        const Sizef resident_size(getResidentSize(d_size));
+        buffer_size = static_cast<std::size_t>(resident_size.d_width)
+          *static_cast<std::size_t>(resident_size.d_height) *4;
+    }
     d_grabBuffer = new std::uint8_t[buffer_size];
 
     blitToMemory(d_grabBuffer);
@@ -290,12 +466,13 @@ void OpenGLTexture::restoreTexture()
         return;
 
     generateOpenGLTexture();
-    setTextureSize_impl(d_size);
+    setResidentTextureSize(getResidentSize(d_size));
 
     /* In OpenGL ES we used "glReadPixels" to grab the texture, reading just the
        relevant rectangle. */
     Sizef blit_size = OpenGLInfo::getSingleton().isUsingOpenglEs() ? d_dataSize : d_size;
-    blitFromMemory(d_grabBuffer, Rectf(glm::vec2(0, 0), blit_size));
+    blitResidentData(d_grabBuffer, Rectf(glm::vec2(0, 0), getResidentSize(blit_size)));
+    updateMinFilter();
 
     // free the grabbuffer
     delete[] d_grabBuffer;
@@ -304,6 +481,34 @@ void OpenGLTexture::restoreTexture()
 
 //----------------------------------------------------------------------------//
 void OpenGLTexture::blitFromMemory(const void* sourceData, const Rectf& area)
+{
+    if (d_droppedLevels > 0)
+        throw InvalidRequestException("Can not blit to texture '" + d_name +
+            "' while its largest mip levels are not resident.");
+
+    d_opaque = d_opaque && Texture::isDataOpaque(sourceData,
+        static_cast<std::size_t>(area.getWidth()) *
+        static_cast<std::size_t>(area.getHeight()), d_pixelFormat);
+
+    blitResidentData(sourceData, area);
+}
+
+//----------------------------------------------------------------------------//
+void OpenGLTexture::blitResidentData(const void* sourceData, const Rectf& area)
+{
+    const std::size_t data_size = d_isCompressed ?
+        static_cast<std::size_t>(getCompressedTextureSize(area.getSize())) :
+        Texture::calculateDataSize(d_pixelFormat,
+                                   static_cast<std::size_t>(area.getWidth()),
+                                   static_cast<std::size_t>(area.getHeight()));
+
+    if (!d_owner.queueTextureUpload(*this, sourceData, area, data_size, !d_isCompressed))
+        uploadResidentData(sourceData, area, true);
+}
+
+//----------------------------------------------------------------------------//
+void OpenGLTexture::uploadResidentData(const void* sourceData, const Rectf& area,
+                                       bool generate_mipmaps)
 {
     // save old texture binding
     GLuint old_tex;
@@ -317,10 +522,120 @@ void OpenGLTexture::blitFromMemory(const void* sourceData, const Rectf& area)
     else
         loadUncompressedTextureBuffer(area, sourceData);
 
+    if (generate_mipmaps && d_hasMipmaps)
+        glGenerateMipmap(GL_TEXTURE_2D);
+
     // restore previous texture binding.
     glBindTexture(GL_TEXTURE_2D, old_tex);
 }
 
+//----------------------------------------------------------------------------//
+void OpenGLTexture::updateMinFilter()
+{
+    GLuint old_tex;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, reinterpret_cast<GLint*>(&old_tex));
+
+    glBindTexture(GL_TEXTURE_2D, d_ogltexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                    d_hasMipmaps ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+
+    glBindTexture(GL_TEXTURE_2D, old_tex);
+}
+
+//----------------------------------------------------------------------------//
+GLint OpenGLTexture::getDroppedLevelCount(const PixelFormat fmt) const
+{
+    if (!d_mipmapsEnabled ||
+        (fmt != PixelFormat::Rgba && fmt != PixelFormat::Rgb) ||
+        !OpenGLInfo::getSingleton().isGenerateMipmapSupported())
+        return 0;
+
+    GLint levels = 0;
+    for (float scale = d_residentScale; scale <= 0.5f && levels < 15; scale *= 2.0f)
+        ++levels;
+
+    return levels;
+}
+
+//----------------------------------------------------------------------------//
+Sizef OpenGLTexture::getResidentSize(const Sizef& size) const
+{
+    Sizef resident(size);
+    for (GLint i = 0; i < d_droppedLevels; ++i)
+        resident = Sizef(std::max(std::floor(resident.d_width / 2.0f), 1.0f),
+                         std::max(std::floor(resident.d_height / 2.0f), 1.0f));
+
+    return resident;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGLTexture::setResidentTextureSize(const Sizef& resident_size)
+{
+    // pending updates were meant for the storage being replaced
+    d_owner.discardTextureUploads(*this);
+    setTextureSize_impl(resident_size);
+
+    const float scale = static_cast<float>(1 << d_droppedLevels);
+    d_size = Sizef(d_size.d_width * scale, d_size.d_height * scale);
+}
+
+//----------------------------------------------------------------------------//
+void OpenGLTexture::setMipmapsEnabled(bool enabled)
+{
+    d_mipmapsEnabled = enabled;
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGLTexture::isMipmapsEnabled() const
+{
+    return d_mipmapsEnabled;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGLTexture::setResidentScale(float scale)
+{
+    d_residentScale = (scale > 0.0f && scale < 1.0f) ? scale : 1.0f;
+}
+
+//----------------------------------------------------------------------------//
+float OpenGLTexture::getResidentScale() const
+{
+    return d_residentScale;
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGLTexture::releaseData()
+{
+    // a grabbed texture has no GL texture to release
+    if (d_grabBuffer || !d_ogltexture)
+        return false;
+
+    if (d_dataReleased)
+        return true;
+
+    // replace the texture with an empty one, so that there is a valid GL
+    // texture to bind and to load data into again later on
+    d_owner.discardTextureUploads(*this);
+    glDeleteTextures(1, &d_ogltexture);
+    generateOpenGLTexture();
+
+    d_hasMipmaps = false;
+    d_dataReleased = true;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGLTexture::isDataReleased() const
+{
+    return d_dataReleased;
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGLTexture::isOpaque() const
+{
+    return d_opaque;
+}
+
 //----------------------------------------------------------------------------//
 
 void OpenGLTexture::updateCachedScaleValues()
@@ -359,6 +674,8 @@ void OpenGLTexture::setTextureEnvironment()
 //----------------------------------------------------------------------------//
 void OpenGLTexture::cleanupOpenGLTexture()
 {
+    d_owner.discardTextureUploads(*this);
+
     // if the grabbuffer is not empty then free it
     if (d_grabBuffer)
     {
@@ -390,6 +707,8 @@ void OpenGLTexture::setOpenGLTexture(GLuint tex, const Sizef& size)
         d_ogltexture = tex;
     }
 
+    d_hasMipmaps = false;
+    d_droppedLevels = 0;
     d_dataSize = d_size = size;
     updateCachedScaleValues();
 }
@@ -411,6 +730,18 @@ bool OpenGLTexture::isPixelFormatSupported(const PixelFormat fmt) const
     case PixelFormat::RgbaDxt5:
         return OpenGLInfo::getSingleton().isS3tcSupported();
 
+    case PixelFormat::RgbaBc7:
+        return OpenGLInfo::getSingleton().isBptcSupported();
+
+    case PixelFormat::RgbEtc2:
+    case PixelFormat::RgbaEtc2:
+        return OpenGLInfo::getSingleton().isEtc2Supported();
+
+    case PixelFormat::RgbaAstc4x4:
+    case PixelFormat::RgbaAstc6x6:
+    case PixelFormat::RgbaAstc8x8:
+        return OpenGLInfo::getSingleton().isAstcSupported();
+
     default:
         return false;
     }
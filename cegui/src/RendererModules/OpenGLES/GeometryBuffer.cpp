@@ -58,13 +58,14 @@ void OpenGLESGeometryBuffer::draw(std::uint32_t drawModeMask) const
 {
     CEGUI_UNUSED(drawModeMask);
     
+    const Rectf& clipRegion = getPreparedClippingRegion();
     // setup clip region
     GLint vp[4];
     glGetIntegerv(GL_VIEWPORT, vp);
-    glScissor(static_cast<GLint>(d_preparedClippingRegion.left()),
-              static_cast<GLint>(vp[3] - d_preparedClippingRegion.bottom()),
-              static_cast<GLint>(d_preparedClippingRegion.getWidth()),
-              static_cast<GLint>(d_preparedClippingRegion.getHeight()));
+    glScissor(static_cast<GLint>(clipRegion.left()),
+              static_cast<GLint>(vp[3] - clipRegion.bottom()),
+              static_cast<GLint>(clipRegion.getWidth()),
+              static_cast<GLint>(clipRegion.getHeight()));
 
     // apply the transformations we need to use.
     if (!d_matrixValid)
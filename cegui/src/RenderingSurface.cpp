@@ -53,7 +53,9 @@ const String RenderingSurface::EventRenderQueueEnded("RenderQueueEnded");
 //----------------------------------------------------------------------------//
 RenderingSurface::RenderingSurface(RenderTarget& target) :
     d_target(&target),
-    d_invalidated(true)
+    d_invalidated(true),
+    d_reorderRenderQueues(false),
+    d_cullOccludedBuffers(false)
 {
 }
 
@@ -107,6 +109,7 @@ void RenderingSurface::draw(std::uint32_t drawMode)
 {
     d_target->activate();
     Renderer& owner = d_target->getOwner();
+    updateDrawOrders();
     owner.uploadBuffers(*this);
 
     drawContent(drawMode);
@@ -114,6 +117,29 @@ void RenderingSurface::draw(std::uint32_t drawMode)
     d_target->deactivate();
 }
 
+//----------------------------------------------------------------------------//
+void RenderingSurface::setRenderQueueReorderingEnabled(bool enabled)
+{
+    d_reorderRenderQueues = enabled;
+}
+
+//----------------------------------------------------------------------------//
+void RenderingSurface::setRenderQueueOcclusionCullingEnabled(bool enabled)
+{
+    d_cullOccludedBuffers = enabled;
+}
+
+//----------------------------------------------------------------------------//
+void RenderingSurface::updateDrawOrders()
+{
+    for (auto& queue : d_queues)
+    {
+        queue.second.setReorderingEnabled(d_reorderRenderQueues);
+        queue.second.setOcclusionCullingEnabled(d_cullOccludedBuffers);
+        queue.second.updateDrawOrder();
+    }
+}
+
 //----------------------------------------------------------------------------//
 void RenderingSurface::drawContent(std::uint32_t drawModeMask)
 {
@@ -161,6 +187,16 @@ bool RenderingSurface::isRenderingWindow() const
     return false;
 }
 
+//----------------------------------------------------------------------------//
+bool RenderingSurface::isRedrawRequired() const
+{
+    for (const RenderingWindow* window : d_windows)
+        if (window->isRedrawRequired())
+            return true;
+
+    return false;
+}
+
 //----------------------------------------------------------------------------//
 RenderingWindow& RenderingSurface::createRenderingWindow(TextureTarget& target)
 {
@@ -33,26 +33,58 @@
 #include "CEGUI/Texture.h"
 #include "CEGUI/RenderEffect.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace CEGUI
 {
+namespace
+{
+//! Returns the smallest Rectf containing both \a a and \a b.
+Rectf getBoundingRect(const Rectf& a, const Rectf& b)
+{
+    return Rectf(glm::min(a.d_min, b.d_min), glm::max(a.d_max, b.d_max));
+}
+
+//! Returns whether \a a and \a b overlap or touch.
+bool areasTouch(const Rectf& a, const Rectf& b)
+{
+    return a.d_min.x <= b.d_max.x && b.d_min.x <= a.d_max.x &&
+           a.d_min.y <= b.d_max.y && b.d_min.y <= a.d_max.y;
+}
+}
+
 //----------------------------------------------------------------------------//
 RenderingWindow::RenderingWindow(TextureTarget& target, RenderingSurface& owner) :
     RenderingSurface(target),
     d_renderer(*System::getSingleton().getRenderer()),
     d_textarget(target),
     d_owner(&owner),
+    d_ownerQueue(RenderQueueID::Base),
     d_geometryBuffer(d_renderer.createGeometryBufferTextured()),
     d_geometryValid(false),
     d_position(0, 0),
     d_size(0, 0),
-    d_rotation(1, 0, 0, 0) // <-- IDENTITY
+    d_rotation(1, 0, 0, 0), // <-- IDENTITY
+    d_partialRedrawThreshold(0.5f),
+    d_presentationOffset(0, 0),
+    d_presentationRotation(1, 0, 0, 0),
+    d_presentationAlpha(1.0f),
+    d_presentationTransformed(false),
+    d_resolutionScale(1.0f),
+    d_maximumRefreshRate(0.0f),
+    d_refreshDeferred(false)
 {
+    // the texture holds premultiplied colours; with premultiplied alpha
+    // enabled on the Renderer all buffers are blended this way anyway
     d_geometryBuffer.setBlendMode(BlendMode::RttPremultiplied);
 }
 
 //----------------------------------------------------------------------------//
 RenderingWindow::~RenderingWindow()
 {
+    // the target may be reused, e.g. from a TextureTargetPool
+    d_textarget.setRenderScale(1.0f);
     d_renderer.destroyGeometryBuffer(d_geometryBuffer);
 }
 
@@ -76,7 +108,7 @@ void RenderingWindow::setPosition(const glm::vec2& position)
 {
     d_position = position;
 
-    glm::vec3 trans(d_position, 0.0f);
+    glm::vec3 trans(d_position + d_presentationOffset, 0.0f);
     // geometry position must be offset according to our owner position, if
     // that is a RenderingWindow.
     if (d_owner->isRenderingWindow())
@@ -93,17 +125,86 @@ void RenderingWindow::setSize(const Sizef& size)
     // URGENT FIXME: Isn't this in the hands of the user?
     /*d_size.d_width = PixelAligned(size.d_width);
     d_size.d_height = PixelAligned(size.d_height);*/
+    const bool sizeChanged = (d_size != size);
     d_size = size;
     d_geometryValid = false;
 
-    d_textarget.declareRenderSize(d_size);
+    declareTargetSize();
+
+    if (sizeChanged)
+    {
+        // the texture may have been recreated, so partial redraws are not
+        // enough and the redraw can not wait for the refresh rate either
+        d_lastRefresh = std::chrono::steady_clock::time_point();
+
+        if (!d_damagedAreas.empty())
+        {
+            d_damagedAreas.clear();
+            d_textarget.clear();
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void RenderingWindow::declareTargetSize()
+{
+    if (d_resolutionScale == 1.0f)
+        d_textarget.declareRenderSize(d_size);
+    else
+        d_textarget.declareRenderSize(Sizef(
+            std::ceil(d_size.d_width * d_resolutionScale),
+            std::ceil(d_size.d_height * d_resolutionScale)));
+}
+
+//----------------------------------------------------------------------------//
+void RenderingWindow::setResolutionScale(float scale)
+{
+    if (scale <= 0.0f)
+        throw InvalidRequestException(
+            "The resolution scale of a RenderingWindow must be positive.");
+
+    if (!d_textarget.isRenderScaleSupported())
+        scale = 1.0f;
+
+    if (scale == d_resolutionScale)
+        return;
+
+    d_resolutionScale = scale;
+    d_textarget.setRenderScale(d_resolutionScale);
+    declareTargetSize();
+    d_geometryValid = false;
+
+    // the old imagery no longer matches the texture
+    d_lastRefresh = std::chrono::steady_clock::time_point();
+    invalidate();
+}
+
+//----------------------------------------------------------------------------//
+void RenderingWindow::setMaximumRefreshRate(float rate)
+{
+    d_maximumRefreshRate = std::max(0.0f, rate);
+}
+
+//----------------------------------------------------------------------------//
+bool RenderingWindow::isRefreshDeferred() const
+{
+    if (d_maximumRefreshRate <= 0.0f ||
+        d_lastRefresh == std::chrono::steady_clock::time_point())
+    {
+        return false;
+    }
+
+    const float sinceRefresh = std::chrono::duration<float>(
+        std::chrono::steady_clock::now() - d_lastRefresh).count();
+
+    return sinceRefresh < 1.0f / d_maximumRefreshRate;
 }
 
 //----------------------------------------------------------------------------//
 void RenderingWindow::setRotation(const glm::quat& rotation)
 {
     d_rotation = rotation;
-    d_geometryBuffer.setRotation(d_rotation);
+    d_geometryBuffer.setRotation(d_presentationRotation * d_rotation);
 }
 
 //----------------------------------------------------------------------------//
@@ -113,6 +214,60 @@ void RenderingWindow::setPivot(const glm::vec3& pivot)
     d_geometryBuffer.setPivot(d_pivot);
 }
 
+//----------------------------------------------------------------------------//
+void RenderingWindow::setPresentationTransform(const glm::vec2& offset,
+                                               const glm::quat& rotation,
+                                               float alpha)
+{
+    if (d_presentationTransformed && offset == d_presentationOffset &&
+        rotation == d_presentationRotation && alpha == d_presentationAlpha)
+    {
+        return;
+    }
+
+    // the owner must redraw where the quad was as well as where it goes now
+    invalidatePresentedArea();
+
+    d_presentationOffset = offset;
+    d_presentationRotation = rotation;
+    d_presentationAlpha = alpha;
+    d_presentationTransformed = true;
+
+    setPosition(d_position);
+    setRotation(d_rotation);
+    d_geometryBuffer.setAlpha(d_presentationAlpha);
+
+    invalidatePresentedArea();
+}
+
+//----------------------------------------------------------------------------//
+void RenderingWindow::resetPresentationTransform()
+{
+    if (!d_presentationTransformed)
+        return;
+
+    invalidatePresentedArea();
+
+    d_presentationOffset = glm::vec2(0, 0);
+    d_presentationRotation = glm::quat(1, 0, 0, 0);
+    d_presentationAlpha = 1.0f;
+    d_presentationTransformed = false;
+
+    setPosition(d_position);
+    setRotation(d_rotation);
+    d_geometryBuffer.setAlpha(d_presentationAlpha);
+
+    invalidatePresentedArea();
+}
+
+//----------------------------------------------------------------------------//
+void RenderingWindow::invalidatePresentedArea()
+{
+    Rectf area(glm::vec2(0, 0), d_size);
+    area.offset(d_presentationOffset);
+    invalidateOwnerArea(area);
+}
+
 //----------------------------------------------------------------------------//
 const glm::vec2& RenderingWindow::getPosition() const
 {
@@ -200,16 +355,36 @@ void RenderingWindow::draw(std::uint32_t drawModeMask)
     if (!d_geometryValid)
         realiseGeometry();
 
-    if (d_invalidated)
+    // a redraw held back by the refresh rate keeps the previous imagery
+    if (d_invalidated && !isRefreshDeferred())
     {
+        // the texture was not cleared when the redraw was deferred
+        if (d_refreshDeferred && d_damagedAreas.empty())
+            d_textarget.clear();
+
         // base class will render out queues for us
-        RenderingSurface::draw(drawModeMask);
+        if (d_damagedAreas.empty())
+            RenderingSurface::draw(drawModeMask);
+        else
+            drawDamagedAreas(drawModeMask);
+
         // mark as no longer invalidated
         d_invalidated = false;
+        d_damagedAreas.clear();
+
+        if (d_maximumRefreshRate > 0.0f)
+            d_lastRefresh = std::chrono::steady_clock::now();
+
+        // the owner kept drawing the previous imagery until now
+        if (d_refreshDeferred)
+        {
+            d_refreshDeferred = false;
+            invalidateOwnerArea(Rectf(glm::vec2(0, 0), d_size));
+        }
     }
 
     // add our geometry to our owner for rendering
-    d_owner->addGeometryBuffer(RenderQueueID::Base, d_geometryBuffer);
+    d_owner->addGeometryBuffer(d_ownerQueue, d_geometryBuffer);
 }
 
 //----------------------------------------------------------------------------//
@@ -217,14 +392,186 @@ void RenderingWindow::invalidate()
 {
     // this override is potentially expensive, so only do the main work when we
     // have to.
-    if (!d_invalidated)
+    const bool deferred = isRefreshDeferred();
+
+    if (!d_invalidated || !d_damagedAreas.empty())
     {
         RenderingSurface::invalidate();
-        d_textarget.clear();
+        d_damagedAreas.clear();
+
+        // a deferred redraw clears the texture once it happens
+        if (!deferred)
+            d_textarget.clear();
+    }
+
+    // also invalidate what we render back to, when the redraw happens
+    if (deferred)
+        d_refreshDeferred = true;
+    else
+        invalidateOwnerArea(Rectf(glm::vec2(0, 0), d_size));
+}
+
+//----------------------------------------------------------------------------//
+bool RenderingWindow::isInvalidated() const
+{
+    if (d_invalidated)
+        return !isRefreshDeferred();
+
+    // nested RenderingWindows are only drawn along with their owner, so one
+    // whose deferred redraw is due has to get this one drawn as well
+    for (const RenderingWindow* window : d_windows)
+        if (window->isInvalidated())
+            return true;
+
+    return !d_target->isImageryCache();
+}
+
+//----------------------------------------------------------------------------//
+void RenderingWindow::invalidateArea(const Rectf& area)
+{
+    const Rectf damage(area.getIntersection(Rectf(glm::vec2(0, 0), d_size)));
+    if (damage.getWidth() <= 0.0f || damage.getHeight() <= 0.0f)
+        return;
+
+    // everything is redrawn already
+    if (d_invalidated && d_damagedAreas.empty())
+        return;
+
+    if (d_partialRedrawThreshold <= 0.0f || !d_textarget.isAreaClearSupported())
+    {
+        invalidate();
+        return;
+    }
+
+    addDamagedArea(damage);
+
+    float damagedSize = 0.0f;
+    for (const Rectf& damaged : d_damagedAreas)
+        damagedSize += damaged.getWidth() * damaged.getHeight();
+
+    if (damagedSize > d_partialRedrawThreshold * d_size.d_width * d_size.d_height)
+    {
+        invalidate();
+        return;
+    }
+
+    RenderingSurface::invalidate();
+
+    if (isRefreshDeferred())
+        d_refreshDeferred = true;
+    else
+        invalidateOwnerArea(damage);
+}
+
+//----------------------------------------------------------------------------//
+void RenderingWindow::addDamagedArea(const Rectf& area)
+{
+    Rectf merged(area);
+
+    // merging may make the result touch areas that were checked before
+    bool mergedAny = true;
+    while (mergedAny)
+    {
+        mergedAny = false;
+        for (auto it = d_damagedAreas.begin(); it != d_damagedAreas.end(); ++it)
+        {
+            if (areasTouch(*it, merged))
+            {
+                merged = getBoundingRect(*it, merged);
+                d_damagedAreas.erase(it);
+                mergedAny = true;
+                break;
+            }
+        }
     }
 
-    // also invalidate what we render back to.
-    d_owner->invalidate();
+    if (d_damagedAreas.size() >= MaxDamagedAreas)
+    {
+        for (const Rectf& damaged : d_damagedAreas)
+            merged = getBoundingRect(damaged, merged);
+
+        d_damagedAreas.clear();
+    }
+
+    d_damagedAreas.push_back(merged);
+}
+
+//----------------------------------------------------------------------------//
+void RenderingWindow::invalidateOwnerArea(const Rectf& area)
+{
+    if (!d_owner->isRenderingWindow() || d_rotation != glm::quat(1, 0, 0, 0) ||
+        d_presentationRotation != glm::quat(1, 0, 0, 0) ||
+        d_geometryBuffer.getRenderEffect())
+    {
+        d_owner->invalidate();
+        return;
+    }
+
+    RenderingWindow* const owner = static_cast<RenderingWindow*>(d_owner);
+    Rectf ownerArea(area);
+    ownerArea.offset(d_position - owner->d_position);
+    owner->invalidateArea(ownerArea);
+}
+
+//----------------------------------------------------------------------------//
+void RenderingWindow::drawDamagedAreas(std::uint32_t drawModeMask)
+{
+    d_target->activate();
+    updateDrawOrders();
+    d_target->getOwner().uploadBuffers(*this);
+
+    // the scissor rectangles of the queued geometry are narrowed to each
+    // damaged area in turn, and restored afterwards, including the shared
+    // ClipRegion the buffers followed.
+    struct Clipping
+    {
+        Rectf d_region;
+        RefCounted<const ClipRegion> d_clipRegion;
+        bool d_active;
+    };
+    std::vector<Clipping> clipping;
+    for (auto& queue : d_queues)
+    {
+        for (const GeometryBuffer* buffer : queue.second.getBuffers())
+        {
+            const Clipping original = { buffer->getClippingRegion(),
+                buffer->getClipRegion(), buffer->isClippingActive() };
+            clipping.push_back(original);
+        }
+    }
+
+    for (const Rectf& area : d_damagedAreas)
+    {
+        d_textarget.clearArea(area);
+
+        std::size_t i = 0;
+        for (auto& queue : d_queues)
+        {
+            for (GeometryBuffer* buffer : queue.second.getBuffers())
+            {
+                const auto& original = clipping[i++];
+                buffer->setClippingRegion(original.d_active ?
+                    original.d_region.getIntersection(area) : area);
+                buffer->setClippingActive(true);
+            }
+        }
+
+        drawContent(drawModeMask);
+    }
+
+    std::size_t i = 0;
+    for (auto& queue : d_queues)
+    {
+        for (GeometryBuffer* buffer : queue.second.getBuffers())
+        {
+            const auto& original = clipping[i++];
+            buffer->setClippingRegion(original.d_region);
+            buffer->setClipRegion(original.d_clipRegion);
+            buffer->setClippingActive(original.d_active);
+        }
+    }
+
+    d_target->deactivate();
 }
 
 //----------------------------------------------------------------------------//
@@ -233,6 +580,12 @@ bool RenderingWindow::isRenderingWindow() const
     return true;
 }
 
+//----------------------------------------------------------------------------//
+bool RenderingWindow::isRedrawRequired() const
+{
+    return d_invalidated || !d_geometryValid || RenderingSurface::isRedrawRequired();
+}
+
 //----------------------------------------------------------------------------//
 void RenderingWindow::realiseGeometry()
 {
@@ -317,8 +670,8 @@ void RenderingWindow::unprojectPoint(const glm::vec2& p_in, glm::vec2& p_out)
 Rectf RenderingWindow::getTextureRect() const
 {
     const bool isTexCoordSysFlipped = d_textarget.getOwner().isTexCoordSystemFlipped();
-    const float tu = d_size.d_width * d_textarget.getTexture().getTexelScaling().x;
-    const float tv = d_size.d_height * d_textarget.getTexture().getTexelScaling().y;
+    const float tu = d_size.d_width * d_resolutionScale * d_textarget.getTexture().getTexelScaling().x;
+    const float tv = d_size.d_height * d_resolutionScale * d_textarget.getTexture().getTexelScaling().y;
     return isTexCoordSysFlipped ?
         Rectf(0, 1, tu, 1 - tv) :
         Rectf(0, 0, tu, tv);
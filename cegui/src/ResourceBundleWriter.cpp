@@ -0,0 +1,431 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ResourceBundleWriter.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Font.h"
+#include "CEGUI/Font_xmlHandler.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/PreparsedXML.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/Scheme.h"
+#include "CEGUI/Scheme_xmlHandler.h"
+#include "CEGUI/System.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+
+#include <sstream>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//----------------------------------------------------------------------------//
+// Names of the elements and attributes that refer to other files
+const String ImagesetElement("Imageset");
+const String ImagesetFromImageElement("ImagesetFromImage");
+const String FontElement("Font");
+const String LookNFeelElement("LookNFeel");
+const String FilenameAttribute("filename");
+const String ImageFileAttribute("imagefile");
+const String ResourceGroupAttribute("resourceGroup");
+const String TypeAttribute("type");
+// Resource group PixmapFont uses for its built-in imageset
+const String BuiltInResourceGroup("*");
+
+//----------------------------------------------------------------------------//
+void writeUInt32(OutStream& out_stream, std::uint32_t value)
+{
+    char bytes[4];
+    for (int i = 0; i < 4; ++i)
+        bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+
+    out_stream.write(bytes, sizeof(bytes));
+}
+
+//----------------------------------------------------------------------------//
+void writeUInt64(OutStream& out_stream, std::uint64_t value)
+{
+    writeUInt32(out_stream, static_cast<std::uint32_t>(value));
+    writeUInt32(out_stream, static_cast<std::uint32_t>(value >> 32));
+}
+
+//----------------------------------------------------------------------------//
+std::string toUtf8(const String& str)
+{
+    std::ostringstream utf8;
+    utf8 << str;
+    return utf8.str();
+}
+
+//----------------------------------------------------------------------------//
+//! XMLHandler collecting the elements of a document that refer to other files.
+class FileReferences : public XMLHandler
+{
+public:
+    struct Reference
+    {
+        String d_element;
+        String d_type;
+        String d_filename;
+        String d_imageFile;
+        String d_resourceGroup;
+    };
+
+    const String& getDefaultResourceGroup() const override
+    {
+        return System::getSingleton().getResourceProvider()->getDefaultResourceGroup();
+    }
+
+    void elementStart(const String& element, const XMLAttributes& attributes) override
+    {
+        if (!attributes.exists(FilenameAttribute) && !attributes.exists(ImageFileAttribute))
+            return;
+
+        Reference reference;
+        reference.d_element = element;
+        reference.d_type = attributes.getValueAsString(TypeAttribute);
+        reference.d_filename = attributes.getValueAsString(FilenameAttribute);
+        reference.d_imageFile = attributes.getValueAsString(ImageFileAttribute);
+        reference.d_resourceGroup = attributes.getValueAsString(ResourceGroupAttribute);
+        d_references.push_back(reference);
+    }
+
+    const std::vector<Reference>& getReferences() const { return d_references; }
+
+private:
+    std::vector<Reference> d_references;
+};
+
+}
+
+//----------------------------------------------------------------------------//
+ResourceBundleWriter::ResourceBundleWriter()
+{
+}
+
+//----------------------------------------------------------------------------//
+void ResourceBundleWriter::addScheme(const String& filename, const String& resourceGroup)
+{
+    const String group(resourceGroup.empty() ?
+        Scheme::getDefaultResourceGroup() : resourceGroup);
+
+    d_schemeFilename = filename;
+    d_schemeResourceGroup = group;
+
+    PreparsedXML recording;
+    if (!addRecording(filename, group, Scheme_xmlHandler().getSchemaName(), recording))
+        return;
+
+    FileReferences references;
+    recording.replay(references);
+
+    for (const FileReferences::Reference& reference : references.getReferences())
+    {
+        if (reference.d_filename.empty())
+            continue;
+
+        if (reference.d_element == ImagesetElement)
+        {
+            addImageset(reference.d_filename, reference.d_resourceGroup);
+        }
+        else if (reference.d_element == ImagesetFromImageElement)
+        {
+            addFile(reference.d_filename, reference.d_resourceGroup.empty() ?
+                ImageManager::getImagesetDefaultResourceGroup() : reference.d_resourceGroup);
+        }
+        else if (reference.d_element == FontElement)
+        {
+            addFont(reference.d_filename, reference.d_resourceGroup);
+        }
+        else if (reference.d_element == LookNFeelElement)
+        {
+            addLookNFeel(reference.d_filename, reference.d_resourceGroup);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ResourceBundleWriter::addImageset(const String& filename, const String& resourceGroup)
+{
+    const String group(resourceGroup.empty() ?
+        ImageManager::getImagesetDefaultResourceGroup() : resourceGroup);
+
+    PreparsedXML recording;
+    if (!addRecording(filename, group, ImageManager::getSingleton().getSchemaName(), recording))
+        return;
+
+    FileReferences references;
+    recording.replay(references);
+
+    for (const FileReferences::Reference& reference : references.getReferences())
+    {
+        if (reference.d_element != ImagesetElement || reference.d_imageFile.empty())
+            continue;
+
+        addFile(reference.d_imageFile, reference.d_resourceGroup.empty() ?
+            ImageManager::getImagesetDefaultResourceGroup() : reference.d_resourceGroup);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ResourceBundleWriter::addFont(const String& filename, const String& resourceGroup)
+{
+    const String group(resourceGroup.empty() ?
+        Font::getDefaultResourceGroup() : resourceGroup);
+
+    PreparsedXML recording;
+    if (!addRecording(filename, group, Font_xmlHandler::FontSchemaName, recording))
+        return;
+
+    FileReferences references;
+    recording.replay(references);
+
+    for (const FileReferences::Reference& reference : references.getReferences())
+    {
+        if (reference.d_element != Font_xmlHandler::FontElement ||
+            reference.d_filename.empty())
+        {
+            continue;
+        }
+
+        // pixmap fonts load an imageset, the other fonts read their file
+        if (reference.d_type == Font_xmlHandler::FontTypePixmap)
+        {
+            if (reference.d_resourceGroup != BuiltInResourceGroup)
+                addImageset(reference.d_filename, reference.d_resourceGroup);
+        }
+        else
+        {
+            addFile(reference.d_filename, reference.d_resourceGroup.empty() ?
+                Font::getDefaultResourceGroup() : reference.d_resourceGroup);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ResourceBundleWriter::addLookNFeel(const String& filename, const String& resourceGroup)
+{
+    addXMLFile(filename, resourceGroup.empty() ?
+        WidgetLookManager::getDefaultResourceGroup() : resourceGroup,
+        WidgetLookManager::getSchemaName());
+}
+
+//----------------------------------------------------------------------------//
+void ResourceBundleWriter::addLayout(const String& filename, const String& resourceGroup)
+{
+    addXMLFile(filename, resourceGroup.empty() ?
+        WindowManager::getDefaultResourceGroup() : resourceGroup,
+        WindowManager::GUILayoutSchemaName);
+}
+
+//----------------------------------------------------------------------------//
+void ResourceBundleWriter::addXMLFile(const String& filename, const String& resourceGroup,
+                                      const String& schemaName)
+{
+    PreparsedXML recording;
+    addRecording(filename, resourceGroup, schemaName, recording);
+}
+
+//----------------------------------------------------------------------------//
+void ResourceBundleWriter::addFile(const String& filename, const String& resourceGroup)
+{
+    const String key(makeKey(filename, resourceGroup));
+    if (d_keys.count(key))
+        return;
+
+    ResourceProvider* const resourceProvider = System::getSingleton().getResourceProvider();
+
+    RawDataContainer data;
+    resourceProvider->loadRawDataContainer(filename, data, resourceGroup);
+
+    File file;
+    file.d_resourceGroup = resourceGroup;
+    file.d_filename = filename;
+    file.d_type = BundleResourceProvider::EntryType::Raw;
+    file.d_data.assign(reinterpret_cast<const char*>(data.getDataPtr()), data.getSize());
+
+    resourceProvider->unloadRawDataContainer(data);
+
+    d_files.push_back(std::move(file));
+    d_keys.insert(key);
+}
+
+//----------------------------------------------------------------------------//
+bool ResourceBundleWriter::contains(const String& filename,
+                                    const String& resourceGroup) const
+{
+    return d_keys.count(makeKey(filename, resourceGroup)) != 0;
+}
+
+//----------------------------------------------------------------------------//
+void ResourceBundleWriter::write(OutStream& out_stream) const
+{
+    // every filename and resource group is stored once in the string table
+    std::vector<String> strings;
+    std::unordered_map<String, std::uint32_t> indices;
+    const auto addString = [&strings, &indices](const String& str)
+    {
+        const auto result = indices.emplace(
+            str, static_cast<std::uint32_t>(strings.size()));
+
+        if (result.second)
+            strings.push_back(str);
+
+        return result.first->second;
+    };
+
+    std::vector<std::uint32_t> fileStrings;
+    fileStrings.reserve(d_files.size() * 2);
+    for (const File& file : d_files)
+    {
+        fileStrings.push_back(addString(file.d_resourceGroup));
+        fileStrings.push_back(addString(file.d_filename));
+    }
+
+    std::uint32_t schemeFilename = BundleResourceProvider::NoString;
+    std::uint32_t schemeGroup = BundleResourceProvider::NoString;
+    if (!d_schemeFilename.empty())
+    {
+        schemeFilename = addString(d_schemeFilename);
+        schemeGroup = addString(d_schemeResourceGroup);
+    }
+
+    std::vector<std::string> utf8Strings;
+    utf8Strings.reserve(strings.size());
+    std::uint64_t offset = sizeof(BundleResourceProvider::FormatMagic) + 4 + 4;
+    for (const String& str : strings)
+    {
+        utf8Strings.push_back(toUtf8(str));
+        offset += 4 + utf8Strings.back().size();
+    }
+    offset += 4 + 4 + 4 + 32 * static_cast<std::uint64_t>(d_files.size());
+
+    out_stream.write(BundleResourceProvider::FormatMagic,
+                     sizeof(BundleResourceProvider::FormatMagic));
+    writeUInt32(out_stream, BundleResourceProvider::FormatVersion);
+
+    writeUInt32(out_stream, static_cast<std::uint32_t>(utf8Strings.size()));
+    for (const std::string& bytes : utf8Strings)
+    {
+        writeUInt32(out_stream, static_cast<std::uint32_t>(bytes.size()));
+        out_stream.write(bytes.data(), bytes.size());
+    }
+
+    writeUInt32(out_stream, schemeFilename);
+    writeUInt32(out_stream, schemeGroup);
+
+    const std::uint64_t alignment = BundleResourceProvider::DataAlignment;
+    const std::uint64_t tableEnd = offset;
+    writeUInt32(out_stream, static_cast<std::uint32_t>(d_files.size()));
+    for (size_t i = 0; i < d_files.size(); ++i)
+    {
+        const File& file = d_files[i];
+        offset = (offset + alignment - 1) / alignment * alignment;
+
+        writeUInt32(out_stream, fileStrings[2 * i]);
+        writeUInt32(out_stream, fileStrings[2 * i + 1]);
+        writeUInt32(out_stream, static_cast<std::uint32_t>(file.d_type));
+        writeUInt32(out_stream, 0);
+        writeUInt64(out_stream, offset);
+        writeUInt64(out_stream, file.d_data.size());
+
+        offset += file.d_data.size();
+    }
+
+    offset = tableEnd;
+    for (const File& file : d_files)
+    {
+        for (; offset % alignment != 0; ++offset)
+            out_stream.put('\0');
+
+        out_stream.write(file.d_data.data(), file.d_data.size());
+        offset += file.d_data.size();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ResourceBundleWriter::clear()
+{
+    d_files.clear();
+    d_keys.clear();
+    d_schemeFilename.clear();
+    d_schemeResourceGroup.clear();
+}
+
+//----------------------------------------------------------------------------//
+String ResourceBundleWriter::makeKey(const String& filename, const String& resourceGroup)
+{
+    return resourceGroup + "|" + filename;
+}
+
+//----------------------------------------------------------------------------//
+bool ResourceBundleWriter::addRecording(const String& filename,
+                                        const String& resourceGroup,
+                                        const String& schemaName,
+                                        PreparsedXML& recording)
+{
+    const String key(makeKey(filename, resourceGroup));
+    if (d_keys.count(key))
+        return false;
+
+    ResourceProvider* const resourceProvider = System::getSingleton().getResourceProvider();
+
+    RawDataContainer source;
+    resourceProvider->loadRawDataContainer(filename, source, resourceGroup);
+
+    try
+    {
+        recording.record(source, schemaName);
+    }
+    catch (...)
+    {
+        resourceProvider->unloadRawDataContainer(source);
+        throw;
+    }
+
+    resourceProvider->unloadRawDataContainer(source);
+
+    std::ostringstream data;
+    recording.write(data);
+
+    File file;
+    file.d_resourceGroup = resourceGroup;
+    file.d_filename = filename;
+    file.d_type = BundleResourceProvider::EntryType::Recording;
+    file.d_data = data.str();
+
+    d_files.push_back(std::move(file));
+    d_keys.insert(key);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,215 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/System.h"
+#include <algorithm>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+struct ResourceProvider::AsyncLoad
+{
+    String d_filename;
+    String d_resourceGroup;
+    LoadCallback d_callback;
+    RawDataContainer d_data;
+    std::exception_ptr d_error;
+    //! Scheduler running the load, nullptr if it was loaded right away.
+    TaskScheduler* d_scheduler = nullptr;
+    TaskScheduler::TaskId d_taskId = 0;
+    //! Set by the task once d_data and d_error are written.
+    bool d_finished = false;
+    //! Whether TaskScheduler::wait was called for d_taskId.
+    bool d_waited = false;
+};
+
+//----------------------------------------------------------------------------//
+ResourceProvider::~ResourceProvider()
+{
+    cancelPendingLoads();
+}
+
+//----------------------------------------------------------------------------//
+void ResourceProvider::readRawDataChunks(const String& filename,
+    const ReadChunkCallback& callback, const String& resourceGroup)
+{
+    RawDataContainer data;
+    loadRawDataContainer(filename, data, resourceGroup);
+
+    try
+    {
+        callback(data.getDataPtr(), data.getSize());
+    }
+    catch (...)
+    {
+        unloadRawDataContainer(data);
+        throw;
+    }
+
+    unloadRawDataContainer(data);
+}
+
+//----------------------------------------------------------------------------//
+void ResourceProvider::loadRawDataContainerAsync(const String& filename,
+    const String& resourceGroup, LoadCallback callback)
+{
+    std::shared_ptr<AsyncLoad> load = std::make_shared<AsyncLoad>();
+    load->d_filename = filename;
+    load->d_resourceGroup = resourceGroup;
+    load->d_callback = std::move(callback);
+
+    if (!isThreadSafe())
+    {
+        try
+        {
+            loadRawDataContainer(filename, load->d_data, resourceGroup);
+        }
+        catch (...)
+        {
+            load->d_error = std::current_exception();
+        }
+
+        load->d_finished = true;
+        std::lock_guard<std::mutex> lock(d_asyncLoadMutex);
+        d_asyncLoads.push_back(load);
+        return;
+    }
+
+    TaskScheduler& scheduler = System::getSingleton().getTaskScheduler();
+    load->d_scheduler = &scheduler;
+
+    // the task must not throw, so that the only wait for it never does either
+    const TaskScheduler::TaskId taskId = scheduler.submit([this, load]()
+    {
+        try
+        {
+            loadRawDataContainer(load->d_filename, load->d_data, load->d_resourceGroup);
+        }
+        catch (...)
+        {
+            load->d_error = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(d_asyncLoadMutex);
+        load->d_finished = true;
+    });
+
+    std::lock_guard<std::mutex> lock(d_asyncLoadMutex);
+    load->d_taskId = taskId;
+    d_asyncLoads.push_back(load);
+}
+
+//----------------------------------------------------------------------------//
+void ResourceProvider::waitForTask(AsyncLoad& load)
+{
+    if (load.d_scheduler && !load.d_waited)
+    {
+        load.d_scheduler->wait(load.d_taskId);
+        load.d_waited = true;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ResourceProvider::dispatchCompletedLoads()
+{
+    // one load at a time, so callbacks may start new loads or throw
+    while (true)
+    {
+        std::shared_ptr<AsyncLoad> load;
+        {
+            std::lock_guard<std::mutex> lock(d_asyncLoadMutex);
+            auto it = std::find_if(d_asyncLoads.begin(), d_asyncLoads.end(),
+                [](const std::shared_ptr<AsyncLoad>& pending) { return pending->d_finished; });
+
+            if (it == d_asyncLoads.end())
+                return;
+
+            load = *it;
+            d_asyncLoads.erase(it);
+        }
+
+        // the task has finished, this only releases its state in the scheduler
+        waitForTask(*load);
+
+        try
+        {
+            if (load->d_callback)
+                load->d_callback(load->d_data, load->d_error);
+        }
+        catch (...)
+        {
+            unloadRawDataContainer(load->d_data);
+            throw;
+        }
+
+        unloadRawDataContainer(load->d_data);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ResourceProvider::waitForPendingLoads()
+{
+    std::vector<std::shared_ptr<AsyncLoad>> loads;
+    {
+        std::lock_guard<std::mutex> lock(d_asyncLoadMutex);
+        loads = d_asyncLoads;
+    }
+
+    for (const auto& load : loads)
+        waitForTask(*load);
+
+    dispatchCompletedLoads();
+}
+
+//----------------------------------------------------------------------------//
+size_t ResourceProvider::getPendingLoadCount() const
+{
+    std::lock_guard<std::mutex> lock(d_asyncLoadMutex);
+    return d_asyncLoads.size();
+}
+
+//----------------------------------------------------------------------------//
+void ResourceProvider::cancelPendingLoads()
+{
+    std::vector<std::shared_ptr<AsyncLoad>> loads;
+    {
+        std::lock_guard<std::mutex> lock(d_asyncLoadMutex);
+        loads.swap(d_asyncLoads);
+    }
+
+    for (const auto& load : loads)
+    {
+        waitForTask(*load);
+        unloadRawDataContainer(load->d_data);
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
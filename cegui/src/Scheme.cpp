@@ -36,6 +36,8 @@
 #include "CEGUI/FactoryModule.h"
 #include "CEGUI/DynamicModule.h"
 #include "CEGUI/SharedStringStream.h"
+#include "CEGUI/Exceptions.h"
+#include <chrono>
 
 #ifdef HAVE_CONFIG_H
 #   include "config.h"
@@ -49,6 +51,43 @@ extern "C"
 CEGUI::FactoryModule& getWindowRendererFactoryModule();
 CEGUI::FactoryModule& getWindowFactoryModule();
 }
+
+namespace
+{
+//! A factory module linked into the static build.
+struct StaticFactoryModule
+{
+    //! Name of the module in scheme files, nullptr to match any name.
+    const char* d_name;
+    CEGUI::FactoryModule& (*d_getModule)();
+};
+
+//! The window renderer sets linked into the static build, by module name.
+const StaticFactoryModule StaticWindowRendererModules[] =
+{
+    { "CEGUICoreWindowRendererSet", &getWindowRendererFactoryModule }
+};
+
+//! The window set of the static build. It is an empty module built into CEGUI
+//! if CEGUI_BUILD_STATIC_FACTORY_MODULE is set, else the application's own.
+const StaticFactoryModule StaticWindowModules[] =
+{
+    { nullptr, &getWindowFactoryModule }
+};
+
+//----------------------------------------------------------------------------//
+template <std::size_t N>
+CEGUI::FactoryModule& getStaticFactoryModule(const StaticFactoryModule (&modules)[N],
+                                             const CEGUI::String& name)
+{
+    for (std::size_t i = 0; i < N; ++i)
+        if (!modules[i].d_name || name == modules[i].d_name)
+            return modules[i].d_getModule();
+
+    throw CEGUI::UnknownObjectException("The module '" + name +
+        "' is not linked into this static build of CEGUI.");
+}
+}
 #endif
 
 
@@ -92,17 +131,44 @@ void Scheme::loadResources(void)
 {
     Logger::getSingleton().logEvent("---- Beginning resource loading for GUI scheme '" + d_name + "' ----", LoggingLevel::Informative);
 
-    // load all resources specified for this scheme.
-    loadXMLImagesets();
-    loadImageFileImagesets();
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    // load all resources specified for this scheme; the image files of the
+    // imagesets are decoded together before the fonts that may refer to them.
+    ImageManager& imgr = ImageManager::getSingleton();
+    imgr.beginTextureLoadBatch();
+    try
+    {
+        loadXMLImagesets();
+        loadImageFileImagesets();
+    }
+    catch (...)
+    {
+        imgr.endTextureLoadBatch();
+        throw;
+    }
+    imgr.endTextureLoadBatch();
+
+    const std::chrono::steady_clock::time_point imagesetsLoaded = std::chrono::steady_clock::now();
     loadFonts();
+    const std::chrono::steady_clock::time_point fontsLoaded = std::chrono::steady_clock::now();
     loadLookNFeels();
+    const std::chrono::steady_clock::time_point looksLoaded = std::chrono::steady_clock::now();
     loadWindowRendererFactories();
     loadWindowFactories();
     loadFactoryAliases();
     loadFalagardMappings();
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
 
-    Logger::getSingleton().logEvent("---- Resource loading for GUI scheme '" + d_name + "' completed ----", LoggingLevel::Informative);
+    typedef std::chrono::duration<double, std::milli> Milliseconds;
+    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
+    sstream << "---- Resource loading for GUI scheme '" << d_name << "' completed in "
+            << Milliseconds(end - start).count() << " ms (imagesets "
+            << Milliseconds(imagesetsLoaded - start).count() << " ms, fonts "
+            << Milliseconds(fontsLoaded - imagesetsLoaded).count() << " ms, looks "
+            << Milliseconds(looksLoaded - fontsLoaded).count() << " ms, factories and mappings "
+            << Milliseconds(end - looksLoaded).count() << " ms) ----";
+    Logger::getSingleton().logEvent(sstream.str(), LoggingLevel::Informative);
 }
 
 
@@ -247,7 +313,7 @@ void Scheme::loadWindowFactories()
             // get the WindowRendererModule object for this module.
             (*cmod).factoryModule = &getWindowFactoryModuleFunc();
 #else
-            (*cmod).factoryModule = &getWindowFactoryModule();
+            (*cmod).factoryModule = &getStaticFactoryModule(StaticWindowModules, (*cmod).name);
 #endif
         }
 
@@ -300,19 +366,20 @@ void Scheme::loadWindowRendererFactories()
             // get the WindowRendererModule object for this module.
             (*cmod).factoryModule = &getWRFactoryModuleFunc();
 #else
-            (*cmod).factoryModule = &getWindowRendererFactoryModule();
+            (*cmod).factoryModule = &getStaticFactoryModule(StaticWindowRendererModules, (*cmod).name);
 #endif
         }
 
-        // see if we should just register all factories available in the module
-        // (i.e. No factories explicitly specified)
+        // see if we should just make all factories available in the module
+        // (i.e. No factories explicitly specified); each one is created when
+        // a window first uses its type.
         if ((*cmod).types.size() == 0)
         {
             Logger::getSingleton().logEvent("No window renderer factories "
                                             "specified for module '" +
                                             (*cmod).name + "' - adding all "
-                                            "available factories...");
-            (*cmod).factoryModule->registerAllFactories();
+                                            "available factories on first use...");
+            WindowRendererManager::getSingleton().addLazyFactoryModule(*(*cmod).factoryModule);
         }
         // some names were explicitly given, so only register those.
         else
@@ -513,6 +580,7 @@ void Scheme::unloadWindowRendererFactories()
         // module (i.e. No factories explicitly specified)
         if ((*cmod).types.size() == 0)
         {
+            WindowRendererManager::getSingleton().removeLazyFactoryModule(*(*cmod).factoryModule);
             (*cmod).factoryModule->unregisterAllFactories();
         }
         // remove all window factories explicitly registered for this module
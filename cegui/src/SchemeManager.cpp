@@ -27,10 +27,12 @@
 #include "CEGUI/SchemeManager.h"
 #include "CEGUI/Scheme.h"
 #include "CEGUI/Scheme_xmlHandler.h"
+#include "CEGUI/BundleResourceProvider.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/InputEvent.h"
 #include "CEGUI/System.h"
 #include "CEGUI/ResourceProvider.h"
+#include "CEGUI/DataContainer.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/SharedStringStream.h"
 
@@ -107,6 +109,64 @@ Scheme& SchemeManager::createFromFile(const String& xml_filename,
 }
 
 
+Scheme& SchemeManager::createFromBundle(const String& bundle_filename,
+    const String& resource_group,
+    XmlResourceExistsAction resourceExistsAction)
+{
+    BundleResourceProvider* const provider = dynamic_cast<BundleResourceProvider*>(
+        System::getSingleton().getResourceProvider());
+
+    if (!provider)
+        throw InvalidRequestException(
+            "Bundles can only be loaded by a BundleResourceProvider.");
+
+    const BundleResourceProvider::BundledScheme scheme(
+        provider->mountBundle(bundle_filename, resource_group));
+
+    if (scheme.d_filename.empty())
+        throw InvalidRequestException(
+            "The bundle '" + bundle_filename + "' holds no scheme.");
+
+    return createFromFile(scheme.d_filename, scheme.d_resourceGroup,
+                          resourceExistsAction);
+}
+
+
+void SchemeManager::createFromFileAsync(const String& xml_filename,
+    const String& resource_group, SchemeCreatedCallback callback,
+    XmlResourceExistsAction resourceExistsAction)
+{
+    const String group(resource_group.empty() ?
+        Scheme::getDefaultResourceGroup() : resource_group);
+
+    System::getSingleton().getResourceProvider()->loadRawDataContainerAsync(
+        xml_filename, group,
+        [this, xml_filename, group, callback, resourceExistsAction]
+        (RawDataContainer& data, std::exception_ptr error)
+    {
+        Scheme* scheme = nullptr;
+        if (!error)
+        {
+            try
+            {
+                scheme = &createFromContainer(data, resourceExistsAction);
+            }
+            catch (...)
+            {
+            }
+        }
+
+        if (!scheme)
+            Logger::getSingleton().logEvent("SchemeManager::createFromFileAsync - "
+                "loading of scheme from file '" + xml_filename + "' of resource group '" +
+                group + "' failed.", LoggingLevel::Error);
+
+        if (callback)
+            callback(scheme);
+    });
+}
+
+
 Scheme& SchemeManager::createFromString(const String& source,
     XmlResourceExistsAction resourceExistsAction)
 {
@@ -32,6 +32,8 @@
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/ScriptModules/Lua/ScriptModule.h"
 #include "CEGUI/System.h"
+#include "CEGUI/InputEvent.h"
+#include <typeinfo>
 
 // include Lua libs and tolua++
 extern "C" {
@@ -46,6 +48,28 @@ extern "C" {
 namespace CEGUI
 {
 
+namespace
+{
+//! Maps an EventArgs based class to the name of its tolua++ type.
+struct EventArgsType
+{
+    const std::type_info* d_type;
+    const char* d_luaType;
+};
+
+//! EventArgs based classes pushed as themselves, most frequent events first.
+const EventArgsType EventArgsTypes[] =
+{
+    { &typeid(CursorInputEventArgs), "const CEGUI::CursorInputEventArgs" },
+    { &typeid(WindowEventArgs), "const CEGUI::WindowEventArgs" },
+    { &typeid(UpdateEventArgs), "const CEGUI::UpdateEventArgs" },
+    { &typeid(TextEventArgs), "const CEGUI::TextEventArgs" },
+    { &typeid(SemanticEventArgs), "const CEGUI::SemanticEventArgs" },
+    { &typeid(ActivationEventArgs), "const CEGUI::ActivationEventArgs" },
+    { &typeid(DragDropEventArgs), "const CEGUI::DragDropEventArgs" }
+};
+}
+
 /*************************************************************************
     Constructor
 *************************************************************************/
@@ -169,7 +193,7 @@ bool LuaFunctor::operator()(const EventArgs& args) const
     }
 
     // push EventArgs  parameter
-    tolua_pushusertype(L, (void*)&args, "const CEGUI::EventArgs");
+    pushEventArgs(L, args);
 
     // call it
     int error = lua_pcall(L, nargs, 1, err_idx);
@@ -263,6 +287,34 @@ void LuaFunctor::pushNamedFunction(lua_State* L, const String& handler_name)
     }
 }
 
+//----------------------------------------------------------------------------//
+void LuaFunctor::pushEventArgs(lua_State* L, const EventArgs& args)
+{
+    const std::type_info& type = typeid(args);
+
+    for (const auto& entry : EventArgsTypes)
+    {
+        if (type != *entry.d_type)
+            continue;
+
+        // tolua++ pushes nothing for a type the bindings do not declare, so
+        // only use the exact type if it has a metatable in this state.
+        luaL_getmetatable(L, entry.d_luaType);
+        const bool registered = !lua_isnil(L, -1);
+        lua_pop(L, 1);
+
+        if (registered)
+        {
+            tolua_pushusertype(L, (void*)&args, entry.d_luaType);
+            return;
+        }
+
+        break;
+    }
+
+    tolua_pushusertype(L, (void*)&args, "const CEGUI::EventArgs");
+}
+
 //----------------------------------------------------------------------------//
 LuaFunctor::LuaFunctor(lua_State* state, const int func, const int selfIndex,
     const String& error_handler) :
@@ -121,6 +121,7 @@ LuaScriptModule::~LuaScriptModule()
     if (d_state)
     {
         unrefErrorFunc();
+        clearEventHandlerCache();
 
         if (d_ownsState)
             lua_close( d_state );
@@ -201,6 +202,7 @@ void LuaScriptModule::createBindings(void)
 void LuaScriptModule::destroyBindings(void)
 {
 	CEGUI::Logger::getSingleton().logEvent( "---- Destroying Lua bindings ----" );
+	clearEventHandlerCache();
 	// is this ok ?
 	lua_pushnil(d_state);
 	lua_setglobal(d_state,"CEGUI");
@@ -383,6 +385,33 @@ void LuaScriptModule::unrefErrorFunc()
     }
 }
 
+//----------------------------------------------------------------------------//
+void LuaScriptModule::clearEventHandlerCache()
+{
+    for (const auto& entry : d_eventHandlerRefs)
+        luaL_unref(d_state, LUA_REGISTRYINDEX, entry.second);
+
+    d_eventHandlerRefs.clear();
+}
+
+//----------------------------------------------------------------------------//
+void LuaScriptModule::pushEventHandler(const String& handler_name)
+{
+    const auto it = d_eventHandlerRefs.find(handler_name);
+    if (it != d_eventHandlerRefs.end())
+    {
+        lua_rawgeti(d_state, LUA_REGISTRYINDEX, it->second);
+        return;
+    }
+
+    LuaFunctor::pushNamedFunction(d_state, handler_name);
+
+    // keep a reference for the next call and leave the function on the stack
+    lua_pushvalue(d_state, -1);
+    d_eventHandlerRefs.emplace(handler_name,
+                               luaL_ref(d_state, LUA_REGISTRYINDEX));
+}
+
 //----------------------------------------------------------------------------//
 void LuaScriptModule::executeScriptFile(const String& filename,
     const String& resourceGroup, const String& error_handler)
@@ -560,6 +589,8 @@ Event::Connection LuaScriptModule::subscribeEvent(EventSet* target,
 void LuaScriptModule::executeScriptFile_impl(const String& filename,
     const String& resourceGroup, const int err_idx, const int top)
 {
+    clearEventHandlerCache();
+
     // load file
     RawDataContainer raw;
     System::getSingleton().getResourceProvider()->loadRawDataContainer(filename,
@@ -596,6 +627,8 @@ void LuaScriptModule::executeScriptFile_impl(const String& filename,
 int LuaScriptModule::executeScriptGlobal_impl(const String& function_name,
     const int err_idx, const int top)
 {
+    clearEventHandlerCache();
+
     // get the function from lua
     lua_getglobal(d_state, function_name.c_str());
 
@@ -641,10 +674,10 @@ bool LuaScriptModule::executeScriptedEventHandler_impl(
     const String& handler_name, const EventArgs& e, const int err_idx,
     const int top)
 {
-    LuaFunctor::pushNamedFunction(d_state, handler_name);
+    pushEventHandler(handler_name);
 
     // push EventArgs as the first parameter
-    tolua_pushusertype(d_state, (void*)&e, "const CEGUI::EventArgs");
+    LuaFunctor::pushEventArgs(d_state, e);
 
     // call it
     int error = lua_pcall(d_state, 1, 1, err_idx);
@@ -670,6 +703,8 @@ bool LuaScriptModule::executeScriptedEventHandler_impl(
 void LuaScriptModule::executeString_impl(const String& str, const int err_idx,
     const int top)
 {
+    clearEventHandlerCache();
+
     // load code into lua and call it
     int error = luaL_loadbuffer(d_state, str.c_str(), str.length(), str.c_str()) ||
                 lua_pcall(d_state, 0, 0, err_idx);
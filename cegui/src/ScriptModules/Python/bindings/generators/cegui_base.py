@@ -447,6 +447,27 @@ def( "subscribeEvent", &EventSet_subscribeEvent);
     # PropertySet.h
     propertySet = CEGUI_ns.class_("PropertySet")
     propertySet.include()
+    # takes a dict so that setting many properties crosses into C++ once
+    propertySet.mem_fun("setProperties").exclude()
+    propertySet.add_declaration_code(
+"""
+void
+PropertySet_setProperties ( ::CEGUI::PropertySet & me, const bp::dict& values ) {
+    const bp::list items = values.items();
+    const long count = bp::len(items);
+
+    ::CEGUI::PropertySet::PropertyValueList list;
+    list.reserve(count);
+    for (long i = 0; i < count; ++i)
+        list.push_back(std::make_pair(
+            bp::extract< ::CEGUI::String >(items[i][0])(),
+            bp::extract< ::CEGUI::String >(items[i][1])()));
+
+    me.setProperties(list);
+    }
+"""
+    )
+    propertySet.add_registration_code("""def ("setProperties", &::PropertySet_setProperties, (bp::arg("values")));""")
 
     # Quaternion.h
     quaternion = CEGUI_ns.class_("Quaternion")
@@ -670,6 +691,11 @@ def( "subscribeEvent", &EventSet_subscribeEvent);
     # python doesn't like void*
     window.mem_fun("setUserData").exclude()
     window.mem_fun("getUserData").exclude()
+    # bulk calls take and return python lists, setProperties is bound on PropertySet
+    window.mem_fun("setProperties").exclude()
+    window.mem_fun("getChildrenRecursive").exclude()
+    window.mem_fun("applyPropertyChanges").exclude()
+    window.class_("PropertyChange").exclude()
     # todo: check that getUserData is really a python object
     window.add_declaration_code(
 """
@@ -685,6 +711,30 @@ Window_getUserData ( ::CEGUI::Window & me) {
     return  (PyObject *) data;
     }
 
+bp::list
+Window_getChildrenRecursive ( const ::CEGUI::Window & me ) {
+    bp::list result;
+    for (::CEGUI::Window* window : me.getChildrenRecursive())
+        result.append(bp::ptr(window));
+    return result;
+    }
+
+// changes are (window path, property name, value) tuples
+void
+Window_applyPropertyChanges ( ::CEGUI::Window & me, const bp::list& changes ) {
+    const long count = bp::len(changes);
+
+    std::vector< ::CEGUI::Window::PropertyChange > list(count);
+    for (long i = 0; i < count; ++i)
+    {
+        list[i].d_windowPath = bp::extract< ::CEGUI::String >(changes[i][0]);
+        list[i].d_propertyName = bp::extract< ::CEGUI::String >(changes[i][1]);
+        list[i].d_value = bp::extract< ::CEGUI::String >(changes[i][2]);
+    }
+
+    me.applyPropertyChanges(list);
+    }
+
 typedef bool ( ::CEGUI::Window::*isChild_string_function_type )( const ::CEGUI::String& ) const;
 typedef bool ( ::CEGUI::Window::*isChild_ptr_function_type )( const ::CEGUI::Element* ) const;
 
@@ -697,6 +747,8 @@ typedef void ( ::CEGUI::Window::*removeChild_ptr_function_type )( ::CEGUI::Eleme
     )
     window.add_registration_code("""def ("setUserData", &::Window_setUserData);""")
     window.add_registration_code("""def ("getUserData", &::Window_getUserData);""")
+    window.add_registration_code("""def ("getChildrenRecursive", &::Window_getChildrenRecursive);""")
+    window.add_registration_code("""def ("applyPropertyChanges", &::Window_applyPropertyChanges, (bp::arg("changes")));""")
 
     window.add_registration_code("""def ("isChild", isChild_string_function_type(&::CEGUI::Window::isChild));""")
     window.add_registration_code("""def ("isChild", isChild_ptr_function_type(&::CEGUI::Window::isChild));""")
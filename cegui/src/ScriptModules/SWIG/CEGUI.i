@@ -80,6 +80,74 @@ using namespace CEGUI;
 	#endif
 %}
 
+// bulk calls, converting whole python containers so that they cross into C++ once
+%{
+	static bool CEGUI_toString(PyObject* obj, CEGUI::String& out) {
+		Py_ssize_t  strLen = 0;
+		const char* strData = PyUnicode_AsUTF8AndSize( obj, &strLen );
+		if (!strData)
+			return false;
+		#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+		out = CEGUI::String( strData );
+		#else
+		out = CEGUI::String( strData, strLen );
+		#endif
+		return true;
+	}
+%}
+// PropertySet::setProperties from a dict of names and values
+%typemap(in) const std::vector<std::pair<CEGUI::String, CEGUI::String> > & (std::vector<std::pair<CEGUI::String, CEGUI::String> > values) {
+	if (!PyDict_Check($input))
+		SWIG_exception_fail(SWIG_TypeError, "expected a dict of property names and values");
+	values.resize(PyDict_Size($input));
+	PyObject* key;
+	PyObject* value;
+	Py_ssize_t pos = 0;
+	for (size_t i = 0; PyDict_Next($input, &pos, &key, &value); ++i)
+		if (!CEGUI_toString(key, values[i].first) || !CEGUI_toString(value, values[i].second))
+			SWIG_exception_fail(SWIG_TypeError, "property names and values must be str");
+	$1 = &values;
+}
+%typemap(typecheck) const std::vector<std::pair<CEGUI::String, CEGUI::String> > & %{
+	$1 = PyDict_Check($input) ? 1 : 0;
+%}
+// StandardItemModel::addItems from a list of str
+%typemap(in) const std::vector<CEGUI::String> & (std::vector<CEGUI::String> texts) {
+	if (!PyList_Check($input))
+		SWIG_exception_fail(SWIG_TypeError, "expected a list of str");
+	texts.resize(PyList_Size($input));
+	for (size_t i = 0; i < texts.size(); ++i)
+		if (!CEGUI_toString(PyList_GET_ITEM($input, i), texts[i]))
+			SWIG_exception_fail(SWIG_TypeError, "expected a list of str");
+	$1 = &texts;
+}
+%typemap(typecheck) const std::vector<CEGUI::String> & %{
+	$1 = PyList_Check($input) ? 1 : 0;
+%}
+// Window::applyPropertyChanges from a list of (window path, property name, value) tuples
+%typemap(in) const std::vector<CEGUI::Window::PropertyChange> & (std::vector<CEGUI::Window::PropertyChange> changes) {
+	if (!PyList_Check($input))
+		SWIG_exception_fail(SWIG_TypeError, "expected a list of (path, property, value) tuples");
+	changes.resize(PyList_Size($input));
+	for (size_t i = 0; i < changes.size(); ++i)
+	{
+		PyObject* change = PyList_GET_ITEM($input, i);
+		if (!PyTuple_Check(change) || PyTuple_Size(change) != 3 ||
+			!CEGUI_toString(PyTuple_GET_ITEM(change, 0), changes[i].d_windowPath) ||
+			!CEGUI_toString(PyTuple_GET_ITEM(change, 1), changes[i].d_propertyName) ||
+			!CEGUI_toString(PyTuple_GET_ITEM(change, 2), changes[i].d_value))
+			SWIG_exception_fail(SWIG_TypeError, "expected a list of (path, property, value) tuples");
+	}
+	$1 = &changes;
+}
+// Window::getChildrenRecursive as a list
+%typemap(out) std::vector<CEGUI::Window*> {
+	const std::vector<CEGUI::Window*>& windows = $1;
+	$result = PyList_New(windows.size());
+	for (size_t i = 0; i < windows.size(); ++i)
+		PyList_SET_ITEM($result, i, SWIG_NewPointerObj(SWIG_as_voidptr(windows[i]), $descriptor(CEGUI::Window*), 0));
+}
+
 // events, poperty
 %ignore CEGUI::Event::final;
 %ignore CEGUI::final;
@@ -238,6 +306,7 @@ using namespace CEGUI;
 %include "CEGUI/views/ListView.h"
 %include "CEGUI/views/StandardItemModel.h"
 %include "CEGUI/views/TreeView.h"
+%include "CEGUI/views/TableView.h"
 
 // falagard
 %include "CEGUI/falagard/WidgetLookManager.h"
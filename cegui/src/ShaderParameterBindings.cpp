@@ -176,6 +176,17 @@ void ShaderParameterBindings::setParameter(const std::string& parameter_name,
         setNewParameter(parameter_name, new ShaderParameterFloat(fvalue));
 }
 
+//----------------------------------------------------------------------------//
+void ShaderParameterBindings::setParameter(const std::string& parameter_name, 
+    const int ivalue)
+{
+    ShaderParameter* shader_param = getParameter(parameter_name);
+    if (shader_param && (shader_param->getType() == ShaderParamType::Int))
+        static_cast<ShaderParameterInt*>(shader_param)->d_parameterValue = ivalue;
+    else
+        setNewParameter(parameter_name, new ShaderParameterInt(ivalue));
+}
+
 //----------------------------------------------------------------------------//
 ShaderParameter* ShaderParameterBindings::getParameter(const std::string& parameter_name)
 {
@@ -0,0 +1,82 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/SharedMutex.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+SharedMutex::SharedMutex() :
+    d_readers(0),
+    d_writer(false)
+{
+}
+
+//----------------------------------------------------------------------------//
+void SharedMutex::lock()
+{
+    std::unique_lock<std::mutex> guard(d_mutex);
+    d_released.wait(guard, [this] { return !d_writer && d_readers == 0; });
+    d_writer = true;
+}
+
+//----------------------------------------------------------------------------//
+void SharedMutex::unlock()
+{
+    {
+        std::lock_guard<std::mutex> guard(d_mutex);
+        d_writer = false;
+    }
+
+    d_released.notify_all();
+}
+
+//----------------------------------------------------------------------------//
+void SharedMutex::lock_shared()
+{
+    std::unique_lock<std::mutex> guard(d_mutex);
+    d_released.wait(guard, [this] { return !d_writer; });
+    ++d_readers;
+}
+
+//----------------------------------------------------------------------------//
+void SharedMutex::unlock_shared()
+{
+    bool last;
+
+    {
+        std::lock_guard<std::mutex> guard(d_mutex);
+        last = --d_readers == 0;
+    }
+
+    if (last)
+        d_released.notify_all();
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
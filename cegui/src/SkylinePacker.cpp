@@ -0,0 +1,161 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/SkylinePacker.h"
+#include <algorithm>
+#include <limits>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+SkylinePacker::SkylinePacker(int size)
+{
+    reset(size);
+}
+
+//----------------------------------------------------------------------------//
+void SkylinePacker::reset(int size)
+{
+    d_size = size;
+    d_skyline.clear();
+    if (size > 0)
+        d_skyline.push_back({ 0, 0, size });
+}
+
+//----------------------------------------------------------------------------//
+void SkylinePacker::grow(int size)
+{
+    if (size <= d_size)
+        return;
+
+    // The skyline keeps its shape, the new area on the right is empty
+    d_skyline.push_back({ d_size, 0, size - d_size });
+    d_size = size;
+}
+
+//----------------------------------------------------------------------------//
+int SkylinePacker::findPosition(int width, int height, glm::ivec2& position) const
+{
+    int bestNode = -1;
+    int bestTop = std::numeric_limits<int>::max();
+    int bestWidth = std::numeric_limits<int>::max();
+
+    for (size_t i = 0; i < d_skyline.size(); ++i)
+    {
+        const int y = fitAtNode(i, width, height);
+        if (y < 0)
+            continue;
+
+        const Node& node = d_skyline[i];
+        if (y + height < bestTop || (y + height == bestTop && node.d_width < bestWidth))
+        {
+            bestNode = static_cast<int>(i);
+            bestTop = y + height;
+            bestWidth = node.d_width;
+            position = glm::ivec2(node.d_x, y);
+        }
+    }
+
+    return bestNode;
+}
+
+//----------------------------------------------------------------------------//
+bool SkylinePacker::pack(int width, int height, glm::ivec2& position)
+{
+    const int node = findPosition(width, height, position);
+    if (node < 0)
+        return false;
+
+    addRectangle(node, position, width, height);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+int SkylinePacker::fitAtNode(size_t nodeIndex, int width, int height) const
+{
+    const int x = d_skyline[nodeIndex].d_x;
+    if (x + width > d_size)
+        return -1;
+
+    int y = 0;
+    int widthLeft = width;
+    for (size_t i = nodeIndex; widthLeft > 0; ++i)
+    {
+        if (i >= d_skyline.size())
+            return -1;
+
+        y = std::max(y, d_skyline[i].d_y);
+        if (y + height > d_size)
+            return -1;
+
+        widthLeft -= d_skyline[i].d_width;
+    }
+
+    return y;
+}
+
+//----------------------------------------------------------------------------//
+void SkylinePacker::addRectangle(int nodeIndex, const glm::ivec2& position,
+                                 int width, int height)
+{
+    const size_t index = static_cast<size_t>(nodeIndex);
+    d_skyline.insert(d_skyline.begin() + index, { position.x, position.y + height, width });
+
+    // Cut the nodes now covered by the new one
+    for (size_t i = index + 1; i < d_skyline.size(); )
+    {
+        const Node& previous = d_skyline[i - 1];
+        const int previousEnd = previous.d_x + previous.d_width;
+        if (d_skyline[i].d_x >= previousEnd)
+            break;
+
+        const int shrink = previousEnd - d_skyline[i].d_x;
+        d_skyline[i].d_x += shrink;
+        d_skyline[i].d_width -= shrink;
+
+        if (d_skyline[i].d_width > 0)
+            break;
+
+        d_skyline.erase(d_skyline.begin() + i);
+    }
+
+    // Merge neighbours at the same level
+    for (size_t i = 0; i + 1 < d_skyline.size(); )
+    {
+        if (d_skyline[i].d_y == d_skyline[i + 1].d_y)
+        {
+            d_skyline[i].d_width += d_skyline[i + 1].d_width;
+            d_skyline.erase(d_skyline.begin() + i + 1);
+        }
+        else
+            ++i;
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,177 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/SmallObjectPool.h"
+#include <mutex>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+const std::size_t SizeClassCount =
+    SmallObjectPool::MaxBlockSize / SmallObjectPool::BlockGranularity;
+const int CategoryCount = static_cast<int>(MemoryCategory::Count);
+
+//! A free block, linking to the next free block of the same size.
+struct FreeBlock
+{
+    FreeBlock* d_next;
+};
+
+//! The free blocks of one size.
+struct FreeList
+{
+    FreeBlock* d_first;
+    std::size_t d_count;
+};
+
+struct PoolState
+{
+    std::mutex d_mutex;
+    FreeList d_freeLists[CategoryCount][SizeClassCount];
+};
+
+// a function local static, so that objects created during static
+// initialisation can already use it
+PoolState& getPoolState()
+{
+    static PoolState state;
+    return state;
+}
+
+//! Returns the size class index for \a size, which must not exceed MaxBlockSize.
+std::size_t getSizeClass(std::size_t size)
+{
+    return size ? (size - 1) / SmallObjectPool::BlockGranularity : 0;
+}
+
+std::size_t getBlockSize(std::size_t sizeClass)
+{
+    return (sizeClass + 1) * SmallObjectPool::BlockGranularity;
+}
+}
+
+//----------------------------------------------------------------------------//
+const std::size_t SmallObjectPool::BlockGranularity;
+const std::size_t SmallObjectPool::MaxBlockSize;
+const std::size_t SmallObjectPool::MaxCachedBlocks;
+
+//----------------------------------------------------------------------------//
+void* SmallObjectPool::allocate(std::size_t size, MemoryCategory category)
+{
+    if (size > MaxBlockSize)
+        return MemoryAllocator::allocateTracked(size, category);
+
+    const std::size_t sizeClass = getSizeClass(size);
+
+    {
+        PoolState& state = getPoolState();
+        std::lock_guard<std::mutex> lock(state.d_mutex);
+
+        FreeList& freeList = state.d_freeLists[static_cast<int>(category)][sizeClass];
+        if (FreeBlock* block = freeList.d_first)
+        {
+            freeList.d_first = block->d_next;
+            --freeList.d_count;
+            return block;
+        }
+    }
+
+    return MemoryAllocator::allocateTracked(getBlockSize(sizeClass), category);
+}
+
+//----------------------------------------------------------------------------//
+void SmallObjectPool::deallocate(void* memory, std::size_t size, MemoryCategory category)
+{
+    if (!memory)
+        return;
+
+    if (size > MaxBlockSize)
+    {
+        MemoryAllocator::deallocateTracked(memory, size, category);
+        return;
+    }
+
+    const std::size_t sizeClass = getSizeClass(size);
+
+    {
+        PoolState& state = getPoolState();
+        std::lock_guard<std::mutex> lock(state.d_mutex);
+
+        FreeList& freeList = state.d_freeLists[static_cast<int>(category)][sizeClass];
+        if (freeList.d_count < MaxCachedBlocks)
+        {
+            FreeBlock* block = static_cast<FreeBlock*>(memory);
+            block->d_next = freeList.d_first;
+            freeList.d_first = block;
+            ++freeList.d_count;
+            return;
+        }
+    }
+
+    MemoryAllocator::deallocateTracked(memory, getBlockSize(sizeClass), category);
+}
+
+//----------------------------------------------------------------------------//
+void SmallObjectPool::releaseCachedBlocks()
+{
+    PoolState& state = getPoolState();
+    std::lock_guard<std::mutex> lock(state.d_mutex);
+
+    for (int category = 0; category < CategoryCount; ++category)
+    {
+        for (std::size_t sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass)
+        {
+            FreeList& freeList = state.d_freeLists[category][sizeClass];
+            while (FreeBlock* block = freeList.d_first)
+            {
+                freeList.d_first = block->d_next;
+                MemoryAllocator::deallocateTracked(block, getBlockSize(sizeClass),
+                    static_cast<MemoryCategory>(category));
+            }
+
+            freeList.d_count = 0;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+std::size_t SmallObjectPool::getCachedBlockCount(MemoryCategory category)
+{
+    PoolState& state = getPoolState();
+    std::lock_guard<std::mutex> lock(state.d_mutex);
+
+    std::size_t count = 0;
+    for (const FreeList& freeList : state.d_freeLists[static_cast<int>(category)])
+        count += freeList.d_count;
+
+    return count;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,269 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/SpatialNavigationStrategy.h"
+#include "CEGUI/Window.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const String SpatialNavigationStrategy::NavigateLeft("left");
+const String SpatialNavigationStrategy::NavigateRight("right");
+const String SpatialNavigationStrategy::NavigateUp("up");
+const String SpatialNavigationStrategy::NavigateDown("down");
+
+//----------------------------------------------------------------------------//
+/*
+    Walks the windows from \a begin towards \a end, which are sorted by their
+    distance from \a origin along the axis of navigation, and returns the one
+    with the lowest score. The walk stops once the distance along the axis
+    alone can't beat the best score anymore.
+*/
+template <typename Iterator, typename GetCentre, typename IsCandidate>
+static Window* findNearest(Iterator begin, Iterator end, const glm::vec2& origin,
+                           bool horizontal, float crossAxisWeight,
+                           GetCentre getCentre, IsCandidate isCandidate)
+{
+    Window* best = nullptr;
+    float bestScore = std::numeric_limits<float>::max();
+
+    for (Iterator it = begin; it != end; ++it)
+    {
+        const glm::vec2 centre = getCentre(it->second);
+        const float along = horizontal ? std::abs(centre.x - origin.x) : std::abs(centre.y - origin.y);
+        if (along >= bestScore)
+            break;
+
+        if (!isCandidate(it->second))
+            continue;
+
+        const float across = horizontal ? std::abs(centre.y - origin.y) : std::abs(centre.x - origin.x);
+        const float score = along + crossAxisWeight * across;
+        if (score < bestScore)
+        {
+            bestScore = score;
+            best = it->second;
+        }
+    }
+
+    return best;
+}
+
+//----------------------------------------------------------------------------//
+SpatialNavigationStrategy::~SpatialNavigationStrategy()
+{
+    // disconnect from the windows before the indices go away
+    clear();
+}
+
+//----------------------------------------------------------------------------//
+void SpatialNavigationStrategy::addWindow(Window* window)
+{
+    if (!window || d_entries.find(window) != d_entries.end())
+        return;
+
+    Entry& entry = d_entries[window];
+    entry.d_xPosition = d_xIndex.end();
+    entry.d_yPosition = d_yIndex.end();
+    entry.d_movedConnection = window->subscribeEvent(Element::EventMoved,
+        Event::Subscriber(&SpatialNavigationStrategy::handleAreaChanged, this));
+    entry.d_sizedConnection = window->subscribeEvent(Element::EventSized,
+        Event::Subscriber(&SpatialNavigationStrategy::handleAreaChanged, this));
+    entry.d_destructionConnection = window->subscribeEvent(Window::EventDestructionStarted,
+        Event::Subscriber(&SpatialNavigationStrategy::handleDestructionStarted, this));
+
+    // the area may still be pending, so the window is sorted in on the next query
+    entry.d_dirty = true;
+    d_dirtyWindows.push_back(window);
+}
+
+//----------------------------------------------------------------------------//
+void SpatialNavigationStrategy::removeWindow(Window* window)
+{
+    EntryMap::iterator it = d_entries.find(window);
+    if (it == d_entries.end())
+        return;
+
+    if (it->second.d_xPosition != d_xIndex.end())
+    {
+        d_xIndex.erase(it->second.d_xPosition);
+        d_yIndex.erase(it->second.d_yPosition);
+    }
+
+    if (it->second.d_dirty)
+        d_dirtyWindows.erase(std::find(d_dirtyWindows.begin(), d_dirtyWindows.end(), window));
+
+    d_entries.erase(it);
+}
+
+//----------------------------------------------------------------------------//
+void SpatialNavigationStrategy::addFocusableWindows(Window* root, bool includeRoot)
+{
+    if (!root)
+        return;
+
+    if (includeRoot && root->canFocus())
+        addWindow(root);
+
+    const size_t childCount = root->getChildCount();
+    for (size_t i = 0; i < childCount; ++i)
+        addFocusableWindows(root->getChildAtIndex(i), true);
+}
+
+//----------------------------------------------------------------------------//
+void SpatialNavigationStrategy::clear()
+{
+    d_entries.clear();
+    d_xIndex.clear();
+    d_yIndex.clear();
+    d_dirtyWindows.clear();
+}
+
+//----------------------------------------------------------------------------//
+bool SpatialNavigationStrategy::isWindowAdded(const Window* window) const
+{
+    return d_entries.find(window) != d_entries.end();
+}
+
+//----------------------------------------------------------------------------//
+Window* SpatialNavigationStrategy::getWindow(Window* neighbour, const String& payload)
+{
+    updateDirtyEntries();
+
+    EntryMap::const_iterator current = d_entries.find(neighbour);
+    if (current == d_entries.end())
+        return getFirstNavigableWindow();
+
+    const glm::vec2 origin = current->second.d_centre;
+
+    const auto getCentre = [this](const Window* window)
+    {
+        return d_entries.find(window)->second.d_centre;
+    };
+    const auto isCandidate = [neighbour](const Window* window)
+    {
+        return window != neighbour && isNavigable(*window);
+    };
+
+    Window* found = nullptr;
+    if (payload == NavigateRight)
+    {
+        found = findNearest(d_xIndex.upper_bound(origin.x), d_xIndex.end(),
+                            origin, true, d_crossAxisWeight, getCentre, isCandidate);
+    }
+    else if (payload == NavigateLeft)
+    {
+        found = findNearest(AxisIndex::reverse_iterator(d_xIndex.lower_bound(origin.x)), d_xIndex.rend(),
+                            origin, true, d_crossAxisWeight, getCentre, isCandidate);
+    }
+    else if (payload == NavigateDown)
+    {
+        found = findNearest(d_yIndex.upper_bound(origin.y), d_yIndex.end(),
+                            origin, false, d_crossAxisWeight, getCentre, isCandidate);
+    }
+    else if (payload == NavigateUp)
+    {
+        found = findNearest(AxisIndex::reverse_iterator(d_yIndex.lower_bound(origin.y)), d_yIndex.rend(),
+                            origin, false, d_crossAxisWeight, getCentre, isCandidate);
+    }
+
+    // nothing in that direction (or no direction at all), keep the focus
+    return found ? found : neighbour;
+}
+
+//----------------------------------------------------------------------------//
+void SpatialNavigationStrategy::updateDirtyEntries()
+{
+    for (const Window* window : d_dirtyWindows)
+    {
+        Entry& entry = d_entries.find(window)->second;
+        entry.d_dirty = false;
+
+        const Rectf& rect = window->getUnclippedOuterRect().get();
+        entry.d_centre = rect.d_min + (rect.d_max - rect.d_min) * 0.5f;
+
+        if (entry.d_xPosition != d_xIndex.end())
+        {
+            d_xIndex.erase(entry.d_xPosition);
+            d_yIndex.erase(entry.d_yPosition);
+        }
+
+        Window* const mutableWindow = const_cast<Window*>(window);
+        entry.d_xPosition = d_xIndex.emplace(entry.d_centre.x, mutableWindow);
+        entry.d_yPosition = d_yIndex.emplace(entry.d_centre.y, mutableWindow);
+    }
+
+    d_dirtyWindows.clear();
+}
+
+//----------------------------------------------------------------------------//
+bool SpatialNavigationStrategy::handleAreaChanged(const EventArgs& args)
+{
+    const Window* const window =
+        static_cast<const Window*>(static_cast<const ElementEventArgs&>(args).element);
+
+    EntryMap::iterator it = d_entries.find(window);
+    if (it != d_entries.end() && !it->second.d_dirty)
+    {
+        it->second.d_dirty = true;
+        d_dirtyWindows.push_back(window);
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool SpatialNavigationStrategy::handleDestructionStarted(const EventArgs& args)
+{
+    removeWindow(static_cast<const WindowEventArgs&>(args).window);
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool SpatialNavigationStrategy::isNavigable(const Window& window)
+{
+    return window.isEffectiveVisible() && !window.isEffectiveDisabled() && window.canFocus();
+}
+
+//----------------------------------------------------------------------------//
+Window* SpatialNavigationStrategy::getFirstNavigableWindow() const
+{
+    for (const AxisIndex::value_type& item : d_yIndex)
+        if (isNavigable(*item.second))
+            return item.second;
+
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -48,7 +48,9 @@ void StdRegexMatcher::setRegexString(const String& regex)
 #elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII
     const std::string& regex8bit = regex;
 #endif
-    d_regex = std::regex(regex8bit);
+    // optimize trades a slower construction for faster matching, which pays
+    // off as matchers are shared and matched on every keystroke.
+    d_regex = std::regex(regex8bit, std::regex::ECMAScript | std::regex::optimize);
     d_string = regex;
 }
 
@@ -68,8 +70,7 @@ bool StdRegexMatcher::matchRegex(const String& str) const
 #elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII
     const std::string& str8bit = str;
 #endif
-    std::smatch smatch;
-    return std::regex_match(str8bit, smatch, d_regex) && !smatch.empty();
+    return std::regex_match(str8bit, d_regex);
 }
 
 //----------------------------------------------------------------------------//
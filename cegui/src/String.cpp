@@ -71,11 +71,33 @@ std::u32string String::convertUtf8ToUtf32(const char* utf8String, const size_t s
         return std::u32string();
 
     std::u32string utf32String;
+    appendUtf8ToUtf32(utf32String, utf8String, stringLength);
+
+    return utf32String;
+}
+
+void String::appendUtf8ToUtf32(std::u32string& utf32String, const char* utf8String,
+                               const size_t stringLength)
+{
+    if (utf8String == nullptr)
+        return;
+
+    // Every UTF-8 code unit results in at most one UTF-32 code point
+    utf32String.reserve(utf32String.size() + stringLength);
 
     // Go through every UTF-8 code unit
     size_t currentCharIndex = 0;
     while (currentCharIndex < stringLength)
     {
+        // ASCII code units are code points of their own
+        const unsigned char currentCodeUnit = static_cast<unsigned char>(utf8String[currentCharIndex]);
+        if (currentCodeUnit < 0x80)
+        {
+            utf32String.push_back(currentCodeUnit);
+            ++currentCharIndex;
+            continue;
+        }
+
         size_t remainingCodeUnits = stringLength - currentCharIndex;
         size_t usedCodeUnits;
         char32_t utf32CodePoint = getCodePointFromCodeUnits(utf8String + currentCharIndex,
@@ -85,8 +107,41 @@ std::u32string String::convertUtf8ToUtf32(const char* utf8String, const size_t s
 
         utf32String.push_back(utf32CodePoint);
     }
+}
 
-    return utf32String;
+int String::compareUtf32ToUtf8(const char32_t* utf32String, const size_t utf32Length,
+                               const char* utf8String, const size_t utf8Length)
+{
+    // Decode the UTF-8 code units while comparing, so no converted copy is needed
+    size_t utf32Index = 0;
+    size_t utf8Index = 0;
+    while (utf32Index < utf32Length && utf8Index < utf8Length)
+    {
+        char32_t utf8CodePoint;
+        const unsigned char currentCodeUnit = static_cast<unsigned char>(utf8String[utf8Index]);
+        if (currentCodeUnit < 0x80)
+        {
+            utf8CodePoint = currentCodeUnit;
+            ++utf8Index;
+        }
+        else
+        {
+            size_t usedCodeUnits;
+            utf8CodePoint = getCodePointFromCodeUnits(utf8String + utf8Index,
+                                                      utf8Length - utf8Index,
+                                                      usedCodeUnits);
+            utf8Index += usedCodeUnits;
+        }
+
+        const char32_t utf32CodePoint = utf32String[utf32Index++];
+        if (utf32CodePoint != utf8CodePoint)
+            return utf32CodePoint < utf8CodePoint ? -1 : 1;
+    }
+
+    if (utf32Index < utf32Length)
+        return 1;
+
+    return utf8Index < utf8Length ? -1 : 0;
 }
 
 std::string String::convertUtf32ToUtf8(const char32_t* utf32String)
@@ -122,7 +177,9 @@ std::string String::convertUtf32ToUtf8(const char32_t* utf32String, const size_t
         return std::string();
 
     std::string utf8EncodedString;
-    
+    // Most strings are mostly ASCII, which takes one UTF-8 code unit per code point
+    utf8EncodedString.reserve(stringLength);
+
     // Go through every UTF-32 code unit
     for (size_t currentCharIndex = 0; currentCharIndex < stringLength; ++currentCharIndex)
     {
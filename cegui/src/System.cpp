@@ -49,8 +49,16 @@
 #include "CEGUI/DefaultResourceProvider.h"
 #include "CEGUI/ImageCodec.h"
 #include "CEGUI/widgets/All.h"
+#include "CEGUI/views/TableView.h"
 #include "CEGUI/SharedStringStream.h"
 #include "CEGUI/svg/SVGDataManager.h"
+#include "CEGUI/TaskScheduler.h"
+#include "CEGUI/SmallObjectPool.h"
+#include "CEGUI/RegexMatcher.h"
+#ifdef CEGUI_HAS_FREETYPE
+#   include "CEGUI/FreeTypeFont.h"
+#   include "CEGUI/FreeTypeGlyphAtlas.h"
+#endif
 #if defined(CEGUI_HAS_PCRE_REGEX)
 #   include "CEGUI/PCRERegexMatcher.h"
 #elif defined(CEGUI_HAS_STD11_REGEX)
@@ -74,12 +82,50 @@ void destroyImageCodec(CEGUI::ImageCodec* imageCodec);
 }
 #endif
 
+#include <chrono>
+
 #define S_(X) #X
 #define STRINGIZE(X) S_(X)
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+namespace
+{
+//----------------------------------------------------------------------------//
+//! Adds the time from its construction to its destruction to the startup times.
+class StartupTimer
+{
+public:
+    StartupTimer(System::StartupTimeList& times, const String& subsystem) :
+        d_times(times),
+        d_subsystem(subsystem),
+        d_start(std::chrono::steady_clock::now())
+    {}
+
+    ~StartupTimer()
+    {
+        const std::chrono::duration<double, std::milli> duration =
+            std::chrono::steady_clock::now() - d_start;
+        const System::StartupTime time = { d_subsystem, duration.count() };
+        d_times.push_back(time);
+
+        if (Logger* logger = Logger::getSingletonPtr())
+        {
+            std::stringstream& sstream = SharedStringstream::GetPreparedStream();
+            sstream << "[System] " << d_subsystem << " initialised in "
+                    << time.d_milliseconds << " ms";
+            logger->logEvent(sstream.str(), LoggingLevel::Informative);
+        }
+    }
+
+private:
+    System::StartupTimeList& d_times;
+    const String d_subsystem;
+    const std::chrono::steady_clock::time_point d_start;
+};
+}
+
 const String System::EventNamespace("System");
 
 /*************************************************************************
@@ -128,7 +174,9 @@ System::System(Renderer& renderer,
   d_ourImageCodec(false),
   d_imageCodecModule(nullptr),
   d_ourLogger(Logger::getSingletonPtr() == nullptr),
-  d_customRenderedStringParser(nullptr)
+  d_customRenderedStringParser(nullptr),
+  d_taskScheduler(nullptr),
+  d_serialTaskScheduler(new SerialTaskScheduler())
 {
     // Start out by fixing the numeric locale to C (we depend on this behaviour)
     // consider a UVector2 as a property {{0.5,0},{0.5,0}} could become {{0,5,0},{0,5,0}}
@@ -162,43 +210,52 @@ System::System(Renderer& renderer,
     }
 
     // handle initialisation and setup of the XML parser
-    setupXMLParser();
+    {
+        StartupTimer timer(d_startupTimes, "XML parser");
+        setupXMLParser();
+    }
 
     // now XML is available, read the configuration file (if any)
     Config_xmlHandler config;
-    if (!configFile.empty())
     {
-        try
-        {
-            d_xmlParser->parseXMLFile(config, configFile,
-                                      config.CEGUIConfigSchemaName,
-                                      "");
-        }
-        catch (...)
+        StartupTimer timer(d_startupTimes, "Configuration");
+        if (!configFile.empty())
         {
-            // cleanup XML stuff
-            d_xmlParser->cleanup();
-            delete d_xmlParser;
-            throw;
+            try
+            {
+                d_xmlParser->parseXMLFile(config, configFile,
+                                          config.CEGUIConfigSchemaName,
+                                          "");
+            }
+            catch (...)
+            {
+                // cleanup XML stuff
+                d_xmlParser->cleanup();
+                delete d_xmlParser;
+                throw;
+            }
         }
-    }
 
-    // Initialise logger if the user didn't create a logger beforehand
-    if (d_ourLogger)
-        config.initialiseLogger(logFile);
+        // Initialise logger if the user didn't create a logger beforehand
+        if (d_ourLogger)
+            config.initialiseLogger(logFile);
 
-    // if we created the resource provider we know it's DefaultResourceProvider
-    // so can auto-initialise the resource group directories via the config
-    if (d_ourResourceProvider)
-        config.initialiseResourceGroupDirectories();
+        // if we created the resource provider we know it's DefaultResourceProvider
+        // so can auto-initialise the resource group directories via the config
+        if (d_ourResourceProvider)
+            config.initialiseResourceGroupDirectories();
 
-    // get config to update XML parser if it needs to.
-    config.initialiseXMLParser();
+        // get config to update XML parser if it needs to.
+        config.initialiseXMLParser();
+    }
 
     // set up ImageCodec
-    config.initialiseImageCodec();
-    if (!d_imageCodec)
-        setupImageCodec("");
+    {
+        StartupTimer timer(d_startupTimes, "Image codec");
+        config.initialiseImageCodec();
+        if (!d_imageCodec)
+            setupImageCodec("");
+    }
 
     // initialise any default resource groups specified in the config.
     config.initialiseDefaultResourceGroups();
@@ -209,10 +266,16 @@ System::System(Renderer& renderer,
     logger.logEvent("---- Beginning CEGUI System initialisation ----");
 
     // create the core system singleton objects
-    createSingletons();
+    {
+        StartupTimer timer(d_startupTimes, "Core singletons");
+        createSingletons();
+    }
 
     // add the window factories for the core window types
-    addStandardWindowFactories();
+    {
+        StartupTimer timer(d_startupTimes, "Standard window factories");
+        addStandardWindowFactories();
+    }
 
     String addressStr = SharedStringstream::GetPointerAddressAsString(this);
     logger.logEvent("CEGUI::System Singleton created. (" + addressStr + ")");
@@ -220,16 +283,20 @@ System::System(Renderer& renderer,
     logger.logEvent("");
 
     // autoload resources specified in config
-    config.loadAutoResources();
+    {
+        StartupTimer timer(d_startupTimes, "Auto-loaded resources");
+        config.loadAutoResources();
 
-    // set up defaults
-    config.initialiseDefaultFont();
-    config.initialiseDefaultCursor();
-    config.initialiseDefaulTooltip();
+        // set up defaults
+        config.initialiseDefaultFont();
+        config.initialiseDefaultCursor();
+        config.initialiseDefaulTooltip();
+    }
 
     // scripting available?
     if (d_scriptModule)
     {
+        StartupTimer timer(d_startupTimes, "Script module");
         d_scriptModule->createBindings();
         config.executeInitScript();
         d_termScriptName = config.getTerminateScriptName();
@@ -255,6 +322,9 @@ System::~System(void)
 
     }
 
+    // callbacks of pending loads would find the managers destroyed
+    d_resourceProvider->cancelPendingLoads();
+
     if (d_nativeClipboardProvider != nullptr)
         delete d_nativeClipboardProvider;
 
@@ -296,6 +366,10 @@ System::~System(void)
     if (d_ourResourceProvider)
         delete d_resourceProvider;
 
+    // matchers still acquired by client code
+    for (auto& entry : d_sharedRegexMatchers)
+        destroyRegexMatcher(entry.second.d_matcher);
+
     String addressStr = SharedStringstream::GetPointerAddressAsString(this);
     Logger::getSingleton().logEvent("CEGUI::System singleton destroyed. " + addressStr);
     Logger::getSingleton().logEvent("---- CEGUI System destruction completed ----");
@@ -307,6 +381,7 @@ System::~System(void)
 #endif
 
     delete d_clipboard;
+    delete d_serialTaskScheduler;
 }
 
 //---------------------------------------------------------------------------//
@@ -407,6 +482,16 @@ const String& System::getVerboseVersion()
 //----------------------------------------------------------------------------//
 void System::renderAllGUIContexts()
 {
+#ifdef CEGUI_HAS_FREETYPE
+    // show the glyphs rasterised in the background since the last frame
+    FreeTypeFont::processRasterisedGlyphs();
+#endif
+
+    // the geometry of all contexts is generated at once, only its submission
+    // has to happen one context after the other
+    if (d_guiContexts.size() > 1)
+        GUIContext::bufferGeometryInParallel(d_guiContexts);
+
     d_renderer->beginRendering();
 
     for (GUIContextCollection::iterator i = d_guiContexts.begin();
@@ -417,13 +502,30 @@ void System::renderAllGUIContexts()
     }
 
     d_renderer->endRendering();
+    d_renderer->finishFrameStats();
 
-    // do final destruction on dead-pool windows
-    WindowManager::getSingleton().cleanDeadPool();
+#ifdef CEGUI_HAS_FREETYPE
+    // age the shared glyph atlas, evicting the pages nothing used this frame
+    FreeTypeGlyphAtlas::notifyFrameEnded();
+#endif
+
+    // keep the textures within the memory budget, if one is set
+    d_renderer->getTextureResidencyManager().notifyFrameEnded();
+
+    // do final destruction on dead-pool windows, within the time budget
+    WindowManager::getSingleton().cleanDeadPoolWithinBudget();
 }
 
 void System::renderAllGUIContextsOnTarget(Renderer* /*contained_in*/)
 {
+#ifdef CEGUI_HAS_FREETYPE
+    // show the glyphs rasterised in the background since the last frame
+    FreeTypeFont::processRasterisedGlyphs();
+#endif
+
+    if (d_guiContexts.size() > 1)
+        GUIContext::bufferGeometryInParallel(d_guiContexts);
+
     d_renderer->beginRendering();
 
     for (GUIContextCollection::iterator i = d_guiContexts.begin();
@@ -436,9 +538,18 @@ void System::renderAllGUIContextsOnTarget(Renderer* /*contained_in*/)
     }
 
     d_renderer->endRendering();
+    d_renderer->finishFrameStats();
 
-    // do final destruction on dead-pool windows
-    WindowManager::getSingleton().cleanDeadPool();
+#ifdef CEGUI_HAS_FREETYPE
+    // age the shared glyph atlas, evicting the pages nothing used this frame
+    FreeTypeGlyphAtlas::notifyFrameEnded();
+#endif
+
+    // keep the textures within the memory budget, if one is set
+    d_renderer->getTextureResidencyManager().notifyFrameEnded();
+
+    // do final destruction on dead-pool windows, within the time budget
+    WindowManager::getSingleton().cleanDeadPoolWithinBudget();
 }
 
 /*************************************************************************
@@ -581,6 +692,21 @@ void System::executeScriptString(const String& str) const
 bool System::injectTimePulse(float timeElapsed)
 {
     AnimationManager::getSingleton().autoStepInstances(timeElapsed);
+    d_resourceProvider->dispatchCompletedLoads();
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool System::isIdle() const
+{
+    if (AnimationManager::getSingleton().hasAutoSteppedRunningInstances() ||
+        d_resourceProvider->getPendingLoadCount() != 0)
+        return false;
+
+    for (const GUIContext* context : d_guiContexts)
+        if (!context->isIdle())
+            return false;
+
     return true;
 }
 
@@ -600,13 +726,14 @@ System*    System::getSingletonPtr(void)
 *************************************************************************/
 void System::notifyDisplaySizeChanged(const Sizef& new_size)
 {
-    // notify other components of the display size change
+    // notify other components of the display size change. Each invalidates
+    // only what it affects: images whose rendered size changed invalidate the
+    // cached rendering, fonts whose scale changed their own windows, and the
+    // layout triggered by the new target area the windows it really resizes.
     ImageManager::getSingleton().notifyDisplaySizeChanged(new_size);
     FontManager::getSingleton().notifyDisplaySizeChanged(new_size);
     d_renderer->setDisplaySize(new_size);
 
-    invalidateAllWindows();
-
     // Fire event
     DisplayEventArgs args(new_size);
     fireEvent(EventDisplaySizeChanged, args, EventNamespace);
@@ -683,6 +810,7 @@ void System::addStandardWindowFactories()
     // views
     WindowFactoryManager::addWindowType<ListView>();
     WindowFactoryManager::addWindowType<TreeView>();
+    WindowFactoryManager::addWindowType<TableView>();
 }
 
 void System::createSingletons()
@@ -910,6 +1038,28 @@ System& System::create(Renderer& renderer, ResourceProvider* resourceProvider,
                        scriptModule, configFile, logFile);
 }
 
+//----------------------------------------------------------------------------//
+void System::setMemoryAllocator(MemoryAllocator* allocator)
+{
+    if (getSingletonPtr())
+        throw InvalidRequestException(
+            "The MemoryAllocator can not be changed while the System exists.");
+
+    SmallObjectPool::releaseCachedBlocks();
+    if (MemoryAllocator::getTotalAllocationCount() != 0)
+        throw InvalidRequestException(
+            "The MemoryAllocator can not be changed while objects allocated "
+            "through the current one still exist.");
+
+    MemoryAllocator::setCurrent(allocator);
+}
+
+//----------------------------------------------------------------------------//
+MemoryAllocator& System::getMemoryAllocator()
+{
+    return MemoryAllocator::getCurrent();
+}
+
 //----------------------------------------------------------------------------//
 void System::performVersionTest(const int expected, const int received,
                                 const String& func)
@@ -950,6 +1100,18 @@ void System::setDefaultCustomRenderedStringParser(RenderedStringParser* parser)
     }
 }
 
+//----------------------------------------------------------------------------//
+void System::setTaskScheduler(TaskScheduler* scheduler)
+{
+    d_taskScheduler = scheduler;
+}
+
+//----------------------------------------------------------------------------//
+TaskScheduler& System::getTaskScheduler() const
+{
+    return d_taskScheduler ? *d_taskScheduler : *d_serialTaskScheduler;
+}
+
 //----------------------------------------------------------------------------//
 void System::invalidateAllCachedRendering()
 {
@@ -992,6 +1154,52 @@ void System::destroyRegexMatcher(RegexMatcher* rm) const
     delete rm;
 }
 
+//----------------------------------------------------------------------------//
+RegexMatcher* System::acquireRegexMatcher(const String& regex)
+{
+    auto it = d_sharedRegexMatchers.find(regex);
+    if (it != d_sharedRegexMatchers.end())
+    {
+        ++it->second.d_users;
+        return it->second.d_matcher;
+    }
+
+    RegexMatcher* matcher = createRegexMatcher();
+    if (!matcher)
+        return nullptr;
+
+    try
+    {
+        matcher->setRegexString(regex);
+    }
+    catch (...)
+    {
+        destroyRegexMatcher(matcher);
+        throw;
+    }
+
+    d_sharedRegexMatchers.emplace(regex, SharedRegexMatcher{matcher, 1});
+    return matcher;
+}
+
+//----------------------------------------------------------------------------//
+void System::releaseRegexMatcher(RegexMatcher* rm)
+{
+    if (!rm)
+        return;
+
+    auto it = d_sharedRegexMatchers.find(rm->getRegexString());
+    if (it == d_sharedRegexMatchers.end() || it->second.d_matcher != rm)
+        throw InvalidRequestException(
+            "The RegexMatcher was not returned by acquireRegexMatcher.");
+
+    if (--it->second.d_users == 0)
+    {
+        destroyRegexMatcher(rm);
+        d_sharedRegexMatchers.erase(it);
+    }
+}
+
 //----------------------------------------------------------------------------//
 void System::setDefaultFontName(const String& name)
 {
@@ -0,0 +1,233 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/TaskScheduler.h"
+#include "CEGUI/Exceptions.h"
+#include <algorithm>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+void TaskScheduler::parallelFor(std::size_t begin, std::size_t end, const IndexedTask& body)
+{
+    if (begin >= end)
+        return;
+
+    const std::size_t count = end - begin;
+    const std::size_t chunkCount = std::max<std::size_t>(1, std::min(count, getConcurrency()));
+    const std::size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+
+    std::vector<TaskId> tasks;
+    std::size_t chunkBegin = begin;
+    for (; end - chunkBegin > chunkSize; chunkBegin += chunkSize)
+    {
+        const std::size_t chunkEnd = chunkBegin + chunkSize;
+        tasks.push_back(submit([&body, chunkBegin, chunkEnd]()
+        {
+            for (std::size_t i = chunkBegin; i < chunkEnd; ++i)
+                body(i);
+        }));
+    }
+
+    std::exception_ptr error;
+    try
+    {
+        for (std::size_t i = chunkBegin; i < end; ++i)
+            body(i);
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    // every chunk references body, so all of them must finish before leaving
+    for (TaskId task : tasks)
+    {
+        try
+        {
+            wait(task);
+        }
+        catch (...)
+        {
+            if (!error)
+                error = std::current_exception();
+        }
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+//----------------------------------------------------------------------------//
+TaskScheduler::TaskId SerialTaskScheduler::submit(Task task)
+{
+    const TaskId id = d_nextTaskId++;
+
+    try
+    {
+        task();
+    }
+    catch (...)
+    {
+        d_failedTasks[id] = std::current_exception();
+    }
+
+    return id;
+}
+
+//----------------------------------------------------------------------------//
+void SerialTaskScheduler::wait(TaskId id)
+{
+    auto failed = d_failedTasks.find(id);
+    if (failed == d_failedTasks.end())
+        return;
+
+    const std::exception_ptr error = failed->second;
+    d_failedTasks.erase(failed);
+    std::rethrow_exception(error);
+}
+
+//----------------------------------------------------------------------------//
+void SerialTaskScheduler::parallelFor(std::size_t begin, std::size_t end, const IndexedTask& body)
+{
+    for (std::size_t i = begin; i < end; ++i)
+        body(i);
+}
+
+//----------------------------------------------------------------------------//
+ThreadPoolTaskScheduler::ThreadPoolTaskScheduler(std::size_t threadCount)
+{
+    if (threadCount == 0)
+    {
+        const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+        threadCount = (hardwareThreads > 1) ? hardwareThreads - 1 : 1;
+    }
+
+    d_workers.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+        d_workers.emplace_back(&ThreadPoolTaskScheduler::workerMain, this);
+}
+
+//----------------------------------------------------------------------------//
+ThreadPoolTaskScheduler::~ThreadPoolTaskScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stopping = true;
+    }
+    d_taskQueued.notify_all();
+
+    for (std::thread& worker : d_workers)
+        worker.join();
+}
+
+//----------------------------------------------------------------------------//
+TaskScheduler::TaskId ThreadPoolTaskScheduler::submit(Task task)
+{
+    TaskId id;
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        id = d_nextTaskId++;
+        d_tasks[id];
+        d_queue.emplace_back(id, std::move(task));
+    }
+    d_taskQueued.notify_one();
+
+    return id;
+}
+
+//----------------------------------------------------------------------------//
+void ThreadPoolTaskScheduler::wait(TaskId id)
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+
+    if (d_tasks.find(id) == d_tasks.end())
+        throw InvalidRequestException("The task to wait for is not known to "
+            "this ThreadPoolTaskScheduler or was already waited for.");
+
+    // help with the queue instead of idling, which also allows nested waits
+    while (!d_tasks[id].d_finished)
+    {
+        if (!d_queue.empty())
+            runQueuedTask(lock);
+        else
+            d_taskFinished.wait(lock);
+    }
+
+    auto state = d_tasks.find(id);
+    const std::exception_ptr error = state->second.d_error;
+    d_tasks.erase(state);
+    lock.unlock();
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+//----------------------------------------------------------------------------//
+void ThreadPoolTaskScheduler::runQueuedTask(std::unique_lock<std::mutex>& lock)
+{
+    std::pair<TaskId, Task> entry(std::move(d_queue.front()));
+    d_queue.pop_front();
+    lock.unlock();
+
+    std::exception_ptr error;
+    try
+    {
+        entry.second();
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    lock.lock();
+    TaskState& state = d_tasks[entry.first];
+    state.d_finished = true;
+    state.d_error = error;
+    d_taskFinished.notify_all();
+}
+
+//----------------------------------------------------------------------------//
+void ThreadPoolTaskScheduler::workerMain()
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+
+    while (true)
+    {
+        d_taskQueued.wait(lock, [this]() { return d_stopping || !d_queue.empty(); });
+
+        // queued tasks are still run when stopping
+        if (d_queue.empty())
+            return;
+
+        runQueuedTask(lock);
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,302 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/TextureResidencyManager.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/TextureTarget.h"
+#include "CEGUI/GeometryBuffer.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const std::size_t TextureResidencyManager::NoBudget =
+    std::numeric_limits<std::size_t>::max();
+
+//----------------------------------------------------------------------------//
+TextureResidencyManager::TextureResidencyManager(Renderer& owner) :
+    d_owner(owner),
+    d_memoryBudget(NoBudget),
+    d_frame(0),
+    d_usedThisFrame(false),
+    d_evictionCount(0),
+    d_restoreCount(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+void TextureResidencyManager::addTexture(Texture& texture, TextureCategory category,
+                                         EvictFunction evict, RestoreFunction restore)
+{
+    Entry& entry = d_entries[&texture];
+    entry.d_texture = &texture;
+    entry.d_name = texture.getName();
+    entry.d_target = nullptr;
+    entry.d_category = category;
+    entry.d_evict = evict;
+    entry.d_restore = restore;
+    entry.d_lastUsedFrame = d_frame;
+}
+
+//----------------------------------------------------------------------------//
+void TextureResidencyManager::addTextureTarget(const TextureTarget& target,
+                                               EvictFunction evict)
+{
+    Texture& texture = target.getTexture();
+    addTexture(texture, TextureCategory::RenderTarget, evict);
+    d_entries[&texture].d_target = &target;
+}
+
+//----------------------------------------------------------------------------//
+void TextureResidencyManager::removeTexture(const Texture& texture)
+{
+    d_entries.erase(&texture);
+}
+
+//----------------------------------------------------------------------------//
+bool TextureResidencyManager::isTextureTracked(const Texture& texture) const
+{
+    return d_entries.find(&texture) != d_entries.end();
+}
+
+//----------------------------------------------------------------------------//
+void TextureResidencyManager::markUsed(const Texture& texture)
+{
+    d_usedThisFrame = true;
+
+    auto iter = d_entries.find(&texture);
+    if (iter == d_entries.end())
+        return;
+
+    Entry& entry = iter->second;
+    entry.d_lastUsedFrame = d_frame;
+
+    if (!entry.d_restore || !isTextureAlive(entry) || !entry.d_texture->isDataReleased())
+        return;
+
+    // the restore function may add the texture again, invalidating entry
+    const RestoreFunction restore(entry.d_restore);
+    restore();
+    ++d_restoreCount;
+}
+
+//----------------------------------------------------------------------------//
+void TextureResidencyManager::markUsed(const GeometryBuffer& buffer)
+{
+    static const std::string textureParameter("texture0");
+
+    d_usedThisFrame = true;
+
+    if (const Texture* texture = buffer.getTexture(textureParameter))
+        markUsed(*texture);
+}
+
+//----------------------------------------------------------------------------//
+void TextureResidencyManager::markUsed(const std::vector<GeometryBuffer*>& buffers)
+{
+    for (const GeometryBuffer* buffer : buffers)
+        markUsed(*buffer);
+}
+
+//----------------------------------------------------------------------------//
+void TextureResidencyManager::setMemoryBudget(std::size_t bytes)
+{
+    d_memoryBudget = bytes;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t TextureResidencyManager::getMemoryUsage(TextureCategory category) const
+{
+    std::size_t usage = 0;
+    for (const auto& entry : d_entries)
+        if (entry.second.d_category == category)
+            usage += getMemoryUsage(entry.second);
+
+    if (category == TextureCategory::RenderTarget)
+        usage += d_owner.getTextureTargetPool().getIdleMemoryUsage();
+
+    return usage;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t TextureResidencyManager::getMemoryUsage() const
+{
+    std::size_t usage = d_owner.getTextureTargetPool().getIdleMemoryUsage();
+    for (const auto& entry : d_entries)
+        usage += getMemoryUsage(entry.second);
+
+    return usage;
+}
+
+//----------------------------------------------------------------------------//
+void TextureResidencyManager::notifyFrameEnded()
+{
+    if (!d_usedThisFrame)
+        return;
+
+    removeDestroyedTextures();
+
+    if (d_memoryBudget != NoBudget)
+        enforceMemoryBudget();
+
+    d_usedThisFrame = false;
+    ++d_frame;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t TextureResidencyManager::estimateMemoryUsage(const Texture& texture)
+{
+    if (texture.isDataReleased())
+        return 0;
+
+    const Sizef& size(texture.getSize());
+    std::size_t usage = static_cast<std::size_t>(std::ceil(size.d_width)) *
+                        static_cast<std::size_t>(std::ceil(size.d_height)) * 4;
+
+    if (texture.isMipmapsEnabled())
+    {
+        // each halving of the resident scale drops the largest level
+        for (float scale = texture.getResidentScale(); scale <= 0.5f; scale *= 2.0f)
+            usage /= 4;
+
+        // the whole mip chain takes a third more than its base level
+        usage += usage / 3;
+    }
+
+    return usage;
+}
+
+//----------------------------------------------------------------------------//
+bool TextureResidencyManager::isTextureAlive(const Entry& entry) const
+{
+    if (entry.d_target)
+        return true;
+
+    return d_owner.isTextureDefined(entry.d_name) &&
+           &d_owner.getTexture(entry.d_name) == entry.d_texture;
+}
+
+//----------------------------------------------------------------------------//
+void TextureResidencyManager::removeDestroyedTextures()
+{
+    for (auto iter = d_entries.begin(); iter != d_entries.end();)
+    {
+        if (isTextureAlive(iter->second))
+            ++iter;
+        else
+            iter = d_entries.erase(iter);
+    }
+}
+
+//----------------------------------------------------------------------------//
+std::size_t TextureResidencyManager::getMemoryUsage(const Entry& entry) const
+{
+    if (!isTextureAlive(entry))
+        return 0;
+
+    if (entry.d_target)
+        return TextureTargetPool::estimateMemoryUsage(*entry.d_target);
+
+    return estimateMemoryUsage(*entry.d_texture);
+}
+
+//----------------------------------------------------------------------------//
+void TextureResidencyManager::enforceMemoryBudget()
+{
+    TextureTargetPool& pool = d_owner.getTextureTargetPool();
+
+    // idle targets are the cheapest to give up, nothing is drawn with them
+    if (getMemoryUsage() > d_memoryBudget)
+        pool.clear();
+
+    std::size_t usage = getMemoryUsage();
+    if (usage <= d_memoryBudget)
+        return;
+
+    struct Candidate
+    {
+        const Texture* d_texture;
+        int d_priority;
+        std::uint64_t d_lastUsedFrame;
+    };
+
+    // textures drawn in the frame just ended are kept
+    std::vector<Candidate> candidates;
+    for (const auto& entry : d_entries)
+    {
+        const Entry& e = entry.second;
+        if (!e.d_evict || e.d_lastUsedFrame >= d_frame || e.d_texture->isDataReleased())
+            continue;
+
+        // render targets and glyph pages are cheap to recreate, imagesets
+        // must be loaded from their files again
+        Candidate candidate;
+        candidate.d_texture = entry.first;
+        candidate.d_priority = e.d_category == TextureCategory::Imageset ? 1 : 0;
+        candidate.d_lastUsedFrame = e.d_lastUsedFrame;
+        candidates.push_back(candidate);
+    }
+
+    std::sort(candidates.begin(), candidates.end(),
+        [](const Candidate& a, const Candidate& b)
+        {
+            if (a.d_priority != b.d_priority)
+                return a.d_priority < b.d_priority;
+            return a.d_lastUsedFrame < b.d_lastUsedFrame;
+        });
+
+    for (const Candidate& candidate : candidates)
+    {
+        if (usage <= d_memoryBudget)
+            break;
+
+        // earlier evictions may have removed the texture
+        auto iter = d_entries.find(candidate.d_texture);
+        if (iter == d_entries.end())
+            continue;
+
+        const std::size_t textureUsage = getMemoryUsage(iter->second);
+
+        // the function may remove the texture and so invalidate the entry
+        const EvictFunction evict(iter->second.d_evict);
+        if (!evict())
+            continue;
+
+        ++d_evictionCount;
+        usage = usage > textureUsage ? usage - textureUsage : 0;
+    }
+
+    // targets of evicted RenderingWindows went back to the pool
+    pool.clear();
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -26,6 +26,8 @@
  ***************************************************************************/
 #include "CEGUI/TextureTarget.h"
 
+#include <algorithm>
+#include <cmath>
 
 namespace CEGUI
 {
@@ -38,5 +40,48 @@ bool TextureTarget::getUsesStencil() const
     return d_usesStencil;
 }
 
+void TextureTarget::clearArea(const Rectf&)
+{
+    clear();
+}
+
+Sizef TextureTargetGrowthPolicy::getStorageSize(const Sizef& current, const Sizef& required)
+{
+    if (!d_enabled)
+        return required;
+
+    if (required.d_width <= current.d_width && required.d_height <= current.d_height)
+    {
+        const bool underused =
+            required.d_width * required.d_height * 4.0f < current.d_width * current.d_height;
+
+        if (!underused)
+        {
+            d_underusedDeclarations = 0;
+            return current;
+        }
+
+        if (++d_underusedDeclarations < ShrinkDelay)
+            return current;
+
+        d_underusedDeclarations = 0;
+        return Sizef(roundUp(required.d_width), roundUp(required.d_height));
+    }
+
+    d_underusedDeclarations = 0;
+
+    // grow by half at least, so that steadily growing content rarely reallocates
+    return Sizef(
+        required.d_width > current.d_width ?
+            roundUp(std::max(required.d_width, current.d_width * 1.5f)) : current.d_width,
+        required.d_height > current.d_height ?
+            roundUp(std::max(required.d_height, current.d_height * 1.5f)) : current.d_height);
+}
+
+float TextureTargetGrowthPolicy::roundUp(float extent)
+{
+    return std::ceil(extent / Granularity) * Granularity;
+}
+
 
 }
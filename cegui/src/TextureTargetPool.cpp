@@ -0,0 +1,181 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/TextureTargetPool.h"
+#include "CEGUI/TextureTarget.h"
+#include "CEGUI/Renderer.h"
+#include <cmath>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const std::size_t TextureTargetPool::DefaultMemoryBudget;
+const std::uint32_t TextureTargetPool::DefaultBucketGranularity;
+
+//----------------------------------------------------------------------------//
+TextureTargetPool::TextureTargetPool(Renderer& owner) :
+    d_owner(owner),
+    d_idleMemoryUsage(0),
+    d_memoryBudget(DefaultMemoryBudget),
+    d_bucketGranularity(DefaultBucketGranularity),
+    d_hitCount(0),
+    d_missCount(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+TextureTargetPool::~TextureTargetPool()
+{
+    // the owning Renderer is being destroyed and takes its targets down itself
+    forgetAll();
+}
+
+//----------------------------------------------------------------------------//
+TextureTarget* TextureTargetPool::acquire(bool addStencilBuffer, const Sizef& size)
+{
+    const std::uint32_t bucketWidth = getBucket(size.d_width);
+    const std::uint32_t bucketHeight = getBucket(size.d_height);
+
+    // search from the most recently released target on
+    std::vector<IdleTarget>::iterator match = d_idleTargets.end();
+    for (std::vector<IdleTarget>::iterator iter = d_idleTargets.end();
+         iter != d_idleTargets.begin();)
+    {
+        --iter;
+        const TextureTarget& target = *iter->d_target;
+        if (target.getUsesStencil() != addStencilBuffer)
+            continue;
+
+        const Sizef targetSize(target.getArea().getSize());
+        if (getBucket(targetSize.d_width) != bucketWidth ||
+            getBucket(targetSize.d_height) != bucketHeight)
+            continue;
+
+        match = iter;
+        if (targetSize == size)
+            break;
+    }
+
+    if (match == d_idleTargets.end())
+    {
+        ++d_missCount;
+        return d_owner.createTextureTarget(addStencilBuffer);
+    }
+
+    TextureTarget* target = match->d_target;
+    d_idleMemoryUsage -= match->d_memoryUsage;
+    d_idleTargets.erase(match);
+    ++d_hitCount;
+
+    target->clear();
+    return target;
+}
+
+//----------------------------------------------------------------------------//
+void TextureTargetPool::release(TextureTarget* target)
+{
+    if (!target)
+        return;
+
+    IdleTarget idle;
+    idle.d_target = target;
+    idle.d_memoryUsage = estimateMemoryUsage(*target);
+
+    d_idleTargets.push_back(idle);
+    d_idleMemoryUsage += idle.d_memoryUsage;
+
+    enforceMemoryBudget();
+}
+
+//----------------------------------------------------------------------------//
+void TextureTargetPool::clear()
+{
+    // take the list first, destroying targets may call back into forgetAll
+    std::vector<IdleTarget> targets;
+    targets.swap(d_idleTargets);
+    d_idleMemoryUsage = 0;
+
+    for (const IdleTarget& idle : targets)
+        d_owner.destroyTextureTarget(idle.d_target);
+}
+
+//----------------------------------------------------------------------------//
+void TextureTargetPool::forgetAll()
+{
+    d_idleTargets.clear();
+    d_idleMemoryUsage = 0;
+}
+
+//----------------------------------------------------------------------------//
+void TextureTargetPool::setMemoryBudget(std::size_t budget)
+{
+    d_memoryBudget = budget;
+    enforceMemoryBudget();
+}
+
+//----------------------------------------------------------------------------//
+std::size_t TextureTargetPool::estimateMemoryUsage(const TextureTarget& target)
+{
+    const Sizef size(target.getArea().getSize());
+    const std::size_t pixels = static_cast<std::size_t>(std::ceil(size.d_width)) *
+                               static_cast<std::size_t>(std::ceil(size.d_height));
+
+    // 32 bit colour, plus a 32 bit depth / stencil buffer if used
+    return pixels * (target.getUsesStencil() ? 8 : 4);
+}
+
+//----------------------------------------------------------------------------//
+std::uint32_t TextureTargetPool::getBucket(float extent) const
+{
+    const std::uint32_t pixels = static_cast<std::uint32_t>(std::ceil(extent));
+    if (d_bucketGranularity == 0)
+        return pixels;
+
+    return (pixels + d_bucketGranularity - 1) / d_bucketGranularity;
+}
+
+//----------------------------------------------------------------------------//
+void TextureTargetPool::enforceMemoryBudget()
+{
+    std::size_t evictCount = 0;
+    while (d_idleMemoryUsage > d_memoryBudget && evictCount < d_idleTargets.size())
+        d_idleMemoryUsage -= d_idleTargets[evictCount++].d_memoryUsage;
+
+    if (!evictCount)
+        return;
+
+    const std::vector<IdleTarget> evicted(d_idleTargets.begin(),
+                                          d_idleTargets.begin() + evictCount);
+    d_idleTargets.erase(d_idleTargets.begin(), d_idleTargets.begin() + evictCount);
+
+    for (const IdleTarget& idle : evicted)
+        d_owner.destroyTextureTarget(idle.d_target);
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -56,18 +56,16 @@ bool UndoHandler::undo(size_t &cursor)
         {
             UndoAction &action = d_undoList[d_undoPosition--];
 
-            String newText = d_attachedWindow->getText();
             if (action.d_type == UndoActionType::Insert)
             {
-                newText.erase(action.d_startIdx, action.d_text.length());
                 cursor = action.d_startIdx;
+                d_attachedWindow->eraseText(action.d_startIdx, action.d_text.length());
             }
             else
             {
-                newText.insert(action.d_startIdx, action.d_text);
                 cursor = action.d_startIdx + action.d_text.length();
+                d_attachedWindow->insertText(action.d_text, action.d_startIdx);
             }
-            d_attachedWindow->setText(newText);
             d_lastUndo = true;
             return true;
         }
@@ -85,18 +83,16 @@ bool UndoHandler::redo(size_t &cursor)
     {
         UndoAction &action = d_undoList[++d_undoPosition];
 
-        String newText = d_attachedWindow->getText();
         if (action.d_type == UndoActionType::Insert)
         {
-            newText.insert(action.d_startIdx, action.d_text);
             cursor = action.d_startIdx + action.d_text.length();
+            d_attachedWindow->insertText(action.d_text, action.d_startIdx);
         }
         else
         {
-            newText.erase(action.d_startIdx, action.d_text.length());
             cursor = action.d_startIdx;
+            d_attachedWindow->eraseText(action.d_startIdx, action.d_text.length());
         }
-        d_attachedWindow->setText(newText);
         d_lastUndo = false;
         return true;
     }
@@ -36,18 +36,24 @@
 #include "CEGUI/WindowRendererManager.h"
 #include "CEGUI/WindowFactoryManager.h"
 #include "CEGUI/GUIContext.h"
+#include "CEGUI/Profiler.h"
 #include "CEGUI/widgets/Tooltip.h"
 #include "CEGUI/falagard/WidgetLookManager.h"
 #include "CEGUI/falagard/WidgetLookFeel.h"
 #include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/ClipRegion.h"
 #include "CEGUI/RenderingContext.h"
 #include "CEGUI/RenderingWindow.h"
+#include "CEGUI/InPlaceRenderEffect.h"
 #include "CEGUI/RenderTarget.h"
+#include "CEGUI/TextureTarget.h"
 #include "CEGUI/GlobalEventSet.h"
 #include "CEGUI/SharedStringStream.h"
 #include "CEGUI/BasicRenderedStringParser.h"
 #include "CEGUI/DefaultRenderedStringParser.h"
 #include "CEGUI/Logger.h"
+#include "CEGUI/WindowHitTestIndex.h"
+#include "CEGUI/WindowStaticGroup.h"
 #if defined (CEGUI_USE_FRIBIDI)
 #include "CEGUI/FribidiVisualMapping.h"
 #elif defined (CEGUI_USE_MINIBIDI)
@@ -57,6 +63,9 @@
 #include "CEGUI/RaqmTextData.h"
 #endif
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
 #include <queue>
 
 // Start of CEGUI namespace section
@@ -95,6 +104,9 @@ const String Window::UpdateModePropertyName("UpdateMode");
 const String Window::CursorInputPropagationEnabledPropertyName("CursorInputPropagationEnabled");
 const String Window::AutoWindowPropertyName("AutoWindow");
 const String Window::DrawModeMaskPropertyName("DrawModeMask");
+const String Window::HitTestIndexEnabledPropertyName("HitTestIndexEnabled");
+const String Window::StaticGroupEnabledPropertyName("StaticGroupEnabled");
+const String Window::RotationUsingGeometryPropertyName("RotationUsingGeometry");
 //----------------------------------------------------------------------------//
 const String Window::EventNamespace("Window");
 const String Window::EventUpdated ("Updated");
@@ -118,6 +130,7 @@ const String Window::EventInvalidated( "Invalidated" );
 const String Window::EventRenderingStarted( "RenderingStarted" );
 const String Window::EventRenderingEnded( "RenderingEnded" );
 const String Window::EventDestructionStarted( "DestructionStarted" );
+const String Window::EventRecycled( "Recycled" );
 const String Window::EventDragDropItemEnters("DragDropItemEnters");
 const String Window::EventDragDropItemLeaves("DragDropItemLeaves");
 const String Window::EventDragDropItemDropped("DragDropItemDropped");
@@ -160,6 +173,11 @@ DefaultRenderedStringParser Window::d_defaultStringParser;
 Window::WindowRendererProperty Window::d_windowRendererProperty;
 Window::LookNFeelProperty Window::d_lookNFeelProperty;
 
+//----------------------------------------------------------------------------//
+std::uint64_t Window::s_clippingGeneration = 0;
+GUIContext* Window::s_updatingContext = nullptr;
+std::uint64_t Window::s_updatePulse = 0;
+
 //----------------------------------------------------------------------------//
 Window::WindowRendererProperty::WindowRendererProperty() : TplWindowProperty<Window,String>(
     "WindowRenderer",
@@ -203,6 +221,48 @@ void Window::LookNFeelProperty::writeXMLToStream(const PropertyReceiver* receive
 Window::Window(const String& type, const String& name):
     NamedElement(name),
 
+    // rendering components and text system
+    d_guiContext(nullptr),
+    d_windowRenderer(nullptr),
+    d_surface(nullptr),
+    d_cursor(nullptr),
+    d_font(nullptr),
+    d_customStringParser(nullptr),
+    d_oldCapture(nullptr),
+    d_userData(nullptr),
+
+#if defined (CEGUI_USE_FRIBIDI)
+    d_bidiVisualMapping(new FribidiVisualMapping),
+#elif defined (CEGUI_USE_MINIBIDI)
+    d_bidiVisualMapping(new MinibidiVisualMapping),
+#elif defined (CEGUI_BIDI_SUPPORT)
+    #error "BIDI Configuration is inconsistant, check your config!"
+#endif
+#ifdef CEGUI_USE_RAQM
+    d_raqmTextData(new RaqmTextData()),
+#endif
+
+    // initialise area cache rects
+    d_outerRectClipper(0, 0, 0, 0),
+    d_innerRectClipper(0, 0, 0, 0),
+    d_hitTestRect(0, 0, 0, 0),
+
+    d_clippingGeneration(++s_clippingGeneration),
+
+    // margin
+    d_margin(UBox(UDim(0, 0))),
+
+    d_drawModeMask(DrawModeFlagWindowRegular),
+    d_ID(0),
+
+    // Initial update mode
+    d_updateMode(WindowUpdateMode::Visible),
+
+    // alpha transparency set up
+    d_alpha(1.0f),
+
+    d_drawListTopmostBegin(0),
+
     // basic types and initial window name
     d_type(type),
     d_autoWindow(false),
@@ -220,50 +280,28 @@ Window::Window(const String& type, const String& name):
     // clipping options
     d_clippedByParent(true),
 
-    // rendering components and options
-    d_windowRenderer(nullptr),
-    d_surface(nullptr),
+    // rendering options
     d_needsRedraw(true),
+    d_needsTransformUpdate(false),
+    d_cullingGeometry(false),
+    d_geometryCulled(false),
+    d_subtreeUpdateRequested(false),
+    d_hasUnclippedGeometry(false),
+    d_rotationUsingGeometry(false),
     d_autoRenderingWindow(false),
+    d_autoRenderingWindowEvicted(false),
     d_autoRenderingSurfaceStencilEnabled(false),
-    d_cursor(nullptr),
 
-    // alpha transparency set up
-    d_alpha(1.0f),
     d_inheritsAlpha(true),
 
     // cursor input capture set up
-    d_oldCapture(nullptr),
     d_restoreOldCapture(false),
     d_distCapturedInputs(false),
 
     // text system set up
-    d_font(nullptr),
-
-#if defined (CEGUI_USE_FRIBIDI)
-    d_bidiVisualMapping(new FribidiVisualMapping),
-    d_bidiDataValid(false),
-#elif defined (CEGUI_USE_MINIBIDI)
-    d_bidiVisualMapping(new MinibidiVisualMapping),
-    d_bidiDataValid(false),
-#elif defined (CEGUI_BIDI_SUPPORT)
-    #error "BIDI Configuration is inconsistant, check your config!"
-#endif
-#ifdef CEGUI_USE_RAQM
-    d_raqmTextData(new RaqmTextData()),
-#endif
-
     d_renderedStringValid(false),
-    d_customStringParser(nullptr),
     d_textParsingEnabled(true),
 
-    // margin
-    d_margin(UBox(UDim(0, 0))),
-
-    // user specific data
-    d_ID(0),
-    d_userData(nullptr),
-
     // z-order related options
     d_alwaysOnTop(false),
     d_riseOnPointerActivation(true),
@@ -271,46 +309,25 @@ Window::Window(const String& type, const String& name):
 
     d_cursorPassThroughEnabled(false),
     d_autoRepeat(false),
-    d_repeatDelay(0.3f),
-    d_repeatRate(0.06f),
-    d_repeatPointerSource(CursorInputSource::NotSpecified),
-    d_repeating(false),
-    d_repeatElapsed(0.0f),
 
     // drag and drop
     d_dragDropTarget(true),
 
     // tool tip related
-    d_customTip(nullptr),
-    d_weOwnTip(false),
     d_inheritsTipText(true),
     d_tooltipEnabled(true),
 
     // XML writing options
     d_allowWriteXML(true),
 
-    // initialise area cache rects
-    d_outerRectClipper(0, 0, 0, 0),
-    d_innerRectClipper(0, 0, 0, 0),
-    d_hitTestRect(0, 0, 0, 0),
-
-    // cached pixel rect validity flags
-    d_outerRectClipperValid(false),
-    d_innerRectClipperValid(false),
-    d_hitTestRectValid(false),
-
-    // Initial update mode
-    d_updateMode(WindowUpdateMode::Visible),
-
     // Don't propagate cursor inputs by default.
     d_propagatePointerInputs(false),
 
-    d_guiContext(nullptr),
-
     d_containsPointer(false),
-    d_isFocused(false),
-
-    d_drawModeMask(DrawModeFlagWindowRegular)
+    d_isFocused(false)
+#if defined (CEGUI_USE_FRIBIDI) || defined (CEGUI_USE_MINIBIDI)
+    , d_bidiDataValid(false)
+#endif
 {
 
     d_fontRenderSizeChangeConnection =
@@ -328,6 +345,9 @@ Window::~Window()
     // most cleanup actually happened earlier in Window::destroy.
     destroyGeometryBuffers();
 
+    if (d_updateListContext)
+        d_updateListContext->cancelWindowUpdate(*this);
+
 #ifdef CEGUI_BIDI_SUPPORT
     delete d_bidiVisualMapping;
 #endif
@@ -343,6 +363,10 @@ void Window::endInitialisation()
 //----------------------------------------------------------------------------//
 bool Window::isChild(unsigned int ID) const
 {
+    if (ID != 0)
+        if (const Window* owner = getIDIndexOwner())
+            return findIndexedDescendant(*owner, ID, true) != nullptr;
+
     const size_t child_count = getChildCount();
 
     for (size_t i = 0; i < child_count; ++i)
@@ -355,6 +379,10 @@ bool Window::isChild(unsigned int ID) const
 //----------------------------------------------------------------------------//
 bool Window::isChildRecursive(unsigned int ID) const
 {
+    if (ID != 0)
+        if (const Window* owner = getIDIndexOwner())
+            return findIndexedDescendant(*owner, ID, false) != nullptr;
+
     const size_t child_count = getChildCount();
 
     for (size_t i = 0; i < child_count; ++i)
@@ -380,6 +408,10 @@ Window* Window::getChild(unsigned int id) const
 //----------------------------------------------------------------------------//
 Window* Window::findChild(unsigned int id) const
 {
+    if (id != 0)
+        if (const Window* owner = getIDIndexOwner())
+            return findIndexedDescendant(*owner, id, true);
+
     const size_t child_count = getChildCount();
 
     for (size_t i = 0; i < child_count; ++i)
@@ -389,9 +421,30 @@ Window* Window::findChild(unsigned int id) const
     return nullptr;
 }
 
+//----------------------------------------------------------------------------//
+std::vector<Window*> Window::getChildrenRecursive() const
+{
+    std::vector<Window*> windows(d_children.size());
+    for (size_t i = 0; i < d_children.size(); ++i)
+        windows[i] = static_cast<Window*>(d_children[i]);
+
+    // the windows found so far double as the queue of the search
+    for (size_t i = 0; i < windows.size(); ++i)
+    {
+        for (Element* child : windows[i]->d_children)
+            windows.push_back(static_cast<Window*>(child));
+    }
+
+    return windows;
+}
+
 //----------------------------------------------------------------------------//
 Window* Window::getChildRecursive(unsigned int ID) const
 {
+    if (ID != 0)
+        if (const Window* owner = getIDIndexOwner())
+            return findIndexedDescendant(*owner, ID, false);
+
     std::queue<Element*> ElementsToSearch;
 
     for (Element* child : d_children) // load all children into the queue
@@ -488,10 +541,11 @@ float Window::getEffectiveAlpha() const
 //----------------------------------------------------------------------------//
 const Rectf& Window::getOuterRectClipper() const
 {
-    if (!d_outerRectClipperValid)
+    const std::uint64_t generation = getClippingGeneration();
+    if (d_outerRectClipperGeneration != generation)
     {
         d_outerRectClipper = getOuterRectClipper_impl();
-        d_outerRectClipperValid = true;
+        d_outerRectClipperGeneration = generation;
     }
 
     return d_outerRectClipper;
@@ -500,10 +554,11 @@ const Rectf& Window::getOuterRectClipper() const
 //----------------------------------------------------------------------------//
 const Rectf& Window::getInnerRectClipper() const
 {
-    if (!d_innerRectClipperValid)
+    const std::uint64_t generation = getClippingGeneration();
+    if (d_innerRectClipperGeneration != generation)
     {
         d_innerRectClipper = getInnerRectClipper_impl();
-        d_innerRectClipperValid = true;
+        d_innerRectClipperGeneration = generation;
     }
 
     return d_innerRectClipper;
@@ -512,15 +567,79 @@ const Rectf& Window::getInnerRectClipper() const
 //----------------------------------------------------------------------------//
 const Rectf& Window::getHitTestRect() const
 {
-    if (!d_hitTestRectValid)
+    const std::uint64_t generation = getClippingGeneration();
+    if (d_hitTestRectGeneration != generation)
     {
         d_hitTestRect = getHitTestRect_impl();
-        d_hitTestRectValid = true;
+        d_hitTestRectGeneration = generation;
     }
 
     return d_hitTestRect;
 }
 
+//----------------------------------------------------------------------------//
+std::uint64_t Window::getClippingGeneration() const
+{
+    // nothing was invalidated anywhere since the last call
+    if (d_effectiveClippingGenerationCheck == s_clippingGeneration)
+        return d_effectiveClippingGeneration;
+
+    std::uint64_t generation = d_clippingGeneration;
+    if (d_parent && d_clippedByParent)
+        generation = std::max(generation, getParent()->getClippingGeneration());
+
+    d_effectiveClippingGeneration = generation;
+    d_effectiveClippingGenerationCheck = s_clippingGeneration;
+    return generation;
+}
+
+//----------------------------------------------------------------------------//
+bool Window::cullGeometry(const Rectf& area) const
+{
+    if (!d_cullingGeometry)
+        return false;
+
+    const Rectf visible(area.getIntersection(d_geometryCullRect));
+    if (visible.getWidth() > 0.0f && visible.getHeight() > 0.0f)
+        return false;
+
+    d_geometryCulled = true;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+Rectf Window::getLocalClippingRegion() const
+{
+    Rectf region(d_clippingRegion);
+    region.offset(-glm::vec2(d_translation));
+    return region;
+}
+
+//----------------------------------------------------------------------------//
+bool Window::isDrawCulled() const
+{
+    if (d_hasUnclippedGeometry || (d_surface && d_surface->isRenderingWindow()))
+        return false;
+
+    return d_clippingRegion.getWidth() <= 0.0f || d_clippingRegion.getHeight() <= 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+bool Window::isSubtreeCulled() const
+{
+    if (!isDrawCulled())
+        return false;
+
+    // children not clipped by us may still be seen
+    for (const Window* wnd : d_drawList)
+    {
+        if (wnd->isVisible() && !wnd->isSubtreeCulled())
+            return false;
+    }
+
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 Rectf Window::getParentClipRect() const
 {
@@ -593,6 +712,12 @@ bool Window::isHit(const glm::vec2& position, const bool allow_disabled) const
     if ((test_area.getWidth() == 0.0f) || (test_area.getHeight() == 0.0f))
         return false;
 
+    if (isRotatingGeometry())
+    {
+        glm::vec2 local;
+        return unrotatePosition(position, local) && test_area.isPointInRectf(local);
+    }
+
     return test_area.isPointInRectf(position);
 }
 
@@ -612,23 +737,43 @@ Window* Window::getChildAtPosition(const glm::vec2& position,
     // if the window has RenderingWindow backing
     if (d_surface && d_surface->isRenderingWindow())
         static_cast<RenderingWindow*>(d_surface)->unprojectPoint(position, p);
+    else if (isRotatingGeometry())
+    {
+        // the children are laid out in our unrotated area
+        if (!unrotatePosition(position, p))
+            return nullptr;
+    }
     else
         p = position;
 
-    const auto end = d_drawList.crend();
-    for (auto child = d_drawList.rbegin(); child != end; ++child)
+    const auto hitTestChild = [&](Window* child) -> Window*
     {
-        if ((*child) != exclude && (*child)->isEffectiveVisible())
-        {
-            // recursively scan for hit on children of this child window...
-            if (Window* const wnd = (*child)->getChildAtPosition(p, hittestfunc, allow_disabled, exclude))
+        if (child == exclude || !child->isEffectiveVisible())
+            return nullptr;
+
+        // recursively scan for hit on children of this child window...
+        if (Window* const wnd = child->getChildAtPosition(p, hittestfunc, allow_disabled, exclude))
+            return wnd;
+
+        // see if this child is hit and return it if it is
+        return (child->*hittestfunc)(p, allow_disabled) ? child : nullptr;
+    };
+
+    // only the children whose area covers the position can be hit
+    if (d_hitTestIndex)
+    {
+        for (Window* const child : d_hitTestIndex->getCandidates(p))
+            if (Window* const wnd = hitTestChild(child))
                 return wnd;
-            // see if this child is hit and return it's cursor if it is
-            else if (((*child)->*hittestfunc)(p, allow_disabled))
-                return *child;
-        }
+
+        return nullptr;
     }
 
+    const auto end = d_drawList.crend();
+    for (auto child = d_drawList.rbegin(); child != end; ++child)
+        if (Window* const wnd = hitTestChild(*child))
+            return wnd;
+
     // nothing hit
     return nullptr;
 }
@@ -647,6 +792,210 @@ bool Window::isHitTargetWindow(const glm::vec2& position, bool allow_disabled) c
     return !isCursorPassThroughEnabled() && isHit(position, allow_disabled);
 }
 
+//----------------------------------------------------------------------------//
+void Window::setHitTestIndexEnabled(bool setting)
+{
+    if (setting == isHitTestIndexEnabled())
+        return;
+
+    if (setting)
+        d_hitTestIndex.reset(new WindowHitTestIndex(*this));
+    else
+        d_hitTestIndex.reset();
+}
+
+//----------------------------------------------------------------------------//
+void Window::setIDIndexEnabled(bool setting)
+{
+    if (setting == isIDIndexEnabled())
+        return;
+
+    if (setting)
+    {
+        d_idIndex.reset(new IDIndex());
+        for (Element* child : d_children)
+            addToIDIndex(*d_idIndex, *static_cast<Window*>(child));
+    }
+    else
+        d_idIndex.reset();
+}
+
+//----------------------------------------------------------------------------//
+const Window* Window::getIDIndexOwner() const
+{
+    for (const Window* wnd = this; wnd; wnd = wnd->getParent())
+        if (wnd->d_idIndex)
+            return wnd;
+
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------//
+Window* Window::findIndexedDescendant(const Window& owner, unsigned int ID,
+                                      bool childrenOnly) const
+{
+    const auto range = owner.d_idIndex->equal_range(ID);
+
+    // the common case of a unique ID looked up on the owner needs no ordering
+    if (this == &owner && !childrenOnly &&
+        range.first != range.second && std::next(range.first) == range.second)
+        return range.first->second;
+
+    Window* found = nullptr;
+    size_t foundDepth = 0;
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        Window* const candidate = it->second;
+
+        // the index of an ancestor also holds windows outside of this subtree
+        size_t depth = 1;
+        const Window* parent = candidate->getParent();
+        while (parent != this && parent && !childrenOnly)
+        {
+            parent = parent->getParent();
+            ++depth;
+        }
+
+        if (parent != this)
+            continue;
+
+        // keep the order of a breadth first search over the children
+        bool precedes = !found || depth < foundDepth;
+        if (found && depth == foundDepth)
+        {
+            const Window* a = candidate;
+            const Window* b = found;
+            while (a->getParent() != b->getParent())
+            {
+                a = a->getParent();
+                b = b->getParent();
+            }
+
+            precedes = a->getParent()->getChildIndex(a) < a->getParent()->getChildIndex(b);
+        }
+
+        if (precedes)
+        {
+            found = candidate;
+            foundDepth = depth;
+        }
+    }
+
+    return found;
+}
+
+//----------------------------------------------------------------------------//
+void Window::addToIDIndex(IDIndex& index, Window& wnd)
+{
+    if (wnd.d_ID != 0)
+        index.emplace(wnd.d_ID, &wnd);
+
+    for (Element* child : wnd.d_children)
+        addToIDIndex(index, *static_cast<Window*>(child));
+}
+
+//----------------------------------------------------------------------------//
+void Window::removeFromIDIndex(IDIndex& index, const Window& wnd)
+{
+    if (wnd.d_ID != 0)
+    {
+        const auto range = index.equal_range(wnd.d_ID);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == &wnd)
+            {
+                index.erase(it);
+                break;
+            }
+        }
+    }
+
+    for (const Element* child : wnd.d_children)
+        removeFromIDIndex(index, *static_cast<const Window*>(child));
+}
+
+//----------------------------------------------------------------------------//
+void Window::setStaticGroupEnabled(bool setting)
+{
+    if (setting == isStaticGroupEnabled())
+        return;
+
+    if (setting)
+        d_staticGroup.reset(new WindowStaticGroup(*this));
+    else
+        d_staticGroup.reset();
+
+    invalidateRenderingSurface();
+}
+
+//----------------------------------------------------------------------------//
+void Window::setRotationUsingGeometry(bool setting)
+{
+    if (setting == d_rotationUsingGeometry)
+        return;
+
+    d_rotationUsingGeometry = setting;
+    applyRotation();
+}
+
+//----------------------------------------------------------------------------//
+bool Window::isRotatingGeometry() const
+{
+    return d_rotationUsingGeometry && d_rotation != glm::quat(1.0f, 0.0f, 0.0f, 0.0f) &&
+        !(d_surface && d_surface->isRenderingWindow());
+}
+
+//----------------------------------------------------------------------------//
+void Window::invalidateStaticGroups()
+{
+    bool invalidated = false;
+    for (Window* wnd = this; wnd; wnd = wnd->getParent())
+    {
+        if (wnd->d_staticGroup)
+        {
+            wnd->d_staticGroup->invalidate();
+            invalidated = true;
+        }
+    }
+
+    // the merged geometry is only rebuilt when the windows are drawn again
+    if (invalidated)
+        if (GUIContext* context = getGUIContextPtr())
+            context->markAsDirty();
+}
+
+//----------------------------------------------------------------------------//
+void Window::invalidateHitTestIndexEntry(bool ancestors)
+{
+    Window* wnd = this;
+    while (Window* const parent = wnd->getParent())
+    {
+        if (parent->d_hitTestIndex)
+            parent->d_hitTestIndex->invalidateChild(*wnd);
+
+        if (!ancestors)
+            break;
+
+        wnd = parent;
+    }
+
+    // the window containing the cursor may be another one now
+    if (GUIContext* context = getGUIContextPtr())
+        context->updateWindowContainingCursor();
+}
+
+//----------------------------------------------------------------------------//
+void Window::setCursorPassThroughEnabled(bool setting)
+{
+    if (d_cursorPassThroughEnabled == setting)
+        return;
+
+    d_cursorPassThroughEnabled = setting;
+
+    if (GUIContext* context = getGUIContextPtr())
+        context->updateWindowContainingCursor();
+}
+
 //----------------------------------------------------------------------------//
 void Window::setEnabled(bool enabled)
 {
@@ -765,6 +1114,10 @@ void Window::setClippedByParent(bool setting)
         return;
 
     d_clippedByParent = setting;
+
+    // whether our ancestors' children can be hit outside their areas changed
+    invalidateHitTestIndexEntry(true);
+
     WindowEventArgs args(this);
     onClippingChanged(args);
 }
@@ -804,17 +1157,8 @@ void Window::setFont(const String& name)
 //----------------------------------------------------------------------------//
 void Window::removeChild(unsigned int ID)
 {
-    const size_t child_count = getChildCount();
-
-    for (size_t i = 0; i < child_count; ++i)
-    {
-        if (getChildAtIndex(i)->getID() == ID)
-        {
-            removeChild(d_children[i]);
-            return;
-        }
-
-    }
+    if (Window* wnd = findChild(ID))
+        removeChild(wnd);
 }
 
 //----------------------------------------------------------------------------//
@@ -863,14 +1207,12 @@ bool Window::moveToFront_impl(bool byClick)
     {
         took_action = true;
 
-        // remove us from our parent's draw list
-        getParent()->removeWindowFromDrawList(*this);
-        // re-attach ourselves to our parent's draw list which will move us in
-        // front of sibling windows with the same 'always-on-top' setting as we
-        // have.
-        getParent()->addWindowToDrawList(*this);
-        // notify relevant windows about the z-order change.
-        onZChange_impl();
+        // move us in front of sibling windows with the same 'always-on-top'
+        // setting as we have.
+        Window* const parent = getParent();
+        parent->moveInDrawList(parent->getDrawListIndex(*this),
+            (d_alwaysOnTop ? parent->d_drawList.size() :
+                             parent->d_drawListTopmostBegin) - 1);
     }
 
     return took_action;
@@ -886,14 +1228,11 @@ void Window::moveToBack()
     {
         if (d_zOrderingEnabled)
         {
-            // remove us from our parent's draw list
-            getParent()->removeWindowFromDrawList(*this);
-            // re-attach ourselves to our parent's draw list which will move us
-            // in behind sibling windows with the same 'always-on-top' setting
-            // as we have.
-            getParent()->addWindowToDrawList(*this, true);
-            // notify relevant windows about the z-order change.
-            onZChange_impl();
+            // move us in behind sibling windows with the same 'always-on-top'
+            // setting as we have.
+            Window* const parent = getParent();
+            parent->moveInDrawList(parent->getDrawListIndex(*this),
+                d_alwaysOnTop ? parent->d_drawListTopmostBegin : 0);
         }
 
         // FIXME: what for?
@@ -909,25 +1248,12 @@ void Window::moveInFront(const Window* const window)
         !d_zOrderingEnabled)
         return;
 
-    // erase us from our current position
-    const auto p = std::find(getParent()->d_drawList.begin(),
-        getParent()->d_drawList.end(),
-        this);
-    if (p != getParent()->d_drawList.end())
-        getParent()->d_drawList.erase(p);
-
-    // find window we're to be moved in front of in parent's draw list
-    auto i = std::find(getParent()->d_drawList.begin(),
-        getParent()->d_drawList.end(),
-        window);
-    // sanity check that target window was also attached to correct parent.
-    assert(i != getParent()->d_drawList.end());
-
-    // reinsert ourselves at the right location
-    getParent()->d_drawList.insert(++i, this);
+    Window* const parent = getParent();
+    const size_t from = parent->getDrawListIndex(*this);
+    const size_t target = parent->getDrawListIndex(*window);
 
-    // handle event notifications for affected windows.
-    onZChange_impl();
+    // the target shifts down by one when we are taken from below it
+    parent->moveInDrawList(from, from < target ? target : target + 1);
 }
 
 //----------------------------------------------------------------------------//
@@ -938,28 +1264,12 @@ void Window::moveBehind(const Window* const window)
         !d_zOrderingEnabled)
         return;
 
-    // find our position in the parent child draw list
-    const auto p = std::find(getParent()->d_drawList.begin(),
-        getParent()->d_drawList.end(),
-        this);
-    // sanity checK that we were attached to our parent.
-    assert(p != getParent()->d_drawList.end());
-
-    // erase us from our current position
-    getParent()->d_drawList.erase(p);
-
-    // find window we're to be moved in front of in parent's draw list
-    const auto i = std::find(getParent()->d_drawList.begin(),
-        getParent()->d_drawList.end(),
-        window);
-    // sanity check that target window was also attached to correct parent.
-    assert(i != getParent()->d_drawList.end());
+    Window* const parent = getParent();
+    const size_t from = parent->getDrawListIndex(*this);
+    const size_t target = parent->getDrawListIndex(*window);
 
-    // reinsert ourselves at the right location
-    getParent()->d_drawList.insert(i, this);
-
-    // handle event notifications for affected windows.
-    onZChange_impl();
+    // the target shifts down by one when we are taken from below it
+    parent->moveInDrawList(from, from < target ? target - 1 : target);
 }
 
 //----------------------------------------------------------------------------//
@@ -1014,14 +1324,21 @@ void Window::setAlwaysOnTop(bool setting)
     {
         if (d_zOrderingEnabled)
         {
-            // remove us from our parent's draw list
-            getParent()->removeWindowFromDrawList(*this);
-            // re-attach ourselves to our parent's draw list which will move us
-            // in behind sibling windows with the same 'always-on-top' setting
-            // as we have.
-            getParent()->addWindowToDrawList(*this, true);
-            // notify relevant windows about the z-order change.
-            onZChange_impl();
+            // move us to the boundary of the groups, behind sibling windows
+            // with the same 'always-on-top' setting as we now have.
+            Window* const parent = getParent();
+            const size_t from = parent->getDrawListIndex(*this);
+
+            if (d_alwaysOnTop)
+            {
+                parent->moveInDrawList(from, parent->d_drawListTopmostBegin - 1);
+                --parent->d_drawListTopmostBegin;
+            }
+            else
+            {
+                parent->moveInDrawList(from, 0);
+                ++parent->d_drawListTopmostBegin;
+            }
         }
     }
 
@@ -1149,50 +1466,130 @@ void Window::invalidate_impl(const bool recursive)
     d_needsRedraw = true;
     invalidateRenderingSurface();
 
-    WindowEventArgs args(this);
-    onInvalidated(args);
+    WindowEventArgs args(this);
+    onInvalidated(args);
+
+    if (recursive)
+    {
+        for (Element* child : d_children)
+            static_cast<Window*>(child)->invalidate_impl(true);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void Window::draw(std::uint32_t drawModeMask)
+{
+    // don't do anything if window is not visible
+    if (!isEffectiveVisible())
+    {
+        d_drawnSurfaceArea = Rectf(0, 0, 0, 0);
+        return;
+    }
+
+    // the texture cache was evicted while not drawn, it is needed again now
+    if (d_autoRenderingWindowEvicted)
+        allocateRenderingWindow(d_autoRenderingSurfaceStencilEnabled);
+
+    // get rendering context
+    RenderingContext ctx;
+    getRenderingContext(ctx);
+
+    // remember where we end up, so this area is redrawn when we move away
+    if (d_parent)
+    {
+        RenderingContext parentCtx;
+        getParent()->getRenderingContext(parentCtx);
+        d_drawnSurfaceArea = getSurfaceArea(parentCtx);
+    }
+
+    // clear geometry from surface if it's ours
+    if (ctx.owner == this)
+        ctx.surface->clearGeometry();
+
+    const bool allowDrawing = checkIfDrawMaskAllowsDrawing(drawModeMask);
+
+    // redraw if no surface set, or if surface is invalidated
+    if (!d_surface || d_surface->isInvalidated())
+    {
+        // a static group queues the merged geometry of the whole subtree
+        if (!d_staticGroup || !d_staticGroup->draw(ctx, drawModeMask))
+        {
+            FrameStats* const stats = FrameStats::getActive();
+
+            // nothing is generated or queued for a window clipped away
+            if (allowDrawing)
+            {
+                if (!isDrawCulled())
+                    drawSelf(ctx, drawModeMask);
+                else if (stats)
+                    ++stats->d_windowsCulled;
+            }
+
+            // render any child windows, skipping subtrees that can't be seen
+            for (auto wnd : d_drawList)
+            {
+                if (!isChildInView(*wnd))
+                    continue;
+
+                if (!wnd->isSubtreeCulled())
+                    wnd->draw(drawModeMask);
+                else if (stats)
+                    ++stats->d_windowsCulled;
+            }
+        }
+    }
+
+    // do final rendering for surface if it's ours
+    if (ctx.owner == this && allowDrawing)
+        ctx.surface->draw(drawModeMask);
+}
+
+//----------------------------------------------------------------------------//
+void Window::collectInvalidatedSurfaceOwners(std::vector<Window*>& roots)
+{
+    if (!isEffectiveVisible())
+        return;
+
+    // a valid surface is drawn as is, so nothing below it is regenerated
+    if (d_surface)
+    {
+        if (!d_surface->isInvalidated())
+            return;
 
-    if (recursive)
+        roots.push_back(this);
+    }
+
+    for (auto wnd : d_drawList)
     {
-        for (Element* child : d_children)
-            static_cast<Window*>(child)->invalidate_impl(true);
+        if (isChildInView(*wnd))
+            wnd->collectInvalidatedSurfaceOwners(roots);
     }
 }
 
 //----------------------------------------------------------------------------//
-void Window::draw(std::uint32_t drawModeMask)
+void Window::bufferSurfaceGeometry(std::uint32_t drawModeMask)
 {
-    // don't do anything if window is not visible
     if (!isEffectiveVisible())
         return;
 
-    // get rendering context
-    RenderingContext ctx;
-    getRenderingContext(ctx);
-
-    // clear geometry from surface if it's ours
-    if (ctx.owner == this)
-        ctx.surface->clearGeometry();
-
-    const bool allowDrawing = checkIfDrawMaskAllowsDrawing(drawModeMask);
-
-    // redraw if no surface set, or if surface is invalidated
-    if (!d_surface || d_surface->isInvalidated())
+    if (checkIfDrawMaskAllowsDrawing(drawModeMask) && !isDrawCulled())
     {
-        if (allowDrawing)
-        {
-            // perform drawing for 'this' Window
-            drawSelf(ctx, drawModeMask);
-        }
+        RenderingContext ctx;
+        getRenderingContext(ctx);
+        prepareGeometry(ctx, drawModeMask);
+    }
 
-        // render any child windows
-        for (auto wnd : d_drawList)
-            wnd->draw(drawModeMask);
+    for (auto wnd : d_drawList)
+    {
+        if (!wnd->d_surface && isChildInView(*wnd) && !wnd->isSubtreeCulled())
+            wnd->bufferSurfaceGeometry(drawModeMask);
     }
+}
 
-    // do final rendering for surface if it's ours
-    if (ctx.owner == this && allowDrawing)
-        ctx.surface->draw(drawModeMask);
+//----------------------------------------------------------------------------//
+void Window::prepareGeometry(const RenderingContext& ctx, std::uint32_t drawModeMask)
+{
+    bufferGeometry(ctx, drawModeMask);
 }
 
 //----------------------------------------------------------------------------//
@@ -1207,8 +1604,15 @@ void Window::bufferGeometry(const RenderingContext&, std::uint32_t /*drawModeMas
 {
     if (d_needsRedraw)
     {
-        // dispose of already cached geometry.
-        destroyGeometryBuffers();
+        CEGUI_PROFILE_SCOPE("Window::bufferGeometry");
+
+        if (FrameStats* stats = FrameStats::getActive())
+            ++stats->d_windowsRedrawn;
+
+        // keep geometry owned by the imagery cache, hand the rest to the
+        // pool so it can be refilled.
+        d_geometryCache.beginPass(d_geometryBuffers);
+        d_geometryBufferPool.beginPass(d_geometryBuffers);
 
         // signal rendering started
         WindowEventArgs args(this);
@@ -1217,21 +1621,48 @@ void Window::bufferGeometry(const RenderingContext&, std::uint32_t /*drawModeMas
         // HACK: ensure our rendered string content is up to date
         getRenderedString();
 
+        // imagery lying outside of the clipping region is skipped
+        d_geometryCullRect = getLocalClippingRegion();
+        d_geometryCulled = false;
+        // the clipping region is not axis aligned to rotated geometry
+        d_cullingGeometry = !d_geometryRotation;
+
         // get derived class or WindowRenderer to re-populate geometry buffer.
-        if (d_windowRenderer)
-            d_windowRenderer->createRenderGeometry();
-        else
-            populateGeometryBuffer();
+        Renderer* renderer = System::getSingleton().getRenderer();
+        GeometryBufferPool* previousPool = renderer->getActiveGeometryBufferPool();
+        renderer->setActiveGeometryBufferPool(&d_geometryBufferPool);
+        try
+        {
+            if (d_windowRenderer)
+                d_windowRenderer->createRenderGeometry();
+            else
+                populateGeometryBuffer();
+        }
+        catch (...)
+        {
+            renderer->setActiveGeometryBufferPool(previousPool);
+            d_cullingGeometry = false;
+            throw;
+        }
+        renderer->setActiveGeometryBufferPool(previousPool);
+        d_cullingGeometry = false;
+        d_geometryBufferPool.endPass(d_geometryBuffers);
 
-        // Setup newly created geometry with our settings
-        const float finalAlpha = getEffectiveAlpha();
-        for (CEGUI::GeometryBuffer* currentBuffer : d_geometryBuffers)
+        // vertex stage of the effect, the geometry was not taken from the
+        // imagery cache in that case
+        if (d_inPlaceRenderEffect && d_inPlaceRenderEffect->modifiesGeometry())
         {
-            currentBuffer->setTranslation(d_translation);
-            currentBuffer->setClippingRegion(d_clippingRegion);
-            currentBuffer->setAlpha(finalAlpha);
+            for (GeometryBuffer* buffer : d_geometryBuffers)
+                d_inPlaceRenderEffect->modifyGeometry(*this, *buffer);
         }
 
+        // Setup newly created geometry with our settings
+        updateGeometryBuffersTransform();
+
+        // such geometry may be seen even when our clipping region is empty
+        d_hasUnclippedGeometry = std::any_of(d_geometryBuffers.begin(), d_geometryBuffers.end(),
+            [](const GeometryBuffer* buffer) { return !buffer->isClippingActive(); });
+
         // signal rendering ended
         args.handled = 0;
         onRenderingEnded(args);
@@ -1239,6 +1670,41 @@ void Window::bufferGeometry(const RenderingContext&, std::uint32_t /*drawModeMas
         // mark ourselves as no longer needed a redraw.
         d_needsRedraw = false;
     }
+    else if (d_needsTransformUpdate)
+    {
+        // only moved or faded, the cached geometry itself is still valid.
+        updateGeometryBuffersTransform();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void Window::updateGeometryBuffersTransform()
+{
+    const float finalAlpha = getEffectiveAlpha();
+    for (CEGUI::GeometryBuffer* currentBuffer : d_geometryBuffers)
+    {
+        if (d_geometryRotation)
+        {
+            // the buffers rotate around a pivot relative to their translation
+            currentBuffer->setTranslation(d_translation + d_geometryRotation->d_offset);
+            currentBuffer->setRotation(d_geometryRotation->d_rotation);
+            currentBuffer->setPivot(d_geometryRotation->d_pivot - d_translation);
+        }
+        else
+        {
+            currentBuffer->setTranslation(d_translation);
+            currentBuffer->setRotation(glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+            currentBuffer->setPivot(glm::vec3(0.0f, 0.0f, 0.0f));
+        }
+        currentBuffer->setClipRegion(d_clipRegion);
+        currentBuffer->setAlpha(finalAlpha);
+
+        // parameter stage of the effect, on top of our own settings
+        if (d_inPlaceRenderEffect)
+            d_inPlaceRenderEffect->prepareGeometry(*this, *currentBuffer);
+    }
+
+    d_needsTransformUpdate = false;
 }
 
 //----------------------------------------------------------------------------//
@@ -1276,14 +1742,29 @@ void Window::addChild_impl(Element* element)
 
     NamedElement::addChild_impl(wnd);
 
+    for (Window* owner = this; owner; owner = owner->getParent())
+        if (owner->d_idIndex)
+            addToIDIndex(*owner->d_idIndex, *wnd);
+
+    // links may now resolve to the child, and the child's links to its parent
+    invalidatePropertyLinkTargets();
+    wnd->d_propertyLinkTargets.clear();
+
     // TODO: also propagate GUI context, see setGUIContext
     wnd->onTargetSurfaceChanged(getTargetRenderingSurface());
 
-    addWindowToDrawList(*wnd);
+    const size_t drawIndex = addWindowToDrawList(*wnd);
+
+    // the new child may be hit outside of our area
+    invalidateHitTestIndexEntry(true);
+
+    // the new subtree may have work pending that the update list knows nothing of
+    wnd->requestSubtreeUpdates();
 
     wnd->invalidate(true);
 
-    wnd->onZChange_impl();
+    // only the new child and the siblings now behind it changed position
+    notifyZChanged(drawIndex, d_drawList.size() - 1);
 
     // If window uses default font, handle its possible change
     // TODO: remove if GUI context will be propagated, setGUIContext will have to handle this!
@@ -1304,6 +1785,15 @@ void Window::removeChild_impl(Element* element)
 
     NamedElement::removeChild_impl(wnd);
 
+    for (Window* owner = this; owner; owner = owner->getParent())
+        if (owner->d_idIndex)
+            removeFromIDIndex(*owner->d_idIndex, *wnd);
+
+    invalidatePropertyLinkTargets();
+    wnd->d_propertyLinkTargets.clear();
+
+    invalidateHitTestIndexEntry(true);
+
     // TODO: also propagate GUI context, see setGUIContext
     wnd->onTargetSurfaceChanged(nullptr);
 
@@ -1373,6 +1863,26 @@ void Window::setID(unsigned int ID)
     if (d_ID == ID)
         return;
 
+    for (Window* ancestor = getParent(); ancestor; ancestor = ancestor->getParent())
+    {
+        if (!ancestor->d_idIndex)
+            continue;
+
+        IDIndex& index = *ancestor->d_idIndex;
+        const auto range = index.equal_range(d_ID);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == this)
+            {
+                index.erase(it);
+                break;
+            }
+        }
+
+        if (ID != 0)
+            index.emplace(ID, this);
+    }
+
     d_ID = ID;
 
     WindowEventArgs args(this);
@@ -1589,6 +2099,28 @@ void Window::addWindowProperties()
         "Value is a bitmask of 32 bit size, which will be checked against the bitmask specified for the draw call.",
         &Window::setDrawModeMask, &Window::getDrawModeMask, DrawModeFlagWindowRegular
     );
+
+    CEGUI_DEFINE_PROPERTY(Window, bool,
+        HitTestIndexEnabledPropertyName, "Property to get/set whether the Window keeps a spatial index of its "
+        "children's hit test areas, so that finding the child at a position does not scan all children. "
+        "Value is either \"true\" or \"false\".",
+        &Window::setHitTestIndexEnabled, &Window::isHitTestIndexEnabled, false
+    );
+
+    CEGUI_DEFINE_PROPERTY(Window, bool,
+        StaticGroupEnabledPropertyName, "Property to get/set whether the Window draws itself and all of its "
+        "descendants as a few combined geometry buffers, which are rebuilt whenever anything within the "
+        "subtree changes. "
+        "Value is either \"true\" or \"false\".",
+        &Window::setStaticGroupEnabled, &Window::isStaticGroupEnabled, false
+    );
+
+    CEGUI_DEFINE_PROPERTY(Window, bool,
+        RotationUsingGeometryPropertyName, "Property to get/set whether the rotation of the Window is applied "
+        "to the geometry of the Window and its descendants instead of through a RenderingWindow. "
+        "Value is either \"true\" or \"false\".",
+        &Window::setRotationUsingGeometry, &Window::isRotationUsingGeometry, false
+    );
 }
 
 //----------------------------------------------------------------------------//
@@ -1604,7 +2136,8 @@ void Window::setCursorAutoRepeatEnabled(bool setting)
         return;
 
     d_autoRepeat = setting;
-    d_repeatPointerSource = CursorInputSource::NotSpecified;
+    if (d_autoRepeatState)
+        d_autoRepeatState->d_pointerSource = CursorInputSource::NotSpecified;
 
     // FIXME: There is a potential issue here if this setting is
     // FIXME: changed _while_ the cursor is auto-repeating, and
@@ -1620,66 +2153,202 @@ void Window::setCursorAutoRepeatEnabled(bool setting)
 //----------------------------------------------------------------------------//
 void Window::setAutoRepeatDelay(float delay)
 {
-    d_repeatDelay = delay;
+    getAutoRepeatState().d_delay = delay;
 }
 
 //----------------------------------------------------------------------------//
 void Window::setAutoRepeatRate(float rate)
 {
-    d_repeatRate = rate;
+    getAutoRepeatState().d_rate = rate;
+}
+
+//----------------------------------------------------------------------------//
+Window::AutoRepeatState& Window::getAutoRepeatState()
+{
+    if (!d_autoRepeatState)
+        d_autoRepeatState.reset(new AutoRepeatState());
+
+    return *d_autoRepeatState;
+}
+
+//----------------------------------------------------------------------------//
+bool Window::isAutoRepeatTracking() const
+{
+    return d_autoRepeat && d_autoRepeatState &&
+        d_autoRepeatState->d_pointerSource != CursorInputSource::NotSpecified;
 }
 
 //----------------------------------------------------------------------------//
 void Window::update(float elapsed)
 {
+    CEGUI_PROFILE_SCOPE("Window::update");
+
     // perform update for 'this' Window
+    update_impl(elapsed);
+
+    // update child windows
+    for (size_t i = 0; i < getChildCount(); ++i)
+    {
+        Window* const child = getChildAtIndex(i);
+
+        // update children based on their WindowUpdateMode setting.
+        if (child->d_updateMode == WindowUpdateMode::Always ||
+                (child->d_updateMode == WindowUpdateMode::Visible &&
+                 child->isVisible() && isChildInView(*child)))
+        {
+            child->update(elapsed);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void Window::updateWithoutChildren(float elapsed)
+{
+    update_impl(elapsed);
+}
+
+//----------------------------------------------------------------------------//
+void Window::update_impl(float elapsed)
+{
+    if (s_updatingContext)
+    {
+        // already updated by this pulse as part of another update list entry
+        if (d_updatePulse == s_updatePulse)
+            return;
+
+        d_updatePulse = s_updatePulse;
+    }
+
+    if (FrameStats* stats = FrameStats::getActive())
+        ++stats->d_windowsUpdated;
+
     updateSelf(elapsed);
 
     // update underlying RenderingWindow if needed
     if (d_surface && d_surface->isRenderingWindow())
         static_cast<RenderingWindow*>(d_surface)->update(elapsed);
 
+    if (d_inPlaceRenderEffect)
+    {
+        switch (d_inPlaceRenderEffect->update(elapsed, *this))
+        {
+        case InPlaceRenderEffect::Change::Geometry:
+            invalidate();
+            break;
+
+        case InPlaceRenderEffect::Change::Parameters:
+            // only the parameter stage runs again on the cached geometry
+            d_needsTransformUpdate = true;
+            invalidateRenderingSurface();
+            if (GUIContext* context = getGUIContextPtr())
+                context->markAsDirty();
+            break;
+
+        default:
+            break;
+        }
+    }
+
     UpdateEventArgs e(this,elapsed);
     fireEvent(EventUpdated,e,EventNamespace);
 
-    // update child windows
-    for (size_t i = 0; i < getChildCount(); ++i)
+    // stay on the update list while there is work left
+    if (s_updatingContext && isUpdateRequired())
+        s_updatingContext->requestWindowUpdate(*this, false);
+}
+
+//----------------------------------------------------------------------------//
+bool Window::isUpdateRequired() const
+{
+    if (isAutoRepeatTracking())
+        return true;
+
+    if (d_surface && d_surface->isRenderingWindow() &&
+        static_cast<RenderingWindow*>(d_surface)->getRenderEffect())
+        return true;
+
+    if (d_inPlaceRenderEffect)
+        return true;
+
+    if (isEventPresent(EventUpdated))
+        return true;
+
+    return d_windowRenderer && d_windowRenderer->isUpdateRequired();
+}
+
+//----------------------------------------------------------------------------//
+void Window::setInPlaceRenderEffect(InPlaceRenderEffect* effect)
+{
+    if (d_inPlaceRenderEffect == effect)
+        return;
+
+    // cached imagery may carry the vertices or parameters of the old effect
+    if (d_inPlaceRenderEffect)
     {
-        // update children based on their WindowUpdateMode setting.
-        if (getChildAtIndex(i)->d_updateMode == WindowUpdateMode::Always ||
-                (getChildAtIndex(i)->d_updateMode == WindowUpdateMode::Visible &&
-                 getChildAtIndex(i)->isVisible()))
-        {
-            getChildAtIndex(i)->update(elapsed);
-        }
+        d_geometryCache.detach(d_geometryBuffers);
+        d_geometryCache.clear();
     }
+
+    d_inPlaceRenderEffect = effect;
+
+    invalidate();
+    if (effect)
+        requestUpdates();
+}
+
+//----------------------------------------------------------------------------//
+void Window::requestUpdates()
+{
+    if (GUIContext* context = getGUIContextPtr())
+        context->requestWindowUpdate(*this, false);
+}
+
+//----------------------------------------------------------------------------//
+void Window::requestSubtreeUpdates()
+{
+    if (GUIContext* context = getGUIContextPtr())
+        context->requestWindowUpdate(*this, true);
+}
+
+//----------------------------------------------------------------------------//
+void Window::notifyEventAdded(const Event& event)
+{
+    if (event.getName() == EventUpdated)
+        requestUpdates();
+}
+
+//----------------------------------------------------------------------------//
+bool Window::isChildInView(const Window&) const
+{
+    return true;
 }
 
 //----------------------------------------------------------------------------//
 void Window::updateSelf(float elapsed)
 {
     // cursor autorepeat processing.
-    if (d_autoRepeat && d_repeatPointerSource != CursorInputSource::NotSpecified)
+    if (isAutoRepeatTracking())
     {
-        d_repeatElapsed += elapsed;
+        AutoRepeatState& repeat = *d_autoRepeatState;
+        repeat.d_elapsed += elapsed;
 
-        if (d_repeating)
+        if (repeat.d_repeating)
         {
-            if (d_repeatElapsed > d_repeatRate)
+            if (repeat.d_elapsed > repeat.d_rate)
             {
-                d_repeatElapsed -= d_repeatRate;
+                repeat.d_elapsed -= repeat.d_rate;
                 // trigger the repeated event
-                generateAutoRepeatEvent(d_repeatPointerSource);
+                generateAutoRepeatEvent(repeat.d_pointerSource);
             }
         }
         else
         {
-            if (d_repeatElapsed > d_repeatDelay)
+            if (repeat.d_elapsed > repeat.d_delay)
             {
-                d_repeatElapsed = 0;
-                d_repeating = true;
+                repeat.d_elapsed = 0;
+                repeat.d_repeating = true;
                 // trigger the repeated event
-                generateAutoRepeatEvent(d_repeatPointerSource);
+                generateAutoRepeatEvent(repeat.d_pointerSource);
             }
         }
     }
@@ -1801,7 +2470,7 @@ void Window::destroy()
     setTooltip(nullptr);
 
     // clean up looknfeel related things
-    if (!d_lookName.empty())
+    if (!d_lookName.getString().empty())
     {
         d_windowRenderer->onLookNFeelUnassigned();
         WidgetLookManager::getSingleton().getWidgetLook(d_lookName).
@@ -1823,11 +2492,47 @@ void Window::destroy()
     invalidate();
 }
 
+//----------------------------------------------------------------------------//
+void Window::recycle()
+{
+    if (d_parent)
+        d_parent->removeChild(this);
+
+    releaseInput();
+
+    // let go of the tooltip if we have it
+    Tooltip* const tip = getTooltip();
+    if (tip && tip->getTargetWindow()==this)
+        tip->setTargetWindow(nullptr);
+
+    setTooltip(nullptr);
+
+    // auto windows belong to the look and are kept, anything else goes
+    for (std::size_t i = 0; i < getChildCount(); )
+    {
+        Window* wnd = getChildAtIndex(i);
+        if (wnd->isAutoWindow())
+        {
+            ++i;
+            continue;
+        }
+
+        removeChild(wnd);
+        if (wnd->isDestroyedByParent())
+            WindowManager::getSingleton().destroyWindow(wnd);
+    }
+
+    invalidate();
+
+    WindowEventArgs args(this);
+    onRecycled(args);
+}
+
 //----------------------------------------------------------------------------//
 Tooltip* Window::getTooltip() const
 {
     if (!isUsingDefaultTooltip())
-        return d_customTip;
+        return d_tooltipData->d_customTip;
 
     GUIContext* context = getGUIContextPtr();
     return context ? context->getDefaultTooltipObject(): nullptr;
@@ -1836,41 +2541,51 @@ Tooltip* Window::getTooltip() const
 //----------------------------------------------------------------------------//
 void Window::setTooltip(Tooltip* tooltip)
 {
+    if (!tooltip && !d_tooltipData)
+        return;
+
+    TooltipData& data = getTooltipData();
+
     // destroy current custom tooltip if one exists and we created it
-    if (d_customTip && d_weOwnTip)
-        WindowManager::getSingleton().destroyWindow(d_customTip);
+    if (data.d_customTip && data.d_weOwnTip)
+        WindowManager::getSingleton().destroyWindow(data.d_customTip);
 
     // set new custom tooltip
-    d_weOwnTip = false;
-    d_customTip = tooltip;
+    data.d_weOwnTip = false;
+    data.d_customTip = tooltip;
 }
 
 //----------------------------------------------------------------------------//
 void Window::setTooltipType(const String& tooltipType)
 {
+    if (tooltipType.empty() && !d_tooltipData)
+        return;
+
+    TooltipData& data = getTooltipData();
+
     // destroy current custom tooltip if one exists and we created it
-    if (d_customTip && d_weOwnTip)
-        WindowManager::getSingleton().destroyWindow(d_customTip);
+    if (data.d_customTip && data.d_weOwnTip)
+        WindowManager::getSingleton().destroyWindow(data.d_customTip);
 
     if (tooltipType.empty())
     {
-        d_customTip = nullptr;
-        d_weOwnTip = false;
+        data.d_customTip = nullptr;
+        data.d_weOwnTip = false;
     }
     else
     {
         try
         {
-            d_customTip = static_cast<Tooltip*>(
+            data.d_customTip = static_cast<Tooltip*>(
                 WindowManager::getSingleton().createWindow(
                     tooltipType, getName() + TooltipNameSuffix));
-            d_customTip->setAutoWindow(true);
-            d_weOwnTip = true;
+            data.d_customTip->setAutoWindow(true);
+            data.d_weOwnTip = true;
         }
         catch (UnknownObjectException&)
         {
-            d_customTip = nullptr;
-            d_weOwnTip = false;
+            data.d_customTip = nullptr;
+            data.d_weOwnTip = false;
         }
     }
 }
@@ -1878,13 +2593,16 @@ void Window::setTooltipType(const String& tooltipType)
 //----------------------------------------------------------------------------//
 String Window::getTooltipType() const
 {
-    return isUsingDefaultTooltip() ? String("") : d_customTip->getType();
+    return isUsingDefaultTooltip() ? String("") : d_tooltipData->d_customTip->getType();
 }
 
 //----------------------------------------------------------------------------//
 void Window::setTooltipText(const String& tip)
 {
-    d_tooltipText = tip;
+    if (tip.empty() && !d_tooltipData)
+        return;
+
+    getTooltipData().d_text = tip;
 
     Tooltip* const tooltip = getTooltip();
 
@@ -1892,13 +2610,30 @@ void Window::setTooltipText(const String& tip)
         tooltip->setText(tip);
 }
 
+//----------------------------------------------------------------------------//
+const String& Window::getTooltipText() const
+{
+    static const String empty;
+    return d_tooltipData ? d_tooltipData->d_text : empty;
+}
+
 //----------------------------------------------------------------------------//
 const String& Window::getTooltipTextIncludingInheritance() const
 {
-    if (d_inheritsTipText && d_parent && d_tooltipText.empty())
+    const String& text = getTooltipText();
+    if (d_inheritsTipText && d_parent && text.empty())
         return getParent()->getTooltipText();
     else
-        return d_tooltipText;
+        return text;
+}
+
+//----------------------------------------------------------------------------//
+Window::TooltipData& Window::getTooltipData()
+{
+    if (!d_tooltipData)
+        d_tooltipData.reset(new TooltipData());
+
+    return *d_tooltipData;
 }
 
 //----------------------------------------------------------------------------//
@@ -1910,7 +2645,7 @@ void Window::setInheritsTooltipText(bool setting)
 //----------------------------------------------------------------------------//
 void Window::setLookNFeel(const String& look)
 {
-    if (d_lookName == look)
+    if (d_lookName.getString() == look)
         return;
 
     if (!d_windowRenderer)
@@ -1918,23 +2653,19 @@ void Window::setLookNFeel(const String& look)
             "window renderer assigned to the window '" + d_name +
             "' to set its look'n'feel");
 
-    WidgetLookManager& wlMgr = WidgetLookManager::getSingleton();
-    if (!d_lookName.empty())
-    {
-        d_windowRenderer->onLookNFeelUnassigned();
-        wlMgr.getWidgetLook(d_lookName).cleanUpWidget(*this);
-    }
+    releaseLookNFeel();
 
-    d_lookName = look;
-    Logger::getSingleton().logEvent("Assigning LookNFeel '" + look +
-        "' to window '" + d_name + "'.", LoggingLevel::Informative);
+    d_lookName = InternedName(look);
+    CEGUI_LOG(LoggingLevel::Informative, "Assigning LookNFeel '" + look +
+        "' to window '" + d_name + "'.");
 
     // Get look and feel to initialise the widget as it needs.
     // Set init flag to prevent premature child layouting by LNF.
     const bool prevInit = d_initialising;
     d_initialising = true;
-    wlMgr.getWidgetLook(look).initialiseWidget(*this);
+    WidgetLookManager::getSingleton().getWidgetLook(look).initialiseWidget(*this);
     d_initialising = prevInit;
+    invalidatePropertyLinkTargets();
 
     // do the necessary binding to the stuff added by the look and feel
     initialiseComponents();
@@ -1945,6 +2676,25 @@ void Window::setLookNFeel(const String& look)
     invalidate();
 }
 
+//----------------------------------------------------------------------------//
+void Window::releaseLookNFeel()
+{
+    if (!d_lookName.getString().empty() && d_windowRenderer)
+    {
+        d_windowRenderer->onLookNFeelUnassigned();
+        WidgetLookManager::getSingleton().getWidgetLook(d_lookName).cleanUpWidget(*this);
+    }
+
+    // the look adds and removes properties that may be link targets
+    invalidatePropertyLinkTargets();
+
+    // cached imagery belongs to the previous look
+    d_geometryCache.detach(d_geometryBuffers);
+    d_geometryCache.clear();
+
+    d_lookName = InternedName();
+}
+
 //----------------------------------------------------------------------------//
 void Window::setModalState(bool state)
 {
@@ -1972,26 +2722,34 @@ bool Window::getModalState() const
 //----------------------------------------------------------------------------//
 const String& Window::getUserString(const String& name) const
 {
-    auto iter = d_userStrings.find(name);
-
-    if (iter == d_userStrings.end())
+    if (!isUserStringDefined(name))
         throw UnknownObjectException(
             "a user string named '" + name + "' is not defined for Window '" +
             d_name + "'.");
 
-    return (*iter).second;
+    return d_userStrings->find(name)->second;
 }
 
 //----------------------------------------------------------------------------//
 bool Window::isUserStringDefined(const String& name) const
 {
-     return d_userStrings.find(name) != d_userStrings.end();
+    return d_userStrings && d_userStrings->find(name) != d_userStrings->end();
 }
 
 //----------------------------------------------------------------------------//
 void Window::setUserString(const String& name, const String& value)
 {
-    d_userStrings[name] = value;
+    if (!d_userStrings)
+        d_userStrings.reset(new std::unordered_map<String, String>());
+
+    (*d_userStrings)[name] = value;
+}
+
+//----------------------------------------------------------------------------//
+const std::unordered_map<String, String>& Window::getUserStrings() const
+{
+    static const std::unordered_map<String, String> empty;
+    return d_userStrings ? *d_userStrings : empty;
 }
 
 //----------------------------------------------------------------------------//
@@ -2014,7 +2772,7 @@ void Window::writeXMLToStream(XMLSerializer& xml_stream) const
     writePropertiesXML(xml_stream);
     // user strings
     const String UserStringXMLElementName("UserString");
-    for (const auto& pair : d_userStrings)
+    for (const auto& pair : getUserStrings())
     {
         const String& name = pair.first;
         // ignore auto props
@@ -2106,31 +2864,27 @@ bool Window::writeAutoChildWindowXML(XMLSerializer& xml_stream) const
     if (!d_allowWriteXML)
         return false;
 
-    // we temporarily output to this string stream to see if have to do the tag
-    // at all.  Make sure this stream does UTF-8
-    std::ostringstream ss;
-    XMLSerializer xml(ss);
-    xml.openTag(AutoWindowXMLElementName);
-    // Create the XML Child Tree
-    // write out properties.
-    writePropertiesXML(xml);
-    // write out attached child windows.
-    writeChildWindowsXML(xml);
-    xml.closeTag();
-    if (xml.getTagCount() <= 1)
-        return false;
+    // write the tag and roll it back again if it turns out to be empty
+    const XMLSerializer::Checkpoint point = xml_stream.checkpoint();
+    const unsigned int tagCount = xml_stream.getTagCount();
 
     // output opening AutoWindow tag
     xml_stream.openTag(AutoWindowXMLElementName);
     // write name suffix attribute
     xml_stream.attribute(AutoWindowNamePathXMLAttributeName, getName());
-    // Inefficient : do the XML serialization again
     // write out properties.
     writePropertiesXML(xml_stream);
     // write out attached child windows.
     writeChildWindowsXML(xml_stream);
     xml_stream.closeTag();
 
+    if (xml_stream.getTagCount() - tagCount <= 1)
+    {
+        xml_stream.rollBack(point);
+        return false;
+    }
+
+    xml_stream.commit(point);
     return true;
 }
 
@@ -2141,52 +2895,87 @@ Window* Window::getChildAutoWindow(const String& name)
 }
 
 //----------------------------------------------------------------------------//
-void Window::addWindowToDrawList(Window& wnd, bool at_back)
+size_t Window::addWindowToDrawList(Window& wnd, bool at_back)
 {
-    // add behind other windows in same group
-    if (at_back)
-    {
-        // calculate position where window should be added for drawing
-        auto pos = d_drawList.begin();
-        if (wnd.isAlwaysOnTop())
-        {
-            // find first topmost window
-            while ((pos != d_drawList.end()) && (!(*pos)->isAlwaysOnTop()))
-                ++pos;
-        }
-        // add window to draw list
-        d_drawList.insert(pos, &wnd);
-    }
-    // add in front of other windows in group
+    // 'always on top' windows follow all others, so the position of either
+    // group's front and back is known without searching
+    size_t index;
+    if (wnd.isAlwaysOnTop())
+        index = at_back ? d_drawListTopmostBegin : d_drawList.size();
     else
-    {
-        // calculate position where window should be added for drawing
-        auto position = d_drawList.rbegin();
-        if (!wnd.isAlwaysOnTop())
-        {
-            // find last non-topmost window
-            while ((position != d_drawList.rend()) && ((*position)->isAlwaysOnTop()))
-                ++position;
-        }
-        // add window to draw list
-        d_drawList.insert(position.base(), &wnd);
-    }
+        index = at_back ? 0 : d_drawListTopmostBegin++;
+
+    d_drawList.insert(d_drawList.begin() + index, &wnd);
+
+    if (d_hitTestIndex)
+        d_hitTestIndex->invalidate();
+    invalidateStaticGroups();
+
+    return index;
 }
 
 //----------------------------------------------------------------------------//
 void Window::removeWindowFromDrawList(const Window& wnd)
 {
-    // if draw list is not empty
-    if (!d_drawList.empty())
+    // attempt to find the window in the draw list
+    const auto position = std::find(d_drawList.begin(), d_drawList.end(), &wnd);
+
+    // remove the window if it was found in the draw list
+    if (position != d_drawList.end())
     {
-        // attempt to find the window in the draw list
-        const auto position =
-            std::find(d_drawList.begin(), d_drawList.end(), &wnd);
+        if (static_cast<size_t>(position - d_drawList.begin()) < d_drawListTopmostBegin)
+            --d_drawListTopmostBegin;
+
+        d_drawList.erase(position);
+    }
+
+    if (d_hitTestIndex)
+        d_hitTestIndex->invalidate();
+    invalidateStaticGroups();
+}
+
+//----------------------------------------------------------------------------//
+size_t Window::getDrawListIndex(const Window& wnd) const
+{
+    const auto position = std::find(d_drawList.begin(), d_drawList.end(), &wnd);
+    // sanity check that the window is attached to us.
+    assert(position != d_drawList.end());
+
+    return position - d_drawList.begin();
+}
+
+//----------------------------------------------------------------------------//
+void Window::moveInDrawList(size_t from, size_t to)
+{
+    if (from == to)
+        return;
+
+    const auto begin = d_drawList.begin();
+    if (from < to)
+        std::rotate(begin + from, begin + from + 1, begin + to + 1);
+    else
+        std::rotate(begin + to, begin + from, begin + from + 1);
+
+    if (d_hitTestIndex)
+        d_hitTestIndex->invalidate();
+    invalidateStaticGroups();
+
+    // handle event notifications for affected windows.
+    notifyZChanged(std::min(from, to), std::max(from, to));
+}
 
-        // remove the window if it was found in the draw list
-        if (position != d_drawList.end())
-            d_drawList.erase(position);
+//----------------------------------------------------------------------------//
+void Window::notifyZChanged(size_t first, size_t last)
+{
+    // handlers may remove children, so check the bounds on every step
+    for (size_t i = first; i <= last && i < d_drawList.size(); ++i)
+    {
+        WindowEventArgs args(d_drawList[i]);
+        d_drawList[i]->onZChanged(args);
     }
+
+    if (GUIContext* context = getGUIContextPtr())
+        context->updateWindowContainingCursor();
 }
 
 //----------------------------------------------------------------------------//
@@ -2225,12 +3014,13 @@ void Window::onMoved(ElementEventArgs& e)
     // handle invalidation of surfaces and trigger needed redraws
     if (d_parent)
     {
-        getParent()->invalidateRenderingSurface();
-        // need to redraw some geometry if parent uses a caching surface
+        invalidateSurfaceArea(true);
+        // need to redraw some geometry if parent uses a caching surface, or
+        // if windows that were culled may have come into view
         if (auto ctx = getGUIContextPtr())
         {
             CEGUI::RenderingSurface* rs = getParent()->getTargetRenderingSurface();
-            if (rs && rs->isRenderingWindow())
+            if ((rs && rs->isRenderingWindow()) || ctx->getFrameStats().d_windowsCulled != 0)
                 ctx->markAsDirty();
         }
     }
@@ -2240,7 +3030,7 @@ void Window::onMoved(ElementEventArgs& e)
 void Window::onTextChanged(WindowEventArgs& e)
 {
     invalidate();
-    fireEvent(EventTextChanged, e, EventNamespace);
+    fireCoalescedEvent(EventTextChanged, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -2271,16 +3061,15 @@ void Window::onAlphaChanged(WindowEventArgs& e)
 
     }
 
-    const float finalAlpha = getEffectiveAlpha();
-    for (CEGUI::GeometryBuffer* currentBuffer : d_geometryBuffers)
-        currentBuffer->setAlpha(finalAlpha);
+    // the new alpha is applied to our cached geometry when it is next drawn
+    d_needsTransformUpdate = true;
 
     invalidateRenderingSurface();
 
     if (GUIContext* context = getGUIContextPtr())
         context->markAsDirty();
 
-    fireEvent(EventAlphaChanged, e, EventNamespace);
+    fireCoalescedEvent(EventAlphaChanged, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -2293,6 +3082,8 @@ void Window::onIDChanged(WindowEventArgs& e)
 void Window::onShown(WindowEventArgs& e)
 {
     invalidate();
+    // the subtree was skipped by selective updates while hidden
+    requestSubtreeUpdates();
     fireEvent(EventShown, e, EventNamespace);
 }
 
@@ -2362,7 +3153,8 @@ void Window::onParentDestroyChanged(WindowEventArgs& e)
 //----------------------------------------------------------------------------//
 void Window::onInheritsAlphaChanged(WindowEventArgs& e)
 {
-    invalidate();
+    // no need to regenerate geometry: a resulting change of the effective
+    // alpha is handled by onAlphaChanged, which setInheritsAlpha calls.
     fireEvent(EventInheritsAlphaChanged, e, EventNamespace);
 }
 
@@ -2387,7 +3179,8 @@ void Window::onCaptureGained(WindowEventArgs& e)
 void Window::onCaptureLost(WindowEventArgs& e)
 {
     // reset auto-repeat state
-    d_repeatPointerSource = CursorInputSource::NotSpecified;
+    if (d_autoRepeatState)
+        d_autoRepeatState->d_pointerSource = CursorInputSource::NotSpecified;
 
     // handle restore of previous capture window as required.
     if (d_restoreOldCapture && d_oldCapture)
@@ -2411,7 +3204,7 @@ void Window::onCaptureLost(WindowEventArgs& e)
 //----------------------------------------------------------------------------//
 void Window::onInvalidated(WindowEventArgs& e)
 {
-    fireEvent(EventInvalidated, e, EventNamespace);
+    fireCoalescedEvent(EventInvalidated, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -2445,11 +3238,19 @@ void Window::onDestructionStarted(WindowEventArgs& e)
     fireEvent(EventDestructionStarted, e, EventNamespace);
 }
 
+//----------------------------------------------------------------------------//
+void Window::onRecycled(WindowEventArgs& e)
+{
+    fireEvent(EventRecycled, e, EventNamespace);
+}
+
 //----------------------------------------------------------------------------//
 void Window::onActivated(ActivationEventArgs& e)
 {
     d_active = true;
     invalidate();
+    // a WindowRenderer may animate the active state, e.g. a blinking caret
+    requestUpdates();
 
     // activate all ancestors
     auto ancestor = getParent();
@@ -2512,6 +3313,15 @@ void Window::onChildRemoved(ElementEventArgs& e)
     Element::onChildRemoved(e);
 }
 
+//----------------------------------------------------------------------------//
+void Window::onNameChanged(NamedElementEventArgs& e)
+{
+    // links of our ancestors may refer to us by name path
+    invalidatePropertyLinkTargets();
+
+    NamedElement::onNameChanged(e);
+}
+
 //----------------------------------------------------------------------------//
 void Window::onCursorEntersArea(CursorInputEventArgs& e)
 {
@@ -2614,14 +3424,16 @@ void Window::onCursorPressHold(CursorInputEventArgs& e)
     // it could be us that generated this event via auto-repeat).
     if (d_autoRepeat)
     {
-        if (d_repeatPointerSource == CursorInputSource::NotSpecified)
+        AutoRepeatState& repeat = getAutoRepeatState();
+        if (repeat.d_pointerSource == CursorInputSource::NotSpecified)
             captureInput();
 
-        if ((d_repeatPointerSource != e.source) && isCapturedByThis())
+        if ((repeat.d_pointerSource != e.source) && isCapturedByThis())
         {
-            d_repeatPointerSource = e.source;
-            d_repeatElapsed = 0.f;
-            d_repeating = false;
+            repeat.d_pointerSource = e.source;
+            repeat.d_elapsed = 0.f;
+            repeat.d_repeating = false;
+            requestUpdates();
         }
     }
 
@@ -2691,10 +3503,10 @@ void Window::onCursorActivate(CursorInputEventArgs& e)
         tip->setTargetWindow(this);
 
     // reset auto-repeat state
-    if (d_autoRepeat && d_repeatPointerSource != CursorInputSource::NotSpecified)
+    if (isAutoRepeatTracking())
     {
         releaseInput();
-        d_repeatPointerSource = CursorInputSource::NotSpecified;
+        d_autoRepeatState->d_pointerSource = CursorInputSource::NotSpecified;
     }
 
     fireEvent(EventCursorActivate, e, EventNamespace);
@@ -2785,11 +3597,14 @@ void Window::setWindowRenderer(const String& name)
 
     if (!name.empty())
     {
-        Logger::getSingleton().logEvent("Assigning the window renderer '" +
-            name + "' to the window '" + d_name + "'", LoggingLevel::Informative);
+        CEGUI_LOG(LoggingLevel::Informative, "Assigning the window renderer '" +
+            name + "' to the window '" + d_name + "'");
         d_windowRenderer = wrm.createWindowRenderer(name);
         WindowEventArgs e(this);
         onWindowRendererAttached(e);
+        // the renderer's properties may be link targets
+        invalidatePropertyLinkTargets();
+        requestUpdates();
     }
     else
         throw InvalidRequestException(
@@ -2849,7 +3664,10 @@ void Window::banPropertyFromXML(const String& property_name)
     }
 
     // check if the insertion failed
-    if (!d_bannedXMLProperties.insert(property_name).second)
+    if (!d_bannedXMLProperties)
+        d_bannedXMLProperties.reset(new std::unordered_set<String>());
+
+    if (!d_bannedXMLProperties->insert(property_name).second)
         // just log the incidence
         CEGUI_LOGINSANE("Window::banPropertyFromXML: The property '" +
             property_name + "' is already banned in window '" + d_name + "'");
@@ -2870,7 +3688,8 @@ void Window::banPropertyFromXMLRecursive(const String& property_name)
 //----------------------------------------------------------------------------//
 void Window::unbanPropertyFromXML(const String& property_name)
 {
-    d_bannedXMLProperties.erase(property_name);
+    if (d_bannedXMLProperties)
+        d_bannedXMLProperties->erase(property_name);
 }
 
 //----------------------------------------------------------------------------//
@@ -2886,13 +3705,68 @@ void Window::unbanPropertyFromXMLRecursive(const String& property_name)
 }
 
 //----------------------------------------------------------------------------//
-bool Window::isPropertyBannedFromXML(const String& property_name) const
+namespace
+{
+//! Runs \a apply with the layout of \a context deferred, recomputing it once after.
+template <typename TApply>
+void applyWithLayoutDeferred(GUIContext* context, TApply apply)
+{
+    if (!context || context->isLayoutDeferred())
+    {
+        apply();
+        return;
+    }
+
+    context->setLayoutDeferred(true);
+    try
+    {
+        apply();
+    }
+    catch (...)
+    {
+        context->setLayoutDeferred(false);
+        throw;
+    }
+    context->setLayoutDeferred(false);
+}
+}
+
+//----------------------------------------------------------------------------//
+void Window::setProperties(const PropertyValueList& values)
+{
+    applyWithLayoutDeferred(getGUIContextPtr(),
+        [this, &values]() { PropertySet::setProperties(values); });
+}
+
+//----------------------------------------------------------------------------//
+void Window::applyPropertyChanges(const std::vector<PropertyChange>& changes)
 {
-    const auto it = d_bannedXMLProperties.find(property_name);
+    applyWithLayoutDeferred(getGUIContextPtr(), [this, &changes]()
+    {
+        const String* path = nullptr;
+        Window* target = nullptr;
+
+        for (const auto& change : changes)
+        {
+            if (!path || change.d_windowPath != *path)
+            {
+                target = change.d_windowPath.empty() ?
+                    this : getChild(change.d_windowPath);
+                path = &change.d_windowPath;
+            }
+
+            target->setProperty(change.d_propertyName, change.d_value);
+        }
+    });
+}
 
+//----------------------------------------------------------------------------//
+bool Window::isPropertyBannedFromXML(const String& property_name) const
+{
     // generally, there will always less banned properties than all properties,
     // so it makes sense to check that first before querying the property instance
-    if (it != d_bannedXMLProperties.end())
+    if (d_bannedXMLProperties &&
+        d_bannedXMLProperties->find(property_name) != d_bannedXMLProperties->end())
     {
         return true;
     }
@@ -2920,6 +3794,28 @@ void Window::unbanPropertyFromXML(const Property* property)
         unbanPropertyFromXML(property->getName());
 }
 
+//----------------------------------------------------------------------------//
+std::shared_ptr<const Window::PropertyLinkTargetList> Window::getPropertyLinkTargets(
+    const Property* link) const
+{
+    const auto it = d_propertyLinkTargets.find(link);
+    return it != d_propertyLinkTargets.end() ? it->second : nullptr;
+}
+
+//----------------------------------------------------------------------------//
+void Window::setPropertyLinkTargets(const Property* link,
+    std::shared_ptr<const PropertyLinkTargetList> targets) const
+{
+    d_propertyLinkTargets[link] = std::move(targets);
+}
+
+//----------------------------------------------------------------------------//
+void Window::invalidatePropertyLinkTargets()
+{
+    for (Window* wnd = this; wnd; wnd = wnd->getParent())
+        wnd->d_propertyLinkTargets.clear();
+}
+
 //----------------------------------------------------------------------------//
 bool Window::isPropertyBannedFromXML(const Property* property) const
 {
@@ -2933,7 +3829,7 @@ bool Window::isPropertyBannedFromXML(const Property* property) const
 bool Window::isPropertyAtDefault(const Property* property) const
 {
     // if we have a looknfeel we examine it for defaults
-    if (!d_lookName.empty())
+    if (!d_lookName.getString().empty())
     {
         if (d_parent && !getParent()->getLookNFeel().empty())
         {
@@ -2958,7 +3854,7 @@ bool Window::isPropertyAtDefault(const Property* property) const
                     const PropertyInitialiser* const propInitialiser = widgetComp.findPropertyInitialiser(property->getName());
 
                     if (propInitialiser)
-                        return (getProperty(property->getName()) == propInitialiser->getInitialiserValue());
+                        return (property->get(this) == propInitialiser->getInitialiserValue());
                 }
             }
         }
@@ -2970,8 +3866,7 @@ bool Window::isPropertyAtDefault(const Property* property) const
         const PropertyInitialiser* const propinit =
             wlf.findPropertyInitialiser(property->getName());
         if (propinit)
-            return (getProperty(property->getName()) ==
-                    propinit->getInitialiserValue());
+            return (property->get(this) == propinit->getInitialiserValue());
     }
 
     // we don't have a looknfeel with a new value for this property so we rely
@@ -2982,14 +3877,9 @@ bool Window::isPropertyAtDefault(const Property* property) const
 //----------------------------------------------------------------------------//
 void Window::notifyClippingChanged()
 {
-    d_outerRectClipperValid = false;
-    d_innerRectClipperValid = false;
-    d_hitTestRectValid = false;
-
-    // inform children that their clipped screen areas must be updated
-    for (Element* child : d_children)
-        if (static_cast<Window*>(child)->isClippedByParent())
-            static_cast<Window*>(child)->notifyClippingChanged();
+    // children clipped by us see the new generation through getClippingGeneration
+    d_clippingGeneration = ++s_clippingGeneration;
+    invalidateHitTestIndexEntry(false);
 }
 
 //----------------------------------------------------------------------------//
@@ -3006,6 +3896,13 @@ void Window::notifyDefaultFontChanged()
         static_cast<Window*>(child)->notifyDefaultFontChanged();
 }
 
+//----------------------------------------------------------------------------//
+bool Window::isScreenAreaChangeDeferred() const
+{
+    const GUIContext* context = getGUIContextPtr();
+    return context && context->isLayoutDeferred();
+}
+
 //----------------------------------------------------------------------------//
 uint8_t Window::handleAreaChanges(bool moved, bool sized)
 {
@@ -3015,12 +3912,8 @@ uint8_t Window::handleAreaChanges(bool moved, bool sized)
         d_unclippedInnerRect.invalidateCache();
 
     // Either our position, size or parent clip rects changed.
-    // In any case we need to recalculate our clipping rects.
-    d_outerRectClipperValid = false;
-    d_innerRectClipperValid = false;
-
-    // Always invalidate hit rect because we can't guess how it is calculated
-    d_hitTestRectValid = false;
+    // In any case we need to recalculate our clipping and hit test rects.
+    notifyClippingChanged();
     if (GUIContext* context = getGUIContextPtr())
         context->updateWindowContainingCursor();
 
@@ -3122,7 +4015,7 @@ void Window::performChildLayout(bool client, bool nonClient)
     bool changed = false;
 
     // Layout child widgets with LNF
-    if (!d_lookName.empty())
+    if (!d_lookName.getString().empty())
     {
         try
         {
@@ -3132,7 +4025,7 @@ void Window::performChildLayout(bool client, bool nonClient)
         {
             Logger::getSingleton().logEvent(
                 "Window::performChildLayout: "
-                "WidgetLook '" + d_lookName + "' was not found.", LoggingLevel::Error);
+                "WidgetLook '" + d_lookName.getString() + "' was not found.", LoggingLevel::Error);
         }
     }
 
@@ -3144,8 +4037,7 @@ void Window::performChildLayout(bool client, bool nonClient)
     if (changed)
     {
         d_unclippedInnerRect.invalidateCache();
-        d_innerRectClipperValid = false;
-        d_hitTestRectValid = false;
+        notifyClippingChanged();
 
         // Relayout client children if an inner rect size has changed
         if (!client)
@@ -3176,16 +4068,17 @@ void Window::setFalagardType(const String& type, const String& rendererType)
 
     // Check if old one is the same. If so, ignore since we don't need to do
     // anything (type is already assigned)
-    pos = d_falagardType.find(separator);
-    String oldLook(d_falagardType, 0, pos);
+    const String& falagardType = d_falagardType.getString();
+    pos = falagardType.find(separator);
+    String oldLook(falagardType, 0, pos);
     if(oldLook == newLook)
         return;
 
     // Obtain widget kind
-    String widget(d_falagardType, pos + 1);
+    String widget(falagardType, pos + 1);
 
     // Build new type (look/widget)
-    d_falagardType = newLook + separator + widget;
+    d_falagardType = InternedName(newLook + separator + widget);
 
     // Set new renderer
     if(rendererType.length() > 0)
@@ -3203,16 +4096,12 @@ bool Window::isTopOfZOrder() const
         return true;
 
     // get position of window at top of z-order in same group as this window
-    auto pos = getParent()->d_drawList.rbegin();
-    if (!d_alwaysOnTop)
-    {
-        // find last non-topmost window
-        while ((pos != getParent()->d_drawList.rend()) && (*pos)->isAlwaysOnTop())
-            ++pos;
-    }
+    const Window* const parent = getParent();
+    const size_t end = d_alwaysOnTop ? parent->d_drawList.size() :
+                                       parent->d_drawListTopmostBegin;
 
     // return whether the window at the top of the z order is us
-    return *pos == this;
+    return end > 0 && parent->d_drawList[end - 1] == this;
 }
 
 //----------------------------------------------------------------------------//
@@ -3229,6 +4118,35 @@ void Window::insertText(const String& text, const String::size_type position)
     onTextChanged(args);
 }
 
+//----------------------------------------------------------------------------//
+void Window::eraseText(const String::size_type position, const String::size_type length)
+{
+    d_textLogical.erase(position, length);
+    d_renderedStringValid = false;
+
+#ifdef CEGUI_BIDI_SUPPORT
+    d_bidiDataValid = false;
+#endif
+
+    WindowEventArgs args(this);
+    onTextChanged(args);
+}
+
+//----------------------------------------------------------------------------//
+void Window::replaceText(const String::size_type position,
+                         const String::size_type length, const String& text)
+{
+    d_textLogical.replace(position, length, text);
+    d_renderedStringValid = false;
+
+#ifdef CEGUI_BIDI_SUPPORT
+    d_bidiDataValid = false;
+#endif
+
+    WindowEventArgs args(this);
+    onTextChanged(args);
+}
+
 //----------------------------------------------------------------------------//
 void Window::appendText(const String& text)
 {
@@ -3244,7 +4162,7 @@ void Window::appendText(const String& text)
 }
 
 //----------------------------------------------------------------------------//
-void Window::appendGeometryBuffers(std::vector<GeometryBuffer*>& geomBuffers)
+void Window::appendGeometryBuffers(const std::vector<GeometryBuffer*>& geomBuffers)
 {
     d_geometryBuffers.insert(d_geometryBuffers.end(), geomBuffers.begin(),
         geomBuffers.end());
@@ -3304,6 +4222,9 @@ void Window::setRenderingSurface(RenderingSurface* surface)
 
     d_surface = surface;
 
+    // positions are unprojected for the children of a RenderingWindow
+    invalidateHitTestIndexEntry(true);
+
     // transfer child surfaces to this new surface
     if (d_surface)
     {
@@ -3315,12 +4236,65 @@ void Window::setRenderingSurface(RenderingSurface* surface)
 //----------------------------------------------------------------------------//
 void Window::invalidateRenderingSurface()
 {
+    invalidateStaticGroups();
+
     // invalidate our surface chain if we have one
     if (d_surface)
         d_surface->invalidate();
-    // else look through the hierarchy for a surface chain to invalidate.
-    else if (d_parent)
-        getParent()->invalidateRenderingSurface();
+    // else only the part of the surface chain we draw to is affected.
+    else
+        invalidateSurfaceArea(false);
+}
+
+//----------------------------------------------------------------------------//
+Rectf Window::getSurfaceArea(const RenderingContext& parentCtx) const
+{
+    Rectf area(getOuterRectClipper());
+    if (area.getWidth() != 0.0f && area.getHeight() != 0.0f)
+        area.offset(-parentCtx.offset);
+
+    return area;
+}
+
+//----------------------------------------------------------------------------//
+void Window::invalidateSurfaceArea(bool includeChildren)
+{
+    if (!d_parent)
+        return;
+
+    RenderingContext parentCtx;
+    getParent()->getRenderingContext(parentCtx);
+
+    // nothing is drawn while we are not attached to a GUIContext
+    if (!parentCtx.surface)
+        return;
+
+    if (parentCtx.surface->isRenderingWindow())
+    {
+        invalidateSurfaceArea_impl(*static_cast<RenderingWindow*>(parentCtx.surface),
+                                   parentCtx, includeChildren);
+    }
+    // surfaces that are not owned by the GUIContext cannot be partially invalidated
+    else if (parentCtx.owner)
+    {
+        parentCtx.surface->invalidate();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void Window::invalidateSurfaceArea_impl(RenderingWindow& surface,
+                                        const RenderingContext& parentCtx,
+                                        bool includeChildren)
+{
+    surface.invalidateArea(d_drawnSurfaceArea);
+    surface.invalidateArea(getSurfaceArea(parentCtx));
+
+    // descendants with a surface of their own are covered by our area
+    if (!includeChildren || d_surface)
+        return;
+
+    for (Element* child : d_children)
+        static_cast<Window*>(child)->invalidateSurfaceArea_impl(surface, parentCtx, true);
 }
 
 //----------------------------------------------------------------------------//
@@ -3347,6 +4321,7 @@ void Window::setUsingAutoRenderingSurface(bool setting)
     {
         releaseRenderingWindow();
         d_autoRenderingWindow = false;
+        d_autoRenderingWindowEvicted = false;
     }
 
     // while the actual area on screen may not have changed, the arrangement of
@@ -3377,6 +4352,7 @@ void Window::allocateRenderingWindow(bool addStencilBuffer)
         return;
 
     d_autoRenderingWindow = true;
+    d_autoRenderingWindowEvicted = false;
 
     CEGUI::RenderingSurface* rs = getTargetRenderingSurface();
     if (!rs)
@@ -3385,8 +4361,9 @@ void Window::allocateRenderingWindow(bool addStencilBuffer)
         return;
     }
 
+    Renderer* const renderer = System::getSingleton().getRenderer();
     TextureTarget* const t =
-        System::getSingleton().getRenderer()->createTextureTarget(addStencilBuffer);
+        renderer->getTextureTargetPool().acquire(addStencilBuffer, getPixelSize());
 
     // TextureTargets may not be available, so check that first.
     if (!t)
@@ -3399,8 +4376,18 @@ void Window::allocateRenderingWindow(bool addStencilBuffer)
         return;
     }
 
+    // the cache can be evicted to stay within the texture memory budget while
+    // the window is not drawn, a new one is allocated when it is drawn again
+    renderer->getTextureResidencyManager().addTextureTarget(*t, [this]()
+    {
+        releaseRenderingWindow();
+        d_autoRenderingWindowEvicted = true;
+        return true;
+    });
+
     d_surface = &rs->createRenderingWindow(*t);
     transferChildSurfaces();
+    invalidateHitTestIndexEntry(true);
 
     // set size and position of RenderingWindow
     auto rw = static_cast<RenderingWindow*>(d_surface);
@@ -3425,10 +4412,13 @@ void Window::releaseRenderingWindow()
     d_surface = nullptr;
     // detach child surfaces prior to destroying the owning surface
     transferChildSurfaces();
+    invalidateHitTestIndexEntry(true);
     // destroy surface and texture target it used
     TextureTarget* tt = &old_surface->getTextureTarget();
     old_surface->getOwner().destroyRenderingWindow(*old_surface);
-    System::getSingleton().getRenderer()->destroyTextureTarget(tt);
+    Renderer* const renderer = System::getSingleton().getRenderer();
+    renderer->getTextureResidencyManager().removeTexture(tt->getTexture());
+    renderer->getTextureTargetPool().release(tt);
 
     if (GUIContext* context = getGUIContextPtr())
         context->markAsDirty();
@@ -3457,12 +4447,28 @@ void Window::transferChildSurfaces()
 void Window::onRotated(ElementEventArgs& e)
 {
     Element::onRotated(e);
-    
+    applyRotation();
+}
+
+//----------------------------------------------------------------------------//
+void Window::applyRotation()
+{
     if(!getGUIContextPtr())
     {
         return;
     }
 
+    // geometry rotated so far, or to be rotated now, is transformed again
+    if (d_rotationUsingGeometry || d_geometryRotation)
+    {
+        updateSubtreeGeometryRotation();
+        invalidateHitTestIndexEntry(true);
+        invalidateRenderingSurface();
+    }
+
+    if (d_rotationUsingGeometry && !(d_surface && d_surface->isRenderingWindow()))
+        return;
+
     // TODO: Checking quaternion for equality with IDENTITY is stupid,
     //       change this to something else, checking with tolerance.
     if (d_rotation != glm::quat() && !d_surface)
@@ -3556,16 +4562,13 @@ glm::vec2 Window::getUnprojectedPosition(const glm::vec2& pos) const
     if (!rs)
         return pos;
 
-    // if window is not backed by RenderingWindow, return same pos.
-    if (!rs->isRenderingWindow())
-        return pos;
-
-    // get first target RenderingWindow
-    RenderingWindow* rw = static_cast<RenderingWindow*>(rs);
-
     // setup for loop
     glm::vec2 out_pos(pos);
 
+    // get first target RenderingWindow, if any
+    RenderingWindow* rw = rs->isRenderingWindow() ?
+        static_cast<RenderingWindow*>(rs) : nullptr;
+
     // while there are rendering windows
     while (rw)
     {
@@ -3578,6 +4581,25 @@ glm::vec2 Window::getUnprojectedPosition(const glm::vec2& pos) const
                 static_cast<RenderingWindow*>(rs) : nullptr;
     }
 
+    // undo the rotations applied to the geometry drawn to our target surface,
+    // starting from the outermost one
+    std::vector<const Window*> rotating;
+    for (const Window* wnd = this; wnd; wnd = wnd->getParent())
+    {
+        if (wnd != this && wnd->d_surface && wnd->d_surface->isRenderingWindow())
+            break;
+
+        if (wnd->isRotatingGeometry())
+            rotating.push_back(wnd);
+    }
+
+    for (auto itor = rotating.rbegin(); itor != rotating.rend(); ++itor)
+    {
+        glm::vec2 unrotated;
+        if ((*itor)->unrotatePosition(out_pos, unrotated))
+            out_pos = unrotated;
+    }
+
     return out_pos;
 }
 
@@ -3636,6 +4658,7 @@ void Window::onMarginChanged(WindowEventArgs& e)
 void Window::setUpdateMode(const WindowUpdateMode mode)
 {
     d_updateMode = mode;
+    requestSubtreeUpdates();
 }
 
 //----------------------------------------------------------------------------//
@@ -3647,6 +4670,9 @@ void Window::setCursorInputPropagationEnabled(const bool enabled)
 //----------------------------------------------------------------------------//
 Window* Window::clone(const bool deepCopy) const
 {
+    // the copied properties fire their notifications once the copy is done
+    EventSet::BatchScope batch;
+
     Window* ret =
         WindowManager::getSingleton().createWindow(getType(), getName());
 
@@ -3666,32 +4692,44 @@ Window* Window::clone(const bool deepCopy) const
 //----------------------------------------------------------------------------//
 void Window::clonePropertiesTo(Window& target) const
 {
+    // user strings go first, properties defined by a look'n'feel keep their
+    // values in them
+    for (const auto& pair : getUserStrings())
+        target.setUserString(pair.first, pair.second);
+
     for (PropertySet::PropertyIterator propertyIt = getPropertyIterator();
          !propertyIt.isAtEnd();
          ++propertyIt)
     {
         const String& propertyName = propertyIt.getCurrentKey();
-        const String propertyValue = getProperty(propertyName);
 
         // we never copy stuff that doesn't get written into XML
         if (isPropertyBannedFromXML(propertyName))
             continue;
 
-        // some cases when propertyValue is "" could lead to exception throws
-        if (propertyValue.empty())
+        if (propertyName == "LookNFeel" || propertyName == "WindowRenderer")
         {
-            // special case, this causes exception throw when no window renderer
-            // is assigned to the window
-            if (propertyName == "LookNFeel")
-                continue;
-
-            // special case, this causes exception throw because we are setting
-            // 'null' window renderer
-            if (propertyName == "WindowRenderer")
-                continue;
+            // an empty value causes an exception throw when no window
+            // renderer is assigned or because we would set a 'null' one
+            const String propertyValue = getProperty(propertyName);
+            if (!propertyValue.empty())
+                target.setProperty(propertyName, propertyValue);
+
+            continue;
         }
 
-        target.setProperty(propertyName, propertyValue);
+        // when both windows share the property, the value is copied without
+        // converting it to a string and back
+        Property* const property = propertyIt.getCurrentValue();
+        if (target.isPropertyPresent(propertyIt.getCurrentKey()) &&
+            target.getPropertyInstance(propertyIt.getCurrentKey()) == property)
+        {
+            property->copyValue(this, &target);
+        }
+        else
+        {
+            target.setProperty(propertyName, getProperty(propertyName));
+        }
     }
 }
 
@@ -3707,7 +4745,9 @@ void Window::cloneChildWidgetsTo(Window& target) const
         if (child->isAutoWindow())
         {
             // we skip auto windows, they are already created
-            // automatically
+            // automatically, but take over their state
+            if (target.isChild(child->getName()))
+                child->clonePropertiesTo(*target.getChild(child->getName()));
 
             // note: some windows store non auto windows inside auto windows,
             //       standard solution is to copy these non-auto windows to
@@ -3752,8 +4792,14 @@ void Window::updateTransformAndClipping()
     getRenderingContext(ctx);
 
     const auto& pos = getUnclippedOuterRect().get().getPosition();
-
-    if (ctx.owner == this && ctx.surface->isRenderingWindow())
+    const glm::vec3 oldTranslation(d_translation);
+    const ClipRegion* const oldClipRegion = d_clipRegion.get();
+    const bool wasGeometryRotated = d_geometryRotation != nullptr;
+    const GeometryRotation oldGeometryRotation(
+        wasGeometryRotated ? *d_geometryRotation : GeometryRotation());
+
+    const bool ownsSurface = ctx.owner == this && ctx.surface->isRenderingWindow();
+    if (ownsSurface)
     {
         RenderingWindow* const rw = static_cast<RenderingWindow*>(ctx.surface);
 
@@ -3765,6 +4811,9 @@ void Window::updateTransformAndClipping()
         rw->setClippingRegion(getParentClipRect());
 
         d_clippingRegion = Rectf(glm::vec2(0, 0), d_pixelSize);
+
+        // our contents are drawn unrotated into the RenderingWindow
+        d_geometryRotation.reset();
     }
     else
     {
@@ -3775,22 +4824,157 @@ void Window::updateTransformAndClipping()
         d_clippingRegion = getOuterRectClipper();
         if (d_clippingRegion.getWidth() != 0.0f && d_clippingRegion.getHeight() != 0.0f)
             d_clippingRegion.offset(-ctx.offset);
+
+        updateGeometryRotation(ctx);
+        if (d_geometryRotation)
+            d_clippingRegion = d_geometryRotation->d_clipRect;
     }
 
-    for (CEGUI::GeometryBuffer* currentBuffer : d_geometryBuffers)
+    updateClipRegion(ownsSurface);
+
+    // imagery culled from the cached geometry may have come into view
+    if (d_geometryCulled && !d_needsRedraw)
+    {
+        const Rectf visible(getLocalClippingRegion());
+        if (d_geometryRotation ||
+            (visible.getWidth() > 0.0f && visible.getHeight() > 0.0f &&
+             (visible.left() < d_geometryCullRect.left() ||
+              visible.top() < d_geometryCullRect.top() ||
+              visible.right() > d_geometryCullRect.right() ||
+              visible.bottom() > d_geometryCullRect.bottom())))
+        {
+            d_needsRedraw = true;
+            invalidateRenderingSurface();
+        }
+    }
+
+    // a changed clipping region reaches the buffers through the shared
+    // ClipRegion, they are only touched when something else changed.
+    if (d_translation != oldTranslation || d_clipRegion.get() != oldClipRegion ||
+        d_inPlaceRenderEffect || (d_geometryRotation != nullptr) != wasGeometryRotated ||
+        (d_geometryRotation && !(*d_geometryRotation == oldGeometryRotation)))
+    {
+        d_needsTransformUpdate = true;
+    }
+    invalidateStaticGroups();
+}
+
+//----------------------------------------------------------------------------//
+void Window::updateGeometryRotation(const RenderingContext& ctx)
+{
+    // The rotation of the parent applies to our geometry as well, unless we
+    // draw to its RenderingWindow, in which case it has no geometry rotation.
+    const Window* const parent = getParent();
+    const GeometryRotation* const inherited =
+        parent ? parent->d_geometryRotation.get() : nullptr;
+
+    if (!isRotatingGeometry())
+    {
+        if (!inherited)
+            d_geometryRotation.reset();
+        else if (d_geometryRotation)
+            *d_geometryRotation = *inherited;
+        else
+            d_geometryRotation.reset(new GeometryRotation(*inherited));
+
+        return;
+    }
+
+    GeometryRotation rotation;
+    rotation.d_pivot = d_translation + getPivotPixels();
+    if (inherited)
+    {
+        // our rotation applies first, around our own pivot
+        rotation.d_rotation = inherited->d_rotation * d_rotation;
+        rotation.d_offset = inherited->d_offset +
+            inherited->d_rotation * (rotation.d_pivot - inherited->d_pivot) +
+            inherited->d_pivot - rotation.d_pivot;
+        rotation.d_clipRect = inherited->d_clipRect;
+    }
+    else
+    {
+        rotation.d_rotation = d_rotation;
+        rotation.d_offset = glm::vec3(0.0f, 0.0f, 0.0f);
+        rotation.d_clipRect = getParentClipRect();
+        if (rotation.d_clipRect.getWidth() != 0.0f && rotation.d_clipRect.getHeight() != 0.0f)
+            rotation.d_clipRect.offset(-ctx.offset);
+    }
+
+    if (d_geometryRotation)
+        *d_geometryRotation = rotation;
+    else
+        d_geometryRotation.reset(new GeometryRotation(rotation));
+}
+
+//----------------------------------------------------------------------------//
+void Window::updateSubtreeGeometryRotation()
+{
+    updateTransformAndClipping();
+
+    for (Element* child : d_children)
+    {
+        Window* const wnd = static_cast<Window*>(child);
+
+        // the contents of a RenderingWindow are drawn unrotated into it
+        if (!wnd->d_surface || !wnd->d_surface->isRenderingWindow())
+            wnd->updateSubtreeGeometryRotation();
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool Window::unrotatePosition(const glm::vec2& position, glm::vec2& out) const
+{
+    // solves d_rotation * (p - pivot) + pivot = position for p in the plane
+    // of the window, leaving out the perspective of the projection
+    const glm::vec3 pivot(glm::vec3(getUnclippedOuterRect().get().getPosition(), 0.0f) +
+        getPivotPixels());
+    const glm::mat3 rotation(glm::mat3_cast(d_rotation));
+
+    const float z = -pivot.z;
+    const float x = position.x - pivot.x - rotation[2][0] * z;
+    const float y = position.y - pivot.y - rotation[2][1] * z;
+
+    const float det = rotation[0][0] * rotation[1][1] - rotation[1][0] * rotation[0][1];
+    if (std::abs(det) < 1e-6f)
+        return false;
+
+    out.x = pivot.x + (rotation[1][1] * x - rotation[1][0] * y) / det;
+    out.y = pivot.y + (rotation[0][0] * y - rotation[0][1] * x) / det;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void Window::updateClipRegion(bool ownsSurface)
+{
+    // geometry of the parent is drawn to the same surface unless we own one,
+    // so equal regions may be shared.
+    const Window* const parent = getParent();
+    if (!ownsSurface && parent && parent->d_clipRegion &&
+        parent->d_clipRegion->getRegion() == d_clippingRegion)
     {
-        currentBuffer->setTranslation(d_translation);
-        currentBuffer->setClippingRegion(d_clippingRegion);
+        d_clipRegion = parent->d_clipRegion;
+        return;
     }
+
+    // never change the region of the parent when ours starts to differ
+    if (!d_clipRegion || (parent && d_clipRegion == parent->d_clipRegion))
+        d_clipRegion = std::make_shared<ClipRegion>();
+
+    d_clipRegion->setRegion(d_clippingRegion);
 }
 
 //----------------------------------------------------------------------------//
 void Window::updatePivot()
 {
-    static_cast<RenderingWindow*>(d_surface)->setPivot(
-      glm::vec3(CoordConverter::asAbsolute(d_pivot.d_x, d_pixelSize.d_width,  false),
-                CoordConverter::asAbsolute(d_pivot.d_y, d_pixelSize.d_height, false),
-                CoordConverter::asAbsolute(d_pivot.d_z, 0,                    false)));
+    static_cast<RenderingWindow*>(d_surface)->setPivot(getPivotPixels());
+}
+
+//----------------------------------------------------------------------------//
+glm::vec3 Window::getPivotPixels() const
+{
+    return glm::vec3(CoordConverter::asAbsolute(d_pivot.d_x, d_pixelSize.d_width,  false),
+                     CoordConverter::asAbsolute(d_pivot.d_y, d_pixelSize.d_height, false),
+                     CoordConverter::asAbsolute(d_pivot.d_z, 0,                    false));
 }
 
 //----------------------------------------------------------------------------//
@@ -4026,11 +5210,16 @@ bool Window::canFocus() const
 //----------------------------------------------------------------------------//
 void Window::destroyGeometryBuffers()
 {
+    // buffers owned by the imagery cache are destroyed along with it
+    d_geometryCache.detach(d_geometryBuffers);
+
     const size_t geom_buffer_count = d_geometryBuffers.size();
     for (size_t i = 0; i < geom_buffer_count; ++i)
         System::getSingleton().getRenderer()->destroyGeometryBuffer(*d_geometryBuffers.at(i));
 
     d_geometryBuffers.clear();
+    d_geometryBufferPool.clear();
+    d_geometryCache.clear();
 }
 
 //----------------------------------------------------------------------------//
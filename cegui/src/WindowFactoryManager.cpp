@@ -117,7 +117,11 @@ void WindowFactoryManager::addFactory(WindowFactory* factory)
 	}
 
 	// add the factory to the registry
-	d_factoryRegistry[factory->getTypeName()] = factory;
+    {
+        std::lock_guard<SharedMutex> guard(d_registryMutex);
+        d_factoryRegistry[factory->getTypeName()] = factory;
+        d_resolvedTypes.clear();
+    }
 
     String addressStr = SharedStringstream::GetPointerAddressAsString(factory);
 	Logger::getSingleton().logEvent("[WindowFactoryManager] WindowFactory for '" +
@@ -142,7 +146,11 @@ void WindowFactoryManager::removeFactory(const String& name)
 
     String addressStr = SharedStringstream::GetPointerAddressAsString((*i).second);
 
-	d_factoryRegistry.erase(name);
+    {
+        std::lock_guard<SharedMutex> guard(d_registryMutex);
+        d_factoryRegistry.erase(name);
+        d_resolvedTypes.clear();
+    }
 
     Logger::getSingleton().logEvent("[WindowFactoryManager] WindowFactory for '" + name +
                                     "' windows removed. " + addressStr);
@@ -184,6 +192,8 @@ void WindowFactoryManager::removeAllFactories(void)
 *************************************************************************/
 WindowFactory* WindowFactoryManager::getFactory(const String& type) const
 {
+    SharedLock guard(d_registryMutex);
+
     // first, dereference aliased types, as needed.
     String targetType(getDereferencedAliasType(type));
 
@@ -225,6 +235,8 @@ WindowFactory* WindowFactoryManager::getFactory(const String& type) const
 *************************************************************************/
 bool WindowFactoryManager::isFactoryPresent(const String& name) const
 {
+    SharedLock guard(d_registryMutex);
+
     // first, dereference aliased types, as needed.
     String targetType(getDereferencedAliasType(name));
 
@@ -266,17 +278,22 @@ WindowFactoryManager::TypeAliasIterator WindowFactoryManager::getAliasIterator(v
 *************************************************************************/
 void WindowFactoryManager::addWindowTypeAlias(const String& aliasName, const String& targetType)
 {
-	TypeAliasRegistry::iterator pos = d_aliasRegistry.find(aliasName);
+    {
+        std::lock_guard<SharedMutex> guard(d_registryMutex);
+        TypeAliasRegistry::iterator pos = d_aliasRegistry.find(aliasName);
 
-	if (pos == d_aliasRegistry.end())
-	{
-		d_aliasRegistry[aliasName].d_targetStack.push_back(targetType);
-	}
-	// alias already exists, add our new entry to the list already there
-	else
-	{
-		pos->second.d_targetStack.push_back(targetType);
-	}
+        if (pos == d_aliasRegistry.end())
+        {
+            d_aliasRegistry[aliasName].d_targetStack.push_back(targetType);
+        }
+        // alias already exists, add our new entry to the list already there
+        else
+        {
+            pos->second.d_targetStack.push_back(targetType);
+        }
+
+        d_resolvedTypes.clear();
+    }
 
 	Logger::getSingleton().logEvent("Window type alias named '" + aliasName + "' added for window type '" + targetType +"'.");
 }
@@ -287,6 +304,8 @@ void WindowFactoryManager::addWindowTypeAlias(const String& aliasName, const Str
 *************************************************************************/
 void WindowFactoryManager::removeWindowTypeAlias(const String& aliasName, const String& targetType)
 {
+    std::unique_lock<SharedMutex> guard(d_registryMutex);
+
 	// find alias name
 	TypeAliasRegistry::iterator pos = d_aliasRegistry.find(aliasName);
 
@@ -301,15 +320,20 @@ void WindowFactoryManager::removeWindowTypeAlias(const String& aliasName, const
 		{
 			// erase the target mapping
 			pos->second.d_targetStack.erase(aliasPos);
+            d_resolvedTypes.clear();
+
+            // the alias is erased along with its last target
+            const bool lastTarget = pos->second.d_targetStack.empty();
+            if (lastTarget)
+                d_aliasRegistry.erase(pos);
+
+            guard.unlock();
 
 			Logger::getSingleton().logEvent("Window type alias named '" + aliasName + "' removed for window type '" + targetType +"'.");
 
 			// if the list of targets for this alias is now empty
-			if (pos->second.d_targetStack.empty())
+			if (lastTarget)
 			{
-				// erase the alias name also
-				d_aliasRegistry.erase(aliasName);
-
 				Logger::getSingleton().logEvent("Window type alias named '" + aliasName + "' has no more targets and has been removed.", LoggingLevel::Error);
 			}
 
@@ -321,7 +345,9 @@ void WindowFactoryManager::removeWindowTypeAlias(const String& aliasName, const
 
 void WindowFactoryManager::removeAllWindowTypeAliases()
 {
+    std::lock_guard<SharedMutex> guard(d_registryMutex);
 	d_aliasRegistry.clear();
+    d_resolvedTypes.clear();
 }
 
 void WindowFactoryManager::addFalagardWindowMapping(const String& newType,
@@ -350,7 +376,9 @@ void WindowFactoryManager::addFalagardWindowMapping(const String& newType,
         renderer + "' Look'N'Feel '" + lookName + "' and RenderEffect '" +
         effectName + "'. " + addressStr);
 
+    std::lock_guard<SharedMutex> guard(d_registryMutex);
     d_falagardRegistry[newType] = mapping;
+    d_resolvedTypes.clear();
 }
 
 void WindowFactoryManager::removeFalagardWindowMapping(const String& type)
@@ -360,13 +388,17 @@ void WindowFactoryManager::removeFalagardWindowMapping(const String& type)
     if (iter != d_falagardRegistry.end())
     {
         Logger::getSingleton().logEvent("Removing falagard mapping for type '" + type + "'.");
+        std::lock_guard<SharedMutex> guard(d_registryMutex);
         d_falagardRegistry.erase(iter);
+        d_resolvedTypes.clear();
     }
 }
 
 void WindowFactoryManager::removeAllFalagardWindowMappings()
 {
+    std::lock_guard<SharedMutex> guard(d_registryMutex);
 	d_falagardRegistry.clear();
+    d_resolvedTypes.clear();
 }
 
 WindowFactoryManager::FalagardMappingIterator WindowFactoryManager::getFalagardMappingIterator() const
@@ -376,11 +408,13 @@ WindowFactoryManager::FalagardMappingIterator WindowFactoryManager::getFalagardM
 
 bool WindowFactoryManager::isFalagardMappedType(const String& type) const
 {
+    SharedLock guard(d_registryMutex);
     return d_falagardRegistry.find(getDereferencedAliasType(type)) != d_falagardRegistry.end();
 }
 
 const String& WindowFactoryManager::getMappedLookForType(const String& type) const
 {
+    SharedLock guard(d_registryMutex);
     FalagardMapRegistry::const_iterator iter =
         d_falagardRegistry.find(getDereferencedAliasType(type));
 
@@ -399,6 +433,7 @@ const String& WindowFactoryManager::getMappedLookForType(const String& type) con
 
 const String& WindowFactoryManager::getMappedRendererForType(const String& type) const
 {
+    SharedLock guard(d_registryMutex);
     FalagardMapRegistry::const_iterator iter =
         d_falagardRegistry.find(getDereferencedAliasType(type));
 
@@ -417,6 +452,7 @@ const String& WindowFactoryManager::getMappedRendererForType(const String& type)
 
 String WindowFactoryManager::getDereferencedAliasType(const String& type) const
 {
+    SharedLock guard(d_registryMutex);
     TypeAliasRegistry::const_iterator alias = d_aliasRegistry.find(type);
 
     // if this is an aliased type, ensure to fully dereference by recursively
@@ -430,6 +466,7 @@ String WindowFactoryManager::getDereferencedAliasType(const String& type) const
 
 const WindowFactoryManager::FalagardWindowMapping& WindowFactoryManager::getFalagardMappingForType(const String& type) const
 {
+    SharedLock guard(d_registryMutex);
     FalagardMapRegistry::const_iterator iter =
         d_falagardRegistry.find(getDereferencedAliasType(type));
 
@@ -446,6 +483,29 @@ const WindowFactoryManager::FalagardWindowMapping& WindowFactoryManager::getFala
     }
 }
 
+const WindowFactoryManager::ResolvedWindowType& WindowFactoryManager::resolveWindowType(const String& type) const
+{
+    // the cache is cleared with the registry locked exclusively
+    SharedLock guard(d_registryMutex);
+
+    {
+        std::lock_guard<std::mutex> cacheGuard(d_resolvedTypesMutex);
+        ResolvedTypeCache::const_iterator cached = d_resolvedTypes.find(type);
+        if (cached != d_resolvedTypes.end())
+            return cached->second;
+    }
+
+    ResolvedWindowType resolved;
+    // throws for unknown types, which are therefore never cached
+    resolved.d_factory = getFactory(type);
+
+    FalagardMapRegistry::const_iterator mapping =
+        d_falagardRegistry.find(getDereferencedAliasType(type));
+    resolved.d_mapping = (mapping != d_falagardRegistry.end()) ? &mapping->second : nullptr;
+
+    std::lock_guard<std::mutex> cacheGuard(d_resolvedTypesMutex);
+    return d_resolvedTypes.emplace(type, resolved).first->second;
+}
 
 //////////////////////////////////////////////////////////////////////////
 /*************************************************************************
@@ -0,0 +1,361 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/WindowHitTestIndex.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/RenderingSurface.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+//! Maximum number of cells per grid axis
+static const std::size_t MaxGridDimension = 64;
+
+//----------------------------------------------------------------------------//
+WindowHitTestIndex::WindowHitTestIndex(const Window& owner) :
+    d_owner(owner),
+    d_area(0, 0, 1, 1),
+    d_cellSize(1, 1),
+    d_columns(1),
+    d_rows(1),
+    d_valid(false),
+    d_clippingGeneration(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+void WindowHitTestIndex::invalidate()
+{
+    d_valid = false;
+}
+
+//----------------------------------------------------------------------------//
+void WindowHitTestIndex::invalidateChild(const Window& child)
+{
+    // the whole index is rebuilt on the next query anyway
+    if (!d_valid)
+        return;
+
+    const auto it = d_entryIndices.find(&child);
+    if (it == d_entryIndices.end() || d_entries[it->second].d_dirty)
+        return;
+
+    d_entries[it->second].d_dirty = true;
+    d_dirtyEntries.push_back(it->second);
+}
+
+//----------------------------------------------------------------------------//
+const std::vector<Window*>& WindowHitTestIndex::getCandidates(const glm::vec2& position)
+{
+    if (!d_valid)
+        rebuild();
+    else
+    {
+        // a clipping change of the owner or its ancestors may affect the hit
+        // test rect of any child, most of them keep their bounds though
+        if (d_clippingGeneration != d_owner.getClippingGeneration())
+        {
+            d_clippingGeneration = d_owner.getClippingGeneration();
+            for (std::size_t i = 0; i < d_entries.size(); ++i)
+            {
+                if (!d_entries[i].d_dirty)
+                {
+                    d_entries[i].d_dirty = true;
+                    d_dirtyEntries.push_back(i);
+                }
+            }
+        }
+
+        if (!d_dirtyEntries.empty())
+            updateDirtyEntries();
+    }
+
+    // the bounds are relative to the owner, so that moving it, e.g. when
+    // scrolling its content, leaves them as they are
+    const glm::vec2 localPosition(position - getOrigin());
+
+    const std::vector<std::size_t>& cell =
+        d_cells[getRow(localPosition.y) * d_columns + getColumn(localPosition.x)];
+
+    // merge the cell with the unbounded entries, front to back
+    d_candidates.clear();
+    auto bounded = cell.rbegin();
+    auto unbounded = d_unboundedEntries.rbegin();
+    while (bounded != cell.rend() || unbounded != d_unboundedEntries.rend())
+    {
+        if (unbounded == d_unboundedEntries.rend() ||
+            (bounded != cell.rend() && *bounded > *unbounded))
+        {
+            const Entry& entry = d_entries[*bounded++];
+            if (entry.d_bounds.isPointInRectf(localPosition))
+                d_candidates.push_back(entry.d_window);
+        }
+        else
+            d_candidates.push_back(d_entries[*unbounded++].d_window);
+    }
+
+    return d_candidates;
+}
+
+//----------------------------------------------------------------------------//
+void WindowHitTestIndex::rebuild()
+{
+    const std::vector<Window*>& drawList = d_owner.d_drawList;
+
+    d_clippingGeneration = d_owner.getClippingGeneration();
+    d_entries.resize(drawList.size());
+    const glm::vec2 origin(getOrigin());
+    d_entryIndices.clear();
+    d_unboundedEntries.clear();
+    d_dirtyEntries.clear();
+
+    bool haveArea = false;
+    std::size_t boundedCount = 0;
+    for (std::size_t i = 0; i < drawList.size(); ++i)
+    {
+        Entry& entry = d_entries[i];
+        entry.d_window = drawList[i];
+        entry.d_dirty = false;
+        d_entryIndices[entry.d_window] = i;
+
+        entry.d_bounded = isSubtreeBounded(*entry.d_window);
+        entry.d_bounds = getEntryBounds(*entry.d_window, entry.d_bounded, origin);
+        if (!entry.d_bounded || entry.d_bounds.getWidth() <= 0.0f ||
+            entry.d_bounds.getHeight() <= 0.0f)
+            continue;
+
+        if (!haveArea)
+        {
+            d_area = entry.d_bounds;
+            haveArea = true;
+        }
+        else
+        {
+            d_area.d_min.x = std::min(d_area.d_min.x, entry.d_bounds.d_min.x);
+            d_area.d_min.y = std::min(d_area.d_min.y, entry.d_bounds.d_min.y);
+            d_area.d_max.x = std::max(d_area.d_max.x, entry.d_bounds.d_max.x);
+            d_area.d_max.y = std::max(d_area.d_max.y, entry.d_bounds.d_max.y);
+        }
+
+        ++boundedCount;
+    }
+
+    if (!haveArea)
+        d_area = Rectf(0, 0, 1, 1);
+
+    // aim for about one child per cell if they were evenly spread
+    const std::size_t dimension = std::min(MaxGridDimension, std::max<std::size_t>(1,
+        static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<float>(boundedCount))))));
+    d_columns = dimension;
+    d_rows = dimension;
+    d_cellSize.x = d_area.getWidth() / d_columns;
+    d_cellSize.y = d_area.getHeight() / d_rows;
+
+    d_cells.assign(d_columns * d_rows, std::vector<std::size_t>());
+    for (std::size_t i = 0; i < d_entries.size(); ++i)
+        insertEntry(i);
+
+    d_valid = true;
+}
+
+//----------------------------------------------------------------------------//
+void WindowHitTestIndex::updateDirtyEntries()
+{
+    const glm::vec2 origin(getOrigin());
+
+    // entries whose bounds did not change stay in their cells
+    std::vector<std::size_t> changedEntries;
+    for (const std::size_t index : d_dirtyEntries)
+    {
+        Entry& entry = d_entries[index];
+        entry.d_dirty = false;
+
+        const bool bounded = isSubtreeBounded(*entry.d_window);
+        const Rectf bounds(getEntryBounds(*entry.d_window, bounded, origin));
+        if (bounded != entry.d_bounded || bounds != entry.d_bounds)
+            changedEntries.push_back(index);
+    }
+
+    d_dirtyEntries.clear();
+
+    // moving most children relative to each other is cheaper to handle at once
+    if (changedEntries.size() * 2 > d_entries.size())
+    {
+        rebuild();
+        return;
+    }
+
+    for (const std::size_t index : changedEntries)
+    {
+        Entry& entry = d_entries[index];
+        removeEntry(index);
+        entry.d_bounded = isSubtreeBounded(*entry.d_window);
+        entry.d_bounds = getEntryBounds(*entry.d_window, entry.d_bounded, origin);
+        insertEntry(index);
+    }
+}
+
+//----------------------------------------------------------------------------//
+glm::vec2 WindowHitTestIndex::getOrigin() const
+{
+    return d_owner.getUnclippedOuterRect().get().getPosition();
+}
+
+//----------------------------------------------------------------------------//
+Rectf WindowHitTestIndex::getEntryBounds(const Window& child, bool bounded,
+                                         const glm::vec2& origin)
+{
+    if (!bounded)
+        return Rectf(0, 0, 0, 0);
+
+    // The unclipped area does not change when only the clipping does, e.g.
+    // when the owner is scrolled. Hit test rects beyond it, like the one of
+    // a ScrolledContainer, are included as they currently are.
+    Rectf bounds(child.getUnclippedOuterRect().get());
+    const Rectf& hitTestRect = child.getHitTestRect();
+    if (hitTestRect.getWidth() > 0.0f && hitTestRect.getHeight() > 0.0f)
+    {
+        bounds.d_min.x = std::min(bounds.d_min.x, hitTestRect.d_min.x);
+        bounds.d_min.y = std::min(bounds.d_min.y, hitTestRect.d_min.y);
+        bounds.d_max.x = std::max(bounds.d_max.x, hitTestRect.d_max.x);
+        bounds.d_max.y = std::max(bounds.d_max.y, hitTestRect.d_max.y);
+    }
+
+    bounds.offset(-origin);
+    return bounds;
+}
+
+//----------------------------------------------------------------------------//
+void WindowHitTestIndex::insertEntry(std::size_t index)
+{
+    Entry& entry = d_entries[index];
+
+    if (!entry.d_bounded)
+    {
+        d_unboundedEntries.insert(std::lower_bound(d_unboundedEntries.begin(),
+            d_unboundedEntries.end(), index), index);
+        return;
+    }
+
+    // children with an empty hit test rect can not be hit at all
+    if (entry.d_bounds.getWidth() <= 0.0f || entry.d_bounds.getHeight() <= 0.0f)
+    {
+        entry.d_firstColumn = entry.d_firstRow = 1;
+        entry.d_lastColumn = entry.d_lastRow = 0;
+        return;
+    }
+
+    entry.d_firstColumn = getColumn(entry.d_bounds.left());
+    entry.d_lastColumn = getColumn(entry.d_bounds.right());
+    entry.d_firstRow = getRow(entry.d_bounds.top());
+    entry.d_lastRow = getRow(entry.d_bounds.bottom());
+
+    for (std::size_t row = entry.d_firstRow; row <= entry.d_lastRow; ++row)
+    {
+        for (std::size_t column = entry.d_firstColumn; column <= entry.d_lastColumn; ++column)
+        {
+            std::vector<std::size_t>& cell = d_cells[row * d_columns + column];
+            cell.insert(std::lower_bound(cell.begin(), cell.end(), index), index);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void WindowHitTestIndex::removeEntry(std::size_t index)
+{
+    const Entry& entry = d_entries[index];
+
+    if (!entry.d_bounded)
+    {
+        const auto it = std::lower_bound(d_unboundedEntries.begin(),
+                                         d_unboundedEntries.end(), index);
+        if (it != d_unboundedEntries.end() && *it == index)
+            d_unboundedEntries.erase(it);
+        return;
+    }
+
+    for (std::size_t row = entry.d_firstRow; row <= entry.d_lastRow; ++row)
+    {
+        for (std::size_t column = entry.d_firstColumn; column <= entry.d_lastColumn; ++column)
+        {
+            std::vector<std::size_t>& cell = d_cells[row * d_columns + column];
+            const auto it = std::lower_bound(cell.begin(), cell.end(), index);
+            if (it != cell.end() && *it == index)
+                cell.erase(it);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+std::size_t WindowHitTestIndex::getColumn(float x) const
+{
+    const float column = std::floor((x - d_area.left()) / d_cellSize.x);
+    if (!(column > 0.0f))
+        return 0;
+
+    return std::min(static_cast<std::size_t>(column), d_columns - 1);
+}
+
+//----------------------------------------------------------------------------//
+std::size_t WindowHitTestIndex::getRow(float y) const
+{
+    const float row = std::floor((y - d_area.top()) / d_cellSize.y);
+    if (!(row > 0.0f))
+        return 0;
+
+    return std::min(static_cast<std::size_t>(row), d_rows - 1);
+}
+
+//----------------------------------------------------------------------------//
+bool WindowHitTestIndex::isSubtreeBounded(const Window& wnd)
+{
+    // positions are unprojected for the children of a RenderingWindow
+    const RenderingSurface* const surface = wnd.getRenderingSurface();
+    if (surface && surface->isRenderingWindow())
+        return false;
+
+    // and a window rotating its geometry is hit outside of its area
+    if (wnd.isRotatingGeometry())
+        return false;
+
+    const std::size_t childCount = wnd.getChildCount();
+    for (std::size_t i = 0; i < childCount; ++i)
+    {
+        const Window* const child = wnd.getChildAtIndex(i);
+        if (!child->isClippedByParent() || !isSubtreeBounded(*child))
+            return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -35,8 +35,14 @@
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/XMLSerializer.h"
 #include "CEGUI/RenderEffectManager.h"
+#include "CEGUI/InPlaceRenderEffect.h"
 #include "CEGUI/RenderingWindow.h"
 #include "CEGUI/SharedStringStream.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/Renderer.h"
+#include <chrono>
 #include <fstream>
 #include <algorithm>
 
@@ -57,6 +63,7 @@ String WindowManager::d_defaultResourceGroup;
 // Declared in WindowManager
 const String WindowManager::GUILayoutSchemaName("GUILayout.xsd");
 const String WindowManager::GeneratedWindowNameBase("__cewin_uid_");
+const String WindowManager::PreparsedFileSuffix(".bin");
 const String WindowManager::EventNamespace("WindowManager");
 const String WindowManager::EventWindowCreated("WindowCreated");
 const String WindowManager::EventWindowDestroyed("WindowDestroyed");
@@ -66,8 +73,12 @@ const String WindowManager::EventWindowDestroyed("WindowDestroyed");
     Constructor
 *************************************************************************/
 WindowManager::WindowManager(void) :
+    d_deadPoolTimeBudget(0),
     d_uid_counter(0),
-    d_lockCount(0)
+    d_lockCount(0),
+    d_windowPoolSuspended(false),
+    d_preparsedFilesEnabled(true),
+    d_layoutCacheEnabled(true)
 {
     String addressStr = SharedStringstream::GetPointerAddressAsString(this);
 
@@ -103,29 +114,47 @@ Window* WindowManager::createWindow(const String& type, const String& name)
 
     String finalName(name.empty() ? generateUniqueWindowName() : name);
 
-    WindowFactoryManager& wfMgr = WindowFactoryManager::getSingleton();
-    WindowFactory* factory = wfMgr.getFactory(type);
+    // resolved once per type, the result is cached by the factory manager
+    const WindowFactoryManager::ResolvedWindowType resolved =
+        WindowFactoryManager::getSingleton().resolveWindowType(type);
+    const WindowFactoryManager::FalagardWindowMapping* const mapping = resolved.d_mapping;
 
-    Window* newWindow = factory->createWindow(finalName);
+    // reuse a recycled window if there is one
+    Window* newWindow = takeWindowFromPool(type, mapping ? mapping->d_lookName : String());
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(newWindow);
-    Logger::getSingleton().logEvent("Window '" + finalName +"' of type '" +
-        type + "' has been created. " + addressStr, LoggingLevel::Informative);
-
-    // see if we need to assign a look to this window
-    if (wfMgr.isFalagardMappedType(type))
+    if (newWindow)
     {
-        const WindowFactoryManager::FalagardWindowMapping& fwm = wfMgr.getFalagardMappingForType(type);
-        // this was a mapped type, so assign a look to the window so it can finalise
-        // its initialisation
-        newWindow->d_falagardType = type;
-        newWindow->setWindowRenderer(fwm.d_rendererType);
-        newWindow->setLookNFeel(fwm.d_lookName);
+        newWindow->setName(finalName);
 
-        initialiseRenderEffect(newWindow, fwm.d_effectName);
+        CEGUI_LOG(LoggingLevel::Informative, "Window '" + finalName +"' of type '" +
+            type + "' has been taken from the window pool. " +
+            SharedStringstream::GetPointerAddressAsString(newWindow));
+    }
+    else
+    {
+        newWindow = resolved.d_factory->createWindow(finalName);
+
+        CEGUI_LOG(LoggingLevel::Informative, "Window '" + finalName +"' of type '" +
+            type + "' has been created. " +
+            SharedStringstream::GetPointerAddressAsString(newWindow));
+
+        // see if we need to assign a look to this window
+        if (mapping)
+        {
+            // this was a mapped type, so assign a look to the window so it can finalise
+            // its initialisation
+            newWindow->d_falagardType = InternedName(type);
+            newWindow->setWindowRenderer(mapping->d_rendererType);
+            newWindow->setLookNFeel(mapping->d_lookName);
+
+            initialiseRenderEffect(newWindow, mapping->d_effectName);
+        }
     }
 
-	d_windowRegistry.push_back(newWindow);
+    {
+        std::lock_guard<std::mutex> guard(d_registryMutex);
+        d_windowRegistry.push_back(newWindow);
+    }
 
     // fire event to notify interested parites about the new window.
     WindowEventArgs args(newWindow);
@@ -154,6 +183,16 @@ void WindowManager::initialiseRenderEffect(
        return;
     }
 
+    RenderEffect& instance = RenderEffectManager::getSingleton().create(effect, wnd);
+
+    // effects applied in place work on the geometry of the window itself and
+    // need no RenderingSurface
+    if (instance.isAppliedInPlace())
+    {
+        wnd->setInPlaceRenderEffect(static_cast<InPlaceRenderEffect*>(&instance));
+        return;
+    }
+
     // If we do not have a RenderingSurface, enable AutoRenderingSurface to
     // try and create one
     if (!wnd->getRenderingSurface())
@@ -168,14 +207,15 @@ void WindowManager::initialiseRenderEffect(
     if (wnd->getRenderingSurface() &&
         wnd->getRenderingSurface()->isRenderingWindow())
     {
-        // Set an instance of the requested RenderEffect
+        // Set the instance of the requested RenderEffect
         static_cast<RenderingWindow*>(wnd->getRenderingSurface())->
-                setRenderEffect(&RenderEffectManager::getSingleton().
-                        create(effect, wnd));
+                setRenderEffect(&instance);
     }
     // log fact that we could not get a usable RenderingSurface
     else
     {
+        RenderEffectManager::getSingleton().destroy(instance);
+
         logger.logEvent("Unable to set effect for window '" +
             wnd->getName() + "' since RenderingSurface is either missing "
             "or of wrong type (i.e. not a RenderingWindow).",
@@ -188,15 +228,16 @@ void WindowManager::initialiseRenderEffect(
 *************************************************************************/
 void WindowManager::destroyWindow(Window* window)
 {
+    std::unique_lock<std::mutex> guard(d_registryMutex);
 	WindowVector::iterator iter =
         std::find(d_windowRegistry.begin(),
                   d_windowRegistry.end(),
                   window);
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(&window);
-
 	if (iter == d_windowRegistry.end())
     {
+        guard.unlock();
+        String addressStr = SharedStringstream::GetPointerAddressAsString(window);
         Logger::getSingleton().logEvent("[WindowManager] Attempt to delete "
             "Window that does not exist!  Address was: " + addressStr +
             ". WARNING: This could indicate a double-deletion issue!!",
@@ -205,9 +246,24 @@ void WindowManager::destroyWindow(Window* window)
     }
 
     d_windowRegistry.erase(iter);
+    guard.unlock();
+
+    // forget a layout template destroyed from outside
+    for (auto tpl = d_layoutTemplates.begin(); tpl != d_layoutTemplates.end(); ++tpl)
+    {
+        if (tpl->second == window)
+        {
+            d_layoutTemplates.erase(tpl);
+            break;
+        }
+    }
 
-    Logger::getSingleton().logEvent("Window at '" + window->getNamePath() +
-        "' will be added to dead pool. " + addressStr, LoggingLevel::Informative);
+    if (recycleWindow(window))
+        return;
+
+    CEGUI_LOG(LoggingLevel::Informative, "Window at '" + window->getNamePath() +
+        "' will be added to dead pool. " +
+        SharedStringstream::GetPointerAddressAsString(window));
 
     // do 'safe' part of cleanup
     window->destroy();
@@ -227,13 +283,157 @@ void WindowManager::destroyWindow(Window* window)
 *************************************************************************/
 void WindowManager::destroyAllWindows(void)
 {
+    // pooled windows go first, as their auto windows are still registered
+    clearWindowPool();
+
+    d_windowPoolSuspended = true;
 	while (!d_windowRegistry.empty())
 		destroyWindow(*d_windowRegistry.begin());
+    d_windowPoolSuspended = false;
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::setWindowPoolCapacity(const String& type, std::size_t capacity)
+{
+    if (capacity)
+        d_windowPoolCapacities[type] = capacity;
+    else
+        d_windowPoolCapacities.erase(type);
+
+    // destroy what no longer fits
+    WindowVector excess;
+    {
+        std::lock_guard<std::mutex> guard(d_registryMutex);
+        for (WindowPoolMap::iterator pool = d_windowPool.begin(); pool != d_windowPool.end(); )
+        {
+            if (pool->first.first != type || pool->second.size() <= capacity)
+            {
+                ++pool;
+                continue;
+            }
+
+            excess.insert(excess.end(), pool->second.begin() + capacity, pool->second.end());
+            pool->second.resize(capacity);
+            if (pool->second.empty())
+                pool = d_windowPool.erase(pool);
+            else
+                ++pool;
+        }
+    }
+
+    destroyPooledWindows(excess);
+}
+
+//----------------------------------------------------------------------------//
+std::size_t WindowManager::getWindowPoolCapacity(const String& type) const
+{
+    std::map<String, std::size_t>::const_iterator capacity = d_windowPoolCapacities.find(type);
+    return capacity != d_windowPoolCapacities.end() ? capacity->second : 0;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t WindowManager::getPooledWindowCount(const String& type) const
+{
+    std::lock_guard<std::mutex> guard(d_registryMutex);
+    std::size_t count = 0;
+    for (WindowPoolMap::const_iterator pool = d_windowPool.begin(); pool != d_windowPool.end(); ++pool)
+        if (pool->first.first == type)
+            count += pool->second.size();
+
+    return count;
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::clearWindowPool()
+{
+    WindowPoolMap pools;
+    {
+        std::lock_guard<std::mutex> guard(d_registryMutex);
+        pools.swap(d_windowPool);
+    }
+
+    for (WindowPoolMap::iterator pool = pools.begin(); pool != pools.end(); ++pool)
+        destroyPooledWindows(pool->second);
+}
+
+//----------------------------------------------------------------------------//
+Window* WindowManager::takeWindowFromPool(const String& type, const String& look)
+{
+    std::lock_guard<std::mutex> guard(d_registryMutex);
+    if (d_windowPool.empty())
+        return nullptr;
+
+    WindowPoolMap::iterator pool = d_windowPool.find(std::make_pair(type, look));
+    if (pool == d_windowPool.end())
+        return nullptr;
+
+    Window* window = pool->second.back();
+    pool->second.pop_back();
+    if (pool->second.empty())
+        d_windowPool.erase(pool);
+
+    return window;
+}
+
+//----------------------------------------------------------------------------//
+bool WindowManager::recycleWindow(Window* window)
+{
+    // auto windows are owned by the look of their parent
+    if (d_windowPoolSuspended || window->isAutoWindow())
+        return false;
+
+    const std::pair<String, String> key(window->getType(), window->getLookNFeel());
+    std::size_t pooledCount = 0;
+    {
+        std::lock_guard<std::mutex> guard(d_registryMutex);
+        WindowPoolMap::const_iterator pool = d_windowPool.find(key);
+        if (pool != d_windowPool.end())
+            pooledCount = pool->second.size();
+    }
+
+    if (pooledCount >= getWindowPoolCapacity(key.first))
+        return false;
+
+    CEGUI_LOG(LoggingLevel::Informative, "Window at '" + window->getNamePath() +
+        "' will be added to the window pool. " +
+        SharedStringstream::GetPointerAddressAsString(window));
+
+    window->recycle();
+
+    // the pools might have changed while recycling the children
+    {
+        std::lock_guard<std::mutex> guard(d_registryMutex);
+        d_windowPool[key].push_back(window);
+    }
+
+    WindowEventArgs args(window);
+    fireEvent(EventWindowDestroyed, args, EventNamespace);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::destroyPooledWindows(WindowVector& windows)
+{
+    const bool wasSuspended = d_windowPoolSuspended;
+    d_windowPoolSuspended = true;
+
+    for (WindowVector::iterator window = windows.begin(); window != windows.end(); ++window)
+    {
+        {
+            std::lock_guard<std::mutex> guard(d_registryMutex);
+            d_windowRegistry.push_back(*window);
+        }
+        destroyWindow(*window);
+    }
+
+    d_windowPoolSuspended = wasSuspended;
 }
 
 //----------------------------------------------------------------------------//
 bool WindowManager::isAlive(const Window* window) const
 {
+    std::lock_guard<std::mutex> guard(d_registryMutex);
 	WindowVector::const_iterator iter =
         std::find(d_windowRegistry.begin(),
                   d_windowRegistry.end(),
@@ -253,7 +453,23 @@ Window* WindowManager::loadLayoutFromContainer(const RawDataContainer& source, P
     // do parse (which uses handler to create actual data)
     try
     {
-        System::getSingleton().getXMLParser()->parseXML(handler, source, GUILayoutSchemaName);
+        // windows get their properties one at a time, fire the resulting
+        // size and text notifications once the layout is complete.
+        EventSet::BatchScope batch;
+
+        if (PreparsedXML::isPreparsedData(source))
+        {
+            PreparsedXML compiled;
+            if (!compiled.read(source))
+                throw FileIOException("the compiled layout is invalid or was "
+                    "written by a different version of CEGUI.");
+
+            compiled.replay(handler);
+        }
+        else
+        {
+            System::getSingleton().getXMLParser()->parseXML(handler, source, GUILayoutSchemaName);
+        }
     }
     catch (...)
     {
@@ -281,17 +497,47 @@ Window* WindowManager::loadLayoutFromFile(const String& filename, const String&
     // create handler object
     GUILayout_xmlHandler handler(callback, userdata);
 
-	// do parse (which uses handler to create actual data)
-	try
-	{
-        System::getSingleton().getXMLParser()->parseXMLFile(handler,
-            filename, GUILayoutSchemaName, resourceGroup.empty() ? d_defaultResourceGroup : resourceGroup);
-	}
-	catch (...)
-	{
-        Logger::getSingleton().logEvent("WindowManager::loadLayoutFromFile - loading of layout from file '" + filename +"' failed.", LoggingLevel::Error);
-        throw;
-	}
+    const String& group = resourceGroup.empty() ? d_defaultResourceGroup : resourceGroup;
+    ResourceProvider* const resourceProvider = System::getSingleton().getResourceProvider();
+    const String preparsedFilename(filename + PreparsedFileSuffix);
+    const bool usePreparsedFile = d_preparsedFilesEnabled &&
+        resourceProvider->isResourceAvailable(preparsedFilename, group);
+
+    if (!usePreparsedFile && !d_layoutCacheEnabled)
+    {
+        // do parse (which uses handler to create actual data)
+        try
+        {
+            EventSet::BatchScope batch;
+            System::getSingleton().getXMLParser()->parseXMLFile(handler,
+                filename, GUILayoutSchemaName, group);
+        }
+        catch (...)
+        {
+            Logger::getSingleton().logEvent("WindowManager::loadLayoutFromFile - loading of layout from file '" + filename +"' failed.", LoggingLevel::Error);
+            throw;
+        }
+    }
+    else
+    {
+        // the XML is still loaded, both to check that a compiled layout was
+        // made from it and to compile it if there is no such layout.
+        RawDataContainer xmlData;
+        resourceProvider->loadRawDataContainer(filename, xmlData, group);
+
+        try
+        {
+            buildLayout(handler, xmlData, filename, group, usePreparsedFile);
+        }
+        catch (...)
+        {
+            resourceProvider->unloadRawDataContainer(xmlData);
+            Logger::getSingleton().logEvent("WindowManager::loadLayoutFromFile - loading of layout from file '" + filename +"' failed.", LoggingLevel::Error);
+            throw;
+        }
+
+        resourceProvider->unloadRawDataContainer(xmlData);
+    }
 
     // log the completion of loading
     Logger::getSingleton().logEvent("---- Successfully completed loading of GUI layout from '" + filename + "' ----", LoggingLevel::Standard);
@@ -299,6 +545,125 @@ Window* WindowManager::loadLayoutFromFile(const String& filename, const String&
 	return handler.getLayoutRootWindow();
 }
 
+void WindowManager::loadLayoutFromFileAsync(const String& filename,
+    const String& resourceGroup, LayoutLoadedCallback callback,
+    PropertyCallback* propertyCallback, void* userdata)
+{
+    if (filename.empty())
+    {
+        throw InvalidRequestException(
+            "Filename supplied for gui-layout loading must be valid.");
+    }
+
+    const String group(resourceGroup.empty() ? d_defaultResourceGroup : resourceGroup);
+
+    System::getSingleton().getResourceProvider()->loadRawDataContainerAsync(
+        filename, group,
+        [this, filename, group, callback, propertyCallback, userdata]
+        (RawDataContainer& data, std::exception_ptr error)
+    {
+        Window* root = nullptr;
+        bool failed = static_cast<bool>(error);
+        if (!failed)
+        {
+            try
+            {
+                GUILayout_xmlHandler handler(propertyCallback, userdata);
+                buildLayout(handler, data, filename, group, false);
+                root = handler.getLayoutRootWindow();
+            }
+            catch (...)
+            {
+                failed = true;
+            }
+        }
+
+        if (failed)
+            Logger::getSingleton().logEvent("WindowManager::loadLayoutFromFileAsync - loading of layout from file '" + filename +"' failed.", LoggingLevel::Error);
+        else
+            Logger::getSingleton().logEvent("---- Successfully completed loading of GUI layout from '" + filename + "' ----", LoggingLevel::Standard);
+
+        if (callback)
+            callback(root);
+    });
+}
+
+void WindowManager::buildLayout(GUILayout_xmlHandler& handler, const RawDataContainer& xmlData,
+    const String& filename, const String& group, bool usePreparsedFile)
+{
+    // layouts a provider holds recorded, such as those of a bundle, are
+    // replayed as they are
+    if (PreparsedXML::isPreparsedData(xmlData))
+    {
+        PreparsedXML recording;
+        if (!recording.read(xmlData))
+        {
+            throw InvalidRequestException(
+                "'" + filename + "' holds a recording that can not be read.");
+        }
+
+        EventSet::BatchScope batch;
+        recording.replay(handler);
+        return;
+    }
+
+    const std::uint64_t sourceHash = PreparsedXML::computeSourceHash(xmlData);
+    const String cacheKey(group + "|" + filename);
+
+    // the cache only hands out entries that are complete and never modified
+    // again, so layouts loaded on several threads can replay them at once.
+    std::shared_ptr<const PreparsedXML> compiled;
+
+    if (d_layoutCacheEnabled)
+    {
+        std::lock_guard<std::mutex> guard(d_layoutCacheMutex);
+        const auto entry = d_layoutCache.find(cacheKey);
+        if (entry != d_layoutCache.end() && entry->second->getSourceHash() == sourceHash)
+            compiled = entry->second;
+    }
+    const bool cached = static_cast<bool>(compiled);
+
+    if (!compiled && usePreparsedFile)
+    {
+        ResourceProvider* const resourceProvider = System::getSingleton().getResourceProvider();
+        const String preparsedFilename(filename + PreparsedFileSuffix);
+        RawDataContainer preparsedData;
+        resourceProvider->loadRawDataContainer(preparsedFilename, preparsedData, group);
+        std::shared_ptr<PreparsedXML> fromFile(std::make_shared<PreparsedXML>());
+        const bool upToDate = fromFile->read(preparsedData, sourceHash);
+        resourceProvider->unloadRawDataContainer(preparsedData);
+
+        if (upToDate)
+        {
+            compiled = fromFile;
+        }
+        else
+        {
+            Logger::getSingleton().logEvent("WindowManager::loadLayoutFromFile - '" + preparsedFilename +
+                "' is outdated, parsing '" + filename + "' instead.", LoggingLevel::Warning);
+        }
+    }
+
+    if (!compiled && d_layoutCacheEnabled)
+    {
+        std::shared_ptr<PreparsedXML> recorded(std::make_shared<PreparsedXML>());
+        recorded->record(xmlData, GUILayoutSchemaName);
+        compiled = recorded;
+    }
+
+    if (compiled && !cached && d_layoutCacheEnabled)
+    {
+        std::lock_guard<std::mutex> guard(d_layoutCacheMutex);
+        d_layoutCache[cacheKey] = compiled;
+    }
+
+    EventSet::BatchScope batch;
+    if (compiled)
+        compiled->replay(handler);
+    else
+        System::getSingleton().getXMLParser()->parseXML(handler, xmlData, GUILayoutSchemaName);
+}
+
 Window* WindowManager::loadLayoutFromString(const String& source, PropertyCallback* callback, void* userdata)
 {
     // log the fact we are about to load a layout
@@ -310,6 +675,7 @@ Window* WindowManager::loadLayoutFromString(const String& source, PropertyCallba
     // do parse (which uses handler to create actual data)
     try
     {
+        EventSet::BatchScope batch;
         System::getSingleton().getXMLParser()->parseXMLString(handler, source, GUILayoutSchemaName);
     }
     catch (...)
@@ -324,6 +690,69 @@ Window* WindowManager::loadLayoutFromString(const String& source, PropertyCallba
     return handler.getLayoutRootWindow();
 }
 
+void WindowManager::writePreparsedLayoutToStream(const String& filename, OutStream& out_stream,
+                                                 const String& resourceGroup) const
+{
+    ResourceProvider* const resourceProvider = System::getSingleton().getResourceProvider();
+
+    RawDataContainer xmlData;
+    resourceProvider->loadRawDataContainer(filename, xmlData,
+        resourceGroup.empty() ? d_defaultResourceGroup : resourceGroup);
+
+    PreparsedXML compiled;
+    try
+    {
+        compiled.record(xmlData, GUILayoutSchemaName);
+    }
+    catch (...)
+    {
+        resourceProvider->unloadRawDataContainer(xmlData);
+        throw;
+    }
+
+    resourceProvider->unloadRawDataContainer(xmlData);
+    compiled.write(out_stream);
+}
+
+Window* WindowManager::createLayoutFromTemplate(const String& filename, const String& resourceGroup)
+{
+    const String& group = resourceGroup.empty() ? d_defaultResourceGroup : resourceGroup;
+    const String templateKey(group + "|" + filename);
+
+    auto tpl = d_layoutTemplates.find(templateKey);
+    if (tpl == d_layoutTemplates.end())
+    {
+        Window* const root = loadLayoutFromFile(filename, group);
+        tpl = d_layoutTemplates.emplace(templateKey, root).first;
+    }
+
+    return tpl->second->clone(true);
+}
+
+void WindowManager::destroyLayoutTemplates()
+{
+    std::unordered_map<String, Window*> templates;
+    templates.swap(d_layoutTemplates);
+
+    for (const auto& tpl : templates)
+        destroyWindow(tpl.second);
+}
+
+void WindowManager::setLayoutCacheEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> guard(d_layoutCacheMutex);
+    d_layoutCacheEnabled = enabled;
+
+    if (!enabled)
+        d_layoutCache.clear();
+}
+
+void WindowManager::clearLayoutCache()
+{
+    std::lock_guard<std::mutex> guard(d_layoutCacheMutex);
+    d_layoutCache.clear();
+}
+
 bool WindowManager::isDeadPoolEmpty(void) const
 {
     return d_deathrow.empty();
@@ -331,20 +760,64 @@ bool WindowManager::isDeadPoolEmpty(void) const
 
 void WindowManager::cleanDeadPool(void)
 {
-    WindowVector::reverse_iterator curr = d_deathrow.rbegin();
-    for (; curr != d_deathrow.rend(); ++curr)
+    if (d_deathrow.empty())
+        return;
+
+    // release the GPU resources of all the windows in one go
+    Renderer* const renderer = System::getSingleton().getRenderer();
+    const bool deferBuffers = !renderer->isGeometryBufferDestructionDeferred();
+    if (deferBuffers)
+        renderer->setGeometryBufferDestructionDeferred(true);
+
+    while (!d_deathrow.empty())
+        destroyDeadWindow();
+
+    if (deferBuffers)
+        renderer->setGeometryBufferDestructionDeferred(false);
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::cleanDeadPoolWithinBudget()
+{
+    if (d_deadPoolTimeBudget == 0)
     {
+        cleanDeadPool();
+        return;
+    }
+
+    if (d_deathrow.empty())
+        return;
+
+    Renderer* const renderer = System::getSingleton().getRenderer();
+    const bool deferBuffers = !renderer->isGeometryBufferDestructionDeferred();
+    if (deferBuffers)
+        renderer->setGeometryBufferDestructionDeferred(true);
+
+    const std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::now() + std::chrono::microseconds(d_deadPoolTimeBudget);
+
+    do
+        destroyDeadWindow();
+    while (!d_deathrow.empty() && std::chrono::steady_clock::now() < deadline);
+
+    if (deferBuffers)
+        renderer->setGeometryBufferDestructionDeferred(false);
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::destroyDeadWindow()
+{
+    // windows are destroyed in the reverse order they were added in
+    Window* const window = d_deathrow.back();
+    d_deathrow.pop_back();
+
 // in debug mode, log what gets cleaned from the dead pool (insane level)
 #if defined(DEBUG) || defined (_DEBUG)
-        CEGUI_LOGINSANE("Window '" + (*curr)->getName() + "' about to be finally destroyed from dead pool.");
+    CEGUI_LOGINSANE("Window '" + window->getName() + "' about to be finally destroyed from dead pool.");
 #endif
 
-        WindowFactory* factory = WindowFactoryManager::getSingleton().getFactory((*curr)->getType());
-        factory->destroyWindow(*curr);
-    }
-
-    // all done here, so clear all pointers from dead pool
-    d_deathrow.clear();
+    WindowFactory* factory = WindowFactoryManager::getSingleton().getFactory(window->getType());
+    factory->destroyWindow(window);
 }
 
 void WindowManager::writeLayoutToStream(const Window& window, OutStream& out_stream) const
@@ -386,6 +859,7 @@ void WindowManager::saveLayoutToFile(const Window& window,
 
 String WindowManager::generateUniqueWindowName()
 {
+    std::lock_guard<std::mutex> guard(d_registryMutex);
     const String ret = GeneratedWindowNameBase +
         PropertyHelper<std::uint32_t>::toString(d_uid_counter);
 
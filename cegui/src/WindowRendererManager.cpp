@@ -25,6 +25,7 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/WindowRendererManager.h"
+#include "CEGUI/FactoryModule.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/SharedStringStream.h"
@@ -115,7 +116,28 @@ WindowRendererManager::~WindowRendererManager()
 *************************************************************************/
 bool WindowRendererManager::isFactoryPresent(const String& name) const
 {
-    return (d_wrReg.find(name) != d_wrReg.end());
+    {
+        SharedLock guard(d_registryMutex);
+        if (d_wrReg.find(name) != d_wrReg.end())
+            return true;
+    }
+
+    std::lock_guard<std::recursive_mutex> guard(d_lazyModulesMutex);
+    for (std::vector<FactoryModule*>::const_iterator i = d_lazyModules.begin();
+         i != d_lazyModules.end(); ++i)
+    {
+        if ((*i)->isFactoryAvailable(name))
+            return true;
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool WindowRendererManager::isFactoryRegistered(const String& name) const
+{
+    SharedLock guard(d_registryMutex);
+    return d_wrReg.find(name) != d_wrReg.end();
 }
 
 /*************************************************************************
@@ -123,11 +145,18 @@ bool WindowRendererManager::isFactoryPresent(const String& name) const
 *************************************************************************/
 WindowRendererFactory* WindowRendererManager::getFactory(const String& name) const
 {
-    WR_Registry::const_iterator i = d_wrReg.find(name);
-    if (i != d_wrReg.end())
     {
-        return (*i).second;
+        SharedLock guard(d_registryMutex);
+        WR_Registry::const_iterator i = d_wrReg.find(name);
+        if (i != d_wrReg.end())
+        {
+            return (*i).second;
+        }
     }
+
+    if (addLazyFactory(name))
+        return getFactory(name);
+
     throw UnknownObjectException("There is no WindowRendererFactory named '"+name+"' available");
 }
 
@@ -140,9 +169,12 @@ void WindowRendererManager::addFactory(WindowRendererFactory* wr)
     {
         return;
     }
-    if (d_wrReg.insert(std::make_pair(wr->getName(), wr)).second == false)
     {
-        throw AlreadyExistsException("A WindowRendererFactory named '"+wr->getName()+"' already exist");
+        std::lock_guard<SharedMutex> guard(d_registryMutex);
+        if (d_wrReg.insert(std::make_pair(wr->getName(), wr)).second == false)
+        {
+            throw AlreadyExistsException("A WindowRendererFactory named '"+wr->getName()+"' already exist");
+        }
     }
 
     String addressStr = SharedStringstream::GetPointerAddressAsString(wr);
@@ -171,7 +203,10 @@ void WindowRendererManager::removeFactory(const String& name)
 
     String addressStr = SharedStringstream::GetPointerAddressAsString((*i).second);
 
-    d_wrReg.erase(name);
+    {
+        std::lock_guard<SharedMutex> guard(d_registryMutex);
+        d_wrReg.erase(name);
+    }
 
     Logger::getSingleton().logEvent("WindowRendererFactory for '" + name +
                                     "' WindowRenderers removed. " + addressStr);
@@ -188,6 +223,44 @@ void WindowRendererManager::removeFactory(const String& name)
     }
 }
 
+//----------------------------------------------------------------------------//
+void WindowRendererManager::addLazyFactoryModule(FactoryModule& module)
+{
+    std::lock_guard<std::recursive_mutex> guard(d_lazyModulesMutex);
+    d_lazyModules.push_back(&module);
+}
+
+//----------------------------------------------------------------------------//
+void WindowRendererManager::removeLazyFactoryModule(FactoryModule& module)
+{
+    std::lock_guard<std::recursive_mutex> guard(d_lazyModulesMutex);
+
+    // a module shared by several schemes is listed once for each of them
+    std::vector<FactoryModule*>::iterator i =
+        std::find(d_lazyModules.begin(), d_lazyModules.end(), &module);
+    if (i != d_lazyModules.end())
+        d_lazyModules.erase(i);
+}
+
+//----------------------------------------------------------------------------//
+bool WindowRendererManager::addLazyFactory(const String& name) const
+{
+    // held while the factory is added, so it is only added once
+    std::lock_guard<std::recursive_mutex> guard(d_lazyModulesMutex);
+
+    for (std::vector<FactoryModule*>::const_iterator i = d_lazyModules.begin();
+         i != d_lazyModules.end(); ++i)
+    {
+        if ((*i)->isFactoryAvailable(name))
+        {
+            (*i)->registerFactory(name);
+            return true;
+        }
+    }
+
+    return false;
+}
+
 /*************************************************************************
     Create a WindowRenderer instance by factory name
 *************************************************************************/
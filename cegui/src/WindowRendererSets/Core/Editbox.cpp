@@ -33,7 +33,11 @@
 #include "CEGUI/Font.h"
 #include "CEGUI/BidiVisualMapping.h"
 #include "CEGUI/TplWindowRendererProperty.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/GeometryCache.h"
 
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
 #include <stdio.h>
 
 // Start of CEGUI namespace section
@@ -449,15 +453,123 @@ bool FalagardEditbox::editboxIsReadOnly() const
 void FalagardEditbox::renderCaret(const ImagerySection& imagery,
                                   const Rectf& text_area,
                                   const float text_offset,
-                                  const float extent_to_caret) const
+                                  const float extent_to_caret)
 {
-    if ((!d_blinkCaret || d_showCaret) && editboxIsFocussed() && !editboxIsReadOnly())
+    d_caretBuffers.clear();
+
+    if (!editboxIsFocussed() || editboxIsReadOnly())
+        return;
+
+    Rectf caretRect(text_area);
+    caretRect.d_min.x += extent_to_caret + text_offset;
+
+    // in-place render effects own the transform of the buffers, so the caret
+    // is only drawn while it is shown.
+    if (d_window->getInPlaceRenderEffect())
     {
-        Rectf caretRect(text_area);
-        caretRect.d_min.x += extent_to_caret + text_offset;
+        if (!d_blinkCaret || d_showCaret)
+            imagery.render(*d_window, caretRect, nullptr, &text_area);
+        return;
+    }
 
+    // the caret is drawn even while blinked off and is shown, hidden and
+    // moved through the transform of its buffers, so that doing so does not
+    // redraw the text. The geometry is kept out of the geometry cache of the
+    // window, as the buffers are modified.
+    std::vector<GeometryBuffer*>& buffers = d_window->getGeometryBuffers();
+    const size_t firstBuffer = buffers.size();
+
+    GeometryCache& cache = d_window->getGeometryCache();
+    const size_t cacheCapacity = cache.getCapacity();
+    cache.setCapacity(0);
+    try
+    {
         imagery.render(*d_window, caretRect, nullptr, &text_area);
     }
+    catch (...)
+    {
+        cache.setCapacity(cacheCapacity);
+        throw;
+    }
+    cache.setCapacity(cacheCapacity);
+
+    d_caretBuffers.assign(buffers.begin() + firstBuffer, buffers.end());
+    d_caretRenderedRect = caretRect;
+    d_caretRect = caretRect;
+    updateCaretTransform();
+}
+
+//----------------------------------------------------------------------------//
+bool FalagardEditbox::isCaretMovable(const ImagerySection& imagery,
+                                     const Rectf& text_area,
+                                     const Rectf& caret_rect) const
+{
+    // the caret geometry is clipped to the text area when it is created, so
+    // it can only be moved while it is not clipped, at either position.
+    const Rectf renderedArea(imagery.getBoundingRect(*d_window, d_caretRenderedRect));
+    const Rectf area(imagery.getBoundingRect(*d_window, caret_rect));
+
+    return renderedArea.getSize() == area.getSize() &&
+           text_area.getIntersection(renderedArea) == renderedArea &&
+           text_area.getIntersection(area) == area;
+}
+
+//----------------------------------------------------------------------------//
+void FalagardEditbox::updateCaretTransform()
+{
+    const glm::mat4 transform = (!d_blinkCaret || d_showCaret) ?
+        glm::translate(glm::mat4(1.0f),
+                       glm::vec3(d_caretRect.d_min - d_caretRenderedRect.d_min, 0.0f)) :
+        glm::scale(glm::mat4(1.0f), glm::vec3(0.0f));
+
+    for (GeometryBuffer* buffer : d_caretBuffers)
+        buffer->setCustomTransform(transform);
+}
+
+//----------------------------------------------------------------------------//
+bool FalagardEditbox::updateCaretGeometry()
+{
+    if (d_caretBuffers.empty())
+        return false;
+
+    // the buffers are recycled when the window is redrawn
+    const std::vector<GeometryBuffer*>& buffers = d_window->getGeometryBuffers();
+    for (GeometryBuffer* buffer : d_caretBuffers)
+    {
+        if (std::find(buffers.begin(), buffers.end(), buffer) == buffers.end())
+            return false;
+    }
+
+    const Font* font = d_window->getActualFont();
+    if (!font)
+        return false;
+
+    String visual_text;
+    setupVisualString(visual_text);
+
+    const WidgetLookFeel& wlf = getLookNFeel();
+    const ImagerySection& caret_imagery = wlf.getImagerySection("Caret");
+
+    const Rectf text_area(wlf.getNamedArea("TextArea").getArea().getPixelRect(*d_window));
+    const size_t caret_index = getCaretIndex(visual_text);
+    const float caret_width = caret_imagery.getBoundingRect(*d_window, text_area).getWidth();
+    const float text_extent = font->getTextExtent(visual_text);
+    const float extent_to_caret_visual = font->getTextAdvance(visual_text.substr(0, caret_index));
+    const float extent_to_caret_logical = extentToCarretLogical(extent_to_caret_visual, text_extent, caret_width);
+
+    // the text scrolls when the caret leaves the text area, which needs a redraw
+    if (calculateTextOffset(text_area, text_extent, caret_width, extent_to_caret_logical) != d_lastTextOffset)
+        return false;
+
+    Rectf caretRect(text_area);
+    caretRect.d_min.x += extent_to_caret_visual + textOffsetVisual(text_area, text_extent);
+
+    if (!isCaretMovable(caret_imagery, text_area, caretRect))
+        return false;
+
+    d_caretRect = caretRect;
+    updateCaretTransform();
+    return true;
 }
 
 //----------------------------------------------------------------------------//
@@ -500,6 +612,15 @@ void FalagardEditbox::setColourRectToOptionalPropertyColour(
         colour_rect.setColours(0);
 }
 
+//----------------------------------------------------------------------------//
+bool FalagardEditbox::isUpdateRequired() const
+{
+    // the caret only blinks while the text can be edited
+    return d_blinkCaret &&
+        !static_cast<Editbox*>(d_window)->isReadOnly() &&
+        static_cast<Editbox*>(d_window)->hasInputFocus();
+}
+
 //----------------------------------------------------------------------------//
 void FalagardEditbox::update(float elapsed)
 {
@@ -517,8 +638,8 @@ void FalagardEditbox::update(float elapsed)
         {
             d_caretBlinkElapsed = 0.0f;
             d_showCaret ^= true;
-            // state changed, so need a redraw
-            d_window->invalidate();
+            // state changed, so the caret needs a redraw
+            static_cast<Editbox*>(d_window)->invalidateCaret();
         }
     }
 }
@@ -539,6 +660,9 @@ float FalagardEditbox::getCaretBlinkTimeout() const
 void FalagardEditbox::setCaretBlinkEnabled(bool enable)
 {
     d_blinkCaret = enable;
+
+    if (enable && d_window)
+        d_window->requestUpdates();
 }
 
 //----------------------------------------------------------------------------//
@@ -588,6 +712,14 @@ bool FalagardEditbox::handleFontRenderSizeChange(const Font* const font)
     return res;
 }
 
+//----------------------------------------------------------------------------//
+void FalagardEditbox::onDetach()
+{
+    d_caretBuffers.clear();
+
+    EditboxWindowRenderer::onDetach();
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
@@ -70,6 +70,8 @@ void FalagardListView::createRenderGeometry(ListView* list_view)
 {
     Rectf items_area(getViewRenderArea());
     glm::vec2 item_pos(getItemRenderStartPosition(list_view, items_area));
+    // virtualised lists only hold the items around the visible area
+    item_pos.y += list_view->getItemsOffset();
 
     for (size_t i = 0; i < list_view->getItems().size(); ++i)
     {
@@ -51,6 +51,7 @@
 #include "CEGUI/WindowRendererSets/Core/StaticText.h"
 #include "CEGUI/WindowRendererSets/Core/TabButton.h"
 #include "CEGUI/WindowRendererSets/Core/TabControl.h"
+#include "CEGUI/WindowRendererSets/Core/TableView.h"
 #include "CEGUI/WindowRendererSets/Core/Titlebar.h"
 #include "CEGUI/WindowRendererSets/Core/ToggleButton.h"
 #include "CEGUI/WindowRendererSets/Core/Tooltip.h"
@@ -91,6 +92,7 @@ CoreWindowRendererModule::CoreWindowRendererModule()
     d_registry.push_back(new TplWRFactoryRegisterer<FalagardStaticText>());
     d_registry.push_back(new TplWRFactoryRegisterer<FalagardTabButton>());
     d_registry.push_back(new TplWRFactoryRegisterer<FalagardTabControl>());
+    d_registry.push_back(new TplWRFactoryRegisterer<FalagardTableView>());
     d_registry.push_back(new TplWRFactoryRegisterer<FalagardTitlebar>());
     d_registry.push_back(new TplWRFactoryRegisterer<FalagardToggleButton>());
     d_registry.push_back(new TplWRFactoryRegisterer<FalagardTooltip>());
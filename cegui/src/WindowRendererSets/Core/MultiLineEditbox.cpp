@@ -33,6 +33,11 @@
 #include "CEGUI/Image.h"
 #include "CEGUI/Font.h"
 #include "CEGUI/TplWindowRendererProperty.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/GeometryCache.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -127,44 +132,129 @@ void FalagardMultiLineEditbox::cacheEditboxBaseImagery()
     imagery->render(*w);
 }
 
-void FalagardMultiLineEditbox::cacheCaretImagery(const Rectf& textArea)
+bool FalagardMultiLineEditbox::getCaretArea(const Rectf& textArea, Rectf& caretArea) const
 {
     MultiLineEditbox* w = static_cast<MultiLineEditbox*>(d_window);
     const Font* fnt = w->getActualFont();
 
     // require a font so that we can calculate caret position.
-    if (fnt)
-    {
-        // get line that caret is in
-        size_t caretLine = w->getLineNumberFromIndex(w->getCaretIndex());
+    if (!fnt)
+        return false;
 
-        const MultiLineEditbox::LineList& d_lines = w->getFormattedLines();
+    // get line that caret is in
+    size_t caretLine = w->getLineNumberFromIndex(w->getCaretIndex());
 
-        // if caret line is valid.
-        if (caretLine < d_lines.size())
-        {
-            // calculate pixel offsets to where caret should be drawn
-            size_t caretLineIdx = w->getCaretIndex() - d_lines[caretLine].d_startIdx;
-            float ypos = caretLine * fnt->getLineSpacing();
-            float xpos = fnt->getTextAdvance(w->getText().substr(d_lines[caretLine].d_startIdx, caretLineIdx));
-
-            // get WidgetLookFeel for the assigned look.
-            const WidgetLookFeel& wlf = getLookNFeel();
-            // get caret imagery
-            const ImagerySection& caretImagery = wlf.getImagerySection("Caret");
-
-            // calculate finat destination area for caret
-            Rectf caretArea;
-            caretArea.left(textArea.left() + xpos);
-            caretArea.top(textArea.top() + ypos);
-            caretArea.setWidth(caretImagery.getBoundingRect(*w).getSize().d_width);
-            caretArea.setHeight(fnt->getLineSpacing());
-            caretArea.offset(-glm::vec2(w->getHorzScrollbar()->getScrollPosition(), w->getVertScrollbar()->getScrollPosition()));
-
-            // Create the render geometry for the caret image
+    const MultiLineEditbox::LineList& d_lines = w->getFormattedLines();
+
+    // if caret line is valid.
+    if (caretLine >= d_lines.size())
+        return false;
+
+    // calculate pixel offsets to where caret should be drawn
+    size_t caretLineIdx = w->getCaretIndex() - d_lines[caretLine].d_startIdx;
+    float ypos = caretLine * fnt->getLineSpacing();
+    float xpos = fnt->getTextAdvance(w->getText().substr(d_lines[caretLine].d_startIdx, caretLineIdx));
+
+    // get caret imagery
+    const ImagerySection& caretImagery = getLookNFeel().getImagerySection("Caret");
+
+    // calculate finat destination area for caret
+    caretArea.left(textArea.left() + xpos);
+    caretArea.top(textArea.top() + ypos);
+    caretArea.setWidth(caretImagery.getBoundingRect(*w).getSize().d_width);
+    caretArea.setHeight(fnt->getLineSpacing());
+    caretArea.offset(-glm::vec2(w->getHorzScrollbar()->getScrollPosition(), w->getVertScrollbar()->getScrollPosition()));
+
+    return true;
+}
+
+void FalagardMultiLineEditbox::cacheCaretImagery(const Rectf& textArea)
+{
+    d_caretBuffers.clear();
+
+    Rectf caretArea;
+    if (!getCaretArea(textArea, caretArea))
+        return;
+
+    MultiLineEditbox* w = static_cast<MultiLineEditbox*>(d_window);
+    const ImagerySection& caretImagery = getLookNFeel().getImagerySection("Caret");
+
+    // in-place render effects own the transform of the buffers, so the caret
+    // is only drawn while it is shown.
+    if (w->getInPlaceRenderEffect())
+    {
+        if (!d_blinkCaret || d_showCaret)
             caretImagery.render(*w, caretArea, nullptr, &textArea);
-        }
+        return;
+    }
+
+    // the caret is drawn even while blinked off and is shown, hidden and
+    // moved through the transform of its buffers, so that doing so does not
+    // redraw the text. The geometry is kept out of the geometry cache of the
+    // window, as the buffers are modified.
+    std::vector<GeometryBuffer*>& buffers = w->getGeometryBuffers();
+    const size_t firstBuffer = buffers.size();
+
+    GeometryCache& cache = w->getGeometryCache();
+    const size_t cacheCapacity = cache.getCapacity();
+    cache.setCapacity(0);
+    try
+    {
+        caretImagery.render(*w, caretArea, nullptr, &textArea);
+    }
+    catch (...)
+    {
+        cache.setCapacity(cacheCapacity);
+        throw;
+    }
+    cache.setCapacity(cacheCapacity);
+
+    d_caretBuffers.assign(buffers.begin() + firstBuffer, buffers.end());
+    d_caretRenderedArea = caretArea;
+    d_caretArea = caretArea;
+    updateCaretTransform();
+}
+
+bool FalagardMultiLineEditbox::isCaretMovable(const Rectf& textArea, const Rectf& caretArea) const
+{
+    // the caret geometry is clipped to the text area when it is created, so
+    // it can only be moved while it is not clipped, at either position.
+    return textArea.getIntersection(d_caretRenderedArea) == d_caretRenderedArea &&
+           textArea.getIntersection(caretArea) == caretArea;
+}
+
+void FalagardMultiLineEditbox::updateCaretTransform()
+{
+    const glm::mat4 transform = (!d_blinkCaret || d_showCaret) ?
+        glm::translate(glm::mat4(1.0f),
+                       glm::vec3(d_caretArea.d_min - d_caretRenderedArea.d_min, 0.0f)) :
+        glm::scale(glm::mat4(1.0f), glm::vec3(0.0f));
+
+    for (GeometryBuffer* buffer : d_caretBuffers)
+        buffer->setCustomTransform(transform);
+}
+
+bool FalagardMultiLineEditbox::updateCaretGeometry()
+{
+    if (d_caretBuffers.empty())
+        return false;
+
+    // the buffers are recycled when the window is redrawn
+    const std::vector<GeometryBuffer*>& buffers = d_window->getGeometryBuffers();
+    for (GeometryBuffer* buffer : d_caretBuffers)
+    {
+        if (std::find(buffers.begin(), buffers.end(), buffer) == buffers.end())
+            return false;
     }
+
+    const Rectf textArea(getTextRenderArea());
+    Rectf caretArea;
+    if (!getCaretArea(textArea, caretArea) || !isCaretMovable(textArea, caretArea))
+        return false;
+
+    d_caretArea = caretArea;
+    updateCaretTransform();
+    return true;
 }
 
 void FalagardMultiLineEditbox::createRenderGeometry()
@@ -178,9 +268,9 @@ void FalagardMultiLineEditbox::createRenderGeometry()
     cacheTextLines(textarea);
 
     // Create the render geometry for the caret
-    if ((w->hasInputFocus() && !w->isReadOnly()) &&
-        (!d_blinkCaret || d_showCaret))
-            cacheCaretImagery(textarea);
+    d_caretBuffers.clear();
+    if (w->hasInputFocus() && !w->isReadOnly())
+        cacheCaretImagery(textarea);
 }
 
 void FalagardMultiLineEditbox::cacheTextLines(const Rectf& dest_area)
@@ -224,8 +314,16 @@ void FalagardMultiLineEditbox::cacheTextLines(const Rectf& dest_area)
     // for each formatted line.
     for (size_t i = sidx; i < eidx; ++i)
     {
-        Rectf lineRect(drawArea);
         const MultiLineEditbox::LineInfo& currLine = d_lines[i];
+
+        // skip lines scrolled out of view horizontally
+        if (drawArea.left() + currLine.d_extent < dest_area.left())
+        {
+            drawArea.d_min.y += fnt->getLineSpacing();
+            continue;
+        }
+
+        Rectf lineRect(drawArea);
         String lineText(w->getTextVisual().substr(currLine.d_startIdx, currLine.d_length));
 
 #if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
@@ -406,6 +504,15 @@ void FalagardMultiLineEditbox::setColourRectToOptionalPropertyColour(
         colour_rect.setColours(0);
 }
 
+//----------------------------------------------------------------------------//
+bool FalagardMultiLineEditbox::isUpdateRequired() const
+{
+    // the caret only blinks while the text can be edited
+    return d_blinkCaret &&
+        !static_cast<MultiLineEditbox*>(d_window)->isReadOnly() &&
+        static_cast<MultiLineEditbox*>(d_window)->hasInputFocus();
+}
+
 //----------------------------------------------------------------------------//
 void FalagardMultiLineEditbox::update(float elapsed)
 {
@@ -423,8 +530,8 @@ void FalagardMultiLineEditbox::update(float elapsed)
         {
             d_caretBlinkElapsed = 0.0f;
             d_showCaret ^= true;
-            // state changed, so need a redraw
-            d_window->invalidate();
+            // state changed, so the caret needs a redraw
+            static_cast<MultiLineEditbox*>(d_window)->invalidateCaret();
         }
     }
 }
@@ -445,6 +552,9 @@ float FalagardMultiLineEditbox::getCaretBlinkTimeout() const
 void FalagardMultiLineEditbox::setCaretBlinkEnabled(bool enable)
 {
     d_blinkCaret = enable;
+
+    if (enable && d_window)
+        d_window->requestUpdates();
 }
 
 //----------------------------------------------------------------------------//
@@ -468,4 +578,12 @@ bool FalagardMultiLineEditbox::handleFontRenderSizeChange(const Font* const font
     return res;
 }
 
+//----------------------------------------------------------------------------//
+void FalagardMultiLineEditbox::onDetach()
+{
+    d_caretBuffers.clear();
+
+    MultiLineEditboxWindowRenderer::onDetach();
+}
+
 } // End of  CEGUI namespace section
@@ -30,6 +30,12 @@
 #include "CEGUI/widgets/ProgressBar.h"
 #include "CEGUI/CoordConverter.h"
 #include "CEGUI/TplWindowRendererProperty.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/GeometryBufferPool.h"
+#include "CEGUI/GeometryCache.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include <algorithm>
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -37,7 +43,7 @@ namespace CEGUI
     const String FalagardProgressBar::TypeName("Core/ProgressBar");
 
     FalagardProgressBar::FalagardProgressBar(const String& type) :
-        WindowRenderer(type, "ProgressBar"),
+        ProgressBarWindowRenderer(type),
         d_vertical(false),
         d_reversed(false)
     {
@@ -53,6 +59,11 @@ namespace CEGUI
         false);
     }
 
+    FalagardProgressBar::~FalagardProgressBar()
+    {
+        destroyProgressTemplates();
+    }
+
     void FalagardProgressBar::createRenderGeometry()
     {
         const StateImagery* imagery;
@@ -68,12 +79,132 @@ namespace CEGUI
         imagery = &wlf.getStateImagery(d_window->isEffectiveDisabled() ? "DisabledProgress" : "EnabledProgress");
 
         // get target rect for this imagery
-        Rectf progressRect(wlf.getNamedArea("ProgressArea").getArea().getPixelRect(*d_window));
+        d_progressRect = wlf.getNamedArea("ProgressArea").getArea().getPixelRect(*d_window);
+
+        // Draw the whole progress imagery and clip it to the progress
+        // afterwards, so that it can be clipped again when the progress changes.
+        std::vector<GeometryBuffer*>& buffers = d_window->getGeometryBuffers();
+        const size_t firstBuffer = buffers.size();
+        renderProgressImagery(*imagery, d_progressRect);
+
+        destroyProgressTemplates();
+        d_progressBuffers.assign(buffers.begin() + firstBuffer, buffers.end());
+        if (createProgressTemplates())
+        {
+            clipProgressGeometry();
+            return;
+        }
+
+        // geometry we can't copy is drawn clipped right away instead
+        for (GeometryBuffer* buffer : d_progressBuffers)
+            buffer->reset();
+        d_progressBuffers.clear();
+
+        renderProgressImagery(*imagery, getProgressClipper(d_progressRect));
+    }
+
+    void FalagardProgressBar::renderProgressImagery(const StateImagery& imagery, const Rectf& clipper)
+    {
+        // the geometry changes along with the progress, so it is kept out of
+        // the geometry cache of the window.
+        GeometryCache& cache = d_window->getGeometryCache();
+        const size_t cacheCapacity = cache.getCapacity();
+        cache.setCapacity(0);
+        try
+        {
+            imagery.render(*d_window, d_progressRect, nullptr, &clipper);
+        }
+        catch (...)
+        {
+            cache.setCapacity(cacheCapacity);
+            throw;
+        }
+        cache.setCapacity(cacheCapacity);
+    }
+
+    bool FalagardProgressBar::createProgressTemplates()
+    {
+        Renderer* renderer = System::getSingleton().getRenderer();
+        GeometryBufferPool* pool = renderer->getActiveGeometryBufferPool();
+        if (!pool)
+            return false;
+
+        std::vector<DefaultShaderType> shaderTypes(d_progressBuffers.size());
+        for (size_t i = 0; i < d_progressBuffers.size(); ++i)
+        {
+            if (!pool->getIssuedShaderType(*d_progressBuffers[i], shaderTypes[i]))
+                return false;
+        }
+
+        // the copies are ours and must not be recycled by the pool
+        renderer->setActiveGeometryBufferPool(nullptr);
+        for (size_t i = 0; i < d_progressBuffers.size(); ++i)
+        {
+            GeometryBuffer& copy = shaderTypes[i] == DefaultShaderType::Solid ?
+                renderer->createGeometryBufferColoured() :
+                renderer->createGeometryBufferTextured(shaderTypes[i]);
+
+            copy.copyGeometryFrom(*d_progressBuffers[i]);
+            d_progressTemplates.push_back(&copy);
+        }
+        renderer->setActiveGeometryBufferPool(pool);
 
+        return true;
+    }
+
+    void FalagardProgressBar::destroyProgressTemplates()
+    {
+        Renderer* renderer = System::getSingletonPtr() ?
+            System::getSingleton().getRenderer() : nullptr;
+
+        for (GeometryBuffer* buffer : d_progressTemplates)
+        {
+            if (renderer)
+                renderer->destroyGeometryBuffer(*buffer);
+        }
+
+        d_progressTemplates.clear();
+    }
+
+    bool FalagardProgressBar::updateProgressGeometry()
+    {
+        if (d_progressBuffers.empty())
+            return false;
+
+        // the buffers are recycled when the window is redrawn
+        const std::vector<GeometryBuffer*>& buffers = d_window->getGeometryBuffers();
+        for (GeometryBuffer* buffer : d_progressBuffers)
+        {
+            if (std::find(buffers.begin(), buffers.end(), buffer) == buffers.end())
+                return false;
+        }
+
+        clipProgressGeometry();
+        return true;
+    }
+
+    void FalagardProgressBar::onDetach()
+    {
+        d_progressBuffers.clear();
+        destroyProgressTemplates();
+
+        ProgressBarWindowRenderer::onDetach();
+    }
+
+    void FalagardProgressBar::clipProgressGeometry()
+    {
+        const Rectf progressClipper(getProgressClipper(d_progressRect));
+
+        for (size_t i = 0; i < d_progressBuffers.size(); ++i)
+            d_progressBuffers[i]->copyClippedGeometryFrom(*d_progressTemplates[i], progressClipper);
+    }
+
+    Rectf FalagardProgressBar::getProgressClipper(const Rectf& progressRect) const
+    {
         // calculate a clipper according to the current progress.
         Rectf progressClipper(progressRect);
 
-        ProgressBar* w = static_cast<ProgressBar*>(d_window);
+        const ProgressBar* w = static_cast<const ProgressBar*>(d_window);
         if (d_vertical)
         {
             float height = CoordConverter::alignToPixels(progressClipper.getHeight() * w->getProgress());
@@ -101,8 +232,7 @@ namespace CEGUI
             }
         }
 
-        // peform the rendering operation.
-        imagery->render(*d_window, progressRect, nullptr, &progressClipper);
+        return progressClipper;
     }
 
     bool FalagardProgressBar::isVertical() const
@@ -269,7 +269,8 @@ void FalagardStaticText::adjustSizeToContent()
     getVertScrollbarWithoutUpdate()->hide();
     if (isWordWrapOn())
     {
-        LeftAlignedRenderedString orig_str(d_formattedRenderedString->getRenderedString());
+        // NB: the formatter might not have been created yet
+        LeftAlignedRenderedString orig_str(d_window->getRenderedString());
         USize size_func(UDim(-1.f, -1.f), UDim(-1.f, -1.f));
         size_func.d_width = getWindow()->getElementWidthLowerBoundAsFuncOfWidthOfAreaReservedForContent();
         size_func.d_height = getWindow()->getElementHeightLowerBoundAsFuncOfHeightOfAreaReservedForContent();
@@ -283,7 +284,8 @@ void FalagardStaticText::adjustSizeToContent()
         }
         if (getWindow()->isWidthAdjustedToContent())
         {
-            adjustSizeToContent_wordWrap_notKeepingAspectRatio(size_func, content_max_width, window_max_width, epsilon);
+            adjustSizeToContent_wordWrap_notKeepingAspectRatio(
+              orig_str, size_func, content_max_width, window_max_width, epsilon);
             return;
         }
     }
@@ -1029,18 +1031,18 @@ void FalagardStaticText::adjustSizeToContent_wordWrap_keepingAspectRatio(const L
        "getNumOfTextLinesToShow().isAuto()" is false, which means we know
        exactly how many text lines we want to reserve space for, regardless of
        word-wrapping.
-    2) Adjust the window width by try-and-error, using bisection.
+    2) Adjust the window width by try-and-error, see
+       "getWindowWidthAdjustedToContent".
 ------------------------------------------------------------------------------*/
-void FalagardStaticText::adjustSizeToContent_wordWrap_notKeepingAspectRatio(
+void FalagardStaticText::adjustSizeToContent_wordWrap_notKeepingAspectRatio(const LeftAlignedRenderedString& orig_str,
   USize& size_func, float content_max_width, float window_max_width, float epsilon)
 {
     float height(getWindow()->isHeightAdjustedToContent()  ?
       size_func.d_height.d_scale*(getContentHeight()+epsilon) + size_func.d_height.d_offset  :
       getWindow()->getPixelSize().d_height);
     UDim height_as_u_dim(getWindow()->isHeightAdjustedToContent()  ?  UDim(0.f, height) : getWindow()->getHeight());
-    float window_width(getWindow()->getSizeAdjustedToContent_bisection(
-                         USize(UDim(1.f, 0.f), UDim(0.f, height)), -1.f, window_max_width)
-                       .d_width);
+    float window_width(getWindowWidthAdjustedToContent(
+                         height, content_max_width, orig_str.getVerticalExtent(getWindow()), window_max_width, epsilon));
     getWindow()->setSize(USize(UDim(0.f, window_width), height_as_u_dim), false);
 
      /* It's possible that due to a too low height we're unable to make the
@@ -1057,6 +1059,87 @@ void FalagardStaticText::adjustSizeToContent_wordWrap_notKeepingAspectRatio(
     }
 }
 
+/*----------------------------------------------------------------------------//
+    Return the minimal integer window width, for the window height "height", in
+    which the text fits (see "contentFits"). The text fits in every width above
+    that one, and it's assumed to fit in "window_max_width". The text without
+    word wrapping has the extents "content_max_width" and "content_max_height".
+
+    Instead of only halving the range of possible widths, we look at the
+    extents of the text formatted for each width we try:
+    - If it fits, word wrapping gives the same lines for every narrower width
+      that still reserves the horizontal extent of the formatted text. So we
+      go straight to the narrowest such width next, then try one below it.
+    - If it doesn't fit because of too many lines, we predict the width needed
+      for the lines that fit in the height, assuming the area covered by the
+      text stays the same.
+    A prediction that doesn't halve the range is followed by a bisection step,
+    so this never needs many more tries than bisection alone. Usually the
+    solution is found after 3-4 tries instead of about log2(window_max_width).
+------------------------------------------------------------------------------*/
+float FalagardStaticText::getWindowWidthAdjustedToContent(float height, float content_max_width,
+  float content_max_height, float window_max_width, float epsilon)
+{
+    const UDim width_func(getWindow()->getElementWidthLowerBoundAsFuncOfWidthOfAreaReservedForContent());
+    const UDim content_height_func(getWindow()->getHeightOfAreaReservedForContentLowerBoundAsFuncOfElementHeight());
+    const UDim height_as_u_dim(0.f, height);
+
+    // The text doesn't fit in "fails_width" and fits in "fits_width"
+    float fails_width(-1.f);
+    float fits_width(std::ceil(window_max_width));
+
+    // Predict the width at which the unwrapped lines, rewrapped, fill the height
+    float width(fits_width);
+    const std::size_t num_of_lines(getWindow()->getRenderedString().getLineCount());
+    const float line_height(num_of_lines ? content_max_height / num_of_lines : 0.f);
+    const float content_height(content_height_func.d_scale*height + content_height_func.d_offset);
+    if (line_height > 0.f  &&  content_height >= line_height)
+    {
+        const float max_num_of_lines(std::floor(content_height / line_height));
+        width = (content_max_width*num_of_lines/max_num_of_lines + epsilon)*width_func.d_scale + width_func.d_offset;
+    }
+
+    while (fails_width+1.f < fits_width)
+    {
+        width = std::max(fails_width+1.f, std::min(fits_width-1.f, std::ceil(width)));
+        const float range(fits_width - fails_width);
+        getWindow()->setSize(USize(UDim(0.f, width), height_as_u_dim), false);
+
+        if (contentFits())
+        {
+            const float tight_width(std::ceil(
+              (d_formattedRenderedString->getHorizontalExtent(getWindow())+epsilon)*width_func.d_scale
+              + width_func.d_offset));
+            fits_width = width;
+            width = tight_width < fits_width ? tight_width : fits_width - 1.f;
+        }
+        else
+        {
+            fails_width = width;
+            width = (fails_width+fits_width) / 2.f;
+
+            const std::size_t formatted_lines(d_formattedRenderedString->getFormattedLineCount());
+            const float formatted_height(d_formattedRenderedString->getVerticalExtent(getWindow()));
+            const Rectf text_area(getTextRenderArea());
+            const float max_num_of_lines(formatted_lines ?
+              std::floor(text_area.getHeight()*formatted_lines/formatted_height) : 0.f);
+            if (!d_formattedRenderedString->wasWordSplit()  &&  max_num_of_lines >= 1.f  &&
+                formatted_lines > max_num_of_lines)
+            {
+                width = std::min(width,
+                  (text_area.getWidth()*formatted_lines/max_num_of_lines + epsilon)*width_func.d_scale +
+                   width_func.d_offset);
+            }
+        }
+
+        // Fall back to bisection while predictions don't pay off
+        if (fits_width-fails_width > range/2.f)
+            width = (fails_width+fits_width) / 2.f;
+    }
+
+    return fits_width;
+}
+
 /*----------------------------------------------------------------------------//
     An implementation of "adjustSizeToContent" where we do the following:
 
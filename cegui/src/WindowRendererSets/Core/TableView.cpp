@@ -0,0 +1,125 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/WindowRendererSets/Core/TableView.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+#include "CEGUI/falagard/WidgetLookFeel.h"
+#include "CEGUI/widgets/Scrollbar.h"
+#include "CEGUI/RenderedString.h"
+
+#include <algorithm>
+
+namespace CEGUI
+{
+
+//----------------------------------------------------------------------------//
+const String FalagardTableView::TypeName("Core/TableView");
+
+//----------------------------------------------------------------------------//
+FalagardTableView::FalagardTableView(const String& type) :
+    ItemViewWindowRenderer(type)
+{
+}
+
+//----------------------------------------------------------------------------//
+void FalagardTableView::createRenderGeometry()
+{
+    const StateImagery* imagery;
+    const WidgetLookFeel& wlf = getLookNFeel();
+    TableView* table_view = static_cast<TableView*>(d_window);
+
+    table_view->prepareForRender();
+
+    bool has_focused_state =
+        table_view->isFocused() && wlf.isStateImageryPresent("EnabledFocused");
+    imagery = &wlf.getStateImagery(
+        table_view->isEffectiveDisabled() ? "Disabled" :
+            (has_focused_state ? "EnabledFocused" : "Enabled"));
+    imagery->render(*table_view);
+
+    createRenderGeometry(table_view);
+}
+
+//----------------------------------------------------------------------------//
+void FalagardTableView::createRenderGeometry(TableView* table_view)
+{
+    const Rectf items_area(getViewRenderArea());
+    const float row_height = table_view->getEffectiveRowHeight();
+    const float left = items_area.left() - table_view->getHorzScrollbar()->getScrollPosition();
+    const float rows_top = items_area.top() + row_height -
+        table_view->getVertScrollbar()->getScrollPosition();
+
+    Rectf header_area(items_area);
+    header_area.setHeight(std::min(row_height, items_area.getHeight()));
+    Rectf rows_area(items_area);
+    rows_area.top(header_area.bottom());
+
+    const std::vector<TableViewCellRenderingState>& headers = table_view->getHeaderCells();
+    for (size_t i = 0; i < headers.size(); ++i)
+    {
+        const TableViewCellRenderingState& cell = headers[i];
+
+        Rectf cell_rect;
+        cell_rect.left(left + table_view->getColumnOffset(cell.d_column));
+        cell_rect.top(items_area.top());
+        cell_rect.setSize(Sizef(table_view->getColumn(cell.d_column).d_width, row_height));
+
+        Rectf cell_clipper(cell_rect.getIntersection(header_area));
+        createRenderGeometryAndAddToItemView(table_view, *cell.d_string,
+            cell_rect, table_view->getActualFont(), &cell_clipper, false);
+    }
+
+    const std::vector<TableViewCellRenderingState>& cells = table_view->getCells();
+    for (size_t i = 0; i < cells.size(); ++i)
+    {
+        const TableViewCellRenderingState& cell = cells[i];
+
+        Rectf cell_rect;
+        cell_rect.left(left + table_view->getColumnOffset(cell.d_column));
+        cell_rect.top(rows_top + cell.d_row * row_height);
+        cell_rect.setSize(Sizef(table_view->getColumn(cell.d_column).d_width, row_height));
+
+        Rectf cell_clipper(cell_rect.getIntersection(rows_area));
+        if (cell_clipper.getWidth() <= 0 || cell_clipper.getHeight() <= 0)
+            continue;
+
+        createRenderGeometryAndAddToItemView(table_view, *cell.d_string,
+            cell_rect, table_view->getActualFont(), &cell_clipper, cell.d_isSelected);
+    }
+}
+
+//----------------------------------------------------------------------------//
+Rectf FalagardTableView::getViewRenderArea(void) const
+{
+    return ItemViewRenderer::getViewRenderArea(getView());
+}
+
+//----------------------------------------------------------------------------//
+void FalagardTableView::resizeViewToContent(bool fit_width, bool fit_height) const
+{
+    ItemViewRenderer::resizeViewToContent(getView(), fit_width, fit_height);
+}
+}
@@ -63,7 +63,26 @@ void FalagardTreeView::createRenderGeometry()
 
     Rectf items_area(getViewRenderArea());
     glm::vec2 item_pos(getItemRenderStartPosition(tree_view, items_area));
-    renderTreeItem(tree_view, items_area, item_pos, &tree_view->getRootItemState(), 0);
+
+    if (!tree_view->isVirtualised())
+    {
+        renderTreeItem(tree_view, items_area, item_pos, &tree_view->getRootItemState(), 0);
+        return;
+    }
+
+    // virtualised rows are a flat list starting at the first formatted row
+    const float start_x = item_pos.x;
+    item_pos.y += tree_view->getItemsOffset();
+
+    const std::vector<TreeViewItemRenderingState*>& items =
+        tree_view->getVirtualisedItems();
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        item_pos.x = start_x + getSubtreeExpanderXIndent(items[i]->d_nestedLevel);
+        renderItem(tree_view, items_area, item_pos, items[i]);
+
+        item_pos.y += std::max(items[i]->d_size.d_height, d_subtreeExpanderImagerySize.d_height);
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -71,78 +90,87 @@ void FalagardTreeView::renderTreeItem(TreeView* tree_view, const Rectf& items_ar
     glm::vec2& item_pos, const TreeViewItemRenderingState* item_to_render,
     size_t depth)
 {
-    float expander_margin = tree_view->getSubtreeExpanderMargin();
     for (size_t i = 0; i < item_to_render->d_renderedChildren.size(); ++i)
     {
         TreeViewItemRenderingState* item = item_to_render->d_renderedChildren.at(i);
-        RenderedString& rendered_string = item->d_string;
-        Sizef size(item->d_size);
-
-        // center the expander compared to the item's height
-        float half_diff = (size.d_height - d_subtreeExpanderImagerySize.d_height) / 2.0f;
+        const float indent = renderItem(tree_view, items_area, item_pos, item);
 
-        size.d_width = std::max(items_area.getWidth(), size.d_width);
-        float indent = d_subtreeExpanderImagerySize.d_width + expander_margin * 2;
-        if (item->d_totalChildCount > 0)
-        {
-            const ImagerySection* section = item->d_subtreeIsExpanded
-                ? d_subtreeCollapserImagery : d_subtreeExpanderImagery;
+        item_pos.y += std::max(item->d_size.d_height, d_subtreeExpanderImagerySize.d_height);
 
-            Rectf button_rect;
-            button_rect.left(item_pos.x + expander_margin);
-            button_rect.top(item_pos.y +
-                (half_diff > 0 ? half_diff : 0));
-            button_rect.setSize(d_subtreeExpanderImagerySize);
+        if (item->d_renderedChildren.empty())
+            continue;
 
-            Rectf button_clipper(button_rect.getIntersection(items_area));
-            section->render(*tree_view, button_rect, nullptr, &button_clipper);
+        item_pos.x += indent;
 
-            indent = button_rect.getWidth() + expander_margin * 2;
+        if (item->d_subtreeIsExpanded)
+        {
+            renderTreeItem(tree_view, items_area, item_pos, item, depth + 1);
         }
 
-        Rectf item_rect;
-        item_rect.left(item_pos.x + indent);
-        item_rect.top(item_pos.y + (half_diff < 0 ? -half_diff : 0));
-        item_rect.setSize(size);
+        item_pos.x -= indent;
+    }
+}
 
-        if (!item->d_icon.empty())
-        {
-            Image& img = ImageManager::getSingleton().get(item->d_icon);
+//----------------------------------------------------------------------------//
+float FalagardTreeView::renderItem(TreeView* tree_view, const Rectf& items_area,
+    const glm::vec2& item_pos, TreeViewItemRenderingState* item)
+{
+    float expander_margin = tree_view->getSubtreeExpanderMargin();
+    RenderedString& rendered_string = item->d_string;
+    Sizef size(item->d_size);
 
-            Rectf icon_rect(item_rect);
-            icon_rect.setWidth(size.d_height);
-            icon_rect.setHeight(size.d_height);
+    // center the expander compared to the item's height
+    float half_diff = (size.d_height - d_subtreeExpanderImagerySize.d_height) / 2.0f;
 
-            Rectf icon_clipper(icon_rect.getIntersection(items_area));
+    size.d_width = std::max(items_area.getWidth(), size.d_width);
+    float indent = d_subtreeExpanderImagerySize.d_width + expander_margin * 2;
+    if (item->d_totalChildCount > 0)
+    {
+        const ImagerySection* section = item->d_subtreeIsExpanded
+            ? d_subtreeCollapserImagery : d_subtreeExpanderImagery;
 
-            ImageRenderSettings renderSettings(
-                icon_rect, &icon_clipper,
-                true, ICON_COLOUR_RECT, 1.0f);
+        Rectf button_rect;
+        button_rect.left(item_pos.x + expander_margin);
+        button_rect.top(item_pos.y +
+            (half_diff > 0 ? half_diff : 0));
+        button_rect.setSize(d_subtreeExpanderImagerySize);
 
-            auto imgGeomBuffers = img.createRenderGeometry(renderSettings);
-            tree_view->appendGeometryBuffers(imgGeomBuffers);
+        Rectf button_clipper(button_rect.getIntersection(items_area));
+        section->render(*tree_view, button_rect, nullptr, &button_clipper);
 
-            item_rect.left(item_rect.left() + icon_rect.getWidth());
-        }
+        indent = button_rect.getWidth() + expander_margin * 2;
+    }
 
-        Rectf item_clipper(item_rect.getIntersection(items_area));
-        createRenderGeometryAndAddToItemView(tree_view, rendered_string, item_rect,
-            tree_view->getActualFont(), &item_clipper, item->d_isSelected);
+    Rectf item_rect;
+    item_rect.left(item_pos.x + indent);
+    item_rect.top(item_pos.y + (half_diff < 0 ? -half_diff : 0));
+    item_rect.setSize(size);
 
-        item_pos.y += std::max(size.d_height, d_subtreeExpanderImagerySize.d_height);
+    if (!item->d_icon.empty())
+    {
+        Image& img = ImageManager::getSingleton().get(item->d_icon);
 
-        if (item->d_renderedChildren.empty())
-            continue;
+        Rectf icon_rect(item_rect);
+        icon_rect.setWidth(size.d_height);
+        icon_rect.setHeight(size.d_height);
 
-        item_pos.x += indent;
+        Rectf icon_clipper(icon_rect.getIntersection(items_area));
 
-        if (item->d_subtreeIsExpanded)
-        {
-            renderTreeItem(tree_view, items_area, item_pos, item, depth + 1);
-        }
+        ImageRenderSettings renderSettings(
+            icon_rect, &icon_clipper,
+            true, ICON_COLOUR_RECT, 1.0f);
 
-        item_pos.x -= indent;
+        auto imgGeomBuffers = img.createRenderGeometry(renderSettings);
+        tree_view->appendGeometryBuffers(imgGeomBuffers);
+
+        item_rect.left(item_rect.left() + icon_rect.getWidth());
     }
+
+    Rectf item_clipper(item_rect.getIntersection(items_area));
+    createRenderGeometryAndAddToItemView(tree_view, rendered_string, item_rect,
+        tree_view->getActualFont(), &item_clipper, item->d_isSelected);
+
+    return indent;
 }
 
 static Sizef getImagerySize(const ImagerySection& section)
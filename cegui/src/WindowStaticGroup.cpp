@@ -0,0 +1,223 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/WindowStaticGroup.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RenderMaterial.h"
+#include "CEGUI/RenderingContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/RenderingSurface.h"
+#include "CEGUI/System.h"
+
+#include <algorithm>
+#include <limits>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+WindowStaticGroup::WindowStaticGroup(Window& owner) :
+    d_owner(owner),
+    d_lastBufferCombined(false),
+    d_drawModeMask(0),
+    d_valid(false)
+{
+}
+
+//----------------------------------------------------------------------------//
+WindowStaticGroup::~WindowStaticGroup()
+{
+    clear();
+}
+
+//----------------------------------------------------------------------------//
+bool WindowStaticGroup::draw(const RenderingContext& ctx, std::uint32_t drawModeMask)
+{
+    if ((!d_valid || d_drawModeMask != drawModeMask) && !rebuild(ctx, drawModeMask))
+        return false;
+
+    ctx.surface->addGeometryBuffers(ctx.queue, d_buffers);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool WindowStaticGroup::rebuild(const RenderingContext& ctx, std::uint32_t drawModeMask)
+{
+    clear();
+
+    if (!isFlattenable(d_owner, ctx))
+        return false;
+
+    // windows changing while being buffered invalidate the group again
+    d_valid = true;
+    d_drawModeMask = drawModeMask;
+
+    addWindow(d_owner, ctx, drawModeMask);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool WindowStaticGroup::isFlattenable(const Window& wnd, const RenderingContext& ctx) const
+{
+    for (const Window* child : wnd.d_drawList)
+    {
+        if (!child->isEffectiveVisible())
+            continue;
+
+        // the subtree must draw to where the owner draws
+        RenderingContext childCtx;
+        child->getRenderingContext(childCtx);
+        if (child->d_surface || childCtx.surface != ctx.surface || childCtx.queue != ctx.queue)
+            return false;
+
+        if (!isFlattenable(*child, ctx))
+            return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void WindowStaticGroup::addWindow(Window& wnd, const RenderingContext& ctx,
+                                  std::uint32_t drawModeMask)
+{
+    if (&wnd != &d_owner)
+    {
+        if (!wnd.isEffectiveVisible())
+        {
+            wnd.d_drawnSurfaceArea = Rectf(0, 0, 0, 0);
+            return;
+        }
+
+        // same as Window::draw, all windows of the group share the owner's context
+        wnd.d_drawnSurfaceArea = wnd.getSurfaceArea(ctx);
+    }
+
+    if (wnd.checkIfDrawMaskAllowsDrawing(drawModeMask))
+    {
+        wnd.prepareGeometry(ctx, drawModeMask);
+
+        for (GeometryBuffer* buffer : wnd.d_geometryBuffers)
+            addBuffer(*buffer, wnd.d_translation);
+    }
+
+    for (Window* child : wnd.d_drawList)
+        addWindow(*child, ctx, drawModeMask);
+}
+
+//----------------------------------------------------------------------------//
+void WindowStaticGroup::addBuffer(GeometryBuffer& buffer, const glm::vec3& translation)
+{
+    if (!buffer.getVertexCount() && !buffer.getQuadInstanceCount())
+        return;
+
+    if (!buffer.isMergeable() || !isWithinClippingRegions(buffer, translation))
+    {
+        d_buffers.push_back(&buffer);
+        d_lastBufferCombined = false;
+        return;
+    }
+
+    if (!d_lastBufferCombined || !d_buffers.back()->isMergeableWith(buffer))
+    {
+        // the combined buffer gets a material of its own, as the ones of
+        // the windows are modified when they are refilled.
+        Renderer& renderer = *System::getSingleton().getRenderer();
+        RefCounted<RenderMaterial> material(new RenderMaterial(
+            const_cast<ShaderWrapper*>(buffer.getRenderMaterial()->getShaderWrapper())));
+
+        const bool textured = buffer.getVertexAttributeElementCount() > 7;
+        GeometryBuffer& combined = textured ?
+            renderer.createGeometryBufferTextured(material) :
+            renderer.createGeometryBufferColoured(material);
+
+        combined.setClipRegion(d_owner.d_clipRegion);
+        combined.setClippingActive(true);
+
+        d_combinedBuffers.push_back(&combined);
+        d_buffers.push_back(&combined);
+        d_lastBufferCombined = true;
+    }
+
+    d_buffers.back()->appendMergedGeometryFrom(buffer);
+}
+
+//----------------------------------------------------------------------------//
+bool WindowStaticGroup::isWithinClippingRegions(const GeometryBuffer& buffer,
+                                                const glm::vec3& translation) const
+{
+    // positions are the first attribute of every vertex
+    const std::vector<float>& vertexData = buffer.getVertexData();
+    const std::size_t stride = buffer.getVertexAttributeElementCount();
+    if (!stride)
+        return false;
+
+    float minX = std::numeric_limits<float>::max();
+    float minY = std::numeric_limits<float>::max();
+    float maxX = std::numeric_limits<float>::lowest();
+    float maxY = std::numeric_limits<float>::lowest();
+    for (std::size_t vertex = 0; vertex + stride <= vertexData.size(); vertex += stride)
+    {
+        minX = std::min(minX, vertexData[vertex]);
+        maxX = std::max(maxX, vertexData[vertex]);
+        minY = std::min(minY, vertexData[vertex + 1]);
+        maxY = std::max(maxY, vertexData[vertex + 1]);
+    }
+
+    Rectf bounds(minX, minY, maxX, maxY);
+    bounds.offset(glm::vec2(translation));
+
+    const auto contains = [&bounds](const Rectf& region)
+    {
+        return bounds.left() >= region.left() && bounds.top() >= region.top() &&
+               bounds.right() <= region.right() && bounds.bottom() <= region.bottom();
+    };
+
+    if (buffer.isClippingActive() && !contains(buffer.getClippingRegion()))
+        return false;
+
+    return contains(d_owner.d_clippingRegion);
+}
+
+//----------------------------------------------------------------------------//
+void WindowStaticGroup::clear()
+{
+    if (!d_combinedBuffers.empty())
+    {
+        Renderer* renderer = System::getSingleton().getRenderer();
+        for (GeometryBuffer* buffer : d_combinedBuffers)
+            renderer->destroyGeometryBuffer(*buffer);
+
+        d_combinedBuffers.clear();
+    }
+
+    d_buffers.clear();
+    d_lastBufferCombined = false;
+    d_valid = false;
+}
+
+} // End of  CEGUI namespace section
@@ -27,6 +27,7 @@
 #include "CEGUI/XMLAttributes.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/SharedStringStream.h"
+#include <cstring>
 
 namespace CEGUI
 {
@@ -36,22 +37,69 @@ namespace CEGUI
     XMLAttributes::~XMLAttributes(void)
     {}
 
+    XMLAttributes::XMLAttributes(const XMLAttributes& other) :
+        d_attrs(other.d_attrs)
+    {
+        materialiseViews();
+    }
+
+    XMLAttributes& XMLAttributes::operator=(const XMLAttributes& other)
+    {
+        if (this != &other)
+        {
+            d_attrs = other.d_attrs;
+            materialiseViews();
+        }
+
+        return *this;
+    }
+
     void XMLAttributes::add(const String& attrName, const String& attrValue)
     {
-        d_attrs[attrName] = attrValue;
+        const size_t index = findIndex(attrName);
+
+        if (index != d_attrs.size())
+        {
+            d_attrs[index].d_valueView = nullptr;
+            d_attrs[index].d_value = attrValue;
+            return;
+        }
+
+        Attribute attr;
+        attr.d_nameView = nullptr;
+        attr.d_valueView = nullptr;
+        attr.d_name = attrName;
+        attr.d_value = attrValue;
+        d_attrs.push_back(attr);
+    }
+
+    void XMLAttributes::addView(const char* attrName, const char* attrValue)
+    {
+        const size_t index = findIndex(attrName);
+
+        if (index != d_attrs.size())
+        {
+            d_attrs[index].d_valueView = attrValue;
+            d_attrs[index].d_value.clear();
+            return;
+        }
+
+        d_attrs.push_back(Attribute());
+        d_attrs.back().d_nameView = attrName;
+        d_attrs.back().d_valueView = attrValue;
     }
 
     void XMLAttributes::remove(const String& attrName)
     {
-        AttributeMap::iterator pos = d_attrs.find(attrName);
+        const size_t index = findIndex(attrName);
 
-        if (pos != d_attrs.end())
-            d_attrs.erase(pos);
+        if (index != d_attrs.size())
+            d_attrs.erase(d_attrs.begin() + index);
     }
 
     bool XMLAttributes::exists(const String& attrName) const
     {
-        return d_attrs.find(attrName) != d_attrs.end();
+        return findIndex(attrName) != d_attrs.size();
     }
 
     size_t XMLAttributes::getCount(void) const
@@ -67,10 +115,15 @@ namespace CEGUI
                 "The specified index is out of range for this XMLAttributes block.");
         }
 
-        AttributeMap::const_iterator iter = d_attrs.begin();
-        std::advance(iter, index);
+        const Attribute& attr = d_attrs[index];
 
-        return (*iter).first;
+        if (attr.d_nameView)
+        {
+            attr.d_name = String(attr.d_nameView);
+            attr.d_nameView = nullptr;
+        }
+
+        return attr.d_name;
     }
 
     const String& XMLAttributes::getValue(size_t index) const
@@ -81,19 +134,24 @@ namespace CEGUI
                 "The specified index is out of range for this XMLAttributes block.");
         }
 
-        AttributeMap::const_iterator iter = d_attrs.begin();
-        std::advance(iter, index);
+        const Attribute& attr = d_attrs[index];
+
+        if (attr.d_valueView)
+        {
+            attr.d_value = String(attr.d_valueView);
+            attr.d_valueView = nullptr;
+        }
 
-        return (*iter).second;
+        return attr.d_value;
     }
 
     const String& XMLAttributes::getValue(const String& attrName) const
     {
-        AttributeMap::const_iterator pos = d_attrs.find(attrName);
+        const size_t index = findIndex(attrName);
 
-        if (pos != d_attrs.end())
+        if (index != d_attrs.size())
         {
-            return (*pos).second;
+            return getValue(index);
         }
         else
         {
@@ -104,54 +162,64 @@ namespace CEGUI
 
     String XMLAttributes::getValueAsString(const String& attrName, const String& def) const
     {
-        return (exists(attrName)) ? getValue(attrName) : def;
+        const size_t index = findIndex(attrName);
+
+        if (index == d_attrs.size())
+            return def;
+
+        // build the result straight from the view rather than caching it
+        const Attribute& attr = d_attrs[index];
+        return attr.d_valueView ? String(attr.d_valueView) : attr.d_value;
     }
 
 
     bool XMLAttributes::getValueAsBool(const String& attrName, bool def) const
     {
-        if (!exists(attrName))
+        const size_t index = findIndex(attrName);
+
+        if (index == d_attrs.size())
         {
             return def;
         }
 
-        const String& val = getValue(attrName);
+        std::string buffer;
+        const char* val = getValueChars(d_attrs[index], buffer);
 
-        if (val == "false" || val == "False" || val == "0")
+        if (!std::strcmp(val, "false") || !std::strcmp(val, "False") || !std::strcmp(val, "0"))
         {
             return false;
         }
-        else if (val == "true" || val == "True" || val == "1")
+        else if (!std::strcmp(val, "true") || !std::strcmp(val, "True") || !std::strcmp(val, "1"))
         {
             return true;
         }
         else
         {
-            throw InvalidRequestException(
-                "failed to convert attribute '" + attrName + "' with value '" + getValue(attrName) + "' to bool.");
+            throwConversionError(attrName, "bool");
+            return def;
         }
     }
 
     int XMLAttributes::getValueAsInteger(const String& attrName, int def) const
     {
-        if (!exists(attrName))
+        const size_t index = findIndex(attrName);
+
+        if (index == d_attrs.size())
         {
             return def;
         }
 
+        std::string buffer;
         int val;
-#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
-        std::istringstream strm(getValue(attrName).c_str());
-#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
-        std::istringstream strm( String::convertUtf32ToUtf8(getValue(attrName).getString()).c_str());
-#endif
+        std::stringstream& strm = SharedStringstream::GetPreparedStream();
+        strm << getValueChars(d_attrs[index], buffer);
+
         strm >> val;
 
         // Check for success and end-of-file
         if(strm.fail() || !strm.eof())
         {
-            throw InvalidRequestException(
-                "failed to convert attribute '" + attrName + "' with value '" + getValue(attrName) + "' to integer.");
+            throwConversionError(attrName, "integer");
         }
 
         return val;
@@ -159,25 +227,94 @@ namespace CEGUI
 
     float XMLAttributes::getValueAsFloat(const String& attrName, float def) const
     {
-        if (!exists(attrName))
+        const size_t index = findIndex(attrName);
+
+        if (index == d_attrs.size())
         {
             return def;
         }
 
+        std::string buffer;
         float val;
         std::stringstream& strm = SharedStringstream::GetPreparedStream();
-        strm << getValue(attrName);
+        strm << getValueChars(d_attrs[index], buffer);
 
         strm >> val;
 
         // Check for success and end-of-file
         if(strm.fail() || !strm.eof())
         {
-            throw InvalidRequestException(
-                "failed to convert attribute '" + attrName + "' with value '" + getValue(attrName) + "' to float.");
+            throwConversionError(attrName, "float");
         }
 
         return val;
     }
 
+    size_t XMLAttributes::findIndex(const char* attrName) const
+    {
+        // attribute blocks are small, so a linear search beats any hashing
+        std::string buffer;
+
+        for (size_t i = 0; i < d_attrs.size(); ++i)
+        {
+            if (!std::strcmp(getNameChars(d_attrs[i], buffer), attrName))
+                return i;
+        }
+
+        return d_attrs.size();
+    }
+
+    size_t XMLAttributes::findIndex(const String& attrName) const
+    {
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
+        return findIndex(attrName.c_str());
+#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+        return findIndex(String::convertUtf32ToUtf8(attrName.getString()).c_str());
+#endif
+    }
+
+    void XMLAttributes::materialiseViews() const
+    {
+        for (size_t i = 0; i < d_attrs.size(); ++i)
+        {
+            getName(i);
+            getValue(i);
+        }
+    }
+
+    const char* XMLAttributes::getNameChars(const Attribute& attr, std::string& buffer)
+    {
+        if (attr.d_nameView)
+            return attr.d_nameView;
+
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
+        (void)buffer;
+        return attr.d_name.c_str();
+#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+        buffer = String::convertUtf32ToUtf8(attr.d_name.getString());
+        return buffer.c_str();
+#endif
+    }
+
+    const char* XMLAttributes::getValueChars(const Attribute& attr, std::string& buffer)
+    {
+        if (attr.d_valueView)
+            return attr.d_valueView;
+
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
+        (void)buffer;
+        return attr.d_value.c_str();
+#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+        buffer = String::convertUtf32ToUtf8(attr.d_value.getString());
+        return buffer.c_str();
+#endif
+    }
+
+    void XMLAttributes::throwConversionError(const String& attrName, const char* typeName) const
+    {
+        throw InvalidRequestException(
+            "failed to convert attribute '" + attrName + "' with value '" +
+            getValue(attrName) + "' to " + typeName + ".");
+    }
+
 } // End of  CEGUI namespace section
@@ -27,6 +27,8 @@
 #include "CEGUI/XMLHandler.h"
 #include "CEGUI/System.h"
 #include "CEGUI/XMLParser.h"
+#include "CEGUI/PreparsedXML.h"
+#include "CEGUI/Exceptions.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -53,6 +55,18 @@ namespace CEGUI
     {
         d_resourceExistsAction = resourceExistsAction;
 
+        // recordings, such as the files of a bundle, are replayed as they are
+        if (PreparsedXML::isPreparsedData(source))
+        {
+            PreparsedXML recording;
+            if (!recording.read(source))
+                throw InvalidRequestException(
+                    "The container holds a recording that can not be read.");
+
+            recording.replay(*this);
+            return;
+        }
+
         System::getSingleton().getXMLParser()->parseXML(
             *this, source, getSchemaName());
     }
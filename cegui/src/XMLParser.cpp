@@ -29,6 +29,8 @@
 #include "CEGUI/System.h"
 #include "CEGUI/ResourceProvider.h"
 #include "CEGUI/Logger.h"
+#include "CEGUI/PreparsedXML.h"
+#include "CEGUI/Profiler.h"
 #include <cstring>
 
 namespace CEGUI
@@ -55,6 +57,56 @@ namespace CEGUI
 
     void XMLParser::parseXMLFile(XMLHandler& handler, const String& filename, const String& schemaName, const String& resourceGroup, bool allowXmlValidation)
     {
+        CEGUI_PROFILE_SCOPE("XMLParser::parseXMLFile");
+
+        // files the provider holds recorded, such as those of a bundle, were
+        // validated when recorded and are replayed without parsing
+        PreparsedXML recording;
+        if (System::getSingleton().getResourceProvider()->loadPreparsedXML(filename, recording, resourceGroup))
+        {
+            try
+            {
+                recording.replay(handler);
+            }
+            catch (const Exception&)
+            {
+                // hint the related file name in the log
+                Logger::getSingleton().logEvent("The last thrown exception was related to XML file '" +
+                                                filename + "' from resource group '" + resourceGroup + "'.", LoggingLevel::Error);
+                throw;
+            }
+
+            return;
+        }
+
+        std::unique_ptr<ChunkedParse> chunkedParse(
+            createChunkedParse(handler, schemaName, allowXmlValidation));
+
+        // parse the file while it is being read
+        if (chunkedParse)
+        {
+            try
+            {
+                System::getSingleton().getResourceProvider()->readRawDataChunks(filename,
+                    [&chunkedParse](const std::uint8_t* data, size_t size)
+                    {
+                        chunkedParse->parseChunk(data, size);
+                    },
+                    resourceGroup);
+
+                chunkedParse->finish();
+            }
+            catch (const Exception&)
+            {
+                // hint the related file name in the log
+                Logger::getSingleton().logEvent("The last thrown exception was related to XML file '" +
+                                                filename + "' from resource group '" + resourceGroup + "'.", LoggingLevel::Error);
+                throw;
+            }
+
+            return;
+        }
+
         // Acquire resource using CEGUI ResourceProvider
         RawDataContainer rawXMLData;
         System::getSingleton().getResourceProvider()->loadRawDataContainer(filename, rawXMLData, resourceGroup);
@@ -80,8 +132,16 @@ namespace CEGUI
         System::getSingleton().getResourceProvider()->unloadRawDataContainer(rawXMLData);
     }
 
+    std::unique_ptr<XMLParser::ChunkedParse> XMLParser::createChunkedParse(
+        XMLHandler& /*handler*/, const String& /*schemaName*/, bool /*allowXmlValidation*/)
+    {
+        return std::unique_ptr<ChunkedParse>();
+    }
+
     void XMLParser::parseXMLString(XMLHandler& handler, const String& source, const String& schemaName, bool allowXmlValidation)
     {
+        CEGUI_PROFILE_SCOPE("XMLParser::parseXMLString");
+
         // Put the source string into a RawDataContainer
         RawDataContainer rawXMLData;
 
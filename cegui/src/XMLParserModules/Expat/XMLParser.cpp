@@ -47,34 +47,65 @@ ExpatParser::~ExpatParser(void)
 {
 }
 
-void ExpatParser::parseXML(XMLHandler& handler, const RawDataContainer& source, const String& /*schemaName*/, bool /*allowXmlValidation*/)
+class ExpatParser::ExpatChunkedParse : public XMLParser::ChunkedParse
 {
-    // All stuff goes here
-    XML_Parser parser = XML_ParserCreate(nullptr); // Create a parser
+public:
+    ExpatChunkedParse(XMLHandler& handler) :
+        d_parser(XML_ParserCreate(nullptr)) // Create a parser
+    {
+        if (!d_parser)
+        {
+            throw GenericException("Unable to create a new Expat Parser");
+        }
+
+        XML_SetUserData(d_parser, static_cast<void*>(&handler)); // Initialise user data
+        XML_SetElementHandler(d_parser, startElement, endElement); // Register callback for elements
+        XML_SetCharacterDataHandler(d_parser, characterData); // Register callback for character data
+    }
 
-    if (!parser)
+    ~ExpatChunkedParse()
     {
-        throw GenericException("Unable to create a new Expat Parser");
+        XML_ParserFree(d_parser);
     }
 
-    XML_SetUserData(parser, static_cast<void*>(&handler)); // Initialise user data
-    XML_SetElementHandler(parser, startElement, endElement); // Register callback for elements
-    XML_SetCharacterDataHandler(parser, characterData); // Register callback for character data
+    void parseChunk(const std::uint8_t* data, size_t size) override
+    {
+        parse(reinterpret_cast<const char*>(data), size, false);
+    }
 
-    // Parse the data (note that the last true parameter tels Expat that this is the last chunk of the document
-    if (!XML_Parse(parser, reinterpret_cast<const char*>(source.getDataPtr()), source.getSize(), true))
+    void finish() override
     {
-        String exception (String("XML Parsing error '") +
-                          String(XML_ErrorString(XML_GetErrorCode(parser))) +
-                          String("' at line ") +
-                          PropertyHelper<std::uint32_t>::toString(XML_GetCurrentLineNumber(parser)));
-        // (We know it is a valid pointer, otherwise an exception would have been thrown above.)
-        XML_ParserFree(parser);
-        throw GenericException(exception);
+        // tells Expat that the previous chunk was the last one of the document
+        parse(nullptr, 0, true);
     }
 
-    // (We know it is a valid pointer, otherwise an exception would have been thrown above.)
-    XML_ParserFree(parser);
+private:
+    void parse(const char* data, size_t size, bool isFinal)
+    {
+        if (!XML_Parse(d_parser, data, static_cast<int>(size), isFinal))
+        {
+            String exception (String("XML Parsing error '") +
+                              String(XML_ErrorString(XML_GetErrorCode(d_parser))) +
+                              String("' at line ") +
+                              PropertyHelper<std::uint32_t>::toString(XML_GetCurrentLineNumber(d_parser)));
+            throw GenericException(exception);
+        }
+    }
+
+    XML_Parser d_parser;
+};
+
+void ExpatParser::parseXML(XMLHandler& handler, const RawDataContainer& source, const String& schemaName, bool allowXmlValidation)
+{
+    std::unique_ptr<ChunkedParse> parse(createChunkedParse(handler, schemaName, allowXmlValidation));
+    parse->parseChunk(source.getDataPtr(), source.getSize());
+    parse->finish();
+}
+
+std::unique_ptr<XMLParser::ChunkedParse> ExpatParser::createChunkedParse(
+    XMLHandler& handler, const String& /*schemaName*/, bool /*allowXmlValidation*/)
+{
+    return std::unique_ptr<ChunkedParse>(new ExpatChunkedParse(handler));
 }
 
 bool ExpatParser::initialiseImpl(void)
@@ -91,7 +122,7 @@ void ExpatParser::startElement(void* data, const char* element, const char** att
     XMLAttributes attrs;
 
     for(size_t i = 0 ; attr[i] ; i += 2)
-        attrs.add(attr[i], attr[i+1]);
+        attrs.addView(attr[i], attr[i+1]);
 
     handler->elementStart(element, attrs);
 }
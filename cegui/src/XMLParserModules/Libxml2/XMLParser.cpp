@@ -38,6 +38,9 @@
 #include <libxml/xmlmemory.h>
 #include <libxml/xmlerror.h>
 
+#include <algorithm>
+#include <climits>
+
 // Start of CEGUI namespace section
 namespace CEGUI
 {
@@ -98,34 +101,93 @@ LibxmlParser::~LibxmlParser(void)
 {
 }
 
-void LibxmlParser::parseXML(XMLHandler& handler,
-                            const RawDataContainer& source,
-                            const String& /*schemaName*/,
-                            bool /*allowXmlValidation*/)
+class LibxmlParser::LibxmlChunkedParse : public XMLParser::ChunkedParse
 {
-    xmlDocPtr doc = xmlParseMemory(
-        reinterpret_cast<const char*>(source.getDataPtr()),
-        source.getSize());
+public:
+    LibxmlChunkedParse(XMLHandler& handler) :
+        d_handler(handler),
+        d_context(xmlCreatePushParserCtxt(nullptr, nullptr, nullptr, 0, nullptr))
+    {
+        if (!d_context)
+            throw GenericException("Unable to create a new libxml2 push parser");
+    }
+
+    ~LibxmlChunkedParse()
+    {
+        // the document is not owned by the parser context
+        if (d_context->myDoc)
+            xmlFreeDoc(d_context->myDoc);
+
+        xmlFreeParserCtxt(d_context);
+    }
+
+    void parseChunk(const std::uint8_t* data, size_t size) override
+    {
+        parse(reinterpret_cast<const char*>(data), size, false);
+    }
+
+    void finish() override
+    {
+        // tells libxml2 that the previous chunk was the last one of the document
+        parse(nullptr, 0, true);
+
+        if (!d_context->wellFormed || !d_context->myDoc)
+            throwParseError();
 
-    if (!doc)
+        // get root element
+        xmlNode* root = xmlDocGetRootElement(d_context->myDoc);
+
+        // process all elements from root to end of doc
+        if (root)
+            processXMLElement(d_handler, root);
+    }
+
+private:
+    void parse(const char* data, size_t size, bool isFinal)
     {
-        xmlError* err = xmlGetLastError();
+        // chunks larger than libxml2 takes at once are split
+        do
+        {
+            const int chunkSize = static_cast<int>(std::min<size_t>(size, INT_MAX));
+            const bool isLastChunk = isFinal && static_cast<size_t>(chunkSize) == size;
+
+            if (xmlParseChunk(d_context, data, chunkSize, isLastChunk ? 1 : 0) != 0)
+                throwParseError();
+
+            data += chunkSize;
+            size -= chunkSize;
+        }
+        while (size != 0);
+    }
+
+    void throwParseError()
+    {
+        const xmlError* err = xmlCtxtGetLastError(d_context);
 
         throw GenericException(
-            String("xmlParseMemory failed in file: '") +
-            err->file + "' at line number" +
-            PropertyHelper<std::uint32_t>::toString(err->line) + ".  Error is:" +
-            err->message);
+            String("xmlParseChunk failed at line number ") +
+            PropertyHelper<std::uint32_t>::toString(err ? err->line : 0) + ".  Error is:" +
+            ((err && err->message) ? err->message : "unknown"));
     }
 
-    // get root element
-    xmlNode* root = xmlDocGetRootElement(doc);
+    XMLHandler& d_handler;
+    xmlParserCtxtPtr d_context;
+};
 
-    // process all elements from root to end of doc
-    processXMLElement(handler, root);
+void LibxmlParser::parseXML(XMLHandler& handler,
+                            const RawDataContainer& source,
+                            const String& schemaName,
+                            bool allowXmlValidation)
+{
+    std::unique_ptr<ChunkedParse> parse(createChunkedParse(handler, schemaName, allowXmlValidation));
+    parse->parseChunk(source.getDataPtr(), source.getSize());
+    parse->finish();
+}
 
-    // release the xmlDoc 
-    xmlFreeDoc(doc);
+std::unique_ptr<XMLParser::ChunkedParse> LibxmlParser::createChunkedParse(
+    XMLHandler& handler, const String& /*schemaName*/, bool /*allowXmlValidation*/)
+{
+    return std::unique_ptr<ChunkedParse>(new LibxmlChunkedParse(handler));
 }
 
 bool LibxmlParser::initialiseImpl(void)
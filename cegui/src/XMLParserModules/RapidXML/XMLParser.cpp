@@ -119,14 +119,16 @@ RapidXMLDocument::RapidXMLDocument(XMLHandler& handler,
 //----------------------------------------------------------------------------//
 void RapidXMLDocument::processElement(const rapidxml::xml_node<>* element)
 {
-    // build attributes block for the element
+    // build attributes block for the element; rapidxml parses in situ, so
+    // names and values are null terminated strings inside our buffer and
+    // can be referenced rather than copied.
     XMLAttributes attrs;
 
     rapidxml::xml_attribute<>* currAttr = element->first_attribute(0);
 
     while (currAttr)
     {
-        attrs.add(currAttr->name(), currAttr->value());
+        attrs.addView(currAttr->name(), currAttr->value());
         currAttr = currAttr->next_attribute();
     }
 
@@ -114,7 +114,7 @@ namespace CEGUI
         const TiXmlAttribute *currAttr = element->FirstAttribute();
         while (currAttr)
         {
-            attrs.add(currAttr->Name(), currAttr->Value());
+            attrs.addView(currAttr->Name(), currAttr->Value());
             currAttr = currAttr->Next();
         }
 
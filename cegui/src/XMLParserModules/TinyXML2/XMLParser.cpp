@@ -73,7 +73,7 @@ namespace CEGUI
         const tinyxml2::XMLAttribute *currAttr = element->FirstAttribute();
         while (currAttr)
         {
-            attrs.add(currAttr->Name(), currAttr->Value());
+            attrs.addView(currAttr->Name(), currAttr->Value());
             currAttr = currAttr->Next();
         }
 
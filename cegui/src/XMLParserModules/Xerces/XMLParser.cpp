@@ -36,6 +36,7 @@
 #include "CEGUI/PropertyHelper.h"
 
 #include <xercesc/validators/schema/SchemaValidator.hpp>
+#include <xercesc/internal/XMLGrammarPoolImpl.hpp>
 
 #include <iostream> // Debug 
 // Start of CEGUI namespace section
@@ -53,7 +54,8 @@ namespace CEGUI
     //
     ////////////////////////////////////////////////////////////////////////////////
 
-    XercesParser::XercesParser(void)
+    XercesParser::XercesParser(void) :
+        d_xmlValidationEnabled(isXmlValidationEnabledByDefault())
     {
         // set ID string
         d_identifierString = "CEGUI::XercesParser - Official Xerces-C++ based parser module for CEGUI";
@@ -68,34 +70,65 @@ namespace CEGUI
                               "passed to parseXML.",
                               &XercesParser::setXmlValidationEnabled,
                               &XercesParser::isXmlValidationEnabled,
-                              true);
+                              isXmlValidationEnabledByDefault());
     }
 
     XercesParser::~XercesParser(void)
     {}
 
+    bool XercesParser::isXmlValidationEnabledByDefault()
+    {
+#if defined(DEBUG) || defined(_DEBUG) || defined(CEGUI_XERCES_VALIDATE_IN_RELEASE)
+        return true;
+#else
+        return false;
+#endif
+    }
+
     void XercesParser::parseXML(XMLHandler& handler, const RawDataContainer& source, const String& schemaName, bool xmlValidationEnabled)
     {
         XERCES_CPP_NAMESPACE_USE;
 
         XercesHandler xercesHandler(handler);
 
-        // create parser
-        SAX2XMLReader* reader = createReader(xercesHandler);
+        // ignore local settings if validation is disabled globally
+        bool forceXmlValidation = isXmlValidationEnabled() && xmlValidationEnabled;
 
-        try
+        // otherwise ignore the missing schema and proceed
+        if (forceXmlValidation && schemaName.empty())
+        {
+            Logger::getSingleton().logEvent("XercesParser::parseXML - No schema specified. Proceeding.");
+            forceXmlValidation = false;
+        }
+
+        // the compiled grammar of a schema is kept in a pool shared by all
+        // readers validating against it, so that it is only loaded once.
+        XMLGrammarPool* grammarPool = nullptr;
+        bool grammarCached = false;
+        if (forceXmlValidation)
         {
-            bool forceXmlValidation;
+            GrammarPoolMap::iterator pool = d_grammarPools.find(schemaName);
+            grammarCached = pool != d_grammarPools.end();
+            grammarPool = grammarCached ? pool->second :
+                new XMLGrammarPoolImpl(XMLPlatformUtils::fgMemoryManager);
+        }
 
-            // ignore local settings if validation is disabled globally
-            if (!isXmlValidationEnabled())
-                forceXmlValidation = false;
-            else
-                forceXmlValidation = xmlValidationEnabled;
+        // create parser
+        SAX2XMLReader* reader = createReader(xercesHandler, grammarPool);
 
+        try
+        {
             // set up schema
             if (forceXmlValidation)
-                initialiseSchema(reader, schemaName);
+            {
+                initialiseSchema(reader, schemaName, !grammarCached);
+
+                if (!grammarCached)
+                {
+                    d_grammarPools[schemaName] = grammarPool;
+                    grammarCached = true;
+                }
+            }
             // do parse
             doParse(reader, source);
         }
@@ -103,7 +136,7 @@ namespace CEGUI
         {
             if (exc.getCode() != XMLExcepts::NoError)
             {
-                delete reader;
+                destroyReader(reader, grammarCached ? nullptr : grammarPool);
 
                 char* excmsg = XMLString::transcode(exc.getMessage());
                 String message("An error occurred at line nr. " + PropertyHelper<std::uint32_t>::toString((std::uint32_t)exc.getSrcLine()) + " while parsing XML.  Additional information: ");
@@ -116,7 +149,7 @@ namespace CEGUI
         }
         catch (const SAXParseException& exc)
         {
-            delete reader;
+            destroyReader(reader, grammarCached ? nullptr : grammarPool);
 
             char* excmsg = XMLString::transcode(exc.getMessage());
             String message("An error occurred at line nr. " + PropertyHelper<std::uint32_t>::toString((std::uint32_t)exc.getLineNumber()) + " while parsing XML.  Additional information: ");
@@ -127,14 +160,22 @@ namespace CEGUI
         }
         catch (...)
         {
-            delete reader;
+            destroyReader(reader, grammarCached ? nullptr : grammarPool);
 
             Logger::getSingleton().logEvent("An unexpected error occurred while parsing XML", LoggingLevel::Error);
             throw;
         }
 
         // cleanup
-        delete reader;
+        destroyReader(reader, grammarCached ? nullptr : grammarPool);
+    }
+
+    void XercesParser::clearSchemaCache()
+    {
+        for (GrammarPoolMap::value_type& pool : d_grammarPools)
+            delete pool.second;
+
+        d_grammarPools.clear();
     }
 
     bool XercesParser::initialiseImpl(void)
@@ -163,6 +204,9 @@ namespace CEGUI
 
     void XercesParser::cleanupImpl(void)
     {
+        // the grammar pools must be gone before Xerces-C is terminated
+        clearSchemaCache();
+
         // cleanup XML stuff
         XERCES_CPP_NAMESPACE_USE;
         XMLPlatformUtils::Terminate();
@@ -224,18 +268,17 @@ namespace CEGUI
 
     }
 
-    void XercesParser::initialiseSchema(XERCES_CPP_NAMESPACE::SAX2XMLReader* reader, const String& schemaName)
+    void XercesParser::initialiseSchema(XERCES_CPP_NAMESPACE::SAX2XMLReader* reader, const String& schemaName, bool loadGrammar)
     {
-        // only load the schema if it's name is passed
-        if (!schemaName.empty())
-        {
-            XERCES_CPP_NAMESPACE_USE;
+        XERCES_CPP_NAMESPACE_USE;
 
-            // enable schema use and set validation options
-            reader->setFeature(XMLUni::fgXercesSchema, true);
-            reader->setFeature(XMLUni::fgSAX2CoreValidation, true);
-            reader->setFeature(XMLUni::fgXercesValidationErrorAsFatal, true);
+        // enable schema use and set validation options
+        reader->setFeature(XMLUni::fgXercesSchema, true);
+        reader->setFeature(XMLUni::fgSAX2CoreValidation, true);
+        reader->setFeature(XMLUni::fgXercesValidationErrorAsFatal, true);
 
+        if (loadGrammar)
+        {
             // load in the raw schema data
             RawDataContainer rawSchemaData;
             // load the schema from the resource group
@@ -252,35 +295,43 @@ namespace CEGUI
                 String::convertUtf32ToUtf8(schemaName.getString()).c_str(),
 #endif
                 false);
-            reader->loadGrammar(schemaData, Grammar::SchemaGrammarType, true);
-            // enable grammar reuse
-            reader->setFeature(XMLUni::fgXercesUseCachedGrammarInParse, true);
 
-            // set schema for usage     
-#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
-            XMLCh* pval = XMLString::transcode(schemaName.c_str());
-#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
-            XMLCh* pval = XMLString::transcode(String::convertUtf32ToUtf8(schemaName.getString()).c_str());
-#endif
-            reader->setProperty(XMLUni::fgXercesSchemaExternalNoNameSpaceSchemaLocation, pval);
-            XMLString::release(&pval);
-            Logger::getSingleton().logEvent("XercesParser::initialiseSchema - XML schema file '" + schemaName + "' has been initialised.");
+            // the compiled grammar is cached in the grammar pool of the reader
+            try
+            {
+                reader->loadGrammar(schemaData, Grammar::SchemaGrammarType, true);
+            }
+            catch (...)
+            {
+                System::getSingleton().getResourceProvider()->unloadRawDataContainer(rawSchemaData);
+                throw;
+            }
 
             // use resource provider to release loaded schema data (if it supports this)
             System::getSingleton().getResourceProvider()->unloadRawDataContainer(rawSchemaData);
+            Logger::getSingleton().logEvent("XercesParser::initialiseSchema - XML schema file '" + schemaName + "' has been initialised.");
         }
-        else
-        {
-            // otherwise ignore the missing schema and proceed
-            Logger::getSingleton().logEvent("XercesParser::initialiseSchema - No schema specified. Proceeding.");
-        }
+
+        // enable grammar reuse
+        reader->setFeature(XMLUni::fgXercesUseCachedGrammarInParse, true);
+
+        // set schema for usage
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
+        XMLCh* pval = XMLString::transcode(schemaName.c_str());
+#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+        XMLCh* pval = XMLString::transcode(String::convertUtf32ToUtf8(schemaName.getString()).c_str());
+#endif
+        reader->setProperty(XMLUni::fgXercesSchemaExternalNoNameSpaceSchemaLocation, pval);
+        XMLString::release(&pval);
     }
 
-    XERCES_CPP_NAMESPACE::SAX2XMLReader* XercesParser::createReader(XERCES_CPP_NAMESPACE::DefaultHandler& handler)
+    XERCES_CPP_NAMESPACE::SAX2XMLReader* XercesParser::createReader(XERCES_CPP_NAMESPACE::DefaultHandler& handler,
+                                                                    XERCES_CPP_NAMESPACE::XMLGrammarPool* grammarPool)
     {
         XERCES_CPP_NAMESPACE_USE;
 
-        SAX2XMLReader* reader = XMLReaderFactory::createXMLReader();
+        SAX2XMLReader* reader = XMLReaderFactory::createXMLReader(
+            XMLPlatformUtils::fgMemoryManager, grammarPool);
 
         // set basic settings we want from parser
         reader->setFeature(XMLUni::fgSAX2CoreNameSpaces, true);
@@ -292,6 +343,14 @@ namespace CEGUI
         return reader;
     }
 
+    void XercesParser::destroyReader(XERCES_CPP_NAMESPACE::SAX2XMLReader* reader,
+                                     XERCES_CPP_NAMESPACE::XMLGrammarPool* grammarPool)
+    {
+        // the reader uses the grammar pool, so it is destroyed first
+        delete reader;
+        delete grammarPool;
+    }
+
     void XercesParser::doParse(XERCES_CPP_NAMESPACE::SAX2XMLReader* parser, const RawDataContainer& source)
     {
         XERCES_CPP_NAMESPACE_USE;
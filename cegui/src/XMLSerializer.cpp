@@ -29,20 +29,32 @@
 
 namespace CEGUI 
 {
+namespace
+{
+// buffered output beyond this size is written out once no checkpoint is held
+const size_t FlushThreshold = 64 * 1024;
+}
+
 XMLSerializer::XMLSerializer(OutStream& out, size_t indentSpace)
     : d_error(false), d_tagCount(0), d_depth(0), d_indentSpace(indentSpace), 
-      d_needClose(false), d_lastIsText(false), d_stream(out)
+      d_needClose(false), d_lastIsText(false), d_stream(out),
+      d_checkpointCount(0)
 {
-    d_stream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << std::endl;
+    d_buffer.reserve(FlushThreshold);
+    d_buffer += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
     d_error = ! d_stream;
 }
 
 XMLSerializer::~XMLSerializer(void)
 {
-    if (!d_error || !d_tagStack.empty())
+    if (!d_error || d_tagStarts.size() != 0)
     {
-        d_stream << std::endl;
+        d_buffer += '\n';
     }
+
+    d_checkpointCount = 0;
+    flushBuffer();
+    d_stream.flush();
 }
 
 
@@ -54,47 +66,55 @@ XMLSerializer& XMLSerializer::openTag(const String& name)
         ++d_tagCount;
         if (d_needClose)
         {
-            d_stream << '>';	  
+            d_buffer += '>';
         }
         if (!d_lastIsText)
         {
-            d_stream << std::endl;
+            d_buffer += '\n';
             indentLine();
         }
-        d_stream << '<' << name << ' ';
-        d_tagStack.push_back(name);
+        const std::string& utf8Name = toUtf8(name);
+        d_buffer += '<';
+        d_buffer += utf8Name;
+        d_buffer += ' ';
+        d_tagStarts.push_back(d_tagNames.size());
+        d_tagNames += utf8Name;
         ++d_depth;
         d_needClose = true;
         d_lastIsText = false;
-        d_error = ! d_stream;
     }
     return *this;
 }
 
 XMLSerializer& XMLSerializer::closeTag(void)
 {
-    String back =  d_tagStack.back();
+    const size_t nameStart = d_tagStarts.back();
     if (! d_error)
     {
         --d_depth;
         if (d_needClose)
         {
-            d_stream << "/>";
-        }
-        else if (! d_lastIsText)
-        {
-            d_stream << std::endl;
-            indentLine();
-            d_stream << "</" << back << '>';
+            d_buffer += "/>";
         }
         else
         {
-            d_stream << "</" << back << '>';
+            if (! d_lastIsText)
+            {
+                d_buffer += '\n';
+                indentLine();
+            }
+            d_buffer += "</";
+            d_buffer.append(d_tagNames, nameStart, std::string::npos);
+            d_buffer += '>';
         }
         d_lastIsText = false;
         d_needClose = false;
-        d_tagStack.pop_back();
-        d_error = ! d_stream;
+        d_tagNames.resize(nameStart);
+        d_tagStarts.pop_back();
+
+        // the document is complete once the outermost tag is closed
+        if (d_depth == 0 || d_buffer.size() >= FlushThreshold)
+            flushBuffer();
     }
     return *this;
 }
@@ -108,11 +128,11 @@ XMLSerializer& XMLSerializer::attribute(const String& name, const String& value)
     }
     if (!d_error)
     {
-        d_stream << name << "=\""
-            << convertEntityInAttribute(value)
-            << "\" ";
+        d_buffer += toUtf8(name);
+        d_buffer += "=\"";
+        appendEscaped(value, true);
+        d_buffer += "\" ";
         d_lastIsText = false;
-        d_error = ! d_stream;
     }
     return *this;
 }
@@ -124,12 +144,11 @@ XMLSerializer& XMLSerializer::text(const String& text)
     {
         if (d_needClose)
         {
-            d_stream << '>';
+            d_buffer += '>';
             d_needClose = false;
         }
-        d_stream << convertEntityInText(text);
+        appendEscaped(text, false);
         d_lastIsText = true;
-        d_error = ! d_stream;
     }
     return *this;
 }
@@ -139,92 +158,119 @@ unsigned int XMLSerializer::getTagCount() const
     return d_tagCount;
 }
 
-void XMLSerializer::indentLine(void)
+XMLSerializer::Checkpoint XMLSerializer::checkpoint()
 {
-    size_t spaceCount = d_depth * d_indentSpace;
-    // There's for sure a best way to do this but it works 
-    for (size_t i = 0 ; i < spaceCount ; ++i)
-    {
-        d_stream << ' ';
-    }  
+    ++d_checkpointCount;
+
+    Checkpoint point;
+    point.d_bufferSize = d_buffer.size();
+    point.d_tagCount = d_tagCount;
+    point.d_depth = d_depth;
+    point.d_needClose = d_needClose;
+    point.d_lastIsText = d_lastIsText;
+    return point;
 }
 
-String XMLSerializer::convertEntityInText(const String& text)
+void XMLSerializer::rollBack(const Checkpoint& point)
 {
-    String res;
-    res.reserve(text.size()*2);
-    const String::const_iterator iterEnd = text.end();
-    for (String::const_iterator iter = text.begin(); iter != iterEnd ; ++iter)
-    {
-        switch(*iter)
-        {  
-            case '<':
-                res += "&lt;";
-                break;
-      
-            case '>':
-                res += "&gt;";
-                break;
-        
-            case '&':
-                res += "&amp;";
-                break;
-        
-            case '\'':
-                res += "&apos;";
-                break;
+    d_buffer.resize(point.d_bufferSize);
+    d_tagCount = point.d_tagCount;
+    d_depth = point.d_depth;
+    d_needClose = point.d_needClose;
+    d_lastIsText = point.d_lastIsText;
+    --d_checkpointCount;
+}
 
-            case '"':
-                res += "&quot;";
-                break;
-      
-            default:
-                res += *iter;
-        }
-    }
-    return res;
+void XMLSerializer::commit(const Checkpoint& /*point*/)
+{
+    --d_checkpointCount;
+
+    if (d_buffer.size() >= FlushThreshold)
+        flushBuffer();
+}
+
+XMLSerializer& XMLSerializer::flush()
+{
+    flushBuffer();
+    return *this;
+}
+
+void XMLSerializer::indentLine(void)
+{
+    d_buffer.append(d_depth * d_indentSpace, ' ');
 }
 
-String XMLSerializer::convertEntityInAttribute(const String& attributeValue)
+const std::string& XMLSerializer::toUtf8(const String& str)
 {
-    // Reserve a lot of space 
-    String res;
-    res.reserve(attributeValue.size()*2);
-    const String::const_iterator iterEnd = attributeValue.end();
-    for (String::const_iterator iter = attributeValue.begin(); iter != iterEnd ; ++iter)
+#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII
+    return str;
+#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8
+    return str.getString();
+#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+    d_scratch = String::convertUtf32ToUtf8(str.getString());
+    return d_scratch;
+#endif
+}
+
+void XMLSerializer::appendEscaped(const String& text, bool inAttribute)
+{
+    const std::string& utf8 = toUtf8(text);
+    const char* const end = utf8.data() + utf8.size();
+    const char* run = utf8.data();
+
+    // copy the runs between special chars as a whole
+    for (const char* iter = run; iter != end; ++iter)
     {
+        const char* entity;
         switch(*iter)
         {  
             case '<':
-                res += "&lt;";
+                entity = "&lt;";
                 break;
       
             case '>':
-                res += "&gt;";
+                entity = "&gt;";
                 break;
         
             case '&':
-                res += "&amp;";
+                entity = "&amp;";
                 break;
         
             case '\'':
-                res += "&apos;";
+                entity = "&apos;";
                 break;
 
             case '"':
-                res += "&quot;";
+                entity = "&quot;";
                 break;
       
             case '\n':
-                res += "\\n";
+                if (!inAttribute)
+                    continue;
+                entity = "\\n";
                 break;
 
             default:
-                res += *iter;
+                continue;
         }
+
+        d_buffer.append(run, iter - run);
+        d_buffer += entity;
+        run = iter + 1;
     }
 
-    return res;
+    d_buffer.append(run, end - run);
+}
+
+void XMLSerializer::flushBuffer()
+{
+    if (d_checkpointCount != 0 || d_buffer.empty())
+        return;
+
+    d_stream.write(d_buffer.data(), d_buffer.size());
+    d_buffer.clear();
+    if (! d_stream)
+        d_error = true;
 }
 
-} // End of CEGUI Namespace 
+} // End of CEGUI Namespace
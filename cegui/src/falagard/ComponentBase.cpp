@@ -48,11 +48,17 @@ void FalagardComponentBase::createRenderGeometryAndAddToWindow(
     bool clipToDisplay) const
 {
     Rectf dest_rect(d_area.getPixelRect(srcWindow));
+    // geometry clipped to the display may be drawn outside of the window
+    if (!clipToDisplay && srcWindow.cullGeometry(dest_rect))
+        return;
 
     if (!clipper)
         clipper = &dest_rect;
 
     const Rectf final_clip_rect(dest_rect.getIntersection(*clipper));
+    if (final_clip_rect.getWidth() <= 0.0f || final_clip_rect.getHeight() <= 0.0f)
+        return;
+
     addImageRenderGeometryToWindow_impl(srcWindow, dest_rect, modColours,
         &final_clip_rect, clipToDisplay);
 }
@@ -66,16 +72,48 @@ void FalagardComponentBase::createRenderGeometryAndAddToWindow(
     bool clipToDisplay) const
 {
     Rectf dest_rect(d_area.getPixelRect(srcWindow, baseRect));
+    // geometry clipped to the display may be drawn outside of the window
+    if (!clipToDisplay && srcWindow.cullGeometry(dest_rect))
+        return;
 
     if (!clipper)
         clipper = &dest_rect;
 
     const Rectf final_clip_rect(dest_rect.getIntersection(*clipper));
+    if (final_clip_rect.getWidth() <= 0.0f || final_clip_rect.getHeight() <= 0.0f)
+        return;
 
     addImageRenderGeometryToWindow_impl(srcWindow, dest_rect, modColours,
         &final_clip_rect, clipToDisplay);
 }
 
+//----------------------------------------------------------------------------//
+void FalagardComponentBase::addGeometryCacheKey(const Window& srcWindow,
+                                                const Rectf* baseRect,
+                                                const ColourRect* modColours,
+                                                bool clipToDisplay,
+                                                GeometryCacheKey& key) const
+{
+    const Rectf destRect(baseRect ? d_area.getPixelRect(srcWindow, *baseRect) :
+                                    d_area.getPixelRect(srcWindow));
+    key.add(destRect);
+    // culled components add no geometry, see createRenderGeometryAndAddToWindow
+    key.add(static_cast<std::uint32_t>(
+        !clipToDisplay && srcWindow.cullGeometry(destRect)));
+
+    ColourRect finalColours;
+    initColoursRect(srcWindow, modColours, finalColours);
+    key.add(finalColours);
+
+    addGeometryCacheKey_impl(srcWindow, key);
+}
+
+//----------------------------------------------------------------------------//
+void FalagardComponentBase::addGeometryCacheKey_impl(const Window&,
+                                                     GeometryCacheKey&) const
+{
+}
+
 //----------------------------------------------------------------------------//
 const ComponentArea& FalagardComponentBase::getComponentArea() const
 {
@@ -168,6 +206,16 @@ bool FalagardComponentBase::handleFontRenderSizeChange(Window& window,
     return d_area.handleFontRenderSizeChange(window, font);
 }
 
+//----------------------------------------------------------------------------//
+void FalagardComponentBase::gatherPropertyReferences(
+    std::unordered_set<String>& properties) const
+{
+    d_area.gatherPropertyReferences(properties);
+
+    if (!d_colourPropertyName.empty())
+        properties.insert(d_colourPropertyName);
+}
+
 //----------------------------------------------------------------------------//
 
 }
@@ -35,9 +35,48 @@
 #include "CEGUI/Font.h"
 #include "CEGUI/CoordConverter.h"
 #include "CEGUI/Logger.h"
+#include <algorithm>
 
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+namespace
+{
+// Applies an operator of OperatorDim, shared with the compiled DimensionPrograms
+float applyDimensionOperator(DimensionOperator op, float lval, float rval)
+{
+    switch(op)
+    {
+    case DimensionOperator::NoOp:
+        return 0.0f;
+
+    case DimensionOperator::Add:
+        return lval + rval;
+
+    case DimensionOperator::Subtract:
+        return lval - rval;
+
+    case DimensionOperator::Multiply:
+        return lval * rval;
+
+    // divide by zero returns zero.  Not 100% correct but is better than the
+    // alternatives in the majority of cases where LookNFeels are concerned.
+    case DimensionOperator::Divide:
+        return rval == 0.0f ? rval : lval / rval;
+
+    case DimensionOperator::Max:
+        return (lval > rval) ? lval : rval;
+
+    case DimensionOperator::Min:
+        return (lval < rval) ? lval : rval;
+
+    default:
+        throw InvalidRequestException(
+            "Unknown DimensionOperator value.");
+    }
+}
+}
+
 //----------------------------------------------------------------------------//
 BaseDim::BaseDim()
 {
@@ -64,6 +103,11 @@ bool BaseDim::handleFontRenderSizeChange(Window& /*window*/,
     return false;
 }
 
+//----------------------------------------------------------------------------//
+void BaseDim::gatherPropertyReferences(std::unordered_set<String>& /*properties*/) const
+{
+}
+
 //----------------------------------------------------------------------------//
 UDim BaseDim::getLowerBoundAsUDim(const Window& wnd, DimensionType /*type*/) const
 {
@@ -168,6 +212,15 @@ bool OperatorDim::handleFontRenderSizeChange(Window& window, const Font* font) c
         (d_right && d_right->handleFontRenderSizeChange(window, font));
 }
 
+//----------------------------------------------------------------------------//
+void OperatorDim::gatherPropertyReferences(std::unordered_set<String>& properties) const
+{
+    if (d_left)
+        d_left->gatherPropertyReferences(properties);
+    if (d_right)
+        d_right->gatherPropertyReferences(properties);
+}
+
 //----------------------------------------------------------------------------//
 float OperatorDim::getValue(const Window& wnd) const
 {
@@ -189,35 +242,7 @@ float OperatorDim::getValue(const Window& wnd, const Rectf& container) const
 //----------------------------------------------------------------------------//
 float OperatorDim::getValueImpl(const float lval, const float rval) const
 {
-    switch(d_op)
-    {
-    case DimensionOperator::NoOp:
-        return 0.0f;
-
-    case DimensionOperator::Add:
-        return lval + rval;
-
-    case DimensionOperator::Subtract:
-        return lval - rval;
-
-    case DimensionOperator::Multiply:
-        return lval * rval;
-
-    // divide by zero returns zero.  Not 100% correct but is better than the
-    // alternatives in the majority of cases where LookNFeels are concerned.
-    case DimensionOperator::Divide:
-        return rval == 0.0f ? rval : lval / rval;
-
-    case DimensionOperator::Max:
-        return (lval > rval) ? lval : rval;
-
-    case DimensionOperator::Min:
-        return (lval < rval) ? lval : rval;
-
-    default:
-        throw InvalidRequestException(
-            "Unknown DimensionOperator value.");
-    }
+    return applyDimensionOperator(d_op, lval, rval);
 }
 
 //----------------------------------------------------------------------------//
@@ -452,26 +477,30 @@ void ImageDimBase::writeXMLElementAttributes_impl(XMLSerializer& xml_stream) con
 //----------------------------------------------------------------------------//
 ImageDim::ImageDim(const String& image_name, DimensionType dim) :
     ImageDimBase(dim),
-    d_imageName(image_name)
+    d_image(image_name)
 {
 }
 
 //----------------------------------------------------------------------------//
 const String& ImageDim::getSourceImageName() const
 {
-    return d_imageName;
+    return d_image.getName();
 }
 
 //----------------------------------------------------------------------------//
 void ImageDim::setSourceImageName(const String& image_name)
 {
-    d_imageName = image_name;
+    d_image.setName(image_name);
 }
 
 //----------------------------------------------------------------------------//
 const Image* ImageDim::getSourceImage(const Window& /*wnd*/) const
 {
-    return &ImageManager::getSingleton().get(d_imageName);
+    if (const Image* image = d_image.get())
+        return image;
+
+    // throws the usual exception for an unknown image
+    return &ImageManager::getSingleton().get(d_image.getName());
 }
 
 //----------------------------------------------------------------------------//
@@ -490,7 +519,7 @@ void ImageDim::writeXMLElementName_impl(XMLSerializer& xml_stream) const
 void ImageDim::writeXMLElementAttributes_impl(XMLSerializer& xml_stream) const
 {
     ImageDimBase::writeXMLElementAttributes_impl(xml_stream);
-    xml_stream.attribute(Falagard_xmlHandler::NameAttribute, d_imageName);
+    xml_stream.attribute(Falagard_xmlHandler::NameAttribute, d_image.getName());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -518,8 +547,15 @@ void ImagePropertyDim::setSourceProperty(const String& property_name)
 //----------------------------------------------------------------------------//
 const Image* ImagePropertyDim::getSourceImage(const Window& wnd) const
 {
-    const String& image_name(wnd.getProperty(d_propertyName));
-    return image_name.empty() ? 0 : &ImageManager::getSingleton().get(image_name);
+    const String image_name(wnd.getProperty(d_propertyName));
+    if (image_name.empty())
+        return nullptr;
+
+    if (const Image* image = d_image.get(image_name))
+        return image;
+
+    // throws the usual exception for an unknown image
+    return &ImageManager::getSingleton().get(image_name);
 }
 
 //----------------------------------------------------------------------------//
@@ -528,6 +564,12 @@ BaseDim* ImagePropertyDim::clone() const
     return new ImagePropertyDim(*this);
 }
 
+//----------------------------------------------------------------------------//
+void ImagePropertyDim::gatherPropertyReferences(std::unordered_set<String>& properties) const
+{
+    properties.insert(d_propertyName);
+}
+
 //----------------------------------------------------------------------------//
 void ImagePropertyDim::writeXMLElementName_impl(XMLSerializer& xml_stream) const
 {
@@ -696,13 +738,13 @@ void FontDim::setName(const String& name)
 //----------------------------------------------------------------------------//
 const String& FontDim::getFont() const
 {
-    return d_font;
+    return d_font.getName();
 }
 
 //----------------------------------------------------------------------------//
 void FontDim::setFont(const String& font)
 {
-    d_font = font;
+    d_font.setName(font);
 }
 
 //----------------------------------------------------------------------------//
@@ -778,8 +820,14 @@ float FontDim::getValue(const Window& wnd) const
 //----------------------------------------------------------------------------//
 const Font* FontDim::getFontObject(const Window& window) const
 {
-    return d_font.empty() ? window.getActualFont() :
-                            &FontManager::getSingleton().get(d_font);
+    if (d_font.getName().empty())
+        return window.getActualFont();
+
+    if (const Font* font = d_font.get())
+        return font;
+
+    // throws the usual exception for an unknown font
+    return &FontManager::getSingleton().get(d_font.getName());
 }
 
 //----------------------------------------------------------------------------//
@@ -808,8 +856,8 @@ void FontDim::writeXMLElementAttributes_impl(XMLSerializer& xml_stream) const
     if (!d_childName.empty())
         xml_stream.attribute(Falagard_xmlHandler::WidgetAttribute, d_childName);
 
-    if (!d_font.empty())
-        xml_stream.attribute(Falagard_xmlHandler::FontAttribute, d_font);
+    if (!d_font.getName().empty())
+        xml_stream.attribute(Falagard_xmlHandler::FontAttribute, d_font.getName());
 
     if (!d_text.empty())
         xml_stream.attribute(Falagard_xmlHandler::StringAttribute, d_text);
@@ -918,6 +966,14 @@ BaseDim* PropertyDim::clone() const
     return new PropertyDim(*this);
 }
 
+//----------------------------------------------------------------------------//
+void PropertyDim::gatherPropertyReferences(std::unordered_set<String>& properties) const
+{
+    // properties of child windows are not properties of the look's window
+    if (d_childName.empty())
+        properties.insert(d_property);
+}
+
 //----------------------------------------------------------------------------//
 void PropertyDim::writeXMLElementName_impl(XMLSerializer& xml_stream) const
 {
@@ -941,6 +997,7 @@ Dimension::Dimension()
     : d_value(nullptr)
     , d_type(DimensionType::Invalid)
 {
+    d_program.compile(d_value);
 }
 
 //----------------------------------------------------------------------------//
@@ -955,6 +1012,7 @@ Dimension::Dimension(const BaseDim& dim, DimensionType type)
 {
     d_value = dim.clone();
     d_type = type;
+    d_program.compile(d_value);
 }
 
 //----------------------------------------------------------------------------//
@@ -962,6 +1020,7 @@ Dimension::Dimension(const Dimension& other)
 {
     d_value = other.d_value ? other.d_value->clone() : 0;
     d_type = other.d_type;
+    d_program.compile(d_value);
 }
 
 //----------------------------------------------------------------------------//
@@ -973,6 +1032,7 @@ Dimension& Dimension::operator=(const Dimension& other)
 
     d_value = other.d_value ? other.d_value->clone() : 0;
     d_type = other.d_type;
+    d_program.compile(d_value);
 
     return *this;
 }
@@ -992,6 +1052,7 @@ void Dimension::setBaseDimension(const BaseDim& dim)
         delete d_value;
 
     d_value = dim.clone();
+    d_program.compile(d_value);
 }
 
 //----------------------------------------------------------------------------//
@@ -1025,6 +1086,261 @@ bool Dimension::handleFontRenderSizeChange(Window& window,
                      false;
 }
 
+//----------------------------------------------------------------------------//
+void Dimension::gatherPropertyReferences(std::unordered_set<String>& properties) const
+{
+    if (d_value)
+        d_value->gatherPropertyReferences(properties);
+}
+
+//----------------------------------------------------------------------------//
+float Dimension::getValue(const Window& wnd) const
+{
+    assert(d_value);
+    return d_program.evaluate(wnd);
+}
+
+//----------------------------------------------------------------------------//
+float Dimension::getValue(const Window& wnd, const Rectf& container) const
+{
+    assert(d_value);
+    return d_program.evaluate(wnd, container);
+}
+
+//----------------------------------------------------------------------------//
+const DimensionProgram& Dimension::getProgram() const
+{
+    return d_program;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------------//
+const size_t DimensionProgram::MaxStackDepth;
+
+//----------------------------------------------------------------------------//
+DimensionProgram::DimensionProgram() :
+    d_root(nullptr),
+    d_stackOverflow(false)
+{
+}
+
+//----------------------------------------------------------------------------//
+void DimensionProgram::compile(const BaseDim* dim)
+{
+    d_instructions.clear();
+    d_root = dim;
+    d_stackOverflow = dim && compileNode(dim) > MaxStackDepth;
+}
+
+//----------------------------------------------------------------------------//
+size_t DimensionProgram::compileNode(const BaseDim* dim)
+{
+    if (!dim)
+    {
+        addConstant(0.0f);
+        return 1;
+    }
+
+    if (const OperatorDim* op = dynamic_cast<const OperatorDim*>(dim))
+    {
+        const size_t leftStart = d_instructions.size();
+        const size_t leftDepth = compileNode(op->getLeftOperand());
+        const size_t rightStart = d_instructions.size();
+        const size_t rightDepth = compileNode(op->getRightOperand());
+
+        // fold operators on constants, unless evaluating them would throw
+        if (rightStart - leftStart == 1 && d_instructions.size() - rightStart == 1 &&
+            d_instructions[leftStart].d_opCode == OpCode::Constant &&
+            d_instructions[rightStart].d_opCode == OpCode::Constant &&
+            op->getOperator() >= DimensionOperator::NoOp &&
+            op->getOperator() <= DimensionOperator::Min)
+        {
+            const float value = applyDimensionOperator(op->getOperator(),
+                d_instructions[leftStart].d_value, d_instructions[rightStart].d_value);
+            d_instructions.resize(leftStart);
+            addConstant(value);
+            return 1;
+        }
+
+        Instruction instruction = {};
+        instruction.d_opCode = OpCode::Operator;
+        instruction.d_operator = op->getOperator();
+        d_instructions.push_back(instruction);
+        return std::max(leftDepth, rightDepth + 1);
+    }
+
+    if (const AbsoluteDim* absolute = dynamic_cast<const AbsoluteDim*>(dim))
+    {
+        addConstant(absolute->getBaseValue());
+        return 1;
+    }
+
+    Instruction instruction = {};
+    instruction.d_opCode = OpCode::Node;
+    instruction.d_node = dim;
+
+    if (const UnifiedDim* unified = dynamic_cast<const UnifiedDim*>(dim))
+    {
+        switch (unified->getSourceDimension())
+        {
+        case DimensionType::LeftEdge:
+        case DimensionType::RightEdge:
+        case DimensionType::XPosition:
+        case DimensionType::XOffset:
+        case DimensionType::Width:
+            instruction.d_opCode = OpCode::UnifiedWidth;
+            break;
+
+        case DimensionType::TopEdge:
+        case DimensionType::BottomEdge:
+        case DimensionType::YPosition:
+        case DimensionType::YOffset:
+        case DimensionType::Height:
+            instruction.d_opCode = OpCode::UnifiedHeight;
+            break;
+
+        default:
+            // keep the node, which throws when evaluated
+            break;
+        }
+
+        instruction.d_udim = unified->getBaseValue();
+        if (instruction.d_opCode != OpCode::Node && instruction.d_udim.d_scale == 0.0f)
+        {
+            addConstant(CoordConverter::alignToPixels(instruction.d_udim.d_offset));
+            return 1;
+        }
+    }
+    else if (const ImageDim* image = dynamic_cast<const ImageDim*>(dim))
+    {
+        switch (image->getSourceDimension())
+        {
+        case DimensionType::Width:
+        case DimensionType::Height:
+        case DimensionType::XOffset:
+        case DimensionType::YOffset:
+            instruction.d_opCode = OpCode::Image;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    d_instructions.push_back(instruction);
+    return 1;
+}
+
+//----------------------------------------------------------------------------//
+void DimensionProgram::addConstant(float value)
+{
+    Instruction instruction = {};
+    instruction.d_opCode = OpCode::Constant;
+    instruction.d_value = value;
+    d_instructions.push_back(instruction);
+}
+
+//----------------------------------------------------------------------------//
+float DimensionProgram::evaluate(const Window& wnd) const
+{
+    return evaluate(wnd, nullptr);
+}
+
+//----------------------------------------------------------------------------//
+float DimensionProgram::evaluate(const Window& wnd, const Rectf& container) const
+{
+    return evaluate(wnd, &container);
+}
+
+//----------------------------------------------------------------------------//
+float DimensionProgram::evaluate(const Window& wnd, const Rectf* container) const
+{
+    if (d_instructions.empty())
+        return 0.0f;
+
+    if (d_stackOverflow)
+        return container ? d_root->getValue(wnd, *container) : d_root->getValue(wnd);
+
+    float stack[MaxStackDepth];
+    size_t top = 0;
+
+    for (const Instruction& instruction : d_instructions)
+    {
+        switch (instruction.d_opCode)
+        {
+        case OpCode::Constant:
+            stack[top++] = instruction.d_value;
+            break;
+
+        case OpCode::UnifiedWidth:
+            stack[top++] = CoordConverter::asAbsolute(instruction.d_udim,
+                container ? container->getWidth() : wnd.getPixelSize().d_width);
+            break;
+
+        case OpCode::UnifiedHeight:
+            stack[top++] = CoordConverter::asAbsolute(instruction.d_udim,
+                container ? container->getHeight() : wnd.getPixelSize().d_height);
+            break;
+
+        case OpCode::Image:
+        {
+            const ImageDim* imageDim = static_cast<const ImageDim*>(instruction.d_node);
+            const Image* image = imageDim->d_image.get();
+            if (!image)
+            {
+                // unknown images throw as usual
+                stack[top++] = imageDim->getValue(wnd);
+                break;
+            }
+
+            switch (imageDim->getSourceDimension())
+            {
+            case DimensionType::Width:
+                stack[top++] = image->getRenderedSize().d_width;
+                break;
+            case DimensionType::Height:
+                stack[top++] = image->getRenderedSize().d_height;
+                break;
+            case DimensionType::XOffset:
+                stack[top++] = image->getRenderedOffset().x;
+                break;
+            default:
+                stack[top++] = image->getRenderedOffset().y;
+                break;
+            }
+            break;
+        }
+
+        case OpCode::Operator:
+            --top;
+            stack[top - 1] = applyDimensionOperator(instruction.d_operator,
+                                                    stack[top - 1], stack[top]);
+            break;
+
+        case OpCode::Node:
+            stack[top++] = container ? instruction.d_node->getValue(wnd, *container) :
+                                       instruction.d_node->getValue(wnd);
+            break;
+        }
+    }
+
+    return stack[0];
+}
+
+//----------------------------------------------------------------------------//
+bool DimensionProgram::isConstant() const
+{
+    return d_instructions.size() == 1 &&
+           d_instructions.front().d_opCode == OpCode::Constant;
+}
+
+//----------------------------------------------------------------------------//
+size_t DimensionProgram::getInstructionCount() const
+{
+    return d_instructions.size();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 //----------------------------------------------------------------------------//
@@ -1221,18 +1537,18 @@ Rectf ComponentArea::getPixelRect(const Window& wnd) const
         assert(d_right_or_width.getDimensionType() == DimensionType::RightEdge || d_right_or_width.getDimensionType() == DimensionType::Width);
         assert(d_bottom_or_height.getDimensionType() == DimensionType::BottomEdge || d_bottom_or_height.getDimensionType() == DimensionType::Height);
 
-        pixelRect.left(d_left.getBaseDimension().getValue(wnd));
-        pixelRect.top(d_top.getBaseDimension().getValue(wnd));
+        pixelRect.left(d_left.getValue(wnd));
+        pixelRect.top(d_top.getValue(wnd));
 
         if (d_right_or_width.getDimensionType() == DimensionType::Width)
-            pixelRect.setWidth(d_right_or_width.getBaseDimension().getValue(wnd));
+            pixelRect.setWidth(d_right_or_width.getValue(wnd));
         else
-            pixelRect.right(d_right_or_width.getBaseDimension().getValue(wnd));
+            pixelRect.right(d_right_or_width.getValue(wnd));
 
         if (d_bottom_or_height.getDimensionType() == DimensionType::Height)
-            pixelRect.setHeight(d_bottom_or_height.getBaseDimension().getValue(wnd));
+            pixelRect.setHeight(d_bottom_or_height.getValue(wnd));
         else
-            pixelRect.bottom(d_bottom_or_height.getBaseDimension().getValue(wnd));
+            pixelRect.bottom(d_bottom_or_height.getValue(wnd));
     }
 
     return pixelRect;
@@ -1266,18 +1582,18 @@ Rectf ComponentArea::getPixelRect(const Window& wnd, const Rectf& container) con
         assert(d_right_or_width.getDimensionType() == DimensionType::RightEdge || d_right_or_width.getDimensionType() == DimensionType::Width);
         assert(d_bottom_or_height.getDimensionType() == DimensionType::BottomEdge || d_bottom_or_height.getDimensionType() == DimensionType::Height);
 
-        pixelRect.left(d_left.getBaseDimension().getValue(wnd, container) + container.left());
-        pixelRect.top(d_top.getBaseDimension().getValue(wnd, container) + container.top());
+        pixelRect.left(d_left.getValue(wnd, container) + container.left());
+        pixelRect.top(d_top.getValue(wnd, container) + container.top());
 
         if (d_right_or_width.getDimensionType() == DimensionType::Width)
-            pixelRect.setWidth(d_right_or_width.getBaseDimension().getValue(wnd, container));
+            pixelRect.setWidth(d_right_or_width.getValue(wnd, container));
         else
-            pixelRect.right(d_right_or_width.getBaseDimension().getValue(wnd, container) + container.left());
+            pixelRect.right(d_right_or_width.getValue(wnd, container) + container.left());
 
         if (d_bottom_or_height.getDimensionType() == DimensionType::Height)
-            pixelRect.setHeight(d_bottom_or_height.getBaseDimension().getValue(wnd, container));
+            pixelRect.setHeight(d_bottom_or_height.getValue(wnd, container));
         else
-            pixelRect.bottom(d_bottom_or_height.getBaseDimension().getValue(wnd, container) + container.top());
+            pixelRect.bottom(d_bottom_or_height.getValue(wnd, container) + container.top());
     }
 
     return pixelRect;
@@ -1375,6 +1691,34 @@ bool ComponentArea::handleFontRenderSizeChange(Window& window,
     return result;
 }
 
+//----------------------------------------------------------------------------//
+void ComponentArea::gatherPropertyReferences(std::unordered_set<String>& properties) const
+{
+    if (isAreaFetchedFromProperty())
+    {
+        properties.insert(d_namedSource);
+        return;
+    }
+
+    if (isAreaFetchedFromNamedArea())
+    {
+        // the look holding the named area may not be loaded yet
+        WidgetLookManager& wlfMgr = WidgetLookManager::getSingleton();
+        if (!wlfMgr.isWidgetLookAvailable(d_namedAreaSourceLook))
+            return;
+
+        const WidgetLookFeel& look = wlfMgr.getWidgetLook(d_namedAreaSourceLook);
+        if (look.isNamedAreaPresent(d_namedSource))
+            look.getNamedArea(d_namedSource).gatherPropertyReferences(properties);
+        return;
+    }
+
+    d_left.gatherPropertyReferences(properties);
+    d_top.gatherPropertyReferences(properties);
+    d_right_or_width.gatherPropertyReferences(properties);
+    d_bottom_or_height.gatherPropertyReferences(properties);
+}
+
 //----------------------------------------------------------------------------//
 UDim ComponentArea::getWidthLowerBoundAsFuncOfWindowWidth(const Window& wnd) const
 {
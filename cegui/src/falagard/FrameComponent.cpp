@@ -30,7 +30,9 @@
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/ImageManager.h"
 #include "CEGUI/Image.h"
+#include "CEGUI/BitmapImage.h"
 #include "CEGUI/CoordConverter.h"
+#include "CEGUI/GeometryBuffer.h"
 
 namespace CEGUI
 {
@@ -272,6 +274,62 @@ const String& FrameComponent::getImagePropertySource(
     return d_frameImages[frameImageIndex].d_propertyName;
 }
 
+//----------------------------------------------------------------------------//
+void FrameComponent::addGeometryCacheKey_impl(const Window& srcWindow,
+                                              GeometryCacheKey& key) const
+{
+    for (int i = 0; i < static_cast<int>(FrameImageComponent::FrameImageCount); ++i)
+        key.add(getImage(static_cast<FrameImageComponent>(i), srcWindow));
+
+    key.add(static_cast<std::uint32_t>(d_leftEdgeFormatting.get(srcWindow)));
+    key.add(static_cast<std::uint32_t>(d_rightEdgeFormatting.get(srcWindow)));
+    key.add(static_cast<std::uint32_t>(d_topEdgeFormatting.get(srcWindow)));
+    key.add(static_cast<std::uint32_t>(d_bottomEdgeFormatting.get(srcWindow)));
+    key.add(static_cast<std::uint32_t>(d_backgroundVertFormatting.get(srcWindow)));
+    key.add(static_cast<std::uint32_t>(d_backgroundHorzFormatting.get(srcWindow)));
+}
+
+//----------------------------------------------------------------------------//
+void FrameComponent::gatherPropertyReferences(std::unordered_set<String>& properties) const
+{
+    FalagardComponentBase::gatherPropertyReferences(properties);
+
+    for (const FrameImageSource& source : d_frameImages)
+    {
+        if (source.d_specified && !source.d_propertyName.empty())
+            properties.insert(source.d_propertyName);
+    }
+
+    d_leftEdgeFormatting.gatherPropertyReferences(properties);
+    d_rightEdgeFormatting.gatherPropertyReferences(properties);
+    d_topEdgeFormatting.gatherPropertyReferences(properties);
+    d_bottomEdgeFormatting.gatherPropertyReferences(properties);
+    d_backgroundVertFormatting.gatherPropertyReferences(properties);
+    d_backgroundHorzFormatting.gatherPropertyReferences(properties);
+}
+
+//----------------------------------------------------------------------------//
+struct FrameComponent::ImageBatch
+{
+    ImageBatch(const Rectf* clipper, std::vector<GeometryBuffer*>& buffers) :
+        d_clipper(clipper),
+        d_buffer(nullptr),
+        d_texture(nullptr),
+        d_shaderType(DefaultShaderType::Textured),
+        d_buffers(buffers)
+    {}
+
+    //! Clipper of the whole frame, which also applies to the shared buffer.
+    const Rectf* d_clipper;
+    //! Buffer further BitmapImages are appended to, nullptr if there is none.
+    GeometryBuffer* d_buffer;
+    //! Texture and shader of d_buffer.
+    const Texture* d_texture;
+    DefaultShaderType d_shaderType;
+    //! The buffers of the window, the buffers of the frame are appended to in drawing order.
+    std::vector<GeometryBuffer*>& d_buffers;
+};
+
 //----------------------------------------------------------------------------//
 void FrameComponent::addImageRenderGeometryToWindow_impl(
     Window& srcWindow, Rectf& destRect,
@@ -301,7 +359,9 @@ void FrameComponent::addImageRenderGeometryToWindow_impl(
     ColourRect& renderSettingMultiplyColours = renderSettings.d_multiplyColours;
 
     calcColoursPerImage = !renderSettingFinalColours.isMonochromatic();
-    
+
+    ImageBatch batch(clipper, srcWindow.getGeometryBuffers());
+
     // top-left image
     if (const Image* const componentImage = getImage(FrameImageComponent::TopLeftCorner, srcWindow))
     {
@@ -329,11 +389,8 @@ void FrameComponent::addImageRenderGeometryToWindow_impl(
             renderSettingMultiplyColours = renderSettingFinalColours.getSubRectangle(leftfactor, rightfactor, topfactor, bottomfactor);
         }
 
-        // create render geometry for this element and append it to the Window's geometry
-        std::vector<GeometryBuffer*> imageGeomBuffers = 
-            componentImage->createRenderGeometry(renderSettings);
-
-        srcWindow.appendGeometryBuffers(imageGeomBuffers);
+        // create render geometry for this element
+        appendImageGeometry(componentImage, renderSettings, batch);
     }
 
     // top-right image
@@ -363,11 +420,8 @@ void FrameComponent::addImageRenderGeometryToWindow_impl(
             renderSettingMultiplyColours = renderSettingFinalColours.getSubRectangle(leftfactor, rightfactor, topfactor, bottomfactor);
         }
 
-        // create render geometry for this element and append it to the Window's geometry
-        std::vector<GeometryBuffer*> imageGeomBuffers =
-            componentImage->createRenderGeometry(renderSettings);
-
-        srcWindow.appendGeometryBuffers(imageGeomBuffers);
+        // create render geometry for this element
+        appendImageGeometry(componentImage, renderSettings, batch);
     }
 
     // bottom-left image
@@ -397,11 +451,8 @@ void FrameComponent::addImageRenderGeometryToWindow_impl(
             renderSettingMultiplyColours = renderSettingFinalColours.getSubRectangle(leftfactor, rightfactor, topfactor, bottomfactor);
         }
 
-        // create render geometry for this element and append it to the Window's geometry
-        std::vector<GeometryBuffer*> imageGeomBuffers =
-            componentImage->createRenderGeometry(renderSettings);
-
-        srcWindow.appendGeometryBuffers(imageGeomBuffers);
+        // create render geometry for this element
+        appendImageGeometry(componentImage, renderSettings, batch);
     }
 
     // bottom-right image
@@ -430,11 +481,8 @@ void FrameComponent::addImageRenderGeometryToWindow_impl(
             renderSettingMultiplyColours = renderSettingFinalColours.getSubRectangle( leftfactor, rightfactor, topfactor, bottomfactor);
         }
 
-        // create render geometry for this element and append it to the Window's geometry
-        std::vector<GeometryBuffer*> imageGeomBuffers =
-            componentImage->createRenderGeometry(renderSettings);
-
-        srcWindow.appendGeometryBuffers(imageGeomBuffers);
+        // create render geometry for this element
+        appendImageGeometry(componentImage, renderSettings, batch);
     }
 
     // top image
@@ -462,13 +510,10 @@ void FrameComponent::addImageRenderGeometryToWindow_impl(
             renderSettingMultiplyColours = renderSettingFinalColours.getSubRectangle( leftfactor, rightfactor, topfactor, bottomfactor);
         }
 
-        // create render geometry for this image and append it to the Window's geometry
-        std::vector<GeometryBuffer*> imageGeomBuffers =
-            createRenderGeometryForImage(componentImage,
-                VerticalImageFormatting::TopAligned, d_topEdgeFormatting.get(srcWindow),
-                renderSettingDestArea, renderSettingMultiplyColours, clipper, clipToDisplay);
-
-        srcWindow.appendGeometryBuffers(imageGeomBuffers);
+        // create render geometry for this image
+        createRenderGeometryForImage(componentImage,
+            VerticalImageFormatting::TopAligned, d_topEdgeFormatting.get(srcWindow),
+            renderSettingDestArea, renderSettingMultiplyColours, clipper, clipToDisplay, batch);
     }
 
     // bottom image
@@ -496,13 +541,10 @@ void FrameComponent::addImageRenderGeometryToWindow_impl(
             renderSettingMultiplyColours = renderSettingFinalColours.getSubRectangle(leftfactor, rightfactor, topfactor, bottomfactor);
         }
 
-        // create render geometry for this image and append it to the Window's geometry
-        std::vector<GeometryBuffer*> imageGeomBuffers =
-            createRenderGeometryForImage(componentImage,
-                VerticalImageFormatting::BottomAligned, d_bottomEdgeFormatting.get(srcWindow),
-                renderSettingDestArea, renderSettingMultiplyColours, clipper, clipToDisplay);
-
-        srcWindow.appendGeometryBuffers(imageGeomBuffers);
+        // create render geometry for this image
+        createRenderGeometryForImage(componentImage,
+            VerticalImageFormatting::BottomAligned, d_bottomEdgeFormatting.get(srcWindow),
+            renderSettingDestArea, renderSettingMultiplyColours, clipper, clipToDisplay, batch);
     }
 
     // left image
@@ -530,13 +572,10 @@ void FrameComponent::addImageRenderGeometryToWindow_impl(
             renderSettingMultiplyColours = renderSettingFinalColours.getSubRectangle( leftfactor, rightfactor, topfactor, bottomfactor);
         }
 
-        // create render geometry for this image and append it to the Window's geometry
-        std::vector<GeometryBuffer*> imageGeomBuffers =
-            createRenderGeometryForImage(componentImage,
-                d_leftEdgeFormatting.get(srcWindow), HorizontalFormatting::LeftAligned,
-                renderSettingDestArea, renderSettingMultiplyColours, clipper, clipToDisplay);
-
-        srcWindow.appendGeometryBuffers(imageGeomBuffers);
+        // create render geometry for this image
+        createRenderGeometryForImage(componentImage,
+            d_leftEdgeFormatting.get(srcWindow), HorizontalFormatting::LeftAligned,
+            renderSettingDestArea, renderSettingMultiplyColours, clipper, clipToDisplay, batch);
     }
 
     // right image
@@ -564,13 +603,10 @@ void FrameComponent::addImageRenderGeometryToWindow_impl(
             renderSettingMultiplyColours = renderSettingFinalColours.getSubRectangle( leftfactor, rightfactor, topfactor, bottomfactor);
         }
 
-        // create render geometry for this image and append it to the Window's geometry
-        std::vector<GeometryBuffer*> imageGeomBuffers =
-            createRenderGeometryForImage(componentImage,
-                d_rightEdgeFormatting.get(srcWindow), HorizontalFormatting::RightAligned,
-                renderSettingDestArea, renderSettingMultiplyColours, clipper, clipToDisplay);
-
-        srcWindow.appendGeometryBuffers(imageGeomBuffers);
+        // create render geometry for this image
+        createRenderGeometryForImage(componentImage,
+            d_rightEdgeFormatting.get(srcWindow), HorizontalFormatting::RightAligned,
+            renderSettingDestArea, renderSettingMultiplyColours, clipper, clipToDisplay, batch);
     }
 
     if (const Image* const componentImage = getImage(FrameImageComponent::Background, srcWindow))
@@ -592,23 +628,60 @@ void FrameComponent::addImageRenderGeometryToWindow_impl(
         const VerticalImageFormatting vertFormatting =
             d_backgroundVertFormatting.get(srcWindow);
 
-        // create render geometry for this image and append it to the Window's geometry
-        std::vector<GeometryBuffer*> imageGeomBuffers =
-            createRenderGeometryForImage(componentImage,
-                vertFormatting, horzFormatting,
-                backgroundRect, renderSettingMultiplyColours, clipper, clipToDisplay);
+        // create render geometry for this image
+        createRenderGeometryForImage(componentImage,
+            vertFormatting, horzFormatting,
+            backgroundRect, renderSettingMultiplyColours, clipper, clipToDisplay, batch);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void FrameComponent::appendImageGeometry(const Image* image,
+    const ImageRenderSettings& renderSettings, ImageBatch& batch)
+{
+    const BitmapImage* bitmapImage = dynamic_cast<const BitmapImage*>(image);
+
+    if (bitmapImage && batch.d_buffer &&
+        bitmapImage->getTexture() == batch.d_texture &&
+        bitmapImage->getShaderType() == batch.d_shaderType &&
+        renderSettings.d_alpha == batch.d_buffer->getAlpha())
+    {
+        bitmapImage->addToRenderGeometry(*batch.d_buffer,
+            renderSettings.d_destArea, renderSettings.d_clipArea,
+            renderSettings.d_multiplyColours);
+        return;
+    }
+
+    const std::size_t firstImageBuffer = batch.d_buffers.size();
+    image->appendRenderGeometry(batch.d_buffers, renderSettings);
 
-        srcWindow.appendGeometryBuffers(imageGeomBuffers);
+    // keep the drawing order: images that can't be batched end the batch
+    batch.d_buffer = nullptr;
+    if (bitmapImage && batch.d_buffers.size() == firstImageBuffer + 1)
+    {
+        batch.d_buffer = batch.d_buffers.back();
+        batch.d_texture = bitmapImage->getTexture();
+        batch.d_shaderType = bitmapImage->getShaderType();
+
+        // the quads are clipped to their own area when added, the buffer
+        // only needs to clip to the frame, not to the area of the first image
+        if (renderSettings.d_clippingEnabled)
+        {
+            if (batch.d_clipper)
+                batch.d_buffer->setClippingRegion(*batch.d_clipper);
+            else
+                batch.d_buffer->setClippingActive(false);
+        }
     }
 }
 
 //----------------------------------------------------------------------------//
-std::vector<GeometryBuffer*> FrameComponent::createRenderGeometryForImage(
+void FrameComponent::createRenderGeometryForImage(
     const Image* image,
     VerticalImageFormatting vertFmt,
     HorizontalFormatting horzFmt,
     Rectf& destRect, const ColourRect& colours,
-    const Rectf* clipper, bool clip_to_display) const
+    const Rectf* clipper, bool clip_to_display, ImageBatch& batch) const
 {
     unsigned int horzTiles, vertTiles;
     float xpos, ypos;
@@ -686,8 +759,6 @@ std::vector<GeometryBuffer*> FrameComponent::createRenderGeometryForImage(
     }
 
     // Create the render geometry
-    std::vector<GeometryBuffer*> geomBuffers;
-
     ImageRenderSettings renderSettings(Rectf(), nullptr, !clip_to_display, colours);
 
     Rectf& renderSettingDestArea = renderSettings.d_destArea;
@@ -723,11 +794,9 @@ std::vector<GeometryBuffer*> FrameComponent::createRenderGeometryForImage(
                 renderSettings.d_clipArea = clipper;
             }
 
-            std::vector<GeometryBuffer*> currentRenderGeometry =
-                image->createRenderGeometry(renderSettings);
-
-            geomBuffers.insert(geomBuffers.end(), currentRenderGeometry.begin(),
-                currentRenderGeometry.end());
+            // tiles of a BitmapImage share texture and settings, so they
+            // all end up in the same buffer
+            appendImageGeometry(image, renderSettings, batch);
 
             renderSettingDestArea.d_min.x += imgSz.d_width;
             renderSettingDestArea.d_max.x += imgSz.d_width;
@@ -736,8 +805,6 @@ std::vector<GeometryBuffer*> FrameComponent::createRenderGeometryForImage(
         renderSettingDestArea.d_min.y += imgSz.d_height;
         renderSettingDestArea.d_max.y += imgSz.d_height;
     }
-
-    return geomBuffers;
 }
 
 //----------------------------------------------------------------------------//
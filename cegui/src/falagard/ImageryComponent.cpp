@@ -30,6 +30,7 @@
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/ImageManager.h"
 #include "CEGUI/Image.h"
+#include "CEGUI/BitmapImage.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/CoordConverter.h"
 #include <iostream>
@@ -120,6 +121,28 @@ namespace CEGUI
         d_vertFormatting.setPropertySource(property_name);
     }
 
+    void ImageryComponent::addGeometryCacheKey_impl(const Window& srcWindow,
+                                                    GeometryCacheKey& key) const
+    {
+        key.add(isImageFetchedFromProperty() ?
+            srcWindow.getProperty<Image*>(d_imagePropertyName) :
+            d_image);
+        key.add(static_cast<std::uint32_t>(d_horzFormatting.get(srcWindow)));
+        key.add(static_cast<std::uint32_t>(d_vertFormatting.get(srcWindow)));
+    }
+
+    void ImageryComponent::gatherPropertyReferences(
+                                std::unordered_set<String>& properties) const
+    {
+        FalagardComponentBase::gatherPropertyReferences(properties);
+
+        if (isImageFetchedFromProperty())
+            properties.insert(d_imagePropertyName);
+
+        d_horzFormatting.gatherPropertyReferences(properties);
+        d_vertFormatting.gatherPropertyReferences(properties);
+    }
+
     void ImageryComponent::addImageRenderGeometryToWindow_impl(
         Window& srcWindow, Rectf& destRect,
         const CEGUI::ColourRect* modColours, const Rectf* clipper,
@@ -225,6 +248,11 @@ namespace CEGUI
         renderSettingDestArea.top(ypos);
         renderSettingDestArea.bottom(ypos + imgSz.d_height);
 
+        // tiles of a BitmapImage share texture and settings, so they are all
+        // added to the buffer of the first tile
+        const BitmapImage* bitmapImage = dynamic_cast<const BitmapImage*>(img);
+        GeometryBuffer* tileBuffer = nullptr;
+
         for (unsigned int row = 0; row < vertTiles; ++row)
         {
             renderSettingDestArea.left(xpos);
@@ -254,11 +282,21 @@ namespace CEGUI
                     imgRenderSettings.d_clipArea = clipper;
                 }
 
-                // add geometry for image to the target window.
-                std::vector<GeometryBuffer*> geomBuffers = 
-                    img->createRenderGeometry(imgRenderSettings);
+                if (tileBuffer)
+                {
+                    bitmapImage->addToRenderGeometry(*tileBuffer, renderSettingDestArea,
+                        imgRenderSettings.d_clipArea, finalColours);
+                }
+                else
+                {
+                    // add geometry for image to the target window.
+                    std::vector<GeometryBuffer*>& geomBuffers = srcWindow.getGeometryBuffers();
+                    const std::size_t firstImageBuffer = geomBuffers.size();
+                    img->appendRenderGeometry(geomBuffers, imgRenderSettings);
 
-                srcWindow.appendGeometryBuffers(geomBuffers);
+                    if (bitmapImage && geomBuffers.size() == firstImageBuffer + 1)
+                        tileBuffer = geomBuffers.back();
+                }
 
                 renderSettingDestArea.d_min.x += imgSz.d_width;
                 renderSettingDestArea.d_max.x += imgSz.d_width;
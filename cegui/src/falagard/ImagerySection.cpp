@@ -26,8 +26,14 @@
  ***************************************************************************/
 #include "CEGUI/falagard/ImagerySection.h"
 #include "CEGUI/falagard/XMLHandler.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/Logger.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/GeometryCache.h"
+#include "CEGUI/InPlaceRenderEffect.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
 #include <iostream>
 #include <limits>
 
@@ -45,6 +51,18 @@ namespace CEGUI
 
     void ImagerySection::render(Window& srcWindow, const CEGUI::ColourRect* modColours, const Rectf* clipper, bool clipToDisplay) const
     {
+        render_impl(srcWindow, nullptr, modColours, clipper, clipToDisplay);
+    }
+
+    void ImagerySection::render(Window& srcWindow, const Rectf& baseRect, const CEGUI::ColourRect* modColours, const Rectf* clipper, bool clipToDisplay) const
+    {
+        render_impl(srcWindow, &baseRect, modColours, clipper, clipToDisplay);
+    }
+
+    void ImagerySection::render_impl(Window& srcWindow, const Rectf* baseRect, const CEGUI::ColourRect* modColours, const Rectf* clipper, bool clipToDisplay) const
+    {
+        WidgetLookManager::RenderStatsScope stats(d_name, srcWindow);
+
         // decide what to do as far as colours go
         ColourRect finalCols;
         initMasterColourRect(srcWindow, finalCols);
@@ -54,48 +72,78 @@ namespace CEGUI
 
         ColourRect* finalColsPtr = (finalCols.isMonochromatic() && finalCols.d_top_left.getARGB() == 0xFFFFFFFF) ? 0 : &finalCols;
 
-        // render all frame components in this section
-        for(FrameComponentList::const_iterator frame = d_frames.begin(); frame != d_frames.end(); ++frame)
+        // text depends on fonts and strings which are not part of the key, so
+        // sections drawing text are always rebuilt. So is the geometry of
+        // windows whose effect modifies the vertices of their buffers.
+        GeometryCache& cache = srcWindow.getGeometryCache();
+        const InPlaceRenderEffect* effect = srcWindow.getInPlaceRenderEffect();
+        if (!d_texts.empty() || !cache.getCapacity() ||
+            (effect && effect->modifiesGeometry()))
         {
-            (*frame).createRenderGeometryAndAddToWindow(srcWindow, finalColsPtr, clipper, clipToDisplay);
+            renderComponents(srcWindow, baseRect, finalColsPtr, clipper, clipToDisplay);
+            return;
         }
-        // render all image components in this section
+
+        GeometryCacheKey key(this);
+        key.add(WidgetLookManager::getSingleton().getGeneration());
+        key.add(ImageManager::getSingleton().getGeneration());
+        const Sizef& displaySize = System::getSingleton().getRenderer()->getDisplaySize();
+        key.add(displaySize.d_width);
+        key.add(displaySize.d_height);
+        key.add(static_cast<std::uint32_t>(clipToDisplay));
+        key.add(static_cast<std::uint32_t>(clipper != nullptr));
+        if (clipper)
+            key.add(*clipper);
+
+        for(FrameComponentList::const_iterator frame = d_frames.begin(); frame != d_frames.end(); ++frame)
+            (*frame).addGeometryCacheKey(srcWindow, baseRect, finalColsPtr, clipToDisplay, key);
         for(ImageryComponentList::const_iterator image = d_images.begin(); image != d_images.end(); ++image)
+            (*image).addGeometryCacheKey(srcWindow, baseRect, finalColsPtr, clipToDisplay, key);
+
+        if (const std::vector<GeometryBuffer*>* buffers = cache.find(key))
         {
-            (*image).createRenderGeometryAndAddToWindow(srcWindow, finalColsPtr, clipper, clipToDisplay);
+            srcWindow.appendGeometryBuffers(*buffers);
+            return;
         }
-        // render all text components in this section
-        for(TextComponentList::const_iterator text = d_texts.begin(); text != d_texts.end(); ++text)
+
+        // windows of the same look and size share their geometry as templates
+        std::vector<GeometryBuffer*>& windowBuffers = srcWindow.getGeometryBuffers();
+        const size_t firstBuffer = windowBuffers.size();
+        GeometryTemplateCache& templates = WidgetLookManager::getSingleton().getGeometryTemplateCache();
+        if (!templates.instantiate(key, windowBuffers))
         {
-            (*text).createRenderGeometryAndAddToWindow(srcWindow, finalColsPtr, clipper, clipToDisplay);
+            renderComponents(srcWindow, baseRect, finalColsPtr, clipper, clipToDisplay);
+            templates.store(key, windowBuffers, firstBuffer);
         }
+
+        cache.store(key, windowBuffers, firstBuffer);
     }
 
-    void ImagerySection::render(Window& srcWindow, const Rectf& baseRect, const CEGUI::ColourRect* modColours, const Rectf* clipper, bool clipToDisplay) const
+    void ImagerySection::renderComponents(Window& srcWindow, const Rectf* baseRect, const CEGUI::ColourRect* modColours, const Rectf* clipper, bool clipToDisplay) const
     {
-        // decide what to do as far as colours go
-        ColourRect finalCols;
-        initMasterColourRect(srcWindow, finalCols);
-
-        if (modColours)
-            finalCols *= *modColours;
-
-        ColourRect* finalColsPtr = (finalCols.isMonochromatic() && finalCols.d_top_left.getARGB() == 0xFFFFFFFF) ? 0 : &finalCols;
-
         // render all frame components in this section
         for(FrameComponentList::const_iterator frame = d_frames.begin(); frame != d_frames.end(); ++frame)
         {
-            (*frame).createRenderGeometryAndAddToWindow(srcWindow, baseRect, finalColsPtr, clipper, clipToDisplay);
+            if (baseRect)
+                (*frame).createRenderGeometryAndAddToWindow(srcWindow, *baseRect, modColours, clipper, clipToDisplay);
+            else
+                (*frame).createRenderGeometryAndAddToWindow(srcWindow, modColours, clipper, clipToDisplay);
         }
         // render all image components in this section
         for(ImageryComponentList::const_iterator image = d_images.begin(); image != d_images.end(); ++image)
         {
-            (*image).createRenderGeometryAndAddToWindow(srcWindow, baseRect, finalColsPtr, clipper, clipToDisplay);
+            if (baseRect)
+                (*image).createRenderGeometryAndAddToWindow(srcWindow, *baseRect, modColours, clipper, clipToDisplay);
+            else
+                (*image).createRenderGeometryAndAddToWindow(srcWindow, modColours, clipper, clipToDisplay);
         }
         // render all text components in this section
         for(TextComponentList::const_iterator text = d_texts.begin(); text != d_texts.end(); ++text)
         {
-            (*text).createRenderGeometryAndAddToWindow(srcWindow, baseRect, finalColsPtr, clipper, clipToDisplay);
+            if (baseRect)
+                (*text).createRenderGeometryAndAddToWindow(srcWindow, *baseRect, modColours, clipper, clipToDisplay);
+            else
+                (*text).createRenderGeometryAndAddToWindow(srcWindow, modColours, clipper, clipToDisplay);
         }
     }
 
@@ -375,6 +423,19 @@ namespace CEGUI
         return result;
     }
 
+    void ImagerySection::gatherPropertyReferences(std::unordered_set<String>& properties) const
+    {
+        if (!d_colourPropertyName.empty())
+            properties.insert(d_colourPropertyName);
+
+        for (const FrameComponent& frame : d_frames)
+            frame.gatherPropertyReferences(properties);
+        for (const ImageryComponent& image : d_images)
+            image.gatherPropertyReferences(properties);
+        for (const TextComponent& text : d_texts)
+            text.gatherPropertyReferences(properties);
+    }
+
     ImagerySection::ImageryComponentPointerList ImagerySection::getImageryComponentPointers()
     {
         ImagerySection::ImageryComponentPointerList pointerList;
@@ -69,4 +69,9 @@ namespace CEGUI
         return d_area.handleFontRenderSizeChange(window, font);
     }
 
+    void NamedArea::gatherPropertyReferences(std::unordered_set<String>& properties) const
+    {
+        d_area.gatherPropertyReferences(properties);
+    }
+
 } // End of  CEGUI namespace section
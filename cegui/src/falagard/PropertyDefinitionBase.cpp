@@ -28,6 +28,9 @@
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/XMLSerializer.h"
 #include "CEGUI/falagard/XMLHandler.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+#include "CEGUI/falagard/WidgetLookFeel.h"
+#include "CEGUI/Window.h"
 
 namespace CEGUI
 {
@@ -169,6 +172,22 @@ void PropertyDefinitionBase::writeDefinitionXMLAttributes(
         xml_stream.attribute(Falagard_xmlHandler::FireEventAttribute, d_eventFiredOnWrite);
 }
 
+//----------------------------------------------------------------------------//
+bool PropertyDefinitionBase::isLayoutAffected(const Window& window) const
+{
+    const String& lookName = window.getLookNFeel();
+    WidgetLookManager& wlfMgr = WidgetLookManager::getSingleton();
+    if (lookName.empty() || !wlfMgr.isWidgetLookAvailable(lookName))
+        return true;
+
+    const std::uint32_t dependencies =
+        wlfMgr.getWidgetLook(lookName).getPropertyDependencies(d_propertyName);
+
+    return dependencies == 0 ||
+        (dependencies & (WidgetLookFeel::NamedAreaDependency |
+                         WidgetLookFeel::WidgetComponentDependency)) != 0;
+}
+
 //----------------------------------------------------------------------------//
 
 }
@@ -254,6 +254,27 @@ namespace CEGUI
         xml_stream.closeTag();
     }
 
+//----------------------------------------------------------------------------//
+void SectionSpecification::gatherPropertyReferences(
+    std::unordered_set<String>& properties) const
+{
+    if (!d_colourPropertyName.empty())
+        properties.insert(d_colourPropertyName);
+
+    // a render control property of the parent or a child is not ours
+    if (!d_renderControlProperty.empty() && d_renderControlWidget.empty())
+        properties.insert(d_renderControlProperty);
+
+    // the owning look may not be loaded yet
+    WidgetLookManager& wlfMgr = WidgetLookManager::getSingleton();
+    if (!wlfMgr.isWidgetLookAvailable(d_owner))
+        return;
+
+    const WidgetLookFeel& look = wlfMgr.getWidgetLook(d_owner);
+    if (look.isImagerySectionPresent(d_sectionName))
+        look.getImagerySection(d_sectionName).gatherPropertyReferences(properties);
+}
+
 //----------------------------------------------------------------------------//
 bool SectionSpecification::shouldBeDrawn(const Window& wnd) const
 {
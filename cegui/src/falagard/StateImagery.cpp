@@ -26,7 +26,9 @@
  ***************************************************************************/
 #include "CEGUI/falagard/StateImagery.h"
 #include "CEGUI/falagard/XMLHandler.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
 #include "CEGUI/XMLSerializer.h"
+#include "CEGUI/Profiler.h"
 #include <algorithm> // sort
 
 namespace CEGUI
@@ -39,6 +41,9 @@ StateImagery::StateImagery(const String& name) :
 
 void StateImagery::render(Window& srcWindow, const ColourRect* modcols, const Rectf* clipper) const
 {
+    CEGUI_PROFILE_SCOPE("StateImagery::render");
+    WidgetLookManager::RenderStatsScope stats(srcWindow, d_stateName);
+
     // render all layers defined for this state
     for(LayerSpecificationList::const_iterator curr = d_layers.begin(); curr != d_layers.end(); ++curr)
         (*curr).render(srcWindow, modcols, clipper, d_clipToDisplay);
@@ -46,6 +51,9 @@ void StateImagery::render(Window& srcWindow, const ColourRect* modcols, const Re
 
 void StateImagery::render(Window& srcWindow, const Rectf& baseRect, const ColourRect* modcols, const Rectf* clipper) const
 {
+    CEGUI_PROFILE_SCOPE("StateImagery::render");
+    WidgetLookManager::RenderStatsScope stats(srcWindow, d_stateName);
+
     // render all layers defined for this state
     for(LayerSpecificationList::const_iterator curr = d_layers.begin(); curr != d_layers.end(); ++curr)
         (*curr).render(srcWindow, baseRect, modcols, clipper, d_clipToDisplay);
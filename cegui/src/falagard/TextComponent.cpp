@@ -34,6 +34,7 @@
 #include "CEGUI/JustifiedRenderedString.h"
 #include "CEGUI/RenderedStringWordWrapper.h"
 #include "CEGUI/RenderedStringParser.h"
+#include <algorithm>
 #if defined (CEGUI_USE_FRIBIDI)
     #include "CEGUI/FribidiVisualMapping.h"
 #elif defined (CEGUI_USE_MINIBIDI)
@@ -61,7 +62,6 @@ namespace CEGUI
         d_raqmTextNeedsUpdate(true),
 #endif 
         d_formattedRenderedString(new LeftAlignedRenderedString(d_renderedString)),
-        d_lastHorzFormatting(HorizontalTextFormatting::LeftAligned),
         d_vertFormatting(VerticalTextFormatting::TopAligned),
         d_horzFormatting(HorizontalTextFormatting::LeftAligned)
     {
@@ -92,9 +92,8 @@ namespace CEGUI
         d_raqmTextNeedsUpdate(true),
 #endif
 
-        d_renderedString(obj.d_renderedString),
         d_formattedRenderedString(obj.d_formattedRenderedString),
-        d_lastHorzFormatting(obj.d_lastHorzFormatting),
+        d_formattingCache(obj.d_formattingCache),
         d_font(obj.d_font),
         d_vertFormatting(obj.d_vertFormatting),
         d_horzFormatting(obj.d_horzFormatting),
@@ -117,9 +116,8 @@ namespace CEGUI
 #ifdef CEGUI_BIDI_SUPPORT
         d_bidiDataValid = false;
 #endif
-        d_renderedString = other.d_renderedString;
         d_formattedRenderedString = other.d_formattedRenderedString;
-        d_lastHorzFormatting = other.d_lastHorzFormatting;
+        d_formattingCache = other.d_formattingCache;
         d_font = other.d_font;
         d_vertFormatting = other.d_vertFormatting;
         d_horzFormatting = other.d_horzFormatting;
@@ -144,12 +142,12 @@ namespace CEGUI
 
     const String& TextComponent::getFont() const
     {
-        return d_font;
+        return d_font.getName();
     }
 
     void TextComponent::setFont(const String& font)
     {
-        d_font = font;
+        d_font.setName(font);
     }
 
     VerticalTextFormatting TextComponent::getVerticalFormatting(const Window& wnd) const
@@ -204,65 +202,38 @@ namespace CEGUI
         d_vertFormatting.setPropertySource(property_name);
     }
 
-    void TextComponent::setupStringFormatter(const Window& window,
-                                             const RenderedString& rendered_string) const
+    FormattedRenderedString* TextComponent::createStringFormatter(
+        HorizontalTextFormatting horzFormatting, const RenderedString& rendered_string)
     {
-        const HorizontalTextFormatting horzFormatting = d_horzFormatting.get(window);
-
-        // no formatting change
-        if (horzFormatting == d_lastHorzFormatting)
-        {
-            d_formattedRenderedString->setRenderedString(rendered_string);
-            return;
-        }
-
-        d_lastHorzFormatting = horzFormatting;
-
         switch(horzFormatting)
         {
-        case HorizontalTextFormatting::LeftAligned:
-            d_formattedRenderedString.reset(
-                new LeftAlignedRenderedString(rendered_string));
-            break;
-
         case HorizontalTextFormatting::CentreAligned:
-            d_formattedRenderedString.reset(
-                new CentredRenderedString(rendered_string));
-            break;
+            return new CentredRenderedString(rendered_string);
 
         case HorizontalTextFormatting::RightAligned:
-            d_formattedRenderedString.reset(
-                new RightAlignedRenderedString(rendered_string));
-            break;
+            return new RightAlignedRenderedString(rendered_string);
 
         case HorizontalTextFormatting::Justified:
-            d_formattedRenderedString.reset(
-                new JustifiedRenderedString(rendered_string));
-            break;
+            return new JustifiedRenderedString(rendered_string);
 
         case HorizontalTextFormatting::WordWrapLeftAligned:
-            d_formattedRenderedString.reset(
-                new RenderedStringWordWrapper
-                    <LeftAlignedRenderedString>(rendered_string));
-            break;
+            return new RenderedStringWordWrapper
+                <LeftAlignedRenderedString>(rendered_string);
 
         case HorizontalTextFormatting::WordWrapCentreAligned:
-            d_formattedRenderedString.reset(
-                new RenderedStringWordWrapper
-                    <CentredRenderedString>(rendered_string));
-            break;
+            return new RenderedStringWordWrapper
+                <CentredRenderedString>(rendered_string);
 
         case HorizontalTextFormatting::WordWrapRightAligned:
-            d_formattedRenderedString.reset(
-                new RenderedStringWordWrapper
-                    <RightAlignedRenderedString>(rendered_string));
-            break;
+            return new RenderedStringWordWrapper
+                <RightAlignedRenderedString>(rendered_string);
 
         case HorizontalTextFormatting::WordWraperJustified:
-            d_formattedRenderedString.reset(
-                new RenderedStringWordWrapper
-                    <JustifiedRenderedString>(rendered_string));
-            break;
+            return new RenderedStringWordWrapper
+                <JustifiedRenderedString>(rendered_string);
+
+        default:
+            return new LeftAlignedRenderedString(rendered_string);
         }
     }
 
@@ -309,16 +280,11 @@ namespace CEGUI
 
     const Font* TextComponent::getFontObject(const Window& window) const
     {
-        try
-        {
-            return d_fontPropertyName.empty() ?
-                (d_font.empty() ? window.getActualFont() : &FontManager::getSingleton().get(d_font))
-                : &FontManager::getSingleton().get(window.getProperty(d_fontPropertyName));
-        }
-        catch (UnknownObjectException&)
-        {
-            return nullptr;
-        }
+        // The handles only look the names up after fonts were created or destroyed
+        if (!d_fontPropertyName.empty())
+            return d_propertyFont.get(window.getProperty(d_fontPropertyName));
+
+        return d_font.getName().empty() ? window.getActualFont() : d_font.get();
     }
 
     void TextComponent::writeXMLToStream(XMLSerializer& xml_stream) const
@@ -329,11 +295,11 @@ namespace CEGUI
         d_area.writeXMLToStream(xml_stream);
 
         // write text element
-        if (!d_font.empty() || !getText().empty())
+        if (!d_font.getName().empty() || !getText().empty())
         {
             xml_stream.openTag(Falagard_xmlHandler::TextElement);
-            if (!d_font.empty())
-                xml_stream.attribute(Falagard_xmlHandler::FontAttribute, d_font);
+            if (!d_font.getName().empty())
+                xml_stream.attribute(Falagard_xmlHandler::FontAttribute, d_font.getName());
             if (!getText().empty())
                 xml_stream.attribute(Falagard_xmlHandler::StringAttribute, getText());
             xml_stream.closeTag();
@@ -426,12 +392,29 @@ namespace CEGUI
         return d_formattedRenderedString->getVerticalExtent(&window);
     }
 
+    void TextComponent::gatherPropertyReferences(
+                                std::unordered_set<String>& properties) const
+    {
+        FalagardComponentBase::gatherPropertyReferences(properties);
+
+        if (!d_textPropertyName.empty())
+            properties.insert(d_textPropertyName);
+        if (!d_fontPropertyName.empty())
+            properties.insert(d_fontPropertyName);
+
+        d_horzFormatting.gatherPropertyReferences(properties);
+        d_vertFormatting.gatherPropertyReferences(properties);
+    }
+
     bool TextComponent::handleFontRenderSizeChange(Window& window,
                                                    const Font* font) const
     {
         const bool res = 
             FalagardComponentBase::handleFontRenderSizeChange(window, font);
 
+        // the cached formattings were measured with the old size
+        d_formattingCache.clear();
+
         if (font == getFontObject(window))
         {
             window.invalidate();
@@ -458,12 +441,13 @@ namespace CEGUI
         if (!font)
             throw InvalidRequestException("Window doesn't have a font.");
 
-        const RenderedString* rs = &d_renderedString;
+        String vis;
+        const String* text;
+        const Font* parseFont = font;
         // do we fetch text from a property
         if (!d_textPropertyName.empty())
         {
             // fetch text & do bi-directional reordering as needed
-            String vis;
             #ifdef CEGUI_BIDI_SUPPORT
                 BidiVisualMapping::StrIndexList l2v, v2l;
                 d_bidiVisualMapping->reorderFromLogicalToVisual(
@@ -471,26 +455,56 @@ namespace CEGUI
             #else
                 vis = srcWindow.getProperty(d_textPropertyName);
             #endif
-            // parse string using parser from Window.
-            d_renderedString =
-                srcWindow.getRenderedStringParser().parse(vis, font, nullptr);
+            text = &vis;
         }
         // do we use a static text string from the looknfeel
         else if (!getTextVisual().empty())
-            // parse string using parser from Window.
-            d_renderedString = srcWindow.getRenderedStringParser().
-                parse(getTextVisual(), font, nullptr);
-        // do we have to override the font?
-        else if (font != srcWindow.getActualFont())
-            d_renderedString = srcWindow.getRenderedStringParser().
-                parse(srcWindow.getTextVisual(), font, nullptr);
-        // use ready-made RenderedString from the Window itself
+            text = &getTextVisual();
+        // use the text of the Window itself, parsed the way
+        // Window::getRenderedString does unless we override the font
         else
-            rs = &srcWindow.getRenderedString();
+        {
+            text = &srcWindow.getTextVisual();
+            if (font == srcWindow.getActualFont())
+                parseFont = nullptr;
+        }
+
+        RenderedStringParser& parser = srcWindow.getRenderedStringParser();
+        const HorizontalTextFormatting horzFormatting = d_horzFormatting.get(srcWindow);
+
+        for (auto it = d_formattingCache.begin(); it != d_formattingCache.end(); ++it)
+        {
+            if (it->d_window == &srcWindow && it->d_parser == &parser &&
+                it->d_font == font && it->d_parseFont == parseFont &&
+                it->d_horzFormatting == horzFormatting &&
+                it->d_width == size.d_width && it->d_text == *text)
+            {
+                std::rotate(d_formattingCache.begin(), it, it + 1);
+                d_formattedRenderedString = d_formattingCache.front().d_formattedRenderedString;
+                return;
+            }
+        }
 
-        setupStringFormatter(srcWindow, *rs);
-        d_formattedRenderedString->format(&srcWindow, size);
-    
+        CachedFormatting formatting;
+        formatting.d_window = &srcWindow;
+        formatting.d_parser = &parser;
+        formatting.d_font = font;
+        formatting.d_parseFont = parseFont;
+        formatting.d_text = *text;
+        formatting.d_horzFormatting = horzFormatting;
+        formatting.d_width = size.d_width;
+        // parse string using parser from Window.
+        formatting.d_renderedString = std::make_shared<RenderedString>(
+            parser.parse(*text, parseFont, nullptr));
+        formatting.d_formattedRenderedString.reset(
+            createStringFormatter(horzFormatting, *formatting.d_renderedString));
+        formatting.d_formattedRenderedString->format(&srcWindow, size);
+
+        if (d_formattingCache.size() >= FormattingCacheSize)
+            d_formattingCache.pop_back();
+        d_formattingCache.insert(d_formattingCache.begin(), std::move(formatting));
+
+        d_formattedRenderedString = d_formattingCache.front().d_formattedRenderedString;
     }
 
 //----------------------------------------------------------------------------//
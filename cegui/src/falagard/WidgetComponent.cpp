@@ -333,6 +333,11 @@ namespace CEGUI
         return false;
     }
 
+    void WidgetComponent::gatherPropertyReferences(std::unordered_set<String>& properties) const
+    {
+        d_area.gatherPropertyReferences(properties);
+    }
+
 const WidgetComponent::PropertyInitialiserList& WidgetComponent::getPropertyInitialisers() const
 {
     return d_propertyInitialisers;
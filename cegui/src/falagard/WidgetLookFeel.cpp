@@ -33,10 +33,41 @@
 
 namespace CEGUI
 {
+//---------------------------------------------------------------------------//
+const std::uint32_t WidgetLookFeel::ImageryDependency = 1;
+const std::uint32_t WidgetLookFeel::NamedAreaDependency = 2;
+const std::uint32_t WidgetLookFeel::WidgetComponentDependency = 4;
+// changes whenever the elements of any look are modified in place
+static std::atomic<std::uint32_t> s_elementsGeneration(1);
+
+namespace
+{
+//---------------------------------------------------------------------------//
+template<typename T>
+const T* findLocalElement(const InternedNameMap<T>& elements,
+                          const String& name)
+{
+    const auto i = elements.find(name);
+    return (i != elements.end()) ? &i->second : nullptr;
+}
+
+//---------------------------------------------------------------------------//
+template<typename T>
+const T* findResolvedElement(const std::unordered_map<String, const T*>& elements,
+                             const String& name)
+{
+    const auto i = elements.find(name);
+    return (i != elements.end()) ? i->second : nullptr;
+}
+
+}
+
 //---------------------------------------------------------------------------//
 WidgetLookFeel::WidgetLookFeel(const String& name, const String& inheritedLookName) :
     d_lookName(name),
-    d_inheritedLookName(inheritedLookName)
+    d_inheritedLookName(inheritedLookName),
+    d_propertyDependenciesGeneration(0),
+    d_resolvedElementsGeneration(0)
 {
 }
 
@@ -51,7 +82,9 @@ WidgetLookFeel::WidgetLookFeel(const WidgetLookFeel& other) :
     d_namedAreaMap(other.d_namedAreaMap),
     d_animations(other.d_animations),
     d_animationInstances(other.d_animationInstances),
-    d_eventLinkDefinitionMap(other.d_eventLinkDefinitionMap)
+    d_eventLinkDefinitionMap(other.d_eventLinkDefinitionMap),
+    d_propertyDependenciesGeneration(0),
+    d_resolvedElementsGeneration(0)
 {
     copyPropertyDefinitionsFrom(other);
     copyPropertyLinkDefinitionsFrom(other);
@@ -80,6 +113,11 @@ void WidgetLookFeel::swap(WidgetLookFeel& other)
     std::swap(d_animations, other.d_animations);
     std::swap(d_animationInstances, other.d_animationInstances);
     std::swap(d_eventLinkDefinitionMap, other.d_eventLinkDefinitionMap);
+    std::swap(d_propertyDependencies, other.d_propertyDependencies);
+    std::swap(d_propertyDependenciesGeneration, other.d_propertyDependenciesGeneration);
+    // the resolved elements of either look may point into the other one
+    d_resolvedElementsGeneration = 0;
+    other.d_resolvedElementsGeneration = 0;
 }
 
 //---------------------------------------------------------------------------//
@@ -92,43 +130,40 @@ WidgetLookFeel::~WidgetLookFeel()
 //---------------------------------------------------------------------------//
 const StateImagery& WidgetLookFeel::getStateImagery(const CEGUI::String& name, bool includeInheritedLook) const
 {
-    StateImageryMap::const_iterator stateImageryIter = d_stateImageryMap.find(name);
+    const StateImagery* const element = (includeInheritedLook && !d_inheritedLookName.empty()) ?
+        findResolvedElement(getResolvedElements().d_stateImagery, name) :
+        findLocalElement(d_stateImageryMap, name);
 
-    if (stateImageryIter != d_stateImageryMap.end())
-        return stateImageryIter->second;
-
-    if (!includeInheritedLook || d_inheritedLookName.empty())
+    if (!element)
         throw UnknownObjectException("StateImagery with name '" + name + "' was not found in WidgetLookFeel '" + d_lookName + "'.");
 
-    return WidgetLookManager::getSingleton().getWidgetLook(d_inheritedLookName).getStateImagery(name, true);
+    return *element;
 }
 
 //---------------------------------------------------------------------------//
 const ImagerySection& WidgetLookFeel::getImagerySection(const CEGUI::String& name, bool includeInheritedLook) const
 {
-    ImagerySectionMap::const_iterator imagerySectIter = d_imagerySectionMap.find(name);
+    const ImagerySection* const element = (includeInheritedLook && !d_inheritedLookName.empty()) ?
+        findResolvedElement(getResolvedElements().d_imagerySections, name) :
+        findLocalElement(d_imagerySectionMap, name);
 
-    if (imagerySectIter != d_imagerySectionMap.end())
-        return imagerySectIter->second;
-
-    if (!includeInheritedLook || d_inheritedLookName.empty())
+    if (!element)
         throw UnknownObjectException("ImagerySection with name '" + name + "' was not found in WidgetLookFeel '" + d_lookName + "'.");
 
-    return WidgetLookManager::getSingleton().getWidgetLook(d_inheritedLookName).getImagerySection(name, true);
+    return *element;
 }
 
 //---------------------------------------------------------------------------//
 const NamedArea& WidgetLookFeel::getNamedArea(const String& name, bool includeInheritedLook) const
 {
-    NamedAreaMap::const_iterator namedAreaIter = d_namedAreaMap.find(name);
+    const NamedArea* const element = (includeInheritedLook && !d_inheritedLookName.empty()) ?
+        findResolvedElement(getResolvedElements().d_namedAreas, name) :
+        findLocalElement(d_namedAreaMap, name);
 
-    if (namedAreaIter != d_namedAreaMap.end())
-        return namedAreaIter->second;
-
-    if (!includeInheritedLook || d_inheritedLookName.empty())
+    if (!element)
         throw UnknownObjectException("NamedArea with name '" + name + "' was not found in WidgetLookFeel '" + d_lookName + "'.");
 
-    return WidgetLookManager::getSingleton().getWidgetLook(d_inheritedLookName).getNamedArea(name, true);
+    return *element;
 }
 
 //---------------------------------------------------------------------------//
@@ -176,15 +211,14 @@ const PropertyDefinitionBase& WidgetLookFeel::getPropertyLinkDefinition(const St
 //---------------------------------------------------------------------------//
 const WidgetComponent& WidgetLookFeel::getWidgetComponent(const String& name, bool includeInheritedLook) const
 {
-    WidgetComponentMap::const_iterator widgetComponentIter = d_widgetComponentMap.find(name);
+    const WidgetComponent* const element = (includeInheritedLook && !d_inheritedLookName.empty()) ?
+        findResolvedElement(getResolvedElements().d_widgetComponents, name) :
+        findLocalElement(d_widgetComponentMap, name);
 
-    if (widgetComponentIter != d_widgetComponentMap.end())
-        return widgetComponentIter->second;
-
-    if (!includeInheritedLook || d_inheritedLookName.empty())
+    if (!element)
         throw UnknownObjectException("WidgetComponent with name '" + name + "' was not found in WidgetLookFeel '" + d_lookName + "'.");
 
-    return WidgetLookManager::getSingleton().getWidgetLook(d_inheritedLookName).getWidgetComponent(name, true);
+    return *element;
 }
 
 //---------------------------------------------------------------------------//
@@ -220,7 +254,8 @@ void WidgetLookFeel::addImagerySection(const ImagerySection& section)
         d_imagerySectionMap.erase(foundIter);
     }
 
-    d_imagerySectionMap.insert(ImagerySectionMap::value_type(name, section));
+    d_imagerySectionMap.insert(ImagerySectionMap::value_type(InternedName(name), section));
+    ++s_elementsGeneration;
 }
 
 //---------------------------------------------------------------------------//
@@ -235,9 +270,12 @@ void WidgetLookFeel::renameImagerySection(const String& oldName, const String& n
         throw UnknownObjectException("imagery section: '" + newName +
             "' already exists in look '" + d_lookName + "'.");
 
-    oldsection->second.setName(newName);
-    d_imagerySectionMap[newName] = d_imagerySectionMap[oldName];
+    ImagerySection section(std::move(oldsection->second));
+    section.setName(newName);
     d_imagerySectionMap.erase(oldsection);
+    d_imagerySectionMap.insert(
+        ImagerySectionMap::value_type(InternedName(newName), std::move(section)));
+    ++s_elementsGeneration;
 }
 
 //---------------------------------------------------------------------------//
@@ -253,7 +291,8 @@ void WidgetLookFeel::addWidgetComponent(const WidgetComponent& widget)
         d_widgetComponentMap.erase(foundIter);
     }
 
-    d_widgetComponentMap.insert(WidgetComponentMap::value_type(name, widget));
+    d_widgetComponentMap.insert(WidgetComponentMap::value_type(InternedName(name), widget));
+    ++s_elementsGeneration;
 }
 
 //---------------------------------------------------------------------------//
@@ -269,7 +308,8 @@ void WidgetLookFeel::addStateImagery(const StateImagery& state)
         d_stateImageryMap.erase(foundIter);
     }
 
-    d_stateImageryMap.insert(StateImageryMap::value_type(name, state));
+    d_stateImageryMap.insert(StateImageryMap::value_type(InternedName(name), state));
+    ++s_elementsGeneration;
 }
 
 //---------------------------------------------------------------------------//
@@ -285,25 +325,28 @@ void WidgetLookFeel::addPropertyInitialiser(const PropertyInitialiser& initialis
         d_propertyInitialiserMap.erase(foundIter);
     }
 
-    d_propertyInitialiserMap.insert(PropertyInitialiserMap::value_type(name, initialiser));
+    d_propertyInitialiserMap.insert(PropertyInitialiserMap::value_type(InternedName(name), initialiser));
 }
 
 //---------------------------------------------------------------------------//
 void WidgetLookFeel::clearImagerySections()
 {
     d_imagerySectionMap.clear();
+    ++s_elementsGeneration;
 }
 
 //---------------------------------------------------------------------------//
 void WidgetLookFeel::clearWidgetComponents()
 {
     d_widgetComponentMap.clear();
+    ++s_elementsGeneration;
 }
 
 //---------------------------------------------------------------------------//
 void WidgetLookFeel::clearStateSpecifications()
 {
     d_stateImageryMap.clear();
+    ++s_elementsGeneration;
 }
 
 //---------------------------------------------------------------------------//
@@ -446,57 +489,37 @@ void WidgetLookFeel::cleanUpWidget(Window& widget) const
 //---------------------------------------------------------------------------//
 bool WidgetLookFeel::isStateImageryPresent(const String& name, bool includeInheritedLook) const
 {
-    StateImageryMap::const_iterator i = d_stateImageryMap.find(name);
-    
-    if (i != d_stateImageryMap.end())
-        return true;
+    if (includeInheritedLook && !d_inheritedLookName.empty())
+        return findResolvedElement(getResolvedElements().d_stateImagery, name) != nullptr;
 
-    if (d_inheritedLookName.empty() || !includeInheritedLook)
-        return false;
- 
-    return WidgetLookManager::getSingleton().getWidgetLook(d_inheritedLookName).isStateImageryPresent(name, true);
+    return findLocalElement(d_stateImageryMap, name) != nullptr;
 }
 
 //---------------------------------------------------------------------------//
 bool WidgetLookFeel::isImagerySectionPresent(const String& name, bool includeInheritedLook) const
 {
-    ImagerySectionMap::const_iterator i = d_imagerySectionMap.find(name);
-    
-    if (i != d_imagerySectionMap.end())
-        return true;
+    if (includeInheritedLook && !d_inheritedLookName.empty())
+        return findResolvedElement(getResolvedElements().d_imagerySections, name) != nullptr;
 
-    if (d_inheritedLookName.empty() || !includeInheritedLook)
-        return false;
- 
-    return WidgetLookManager::getSingleton().getWidgetLook(d_inheritedLookName).isImagerySectionPresent(name, true);
+    return findLocalElement(d_imagerySectionMap, name) != nullptr;
 }
 
 //---------------------------------------------------------------------------//
 bool WidgetLookFeel::isNamedAreaPresent(const String& name, bool includeInheritedLook) const
 {
-    NamedAreaMap::const_iterator area = d_namedAreaMap.find(name);
+    if (includeInheritedLook && !d_inheritedLookName.empty())
+        return findResolvedElement(getResolvedElements().d_namedAreas, name) != nullptr;
 
-    if (area != d_namedAreaMap.end())
-        return true;
-
-    if (d_inheritedLookName.empty() || !includeInheritedLook)
-        return false;
-
-    return WidgetLookManager::getSingleton().getWidgetLook(d_inheritedLookName).isNamedAreaPresent(name, true);
+    return findLocalElement(d_namedAreaMap, name) != nullptr;
 }
 
 //---------------------------------------------------------------------------//
 bool WidgetLookFeel::isWidgetComponentPresent(const String& name, bool includeInheritedLook) const
 {
-    WidgetComponentMap::const_iterator widgetComponentIter = d_widgetComponentMap.find(name);
-
-    if (widgetComponentIter != d_widgetComponentMap.end())
-        return true;
+    if (includeInheritedLook && !d_inheritedLookName.empty())
+        return findResolvedElement(getResolvedElements().d_widgetComponents, name) != nullptr;
 
-    if (d_inheritedLookName.empty() || !includeInheritedLook)
-        return false;
-
-    return WidgetLookManager::getSingleton().getWidgetLook(d_inheritedLookName).isWidgetComponentPresent(name, true);
+    return findLocalElement(d_widgetComponentMap, name) != nullptr;
 }
 
 //---------------------------------------------------------------------------//
@@ -568,7 +591,8 @@ void WidgetLookFeel::addNamedArea(const NamedArea& area)
         d_namedAreaMap.erase(foundIter);
     }
 
-    d_namedAreaMap.insert(NamedAreaMap::value_type(name, area));
+    d_namedAreaMap.insert(NamedAreaMap::value_type(InternedName(name), area));
+    ++s_elementsGeneration;
 }
 
 
@@ -585,14 +609,18 @@ void WidgetLookFeel::renameNamedArea(const String& oldName, const String& newNam
         throw UnknownObjectException("named area: '" + newName +
             "' already exists in look '" + d_lookName + "'.");
 
-    oldarea->second.setName(newName);
-    d_namedAreaMap[newName] = d_namedAreaMap[oldName];
+    NamedArea area(std::move(oldarea->second));
+    area.setName(newName);
     d_namedAreaMap.erase(oldarea);
+    d_namedAreaMap.insert(
+        NamedAreaMap::value_type(InternedName(newName), std::move(area)));
+    ++s_elementsGeneration;
 }
 //---------------------------------------------------------------------------//
 void WidgetLookFeel::clearNamedAreas()
 {
     d_namedAreaMap.clear();
+    ++s_elementsGeneration;
 }
 
 //---------------------------------------------------------------------------//
@@ -983,7 +1011,7 @@ void WidgetLookFeel::addEventLinkDefinition(const EventLinkDefinition& evtdef)
         d_eventLinkDefinitionMap.erase(foundIter);
     }
 
-    d_eventLinkDefinitionMap.insert(EventLinkDefinitionMap::value_type(name, evtdef));
+    d_eventLinkDefinitionMap.insert(EventLinkDefinitionMap::value_type(InternedName(name), evtdef));
 }
 
 //---------------------------------------------------------------------------//
@@ -1113,6 +1141,111 @@ bool WidgetLookFeel::handleFontRenderSizeChange(Window& window,
     return result;
 }
 
+//---------------------------------------------------------------------------//
+std::uint32_t WidgetLookFeel::getPropertyDependencies(const String& propertyName) const
+{
+    const std::uint64_t generation = getLooksGeneration();
+    if (d_propertyDependenciesGeneration != generation)
+    {
+        d_propertyDependencies.clear();
+        gatherPropertyDependencies(d_propertyDependencies);
+        d_propertyDependenciesGeneration = generation;
+    }
+
+    const PropertyDependencyMap::const_iterator i =
+        d_propertyDependencies.find(propertyName);
+    return (i != d_propertyDependencies.end()) ? i->second : 0;
+}
+
+//---------------------------------------------------------------------------//
+std::uint64_t WidgetLookFeel::getLooksGeneration()
+{
+    return (static_cast<std::uint64_t>(WidgetLookManager::getSingleton().getGeneration()) << 32) |
+        s_elementsGeneration.load(std::memory_order_relaxed);
+}
+
+//---------------------------------------------------------------------------//
+const WidgetLookFeel::ResolvedElements& WidgetLookFeel::getResolvedElements() const
+{
+    const std::uint64_t generation = getLooksGeneration();
+    if (d_resolvedElementsGeneration.load(std::memory_order_acquire) == generation)
+        return d_resolvedElements;
+
+    std::lock_guard<std::mutex> lock(d_resolvedElementsMutex);
+    if (d_resolvedElementsGeneration.load(std::memory_order_relaxed) == generation)
+        return d_resolvedElements;
+
+    d_resolvedElements.d_stateImagery.clear();
+    d_resolvedElements.d_imagerySections.clear();
+    d_resolvedElements.d_namedAreas.clear();
+    d_resolvedElements.d_widgetComponents.clear();
+
+    // walk the inheritance chain from the most derived look, so that
+    // emplace keeps the element that overrides the inherited ones.
+    const WidgetLookManager& wlfMgr = WidgetLookManager::getSingleton();
+    const WidgetLookFeel* look = this;
+    while (look)
+    {
+        for (const auto& state : look->d_stateImageryMap)
+            d_resolvedElements.d_stateImagery.emplace(state.first, &state.second);
+        for (const auto& section : look->d_imagerySectionMap)
+            d_resolvedElements.d_imagerySections.emplace(section.first, &section.second);
+        for (const auto& area : look->d_namedAreaMap)
+            d_resolvedElements.d_namedAreas.emplace(area.first, &area.second);
+        for (const auto& widget : look->d_widgetComponentMap)
+            d_resolvedElements.d_widgetComponents.emplace(widget.first, &widget.second);
+
+        look = (!look->d_inheritedLookName.empty() &&
+                wlfMgr.isWidgetLookAvailable(look->d_inheritedLookName)) ?
+            &wlfMgr.getWidgetLook(look->d_inheritedLookName) : nullptr;
+    }
+
+    d_resolvedElementsGeneration.store(generation, std::memory_order_release);
+    return d_resolvedElements;
+}
+
+//---------------------------------------------------------------------------//
+void WidgetLookFeel::gatherPropertyDependencies(
+    PropertyDependencyMap& dependencies) const
+{
+    std::unordered_set<String> properties;
+
+    // sections may also be drawn directly by the window renderer, so all of
+    // them count and not just those referenced by the states.
+    for (const auto& section : d_imagerySectionMap)
+        section.second.gatherPropertyReferences(properties);
+
+    for (const auto& state : d_stateImageryMap)
+        for (const LayerSpecification& layer : state.second.getLayerSpecifications())
+            for (const SectionSpecification& section : layer.getSectionSpecifications())
+                section.gatherPropertyReferences(properties);
+
+    for (const String& property : properties)
+        dependencies[property] |= ImageryDependency;
+    properties.clear();
+
+    for (const auto& area : d_namedAreaMap)
+        area.second.gatherPropertyReferences(properties);
+
+    for (const String& property : properties)
+        dependencies[property] |= NamedAreaDependency;
+    properties.clear();
+
+    for (const auto& widget : d_widgetComponentMap)
+        widget.second.gatherPropertyReferences(properties);
+
+    for (const String& property : properties)
+        dependencies[property] |= WidgetComponentDependency;
+
+    WidgetLookManager& wlfMgr = WidgetLookManager::getSingleton();
+    if (!d_inheritedLookName.empty() &&
+        wlfMgr.isWidgetLookAvailable(d_inheritedLookName))
+    {
+        wlfMgr.getWidgetLook(d_inheritedLookName).
+            gatherPropertyDependencies(dependencies);
+    }
+}
+
 //---------------------------------------------------------------------------//
 WidgetLookFeel::StateImageryPointerMap WidgetLookFeel::getStateImageryMap(bool includeInheritedLook)
 {
@@ -29,8 +29,19 @@
 #include "CEGUI/falagard/XMLHandler.h"
 #include "CEGUI/System.h"
 #include "CEGUI/XMLParser.h"
+#include "CEGUI/PreparsedXML.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/DataContainer.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/SharedStringStream.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/XMLSerializer.h"
+#include "CEGUI/PropertyHelper.h"
+#include <algorithm>
+#include <iomanip>
+#include <tuple>
 
 namespace CEGUI
 {
@@ -38,10 +49,18 @@ namespace CEGUI
     // Static data definitions.
     template<> WidgetLookManager* Singleton<WidgetLookManager>::ms_Singleton = nullptr;
     const String WidgetLookManager::FalagardSchemaName("Falagard.xsd");
+    const String WidgetLookManager::PreparsedFileSuffix(".bin");
     String WidgetLookManager::d_defaultResourceGroup;
+    // generation of the looks, shared by all instances of the manager
+    static std::atomic<std::uint32_t> s_generation(1);
+    // state whose rendering is measured on the current thread
+    static thread_local const String* s_renderedState = nullptr;
     ////////////////////////////////////////////////////////////////////////////////
 
-    WidgetLookManager::WidgetLookManager()
+    WidgetLookManager::WidgetLookManager() :
+        d_stagedWidgetLooks(nullptr),
+        d_preparsedFilesEnabled(true),
+        d_renderStatsEnabled(false)
     {
         String addressStr = SharedStringstream::GetPointerAddressAsString(this);
 
@@ -100,21 +119,88 @@ namespace CEGUI
                 "Filename supplied for look & feel file must be valid");
         }
 
+        const String& group = resourceGroup.empty() ? d_defaultResourceGroup : resourceGroup;
+        ResourceProvider* const resourceProvider = System::getSingleton().getResourceProvider();
+        const String preparsedFilename(filename + PreparsedFileSuffix);
+
         // create handler object
         Falagard_xmlHandler handler(this);
 
-        // perform parse of XML data
+        if (!d_preparsedFilesEnabled ||
+            !resourceProvider->isResourceAvailable(preparsedFilename, group))
+        {
+            // perform parse of XML data
+            try
+            {
+                System::getSingleton().getXMLParser()->parseXMLFile(
+                    handler, filename, FalagardSchemaName, group);
+            }
+            catch (...)
+            {
+                Logger::getSingleton().logEvent("WidgetLookManager::parseLookNFeelSpecification - loading of look and feel data from file '" + filename +"' has failed.", LoggingLevel::Error);
+                throw;
+            }
+
+            return;
+        }
+
+        // the XML is still loaded, both to check that the pre-parsed data was
+        // made from it and to fall back to parsing it if it was not.
+        RawDataContainer xmlData;
+        resourceProvider->loadRawDataContainer(filename, xmlData, group);
+
+        PreparsedXML preparsed;
+        RawDataContainer preparsedData;
+        resourceProvider->loadRawDataContainer(preparsedFilename, preparsedData, group);
+        const bool upToDate = preparsed.read(preparsedData, PreparsedXML::computeSourceHash(xmlData));
+        resourceProvider->unloadRawDataContainer(preparsedData);
+
         try
         {
-            System::getSingleton().getXMLParser()->parseXMLFile(
-                handler, filename, FalagardSchemaName,
-                resourceGroup.empty() ? d_defaultResourceGroup : resourceGroup);
+            if (upToDate)
+            {
+                preparsed.replay(handler);
+            }
+            else
+            {
+                Logger::getSingleton().logEvent("WidgetLookManager::parseLookNFeelSpecification - '" + preparsedFilename +
+                    "' is outdated, parsing '" + filename + "' instead.", LoggingLevel::Warning);
+                System::getSingleton().getXMLParser()->parseXML(
+                    handler, xmlData, FalagardSchemaName);
+            }
         }
         catch (...)
         {
+            resourceProvider->unloadRawDataContainer(xmlData);
             Logger::getSingleton().logEvent("WidgetLookManager::parseLookNFeelSpecification - loading of look and feel data from file '" + filename +"' has failed.", LoggingLevel::Error);
             throw;
         }
+
+        resourceProvider->unloadRawDataContainer(xmlData);
+    }
+
+    void WidgetLookManager::writePreparsedLookNFeelToStream(const String& filename, OutStream& out_stream,
+                                                            const String& resourceGroup) const
+    {
+        ResourceProvider* const resourceProvider = System::getSingleton().getResourceProvider();
+
+        RawDataContainer xmlData;
+        resourceProvider->loadRawDataContainer(filename, xmlData,
+            resourceGroup.empty() ? d_defaultResourceGroup : resourceGroup);
+
+        PreparsedXML preparsed;
+        try
+        {
+            preparsed.record(xmlData, FalagardSchemaName);
+        }
+        catch (...)
+        {
+            resourceProvider->unloadRawDataContainer(xmlData);
+            throw;
+        }
+
+        resourceProvider->unloadRawDataContainer(xmlData);
+        preparsed.write(out_stream);
     }
     
     void WidgetLookManager::parseLookNFeelSpecificationFromString(const String& source)
@@ -135,13 +221,117 @@ namespace CEGUI
         }
     }
 
+    WidgetLookManager::WidgetLookNameSet WidgetLookManager::reloadLookNFeelSpecificationFromFile(
+        const String& filename, const String& resourceGroup)
+    {
+        WidgetLookList staged;
+        d_stagedWidgetLooks = &staged;
+        try
+        {
+            parseLookNFeelSpecificationFromFile(filename, resourceGroup);
+        }
+        catch (...)
+        {
+            d_stagedWidgetLooks = nullptr;
+            throw;
+        }
+        d_stagedWidgetLooks = nullptr;
+
+        // the XML written for a look is compared, it is complete and canonical
+        WidgetLookNameSet changed;
+        for (const auto& entry : staged)
+        {
+            if (!isWidgetLookAvailable(entry.first))
+            {
+                changed.insert(entry.first);
+                continue;
+            }
+
+            std::ostringstream previous;
+            std::ostringstream current;
+            {
+                XMLSerializer previousXml(previous);
+                getWidgetLook(entry.first).writeXMLToStream(previousXml);
+                XMLSerializer currentXml(current);
+                entry.second.writeXMLToStream(currentXml);
+            }
+
+            if (previous.str() != current.str())
+                changed.insert(entry.first);
+        }
+
+        if (changed.empty())
+            return changed;
+
+        // looks inheriting from a changed look change as well
+        WidgetLookNameSet affected(changed);
+        for (const auto& entry : d_widgetLooks)
+        {
+            String inherited(entry.second.getInheritedWidgetLookName());
+            for (size_t depth = 0; !inherited.empty() && depth < d_widgetLooks.size(); ++depth)
+            {
+                if (changed.find(inherited) != changed.end())
+                {
+                    affected.insert(entry.first);
+                    break;
+                }
+
+                WidgetLookList::const_iterator parent = d_widgetLooks.find(inherited);
+                if (parent == d_widgetLooks.end())
+                    break;
+                inherited = parent->second.getInheritedWidgetLookName();
+            }
+        }
+
+        // windows are cleaned up by the definition that initialised them
+        std::vector<std::pair<Window*, String>> windows;
+        WindowManager& winMgr = WindowManager::getSingleton();
+        for (WindowManager::WindowIterator it = winMgr.getIterator(); !it.isAtEnd(); ++it)
+        {
+            Window* const window = it.getCurrentValue();
+            if (affected.find(window->getLookNFeel()) != affected.end())
+                windows.push_back(std::make_pair(window, window->getLookNFeel()));
+        }
+
+        // AutoWindows of a window cleaned up before are gone already
+        for (const auto& entry : windows)
+        {
+            if (winMgr.isAlive(entry.first))
+                entry.first->releaseLookNFeel();
+        }
+
+        {
+            std::lock_guard<SharedMutex> lock(d_widgetLooksMutex);
+            for (const String& name : changed)
+                d_widgetLooks[name] = staged[name];
+            ++s_generation;
+            d_geometryTemplates.clear();
+        }
+
+        for (const auto& entry : windows)
+        {
+            if (winMgr.isAlive(entry.first))
+                entry.first->setLookNFeel(entry.second);
+        }
+
+        Logger::getSingleton().logEvent("WidgetLookManager::reloadLookNFeelSpecificationFromFile - " +
+            PropertyHelper<std::uint32_t>::toString(static_cast<std::uint32_t>(changed.size())) +
+            " looks changed in '" + filename + "', reapplied to " +
+            PropertyHelper<std::uint32_t>::toString(static_cast<std::uint32_t>(windows.size())) +
+            " windows.");
+
+        return changed;
+    }
+
     bool WidgetLookManager::isWidgetLookAvailable(const String& widget) const
     {
+        SharedLock guard(d_widgetLooksMutex);
         return d_widgetLooks.find(widget) != d_widgetLooks.end();
     }
 
     const WidgetLookFeel& WidgetLookManager::getWidgetLook(const String& widget) const
     {
+        SharedLock guard(d_widgetLooksMutex);
         WidgetLookList::const_iterator wlf = d_widgetLooks.find(widget);
 
         if (wlf != d_widgetLooks.end())
@@ -158,7 +348,10 @@ namespace CEGUI
         WidgetLookList::iterator wlf = d_widgetLooks.find(widget);
         if (wlf != d_widgetLooks.end())
         {
+            std::lock_guard<SharedMutex> lock(d_widgetLooksMutex);
             d_widgetLooks.erase(wlf);
+            ++s_generation;
+            d_geometryTemplates.clear();
         }
         else
         {
@@ -170,18 +363,30 @@ namespace CEGUI
 
     void WidgetLookManager::eraseAllWidgetLooks()
     {
+        std::lock_guard<SharedMutex> lock(d_widgetLooksMutex);
         d_widgetLooks.clear();
+        ++s_generation;
+        d_geometryTemplates.clear();
     }
 
     void WidgetLookManager::addWidgetLook(const WidgetLookFeel& look)
     {
+        if (d_stagedWidgetLooks)
+        {
+            (*d_stagedWidgetLooks)[look.getName()] = look;
+            return;
+        }
+
         if (isWidgetLookAvailable(look.getName()))
         {
             Logger::getSingleton().logEvent(
                 "WidgetLookManager::addWidgetLook - Widget look and feel '" + look.getName() + "' already exists.  Replacing previous definition.");
         }
 
+        std::lock_guard<SharedMutex> lock(d_widgetLooksMutex);
         d_widgetLooks[look.getName()] = look;
+        ++s_generation;
+        d_geometryTemplates.clear();
     }
 
     void WidgetLookManager::writeWidgetLookToStream(const String& name, OutStream& out_stream) const
@@ -278,5 +483,130 @@ namespace CEGUI
         return pointerMap;
     }
 
+    std::uint32_t WidgetLookManager::getGeneration() const
+    {
+        return s_generation;
+    }
+
+    bool FalagardRenderStatsKey::operator<(const FalagardRenderStatsKey& other) const
+    {
+        return std::tie(d_look, d_state, d_section) <
+            std::tie(other.d_look, other.d_state, other.d_section);
+    }
+
+    WidgetLookManager::RenderStatsMap WidgetLookManager::getRenderStats() const
+    {
+        std::lock_guard<std::mutex> lock(d_renderStatsMutex);
+        return d_renderStats;
+    }
+
+    void WidgetLookManager::resetRenderStats()
+    {
+        std::lock_guard<std::mutex> lock(d_renderStatsMutex);
+        d_renderStats.clear();
+    }
+
+    void WidgetLookManager::addRenderStats(const FalagardRenderStatsKey& key,
+                                           const FalagardRenderStats& stats)
+    {
+        std::lock_guard<std::mutex> lock(d_renderStatsMutex);
+        FalagardRenderStats& total = d_renderStats[key];
+        total.d_renderCount += stats.d_renderCount;
+        total.d_time += stats.d_time;
+        total.d_vertexCount += stats.d_vertexCount;
+        total.d_bufferCount += stats.d_bufferCount;
+    }
+
+    void WidgetLookManager::logRenderStats() const
+    {
+        const RenderStatsMap stats(getRenderStats());
+
+        std::vector<RenderStatsMap::const_iterator> sorted;
+        sorted.reserve(stats.size());
+        for (RenderStatsMap::const_iterator it = stats.begin(); it != stats.end(); ++it)
+            sorted.push_back(it);
+
+        std::stable_sort(sorted.begin(), sorted.end(),
+            [](RenderStatsMap::const_iterator a, RenderStatsMap::const_iterator b)
+            { return a->second.d_time > b->second.d_time; });
+
+        Logger& logger = Logger::getSingleton();
+        logger.logEvent("---- Falagard rendering statistics ----");
+        logger.logEvent("look / state / section: renders, time (ms), vertices, buffers");
+
+        for (const RenderStatsMap::const_iterator& it : sorted)
+        {
+            std::stringstream& sstream = SharedStringstream::GetPreparedStream();
+            sstream << it->first.d_look << " / "
+                    << (it->first.d_state.empty() ? String("-") : it->first.d_state) << " / "
+                    << (it->first.d_section.empty() ? String("*") : it->first.d_section) << ": "
+                    << it->second.d_renderCount << ", "
+                    << std::fixed << std::setprecision(3) << it->second.d_time * 1000.0 << ", "
+                    << it->second.d_vertexCount << ", "
+                    << it->second.d_bufferCount;
+            logger.logEvent(sstream.str());
+        }
+    }
+
+    WidgetLookManager::RenderStatsScope::RenderStatsScope(Window& window, const String& state) :
+        d_window(nullptr),
+        d_state(&state),
+        d_section(nullptr),
+        d_previousState(nullptr)
+    {
+        start(window);
+        if (d_window)
+            s_renderedState = &state;
+    }
+
+    WidgetLookManager::RenderStatsScope::RenderStatsScope(const String& section, Window& window) :
+        d_window(nullptr),
+        d_state(s_renderedState),
+        d_section(&section),
+        d_previousState(nullptr)
+    {
+        start(window);
+    }
+
+    void WidgetLookManager::RenderStatsScope::start(Window& window)
+    {
+        WidgetLookManager* manager = WidgetLookManager::getSingletonPtr();
+        if (!manager || !manager->isRenderStatsEnabled())
+            return;
+
+        d_window = &window;
+        d_previousState = s_renderedState;
+        d_firstBuffer = window.getGeometryBuffers().size();
+        d_start = std::chrono::steady_clock::now();
+    }
+
+    WidgetLookManager::RenderStatsScope::~RenderStatsScope()
+    {
+        if (!d_window)
+            return;
+
+        FalagardRenderStats stats;
+        stats.d_renderCount = 1;
+        stats.d_time = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - d_start).count();
+
+        const std::vector<GeometryBuffer*>& buffers = d_window->getGeometryBuffers();
+        for (std::size_t i = d_firstBuffer; i < buffers.size(); ++i)
+            stats.d_vertexCount += buffers[i]->getVertexCount();
+        stats.d_bufferCount = buffers.size() - std::min(d_firstBuffer, buffers.size());
+
+        FalagardRenderStatsKey key;
+        key.d_look = d_window->getLookNFeel();
+        if (d_state)
+            key.d_state = *d_state;
+        if (d_section)
+            key.d_section = *d_section;
+
+        s_renderedState = d_previousState;
+
+        if (WidgetLookManager* manager = WidgetLookManager::getSingletonPtr())
+            manager->addRenderStats(key, stats);
+    }
+
 
 } // End of  CEGUI namespace section
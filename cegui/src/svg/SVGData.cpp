@@ -94,6 +94,9 @@ const String SVGLineAttributeY1( "y1" );
 const String SVGLineAttributeX2( "x2" );
 const String SVGLineAttributeY2( "y2" );
 
+//----------------------------------------------------------------------------//
+const size_t SVGData::MaxCachedTesselations = 8;
+
 //----------------------------------------------------------------------------//
 SVGData::SVGData(const String& name)
     : d_name(name)
@@ -136,6 +139,7 @@ void SVGData::loadFromFile(const String& file_name,
 void SVGData::addShape(SVGBasicShape* svg_shape)
 {
     d_svgBasicShapes.push_back(svg_shape);
+    invalidateTesselationCache();
 }
 
 //----------------------------------------------------------------------------//
@@ -146,6 +150,49 @@ void SVGData::destroyShapes()
         delete d_svgBasicShapes[i];
 
     d_svgBasicShapes.clear();
+    invalidateTesselationCache();
+}
+
+//----------------------------------------------------------------------------//
+const std::vector<SVGData::TesselatedGeometry>* SVGData::getCachedTesselation(
+    const glm::ivec2& scale_bucket,
+    bool anti_aliasing)
+{
+    for (auto it = d_tesselationCache.begin(); it != d_tesselationCache.end(); ++it)
+    {
+        if (it->d_scaleBucket != scale_bucket || it->d_antiAliasing != anti_aliasing)
+            continue;
+
+        // keep the entries ordered from the most to the least recently used
+        d_tesselationCache.splice(d_tesselationCache.begin(), d_tesselationCache, it);
+        return &d_tesselationCache.front().d_geometry;
+    }
+
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------//
+const std::vector<SVGData::TesselatedGeometry>& SVGData::cacheTesselation(
+    const glm::ivec2& scale_bucket,
+    bool anti_aliasing,
+    std::vector<TesselatedGeometry>&& geometry)
+{
+    if (d_tesselationCache.size() >= MaxCachedTesselations)
+        d_tesselationCache.pop_back();
+
+    TesselationCacheEntry entry;
+    entry.d_scaleBucket = scale_bucket;
+    entry.d_antiAliasing = anti_aliasing;
+    entry.d_geometry = std::move(geometry);
+    d_tesselationCache.push_front(std::move(entry));
+
+    return d_tesselationCache.front().d_geometry;
+}
+
+//----------------------------------------------------------------------------//
+void SVGData::invalidateTesselationCache()
+{
+    d_tesselationCache.clear();
 }
 
 //----------------------------------------------------------------------------//
@@ -33,6 +33,9 @@
 #include "CEGUI/svg/SVGDataManager.h"
 #include "CEGUI/XMLAttributes.h"
 
+#include <algorithm>
+#include <cmath>
+
 
 
 // Start of CEGUI namespace section
@@ -51,11 +54,31 @@ const String ImageAutoScaledAttribute( "autoScaled" );
 const String ImageNativeHorzResAttribute( "nativeHorzRes" );
 const String ImageNativeVertResAttribute( "nativeVertRes" );
 
+namespace
+{
+//! Number of scale buckets the shapes are tesselated for per doubling of the scale.
+const float ScaleBucketsPerOctave = 4.0f;
+
+//----------------------------------------------------------------------------//
+int getScaleBucket(float scale)
+{
+    return static_cast<int>(std::floor(std::log2(scale) * ScaleBucketsPerOctave + 0.5f));
+}
+
+//----------------------------------------------------------------------------//
+float getBucketScale(int bucket)
+{
+    return std::exp2(static_cast<float>(bucket) / ScaleBucketsPerOctave);
+}
+
+}
+
 //----------------------------------------------------------------------------//
 SVGImage::SVGImage(const String& name) :
     Image(name),
     d_svgData(nullptr),
-    d_useGeometryAntialiasing(true)
+    d_useGeometryAntialiasing(true),
+    d_geometryAntialiasingMinimumSize(0.0f)
 {
 }
 
@@ -68,7 +91,8 @@ SVGImage::SVGImage(const String& name, SVGData& svg_data) :
           AutoScaledMode::Disabled,
           Sizef(640, 480)),
     d_svgData(&svg_data),
-    d_useGeometryAntialiasing(true)
+    d_useGeometryAntialiasing(true),
+    d_geometryAntialiasingMinimumSize(0.0f)
 {
 }
 
@@ -86,7 +110,8 @@ SVGImage::SVGImage(const XMLAttributes& attributes) :
                 static_cast<float>(attributes.getValueAsInteger(ImageNativeVertResAttribute, 480)))),
     d_svgData(&SVGDataManager::getSingleton().getSVGData(
               attributes.getValueAsString(ImageSVGDataAttribute))),
-    d_useGeometryAntialiasing(true)
+    d_useGeometryAntialiasing(true),
+    d_geometryAntialiasingMinimumSize(0.0f)
 {
 }
 
@@ -128,22 +153,76 @@ std::vector<GeometryBuffer*> SVGImage::createRenderGeometry(
     final_rect.d_max.x = CoordConverter::alignToPixels(final_rect.d_max.x);
     final_rect.d_max.y = CoordConverter::alignToPixels(final_rect.d_max.y);
 
+    // The anti-aliasing geometry is skipped for Images drawn at small sizes
+    const bool anti_aliasing = d_useGeometryAntialiasing &&
+        std::max(dest.getWidth(), dest.getHeight()) >= d_geometryAntialiasingMinimumSize;
+
     SVGImageRenderSettings svg_render_settings(render_settings,
                                                scale_factor,
-                                               d_useGeometryAntialiasing);
+                                               anti_aliasing);
 
     std::vector<GeometryBuffer*> geometryBuffers;
     const std::vector<SVGBasicShape*>& shapes = d_svgData->getShapes();
-    
+
+    // Flipped Images are tesselated without using the cache
+    if (scale_factor.x <= 0.0f || scale_factor.y <= 0.0f)
+    {
+        for(SVGBasicShape* currentShape : shapes)
+        {
+            std::vector<GeometryBuffer*> currentRenderGeometry =
+                currentShape->createRenderGeometry(svg_render_settings);
+
+            geometryBuffers.insert(geometryBuffers.end(), currentRenderGeometry.begin(),
+                currentRenderGeometry.end());
+        }
+
+        return geometryBuffers;
+    }
+
+    // The shapes are tesselated for the scale bucket nearest to the actual
+    // scale and the result is cached by the SVGData, so that redraws and small
+    // changes of the size do not tesselate the shapes again.
+    const glm::ivec2 scale_bucket(getScaleBucket(scale_factor.x), getScaleBucket(scale_factor.y));
+
+    const std::vector<SVGData::TesselatedGeometry>* tesselation =
+        d_svgData->getCachedTesselation(scale_bucket, anti_aliasing);
+
+    if (tesselation)
+    {
+        for (const SVGData::TesselatedGeometry& geometry : *tesselation)
+            geometryBuffers.push_back(SVGTesselator::createGeometryBuffer(
+                geometry.d_vertexData, geometry.d_customTransform, svg_render_settings));
+
+        return geometryBuffers;
+    }
+
+    const SVGImageRenderSettings bucket_render_settings(render_settings,
+        glm::vec2(getBucketScale(scale_bucket.x), getBucketScale(scale_bucket.y)),
+        anti_aliasing);
+
+    std::vector<SVGData::TesselatedGeometry> created_geometry;
     for(SVGBasicShape* currentShape : shapes)
     {
         std::vector<GeometryBuffer*> currentRenderGeometry =
-            currentShape->createRenderGeometry(svg_render_settings);
+            currentShape->createRenderGeometry(bucket_render_settings);
+
+        for (GeometryBuffer* buffer : currentRenderGeometry)
+        {
+            SVGData::TesselatedGeometry geometry;
+            geometry.d_customTransform = buffer->getCustomTransform();
+            geometry.d_vertexData = buffer->getVertexData();
+            created_geometry.push_back(std::move(geometry));
+
+            // the geometry was created for the bucket, it is drawn at the actual scale
+            buffer->setScale(scale_factor);
+        }
 
         geometryBuffers.insert(geometryBuffers.end(), currentRenderGeometry.begin(),
             currentRenderGeometry.end());
     }
 
+    d_svgData->cacheTesselation(scale_bucket, anti_aliasing, std::move(created_geometry));
+
     return geometryBuffers;
 }
 
@@ -167,6 +246,18 @@ void SVGImage::setUseGeometryAntialiasing(bool use_geometry_antialiasing)
     d_useGeometryAntialiasing = use_geometry_antialiasing;
 }
 
+//----------------------------------------------------------------------------//
+float SVGImage::getGeometryAntialiasingMinimumSize() const
+{
+    return d_geometryAntialiasingMinimumSize;
+}
+
+//----------------------------------------------------------------------------//
+void SVGImage::setGeometryAntialiasingMinimumSize(float size)
+{
+    d_geometryAntialiasingMinimumSize = size;
+}
+
 //----------------------------------------------------------------------------//
 }
 
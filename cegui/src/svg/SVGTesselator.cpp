@@ -39,6 +39,7 @@
 #endif
 
 #include <cmath>
+#include <algorithm>
 
 
 // Start of CEGUI namespace section
@@ -47,6 +48,9 @@ namespace CEGUI
 //Internal numeric value for  circle roundness. The lower, the better tesselated the
 //circle will be. We will set it to an, for our needs, appropriate fixed value.
 const float CircleRoundnessValue = 0.8f;
+//Minimum number of segments used for circles and ellipses, no matter how small
+//they are drawn.
+const float MinimumCircleSegmentCount = 8.0f;
 
 //----------------------------------------------------------------------------//
 SVGTesselator::StrokeSegmentData::StrokeSegmentData(GeometryBuffer& geometry_buffer,
@@ -146,11 +150,15 @@ std::vector<GeometryBuffer*> SVGTesselator::tesselateCircle(
     glm::vec2 scale_factors = determineScaleFactors(circle->d_transformation, render_settings);
 
     //We need this to determine the degree of tesselation required for the curved elements
-    float max_scale = std::max(render_settings.d_scaleFactor.x, render_settings.d_scaleFactor.y);
+    float max_scale = calculateMaxScale(scale_factors);
 
     //Get the radius
     const float& radius = circle->d_r;
 
+    //A radius of zero disables the rendering of the shape
+    if (radius <= 0.0f)
+        return geomBuffers;
+
     //Precalculate values needed for the circle tesselation
     float num_segments, cos_value, sin_value;
     calculateCircleTesselationParameters(radius, max_scale, num_segments, cos_value, sin_value);
@@ -195,12 +203,16 @@ std::vector<GeometryBuffer*> SVGTesselator::tesselateEllipse(
     glm::vec2 scale_factors = determineScaleFactors(ellipse->d_transformation, render_settings);
 
     //We need this to determine the degree of tesselation required for the curved elements
-    float max_scale = std::max(render_settings.d_scaleFactor.x, render_settings.d_scaleFactor.y);
+    float max_scale = calculateMaxScale(scale_factors);
 
     //Get the radii
     const float& radiusX = ellipse->d_rx;
     const float& radiusY = ellipse->d_ry;
 
+    //A radius of zero disables the rendering of the shape
+    if (radiusX <= 0.0f || radiusY <= 0.0f)
+        return geomBuffers;
+
     //Create ellipse points
     std::vector<glm::vec2> ellipse_points;
     createEllipsePoints(radiusX, radiusY, max_scale, ellipse_points);
@@ -310,6 +322,21 @@ std::vector<GeometryBuffer*> SVGTesselator::tesselatePolygon(
     return geomBuffers;
 }
 
+//----------------------------------------------------------------------------//
+GeometryBuffer* SVGTesselator::createGeometryBuffer(
+    const std::vector<float>& vertex_data,
+    const glm::mat4& custom_transform,
+    const SVGImage::SVGImageRenderSettings& render_settings)
+{
+    GeometryBuffer* geometry_buffer = &System::getSingleton().getRenderer()->createGeometryBufferColoured();
+
+    setupGeometryBufferSettings(geometry_buffer, render_settings, custom_transform);
+    if (!vertex_data.empty())
+        geometry_buffer->appendGeometry(vertex_data.data(), vertex_data.size());
+
+    return geometry_buffer;
+}
+
 //----------------------------------------------------------------------------//
 std::vector<GeometryBuffer*> SVGTesselator::setupGeometryBuffers(
     GeometryBuffer*& fill_geometry_buffer,
@@ -359,6 +386,13 @@ glm::vec4 SVGTesselator::getStrokeColour(const SVGPaintStyle &paint_style)
     return glm::vec4(stroke_colour_values.x, stroke_colour_values.y, stroke_colour_values.z, paint_style.d_strokeOpacity);
 }
 
+//----------------------------------------------------------------------------//
+float SVGTesselator::calculateMaxScale(const glm::vec2& scale_factors)
+{
+    //The scale factors are inverted, the smaller one belongs to the larger scale
+    return 1.0f / std::min(scale_factors.x, scale_factors.y);
+}
+
 //----------------------------------------------------------------------------//
 glm::mat4 SVGTesselator::createRenderableMatrixFromSVGMatrix(glm::mat3 svg_matrix)
 {
@@ -424,7 +458,7 @@ void SVGTesselator::createStroke(const std::vector<glm::vec2>& points,
         return;
 
     //We need this to determine the degree of tesselation required for the curved elements
-    float max_scale = std::max(render_settings.d_scaleFactor.x, render_settings.d_scaleFactor.y);
+    float max_scale = calculateMaxScale(scale_factors);
 
     // Create an object containing all the data we need for our segment processing
     StrokeSegmentData stroke_data(geometry_buffer, paint_style.d_strokeWidth * 0.5f, paint_style, max_scale);
@@ -852,11 +886,14 @@ void SVGTesselator::calculateCircleTesselationParameters(const float radius,
                                                          float& cos_value,
                                                          float& sin_value)
 {
-    //Adapt the tesselation to the scale
+    static const float two_pi = 2.0f * glm::pi<float>(); 
+
+    //Adapt the tesselation to the scale. Circles that are small on screen would
+    //otherwise end up with too few segments, or none at all
     float segment_length  = CircleRoundnessValue / max_scale;
-    float theta = std::acos( 1.0f - ( segment_length / radius ) );
+    float theta = std::acos( std::max(1.0f - ( segment_length / radius ), -1.0f) );
+    theta = std::min(theta, two_pi / MinimumCircleSegmentCount);
 
-    static const float two_pi = 2.0f * glm::pi<float>(); 
     //Calculate the number of segments using 360° as angle and using theta
     num_segments = two_pi / theta;
 
@@ -106,6 +106,17 @@ void ItemModel::notifyChildrenDataChanged(ModelIndex parent_index, size_t start_
     fireEvent(EventChildrenDataChanged, args);
 }
 
+//----------------------------------------------------------------------------//
+bool ItemModel::isDataPending(const ModelIndex&, ItemDataRole) const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+void ItemModel::requestData(const ModelIndex&, size_t, size_t)
+{
+}
+
 //----------------------------------------------------------------------------//
 bool ItemModel::areIndicesEqual(const ModelIndex& index1, const ModelIndex& index2) const
 {
@@ -31,6 +31,7 @@
 #include "CEGUI/GUIContext.h"
 #include "CEGUI/widgets/Tooltip.h"
 #include "CEGUI/widgets/Scrollbar.h"
+#include <algorithm>
 
 namespace CEGUI
 {
@@ -47,6 +48,141 @@ ItemView* ItemViewWindowRenderer::getView() const
     return static_cast<ItemView*>(d_window);
 }
 
+//----------------------------------------------------------------------------//
+bool ChildIdRangeSet::contains(size_t id) const
+{
+    // the last range starting at or before id
+    std::vector<Range>::const_iterator itor = std::upper_bound(
+        d_ranges.begin(), d_ranges.end(), id,
+        [](size_t value, const Range& range) { return value < range.d_first; });
+
+    return itor != d_ranges.begin() && id < (itor - 1)->d_end;
+}
+
+//----------------------------------------------------------------------------//
+void ChildIdRangeSet::insert(size_t first, size_t end)
+{
+    if (first >= end)
+        return;
+
+    // ranges overlapping or touching [first, end) are merged with it
+    std::vector<Range>::iterator begin_itor = std::lower_bound(
+        d_ranges.begin(), d_ranges.end(), first,
+        [](const Range& range, size_t value) { return range.d_end < value; });
+    std::vector<Range>::iterator end_itor = std::upper_bound(
+        begin_itor, d_ranges.end(), end,
+        [](size_t value, const Range& range) { return value < range.d_first; });
+
+    Range merged = { first, end };
+    for (std::vector<Range>::iterator itor = begin_itor; itor != end_itor; ++itor)
+    {
+        merged.d_first = std::min(merged.d_first, itor->d_first);
+        merged.d_end = std::max(merged.d_end, itor->d_end);
+        d_count -= itor->d_end - itor->d_first;
+    }
+
+    d_count += merged.d_end - merged.d_first;
+    begin_itor = d_ranges.erase(begin_itor, end_itor);
+    d_ranges.insert(begin_itor, merged);
+}
+
+//----------------------------------------------------------------------------//
+void ChildIdRangeSet::erase(size_t first, size_t end)
+{
+    if (first >= end)
+        return;
+
+    std::vector<Range>::iterator begin_itor = std::upper_bound(
+        d_ranges.begin(), d_ranges.end(), first,
+        [](size_t value, const Range& range) { return value < range.d_end; });
+    std::vector<Range>::iterator end_itor = std::lower_bound(
+        begin_itor, d_ranges.end(), end,
+        [](const Range& range, size_t value) { return range.d_first < value; });
+
+    if (begin_itor == end_itor)
+        return;
+
+    // the parts of the first and last ranges outside [first, end) remain
+    std::vector<Range> remaining;
+    if (begin_itor->d_first < first)
+    {
+        const Range left = { begin_itor->d_first, first };
+        remaining.push_back(left);
+    }
+    if ((end_itor - 1)->d_end > end)
+    {
+        const Range right = { end, (end_itor - 1)->d_end };
+        remaining.push_back(right);
+    }
+
+    for (std::vector<Range>::iterator itor = begin_itor; itor != end_itor; ++itor)
+        d_count -= itor->d_end - itor->d_first;
+    for (std::vector<Range>::iterator itor = remaining.begin(); itor != remaining.end(); ++itor)
+        d_count += itor->d_end - itor->d_first;
+
+    begin_itor = d_ranges.erase(begin_itor, end_itor);
+    d_ranges.insert(begin_itor, remaining.begin(), remaining.end());
+}
+
+//----------------------------------------------------------------------------//
+void ChildIdRangeSet::insertChildren(size_t start, size_t count)
+{
+    if (count == 0)
+        return;
+
+    std::vector<Range>::iterator itor = std::upper_bound(
+        d_ranges.begin(), d_ranges.end(), start,
+        [](size_t value, const Range& range) { return value < range.d_end; });
+
+    // the new children are not selected, so they split a range they fall into
+    if (itor != d_ranges.end() && itor->d_first < start)
+    {
+        const Range right = { start, itor->d_end };
+        itor->d_end = start;
+        itor = d_ranges.insert(itor + 1, right);
+    }
+
+    for (; itor != d_ranges.end(); ++itor)
+    {
+        itor->d_first += count;
+        itor->d_end += count;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ChildIdRangeSet::removeChildren(size_t start, size_t count)
+{
+    if (count == 0)
+        return;
+
+    erase(start, start + count);
+
+    std::vector<Range>::iterator itor = std::lower_bound(
+        d_ranges.begin(), d_ranges.end(), start,
+        [](const Range& range, size_t value) { return range.d_first < value; });
+
+    for (std::vector<Range>::iterator shifted = itor; shifted != d_ranges.end(); ++shifted)
+    {
+        shifted->d_first -= count;
+        shifted->d_end -= count;
+    }
+
+    // ranges on both sides of the removed children may now touch
+    if (itor != d_ranges.begin() && itor != d_ranges.end() &&
+        (itor - 1)->d_end == itor->d_first)
+    {
+        (itor - 1)->d_end = itor->d_end;
+        d_ranges.erase(itor);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ChildIdRangeSet::clear()
+{
+    d_ranges.clear();
+    d_count = 0;
+}
+
 //----------------------------------------------------------------------------//
 const String& PropertyHelper<ScrollbarDisplayMode>::getDataTypeName()
 {
@@ -113,6 +249,8 @@ PropertyHelper<ViewSortMode>::toString(pass_type val)
 //----------------------------------------------------------------------------//
 const Colour ItemView::DefaultTextColour = 0xFFFFFFFF;
 const Colour ItemView::DefaultSelectionColour = Colour(0xFF4444AA);
+const String ItemView::DefaultPendingItemText("...");
+const size_t ItemView::DefaultDataPrefetchCount = 32;
 const String ItemView::HorzScrollbarName("__auto_hscrollbar__");
 const String ItemView::VertScrollbarName("__auto_vscrollbar__");
 const String ItemView::EventVertScrollbarDisplayModeChanged("VertScrollbarDisplayModeChanged");
@@ -130,6 +268,9 @@ ItemView::ItemView(const String& type, const String& name) :
     d_selectionColourRect(ColourRect(DefaultSelectionColour)),
     d_isDirty(true),
     d_needsFullRender(true),
+    d_needsItemsUpdate(true),
+    d_partialInvalidation(false),
+    d_indexSelectionStatesOutdated(false),
     d_lastSelectedIndex(nullptr),
     d_selectionBrush(nullptr),
     d_vertScrollbarDisplayMode(ScrollbarDisplayMode::WhenNeeded),
@@ -139,6 +280,8 @@ ItemView::ItemView(const String& type, const String& name) :
     d_sortMode(ViewSortMode::NoSorting),
     d_isAutoResizeHeightEnabled(false),
     d_isAutoResizeWidthEnabled(false),
+    d_pendingItemText(DefaultPendingItemText),
+    d_dataPrefetchCount(DefaultDataPrefetchCount),
     d_renderedMaxWidth(0),
     d_renderedTotalHeight(0),
     d_eventChildrenAddedConnection(nullptr),
@@ -225,6 +368,22 @@ void ItemView::addItemViewProperties()
         &ItemView::setAutoResizeWidthEnabled,
         &ItemView::isAutoResizeWidthEnabled, false
         )
+
+    CEGUI_DEFINE_PROPERTY(ItemView, String,
+        "PendingItemText",
+        "Property to get/set the text shown for the items whose data the model "
+        "is still fetching. Value is a string.",
+        &ItemView::setPendingItemText, &ItemView::getPendingItemText,
+        DefaultPendingItemText
+        )
+
+    CEGUI_DEFINE_PROPERTY(ItemView, size_t,
+        "DataPrefetchCount",
+        "Property to get/set how many items before and after the visible ones "
+        "the model is asked to fetch. Value is an unsigned integer.",
+        &ItemView::setDataPrefetchCount, &ItemView::getDataPrefetchCount,
+        DefaultDataPrefetchCount
+        )
 }
 
 //----------------------------------------------------------------------------//
@@ -253,7 +412,7 @@ void ItemView::setModel(ItemModel* item_model)
     d_itemModel = item_model;
 
     connectToModelEvents(d_itemModel);
-    d_indexSelectionStates.clear();
+    clearSelections();
     d_needsFullRender = true;
 
     ItemViewEventArgs args(this);
@@ -299,17 +458,10 @@ bool ItemView::onChildrenAdded(const EventArgs& args)
 {
     const ModelEventArgs& model_args = static_cast<const ModelEventArgs&>(args);
 
-    for (SelectionStatesVector::iterator itor = d_indexSelectionStates.begin();
-        itor != d_indexSelectionStates.end(); ++itor)
+    if (ChildIdRangeSet* selected = findSelectedChildIds(model_args.d_parentIndex, false))
     {
-        ModelIndexSelectionState& state = *itor;
-
-        if (state.d_childId >= model_args.d_startId &&
-            d_itemModel->areIndicesEqual(state.d_parentIndex, model_args.d_parentIndex))
-        {
-            state.d_childId += model_args.d_count;
-            state.d_selectedIndex = d_itemModel->makeIndex(state.d_childId, state.d_parentIndex);
-        }
+        selected->insertChildren(model_args.d_startId, model_args.d_count);
+        d_indexSelectionStatesOutdated = true;
     }
 
     invalidateView(false);
@@ -326,23 +478,20 @@ bool ItemView::onChildrenWillBeRemoved(const EventArgs& args)
 
     const ModelEventArgs& model_args = static_cast<const ModelEventArgs&>(args);
 
-    SelectionStatesVector::iterator itor = d_indexSelectionStates.begin();
-    while (itor != d_indexSelectionStates.end())
+    if (d_lastSelectedIndex.d_modelData != nullptr &&
+        d_itemModel->areIndicesEqual(
+            d_itemModel->getParentIndex(d_lastSelectedIndex), model_args.d_parentIndex))
     {
-        ModelIndexSelectionState& state = *itor;
-
-        if (state.d_childId >= model_args.d_startId &&
-            state.d_childId <= model_args.d_startId + model_args.d_count)
-        {
-            if (d_itemModel->areIndicesEqual(d_lastSelectedIndex, state.d_selectedIndex))
-                d_lastSelectedIndex = ModelIndex(nullptr);
+        const int child_id = d_itemModel->getChildId(d_lastSelectedIndex);
+        if (child_id >= static_cast<int>(model_args.d_startId) &&
+            child_id < static_cast<int>(model_args.d_startId + model_args.d_count))
+            d_lastSelectedIndex = ModelIndex(nullptr);
+    }
 
-            itor = d_indexSelectionStates.erase(itor);
-        }
-        else
-        {
-            ++itor;
-        }
+    if (ChildIdRangeSet* selected = findSelectedChildIds(model_args.d_parentIndex, false))
+    {
+        selected->removeChildren(model_args.d_startId, model_args.d_count);
+        d_indexSelectionStatesOutdated = true;
     }
 
     return true;
@@ -377,13 +526,15 @@ bool ItemView::onChildrenDataChanged(const EventArgs&)
 void ItemView::onSelectionChanged(ItemViewEventArgs& args)
 {
     invalidateView(false);
-    fireEvent(EventSelectionChanged, args);
+    // changes made within an EventSet::BatchScope are reported once
+    fireCoalescedEvent(EventSelectionChanged, args);
 }
 
 //----------------------------------------------------------------------------//
 bool ItemView::onScrollPositionChanged(const EventArgs&)
 {
-    invalidateView(false);
+    // scrolling alone does not change the rendering states of the items
+    invalidateViewPartially(false);
     return true;
 }
 
@@ -428,13 +579,23 @@ void ItemView::disconnectModelEvents()
 //----------------------------------------------------------------------------//
 void ItemView::invalidateView(bool recursive)
 {
-    //TODO: allow invalidation only of certain parts (e.g.: items/indices)
+    if (!d_partialInvalidation)
+        d_needsItemsUpdate = true;
+
     updateScrollbars();
     resizeToContent();
     setIsDirty(true);
     invalidate(recursive);
 }
 
+//----------------------------------------------------------------------------//
+void ItemView::invalidateViewPartially(bool recursive)
+{
+    d_partialInvalidation = true;
+    invalidateView(recursive);
+    d_partialInvalidation = false;
+}
+
 //----------------------------------------------------------------------------//
 ItemModel* ItemView::getModel() const
 {
@@ -480,6 +641,29 @@ void ItemView::setSelectionColourRect(const ColourRect& colour_rect)
 //----------------------------------------------------------------------------//
 const std::vector<ModelIndexSelectionState>& ItemView::getIndexSelectionStates() const
 {
+    if (!d_indexSelectionStatesOutdated)
+        return d_indexSelectionStates;
+
+    d_indexSelectionStates.clear();
+    d_indexSelectionStates.reserve(getSelectionCount());
+    for (std::vector<SelectedChildren>::const_iterator itor = d_selection.begin();
+        itor != d_selection.end(); ++itor)
+    {
+        const std::vector<ChildIdRangeSet::Range>& ranges = itor->d_childIds.getRanges();
+        for (size_t i = 0; i < ranges.size(); ++i)
+        {
+            for (size_t id = ranges[i].d_first; id < ranges[i].d_end; ++id)
+            {
+                ModelIndexSelectionState state;
+                state.d_parentIndex = itor->d_parentIndex;
+                state.d_childId = id;
+                state.d_selectedIndex = d_itemModel->makeIndex(id, itor->d_parentIndex);
+                d_indexSelectionStates.push_back(state);
+            }
+        }
+    }
+
+    d_indexSelectionStatesOutdated = false;
     return d_indexSelectionStates;
 }
 
@@ -496,24 +680,95 @@ void ItemView::setIsDirty(bool value)
 }
 
 //----------------------------------------------------------------------------//
-int ItemView::getSelectedIndexPosition(const ModelIndex& index) const
+ChildIdRangeSet* ItemView::findSelectedChildIds(const ModelIndex& parent_index,
+    bool create)
+{
+    for (std::vector<SelectedChildren>::iterator itor = d_selection.begin();
+        itor != d_selection.end(); ++itor)
+    {
+        if (d_itemModel->areIndicesEqual(itor->d_parentIndex, parent_index))
+            return &itor->d_childIds;
+    }
+
+    if (!create)
+        return nullptr;
+
+    SelectedChildren selected;
+    selected.d_parentIndex = parent_index;
+    d_selection.push_back(selected);
+    return &d_selection.back().d_childIds;
+}
+
+//----------------------------------------------------------------------------//
+const ChildIdRangeSet* ItemView::getSelectedChildIds(const ModelIndex& parent_index) const
 {
     if (d_itemModel == nullptr)
-        return false;
+        return nullptr;
 
-    for (size_t i = 0; i < d_indexSelectionStates.size(); ++i)
+    for (std::vector<SelectedChildren>::const_iterator itor = d_selection.begin();
+        itor != d_selection.end(); ++itor)
     {
-        if (d_itemModel->areIndicesEqual(index, d_indexSelectionStates.at(i).d_selectedIndex))
-            return i;
+        if (d_itemModel->areIndicesEqual(itor->d_parentIndex, parent_index))
+            return itor->d_childIds.empty() ? nullptr : &itor->d_childIds;
     }
 
-    return -1;
+    return nullptr;
 }
 
 //----------------------------------------------------------------------------//
 bool ItemView::isIndexSelected(const ModelIndex& index) const
 {
-    return getSelectedIndexPosition(index) != -1;
+    if (d_selection.empty() || d_itemModel == nullptr)
+        return false;
+
+    const ChildIdRangeSet* selected = getSelectedChildIds(d_itemModel->getParentIndex(index));
+    if (selected == nullptr)
+        return false;
+
+    const int child_id = d_itemModel->getChildId(index);
+    return child_id != -1 && selected->contains(static_cast<size_t>(child_id));
+}
+
+//----------------------------------------------------------------------------//
+bool ItemView::isChildSelected(const ModelIndex& parent_index, size_t child_id) const
+{
+    if (d_selection.empty())
+        return false;
+
+    const ChildIdRangeSet* selected = getSelectedChildIds(parent_index);
+    return selected != nullptr && selected->contains(child_id);
+}
+
+//----------------------------------------------------------------------------//
+size_t ItemView::getSelectionCount() const
+{
+    size_t count = 0;
+    for (std::vector<SelectedChildren>::const_iterator itor = d_selection.begin();
+        itor != d_selection.end(); ++itor)
+    {
+        count += itor->d_childIds.getCount();
+    }
+
+    return count;
+}
+
+//----------------------------------------------------------------------------//
+bool ItemView::selectAll()
+{
+    if (d_itemModel == nullptr || !d_isMultiSelectEnabled)
+        return false;
+
+    const ModelIndex root_index = d_itemModel->getRootIndex();
+    const size_t child_count = d_itemModel->getChildCount(root_index);
+    if (child_count == 0)
+        return false;
+
+    findSelectedChildIds(root_index, true)->insert(0, child_count);
+    d_indexSelectionStatesOutdated = true;
+
+    ItemViewEventArgs args(this);
+    onSelectionChanged(args);
+    return true;
 }
 
 //----------------------------------------------------------------------------//
@@ -707,7 +962,7 @@ void ItemView::setupTooltip(glm::vec2 position)
     if (!d_itemModel->isValidIndex(index))
         setTooltipText("");
     else
-        setTooltipText(d_itemModel->getData(index, ItemDataRole::Tooltip));
+        setTooltipText(getItemData(index, ItemDataRole::Tooltip));
 }
 
 //----------------------------------------------------------------------------//
@@ -727,9 +982,9 @@ void ItemView::setMultiSelectEnabled(bool enabled)
     d_isMultiSelectEnabled = enabled;
 
     // deselect others
-    if (!d_isItemTooltipsEnabled && d_indexSelectionStates.size() > 1)
+    if (!d_isItemTooltipsEnabled && getSelectionCount() > 1)
     {
-        setIndexSelectionState(d_indexSelectionStates.front().d_selectedIndex, true);
+        setIndexSelectionState(getIndexSelectionStates().front().d_selectedIndex, true);
     }
 
     WindowEventArgs args(this);
@@ -800,12 +1055,18 @@ bool ItemView::handleSelection(const ModelIndex& index, bool should_select,
         !d_itemModel->isValidIndex(index))
         return false;
 
-    int index_position = getSelectedIndexPosition(index);
-    if (index_position != -1)
+    const ModelIndex parent_index = d_itemModel->getParentIndex(index);
+    const int child_id = d_itemModel->getChildId(index);
+    if (child_id == -1)
+        return false;
+
+    if (isChildSelected(parent_index, static_cast<size_t>(child_id)))
     {
         if (!should_select)
         {
-            d_indexSelectionStates.erase(d_indexSelectionStates.begin() + index_position);
+            findSelectedChildIds(parent_index, false)->erase(
+                static_cast<size_t>(child_id), static_cast<size_t>(child_id) + 1);
+            d_indexSelectionStatesOutdated = true;
 
             ItemViewEventArgs args(this, index);
             onSelectionChanged(args);
@@ -817,33 +1078,32 @@ bool ItemView::handleSelection(const ModelIndex& index, bool should_select,
         if (is_cumulative)
             return true;
     }
-
-    if (!is_cumulative)
-        d_indexSelectionStates.clear();
-
-    ModelIndex parent_index = d_itemModel->getParentIndex(index);
-    size_t end_child_id = d_itemModel->getChildId(index);
-    size_t start_child_id = end_child_id;
-    if (is_range && is_cumulative && d_lastSelectedIndex.d_modelData != nullptr)
+    else if (!should_select)
     {
-        start_child_id = d_itemModel->getChildId(d_lastSelectedIndex);
+        return false;
     }
 
-    for (size_t id = start_child_id; id <= end_child_id; ++id)
+    if (!is_cumulative)
+        clearSelections();
+
+    // a range goes from the last selected sibling to the index, either way
+    size_t start_child_id = static_cast<size_t>(child_id);
+    size_t end_child_id = start_child_id;
+    if (is_range && is_cumulative && d_lastSelectedIndex.d_modelData != nullptr &&
+        d_itemModel->areIndicesEqual(
+            d_itemModel->getParentIndex(d_lastSelectedIndex), parent_index))
     {
-        ModelIndexSelectionState selection_state;
-        selection_state.d_selectedIndex = d_itemModel->makeIndex(id, parent_index);
-
-        // ignore already selected indices
-        if (getSelectedIndexPosition(selection_state.d_selectedIndex) != -1)
-            continue;
-
-        selection_state.d_childId = id;
-        selection_state.d_parentIndex = parent_index;
-
-        d_indexSelectionStates.push_back(selection_state);
+        const int last_child_id = d_itemModel->getChildId(d_lastSelectedIndex);
+        if (last_child_id != -1)
+        {
+            start_child_id = std::min(start_child_id, static_cast<size_t>(last_child_id));
+            end_child_id = std::max(end_child_id, static_cast<size_t>(last_child_id));
+        }
     }
 
+    findSelectedChildIds(parent_index, true)->insert(start_child_id, end_child_id + 1);
+    d_indexSelectionStatesOutdated = true;
+
     d_lastSelectedIndex = index;
 
     ItemViewEventArgs args(this, index);
@@ -882,13 +1142,15 @@ void ItemView::onSortModeChanged(WindowEventArgs& args)
 //----------------------------------------------------------------------------//
 void ItemView::onViewContentsChanged(WindowEventArgs& args)
 {
-    fireEvent(EventViewContentsChanged, args, EventNamespace);
+    fireCoalescedEvent(EventViewContentsChanged, args, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void ItemView::clearSelections()
 {
+    d_selection.clear();
     d_indexSelectionStates.clear();
+    d_indexSelectionStatesOutdated = false;
 }
 
 //----------------------------------------------------------------------------//
@@ -896,10 +1158,15 @@ void ItemView::handleSelectionNavigation(SemanticEventArgs& e)
 {
     ModelIndex parent_index = d_itemModel->getRootIndex();
     int last_selected_child_id = -1;
-    if (!d_indexSelectionStates.empty())
+    if (d_lastSelectedIndex.d_modelData != nullptr && getSelectionCount() != 0)
     {
-        ModelIndexSelectionState last_selection = d_indexSelectionStates.back();
-        last_selected_child_id = last_selection.d_childId;
+        last_selected_child_id = d_itemModel->getChildId(d_lastSelectedIndex);
+        parent_index = d_itemModel->getParentIndex(d_lastSelectedIndex);
+    }
+    else if (getSelectionCount() != 0)
+    {
+        const ModelIndexSelectionState& last_selection = getIndexSelectionStates().back();
+        last_selected_child_id = static_cast<int>(last_selection.d_childId);
         parent_index = last_selection.d_parentIndex;
     }
 
@@ -1038,4 +1305,140 @@ ItemViewEventArgs::ItemViewEventArgs(ItemView* wnd, ModelIndex index)
 {
 }
 
+//----------------------------------------------------------------------------//
+void ItemView::RowOffsets::reset(size_t count, float height)
+{
+    d_heights.assign(count, height);
+    rebuild();
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::RowOffsets::insert(size_t row, size_t count, float height)
+{
+    d_heights.insert(d_heights.begin() + row, count, height);
+    rebuild();
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::RowOffsets::erase(size_t row, size_t count)
+{
+    d_heights.erase(d_heights.begin() + row, d_heights.begin() + row + count);
+    rebuild();
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::RowOffsets::setHeight(size_t row, float height)
+{
+    const float delta = height - d_heights[row];
+    if (delta == 0.0f)
+        return;
+
+    d_heights[row] = height;
+    for (size_t i = row + 1; i < d_tree.size(); i += i & (~i + 1))
+        d_tree[i] += delta;
+}
+
+//----------------------------------------------------------------------------//
+float ItemView::RowOffsets::getOffset(size_t row) const
+{
+    float offset = 0.0f;
+    for (size_t i = row; i > 0; i -= i & (~i + 1))
+        offset += d_tree[i];
+
+    return offset;
+}
+
+//----------------------------------------------------------------------------//
+size_t ItemView::RowOffsets::findRow(float offset) const
+{
+    const size_t count = d_heights.size();
+
+    size_t step = 1;
+    while (step * 2 <= count)
+        step *= 2;
+
+    // descend the tree to the number of rows ending at or before the offset
+    size_t row = 0;
+    for (; step > 0 && count > 0; step /= 2)
+    {
+        if (row + step <= count && d_tree[row + step] <= offset)
+        {
+            row += step;
+            offset -= d_tree[row];
+        }
+    }
+
+    return row;
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::RowOffsets::rebuild()
+{
+    const size_t count = d_heights.size();
+    d_tree.assign(count + 1, 0.0f);
+
+    for (size_t i = 1; i <= count; ++i)
+    {
+        d_tree[i] += d_heights[i - 1];
+        const size_t parent = i + (i & (~i + 1));
+        if (parent <= count)
+            d_tree[parent] += d_tree[i];
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::setPendingItemText(const String& text)
+{
+    if (d_pendingItemText == text)
+        return;
+
+    d_pendingItemText = text;
+    invalidateView(false);
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::setDataPrefetchCount(size_t count)
+{
+    d_dataPrefetchCount = count;
+}
+
+//----------------------------------------------------------------------------//
+String ItemView::getItemData(const ModelIndex& index, ItemDataRole role)
+{
+    if (!d_itemModel->isDataPending(index, role))
+        return d_itemModel->getData(index, role);
+
+    return role == ItemDataRole::Icon ? String() : d_pendingItemText;
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::requestItemData(const ModelIndex& parent_index,
+    const ChildIdRangeSet& child_ids)
+{
+    if (child_ids.empty())
+        return;
+
+    const size_t child_count = d_itemModel->getChildCount(parent_index);
+
+    // ranges closer than twice the prefetch count merge once extended
+    ChildIdRangeSet requested;
+    const std::vector<ChildIdRangeSet::Range>& ranges = child_ids.getRanges();
+    for (std::vector<ChildIdRangeSet::Range>::const_iterator itor = ranges.begin();
+        itor != ranges.end(); ++itor)
+    {
+        const size_t first = itor->d_first > d_dataPrefetchCount ?
+            itor->d_first - d_dataPrefetchCount : 0;
+        const size_t end = std::min(itor->d_end + d_dataPrefetchCount, child_count);
+        if (first < end)
+            requested.insert(first, end);
+    }
+
+    const std::vector<ChildIdRangeSet::Range>& requested_ranges = requested.getRanges();
+    for (std::vector<ChildIdRangeSet::Range>::const_iterator itor = requested_ranges.begin();
+        itor != requested_ranges.end(); ++itor)
+    {
+        d_itemModel->requestData(parent_index, itor->d_first, itor->d_end - itor->d_first);
+    }
+}
+
 }
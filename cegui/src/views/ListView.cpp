@@ -35,31 +35,17 @@
 #include "CEGUI/RenderedStringWordWrapper.h"
 #include "CEGUI/RenderedStringParser.h"
 #include "CEGUI/widgets/Scrollbar.h"
+#include "CEGUI/Font.h"
 #include <algorithm> // sort
 
 namespace CEGUI
 {
 typedef std::vector<ListViewItemRenderingState> ViewItemsVector;
 
-//----------------------------------------------------------------------------//
-static bool listViewItemPointerLess(
-    const ListViewItemRenderingState* item1,
-    const ListViewItemRenderingState* item2)
-{
-    return *item1 < *item2;
-}
-
-//----------------------------------------------------------------------------//
-static bool listViewItemPointerGreater(
-    const ListViewItemRenderingState* item1,
-    const ListViewItemRenderingState* item2)
-{
-    return *item1 > *item2;
-}
-
 //----------------------------------------------------------------------------//
 const String ListView::EventNamespace("ListView");
 const String ListView::WidgetTypeName("CEGUI/ListView");
+const size_t ListView::VirtualisedOverscanRows = 4;
 
 //----------------------------------------------------------------------------//
 ListViewItemRenderingState::ListViewItemRenderingState(ListView* list_view) :
@@ -176,7 +162,12 @@ bool ListViewItemRenderingState::operator>(const ListViewItemRenderingState& oth
 //----------------------------------------------------------------------------//
 ListView::ListView(const String& type, const String& name) :
     ItemView(type, name),
-    d_horzFormatting(HorizontalTextFormatting::LeftAligned)
+    d_horzFormatting(HorizontalTextFormatting::LeftAligned),
+    d_virtualised(false),
+    d_virtualisedRowHeight(0.0f),
+    d_firstVirtualRow(0),
+    d_textIndexModel(nullptr),
+    d_textIndexOutdated(true)
 {
     const String& propertyOrigin = "ListView";
 
@@ -185,6 +176,21 @@ ListView::ListView(const String& type, const String& name) :
         "  Value is one of the HorzFormatting strings.",
         &ListView::setHorizontalFormatting, &ListView::getHorizontalFormatting,
         HorizontalTextFormatting::LeftAligned);
+
+    CEGUI_DEFINE_PROPERTY(ListView, bool,
+        "Virtualised", "Property to get/set whether only the items around the "
+        "visible area are laid out and rendered. Value is either \"true\" or \"false\".",
+        &ListView::setVirtualised, &ListView::isVirtualised, false);
+
+    CEGUI_DEFINE_PROPERTY(ListView, float,
+        "VirtualisedRowHeight", "Property to get/set the height of the items in "
+        "virtualised mode; 0 estimates it from the font. Value is a float.",
+        &ListView::setVirtualisedRowHeight, &ListView::getVirtualisedRowHeight, 0.0f);
+
+    CEGUI_DEFINE_PROPERTY(ListView, String,
+        "FilterText", "Property to get/set the text that the shown items must "
+        "start with; empty shows all items. Value is a string.",
+        &ListView::setFilterText, &ListView::getFilterText, "");
 }
 
 //----------------------------------------------------------------------------//
@@ -201,6 +207,120 @@ void ListView::setHorizontalFormatting(HorizontalTextFormatting h_fmt)
     d_needsFullRender = true;
 }
 
+//----------------------------------------------------------------------------//
+void ListView::setVirtualised(bool virtualised)
+{
+    if (virtualised == d_virtualised)
+        return;
+
+    d_virtualised = virtualised;
+    d_items.clear();
+    d_sortedItems.clear();
+    d_rowOffsets.reset(0, 0.0f);
+    d_sortOrder.clear();
+    d_firstVirtualRow = 0;
+    d_needsFullRender = true;
+    invalidateView(false);
+}
+
+//----------------------------------------------------------------------------//
+void ListView::setVirtualisedRowHeight(float height)
+{
+    if (height == d_virtualisedRowHeight)
+        return;
+
+    d_virtualisedRowHeight = height;
+    if (d_virtualised)
+    {
+        d_needsFullRender = true;
+        invalidateView(false);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ListView::setFilterText(const String& text)
+{
+    if (text == d_filterText)
+        return;
+
+    d_filterText = text;
+    d_needsFullRender = true;
+    invalidateView(false);
+}
+
+//----------------------------------------------------------------------------//
+int ListView::findChildIdWithText(const String& text, size_t start_id)
+{
+    if (d_itemModel == nullptr)
+        return -1;
+
+    updateTextIndex();
+
+    // equal texts are ordered by child id
+    const auto itor = std::lower_bound(d_textIndex.begin(), d_textIndex.end(),
+        std::make_pair(text, start_id));
+
+    if (itor == d_textIndex.end() || itor->first != text)
+        return -1;
+
+    return static_cast<int>(itor->second);
+}
+
+//----------------------------------------------------------------------------//
+void ListView::updateTextIndex()
+{
+    if (!d_textIndexOutdated && d_textIndexModel == d_itemModel)
+        return;
+
+    const ModelIndex root_index = d_itemModel->getRootIndex();
+    const size_t child_count = d_itemModel->getChildCount(root_index);
+
+    d_textIndex.clear();
+    d_textIndex.reserve(child_count);
+    for (size_t child = 0; child < child_count; ++child)
+    {
+        d_textIndex.push_back(std::make_pair(
+            d_itemModel->getData(d_itemModel->makeIndex(child, root_index)), child));
+    }
+
+    std::sort(d_textIndex.begin(), d_textIndex.end());
+    d_textIndexModel = d_itemModel;
+    d_textIndexOutdated = false;
+}
+
+//----------------------------------------------------------------------------//
+void ListView::buildFilteredRows()
+{
+    d_filteredRows.clear();
+    if (!isFiltered())
+        return;
+
+    updateTextIndex();
+
+    // texts starting with the filter follow each other in the index
+    const size_t filter_length = d_filterText.length();
+    for (auto itor = std::lower_bound(d_textIndex.begin(), d_textIndex.end(),
+            std::make_pair(d_filterText, size_t(0)));
+         itor != d_textIndex.end() && itor->first.compare(0, filter_length, d_filterText) == 0;
+         ++itor)
+    {
+        d_filteredRows.push_back(itor->second);
+    }
+
+    if (d_sortMode == ViewSortMode::NoSorting)
+    {
+        std::sort(d_filteredRows.begin(), d_filteredRows.end());
+    }
+    else
+    {
+        std::sort(d_filteredRows.begin(), d_filteredRows.end(),
+            [this](size_t child1, size_t child2)
+        {
+            return isChildBefore(child1, child2);
+        });
+    }
+}
+
 //----------------------------------------------------------------------------//
 void ListView::prepareForRender()
 {
@@ -208,23 +328,39 @@ void ListView::prepareForRender()
     if (d_itemModel == nullptr || !isDirty())
         return;
 
+    if (d_virtualised)
+    {
+        prepareVirtualisedRows();
+        return;
+    }
+
     if (d_needsFullRender)
     {
         d_renderedMaxWidth = d_renderedTotalHeight = 0;
         d_items.clear();
     }
+    else if (!d_needsItemsUpdate)
+    {
+        // model changes were applied to the affected items as they came
+        updateScrollbars();
+        setIsDirty(false);
+        return;
+    }
 
     ModelIndex root_index = d_itemModel->getRootIndex();
     size_t child_count = d_itemModel->getChildCount(root_index);
 
+    // every item is laid out, so all of them are requested
+    ChildIdRangeSet requested_children;
+    requested_children.insert(0, child_count);
+    requestItemData(root_index, requested_children);
+
     for (size_t child = 0; child < child_count; ++child)
     {
-        ModelIndex index = d_itemModel->makeIndex(child, root_index);
-
         if (d_needsFullRender)
         {
             ListViewItemRenderingState state = ListViewItemRenderingState(this);
-            updateItem(state, index, d_renderedMaxWidth, d_renderedTotalHeight);
+            updateItem(state, child, d_renderedMaxWidth, d_renderedTotalHeight);
             d_items.push_back(std::move(state));
         }
         else
@@ -232,14 +368,265 @@ void ListView::prepareForRender()
             ListViewItemRenderingState& item = d_items.at(child);
             d_renderedTotalHeight -= item.d_size.d_height;
 
-            updateItem(item, index, d_renderedMaxWidth, d_renderedTotalHeight);
+            updateItem(item, child, d_renderedMaxWidth, d_renderedTotalHeight);
         }
     }
 
+    // the order is kept up to date along with the model notifications
+    if (d_needsFullRender || d_sortedItems.size() != getRowCount(d_items.size()))
+        resortListView();
+
+    updateScrollbars();
+    setIsDirty(false);
+    d_needsFullRender = false;
+    d_needsItemsUpdate = false;
+}
+
+//----------------------------------------------------------------------------//
+void ListView::prepareVirtualisedRows()
+{
+    const ModelIndex root_index = d_itemModel->getRootIndex();
+    const size_t child_count = d_itemModel->getChildCount(root_index);
+
+    if (d_needsFullRender || d_rowOffsets.size() != getRowCount(child_count))
+    {
+        d_renderedMaxWidth = 0;
+        d_needsItemsUpdate = true;
+        buildSortOrder(child_count);
+        buildFilteredRows();
+        d_rowOffsets.reset(getRowCount(child_count), getVirtualisedRowEstimate());
+    }
+
+    const size_t row_count = d_rowOffsets.size();
+
+    // rows within the visible area, extended by the overscan rows
+    const ItemViewWindowRenderer* const view_renderer = getViewRenderer();
+    const float view_top = getVertScrollbar()->getScrollPosition();
+    const float view_height = view_renderer ?
+        view_renderer->getViewRenderArea().getHeight() : getPixelSize().d_height;
+
+    size_t first_row = d_rowOffsets.findRow(view_top);
+    first_row = first_row > VirtualisedOverscanRows ? first_row - VirtualisedOverscanRows : 0;
+    const size_t last_row = d_rowOffsets.findRow(view_top + view_height);
+    const size_t end_row = std::min(last_row + 1 + VirtualisedOverscanRows, row_count);
+
+    ChildIdRangeSet requested_children;
+    for (size_t row = first_row; row < end_row; ++row)
+    {
+        const size_t child_id = getChildIdForRow(row);
+        requested_children.insert(child_id, child_id + 1);
+    }
+    requestItemData(root_index, requested_children);
+
+    // rows staying in view are kept unless their contents may have changed,
+    // the states of the others are recycled for the rows scrolled into view
+    const size_t old_first_row = d_firstVirtualRow;
+    const size_t old_end_row = d_firstVirtualRow + d_items.size();
+    ViewItemsVector spare_items;
+    for (size_t i = 0; i < d_items.size(); ++i)
+    {
+        const size_t row = old_first_row + i;
+        if (d_needsItemsUpdate || row < first_row || row >= end_row)
+            spare_items.push_back(std::move(d_items[i]));
+    }
+
+    ViewItemsVector items;
+    items.reserve(end_row > first_row ? end_row - first_row : 0);
+    for (size_t row = first_row; row < end_row; ++row)
+    {
+        if (!d_needsItemsUpdate && row >= old_first_row && row < old_end_row)
+        {
+            items.push_back(std::move(d_items[row - old_first_row]));
+            continue;
+        }
+
+        if (spare_items.empty())
+        {
+            items.push_back(ListViewItemRenderingState(this));
+        }
+        else
+        {
+            items.push_back(std::move(spare_items.back()));
+            spare_items.pop_back();
+        }
+
+        ListViewItemRenderingState& item = items.back();
+        float unused_height = 0;
+        updateItem(item, getChildIdForRow(row), d_renderedMaxWidth, unused_height);
+
+        if (d_virtualisedRowHeight > 0)
+            item.d_size.d_height = d_virtualisedRowHeight;
+
+        d_rowOffsets.setHeight(row, item.d_size.d_height);
+    }
+
+    d_items.swap(items);
+    d_firstVirtualRow = first_row;
+
+    d_sortedItems.clear();
+    for (ViewItemsVector::iterator itor = d_items.begin();
+        itor != d_items.end(); ++itor)
+    {
+        d_sortedItems.push_back(&(*itor));
+    }
+
+    d_renderedTotalHeight = d_rowOffsets.getOffset(row_count);
+
     updateScrollbars();
     setIsDirty(false);
-    resortListView();
     d_needsFullRender = false;
+    d_needsItemsUpdate = false;
+}
+
+//----------------------------------------------------------------------------//
+float ListView::getVirtualisedRowEstimate() const
+{
+    if (d_virtualisedRowHeight > 0)
+        return d_virtualisedRowHeight;
+
+    const Font* font = getActualFont();
+    return font ? font->getLineSpacing() : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+size_t ListView::getChildIdForRow(size_t row) const
+{
+    if (isFiltered())
+        return d_filteredRows[row];
+
+    return d_sortOrder.empty() ? row : d_sortOrder[row];
+}
+
+//----------------------------------------------------------------------------//
+size_t ListView::getRowCount(size_t child_count) const
+{
+    return isFiltered() ? d_filteredRows.size() : child_count;
+}
+
+//----------------------------------------------------------------------------//
+bool ListView::isChildBefore(size_t child1, size_t child2) const
+{
+    const ModelIndex root_index = d_itemModel->getRootIndex();
+    const int result = d_itemModel->compareIndices(
+        d_itemModel->makeIndex(child1, root_index),
+        d_itemModel->makeIndex(child2, root_index));
+
+    return d_sortMode == ViewSortMode::Ascending ? result < 0 : result > 0;
+}
+
+//----------------------------------------------------------------------------//
+size_t ListView::getSortedInsertRow(size_t child_id) const
+{
+    return std::upper_bound(d_sortOrder.begin(), d_sortOrder.end(), child_id,
+        [this](size_t child1, size_t child2)
+    {
+        return isChildBefore(child1, child2);
+    }) - d_sortOrder.begin();
+}
+
+//----------------------------------------------------------------------------//
+void ListView::buildSortOrder(size_t child_count)
+{
+    d_sortOrder.clear();
+    if (d_sortMode == ViewSortMode::NoSorting)
+        return;
+
+    d_sortOrder.resize(child_count);
+    for (size_t child = 0; child < child_count; ++child)
+        d_sortOrder[child] = child;
+
+    std::sort(d_sortOrder.begin(), d_sortOrder.end(),
+        [this](size_t child1, size_t child2)
+    {
+        return isChildBefore(child1, child2);
+    });
+}
+
+//----------------------------------------------------------------------------//
+void ListView::insertIntoSortOrder(size_t start_id, size_t count)
+{
+    for (std::vector<size_t>::iterator itor = d_sortOrder.begin();
+        itor != d_sortOrder.end(); ++itor)
+    {
+        if (*itor >= start_id)
+            *itor += count;
+    }
+
+    for (size_t id = start_id; id < start_id + count; ++id)
+    {
+        const size_t row = getSortedInsertRow(id);
+        d_sortOrder.insert(d_sortOrder.begin() + row, id);
+
+        if (d_virtualised)
+            d_rowOffsets.insert(row, 1, getVirtualisedRowEstimate());
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ListView::eraseFromSortOrder(size_t start_id, size_t count)
+{
+    for (size_t row = d_sortOrder.size(); row-- > 0;)
+    {
+        const size_t id = d_sortOrder[row];
+        if (id >= start_id + count)
+        {
+            d_sortOrder[row] = id - count;
+        }
+        else if (id >= start_id)
+        {
+            d_sortOrder.erase(d_sortOrder.begin() + row);
+
+            if (d_virtualised)
+                d_rowOffsets.erase(row, 1);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ListView::updateSortOrder(size_t start_id, size_t count)
+{
+    // the changed rows are taken out first, so that the others stay sorted
+    // while looking for the new positions
+    std::vector<float> heights(count, getVirtualisedRowEstimate());
+    for (size_t row = d_sortOrder.size(); row-- > 0;)
+    {
+        const size_t id = d_sortOrder[row];
+        if (id < start_id || id >= start_id + count)
+            continue;
+
+        d_sortOrder.erase(d_sortOrder.begin() + row);
+
+        if (d_virtualised)
+        {
+            heights[id - start_id] = d_rowOffsets.getHeight(row);
+            d_rowOffsets.erase(row, 1);
+        }
+    }
+
+    for (size_t id = start_id; id < start_id + count; ++id)
+    {
+        const size_t row = getSortedInsertRow(id);
+        d_sortOrder.insert(d_sortOrder.begin() + row, id);
+
+        if (d_virtualised)
+            d_rowOffsets.insert(row, 1, heights[id - start_id]);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ListView::updateSortedItems()
+{
+    d_sortedItems.resize(getRowCount(d_items.size()));
+    for (size_t row = 0; row < d_sortedItems.size(); ++row)
+        d_sortedItems[row] = &d_items[getChildIdForRow(row)];
+
+    // hidden items don't take any room
+    if (isFiltered())
+    {
+        d_renderedTotalHeight = 0;
+        for (const ListViewItemRenderingState* item : d_sortedItems)
+            d_renderedTotalHeight += item->d_size.d_height;
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -257,6 +644,17 @@ ModelIndex ListView::indexAt(const glm::vec2& position)
     if (!render_area.isPointInRectf(window_position))
         return ModelIndex();
 
+    if (d_virtualised)
+    {
+        const size_t row = d_rowOffsets.findRow(window_position.y -
+            render_area.d_min.y + getVertScrollbar()->getScrollPosition());
+
+        if (row >= d_rowOffsets.size())
+            return ModelIndex();
+
+        return d_itemModel->makeIndex(getChildIdForRow(row), d_itemModel->getRootIndex());
+    }
+
     float cur_height = render_area.d_min.y - getVertScrollbar()->getScrollPosition();
     //TODO: start only on the visible area
     for (size_t index = 0; index < d_sortedItems.size(); ++index)
@@ -284,21 +682,27 @@ const std::vector<ListViewItemRenderingState*>& ListView::getItems() const
 }
 
 //----------------------------------------------------------------------------//
-void ListView::resortListView()
+float ListView::getItemsOffset() const
 {
-    d_sortedItems.clear();
+    if (!d_virtualised)
+        return 0.0f;
 
-    for (ViewItemsVector::iterator itor = d_items.begin();
-        itor != d_items.end(); ++itor)
-    {
-        d_sortedItems.push_back(&(*itor));
-    }
+    return d_rowOffsets.getOffset(std::min(d_firstVirtualRow, d_rowOffsets.size()));
+}
 
-    if (d_sortMode == ViewSortMode::NoSorting)
+//----------------------------------------------------------------------------//
+void ListView::resortListView()
+{
+    // virtualised rows are sorted along with the next full render
+    if (d_virtualised)
+    {
+        d_needsFullRender = true;
         return;
+    }
 
-    sort(d_sortedItems.begin(), d_sortedItems.end(),
-        d_sortMode == ViewSortMode::Ascending ? &listViewItemPointerLess : &listViewItemPointerGreater);
+    buildSortOrder(d_items.size());
+    buildFilteredRows();
+    updateSortedItems();
 }
 
 //----------------------------------------------------------------------------//
@@ -309,10 +713,12 @@ void ListView::resortView()
 }
 
 //----------------------------------------------------------------------------//
-void ListView::updateItem(ListViewItemRenderingState &item, ModelIndex index,
+void ListView::updateItem(ListViewItemRenderingState &item, size_t child_id,
     float& max_width, float& total_height)
 {
-    String text = d_itemModel->getData(index);
+    const ModelIndex root_index = d_itemModel->getRootIndex();
+    const ModelIndex index = d_itemModel->makeIndex(child_id, root_index);
+    String text = getItemData(index);
 
     item.setStringAndFormatting(
         getRenderedStringParser().parse(text, getActualFont(), &d_textColourRect),
@@ -328,7 +734,7 @@ void ListView::updateItem(ListViewItemRenderingState &item, ModelIndex index,
 
     item.d_index = index;
     item.d_text = text;
-    item.d_icon = d_itemModel->getData(index, ItemDataRole::Icon);
+    item.d_icon = getItemData(index, ItemDataRole::Icon);
 
     item.d_size = Sizef(
         item.d_formattedString->getHorizontalExtent(this),
@@ -338,47 +744,134 @@ void ListView::updateItem(ListViewItemRenderingState &item, ModelIndex index,
 
     total_height += item.d_size.d_height;
 
-    item.d_isSelected = isIndexSelected(index);
+    item.d_isSelected = isChildSelected(root_index, child_id);
 }
 
 //----------------------------------------------------------------------------//
 bool ListView::onChildrenAdded(const EventArgs& args)
 {
+    d_partialInvalidation = true;
     ItemView::onChildrenAdded(args);
+    d_partialInvalidation = false;
     const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
 
     if (!d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
         return true;
 
+    d_textIndexOutdated = true;
+    if (isFiltered())
+    {
+        // the filtered rows are looked up again in the updated index
+        d_needsFullRender = true;
+        return true;
+    }
+
+    if (d_virtualised)
+    {
+        // the rows keep the heights measured so far
+        if (d_needsFullRender)
+            return true;
+
+        if (margs.d_startId > d_rowOffsets.size())
+            d_needsFullRender = true;
+        else if (d_sortMode == ViewSortMode::NoSorting)
+            d_rowOffsets.insert(margs.d_startId, margs.d_count, getVirtualisedRowEstimate());
+        else
+            insertIntoSortOrder(margs.d_startId, margs.d_count);
+
+        d_needsItemsUpdate = true;
+        return true;
+    }
+
+    // items not built yet are created along with the pending full render
+    if (d_needsFullRender)
+        return true;
+
+    if (margs.d_startId > d_items.size())
+    {
+        d_needsFullRender = true;
+        return true;
+    }
+
     ViewItemsVector items;
     for (size_t i = 0; i < margs.d_count; ++i)
     {
         ListViewItemRenderingState item(this);
 
-        updateItem(item,
-            d_itemModel->makeIndex(margs.d_startId + i, margs.d_parentIndex),
+        updateItem(item, margs.d_startId + i,
             d_renderedMaxWidth, d_renderedTotalHeight);
 
         items.push_back(std::move(item));
     }
 
+    const ListViewItemRenderingState* const old_items = d_items.data();
     d_items.insert(d_items.begin() + margs.d_startId, std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
 
-    //TODO: insert in the right place directly!
-    resortListView();
-    invalidateView(false);
+    if (d_sortMode != ViewSortMode::NoSorting)
+    {
+        insertIntoSortOrder(margs.d_startId, margs.d_count);
+        updateSortedItems();
+    }
+    else if (d_items.data() == old_items)
+    {
+        // unsorted pointers follow the items, they only need to be extended
+        for (size_t i = d_sortedItems.size(); i < d_items.size(); ++i)
+            d_sortedItems.push_back(&d_items[i]);
+    }
+    else
+    {
+        updateSortedItems();
+    }
+
+    invalidateViewPartially(false);
     return true;
 }
 
 //----------------------------------------------------------------------------//
 bool ListView::onChildrenRemoved(const EventArgs& args)
 {
+    d_partialInvalidation = true;
     ItemView::onChildrenRemoved(args);
+    d_partialInvalidation = false;
     const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
 
     if (!d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
         return true;
 
+    d_textIndexOutdated = true;
+    if (isFiltered())
+    {
+        d_needsFullRender = true;
+        invalidateView(false);
+        return true;
+    }
+
+    if (d_virtualised)
+    {
+        if (d_needsFullRender)
+            return true;
+
+        if (margs.d_startId + margs.d_count > d_rowOffsets.size())
+            d_needsFullRender = true;
+        else if (d_sortMode == ViewSortMode::NoSorting)
+            d_rowOffsets.erase(margs.d_startId, margs.d_count);
+        else
+            eraseFromSortOrder(margs.d_startId, margs.d_count);
+
+        invalidateView(false);
+        return true;
+    }
+
+    if (d_needsFullRender)
+        return true;
+
+    if (margs.d_startId + margs.d_count > d_items.size())
+    {
+        d_needsFullRender = true;
+        invalidateView(false);
+        return true;
+    }
+
     ViewItemsVector::iterator begin = d_items.begin() + margs.d_startId;
     ViewItemsVector::iterator end = begin + margs.d_count;
 
@@ -389,8 +882,75 @@ bool ListView::onChildrenRemoved(const EventArgs& args)
 
     d_items.erase(begin, end);
 
-    resortListView();
-    invalidateView(false);
+    if (d_sortMode != ViewSortMode::NoSorting)
+    {
+        eraseFromSortOrder(margs.d_startId, margs.d_count);
+        updateSortedItems();
+    }
+    else
+    {
+        // unsorted pointers follow the items, they only need to be truncated
+        d_sortedItems.resize(d_items.size());
+    }
+
+    invalidateViewPartially(false);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool ListView::onChildrenDataChanged(const EventArgs& args)
+{
+    d_partialInvalidation = true;
+    ItemView::onChildrenDataChanged(args);
+    d_partialInvalidation = false;
+    const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
+
+    const ModelIndex root_index = d_itemModel->getRootIndex();
+    if (!d_itemModel->areIndicesEqual(margs.d_parentIndex, root_index))
+        return true;
+
+    d_textIndexOutdated = true;
+    if (isFiltered())
+    {
+        // changed texts may enter or leave the filter
+        d_needsFullRender = true;
+        return true;
+    }
+
+    if (d_needsFullRender)
+        return true;
+
+    if (d_virtualised)
+    {
+        if (d_sortMode != ViewSortMode::NoSorting &&
+            margs.d_startId + margs.d_count <= d_rowOffsets.size())
+            updateSortOrder(margs.d_startId, margs.d_count);
+
+        d_needsItemsUpdate = true;
+        return true;
+    }
+
+    if (margs.d_startId + margs.d_count > d_items.size())
+    {
+        d_needsItemsUpdate = true;
+        return true;
+    }
+
+    for (size_t id = margs.d_startId; id < margs.d_startId + margs.d_count; ++id)
+    {
+        ListViewItemRenderingState& item = d_items[id];
+        d_renderedTotalHeight -= item.d_size.d_height;
+
+        updateItem(item, id, d_renderedMaxWidth, d_renderedTotalHeight);
+    }
+
+    if (d_sortMode != ViewSortMode::NoSorting)
+    {
+        updateSortOrder(margs.d_startId, margs.d_count);
+        updateSortedItems();
+    }
+
+    invalidateViewPartially(false);
     return true;
 }
 
@@ -403,8 +963,38 @@ Rectf ListView::getIndexRect(const ModelIndex& index)
         return Rectf(0, 0, 0, 0);
     }
 
+    if (d_virtualised)
+    {
+        size_t row = static_cast<size_t>(child_id);
+        if (isFiltered())
+            row = std::find(d_filteredRows.begin(), d_filteredRows.end(), row) - d_filteredRows.begin();
+        else if (!d_sortOrder.empty())
+            row = std::find(d_sortOrder.begin(), d_sortOrder.end(), row) - d_sortOrder.begin();
+
+        if (row >= d_rowOffsets.size())
+            return Rectf(0, 0, 0, 0);
+
+        return Rectf(glm::vec2(0, d_rowOffsets.getOffset(row)),
+                     Sizef(d_renderedMaxWidth, d_rowOffsets.getHeight(row)));
+    }
+
     glm::vec2 pos(0, 0);
 
+    if (isFiltered())
+    {
+        // hidden items have no rectangle, the shown ones follow each other
+        const ListViewItemRenderingState* const item = &d_items.at(static_cast<size_t>(child_id));
+        for (const ListViewItemRenderingState* shown : d_sortedItems)
+        {
+            if (shown == item)
+                return Rectf(pos, item->d_size);
+
+            pos.y += shown->d_size.d_height;
+        }
+
+        return Rectf(0, 0, 0, 0);
+    }
+
     for (size_t i = 0; i < static_cast<size_t>(child_id); ++i)
     {
         pos.y += d_items.at(i).d_size.d_height;
@@ -412,4 +1002,5 @@ Rectf ListView::getIndexRect(const ModelIndex& index)
 
     return Rectf(pos, d_items.at(static_cast<size_t>(child_id)).d_size);
 }
+
 }
@@ -62,4 +62,15 @@ void StandardItemModel::updateItemText(StandardItem* item, const String& new_tex
 
     notifyChildrenDataChanged(parent_index, 0, 1);
 }
+
+//----------------------------------------------------------------------------//
+void StandardItemModel::addItems(const std::vector<String>& texts)
+{
+    std::vector<StandardItem*> items;
+    items.reserve(texts.size());
+    for (const auto& text : texts)
+        items.push_back(new StandardItem(text));
+
+    addItems(items.begin(), items.end());
+}
 }
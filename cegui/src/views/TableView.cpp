@@ -0,0 +1,637 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/views/TableView.h"
+#include "CEGUI/CoordConverter.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/RenderedString.h"
+#include "CEGUI/RenderedStringParser.h"
+#include "CEGUI/widgets/Scrollbar.h"
+#include "CEGUI/Font.h"
+#include <algorithm>
+#include <cmath>
+
+namespace CEGUI
+{
+typedef std::vector<TableViewCellRenderingState> CellsVector;
+
+//----------------------------------------------------------------------------//
+const String TableView::EventNamespace("TableView");
+const String TableView::WidgetTypeName("CEGUI/TableView");
+const size_t TableView::VirtualisedOverscanRows = 4;
+
+//----------------------------------------------------------------------------//
+TableViewCellRenderingState::TableViewCellRenderingState() :
+    d_string(nullptr),
+    d_row(0),
+    d_column(0),
+    d_isSelected(false)
+{
+}
+
+//----------------------------------------------------------------------------//
+TableViewCellRenderingState::~TableViewCellRenderingState()
+{
+    delete d_string;
+}
+
+//----------------------------------------------------------------------------//
+TableViewCellRenderingState::TableViewCellRenderingState(TableViewCellRenderingState&& src) noexcept :
+    d_string    (src.d_string),
+    d_text      (std::move(src.d_text)),
+    d_row       (src.d_row),
+    d_column    (src.d_column),
+    d_isSelected(src.d_isSelected)
+{
+    src.d_string = nullptr; // don't allow delete d_string by src
+}
+
+//----------------------------------------------------------------------------//
+TableViewCellRenderingState& TableViewCellRenderingState::operator=(TableViewCellRenderingState&& src) noexcept
+{
+    std::swap(d_string, src.d_string);
+    d_text       = std::move(src.d_text);
+    d_row        = src.d_row;
+    d_column     = src.d_column;
+    d_isSelected = src.d_isSelected;
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+void TableViewCellRenderingState::setString(const RenderedString& string)
+{
+    if (d_string)
+        *d_string = string;
+    else
+        d_string = new RenderedString(string);
+}
+
+//----------------------------------------------------------------------------//
+TableView::TableView(const String& type, const String& name) :
+    ItemView(type, name),
+    d_columnOffsets(1, 0.0f),
+    d_rowHeight(0.0f),
+    d_sortColumn(0),
+    d_firstRow(0),
+    d_endRow(0),
+    d_firstColumn(0),
+    d_endColumn(0)
+{
+    const String& propertyOrigin = "TableView";
+
+    CEGUI_DEFINE_PROPERTY(TableView, float,
+        "RowHeight", "Property to get/set the height of the rows and of the "
+        "header; 0 uses the line spacing of the font. Value is a float.",
+        &TableView::setRowHeight, &TableView::getRowHeight, 0.0f);
+
+    CEGUI_DEFINE_PROPERTY(TableView, size_t,
+        "SortColumn", "Property to get/set the column the rows are sorted by. "
+        "Value is the index of the column.",
+        &TableView::setSortColumn, &TableView::getSortColumn, 0);
+}
+
+//----------------------------------------------------------------------------//
+TableView::~TableView()
+{
+}
+
+//----------------------------------------------------------------------------//
+size_t TableView::addColumn(const String& header, float width, ItemDataRole role)
+{
+    TableViewColumn column;
+    column.d_header = header;
+    column.d_width = width;
+    column.d_role = role;
+    d_columns.push_back(column);
+
+    updateColumnOffsets();
+    d_needsFullRender = true;
+    invalidateView(false);
+
+    return d_columns.size() - 1;
+}
+
+//----------------------------------------------------------------------------//
+void TableView::removeColumn(size_t column)
+{
+    checkColumn(column);
+
+    d_columns.erase(d_columns.begin() + column);
+    updateColumnOffsets();
+
+    if (d_sortColumn > column)
+        --d_sortColumn;
+    else if (d_sortColumn == column)
+        d_sortColumn = 0;
+
+    d_needsFullRender = true;
+    invalidateView(false);
+}
+
+//----------------------------------------------------------------------------//
+const TableViewColumn& TableView::getColumn(size_t column) const
+{
+    checkColumn(column);
+    return d_columns[column];
+}
+
+//----------------------------------------------------------------------------//
+void TableView::setColumnWidth(size_t column, float width)
+{
+    checkColumn(column);
+    if (d_columns[column].d_width == width)
+        return;
+
+    // the cells keep their contents, only the visible range changes
+    d_columns[column].d_width = width;
+    updateColumnOffsets();
+    invalidateViewPartially(false);
+}
+
+//----------------------------------------------------------------------------//
+float TableView::getColumnOffset(size_t column) const
+{
+    return d_columnOffsets[std::min(column, d_columns.size())];
+}
+
+//----------------------------------------------------------------------------//
+size_t TableView::getColumnAt(float x) const
+{
+    const std::vector<float>::const_iterator itor =
+        std::upper_bound(d_columnOffsets.begin(), d_columnOffsets.end(), x);
+
+    if (itor == d_columnOffsets.begin())
+        return d_columns.size();
+
+    return std::min(static_cast<size_t>(itor - d_columnOffsets.begin()) - 1,
+        d_columns.size());
+}
+
+//----------------------------------------------------------------------------//
+void TableView::setRowHeight(float height)
+{
+    if (height == d_rowHeight)
+        return;
+
+    d_rowHeight = height;
+    invalidateViewPartially(false);
+}
+
+//----------------------------------------------------------------------------//
+float TableView::getEffectiveRowHeight() const
+{
+    if (d_rowHeight > 0)
+        return d_rowHeight;
+
+    const Font* font = getActualFont();
+    return font ? font->getLineSpacing() : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+void TableView::setSortColumn(size_t column)
+{
+    if (column == d_sortColumn)
+        return;
+
+    d_sortColumn = column;
+    if (d_sortMode != ViewSortMode::NoSorting)
+        resortView();
+}
+
+//----------------------------------------------------------------------------//
+size_t TableView::getChildIdForRow(size_t row) const
+{
+    return d_sortOrder.empty() ? row : d_sortOrder[row];
+}
+
+//----------------------------------------------------------------------------//
+void TableView::prepareForRender()
+{
+    ItemView::prepareForRender();
+    if (d_itemModel == nullptr || !isDirty())
+        return;
+
+    const size_t row_count = d_itemModel->getChildCount(d_itemModel->getRootIndex());
+    const size_t sorted_count = d_sortMode == ViewSortMode::NoSorting ? 0 : row_count;
+
+    if (d_needsFullRender || d_sortOrder.size() != sorted_count)
+    {
+        buildSortOrder(row_count);
+        d_needsItemsUpdate = true;
+    }
+
+    // the header stays at the top of the view and the rows scroll below it
+    const float row_height = getEffectiveRowHeight();
+    d_renderedMaxWidth = d_columnOffsets.back();
+    d_renderedTotalHeight = row_height * (row_count + 1);
+    updateScrollbars();
+
+    const ItemViewWindowRenderer* const view_renderer = getViewRenderer();
+    const Sizef view_size = view_renderer ?
+        view_renderer->getViewRenderArea().getSize() : getPixelSize();
+    const float view_top = getVertScrollbar()->getScrollPosition();
+    const float view_left = getHorzScrollbar()->getScrollPosition();
+
+    // rows within the visible area, extended by the overscan rows
+    size_t first_row = 0;
+    size_t end_row = 0;
+    if (row_height > 0)
+    {
+        const float rows_bottom =
+            view_top + std::max(0.0f, view_size.d_height - row_height);
+
+        first_row = static_cast<size_t>(view_top / row_height);
+        first_row = first_row > VirtualisedOverscanRows ? first_row - VirtualisedOverscanRows : 0;
+        end_row = static_cast<size_t>(std::ceil(rows_bottom / row_height));
+        end_row = std::min(end_row + VirtualisedOverscanRows, row_count);
+        first_row = std::min(first_row, end_row);
+    }
+
+    ChildIdRangeSet requested_children;
+    for (size_t row = first_row; row < end_row; ++row)
+    {
+        const size_t child_id = getChildIdForRow(row);
+        requested_children.insert(child_id, child_id + 1);
+    }
+    requestItemData(d_itemModel->getRootIndex(), requested_children);
+
+    // columns within the visible area, found through the cached offsets
+    const size_t first_column = getColumnAt(view_left);
+    size_t end_column = getColumnAt(view_left + view_size.d_width);
+    end_column = end_column < d_columns.size() ? end_column + 1 : d_columns.size();
+
+    // cells staying in view are kept unless their contents may have changed,
+    // the states of the others are recycled for the cells scrolled into view
+    CellsVector spare_cells;
+    for (CellsVector::iterator itor = d_cells.begin(); itor != d_cells.end(); ++itor)
+    {
+        if (d_needsItemsUpdate ||
+            itor->d_row < first_row || itor->d_row >= end_row ||
+            itor->d_column < first_column || itor->d_column >= end_column)
+            spare_cells.push_back(std::move(*itor));
+    }
+
+    const size_t old_column_count = d_endColumn - d_firstColumn;
+    CellsVector cells;
+    cells.reserve((end_row - first_row) * (end_column - first_column));
+    for (size_t row = first_row; row < end_row; ++row)
+    {
+        for (size_t column = first_column; column < end_column; ++column)
+        {
+            if (!d_needsItemsUpdate &&
+                row >= d_firstRow && row < d_endRow &&
+                column >= d_firstColumn && column < d_endColumn)
+            {
+                cells.push_back(std::move(d_cells[(row - d_firstRow) *
+                    old_column_count + column - d_firstColumn]));
+                continue;
+            }
+
+            if (spare_cells.empty())
+            {
+                cells.push_back(TableViewCellRenderingState());
+            }
+            else
+            {
+                cells.push_back(std::move(spare_cells.back()));
+                spare_cells.pop_back();
+            }
+
+            updateCell(cells.back(), row, column);
+        }
+    }
+
+    const bool headers_outdated = d_needsItemsUpdate ||
+        first_column != d_firstColumn || end_column != d_endColumn;
+
+    d_cells.swap(cells);
+    d_firstRow = first_row;
+    d_endRow = end_row;
+    d_firstColumn = first_column;
+    d_endColumn = end_column;
+
+    if (headers_outdated)
+        updateHeaderCells();
+
+    setIsDirty(false);
+    d_needsFullRender = false;
+    d_needsItemsUpdate = false;
+}
+
+//----------------------------------------------------------------------------//
+void TableView::updateColumnOffsets()
+{
+    d_columnOffsets.resize(d_columns.size() + 1);
+    for (size_t column = 0; column < d_columns.size(); ++column)
+        d_columnOffsets[column + 1] = d_columnOffsets[column] + d_columns[column].d_width;
+}
+
+//----------------------------------------------------------------------------//
+void TableView::checkColumn(size_t column) const
+{
+    if (column >= d_columns.size())
+        throw InvalidRequestException("The column index is out of range.");
+}
+
+//----------------------------------------------------------------------------//
+void TableView::updateCell(TableViewCellRenderingState& cell, size_t row, size_t column)
+{
+    const ModelIndex root_index = d_itemModel->getRootIndex();
+    const size_t child_id = getChildIdForRow(row);
+    const ModelIndex index = d_itemModel->makeIndex(child_id, root_index);
+
+    cell.d_text = getItemData(index, d_columns[column].d_role);
+    cell.setString(getRenderedStringParser().parse(
+        cell.d_text, getActualFont(), &d_textColourRect));
+    cell.d_row = row;
+    cell.d_column = column;
+    cell.d_isSelected = isChildSelected(root_index, child_id);
+}
+
+//----------------------------------------------------------------------------//
+void TableView::updateHeaderCells()
+{
+    d_headerCells.resize(d_endColumn - d_firstColumn);
+    for (size_t column = d_firstColumn; column < d_endColumn; ++column)
+    {
+        TableViewCellRenderingState& cell = d_headerCells[column - d_firstColumn];
+        cell.d_text = d_columns[column].d_header;
+        cell.setString(getRenderedStringParser().parse(
+            cell.d_text, getActualFont(), &d_textColourRect));
+        cell.d_row = 0;
+        cell.d_column = column;
+        cell.d_isSelected = false;
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool TableView::isChildBefore(size_t child1, size_t child2) const
+{
+    const ModelIndex root_index = d_itemModel->getRootIndex();
+    const ItemDataRole role = d_sortColumn < d_columns.size() ?
+        d_columns[d_sortColumn].d_role : ItemDataRole::Text;
+
+    const String data1 = d_itemModel->getData(d_itemModel->makeIndex(child1, root_index), role);
+    const String data2 = d_itemModel->getData(d_itemModel->makeIndex(child2, root_index), role);
+
+    return d_sortMode == ViewSortMode::Ascending ? data1 < data2 : data2 < data1;
+}
+
+//----------------------------------------------------------------------------//
+size_t TableView::getSortedInsertRow(size_t child_id) const
+{
+    return std::upper_bound(d_sortOrder.begin(), d_sortOrder.end(), child_id,
+        [this](size_t child1, size_t child2)
+    {
+        return isChildBefore(child1, child2);
+    }) - d_sortOrder.begin();
+}
+
+//----------------------------------------------------------------------------//
+void TableView::buildSortOrder(size_t child_count)
+{
+    d_sortOrder.clear();
+    if (d_sortMode == ViewSortMode::NoSorting)
+        return;
+
+    d_sortOrder.resize(child_count);
+    for (size_t child = 0; child < child_count; ++child)
+        d_sortOrder[child] = child;
+
+    std::stable_sort(d_sortOrder.begin(), d_sortOrder.end(),
+        [this](size_t child1, size_t child2)
+    {
+        return isChildBefore(child1, child2);
+    });
+}
+
+//----------------------------------------------------------------------------//
+void TableView::insertIntoSortOrder(size_t start_id, size_t count)
+{
+    for (std::vector<size_t>::iterator itor = d_sortOrder.begin();
+        itor != d_sortOrder.end(); ++itor)
+    {
+        if (*itor >= start_id)
+            *itor += count;
+    }
+
+    for (size_t id = start_id; id < start_id + count; ++id)
+        d_sortOrder.insert(d_sortOrder.begin() + getSortedInsertRow(id), id);
+}
+
+//----------------------------------------------------------------------------//
+void TableView::eraseFromSortOrder(size_t start_id, size_t count)
+{
+    for (size_t row = d_sortOrder.size(); row-- > 0;)
+    {
+        const size_t id = d_sortOrder[row];
+        if (id >= start_id + count)
+            d_sortOrder[row] = id - count;
+        else if (id >= start_id)
+            d_sortOrder.erase(d_sortOrder.begin() + row);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void TableView::updateSortOrder(size_t start_id, size_t count)
+{
+    // the changed rows are taken out first, so that the others stay sorted
+    // while looking for the new positions
+    for (size_t row = d_sortOrder.size(); row-- > 0;)
+    {
+        const size_t id = d_sortOrder[row];
+        if (id >= start_id && id < start_id + count)
+            d_sortOrder.erase(d_sortOrder.begin() + row);
+    }
+
+    for (size_t id = start_id; id < start_id + count; ++id)
+        d_sortOrder.insert(d_sortOrder.begin() + getSortedInsertRow(id), id);
+}
+
+//----------------------------------------------------------------------------//
+size_t TableView::getRowForChildId(size_t child_id) const
+{
+    if (d_sortOrder.empty())
+        return child_id;
+
+    return std::find(d_sortOrder.begin(), d_sortOrder.end(), child_id) - d_sortOrder.begin();
+}
+
+//----------------------------------------------------------------------------//
+ModelIndex TableView::indexAt(const glm::vec2& position)
+{
+    if (d_itemModel == nullptr)
+        return ModelIndex();
+
+    prepareForRender();
+
+    glm::vec2 window_position = CoordConverter::screenToWindow(*this, position);
+    Rectf render_area(getViewRenderer()->getViewRenderArea());
+
+    if (!render_area.isPointInRectf(window_position))
+        return ModelIndex();
+
+    // positions over the header do not belong to any row
+    const float row_height = getEffectiveRowHeight();
+    const float rows_y = window_position.y - render_area.d_min.y - row_height;
+    if (row_height <= 0 || rows_y < 0)
+        return ModelIndex();
+
+    const ModelIndex root_index = d_itemModel->getRootIndex();
+    const size_t row = static_cast<size_t>(
+        (rows_y + getVertScrollbar()->getScrollPosition()) / row_height);
+
+    if (row >= d_itemModel->getChildCount(root_index))
+        return ModelIndex();
+
+    return d_itemModel->makeIndex(getChildIdForRow(row), root_index);
+}
+
+//----------------------------------------------------------------------------//
+void TableView::ensureIndexIsVisible(const ModelIndex& index)
+{
+    if (d_itemModel == nullptr || d_itemModel->getChildId(index) == -1)
+        return;
+
+    // rows only scroll vertically, below the header
+    const float row_height = getEffectiveRowHeight();
+    const float rows_height =
+        getViewRenderer()->getViewRenderArea().getHeight() - row_height;
+    const Rectf rect(getIndexRect(index));
+
+    Scrollbar* const vert_scroll = getVertScrollbar();
+    const float position = vert_scroll->getScrollPosition();
+
+    if (rect.top() < position || rect.getHeight() > rows_height)
+        vert_scroll->setScrollPosition(rect.top());
+    else if (rect.bottom() > position + rows_height)
+        vert_scroll->setScrollPosition(rect.bottom() - rows_height);
+}
+
+//----------------------------------------------------------------------------//
+void TableView::resortView()
+{
+    // the sort order is rebuilt along with the next render
+    d_needsFullRender = true;
+    invalidateView(false);
+}
+
+//----------------------------------------------------------------------------//
+Rectf TableView::getIndexRect(const ModelIndex& index)
+{
+    const int child_id = d_itemModel->getChildId(index);
+    if (child_id == -1)
+        return Rectf(0, 0, 0, 0);
+
+    const float row_height = getEffectiveRowHeight();
+    const size_t row = getRowForChildId(static_cast<size_t>(child_id));
+
+    return Rectf(glm::vec2(0, row * row_height),
+                 Sizef(d_columnOffsets.back(), row_height));
+}
+
+//----------------------------------------------------------------------------//
+bool TableView::handleSelection(const glm::vec2& position, bool should_select,
+    bool is_cumulative, bool is_range)
+{
+    if (d_itemModel != nullptr && getViewRenderer() != nullptr)
+    {
+        const glm::vec2 window_position = CoordConverter::screenToWindow(*this, position);
+        const Rectf render_area(getViewRenderer()->getViewRenderArea());
+
+        // clicking a header sorts by its column, a second click reverses the order
+        if (render_area.isPointInRectf(window_position) &&
+            window_position.y < render_area.d_min.y + getEffectiveRowHeight())
+        {
+            const size_t column = getColumnAt(window_position.x -
+                render_area.d_min.x + getHorzScrollbar()->getScrollPosition());
+
+            if (column >= d_columns.size())
+                return false;
+
+            if (column == d_sortColumn && d_sortMode == ViewSortMode::Ascending)
+            {
+                setSortMode(ViewSortMode::Descending);
+            }
+            else
+            {
+                setSortColumn(column);
+                setSortMode(ViewSortMode::Ascending);
+            }
+
+            return true;
+        }
+    }
+
+    return ItemView::handleSelection(position, should_select, is_cumulative, is_range);
+}
+
+//----------------------------------------------------------------------------//
+bool TableView::onChildrenAdded(const EventArgs& args)
+{
+    // the base class invalidates the view, so the visible cells are updated
+    // with the next render; only the sort order is maintained here
+    ItemView::onChildrenAdded(args);
+    const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
+
+    if (!d_needsFullRender && !d_sortOrder.empty() &&
+        margs.d_startId <= d_sortOrder.size() &&
+        d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
+        insertIntoSortOrder(margs.d_startId, margs.d_count);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool TableView::onChildrenRemoved(const EventArgs& args)
+{
+    ItemView::onChildrenRemoved(args);
+    const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
+
+    if (!d_needsFullRender && !d_sortOrder.empty() &&
+        margs.d_startId + margs.d_count <= d_sortOrder.size() &&
+        d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
+        eraseFromSortOrder(margs.d_startId, margs.d_count);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool TableView::onChildrenDataChanged(const EventArgs& args)
+{
+    ItemView::onChildrenDataChanged(args);
+    const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
+
+    if (!d_needsFullRender && !d_sortOrder.empty() &&
+        margs.d_startId + margs.d_count <= d_sortOrder.size() &&
+        d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
+        updateSortOrder(margs.d_startId, margs.d_count);
+
+    return true;
+}
+
+}
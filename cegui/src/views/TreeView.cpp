@@ -30,6 +30,7 @@
 #include "CEGUI/CoordConverter.h"
 #include "CEGUI/RenderedStringParser.h"
 #include "CEGUI/widgets/Scrollbar.h"
+#include "CEGUI/Font.h"
 #include <algorithm> // sort
 
 //TODO: handle semantic event for up/down and left/right (open/close subtree)
@@ -65,6 +66,7 @@ const String TreeView::EventNamespace("TreeView");
 const String TreeView::WidgetTypeName("CEGUI/TreeView");
 const String TreeView::EventSubtreeExpanded("SubtreeExpanded");
 const String TreeView::EventSubtreeCollapsed("SubtreeCollapsed");
+const size_t TreeView::VirtualisedOverscanRows = 4;
 
 //----------------------------------------------------------------------------//
 TreeViewItemRenderingState::TreeViewItemRenderingState(TreeView* attached_tree_view) :
@@ -125,7 +127,10 @@ bool TreeViewItemRenderingState::operator>(const TreeViewItemRenderingState& oth
 TreeView::TreeView(const String& type, const String& name) :
     ItemView(type, name),
     d_rootItemState(this),
-    d_subtreeExpanderMargin(DefaultSubtreeExpanderMargin)
+    d_subtreeExpanderMargin(DefaultSubtreeExpanderMargin),
+    d_virtualised(false),
+    d_virtualisedRowHeight(0.0f),
+    d_firstVirtualRow(0)
 {
     addTreeViewProperties();
 }
@@ -140,6 +145,18 @@ void TreeView::addTreeViewProperties()
         &TreeView::setSubtreeExpanderMargin, &TreeView::getSubtreeExpanderMargin,
         DefaultSubtreeExpanderMargin
         )
+
+    CEGUI_DEFINE_PROPERTY(TreeView, bool,
+        "Virtualised", "Property to get/set whether only the rows around the "
+        "visible area are laid out and rendered. Value is either \"true\" or \"false\".",
+        &TreeView::setVirtualised, &TreeView::isVirtualised, false
+        )
+
+    CEGUI_DEFINE_PROPERTY(TreeView, float,
+        "VirtualisedRowHeight", "Property to get/set the height of the rows in "
+        "virtualised mode; 0 estimates it from the font. Value is a float.",
+        &TreeView::setVirtualisedRowHeight, &TreeView::getVirtualisedRowHeight, 0.0f
+        )
 }
 
 //----------------------------------------------------------------------------//
@@ -165,6 +182,52 @@ void TreeView::setSubtreeExpanderMargin(float value)
     d_subtreeExpanderMargin = value;
 }
 
+//----------------------------------------------------------------------------//
+void TreeView::setVirtualised(bool virtualised)
+{
+    if (virtualised == d_virtualised)
+        return;
+
+    d_virtualised = virtualised;
+    d_rootItemState = TreeViewItemRenderingState(this);
+    d_virtualRows.clear();
+    d_rowOffsets.reset(0, 0.0f);
+    d_virtualItems.clear();
+    d_virtualItemPointers.clear();
+    d_firstVirtualRow = 0;
+    d_needsFullRender = true;
+    invalidateView(false);
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::setVirtualisedRowHeight(float height)
+{
+    if (height == d_virtualisedRowHeight)
+        return;
+
+    d_virtualisedRowHeight = height;
+    if (d_virtualised)
+    {
+        resetVirtualRowHeights();
+        invalidateView(false);
+    }
+}
+
+//----------------------------------------------------------------------------//
+const std::vector<TreeViewItemRenderingState*>& TreeView::getVirtualisedItems() const
+{
+    return d_virtualItemPointers;
+}
+
+//----------------------------------------------------------------------------//
+float TreeView::getItemsOffset() const
+{
+    if (!d_virtualised)
+        return 0.0f;
+
+    return d_rowOffsets.getOffset(std::min(d_firstVirtualRow, d_rowOffsets.size()));
+}
+
 //----------------------------------------------------------------------------//
 void TreeView::prepareForRender()
 {
@@ -173,6 +236,12 @@ void TreeView::prepareForRender()
     if (d_itemModel == nullptr || !isDirty())
         return;
 
+    if (d_virtualised)
+    {
+        prepareVirtualisedRows();
+        return;
+    }
+
     if (d_needsFullRender)
     {
         ModelIndex root_index = d_itemModel->getRootIndex();
@@ -187,7 +256,7 @@ void TreeView::prepareForRender()
         computeRenderedChildrenForItem(d_rootItemState, root_index,
             d_renderedMaxWidth, d_renderedTotalHeight);
     }
-    else
+    else if (d_needsItemsUpdate)
     {
         updateRenderingStateForItem(d_rootItemState,
             d_renderedMaxWidth, d_renderedTotalHeight);
@@ -196,6 +265,416 @@ void TreeView::prepareForRender()
     updateScrollbars();
     setIsDirty(false);
     d_needsFullRender = false;
+    d_needsItemsUpdate = false;
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::prepareVirtualisedRows()
+{
+    if (d_needsFullRender)
+    {
+        // like a full render of the non virtualised view, all subtrees collapse
+        d_rootItemState = TreeViewItemRenderingState(this);
+        d_rootItemState.d_nestedLevel = -1;
+        d_rootItemState.d_subtreeIsExpanded = true;
+
+        d_virtualRows.clear();
+        appendVirtualChildren(d_virtualRows, d_itemModel->getRootIndex(), 0, false);
+        d_renderedMaxWidth = 0;
+        d_needsItemsUpdate = true;
+    }
+
+    const size_t row_count = d_virtualRows.size();
+    if (d_needsFullRender || d_rowOffsets.size() != row_count)
+        resetVirtualRowHeights();
+
+    // rows within the visible area, extended by the overscan rows
+    const TreeViewWindowRenderer* const view_renderer = getViewRenderer();
+    const float view_top = getVertScrollbar()->getScrollPosition();
+    const float view_height = view_renderer ?
+        view_renderer->getViewRenderArea().getHeight() : getPixelSize().d_height;
+    const float expander_height = view_renderer ?
+        view_renderer->getSubtreeExpanderSize().d_height : 0.0f;
+
+    size_t first_row = d_rowOffsets.findRow(view_top);
+    first_row = first_row > VirtualisedOverscanRows ? first_row - VirtualisedOverscanRows : 0;
+    const size_t last_row = d_rowOffsets.findRow(view_top + view_height);
+    const size_t end_row = std::min(last_row + 1 + VirtualisedOverscanRows, row_count);
+
+    // rows staying in view are kept unless their contents may have changed,
+    // the states of the others are recycled for the rows scrolled into view
+    const size_t old_first_row = d_firstVirtualRow;
+    const size_t old_end_row = d_firstVirtualRow + d_virtualItems.size();
+    ViewItemsVector spare_items;
+    for (size_t i = 0; i < d_virtualItems.size(); ++i)
+    {
+        const size_t row = old_first_row + i;
+        if (d_needsItemsUpdate || row < first_row || row >= end_row)
+            spare_items.push_back(std::move(d_virtualItems[i]));
+    }
+
+    ViewItemsVector items;
+    items.reserve(end_row > first_row ? end_row - first_row : 0);
+    for (size_t row = first_row; row < end_row; ++row)
+    {
+        if (!d_needsItemsUpdate && row >= old_first_row && row < old_end_row)
+        {
+            items.push_back(std::move(d_virtualItems[row - old_first_row]));
+            continue;
+        }
+
+        if (spare_items.empty())
+        {
+            items.push_back(TreeViewItemRenderingState(this));
+        }
+        else
+        {
+            items.push_back(std::move(spare_items.back()));
+            spare_items.pop_back();
+        }
+
+        const VirtualRow& virtual_row = d_virtualRows[row];
+        const ModelIndex index =
+            d_itemModel->makeIndex(virtual_row.d_childId, virtual_row.d_parentIndex);
+
+        TreeViewItemRenderingState& item = items.back();
+        item.d_children.clear();
+        item.d_renderedChildren.clear();
+        item.d_parentIndex = virtual_row.d_parentIndex;
+        item.d_childId = virtual_row.d_childId;
+        item.d_nestedLevel = virtual_row.d_nestedLevel;
+        item.d_subtreeIsExpanded = virtual_row.d_subtreeIsExpanded;
+        item.d_totalChildCount = d_itemModel->getChildCount(index);
+
+        float unused_height = 0;
+        fillRenderingState(item, index, d_renderedMaxWidth, unused_height);
+
+        if (d_virtualisedRowHeight > 0)
+            item.d_size.d_height = d_virtualisedRowHeight;
+
+        // the renderer advances each row by at least the expander height
+        d_rowOffsets.setHeight(row, std::max(item.d_size.d_height, expander_height));
+    }
+
+    d_virtualItems.swap(items);
+    d_firstVirtualRow = first_row;
+
+    d_virtualItemPointers.clear();
+    for (ViewItemsVector::iterator itor = d_virtualItems.begin();
+        itor != d_virtualItems.end(); ++itor)
+    {
+        d_virtualItemPointers.push_back(&(*itor));
+    }
+
+    d_renderedTotalHeight = d_rowOffsets.getOffset(row_count);
+
+    updateScrollbars();
+    setIsDirty(false);
+    d_needsFullRender = false;
+    d_needsItemsUpdate = false;
+}
+
+//----------------------------------------------------------------------------//
+float TreeView::getVirtualisedRowEstimate() const
+{
+    if (d_virtualisedRowHeight > 0)
+        return d_virtualisedRowHeight;
+
+    const Font* font = getActualFont();
+    return font ? font->getLineSpacing() : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::resetVirtualRowHeights()
+{
+    d_rowOffsets.reset(d_virtualRows.size(), getVirtualisedRowEstimate());
+    d_renderedTotalHeight = d_rowOffsets.getOffset(d_virtualRows.size());
+    d_needsItemsUpdate = true;
+}
+
+//----------------------------------------------------------------------------//
+size_t TreeView::getVirtualSubtreeEnd(const VirtualRowVector& rows, size_t row)
+{
+    const int nested_level = rows[row].d_nestedLevel;
+
+    size_t end = row + 1;
+    while (end < rows.size() && rows[end].d_nestedLevel > nested_level)
+        ++end;
+
+    return end;
+}
+
+//----------------------------------------------------------------------------//
+bool TreeView::isVirtualRowBefore(const VirtualRow& row1, const VirtualRow& row2) const
+{
+    if (d_sortMode == ViewSortMode::NoSorting)
+        return row1.d_childId < row2.d_childId;
+
+    const int result = d_itemModel->compareIndices(
+        d_itemModel->makeIndex(row1.d_childId, row1.d_parentIndex),
+        d_itemModel->makeIndex(row2.d_childId, row2.d_parentIndex));
+
+    return d_sortMode == ViewSortMode::Ascending ? result < 0 : result > 0;
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::appendVirtualChildren(VirtualRowVector& rows,
+    const ModelIndex& parent_index, int nested_level, bool expand_all)
+{
+    VirtualRowVector children(d_itemModel->getChildCount(parent_index));
+    for (size_t child = 0; child < children.size(); ++child)
+    {
+        children[child].d_parentIndex = parent_index;
+        children[child].d_childId = child;
+        children[child].d_nestedLevel = nested_level;
+        children[child].d_subtreeIsExpanded = false;
+    }
+
+    if (d_sortMode != ViewSortMode::NoSorting)
+    {
+        std::sort(children.begin(), children.end(),
+            [this](const VirtualRow& row1, const VirtualRow& row2)
+        {
+            return isVirtualRowBefore(row1, row2);
+        });
+    }
+
+    for (VirtualRowVector::iterator itor = children.begin();
+        itor != children.end(); ++itor)
+    {
+        rows.push_back(*itor);
+        if (!expand_all)
+            continue;
+
+        const ModelIndex index = d_itemModel->makeIndex(itor->d_childId, parent_index);
+        if (d_itemModel->getChildCount(index) == 0)
+            continue;
+
+        rows.back().d_subtreeIsExpanded = true;
+        ItemViewEventArgs args(this, index);
+        onSubtreeExpanded(args);
+
+        appendVirtualChildren(rows, index, nested_level + 1, true);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::appendSortedVirtualRows(const VirtualRowVector& rows,
+    size_t begin, size_t end, VirtualRowVector& out) const
+{
+    // the siblings in [begin, end) along with the end of their subtrees
+    std::vector<std::pair<size_t, size_t> > siblings;
+    for (size_t row = begin; row < end;)
+    {
+        const size_t subtree_end = getVirtualSubtreeEnd(rows, row);
+        siblings.push_back(std::make_pair(row, subtree_end));
+        row = subtree_end;
+    }
+
+    std::stable_sort(siblings.begin(), siblings.end(),
+        [this, &rows](const std::pair<size_t, size_t>& sibling1,
+                      const std::pair<size_t, size_t>& sibling2)
+    {
+        return isVirtualRowBefore(rows[sibling1.first], rows[sibling2.first]);
+    });
+
+    for (size_t i = 0; i < siblings.size(); ++i)
+    {
+        out.push_back(rows[siblings[i].first]);
+        appendSortedVirtualRows(rows, siblings[i].first + 1, siblings[i].second, out);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::expandVirtualRows(size_t begin, size_t end)
+{
+    // collapsed rows have no rows below them, so expanding every row of the
+    // range in a single pass keeps the ones that were expanded already
+    VirtualRowVector rows(d_virtualRows.begin(), d_virtualRows.begin() + begin);
+    for (size_t row = begin; row < end; ++row)
+    {
+        rows.push_back(d_virtualRows[row]);
+
+        VirtualRow& virtual_row = rows.back();
+        if (virtual_row.d_subtreeIsExpanded)
+            continue;
+
+        const ModelIndex index =
+            d_itemModel->makeIndex(virtual_row.d_childId, virtual_row.d_parentIndex);
+        if (d_itemModel->getChildCount(index) == 0)
+            continue;
+
+        virtual_row.d_subtreeIsExpanded = true;
+        const int nested_level = virtual_row.d_nestedLevel + 1;
+
+        ItemViewEventArgs args(this, index);
+        onSubtreeExpanded(args);
+
+        appendVirtualChildren(rows, index, nested_level, true);
+    }
+    rows.insert(rows.end(), d_virtualRows.begin() + end, d_virtualRows.end());
+
+    d_virtualRows.swap(rows);
+    resetVirtualRowHeights();
+    invalidateView(false);
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::toggleVirtualRow(size_t row)
+{
+    const VirtualRow virtual_row = d_virtualRows[row];
+    const ModelIndex index =
+        d_itemModel->makeIndex(virtual_row.d_childId, virtual_row.d_parentIndex);
+    ItemViewEventArgs args(this, index);
+
+    if (!virtual_row.d_subtreeIsExpanded)
+    {
+        VirtualRowVector children;
+        appendVirtualChildren(children, index, virtual_row.d_nestedLevel + 1, false);
+
+        d_virtualRows[row].d_subtreeIsExpanded = true;
+        d_virtualRows.insert(d_virtualRows.begin() + row + 1,
+            children.begin(), children.end());
+        d_rowOffsets.insert(row + 1, children.size(), getVirtualisedRowEstimate());
+
+        onSubtreeExpanded(args);
+    }
+    else
+    {
+        const size_t subtree_end = getVirtualSubtreeEnd(d_virtualRows, row);
+
+        d_virtualRows[row].d_subtreeIsExpanded = false;
+        d_virtualRows.erase(d_virtualRows.begin() + row + 1,
+            d_virtualRows.begin() + subtree_end);
+        d_rowOffsets.erase(row + 1, subtree_end - row - 1);
+
+        onSubtreeCollapsed(args);
+    }
+
+    d_renderedTotalHeight = d_rowOffsets.getOffset(d_rowOffsets.size());
+    invalidateView(false);
+}
+
+//----------------------------------------------------------------------------//
+bool TreeView::getVirtualRowOfItem(const TreeViewItemRenderingState& item,
+    size_t& row) const
+{
+    if (d_virtualItems.empty() ||
+        &item < &d_virtualItems.front() || &item > &d_virtualItems.back())
+        return false;
+
+    row = d_firstVirtualRow + (&item - &d_virtualItems.front());
+    return row < d_virtualRows.size();
+}
+
+//----------------------------------------------------------------------------//
+bool TreeView::getVirtualChildrenRange(const ModelIndex& parent_index,
+    size_t& begin, size_t& end, int& nested_level) const
+{
+    if (d_itemModel->areIndicesEqual(parent_index, d_itemModel->getRootIndex()))
+    {
+        begin = 0;
+        end = d_virtualRows.size();
+        nested_level = 0;
+        return true;
+    }
+
+    for (size_t row = 0; row < d_virtualRows.size(); ++row)
+    {
+        const VirtualRow& virtual_row = d_virtualRows[row];
+        if (!d_itemModel->areIndicesEqual(parent_index,
+            d_itemModel->makeIndex(virtual_row.d_childId, virtual_row.d_parentIndex)))
+            continue;
+
+        if (!virtual_row.d_subtreeIsExpanded)
+            return false;
+
+        begin = row + 1;
+        end = getVirtualSubtreeEnd(d_virtualRows, row);
+        nested_level = virtual_row.d_nestedLevel + 1;
+        return true;
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::onVirtualChildrenAdded(const ModelEventArgs& args)
+{
+    size_t begin, end;
+    int nested_level;
+    if (!getVirtualChildrenRange(args.d_parentIndex, begin, end, nested_level))
+        return;
+
+    // update existing child ids and find the row following the new children
+    size_t insert_row = end;
+    for (size_t row = begin; row < end; row = getVirtualSubtreeEnd(d_virtualRows, row))
+    {
+        VirtualRow& sibling = d_virtualRows[row];
+        if (sibling.d_childId < args.d_startId)
+            continue;
+
+        sibling.d_childId += args.d_count;
+        insert_row = std::min(insert_row, row);
+    }
+
+    VirtualRowVector rows(args.d_count);
+    for (size_t i = 0; i < args.d_count; ++i)
+    {
+        rows[i].d_parentIndex = args.d_parentIndex;
+        rows[i].d_childId = args.d_startId + i;
+        rows[i].d_nestedLevel = nested_level;
+        rows[i].d_subtreeIsExpanded = false;
+    }
+
+    d_virtualRows.insert(d_virtualRows.begin() + insert_row, rows.begin(), rows.end());
+    d_rowOffsets.insert(insert_row, args.d_count, getVirtualisedRowEstimate());
+    end += args.d_count;
+
+    if (d_sortMode != ViewSortMode::NoSorting)
+    {
+        VirtualRowVector sorted;
+        sorted.reserve(end - begin);
+        appendSortedVirtualRows(d_virtualRows, begin, end, sorted);
+        std::copy(sorted.begin(), sorted.end(), d_virtualRows.begin() + begin);
+
+        for (size_t row = begin; row < end; ++row)
+            d_rowOffsets.setHeight(row, getVirtualisedRowEstimate());
+    }
+
+    d_renderedTotalHeight = d_rowOffsets.getOffset(d_rowOffsets.size());
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::onVirtualChildrenRemoved(const ModelEventArgs& args)
+{
+    size_t begin, end;
+    int nested_level;
+    if (!getVirtualChildrenRange(args.d_parentIndex, begin, end, nested_level))
+        return;
+
+    for (size_t row = begin; row < end;)
+    {
+        const size_t subtree_end = getVirtualSubtreeEnd(d_virtualRows, row);
+        VirtualRow& sibling = d_virtualRows[row];
+
+        if (sibling.d_childId >= args.d_startId + args.d_count)
+        {
+            sibling.d_childId -= args.d_count;
+        }
+        else if (sibling.d_childId >= args.d_startId)
+        {
+            d_virtualRows.erase(d_virtualRows.begin() + row,
+                d_virtualRows.begin() + subtree_end);
+            d_rowOffsets.erase(row, subtree_end - row);
+            end -= subtree_end - row;
+            continue;
+        }
+
+        row = subtree_end;
+    }
+
+    d_renderedTotalHeight = d_rowOffsets.getOffset(d_rowOffsets.size());
 }
 
 //----------------------------------------------------------------------------//
@@ -276,12 +755,12 @@ void TreeView::updateRenderingStateForItem(TreeViewItemRenderingState& item,
 void TreeView::fillRenderingState(TreeViewItemRenderingState& item,
     const ModelIndex& index, float& rendered_max_width, float& rendered_total_height)
 {
-    String text = d_itemModel->getData(index);
+    String text = getItemData(index);
     RenderedString rendered_string = getRenderedStringParser().parse(
         text, getActualFont(), &d_textColourRect);
     item.d_string = rendered_string;
     item.d_text = text;
-    item.d_icon = d_itemModel->getData(index, ItemDataRole::Icon);
+    item.d_icon = getItemData(index, ItemDataRole::Icon);
 
     item.d_size = Sizef(
         rendered_string.getHorizontalExtent(this),
@@ -292,7 +771,7 @@ void TreeView::fillRenderingState(TreeViewItemRenderingState& item,
     rendered_max_width = std::max(rendered_max_width, item.d_size.d_width + indent);
     rendered_total_height += item.d_size.d_height;
 
-    item.d_isSelected = isIndexSelected(index);
+    item.d_isSelected = isChildSelected(item.d_parentIndex, item.d_childId);
 }
 
 //----------------------------------------------------------------------------//
@@ -316,6 +795,34 @@ ModelIndex TreeView::indexAtWithAction(const glm::vec2& position,
     if (!render_area.isPointInRectf(window_position))
         return ModelIndex();
 
+    if (d_virtualised)
+    {
+        const size_t row = d_rowOffsets.findRow(window_position.y -
+            render_area.d_min.y + getVertScrollbar()->getScrollPosition());
+
+        if (row >= d_virtualRows.size())
+            return ModelIndex();
+
+        const VirtualRow virtual_row = d_virtualRows[row];
+        TreeViewItemRenderingState* item =
+            row >= d_firstVirtualRow && row - d_firstVirtualRow < d_virtualItems.size()
+            ? &d_virtualItems[row - d_firstVirtualRow] : nullptr;
+
+        float expander_width = getViewRenderer()->getSubtreeExpanderSize().d_width;
+        float base_x = getViewRenderer()->getSubtreeExpanderXIndent(virtual_row.d_nestedLevel);
+        base_x -= getHorzScrollbar()->getScrollPosition();
+        const bool toggles_expander = window_position.x >= base_x &&
+            window_position.x <= base_x + expander_width;
+
+        if (item != nullptr)
+            (this->*action)(*item, toggles_expander);
+
+        if (toggles_expander)
+            return ModelIndex();
+
+        return d_itemModel->makeIndex(virtual_row.d_childId, virtual_row.d_parentIndex);
+    }
+
     float cur_height = render_area.d_min.y - getVertScrollbar()->getScrollPosition();
     bool handled = false;
     return indexAtRecursive(d_rootItemState, cur_height, window_position,
@@ -373,6 +880,15 @@ void TreeView::toggleSubtree(TreeViewItemRenderingState& item)
     if (d_itemModel == nullptr)
         return;
 
+    if (d_virtualised)
+    {
+        size_t row;
+        if (getVirtualRowOfItem(item, row))
+            toggleVirtualRow(row);
+
+        return;
+    }
+
     item.d_subtreeIsExpanded = !item.d_subtreeIsExpanded;
 
     ItemViewEventArgs args(this,
@@ -428,9 +944,22 @@ void TreeView::handleSelectionAction(TreeViewItemRenderingState& item, bool togg
 //----------------------------------------------------------------------------//
 bool TreeView::onChildrenRemoved(const EventArgs& args)
 {
+    d_partialInvalidation = true;
     ItemView::onChildrenRemoved(args);
+    d_partialInvalidation = false;
 
     const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
+    if (d_virtualised)
+    {
+        onVirtualChildrenRemoved(margs);
+        invalidateView(false);
+        return true;
+    }
+
+    // the states of the removed items are dropped by the pending full render
+    if (d_needsFullRender)
+        return true;
+
     TreeViewItemRenderingState* item = getTreeViewItemForIndex(margs.d_parentIndex);
 
     if (item == nullptr)
@@ -439,7 +968,17 @@ bool TreeView::onChildrenRemoved(const EventArgs& args)
     item->d_totalChildCount -= margs.d_count;
 
     if (!item->d_subtreeIsExpanded)
+    {
+        invalidateViewPartially(false);
         return true;
+    }
+
+    if (margs.d_startId + margs.d_count > item->d_children.size())
+    {
+        d_needsFullRender = true;
+        invalidateView(false);
+        return true;
+    }
 
     ViewItemsVector::iterator begin = item->d_children.begin() + margs.d_startId;
     ViewItemsVector::iterator end = begin + margs.d_count;
@@ -456,16 +995,29 @@ bool TreeView::onChildrenRemoved(const EventArgs& args)
     item->d_children.erase(begin, end);
 
     item->sortChildren();
-    invalidateView(false);
+    invalidateViewPartially(false);
     return true;
 }
 
 //----------------------------------------------------------------------------//
 bool TreeView::onChildrenAdded(const EventArgs& args)
 {
+    d_partialInvalidation = true;
     ItemView::onChildrenAdded(args);
+    d_partialInvalidation = false;
 
     const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
+    if (d_virtualised)
+    {
+        onVirtualChildrenAdded(margs);
+        invalidateView(false);
+        return true;
+    }
+
+    // the added items are created along with the pending full render
+    if (d_needsFullRender)
+        return true;
+
     TreeViewItemRenderingState* item = getTreeViewItemForIndex(margs.d_parentIndex);
 
     if (item == nullptr)
@@ -473,8 +1025,19 @@ bool TreeView::onChildrenAdded(const EventArgs& args)
 
     item->d_totalChildCount += margs.d_count;
 
+    // a collapsed item only shows the expander for its new children
     if (!item->d_subtreeIsExpanded)
+    {
+        invalidateViewPartially(false);
         return true;
+    }
+
+    if (margs.d_startId > item->d_children.size())
+    {
+        d_needsFullRender = true;
+        invalidateView(false);
+        return true;
+    }
 
     ViewItemsVector states;
     for (size_t id = margs.d_startId; id < margs.d_startId + margs.d_count; ++id)
@@ -496,7 +1059,53 @@ bool TreeView::onChildrenAdded(const EventArgs& args)
         states.begin(), states.end());
 
     item->sortChildren();
-    invalidateView(false);
+    invalidateViewPartially(false);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool TreeView::onChildrenDataChanged(const EventArgs& args)
+{
+    d_partialInvalidation = true;
+    ItemView::onChildrenDataChanged(args);
+    d_partialInvalidation = false;
+
+    const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
+    if (d_virtualised)
+    {
+        d_needsItemsUpdate = true;
+        return true;
+    }
+
+    if (d_needsFullRender)
+        return true;
+
+    TreeViewItemRenderingState* item = getTreeViewItemForIndex(margs.d_parentIndex);
+
+    // items of collapsed subtrees have no rendering state to update
+    if (item == nullptr || !item->d_subtreeIsExpanded)
+        return true;
+
+    if (margs.d_startId + margs.d_count > item->d_children.size())
+    {
+        d_needsItemsUpdate = true;
+        return true;
+    }
+
+    for (size_t id = margs.d_startId; id < margs.d_startId + margs.d_count; ++id)
+    {
+        TreeViewItemRenderingState& child = item->d_children[id];
+        d_renderedTotalHeight -= child.d_size.d_height;
+
+        fillRenderingState(child,
+            d_itemModel->makeIndex(id, margs.d_parentIndex),
+            d_renderedMaxWidth, d_renderedTotalHeight);
+    }
+
+    if (d_sortMode != ViewSortMode::NoSorting)
+        item->sortChildren();
+
+    invalidateViewPartially(false);
     return true;
 }
 
@@ -515,6 +1124,23 @@ void TreeView::onSubtreeCollapsed(ItemViewEventArgs& args)
 //----------------------------------------------------------------------------//
 TreeViewItemRenderingState* TreeView::getTreeViewItemForIndex(const ModelIndex& index)
 {
+    if (d_virtualised)
+    {
+        if (d_itemModel->areIndicesEqual(index, d_itemModel->getRootIndex()))
+            return &d_rootItemState;
+
+        // only the rows around the visible area have a rendering state
+        for (ItemStateVector::iterator itor = d_virtualItems.begin();
+            itor != d_virtualItems.end(); ++itor)
+        {
+            if (d_itemModel->areIndicesEqual(index,
+                d_itemModel->makeIndex(itor->d_childId, itor->d_parentIndex)))
+                return &(*itor);
+        }
+
+        return nullptr;
+    }
+
     std::vector<int> ids_stack;
     ModelIndex root_index = d_itemModel->getRootIndex();
     ModelIndex temp_index = index;
@@ -550,6 +1176,18 @@ TreeViewItemRenderingState* TreeView::getTreeViewItemForIndex(const ModelIndex&
 //----------------------------------------------------------------------------//
 void TreeView::resortView()
 {
+    if (d_virtualised)
+    {
+        VirtualRowVector rows;
+        rows.reserve(d_virtualRows.size());
+        appendSortedVirtualRows(d_virtualRows, 0, d_virtualRows.size(), rows);
+        d_virtualRows.swap(rows);
+
+        resetVirtualRowHeights();
+        invalidateView(false);
+        return;
+    }
+
     d_rootItemState.sortChildren();
     invalidateView(false);
 }
@@ -557,12 +1195,25 @@ void TreeView::resortView()
 //----------------------------------------------------------------------------//
 void TreeView::expandAllSubtrees()
 {
+    // the states of a pending full render would replace the expanded ones
+    prepareForRender();
     expandSubtreeRecursive(d_rootItemState);
 }
 
 //----------------------------------------------------------------------------//
 void TreeView::expandSubtreeRecursive(TreeViewItemRenderingState& item)
 {
+    if (d_virtualised)
+    {
+        size_t row;
+        if (&item == &d_rootItemState)
+            expandVirtualRows(0, d_virtualRows.size());
+        else if (getVirtualRowOfItem(item, row))
+            expandVirtualRows(row, getVirtualSubtreeEnd(d_virtualRows, row));
+
+        return;
+    }
+
     if (!item.d_subtreeIsExpanded)
         toggleSubtree(item);
 
@@ -214,7 +214,7 @@ void ComboDropList::onCursorActivate(CursorInputEventArgs& e)
 		if (d_armed && (getChildAtPosition(e.position) == nullptr))
 		{
             // if something was selected, confirm that selection.
-            if (getIndexSelectionStates().size() > 0)
+            if (getSelectionCount() > 0)
             {
                 WindowEventArgs args(this);
                 onListSelectionAccepted(args);
@@ -86,7 +86,8 @@ Combobox::Combobox(const String& type, const String& name) :
 	Window(type, name),
     d_singleClickOperation(false),
     d_autoSizeHeight(false),
-    d_autoSizeWidth(false)
+    d_autoSizeWidth(false),
+    d_listFiltering(false)
 {
 	addComboboxProperties();
 }
@@ -679,6 +680,10 @@ void Combobox::onTextChanged(WindowEventArgs& e)
         editbox->setText(getText());
 		++e.handled;
 
+        // only text typed by the user filters the list
+        if (d_listFiltering && editbox->hasInputFocus())
+            getDropList()->setFilterText(getText());
+
         selectListItemWithEditboxText();
 
 		Window::onTextChanged(e);
@@ -693,6 +698,7 @@ void Combobox::onTextChanged(WindowEventArgs& e)
 *************************************************************************/
 bool Combobox::button_PressHandler(const EventArgs&)
 {
+    getDropList()->setFilterText("");
     selectListItemWithEditboxText();
     showDropList();
 
@@ -747,6 +753,15 @@ void Combobox::setAutoSizeListWidthToContent(bool auto_size)
         updateAutoSizedDropList();
 }
 
+//----------------------------------------------------------------------------//
+void Combobox::setListFilteringEnabled(bool setting)
+{
+    d_listFiltering = setting;
+
+    if (!d_listFiltering)
+        getDropList()->setFilterText("");
+}
+
 //----------------------------------------------------------------------------//
 void Combobox::updateAutoSizedDropList()
 {
@@ -921,6 +936,14 @@ void Combobox::addComboboxProperties(void)
           &Combobox::setAutoSizeListWidthToContent,
           &Combobox::getAutoSizeListWidthToContent, false
     );
+    CEGUI_DEFINE_PROPERTY(Combobox, bool,
+          "FilterList",
+          "Property to get/set whether typing in the editbox filters the items "
+          "shown by the drop down list. "
+          "Value is either \"true\" or \"false\".",
+          &Combobox::setListFilteringEnabled,
+          &Combobox::isListFilteringEnabled, false
+    );
 }
 
 
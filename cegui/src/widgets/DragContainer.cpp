@@ -29,6 +29,7 @@
 #include "CEGUI/RenderingContext.h"
 #include "CEGUI/ImageManager.h"
 #include "CEGUI/GUIContext.h"
+#include "CEGUI/RenderingWindow.h"
 #include <cmath>
 
 namespace CEGUI
@@ -53,6 +54,7 @@ DragContainer::DragContainer(const String& type, const String& name) :
     Window(type, name),
     d_dropTarget(nullptr),
     d_dragIndicatorImage(nullptr),
+    d_dragImageOffset(0.f, 0.f),
     d_dragThreshold(8.0f),
     d_dragAlpha(0.5f),
     d_draggingEnabled(true),
@@ -60,7 +62,10 @@ DragContainer::DragContainer(const String& type, const String& name) :
     d_dragging(false),
     d_stickyMode(false),
     d_pickedUp(false),
-    d_usingFixedDragOffset(false)
+    d_usingFixedDragOffset(false),
+    d_dragImageEnabled(false),
+    d_dragImageActive(false),
+    d_dragImageOwnsSurface(false)
 {
     addDragContainerProperties();
 }
@@ -166,6 +171,12 @@ void DragContainer::addDragContainerProperties()
             "Value is either \"true\" or \"false\".",
         &DragContainer::setUsingFixedDragOffset, &DragContainer::isUsingFixedDragOffset, false /* TODO: Inconsistency */
     );
+
+    CEGUI_DEFINE_PROPERTY(DragContainer, bool,
+        "DragImage", "Property to get/set whether the DragContainer is dragged as an image "
+            "cached when dragging starts.  Value is either \"true\" or \"false\".",
+        &DragContainer::setDragImageEnabled, &DragContainer::isDragImageEnabled, false
+    );
 }
 
 //----------------------------------------------------------------------------//
@@ -181,6 +192,22 @@ void DragContainer::doDragging(const glm::vec2& local_cursor)
     // calculate amount to move
     UVector2 offset(cegui_absdim(local_cursor.x), cegui_absdim(local_cursor.y));
     offset -= (d_usingFixedDragOffset) ? d_fixedDragOffset : d_dragPoint;
+
+    // the DragContainer stays in place, so the offset is the whole displacement
+    if (d_dragImageActive)
+    {
+        const glm::vec2 image_offset(CoordConverter::asAbsolute(offset, d_pixelSize));
+        if (image_offset != d_dragImageOffset)
+        {
+            d_dragImageOffset = image_offset;
+            updateDragImage();
+
+            WindowEventArgs args(this);
+            onDragPositionChanged(args);
+        }
+        return;
+    }
+
     if (offset != UVector2::zero())
     {
         // set new position
@@ -250,6 +277,17 @@ void DragContainer::onCursorActivate(CursorInputEventArgs& e)
         {
             if (d_dragging)
             {
+                // Move to where the drag image was dropped
+                if (d_dragImageActive)
+                {
+                    const glm::vec2 image_offset(d_dragImageOffset);
+                    endDragImage();
+
+                    if (image_offset != glm::vec2(0.f, 0.f))
+                        setPosition(getPosition() +
+                            UVector2(cegui_absdim(image_offset.x), cegui_absdim(image_offset.y)));
+                }
+
                 // Target could change even if we didn't move. Ensure we drop correctly.
                 updateDropTarget();
 
@@ -260,7 +298,11 @@ void DragContainer::onCursorActivate(CursorInputEventArgs& e)
 
                     // Try dropping. Continue sticky dragging if it is not accepted by the target.
                     if (!d_dropTarget->notifyDragDropItemDropped(this) && d_pickedUp)
+                    {
+                        if (d_dragging)
+                            beginDragImage();
                         return;
+                    }
 
                     if (d_moved)
                         d_startPosition = getPosition();
@@ -300,6 +342,9 @@ void DragContainer::onCaptureLost(WindowEventArgs& e)
 
     if (d_dragging)
     {
+        // any pending drag image offset is discarded along with the drag
+        endDragImage();
+
         // restore normal state of the window
         d_dragging = false;
 
@@ -345,6 +390,9 @@ void DragContainer::onClippingChanged(WindowEventArgs& e)
     }
 
     Window::onClippingChanged(e);
+
+    if (d_dragImageActive)
+        updateDragImage();
 }
 
 //----------------------------------------------------------------------------//
@@ -354,6 +402,18 @@ void DragContainer::onMoved(ElementEventArgs& e)
     d_moved = true;
 }
 
+//----------------------------------------------------------------------------//
+uint8_t DragContainer::handleAreaChanges(bool moved, bool sized)
+{
+    const uint8_t flags = Window::handleAreaChanges(moved, sized);
+
+    // the base class places our surface at the real position of the window
+    if (d_dragImageActive)
+        updateDragImage();
+
+    return flags;
+}
+
 //----------------------------------------------------------------------------//
 void DragContainer::onDragStarted(WindowEventArgs& e)
 {
@@ -370,6 +430,9 @@ void DragContainer::onDragStarted(WindowEventArgs& e)
 
     d_dragging = true;
 
+    if (d_dragImageEnabled)
+        beginDragImage();
+
     // Now drag mode is set, change cursor as required
     updateActiveCursorImage();
 
@@ -495,8 +558,8 @@ void DragContainer::onDragDropTargetChanged(DragDropEventArgs& e)
 //----------------------------------------------------------------------------//
 void DragContainer::getRenderingContext_impl(RenderingContext& ctx) const
 {
-    // if not dragging, do the default thing.
-    if (!d_dragging)
+    // if not dragging, do the default thing. The drag image is our own surface.
+    if (!d_dragging || d_dragImageActive)
     {
         Window::getRenderingContext_impl(ctx);
         return;
@@ -513,6 +576,95 @@ void DragContainer::getRenderingContext_impl(RenderingContext& ctx) const
     ctx.queue = RenderQueueID::Overlay;
 }
 
+//----------------------------------------------------------------------------//
+void DragContainer::beginDragImage()
+{
+    if (d_dragImageActive || !d_parent)
+        return;
+
+    d_dragImageOffset = glm::vec2(0.f, 0.f);
+    d_dragImageOwnsSurface = !isUsingAutoRenderingSurface();
+    if (d_dragImageOwnsSurface)
+        setUsingAutoRenderingSurface(true);
+
+    // without texture targets we just drag the window itself
+    RenderingSurface* surface = getRenderingSurface();
+    if (!surface || !surface->isRenderingWindow())
+    {
+        if (d_dragImageOwnsSurface)
+            setUsingAutoRenderingSurface(false);
+        d_dragImageOwnsSurface = false;
+        return;
+    }
+
+    // draw the cached image on top of everything else in the root surface
+    RenderingWindow* rw = static_cast<RenderingWindow*>(surface);
+    getRootWindow()->getTargetRenderingSurface()->transferRenderingWindow(*rw);
+    rw->setOwnerQueue(RenderQueueID::Overlay);
+
+    d_dragImageActive = true;
+    updateDragImage();
+}
+
+//----------------------------------------------------------------------------//
+void DragContainer::updateDragImage()
+{
+    RenderingWindow* rw = static_cast<RenderingWindow*>(getRenderingSurface());
+    rw->setPosition(getUnclippedOuterRect().get().getPosition() + d_dragImageOffset);
+    rw->setClippingRegion(getParentClipRect());
+
+    // A cached parent surface which is up to date would not draw us, and thus
+    // not the image either, so let it redraw the (now empty) area we cover.
+    // The content of the image itself is not redrawn.
+    if (d_parent)
+    {
+        RenderingContext parentCtx;
+        getParent()->getRenderingContext(parentCtx);
+
+        if (parentCtx.surface && parentCtx.surface->isRenderingWindow())
+        {
+            Rectf area(getOuterRectClipper());
+            if (area.getWidth() != 0.0f && area.getHeight() != 0.0f)
+                area.offset(-parentCtx.offset);
+
+            static_cast<RenderingWindow*>(parentCtx.surface)->invalidateArea(area);
+        }
+    }
+
+    if (GUIContext* context = getGUIContextPtr())
+        context->markAsDirty();
+}
+
+//----------------------------------------------------------------------------//
+void DragContainer::endDragImage()
+{
+    if (!d_dragImageActive)
+        return;
+
+    d_dragImageActive = false;
+    d_dragImageOffset = glm::vec2(0.f, 0.f);
+
+    RenderingWindow* rw = static_cast<RenderingWindow*>(getRenderingSurface());
+    rw->setOwnerQueue(RenderQueueID::Base);
+
+    if (d_dragImageOwnsSurface)
+    {
+        d_dragImageOwnsSurface = false;
+        setUsingAutoRenderingSurface(false);
+        return;
+    }
+
+    // give the surface back to our parent and put it where we really are
+    if (RenderingSurface* target = getParent() ? getParent()->getTargetRenderingSurface() : nullptr)
+        target->transferRenderingWindow(*rw);
+
+    rw->setPosition(getUnclippedOuterRect().get().getPosition());
+    rw->setClippingRegion(getParentClipRect());
+
+    if (GUIContext* context = getGUIContextPtr())
+        context->markAsDirty();
+}
+
 //----------------------------------------------------------------------------//
 bool DragContainer::pickUp(bool force_sticky /*= false*/)
 {
@@ -52,26 +52,21 @@ const String Editbox::ReadOnlyMouseCursorImagePropertyName("ReadOnlyMouseCursorI
 Editbox::Editbox(const String& type, const String& name) :
     EditboxBase(type, name),
     d_readOnlyMouseCursorImage(nullptr),
-    d_validator(System::getSingleton().createRegexMatcher()),
+    d_validationString(".*"),
+    // default to accepting all characters
+    d_validator(System::getSingleton().acquireRegexMatcher(d_validationString)),
     d_weOwnValidator(true),
     d_validatorMatchState(RegexMatcher::MatchState::Valid),
     d_previousValidityChangeResponse(true)
 {
     addEditboxProperties();
-
-    // default to accepting all characters
-    if (d_validator)
-        setValidationString(".*");
-    // set copy of validation string to ".*" so getter returns something valid.
-    else
-        d_validationString = ".*";
 }
 
 
 Editbox::~Editbox(void)
 {
-    if (d_weOwnValidator && d_validator)
-        System::getSingleton().destroyRegexMatcher(d_validator);
+    if (d_weOwnValidator)
+        System::getSingleton().releaseRegexMatcher(d_validator);
 }
 
 
@@ -91,7 +86,18 @@ void Editbox::setValidationString(const String& validation_string)
             "Unable to set validation string on Editbox '" + getNamePath() +
             "' because it does not currently have a RegexMatcher validator.");
 
-    d_validator->setRegexString(validation_string);
+    // system supplied validators are shared by all Editboxes using the same
+    // pattern, so switch to the one of the new pattern instead of changing it.
+    if (d_weOwnValidator)
+    {
+        RegexMatcher* const validator =
+            System::getSingleton().acquireRegexMatcher(validation_string);
+        System::getSingleton().releaseRegexMatcher(d_validator);
+        d_validator = validator;
+    }
+    else
+        d_validator->setRegexString(validation_string);
+
     d_validationString = validation_string;
 
     // notification
@@ -190,8 +196,8 @@ Editbox::MatchState Editbox::getStringMatchState(const String& str) const
 
 void Editbox::setValidator(RegexMatcher* validator)
 {
-    if (d_weOwnValidator && d_validator)
-        System::getSingleton().destroyRegexMatcher(d_validator);
+    if (d_weOwnValidator)
+        System::getSingleton().releaseRegexMatcher(d_validator);
 
     d_validator = validator;
 
@@ -199,7 +205,7 @@ void Editbox::setValidator(RegexMatcher* validator)
         d_weOwnValidator = false;
     else
     {
-        d_validator = System::getSingleton().createRegexMatcher();
+        d_validator = System::getSingleton().acquireRegexMatcher(d_validationString);
         d_weOwnValidator = true;
     }
 }
@@ -478,6 +484,13 @@ bool Editbox::validateWindowRenderer(const WindowRenderer* renderer) const
 }
 
 
+bool Editbox::updateCaretGeometry()
+{
+	EditboxWindowRenderer* wr = dynamic_cast<EditboxWindowRenderer*>(d_windowRenderer);
+	return wr && wr->updateCaretGeometry();
+}
+
+
 void Editbox::onValidationStringChanged(WindowEventArgs& e)
 {
     fireEvent(EventValidationStringChanged , e, EventNamespace);
@@ -33,6 +33,7 @@
 #include "CEGUI/Clipboard.h"
 #include "CEGUI/BidiVisualMapping.h"
 #include "CEGUI/UndoHandler.h"
+#include "CEGUI/GUIContext.h"
 
 #include <string.h>
 
@@ -116,6 +117,8 @@ void EditboxBase::setReadOnly(bool setting)
         d_readOnly = setting;
         WindowEventArgs args(this);
         onReadOnlyChanged(args);
+        // an editable box may blink its caret
+        requestUpdates();
         
         // Update the cursor according to the read only state.
         if (setting)
@@ -529,7 +532,7 @@ void EditboxBase::onMaximumTextLengthChanged(WindowEventArgs& e)
 
 void EditboxBase::onCaretMoved(WindowEventArgs& e)
 {
-    invalidate();
+    invalidateCaret();
     fireEvent(EventCaretMoved , e, EventNamespace);
 }
 
@@ -640,6 +643,29 @@ bool EditboxBase::performRedo()
 }
 
 
+void EditboxBase::invalidateCaret()
+{
+    // only the caret changes, let the renderer update it in place
+    if (updateCaretGeometry())
+    {
+        invalidateRenderingSurface();
+
+        if (GUIContext* context = getGUIContextPtr())
+            context->markAsDirty();
+    }
+    else
+    {
+        invalidate();
+    }
+}
+
+
+bool EditboxBase::updateCaretGeometry()
+{
+    return false;
+}
+
+
 bool EditboxBase::handleBasicSemanticValue(SemanticEventArgs& e)
 {
     switch (e.d_semanticValue)
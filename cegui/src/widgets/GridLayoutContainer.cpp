@@ -395,7 +395,10 @@ void GridLayoutContainer::layout_impl()
     // OK, now rowSizes[y] is the height of y-th row
     //         colSizes[x] is the width of x-th column
 
-    // Second layouting phase starts now
+    // Second layouting phase starts now, the positions are computed first
+    // and the children are moved all at once afterwards
+    d_childPositions.resize(d_children.size());
+
     UDim cellX;
     UDim cellY(0.f, 0.f);
     for (size_t y = 0; y < d_gridHeight; ++y)
@@ -405,9 +408,8 @@ void GridLayoutContainer::layout_impl()
         
         for (size_t x = 0; x < d_gridWidth; ++x)
         {
-            Window* window = getChildAtIndex(mapCellToIndex(x, y));
-            const UVector2 offset = getOffsetForWindow(window);
-            window->setPosition(UVector2(cellX, cellY) + offset);
+            const size_t idx = mapCellToIndex(x, y);
+            d_childPositions[idx] = UVector2(cellX, cellY) + getOffsetForWindow(getChildAtIndex(idx));
 
             cellX += colSizes[x];
         }
@@ -415,6 +417,8 @@ void GridLayoutContainer::layout_impl()
         cellY += rowSizes[y];
     }
 
+    applyChildPositions();
+
     // Now we just need to set the total width and height
 
     setSize(USize(cellX, cellY));
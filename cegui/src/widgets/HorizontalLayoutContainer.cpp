@@ -49,14 +49,16 @@ void HorizontalLayoutContainer::layout_impl()
     UDim leftOffset(0, 0);
     UDim layoutHeight(0, 0);
 
-    for (auto child : d_children)
+    // compute every position first and move the children at once afterwards
+    d_childPositions.resize(d_children.size());
+
+    for (size_t i = 0; i < d_children.size(); ++i)
     {
-        Window* window = static_cast<Window*>(child);
+        Window* window = static_cast<Window*>(d_children[i]);
+
+        d_childPositions[i] = getOffsetForWindow(window) + UVector2(leftOffset, UDim(0, 0));
 
-        const UVector2 offset = getOffsetForWindow(window);
-        window->setPosition(offset + UVector2(leftOffset, UDim(0, 0)));
-        
-        // setPosition triggered child pixel size recalculation, now we can get bounds
+        // pixel sizes of the children don't depend on their positions
         const UVector2 boundingSize = getBoundingSizeForWindow(window);
 
         // full child window height, including margins
@@ -71,6 +73,8 @@ void HorizontalLayoutContainer::layout_impl()
         leftOffset += boundingSize.d_x;
     }
 
+    applyChildPositions();
+
     setSize(USize(leftOffset, layoutHeight));
 }
 
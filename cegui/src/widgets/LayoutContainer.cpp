@@ -40,7 +40,8 @@ const String LayoutContainer::EventNamespace("LayoutContainer");
 LayoutContainer::LayoutContainer(const String& type, const String& name):
     Window(type, name),
     d_needsLayouting(false),
-    d_childContentArea(this, static_cast<Element::CachedRectf::DataGenerator>(&LayoutContainer::getChildContentArea_impl))
+    d_childContentArea(this, static_cast<Element::CachedRectf::DataGenerator>(&LayoutContainer::getChildContentArea_impl)),
+    d_applyingChildPositions(false)
 {
     // layout should take the whole window by default I think
     setSize(USize(cegui_reldim(1), cegui_reldim(1)));
@@ -60,6 +61,10 @@ void LayoutContainer::layoutIfNecessary()
         // the final size calculation changes parent ScrollablePane scrollbars.
         // This is why the flag is cleared before layouting, not after it.
         d_needsLayouting = false;
+
+        // Positioning the children fires their EventSized and EventMoved,
+        // have subscribers see each of them once when layouting is done.
+        EventSet::BatchScope batch;
         layout_impl();
     }
 }
@@ -71,6 +76,19 @@ void LayoutContainer::update(float elapsed)
     layoutIfNecessary();
 }
 
+//----------------------------------------------------------------------------//
+void LayoutContainer::updateWithoutChildren(float elapsed)
+{
+    Window::updateWithoutChildren(elapsed);
+    layoutIfNecessary();
+}
+
+//----------------------------------------------------------------------------//
+bool LayoutContainer::isUpdateRequired() const
+{
+    return d_needsLayouting || Window::isUpdateRequired();
+}
+
 //----------------------------------------------------------------------------//
 uint8_t LayoutContainer::handleAreaChanges(bool moved, bool sized)
 {
@@ -160,14 +178,16 @@ void LayoutContainer::cleanupChildren(void)
 //----------------------------------------------------------------------------//
 bool LayoutContainer::handleChildSized(const EventArgs&)
 {
-    markNeedsLayouting();
+    if (!d_applyingChildPositions)
+        markNeedsLayouting();
     return true;
 }
 
 //----------------------------------------------------------------------------//
 bool LayoutContainer::handleChildMarginChanged(const EventArgs&)
 {
-    markNeedsLayouting();
+    if (!d_applyingChildPositions)
+        markNeedsLayouting();
     return true;
 }
 
@@ -185,6 +205,30 @@ bool LayoutContainer::handleChildRemoved(const EventArgs&)
     return true;
 }
 
+//----------------------------------------------------------------------------//
+void LayoutContainer::applyChildPositions()
+{
+    d_applyingChildPositions = true;
+
+    try
+    {
+        // NB: handlers of the area change events may add or remove children
+        for (size_t i = 0; i < d_childPositions.size() && i < d_children.size(); ++i)
+        {
+            Window* window = static_cast<Window*>(d_children[i]);
+            if (window->getPosition() != d_childPositions[i])
+                window->setPosition(d_childPositions[i]);
+        }
+    }
+    catch (...)
+    {
+        d_applyingChildPositions = false;
+        throw;
+    }
+
+    d_applyingChildPositions = false;
+}
+
 //----------------------------------------------------------------------------//
 UVector2 LayoutContainer::getOffsetForWindow(Window* window) const
 {
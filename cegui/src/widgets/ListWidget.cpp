@@ -82,7 +82,7 @@ StandardItem* ListWidget::getFirstSelectedItem()
 //----------------------------------------------------------------------------//
 StandardItem* ListWidget::getNextSelectedItem(const StandardItem* start_item)
 {
-    if (d_indexSelectionStates.empty())
+    if (d_selection.empty())
         return nullptr;
 
     int child_id = d_itemModel.getChildId(start_item);
@@ -127,6 +127,34 @@ void ListWidget::insertItem(StandardItem* item, const StandardItem* position)
     d_itemModel.insertItem(item, position);
 }
 
+//----------------------------------------------------------------------------//
+void ListWidget::addItems(const std::vector<String>& texts)
+{
+    std::vector<StandardItem*> items;
+    items.reserve(texts.size());
+
+    for (std::vector<String>::const_iterator itor = texts.begin();
+        itor != texts.end(); ++itor)
+    {
+        items.push_back(new StandardItem(*itor));
+    }
+
+    addItems(items);
+}
+
+//----------------------------------------------------------------------------//
+void ListWidget::addItems(const std::vector<StandardItem*>& items)
+{
+    d_itemModel.addItems(items.begin(), items.end());
+}
+
+//----------------------------------------------------------------------------//
+void ListWidget::insertItems(const std::vector<StandardItem*>& items,
+    const StandardItem* position)
+{
+    d_itemModel.insertItems(items.begin(), items.end(), position);
+}
+
 //----------------------------------------------------------------------------//
 void ListWidget::removeItem(const StandardItem* item)
 {
@@ -142,7 +170,7 @@ size_t ListWidget::getItemCount() const
 //----------------------------------------------------------------------------//
 size_t ListWidget::getSelectedItemsCount() const
 {
-    return d_indexSelectionStates.size();
+    return getSelectionCount();
 }
 
 //----------------------------------------------------------------------------//
@@ -160,25 +188,18 @@ StandardItem* ListWidget::findItemWithText(const String& text, const StandardIte
         return nullptr;
 
     // if start_item is NULL begin search at beginning, else start at item after start_item
-    size_t index = start_item == nullptr ? 0 : (static_cast<size_t>(child_id) + 1);
-    size_t list_size = getItemCount();
-
-    while (index < list_size)
-    {
-        if (getItemAtIndex(index)->getText() == text)
-        {
-            return getItemAtIndex(index);
-        }
-
-        index++;
-    }
+    const size_t start_id = start_item == nullptr ? 0 : (static_cast<size_t>(child_id) + 1);
 
-    return nullptr;
+    const int found_id = findChildIdWithText(text, start_id);
+    return found_id == -1 ? nullptr : getItemAtIndex(static_cast<size_t>(found_id));
 }
 
 //----------------------------------------------------------------------------//
 void ListWidget::clearList()
 {
+    // the model notifies about the removed items, report the cleared list
+    // only once to the ViewContentsChanged subscribers.
+    EventSet::BatchScope batch;
     d_itemModel.clear(true);
 
     WindowEventArgs args(this);
@@ -203,23 +224,15 @@ bool ListWidget::isItemInList(const StandardItem* item)
 //----------------------------------------------------------------------------//
 bool ListWidget::isItemSelected(const StandardItem* item)
 {
-    for (SelectionStatesVector::const_iterator itor = getIndexSelectionStates().begin();
-        itor != getIndexSelectionStates().end(); ++itor)
-    {
-        if (item == d_itemModel.getItemForIndex(itor->d_selectedIndex))
-        {
-            return true;
-        }
-    }
-
-    return false;
+    const int child_id = d_itemModel.getChildId(item);
+    return child_id != -1 &&
+        isChildSelected(d_itemModel.getRootIndex(), static_cast<size_t>(child_id));
 }
 
 //----------------------------------------------------------------------------//
 bool ListWidget::isIndexSelected(size_t index)
 {
-    //TODO: make a macro/inline function for lists that makes an index - since Root is always the parent
-    return ListView::isIndexSelected(d_itemModel.makeIndex(index, d_itemModel.getRootIndex()));
+    return isChildSelected(d_itemModel.getRootIndex(), index);
 }
 
 //----------------------------------------------------------------------------//
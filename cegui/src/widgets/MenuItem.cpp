@@ -417,6 +417,7 @@ void MenuItem::startPopupClosing(void)
         d_autoPopupTimeElapsed = 0.0f;
         d_popupClosing = true;
         invalidate();
+        requestUpdates();
     }
     else
     {
@@ -436,6 +437,7 @@ void MenuItem::startPopupOpening(void)
     {
         d_autoPopupTimeElapsed = 0.0f;
         d_popupOpening = true;
+        requestUpdates();
     }
 }
 
@@ -655,6 +657,12 @@ void MenuItem::updateSelf(float elapsed)
     }
 }
 
+bool MenuItem::isUpdateRequired() const
+{
+    return (d_autoPopupTimeout != 0.0f && (d_popupOpening || d_popupClosing)) ||
+        ItemEntry::isUpdateRequired();
+}
+
 /*************************************************************************
     Internal version of adding a child window.
 *************************************************************************/
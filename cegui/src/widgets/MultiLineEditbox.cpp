@@ -33,6 +33,7 @@
 #include "CEGUI/CoordConverter.h"
 #include "CEGUI/Clipboard.h"
 #include "CEGUI/UndoHandler.h"
+#include <algorithm>
 
 namespace CEGUI
 {
@@ -80,6 +81,9 @@ MultiLineEditbox::MultiLineEditbox(const String& type, const String& name) :
 	d_wordWrap(true),
 	d_lastRenderWidth(0.0),
 	d_widestExtent(0.0f),
+	d_formattedFont(nullptr),
+	d_formattedLineSpacing(0.0f),
+	d_formattedWordWrap(true),
 	d_forceVertScroll(false),
 	d_forceHorzScroll(false),
 	d_selectionBrush(nullptr)
@@ -274,8 +278,6 @@ void MultiLineEditbox::formatText(const bool update_scrollbars)
 {
 	d_widestExtent = 0.0f;
 
-	String paraText;
-
 	const Font* fnt = getActualFont();
 
 	if (fnt)
@@ -283,7 +285,6 @@ void MultiLineEditbox::formatText(const bool update_scrollbars)
 		float areaWidth = getTextRenderArea().getWidth();
         String::size_type   currPos = 0;
         String::size_type   paraLen;
-        LineInfo line{};
 
         d_lines.clear();
 
@@ -298,91 +299,220 @@ void MultiLineEditbox::formatText(const bool update_scrollbars)
 				++paraLen -= currPos;
 			}
 
-            paraText = getText().substr(currPos, paraLen);
+            formatParagraph(*fnt, getText().substr(currPos, paraLen), currPos, areaWidth, d_lines);
 
-			if (!d_wordWrap || (areaWidth <= 0.0f))
-			{
-				// no word wrapping, so we are just one long line.
-				line.d_startIdx = currPos;
-				line.d_length	= paraLen;
-				line.d_extent	= fnt->getTextExtent(paraText);
-				d_lines.push_back(line);
-
-				// update widest, if needed.
-				if (line.d_extent > d_widestExtent)
-				{
-					d_widestExtent = line.d_extent;
-				}
+			// skip to next 'paragraph' in text
+			currPos += paraLen;
+		}
 
-			}
-			// must word-wrap the paragraph text
-			else
+		for (const LineInfo& line : d_lines)
+		{
+			d_widestExtent = std::max(d_widestExtent, line.d_extent);
+		}
+
+		d_lastRenderWidth = areaWidth;
+	}
+
+	storeFormattingState(fnt);
+
+    if (update_scrollbars)
+        configureScrollbars();
+
+    invalidate();
+}
+
+
+void MultiLineEditbox::formatChangedText(const bool update_scrollbars)
+{
+	const Font* fnt = getActualFont();
+	const float areaWidth = getTextRenderArea().getWidth();
+
+	if (!fnt || d_lines.empty() || (fnt != d_formattedFont) ||
+		(fnt->getLineSpacing() != d_formattedLineSpacing) ||
+		(d_wordWrap != d_formattedWordWrap) || (areaWidth != d_lastRenderWidth))
+	{
+		formatText(update_scrollbars);
+		return;
+	}
+
+	const String& text = getText();
+	const size_t oldLength = d_formattedText.length();
+	const size_t newLength = text.length();
+	const size_t minLength = std::min(oldLength, newLength);
+
+	// find the unchanged beginning and end of the text
+	size_t prefixLen = 0;
+	while ((prefixLen < minLength) && (text[prefixLen] == d_formattedText[prefixLen]))
+	{
+		++prefixLen;
+	}
+
+	size_t suffixLen = 0;
+	while ((suffixLen < minLength - prefixLen) &&
+		   (text[newLength - 1 - suffixLen] == d_formattedText[oldLength - 1 - suffixLen]))
+	{
+		++suffixLen;
+	}
+
+	if ((prefixLen == minLength) && (oldLength == newLength))
+	{
+		if (update_scrollbars)
+			configureScrollbars();
+
+		invalidate();
+		return;
+	}
+
+	// the lines of the paragraphs before the change are still valid
+	String::size_type currPos = 0;
+	if (prefixLen > 0)
+	{
+		const String::size_type lastBreak = text.find_last_of(d_lineBreakChars, prefixLen - 1);
+		if (lastBreak != String::npos)
+		{
+			currPos = lastBreak + 1;
+		}
+	}
+
+	const auto lineStartLess = [](const LineInfo& line, size_t idx)
+	{
+		return line.d_startIdx < idx;
+	};
+
+	const size_t firstChangedLine = std::lower_bound(
+		d_lines.begin(), d_lines.end(), currPos, lineStartLess) - d_lines.begin();
+	size_t firstKeptLine = d_lines.size();
+
+	// reformat paragraph by paragraph until one ends in the unchanged end of
+	// the text, where the old lines continue at the same paragraph start.
+	const size_t changeEnd = newLength - suffixLen;
+	LineList changedLines;
+
+	while (currPos < newLength)
+	{
+		String::size_type paraLen = text.find_first_of(d_lineBreakChars, currPos);
+		if (paraLen == String::npos)
+		{
+			paraLen = newLength - currPos;
+		}
+		else
+		{
+			++paraLen -= currPos;
+		}
+
+		formatParagraph(*fnt, text.substr(currPos, paraLen), currPos, areaWidth, changedLines);
+		currPos += paraLen;
+
+		if ((currPos > changeEnd) && (currPos < newLength))
+		{
+			const size_t oldPos = currPos + oldLength - newLength;
+			const auto oldLine = std::lower_bound(d_lines.begin() + firstChangedLine,
+				d_lines.end(), oldPos, lineStartLess);
+
+			if ((oldLine != d_lines.end()) && (oldLine->d_startIdx == oldPos))
 			{
-				String::size_type lineIndex = 0;
+				firstKeptLine = oldLine - d_lines.begin();
+				break;
+			}
+		}
+	}
 
-				// while there is text in the string
-				while (lineIndex < paraLen)
+	d_lines.erase(d_lines.begin() + firstChangedLine, d_lines.begin() + firstKeptLine);
+	d_lines.insert(d_lines.begin() + firstChangedLine, changedLines.begin(), changedLines.end());
+
+	// kept lines only move by the length difference, their extents are reused
+	d_widestExtent = 0.0f;
+	for (size_t i = 0; i < d_lines.size(); ++i)
+	{
+		if (i >= firstChangedLine + changedLines.size())
+		{
+			d_lines[i].d_startIdx = d_lines[i].d_startIdx + newLength - oldLength;
+		}
+
+		d_widestExtent = std::max(d_widestExtent, d_lines[i].d_extent);
+	}
+
+	storeFormattingState(fnt);
+
+	if (update_scrollbars)
+		configureScrollbars();
+
+	invalidate();
+}
+
+
+void MultiLineEditbox::formatParagraph(const Font& fnt, const String& para_text,
+                                       size_t para_start, float area_width,
+                                       LineList& lines) const
+{
+	const String::size_type paraLen = para_text.length();
+	LineInfo line{};
+
+	if (!d_wordWrap || (area_width <= 0.0f))
+	{
+		// no word wrapping, so we are just one long line.
+		line.d_startIdx = para_start;
+		line.d_length	= paraLen;
+		line.d_extent	= fnt.getTextExtent(para_text);
+		lines.push_back(line);
+		return;
+	}
+
+	// must word-wrap the paragraph text
+	String::size_type lineIndex = 0;
+
+	// while there is text in the string
+	while (lineIndex < paraLen)
+	{
+		String::size_type  lineLen = 0;
+		float lineExtent = 0.0f;
+
+		// loop while we have not reached the end of the paragraph string
+		while (lineLen < (paraLen - lineIndex))
+		{
+			// get cp / char count of next token
+			size_t nextTokenSize = getNextTokenLength(para_text, lineIndex + lineLen);
+
+			// get pixel width of the token
+			float tokenExtent  = fnt.getTextExtent(para_text.substr(lineIndex + lineLen, nextTokenSize));
+
+			// would adding this token would overflow the available width
+			if ((lineExtent + tokenExtent) > area_width)
+			{
+				// Was this the first token?
+				if (lineLen == 0)
 				{
-					String::size_type  lineLen = 0;
-					float lineExtent = 0.0f;
-
-					// loop while we have not reached the end of the paragraph string
-					while (lineLen < (paraLen - lineIndex))
-					{
-						// get cp / char count of next token
-						size_t nextTokenSize = getNextTokenLength(paraText, lineIndex + lineLen);
-
-						// get pixel width of the token
-						float tokenExtent  = fnt->getTextExtent(paraText.substr(lineIndex + lineLen, nextTokenSize));
-
-						// would adding this token would overflow the available width
-						if ((lineExtent + tokenExtent) > areaWidth)
-						{
-							// Was this the first token?
-							if (lineLen == 0)
-							{
-								// get point at which to break the token
-								lineLen = fnt->getCharAtPixel(paraText.substr(lineIndex, nextTokenSize), areaWidth);
-							}
-
-							// text wraps, exit loop early with line info up until wrap point
-							break;
-						}
-
-						// add this token to current line
-						lineLen    += nextTokenSize;
-						lineExtent += tokenExtent;
-					}
-
-					// set up line info and add to collection
-					line.d_startIdx = currPos + lineIndex;
-					line.d_length	= lineLen;
-					line.d_extent	= lineExtent;
-					d_lines.push_back(line);
-
-					// update widest, if needed.
-					if (lineExtent > d_widestExtent)
-					{
-						d_widestExtent = lineExtent;
-					}
-
-					// update position in string
-					lineIndex += lineLen;
+					// get point at which to break the token
+					lineLen = fnt.getCharAtPixel(para_text.substr(lineIndex, nextTokenSize), area_width);
 				}
 
+				// text wraps, exit loop early with line info up until wrap point
+				break;
 			}
 
-			// skip to next 'paragraph' in text
-			currPos += paraLen;
+			// add this token to current line
+			lineLen    += nextTokenSize;
+			lineExtent += tokenExtent;
 		}
 
-		d_lastRenderWidth = areaWidth;
+		// set up line info and add to collection
+		line.d_startIdx = para_start + lineIndex;
+		line.d_length	= lineLen;
+		line.d_extent	= lineExtent;
+		lines.push_back(line);
+
+		// update position in string
+		lineIndex += lineLen;
 	}
+}
 
-    if (update_scrollbars)
-        configureScrollbars();
 
-    invalidate();
+void MultiLineEditbox::storeFormattingState(const Font* fnt)
+{
+	d_formattedText = getText();
+	d_formattedFont = fnt;
+	d_formattedLineSpacing = fnt ? fnt->getLineSpacing() : 0.0f;
+	d_formattedWordWrap = d_wordWrap;
 }
 
 
@@ -461,18 +591,14 @@ size_t MultiLineEditbox::getLineNumberFromIndex(size_t index) const
 	}
 	else
 	{
-		size_t indexCount = 0;
-		size_t caretLine = 0;
+		// lines are sorted by their start index, find the last one starting
+		// at or before index.
+		const auto nextLine = std::upper_bound(d_lines.begin(), d_lines.end(), index,
+			[](size_t idx, const LineInfo& line) { return idx < line.d_startIdx; });
 
-		for (; caretLine < lineCount; ++caretLine)
+		if (nextLine != d_lines.begin())
 		{
-			indexCount += d_lines[caretLine].d_length;
-
-			if (index < indexCount)
-			{
-				return caretLine;
-			}
-
+			return static_cast<size_t>(nextLine - d_lines.begin()) - 1;
 		}
 
 	}
@@ -492,14 +618,12 @@ void MultiLineEditbox::eraseSelectedText(bool modify_text)
 		// erase the selected characters (if required)
 		if (modify_text)
 		{
-            String newText = getText();
             UndoHandler::UndoAction undo;
             undo.d_type = UndoHandler::UndoActionType::Delete;
             undo.d_startIdx = getSelectionStart();
-            undo.d_text = newText.substr(getSelectionStart(), getSelectionLength());
+            undo.d_text = getText().substr(getSelectionStart(), getSelectionLength());
             d_undoHandler->addUndoHistory(undo);
-            newText.erase(getSelectionStart(), getSelectionLength());
-            setText(newText);
+            eraseText(getSelectionStart(), getSelectionLength());
 
 			// trigger notification that text has changed.
 			WindowEventArgs args(this);
@@ -522,23 +646,19 @@ bool MultiLineEditbox::performPaste(Clipboard& clipboard)
     if (clipboardText.empty())
         return false;
 
-    // backup and erase selected text
-    String tmp(getText());
-    tmp.erase(getSelectionStart(), getSelectionLength());
+    // erase selected text, the text itself is only modified below
+    const size_t selectionLength = getSelectionLength();
     eraseSelectedText(false);
 
     // if there is room
-    if (tmp.length() + clipboardText.length() < d_maxTextLen)
+    if (getText().length() - selectionLength + clipboardText.length() < d_maxTextLen)
     {
-        String newText = getText();
-        tmp.insert(getCaretIndex(), clipboardText);
         UndoHandler::UndoAction undo;
         undo.d_type = UndoHandler::UndoActionType::Insert;
         undo.d_startIdx = getCaretIndex();
         undo.d_text = clipboardText;
         d_undoHandler->addUndoHistory(undo);
-        newText.insert(getCaretIndex(), clipboardText);
-        setText(newText);
+        replaceText(getCaretIndex(), selectionLength, clipboardText);
 
         d_caretPos += clipboardText.length();
 
@@ -559,15 +679,16 @@ void MultiLineEditbox::handleBackspace()
 {
     if (!isReadOnly())
     {
-        String newText(getText());
+        const String& text = getText();
 
         if (getSelectionLength() != 0)
         {
-            newText.erase(getSelectionStart(), getSelectionLength());
+            const size_t selectionStart = getSelectionStart();
+            const size_t selectionLength = getSelectionLength();
             // erase selection using mode that does not modify getText()
             // (we just want to update state)
             eraseSelectedText(false);
-            setText(newText);
+            eraseText(selectionStart, selectionLength);
         }
         else if (d_caretPos > 0)
         {
@@ -578,8 +699,8 @@ void MultiLineEditbox::handleBackspace()
             size_t deleteStartPos = d_caretPos - 1;
             size_t deleteLength = 1;
 #else
-            String::codepoint_iterator caretIter(newText.begin() + d_caretPos,
-                                                 newText.begin(), newText.end());
+            String::codepoint_iterator caretIter(text.begin() + d_caretPos,
+                                                 text.begin(), text.end());
             --caretIter;
             
             size_t deleteStartPos = caretIter.getCodeUnitIndexFromStart();
@@ -587,11 +708,10 @@ void MultiLineEditbox::handleBackspace()
 #endif
 
             undo.d_startIdx = deleteStartPos;
-            undo.d_text = newText.substr(deleteStartPos, deleteLength);
+            undo.d_text = text.substr(deleteStartPos, deleteLength);
             d_undoHandler->addUndoHistory(undo);
-            newText.erase(deleteStartPos, deleteLength);
             setCaretIndex(deleteStartPos);
-            setText(newText);
+            eraseText(deleteStartPos, deleteLength);
         }
     }
 }
@@ -601,15 +721,16 @@ void MultiLineEditbox::handleDelete()
 {
     if (!isReadOnly())
     {
-        String newText(getText());
+        const String& text = getText();
 
         if (getSelectionLength() != 0)
         {
-            newText.erase(getSelectionStart(), getSelectionLength());
+            const size_t selectionStart = getSelectionStart();
+            const size_t selectionLength = getSelectionLength();
             // erase selection using mode that does not modify getText()
             // (we just want to update state)
             eraseSelectedText(false);
-            setText(newText);
+            eraseText(selectionStart, selectionLength);
         }
         else if (getCaretIndex() < getText().length() - 1)
         {
@@ -620,13 +741,12 @@ void MultiLineEditbox::handleDelete()
 #if CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_8
             size_t eraseLength = 1;
 #else
-            size_t eraseLength = String::getCodePointSize(newText[d_caretPos]);
+            size_t eraseLength = String::getCodePointSize(text[d_caretPos]);
 #endif
 
-            undo.d_text = newText.substr(d_caretPos, eraseLength);
+            undo.d_text = text.substr(d_caretPos, eraseLength);
             d_undoHandler->addUndoHistory(undo);
-            newText.erase(d_caretPos, eraseLength);
-            setText(newText);
+            eraseText(d_caretPos, eraseLength);
 
             ensureCaretIsVisible();
         }
@@ -740,24 +860,26 @@ void MultiLineEditbox::handleNewLine()
 {
     if (!isReadOnly())
     {
-        // erase selected text
-        String newText(getText());
-        newText.erase(getSelectionStart(), getSelectionLength());
+        // erase selected text, the text itself is only modified below
+        const size_t selectionLength = getSelectionLength();
         eraseSelectedText(false);
+        const size_t position = getCaretIndex();
 
         // if there is room
-        if (newText.length() - 1 < d_maxTextLen)
+        if (getText().length() - selectionLength - 1 < d_maxTextLen)
         {
             UndoHandler::UndoAction undo;
             undo.d_type = UndoHandler::UndoActionType::Insert;
-            undo.d_startIdx = getCaretIndex();
+            undo.d_startIdx = position;
             undo.d_text = "\x0a";
             d_undoHandler->addUndoHistory(undo);
-            newText.insert(getCaretIndex(), 1, static_cast<String::value_type>(0x0a));
             d_caretPos++;
+            replaceText(position, selectionLength, undo.d_text);
+        }
+        else
+        {
+            eraseText(position, selectionLength);
         }
-
-        setText(newText);
     }
 }
 
@@ -823,34 +945,27 @@ void MultiLineEditbox::onCharacter(TextEventArgs& e)
     if (e.handled == 0 && hasInputFocus() && !isReadOnly() &&
         getActualFont()->isCodepointAvailable(e.d_character))
     {
-        // erase selected text
-        String newText(getText());
-        newText.erase(getSelectionStart(), getSelectionLength());
+        // erase selected text, the text itself is only modified below
+        const size_t selectionLength = getSelectionLength();
         eraseSelectedText(false);
+        const size_t position = getCaretIndex();
 
         // if there is room
-        if (newText.length() - 1 < d_maxTextLen)
+        if (getText().length() - selectionLength - 1 < d_maxTextLen)
         {
             UndoHandler::UndoAction undo;
             undo.d_type = UndoHandler::UndoActionType::Insert;
-            undo.d_startIdx = getCaretIndex();
+            undo.d_startIdx = position;
             undo.d_text = e.d_character;
             d_undoHandler->addUndoHistory(undo);
-#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
-            size_t strLen = newText.length();
-#endif
-            newText.insert(getCaretIndex(), 1, e.d_character);
-#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
-            d_caretPos += newText.length() - strLen;
-#else
-            d_caretPos++;
-#endif
-            setText(newText);
+            // the character may take multiple code units
+            d_caretPos += undo.d_text.length();
+            replaceText(position, selectionLength, undo.d_text);
             ++e.handled;
         }
         else
         {
-            setText(newText);
+            eraseText(position, selectionLength);
         }
     }
     else
@@ -867,9 +982,7 @@ void MultiLineEditbox::onTextChanged(WindowEventArgs& e)
     // ensure last character is a new line
     if ((getText().length() == 0) || (getText()[getText().length() - 1] != '\n'))
     {
-        String newText = getText();
-        newText.append(1, '\n');
-        setText(newText);
+        appendText("\n");
     }
 
 
@@ -878,8 +991,8 @@ void MultiLineEditbox::onTextChanged(WindowEventArgs& e)
 
     // clear selection
     clearSelection();
-    // layout new text
-    formatText(true);
+    // layout new text, reusing the lines of the unchanged paragraphs
+    formatChangedText(true);
     // layout child windows (scrollbars) since text layout may have changed
     performChildLayout(false, false);
     // ensure caret is still within the text
@@ -938,6 +1051,13 @@ bool MultiLineEditbox::validateWindowRenderer(const WindowRenderer* renderer) co
 }
 
 
+bool MultiLineEditbox::updateCaretGeometry()
+{
+	MultiLineEditboxWindowRenderer* wr = dynamic_cast<MultiLineEditboxWindowRenderer*>(d_windowRenderer);
+	return wr && wr->updateCaretGeometry();
+}
+
+
 // Context might change, we should update contents if it is valid
 void MultiLineEditbox::onTargetSurfaceChanged(RenderingSurface* newSurface)
 {
@@ -1195,9 +1315,7 @@ void MultiLineEditbox::handleSelectAllText(SemanticEventArgs& e)
     // erroneous situation and select up to end at end of text.
     if (paraEnd == String::npos)
     {
-        String newText = getText();
-        newText.append(1, '\n');
-        setText(newText);
+        appendText("\n");
 
         paraEnd = getText().length() - 1;
     }
@@ -122,6 +122,7 @@ void PopupMenu::openPopupMenu(bool notify)
 
 	show();
 	activate();
+	requestUpdates();
 }
 
 
@@ -177,6 +178,8 @@ void PopupMenu::closePopupMenu(bool notify)
 	    d_fading = false;
 	    hide();
 	}
+
+	requestUpdates();
 }
 
 
@@ -225,6 +228,15 @@ void PopupMenu::updateSelf(float elapsed)
 }
 
 
+/*************************************************************************
+	Keep receiving time pulses while fading
+*************************************************************************/
+bool PopupMenu::isUpdateRequired() const
+{
+    return d_fading || MenuBase::isUpdateRequired();
+}
+
+
 /*************************************************************************
 	Sets up sizes and positions for attached ItemEntry children.
 *************************************************************************/
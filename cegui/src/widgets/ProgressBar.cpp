@@ -27,6 +27,7 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/widgets/ProgressBar.h"
+#include "CEGUI/GUIContext.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -41,6 +42,15 @@ const String ProgressBar::EventProgressChanged( "ProgressChanged" );
 const String ProgressBar::EventProgressDone( "ProgressDone" );
 
 
+/*************************************************************************
+	Constructor for ProgressBarWindowRenderer class
+*************************************************************************/
+ProgressBarWindowRenderer::ProgressBarWindowRenderer(const String& name) :
+	WindowRenderer(name, ProgressBar::EventNamespace)
+{
+}
+
+
 /*************************************************************************
 	Constructor for ProgressBar class
 *************************************************************************/
@@ -92,7 +102,19 @@ void ProgressBar::setProgress(float progress)
 *************************************************************************/
 void ProgressBar::onProgressChanged(WindowEventArgs& e)
 {
-	invalidate();
+	// only the progress imagery changes, let the renderer update it in place
+	ProgressBarWindowRenderer* wr = dynamic_cast<ProgressBarWindowRenderer*>(d_windowRenderer);
+	if (wr && wr->updateProgressGeometry())
+	{
+		invalidateRenderingSurface();
+
+		if (GUIContext* context = getGUIContextPtr())
+			context->markAsDirty();
+	}
+	else
+	{
+		invalidate();
+	}
 
 	fireEvent(EventProgressChanged, e, EventNamespace);
 }
@@ -159,6 +159,18 @@ void ScrollablePane::setSwipeScrollingEnabled(bool setting)
         releaseInput();
 }
 
+//----------------------------------------------------------------------------//
+bool ScrollablePane::isContentCullingEnabled() const
+{
+    return getScrolledContainer()->isChildCullingEnabled();
+}
+
+//----------------------------------------------------------------------------//
+void ScrollablePane::setContentCullingEnabled(bool setting)
+{
+    getScrolledContainer()->setChildCullingEnabled(setting);
+}
+
 //----------------------------------------------------------------------------//
 float ScrollablePane::getHorizontalStepSize(void) const
 {
@@ -598,6 +610,12 @@ void ScrollablePane::addScrollablePaneProperties(void)
         &ScrollablePane::setSwipeScrollingEnabled, &ScrollablePane::isSwipeScrollingEnabled, false
     );
 
+    CEGUI_DEFINE_PROPERTY(ScrollablePane, bool,
+        "ContentCulling", "Whether content windows outside the viewable area are skipped "
+        "when drawing and updating. Value is either \"true\" or \"false\".",
+        &ScrollablePane::setContentCullingEnabled, &ScrollablePane::isContentCullingEnabled, true
+    );
+
     CEGUI_DEFINE_PROPERTY(ScrollablePane, bool,
         "ForceVertScrollbar", "Property to get/set the 'always show' setting for the vertical scroll "
         "bar of the pane.  Value is either \"true\" or \"false\".",
@@ -42,7 +42,8 @@ const String ScrolledContainer::EventNamespace("ScrolledContainer");
 //----------------------------------------------------------------------------//
 ScrolledContainer::ScrolledContainer(const String& type, const String& name) :
     Window(type, name),
-    d_childContentArea(this, static_cast<Element::CachedRectf::DataGenerator>(&ScrolledContainer::getChildContentArea_impl))
+    d_childContentArea(this, static_cast<Element::CachedRectf::DataGenerator>(&ScrolledContainer::getChildContentArea_impl)),
+    d_childCullingEnabled(true)
 {
     setCursorInputPropagationEnabled(true);
     setRiseOnClickEnabled(false);
@@ -65,6 +66,14 @@ void ScrolledContainer::adjustSizeToContent()
 
     const Rectf extents = getChildExtentsArea();
 
+    const Sizef baseSize = getChildBaseSize();
+    d_childExtentAreas.clear();
+    for (size_t i = 0; i < getChildCount(); ++i)
+    {
+        const Window* const child = getChildAtIndex(i);
+        d_childExtentAreas[child] = getChildExtentArea(*child, baseSize);
+    }
+
     USize size = getSize();
     if (isWidthAdjustedToContent())
     {
@@ -95,25 +104,11 @@ Rectf ScrolledContainer::getChildExtentsArea() const
     if (childCount == 0)
         return extents;
 
-    Sizef baseSize = d_pixelSize;
-
-    const auto& parentRect = d_parent->getChildContentArea().get();
-    if (isWidthAdjustedToContent())
-        baseSize.d_width = parentRect.getWidth();
-    if (isHeightAdjustedToContent())
-        baseSize.d_height = parentRect.getHeight();
+    const Sizef baseSize = getChildBaseSize();
 
     for (size_t i = 0; i < childCount; ++i)
     {
-        const Window* const child = getChildAtIndex(i);
-        Rectf area(
-            CoordConverter::asAbsolute(child->getPosition(), baseSize),
-            child->getPixelSize());
-
-        if (child->getHorizontalAlignment() == HorizontalAlignment::Centre)
-            area.setPosition(area.getPosition() - glm::vec2(area.getWidth() * 0.5f - baseSize.d_width * 0.5f, 0.0f));
-        if (child->getVerticalAlignment() == VerticalAlignment::Centre)
-            area.setPosition(area.getPosition() - glm::vec2(0.0f, area.getHeight() * 0.5f - baseSize.d_height * 0.5f));
+        const Rectf area = getChildExtentArea(*getChildAtIndex(i), baseSize);
 
         if (area.d_min.x < extents.d_min.x)
             extents.d_min.x = area.d_min.x;
@@ -132,8 +127,49 @@ Rectf ScrolledContainer::getChildExtentsArea() const
 }
 
 //----------------------------------------------------------------------------//
-bool ScrolledContainer::handleChildAreaChanged(const EventArgs& /*e*/)
+Sizef ScrolledContainer::getChildBaseSize() const
 {
+    Sizef baseSize = d_pixelSize;
+    if (!d_parent)
+        return baseSize;
+
+    const auto& parentRect = d_parent->getChildContentArea().get();
+    if (isWidthAdjustedToContent())
+        baseSize.d_width = parentRect.getWidth();
+    if (isHeightAdjustedToContent())
+        baseSize.d_height = parentRect.getHeight();
+
+    return baseSize;
+}
+
+//----------------------------------------------------------------------------//
+Rectf ScrolledContainer::getChildExtentArea(const Window& child, const Sizef& baseSize)
+{
+    Rectf area(
+        CoordConverter::asAbsolute(child.getPosition(), baseSize),
+        child.getPixelSize());
+
+    if (child.getHorizontalAlignment() == HorizontalAlignment::Centre)
+        area.setPosition(area.getPosition() - glm::vec2(area.getWidth() * 0.5f - baseSize.d_width * 0.5f, 0.0f));
+    if (child.getVerticalAlignment() == VerticalAlignment::Centre)
+        area.setPosition(area.getPosition() - glm::vec2(0.0f, area.getHeight() * 0.5f - baseSize.d_height * 0.5f));
+
+    return area;
+}
+
+//----------------------------------------------------------------------------//
+bool ScrolledContainer::handleChildAreaChanged(const EventArgs& e)
+{
+    // Scrolling moves every child, while the extents only change when a child
+    // moves within the content. Checking a single child keeps scrolling from
+    // recalculating the extents over all children for each of them.
+    const Window* const child =
+        static_cast<const Window*>(static_cast<const ElementEventArgs&>(e).element);
+    const auto it = d_childExtentAreas.find(child);
+    if (it != d_childExtentAreas.end() &&
+        it->second == getChildExtentArea(*child, getChildBaseSize()))
+        return true;
+
     adjustSizeToContent();
     return true;
 }
@@ -164,6 +200,7 @@ void ScrolledContainer::onIsSizeAdjustedToContentChanged(ElementEventArgs& e)
         for (auto& windowToConnection : d_childAreaChangeConnections)
             windowToConnection.second->disconnect();
         d_childAreaChangeConnections.clear();
+        d_childExtentAreas.clear();
     }
 
     Window::onIsSizeAdjustedToContentChanged(e);
@@ -206,6 +243,31 @@ Rectf ScrolledContainer::getInnerRectClipper_impl() const
     return d_parent ? getParent()->getInnerRectClipper() : Window::getInnerRectClipper_impl();
 }
 
+//----------------------------------------------------------------------------//
+void ScrolledContainer::setChildCullingEnabled(bool setting)
+{
+    if (d_childCullingEnabled == setting)
+        return;
+
+    d_childCullingEnabled = setting;
+    invalidate(true);
+}
+
+//----------------------------------------------------------------------------//
+bool ScrolledContainer::isChildInView(const Window& child) const
+{
+    // children not clipped by the pane can be seen anywhere
+    if (!d_childCullingEnabled || !child.isClippedByParent())
+        return true;
+
+    // the clipper of the container is the viewport of the pane
+    const Rectf& viewport = getInnerRectClipper();
+    const Rectf& bounds = child.getUnclippedOuterRect().get();
+
+    return bounds.right() > viewport.left() && bounds.left() < viewport.right() &&
+        bounds.bottom() > viewport.top() && bounds.top() < viewport.bottom();
+}
+
 //----------------------------------------------------------------------------//
 Rectf ScrolledContainer::getHitTestRect_impl() const
 {
@@ -252,6 +314,7 @@ void ScrolledContainer::onChildRemoved(ElementEventArgs& e)
         for (auto it = range.first; it != range.second; ++it)
             it->second->disconnect();
         d_childAreaChangeConnections.erase(range.first, range.second);
+        d_childExtentAreas.erase(static_cast<Window*>(e.element));
 
         // recalculate pane size if auto-sized
         adjustSizeToContent();
@@ -264,6 +327,7 @@ void ScrolledContainer::cleanupChildren(void)
     for (auto& windowToConnection : d_childAreaChangeConnections)
         windowToConnection.second->disconnect();
     d_childAreaChangeConnections.clear();
+    d_childExtentAreas.clear();
 
     Window::cleanupChildren();
 }
@@ -276,6 +340,11 @@ uint8_t ScrolledContainer::handleAreaChanges(bool moved, bool sized)
     // invalidate it in this case which may lead to inactual inner rect cache.
     d_childContentArea.invalidateCache();
     d_unclippedInnerRect.invalidateCache();
+
+    // scrolling may bring culled children back into view, see isChildInView
+    if (d_childCullingEnabled)
+        requestSubtreeUpdates();
+
     return Window::handleAreaChanges(moved, sized);
 }
 
@@ -79,7 +79,8 @@ TabControl::TabControl(const String& type, const String& name)
     d_tabHeight(0, -1), // means 'to be initialized later'
     d_tabPadding(0, 5),
     d_firstTabOffset(0),
-    d_tabPanePos(TabPanePosition::Top)
+    d_tabPanePos(TabPanePosition::Top),
+    d_lazyTabUnloadDelay(0.0f)
 {
 	addTabControlProperties();
 }
@@ -290,6 +291,116 @@ void TabControl::removeTab(unsigned int ID)
     if (auto tab = getTabPane()->findChild(ID))
         removeTab_impl(tab);
 }
+/*************************************************************************
+Add a tab whose contents are created on first selection
+*************************************************************************/
+void TabControl::addLazyTab(const String& name, const String& text, TabContentsFactory factory)
+{
+    Window* placeholder = WindowManager::getSingleton().createWindow("DefaultWindow", name);
+    placeholder->setText(text);
+    placeholder->setSize(USize(cegui_reldim(1.0f), cegui_reldim(1.0f)));
+
+    LazyTab& tab = d_lazyTabs[placeholder];
+    tab.d_factory = std::move(factory);
+    tab.d_contents = nullptr;
+    tab.d_idleTime = 0.0f;
+
+    // the first tab is selected right away and gets loaded then
+    addTab(placeholder);
+}
+
+//----------------------------------------------------------------------------//
+void TabControl::addLazyTab(const String& name, const String& text,
+                            const String& layoutFilename, const String& resourceGroup)
+{
+    addLazyTab(name, text, [layoutFilename, resourceGroup]()
+    {
+        return WindowManager::getSingleton().loadLayoutFromFile(layoutFilename, resourceGroup);
+    });
+}
+
+/*************************************************************************
+Return whether the contents of a tab are created
+*************************************************************************/
+bool TabControl::isTabContentsLoaded(Window* wnd) const
+{
+    // throws if wnd is not a tab
+    getButtonForTabContents(wnd);
+
+    auto it = d_lazyTabs.find(wnd);
+    return it == d_lazyTabs.end() || it->second.d_contents;
+}
+
+/*************************************************************************
+Create the contents of a lazy tab
+*************************************************************************/
+void TabControl::loadTabContents(Window* wnd)
+{
+    auto it = d_lazyTabs.find(wnd);
+    if (it == d_lazyTabs.end() || it->second.d_contents)
+        return;
+
+    it->second.d_idleTime = 0.0f;
+    it->second.d_contents = it->second.d_factory();
+    if (it->second.d_contents)
+        wnd->addChild(it->second.d_contents);
+}
+
+/*************************************************************************
+Destroy the contents of a lazy tab
+*************************************************************************/
+void TabControl::unloadTabContents(Window* wnd)
+{
+    auto it = d_lazyTabs.find(wnd);
+    if (it == d_lazyTabs.end() || !it->second.d_contents || wnd->isVisible())
+        return;
+
+    Window* contents = it->second.d_contents;
+    it->second.d_contents = nullptr;
+    WindowManager::getSingleton().destroyWindow(contents);
+}
+
+/*************************************************************************
+Unload lazy tabs that were not selected for a while
+*************************************************************************/
+void TabControl::updateSelf(float elapsed)
+{
+    Window::updateSelf(elapsed);
+
+    if (d_lazyTabUnloadDelay <= 0.0f)
+        return;
+
+    for (auto& pair : d_lazyTabs)
+    {
+        if (!pair.second.d_contents)
+            continue;
+
+        // only the selected tab is visible
+        if (pair.first->isVisible())
+        {
+            pair.second.d_idleTime = 0.0f;
+            continue;
+        }
+
+        pair.second.d_idleTime += elapsed;
+        if (pair.second.d_idleTime >= d_lazyTabUnloadDelay)
+            unloadTabContents(pair.first);
+    }
+}
+
+/*************************************************************************
+Lazy tabs need time pulses while loaded contents are hidden
+*************************************************************************/
+bool TabControl::isUpdateRequired() const
+{
+    if (d_lazyTabUnloadDelay > 0.0f)
+        for (const auto& pair : d_lazyTabs)
+            if (pair.second.d_contents && !pair.first->isVisible())
+                return true;
+
+    return Window::isUpdateRequired();
+}
+
 /*************************************************************************
 Add tab button
 *************************************************************************/
@@ -371,6 +482,9 @@ void TabControl::selectTab_impl(Window* wnd)
         bool selectThis = (child == wnd);
         // Are we modifying this tab?
         modified = modified || (tb->isSelected() != selectThis);
+        // Lazy tab contents are created once they get shown
+        if (selectThis)
+            loadTabContents(child);
         // Select tab & set visible if this is the window, not otherwise
         tb->setSelected(selectThis);
         child->setVisible(selectThis);
@@ -378,6 +492,9 @@ void TabControl::selectTab_impl(Window* wnd)
     // Trigger event?
     if (modified)
     {
+        // the previously selected lazy tab starts counting its idle time
+        requestUpdates();
+
         WindowEventArgs args(this);
         onSelectionChanged(args);
     }
@@ -810,6 +927,8 @@ void TabControl::removeTab_impl(Window* window)
 
     // delete connection to event we subscribed earlier
     d_eventConnections.erase(window);
+    // the contents of a lazy tab stay in its placeholder
+    d_lazyTabs.erase(window);
     // Was this selected?
     bool reselect = window->isEffectiveVisible();
     // Tab buttons are the 2nd onward children
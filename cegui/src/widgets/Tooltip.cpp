@@ -27,6 +27,7 @@
 #include "CEGUI/widgets/Tooltip.h"
 #include "CEGUI/Image.h"
 #include "CEGUI/GUIContext.h"
+#include <algorithm>
 
 namespace CEGUI
 {
@@ -57,7 +58,9 @@ namespace CEGUI
 
         d_hoverTime(0.4f),
         d_displayTime(7.5f),
-        d_inPositionSelf(false)
+        d_inPositionSelf(false),
+        d_sizeCacheCapacity(32),
+        d_sizeCacheUseCounter(0)
     {
         addTooltipProperties();
 
@@ -139,10 +142,68 @@ namespace CEGUI
 
     void Tooltip::sizeSelf()
     {
+        const String& text = getText();
+        const Font* const font = getActualFont();
+
+        for (auto& entry : d_sizeCache)
+        {
+            if (entry.d_font != font || entry.d_text != text)
+                continue;
+
+            entry.d_lastUsed = ++d_sizeCacheUseCounter;
+
+            // spare the parsing of the text when it gets drawn
+            d_renderedString = entry.d_renderedString;
+            d_renderedStringValid = true;
+
+            setSize(USize(cegui_absdim(entry.d_size.d_width),
+                          cegui_absdim(entry.d_size.d_height)));
+            return;
+        }
+
         Sizef textSize(getTextSize());
 
         setSize(USize(cegui_absdim(textSize.d_width),
                       cegui_absdim(textSize.d_height)));
+
+        if (!d_sizeCacheCapacity)
+            return;
+
+        if (d_sizeCache.size() >= d_sizeCacheCapacity)
+        {
+            // replace the entry that was not used for the longest time
+            auto lru = std::min_element(d_sizeCache.begin(), d_sizeCache.end(),
+                [](const SizeCacheEntry& a, const SizeCacheEntry& b)
+                { return a.d_lastUsed < b.d_lastUsed; });
+            d_sizeCache.erase(lru);
+        }
+
+        SizeCacheEntry entry;
+        entry.d_text = text;
+        entry.d_font = font;
+        entry.d_size = textSize;
+        entry.d_renderedString = getRenderedString();
+        entry.d_lastUsed = ++d_sizeCacheUseCounter;
+        d_sizeCache.push_back(std::move(entry));
+    }
+
+    void Tooltip::setSizeCacheCapacity(size_t capacity)
+    {
+        d_sizeCacheCapacity = capacity;
+
+        // drop the least recently used entries above the capacity
+        while (d_sizeCache.size() > d_sizeCacheCapacity)
+        {
+            auto lru = std::min_element(d_sizeCache.begin(), d_sizeCache.end(),
+                [](const SizeCacheEntry& a, const SizeCacheEntry& b)
+                { return a.d_lastUsed < b.d_lastUsed; });
+            d_sizeCache.erase(lru);
+        }
+    }
+
+    void Tooltip::clearSizeCache()
+    {
+        d_sizeCache.clear();
     }
 
     void Tooltip::setTargetWindow(Window* wnd)
@@ -161,15 +222,22 @@ namespace CEGUI
                 d_target = wnd;
             }
 
-            // set text to that of the tooltip text of the target
-            setText(wnd->getTooltipTextIncludingInheritance());
-
-            // set size and position of the tooltip window.
-            sizeSelf();
-            positionSelf();
+            // set text to that of the tooltip text of the target, a changed
+            // text sizes and positions the tooltip in onTextChanged
+            const String& text = wnd->getTooltipTextIncludingInheritance();
+            if (text != getText())
+            {
+                setText(text);
+            }
+            else
+            {
+                sizeSelf();
+                positionSelf();
+            }
         }
 
         resetTimer();
+        requestUpdates();
 
         if (d_active)
         {
@@ -327,6 +395,12 @@ namespace CEGUI
         }
     }
 
+    bool Tooltip::isUpdateRequired() const
+    {
+        // the hover and display timers run while there is a target
+        return d_active || needTooltip() || Window::isUpdateRequired();
+    }
+
     void Tooltip::addTooltipProperties()
     {
         const String& propertyOrigin = WidgetTypeName;
@@ -340,6 +414,11 @@ namespace CEGUI
             "DisplayTime", "Property to get/set the display timeout value in seconds.  Value is a float.",
             &Tooltip::setDisplayTime, &Tooltip::getDisplayTime, 7.5f
         );
+
+        CEGUI_DEFINE_PROPERTY(Tooltip, size_t,
+            "SizeCacheCapacity", "Property to get/set how many tooltip texts have their size remembered.  Value is \"[uint]\".",
+            &Tooltip::setSizeCacheCapacity, &Tooltip::getSizeCacheCapacity, 32
+        );
     }
 
     void Tooltip::onHidden(WindowEventArgs& e)
@@ -36,7 +36,7 @@
 #        Renderer:
 #                Direct3D9Renderer Direct3D10Renderer Direct3D11Renderer IrrlichtRenderer NullRenderer OgreRenderer OpenGLRenderer OpenGL3Renderer OpenGLESRenderer
 #        ImageCodec:
-#                CoronaImageCodec DevILImageCodec FreeImageImageCodec SILLYImageCodec STBImageCodec TGAImageCodec PVRImageCodec
+#                CoronaImageCodec DevILImageCodec FreeImageImageCodec SILLYImageCodec STBImageCodec TGAImageCodec PVRImageCodec CompressedImageCodec
 #        Parser:
 #                ExpatParser LibXMLParser RapidXMLParser TinyXMLParser XercesParser)
 #        Script:
@@ -561,6 +561,7 @@ if ("${CEGUI_VERSION}" VERSION_GREATER "0.8.0")
     cegui_register_module(IMAGECODEC STBImageCodec ImageCodecModules/STB/ImageCodec.h "")
     cegui_register_module(IMAGECODEC TGAImageCodec ImageCodecModules/TGA/ImageCodec.h "")
     cegui_register_module(IMAGECODEC PVRImageCodec ImageCodecModules/PVR/ImageCodec.h "")
+    cegui_register_module(IMAGECODEC CompressedImageCodec ImageCodecModules/Compressed/ImageCodec.h "")
 
     # Parser
     cegui_register_module(PARSER ExpatParser XMLParserModules/Expat/XMLParser.h "")
@@ -0,0 +1,448 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "Stress.h"
+
+#include "CEGUI/SchemeManager.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/AnimationManager.h"
+#include "CEGUI/Animation.h"
+#include "CEGUI/AnimationInstance.h"
+#include "CEGUI/Affector.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/widgets/DefaultWindow.h"
+#include "CEGUI/widgets/ListWidget.h"
+#include "CEGUI/widgets/PushButton.h"
+#include "CEGUI/widgets/Spinner.h"
+#include "CEGUI/widgets/ToggleButton.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+using namespace CEGUI;
+
+namespace
+{
+const float TileWidth = 160.0f;
+const float TileHeight = 100.0f;
+const float ListHeight = 300.0f;
+const float RowHeight = 30.0f;
+//! Seconds the overlay averages the statistics over.
+const float OverlayRefreshInterval = 0.5f;
+
+const char* const ContentLabels[] =
+{
+    "Frame windows",
+    "List rows",
+    "Animated widgets",
+    "Text widgets",
+    "SVG images"
+};
+
+const double DefaultCounts[] = { 50, 1000, 100, 50, 20 };
+const double MaximumCounts[] = { 5000, 100000, 5000, 5000, 5000 };
+
+const char* const ParagraphText =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod "
+    "tempor incididunt ut labore et dolore magna aliqua. Ut enim ad minim "
+    "veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea "
+    "commodo consequat.";
+
+//----------------------------------------------------------------------------//
+void accumulate(FrameStats& sum, const FrameStats& stats)
+{
+    sum.d_windowsUpdated += stats.d_windowsUpdated;
+    sum.d_windowsRedrawn += stats.d_windowsRedrawn;
+    sum.d_windowsCulled += stats.d_windowsCulled;
+    sum.d_geometryBuffersQueued += stats.d_geometryBuffersQueued;
+    sum.d_verticesUploaded += stats.d_verticesUploaded;
+    sum.d_verticesDrawn += stats.d_verticesDrawn;
+    sum.d_drawCalls += stats.d_drawCalls;
+    sum.d_textureUploads += stats.d_textureUploads;
+    sum.d_stateChanges += stats.d_stateChanges;
+    sum.d_layoutPasses += stats.d_layoutPasses;
+
+    sum.d_updateTime += stats.d_updateTime;
+    sum.d_layoutTime += stats.d_layoutTime;
+    sum.d_geometryTime += stats.d_geometryTime;
+    sum.d_submissionTime += stats.d_submissionTime;
+}
+
+}
+
+/*************************************************************************
+    Constructor.
+*************************************************************************/
+StressSample::StressSample() :
+    Sample(-20)
+{
+    Sample::d_name = "StressSample";
+    Sample::d_credits = "CEGUI Development Team";
+    Sample::d_summary = "Spawns configurable amounts of content and shows the "
+        "frame statistics of the Renderer.";
+    Sample::d_description = "Choose how many frame windows, list rows, animated "
+        "widgets, text widgets and SVG images to spawn and press 'Rebuild'. The "
+        "checkboxes toggle deferred layout, selective updates, drawing on demand, "
+        "content caching and a rendering surface for the content. The overlay "
+        "shows per frame averages of the CPU side cost and of the renderer "
+        "counters; timings of the GPU are not measured.";
+
+    std::fill(d_countSpinners, d_countSpinners + ContentKindCount, nullptr);
+}
+
+/*************************************************************************
+    Sample specific initialisation goes here.
+*************************************************************************/
+bool StressSample::initialise(CEGUI::GUIContext* guiContext)
+{
+    d_usedFiles = CEGUI::String(__FILE__);
+    d_guiContext = guiContext;
+
+    SchemeManager::getSingleton().createFromFile("TaharezLook.scheme");
+    guiContext->getCursor().setDefaultImage("TaharezLook/MouseArrow");
+
+    FontManager::FontList loadedFonts = FontManager::getSingleton().createFromFile("DejaVuSans-10.font");
+    Font* defaultFont = loadedFonts.empty() ? 0 : loadedFonts.front();
+    guiContext->setDefaultFont(defaultFont);
+
+    // The SVG sample may have loaded the imageset already
+    if (!ImageManager::getSingleton().isDefined("SVGSampleImageset/SVGTestImage1"))
+        ImageManager::getSingleton().loadImageset("SVGSampleImageset.imageset");
+
+    WindowManager& winMgr = WindowManager::getSingleton();
+    d_root = winMgr.createWindow("DefaultWindow", "Root");
+    guiContext->setRootWindow(d_root);
+
+    d_contentPane = winMgr.createWindow("TaharezLook/ScrollablePane", "Content");
+    d_contentPane->setArea(
+        UVector2(cegui_reldim(0.25f), cegui_reldim(0.0f)),
+        USize(cegui_reldim(0.75f), cegui_reldim(1.0f)));
+    d_root->addChild(d_contentPane);
+
+    // A single animation fading the widgets out and in, shared by all of them
+    d_pulseAnimation = AnimationManager::getSingleton().createAnimation();
+    d_pulseAnimation->setDuration(2.0f);
+    d_pulseAnimation->setReplayMode(Animation::ReplayMode::Loop);
+    Affector* affector = d_pulseAnimation->createAffector("Alpha", "float");
+    affector->createKeyFrame(0.0f, "1.0");
+    affector->createKeyFrame(1.0f, "0.2", KeyFrame::Progression::QuadraticDecelerating);
+    affector->createKeyFrame(2.0f, "1.0", KeyFrame::Progression::QuadraticAccelerating);
+
+    createControlPanel();
+    createOverlay();
+
+    rebuildContent();
+
+    return true;
+}
+
+/*************************************************************************
+    Cleans up resources allocated in the initialiseSample call.
+*************************************************************************/
+void StressSample::deinitialise()
+{
+    destroyContent();
+
+    if (d_pulseAnimation)
+    {
+        AnimationManager::getSingleton().destroyAnimation(d_pulseAnimation);
+        d_pulseAnimation = nullptr;
+    }
+
+    // The optimisation modes belong to the context, do not leave them behind
+    if (d_guiContext)
+    {
+        d_guiContext->setLayoutDeferred(false);
+        d_guiContext->setSelectiveUpdateEnabled(false);
+        d_guiContext->setDrawOnDemandEnabled(false);
+        d_guiContext->setContentCachingEnabled(false);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void StressSample::update(float timeSinceLastUpdate)
+{
+    accumulate(d_accumulatedStats, System::getSingleton().getRenderer()->getFrameStats());
+    ++d_accumulatedFrames;
+    d_accumulatedTime += timeSinceLastUpdate;
+
+    if (d_accumulatedTime >= OverlayRefreshInterval)
+        refreshOverlay();
+}
+
+//----------------------------------------------------------------------------//
+void StressSample::createControlPanel()
+{
+    WindowManager& winMgr = WindowManager::getSingleton();
+
+    Window* panel = winMgr.createWindow("TaharezLook/FrameWindow", "ControlPanel");
+    panel->setText("Stress");
+    panel->setArea(
+        UVector2(cegui_reldim(0.0f), cegui_reldim(0.0f)),
+        USize(cegui_reldim(0.25f), cegui_reldim(1.0f)));
+    panel->setProperty("SizingEnabled", "false");
+    panel->setProperty("DragMovingEnabled", "false");
+    panel->setProperty("CloseButtonEnabled", "false");
+    d_root->addChild(panel);
+
+    int row = 0;
+    for (int kind = 0; kind < ContentKindCount; ++kind, ++row)
+    {
+        Window* label = winMgr.createWindow("TaharezLook/Label");
+        label->setText(ContentLabels[kind]);
+        label->setProperty("HorzFormatting", "LeftAligned");
+        label->setArea(
+            UVector2(cegui_absdim(8.0f), cegui_absdim(8.0f + row * RowHeight)),
+            USize(cegui_reldim(0.55f), cegui_absdim(RowHeight - 4.0f)));
+        panel->addChild(label);
+
+        Spinner* spinner = static_cast<Spinner*>(winMgr.createWindow("TaharezLook/Spinner"));
+        spinner->setTextInputMode(Spinner::TextInputMode::Integer);
+        spinner->setMinimumValue(0.0);
+        spinner->setMaximumValue(MaximumCounts[kind]);
+        spinner->setStepSize(10.0);
+        spinner->setCurrentValue(DefaultCounts[kind]);
+        spinner->setArea(
+            UVector2(cegui_reldim(0.6f), cegui_absdim(8.0f + row * RowHeight)),
+            USize(cegui_reldim(0.4f) - cegui_absdim(8.0f), cegui_absdim(RowHeight - 4.0f)));
+        panel->addChild(spinner);
+        d_countSpinners[kind] = spinner;
+    }
+
+    Window* rebuild = winMgr.createWindow("TaharezLook/Button");
+    rebuild->setText("Rebuild");
+    rebuild->setArea(
+        UVector2(cegui_absdim(8.0f), cegui_absdim(8.0f + row * RowHeight)),
+        USize(cegui_reldim(1.0f) - cegui_absdim(16.0f), cegui_absdim(RowHeight - 4.0f)));
+    rebuild->subscribeEvent(PushButton::EventClicked,
+        Event::Subscriber(&StressSample::handleRebuildClicked, this));
+    panel->addChild(rebuild);
+    row += 2;
+
+    d_layoutDeferredOption = createOption("Deferred layout", row++, false);
+    d_selectiveUpdateOption = createOption("Selective update", row++, false);
+    d_drawOnDemandOption = createOption("Draw on demand", row++, false);
+    d_contentCachingOption = createOption("Content caching", row++, false);
+    d_renderingSurfaceOption = createOption("Content rendering surface", row++, false);
+}
+
+//----------------------------------------------------------------------------//
+ToggleButton* StressSample::createOption(const String& text, int row, bool selected)
+{
+    ToggleButton* option = static_cast<ToggleButton*>(
+        WindowManager::getSingleton().createWindow("TaharezLook/Checkbox"));
+    option->setText(text);
+    option->setSelected(selected);
+    option->setArea(
+        UVector2(cegui_absdim(8.0f), cegui_absdim(8.0f + row * RowHeight)),
+        USize(cegui_reldim(1.0f) - cegui_absdim(16.0f), cegui_absdim(RowHeight - 4.0f)));
+    option->subscribeEvent(ToggleButton::EventSelectStateChanged,
+        Event::Subscriber(&StressSample::handleOptionChanged, this));
+    d_root->getChild("ControlPanel")->addChild(option);
+
+    return option;
+}
+
+//----------------------------------------------------------------------------//
+void StressSample::createOverlay()
+{
+    d_overlay = WindowManager::getSingleton().createWindow("TaharezLook/StaticText", "Overlay");
+    d_overlay->setArea(
+        UVector2(cegui_reldim(0.6f), cegui_absdim(8.0f)),
+        USize(cegui_reldim(0.4f) - cegui_absdim(8.0f), cegui_absdim(190.0f)));
+    d_overlay->setProperty("HorzFormatting", "LeftAligned");
+    d_overlay->setProperty("VertFormatting", "TopAligned");
+    d_overlay->setAlwaysOnTop(true);
+    d_overlay->setCursorPassThroughEnabled(true);
+    d_root->addChild(d_overlay);
+}
+
+//----------------------------------------------------------------------------//
+void StressSample::rebuildContent()
+{
+    destroyContent();
+
+    WindowManager& winMgr = WindowManager::getSingleton();
+    AnimationManager& animMgr = AnimationManager::getSingleton();
+
+    int counts[ContentKindCount];
+    for (int kind = 0; kind < ContentKindCount; ++kind)
+        counts[kind] = static_cast<int>(d_countSpinners[kind]->getCurrentValue());
+
+    // The list spans the top of the content, the tiles are laid out below it
+    float gridTop = 0.0f;
+    if (counts[ContentListRows] > 0)
+    {
+        ListWidget* list = static_cast<ListWidget*>(winMgr.createWindow("TaharezLook/ListWidget"));
+        list->setArea(
+            UVector2(cegui_absdim(0.0f), cegui_absdim(0.0f)),
+            USize(cegui_reldim(1.0f), cegui_absdim(ListHeight)));
+
+        std::vector<String> texts;
+        texts.reserve(counts[ContentListRows]);
+        for (int i = 0; i < counts[ContentListRows]; ++i)
+            texts.push_back("Row " + PropertyHelper<int>::toString(i));
+        list->addItems(texts);
+
+        d_contentPane->addChild(list);
+        d_spawnedWindows.push_back(list);
+        gridTop = ListHeight;
+    }
+
+    int tile = 0;
+
+    for (int i = 0; i < counts[ContentFrameWindows]; ++i)
+    {
+        Window* wnd = winMgr.createWindow("TaharezLook/FrameWindow");
+        wnd->setText("Window " + PropertyHelper<int>::toString(i));
+        addTile(wnd, tile++, gridTop);
+    }
+
+    for (int i = 0; i < counts[ContentAnimatedWidgets]; ++i)
+    {
+        Window* wnd = winMgr.createWindow("TaharezLook/Button");
+        wnd->setText("Pulse " + PropertyHelper<int>::toString(i));
+        addTile(wnd, tile++, gridTop);
+
+        AnimationInstance* instance = animMgr.instantiateAnimation(d_pulseAnimation);
+        instance->setTargetWindow(wnd);
+        // Spread the phases so the widgets do not all change in step
+        instance->start();
+        instance->setPosition(std::fmod(i * 0.1f, d_pulseAnimation->getDuration()));
+        d_animationInstances.push_back(instance);
+    }
+
+    for (int i = 0; i < counts[ContentTextWidgets]; ++i)
+    {
+        Window* wnd = winMgr.createWindow("TaharezLook/StaticText");
+        wnd->setProperty("HorzFormatting", "WordWrapLeftAligned");
+        wnd->setText(ParagraphText);
+        addTile(wnd, tile++, gridTop);
+    }
+
+    for (int i = 0; i < counts[ContentSvgImages]; ++i)
+    {
+        Window* wnd = winMgr.createWindow("TaharezLook/StaticImage");
+        wnd->setProperty("Image", "SVGSampleImageset/SVGTestImage1");
+        addTile(wnd, tile++, gridTop);
+    }
+
+    applyOptions();
+}
+
+//----------------------------------------------------------------------------//
+void StressSample::destroyContent()
+{
+    AnimationManager& animMgr = AnimationManager::getSingleton();
+    for (AnimationInstance* instance : d_animationInstances)
+        animMgr.destroyAnimationInstance(instance);
+    d_animationInstances.clear();
+
+    WindowManager& winMgr = WindowManager::getSingleton();
+    for (Window* wnd : d_spawnedWindows)
+        winMgr.destroyWindow(wnd);
+    d_spawnedWindows.clear();
+}
+
+//----------------------------------------------------------------------------//
+void StressSample::addTile(Window* wnd, int index, float top)
+{
+    const int columns = std::max(1,
+        static_cast<int>(d_contentPane->getPixelSize().d_width / TileWidth));
+
+    wnd->setArea(
+        UVector2(cegui_absdim((index % columns) * TileWidth),
+                 cegui_absdim(top + (index / columns) * TileHeight)),
+        USize(cegui_absdim(TileWidth - 4.0f), cegui_absdim(TileHeight - 4.0f)));
+
+    d_contentPane->addChild(wnd);
+    d_spawnedWindows.push_back(wnd);
+}
+
+//----------------------------------------------------------------------------//
+void StressSample::applyOptions()
+{
+    d_guiContext->setLayoutDeferred(d_layoutDeferredOption->isSelected());
+    d_guiContext->setSelectiveUpdateEnabled(d_selectiveUpdateOption->isSelected());
+    d_guiContext->setDrawOnDemandEnabled(d_drawOnDemandOption->isSelected());
+    d_guiContext->setContentCachingEnabled(d_contentCachingOption->isSelected());
+    d_contentPane->setUsingAutoRenderingSurface(d_renderingSurfaceOption->isSelected());
+}
+
+//----------------------------------------------------------------------------//
+void StressSample::refreshOverlay()
+{
+    const double frames = std::max(1u, d_accumulatedFrames);
+    const FrameStats& sum = d_accumulatedStats;
+    const double frameTime = d_accumulatedTime / frames;
+
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(2)
+         << System::getSingleton().getRenderer()->getIdentifierString() << "\n"
+         << "Frame: " << frameTime * 1000.0 << " ms ("
+         << std::setprecision(0) << (frameTime > 0.0 ? 1.0 / frameTime : 0.0) << " fps)\n"
+         << "Draw calls: " << sum.d_drawCalls / frames
+         << ", state changes: " << sum.d_stateChanges / frames << "\n"
+         << "Vertices drawn: " << sum.d_verticesDrawn / frames
+         << ", uploaded: " << sum.d_verticesUploaded / frames << "\n"
+         << "Geometry buffers: " << sum.d_geometryBuffersQueued / frames
+         << ", texture uploads: " << sum.d_textureUploads / frames << "\n"
+         << "Windows updated: " << sum.d_windowsUpdated / frames
+         << ", redrawn: " << sum.d_windowsRedrawn / frames
+         << ", culled: " << sum.d_windowsCulled / frames << "\n"
+         << "Layout passes: " << sum.d_layoutPasses / frames << "\n"
+         << std::setprecision(2)
+         << "CPU ms - update: " << sum.d_updateTime * 1000.0 / frames
+         << ", layout: " << sum.d_layoutTime * 1000.0 / frames
+         << ", geometry: " << sum.d_geometryTime * 1000.0 / frames
+         << ", submission: " << sum.d_submissionTime * 1000.0 / frames;
+
+    d_overlay->setText(text.str());
+
+    d_accumulatedStats.reset();
+    d_accumulatedFrames = 0;
+    d_accumulatedTime = 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+bool StressSample::handleRebuildClicked(const EventArgs&)
+{
+    rebuildContent();
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool StressSample::handleOptionChanged(const EventArgs&)
+{
+    applyOptions();
+    return true;
+}
@@ -0,0 +1,121 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _Stress_Sample_h_
+#define _Stress_Sample_h_
+
+#include "Sample.h"
+
+#include "CEGUI/ForwardRefs.h"
+#include "CEGUI/FrameStats.h"
+
+#include <vector>
+
+namespace CEGUI
+{
+    class Spinner;
+    class ToggleButton;
+}
+
+/*!
+\brief
+    Sample spawning configurable numbers of windows, list rows, animated and
+    text heavy widgets and SVG images, with a live overlay of the frame
+    statistics of the Renderer. It is meant for comparing renderer modules
+    and the optimisation modes of GUIContext under load.
+*/
+class StressSample : public Sample
+{
+public:
+    StressSample();
+    virtual ~StressSample() {}
+
+    bool initialise(CEGUI::GUIContext* guiContext) override;
+    void deinitialise() override;
+
+    void update(float timeSinceLastUpdate) override;
+
+private:
+    //! Kinds of content the sample spawns, each with its own count spinner.
+    enum ContentKind
+    {
+        ContentFrameWindows,
+        ContentListRows,
+        ContentAnimatedWidgets,
+        ContentTextWidgets,
+        ContentSvgImages,
+        ContentKindCount
+    };
+
+    //! Creates the panel with the counts and the optimisation switches.
+    void createControlPanel();
+    //! Creates the overlay showing the frame statistics.
+    void createOverlay();
+    //! Creates a checkbox on the control panel at \a row.
+    CEGUI::ToggleButton* createOption(const CEGUI::String& text, int row, bool selected);
+
+    //! Destroys the spawned content and spawns it again with the current counts.
+    void rebuildContent();
+    //! Destroys the spawned content.
+    void destroyContent();
+    //! Positions \a wnd as tile \a index of the grid starting at \a top and adds it.
+    void addTile(CEGUI::Window* wnd, int index, float top);
+
+    //! Applies the state of the optimisation switches.
+    void applyOptions();
+    //! Writes the statistics accumulated since the last refresh to the overlay.
+    void refreshOverlay();
+
+    bool handleRebuildClicked(const CEGUI::EventArgs& args);
+    bool handleOptionChanged(const CEGUI::EventArgs& args);
+
+    CEGUI::GUIContext*      d_guiContext = nullptr;
+    CEGUI::Window*          d_root = nullptr;
+    //! Scrolled area hosting the spawned content.
+    CEGUI::Window*          d_contentPane = nullptr;
+    CEGUI::Window*          d_overlay = nullptr;
+    CEGUI::Spinner*         d_countSpinners[ContentKindCount];
+    //! Windows spawned by the last rebuild.
+    std::vector<CEGUI::Window*> d_spawnedWindows;
+
+    CEGUI::ToggleButton*    d_layoutDeferredOption = nullptr;
+    CEGUI::ToggleButton*    d_selectiveUpdateOption = nullptr;
+    CEGUI::ToggleButton*    d_drawOnDemandOption = nullptr;
+    CEGUI::ToggleButton*    d_contentCachingOption = nullptr;
+    CEGUI::ToggleButton*    d_renderingSurfaceOption = nullptr;
+
+    //! Looping animation played by the animated widgets.
+    CEGUI::Animation*       d_pulseAnimation = nullptr;
+    std::vector<CEGUI::AnimationInstance*> d_animationInstances;
+
+    //! Renderer statistics summed up since the last overlay refresh.
+    CEGUI::FrameStats       d_accumulatedStats;
+    //! Frames and time accumulated since the last overlay refresh.
+    unsigned int            d_accumulatedFrames = 0;
+    float                   d_accumulatedTime = 0.0f;
+};
+
+#endif
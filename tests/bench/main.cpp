@@ -0,0 +1,393 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+/*
+    cegui-bench: draws sample layouts on the NullRenderer for a number of
+    frames and reports the CPU cost of a frame along with the work that would
+    have been submitted to a graphics API. Run with --help for the options.
+*/
+#include "CEGUI/RendererModules/Null/Renderer.h"
+#include "CEGUI/AnimationManager.h"
+#include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/Font.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/SchemeManager.h"
+#include "CEGUI/ScriptModule.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifndef CEGUI_SAMPLE_DATAPATH
+#   define CEGUI_SAMPLE_DATAPATH "../datafiles"
+#endif
+
+namespace
+{
+//! Options given on the command line.
+struct Options
+{
+    std::string d_dataPath;
+    std::vector<std::string> d_schemes;
+    std::vector<std::string> d_layouts;
+    int d_frames = 600;
+    int d_warmupFrames = 30;
+    bool d_invalidate = false;
+    bool d_simulateUpload = false;
+    std::string d_jsonFile;
+    double d_budget = 0.0;
+};
+
+//! Measurements of one layout.
+struct LayoutResult
+{
+    std::string d_layout;
+    double d_meanTime;
+    double d_medianTime;
+    double d_p95Time;
+    double d_maxTime;
+    double d_cpuTime;
+    //! Frame statistics summed over the measured frames.
+    CEGUI::FrameStats d_totals;
+    std::size_t d_textureMemory;
+};
+
+//----------------------------------------------------------------------------//
+void printUsage()
+{
+    std::printf(
+        "Usage: cegui-bench [options] [layout files]\n"
+        "Draws each layout on the NullRenderer and reports the CPU cost of a frame.\n"
+        "\n"
+        "  --data <dir>        directory of the datafiles (default: $CEGUI_SAMPLE_DATAPATH\n"
+        "                      or " CEGUI_SAMPLE_DATAPATH ")\n"
+        "  --scheme <file>     scheme to load, may be repeated (default: the sample schemes)\n"
+        "  --frames <n>        number of measured frames (default: 600)\n"
+        "  --warmup <n>        number of frames drawn before measuring (default: 30)\n"
+        "  --invalidate        invalidate all windows every frame, so that all\n"
+        "                      geometry is generated again\n"
+        "  --simulate-upload   copy vertex and pixel data as an upload would\n"
+        "  --json <file>       write the results as JSON to the file\n"
+        "  --budget <us>       fail if the median frame of a layout takes longer\n");
+}
+
+//----------------------------------------------------------------------------//
+bool parseOptions(int argc, char* argv[], Options& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg(argv[i]);
+        const bool hasValue = i + 1 < argc;
+
+        if (arg == "--help" || arg == "-h")
+            return false;
+        else if (arg == "--invalidate")
+            options.d_invalidate = true;
+        else if (arg == "--simulate-upload")
+            options.d_simulateUpload = true;
+        else if (arg == "--data" && hasValue)
+            options.d_dataPath = argv[++i];
+        else if (arg == "--scheme" && hasValue)
+            options.d_schemes.push_back(argv[++i]);
+        else if (arg == "--frames" && hasValue)
+            options.d_frames = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--warmup" && hasValue)
+            options.d_warmupFrames = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--json" && hasValue)
+            options.d_jsonFile = argv[++i];
+        else if (arg == "--budget" && hasValue)
+            options.d_budget = std::atof(argv[++i]);
+        else if (arg.compare(0, 2, "--") == 0)
+        {
+            std::fprintf(stderr, "Unknown or incomplete option: %s\n", arg.c_str());
+            return false;
+        }
+        else
+            options.d_layouts.push_back(arg);
+    }
+
+    if (options.d_dataPath.empty())
+    {
+        const char* env = std::getenv("CEGUI_SAMPLE_DATAPATH");
+        options.d_dataPath = env ? env : CEGUI_SAMPLE_DATAPATH;
+    }
+
+    if (options.d_schemes.empty())
+    {
+        options.d_schemes.push_back("Generic.scheme");
+        options.d_schemes.push_back("TaharezLook.scheme");
+        options.d_schemes.push_back("VanillaSkin.scheme");
+        options.d_schemes.push_back("WindowsLook.scheme");
+        options.d_schemes.push_back("AlfiskoSkin.scheme");
+        options.d_schemes.push_back("OgreTray.scheme");
+    }
+
+    if (options.d_layouts.empty())
+    {
+        options.d_layouts.push_back("TaharezLookOverview.layout");
+        options.d_layouts.push_back("VanillaLookOverview.layout");
+        options.d_layouts.push_back("VanillaWindows.layout");
+        options.d_layouts.push_back("TabControlSample.layout");
+        options.d_layouts.push_back("TreeSampleTaharez.layout");
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void initialiseResourceGroups(const std::string& dataPath)
+{
+    CEGUI::DefaultResourceProvider* rp = static_cast<CEGUI::DefaultResourceProvider*>(
+        CEGUI::System::getSingleton().getResourceProvider());
+
+    rp->setResourceGroupDirectory("schemes", dataPath + "/schemes/");
+    rp->setResourceGroupDirectory("imagesets", dataPath + "/imagesets/");
+    rp->setResourceGroupDirectory("fonts", dataPath + "/fonts/");
+    rp->setResourceGroupDirectory("layouts", dataPath + "/layouts/");
+    rp->setResourceGroupDirectory("looknfeels", dataPath + "/looknfeel/");
+    rp->setResourceGroupDirectory("lua_scripts", dataPath + "/lua_scripts/");
+    rp->setResourceGroupDirectory("schemas", dataPath + "/xml_schemas/");
+    rp->setResourceGroupDirectory("animations", dataPath + "/animations/");
+
+    CEGUI::ImageManager::setImagesetDefaultResourceGroup("imagesets");
+    CEGUI::Font::setDefaultResourceGroup("fonts");
+    CEGUI::Scheme::setDefaultResourceGroup("schemes");
+    CEGUI::WidgetLookManager::setDefaultResourceGroup("looknfeels");
+    CEGUI::WindowManager::setDefaultResourceGroup("layouts");
+    CEGUI::ScriptModule::setDefaultResourceGroup("lua_scripts");
+    CEGUI::AnimationManager::setDefaultResourceGroup("animations");
+
+    CEGUI::XMLParser* parser = CEGUI::System::getSingleton().getXMLParser();
+    if (parser->isPropertyPresent("SchemaDefaultResourceGroup"))
+        parser->setProperty("SchemaDefaultResourceGroup", "schemas");
+}
+
+//----------------------------------------------------------------------------//
+void addFrameStats(CEGUI::FrameStats& totals, const CEGUI::FrameStats& frame)
+{
+    totals.d_windowsUpdated += frame.d_windowsUpdated;
+    totals.d_windowsRedrawn += frame.d_windowsRedrawn;
+    totals.d_geometryBuffersQueued += frame.d_geometryBuffersQueued;
+    totals.d_verticesUploaded += frame.d_verticesUploaded;
+    totals.d_verticesDrawn += frame.d_verticesDrawn;
+    totals.d_drawCalls += frame.d_drawCalls;
+    totals.d_textureUploads += frame.d_textureUploads;
+    totals.d_stateChanges += frame.d_stateChanges;
+    totals.d_layoutPasses += frame.d_layoutPasses;
+}
+
+//----------------------------------------------------------------------------//
+LayoutResult runLayout(const Options& options, const std::string& layout)
+{
+    typedef std::chrono::steady_clock Clock;
+    const float frameDuration = 1.0f / 60.0f;
+
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::NullRenderer& renderer = static_cast<CEGUI::NullRenderer&>(*system.getRenderer());
+    CEGUI::GUIContext& context = system.createGUIContext(renderer.getDefaultRenderTarget());
+    CEGUI::Window* root = CEGUI::WindowManager::getSingleton().loadLayoutFromFile(layout);
+    context.setRootWindow(root);
+
+    LayoutResult result = LayoutResult();
+    result.d_layout = layout;
+
+    std::vector<double> frameTimes;
+    frameTimes.reserve(options.d_frames);
+    const std::clock_t cpuStart = std::clock();
+
+    for (int frame = -options.d_warmupFrames; frame < options.d_frames; ++frame)
+    {
+        if (options.d_invalidate)
+            root->invalidate(true);
+
+        const Clock::time_point start = Clock::now();
+        system.injectTimePulse(frameDuration);
+        context.injectTimePulse(frameDuration);
+        system.renderAllGUIContexts();
+        const Clock::time_point end = Clock::now();
+
+        if (frame < 0)
+            continue;
+
+        frameTimes.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        addFrameStats(result.d_totals, renderer.getFrameStats());
+    }
+
+    // includes the warm-up, see the header of the report
+    result.d_cpuTime = 1e6 * static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC /
+        (options.d_frames + options.d_warmupFrames);
+    result.d_textureMemory = renderer.getTextureMemoryUsage();
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+    double total = 0.0;
+    for (std::size_t i = 0; i < frameTimes.size(); ++i)
+        total += frameTimes[i];
+    result.d_meanTime = total / frameTimes.size();
+    result.d_medianTime = frameTimes[(frameTimes.size() - 1) / 2];
+    result.d_p95Time = frameTimes[(frameTimes.size() - 1) * 95 / 100];
+    result.d_maxTime = frameTimes.back();
+
+    context.setRootWindow(nullptr);
+    system.destroyGUIContext(context);
+    CEGUI::WindowManager::getSingleton().destroyWindow(root);
+    CEGUI::WindowManager::getSingleton().cleanDeadPool();
+
+    return result;
+}
+
+//----------------------------------------------------------------------------//
+void printResults(const Options& options, const std::vector<LayoutResult>& results)
+{
+    std::printf("%d frames per layout after %d warm-up frames%s%s\n"
+                "times in microseconds per frame, counts per frame\n\n",
+                options.d_frames, options.d_warmupFrames,
+                options.d_invalidate ? ", all windows invalidated every frame" : "",
+                options.d_simulateUpload ? ", uploads simulated" : "");
+    std::printf("%-32s %9s %9s %9s %9s %9s %7s %7s %9s %9s %7s %9s\n",
+                "layout", "median", "mean", "p95", "max", "cpu", "buffers",
+                "draws", "vertices", "uploaded", "states", "tex KiB");
+
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const LayoutResult& r = results[i];
+        const double frames = options.d_frames;
+        std::printf("%-32s %9.1f %9.1f %9.1f %9.1f %9.1f %7.0f %7.0f %9.0f %9.0f %7.0f %9zu\n",
+                    r.d_layout.c_str(), r.d_medianTime, r.d_meanTime, r.d_p95Time,
+                    r.d_maxTime, r.d_cpuTime,
+                    r.d_totals.d_geometryBuffersQueued / frames,
+                    r.d_totals.d_drawCalls / frames,
+                    r.d_totals.d_verticesDrawn / frames,
+                    r.d_totals.d_verticesUploaded / frames,
+                    r.d_totals.d_stateChanges / frames,
+                    r.d_textureMemory / 1024);
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool writeJSON(const Options& options, const std::vector<LayoutResult>& results)
+{
+    std::ofstream out(options.d_jsonFile.c_str());
+    if (!out)
+        return false;
+
+    out << "{\n    \"frames\": " << options.d_frames
+        << ",\n    \"invalidate\": " << (options.d_invalidate ? "true" : "false")
+        << ",\n    \"simulateUpload\": " << (options.d_simulateUpload ? "true" : "false")
+        << ",\n    \"layouts\": [";
+
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const LayoutResult& r = results[i];
+        const double frames = options.d_frames;
+        out << (i ? ",\n" : "\n")
+            << "        { \"name\": \"" << r.d_layout << "\""
+            << ", \"median_us\": " << r.d_medianTime
+            << ", \"mean_us\": " << r.d_meanTime
+            << ", \"p95_us\": " << r.d_p95Time
+            << ", \"max_us\": " << r.d_maxTime
+            << ", \"cpu_us\": " << r.d_cpuTime
+            << ", \"buffers\": " << r.d_totals.d_geometryBuffersQueued / frames
+            << ", \"draw_calls\": " << r.d_totals.d_drawCalls / frames
+            << ", \"vertices_drawn\": " << r.d_totals.d_verticesDrawn / frames
+            << ", \"vertices_uploaded\": " << r.d_totals.d_verticesUploaded / frames
+            << ", \"state_changes\": " << r.d_totals.d_stateChanges / frames
+            << ", \"texture_uploads\": " << r.d_totals.d_textureUploads / frames
+            << ", \"windows_redrawn\": " << r.d_totals.d_windowsRedrawn / frames
+            << ", \"texture_memory\": " << r.d_textureMemory << " }";
+    }
+
+    out << "\n    ]\n}\n";
+    return static_cast<bool>(out);
+}
+
+}
+
+//----------------------------------------------------------------------------//
+int main(int argc, char* argv[])
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage();
+        return 2;
+    }
+
+    CEGUI::NullRenderer& renderer = CEGUI::NullRenderer::bootstrapSystem();
+    renderer.setUploadSimulationEnabled(options.d_simulateUpload);
+    CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(1280.0f, 720.0f));
+
+    int exitCode = 0;
+    try
+    {
+        initialiseResourceGroups(options.d_dataPath);
+
+        for (std::size_t i = 0; i < options.d_schemes.size(); ++i)
+            CEGUI::SchemeManager::getSingleton().createFromFile(options.d_schemes[i]);
+
+        std::vector<LayoutResult> results;
+        for (std::size_t i = 0; i < options.d_layouts.size(); ++i)
+            results.push_back(runLayout(options, options.d_layouts[i]));
+
+        printResults(options, results);
+
+        if (!options.d_jsonFile.empty() && !writeJSON(options, results))
+        {
+            std::fprintf(stderr, "Unable to write %s\n", options.d_jsonFile.c_str());
+            exitCode = 1;
+        }
+
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            if (options.d_budget > 0.0 && results[i].d_medianTime > options.d_budget)
+            {
+                std::fprintf(stderr, "%s: median frame of %.1f us exceeds the budget of %.1f us\n",
+                             results[i].d_layout.c_str(), results[i].d_medianTime, options.d_budget);
+                exitCode = 1;
+            }
+        }
+    }
+    catch (const CEGUI::Exception& e)
+    {
+        std::fprintf(stderr, "CEGUI error: %s\n", e.what());
+        exitCode = 1;
+    }
+
+    CEGUI::NullRenderer::destroySystem();
+    return exitCode;
+}
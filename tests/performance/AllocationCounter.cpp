@@ -0,0 +1,275 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "AllocationCounter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <ostream>
+
+#if !defined(NDEBUG) && defined(__GLIBC__)
+#   define CEGUI_TESTS_RECORD_CALL_SITES
+#   include <execinfo.h>
+#endif
+
+namespace
+{
+std::atomic<bool> s_counting(false);
+std::atomic<std::size_t> s_allocationCount(0);
+std::atomic<std::size_t> s_allocatedBytes(0);
+std::atomic<std::size_t> s_deallocationCount(0);
+
+#ifdef CEGUI_TESTS_RECORD_CALL_SITES
+//! Call stack recorded for allocations; stored in place, as recording must not allocate.
+struct CallSite
+{
+    static const int MaxFrames = 16;
+
+    void* d_frames[MaxFrames];
+    int d_depth;
+    std::size_t d_count;
+    std::size_t d_bytes;
+};
+
+const std::size_t MaxCallSites = 256;
+CallSite s_callSites[MaxCallSites];
+std::size_t s_callSiteCount = 0;
+std::size_t s_droppedCallSites = 0;
+std::mutex s_callSiteMutex;
+
+//----------------------------------------------------------------------------//
+void recordCallSite(std::size_t size)
+{
+    void* frames[CallSite::MaxFrames];
+    const int depth = backtrace(frames, CallSite::MaxFrames);
+
+    std::lock_guard<std::mutex> lock(s_callSiteMutex);
+
+    for (std::size_t i = 0; i < s_callSiteCount; ++i)
+    {
+        CallSite& site = s_callSites[i];
+        if (site.d_depth == depth &&
+            std::memcmp(site.d_frames, frames, depth * sizeof(void*)) == 0)
+        {
+            ++site.d_count;
+            site.d_bytes += size;
+            return;
+        }
+    }
+
+    if (s_callSiteCount == MaxCallSites)
+    {
+        ++s_droppedCallSites;
+        return;
+    }
+
+    CallSite& site = s_callSites[s_callSiteCount++];
+    std::memcpy(site.d_frames, frames, depth * sizeof(void*));
+    site.d_depth = depth;
+    site.d_count = 1;
+    site.d_bytes = size;
+}
+#endif
+
+//----------------------------------------------------------------------------//
+void* countedAllocate(std::size_t size)
+{
+    if (s_counting.load(std::memory_order_relaxed))
+    {
+        ++s_allocationCount;
+        s_allocatedBytes += size;
+#ifdef CEGUI_TESTS_RECORD_CALL_SITES
+        recordCallSite(size);
+#endif
+    }
+
+    return std::malloc(size ? size : 1);
+}
+
+//----------------------------------------------------------------------------//
+void countedFree(void* ptr)
+{
+    if (ptr && s_counting.load(std::memory_order_relaxed))
+        ++s_deallocationCount;
+
+    std::free(ptr);
+}
+
+}
+
+//----------------------------------------------------------------------------//
+void* operator new(std::size_t size)
+{
+    if (void* ptr = countedAllocate(size))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+//----------------------------------------------------------------------------//
+void* operator new[](std::size_t size)
+{
+    if (void* ptr = countedAllocate(size))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+//----------------------------------------------------------------------------//
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return countedAllocate(size);
+}
+
+//----------------------------------------------------------------------------//
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return countedAllocate(size);
+}
+
+//----------------------------------------------------------------------------//
+void operator delete(void* ptr) noexcept
+{
+    countedFree(ptr);
+}
+
+//----------------------------------------------------------------------------//
+void operator delete[](void* ptr) noexcept
+{
+    countedFree(ptr);
+}
+
+//----------------------------------------------------------------------------//
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    countedFree(ptr);
+}
+
+//----------------------------------------------------------------------------//
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    countedFree(ptr);
+}
+
+//----------------------------------------------------------------------------//
+AllocationCounter::AllocationCounter()
+{
+#ifdef CEGUI_TESTS_RECORD_CALL_SITES
+    // the first backtrace loads the unwinder, which must not be counted
+    void* frames[1];
+    backtrace(frames, 1);
+
+    s_callSiteCount = 0;
+    s_droppedCallSites = 0;
+#endif
+
+    s_allocationCount = 0;
+    s_allocatedBytes = 0;
+    s_deallocationCount = 0;
+    s_counting = true;
+}
+
+//----------------------------------------------------------------------------//
+AllocationCounter::~AllocationCounter()
+{
+    s_counting = false;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t AllocationCounter::getAllocationCount() const
+{
+    return s_allocationCount;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t AllocationCounter::getAllocatedBytes() const
+{
+    return s_allocatedBytes;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t AllocationCounter::getDeallocationCount() const
+{
+    return s_deallocationCount;
+}
+
+//----------------------------------------------------------------------------//
+bool AllocationCounter::isRecordingCallSites()
+{
+#ifdef CEGUI_TESTS_RECORD_CALL_SITES
+    return true;
+#else
+    return false;
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void AllocationCounter::writeCallSites(std::ostream& out) const
+{
+#ifdef CEGUI_TESTS_RECORD_CALL_SITES
+    // the output allocates, so copy the sites out and report them uncounted
+    const bool counting = s_counting.exchange(false);
+
+    std::size_t order[MaxCallSites];
+    std::size_t siteCount;
+    {
+        std::lock_guard<std::mutex> lock(s_callSiteMutex);
+        siteCount = s_callSiteCount;
+    }
+
+    for (std::size_t i = 0; i < siteCount; ++i)
+        order[i] = i;
+
+    std::sort(order, order + siteCount, [](std::size_t a, std::size_t b)
+    {
+        return s_callSites[a].d_count > s_callSites[b].d_count;
+    });
+
+    for (std::size_t i = 0; i < siteCount; ++i)
+    {
+        const CallSite& site = s_callSites[order[i]];
+        out << site.d_count << " allocation(s), " << site.d_bytes << " bytes:\n";
+
+        // skip recordCallSite, countedAllocate and operator new
+        const int firstFrame = 3;
+        char** symbols = backtrace_symbols(site.d_frames, site.d_depth);
+        for (int frame = firstFrame; frame < site.d_depth; ++frame)
+            out << "    " << (symbols ? symbols[frame] : "?") << '\n';
+        std::free(symbols);
+    }
+
+    if (s_droppedCallSites)
+        out << s_droppedCallSites << " allocation(s) from further call sites\n";
+
+    s_counting = counting;
+#else
+    (void)out;
+#endif
+}
@@ -0,0 +1,72 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITestsAllocationCounter_h_
+#define _CEGUITestsAllocationCounter_h_
+
+#include <iosfwd>
+#include <cstddef>
+
+/*!
+\brief
+    Counts the heap allocations made through the global operator new, on any
+    thread, for as long as an instance exists.
+
+    The performance test executable replaces the global operator new and
+    delete. Outside of the lifetime of an AllocationCounter they only check a
+    flag before calling malloc and free. In debug builds on glibc the call
+    stacks of the counted allocations are recorded as well and grouped by
+    call site, so that a failing check can tell which code allocated.
+
+    Only one AllocationCounter may exist at a time.
+*/
+class AllocationCounter
+{
+public:
+    //! Starts counting from zero.
+    AllocationCounter();
+    //! Stops counting.
+    ~AllocationCounter();
+
+    //! Returns the number of allocations counted so far.
+    std::size_t getAllocationCount() const;
+    //! Returns the number of bytes allocated so far.
+    std::size_t getAllocatedBytes() const;
+    //! Returns the number of deallocations counted so far.
+    std::size_t getDeallocationCount() const;
+
+    //! Returns whether call sites are recorded by this build.
+    static bool isRecordingCallSites();
+
+    /*!
+    \brief
+        Writes the recorded call stacks of the counted allocations, most
+        frequent first, or nothing if call sites are not recorded.
+    */
+    void writeCallSites(std::ostream& out) const;
+};
+
+#endif
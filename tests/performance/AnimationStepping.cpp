@@ -0,0 +1,104 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "Benchmark.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/Affector.h"
+#include "CEGUI/Animation.h"
+#include "CEGUI/AnimationInstance.h"
+#include "CEGUI/AnimationManager.h"
+#include "CEGUI/UVector.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+/*!
+\brief
+    Steps looping animations of the alpha and the position of many windows
+    by one 60 Hz frame per iteration.
+*/
+class AnimationSteppingBenchmark : public GUIContextBenchmark
+{
+public:
+    AnimationSteppingBenchmark(const std::string& name, int window_count) :
+        GUIContextBenchmark(name, 10, 500)
+    {
+        CEGUI::AnimationManager& animationManager = CEGUI::AnimationManager::getSingleton();
+
+        d_animation = animationManager.createAnimation();
+        d_animation->setReplayMode(CEGUI::Animation::ReplayMode::Loop);
+        d_animation->setDuration(1.f);
+
+        CEGUI::Affector* alpha = d_animation->createAffector("Alpha", "float");
+        alpha->createKeyFrame(0.f, "1");
+        alpha->createKeyFrame(0.5f, "0.25", CEGUI::KeyFrame::Progression::QuadraticDecelerating);
+        alpha->createKeyFrame(1.f, "1", CEGUI::KeyFrame::Progression::QuadraticAccelerating);
+
+        CEGUI::Affector* position = d_animation->createAffector("Position", "UVector2");
+        position->createKeyFrame(0.f, "{{0,0},{0,0}}");
+        position->createKeyFrame(1.f, "{{0.5,0},{0.5,0}}");
+
+        CEGUI::WindowManager& windowManager = CEGUI::WindowManager::getSingleton();
+        CEGUI::Window* root = windowManager.createWindow("DefaultWindow");
+        root->setSize(CEGUI::USize(CEGUI::UDim(1.f, 0.f), CEGUI::UDim(1.f, 0.f)));
+        setRootWindow(root);
+
+        for (int i = 0; i < window_count; ++i)
+        {
+            CEGUI::Window* window = root->createChild("DefaultWindow");
+            window->setSize(CEGUI::USize(CEGUI::UDim(0.1f, 0.f), CEGUI::UDim(0.1f, 0.f)));
+
+            CEGUI::AnimationInstance* instance = animationManager.instantiateAnimation(d_animation);
+            instance->setTargetWindow(window);
+            instance->start(false);
+            // spread the instances over the duration of the animation
+            instance->setPosition(float(i) / window_count);
+        }
+    }
+
+    ~AnimationSteppingBenchmark()
+    {
+        CEGUI::AnimationManager::getSingleton().destroyAnimation(d_animation);
+    }
+
+    virtual void runIteration()
+    {
+        CEGUI::AnimationManager::getSingleton().autoStepInstances(1.f / 60.f);
+    }
+
+    CEGUI::Animation* d_animation;
+};
+
+BOOST_AUTO_TEST_SUITE(AnimationSteppingBenchmarks)
+
+BOOST_AUTO_TEST_CASE(ManyWindows)
+{
+    AnimationSteppingBenchmark test("Animation stepping: 500 windows", 500);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
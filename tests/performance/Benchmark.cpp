@@ -0,0 +1,333 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "Benchmark.h"
+
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#ifndef CEGUI_BENCHMARK_BASELINE
+#   define CEGUI_BENCHMARK_BASELINE "BenchmarkBaseline.json"
+#endif
+
+namespace
+{
+const char* const ResultsFileName = "performance-benchmark-results.json";
+const double DefaultTolerance = 0.25;
+
+//----------------------------------------------------------------------------//
+// nearest-rank percentile of sorted samples
+double getPercentile(const std::vector<double>& sorted, double fraction)
+{
+    const std::size_t rank = static_cast<std::size_t>(
+        std::ceil(fraction * static_cast<double>(sorted.size())));
+    return sorted[std::min(std::max<std::size_t>(rank, 1), sorted.size()) - 1];
+}
+
+//----------------------------------------------------------------------------//
+void writeJSONString(std::ostream& out, const std::string& str)
+{
+    out << '"';
+    for (std::string::const_iterator i = str.begin(); i != str.end(); ++i)
+    {
+        if (*i == '"' || *i == '\\')
+            out << '\\';
+        out << *i;
+    }
+    out << '"';
+}
+
+//----------------------------------------------------------------------------//
+const char* getEnvironment(const char* name)
+{
+    const char* value = std::getenv(name);
+    return (value && *value) ? value : nullptr;
+}
+
+}
+
+//----------------------------------------------------------------------------//
+Benchmark::Benchmark(const std::string& name, std::size_t warmup_iterations,
+                     std::size_t iterations) :
+    d_name(name),
+    d_warmupIterations(warmup_iterations),
+    d_iterations(std::max<std::size_t>(iterations, 1))
+{
+}
+
+//----------------------------------------------------------------------------//
+void Benchmark::execute()
+{
+    std::cout << "Running benchmark " << d_name << "..." << std::endl;
+
+    const BenchmarkResult result = run();
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "  median " << result.d_median << " us, p90 " << result.d_p90
+              << " us, p99 " << result.d_p99 << " us, min " << result.d_min
+              << " us, max " << result.d_max << " us over "
+              << result.d_iterations << " iterations" << std::endl;
+    std::cout.unsetf(std::ios::floatfield);
+
+    BenchmarkReport& report = BenchmarkReport::getSingleton();
+    report.addResult(result);
+
+    std::string message;
+    const bool withinTolerance = report.checkBaseline(result, message);
+    std::cout << "  " << message << std::endl;
+    BOOST_CHECK_MESSAGE(withinTolerance, d_name << ": " << message);
+}
+
+//----------------------------------------------------------------------------//
+BenchmarkResult Benchmark::run()
+{
+    typedef std::chrono::steady_clock Clock;
+
+    for (std::size_t i = 0; i < d_warmupIterations; ++i)
+    {
+        setUpIteration();
+        runIteration();
+        tearDownIteration();
+    }
+
+    std::vector<double> samples;
+    samples.reserve(d_iterations);
+    for (std::size_t i = 0; i < d_iterations; ++i)
+    {
+        setUpIteration();
+        const Clock::time_point start = Clock::now();
+        runIteration();
+        const Clock::time_point end = Clock::now();
+        tearDownIteration();
+
+        samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+
+    return computeResult(d_name, samples);
+}
+
+//----------------------------------------------------------------------------//
+BenchmarkResult Benchmark::computeResult(const std::string& name, std::vector<double> samples)
+{
+    BenchmarkResult result = { name, samples.size(), 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+    if (samples.empty())
+        return result;
+
+    std::sort(samples.begin(), samples.end());
+
+    double total = 0.0;
+    for (std::vector<double>::const_iterator i = samples.begin(); i != samples.end(); ++i)
+        total += *i;
+
+    result.d_min = samples.front();
+    result.d_max = samples.back();
+    result.d_mean = total / static_cast<double>(samples.size());
+    result.d_median = getPercentile(samples, 0.5);
+    result.d_p90 = getPercentile(samples, 0.9);
+    result.d_p99 = getPercentile(samples, 0.99);
+    return result;
+}
+
+//----------------------------------------------------------------------------//
+GUIContextBenchmark::GUIContextBenchmark(const std::string& name,
+                                         std::size_t warmup_iterations,
+                                         std::size_t iterations) :
+    Benchmark(name, warmup_iterations, iterations),
+    d_root(nullptr)
+{
+    // the display of the NullRenderer is empty by default, which culls everything
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    system.notifyDisplaySizeChanged(CEGUI::Sizef(1280, 720));
+    d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+    d_context->setDefaultFont("DejaVuSans-12");
+}
+
+//----------------------------------------------------------------------------//
+GUIContextBenchmark::~GUIContextBenchmark()
+{
+    d_context->setRootWindow(nullptr);
+    CEGUI::System::getSingleton().destroyGUIContext(*d_context);
+
+    if (d_root)
+    {
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+        CEGUI::WindowManager::getSingleton().cleanDeadPool();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GUIContextBenchmark::setRootWindow(CEGUI::Window* root)
+{
+    d_root = root;
+    d_context->setRootWindow(root);
+}
+
+//----------------------------------------------------------------------------//
+void GUIContextBenchmark::loadRootLayout(const CEGUI::String& filename)
+{
+    setRootWindow(CEGUI::WindowManager::getSingleton().loadLayoutFromFile(filename));
+}
+
+//----------------------------------------------------------------------------//
+void GUIContextBenchmark::renderFrame()
+{
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    renderer->beginRendering();
+    d_context->draw();
+    renderer->endRendering();
+}
+
+//----------------------------------------------------------------------------//
+BenchmarkReport& BenchmarkReport::getSingleton()
+{
+    static BenchmarkReport report;
+    return report;
+}
+
+//----------------------------------------------------------------------------//
+void BenchmarkReport::addResult(const BenchmarkResult& result)
+{
+    d_results.push_back(result);
+
+    // rewritten after each benchmark so that an aborted run still leaves the
+    // results of the completed ones
+    std::ofstream out(ResultsFileName, std::ofstream::out | std::ofstream::trunc);
+    writeResults(out, d_results);
+}
+
+//----------------------------------------------------------------------------//
+bool BenchmarkReport::checkBaseline(const BenchmarkResult& result, std::string& message)
+{
+    loadBaseline();
+
+    std::vector<BaselineEntry>::const_iterator entry = d_baseline.begin();
+    while (entry != d_baseline.end() && entry->d_name != result.d_name)
+        ++entry;
+
+    // a benchmark without a baseline would never detect a regression
+    if (entry == d_baseline.end() || entry->d_median <= 0.0)
+    {
+        message = "no baseline entry, add the result to the baseline file";
+        return false;
+    }
+
+    double tolerance = entry->d_tolerance;
+    if (const char* env = getEnvironment("CEGUI_BENCHMARK_TOLERANCE"))
+        tolerance = std::atof(env);
+
+    const double change = result.d_median / entry->d_median - 1.0;
+
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(1) << (change >= 0.0 ? "+" : "")
+           << change * 100.0 << "% against the baseline median of "
+           << std::setprecision(2) << entry->d_median << " us (tolerance "
+           << std::setprecision(0) << tolerance * 100.0 << "%)";
+    message = stream.str();
+
+    return change <= tolerance;
+}
+
+//----------------------------------------------------------------------------//
+void BenchmarkReport::writeResults(std::ostream& out, const std::vector<BenchmarkResult>& results)
+{
+    out << std::fixed << std::setprecision(3);
+    out << "{\n    \"benchmarks\": [";
+
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const BenchmarkResult& result = results[i];
+
+        out << (i ? ",\n" : "\n") << "        { \"name\": ";
+        writeJSONString(out, result.d_name);
+        out << ", \"iterations\": " << result.d_iterations
+            << ", \"min_us\": " << result.d_min
+            << ", \"mean_us\": " << result.d_mean
+            << ", \"median_us\": " << result.d_median
+            << ", \"p90_us\": " << result.d_p90
+            << ", \"p99_us\": " << result.d_p99
+            << ", \"max_us\": " << result.d_max << " }";
+    }
+
+    out << (results.empty() ? "]\n}\n" : "\n    ]\n}\n");
+}
+
+//----------------------------------------------------------------------------//
+void BenchmarkReport::loadBaseline()
+{
+    if (d_baselineLoaded)
+        return;
+    d_baselineLoaded = true;
+
+    const char* env = getEnvironment("CEGUI_BENCHMARK_BASELINE");
+    const std::string fileName(env ? env : CEGUI_BENCHMARK_BASELINE);
+
+    std::ifstream in(fileName.c_str());
+    if (!in)
+    {
+        std::cout << "Benchmark baseline " << fileName << " not found" << std::endl;
+        return;
+    }
+
+    boost::property_tree::ptree tree;
+    try
+    {
+        boost::property_tree::read_json(in, tree);
+    }
+    catch (const boost::property_tree::json_parser_error& e)
+    {
+        BOOST_ERROR("Invalid benchmark baseline " << fileName << ": " << e.what());
+        return;
+    }
+
+    const double tolerance = tree.get("tolerance", DefaultTolerance);
+
+    const boost::property_tree::ptree empty;
+    const boost::property_tree::ptree& benchmarks = tree.get_child("benchmarks", empty);
+    for (boost::property_tree::ptree::const_iterator i = benchmarks.begin(); i != benchmarks.end(); ++i)
+    {
+        BaselineEntry entry;
+        entry.d_name = i->second.get("name", std::string());
+        entry.d_median = i->second.get("median_us", 0.0);
+        entry.d_tolerance = i->second.get("tolerance", tolerance);
+        d_baseline.push_back(entry);
+    }
+}
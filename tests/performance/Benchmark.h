@@ -0,0 +1,175 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITestsBenchmark_h_
+#define _CEGUITestsBenchmark_h_
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+/*!
+\brief
+    Timing statistics of a benchmark, in microseconds per iteration.
+*/
+struct BenchmarkResult
+{
+    std::string d_name;
+    std::size_t d_iterations;
+    double d_min;
+    double d_mean;
+    double d_median;
+    double d_p90;
+    double d_p99;
+    double d_max;
+};
+
+/*!
+\brief
+    General structure of a benchmark.
+
+    Unlike PerformanceTest, which measures a single run, a benchmark first runs
+    a number of untimed warm-up iterations, so that caches, pools and lazily
+    created resources are in place, and then times each of the measured
+    iterations separately. The percentiles of the iteration times are printed,
+    written to performance-benchmark-results.json and compared against the
+    committed baseline; a median slower than the baseline by more than the
+    tolerance fails the test case.
+
+    Work that must not be measured, like destroying what an iteration created,
+    goes to setUpIteration and tearDownIteration.
+*/
+class Benchmark
+{
+public:
+    Benchmark(const std::string& name, std::size_t warmup_iterations, std::size_t iterations);
+    virtual ~Benchmark() {}
+
+    //! Runs the benchmark, reports the result and checks it against the baseline.
+    void execute();
+
+    //! Runs the warm-up and the measured iterations and returns their statistics.
+    BenchmarkResult run();
+
+    //! Computes the statistics of the given iteration times in microseconds.
+    static BenchmarkResult computeResult(const std::string& name, std::vector<double> samples);
+
+protected:
+    virtual void setUpIteration() {}
+    virtual void runIteration() = 0;
+    virtual void tearDownIteration() {}
+
+    std::string d_name;
+    std::size_t d_warmupIterations;
+    std::size_t d_iterations;
+};
+
+namespace CEGUI
+{
+class GUIContext;
+class String;
+class Window;
+}
+
+/*!
+\brief
+    Benchmark working on a GUIContext of its own, which draws to the default
+    render target of the renderer and is destroyed along with its root window.
+*/
+class GUIContextBenchmark : public Benchmark
+{
+public:
+    GUIContextBenchmark(const std::string& name, std::size_t warmup_iterations, std::size_t iterations);
+    virtual ~GUIContextBenchmark();
+
+    //! Sets the root window of the context, which is then owned by the benchmark.
+    void setRootWindow(CEGUI::Window* root);
+    //! Loads a layout file and makes it the root window of the context.
+    void loadRootLayout(const CEGUI::String& filename);
+    //! Draws the context between beginRendering and endRendering of the renderer.
+    void renderFrame();
+
+    CEGUI::GUIContext* d_context;
+    CEGUI::Window* d_root;
+};
+
+/*!
+\brief
+    Collects the results of all the benchmarks run by the executable and
+    compares them with the baseline.
+
+    The baseline is a JSON file in the same format as the results file, with
+    an optional "tolerance" giving the allowed relative slowdown of the median
+    (0.25 by default), which a benchmark entry may override with a "tolerance"
+    of its own. It is read from the file named by the CEGUI_BENCHMARK_BASELINE
+    environment variable, or BenchmarkBaseline.json next to the sources.
+    The CEGUI_BENCHMARK_TOLERANCE environment variable overrides the tolerance
+    of every benchmark, for running on noisy machines. A benchmark missing
+    from the baseline fails as well.
+*/
+class BenchmarkReport
+{
+public:
+    static BenchmarkReport& getSingleton();
+
+    //! Adds a result and rewrites performance-benchmark-results.json.
+    void addResult(const BenchmarkResult& result);
+
+    /*!
+    \brief
+        Compares a result with its baseline.
+
+    \param message
+        Set to a description of the comparison.
+
+    \return
+        false if the median of \a result is slower than the baseline by more
+        than the tolerance or there is no baseline for it, true otherwise.
+    */
+    bool checkBaseline(const BenchmarkResult& result, std::string& message);
+
+    //! Writes the results in the JSON format of the results and baseline files.
+    static void writeResults(std::ostream& out, const std::vector<BenchmarkResult>& results);
+
+private:
+    struct BaselineEntry
+    {
+        std::string d_name;
+        double d_median;
+        double d_tolerance;
+    };
+
+    BenchmarkReport() : d_baselineLoaded(false) {}
+
+    void loadBaseline();
+
+    std::vector<BenchmarkResult> d_results;
+    std::vector<BaselineEntry> d_baseline;
+    bool d_baselineLoaded;
+};
+
+#endif
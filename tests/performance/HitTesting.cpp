@@ -0,0 +1,105 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "Benchmark.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/SchemeManager.h"
+#include "CEGUI/UVector.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+/*!
+\brief
+    Finds the target child of the root window for a grid of points covering
+    the whole context, as GUIContext does for every cursor move.
+*/
+class HitTestingBenchmark : public GUIContextBenchmark
+{
+public:
+    explicit HitTestingBenchmark(const std::string& name) :
+        GUIContextBenchmark(name, 5, 200),
+        d_hitCount(0)
+    {
+    }
+
+    virtual void runIteration()
+    {
+        const int gridSize = 32;
+        const CEGUI::Sizef& size = d_context->getSurfaceSize();
+        const CEGUI::Window* root = d_context->getRootWindow();
+
+        for (int y = 0; y < gridSize; ++y)
+        {
+            for (int x = 0; x < gridSize; ++x)
+            {
+                const glm::vec2 point((x + 0.5f) * size.d_width / gridSize,
+                                      (y + 0.5f) * size.d_height / gridSize);
+                if (root->getTargetChildAtPosition(point))
+                    ++d_hitCount;
+            }
+        }
+    }
+
+    //! Keeps the results of the queries in use.
+    std::size_t d_hitCount;
+};
+
+BOOST_AUTO_TEST_SUITE(HitTestingBenchmarks)
+
+BOOST_AUTO_TEST_CASE(Layout)
+{
+    HitTestingBenchmark test("Hit testing: TaharezLookOverview");
+    CEGUI::SchemeManager::getSingleton().createFromFile("Generic.scheme");
+    test.loadRootLayout("TaharezLookOverview.layout");
+    test.d_context->updateLayout();
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(WindowGrid)
+{
+    HitTestingBenchmark test("Hit testing: 20x20 windows");
+
+    CEGUI::WindowManager& windowManager = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* root = windowManager.createWindow("DefaultWindow");
+    root->setSize(CEGUI::USize(CEGUI::UDim(1.f, 0.f), CEGUI::UDim(1.f, 0.f)));
+    for (int y = 0; y < 20; ++y)
+    {
+        for (int x = 0; x < 20; ++x)
+        {
+            CEGUI::Window* window = root->createChild("DefaultWindow");
+            window->setPosition(CEGUI::UVector2(CEGUI::UDim(x / 20.f, 0.f), CEGUI::UDim(y / 20.f, 0.f)));
+            window->setSize(CEGUI::USize(CEGUI::UDim(0.04f, 0.f), CEGUI::UDim(0.04f, 0.f)));
+        }
+    }
+    test.setRootWindow(root);
+    test.d_context->updateLayout();
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
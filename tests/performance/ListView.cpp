@@ -89,7 +89,7 @@ public:
 
     virtual void sortItems()
     {
-        d_window->setSortMode(VSM_Ascending);
+        d_window->setSortMode(ViewSortMode::Ascending);
     }
 
     StandardItemModel d_model;
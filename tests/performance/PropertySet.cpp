@@ -27,7 +27,9 @@
 #include <boost/test/unit_test.hpp>
 
 #include "PerformanceTest.h"
+#include "CEGUI/ColourRect.h"
 #include "CEGUI/PropertySet.h"
+#include "CEGUI/PropertyHelper.h"
 #include <sstream>
 
 static const CEGUI::String PROPERTY_NAME("ExplicitlyAddedTestProperty");
@@ -70,6 +72,37 @@ public:
     CEGUI::PropertySet& d_propertySet;
 };
 
+class PropertyHelperConversionPerformanceTest : public PerformanceTest
+{
+public:
+    PropertyHelperConversionPerformanceTest(const CEGUI::String& test_name):
+        PerformanceTest(test_name)
+    {}
+
+    virtual void doTest()
+    {
+        const CEGUI::String urect("{{0.25,-8},{0,12.5},{1,0},{0.75,100}}");
+        const CEGUI::String colours("tl:FFFFFFFF tr:FF7F7F7F bl:80000000 br:00FF00FF");
+        float sum = 0.0f;
+
+        for (unsigned int i = 0; i < 1000000; ++i)
+        {
+            const CEGUI::URect rect = CEGUI::PropertyHelper<CEGUI::URect>::fromString(urect);
+            sum += rect.d_min.d_x.d_scale;
+            sum += static_cast<float>(CEGUI::PropertyHelper<CEGUI::URect>::toString(rect).length());
+
+            const CEGUI::ColourRect colourRect = CEGUI::PropertyHelper<CEGUI::ColourRect>::fromString(colours);
+            sum += static_cast<float>(CEGUI::PropertyHelper<CEGUI::ColourRect>::toString(colourRect).length());
+
+            sum += static_cast<float>(CEGUI::PropertyHelper<float>::toString(i * 0.125f).length());
+            sum += static_cast<float>(CEGUI::PropertyHelper<std::int32_t>::toString(static_cast<std::int32_t>(i)).length());
+        }
+
+        // keep the conversions from being optimised away
+        BOOST_CHECK(sum > 0.0f);
+    }
+};
+
 class TestingPropertySet : public CEGUI::PropertySet
 {
     public:
@@ -117,4 +150,10 @@ BOOST_AUTO_TEST_CASE(TypedSetTest)
     test.execute();
 }
 
+BOOST_AUTO_TEST_CASE(ConversionTest)
+{
+    PropertyHelperConversionPerformanceTest test("PropertyHelper conversion test");
+    test.execute();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
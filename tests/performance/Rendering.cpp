@@ -0,0 +1,146 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "Benchmark.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/SchemeManager.h"
+#include "CEGUI/UVector.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+/*!
+\brief
+    Draws a screen of widgets of one look, invalidating all of them before
+    each iteration so that their Falagard imagery is rendered again.
+*/
+class FalagardRenderingBenchmark : public GUIContextBenchmark
+{
+public:
+    FalagardRenderingBenchmark(const std::string& name, const CEGUI::String& scheme,
+                               const CEGUI::String& look) :
+        GUIContextBenchmark(name, 3, 100)
+    {
+        static const char* const widgetTypes[] =
+        {
+            "Button", "Checkbox", "RadioButton", "Editbox", "MultiLineEditbox",
+            "ProgressBar", "HorizontalScrollbar", "StaticText", "StaticImage",
+            "Combobox", "Label", "FrameWindow"
+        };
+        const int typeCount = sizeof(widgetTypes) / sizeof(widgetTypes[0]);
+        const int rowCount = 8;
+
+        CEGUI::SchemeManager::getSingleton().createFromFile(scheme + ".scheme");
+
+        CEGUI::WindowManager& windowManager = CEGUI::WindowManager::getSingleton();
+        CEGUI::Window* root = windowManager.createWindow("DefaultWindow");
+        root->setSize(CEGUI::USize(CEGUI::UDim(1.f, 0.f), CEGUI::UDim(1.f, 0.f)));
+        setRootWindow(root);
+
+        for (int row = 0; row < rowCount; ++row)
+        {
+            for (int column = 0; column < typeCount; ++column)
+            {
+                CEGUI::Window* widget = windowManager.createWindow(look + "/" + widgetTypes[column]);
+                widget->setPosition(CEGUI::UVector2(CEGUI::UDim(float(column) / typeCount, 0.f),
+                                                    CEGUI::UDim(float(row) / rowCount, 0.f)));
+                widget->setSize(CEGUI::USize(CEGUI::UDim(1.f / typeCount, -2.f),
+                                             CEGUI::UDim(1.f / rowCount, -2.f)));
+                widget->setText("Benchmark");
+                root->addChild(widget);
+            }
+        }
+
+        renderFrame();
+    }
+
+    virtual void setUpIteration()
+    {
+        d_root->invalidate(true);
+    }
+
+    virtual void runIteration()
+    {
+        renderFrame();
+    }
+};
+
+/*!
+\brief
+    Draws an unchanged layout, so that only the queuing and the submission of
+    the cached geometry to the renderer are measured.
+*/
+class RenderSubmissionBenchmark : public GUIContextBenchmark
+{
+public:
+    RenderSubmissionBenchmark(const std::string& name, const CEGUI::String& layout) :
+        GUIContextBenchmark(name, 5, 500)
+    {
+        CEGUI::SchemeManager::getSingleton().createFromFile("Generic.scheme");
+        loadRootLayout(layout);
+        renderFrame();
+    }
+
+    virtual void setUpIteration()
+    {
+        d_context->markAsDirty();
+    }
+
+    virtual void runIteration()
+    {
+        renderFrame();
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(RenderingBenchmarks)
+
+BOOST_AUTO_TEST_CASE(TaharezLookImagery)
+{
+    FalagardRenderingBenchmark test("Falagard render: TaharezLook", "TaharezLook", "TaharezLook");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(VanillaImagery)
+{
+    FalagardRenderingBenchmark test("Falagard render: Vanilla", "VanillaSkin", "Vanilla");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(WindowsLookImagery)
+{
+    FalagardRenderingBenchmark test("Falagard render: WindowsLook", "WindowsLook", "WindowsLook");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(Submission)
+{
+    RenderSubmissionBenchmark test("Render submission: TaharezLookOverview", "TaharezLookOverview.layout");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,150 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "Benchmark.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/SchemeManager.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+
+/*!
+\brief
+    Creates the windows of a layout file, destroying them after each iteration.
+    Unless \a cached, the compiled layouts kept by the WindowManager are
+    dropped first so that every iteration parses the file.
+*/
+class LayoutLoadingBenchmark : public Benchmark
+{
+public:
+    LayoutLoadingBenchmark(const std::string& name, const CEGUI::String& layout, bool cached) :
+        Benchmark(name, 3, 50),
+        d_layout(layout),
+        d_cached(cached),
+        d_window(nullptr)
+    {
+        CEGUI::SchemeManager::getSingleton().createFromFile("Generic.scheme");
+        CEGUI::SchemeManager::getSingleton().createFromFile("VanillaSkin.scheme");
+    }
+
+    virtual void setUpIteration()
+    {
+        if (!d_cached)
+            CEGUI::WindowManager::getSingleton().clearLayoutCache();
+    }
+
+    virtual void runIteration()
+    {
+        d_window = CEGUI::WindowManager::getSingleton().loadLayoutFromFile(d_layout);
+    }
+
+    virtual void tearDownIteration()
+    {
+        CEGUI::WindowManager& windowManager = CEGUI::WindowManager::getSingleton();
+        windowManager.destroyWindow(d_window);
+        windowManager.cleanDeadPool();
+        d_window = nullptr;
+    }
+
+    CEGUI::String d_layout;
+    bool d_cached;
+    CEGUI::Window* d_window;
+};
+
+/*!
+\brief
+    Loads the imageset and the look'n'feel of a scheme.
+
+    A scheme can't be destroyed and loaded again while other schemes are in
+    use, because destroying it unregisters the window factories they share.
+    So the scheme is loaded once and every iteration repeats the loading of
+    its imageset, image decoding included, and the parsing of its widget
+    looks, which is where the time of loading a scheme goes.
+*/
+class SchemeLoadingBenchmark : public Benchmark
+{
+public:
+    SchemeLoadingBenchmark(const std::string& name, const CEGUI::String& scheme,
+                           const CEGUI::String& imageset, const CEGUI::String& look_n_feel) :
+        Benchmark(name, 2, 20),
+        d_imageset(imageset),
+        d_lookNFeel(look_n_feel)
+    {
+        CEGUI::SchemeManager::getSingleton().createFromFile(scheme + ".scheme");
+    }
+
+    virtual void setUpIteration()
+    {
+        CEGUI::ImageManager::getSingleton().destroyImageCollection(d_imageset, true);
+    }
+
+    virtual void runIteration()
+    {
+        CEGUI::ImageManager::getSingleton().loadImageset(d_imageset + ".imageset");
+        CEGUI::WidgetLookManager::getSingleton().parseLookNFeelSpecificationFromFile(
+            d_lookNFeel + ".looknfeel");
+    }
+
+    CEGUI::String d_imageset;
+    CEGUI::String d_lookNFeel;
+};
+
+BOOST_AUTO_TEST_SUITE(ResourceLoadingBenchmarks)
+
+BOOST_AUTO_TEST_CASE(TaharezLookLayout)
+{
+    LayoutLoadingBenchmark test("Layout load: TaharezLookOverview", "TaharezLookOverview.layout", false);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(TaharezLookLayoutCached)
+{
+    LayoutLoadingBenchmark test("Layout load: TaharezLookOverview (cached)", "TaharezLookOverview.layout", true);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(VanillaLayout)
+{
+    LayoutLoadingBenchmark test("Layout load: VanillaLookOverview", "VanillaLookOverview.layout", false);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(WindowsLookScheme)
+{
+    SchemeLoadingBenchmark test("Scheme load: WindowsLook", "WindowsLook", "WindowsLook", "WindowsLook");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(AlfiskoSkinScheme)
+{
+    SchemeLoadingBenchmark test("Scheme load: AlfiskoSkin", "AlfiskoSkin", "AlfiskoSkin", "AlfiskoSkin");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,134 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "PerformanceTest.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Window.h"
+
+/*!
+\brief
+    Adjusts the width of a word wrapped StaticText to many texts and heights,
+    and prints how many times the window was resized to find the widths. Each
+    resize reformats the text, which is what dominates the running time.
+*/
+class StaticTextSizeAdjustmentPerformanceTest : public PerformanceTest
+{
+public:
+    StaticTextSizeAdjustmentPerformanceTest(const CEGUI::String& test_name, bool use_bisection) :
+        PerformanceTest(test_name),
+        d_useBisection(use_bisection),
+        d_resizeCount(0)
+    {
+        d_window = CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/StaticText");
+        d_window->setFont("DejaVuSans-12");
+        d_window->setProperty("HorzFormatting", "WordWrapLeftAligned");
+
+        CEGUI::System& system = CEGUI::System::getSingleton();
+        // the native resolution of the font, so that it's not scaled
+        system.notifyDisplaySizeChanged(CEGUI::Sizef(1280, 720));
+        d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+        d_context->setRootWindow(d_window);
+
+        d_window->subscribeEvent(CEGUI::Element::EventSized, [this]() { ++d_resizeCount; });
+    }
+
+    ~StaticTextSizeAdjustmentPerformanceTest()
+    {
+        d_context->setRootWindow(nullptr);
+        CEGUI::System::getSingleton().destroyGUIContext(*d_context);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_window);
+    }
+
+    virtual void doTest()
+    {
+        const CEGUI::String text(
+            "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do "
+            "eiusmod tempor incididunt ut labore et dolore magna aliqua. Ut enim "
+            "ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut "
+            "aliquip ex ea commodo consequat.");
+
+        unsigned int adjustments = 0;
+        for (unsigned int i = 0; i < 20; ++i)
+        {
+            for (std::size_t length = 20; length <= text.length(); length += 20)
+            {
+                d_window->setText(text.substr(0, length));
+                for (float height = 60.f; height <= 300.f; height += 30.f)
+                {
+                    d_window->setSize(CEGUI::USize(CEGUI::UDim(0.f, 2000.f), CEGUI::UDim(0.f, height)));
+                    adjustWidth(height);
+                    ++adjustments;
+                }
+            }
+        }
+
+        std::cout << d_testName << ": " << d_resizeCount << " resizes for "
+                  << adjustments << " adjustments" << std::endl;
+    }
+
+    void adjustWidth(float height)
+    {
+        if (d_useBisection)
+        {
+            // what FalagardStaticText did before it used the text extents
+            const CEGUI::Sizef size(d_window->getSizeAdjustedToContent_bisection(
+                CEGUI::USize(CEGUI::UDim(1.f, 0.f), CEGUI::UDim(0.f, height)), -1.f, 2000.f));
+            d_window->setSize(CEGUI::USize(CEGUI::UDim(0.f, size.d_width), CEGUI::UDim(0.f, height)));
+        }
+        else
+        {
+            // enabling the adjustment adjusts the size right away
+            d_window->setAdjustWidthToContent(true);
+            d_window->setAdjustWidthToContent(false);
+        }
+    }
+
+    bool d_useBisection;
+    unsigned int d_resizeCount;
+    CEGUI::GUIContext* d_context;
+    CEGUI::Window* d_window;
+};
+
+BOOST_AUTO_TEST_SUITE(StaticTextPerformance)
+
+BOOST_AUTO_TEST_CASE(AdjustWidthByBisection)
+{
+    StaticTextSizeAdjustmentPerformanceTest test("StaticText width adjustment by bisection", true);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(AdjustWidth)
+{
+    StaticTextSizeAdjustmentPerformanceTest test("StaticText width adjustment", false);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,103 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "AllocationCounter.h"
+#include "Benchmark.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/SchemeManager.h"
+
+#include <sstream>
+
+/*!
+\brief
+    Runs frames of an unchanging layout, injecting a time pulse and drawing
+    the context, and counts the heap allocations of the frames following the
+    warm-up.
+
+    The frames of an idle UI must not touch the heap once caches, pools and
+    lazily created resources are in place.
+*/
+class SteadyStateFrames : public GUIContextBenchmark
+{
+public:
+    SteadyStateFrames(const char* scheme, const char* layout) :
+        GUIContextBenchmark("Steady state: " + std::string(layout), 10, 50)
+    {
+        CEGUI::SchemeManager::getSingleton().createFromFile(scheme);
+        loadRootLayout(layout);
+    }
+
+    virtual void runIteration()
+    {
+        d_context->injectTimePulse(1.0f / 60.0f);
+        renderFrame();
+    }
+
+    //! Runs the warm-up frames, then checks that the measured frames do not allocate.
+    void checkNoAllocations()
+    {
+        for (std::size_t i = 0; i < d_warmupIterations; ++i)
+            runIteration();
+
+        std::ostringstream callSites;
+        std::size_t allocations;
+        std::size_t bytes;
+        {
+            AllocationCounter counter;
+
+            for (std::size_t i = 0; i < d_iterations; ++i)
+                runIteration();
+
+            allocations = counter.getAllocationCount();
+            bytes = counter.getAllocatedBytes();
+            if (allocations)
+                counter.writeCallSites(callSites);
+        }
+
+        BOOST_CHECK_MESSAGE(allocations == 0,
+            d_name << ": " << allocations << " allocation(s) of " << bytes <<
+            " bytes in " << d_iterations << " frames\n" << callSites.str());
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(SteadyStateAllocations)
+
+BOOST_AUTO_TEST_CASE(TaharezLookOverview)
+{
+    SteadyStateFrames test("Generic.scheme", "TaharezLookOverview.layout");
+    test.checkNoAllocations();
+}
+
+BOOST_AUTO_TEST_CASE(VanillaLookOverview)
+{
+    SteadyStateFrames test("VanillaSkin.scheme", "VanillaLookOverview.layout");
+    test.checkNoAllocations();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
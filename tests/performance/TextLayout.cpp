@@ -0,0 +1,144 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Config.h"
+
+#ifdef CEGUI_HAS_FREETYPE
+
+#include "Benchmark.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/Font.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+
+/*!
+\brief
+    Lays out a line of text of a single script and creates its geometry.
+
+    The text layout cache of the fonts is cleared before each iteration, so
+    the shaping and the placement of the glyphs are measured, not just the
+    copying of a cached layout. The glyphs themselves are rasterised during
+    the warm-up.
+*/
+class TextLayoutBenchmark : public Benchmark
+{
+public:
+    TextLayoutBenchmark(const std::string& name, const CEGUI::String& font_file,
+                        const CEGUI::String& font, const CEGUI::String& text,
+                        CEGUI::DefaultParagraphDirection direction) :
+        Benchmark(name, 5, 200),
+        d_text(text),
+        d_direction(direction)
+    {
+        CEGUI::FontManager& fontManager = CEGUI::FontManager::getSingleton();
+        if (!fontManager.isDefined(font))
+            CEGUI::FontManager::createFromFile(font_file);
+
+        d_font = &fontManager.get(font);
+    }
+
+    virtual void setUpIteration()
+    {
+        CEGUI::Font::clearTextLayoutCache();
+    }
+
+    virtual void runIteration()
+    {
+        d_geometry = d_font->createTextRenderGeometry(d_text, glm::vec2(0.f, 0.f),
+            nullptr, false, CEGUI::ColourRect(), d_direction);
+    }
+
+    virtual void tearDownIteration()
+    {
+        CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+        for (CEGUI::GeometryBuffer* buffer : d_geometry)
+            renderer->destroyGeometryBuffer(*buffer);
+        d_geometry.clear();
+    }
+
+    CEGUI::Font* d_font;
+    CEGUI::String d_text;
+    CEGUI::DefaultParagraphDirection d_direction;
+    std::vector<CEGUI::GeometryBuffer*> d_geometry;
+};
+
+BOOST_AUTO_TEST_SUITE(TextLayoutBenchmarks)
+
+BOOST_AUTO_TEST_CASE(Latin)
+{
+    TextLayoutBenchmark test("Text layout: Latin", "DejaVuSans-12.font", "DejaVuSans-12",
+        "The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.",
+        CEGUI::DefaultParagraphDirection::LeftToRight);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(Greek)
+{
+    TextLayoutBenchmark test("Text layout: Greek", "DejaVuSans-12.font", "DejaVuSans-12",
+        U"Ξεσκεπάζω τὴν ψυχοφθόρα βδελυγμία. Τάχιστη αλώπηξ βαφής ψημένη γη.",
+        CEGUI::DefaultParagraphDirection::LeftToRight);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(Cyrillic)
+{
+    TextLayoutBenchmark test("Text layout: Cyrillic", "DejaVuSans-12.font", "DejaVuSans-12",
+        U"Съешь же ещё этих мягких французских булок, да выпей же чаю.",
+        CEGUI::DefaultParagraphDirection::LeftToRight);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(Hebrew)
+{
+    TextLayoutBenchmark test("Text layout: Hebrew", "DejaVuSans-12.font", "DejaVuSans-12",
+        U"דג סקרן שט בים מאוכזב ולפתע מצא לו חברה איך הקליטה.",
+        CEGUI::DefaultParagraphDirection::RightToLeft);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(Arabic)
+{
+    TextLayoutBenchmark test("Text layout: Arabic", "DejaVuSans-12.font", "DejaVuSans-12",
+        U"نص حكيم له سر قاطع وذو شأن عظيم مكتوب على ثوب أخضر ومغلف بجلد أزرق.",
+        CEGUI::DefaultParagraphDirection::RightToLeft);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(Hangul)
+{
+    TextLayoutBenchmark test("Text layout: Hangul", "Batang-18.font", "Batang-18",
+        U"키스의 고유조건은 입술끼리 만나야 하고 특별한 기술은 필요치 않다.",
+        CEGUI::DefaultParagraphDirection::LeftToRight);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -77,7 +77,7 @@ public:
         }
         d_window->draw();
 
-        d_window->setSortMode(VSM_Ascending);
+        d_window->setSortMode(ViewSortMode::Ascending);
     }
 
     StandardItemModel d_model;
@@ -29,6 +29,10 @@
 #include "CEGUI/AnimationInstance.h"
 #include "CEGUI/AnimationManager.h"
 #include "CEGUI/Affector.h"
+#include "CEGUI/Interpolator.h"
+#include "CEGUI/KeyFrame.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
 
 #include <boost/test/unit_test.hpp>
 
@@ -179,4 +183,100 @@ BOOST_AUTO_TEST_CASE(ZeroDurationReplayModes)
     }
 }
 
+BOOST_AUTO_TEST_CASE(ApplyNativeValues)
+{
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    CEGUI::AnimationInstance* instance = CEGUI::AnimationManager::getSingleton().instantiateAnimation(d_zeroToOne);
+    d_zeroToOne->setReplayMode(CEGUI::Animation::ReplayMode::PlayOnce);
+    instance->setTargetWindow(window);
+
+    // the float interpolator keeps the parsed key frame values
+    CEGUI::Affector* affector = d_zeroToOne->getAffectorAtIndex(0);
+    BOOST_CHECK(dynamic_cast<CEGUI::NativeInterpolator*>(affector->getInterpolator()));
+
+    instance->start(false);
+    instance->step(0.25f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.25f, 0.0001f);
+    instance->step(0.5f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.75f, 0.0001f);
+
+    // changing a key frame value drops the parsed value
+    affector->getKeyFrameAtIndex(1)->setValue("0.5");
+    instance->step(0.0f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.375f, 0.0001f);
+
+    CEGUI::AnimationManager::getSingleton().destroyAnimationInstance(instance);
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+}
+
+BOOST_AUTO_TEST_CASE(KeyFrameSegments)
+{
+    CEGUI::Animation* animation = CEGUI::AnimationManager::getSingleton().createAnimation("KeyFrameSegments");
+    animation->setDuration(4.0f);
+    animation->setReplayMode(CEGUI::Animation::ReplayMode::Bounce);
+    CEGUI::Affector* affector = animation->createAffector("Alpha", "float");
+    affector->createKeyFrame(3.0f, "0");
+    affector->createKeyFrame(1.0f, "0");
+    affector->createKeyFrame(2.0f, "1");
+    BOOST_CHECK_CLOSE(affector->getKeyFrameAtIndex(1)->getPosition(), 2.0f, 0.0001f);
+
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    CEGUI::AnimationInstance* instance = CEGUI::AnimationManager::getSingleton().instantiateAnimation(animation);
+    instance->setTargetWindow(window);
+    instance->start(false);
+
+    // before the first key frame
+    instance->step(0.5f);
+    BOOST_CHECK_SMALL(window->getAlpha(), 0.0001f);
+    instance->step(1.0f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.5f, 0.0001f);
+    instance->step(1.0f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.5f, 0.0001f);
+    // after the last key frame, then bouncing back
+    instance->step(1.0f);
+    BOOST_CHECK_SMALL(window->getAlpha(), 0.0001f);
+    instance->step(1.75f);
+    BOOST_CHECK_CLOSE(instance->getPosition(), 2.75f, 0.0001f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.25f, 0.0001f);
+
+    // moving key frames keeps them sorted
+    affector->moveKeyFrameToPosition(1.0f, 3.5f);
+    BOOST_CHECK_CLOSE(affector->getKeyFrameAtIndex(2)->getPosition(), 3.5f, 0.0001f);
+    BOOST_CHECK(!affector->hasKeyFrameAtPosition(1.0f));
+
+    CEGUI::AnimationManager::getSingleton().destroyAnimationInstance(instance);
+    CEGUI::AnimationManager::getSingleton().destroyAnimation(animation);
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+}
+
+BOOST_AUTO_TEST_CASE(BatchedNotifications)
+{
+    CEGUI::Animation* animation = CEGUI::AnimationManager::getSingleton().createAnimation("BatchedNotifications");
+    animation->setDuration(1.0f);
+    CEGUI::Affector* first = animation->createAffector("Alpha", "float");
+    first->createKeyFrame(0.0f, "0");
+    first->createKeyFrame(1.0f, "1");
+    CEGUI::Affector* second = animation->createAffector("Alpha", "float");
+    second->createKeyFrame(0.0f, "0");
+    second->createKeyFrame(1.0f, "0.5");
+
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    int alphaChanges = 0;
+    window->subscribeEvent(CEGUI::Window::EventAlphaChanged, [&alphaChanges]() { ++alphaChanges; });
+
+    CEGUI::AnimationInstance* instance = CEGUI::AnimationManager::getSingleton().instantiateAnimation(animation);
+    instance->setTargetWindow(window);
+    instance->start(false);
+    alphaChanges = 0;
+
+    // both affectors set the alpha, the change is notified once per step
+    instance->step(0.5f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.25f, 0.0001f);
+    BOOST_CHECK_EQUAL(alphaChanges, 1);
+
+    CEGUI::AnimationManager::getSingleton().destroyAnimationInstance(instance);
+    CEGUI::AnimationManager::getSingleton().destroyAnimation(animation);
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,107 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/PropertyHelper.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+const CEGUI::String LayoutSource(
+    "<GUILayout version=\"4\">"
+    "  <Window type=\"TaharezLook/FrameWindow\" name=\"Frame\">"
+    "    <Property name=\"Text\" value=\"Loaded in the background\" />"
+    "    <Property name=\"Size\" value=\"{{0,300},{0,200}}\" />"
+    "    <Window type=\"TaharezLook/Button\" name=\"Button\">"
+    "      <Property name=\"Text\" value=\"OK\" />"
+    "    </Window>"
+    "    <Window type=\"TaharezLook/Editbox\" />"
+    "  </Window>"
+    "</GUILayout>");
+}
+
+BOOST_AUTO_TEST_SUITE(BackgroundLayoutLoading)
+
+BOOST_AUTO_TEST_CASE(LayoutsLoadedOnThreadsCanBeAttached)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+
+    const int threadCount = 4;
+    std::vector<CEGUI::Window*> roots(threadCount, nullptr);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&winMgr, &roots, t]
+        {
+            roots[t] = winMgr.loadLayoutFromString(LayoutSource);
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    // every tree is complete and registered, the generated names are unique
+    CEGUI::Window* guiRoot = winMgr.createWindow("DefaultWindow");
+    for (int t = 0; t < threadCount; ++t)
+    {
+        BOOST_REQUIRE(roots[t] != nullptr);
+        BOOST_CHECK(winMgr.isAlive(roots[t]));
+        BOOST_CHECK_EQUAL(roots[t]->getText(), "Loaded in the background");
+        BOOST_REQUIRE(roots[t]->isChild("Button"));
+        BOOST_CHECK_EQUAL(roots[t]->getChild("Button")->getText(), "OK");
+
+        const CEGUI::String editboxName(
+            roots[t]->getChildAtIndex(roots[t]->getChildCount() - 1)->getName());
+        for (int other = 0; other < t; ++other)
+            BOOST_CHECK(roots[other]->getChildAtIndex(roots[other]->getChildCount() - 1)->getName() !=
+                        editboxName);
+
+        // only the main thread attaches the trees, siblings need unique names
+        roots[t]->setName("Frame" + CEGUI::PropertyHelper<int>::toString(t));
+        guiRoot->addChild(roots[t]);
+    }
+
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::GUIContext& context = system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+    context.setRootWindow(guiRoot);
+    context.injectTimePulse(0.1f);
+    system.renderAllGUIContexts();
+
+    context.setRootWindow(nullptr);
+    system.destroyGUIContext(context);
+    winMgr.destroyWindow(guiRoot);
+    winMgr.cleanDeadPool();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,80 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/BasicRenderedStringParser.h"
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/PropertyHelper.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(BasicRenderedStringParser)
+
+BOOST_AUTO_TEST_CASE(ParsesMarkup)
+{
+    CEGUI::BasicRenderedStringParser parser;
+
+    CEGUI::RenderedString rs = parser.parse(
+        "a[colour='FFFF0000']b\nc[top-padding='2']d", nullptr, nullptr);
+    BOOST_CHECK_EQUAL(rs.getLineCount(), 2u);
+    BOOST_CHECK_EQUAL(rs.getComponentCount(), 4u);
+
+    rs = parser.parse("plain text", nullptr, nullptr);
+    BOOST_CHECK_EQUAL(rs.getLineCount(), 1u);
+    BOOST_CHECK_EQUAL(rs.getComponentCount(), 1u);
+
+    rs = parser.parse("escaped \\[colour='FFFF0000'] tag", nullptr, nullptr);
+    BOOST_CHECK_EQUAL(rs.getComponentCount(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(ParseResultsAreCached)
+{
+    CEGUI::BasicRenderedStringParser parser;
+    const CEGUI::String markup("a[colour='FFFF0000']b");
+
+    const CEGUI::RenderedString first = parser.parse(markup, nullptr, nullptr);
+    BOOST_CHECK_EQUAL(parser.getParseCacheSize(), 1u);
+
+    const CEGUI::RenderedString second = parser.parse(markup, nullptr, nullptr);
+    BOOST_CHECK_EQUAL(parser.getParseCacheSize(), 1u);
+    BOOST_CHECK_EQUAL(second.getComponentCount(), first.getComponentCount());
+
+    // different active colours must not reuse the result
+    const CEGUI::ColourRect colours(CEGUI::Colour(0xFF00FF00));
+    parser.parse(markup, nullptr, &colours);
+    BOOST_CHECK_EQUAL(parser.getParseCacheSize(), 2u);
+
+    for (size_t i = 0; i < CEGUI::BasicRenderedStringParser::ParseCacheCapacity; ++i)
+        parser.parse(CEGUI::PropertyHelper<std::uint32_t>::toString(
+            static_cast<std::uint32_t>(i)), nullptr, nullptr);
+    BOOST_CHECK_EQUAL(parser.getParseCacheSize(),
+                      CEGUI::BasicRenderedStringParser::ParseCacheCapacity);
+
+    parser.clearParseCache();
+    BOOST_CHECK_EQUAL(parser.getParseCacheSize(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,113 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/BidiVisualMapping.h"
+
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+
+namespace
+{
+//! Mapping that reverses the whole string and counts the reorderings.
+class ReversingVisualMapping : public CEGUI::BidiVisualMapping
+{
+public:
+    CEGUI::BidiCharType getBidiCharType(const char32_t) const override
+    {
+        return CEGUI::BidiCharType::RIGHT_TO_LEFT;
+    }
+
+    bool reorderFromLogicalToVisual(const CEGUI::String& logical,
+                                    CEGUI::String& visual,
+                                    StrIndexList& l2v,
+                                    StrIndexList& v2l) const override
+    {
+        ++d_reorderCount;
+
+        visual = logical;
+        std::reverse(visual.begin(), visual.end());
+
+        const int length = static_cast<int>(logical.length());
+        l2v.resize(length);
+        v2l.resize(length);
+        for (int i = 0; i < length; ++i)
+            l2v[i] = v2l[i] = length - 1 - i;
+
+        return true;
+    }
+
+    mutable int d_reorderCount = 0;
+};
+}
+
+BOOST_AUTO_TEST_SUITE(BidiVisualMapping)
+
+BOOST_AUTO_TEST_CASE(VisualsAreSharedBetweenMappings)
+{
+    CEGUI::BidiVisualMapping::clearVisualCache();
+
+    ReversingVisualMapping a;
+    ReversingVisualMapping b;
+
+    BOOST_CHECK(a.updateVisual("abc"));
+    BOOST_CHECK(b.updateVisual("abc"));
+    BOOST_CHECK_EQUAL(a.d_reorderCount + b.d_reorderCount, 1);
+    BOOST_CHECK_EQUAL(b.getTextVisual(), "cba");
+    BOOST_CHECK_EQUAL(b.getL2vMapping().size(), 3u);
+    BOOST_CHECK_EQUAL(b.getV2lMapping()[0], 2);
+
+    BOOST_CHECK(b.updateVisual("de"));
+    BOOST_CHECK_EQUAL(b.getTextVisual(), "ed");
+    BOOST_CHECK_EQUAL(b.getL2vMapping().size(), 2u);
+    BOOST_CHECK_EQUAL(CEGUI::BidiVisualMapping::getVisualCacheSize(), 2u);
+
+    CEGUI::BidiVisualMapping::clearVisualCache();
+}
+
+BOOST_AUTO_TEST_CASE(BatchReordering)
+{
+    CEGUI::BidiVisualMapping::clearVisualCache();
+
+    ReversingVisualMapping mapping;
+    const std::vector<CEGUI::String> logical = { "one", "two", "one" };
+    std::vector<CEGUI::String> visual;
+
+    BOOST_CHECK(mapping.updateVisuals(logical, visual));
+    BOOST_REQUIRE_EQUAL(visual.size(), 3u);
+    BOOST_CHECK_EQUAL(visual[0], "eno");
+    BOOST_CHECK_EQUAL(visual[1], "owt");
+    BOOST_CHECK_EQUAL(visual[2], "eno");
+    BOOST_CHECK_EQUAL(mapping.d_reorderCount, 2);
+
+    // windows showing the strings later reuse the results
+    BOOST_CHECK(mapping.updateVisual("two"));
+    BOOST_CHECK_EQUAL(mapping.d_reorderCount, 2);
+
+    CEGUI::BidiVisualMapping::clearVisualCache();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,129 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/CachingResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+#include <map>
+#include <string>
+
+namespace
+{
+// Serves files from memory and counts how often each one is read.
+class MemoryResourceProvider : public CEGUI::ResourceProvider
+{
+public:
+    void loadRawDataContainer(const CEGUI::String& filename, CEGUI::RawDataContainer& output,
+                              const CEGUI::String&) override
+    {
+        const std::string& content = d_files.at(filename);
+        std::uint8_t* const buffer = new std::uint8_t[content.size()];
+        std::memcpy(buffer, content.data(), content.size());
+        output.setData(buffer);
+        output.setSize(content.size());
+        ++d_readCount;
+    }
+
+    void unloadRawDataContainer(CEGUI::RawDataContainer& data) override
+    {
+        data.release();
+    }
+
+    size_t getResourceGroupFileNames(std::vector<CEGUI::String>&, const CEGUI::String&,
+                                     const CEGUI::String&) override
+    {
+        return 0;
+    }
+
+    std::map<CEGUI::String, std::string> d_files;
+    int d_readCount = 0;
+};
+}
+
+BOOST_AUTO_TEST_SUITE(CachingResourceProvider)
+
+BOOST_AUTO_TEST_CASE(ServesRepeatedLoadsFromMemory)
+{
+    MemoryResourceProvider* const files = new MemoryResourceProvider();
+    files->d_files["a.xml"] = "aaaa";
+    files->d_files["b.xml"] = "bbbb";
+    CEGUI::CachingResourceProvider provider(files, 8);
+
+    BOOST_CHECK_EQUAL(provider.loadShared("a.xml", "")->getSize(), 4u);
+    BOOST_CHECK_EQUAL(provider.loadShared("a.xml", "")->getSize(), 4u);
+    BOOST_CHECK_EQUAL(files->d_readCount, 1);
+    BOOST_CHECK_EQUAL(provider.getHitCount(), 1u);
+    BOOST_CHECK_EQUAL(provider.getMissCount(), 1u);
+    BOOST_CHECK_CLOSE(provider.getHitRate(), 0.5f, 0.001f);
+
+    provider.loadShared("b.xml", "");
+    BOOST_CHECK_EQUAL(provider.getMemoryUsage(), 8u);
+    BOOST_CHECK_EQUAL(provider.getCachedFileCount(), 2u);
+
+    // a.xml is the least recently used file once the budget shrinks
+    provider.loadShared("b.xml", "");
+    provider.setMemoryBudget(4);
+    BOOST_CHECK_EQUAL(provider.getEvictionCount(), 1u);
+    provider.loadShared("b.xml", "");
+    BOOST_CHECK_EQUAL(files->d_readCount, 2);
+    provider.loadShared("a.xml", "");
+    BOOST_CHECK_EQUAL(files->d_readCount, 3);
+
+    provider.invalidate("b.xml", "");
+    provider.resetStatistics();
+    provider.loadShared("a.xml", "");
+    BOOST_CHECK_EQUAL(provider.getHitCount(), 1u);
+    BOOST_CHECK_EQUAL(provider.getMissCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(LentDataOutlivesEviction)
+{
+    MemoryResourceProvider* const files = new MemoryResourceProvider();
+    files->d_files["a.xml"] = "aaaa";
+    CEGUI::CachingResourceProvider provider(files, 8);
+
+    CEGUI::RawDataContainer first;
+    CEGUI::RawDataContainer second;
+    provider.loadRawDataContainer("a.xml", first, "");
+    provider.loadRawDataContainer("a.xml", second, "");
+    BOOST_CHECK(first.isBorrowed());
+    BOOST_CHECK_EQUAL(first.getDataPtr(), second.getDataPtr());
+    BOOST_CHECK_EQUAL(files->d_readCount, 1);
+
+    provider.clear();
+    BOOST_CHECK(std::memcmp(first.getDataPtr(), "aaaa", 4) == 0);
+
+    provider.unloadRawDataContainer(first);
+    BOOST_CHECK(!first.getDataPtr());
+    BOOST_CHECK(std::memcmp(second.getDataPtr(), "aaaa", 4) == 0);
+    provider.unloadRawDataContainer(second);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,86 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/Vertex.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(ColourMaths)
+
+BOOST_AUTO_TEST_CASE(Arithmetic)
+{
+    const CEGUI::Colour a(0.5f, 0.25f, 0.125f, 1.0f);
+    const CEGUI::Colour b(0.25f, 0.25f, 0.5f, 0.5f);
+
+    BOOST_CHECK(a + b == CEGUI::Colour(0.75f, 0.5f, 0.625f, 1.5f));
+    BOOST_CHECK(a - b == CEGUI::Colour(0.25f, 0.0f, -0.375f, 0.5f));
+    BOOST_CHECK(a * 2.0f == CEGUI::Colour(1.0f, 0.5f, 0.25f, 2.0f));
+
+    CEGUI::Colour c(a);
+    c *= b;
+    BOOST_CHECK(c == CEGUI::Colour(0.125f, 0.0625f, 0.0625f, 0.5f));
+    BOOST_CHECK_EQUAL(c.getARGB(), 0x7F1F0F0Fu);
+
+    BOOST_CHECK(CEGUI::Colour::lerp(a, b, 0.5f) ==
+                CEGUI::Colour(0.375f, 0.25f, 0.3125f, 0.75f));
+}
+
+BOOST_AUTO_TEST_CASE(ARGBConversion)
+{
+    BOOST_CHECK_EQUAL(CEGUI::Colour(1.0f, 0.0f, 0.5f, 1.0f).getARGB(), 0xFFFF007Fu);
+    BOOST_CHECK_EQUAL(CEGUI::Colour(0xFF336699).getARGB(), 0xFF336699u);
+
+    // out of range components saturate
+    BOOST_CHECK_EQUAL(CEGUI::Colour(2.0f, -1.0f, 0.0f, 1.5f).getARGB(), 0xFFFF0000u);
+}
+
+BOOST_AUTO_TEST_CASE(VertexColour)
+{
+    CEGUI::TexturedColouredVertex vertex;
+    vertex.setColour(CEGUI::Colour(0.1f, 0.2f, 0.3f, 0.4f));
+
+    BOOST_CHECK_EQUAL(vertex.d_colour.x, 0.1f);
+    BOOST_CHECK_EQUAL(vertex.d_colour.y, 0.2f);
+    BOOST_CHECK_EQUAL(vertex.d_colour.z, 0.3f);
+    BOOST_CHECK_EQUAL(vertex.d_colour.w, 0.4f);
+}
+
+BOOST_AUTO_TEST_CASE(ColourRectInterpolation)
+{
+    const CEGUI::ColourRect rect(CEGUI::Colour(0.0f, 0.0f, 0.0f, 0.0f),
+                                 CEGUI::Colour(1.0f, 0.0f, 0.0f, 1.0f),
+                                 CEGUI::Colour(0.0f, 1.0f, 0.0f, 1.0f),
+                                 CEGUI::Colour(1.0f, 1.0f, 1.0f, 1.0f));
+
+    BOOST_CHECK(rect.getColourAtPoint(0.0f, 0.0f) == rect.d_top_left);
+    BOOST_CHECK(rect.getColourAtPoint(1.0f, 1.0f) == rect.d_bottom_right);
+    BOOST_CHECK(rect.getColourAtPoint(0.5f, 0.5f) ==
+                CEGUI::Colour(0.5f, 0.5f, 0.25f, 0.75f));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
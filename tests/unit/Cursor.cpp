@@ -0,0 +1,135 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/Cursor.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/GradientImage.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+//! Provider recording the last image it was asked to show.
+class NativeCursorProviderStub : public CEGUI::NativeCursorProvider
+{
+public:
+    bool setCursorImage(const CEGUI::Image* image, const CEGUI::Sizef& size,
+                        const glm::vec2& hotSpot) override
+    {
+        d_image = image;
+        d_size = size;
+        d_hotSpot = hotSpot;
+        ++d_calls;
+        return d_accept;
+    }
+
+    bool d_accept = true;
+    const CEGUI::Image* d_image = nullptr;
+    CEGUI::Sizef d_size = CEGUI::Sizef(0.0f, 0.0f);
+    glm::vec2 d_hotSpot = glm::vec2(0.0f, 0.0f);
+    int d_calls = 0;
+};
+
+struct CursorFixture
+{
+    CursorFixture()
+    {
+        CEGUI::System& system = CEGUI::System::getSingleton();
+        d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+    }
+
+    ~CursorFixture()
+    {
+        CEGUI::System::getSingleton().destroyGUIContext(*d_context);
+    }
+
+    CEGUI::GUIContext* d_context;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(CursorNativeProvider, CursorFixture)
+
+BOOST_AUTO_TEST_CASE(ImageIsPassedToProvider)
+{
+    CEGUI::Cursor& cursor = d_context->getCursor();
+    CEGUI::GradientImage image("CursorNativeProvider/Image");
+    image.setImageArea(CEGUI::Rectf(0, 0, 16, 32));
+    image.setOffset(glm::vec2(-4, -2));
+
+    NativeCursorProviderStub provider;
+    cursor.setImage(&image);
+    cursor.setNativeProvider(&provider);
+
+    BOOST_CHECK(cursor.isUsingNativeCursor());
+    BOOST_CHECK_EQUAL(provider.d_image, &image);
+    BOOST_CHECK_EQUAL(provider.d_size, CEGUI::Sizef(16, 32));
+    BOOST_CHECK(provider.d_hotSpot == glm::vec2(4, 2));
+
+    // the hot spot follows an explicit render size
+    cursor.setExplicitRenderSize(CEGUI::Sizef(32, 64));
+    BOOST_CHECK_EQUAL(provider.d_size, CEGUI::Sizef(32, 64));
+    BOOST_CHECK(provider.d_hotSpot == glm::vec2(8, 4));
+    cursor.setExplicitRenderSize(CEGUI::Sizef(0, 0));
+
+    // hiding the cursor hides the native cursor
+    cursor.hide();
+    BOOST_CHECK(provider.d_image == nullptr);
+    cursor.show();
+    BOOST_CHECK_EQUAL(provider.d_image, &image);
+
+    // moving the cursor is handled without the provider
+    const int calls = provider.d_calls;
+    cursor.setPosition(glm::vec2(10, 10));
+    BOOST_CHECK_EQUAL(provider.d_calls, calls);
+
+    cursor.setNativeProvider(nullptr);
+    BOOST_CHECK(!cursor.isUsingNativeCursor());
+    BOOST_CHECK(provider.d_image == nullptr);
+    cursor.setImage(static_cast<const CEGUI::Image*>(nullptr));
+}
+
+BOOST_AUTO_TEST_CASE(RefusedImageIsDrawn)
+{
+    CEGUI::Cursor& cursor = d_context->getCursor();
+    CEGUI::GradientImage image("CursorNativeProvider/Refused");
+    image.setImageArea(CEGUI::Rectf(0, 0, 16, 16));
+
+    NativeCursorProviderStub provider;
+    provider.d_accept = false;
+    cursor.setNativeProvider(&provider);
+    cursor.setImage(&image);
+
+    BOOST_CHECK_EQUAL(provider.d_image, &image);
+    BOOST_CHECK(!cursor.isUsingNativeCursor());
+
+    cursor.setNativeProvider(nullptr);
+    cursor.setImage(static_cast<const CEGUI::Image*>(nullptr));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
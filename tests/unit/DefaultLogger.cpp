@@ -0,0 +1,108 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/DefaultLogger.h"
+#include "CEGUI/String.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(AsynchronousLogging)
+
+BOOST_AUTO_TEST_CASE(QueuedEntriesAreWrittenInOrder)
+{
+    CEGUI::DefaultLogger* logger =
+        dynamic_cast<CEGUI::DefaultLogger*>(CEGUI::Logger::getSingletonPtr());
+    if (!logger)
+        return;
+
+    const char* const fileName = "AsynchronousLogging.log";
+    const CEGUI::LoggingLevel previousLevel = logger->getLoggingLevel();
+    logger->setLoggingLevel(CEGUI::LoggingLevel::Standard);
+    logger->setLogFilename(fileName);
+    logger->setAsynchronous(true);
+    BOOST_CHECK(logger->isAsynchronous());
+
+    const int threadCount = 4;
+    const int entryCount = 200;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([logger, t, entryCount]
+        {
+            const CEGUI::String prefix("async " + std::to_string(t) + " ");
+            for (int i = 0; i < entryCount; ++i)
+            {
+                logger->logEvent(prefix + CEGUI::String(std::to_string(i)));
+                logger->logEvent("filtered", CEGUI::LoggingLevel::Informative);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    logger->setAsynchronous(false);
+    BOOST_CHECK(!logger->isAsynchronous());
+    logger->logEvent("synchronous");
+
+    // entries of each thread keep their order and nothing filtered got in
+    std::vector<int> nextEntry(threadCount, 0);
+    bool sawSynchronous = false;
+    bool sawFiltered = false;
+    std::ifstream file(fileName);
+    std::string line;
+    while (std::getline(file, line))
+    {
+        sawFiltered |= line.find("filtered") != std::string::npos;
+        sawSynchronous |= line.find("synchronous") != std::string::npos;
+
+        const std::string::size_type pos = line.find("async ");
+        if (pos == std::string::npos)
+            continue;
+
+        const int t = std::stoi(line.substr(pos + 6));
+        const int i = std::stoi(line.substr(line.find(' ', pos + 6) + 1));
+        BOOST_CHECK_EQUAL(i, nextEntry[t]);
+        nextEntry[t] = i + 1;
+    }
+    file.close();
+
+    for (int t = 0; t < threadCount; ++t)
+        BOOST_CHECK_EQUAL(nextEntry[t], entryCount);
+    BOOST_CHECK(sawSynchronous);
+    BOOST_CHECK(!sawFiltered);
+
+    logger->setLoggingLevel(previousLevel);
+    logger->setLogFilename("CEGUI.log", true);
+    std::remove(fileName);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
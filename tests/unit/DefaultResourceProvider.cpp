@@ -0,0 +1,161 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Exceptions.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+BOOST_AUTO_TEST_SUITE(DefaultResourceProvider)
+
+BOOST_AUTO_TEST_CASE(MapsFilesFromThreshold)
+{
+    const char* const filename = "DefaultResourceProviderMapping.txt";
+    const char content[] = "<Root>mapped</Root>";
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file.write(content, sizeof(content) - 1);
+    }
+
+    CEGUI::DefaultResourceProvider provider;
+
+    CEGUI::RawDataContainer data;
+    provider.setMemoryMappingThreshold(sizeof(content) - 1);
+    provider.loadRawDataContainer(filename, data, "");
+    BOOST_CHECK(data.isMapped());
+    BOOST_REQUIRE_EQUAL(data.getSize(), sizeof(content) - 1);
+    BOOST_CHECK(std::memcmp(data.getDataPtr(), content, data.getSize()) == 0);
+    provider.unloadRawDataContainer(data);
+    BOOST_CHECK(!data.getDataPtr());
+
+    provider.setMemoryMappingThreshold(sizeof(content));
+    provider.loadRawDataContainer(filename, data, "");
+    BOOST_CHECK(!data.isMapped());
+    BOOST_CHECK_EQUAL(data.getSize(), sizeof(content) - 1);
+    provider.unloadRawDataContainer(data);
+
+    std::remove(filename);
+}
+
+BOOST_AUTO_TEST_CASE(LoadsAsynchronously)
+{
+    const char* const filename = "DefaultResourceProviderAsync.txt";
+    const std::string content("<Root>async</Root>");
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file << content;
+    }
+
+    CEGUI::DefaultResourceProvider provider;
+
+    std::string loaded;
+    bool loadFailed = false;
+    provider.loadRawDataContainerAsync(filename, "",
+        [&loaded](CEGUI::RawDataContainer& data, std::exception_ptr error)
+    {
+        BOOST_CHECK(!error);
+        loaded.assign(reinterpret_cast<const char*>(data.getDataPtr()), data.getSize());
+    });
+    provider.loadRawDataContainerAsync("DefaultResourceProviderMissing.txt", "",
+        [&loadFailed](CEGUI::RawDataContainer&, std::exception_ptr error)
+    {
+        loadFailed = static_cast<bool>(error);
+    });
+
+    // callbacks only run when the loads are dispatched
+    BOOST_CHECK_EQUAL(provider.getPendingLoadCount(), 2u);
+    BOOST_CHECK(loaded.empty());
+
+    provider.waitForPendingLoads();
+    BOOST_CHECK_EQUAL(provider.getPendingLoadCount(), 0u);
+    BOOST_CHECK_EQUAL(loaded, content);
+    BOOST_CHECK(loadFailed);
+
+    std::remove(filename);
+}
+
+BOOST_AUTO_TEST_CASE(ReadsInChunks)
+{
+    const char* const filename = "DefaultResourceProviderChunks.txt";
+    const std::string content("<Root>read in chunks</Root>");
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file << content;
+    }
+
+    CEGUI::DefaultResourceProvider provider;
+    provider.setReadChunkSize(8);
+
+    std::string read;
+    size_t chunkCount = 0;
+    provider.readRawDataChunks(filename,
+        [&read, &chunkCount](const std::uint8_t* data, size_t size)
+    {
+        BOOST_CHECK(size <= 8);
+        read.append(reinterpret_cast<const char*>(data), size);
+        ++chunkCount;
+    }, "");
+
+    BOOST_CHECK_EQUAL(read, content);
+    BOOST_CHECK_EQUAL(chunkCount, (content.size() + 7) / 8);
+
+    BOOST_CHECK_THROW(provider.readRawDataChunks("DefaultResourceProviderMissing.txt",
+        [](const std::uint8_t*, size_t) {}, ""), CEGUI::FileIOException);
+
+    std::remove(filename);
+}
+
+BOOST_AUTO_TEST_CASE(ReportsResourceVersions)
+{
+    const char* const filename = "DefaultResourceProviderVersion.txt";
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file << "first";
+    }
+
+    CEGUI::DefaultResourceProvider provider;
+    const std::uint64_t version = provider.getResourceVersion(filename, "");
+    BOOST_CHECK(version != 0);
+    BOOST_CHECK_EQUAL(provider.getResourceVersion(filename, ""), version);
+
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file << "second, longer";
+    }
+    BOOST_CHECK(provider.getResourceVersion(filename, "") != version);
+
+    std::remove(filename);
+    BOOST_CHECK_EQUAL(provider.getResourceVersion(filename, ""), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
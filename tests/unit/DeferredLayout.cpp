@@ -0,0 +1,147 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+struct DeferredLayoutFixture
+{
+    DeferredLayoutFixture()
+    {
+        CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+        d_root = winMgr.createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(0, 400), CEGUI::UDim(0, 400)));
+
+        d_child = winMgr.createWindow("DefaultWindow");
+        d_child->setSize(CEGUI::USize(CEGUI::UDim(0.5f, 0), CEGUI::UDim(0.5f, 0)));
+        d_root->addChild(d_child);
+
+        d_sibling = winMgr.createWindow("DefaultWindow");
+        d_sibling->setSize(CEGUI::USize(CEGUI::UDim(0, 50), CEGUI::UDim(0, 50)));
+        d_root->addChild(d_sibling);
+
+        CEGUI::System& system = CEGUI::System::getSingleton();
+        d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+        d_context->setRootWindow(d_root);
+
+        d_child->subscribeEvent(CEGUI::Element::EventSized,
+            [this]() { ++d_childSizedCount; });
+        d_sibling->subscribeEvent(CEGUI::Element::EventMoved,
+            [this]() { ++d_siblingMovedCount; });
+    }
+
+    ~DeferredLayoutFixture()
+    {
+        d_context->setRootWindow(nullptr);
+        CEGUI::System::getSingleton().destroyGUIContext(*d_context);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    CEGUI::GUIContext* d_context;
+    CEGUI::Window* d_root;
+    CEGUI::Window* d_child;
+    CEGUI::Window* d_sibling;
+    int d_childSizedCount = 0;
+    int d_siblingMovedCount = 0;
+};
+
+void setPixelSize(CEGUI::Window* window, float size)
+{
+    window->setSize(CEGUI::USize(CEGUI::UDim(0, size), CEGUI::UDim(0, size)));
+}
+}
+
+BOOST_FIXTURE_TEST_SUITE(DeferredLayout, DeferredLayoutFixture)
+
+BOOST_AUTO_TEST_CASE(AppliesChangesImmediatelyByDefault)
+{
+    BOOST_CHECK(!d_context->isLayoutDeferred());
+
+    setPixelSize(d_root, 200);
+    BOOST_CHECK(!d_root->isScreenAreaChangePending());
+    BOOST_CHECK_EQUAL(d_child->getPixelSize(), CEGUI::Sizef(100, 100));
+    BOOST_CHECK_EQUAL(d_childSizedCount, 1);
+}
+
+BOOST_AUTO_TEST_CASE(MergesRepeatedChangesIntoOneUpdate)
+{
+    d_context->setLayoutDeferred(true);
+
+    for (float size = 100; size <= 300; size += 10)
+        setPixelSize(d_root, size);
+
+    BOOST_CHECK(d_root->isScreenAreaChangePending());
+    BOOST_CHECK_EQUAL(d_child->getPixelSize(), CEGUI::Sizef(200, 200));
+    BOOST_CHECK_EQUAL(d_childSizedCount, 0);
+
+    d_context->updateLayout();
+
+    BOOST_CHECK(!d_root->isScreenAreaChangePending());
+    BOOST_CHECK(!d_child->isScreenAreaChangePending());
+    BOOST_CHECK_EQUAL(d_root->getPixelSize(), CEGUI::Sizef(300, 300));
+    BOOST_CHECK_EQUAL(d_child->getPixelSize(), CEGUI::Sizef(150, 150));
+    BOOST_CHECK_EQUAL(d_childSizedCount, 1);
+    BOOST_CHECK_EQUAL(d_siblingMovedCount, 0);
+}
+
+BOOST_AUTO_TEST_CASE(UpdatesOnlyPendingWindows)
+{
+    d_context->setLayoutDeferred(true);
+
+    d_child->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 10), CEGUI::UDim(0, 20)));
+    setPixelSize(d_child, 30);
+    BOOST_CHECK(d_child->isScreenAreaChangePending());
+    BOOST_CHECK(!d_root->isScreenAreaChangePending());
+
+    d_context->draw();
+
+    BOOST_CHECK(!d_child->isScreenAreaChangePending());
+    BOOST_CHECK_EQUAL(d_child->getUnclippedOuterRect().get(), CEGUI::Rectf(10, 20, 40, 50));
+    BOOST_CHECK_EQUAL(d_childSizedCount, 1);
+    BOOST_CHECK_EQUAL(d_siblingMovedCount, 0);
+}
+
+BOOST_AUTO_TEST_CASE(AppliesPendingChangesWhenDisabled)
+{
+    d_context->setLayoutDeferred(true);
+    setPixelSize(d_root, 100);
+
+    d_context->setLayoutDeferred(false);
+
+    BOOST_CHECK(!d_context->isLayoutDeferred());
+    BOOST_CHECK(!d_root->isScreenAreaChangePending());
+    BOOST_CHECK_EQUAL(d_child->getPixelSize(), CEGUI::Sizef(50, 50));
+    BOOST_CHECK_EQUAL(d_childSizedCount, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,96 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/falagard/Dimensions.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+struct DimensionsFixture
+{
+    DimensionsFixture()
+    {
+        d_window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        d_window->setSize(CEGUI::USize(CEGUI::UDim(0, 200), CEGUI::UDim(0, 100)));
+    }
+
+    ~DimensionsFixture()
+    {
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_window);
+    }
+
+    CEGUI::Window* d_window;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(Dimensions, DimensionsFixture)
+
+BOOST_AUTO_TEST_CASE(ConstantsAreFolded)
+{
+    const CEGUI::AbsoluteDim four(4.0f);
+    const CEGUI::UnifiedDim three(CEGUI::UDim(0, 3.0f), CEGUI::DimensionType::Width);
+    CEGUI::OperatorDim op(CEGUI::DimensionOperator::Multiply);
+    op.setLeftOperand(&four);
+    op.setRightOperand(&three);
+
+    const CEGUI::Dimension dim(op, CEGUI::DimensionType::Width);
+    BOOST_CHECK(dim.getProgram().isConstant());
+    BOOST_CHECK_EQUAL(dim.getValue(*d_window), 12.0f);
+    BOOST_CHECK_EQUAL(dim.getValue(*d_window), op.getValue(*d_window));
+}
+
+BOOST_AUTO_TEST_CASE(ProgramMatchesTree)
+{
+    // (50% of the width - 10) / max(height, 0)
+    const CEGUI::UnifiedDim halfWidth(CEGUI::UDim(0.5f, 0), CEGUI::DimensionType::Width);
+    const CEGUI::UnifiedDim height(CEGUI::UDim(1.0f, 0), CEGUI::DimensionType::Height);
+    const CEGUI::AbsoluteDim ten(10.0f);
+    const CEGUI::AbsoluteDim zero(0.0f);
+
+    CEGUI::OperatorDim sub(CEGUI::DimensionOperator::Subtract);
+    sub.setLeftOperand(&halfWidth);
+    sub.setRightOperand(&ten);
+    CEGUI::OperatorDim max(CEGUI::DimensionOperator::Max);
+    max.setLeftOperand(&height);
+    max.setRightOperand(&zero);
+    CEGUI::OperatorDim div(CEGUI::DimensionOperator::Divide);
+    div.setLeftOperand(&sub);
+    div.setRightOperand(&max);
+
+    const CEGUI::Dimension dim(div, CEGUI::DimensionType::Width);
+    BOOST_CHECK(!dim.getProgram().isConstant());
+    BOOST_CHECK_EQUAL(dim.getValue(*d_window), div.getValue(*d_window));
+    BOOST_CHECK_CLOSE(dim.getValue(*d_window), 0.9f, 0.01f);
+
+    const CEGUI::Rectf container(0, 0, 40, 20);
+    BOOST_CHECK_EQUAL(dim.getValue(*d_window, container), div.getValue(*d_window, container));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
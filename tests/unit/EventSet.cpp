@@ -31,6 +31,7 @@
 #include "CEGUI/Exceptions.h"
 
 #include <functional>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 
@@ -453,4 +454,131 @@ BOOST_AUTO_TEST_CASE(Subscribing)
     }
 #endif
 }
+BOOST_AUTO_TEST_CASE(FiringByInternedName)
+{
+    CEGUI::EventSet set;
+
+    const CEGUI::InternedName eventName(CEGUI::String("InternedTestEvent"));
+    BOOST_CHECK(!set.isEventPresent(eventName));
+
+    CEGUI::Event::Connection connection = set.subscribeEvent("InternedTestEvent", &freeFunctionSubscriber);
+    BOOST_CHECK(set.isEventPresent(eventName));
+    BOOST_CHECK_EQUAL(set.getEventObject(eventName), set.getEventObject("InternedTestEvent"));
+
+    TestEventArgs args;
+    args.d_targetValue = 50;
+    set.fireEvent(eventName, args);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 50);
+    connection->disconnect();
+
+    // names that were never interned are looked up but never added
+    BOOST_CHECK(!CEGUI::InternedName::find("NeverInternedTestEvent").isInterned());
+    BOOST_CHECK(!set.getEventObject(CEGUI::InternedName(), true));
+    set.fireEvent("NeverInternedTestEvent", args);
+    BOOST_CHECK(!CEGUI::InternedName::find("NeverInternedTestEvent").isInterned());
+}
+
+BOOST_AUTO_TEST_CASE(SubscriberOrderAndReentrancy)
+{
+    CEGUI::Event event("OrderTestEvent");
+    std::vector<int> calls;
+
+    event.subscribe([&calls]() { calls.push_back(3); });
+    event.subscribe(2, [&calls]() { calls.push_back(2); });
+    event.subscribe(1, [&calls]() { calls.push_back(0); });
+    event.subscribe(1, [&calls]() { calls.push_back(1); });
+
+    TestEventArgs args;
+    event(args);
+    const std::vector<int> expected = { 0, 1, 2, 3 };
+    BOOST_CHECK(calls == expected);
+
+    // slots subscribed while firing are called from the next firing on,
+    // slots disconnected while firing are not called anymore
+    CEGUI::Event otherEvent("ReentrancyTestEvent");
+    CEGUI::Event::Connection later;
+    CEGUI::Event::Connection second;
+    int count = 0;
+    otherEvent.subscribe(1, [&]()
+    {
+        ++count;
+        if (!later)
+            later = otherEvent.subscribe(0, [&count]() { count += 10; });
+        second->disconnect();
+    });
+    second = otherEvent.subscribe(2, [&count]() { count += 100; });
+
+    otherEvent(args);
+    BOOST_CHECK_EQUAL(count, 1);
+    BOOST_CHECK_EQUAL(otherEvent.getConnectionCount(), 2u);
+    otherEvent(args);
+    BOOST_CHECK_EQUAL(count, 12);
+}
+
+BOOST_AUTO_TEST_CASE(GlobalSubscribers)
+{
+    CEGUI::GlobalEventSet& globalSet = CEGUI::GlobalEventSet::getSingleton();
+    CEGUI::EventSet set;
+    TestEventArgs args;
+
+    int count = 0;
+    CEGUI::Event::Connection connection = globalSet.subscribeEvent(
+        "GlobalTestNamespace/GlobalTestEvent", [&count]() { ++count; });
+
+    set.fireEvent("GlobalTestEvent", args, "GlobalTestNamespace");
+    BOOST_CHECK_EQUAL(count, 1);
+    set.fireEvent(CEGUI::InternedName(CEGUI::String("GlobalTestEvent")), args, "GlobalTestNamespace");
+    BOOST_CHECK_EQUAL(count, 2);
+    set.fireEvent("GlobalTestEvent", args, "OtherTestNamespace");
+    set.fireEvent("OtherGlobalTestEvent", args, "GlobalTestNamespace");
+    BOOST_CHECK_EQUAL(count, 2);
+
+    connection->disconnect();
+    set.fireEvent("GlobalTestEvent", args, "GlobalTestNamespace");
+    BOOST_CHECK_EQUAL(count, 2);
+}
+
+BOOST_AUTO_TEST_CASE(CoalescedEvents)
+{
+    CEGUI::EventSet set;
+    std::vector<int> values;
+    set.subscribeEvent("CoalescedTestEvent", [&values](const CEGUI::EventArgs& args)
+    {
+        values.push_back(static_cast<const TestEventArgs&>(args).d_targetValue);
+    });
+    int otherCount = 0;
+    set.subscribeEvent("OtherCoalescedTestEvent", [&otherCount]() { ++otherCount; });
+
+    TestEventArgs args;
+    args.d_targetValue = 1;
+    set.fireCoalescedEvent("CoalescedTestEvent", args);
+    BOOST_CHECK_EQUAL(values.size(), 1u);
+
+    {
+        CEGUI::EventSet::BatchScope batch;
+        BOOST_CHECK(CEGUI::EventSet::isBatching());
+
+        args.d_targetValue = 2;
+        set.fireCoalescedEvent("CoalescedTestEvent", args);
+        {
+            CEGUI::EventSet::BatchScope nested;
+            set.fireCoalescedEvent("OtherCoalescedTestEvent", args);
+        }
+        args.d_targetValue = 3;
+        set.fireCoalescedEvent("CoalescedTestEvent", args);
+        BOOST_CHECK_EQUAL(values.size(), 1u);
+        BOOST_CHECK_EQUAL(otherCount, 0);
+
+        // events of an EventSet destroyed before the flush are dropped
+        CEGUI::EventSet destroyed;
+        destroyed.subscribeEvent("CoalescedTestEvent", [&otherCount]() { otherCount += 10; });
+        destroyed.fireCoalescedEvent("CoalescedTestEvent", args);
+    }
+
+    BOOST_CHECK(!CEGUI::EventSet::isBatching());
+    const std::vector<int> expected = { 1, 3 };
+    BOOST_CHECK(values == expected);
+    BOOST_CHECK_EQUAL(otherCount, 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,102 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/views/FlatItemModel.h"
+
+using namespace CEGUI;
+
+typedef FlatItemModel<FlatItem> TestFlatItemModel;
+
+BOOST_AUTO_TEST_SUITE(FlatItemModelTestSuite)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(AddItems_AreChildrenOfRootInOrder)
+{
+    TestFlatItemModel model;
+    std::vector<FlatItem> items;
+    items.push_back(FlatItem("i1"));
+    items.push_back(FlatItem("i2"));
+    items.push_back(FlatItem("i3"));
+
+    model.addItems(items.begin(), items.end());
+
+    BOOST_REQUIRE_EQUAL(3, model.getItemCount());
+    BOOST_REQUIRE_EQUAL(3, model.getChildCount(model.getRootIndex()));
+    BOOST_REQUIRE_EQUAL("i2", model.getData(model.makeIndex(1, model.getRootIndex())));
+    BOOST_REQUIRE_EQUAL(1, model.getChildId(model.makeIndex(1, model.getRootIndex())));
+    BOOST_REQUIRE(!model.isValidIndex(model.makeIndex(3, model.getRootIndex())));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(AddItemAtPosition_ChildOfItem_HasItemAsParent)
+{
+    TestFlatItemModel model;
+    model.addItem(FlatItem("i1"));
+    ModelIndex i1_index = model.makeIndex(0, model.getRootIndex());
+
+    model.addItemAtPosition(FlatItem("i1-child2"), i1_index, 0);
+    model.addItemAtPosition(FlatItem("i1-child1"), i1_index, 0);
+
+    BOOST_REQUIRE_EQUAL(2, model.getChildCount(i1_index));
+    ModelIndex child_index = model.makeIndex(1, i1_index);
+    BOOST_REQUIRE_EQUAL("i1-child2", model.getData(child_index));
+    BOOST_REQUIRE(model.areIndicesEqual(i1_index, model.getParentIndex(child_index)));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(RemoveItem_OtherIndicesStayValid)
+{
+    TestFlatItemModel model;
+    model.addItem(FlatItem("i1"));
+    const TestFlatItemModel::SlotId i2_slot = model.addItem(FlatItem("i2"));
+    model.addItemAtPosition(FlatItem("i1-child"),
+        model.makeIndex(0, model.getRootIndex()), 0);
+
+    model.removeItem(model.makeIndex(0, model.getRootIndex()));
+
+    BOOST_REQUIRE_EQUAL(1, model.getItemCount());
+    BOOST_REQUIRE_EQUAL(1, model.getChildCount(model.getRootIndex()));
+    ModelIndex i2_index = model.getIndexForSlot(i2_slot);
+    BOOST_REQUIRE(model.isValidIndex(i2_index));
+    BOOST_REQUIRE_EQUAL("i2", model.getData(i2_index));
+    BOOST_REQUIRE_EQUAL(0, model.getChildId(i2_index));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(CompareIndices_ComparesItems)
+{
+    TestFlatItemModel model;
+    model.addItem(FlatItem("b"));
+    model.addItem(FlatItem("a"));
+
+    BOOST_REQUIRE_EQUAL(1, model.compareIndices(
+        model.makeIndex(0, model.getRootIndex()),
+        model.makeIndex(1, model.getRootIndex())));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,97 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/FrameAllocator.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+
+BOOST_AUTO_TEST_SUITE(FrameAllocation)
+
+BOOST_AUTO_TEST_CASE(AllocationsAreAlignedAndDistinct)
+{
+    CEGUI::FrameAllocator allocator;
+
+    char* first = static_cast<char*>(allocator.allocate(3, 1));
+    void* second = allocator.allocate(8, 64);
+    char* third = static_cast<char*>(allocator.allocate(1, 1));
+
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(second) % 64, 0u);
+    BOOST_CHECK(first + 3 <= second);
+    BOOST_CHECK(static_cast<char*>(second) + 8 <= third);
+    BOOST_CHECK(allocator.getUsedSize() >= 12);
+}
+
+BOOST_AUTO_TEST_CASE(ResetMergesBlocks)
+{
+    CEGUI::FrameAllocator allocator;
+
+    for (int i = 0; i < 4; ++i)
+        allocator.allocate(CEGUI::FrameAllocator::DefaultBlockSize);
+
+    const std::size_t capacity = allocator.getCapacity();
+    BOOST_CHECK(capacity >= 4 * CEGUI::FrameAllocator::DefaultBlockSize);
+
+    allocator.reset();
+    BOOST_CHECK_EQUAL(allocator.getUsedSize(), 0u);
+    BOOST_CHECK_EQUAL(allocator.getCapacity(), capacity);
+
+    // the same frame again fits into the merged block
+    for (int i = 0; i < 4; ++i)
+        allocator.allocate(CEGUI::FrameAllocator::DefaultBlockSize);
+
+    BOOST_CHECK_EQUAL(allocator.getCapacity(), capacity);
+}
+
+BOOST_AUTO_TEST_CASE(FrameVectorUsesActiveAllocator)
+{
+    CEGUI::FrameAllocator allocator;
+
+    {
+        CEGUI::FrameVector<int> heapVector;
+        heapVector.push_back(1);
+        BOOST_CHECK(heapVector.get_allocator().getFrameAllocator() == nullptr);
+    }
+
+    CEGUI::FrameAllocator* previous = CEGUI::FrameAllocator::setActive(&allocator);
+    {
+        CEGUI::FrameVector<int> frameVector;
+        for (int i = 0; i < 1000; ++i)
+            frameVector.push_back(i);
+
+        BOOST_CHECK(frameVector.get_allocator().getFrameAllocator() == &allocator);
+        BOOST_CHECK_EQUAL(frameVector[999], 999);
+        BOOST_CHECK(allocator.getUsedSize() >= 1000 * sizeof(int));
+    }
+    BOOST_CHECK(CEGUI::FrameAllocator::setActive(previous) == &allocator);
+
+    allocator.reset();
+    BOOST_CHECK_EQUAL(allocator.getUsedSize(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,122 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/falagard/FrameComponent.h"
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+
+namespace
+{
+struct FrameComponentFixture
+{
+    FrameComponentFixture()
+    {
+        d_window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        d_window->setSize(CEGUI::USize(CEGUI::UDim(0, 200), CEGUI::UDim(0, 100)));
+
+        CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+        d_texture = &renderer->createTexture("FrameComponentTest", CEGUI::Sizef(32, 32));
+        d_otherTexture = &renderer->createTexture("FrameComponentTestOther", CEGUI::Sizef(32, 32));
+
+        // a 32x32 nine-slice with 8 pixel wide borders
+        setImage(CEGUI::FrameImageComponent::TopLeftCorner, CEGUI::Rectf(0, 0, 8, 8));
+        setImage(CEGUI::FrameImageComponent::TopRightCorner, CEGUI::Rectf(24, 0, 32, 8));
+        setImage(CEGUI::FrameImageComponent::BottomLeftCorner, CEGUI::Rectf(0, 24, 8, 32));
+        setImage(CEGUI::FrameImageComponent::BottomRightCorner, CEGUI::Rectf(24, 24, 32, 32));
+        setImage(CEGUI::FrameImageComponent::TopEdge, CEGUI::Rectf(8, 0, 24, 8));
+        setImage(CEGUI::FrameImageComponent::BottomEdge, CEGUI::Rectf(8, 24, 24, 32));
+        setImage(CEGUI::FrameImageComponent::LeftEdge, CEGUI::Rectf(0, 8, 8, 24));
+        setImage(CEGUI::FrameImageComponent::RightEdge, CEGUI::Rectf(24, 8, 32, 24));
+        setImage(CEGUI::FrameImageComponent::Background, CEGUI::Rectf(8, 8, 24, 24));
+    }
+
+    ~FrameComponentFixture()
+    {
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_window);
+        CEGUI::WindowManager::getSingleton().cleanDeadPool();
+
+        CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+        renderer->destroyTexture(*d_otherTexture);
+        renderer->destroyTexture(*d_texture);
+    }
+
+    void setImage(CEGUI::FrameImageComponent part, const CEGUI::Rectf& area,
+                  bool otherTexture = false)
+    {
+        d_images.emplace_back(new CEGUI::BitmapImage("FrameComponentTest",
+            otherTexture ? d_otherTexture : d_texture, area, glm::vec2(0, 0),
+            CEGUI::AutoScaledMode::Disabled, CEGUI::Sizef(640, 480)));
+        d_frame.setImage(part, d_images.back().get());
+    }
+
+    CEGUI::Window* d_window;
+    CEGUI::Texture* d_texture;
+    CEGUI::Texture* d_otherTexture;
+    std::vector<std::unique_ptr<CEGUI::BitmapImage>> d_images;
+    CEGUI::FrameComponent d_frame;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(FrameComponent, FrameComponentFixture)
+
+BOOST_AUTO_TEST_CASE(SlicesOfOneTextureShareABuffer)
+{
+    d_frame.createRenderGeometryAndAddToWindow(*d_window);
+
+    BOOST_CHECK_EQUAL(d_window->getGeometryBuffers().size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(TiledEdgesShareTheBuffer)
+{
+    d_frame.setTopEdgeFormatting(CEGUI::HorizontalFormatting::Tiled);
+    d_frame.createRenderGeometryAndAddToWindow(*d_window);
+
+    BOOST_CHECK_EQUAL(d_window->getGeometryBuffers().size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(OtherTextureKeepsDrawingOrder)
+{
+    setImage(CEGUI::FrameImageComponent::TopEdge, CEGUI::Rectf(8, 0, 24, 8), true);
+    d_frame.createRenderGeometryAndAddToWindow(*d_window);
+
+    // corners, then the top edge, then the remaining edges and background
+    const std::vector<CEGUI::GeometryBuffer*>& buffers = d_window->getGeometryBuffers();
+    BOOST_REQUIRE_EQUAL(buffers.size(), 3u);
+    BOOST_CHECK(buffers[0]->getTexture("texture0") == d_texture);
+    BOOST_CHECK(buffers[1]->getTexture("texture0") == d_otherTexture);
+    BOOST_CHECK(buffers[2]->getTexture("texture0") == d_texture);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,287 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/FrameStats.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/RendererModules/Null/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+//! Nothing is drawn to an empty display, which is the default of the Null renderer
+struct FrameStatsFixture
+{
+    FrameStatsFixture()
+    {
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+    }
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(FrameStatistics, FrameStatsFixture)
+
+BOOST_AUTO_TEST_CASE(ContextAndRendererReportTheFrame)
+{
+    CEGUI::WindowManager& windowManager = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* root = windowManager.createWindow("DefaultWindow");
+    CEGUI::Window* first = windowManager.createWindow("TaharezLook/Button");
+    CEGUI::Window* second = windowManager.createWindow("TaharezLook/Button");
+    first->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+    second->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+    second->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 0), CEGUI::UDim(0, 40)));
+    root->addChild(first);
+    root->addChild(second);
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::Renderer* renderer = system.getRenderer();
+    CEGUI::GUIContext& context = system.createGUIContext(renderer->getDefaultRenderTarget());
+    context.setRootWindow(root);
+
+    context.injectTimePulse(0.1f);
+    system.renderAllGUIContexts();
+
+    const CEGUI::FrameStats& stats = context.getFrameStats();
+    BOOST_CHECK_EQUAL(stats.d_windowsUpdated, 3u);
+    BOOST_CHECK_EQUAL(stats.d_windowsRedrawn, 3u);
+    BOOST_CHECK(stats.d_geometryBuffersQueued > 0);
+    BOOST_CHECK_EQUAL(stats.d_layoutPasses, 0u);
+
+    // the renderer sums up all contexts drawn in the frame
+    const CEGUI::FrameStats& rendererStats = renderer->getFrameStats();
+    BOOST_CHECK(rendererStats.d_windowsRedrawn >= stats.d_windowsRedrawn);
+    BOOST_CHECK(rendererStats.d_geometryBuffersQueued >= stats.d_geometryBuffersQueued);
+    BOOST_CHECK(rendererStats.d_geometryTime >= stats.d_geometryTime);
+
+    // an unchanged frame rebuilds nothing
+    system.renderAllGUIContexts();
+    BOOST_CHECK_EQUAL(context.getFrameStats().d_windowsUpdated, 0u);
+    BOOST_CHECK_EQUAL(context.getFrameStats().d_windowsRedrawn, 0u);
+
+    // deferred area changes are applied in a single pass
+    context.setLayoutDeferred(true);
+    first->setSize(CEGUI::USize(CEGUI::UDim(0, 120), CEGUI::UDim(0, 30)));
+    second->setSize(CEGUI::USize(CEGUI::UDim(0, 120), CEGUI::UDim(0, 30)));
+    system.renderAllGUIContexts();
+    BOOST_CHECK_EQUAL(context.getFrameStats().d_layoutPasses, 1u);
+    context.setLayoutDeferred(false);
+
+    context.setRootWindow(nullptr);
+    system.destroyGUIContext(context);
+    windowManager.destroyWindow(root);
+}
+
+BOOST_AUTO_TEST_CASE(NullRendererAccountsDrawWork)
+{
+    CEGUI::WindowManager& windowManager = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* root = windowManager.createWindow("DefaultWindow");
+    CEGUI::Window* button = windowManager.createWindow("TaharezLook/Button");
+    button->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+    root->addChild(button);
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::NullRenderer* renderer = static_cast<CEGUI::NullRenderer*>(system.getRenderer());
+    CEGUI::GUIContext& context = system.createGUIContext(renderer->getDefaultRenderTarget());
+    context.setRootWindow(root);
+
+    system.renderAllGUIContexts();
+    const CEGUI::FrameStats& stats = context.getFrameStats();
+    BOOST_CHECK(stats.d_drawCalls > 0);
+    BOOST_CHECK(stats.d_verticesDrawn > 0);
+    BOOST_CHECK(stats.d_verticesUploaded > 0 && stats.d_verticesUploaded <= stats.d_verticesDrawn);
+    BOOST_CHECK(stats.d_stateChanges >= 4);
+    BOOST_CHECK(renderer->getTextureMemoryUsage() > 0);
+
+    // unchanged geometry is drawn again without being uploaded
+    system.renderAllGUIContexts();
+    BOOST_CHECK(context.getFrameStats().d_verticesDrawn > 0);
+    BOOST_CHECK_EQUAL(context.getFrameStats().d_verticesUploaded, 0u);
+
+    context.setRootWindow(nullptr);
+    system.destroyGUIContext(context);
+    windowManager.destroyWindow(root);
+}
+
+BOOST_AUTO_TEST_CASE(CleanFramesNeedNoRedraw)
+{
+    CEGUI::WindowManager& windowManager = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* root = windowManager.createWindow("DefaultWindow");
+    CEGUI::Window* first = windowManager.createWindow("TaharezLook/Button");
+    CEGUI::Window* second = windowManager.createWindow("TaharezLook/Button");
+    first->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+    second->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+    second->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 0), CEGUI::UDim(0, 40)));
+    root->addChild(first);
+    root->addChild(second);
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::Renderer* renderer = system.getRenderer();
+    CEGUI::GUIContext& context = system.createGUIContext(renderer->getDefaultRenderTarget());
+    context.setRootWindow(root);
+
+    BOOST_CHECK(context.needsRedraw());
+    system.renderAllGUIContexts();
+    BOOST_CHECK(!context.needsRedraw());
+
+    // a clean frame submits all the window geometry again
+    system.renderAllGUIContexts();
+    const auto uncachedVertices = context.getFrameStats().d_verticesDrawn;
+    BOOST_CHECK(uncachedVertices > 12u);
+
+    context.getCursor().setPosition(glm::vec2(10, 10));
+    BOOST_CHECK(context.needsRedraw());
+    system.renderAllGUIContexts();
+    BOOST_CHECK(!context.needsRedraw());
+
+    first->invalidate();
+    BOOST_CHECK(context.needsRedraw());
+    system.renderAllGUIContexts();
+
+    // clean frames are skipped entirely on demand
+    context.setDrawOnDemandEnabled(true);
+    system.renderAllGUIContexts();
+    system.renderAllGUIContexts();
+    BOOST_CHECK_EQUAL(renderer->getFrameStats().d_drawCalls, 0u);
+    second->invalidate();
+    system.renderAllGUIContexts();
+    BOOST_CHECK(renderer->getFrameStats().d_drawCalls > 0);
+    context.setDrawOnDemandEnabled(false);
+
+    // with a content cache clean frames only draw the cached quad and cursor
+    context.setContentCachingEnabled(true);
+    BOOST_CHECK(context.isContentCachingEnabled());
+    system.renderAllGUIContexts();
+    system.renderAllGUIContexts();
+    BOOST_CHECK(context.getFrameStats().d_verticesDrawn <= 12u);
+    BOOST_CHECK_EQUAL(context.getFrameStats().d_windowsRedrawn, 0u);
+
+    first->invalidate();
+    system.renderAllGUIContexts();
+    BOOST_CHECK_EQUAL(context.getFrameStats().d_windowsRedrawn, 1u);
+    BOOST_CHECK(context.getFrameStats().d_verticesDrawn > uncachedVertices);
+    context.setContentCachingEnabled(false);
+
+    context.setRootWindow(nullptr);
+    system.destroyGUIContext(context);
+    windowManager.destroyWindow(root);
+}
+
+BOOST_AUTO_TEST_CASE(SelectiveUpdateSkipsIdleWindows)
+{
+    CEGUI::WindowManager& windowManager = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* root = windowManager.createWindow("DefaultWindow");
+    CEGUI::Window* button = windowManager.createWindow("TaharezLook/Button");
+    CEGUI::Window* editbox = windowManager.createWindow("TaharezLook/Editbox");
+    editbox->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 0), CEGUI::UDim(0, 40)));
+    editbox->setProperty("BlinkCaret", "true");
+    root->addChild(button);
+    root->addChild(editbox);
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::GUIContext& context =
+        system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+    context.setRootWindow(root);
+    context.setSelectiveUpdateEnabled(true);
+
+    auto pulse = [&]()
+    {
+        context.injectTimePulse(0.1f);
+        system.renderAllGUIContexts();
+        return context.getFrameStats().d_windowsUpdated;
+    };
+
+    // the whole tree is updated once, then nothing asks for updates
+    BOOST_CHECK_EQUAL(pulse(), 3u);
+    BOOST_CHECK_EQUAL(pulse(), 0u);
+    BOOST_CHECK(context.isIdle());
+
+    // a focused editbox keeps blinking its caret
+    editbox->activate();
+    BOOST_CHECK(pulse() >= 1u);
+    BOOST_CHECK_EQUAL(pulse(), 1u);
+    BOOST_CHECK(!context.isIdle());
+
+    editbox->deactivate();
+    pulse();
+    BOOST_CHECK_EQUAL(pulse(), 0u);
+    BOOST_CHECK(context.isIdle());
+
+    // subscribers of EventUpdated get their events
+    int updatedCount = 0;
+    button->subscribeEvent(CEGUI::Window::EventUpdated, [&updatedCount]() { ++updatedCount; });
+    pulse();
+    pulse();
+    BOOST_CHECK_EQUAL(updatedCount, 2);
+
+    // windows attached later are updated along with their children
+    CEGUI::Window* child = windowManager.createWindow("DefaultWindow");
+    child->addChild(windowManager.createWindow("DefaultWindow"));
+    root->addChild(child);
+    BOOST_CHECK_EQUAL(pulse(), 3u);
+
+    // hidden windows are skipped
+    button->hide();
+    BOOST_CHECK_EQUAL(pulse(), 0u);
+
+    context.setSelectiveUpdateEnabled(false);
+    BOOST_CHECK(!context.isIdle());
+    context.setRootWindow(nullptr);
+    system.destroyGUIContext(context);
+    windowManager.destroyWindow(root);
+}
+
+BOOST_AUTO_TEST_CASE(WindowsClippedAwayAreNotRedrawn)
+{
+    CEGUI::WindowManager& windowManager = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* root = windowManager.createWindow("DefaultWindow");
+    CEGUI::Window* pane = windowManager.createWindow("DefaultWindow");
+    CEGUI::Window* button = windowManager.createWindow("TaharezLook/Button");
+    root->setSize(CEGUI::USize(CEGUI::UDim(0, 200), CEGUI::UDim(0, 200)));
+    pane->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+    button->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+    pane->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 500), CEGUI::UDim(0, 500)));
+    root->addChild(pane);
+    pane->addChild(button);
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::GUIContext& context = system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+    context.setRootWindow(root);
+
+    // the pane and the button in it lie outside of the root, only the root is built
+    system.renderAllGUIContexts();
+    BOOST_CHECK_EQUAL(context.getFrameStats().d_windowsRedrawn, 1u);
+    BOOST_CHECK_EQUAL(context.getFrameStats().d_windowsCulled, 1u);
+
+    pane->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 10), CEGUI::UDim(0, 10)));
+    system.renderAllGUIContexts();
+    BOOST_CHECK(context.getFrameStats().d_windowsRedrawn >= 2u);
+    BOOST_CHECK_EQUAL(context.getFrameStats().d_windowsCulled, 0u);
+
+    context.setRootWindow(nullptr);
+    system.destroyGUIContext(context);
+    windowManager.destroyWindow(root);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,369 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Config.h"
+
+#ifdef CEGUI_HAS_FREETYPE
+
+#include "CEGUI/FreeTypeFont.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/TaskScheduler.h"
+#include "CEGUI/BakedFont.h"
+#include "CEGUI/DefaultResourceProvider.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+namespace
+{
+struct FreeTypeFontFixture
+{
+    FreeTypeFontFixture()
+    {
+        d_font = static_cast<CEGUI::FreeTypeFont*>(&CEGUI::FontManager::getSingleton().createFreeTypeFont(
+            "AsyncRasterisationSans", 13.f, CEGUI::FontSizeUnit::Pixels, true, "DejaVuSans.ttf"));
+        d_font->setAsynchronousRasterisation(true);
+    }
+
+    ~FreeTypeFontFixture()
+    {
+        CEGUI::FontManager::getSingleton().destroy(*d_font);
+    }
+
+    void layOut(const CEGUI::String& text) const
+    {
+        CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+        for (CEGUI::GeometryBuffer* buffer : d_font->createTextRenderGeometry(text,
+                glm::vec2(0.f, 0.f), nullptr, false, CEGUI::ColourRect(),
+                CEGUI::DefaultParagraphDirection::LeftToRight))
+        {
+            renderer->destroyGeometryBuffer(*buffer);
+        }
+    }
+
+    const CEGUI::FontGlyph* getGlyph(char32_t codePoint) const
+    {
+        return d_font->getGlyphForCodepoint(codePoint);
+    }
+
+    CEGUI::FreeTypeFont* d_font;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(FreeTypeFont, FreeTypeFontFixture)
+
+BOOST_AUTO_TEST_CASE(AsynchronousGlyphsAreBlankUntilProcessed)
+{
+    const float extentBefore = d_font->getTextAdvance("Hi");
+
+    layOut("Hi");
+    // The metrics are known right away, so the layout does not change later
+    BOOST_CHECK(getGlyph(U'H')->getAdvance() > 0.f);
+    BOOST_CHECK(getGlyph(U'H')->getImage() == nullptr);
+    BOOST_CHECK_EQUAL(d_font->getTextAdvance("Hi"), extentBefore);
+
+    CEGUI::FreeTypeFont::processRasterisedGlyphs();
+    BOOST_CHECK(getGlyph(U'H')->getImage() != nullptr);
+    BOOST_CHECK(getGlyph(U'i')->getImage() != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(PrewarmedRange)
+{
+    const size_t layersBefore = d_font->getRasterisedGlyphLayerCount();
+    d_font->prepareGlyphRange(U'0', U'9');
+    CEGUI::FreeTypeFont::processRasterisedGlyphs();
+
+    for (char32_t codePoint = U'0'; codePoint <= U'9'; ++codePoint)
+        BOOST_CHECK(getGlyph(codePoint)->getImage() != nullptr);
+    BOOST_CHECK(getGlyph(U'A')->getImage() == nullptr);
+    BOOST_CHECK_EQUAL(d_font->getRasterisedGlyphLayerCount(), layersBefore + 10);
+    BOOST_CHECK(d_font->getRasterisationTime() > 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(PreparedCharset)
+{
+    d_font->setAsynchronousRasterisation(false);
+
+    d_font->prepareGlyphs("abcabc");
+    BOOST_CHECK(getGlyph(U'a')->getImage() != nullptr);
+    BOOST_CHECK(getGlyph(U'c')->getImage() != nullptr);
+    BOOST_CHECK(getGlyph(U'd')->getImage() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(RasterisedOnWorkerThreads)
+{
+    CEGUI::ThreadPoolTaskScheduler scheduler(2);
+    CEGUI::System::getSingleton().setTaskScheduler(&scheduler);
+
+    d_font->prepareGlyphs("The quick brown fox jumps over the lazy dog");
+    for (int i = 0; i < 1000 && !getGlyph(U'z')->getImage(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        CEGUI::FreeTypeFont::processRasterisedGlyphs();
+    }
+    BOOST_CHECK(getGlyph(U'T')->getImage() != nullptr);
+    BOOST_CHECK(getGlyph(U'z')->getImage() != nullptr);
+
+    // A font destroyed while rasterising waits for its task
+    d_font->prepareGlyphRange(U'\u00C0', U'\u00FF');
+    CEGUI::FontManager::getSingleton().destroy(*d_font);
+    d_font = static_cast<CEGUI::FreeTypeFont*>(&CEGUI::FontManager::getSingleton().createFreeTypeFont(
+        "AsyncRasterisationSans", 13.f, CEGUI::FontSizeUnit::Pixels, true, "DejaVuSans.ttf"));
+
+    CEGUI::System::getSingleton().setTaskScheduler(nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(DistanceFieldFallsBackWithoutShaderSupport)
+{
+    const CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    BOOST_REQUIRE(!renderer->isDefaultShaderTypeSupported(CEGUI::DefaultShaderType::DistanceField));
+
+    d_font->setAsynchronousRasterisation(false);
+    d_font->setDistanceField(true);
+    BOOST_CHECK(d_font->isDistanceField());
+    BOOST_CHECK(!d_font->isDistanceFieldActive());
+
+    // The glyphs are still rendered as plain bitmaps
+    layOut("Hi");
+    BOOST_CHECK(getGlyph(U'H')->getImage() != nullptr);
+    BOOST_CHECK_EQUAL(d_font->getProperty("DistanceField"), "true");
+}
+
+BOOST_AUTO_TEST_CASE(LayersStaySeparateWithoutShaderSupport)
+{
+    const CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    BOOST_REQUIRE(!renderer->isDefaultShaderTypeSupported(CEGUI::DefaultShaderType::LayeredGlyph));
+
+    CEGUI::FreeTypeFont& font = static_cast<CEGUI::FreeTypeFont&>(
+        CEGUI::FontManager::getSingleton().createFreeTypeFont(
+            "OutlinedSans", 13.f, CEGUI::FontSizeUnit::Pixels, true, "DejaVuSans.ttf", "",
+            CEGUI::AutoScaledMode::Disabled, CEGUI::Sizef(640.f, 480.f), 0.f,
+            { CEGUI::FreeTypeFontLayer(), CEGUI::FreeTypeFontLayer(CEGUI::FontLayerType::Outline, 2) }));
+    font.setAsynchronousRasterisation(false);
+    BOOST_CHECK(!font.isLayerPackingActive());
+
+    // Each layer keeps an image of its own
+    for (CEGUI::GeometryBuffer* buffer : font.createTextRenderGeometry("a",
+            glm::vec2(0.f, 0.f), nullptr, false, CEGUI::ColourRect(),
+            CEGUI::DefaultParagraphDirection::LeftToRight))
+    {
+        BOOST_CHECK(buffer->getLayerColours() == glm::mat4(0.0f));
+        CEGUI::System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
+    }
+    const CEGUI::FontGlyph* glyph = font.getGlyphForCodepoint('a');
+    BOOST_CHECK(glyph->getImage(0) != nullptr);
+    BOOST_CHECK(glyph->getImage(1) != nullptr);
+    BOOST_CHECK(glyph->getImage(0) != glyph->getImage(1));
+
+    CEGUI::FontManager::getSingleton().destroy(font);
+}
+
+BOOST_AUTO_TEST_CASE(Latin1MetricsFollowSizeChanges)
+{
+    d_font->setAsynchronousRasterisation(false);
+
+    const float advance = d_font->getTextAdvance("Latin");
+    BOOST_CHECK(advance > 0.f);
+    BOOST_CHECK_EQUAL(d_font->getTextAdvance("Latin"), advance);
+    BOOST_CHECK(d_font->getTextExtent("Latin") >= advance - 1.f);
+    BOOST_CHECK_EQUAL(d_font->getCharAtPixel("Latin", advance + 1.f), 5u);
+
+    d_font->setSize(26.f);
+    BOOST_CHECK(d_font->getTextAdvance("Latin") > advance);
+}
+
+BOOST_AUTO_TEST_CASE(RescaledLazilyOnDisplaySizeChange)
+{
+    CEGUI::FreeTypeFont& font = static_cast<CEGUI::FreeTypeFont&>(
+        CEGUI::FontManager::getSingleton().createFreeTypeFont(
+            "RescaledSans", 13.f, CEGUI::FontSizeUnit::Pixels, true, "DejaVuSans.ttf", "",
+            CEGUI::AutoScaledMode::Vertical, CEGUI::Sizef(640.f, 480.f)));
+    font.notifyDisplaySizeChanged(CEGUI::Sizef(640.f, 480.f));
+
+    int renderSizeChanges = 0;
+    font.subscribeEvent(CEGUI::Font::EventRenderSizeChanged,
+        [&renderSizeChanges]() { ++renderSizeChanges; });
+
+    const auto layOut = [&font](const CEGUI::String& text)
+    {
+        CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+        for (CEGUI::GeometryBuffer* buffer : font.createTextRenderGeometry(text,
+                glm::vec2(0.f, 0.f), nullptr, false, CEGUI::ColourRect(),
+                CEGUI::DefaultParagraphDirection::LeftToRight))
+        {
+            renderer->destroyGeometryBuffer(*buffer);
+        }
+    };
+
+    layOut("a");
+    const float height = font.getFontHeight();
+    const CEGUI::Image* image = font.getGlyphForCodepoint('a')->getImage();
+    BOOST_CHECK(image != nullptr);
+
+    // a vertically scaled font ignores changes of width
+    font.notifyDisplaySizeChanged(CEGUI::Sizef(1280.f, 480.f));
+    BOOST_CHECK_EQUAL(renderSizeChanges, 0);
+    BOOST_CHECK_EQUAL(font.getGlyphForCodepoint('a')->getImage(), image);
+
+    // rescaled glyphs are rasterised again only when they are used
+    font.notifyDisplaySizeChanged(CEGUI::Sizef(1280.f, 960.f));
+    BOOST_CHECK_EQUAL(renderSizeChanges, 1);
+    BOOST_CHECK(font.getFontHeight() > height);
+    BOOST_CHECK(font.getGlyphForCodepoint('a')->getImage() == nullptr);
+
+    layOut("a");
+    BOOST_CHECK(font.getGlyphForCodepoint('a')->getImage() != nullptr);
+    BOOST_CHECK(font.getGlyphForCodepoint('b')->getImage() == nullptr);
+
+    CEGUI::FontManager::getSingleton().destroy(font);
+}
+
+BOOST_AUTO_TEST_CASE(TextLayoutIsReused)
+{
+    d_font->setAsynchronousRasterisation(false);
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+
+    float advance = 0.f;
+    for (CEGUI::GeometryBuffer* buffer : d_font->createTextRenderGeometry("Buy", advance,
+            glm::vec2(0.f, 0.f), nullptr, false, CEGUI::ColourRect(),
+            CEGUI::DefaultParagraphDirection::LeftToRight))
+    {
+        renderer->destroyGeometryBuffer(*buffer);
+    }
+    const size_t layoutsBefore = CEGUI::Font::getTextLayoutCount();
+
+    // The same text drawn elsewhere reuses the layout, only translated
+    float nextPenPosX = 0.f;
+    std::vector<CEGUI::GeometryBuffer*> buffers = d_font->createTextRenderGeometry("Buy",
+        nextPenPosX, glm::vec2(100.f, 40.f), nullptr, false, CEGUI::ColourRect(),
+        CEGUI::DefaultParagraphDirection::LeftToRight);
+    BOOST_CHECK_EQUAL(CEGUI::Font::getTextLayoutCount(), layoutsBefore);
+    BOOST_CHECK(!buffers.empty());
+    BOOST_CHECK_CLOSE(nextPenPosX, 100.f + advance, 0.01f);
+    for (CEGUI::GeometryBuffer* buffer : buffers)
+        renderer->destroyGeometryBuffer(*buffer);
+
+    // So does the same text drawn in other colours, such as on hover
+    buffers = d_font->createTextRenderGeometry("Buy", nextPenPosX, glm::vec2(0.f, 0.f),
+        nullptr, false, CEGUI::ColourRect(CEGUI::Colour(1.f, 0.f, 0.f)),
+        CEGUI::DefaultParagraphDirection::LeftToRight);
+    BOOST_CHECK_EQUAL(CEGUI::Font::getTextLayoutCount(), layoutsBefore);
+    BOOST_CHECK(!buffers.empty());
+    for (CEGUI::GeometryBuffer* buffer : buffers)
+        renderer->destroyGeometryBuffer(*buffer);
+
+    // Resizing the font drops its layouts
+    d_font->setSize(20.f);
+    BOOST_CHECK(CEGUI::Font::getTextLayoutCount() < layoutsBefore);
+}
+
+BOOST_AUTO_TEST_CASE(BakedFontMatchesFreeTypeFont)
+{
+    d_font->setAsynchronousRasterisation(false);
+
+    const std::vector<char32_t> codePoints = { U'A', U'V', U'W', U'a', U'y', U' ' };
+    {
+        std::ofstream out("BakedSans.font.bin", std::ios::binary);
+        d_font->writeBakedFont(out, codePoints, 64);
+    }
+
+    auto* rp = static_cast<CEGUI::DefaultResourceProvider*>(
+        CEGUI::System::getSingleton().getResourceProvider());
+    rp->setResourceGroupDirectory("baked_fonts", "./");
+    CEGUI::BakedFont& baked = static_cast<CEGUI::BakedFont&>(
+        CEGUI::FontManager::getSingleton().createBakedFont(
+            "BakedSans", "BakedSans.font.bin", "baked_fonts"));
+    std::remove("BakedSans.font.bin");
+
+    for (const char32_t codePoint : codePoints)
+    {
+        BOOST_REQUIRE(baked.isCodepointAvailable(codePoint));
+        BOOST_CHECK_EQUAL(baked.getGlyphForCodepoint(codePoint)->getAdvance(),
+                          getGlyph(codePoint)->getAdvance());
+    }
+    BOOST_CHECK(!baked.isCodepointAvailable(U'B'));
+    BOOST_CHECK_EQUAL(baked.getLineSpacing(), d_font->getLineSpacing());
+
+    // The kerning pairs are applied to the advance of the text
+    const float advance = baked.getGlyphForCodepoint(U'A')->getAdvance() +
+        baked.getGlyphForCodepoint(U'V')->getAdvance() + baked.getKerning(U'A', U'V');
+    BOOST_CHECK_CLOSE(baked.getTextAdvance("AV"), advance, 0.01f);
+
+    CEGUI::FontManager::getSingleton().destroy(baked);
+    rp->clearResourceGroupDirectory("baked_fonts");
+}
+
+#ifndef CEGUI_USE_RAQM
+BOOST_AUTO_TEST_CASE(KerningIsCachedPerPair)
+{
+    d_font->setAsynchronousRasterisation(false);
+
+    // Measuring and drawing use the same kerning, asking FreeType once per pair
+    const float advance = d_font->getTextAdvance("AVAVA");
+    layOut("AVAVA");
+    const size_t pairCount = d_font->getCachedKerningPairCount();
+    BOOST_CHECK(pairCount <= 2u);
+
+    BOOST_CHECK_EQUAL(d_font->getTextAdvance("VAVAV AV"), d_font->getTextAdvance("VAVAV AV"));
+    BOOST_CHECK_EQUAL(d_font->getTextAdvance("AVAVA"), advance);
+    BOOST_CHECK(d_font->getCachedKerningPairCount() <= pairCount + 4u);
+
+    // Resizing the font drops its cached kerning
+    d_font->setSize(20.f);
+    BOOST_CHECK_EQUAL(d_font->getCachedKerningPairCount(), 0u);
+}
+#endif
+
+#ifdef CEGUI_USE_RAQM
+BOOST_AUTO_TEST_CASE(ShapedTextIsShared)
+{
+    const size_t shapedBefore = CEGUI::FreeTypeFont::getShapedRunCount();
+
+    // Measuring and drawing the same text shapes it only once
+    const float advance = d_font->getTextAdvance("Shaped");
+    layOut("Shaped");
+    BOOST_CHECK_EQUAL(CEGUI::FreeTypeFont::getShapedRunCount(), shapedBefore + 1);
+    BOOST_CHECK(advance > 0.f);
+    BOOST_CHECK_EQUAL(d_font->getCharAtPixel("Shaped", advance + 1.f), 6u);
+
+    // Resizing the font drops its shaped texts
+    d_font->setSize(20.f);
+    BOOST_CHECK_EQUAL(CEGUI::FreeTypeFont::getShapedRunCount(), shapedBefore);
+    BOOST_CHECK(d_font->getTextAdvance("Shaped") > advance);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,145 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Config.h"
+
+#ifdef CEGUI_HAS_FREETYPE
+
+#include "CEGUI/FreeTypeFont.h"
+#include "CEGUI/FreeTypeGlyphAtlas.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+struct FreeTypeGlyphAtlasFixture
+{
+    FreeTypeGlyphAtlasFixture()
+    {
+        // Start from an empty atlas, whatever the previous tests rasterised
+        CEGUI::FreeTypeGlyphAtlas::setMemoryBudget(0);
+        CEGUI::FreeTypeGlyphAtlas::notifyFrameEnded();
+        CEGUI::FreeTypeGlyphAtlas::notifyFrameEnded();
+        CEGUI::FreeTypeGlyphAtlas::setMemoryBudget(CEGUI::FreeTypeGlyphAtlas::DefaultMemoryBudget);
+
+        CEGUI::FontManager& fontManager = CEGUI::FontManager::getSingleton();
+        d_sans = static_cast<CEGUI::FreeTypeFont*>(&fontManager.createFreeTypeFont(
+            "GlyphAtlasSans", 10.f, CEGUI::FontSizeUnit::Pixels, true, "DejaVuSans.ttf"));
+        d_serif = static_cast<CEGUI::FreeTypeFont*>(&fontManager.createFreeTypeFont(
+            "GlyphAtlasSerif", 11.f, CEGUI::FontSizeUnit::Pixels, true, "DejaVuSerif.ttf"));
+    }
+
+    ~FreeTypeGlyphAtlasFixture()
+    {
+        CEGUI::FreeTypeGlyphAtlas::setMemoryBudget(CEGUI::FreeTypeGlyphAtlas::DefaultMemoryBudget);
+        CEGUI::FontManager::getSingleton().destroy(*d_serif);
+        CEGUI::FontManager::getSingleton().destroy(*d_sans);
+    }
+
+    //! Lays out the text, which rasterises its glyphs, and drops the geometry.
+    static void layOut(const CEGUI::Font& font, const CEGUI::String& text)
+    {
+        CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+        for (CEGUI::GeometryBuffer* buffer : font.createTextRenderGeometry(text,
+                glm::vec2(0.f, 0.f), nullptr, false, CEGUI::ColourRect(),
+                CEGUI::DefaultParagraphDirection::LeftToRight))
+        {
+            renderer->destroyGeometryBuffer(*buffer);
+        }
+    }
+
+    static const CEGUI::Texture* getGlyphTexture(const CEGUI::FreeTypeFont& font, char32_t codePoint)
+    {
+        const CEGUI::Image* image = font.getGlyphForCodepoint(codePoint)->getImage();
+        return image ? static_cast<const CEGUI::BitmapImage*>(image)->getTexture() : nullptr;
+    }
+
+    CEGUI::FreeTypeFont* d_sans;
+    CEGUI::FreeTypeFont* d_serif;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(FreeTypeGlyphAtlas, FreeTypeGlyphAtlasFixture)
+
+BOOST_AUTO_TEST_CASE(FontsSharePages)
+{
+    layOut(*d_sans, "Ag");
+    layOut(*d_serif, "Ag");
+
+    const CEGUI::Texture* texture = getGlyphTexture(*d_sans, U'A');
+    BOOST_REQUIRE(texture != nullptr);
+    BOOST_CHECK(getGlyphTexture(*d_sans, U'g') == texture);
+    BOOST_CHECK(getGlyphTexture(*d_serif, U'A') == texture);
+    BOOST_CHECK(getGlyphTexture(*d_serif, U'g') == texture);
+
+    // The glyphs of the two fonts must not overlap
+    const CEGUI::Rectf sansArea = d_sans->getGlyphForCodepoint(U'A')->getImage()->getImageArea();
+    const CEGUI::Rectf serifArea = d_serif->getGlyphForCodepoint(U'A')->getImage()->getImageArea();
+    BOOST_CHECK(sansArea.getIntersection(serifArea).getSize() == CEGUI::Sizef(0.f, 0.f));
+}
+
+BOOST_AUTO_TEST_CASE(ReleasedFontKeepsOtherGlyphs)
+{
+    layOut(*d_sans, "Ag");
+    layOut(*d_serif, "Ag");
+    const CEGUI::Texture* texture = getGlyphTexture(*d_sans, U'A');
+
+    CEGUI::FontManager::getSingleton().destroy(*d_serif);
+    d_serif = static_cast<CEGUI::FreeTypeFont*>(&CEGUI::FontManager::getSingleton().createFreeTypeFont(
+        "GlyphAtlasSerif", 11.f, CEGUI::FontSizeUnit::Pixels, true, "DejaVuSerif.ttf"));
+
+    BOOST_CHECK(getGlyphTexture(*d_sans, U'A') == texture);
+    BOOST_CHECK(getGlyphTexture(*d_serif, U'A') == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(EvictsPagesUnusedDuringTheFrame)
+{
+    CEGUI::FreeTypeGlyphAtlas::setMemoryBudget(0);
+
+    layOut(*d_sans, "Ag");
+    // Used during the frame that ends, so the page survives the budget
+    CEGUI::FreeTypeGlyphAtlas::notifyFrameEnded();
+    BOOST_CHECK(getGlyphTexture(*d_sans, U'A') != nullptr);
+
+    // Nothing used it during this frame
+    CEGUI::FreeTypeGlyphAtlas::notifyFrameEnded();
+    BOOST_CHECK(getGlyphTexture(*d_sans, U'A') == nullptr);
+    BOOST_CHECK_EQUAL(CEGUI::FreeTypeGlyphAtlas::getInstance()->getPageCount(), 0u);
+
+    // Evicted glyphs are rasterised again when laid out
+    layOut(*d_sans, "A");
+    BOOST_CHECK(getGlyphTexture(*d_sans, U'A') != nullptr);
+    BOOST_CHECK(getGlyphTexture(*d_sans, U'g') == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,421 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/ClipRegion.h"
+#include "CEGUI/RenderMaterial.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/Vertex.h"
+#include "CEGUI/Exceptions.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <vector>
+
+namespace
+{
+//! Stores quad instances the way renderers with instancing support do.
+class InstancingGeometryBuffer : public CEGUI::GeometryBuffer
+{
+public:
+    InstancingGeometryBuffer() :
+        CEGUI::GeometryBuffer(CEGUI::System::getSingleton().getRenderer()->
+            createRenderMaterial(CEGUI::DefaultShaderType::Textured))
+    {
+        addVertexAttribute(CEGUI::VertexAttributeType::Position0);
+        addVertexAttribute(CEGUI::VertexAttributeType::Colour0);
+        addVertexAttribute(CEGUI::VertexAttributeType::TexCoord0);
+    }
+
+    void draw(std::uint32_t) const override {}
+
+    void appendQuadInstance(const CEGUI::Rectf& destRect, const CEGUI::Rectf& texRect,
+                            const CEGUI::Colour& colour) override
+    {
+        if (getVertexCount() != 0)
+        {
+            CEGUI::GeometryBuffer::appendQuadInstance(destRect, texRect, colour);
+            return;
+        }
+
+        const QuadInstance instance = { destRect, texRect, colour };
+        d_instances.push_back(instance);
+    }
+
+    std::size_t getQuadInstanceCount() const override { return d_instances.size(); }
+    bool isQuadInstancingSupported() const override { return true; }
+
+protected:
+    void convertQuadInstancesToVertices() override
+    {
+        std::vector<QuadInstance> instances;
+        instances.swap(d_instances);
+
+        for (const QuadInstance& instance : instances)
+            CEGUI::GeometryBuffer::appendQuadInstance(instance.d_destRect,
+                instance.d_texRect, instance.d_colour);
+    }
+
+    struct QuadInstance
+    {
+        CEGUI::Rectf d_destRect;
+        CEGUI::Rectf d_texRect;
+        CEGUI::Colour d_colour;
+    };
+
+    std::vector<QuadInstance> d_instances;
+};
+
+//! Returns the x position of the first vertex of each quad of six vertices.
+std::vector<float> getQuadLefts(const CEGUI::GeometryBuffer& buffer)
+{
+    std::vector<float> lefts;
+    const std::vector<float>& data = buffer.getVertexData();
+    for (std::size_t i = 0; i < data.size(); i += 6 * 9)
+        lefts.push_back(data[i]);
+
+    return lefts;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(GeometryBuffer)
+
+BOOST_AUTO_TEST_CASE(QuadInstanceFallsBackToVertices)
+{
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    CEGUI::GeometryBuffer& buffer = renderer->createGeometryBufferTextured();
+
+    buffer.appendQuadInstance(CEGUI::Rectf(10.0f, 20.0f, 30.0f, 60.0f),
+                              CEGUI::Rectf(0.0f, 0.0f, 0.5f, 1.0f),
+                              CEGUI::Colour(1.0f, 0.5f, 0.25f, 1.0f));
+
+    // renderers without instancing receive the quad as two triangles
+    BOOST_CHECK_EQUAL(buffer.getQuadInstanceCount(), 0u);
+    BOOST_CHECK_EQUAL(buffer.getVertexCount(), 6u);
+
+    const std::vector<float>& data = buffer.getVertexData();
+    BOOST_REQUIRE_EQUAL(data.size(), 6u * 9u);
+    // top-left position, colour and texture coordinates of the first vertex
+    BOOST_CHECK_EQUAL(data[0], 10.0f);
+    BOOST_CHECK_EQUAL(data[1], 20.0f);
+    BOOST_CHECK_EQUAL(data[4], 0.5f);
+    BOOST_CHECK_EQUAL(data[7], 0.0f);
+    // bottom-right is the third vertex
+    BOOST_CHECK_EQUAL(data[18], 30.0f);
+    BOOST_CHECK_EQUAL(data[19], 60.0f);
+    BOOST_CHECK_EQUAL(data[25], 0.5f);
+    BOOST_CHECK_EQUAL(data[26], 1.0f);
+
+    renderer->destroyGeometryBuffer(buffer);
+}
+
+BOOST_AUTO_TEST_CASE(SingleColouredQuadsAreInstanced)
+{
+    InstancingGeometryBuffer buffer;
+
+    const CEGUI::Rectf destAreas[2] =
+    {
+        CEGUI::Rectf(0.0f, 0.0f, 10.0f, 10.0f),
+        CEGUI::Rectf(20.0f, 0.0f, 30.0f, 10.0f)
+    };
+    const CEGUI::Rectf texAreas[2] =
+    {
+        CEGUI::Rectf(0.0f, 0.0f, 1.0f, 1.0f),
+        CEGUI::Rectf(0.0f, 0.0f, 1.0f, 1.0f)
+    };
+    const CEGUI::ColourRect colours[2] =
+    {
+        CEGUI::ColourRect(CEGUI::Colour(1.0f, 0.0f, 0.0f, 1.0f)),
+        CEGUI::ColourRect(CEGUI::Colour(0.0f, 0.0f, 1.0f, 1.0f))
+    };
+
+    buffer.appendTexturedQuads(destAreas, texAreas, colours, 2, nullptr);
+    BOOST_CHECK_EQUAL(buffer.getQuadInstanceCount(), 2u);
+    BOOST_CHECK_EQUAL(buffer.getVertexCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(MixedQuadsKeepTheirOrder)
+{
+    InstancingGeometryBuffer buffer;
+
+    const CEGUI::Colour red(1.0f, 0.0f, 0.0f, 1.0f);
+    const CEGUI::Colour blue(0.0f, 0.0f, 1.0f, 1.0f);
+    const CEGUI::Rectf destAreas[3] =
+    {
+        CEGUI::Rectf(0.0f, 0.0f, 10.0f, 10.0f),
+        CEGUI::Rectf(20.0f, 0.0f, 30.0f, 10.0f),
+        CEGUI::Rectf(40.0f, 0.0f, 50.0f, 10.0f)
+    };
+    const CEGUI::Rectf texAreas[3] =
+    {
+        CEGUI::Rectf(0.0f, 0.0f, 1.0f, 1.0f),
+        CEGUI::Rectf(0.0f, 0.0f, 1.0f, 1.0f),
+        CEGUI::Rectf(0.0f, 0.0f, 1.0f, 1.0f)
+    };
+    const CEGUI::ColourRect colours[3] =
+    {
+        CEGUI::ColourRect(red),
+        CEGUI::ColourRect(red, blue, red, blue),
+        CEGUI::ColourRect(blue)
+    };
+
+    // an outline added as an instance is followed by a gradient fill
+    buffer.appendQuadInstance(CEGUI::Rectf(100.0f, 0.0f, 110.0f, 10.0f), texAreas[0], blue);
+    BOOST_CHECK_EQUAL(buffer.getQuadInstanceCount(), 1u);
+
+    // instances are drawn after vertices, so the gradient turns them into vertices
+    buffer.appendTexturedQuads(destAreas, texAreas, colours, 3, nullptr);
+    BOOST_CHECK_EQUAL(buffer.getQuadInstanceCount(), 0u);
+    BOOST_REQUIRE_EQUAL(buffer.getVertexCount(), 4u * 6u);
+
+    const std::vector<float> lefts(getQuadLefts(buffer));
+    const float expectedLefts[4] = { 100.0f, 0.0f, 20.0f, 40.0f };
+    BOOST_CHECK_EQUAL_COLLECTIONS(lefts.begin(), lefts.end(), expectedLefts, expectedLefts + 4);
+
+    // red of the first quad of the batch, blue of the outline before it
+    const std::vector<float>& data = buffer.getVertexData();
+    BOOST_CHECK_EQUAL(data[3], 0.0f);
+    BOOST_CHECK_EQUAL(data[5], 1.0f);
+    BOOST_CHECK_EQUAL(data[6 * 9 + 3], 1.0f);
+
+    // single coloured quads following vertices are appended as vertices
+    buffer.appendQuadInstance(CEGUI::Rectf(60.0f, 0.0f, 70.0f, 10.0f), texAreas[0], red);
+    BOOST_CHECK_EQUAL(buffer.getQuadInstanceCount(), 0u);
+    BOOST_CHECK_EQUAL(getQuadLefts(buffer).back(), 60.0f);
+}
+
+BOOST_AUTO_TEST_CASE(IndexedQuadsConvertToTriangles)
+{
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    CEGUI::GeometryBuffer& buffer = renderer->createGeometryBufferTextured();
+    buffer.setQuadIndexingEnabled(true);
+
+    CEGUI::TexturedColouredVertex corners[4];
+    for (int i = 0; i < 4; ++i)
+        corners[i].d_position = glm::vec3(static_cast<float>(i), 0.0f, 0.0f);
+
+    buffer.appendQuad(corners);
+    buffer.appendQuad(corners);
+    BOOST_CHECK(buffer.isUsingQuadIndices());
+    BOOST_CHECK_EQUAL(buffer.getVertexCount(), 8u);
+
+    // any other geometry turns the quads back into triangles
+    buffer.appendGeometry(corners, 3);
+    BOOST_CHECK(!buffer.isUsingQuadIndices());
+    BOOST_REQUIRE_EQUAL(buffer.getVertexCount(), 15u);
+
+    const float expectedX[6] = { 0.0f, 1.0f, 2.0f, 3.0f, 0.0f, 2.0f };
+    for (int i = 0; i < 6; ++i)
+        BOOST_CHECK_EQUAL(buffer.getVertexData()[i * 9], expectedX[i]);
+
+    renderer->destroyGeometryBuffer(buffer);
+}
+
+BOOST_AUTO_TEST_CASE(CopyClippedGeometryInterpolatesTexCoords)
+{
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    CEGUI::GeometryBuffer& source = renderer->createGeometryBufferTextured();
+    CEGUI::GeometryBuffer& clipped = renderer->createGeometryBufferTextured();
+
+    source.appendQuadInstance(CEGUI::Rectf(0.0f, 0.0f, 100.0f, 10.0f),
+                              CEGUI::Rectf(0.0f, 0.0f, 1.0f, 1.0f),
+                              CEGUI::Colour(1.0f, 1.0f, 1.0f, 1.0f));
+    source.appendQuadInstance(CEGUI::Rectf(200.0f, 0.0f, 300.0f, 10.0f),
+                              CEGUI::Rectf(0.0f, 0.0f, 1.0f, 1.0f),
+                              CEGUI::Colour(1.0f, 1.0f, 1.0f, 1.0f));
+
+    // the second quad lies outside and is dropped, the first one is halved
+    clipped.copyClippedGeometryFrom(source, CEGUI::Rectf(0.0f, 0.0f, 50.0f, 10.0f));
+    BOOST_REQUIRE_EQUAL(clipped.getVertexCount(), 6u);
+
+    const std::vector<float>& data = clipped.getVertexData();
+    for (std::size_t i = 0; i < 6; ++i)
+    {
+        const float x = data[i * 9];
+        const float u = data[i * 9 + 7];
+        BOOST_CHECK(x == 0.0f || x == 50.0f);
+        BOOST_CHECK_CLOSE(u, x / 100.0f, 0.001f);
+    }
+
+    // the source is left as it was
+    BOOST_CHECK_EQUAL(source.getVertexCount(), 12u);
+
+    renderer->destroyGeometryBuffer(clipped);
+    renderer->destroyGeometryBuffer(source);
+}
+
+BOOST_AUTO_TEST_CASE(TexturedQuadsAreClippedInOneBatch)
+{
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    CEGUI::GeometryBuffer& buffer = renderer->createGeometryBufferTextured();
+    buffer.setQuadIndexingEnabled(true);
+
+    const CEGUI::Rectf destAreas[3] =
+    {
+        CEGUI::Rectf(0.0f, 0.0f, 100.0f, 10.0f),
+        CEGUI::Rectf(200.0f, 0.0f, 300.0f, 10.0f),
+        CEGUI::Rectf(10.0f, 5.0f, 20.0f, 15.0f)
+    };
+    const CEGUI::Rectf texAreas[3] =
+    {
+        CEGUI::Rectf(0.0f, 0.0f, 1.0f, 1.0f),
+        CEGUI::Rectf(0.0f, 0.0f, 1.0f, 1.0f),
+        CEGUI::Rectf(0.0f, 0.0f, 0.5f, 0.5f)
+    };
+    const CEGUI::ColourRect colours[3] =
+    {
+        CEGUI::ColourRect(CEGUI::Colour(1.0f, 0.0f, 0.0f, 1.0f)),
+        CEGUI::ColourRect(CEGUI::Colour(0.0f, 1.0f, 0.0f, 1.0f)),
+        CEGUI::ColourRect(CEGUI::Colour(0.0f, 0.0f, 1.0f, 1.0f))
+    };
+    const CEGUI::Rectf clipArea(0.0f, 0.0f, 50.0f, 10.0f);
+
+    // the second quad lies outside and is skipped
+    buffer.appendTexturedQuads(destAreas, texAreas, colours, 3, &clipArea);
+    BOOST_CHECK(buffer.isUsingQuadIndices());
+    BOOST_REQUIRE_EQUAL(buffer.getVertexCount(), 8u);
+
+    const std::vector<float>& data = buffer.getVertexData();
+    // the first quad is halved, along with its texture coordinates
+    BOOST_CHECK_EQUAL(data[2 * 9], 50.0f);
+    BOOST_CHECK_CLOSE(data[2 * 9 + 7], 0.5f, 0.001f);
+    BOOST_CHECK_EQUAL(data[3], 1.0f);
+    // the bottom of the third quad is cut at 10
+    BOOST_CHECK_EQUAL(data[4 * 9], 10.0f);
+    BOOST_CHECK_EQUAL(data[5 * 9 + 1], 10.0f);
+    BOOST_CHECK_CLOSE(data[5 * 9 + 8], 0.25f, 0.001f);
+    BOOST_CHECK_EQUAL(data[4 * 9 + 5], 1.0f);
+
+    renderer->destroyGeometryBuffer(buffer);
+}
+
+BOOST_AUTO_TEST_CASE(QuadIndicesContinuePattern)
+{
+    std::vector<std::uint32_t> indices;
+    CEGUI::GeometryBuffer::appendQuadIndices(indices, 1);
+    CEGUI::GeometryBuffer::appendQuadIndices(indices, 1);
+
+    const std::uint32_t expected[12] = { 0, 1, 2, 3, 0, 2, 4, 5, 6, 7, 4, 6 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(indices.begin(), indices.end(),
+                                  expected, expected + 12);
+}
+
+BOOST_AUTO_TEST_CASE(ClippingMaskIsKeptAndCleared)
+{
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    CEGUI::GeometryBuffer& buffer = renderer->createGeometryBufferColoured();
+    CEGUI::GeometryBuffer& other = renderer->createGeometryBufferColoured();
+    BOOST_REQUIRE(buffer.isClippingMaskSupported());
+
+    BOOST_CHECK(buffer.getClippingMaskType() == CEGUI::ClippingMaskType::NoMask);
+    BOOST_CHECK(buffer.hasEquivalentClippingMask(other));
+
+    const CEGUI::Rectf area(10.0f, 10.0f, 50.0f, 30.0f);
+    buffer.setClippingMask(area, 100.0f);
+    BOOST_CHECK(buffer.getClippingMaskType() == CEGUI::ClippingMaskType::RoundedRect);
+    BOOST_CHECK(buffer.getClippingMaskArea() == area);
+    BOOST_CHECK(!buffer.hasEquivalentClippingMask(other));
+
+    // the radius is limited to half the height of the area
+    other.setClippingMask(area, 10.0f);
+    BOOST_CHECK(buffer.hasEquivalentClippingMask(other));
+    other.setClippingMask(area, 5.0f);
+    BOOST_CHECK(!buffer.hasEquivalentClippingMask(other));
+
+    BOOST_CHECK_THROW(buffer.setClippingMask(area, nullptr, CEGUI::Rectf(0.0f, 0.0f, 1.0f, 1.0f)),
+                      CEGUI::InvalidRequestException);
+
+    buffer.clearClippingMask();
+    BOOST_CHECK(buffer.getClippingMaskType() == CEGUI::ClippingMaskType::NoMask);
+
+    renderer->destroyGeometryBuffer(other);
+    renderer->destroyGeometryBuffer(buffer);
+}
+
+BOOST_AUTO_TEST_CASE(SharedClipRegionAppliesToAllBuffers)
+{
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    CEGUI::GeometryBuffer& first = renderer->createGeometryBufferColoured();
+    CEGUI::GeometryBuffer& second = renderer->createGeometryBufferColoured();
+    first.setClippingActive(true);
+    second.setClippingActive(true);
+
+    auto clipRegion = std::make_shared<CEGUI::ClipRegion>();
+    clipRegion->setRegion(CEGUI::Rectf(-10.0f, 0.0f, 50.0f, 40.0f));
+    first.setClipRegion(clipRegion);
+    second.setClipRegion(clipRegion);
+
+    BOOST_CHECK_EQUAL(first.getClippingRegion(), CEGUI::Rectf(-10.0f, 0.0f, 50.0f, 40.0f));
+    BOOST_CHECK_EQUAL(first.getPreparedClippingRegion(), CEGUI::Rectf(0.0f, 0.0f, 50.0f, 40.0f));
+    BOOST_CHECK(first.hasEquivalentClipping(second));
+
+    // updating the shared region does not need the buffers
+    clipRegion->setRegion(CEGUI::Rectf(5.0f, 5.0f, 20.0f, 20.0f));
+    BOOST_CHECK_EQUAL(second.getPreparedClippingRegion(), CEGUI::Rectf(5.0f, 5.0f, 20.0f, 20.0f));
+
+    // an own region releases the shared one
+    second.setClippingRegion(CEGUI::Rectf(0.0f, 0.0f, 10.0f, 10.0f));
+    BOOST_CHECK(!second.getClipRegion());
+    BOOST_CHECK(!first.hasEquivalentClipping(second));
+
+    second.setClippingRegion(CEGUI::Rectf(5.0f, 5.0f, 20.0f, 20.0f));
+    BOOST_CHECK(first.hasEquivalentClipping(second));
+
+    renderer->destroyGeometryBuffer(first);
+    renderer->destroyGeometryBuffer(second);
+}
+
+BOOST_AUTO_TEST_CASE(ModelViewProjMatrixIsCachedUntilTransformChanges)
+{
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    CEGUI::GeometryBuffer& buffer = renderer->createGeometryBufferColoured();
+
+    const glm::mat4 viewProj(glm::scale(glm::mat4(1.0f), glm::vec3(2.0f, 2.0f, 1.0f)));
+    buffer.setTranslation(glm::vec3(10.0f, 20.0f, 0.0f));
+
+    const glm::mat4& matrix = buffer.getModelViewProjMatrix(viewProj);
+    BOOST_CHECK(matrix == viewProj * buffer.getModelMatrix());
+    BOOST_CHECK(buffer.getInverseModelViewProjMatrix(viewProj) * matrix == glm::mat4(1.0f));
+
+    // the cached matrices follow a new transformation of the buffer
+    buffer.setTranslation(glm::vec3(-5.0f, 0.0f, 0.0f));
+    const glm::vec4 origin(buffer.getModelViewProjMatrix(viewProj) * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    BOOST_CHECK_EQUAL(origin.x, -10.0f);
+    BOOST_CHECK_EQUAL(origin.y, 0.0f);
+
+    // and a new view projection matrix
+    const glm::vec4 unscaled(buffer.getModelViewProjMatrix(glm::mat4(1.0f)) * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    BOOST_CHECK_EQUAL(unscaled.x, -5.0f);
+
+    renderer->destroyGeometryBuffer(buffer);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
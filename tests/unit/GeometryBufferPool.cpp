@@ -0,0 +1,152 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/GeometryBufferPool.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(GeometryBufferPool)
+
+BOOST_AUTO_TEST_CASE(RecyclesIssuedBuffers)
+{
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    CEGUI::GeometryBufferPool pool;
+    std::vector<CEGUI::GeometryBuffer*> buffers;
+
+    renderer->setActiveGeometryBufferPool(&pool);
+    CEGUI::GeometryBuffer& first = renderer->createGeometryBufferTextured();
+    first.setAlpha(0.5f);
+    buffers.push_back(&first);
+    renderer->setActiveGeometryBufferPool(nullptr);
+    pool.endPass(buffers);
+
+    BOOST_CHECK_EQUAL(pool.getHitCount(), 0u);
+    BOOST_CHECK_EQUAL(pool.getMissCount(), 1u);
+
+    pool.beginPass(buffers);
+    BOOST_CHECK(buffers.empty());
+    BOOST_CHECK_EQUAL(pool.getFreeBufferCount(), 1u);
+
+    renderer->setActiveGeometryBufferPool(&pool);
+    // a coloured buffer can not be served by a textured one
+    CEGUI::GeometryBuffer& coloured = renderer->createGeometryBufferColoured();
+    CEGUI::GeometryBuffer& second = renderer->createGeometryBufferTextured();
+    renderer->setActiveGeometryBufferPool(nullptr);
+
+    BOOST_CHECK_EQUAL(&second, &first);
+    BOOST_CHECK_NE(&coloured, &first);
+    BOOST_CHECK_EQUAL(second.getVertexCount(), 0u);
+    BOOST_CHECK_EQUAL(pool.getHitCount(), 1u);
+    BOOST_CHECK_EQUAL(pool.getMissCount(), 2u);
+    BOOST_CHECK_CLOSE(pool.getHitRate(), 1.0f / 3.0f, 0.001f);
+
+    buffers.push_back(&second);
+    buffers.push_back(&coloured);
+    pool.endPass(buffers);
+
+    pool.beginPass(buffers);
+    BOOST_CHECK_EQUAL(pool.getFreeBufferCount(), 2u);
+    pool.clear();
+    BOOST_CHECK_EQUAL(pool.getFreeBufferCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(DestroysForeignBuffers)
+{
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    CEGUI::GeometryBufferPool pool;
+    std::vector<CEGUI::GeometryBuffer*> buffers;
+
+    // buffers not handed out through the pool are destroyed instead of kept
+    buffers.push_back(&renderer->createGeometryBufferTextured());
+    pool.endPass(buffers);
+    pool.beginPass(buffers);
+
+    BOOST_CHECK(buffers.empty());
+    BOOST_CHECK_EQUAL(pool.getFreeBufferCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(WindowRedrawReusesBuffers)
+{
+    CEGUI::Window* button = CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/Button");
+    button->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+    button->setText("Button");
+    // imagery kept by the geometry cache would not go through the pool
+    button->getGeometryCache().setCapacity(0);
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::GUIContext& context = system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+    context.setRootWindow(button);
+
+    system.renderAllGUIContexts();
+    const std::size_t bufferCount = button->getGeometryBuffers().size();
+    BOOST_REQUIRE_GT(bufferCount, 0u);
+    BOOST_CHECK_EQUAL(button->getGeometryBufferPool().getHitCount(), 0u);
+
+    button->invalidate();
+    system.renderAllGUIContexts();
+
+    BOOST_CHECK_EQUAL(button->getGeometryBuffers().size(), bufferCount);
+    BOOST_CHECK_EQUAL(button->getGeometryBufferPool().getHitCount(), bufferCount);
+    BOOST_CHECK(system.getRenderer()->getActiveGeometryBufferPool() == nullptr);
+
+    context.setRootWindow(nullptr);
+    system.destroyGUIContext(context);
+    CEGUI::WindowManager::getSingleton().destroyWindow(button);
+}
+
+BOOST_AUTO_TEST_CASE(MoveAndAlphaChangeKeepGeometry)
+{
+    CEGUI::Window* button = CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/Button");
+    button->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+    button->setText("Button");
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::GUIContext& context = system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+    context.setRootWindow(button);
+
+    system.renderAllGUIContexts();
+    const std::vector<CEGUI::GeometryBuffer*> buffers = button->getGeometryBuffers();
+
+    // neither moving nor fading may rebuild the imagery
+    button->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 50), CEGUI::UDim(0, 20)));
+    button->setAlpha(0.5f);
+    button->setInheritsAlpha(false);
+    system.renderAllGUIContexts();
+
+    BOOST_CHECK(button->getGeometryBuffers() == buffers);
+    BOOST_CHECK_EQUAL(button->getGeometryBufferPool().getHitCount(), 0u);
+    BOOST_CHECK_EQUAL(button->getGeometryBufferPool().getMissCount(), buffers.size());
+
+    context.setRootWindow(nullptr);
+    system.destroyGUIContext(context);
+    CEGUI::WindowManager::getSingleton().destroyWindow(button);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,151 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/GeometryCache.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(GeometryCache)
+
+BOOST_AUTO_TEST_CASE(KeyComparesAllValues)
+{
+    const int source = 0;
+    CEGUI::GeometryCacheKey a(&source);
+    CEGUI::GeometryCacheKey b(&source);
+    a.add(CEGUI::Rectf(0, 0, 10, 10));
+    b.add(CEGUI::Rectf(0, 0, 10, 10));
+    BOOST_CHECK(a == b);
+
+    a.add(CEGUI::ColourRect(0xFFFFFFFF));
+    b.add(CEGUI::ColourRect(0xFF7F7F7F));
+    BOOST_CHECK(a != b);
+
+    CEGUI::GeometryCacheKey c(nullptr);
+    c.add(CEGUI::Rectf(0, 0, 10, 10));
+    c.add(CEGUI::ColourRect(0xFFFFFFFF));
+    BOOST_CHECK(a != c);
+}
+
+BOOST_AUTO_TEST_CASE(StateChangeReusesImagery)
+{
+    CEGUI::Window* button = CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/Button");
+    button->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+    button->setText("Button");
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::GUIContext& context = system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+    context.setRootWindow(button);
+
+    system.renderAllGUIContexts();
+    const std::vector<CEGUI::GeometryBuffer*> normalBuffers = button->getGeometryBuffers();
+    BOOST_REQUIRE(!normalBuffers.empty());
+    const CEGUI::GeometryCache& cache = button->getGeometryCache();
+    BOOST_CHECK_EQUAL(cache.getHitCount(), 0u);
+
+    button->setEnabled(false);
+    system.renderAllGUIContexts();
+    button->setEnabled(true);
+    system.renderAllGUIContexts();
+
+    // the frame of the normal state is drawn first and comes from the cache,
+    // the label contains text and is rebuilt
+    BOOST_CHECK_EQUAL(cache.getHitCount(), 1u);
+    BOOST_CHECK(button->getGeometryBuffers().front() == normalBuffers.front());
+    BOOST_CHECK_EQUAL(button->getGeometryBuffers().size(), normalBuffers.size());
+
+    context.setRootWindow(nullptr);
+    system.destroyGUIContext(context);
+    CEGUI::WindowManager::getSingleton().destroyWindow(button);
+}
+
+BOOST_AUTO_TEST_CASE(EvictsLeastRecentlyUsed)
+{
+    CEGUI::Window* button = CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/Button");
+    button->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+    button->getGeometryCache().setCapacity(1);
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::GUIContext& context = system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+    context.setRootWindow(button);
+
+    system.renderAllGUIContexts();
+    button->setEnabled(false);
+    system.renderAllGUIContexts();
+    button->setEnabled(true);
+    system.renderAllGUIContexts();
+
+    // the normal imagery was evicted when the disabled one got stored
+    const CEGUI::GeometryCache& cache = button->getGeometryCache();
+    BOOST_CHECK_EQUAL(cache.getHitCount(), 0u);
+    BOOST_CHECK_EQUAL(cache.getMissCount(), 3u);
+    BOOST_CHECK_EQUAL(cache.getEntryCount(), 2u);
+
+    context.setRootWindow(nullptr);
+    system.destroyGUIContext(context);
+    CEGUI::WindowManager::getSingleton().destroyWindow(button);
+}
+
+BOOST_AUTO_TEST_CASE(IdenticalWindowsShareTemplates)
+{
+    CEGUI::GeometryTemplateCache& templates =
+        CEGUI::WidgetLookManager::getSingleton().getGeometryTemplateCache();
+    templates.clear();
+    templates.resetStatistics();
+
+    CEGUI::WindowManager& windowManager = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* root = windowManager.createWindow("DefaultWindow");
+    CEGUI::Window* first = windowManager.createWindow("TaharezLook/Button");
+    CEGUI::Window* second = windowManager.createWindow("TaharezLook/Button");
+    first->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+    second->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+    second->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 0), CEGUI::UDim(0, 40)));
+    root->addChild(first);
+    root->addChild(second);
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::GUIContext& context = system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+    context.setRootWindow(root);
+
+    system.renderAllGUIContexts();
+
+    // the frame of the second button is a copy of the one of the first,
+    // only the translation differs
+    BOOST_CHECK_EQUAL(templates.getHitCount(), 1u);
+    const CEGUI::GeometryBuffer* firstFrame = first->getGeometryBuffers().front();
+    const CEGUI::GeometryBuffer* secondFrame = second->getGeometryBuffers().front();
+    BOOST_CHECK(firstFrame != secondFrame);
+    BOOST_CHECK(firstFrame->getVertexData() == secondFrame->getVertexData());
+
+    context.setRootWindow(nullptr);
+    system.destroyGUIContext(context);
+    windowManager.destroyWindow(root);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
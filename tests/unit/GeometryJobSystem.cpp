@@ -0,0 +1,200 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/GeometryJobSystem.h"
+#include "CEGUI/TaskScheduler.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+//! Runs the jobs back to front, which must not make a difference.
+class ReverseJobSystem : public CEGUI::GeometryJobSystem
+{
+public:
+    void runJobs(const std::vector<Job>& jobs) override
+    {
+        d_jobCount += jobs.size();
+        for (auto it = jobs.rbegin(); it != jobs.rend(); ++it)
+            (*it)();
+    }
+
+    std::size_t d_jobCount = 0;
+};
+
+struct RenderCounter
+{
+    bool handler(const CEGUI::EventArgs&)
+    {
+        ++d_count;
+        return true;
+    }
+
+    int d_count = 0;
+};
+}
+
+BOOST_AUTO_TEST_SUITE(GeometryJobSystem)
+
+BOOST_AUTO_TEST_CASE(GeneratesSurfaceSubtreesThroughJobs)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* root = winMgr.createWindow("DefaultWindow");
+    CEGUI::Window* first = winMgr.createWindow("TaharezLook/FrameWindow");
+    CEGUI::Window* second = winMgr.createWindow("TaharezLook/FrameWindow");
+    CEGUI::Window* button = winMgr.createWindow("TaharezLook/Button");
+    first->setUsingAutoRenderingSurface(true);
+    second->setUsingAutoRenderingSurface(true);
+    first->setSize(CEGUI::USize(CEGUI::UDim(0, 200), CEGUI::UDim(0, 100)));
+    second->setSize(CEGUI::USize(CEGUI::UDim(0, 200), CEGUI::UDim(0, 100)));
+    button->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+    root->addChild(first);
+    root->addChild(second);
+    first->addChild(button);
+
+    RenderCounter counter;
+    button->subscribeEvent(CEGUI::Window::EventRenderingStarted,
+        CEGUI::Event::Subscriber(&RenderCounter::handler, &counter));
+
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::GUIContext& context = system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+    ReverseJobSystem jobSystem;
+    context.setGeometryJobSystem(&jobSystem);
+    context.setRootWindow(root);
+
+    system.renderAllGUIContexts();
+
+    // root surface plus the two rendering windows
+    BOOST_CHECK_EQUAL(jobSystem.d_jobCount, 3u);
+    BOOST_CHECK_EQUAL(counter.d_count, 1);
+    BOOST_CHECK(!button->getGeometryBuffers().empty());
+    BOOST_CHECK(system.getRenderer()->getActiveGeometryBufferPool() == nullptr);
+
+    // the untouched rendering window is drawn as is and gets no job
+    button->invalidate();
+    system.renderAllGUIContexts();
+
+    BOOST_CHECK_EQUAL(jobSystem.d_jobCount, 5u);
+    BOOST_CHECK_EQUAL(counter.d_count, 2);
+
+    context.setGeometryJobSystem(nullptr);
+    context.setRootWindow(nullptr);
+    system.destroyGUIContext(context);
+    winMgr.destroyWindow(root);
+}
+
+BOOST_AUTO_TEST_CASE(FallsBackToRegisteredTaskScheduler)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* root = winMgr.createWindow("DefaultWindow");
+    std::vector<RenderCounter> counters(4);
+    for (auto& counter : counters)
+    {
+        CEGUI::Window* frame = winMgr.createWindow("TaharezLook/FrameWindow");
+        frame->setUsingAutoRenderingSurface(true);
+        frame->setSize(CEGUI::USize(CEGUI::UDim(0, 200), CEGUI::UDim(0, 100)));
+        frame->setText("Frame");
+        frame->subscribeEvent(CEGUI::Window::EventRenderingEnded,
+            CEGUI::Event::Subscriber(&RenderCounter::handler, &counter));
+        root->addChild(frame);
+    }
+
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::ThreadPoolTaskScheduler scheduler(3);
+    system.setTaskScheduler(&scheduler);
+    CEGUI::GUIContext& context = system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+    context.setRootWindow(root);
+
+    system.renderAllGUIContexts();
+
+    for (const auto& counter : counters)
+        BOOST_CHECK_EQUAL(counter.d_count, 1);
+
+    system.setTaskScheduler(nullptr);
+    context.setRootWindow(nullptr);
+    system.destroyGUIContext(context);
+    winMgr.destroyWindow(root);
+}
+
+BOOST_AUTO_TEST_CASE(GeneratesSeveralContextsAtOnce)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::ThreadPoolTaskScheduler scheduler(3);
+    system.setTaskScheduler(&scheduler);
+
+    // split screen: two contexts showing the same windows
+    std::vector<CEGUI::GUIContext*> contexts;
+    std::vector<RenderCounter> counters(4);
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        CEGUI::Window* root = winMgr.createWindow("DefaultWindow");
+        for (std::size_t j = 0; j < 2; ++j)
+        {
+            CEGUI::Window* frame = winMgr.createWindow("TaharezLook/FrameWindow");
+            frame->setUsingAutoRenderingSurface(true);
+            frame->setSize(CEGUI::USize(CEGUI::UDim(0, 200), CEGUI::UDim(0, 100)));
+            frame->setText("Player");
+            frame->subscribeEvent(CEGUI::Window::EventRenderingEnded,
+                CEGUI::Event::Subscriber(&RenderCounter::handler, &counters[i * 2 + j]));
+            root->addChild(frame);
+        }
+
+        contexts.push_back(&system.createGUIContext(system.getRenderer()->getDefaultRenderTarget()));
+        contexts.back()->setRootWindow(root);
+    }
+
+    system.renderAllGUIContexts();
+
+    for (const auto& counter : counters)
+        BOOST_CHECK_EQUAL(counter.d_count, 1);
+    for (CEGUI::GUIContext* context : contexts)
+        BOOST_CHECK(context->getFrameStats().d_windowsRedrawn > 0);
+
+    // clean contexts generate nothing again
+    system.renderAllGUIContexts();
+
+    for (const auto& counter : counters)
+        BOOST_CHECK_EQUAL(counter.d_count, 1);
+    for (CEGUI::GUIContext* context : contexts)
+        BOOST_CHECK_EQUAL(context->getFrameStats().d_windowsRedrawn, 0u);
+
+    system.setTaskScheduler(nullptr);
+    for (CEGUI::GUIContext* context : contexts)
+    {
+        CEGUI::Window* root = context->getRootWindow();
+        context->setRootWindow(nullptr);
+        system.destroyGUIContext(*context);
+        winMgr.destroyWindow(root);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,117 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/GradientImage.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+
+std::size_t renderVertexCount(const CEGUI::Image& image, const CEGUI::Rectf& area,
+                              const CEGUI::Rectf* clipArea = nullptr)
+{
+    std::vector<CEGUI::GeometryBuffer*> buffers =
+        image.createRenderGeometry(CEGUI::ImageRenderSettings(area, clipArea));
+
+    std::size_t count = 0;
+    for (CEGUI::GeometryBuffer* buffer : buffers)
+    {
+        count += buffer->getVertexCount();
+        CEGUI::System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
+    }
+
+    return count;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(GradientImageGeometry)
+
+BOOST_AUTO_TEST_CASE(IsCreatedByTheImageManager)
+{
+    CEGUI::Image& image = CEGUI::ImageManager::getSingleton().create(
+        "GradientImage", "GradientImageGeometry/Created");
+
+    BOOST_CHECK(dynamic_cast<CEGUI::GradientImage*>(&image) != nullptr);
+
+    CEGUI::ImageManager::getSingleton().destroy(image);
+}
+
+BOOST_AUTO_TEST_CASE(ColoursAreEvaluatedPerGridPoint)
+{
+    CEGUI::GradientImage image("GradientImageGeometry/Grid");
+    image.setImageArea(CEGUI::Rectf(0, 0, 100, 100));
+    image.setSubdivisions(4, 2);
+
+    std::size_t evaluations = 0;
+    image.setColourFunction([&evaluations](const glm::vec2& relPos)
+    {
+        ++evaluations;
+        return CEGUI::Colour(relPos.x, relPos.y, 0.0f);
+    });
+
+    // the vertex count only depends on the subdivisions, not on the size
+    BOOST_CHECK_EQUAL(renderVertexCount(image, CEGUI::Rectf(0, 0, 100, 100)), 4u * 2u * 6u);
+    BOOST_CHECK_EQUAL(evaluations, 5u * 3u);
+    BOOST_CHECK_EQUAL(renderVertexCount(image, CEGUI::Rectf(0, 0, 1000, 1000)), 4u * 2u * 6u);
+}
+
+BOOST_AUTO_TEST_CASE(ClippedCellsAreSkipped)
+{
+    CEGUI::GradientImage image("GradientImageGeometry/Clipped");
+    image.setImageArea(CEGUI::Rectf(0, 0, 100, 100));
+    image.setSubdivisions(4, 4);
+
+    const CEGUI::Rectf leftHalf(0, 0, 50, 100);
+    BOOST_CHECK_EQUAL(renderVertexCount(image, CEGUI::Rectf(0, 0, 100, 100), &leftHalf),
+                      2u * 4u * 6u);
+
+    const CEGUI::Rectf outside(200, 200, 300, 300);
+    BOOST_CHECK_EQUAL(renderVertexCount(image, CEGUI::Rectf(0, 0, 100, 100), &outside), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(CheckerboardIsDrawnBehindTheGradient)
+{
+    CEGUI::GradientImage image("GradientImageGeometry/Checkerboard");
+    image.setImageArea(CEGUI::Rectf(0, 0, 60, 30));
+
+    image.setCheckerboard(15.0f, CEGUI::Colour(1.0f, 1.0f, 1.0f), CEGUI::Colour(0.5f, 0.5f, 0.5f));
+    BOOST_CHECK_EQUAL(renderVertexCount(image, CEGUI::Rectf(0, 0, 60, 30)), (4u * 2u + 1u) * 6u);
+
+    // the squares scale with the Image
+    BOOST_CHECK_EQUAL(renderVertexCount(image, CEGUI::Rectf(0, 0, 120, 60)), (4u * 2u + 1u) * 6u);
+
+    image.setCheckerboard(0.0f, CEGUI::Colour(), CEGUI::Colour());
+    BOOST_CHECK_EQUAL(renderVertexCount(image, CEGUI::Rectf(0, 0, 60, 30)), 6u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,87 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/ImageAtlas.h"
+#include "CEGUI/Texture.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(ImageAtlas)
+
+BOOST_AUTO_TEST_CASE(PacksImagesIntoSharedPages)
+{
+    CEGUI::ImageAtlas atlas;
+    const std::vector<std::uint8_t> pixels(32 * 32 * 4, 0xFF);
+
+    CEGUI::Texture* first = nullptr;
+    CEGUI::Texture* second = nullptr;
+    CEGUI::Rectf firstArea, secondArea;
+    BOOST_REQUIRE(atlas.addImage("first", pixels.data(), 32, 32, first, firstArea));
+    BOOST_REQUIRE(atlas.addImage("second", pixels.data(), 16, 32, second, secondArea));
+
+    BOOST_CHECK_EQUAL(first, second);
+    BOOST_CHECK_EQUAL(atlas.getPageCount(), 1u);
+    BOOST_CHECK_EQUAL(atlas.getImageCount(), 2u);
+    BOOST_CHECK_EQUAL(firstArea.getWidth(), 32.0f);
+    BOOST_CHECK_EQUAL(secondArea.getWidth(), 16.0f);
+    const CEGUI::Rectf overlap(firstArea.getIntersection(secondArea));
+    BOOST_CHECK_EQUAL(overlap.getWidth() * overlap.getHeight(), 0.0f);
+}
+
+BOOST_AUTO_TEST_CASE(LeavesLargeImagesOut)
+{
+    CEGUI::ImageAtlas atlas;
+    atlas.setMaxImageSize(16);
+    const std::vector<std::uint8_t> pixels(32 * 32 * 4, 0xFF);
+
+    CEGUI::Texture* texture = nullptr;
+    CEGUI::Rectf area;
+    BOOST_CHECK(!atlas.addImage("large", pixels.data(), 32, 32, texture, area));
+    BOOST_CHECK(!atlas.isImagePacked("large"));
+    BOOST_CHECK_EQUAL(atlas.getPageCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(DestroysPagesWithoutImages)
+{
+    CEGUI::ImageAtlas atlas;
+    const std::vector<std::uint8_t> pixels(8 * 8 * 4, 0xFF);
+
+    CEGUI::Texture* texture = nullptr;
+    CEGUI::Rectf area;
+    BOOST_REQUIRE(atlas.addImage("a", pixels.data(), 8, 8, texture, area));
+    BOOST_REQUIRE(atlas.addImage("b", pixels.data(), 8, 8, texture, area));
+
+    BOOST_CHECK(atlas.releaseImage("a"));
+    BOOST_CHECK_EQUAL(atlas.getPageCount(), 1u);
+    BOOST_CHECK(atlas.releaseImage("b"));
+    BOOST_CHECK_EQUAL(atlas.getPageCount(), 0u);
+    BOOST_CHECK(!atlas.releaseImage("b"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,79 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/TaskScheduler.h"
+#include "CEGUI/Texture.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(ImageManager)
+
+BOOST_AUTO_TEST_CASE(TextureLoadBatchDefersLoading)
+{
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::ThreadPoolTaskScheduler scheduler(2);
+    system.setTaskScheduler(&scheduler);
+
+    CEGUI::ImageManager& manager = CEGUI::ImageManager::getSingleton();
+    CEGUI::Renderer& renderer = *system.getRenderer();
+
+    manager.beginTextureLoadBatch();
+    manager.beginTextureLoadBatch();
+    manager.addBitmapImageFromFile("ImageManagerTestLogo", "logo.png");
+    manager.addBitmapImageFromFile("ImageManagerTestLauncher", "ic_launcher.png");
+    manager.endTextureLoadBatch();
+
+    // only the outermost batch loads the files
+    BOOST_CHECK(manager.isTextureLoadBatchActive());
+    BOOST_CHECK_EQUAL(renderer.getTexture("ImageManagerTestLogo").getOriginalDataSize().d_width, 0.0f);
+
+    manager.endTextureLoadBatch();
+    BOOST_CHECK(!manager.isTextureLoadBatchActive());
+
+    for (const char* name : { "ImageManagerTestLogo", "ImageManagerTestLauncher" })
+    {
+        const CEGUI::Sizef& size = renderer.getTexture(name).getOriginalDataSize();
+        BOOST_CHECK(size.d_width > 0.0f && size.d_height > 0.0f);
+
+        const CEGUI::Rectf area = manager.get(name).getImageArea();
+        BOOST_CHECK_EQUAL(area.getWidth(), size.d_width);
+        BOOST_CHECK_EQUAL(area.getHeight(), size.d_height);
+
+        manager.destroy(name);
+        renderer.destroyTexture(name);
+    }
+
+    BOOST_CHECK_THROW(manager.endTextureLoadBatch(), CEGUI::InvalidRequestException);
+
+    system.setTaskScheduler(nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -50,12 +50,16 @@ public:
     CEGUI::String d_text;
     float d_totalScroll;
     glm::vec2 d_cursorPosition;
+    int d_movementCount;
     std::vector<SemanticValue> d_semanticValues;
+    //! All semantic values received, in order.
+    std::vector<SemanticValue> d_receivedValues;
 
     MockInputEventReceiver() :
         d_text(""),
         d_totalScroll(0),
-        d_cursorPosition(0.0f, 0.0f)
+        d_cursorPosition(0.0f, 0.0f),
+        d_movementCount(0)
     {}
 
     ~MockInputEventReceiver()
@@ -98,6 +102,7 @@ public:
     {
         d_cursorPosition = glm::vec2(event.d_payload.array[0],
             event.d_payload.array[1]);
+        ++d_movementCount;
         return true;
     }
 
@@ -109,6 +114,8 @@ public:
 
     bool handleSemanticEvent(const SemanticInputEvent& event)
     {
+        d_receivedValues.push_back(event.d_value);
+
         SemanticEventHandlerMap::const_iterator itor =
             d_semanticEventsHandlersMap.find(event.d_value);
         if (itor != d_semanticEventsHandlersMap.end())
@@ -504,4 +511,69 @@ BOOST_AUTO_TEST_CASE(KeyDownLeftArrowAndControlToGoToPreviousWord)
         d_inputEventReceiver->d_semanticValues.end());
 }
 
+BOOST_AUTO_TEST_CASE(CoalescedMovesAndScrollsAreMerged)
+{
+    d_inputAggregator->setEventCoalescingEnabled(true);
+
+    for (int i = 1; i <= 16; ++i)
+        BOOST_CHECK(!d_inputAggregator->injectMousePosition(static_cast<float>(i), 2.0f * i));
+    d_inputAggregator->injectMouseWheelChange(1);
+    d_inputAggregator->injectMouseWheelChange(2);
+
+    BOOST_REQUIRE_EQUAL(d_inputEventReceiver->d_movementCount, 0);
+    BOOST_REQUIRE_EQUAL(d_inputEventReceiver->d_totalScroll, 0);
+
+    BOOST_CHECK(d_inputAggregator->flushPendingInput());
+
+    BOOST_REQUIRE_EQUAL(d_inputEventReceiver->d_movementCount, 1);
+    BOOST_REQUIRE_EQUAL(d_inputEventReceiver->d_cursorPosition.x, 16);
+    BOOST_REQUIRE_EQUAL(d_inputEventReceiver->d_cursorPosition.y, 32);
+    BOOST_REQUIRE_EQUAL(d_inputEventReceiver->d_totalScroll, 3);
+
+    // nothing is left to send
+    BOOST_CHECK(!d_inputAggregator->flushPendingInput());
+    BOOST_REQUIRE_EQUAL(d_inputEventReceiver->d_movementCount, 1);
+}
+
+BOOST_AUTO_TEST_CASE(CoalescedMoveIsSentBeforeButtons)
+{
+    d_inputAggregator->setEventCoalescingEnabled(true);
+
+    d_inputAggregator->injectMousePosition(5, 5);
+    d_inputAggregator->injectMousePosition(10, 10);
+    d_inputAggregator->injectMouseButtonDown(MouseButton::Left);
+    d_inputAggregator->injectMousePosition(20, 20);
+    d_inputAggregator->injectMouseButtonUp(MouseButton::Left);
+
+    std::vector<SemanticValue> expected_values;
+    expected_values.push_back(SemanticValue::CursorMove);
+    expected_values.push_back(SemanticValue::CursorPressHold);
+    expected_values.push_back(SemanticValue::CursorMove);
+    expected_values.push_back(SemanticValue::CursorActivate);
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        d_inputEventReceiver->d_receivedValues.begin(), d_inputEventReceiver->d_receivedValues.end(),
+        expected_values.begin(), expected_values.end());
+    BOOST_REQUIRE_EQUAL(d_inputEventReceiver->d_cursorPosition.x, 20);
+}
+
+BOOST_AUTO_TEST_CASE(CoalescedScrollKeepsItsPosition)
+{
+    d_inputAggregator->setEventCoalescingEnabled(true);
+
+    d_inputAggregator->injectMousePosition(5, 5);
+    d_inputAggregator->injectMouseWheelChange(1);
+    // the scroll happened at (5, 5) and is sent before moving on
+    d_inputAggregator->injectMousePosition(10, 10);
+
+    BOOST_REQUIRE_EQUAL(d_inputEventReceiver->d_movementCount, 1);
+    BOOST_REQUIRE_EQUAL(d_inputEventReceiver->d_cursorPosition.x, 5);
+    BOOST_REQUIRE_EQUAL(d_inputEventReceiver->d_totalScroll, 1);
+
+    // disabling coalescing sends the pending move
+    d_inputAggregator->setEventCoalescingEnabled(false);
+    BOOST_REQUIRE_EQUAL(d_inputEventReceiver->d_movementCount, 2);
+    BOOST_REQUIRE_EQUAL(d_inputEventReceiver->d_cursorPosition.x, 10);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
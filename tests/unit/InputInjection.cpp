@@ -39,7 +39,8 @@ struct InputInjectionFixture
     InputInjectionFixture() :
         d_buttonHandledCount(0),
         d_windowHandledCount(0),
-        d_guiContext(&System::getSingleton().getDefaultGUIContext()),
+        d_guiContext(&System::getSingleton().createGUIContext(
+            System::getSingleton().getRenderer()->getDefaultRenderTarget())),
         d_inputAggregator(new InputAggregator(d_guiContext))
     {
         d_inputAggregator->initialise();
@@ -65,7 +66,7 @@ struct InputInjectionFixture
         d_window->addChild(d_editbox);
         d_window->addChild(d_button);
 
-        System::getSingleton().getDefaultGUIContext().setRootWindow(d_window);
+        d_guiContext->setRootWindow(d_window);
 
         d_windowConnections.push_back(
             d_window->subscribeEvent(Window::EventCursorActivate,
@@ -84,7 +85,8 @@ struct InputInjectionFixture
 
         delete d_inputAggregator;
 
-        System::getSingleton().getDefaultGUIContext().setRootWindow(nullptr);
+        d_guiContext->setRootWindow(nullptr);
+        System::getSingleton().destroyGUIContext(*d_guiContext);
 
         WindowManager::getSingleton().destroyWindow(d_window);
     }
@@ -286,4 +288,40 @@ BOOST_AUTO_TEST_CASE(KeyboardSelectWordAndDelete)
     pressKey(d_inputAggregator, Key::Scan::DeleteKey);
     BOOST_REQUIRE_EQUAL(d_editbox->getText(), "rocks");
 }
+BOOST_AUTO_TEST_CASE(WindowContainingCursorFollowsChanges)
+{
+    d_inputAggregator->injectMousePosition(10, 10);
+    BOOST_CHECK_EQUAL(d_guiContext->getWindowContainingCursor(), d_window);
+
+    // moving into a child of the window containing the cursor
+    d_inputAggregator->injectMousePosition(30, 30);
+    BOOST_CHECK_EQUAL(d_guiContext->getWindowContainingCursor(), d_button);
+    d_inputAggregator->injectMousePosition(31, 31);
+    BOOST_CHECK_EQUAL(d_guiContext->getWindowContainingCursor(), d_button);
+
+    // a window added on top occludes the button
+    Window* cover = WindowManager::getSingleton().createWindow("DefaultWindow");
+    cover->setPosition(UVector2(cegui_reldim(0.25f), cegui_reldim(0.25f)));
+    cover->setSize(USize(cegui_reldim(0.5f), cegui_reldim(0.5f)));
+    d_window->addChild(cover);
+    d_inputAggregator->injectMousePosition(32, 32);
+    BOOST_CHECK_EQUAL(d_guiContext->getWindowContainingCursor(), cover);
+
+    cover->setVisible(false);
+    d_inputAggregator->injectMousePosition(33, 33);
+    BOOST_CHECK_EQUAL(d_guiContext->getWindowContainingCursor(), d_button);
+
+    cover->setVisible(true);
+    cover->setCursorPassThroughEnabled(true);
+    d_inputAggregator->injectMousePosition(34, 34);
+    BOOST_CHECK_EQUAL(d_guiContext->getWindowContainingCursor(), d_button);
+
+    WindowManager::getSingleton().destroyWindow(cover);
+
+    // the button moving away from the cursor
+    d_button->setPosition(UVector2(cegui_reldim(0.5f), cegui_reldim(0.5f)));
+    d_inputAggregator->injectMousePosition(35, 35);
+    BOOST_CHECK_EQUAL(d_guiContext->getWindowContainingCursor(), d_window);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
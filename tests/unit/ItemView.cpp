@@ -27,7 +27,9 @@
 #include <boost/test/unit_test.hpp>
 
 #include "CEGUI/views/ListView.h"
+#include "CEGUI/widgets/Scrollbar.h"
 #include "CEGUI/WindowManager.h"
+#include "CEGUI/Event.h"
 #include "ItemModelStub.h"
 
 using namespace CEGUI;
@@ -193,4 +195,81 @@ BOOST_AUTO_TEST_CASE(EnsureItemIsVisible_ScrollsHorizontallyAndVertically)
     BOOST_REQUIRE_CLOSE(0.0f, view->getHorzScrollbar()->getScrollPosition(), 1.0f);
 }
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SelectAll_StoresSelectionAsSingleRange)
+{
+    for (std::int32_t i = 0; i < 1000; ++i)
+        model.d_items.push_back("item " + PropertyHelper<std::int32_t>::toString(i));
+    view->setMultiSelectEnabled(true);
+
+    BOOST_REQUIRE(view->selectAll());
+
+    BOOST_CHECK_EQUAL(1000, view->getSelectionCount());
+    BOOST_REQUIRE(view->getSelectedChildIds(model.getRootIndex()) != nullptr);
+    BOOST_CHECK_EQUAL(1, view->getSelectedChildIds(model.getRootIndex())->getRanges().size());
+    BOOST_CHECK(view->isIndexSelected(model.makeIndex(500, model.getRootIndex())));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ChildrenAddedAndRemoved_SelectedRangesAreShifted)
+{
+    for (std::int32_t i = 0; i < 10; ++i)
+        model.d_items.push_back("item " + PropertyHelper<std::int32_t>::toString(i));
+    view->setMultiSelectEnabled(true);
+    view->setIndexSelectionState(model.makeIndex(2, model.getRootIndex()), true);
+    view->setIndexSelectionState(model.makeIndex(3, model.getRootIndex()), true);
+
+    model.d_items.insert(model.d_items.begin() + 3, "new item");
+    model.notifyChildrenAdded(model.getRootIndex(), 3, 1);
+
+    BOOST_CHECK_EQUAL(2, view->getSelectionCount());
+    BOOST_CHECK(view->isChildSelected(model.getRootIndex(), 2));
+    BOOST_CHECK(!view->isChildSelected(model.getRootIndex(), 3));
+    BOOST_CHECK(view->isChildSelected(model.getRootIndex(), 4));
+
+    model.notifyChildrenWillBeRemoved(model.getRootIndex(), 3, 1);
+    model.d_items.erase(model.d_items.begin() + 3);
+    model.notifyChildrenRemoved(model.getRootIndex(), 3, 1);
+
+    BOOST_CHECK_EQUAL(2, view->getSelectionCount());
+    BOOST_CHECK_EQUAL(1, view->getSelectedChildIds(model.getRootIndex())->getRanges().size());
+    BOOST_CHECK_EQUAL(2, view->getIndexSelectionStates().size());
+}
+
+//----------------------------------------------------------------------------//
+struct SelectionChangedCounter
+{
+    SelectionChangedCounter() : d_count(0) {}
+
+    bool onSelectionChanged(const EventArgs&)
+    {
+        ++d_count;
+        return true;
+    }
+
+    int d_count;
+};
+
+BOOST_AUTO_TEST_CASE(SelectionChangedInBatchScope_IsFiredOnce)
+{
+    for (std::int32_t i = 0; i < 10; ++i)
+        model.d_items.push_back("item " + PropertyHelper<std::int32_t>::toString(i));
+    view->setMultiSelectEnabled(true);
+
+    SelectionChangedCounter counter;
+    view->subscribeEvent(ItemView::EventSelectionChanged,
+        Event::Subscriber(&SelectionChangedCounter::onSelectionChanged, &counter));
+
+    {
+        EventSet::BatchScope batch;
+        for (size_t i = 0; i < 5; ++i)
+            view->setIndexSelectionState(model.makeIndex(i, model.getRootIndex()), true);
+
+        BOOST_CHECK_EQUAL(0, counter.d_count);
+    }
+
+    BOOST_CHECK_EQUAL(1, counter.d_count);
+    BOOST_CHECK_EQUAL(5, view->getSelectionCount());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,121 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/widgets/VerticalLayoutContainer.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+struct LayoutContainerFixture
+{
+    LayoutContainerFixture()
+    {
+        CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+        d_root = winMgr.createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(0, 400), CEGUI::UDim(0, 400)));
+
+        d_layout = static_cast<CEGUI::LayoutContainer*>(
+            winMgr.createWindow("VerticalLayoutContainer"));
+        d_root->addChild(d_layout);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CEGUI::Window* child = winMgr.createWindow("DefaultWindow");
+            child->setSize(CEGUI::USize(CEGUI::UDim(0, 50), CEGUI::UDim(0, 20)));
+            child->subscribeEvent(CEGUI::Element::EventMoved, [this]() { ++d_movedCount; });
+            d_layout->addChild(child);
+        }
+
+        CEGUI::System& system = CEGUI::System::getSingleton();
+        d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+        d_context->setRootWindow(d_root);
+    }
+
+    ~LayoutContainerFixture()
+    {
+        d_context->setRootWindow(nullptr);
+        CEGUI::System::getSingleton().destroyGUIContext(*d_context);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    //! Layouts until the container settles, the first layout resizes it.
+    void layout()
+    {
+        for (int i = 0; i < 3 && d_layout->needsLayouting(); ++i)
+            d_layout->layoutIfNecessary();
+    }
+
+    CEGUI::GUIContext* d_context;
+    CEGUI::Window* d_root;
+    CEGUI::LayoutContainer* d_layout;
+    int d_movedCount = 0;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(LayoutContainer, LayoutContainerFixture)
+
+BOOST_AUTO_TEST_CASE(StacksChildrenVertically)
+{
+    layout();
+
+    BOOST_CHECK(!d_layout->needsLayouting());
+    for (size_t i = 0; i < 3; ++i)
+        BOOST_CHECK_EQUAL(d_layout->getChildAtIndex(i)->getPosition().d_y.d_offset, 20.f * i);
+    BOOST_CHECK_EQUAL(d_layout->getPixelSize().d_height, 60.f);
+}
+
+BOOST_AUTO_TEST_CASE(RelayoutDoesNotMoveChildrenInPlace)
+{
+    layout();
+    d_movedCount = 0;
+
+    d_layout->markNeedsLayouting();
+    d_layout->layoutIfNecessary();
+
+    BOOST_CHECK_EQUAL(d_movedCount, 0);
+    BOOST_CHECK(!d_layout->needsLayouting());
+}
+
+BOOST_AUTO_TEST_CASE(MovesEachChildOnce)
+{
+    layout();
+    d_movedCount = 0;
+
+    d_layout->getChildAtIndex(0)->setHeight(CEGUI::UDim(0, 30));
+    layout();
+
+    // the two children below the resized one moved down by 10 pixels
+    BOOST_CHECK_EQUAL(d_movedCount, 2);
+    BOOST_CHECK_EQUAL(d_layout->getChildAtIndex(2)->getPosition().d_y.d_offset, 50.f);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
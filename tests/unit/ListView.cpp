@@ -28,6 +28,9 @@
 
 #include "ItemModelStub.h"
 #include "CEGUI/Font.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
 #include "CEGUI/WindowManager.h"
 #include "CEGUI/widgets/Scrollbar.h"
 
@@ -44,19 +47,56 @@ static const String ITEM2 = "ITEM 2";
 static const String ITEM3 = "ITEM 3";
 static const String ITEM_WITH_6LINES = "THIS\nIS\nA\nMULTILINE\nLINE\n";
 
+//----------------------------------------------------------------------------//
+//! Model whose items only become available after the view requested them.
+class PendingItemModelStub : public ItemModelStub
+{
+public:
+    bool isDataPending(const ModelIndex& model_index, ItemDataRole) const override
+    {
+        return !d_loaded[static_cast<const String*>(model_index.d_modelData) - d_items.data()];
+    }
+
+    void requestData(const ModelIndex&, size_t start_id, size_t count) override
+    {
+        d_requests.push_back(std::make_pair(start_id, count));
+    }
+
+    void load(size_t start_id, size_t count)
+    {
+        std::fill(d_loaded.begin() + start_id, d_loaded.begin() + start_id + count, true);
+        notifyChildrenDataChanged(getRootIndex(), start_id, count);
+    }
+
+    std::vector<bool> d_loaded;
+    std::vector<std::pair<size_t, size_t> > d_requests;
+};
+
 //----------------------------------------------------------------------------//
 struct ListViewFixture
 {
     ListViewFixture()
     {
-        System::getSingleton().notifyDisplaySizeChanged(Sizef(100, 100));
+        System& system = System::getSingleton();
+        system.notifyDisplaySizeChanged(Sizef(100, 100));
+        context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
 
         view = static_cast<ListView*>(WindowManager::getSingleton().createWindow("TaharezLook/ListView", "lv"));
         view->setWindowRenderer("Core/ListView");
+        view->setFont("DejaVuSans-12");
+        context->setRootWindow(view);
         view->setModel(&model);
         font_height = view->getFont()->getFontHeight();
     }
 
+    ~ListViewFixture()
+    {
+        context->setRootWindow(nullptr);
+        System::getSingleton().destroyGUIContext(*context);
+        WindowManager::getSingleton().destroyWindow(view);
+    }
+
+    GUIContext* context;
     ListView* view;
     ItemModelStub model;
     float font_height;
@@ -234,14 +274,34 @@ BOOST_AUTO_TEST_CASE(ItemNameChanged_UpdatesRenderedString)
 {
     model.d_items.push_back(ITEM1);
     view->prepareForRender();
-    BOOST_CHECK_EQUAL(1, view->getItems().at(0)->d_string.getLineCount());
+    BOOST_CHECK_EQUAL(1, view->getItems().at(0)->d_string->getLineCount());
 
     model.notifyChildrenDataWillChange(model.getRootIndex(), 0, 1);
     model.d_items.at(0) = ITEM_WITH_6LINES;
     model.notifyChildrenDataChanged(model.getRootIndex(), 0, 1);
 
     view->prepareForRender();
-    BOOST_REQUIRE_EQUAL(6, view->getItems().at(0)->d_string.getLineCount());
+    BOOST_REQUIRE_EQUAL(6, view->getItems().at(0)->d_string->getLineCount());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ItemAppended_OtherItemsAreNotFormattedAgain)
+{
+    model.d_items.push_back(ITEM1);
+    model.d_items.push_back(ITEM2);
+    view->prepareForRender();
+    const float item_height = view->getRenderedTotalHeight() / 2;
+
+    // changed without a notification, only a full update would pick it up
+    model.d_items.at(0) = ITEM_WITH_6LINES;
+    model.d_items.push_back(ITEM3);
+    model.notifyChildrenAdded(model.getRootIndex(), 2, 1);
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(3, view->getItems().size());
+    BOOST_CHECK_EQUAL(1, view->getItems().at(0)->d_string->getLineCount());
+    BOOST_CHECK_EQUAL(ITEM3, view->getItems().at(2)->d_text);
+    BOOST_CHECK_CLOSE(item_height * 3, view->getRenderedTotalHeight(), 0.01f);
 }
 
 //----------------------------------------------------------------------------//
@@ -283,4 +343,137 @@ BOOST_AUTO_TEST_CASE(SortEnabled_IsEnabled_ListIsSorted)
     BOOST_REQUIRE_EQUAL(ITEM3, *(static_cast<String*>(index.d_modelData)));
 }
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SortEnabled_ItemsChange_SortedOrderIsUpdated)
+{
+    model.d_items.push_back(ITEM2);
+    model.d_items.push_back(ITEM3);
+    view->setSortMode(ViewSortMode::Ascending);
+    view->prepareForRender();
+
+    model.notifyChildrenDataWillChange(model.getRootIndex(), 0, 1);
+    model.d_items.at(0) = "ITEM 4";
+    model.notifyChildrenDataChanged(model.getRootIndex(), 0, 1);
+    model.d_items.push_back(ITEM1);
+    model.notifyChildrenAdded(model.getRootIndex(), 2, 1);
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(3, view->getItems().size());
+    BOOST_CHECK_EQUAL(ITEM1, view->getItems().at(0)->d_text);
+    BOOST_CHECK_EQUAL(ITEM3, view->getItems().at(1)->d_text);
+    BOOST_CHECK_EQUAL("ITEM 4", view->getItems().at(2)->d_text);
+
+    model.notifyChildrenWillBeRemoved(model.getRootIndex(), 1, 1);
+    model.d_items.erase(model.d_items.begin() + 1);
+    model.notifyChildrenRemoved(model.getRootIndex(), 1, 1);
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(2, view->getItems().size());
+    BOOST_CHECK_EQUAL(ITEM1, view->getItems().at(0)->d_text);
+    BOOST_CHECK_EQUAL("ITEM 4", view->getItems().at(1)->d_text);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Virtualised_OnlyItemsAroundTheViewAreFormatted)
+{
+    for (std::int32_t i = 0; i < 1000; ++i)
+        model.d_items.push_back("item " + PropertyHelper<std::int32_t>::toString(i));
+    view->setSize(USize(cegui_absdim(100), cegui_absdim(font_height * 10)));
+    view->setVirtualised(true);
+    view->setVirtualisedRowHeight(font_height);
+    view->prepareForRender();
+
+    const size_t max_items = 11 + 2 * ListView::VirtualisedOverscanRows;
+    BOOST_CHECK(view->getItems().size() <= max_items);
+    BOOST_CHECK_CLOSE(view->getRenderedTotalHeight(), font_height * 1000, 0.01f);
+    BOOST_CHECK_EQUAL(view->getItemsOffset(), 0.0f);
+
+    view->getVertScrollbar()->setScrollPosition(font_height * 500);
+    view->prepareForRender();
+
+    BOOST_CHECK(view->getItems().size() <= max_items);
+    BOOST_CHECK_CLOSE(view->getItemsOffset(),
+        font_height * (500 - ListView::VirtualisedOverscanRows), 0.01f);
+    BOOST_CHECK_EQUAL(view->getItems().front()->d_text,
+        "item " + PropertyHelper<std::int32_t>::toString(
+            500 - static_cast<std::int32_t>(ListView::VirtualisedOverscanRows)));
+
+    ModelIndex index = view->indexAt(glm::vec2(1, font_height / 2.0f));
+    BOOST_REQUIRE(index.d_modelData != nullptr);
+    BOOST_CHECK_EQUAL(String("item 500"), *(static_cast<String*>(index.d_modelData)));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(FilterText_OnlyMatchingItemsAreShown)
+{
+    model.d_items.push_back("beta");
+    model.d_items.push_back("alpha");
+    model.d_items.push_back("alpine");
+    model.d_items.push_back("gamma");
+    view->prepareForRender();
+
+    view->setFilterText("alp");
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(view->getItems().size(), 2);
+    BOOST_CHECK_EQUAL(view->getItems().at(0)->d_text, "alpha");
+    BOOST_CHECK_EQUAL(view->getItems().at(1)->d_text, "alpine");
+    BOOST_CHECK_CLOSE(view->getRenderedTotalHeight(), font_height * 2, 0.01f);
+    BOOST_CHECK_EQUAL(view->findChildIdWithText("gamma"), 3);
+
+    view->setFilterText("");
+    view->prepareForRender();
+
+    BOOST_CHECK_EQUAL(view->getItems().size(), 4);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(FilterText_Virtualised_RowsAreTheMatchingItems)
+{
+    for (std::int32_t i = 0; i < 1000; ++i)
+        model.d_items.push_back("item " + PropertyHelper<std::int32_t>::toString(i));
+    view->setSize(USize(cegui_absdim(100), cegui_absdim(font_height * 10)));
+    view->setVirtualised(true);
+    view->setVirtualisedRowHeight(font_height);
+
+    view->setFilterText("item 99");
+    view->prepareForRender();
+
+    // "item 99" and "item 990" to "item 999"
+    BOOST_CHECK_EQUAL(view->getItems().size(), 11);
+    BOOST_CHECK_CLOSE(view->getRenderedTotalHeight(), font_height * 11, 0.01f);
+
+    ModelIndex index = view->indexAt(glm::vec2(1, font_height * 1.5f));
+    BOOST_REQUIRE(index.d_modelData != nullptr);
+    BOOST_CHECK_EQUAL(String("item 990"), *(static_cast<String*>(index.d_modelData)));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(PendingData_PlaceholdersShownUntilLoaded)
+{
+    PendingItemModelStub pending_model;
+    for (std::int32_t i = 0; i < 1000; ++i)
+        pending_model.d_items.push_back("item " + PropertyHelper<std::int32_t>::toString(i));
+    pending_model.d_loaded.assign(1000, false);
+
+    view->setModel(&pending_model);
+    view->setSize(USize(cegui_absdim(100), cegui_absdim(font_height * 10)));
+    view->setVirtualised(true);
+    view->setVirtualisedRowHeight(font_height);
+    view->setDataPrefetchCount(20);
+    view->prepareForRender();
+
+    // the visible rows plus the prefetched ones are requested as a single range
+    BOOST_REQUIRE_EQUAL(pending_model.d_requests.size(), 1);
+    BOOST_CHECK_EQUAL(pending_model.d_requests[0].first, 0);
+    BOOST_CHECK_EQUAL(pending_model.d_requests[0].second, view->getItems().size() + 20);
+    BOOST_CHECK_EQUAL(view->getItems().front()->d_text, view->getPendingItemText());
+
+    pending_model.load(0, 50);
+    view->prepareForRender();
+
+    BOOST_CHECK_EQUAL(view->getItems().front()->d_text, "item 0");
+    view->setModel(&model);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,135 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/MemoryAllocator.h"
+#include "CEGUI/System.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/EventSet.h"
+#include "CEGUI/SmallObjectPool.h"
+#include "CEGUI/Exceptions.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+namespace
+{
+bool handlePooledEvent(const CEGUI::EventArgs&)
+{
+    return true;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(MemoryAllocation)
+
+BOOST_AUTO_TEST_CASE(AllocatorCanNotChangeWhileSystemExists)
+{
+    BOOST_CHECK_THROW(CEGUI::System::setMemoryAllocator(nullptr),
+                      CEGUI::InvalidRequestException);
+}
+
+BOOST_AUTO_TEST_CASE(WindowsAreAccounted)
+{
+    // windows destroyed by earlier tests may still wait in the dead pool
+    CEGUI::WindowManager::getSingleton().cleanDeadPool();
+
+    const std::size_t sizeBefore =
+        CEGUI::MemoryAllocator::getAllocatedSize(CEGUI::MemoryCategory::Window);
+    const std::size_t countBefore =
+        CEGUI::MemoryAllocator::getAllocationCount(CEGUI::MemoryCategory::Window);
+
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    BOOST_CHECK(CEGUI::MemoryAllocator::getAllocatedSize(CEGUI::MemoryCategory::Window) >=
+                sizeBefore + sizeof(CEGUI::Window));
+    BOOST_CHECK(CEGUI::MemoryAllocator::getAllocationCount(CEGUI::MemoryCategory::Window) >
+                countBefore);
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+    CEGUI::WindowManager::getSingleton().cleanDeadPool();
+    BOOST_CHECK_EQUAL(CEGUI::MemoryAllocator::getAllocatedSize(CEGUI::MemoryCategory::Window),
+                      sizeBefore);
+    BOOST_CHECK_EQUAL(CEGUI::MemoryAllocator::getAllocationCount(CEGUI::MemoryCategory::Window),
+                      countBefore);
+}
+
+BOOST_AUTO_TEST_CASE(EventsAreAccounted)
+{
+    CEGUI::EventSet set;
+
+    const std::size_t countBefore =
+        CEGUI::MemoryAllocator::getAllocationCount(CEGUI::MemoryCategory::Event);
+
+    set.addEvent("AccountedEvent");
+    BOOST_CHECK_EQUAL(CEGUI::MemoryAllocator::getAllocationCount(CEGUI::MemoryCategory::Event),
+                      countBefore + 1);
+
+    set.removeEvent("AccountedEvent");
+    BOOST_CHECK_EQUAL(CEGUI::MemoryAllocator::getAllocationCount(CEGUI::MemoryCategory::Event),
+                      countBefore);
+}
+
+BOOST_AUTO_TEST_CASE(ConnectionsReusePooledBlocks)
+{
+    CEGUI::EventSet set;
+    set.addEvent("PooledEvent");
+
+    {
+        CEGUI::Event::Connection connection =
+            set.subscribeEvent("PooledEvent", &handlePooledEvent);
+        connection->disconnect();
+    }
+
+    const std::size_t cachedBlocks =
+        CEGUI::SmallObjectPool::getCachedBlockCount(CEGUI::MemoryCategory::Event);
+    BOOST_CHECK(cachedBlocks > 0);
+
+    CEGUI::Event::Connection connection =
+        set.subscribeEvent("PooledEvent", &handlePooledEvent);
+    BOOST_CHECK(CEGUI::SmallObjectPool::getCachedBlockCount(CEGUI::MemoryCategory::Event) <
+                cachedBlocks);
+    BOOST_CHECK(connection->connected());
+    connection->disconnect();
+}
+
+BOOST_AUTO_TEST_CASE(AdapterIsAccounted)
+{
+    const std::size_t sizeBefore =
+        CEGUI::MemoryAllocator::getAllocatedSize(CEGUI::MemoryCategory::General);
+
+    {
+        std::vector<int, CEGUI::MemoryAllocatorAdapter<int, CEGUI::MemoryCategory::General> >
+            values(100);
+        BOOST_CHECK_EQUAL(CEGUI::MemoryAllocator::getAllocatedSize(CEGUI::MemoryCategory::General),
+                          sizeBefore + 100 * sizeof(int));
+    }
+
+    BOOST_CHECK_EQUAL(CEGUI::MemoryAllocator::getAllocatedSize(CEGUI::MemoryCategory::General),
+                      sizeBefore);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,163 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/widgets/MultiLineEditbox.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+struct MultiLineEditboxFixture
+{
+    MultiLineEditboxFixture()
+    {
+        d_editbox = static_cast<CEGUI::MultiLineEditbox*>(
+            CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/MultiLineEditbox"));
+        d_editbox->setFont("DejaVuSans-12");
+        d_editbox->setSize(CEGUI::USize(CEGUI::UDim(0.f, 300.f), CEGUI::UDim(0.f, 200.f)));
+
+        CEGUI::System& system = CEGUI::System::getSingleton();
+        d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+        d_context->setRootWindow(d_editbox);
+    }
+
+    ~MultiLineEditboxFixture()
+    {
+        d_context->setRootWindow(nullptr);
+        CEGUI::System::getSingleton().destroyGUIContext(*d_context);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_editbox);
+    }
+
+    //! Checks that the current lines match those of a complete reformatting.
+    void checkLinesMatchFullFormatting()
+    {
+        const CEGUI::MultiLineEditbox::LineList lines = d_editbox->getFormattedLines();
+        d_editbox->formatText(false);
+        const CEGUI::MultiLineEditbox::LineList& expected = d_editbox->getFormattedLines();
+
+        BOOST_REQUIRE_EQUAL(lines.size(), expected.size());
+        for (size_t i = 0; i < lines.size(); ++i)
+        {
+            BOOST_CHECK_EQUAL(lines[i].d_startIdx, expected[i].d_startIdx);
+            BOOST_CHECK_EQUAL(lines[i].d_length, expected[i].d_length);
+            BOOST_CHECK_EQUAL(lines[i].d_extent, expected[i].d_extent);
+        }
+    }
+
+    CEGUI::GUIContext* d_context;
+    CEGUI::MultiLineEditbox* d_editbox;
+};
+
+const CEGUI::String Paragraph("Lorem ipsum dolor sit amet, consectetur adipiscing "
+    "elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.\n");
+}
+
+BOOST_FIXTURE_TEST_SUITE(MultiLineEditbox, MultiLineEditboxFixture)
+
+BOOST_AUTO_TEST_CASE(EditsReformatLikeFullFormatting)
+{
+    CEGUI::String text;
+    for (int i = 0; i < 20; ++i)
+        text += Paragraph;
+    d_editbox->setText(text);
+    checkLinesMatchFullFormatting();
+
+    // insert a word in the middle of a paragraph
+    text.insert(Paragraph.length() * 5 + 12, "inserted ");
+    d_editbox->setText(text);
+    checkLinesMatchFullFormatting();
+
+    // split a paragraph and join two others
+    text.insert(Paragraph.length() * 8 + 30, "\n");
+    text.erase(Paragraph.length() * 12 - 1, 1);
+    d_editbox->setText(text);
+    checkLinesMatchFullFormatting();
+
+    // shorten the last paragraph and remove the first one
+    text.erase(text.length() - 20, 10);
+    text.erase(0, Paragraph.length());
+    d_editbox->setText(text);
+    checkLinesMatchFullFormatting();
+}
+
+BOOST_AUTO_TEST_CASE(InPlaceTextEdits)
+{
+    d_editbox->setText("Hello world\nSecond line\n");
+
+    d_editbox->replaceText(6, 5, "there");
+    BOOST_CHECK_EQUAL(d_editbox->getText(), "Hello there\nSecond line\n");
+    checkLinesMatchFullFormatting();
+
+    d_editbox->eraseText(0, 12);
+    BOOST_CHECK_EQUAL(d_editbox->getText(), "Second line\n");
+    checkLinesMatchFullFormatting();
+
+    // the editbox keeps its text terminated by a line break
+    d_editbox->eraseText(6, 6);
+    BOOST_CHECK_EQUAL(d_editbox->getText(), "Second\n");
+}
+
+BOOST_AUTO_TEST_CASE(LineNumberFromIndex)
+{
+    d_editbox->setWordWrapping(false);
+    d_editbox->setText("first\nsecond\nthird\n");
+
+    BOOST_CHECK_EQUAL(d_editbox->getLineNumberFromIndex(0), 0u);
+    BOOST_CHECK_EQUAL(d_editbox->getLineNumberFromIndex(5), 0u);
+    BOOST_CHECK_EQUAL(d_editbox->getLineNumberFromIndex(6), 1u);
+    BOOST_CHECK_EQUAL(d_editbox->getLineNumberFromIndex(13), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(CaretMovesWithoutRedraw)
+{
+    d_editbox->setText("first\nsecond\n");
+    d_editbox->activate();
+    CEGUI::System::getSingleton().renderAllGUIContexts();
+
+    const std::vector<CEGUI::GeometryBuffer*> buffers = d_editbox->getGeometryBuffers();
+    BOOST_REQUIRE(!buffers.empty());
+    BOOST_CHECK(buffers.back()->getCustomTransform() == glm::mat4(1.0f));
+
+    // the caret geometry is drawn last and is moved by its transform, the
+    // rest of the geometry is kept
+    d_editbox->setCaretIndex(8);
+    CEGUI::System::getSingleton().renderAllGUIContexts();
+
+    BOOST_CHECK(d_editbox->getGeometryBuffers() == buffers);
+    BOOST_CHECK(buffers.back()->getCustomTransform() != glm::mat4(1.0f));
+
+    // changing the text still redraws everything
+    d_editbox->setText("third\n");
+    CEGUI::System::getSingleton().renderAllGUIContexts();
+    BOOST_CHECK(d_editbox->getGeometryBuffers().back()->getCustomTransform() == glm::mat4(1.0f));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -26,9 +26,12 @@
  ***************************************************************************/
 
 #include "CEGUI/NamedElement.h"
+#include "CEGUI/PropertyHelper.h"
 
 #include <boost/test/unit_test.hpp>
 
+#include <vector>
+
 BOOST_AUTO_TEST_SUITE(NamedElement)
 
 BOOST_AUTO_TEST_CASE(Children)
@@ -95,4 +98,48 @@ BOOST_AUTO_TEST_CASE(FindRecursive)
     delete root;
 }
 
+BOOST_AUTO_TEST_CASE(ManyChildren)
+{
+    CEGUI::NamedElement* root = new CEGUI::NamedElement("root");
+    std::vector<CEGUI::NamedElement*> children;
+    for (size_t i = 0; i < CEGUI::NamedElement::ChildNameIndexThreshold * 2; ++i)
+    {
+        children.push_back(new CEGUI::NamedElement(
+            "child" + CEGUI::PropertyHelper<std::uint32_t>::toString(static_cast<std::uint32_t>(i))));
+        root->addChild(children.back());
+    }
+
+    CEGUI::NamedElement* inner_child = new CEGUI::NamedElement("inner_child");
+    children[3]->addChild(inner_child);
+
+    BOOST_CHECK_EQUAL(root->getChildElement("child0"), children[0]);
+    BOOST_CHECK_EQUAL(root->getChildElement("child12"), children[12]);
+    BOOST_CHECK_EQUAL(root->getChildElement("child3/inner_child"), inner_child);
+    BOOST_CHECK_EQUAL(root->getChildElement("child3/"), children[3]);
+    BOOST_CHECK(!root->isChild("child"));
+    BOOST_CHECK(!root->isChild("child3/inner"));
+    CEGUI::NamedElement duplicate("child5");
+    BOOST_CHECK_THROW(root->addChild(&duplicate), CEGUI::AlreadyExistsException);
+    BOOST_CHECK_EQUAL(root->getChildElementRecursive("inner_child"), inner_child);
+
+    // renamed and removed children are found under their new names only
+    children[7]->setName("renamed");
+    BOOST_CHECK_EQUAL(root->getChildElement("renamed"), children[7]);
+    BOOST_CHECK(!root->isChild("child7"));
+    BOOST_CHECK_THROW(children[8]->setName("renamed"), CEGUI::AlreadyExistsException);
+
+    root->removeChild("child9");
+    BOOST_CHECK(!root->isChild("child9"));
+    BOOST_CHECK_EQUAL(children[9]->getParentElement(), static_cast<CEGUI::Element*>(nullptr));
+
+    children[3]->removeChild(inner_child);
+    delete inner_child;
+    for (CEGUI::NamedElement* child : children)
+    {
+        root->removeChild(child);
+        delete child;
+    }
+    delete root;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
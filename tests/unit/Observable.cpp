@@ -0,0 +1,88 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Observable.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(ObservableBinding)
+
+BOOST_AUTO_TEST_CASE(ChangesAreAppliedInBatches)
+{
+    CEGUI::Window* wnd = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    CEGUI::Observable<float> alpha(0.5f);
+    CEGUI::Observable<CEGUI::String> text("first");
+
+    wnd->bindProperty("Alpha", alpha);
+    wnd->bindProperty("Text", text);
+    BOOST_CHECK_EQUAL(wnd->getAlpha(), 0.5f);
+    BOOST_CHECK_EQUAL(wnd->getText(), "first");
+
+    // setting the current value queues nothing
+    alpha.set(0.5f);
+    BOOST_CHECK(!alpha.isChangePending());
+
+    alpha.set(0.25f);
+    alpha.set(0.75f);
+    text = "second";
+    BOOST_CHECK(alpha.isChangePending());
+    BOOST_CHECK_EQUAL(wnd->getAlpha(), 0.5f);
+
+    CEGUI::ObservableBase::applyPendingChanges();
+    BOOST_CHECK(!alpha.isChangePending());
+    BOOST_CHECK_EQUAL(wnd->getAlpha(), 0.75f);
+    BOOST_CHECK_EQUAL(wnd->getText(), "second");
+
+    wnd->unbindProperty("Text", text);
+    text = "third";
+    CEGUI::ObservableBase::applyPendingChanges();
+    BOOST_CHECK_EQUAL(wnd->getText(), "second");
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(wnd);
+    BOOST_CHECK_EQUAL(alpha.getBindingCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(DestroyedObservablesAreSkipped)
+{
+    CEGUI::Window* wnd = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    {
+        CEGUI::Observable<float> alpha(0.5f);
+        wnd->bindProperty("Alpha", alpha);
+        alpha.set(0.25f);
+    }
+
+    CEGUI::ObservableBase::applyPendingChanges();
+    BOOST_CHECK_EQUAL(wnd->getAlpha(), 0.5f);
+
+    CEGUI::Observable<int> unknown;
+    BOOST_CHECK_THROW(wnd->bindProperty("NoSuchProperty", unknown), CEGUI::UnknownObjectException);
+    CEGUI::WindowManager::getSingleton().destroyWindow(wnd);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
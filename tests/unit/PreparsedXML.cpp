@@ -0,0 +1,173 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/PreparsedXML.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+#include <sstream>
+
+namespace
+{
+const char s_document[] =
+    "<Root version=\"7\">"
+    "<Item name=\"first\" value=\"1\"/>"
+    "<Item name=\"second\">Some text</Item>"
+    "</Root>";
+
+//! Handler writing the events it receives as lines of a string.
+class EventLog : public CEGUI::XMLHandler
+{
+public:
+    const CEGUI::String& getDefaultResourceGroup() const override
+    {
+        return d_resourceGroup;
+    }
+
+    void elementStart(const CEGUI::String& element,
+                      const CEGUI::XMLAttributes& attributes) override
+    {
+        d_log << "start " << element;
+        if (attributes.exists("name"))
+            d_log << " name=" << attributes.getValue("name");
+        if (attributes.exists("value"))
+            d_log << " value=" << attributes.getValue("value");
+        d_log << " count=" << attributes.getCount() << "\n";
+    }
+
+    void elementEnd(const CEGUI::String& element) override
+    {
+        d_log << "end " << element << "\n";
+    }
+
+    void text(const CEGUI::String& text) override
+    {
+        d_log << "text " << text << "\n";
+    }
+
+    std::string str() const { return d_log.str(); }
+
+private:
+    CEGUI::String d_resourceGroup;
+    std::ostringstream d_log;
+};
+
+void setContainerData(CEGUI::RawDataContainer& container, const std::string& data)
+{
+    std::uint8_t* const buffer = new std::uint8_t[data.size()];
+    std::memcpy(buffer, data.data(), data.size());
+    container.setData(buffer);
+    container.setSize(data.size());
+}
+}
+
+BOOST_AUTO_TEST_SUITE(PreparsedXML)
+
+BOOST_AUTO_TEST_CASE(ReplayMatchesParse)
+{
+    CEGUI::RawDataContainer source;
+    setContainerData(source, s_document);
+
+    EventLog parsed;
+    CEGUI::System::getSingleton().getXMLParser()->parseXML(parsed, source, "");
+
+    CEGUI::PreparsedXML recording;
+    recording.record(source, "");
+    std::ostringstream binary;
+    recording.write(binary);
+
+    CEGUI::RawDataContainer data;
+    setContainerData(data, binary.str());
+    CEGUI::PreparsedXML loaded;
+    BOOST_REQUIRE(loaded.read(data, CEGUI::PreparsedXML::computeSourceHash(source)));
+
+    EventLog replayed;
+    loaded.replay(replayed);
+    BOOST_CHECK(!parsed.str().empty());
+    BOOST_CHECK_EQUAL(replayed.str(), parsed.str());
+}
+
+BOOST_AUTO_TEST_CASE(RejectsOutdatedAndDamagedData)
+{
+    CEGUI::RawDataContainer source;
+    setContainerData(source, s_document);
+
+    CEGUI::PreparsedXML recording;
+    recording.record(source, "");
+    std::ostringstream binary;
+    recording.write(binary);
+    const std::string bytes(binary.str());
+    const std::uint64_t hash = CEGUI::PreparsedXML::computeSourceHash(source);
+
+    CEGUI::PreparsedXML loaded;
+    CEGUI::RawDataContainer data;
+    setContainerData(data, bytes);
+    BOOST_CHECK(!loaded.read(data, hash + 1));
+    BOOST_CHECK(loaded.empty());
+
+    CEGUI::RawDataContainer truncated;
+    setContainerData(truncated, bytes.substr(0, bytes.size() - 2));
+    BOOST_CHECK(!loaded.read(truncated, hash));
+    BOOST_CHECK(loaded.empty());
+
+    // an event referring to a string that does not exist
+    std::string damaged(bytes);
+    damaged[damaged.size() - 4] = static_cast<char>(0xFF);
+    CEGUI::RawDataContainer damagedData;
+    setContainerData(damagedData, damaged);
+    BOOST_CHECK(!loaded.read(damagedData, hash));
+    BOOST_CHECK(loaded.empty());
+}
+
+BOOST_AUTO_TEST_CASE(ReadsWithoutSourceHash)
+{
+    CEGUI::RawDataContainer source;
+    setContainerData(source, s_document);
+    BOOST_CHECK(!CEGUI::PreparsedXML::isPreparsedData(source));
+
+    CEGUI::PreparsedXML recording;
+    recording.record(source, "");
+    std::ostringstream binary;
+    recording.write(binary);
+
+    CEGUI::RawDataContainer data;
+    setContainerData(data, binary.str());
+    BOOST_CHECK(CEGUI::PreparsedXML::isPreparsedData(data));
+
+    CEGUI::PreparsedXML loaded;
+    BOOST_REQUIRE(loaded.read(data));
+    BOOST_CHECK_EQUAL(loaded.getSourceHash(), CEGUI::PreparsedXML::computeSourceHash(source));
+    BOOST_CHECK(!loaded.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,71 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ChromeTraceProfilerBackend.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <string>
+
+BOOST_AUTO_TEST_SUITE(Profiling)
+
+namespace
+{
+const CEGUI::ProfileZone OuterZone = { "Outer", "outerFunction", "Profiler.cpp", 1, 0 };
+const CEGUI::ProfileZone InnerZone = { "Inner \"quoted\"", "innerFunction", "Profiler.cpp", 2, 0 };
+}
+
+BOOST_AUTO_TEST_CASE(ChromeTraceRecordsNestedZones)
+{
+    CEGUI::ChromeTraceProfilerBackend backend;
+    CEGUI::Profiler::setBackend(&backend);
+    {
+        CEGUI::ProfileScope outer(OuterZone);
+        CEGUI::ProfileScope inner(InnerZone);
+    }
+    CEGUI::Profiler::setBackend(nullptr);
+
+    // zones entered without a backend are not reported
+    {
+        CEGUI::ProfileScope ignored(OuterZone);
+    }
+
+    BOOST_CHECK_EQUAL(backend.getEventCount(), 2u);
+
+    std::ostringstream trace;
+    backend.writeTrace(trace);
+    const std::string json = trace.str();
+    BOOST_CHECK_EQUAL(json.compare(0, 15, "{\"traceEvents\":"), 0);
+    BOOST_CHECK(json.find("\"name\":\"Outer\"") != std::string::npos);
+    BOOST_CHECK(json.find("\"name\":\"Inner \\\"quoted\\\"\"") != std::string::npos);
+    BOOST_CHECK(json.find("\"ph\":\"X\"") != std::string::npos);
+
+    backend.clear();
+    BOOST_CHECK_EQUAL(backend.getEventCount(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,103 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+#include "CEGUI/falagard/WidgetLookFeel.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+const CEGUI::String s_lookName("Test/PropertyDependencies");
+const CEGUI::String s_lookSource(
+    "<Falagard version=\"7\">"
+    "  <WidgetLook name=\"Test/PropertyDependencies\">"
+    "    <PropertyDefinition name=\"Inset\" initialValue=\"0\" layoutOnWrite=\"true\""
+    "        fireEvent=\"InsetChanged\" type=\"float\"/>"
+    "    <PropertyDefinition name=\"Tint\" initialValue=\"FFFFFFFF\" redrawOnWrite=\"true\""
+    "        fireEvent=\"TintChanged\" type=\"ColourRect\"/>"
+    "    <NamedArea name=\"Client\">"
+    "      <Area><Dim type=\"LeftEdge\"><PropertyDim name=\"Inset\"/></Dim></Area>"
+    "    </NamedArea>"
+    "    <ImagerySection name=\"main\">"
+    "      <ColourProperty name=\"Tint\"/>"
+    "    </ImagerySection>"
+    "  </WidgetLook>"
+    "</Falagard>");
+
+struct PropertyDefinitionFixture
+{
+    PropertyDefinitionFixture()
+    {
+        CEGUI::WidgetLookManager::getSingleton().parseLookNFeelSpecificationFromString(s_lookSource);
+    }
+
+    ~PropertyDefinitionFixture()
+    {
+        CEGUI::WidgetLookManager::getSingleton().eraseWidgetLook(s_lookName);
+    }
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(PropertyDefinition, PropertyDefinitionFixture)
+
+BOOST_AUTO_TEST_CASE(DependenciesAreTracked)
+{
+    const CEGUI::WidgetLookFeel& look =
+        CEGUI::WidgetLookManager::getSingleton().getWidgetLook(s_lookName);
+
+    BOOST_CHECK_EQUAL(look.getPropertyDependencies("Inset"),
+                      CEGUI::WidgetLookFeel::NamedAreaDependency);
+    BOOST_CHECK_EQUAL(look.getPropertyDependencies("Tint"),
+                      CEGUI::WidgetLookFeel::ImageryDependency);
+    BOOST_CHECK_EQUAL(look.getPropertyDependencies("Unknown"), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(UnchangedWriteDoesNothing)
+{
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    window->setWindowRenderer("Core/Default");
+    window->setLookNFeel(s_lookName);
+
+    int insetChanges = 0;
+    window->subscribeEvent("InsetChanged", [&insetChanges]() { ++insetChanges; });
+
+    window->setProperty("Inset", "0");
+    BOOST_CHECK_EQUAL(insetChanges, 0);
+    window->setProperty("Inset", "4");
+    BOOST_CHECK_EQUAL(insetChanges, 1);
+    window->setProperty("Inset", "4");
+    BOOST_CHECK_EQUAL(insetChanges, 1);
+
+    // the look is erased along with the fixture, so clean the window up first
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+    CEGUI::WindowManager::getSingleton().cleanDeadPool();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
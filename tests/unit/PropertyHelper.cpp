@@ -26,6 +26,13 @@
  ***************************************************************************/
 
 #include "CEGUI/PropertyHelper.h"
+#include "CEGUI/Colour.h"
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/Rectf.h"
+#include "CEGUI/Sizef.h"
+
+#include <limits>
 
 #include <boost/test/unit_test.hpp>
 
@@ -258,4 +265,24 @@ BOOST_AUTO_TEST_CASE(Sizef)
     BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::Sizef>::fromString(CEGUI::PropertyHelper<CEGUI::Sizef>::toString(CEGUI::Sizef(-123456.25f, 1234567))), CEGUI::Sizef(-123456.25f, 1234567));
 }
 
+BOOST_AUTO_TEST_CASE(UnusualNumberNotations)
+{
+    // limits of the integer types
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<std::int64_t>::toString(std::numeric_limits<std::int64_t>::min()),
+                      "-9223372036854775808");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<std::int64_t>::fromString("-9223372036854775808"),
+                      std::numeric_limits<std::int64_t>::min());
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<std::uint64_t>::fromString("18446744073709551615"),
+                      std::numeric_limits<std::uint64_t>::max());
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<std::int16_t>::fromString("40000"), CEGUI::InvalidRequestException);
+
+    // exponents, signs and trailing characters
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(1e20f), "1e+20");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(-0.0f), "-0");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::fromString("1.5e2"), 150.0f);
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::fromString("+.5"), 0.5f);
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::fromString(" 2px"), 2.0f);
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::UDim>::fromString("{1e0,-2.5E1}"), CEGUI::UDim(1, -25));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
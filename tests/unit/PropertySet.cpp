@@ -93,4 +93,84 @@ BOOST_AUTO_TEST_CASE(SettingGetting)
     BOOST_CHECK_EQUAL(set.getProperty<int>("MemberValue"), 10);
 }
 
+BOOST_AUTO_TEST_CASE(AccessByInternedName)
+{
+    TestPropertySet set;
+    const CEGUI::InternedName name(CEGUI::String("MemberValue"));
+
+    BOOST_CHECK(set.isPropertyPresent(name));
+    set.setProperty<int>(name, 7);
+    BOOST_CHECK_EQUAL(set.getProperty<int>(name), 7);
+    set.setProperty(name, "8");
+    BOOST_CHECK_EQUAL(set.getProperty(name), "8");
+    BOOST_CHECK_THROW(set.getProperty(CEGUI::InternedName()), CEGUI::UnknownObjectException);
+}
+
+BOOST_AUTO_TEST_CASE(AccessByHandle)
+{
+    TestPropertySet set;
+
+    const CEGUI::PropertyHandle<int> handle = set.getPropertyHandle<int>("MemberValue");
+    BOOST_REQUIRE(handle.isValid());
+    BOOST_CHECK(handle.isNative());
+    handle.set(12);
+    BOOST_CHECK_EQUAL(set.getMemberValue(), 12);
+    BOOST_CHECK_EQUAL(handle.get(), 12);
+
+    // a handle of another type falls back to string conversion
+    const CEGUI::PropertyHandle<CEGUI::String> stringHandle =
+        set.getPropertyHandle<CEGUI::String>("MemberValue");
+    BOOST_CHECK(!stringHandle.isNative());
+    stringHandle.set("5");
+    BOOST_CHECK_EQUAL(set.getMemberValue(), 5);
+    BOOST_CHECK_EQUAL(stringHandle.get(), "5");
+
+    BOOST_CHECK(!CEGUI::PropertyHandle<int>().isValid());
+    BOOST_CHECK_THROW(set.getPropertyHandle<int>("NonExistant"), CEGUI::UnknownObjectException);
+}
+
+BOOST_AUTO_TEST_CASE(DefaultComparison)
+{
+    TestPropertySet set;
+
+    const CEGUI::TypedProperty<int>* const property =
+        dynamic_cast<const CEGUI::TypedProperty<int>*>(set.getPropertyInstance("MemberValue"));
+    BOOST_REQUIRE(property);
+    BOOST_CHECK_EQUAL(property->getNativeDefault(), 0);
+
+    BOOST_CHECK(set.isPropertyDefault("MemberValue"));
+    set.setMemberValue(4);
+    BOOST_CHECK(!set.isPropertyDefault("MemberValue"));
+    set.setProperty("MemberValue", "0");
+    BOOST_CHECK(set.isPropertyDefault("MemberValue"));
+}
+
+BOOST_AUTO_TEST_CASE(TablesAreSharedAndReplayed)
+{
+    TestPropertySet first;
+    TestPropertySet second;
+    BOOST_CHECK_EQUAL(first.getPropertyInstance("MemberValue"),
+                      second.getPropertyInstance("MemberValue"));
+    BOOST_CHECK(first.getPropertyInstance("MemberValue")->getInternedName() ==
+                CEGUI::InternedName(CEGUI::String("MemberValue")));
+
+    // a set taking another path through the tables does not disturb the others
+    first.removeProperty("MemberValue");
+    BOOST_CHECK(!first.isPropertyPresent("MemberValue"));
+    BOOST_CHECK(second.isPropertyPresent("MemberValue"));
+
+    CEGUI::TplWindowProperty<TestPropertySet, int> other("OtherValue", "", "TestPropertySet",
+        &TestPropertySet::setMemberValue, &TestPropertySet::getMemberValue, 0);
+    first.addProperty(&other);
+    first.defineProperty();
+    BOOST_CHECK(first.isPropertyPresent("OtherValue"));
+    BOOST_CHECK(first.isPropertyPresent("MemberValue"));
+
+    TestPropertySet third;
+    BOOST_CHECK(third.isPropertyPresent("MemberValue"));
+    BOOST_CHECK(!third.isPropertyPresent("OtherValue"));
+    third.setProperty<int>("MemberValue", 3);
+    BOOST_CHECK_EQUAL(third.getMemberValue(), 3);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
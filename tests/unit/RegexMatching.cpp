@@ -31,6 +31,7 @@
 
 #include "CEGUI/RegexMatcher.h"
 #include "CEGUI/System.h"
+#include "CEGUI/Exceptions.h"
 
 #include <boost/test/unit_test.hpp>
 
@@ -134,6 +135,25 @@ BOOST_AUTO_TEST_CASE(SmokeTests)
     BOOST_CHECK_EQUAL(d_regexMatcher->getMatchStateOfString(":192.168.1.111"), CEGUI::RegexMatcher::MatchState::Invalid);
 }
 
+BOOST_AUTO_TEST_CASE(SharedMatchers)
+{
+    CEGUI::System& system = CEGUI::System::getSingleton();
+
+    CEGUI::RegexMatcher* first = system.acquireRegexMatcher("[0-9]*");
+    CEGUI::RegexMatcher* second = system.acquireRegexMatcher("[0-9]*");
+    CEGUI::RegexMatcher* other = system.acquireRegexMatcher("[a-z]*");
+    BOOST_CHECK_EQUAL(first, second);
+    BOOST_CHECK(first != other);
+    BOOST_CHECK_EQUAL(first->getMatchStateOfString("42"), CEGUI::RegexMatcher::MatchState::Valid);
+
+    system.releaseRegexMatcher(first);
+    BOOST_CHECK_EQUAL(second->getMatchStateOfString("4a"), CEGUI::RegexMatcher::MatchState::Invalid);
+    system.releaseRegexMatcher(second);
+    system.releaseRegexMatcher(other);
+
+    BOOST_CHECK_THROW(system.acquireRegexMatcher("(unbalanced"), CEGUI::InvalidRequestException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
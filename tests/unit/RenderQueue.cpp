@@ -0,0 +1,187 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/RenderQueue.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Vertex.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+//! Creates a buffer holding a triangle spanning \a area, coloured or textured.
+CEGUI::GeometryBuffer& createBuffer(const CEGUI::Rectf& area, bool textured)
+{
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    const glm::vec4 white(1.0f, 1.0f, 1.0f, 1.0f);
+    const glm::vec3 corners[3] = {
+        glm::vec3(area.left(), area.top(), 0.0f),
+        glm::vec3(area.right(), area.top(), 0.0f),
+        glm::vec3(area.left(), area.bottom(), 0.0f) };
+
+    if (textured)
+    {
+        CEGUI::GeometryBuffer& buffer = renderer->createGeometryBufferTextured();
+        std::vector<CEGUI::TexturedColouredVertex> vertices;
+        for (const glm::vec3& corner : corners)
+            vertices.push_back(CEGUI::TexturedColouredVertex(corner, white, glm::vec2(0.0f, 0.0f)));
+        buffer.appendGeometry(vertices);
+        return buffer;
+    }
+
+    CEGUI::GeometryBuffer& buffer = renderer->createGeometryBufferColoured();
+    std::vector<CEGUI::ColouredVertex> vertices;
+    for (const glm::vec3& corner : corners)
+        vertices.push_back(CEGUI::ColouredVertex(corner, white));
+    buffer.appendGeometry(vertices);
+    return buffer;
+}
+
+//! Creates a buffer holding a quad covering \a area in the given colour.
+CEGUI::GeometryBuffer& createQuadBuffer(const CEGUI::Rectf& area, const glm::vec4& colour)
+{
+    CEGUI::GeometryBuffer& buffer =
+        CEGUI::System::getSingleton().getRenderer()->createGeometryBufferColoured();
+    const glm::vec3 corners[6] = {
+        glm::vec3(area.left(), area.top(), 0.0f),
+        glm::vec3(area.left(), area.bottom(), 0.0f),
+        glm::vec3(area.right(), area.bottom(), 0.0f),
+        glm::vec3(area.right(), area.bottom(), 0.0f),
+        glm::vec3(area.right(), area.top(), 0.0f),
+        glm::vec3(area.left(), area.top(), 0.0f) };
+
+    std::vector<CEGUI::ColouredVertex> vertices;
+    for (const glm::vec3& corner : corners)
+        vertices.push_back(CEGUI::ColouredVertex(corner, colour));
+    buffer.appendGeometry(vertices);
+    return buffer;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(RenderQueueReordering)
+
+BOOST_AUTO_TEST_CASE(SeparateBuffersAreGroupedByMaterial)
+{
+    CEGUI::GeometryBuffer& first = createBuffer(CEGUI::Rectf(0, 0, 10, 10), false);
+    CEGUI::GeometryBuffer& second = createBuffer(CEGUI::Rectf(20, 0, 30, 10), true);
+    CEGUI::GeometryBuffer& third = createBuffer(CEGUI::Rectf(40, 0, 50, 10), false);
+
+    CEGUI::RenderQueue queue;
+    queue.addGeometryBuffer(first);
+    queue.addGeometryBuffer(second);
+    queue.addGeometryBuffer(third);
+
+    // nothing is reordered unless enabled
+    queue.updateDrawOrder();
+    BOOST_CHECK(queue.getDrawOrder() == queue.getBuffers());
+
+    queue.setReorderingEnabled(true);
+    queue.updateDrawOrder();
+    const std::vector<CEGUI::GeometryBuffer*>& order = queue.getDrawOrder();
+    BOOST_REQUIRE_EQUAL(order.size(), 3u);
+    BOOST_CHECK(order[0] == &first);
+    BOOST_CHECK(order[1] == &third);
+    BOOST_CHECK(order[2] == &second);
+
+    // changing the queue falls back to the submission order until updated
+    queue.removeGeometryBuffer(third);
+    BOOST_CHECK(queue.getDrawOrder() == queue.getBuffers());
+
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    renderer->destroyGeometryBuffer(first);
+    renderer->destroyGeometryBuffer(second);
+    renderer->destroyGeometryBuffer(third);
+}
+
+BOOST_AUTO_TEST_CASE(OverlappingBuffersKeepTheirOrder)
+{
+    CEGUI::GeometryBuffer& first = createBuffer(CEGUI::Rectf(0, 0, 10, 10), false);
+    CEGUI::GeometryBuffer& second = createBuffer(CEGUI::Rectf(20, 0, 30, 10), true);
+    CEGUI::GeometryBuffer& third = createBuffer(CEGUI::Rectf(25, 5, 35, 15), false);
+
+    CEGUI::RenderQueue queue;
+    queue.setReorderingEnabled(true);
+    queue.addGeometryBuffer(first);
+    queue.addGeometryBuffer(second);
+    queue.addGeometryBuffer(third);
+    queue.updateDrawOrder();
+    BOOST_CHECK(queue.getDrawOrder() == queue.getBuffers());
+
+    // clipping the third buffer away from the second one allows moving it
+    third.setClippingRegion(CEGUI::Rectf(30, 0, 40, 20));
+    third.setClippingActive(true);
+    queue.updateDrawOrder();
+    BOOST_CHECK(queue.getDrawOrder()[1] == &third);
+
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    renderer->destroyGeometryBuffer(first);
+    renderer->destroyGeometryBuffer(second);
+    renderer->destroyGeometryBuffer(third);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(RenderQueueOcclusionCulling)
+
+BOOST_AUTO_TEST_CASE(BuffersBehindOpaqueQuadsAreSkipped)
+{
+    CEGUI::GeometryBuffer& hidden = createBuffer(CEGUI::Rectf(10, 10, 20, 20), true);
+    CEGUI::GeometryBuffer& visible = createBuffer(CEGUI::Rectf(90, 10, 110, 20), false);
+    CEGUI::GeometryBuffer& panel = createQuadBuffer(CEGUI::Rectf(0, 0, 100, 100),
+                                                    glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+
+    CEGUI::Rectf opaque;
+    BOOST_CHECK(!hidden.getOpaqueArea(opaque));
+    BOOST_REQUIRE(panel.getOpaqueArea(opaque));
+    BOOST_CHECK(opaque == CEGUI::Rectf(0, 0, 100, 100));
+
+    CEGUI::RenderQueue queue;
+    queue.addGeometryBuffer(hidden);
+    queue.addGeometryBuffer(visible);
+    queue.addGeometryBuffer(panel);
+
+    queue.setOcclusionCullingEnabled(true);
+    queue.updateDrawOrder();
+    const std::vector<CEGUI::GeometryBuffer*>& order = queue.getDrawOrder();
+    BOOST_REQUIRE_EQUAL(order.size(), 2u);
+    BOOST_CHECK(order[0] == &visible);
+    BOOST_CHECK(order[1] == &panel);
+
+    // a translucent panel hides nothing
+    panel.setAlpha(0.5f);
+    queue.updateDrawOrder();
+    BOOST_CHECK(queue.getDrawOrder() == queue.getBuffers());
+
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    renderer->destroyGeometryBuffer(hidden);
+    renderer->destroyGeometryBuffer(visible);
+    renderer->destroyGeometryBuffer(panel);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
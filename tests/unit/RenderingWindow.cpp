@@ -0,0 +1,223 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/RenderingWindow.h"
+#include "CEGUI/Affector.h"
+#include "CEGUI/Animation.h"
+#include "CEGUI/AnimationInstance.h"
+#include "CEGUI/AnimationManager.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/TextureTarget.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+struct RenderingWindowFixture
+{
+    RenderingWindowFixture()
+    {
+        CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+        d_root = winMgr.createWindow("DefaultWindow");
+        d_frame = winMgr.createWindow("DefaultWindow");
+        d_child = winMgr.createWindow("DefaultWindow");
+        d_frame->setUsingAutoRenderingSurface(true);
+        d_frame->setSize(CEGUI::USize(CEGUI::UDim(0, 200), CEGUI::UDim(0, 100)));
+        d_child->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 10), CEGUI::UDim(0, 10)));
+        d_child->setSize(CEGUI::USize(CEGUI::UDim(0, 20), CEGUI::UDim(0, 20)));
+        d_root->addChild(d_frame);
+        d_frame->addChild(d_child);
+
+        // nothing is drawn to an empty display, the default of the Null renderer
+        CEGUI::System& system = CEGUI::System::getSingleton();
+        system.notifyDisplaySizeChanged(CEGUI::Sizef(400, 400));
+        d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+        d_context->setRootWindow(d_root);
+        system.renderAllGUIContexts();
+    }
+
+    ~RenderingWindowFixture()
+    {
+        d_context->setRootWindow(nullptr);
+        CEGUI::System::getSingleton().destroyGUIContext(*d_context);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    CEGUI::RenderingWindow& getSurface() const
+    {
+        return static_cast<CEGUI::RenderingWindow&>(*d_frame->getRenderingSurface());
+    }
+
+    CEGUI::Window* d_root;
+    CEGUI::Window* d_frame;
+    CEGUI::Window* d_child;
+    CEGUI::GUIContext* d_context;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(RenderingWindow, RenderingWindowFixture)
+
+BOOST_AUTO_TEST_CASE(ChildInvalidationDamagesItsArea)
+{
+    BOOST_REQUIRE(d_frame->getRenderingSurface() != nullptr);
+    BOOST_REQUIRE(d_frame->getRenderingSurface()->isRenderingWindow());
+    BOOST_CHECK(!getSurface().isInvalidated());
+    BOOST_CHECK(getSurface().getDamagedAreas().empty());
+
+    d_child->invalidate();
+
+    BOOST_REQUIRE_EQUAL(getSurface().getDamagedAreas().size(), 1u);
+    const CEGUI::Rectf& area = getSurface().getDamagedAreas().front();
+    BOOST_CHECK_EQUAL(area.left(), 10.0f);
+    BOOST_CHECK_EQUAL(area.top(), 10.0f);
+    BOOST_CHECK_EQUAL(area.right(), 30.0f);
+    BOOST_CHECK_EQUAL(area.bottom(), 30.0f);
+
+    CEGUI::System::getSingleton().renderAllGUIContexts();
+
+    BOOST_CHECK(getSurface().getDamagedAreas().empty());
+    BOOST_CHECK(!getSurface().isInvalidated());
+}
+
+BOOST_AUTO_TEST_CASE(MovingChildDamagesOldAndNewArea)
+{
+    d_child->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 100), CEGUI::UDim(0, 60)));
+
+    BOOST_CHECK_EQUAL(getSurface().getDamagedAreas().size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(OverlappingAreasAreMerged)
+{
+    getSurface().invalidateArea(CEGUI::Rectf(0, 0, 20, 20));
+    getSurface().invalidateArea(CEGUI::Rectf(10, 10, 40, 30));
+
+    BOOST_REQUIRE_EQUAL(getSurface().getDamagedAreas().size(), 1u);
+    const CEGUI::Rectf& area = getSurface().getDamagedAreas().front();
+    BOOST_CHECK_EQUAL(area.right(), 40.0f);
+    BOOST_CHECK_EQUAL(area.bottom(), 30.0f);
+}
+
+BOOST_AUTO_TEST_CASE(LargeDamageFallsBackToFullRedraw)
+{
+    getSurface().invalidateArea(CEGUI::Rectf(0, 0, 150, 90));
+
+    BOOST_CHECK(getSurface().getDamagedAreas().empty());
+    BOOST_CHECK(getSurface().isInvalidated());
+
+    CEGUI::System::getSingleton().renderAllGUIContexts();
+    getSurface().setPartialRedrawThreshold(0.0f);
+    getSurface().invalidateArea(CEGUI::Rectf(0, 0, 5, 5));
+
+    BOOST_CHECK(getSurface().getDamagedAreas().empty());
+    BOOST_CHECK(getSurface().isInvalidated());
+}
+
+BOOST_AUTO_TEST_CASE(AnimationIsPresentedWithoutRedraw)
+{
+    CEGUI::AnimationManager& animMgr = CEGUI::AnimationManager::getSingleton();
+    CEGUI::Animation* fade = animMgr.createAnimation("PresentedFade");
+    fade->setDuration(1.0f);
+    fade->setReplayMode(CEGUI::Animation::ReplayMode::PlayOnce);
+    CEGUI::Affector* affector = fade->createAffector("Alpha", "float");
+    affector->createKeyFrame(0.0f, "1");
+    affector->createKeyFrame(1.0f, "0.5");
+
+    CEGUI::AnimationInstance* instance = animMgr.instantiateAnimation(fade);
+    instance->setTargetWindow(d_frame);
+    instance->setRenderSideEvaluationEnabled(true);
+    instance->start(false);
+    instance->step(0.5f);
+
+    // only the quad of the RenderingWindow changes during the animation
+    BOOST_CHECK(instance->isEvaluatedOnRenderSide());
+    BOOST_CHECK(getSurface().hasPresentationTransform());
+    BOOST_CHECK_EQUAL(d_frame->getAlpha(), 1.0f);
+    BOOST_CHECK(!getSurface().isInvalidated());
+
+    // the property is set once the animation ends
+    instance->step(0.5f);
+    BOOST_CHECK(!instance->isEvaluatedOnRenderSide());
+    BOOST_CHECK(!getSurface().hasPresentationTransform());
+    BOOST_CHECK_CLOSE(d_frame->getAlpha(), 0.5f, 0.0001f);
+
+    animMgr.destroyAnimationInstance(instance);
+    animMgr.destroyAnimation(fade);
+}
+
+BOOST_AUTO_TEST_CASE(ResolutionScaleShrinksTexture)
+{
+    const CEGUI::Rectf fullRect(getSurface().getTextureRect());
+
+    getSurface().setResolutionScale(0.5f);
+
+    BOOST_CHECK_EQUAL(getSurface().getResolutionScale(), 0.5f);
+    BOOST_CHECK(getSurface().isInvalidated());
+
+    const CEGUI::TextureTarget& target = getSurface().getTextureTarget();
+    BOOST_CHECK_EQUAL(target.getRenderScale(), 0.5f);
+    BOOST_CHECK_EQUAL(target.getArea().getWidth(), 100.0f);
+    BOOST_CHECK_EQUAL(target.getArea().getHeight(), 50.0f);
+    BOOST_CHECK_CLOSE(getSurface().getTextureRect().getWidth(), fullRect.getWidth() * 0.5f, 0.0001f);
+
+    // scissor rectangles cover every pixel the geometry touches
+    const CEGUI::Rectf pixels(target.getPixelRegion(CEGUI::Rectf(10, 10, 31, 31)));
+    BOOST_CHECK_EQUAL(pixels.left(), 5.0f);
+    BOOST_CHECK_EQUAL(pixels.right(), 16.0f);
+
+    BOOST_CHECK_THROW(getSurface().setResolutionScale(0.0f), CEGUI::InvalidRequestException);
+}
+
+BOOST_AUTO_TEST_CASE(RefreshRateCoalescesInvalidations)
+{
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    getSurface().setMaximumRefreshRate(1.0f);
+
+    // nothing was redrawn recently, so this redraw happens right away
+    d_child->invalidate();
+    BOOST_CHECK(getSurface().isInvalidated());
+    system.renderAllGUIContexts();
+    BOOST_CHECK(!getSurface().isRedrawRequired());
+
+    // within a second of the last redraw further changes wait
+    d_child->invalidate();
+    BOOST_CHECK(getSurface().isRefreshDeferred());
+    BOOST_CHECK(!getSurface().isInvalidated());
+    BOOST_CHECK(getSurface().isRedrawRequired());
+    system.renderAllGUIContexts();
+    BOOST_CHECK(getSurface().isRedrawRequired());
+
+    getSurface().setMaximumRefreshRate(0.0f);
+    BOOST_CHECK(getSurface().isInvalidated());
+    system.renderAllGUIContexts();
+    BOOST_CHECK(!getSurface().isRedrawRequired());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,143 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/BundleResourceProvider.h"
+#include "CEGUI/ResourceBundleWriter.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/PreparsedXML.h"
+#include "CEGUI/System.h"
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/XMLParser.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+//! Handler counting the elements it receives.
+class ElementCounter : public CEGUI::XMLHandler
+{
+public:
+    ElementCounter() :
+        d_count(0)
+    {}
+
+    const CEGUI::String& getDefaultResourceGroup() const override
+    {
+        return d_resourceGroup;
+    }
+
+    void elementStart(const CEGUI::String&, const CEGUI::XMLAttributes&) override
+    {
+        ++d_count;
+    }
+
+    size_t getCount() const { return d_count; }
+
+private:
+    CEGUI::String d_resourceGroup;
+    size_t d_count;
+};
+
+const char* const s_bundleFilename = "ResourceBundleTest.bundle";
+}
+
+BOOST_AUTO_TEST_SUITE(ResourceBundle)
+
+BOOST_AUTO_TEST_CASE(SchemeBundleServesItsFiles)
+{
+    CEGUI::ResourceBundleWriter writer;
+    writer.addScheme("TaharezLook.scheme");
+    BOOST_CHECK(writer.contains("TaharezLook.scheme", "schemes"));
+    BOOST_CHECK(writer.contains("TaharezLook.imageset", "imagesets"));
+    BOOST_CHECK(writer.contains("TaharezLook.png", "imagesets"));
+    BOOST_CHECK(writer.contains("DejaVuSans-12.font", "fonts"));
+    BOOST_CHECK(writer.contains("DejaVuSans.ttf", "fonts"));
+    BOOST_CHECK(writer.contains("TaharezLook.looknfeel", "looknfeels"));
+    BOOST_CHECK_EQUAL(writer.getFileCount(), 6u);
+    {
+        std::ofstream file(s_bundleFilename, std::ios::binary);
+        writer.write(file);
+    }
+
+    CEGUI::BundleResourceProvider provider;
+    provider.setResourceGroupDirectory("bundles", "./");
+    const CEGUI::BundleResourceProvider::BundledScheme scheme =
+        provider.mountBundle(s_bundleFilename, "bundles");
+    BOOST_CHECK_EQUAL(scheme.d_filename, "TaharezLook.scheme");
+    BOOST_CHECK_EQUAL(scheme.d_resourceGroup, "schemes");
+    BOOST_CHECK(provider.isResourceAvailable("TaharezLook.png", "imagesets"));
+    BOOST_CHECK(!provider.isBundled("TaharezLook.png", "fonts"));
+
+    // stored files are lent from the bundle unchanged
+    CEGUI::ResourceProvider* const files = CEGUI::System::getSingleton().getResourceProvider();
+    CEGUI::RawDataContainer original;
+    files->loadRawDataContainer("TaharezLook.png", original, "imagesets");
+    CEGUI::RawDataContainer bundled;
+    provider.loadRawDataContainer("TaharezLook.png", bundled, "imagesets");
+    BOOST_CHECK(bundled.isBorrowed());
+    BOOST_REQUIRE_EQUAL(bundled.getSize(), original.getSize());
+    BOOST_CHECK(std::memcmp(bundled.getDataPtr(), original.getDataPtr(), original.getSize()) == 0);
+    provider.unloadRawDataContainer(bundled);
+    files->unloadRawDataContainer(original);
+
+    // XML files are recorded, replaying them matches parsing them
+    ElementCounter parsed;
+    CEGUI::System::getSingleton().getXMLParser()->parseXMLFile(
+        parsed, "TaharezLook.scheme", "", "schemes");
+
+    CEGUI::PreparsedXML recording;
+    BOOST_REQUIRE(provider.loadPreparsedXML("TaharezLook.scheme", recording, "schemes"));
+    ElementCounter replayed;
+    recording.replay(replayed);
+    BOOST_CHECK_GT(parsed.getCount(), 0u);
+    BOOST_CHECK_EQUAL(replayed.getCount(), parsed.getCount());
+    BOOST_CHECK(!provider.loadPreparsedXML("TaharezLook.png", recording, "imagesets"));
+
+    std::remove(s_bundleFilename);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidBundleIsRejected)
+{
+    {
+        std::ofstream file(s_bundleFilename, std::ios::binary);
+        file << "CEGUIBND but not much else";
+    }
+
+    CEGUI::BundleResourceProvider provider;
+    provider.setResourceGroupDirectory("bundles", "./");
+    BOOST_CHECK_THROW(provider.mountBundle(s_bundleFilename, "bundles"),
+                      CEGUI::FileIOException);
+    BOOST_CHECK_EQUAL(provider.getMountedBundleCount(), 0u);
+
+    std::remove(s_bundleFilename);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
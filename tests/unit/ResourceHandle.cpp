@@ -0,0 +1,68 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/ResourceHandle.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/Image.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(ResourceHandle)
+
+BOOST_AUTO_TEST_CASE(FollowsTheManager)
+{
+    CEGUI::ImageManager& manager = CEGUI::ImageManager::getSingleton();
+    CEGUI::ImageHandle handle("ResourceHandleTestImage");
+    BOOST_CHECK(handle.get() == nullptr);
+
+    const std::uint32_t generation = manager.getGeneration();
+    CEGUI::Image& image = manager.create("BitmapImage", "ResourceHandleTestImage");
+    BOOST_CHECK(manager.getGeneration() != generation);
+    BOOST_CHECK_EQUAL(handle.get(), &image);
+    BOOST_CHECK_EQUAL(handle.get(), &image);
+
+    manager.destroy(image);
+    BOOST_CHECK(handle.get() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(RebindsToNewNames)
+{
+    CEGUI::ImageManager& manager = CEGUI::ImageManager::getSingleton();
+    CEGUI::Image& first = manager.create("BitmapImage", "ResourceHandleTestFirst");
+    CEGUI::Image& second = manager.create("BitmapImage", "ResourceHandleTestSecond");
+
+    CEGUI::ImageHandle handle;
+    BOOST_CHECK(handle.get() == nullptr);
+    BOOST_CHECK_EQUAL(handle.get("ResourceHandleTestFirst"), &first);
+    BOOST_CHECK_EQUAL(handle.get("ResourceHandleTestSecond"), &second);
+    BOOST_CHECK_EQUAL(handle.getName(), "ResourceHandleTestSecond");
+
+    manager.destroy(first);
+    manager.destroy(second);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
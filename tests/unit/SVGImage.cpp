@@ -0,0 +1,108 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/svg/SVGImage.h"
+#include "CEGUI/svg/SVGData.h"
+#include "CEGUI/svg/SVGBasicShape.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+
+std::size_t renderVertexCount(const CEGUI::SVGImage& image, const CEGUI::Rectf& area)
+{
+    std::vector<CEGUI::GeometryBuffer*> buffers =
+        image.createRenderGeometry(CEGUI::ImageRenderSettings(area));
+
+    std::size_t count = 0;
+    for (CEGUI::GeometryBuffer* buffer : buffers)
+    {
+        count += buffer->getVertexCount();
+        CEGUI::System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
+    }
+
+    return count;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(SVGImageTesselation)
+
+BOOST_AUTO_TEST_CASE(TesselationIsCachedPerScaleBucket)
+{
+    CEGUI::SVGData data("SVGImageTesselationData");
+    data.setWidth(100.0f);
+    data.setHeight(100.0f);
+    data.addShape(new CEGUI::SVGCircle(CEGUI::SVGPaintStyle(), glm::mat3x3(1.0f), 50.0f, 50.0f, 40.0f));
+    CEGUI::SVGImage image("SVGImageTesselationImage", data);
+
+    const std::size_t vertexCount = renderVertexCount(image, CEGUI::Rectf(0, 0, 100, 100));
+    BOOST_CHECK(vertexCount > 0);
+    BOOST_CHECK(data.getCachedTesselation(glm::ivec2(0, 0), true) != nullptr);
+
+    // a slightly different size falls into the same bucket and reuses the geometry
+    BOOST_CHECK_EQUAL(renderVertexCount(image, CEGUI::Rectf(0, 0, 101, 101)), vertexCount);
+
+    // adding a shape invalidates the cache
+    data.addShape(new CEGUI::SVGCircle(CEGUI::SVGPaintStyle(), glm::mat3x3(1.0f), 20.0f, 20.0f, 10.0f));
+    BOOST_CHECK(data.getCachedTesselation(glm::ivec2(0, 0), true) == nullptr);
+    BOOST_CHECK(renderVertexCount(image, CEGUI::Rectf(0, 0, 100, 100)) > vertexCount);
+}
+
+BOOST_AUTO_TEST_CASE(SegmentCountAdaptsToSize)
+{
+    CEGUI::SVGData data("SVGImageLevelOfDetailData");
+    data.setWidth(100.0f);
+    data.setHeight(100.0f);
+    data.addShape(new CEGUI::SVGCircle(CEGUI::SVGPaintStyle(), glm::mat3x3(1.0f), 50.0f, 50.0f, 40.0f));
+    CEGUI::SVGImage image("SVGImageLevelOfDetailImage", data);
+    image.setUseGeometryAntialiasing(false);
+
+    const std::size_t small = renderVertexCount(image, CEGUI::Rectf(0, 0, 8, 8));
+    const std::size_t large = renderVertexCount(image, CEGUI::Rectf(0, 0, 400, 400));
+    BOOST_CHECK(small > 0);
+    BOOST_CHECK(small < large);
+}
+
+BOOST_AUTO_TEST_CASE(AntialiasingIsSkippedAtSmallSizes)
+{
+    CEGUI::SVGData data("SVGImageAntialiasingData");
+    data.setWidth(100.0f);
+    data.setHeight(100.0f);
+    data.addShape(new CEGUI::SVGCircle(CEGUI::SVGPaintStyle(), glm::mat3x3(1.0f), 50.0f, 50.0f, 40.0f));
+    CEGUI::SVGImage image("SVGImageAntialiasingImage", data);
+
+    const std::size_t antialiased = renderVertexCount(image, CEGUI::Rectf(0, 0, 16, 16));
+    image.setGeometryAntialiasingMinimumSize(24.0f);
+    BOOST_CHECK(renderVertexCount(image, CEGUI::Rectf(0, 0, 16, 16)) < antialiased);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,74 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/SkylinePacker.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(SkylinePacker)
+
+BOOST_AUTO_TEST_CASE(PacksRectanglesWithoutOverlap)
+{
+    CEGUI::SkylinePacker packer(8);
+    glm::ivec2 first, second, third;
+
+    BOOST_REQUIRE(packer.pack(4, 4, first));
+    BOOST_REQUIRE(packer.pack(4, 2, second));
+    BOOST_REQUIRE(packer.pack(4, 4, third));
+
+    BOOST_CHECK(first == glm::ivec2(0, 0));
+    BOOST_CHECK(second == glm::ivec2(4, 0));
+    // the lowest resulting top edge is on top of the shorter rectangle
+    BOOST_CHECK(third == glm::ivec2(4, 2));
+}
+
+BOOST_AUTO_TEST_CASE(RejectsRectanglesThatDoNotFit)
+{
+    CEGUI::SkylinePacker packer(8);
+    glm::ivec2 position;
+
+    BOOST_CHECK(!packer.pack(9, 1, position));
+    BOOST_REQUIRE(packer.pack(8, 6, position));
+    BOOST_CHECK(!packer.pack(1, 3, position));
+    BOOST_CHECK(packer.pack(8, 2, position));
+}
+
+BOOST_AUTO_TEST_CASE(GrowingKeepsPackedRectangles)
+{
+    CEGUI::SkylinePacker packer(4);
+    glm::ivec2 position;
+
+    BOOST_REQUIRE(packer.pack(4, 4, position));
+    BOOST_CHECK(!packer.pack(4, 4, position));
+
+    packer.grow(8);
+    BOOST_CHECK_EQUAL(packer.getSize(), 8);
+    BOOST_REQUIRE(packer.pack(4, 4, position));
+    BOOST_CHECK(position == glm::ivec2(4, 0));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
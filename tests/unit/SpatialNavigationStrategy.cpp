@@ -0,0 +1,128 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/SpatialNavigationStrategy.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+const int GridSize = 5;
+const float ItemSize = 20.0f;
+
+struct SpatialNavigationFixture
+{
+    SpatialNavigationFixture()
+    {
+        CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+        d_root = winMgr.createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(0, 400), CEGUI::UDim(0, 400)));
+
+        for (int y = 0; y < GridSize; ++y)
+        {
+            for (int x = 0; x < GridSize; ++x)
+            {
+                CEGUI::Window* item = winMgr.createWindow("TaharezLook/Button");
+                item->setPosition(CEGUI::UVector2(CEGUI::UDim(0, x * ItemSize * 2),
+                                                  CEGUI::UDim(0, y * ItemSize * 2)));
+                item->setSize(CEGUI::USize(CEGUI::UDim(0, ItemSize), CEGUI::UDim(0, ItemSize)));
+                d_root->addChild(item);
+            }
+        }
+
+        d_strategy.addFocusableWindows(d_root);
+    }
+
+    ~SpatialNavigationFixture()
+    {
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+        CEGUI::WindowManager::getSingleton().cleanDeadPool();
+    }
+
+    CEGUI::Window* getItem(int x, int y) const
+    {
+        return d_root->getChildAtIndex(y * GridSize + x);
+    }
+
+    CEGUI::Window* d_root;
+    CEGUI::SpatialNavigationStrategy d_strategy;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(SpatialNavigation, SpatialNavigationFixture)
+
+BOOST_AUTO_TEST_CASE(NavigatesToNearestWindowInDirection)
+{
+    typedef CEGUI::SpatialNavigationStrategy Strategy;
+
+    BOOST_CHECK_EQUAL(d_strategy.getWindowCount(), static_cast<size_t>(GridSize * GridSize));
+    BOOST_CHECK(!d_strategy.isWindowAdded(d_root));
+
+    CEGUI::Window* const centre = getItem(2, 2);
+    BOOST_CHECK_EQUAL(d_strategy.getWindow(centre, Strategy::NavigateRight), getItem(3, 2));
+    BOOST_CHECK_EQUAL(d_strategy.getWindow(centre, Strategy::NavigateLeft), getItem(1, 2));
+    BOOST_CHECK_EQUAL(d_strategy.getWindow(centre, Strategy::NavigateUp), getItem(2, 1));
+    BOOST_CHECK_EQUAL(d_strategy.getWindow(centre, Strategy::NavigateDown), getItem(2, 3));
+
+    // nothing beyond the edge, and unknown payloads keep the focus
+    BOOST_CHECK_EQUAL(d_strategy.getWindow(getItem(4, 0), Strategy::NavigateRight), getItem(4, 0));
+    BOOST_CHECK_EQUAL(d_strategy.getWindow(centre, "sideways"), centre);
+
+    // unknown neighbours start at the top
+    BOOST_CHECK_EQUAL(d_strategy.getWindow(nullptr, Strategy::NavigateDown)->getYPosition().d_offset, 0.0f);
+}
+
+BOOST_AUTO_TEST_CASE(SkipsWindowsThatCanNotBeFocused)
+{
+    typedef CEGUI::SpatialNavigationStrategy Strategy;
+
+    getItem(3, 2)->hide();
+    getItem(4, 2)->disable();
+    // the nearest remaining windows are diagonal to the current one
+    CEGUI::Window* const found = d_strategy.getWindow(getItem(2, 2), Strategy::NavigateRight);
+    BOOST_CHECK(found == getItem(3, 1) || found == getItem(3, 3));
+}
+
+BOOST_AUTO_TEST_CASE(FollowsAreaChangesAndDestruction)
+{
+    typedef CEGUI::SpatialNavigationStrategy Strategy;
+
+    CEGUI::Window* const start = getItem(0, 0);
+    BOOST_CHECK_EQUAL(d_strategy.getWindow(start, Strategy::NavigateRight), getItem(1, 0));
+
+    // move a window between the first two of the row
+    CEGUI::Window* const moved = getItem(4, 4);
+    moved->setPosition(CEGUI::UVector2(CEGUI::UDim(0, ItemSize), CEGUI::UDim(0, 0)));
+    BOOST_CHECK_EQUAL(d_strategy.getWindow(start, Strategy::NavigateRight), moved);
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(moved);
+    BOOST_CHECK(!d_strategy.isWindowAdded(moved));
+    BOOST_CHECK_EQUAL(d_strategy.getWindow(start, Strategy::NavigateRight), getItem(1, 0));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -27,6 +27,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "CEGUI/views/StandardItemModel.h"
+#include "CEGUI/Event.h"
 
 using namespace CEGUI;
 
@@ -76,4 +77,62 @@ BOOST_AUTO_TEST_CASE(Insert_ChildOfNode_InsertsBefore)
     BOOST_REQUIRE_EQUAL(i1_child1->getText(), model.getData(model.makeIndex(1, i1_index), ItemDataRole::Text));
 }
 
+//----------------------------------------------------------------------------//
+struct ChildrenAddedRecorder
+{
+    bool onChildrenAdded(const EventArgs& args)
+    {
+        d_events.push_back(static_cast<const ModelEventArgs&>(args));
+        return true;
+    }
+
+    std::vector<ModelEventArgs> d_events;
+};
+
+BOOST_AUTO_TEST_CASE(AddItemsAtPosition_InsertsRangeWithSingleNotification)
+{
+    StandardItemModel model;
+    model.addItem("i1");
+    model.addItem("i4");
+
+    ChildrenAddedRecorder recorder;
+    model.subscribeEvent(ItemModel::EventChildrenAdded,
+        Event::Subscriber(&ChildrenAddedRecorder::onChildrenAdded, &recorder));
+
+    std::vector<StandardItem*> items;
+    items.push_back(new StandardItem("i2"));
+    items.push_back(new StandardItem("i3"));
+    model.addItemsAtPosition(items.begin(), items.end(), model.getRootIndex(), 1);
+
+    BOOST_REQUIRE_EQUAL(1, recorder.d_events.size());
+    BOOST_REQUIRE_EQUAL(1, recorder.d_events.front().d_startId);
+    BOOST_REQUIRE_EQUAL(2, recorder.d_events.front().d_count);
+
+    BOOST_REQUIRE_EQUAL(4, model.getChildCount(model.getRootIndex()));
+    BOOST_REQUIRE_EQUAL("i2", model.getData(model.makeIndex(1, model.getRootIndex()), ItemDataRole::Text));
+    BOOST_REQUIRE_EQUAL("i3", model.getData(model.makeIndex(2, model.getRootIndex()), ItemDataRole::Text));
+    BOOST_REQUIRE_EQUAL("i4", model.getData(model.makeIndex(3, model.getRootIndex()), ItemDataRole::Text));
+    BOOST_REQUIRE(items.front()->getParent() == &model.getRoot());
+}
+
+BOOST_AUTO_TEST_CASE(AddItems_FromTexts_AppendsWithSingleNotification)
+{
+    StandardItemModel model;
+    model.addItem("i1");
+
+    ChildrenAddedRecorder recorder;
+    model.subscribeEvent(ItemModel::EventChildrenAdded,
+        Event::Subscriber(&ChildrenAddedRecorder::onChildrenAdded, &recorder));
+
+    std::vector<String> texts;
+    texts.push_back("i2");
+    texts.push_back("i3");
+    model.addItems(texts);
+
+    BOOST_REQUIRE_EQUAL(1, recorder.d_events.size());
+    BOOST_REQUIRE_EQUAL(1, recorder.d_events.front().d_startId);
+    BOOST_REQUIRE_EQUAL(2, recorder.d_events.front().d_count);
+    BOOST_REQUIRE_EQUAL("i3", model.getData(model.makeIndex(2, model.getRootIndex()), ItemDataRole::Text));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,62 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/System.h"
+#include "CEGUI/WindowRendererManager.h"
+#include "CEGUI/WindowRenderer.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(StartupRegistration)
+
+BOOST_AUTO_TEST_CASE(WindowRenderersAreAvailableOnFirstUse)
+{
+    CEGUI::WindowRendererManager& manager = CEGUI::WindowRendererManager::getSingleton();
+
+    BOOST_CHECK(manager.isFactoryPresent("Core/Button"));
+    BOOST_CHECK(!manager.isFactoryPresent("StartupRegistrationTest/Missing"));
+
+    CEGUI::WindowRendererFactory* factory = manager.getFactory("Core/Button");
+    BOOST_REQUIRE(factory != nullptr);
+    BOOST_CHECK_EQUAL(factory->getName(), "Core/Button");
+    BOOST_CHECK_EQUAL(manager.getFactory("Core/Button"), factory);
+}
+
+BOOST_AUTO_TEST_CASE(SubsystemStartupTimesAreReported)
+{
+    const CEGUI::System::StartupTimeList& times =
+        CEGUI::System::getSingleton().getStartupTimes();
+
+    BOOST_REQUIRE(!times.empty());
+    for (const CEGUI::System::StartupTime& time : times)
+    {
+        BOOST_CHECK(!time.d_subsystem.empty());
+        BOOST_CHECK_GE(time.d_milliseconds, 0.0);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,127 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/LeftAlignedRenderedString.h"
+#include "CEGUI/RenderedStringTextComponent.h"
+#include "CEGUI/RenderedStringWordWrapper.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+struct StaticTextFixture
+{
+    StaticTextFixture()
+    {
+        d_text = CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/StaticText");
+        d_text->setFont("DejaVuSans-12");
+        d_text->setProperty("HorzFormatting", "WordWrapLeftAligned");
+
+        CEGUI::System& system = CEGUI::System::getSingleton();
+        // the native resolution of the font, so that it's not scaled
+        system.notifyDisplaySizeChanged(CEGUI::Sizef(1280, 720));
+        d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+        d_context->setRootWindow(d_text);
+    }
+
+    ~StaticTextFixture()
+    {
+        d_context->setRootWindow(nullptr);
+        CEGUI::System::getSingleton().destroyGUIContext(*d_context);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_text);
+    }
+
+    //! Returns the width found by plain bisection for the current height.
+    float getWidthFoundByBisection() const
+    {
+        const float height = d_text->getPixelSize().d_height;
+        return d_text->getSizeAdjustedToContent_bisection(
+            CEGUI::USize(CEGUI::UDim(1.f, 0.f), CEGUI::UDim(0.f, height)), -1.f, 4096.f).d_width;
+    }
+
+    CEGUI::GUIContext* d_context;
+    CEGUI::Window* d_text;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(StaticText, StaticTextFixture)
+
+BOOST_AUTO_TEST_CASE(WordWrappedWidthMatchesBisection)
+{
+    const CEGUI::String texts[] =
+    {
+        "Short",
+        "A tooltip sized to its content, long enough to be wrapped into a few lines.",
+        "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod "
+        "tempor incididunt ut labore et dolore magna aliqua.\nUt enim ad minim "
+        "veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea "
+        "commodo consequat.",
+        "Supercalifragilisticexpialidocious is a word that is wider than the others"
+    };
+    const float heights[] = { 60.f, 100.f, 150.f, 300.f };
+
+    for (const CEGUI::String& text : texts)
+    {
+        for (float height : heights)
+        {
+            d_text->setText(text);
+            d_text->setSize(CEGUI::USize(CEGUI::UDim(0.f, 1000.f), CEGUI::UDim(0.f, height)));
+            d_text->setAdjustWidthToContent(true);
+            d_text->adjustSizeToContent();
+
+            const float width = d_text->getPixelSize().d_width;
+            BOOST_CHECK(d_text->contentFits());
+            BOOST_CHECK_EQUAL(width, getWidthFoundByBisection());
+            d_text->setAdjustWidthToContent(false);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(WordWrappedLinesFitTheArea)
+{
+    CEGUI::String paragraph;
+    for (int i = 0; i < 200; ++i)
+        paragraph += "Lorem ipsum dolor sit amet, consectetur adipiscing elit. ";
+
+    CEGUI::RenderedString rs;
+    rs.appendComponent(CEGUI::RenderedStringTextComponent(paragraph, d_text->getFont()));
+    rs.appendLineBreak();
+    rs.appendComponent(CEGUI::RenderedStringTextComponent("Short", d_text->getFont()));
+
+    const float width = 200.f;
+    CEGUI::RenderedStringWordWrapper<CEGUI::LeftAlignedRenderedString> wrapper(rs);
+    wrapper.format(d_text, CEGUI::Sizef(width, 0.f));
+
+    BOOST_CHECK_GT(wrapper.getFormattedLineCount(), 200u);
+    BOOST_CHECK_LE(wrapper.getHorizontalExtent(d_text), width);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
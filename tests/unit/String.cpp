@@ -29,6 +29,9 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <functional>
+#include <string>
+
 // it's not worth it to test std::string, is it?
 #if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
 
@@ -56,6 +59,27 @@ BOOST_AUTO_TEST_CASE(Operators)
     BOOST_CHECK(a != b);
 }
 
+BOOST_AUTO_TEST_CASE(Utf8ComparisonAndAppending)
+{
+    // "a\u00E4b" encoded in UTF-8
+    const char* encoded = "a\xC3\xA4" "b";
+    CEGUI::String a(encoded);
+
+    BOOST_CHECK_EQUAL(a.compare(encoded), 0);
+    BOOST_CHECK_EQUAL(a.compare(std::string(encoded)), 0);
+    BOOST_CHECK(a.compare("a") > 0);
+    BOOST_CHECK(a.compare("a\xC3\xA4" "bc") < 0);
+    BOOST_CHECK(a.compare("ab") > 0);
+    BOOST_CHECK(a.compare("a\xC3\xA5") < 0);
+    BOOST_CHECK(CEGUI::String().compare("") == 0);
+
+    CEGUI::String b("a");
+    b.append("\xC3\xA4");
+    b.append(std::string("b"));
+    BOOST_CHECK_EQUAL(a, b);
+    BOOST_CHECK_EQUAL(std::hash<CEGUI::String>()(a), std::hash<CEGUI::String>()(b));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
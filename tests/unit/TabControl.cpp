@@ -0,0 +1,105 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/widgets/TabControl.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+struct TabControlFixture
+{
+    TabControlFixture()
+    {
+        d_tabControl = static_cast<CEGUI::TabControl*>(
+            CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/TabControl"));
+        // the tab height comes from the font, and no GUIContext provides a default
+        d_tabControl->setFont("DejaVuSans-12");
+    }
+
+    ~TabControlFixture()
+    {
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_tabControl);
+    }
+
+    //! Add a lazy tab counting how many times its contents were created.
+    void addLazyTab(const CEGUI::String& name)
+    {
+        d_tabControl->addLazyTab(name, name, [this]()
+        {
+            ++d_createdCount;
+            return CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        });
+    }
+
+    CEGUI::TabControl* d_tabControl;
+    int d_createdCount = 0;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(TabControl, TabControlFixture)
+
+BOOST_AUTO_TEST_CASE(LazyTab_IsLoadedOnFirstSelection)
+{
+    addLazyTab("first");
+    addLazyTab("second");
+
+    // the first tab gets selected when added
+    BOOST_CHECK_EQUAL(d_createdCount, 1);
+    BOOST_CHECK(!d_tabControl->isTabContentsLoaded(d_tabControl->getTabContents("second")));
+
+    d_tabControl->setSelectedTab("second");
+    BOOST_CHECK_EQUAL(d_createdCount, 2);
+    BOOST_CHECK(d_tabControl->isTabContentsLoaded(d_tabControl->getTabContents("second")));
+    BOOST_CHECK_EQUAL(d_tabControl->getTabContents("second")->getChildCount(), 1);
+
+    d_tabControl->setSelectedTab("first");
+    d_tabControl->setSelectedTab("second");
+    BOOST_CHECK_EQUAL(d_createdCount, 2);
+}
+
+BOOST_AUTO_TEST_CASE(LazyTab_IsUnloadedAfterDelay)
+{
+    addLazyTab("first");
+    addLazyTab("second");
+    d_tabControl->setSelectedTab("second");
+    d_tabControl->setSelectedTab("first");
+
+    d_tabControl->setLazyTabUnloadDelay(1.0f);
+    d_tabControl->update(0.5f);
+    BOOST_CHECK(d_tabControl->isTabContentsLoaded(d_tabControl->getTabContents("second")));
+
+    d_tabControl->update(0.6f);
+    BOOST_CHECK(!d_tabControl->isTabContentsLoaded(d_tabControl->getTabContents("second")));
+    BOOST_CHECK(d_tabControl->isTabContentsLoaded(d_tabControl->getTabContents("first")));
+
+    d_tabControl->setSelectedTab("second");
+    BOOST_CHECK_EQUAL(d_createdCount, 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,142 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "ItemModelStub.h"
+#include "CEGUI/Font.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/widgets/Scrollbar.h"
+#include "CEGUI/views/TableView.h"
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+struct TableViewFixture
+{
+    TableViewFixture()
+    {
+        System& system = System::getSingleton();
+        system.notifyDisplaySizeChanged(Sizef(100, 100));
+        context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+
+        view = static_cast<TableView*>(WindowManager::getSingleton().createWindow("TaharezLook/TableView", "tv"));
+        view->setWindowRenderer("Core/TableView");
+        view->setFont("DejaVuSans-12");
+        context->setRootWindow(view);
+        view->setModel(&model);
+        font_height = view->getFont()->getFontHeight();
+        view->setRowHeight(font_height);
+    }
+
+    ~TableViewFixture()
+    {
+        context->setRootWindow(nullptr);
+        System::getSingleton().destroyGUIContext(*context);
+        WindowManager::getSingleton().destroyWindow(view);
+    }
+
+    GUIContext* context;
+    TableView* view;
+    ItemModelStub model;
+    float font_height;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TableViewTestSuite, TableViewFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(IndexAt_PositionBelowHeader_ReturnsRowIndex)
+{
+    view->addColumn("Name", 50);
+    model.d_items.push_back("item 0");
+    model.d_items.push_back("item 1");
+
+    BOOST_CHECK(view->indexAt(glm::vec2(1, font_height / 2.0f)).d_modelData == nullptr);
+
+    ModelIndex index = view->indexAt(glm::vec2(1, font_height * 2.5f));
+    BOOST_REQUIRE(index.d_modelData != nullptr);
+    BOOST_CHECK_EQUAL(String("item 1"), *(static_cast<String*>(index.d_modelData)));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ManyRowsAndColumns_OnlyCellsAroundTheViewAreFormatted)
+{
+    for (std::int32_t i = 0; i < 40; ++i)
+        view->addColumn("column " + PropertyHelper<std::int32_t>::toString(i), 50);
+    for (std::int32_t i = 0; i < 1000; ++i)
+        model.d_items.push_back("item " + PropertyHelper<std::int32_t>::toString(i));
+    view->setSize(USize(cegui_absdim(100), cegui_absdim(font_height * 10)));
+    view->prepareForRender();
+
+    const size_t max_rows = 10 + 2 * TableView::VirtualisedOverscanRows;
+    const size_t max_columns = 3;
+    BOOST_CHECK(view->getCells().size() <= max_rows * max_columns);
+    BOOST_CHECK(view->getHeaderCells().size() <= max_columns);
+    BOOST_CHECK_CLOSE(view->getRenderedMaxWidth(), 50.0f * 40, 0.01f);
+    BOOST_CHECK_CLOSE(view->getRenderedTotalHeight(), font_height * 1001, 0.01f);
+
+    view->getVertScrollbar()->setScrollPosition(font_height * 500);
+    view->getHorzScrollbar()->setScrollPosition(50.0f * 20);
+    view->prepareForRender();
+
+    BOOST_REQUIRE(!view->getCells().empty());
+    BOOST_CHECK(view->getCells().size() <= max_rows * max_columns);
+    BOOST_CHECK_EQUAL(view->getCells().front().d_row,
+        500 - TableView::VirtualisedOverscanRows);
+    BOOST_CHECK_EQUAL(view->getCells().front().d_column, 20);
+    BOOST_CHECK_EQUAL(view->getHeaderCells().front().d_text, "column 20");
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SortEnabled_RowsAreOrderedWithoutReorderingTheModel)
+{
+    view->addColumn("Name", 50);
+    model.d_items.push_back("b");
+    model.d_items.push_back("c");
+    model.d_items.push_back("a");
+
+    view->setSortMode(ViewSortMode::Ascending);
+    view->prepareForRender();
+
+    BOOST_CHECK_EQUAL(2, view->getChildIdForRow(0));
+    BOOST_CHECK_EQUAL(0, view->getChildIdForRow(1));
+    BOOST_CHECK_EQUAL(1, view->getChildIdForRow(2));
+    BOOST_CHECK_EQUAL(String("a"), view->getCells().front().d_text);
+    BOOST_CHECK_EQUAL(String("b"), model.d_items.front());
+
+    model.d_items.push_back("0");
+    model.notifyChildrenAdded(model.getRootIndex(), 3, 1);
+    view->setSortMode(ViewSortMode::Descending);
+    view->prepareForRender();
+
+    BOOST_CHECK_EQUAL(1, view->getChildIdForRow(0));
+    BOOST_CHECK_EQUAL(3, view->getChildIdForRow(3));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,109 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/TaskScheduler.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Exceptions.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <stdexcept>
+
+BOOST_AUTO_TEST_SUITE(TaskScheduler)
+
+BOOST_AUTO_TEST_CASE(SystemFallsBackToSerialExecution)
+{
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    BOOST_CHECK_EQUAL(system.getTaskScheduler().getConcurrency(), 1u);
+
+    CEGUI::ThreadPoolTaskScheduler pool(2);
+    system.setTaskScheduler(&pool);
+    BOOST_CHECK(&system.getTaskScheduler() == &pool);
+    BOOST_CHECK_EQUAL(system.getTaskScheduler().getConcurrency(), 3u);
+
+    system.setTaskScheduler(nullptr);
+    BOOST_CHECK_EQUAL(system.getTaskScheduler().getConcurrency(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(SerialSchedulerRethrowsOnWait)
+{
+    CEGUI::SerialTaskScheduler scheduler;
+    int value = 0;
+
+    const auto ok = scheduler.submit([&value]() { value = 1; });
+    BOOST_CHECK_EQUAL(value, 1);
+    BOOST_CHECK_NO_THROW(scheduler.wait(ok));
+
+    const auto failing = scheduler.submit([]() { throw std::runtime_error("failed"); });
+    BOOST_CHECK_THROW(scheduler.wait(failing), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(ThreadPoolRunsEveryIndexOnce)
+{
+    CEGUI::ThreadPoolTaskScheduler scheduler(3);
+    std::vector<std::atomic<int>> hits(1000);
+    for (auto& hit : hits)
+        hit = 0;
+
+    scheduler.parallelFor(0, hits.size(), [&hits](std::size_t i) { ++hits[i]; });
+
+    for (auto& hit : hits)
+        BOOST_REQUIRE_EQUAL(hit.load(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ThreadPoolSupportsNestedWaits)
+{
+    CEGUI::ThreadPoolTaskScheduler scheduler(1);
+    std::atomic<int> sum(0);
+
+    // the outer tasks occupy the only worker and wait for their own tasks
+    scheduler.parallelFor(0, 4, [&scheduler, &sum](std::size_t i)
+    {
+        const auto inner = scheduler.submit([&sum, i]() { sum += static_cast<int>(i); });
+        scheduler.wait(inner);
+    });
+
+    BOOST_CHECK_EQUAL(sum.load(), 0 + 1 + 2 + 3);
+}
+
+BOOST_AUTO_TEST_CASE(ThreadPoolRethrowsTaskExceptions)
+{
+    CEGUI::ThreadPoolTaskScheduler scheduler(2);
+
+    BOOST_CHECK_THROW(scheduler.parallelFor(0, 16, [](std::size_t i)
+    {
+        if (i == 5)
+            throw std::runtime_error("failed");
+    }), std::runtime_error);
+
+    const auto failing = scheduler.submit([]() { throw std::runtime_error("failed"); });
+    BOOST_CHECK_THROW(scheduler.wait(failing), std::runtime_error);
+    BOOST_CHECK_THROW(scheduler.wait(failing), CEGUI::InvalidRequestException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,87 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/Texture.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+
+using CEGUI::Texture;
+
+BOOST_AUTO_TEST_SUITE(TextureDataSize)
+
+BOOST_AUTO_TEST_CASE(CalculatesUncompressedDataSize)
+{
+    BOOST_CHECK_EQUAL(Texture::calculateDataSize(Texture::PixelFormat::Rgba, 10, 3), 120u);
+    BOOST_CHECK_EQUAL(Texture::calculateDataSize(Texture::PixelFormat::Rgb, 10, 3), 90u);
+    BOOST_CHECK_EQUAL(Texture::calculateDataSize(Texture::PixelFormat::Rgb565, 10, 3), 60u);
+    BOOST_CHECK(!Texture::isCompressedFormat(Texture::PixelFormat::Rgba4444));
+}
+
+BOOST_AUTO_TEST_CASE(RoundsCompressedDataSizeUpToBlocks)
+{
+    // 5x5 pixels take 2x2 blocks of 4x4 pixels
+    BOOST_CHECK_EQUAL(Texture::calculateDataSize(Texture::PixelFormat::RgbaDxt1, 5, 5), 32u);
+    BOOST_CHECK_EQUAL(Texture::calculateDataSize(Texture::PixelFormat::RgbaDxt5, 5, 5), 64u);
+    BOOST_CHECK_EQUAL(Texture::calculateDataSize(Texture::PixelFormat::RgbaBc7, 5, 5), 64u);
+    BOOST_CHECK_EQUAL(Texture::calculateDataSize(Texture::PixelFormat::RgbEtc2, 5, 5), 32u);
+    BOOST_CHECK_EQUAL(Texture::calculateDataSize(Texture::PixelFormat::RgbaAstc6x6, 13, 6), 48u);
+    BOOST_CHECK_EQUAL(Texture::calculateDataSize(Texture::PixelFormat::RgbaAstc8x8, 8, 8), 16u);
+    BOOST_CHECK(Texture::isCompressedFormat(Texture::PixelFormat::RgbaAstc4x4));
+}
+
+BOOST_AUTO_TEST_CASE(AppliesMinimumPvrtcBlockCount)
+{
+    BOOST_CHECK_EQUAL(Texture::calculateDataSize(Texture::PixelFormat::Pvrtc4, 4, 4), 32u);
+    BOOST_CHECK_EQUAL(Texture::calculateDataSize(Texture::PixelFormat::Pvrtc2, 32, 8), 64u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(TexturePremultipliedAlpha)
+
+BOOST_AUTO_TEST_CASE(MultipliesColourChannelsByAlpha)
+{
+    std::uint8_t pixels[] =
+    {
+        255, 128, 0, 255,
+        255, 128, 10, 128,
+        200, 200, 200, 0
+    };
+    Texture::premultiplyAlpha(pixels, 3);
+
+    const std::uint8_t expected[] =
+    {
+        255, 128, 0, 255,
+        128, 64, 5, 128,
+        0, 0, 0, 0
+    };
+    BOOST_CHECK_EQUAL_COLLECTIONS(pixels, pixels + 12, expected, expected + 12);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,166 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/TextureResidencyManager.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Texture.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+namespace
+{
+CEGUI::Renderer& getRenderer()
+{
+    return *CEGUI::System::getSingleton().getRenderer();
+}
+
+CEGUI::Texture& createTexture(const CEGUI::String& name)
+{
+    CEGUI::Texture& texture = getRenderer().createTexture(name);
+    const std::vector<std::uint8_t> pixels(64 * 64 * 4, 0);
+    texture.loadFromMemory(pixels.data(), CEGUI::Sizef(64, 64),
+                           CEGUI::Texture::PixelFormat::Rgba);
+    return texture;
+}
+
+CEGUI::TextureResidencyManager::EvictFunction releaseData(CEGUI::Texture& texture)
+{
+    return [&texture]() { return texture.releaseData(); };
+}
+
+const std::size_t TextureMemory = 64 * 64 * 4;
+}
+
+BOOST_AUTO_TEST_SUITE(TextureResidency)
+
+BOOST_AUTO_TEST_CASE(AccountsMemoryPerCategory)
+{
+    CEGUI::TextureResidencyManager manager(getRenderer());
+    CEGUI::Texture& imageset = createTexture("TextureResidencyImageset");
+    CEGUI::Texture& glyphs = createTexture("TextureResidencyGlyphs");
+
+    manager.addTexture(imageset, CEGUI::TextureCategory::Imageset);
+    manager.addTexture(glyphs, CEGUI::TextureCategory::GlyphAtlas);
+    BOOST_CHECK_EQUAL(manager.getMemoryUsage(CEGUI::TextureCategory::Imageset), TextureMemory);
+    BOOST_CHECK_EQUAL(manager.getMemoryUsage(CEGUI::TextureCategory::GlyphAtlas), TextureMemory);
+
+    // released data takes no memory
+    BOOST_REQUIRE(imageset.releaseData());
+    BOOST_CHECK_EQUAL(manager.getMemoryUsage(CEGUI::TextureCategory::Imageset), 0u);
+
+    // textures destroyed without being removed are forgotten
+    manager.removeTexture(imageset);
+    getRenderer().destroyTexture(glyphs);
+    BOOST_CHECK_EQUAL(manager.getMemoryUsage(CEGUI::TextureCategory::GlyphAtlas), 0u);
+    manager.markUsed(imageset);
+    manager.notifyFrameEnded();
+    BOOST_CHECK(!manager.isTextureTracked(glyphs));
+
+    getRenderer().destroyTexture(imageset);
+}
+
+BOOST_AUTO_TEST_CASE(EvictsLeastRecentlyDrawnTextures)
+{
+    CEGUI::TextureResidencyManager manager(getRenderer());
+    CEGUI::Texture& imageset = createTexture("TextureResidencyOldImageset");
+    CEGUI::Texture& glyphs = createTexture("TextureResidencyNewGlyphs");
+    CEGUI::Texture& drawn = createTexture("TextureResidencyDrawn");
+
+    std::size_t restoreCount = 0;
+    manager.addTexture(imageset, CEGUI::TextureCategory::Imageset, releaseData(imageset),
+        [&]()
+        {
+            const std::vector<std::uint8_t> pixels(64 * 64 * 4, 0);
+            imageset.loadFromMemory(pixels.data(), CEGUI::Sizef(64, 64),
+                                    CEGUI::Texture::PixelFormat::Rgba);
+            ++restoreCount;
+        });
+    manager.addTexture(glyphs, CEGUI::TextureCategory::GlyphAtlas, releaseData(glyphs));
+    manager.addTexture(drawn, CEGUI::TextureCategory::GlyphAtlas, releaseData(drawn));
+    manager.setMemoryBudget(2 * TextureMemory);
+    BOOST_CHECK(manager.isTrackingUsage());
+
+    // nothing drawn in the frame yet, so nothing may be evicted
+    manager.markUsed(imageset);
+    manager.markUsed(glyphs);
+    manager.markUsed(drawn);
+    manager.notifyFrameEnded();
+    BOOST_CHECK_EQUAL(manager.getEvictionCount(), 0u);
+
+    // glyph pages go before imagesets drawn as long ago
+    manager.markUsed(drawn);
+    manager.notifyFrameEnded();
+    BOOST_CHECK_EQUAL(manager.getEvictionCount(), 1u);
+    BOOST_CHECK(glyphs.isDataReleased());
+    BOOST_CHECK(!imageset.isDataReleased());
+    BOOST_CHECK_EQUAL(manager.getMemoryUsage(), 2 * TextureMemory);
+
+    // the glyph page is filled and drawn again, now the imageset goes
+    const std::vector<std::uint8_t> pixels(64 * 64 * 4, 0);
+    glyphs.loadFromMemory(pixels.data(), CEGUI::Sizef(64, 64), CEGUI::Texture::PixelFormat::Rgba);
+    manager.markUsed(glyphs);
+    manager.markUsed(drawn);
+    manager.notifyFrameEnded();
+    BOOST_CHECK_EQUAL(manager.getEvictionCount(), 2u);
+    BOOST_CHECK(imageset.isDataReleased());
+    BOOST_CHECK(!drawn.isDataReleased());
+
+    // evicted imagesets are loaded again when they are drawn
+    manager.markUsed(imageset);
+    BOOST_CHECK(!imageset.isDataReleased());
+    BOOST_CHECK_EQUAL(restoreCount, 1u);
+    BOOST_CHECK_EQUAL(manager.getRestoreCount(), 1u);
+
+    getRenderer().destroyTexture(imageset);
+    getRenderer().destroyTexture(glyphs);
+    getRenderer().destroyTexture(drawn);
+}
+
+BOOST_AUTO_TEST_CASE(ImagesetsAreLoadedAgainFromTheirFiles)
+{
+    CEGUI::ImageManager& imageManager = CEGUI::ImageManager::getSingleton();
+    CEGUI::TextureResidencyManager& manager = getRenderer().getTextureResidencyManager();
+
+    imageManager.addBitmapImageFromFile("TextureResidencyLogo", "logo.png");
+    CEGUI::Texture& texture = getRenderer().getTexture("TextureResidencyLogo");
+    BOOST_REQUIRE(manager.isTextureTracked(texture));
+    const CEGUI::Sizef size(texture.getOriginalDataSize());
+
+    BOOST_REQUIRE(texture.releaseData());
+    manager.markUsed(texture);
+    BOOST_CHECK(!texture.isDataReleased());
+    BOOST_CHECK(texture.getOriginalDataSize() == size);
+
+    imageManager.destroyImageCollection("TextureResidencyLogo");
+    BOOST_CHECK(!manager.isTextureTracked(texture));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
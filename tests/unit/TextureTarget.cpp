@@ -0,0 +1,70 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/TextureTarget.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(TextureTargetGrowth)
+
+BOOST_AUTO_TEST_CASE(GrowsInBucketsAndKeepsStorageThatFits)
+{
+    CEGUI::TextureTargetGrowthPolicy policy;
+
+    CEGUI::Sizef storage = policy.getStorageSize(CEGUI::Sizef(0, 0), CEGUI::Sizef(100, 50));
+    BOOST_CHECK_EQUAL(storage, CEGUI::Sizef(128, 64));
+
+    // resizing within the storage reallocates nothing
+    BOOST_CHECK_EQUAL(policy.getStorageSize(storage, CEGUI::Sizef(120, 60)), storage);
+    BOOST_CHECK_EQUAL(policy.getStorageSize(storage, CEGUI::Sizef(70, 40)), storage);
+
+    // only the exceeded dimension grows, by half at least
+    storage = policy.getStorageSize(storage, CEGUI::Sizef(130, 60));
+    BOOST_CHECK_EQUAL(storage, CEGUI::Sizef(192, 64));
+
+    policy.setEnabled(false);
+    BOOST_CHECK_EQUAL(policy.getStorageSize(storage, CEGUI::Sizef(130, 60)), CEGUI::Sizef(130, 60));
+}
+
+BOOST_AUTO_TEST_CASE(ShrinksAfterSustainedUnderUse)
+{
+    CEGUI::TextureTargetGrowthPolicy policy;
+    const CEGUI::Sizef storage(512, 512);
+
+    for (std::uint32_t i = 1; i < CEGUI::TextureTargetGrowthPolicy::ShrinkDelay; ++i)
+        BOOST_CHECK_EQUAL(policy.getStorageSize(storage, CEGUI::Sizef(100, 100)), storage);
+
+    // a declaration using the storage well restarts the count
+    BOOST_CHECK_EQUAL(policy.getStorageSize(storage, CEGUI::Sizef(500, 500)), storage);
+    BOOST_CHECK_EQUAL(policy.getStorageSize(storage, CEGUI::Sizef(100, 100)), storage);
+
+    for (std::uint32_t i = 2; i < CEGUI::TextureTargetGrowthPolicy::ShrinkDelay; ++i)
+        policy.getStorageSize(storage, CEGUI::Sizef(100, 100));
+
+    BOOST_CHECK_EQUAL(policy.getStorageSize(storage, CEGUI::Sizef(100, 100)), CEGUI::Sizef(128, 128));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
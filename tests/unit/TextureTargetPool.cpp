@@ -0,0 +1,134 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/TextureTargetPool.h"
+#include "CEGUI/TextureTarget.h"
+#include "CEGUI/RenderingWindow.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+CEGUI::Renderer& getRenderer()
+{
+    return *CEGUI::System::getSingleton().getRenderer();
+}
+}
+
+BOOST_AUTO_TEST_SUITE(TextureTargetPool)
+
+BOOST_AUTO_TEST_CASE(ReusesTargetsOfTheSameBucket)
+{
+    CEGUI::TextureTargetPool pool(getRenderer());
+
+    CEGUI::TextureTarget* target = pool.acquire(false, CEGUI::Sizef(100, 50));
+    BOOST_REQUIRE(target != nullptr);
+    target->declareRenderSize(CEGUI::Sizef(100, 50));
+    BOOST_CHECK_EQUAL(pool.getMissCount(), 1u);
+
+    pool.release(target);
+    BOOST_CHECK_EQUAL(pool.getIdleTargetCount(), 1u);
+    BOOST_CHECK_EQUAL(pool.getIdleMemoryUsage(), 100u * 50u * 4u);
+
+    // different stencil usage and a different bucket do not match
+    CEGUI::TextureTarget* stencilTarget = pool.acquire(true, CEGUI::Sizef(100, 50));
+    BOOST_CHECK(stencilTarget != target);
+    CEGUI::TextureTarget* largeTarget = pool.acquire(false, CEGUI::Sizef(300, 50));
+    BOOST_CHECK(largeTarget != target);
+    BOOST_CHECK_EQUAL(pool.getMissCount(), 3u);
+
+    BOOST_CHECK(pool.acquire(false, CEGUI::Sizef(110, 60)) == target);
+    BOOST_CHECK_EQUAL(pool.getHitCount(), 1u);
+    BOOST_CHECK_EQUAL(pool.getIdleTargetCount(), 0u);
+    BOOST_CHECK_EQUAL(pool.getIdleMemoryUsage(), 0u);
+
+    getRenderer().destroyTextureTarget(target);
+    getRenderer().destroyTextureTarget(stencilTarget);
+    getRenderer().destroyTextureTarget(largeTarget);
+}
+
+BOOST_AUTO_TEST_CASE(EvictsOldestTargetsOverBudget)
+{
+    CEGUI::TextureTargetPool pool(getRenderer());
+    pool.setMemoryBudget(100 * 100 * 4);
+
+    CEGUI::TextureTarget* first = pool.acquire(false, CEGUI::Sizef(100, 100));
+    CEGUI::TextureTarget* second = pool.acquire(false, CEGUI::Sizef(100, 100));
+    first->declareRenderSize(CEGUI::Sizef(100, 100));
+    second->declareRenderSize(CEGUI::Sizef(100, 100));
+
+    pool.release(first);
+    pool.release(second);
+
+    BOOST_CHECK_EQUAL(pool.getIdleTargetCount(), 1u);
+    BOOST_CHECK(pool.acquire(false, CEGUI::Sizef(100, 100)) == second);
+
+    pool.release(second);
+    pool.setMemoryBudget(0);
+    BOOST_CHECK_EQUAL(pool.getIdleTargetCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(AutoRenderingSurfacesShareThePool)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* root = winMgr.createWindow("DefaultWindow");
+    CEGUI::Window* panel = winMgr.createWindow("DefaultWindow");
+    panel->setSize(CEGUI::USize(CEGUI::UDim(0, 200), CEGUI::UDim(0, 100)));
+    root->addChild(panel);
+
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::GUIContext& context = system.createGUIContext(getRenderer().getDefaultRenderTarget());
+    context.setRootWindow(root);
+
+    CEGUI::TextureTargetPool& pool = getRenderer().getTextureTargetPool();
+    pool.clear();
+
+    panel->setUsingAutoRenderingSurface(true);
+    BOOST_REQUIRE(panel->getRenderingSurface() != nullptr);
+    CEGUI::TextureTarget* target =
+        &static_cast<CEGUI::RenderingWindow*>(panel->getRenderingSurface())->getTextureTarget();
+
+    panel->setUsingAutoRenderingSurface(false);
+    BOOST_CHECK_EQUAL(pool.getIdleTargetCount(), 1u);
+
+    panel->setUsingAutoRenderingSurface(true);
+    BOOST_CHECK(&static_cast<CEGUI::RenderingWindow*>(
+        panel->getRenderingSurface())->getTextureTarget() == target);
+    BOOST_CHECK_EQUAL(pool.getIdleTargetCount(), 0u);
+
+    context.setRootWindow(nullptr);
+    system.destroyGUIContext(context);
+    winMgr.destroyWindow(root);
+    pool.clear();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -29,6 +29,9 @@
 #include "InventoryModel.h"
 #include "CEGUI/Event.h"
 #include "CEGUI/Font.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
 #include "CEGUI/WindowManager.h"
 
 // Yup. We need this in order to easily inject/call event handlers without having
@@ -44,10 +47,14 @@ struct TreeViewFixture
 {
     TreeViewFixture()
     {
-        System::getSingleton().notifyDisplaySizeChanged(Sizef(100, 100));
+        System& system = System::getSingleton();
+        system.notifyDisplaySizeChanged(Sizef(100, 100));
+        context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
 
         view = static_cast<TreeView*>(
             WindowManager::getSingleton().createWindow("TaharezLook/TreeView", "tv"));
+        view->setFont("DejaVuSans-12");
+        context->setRootWindow(view);
         view->setModel(&model);
         view->setItemTooltipsEnabled(true);
         font_height = view->getFont()->getFontHeight();
@@ -59,6 +66,13 @@ struct TreeViewFixture
             Event::Subscriber(&TreeViewFixture::onSubtreeCollapsed, this));
     }
 
+    ~TreeViewFixture()
+    {
+        context->setRootWindow(nullptr);
+        System::getSingleton().destroyGUIContext(*context);
+        WindowManager::getSingleton().destroyWindow(view);
+    }
+
     bool onSubtreeExpanded(const EventArgs& args)
     {
         expanded_nodes.push_back(
@@ -73,7 +87,7 @@ struct TreeViewFixture
         return true;
     }
 
-
+    GUIContext* context;
     TreeView* view;
     InventoryModel model;
     float font_height;
@@ -567,4 +581,36 @@ BOOST_AUTO_TEST_CASE(MultipleLevelsHierarchy_RenderedMaxWidthGreaterThanViewSize
     BOOST_REQUIRE(view->getRenderedMaxWidth() > 100);
 }
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Virtualised_OnlyRowsAroundTheViewAreFormatted)
+{
+    for (size_t i = 0; i < 500; ++i)
+        model.addRandomItemWithChildren(model.getRootIndex(), i, 3);
+    view->setSize(USize(cegui_absdim(100), cegui_absdim(font_height * 10)));
+    view->setVirtualised(true);
+    view->prepareForRender();
+
+    const size_t max_items = 11 + 2 * TreeView::VirtualisedOverscanRows;
+    BOOST_CHECK(view->getVirtualisedItems().size() <= max_items);
+    BOOST_CHECK(view->getRootItemState().d_renderedChildren.empty());
+
+    view->expandAllSubtrees();
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(500, expanded_nodes.size());
+    const std::vector<TreeViewItemRenderingState*>& items = view->getVirtualisedItems();
+    BOOST_REQUIRE(items.size() <= max_items);
+    BOOST_REQUIRE_EQUAL(0, items.at(0)->d_nestedLevel);
+    BOOST_REQUIRE_EQUAL(1, items.at(1)->d_nestedLevel);
+    BOOST_REQUIRE_EQUAL(0, items.at(4)->d_nestedLevel);
+    BOOST_REQUIRE_EQUAL(1, items.at(4)->d_childId);
+
+    view->toggleSubtree(*items.at(0));
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(1, collapsed_nodes.size());
+    BOOST_REQUIRE_EQUAL(0, view->getVirtualisedItems().at(1)->d_nestedLevel);
+    BOOST_REQUIRE_EQUAL(1, view->getVirtualisedItems().at(1)->d_childId);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
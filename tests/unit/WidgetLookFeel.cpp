@@ -0,0 +1,282 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/falagard/WidgetLookManager.h"
+#include "CEGUI/falagard/WidgetLookFeel.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/System.h"
+#include "CEGUI/DefaultResourceProvider.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+
+namespace
+{
+const CEGUI::String s_baseSource(
+    "<Falagard version=\"7\">"
+    "  <WidgetLook name=\"Test/Base\">"
+    "    <NamedArea name=\"Client\"><Area/></NamedArea>"
+    "    <ImagerySection name=\"frame\"/>"
+    "    <StateImagery name=\"Enabled\"/>"
+    "  </WidgetLook>"
+    "</Falagard>");
+
+const CEGUI::String s_derivedSource(
+    "<Falagard version=\"7\">"
+    "  <WidgetLook name=\"Test/Derived\" inherits=\"Test/Base\">"
+    "    <NamedArea name=\"Client\"><Area/></NamedArea>"
+    "  </WidgetLook>"
+    "</Falagard>");
+
+const CEGUI::String s_linkedSource(
+    "<Falagard version=\"7\">"
+    "  <WidgetLook name=\"Test/Linked\">"
+    "    <PropertyLinkDefinition name=\"ChildText\" widget=\"__auto_child__\""
+    "        targetProperty=\"Text\" initialValue=\"initial\" type=\"String\"/>"
+    "    <Child type=\"DefaultWindow\" nameSuffix=\"__auto_child__\"/>"
+    "    <StateImagery name=\"Enabled\"/>"
+    "  </WidgetLook>"
+    "</Falagard>");
+
+struct InheritanceFixture
+{
+    InheritanceFixture()
+    {
+        CEGUI::WidgetLookManager& manager = CEGUI::WidgetLookManager::getSingleton();
+        manager.parseLookNFeelSpecificationFromString(s_baseSource);
+        manager.parseLookNFeelSpecificationFromString(s_derivedSource);
+    }
+
+    ~InheritanceFixture()
+    {
+        CEGUI::WidgetLookManager& manager = CEGUI::WidgetLookManager::getSingleton();
+        manager.eraseWidgetLook("Test/Derived");
+        manager.eraseWidgetLook("Test/Base");
+    }
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(WidgetLookFeel, InheritanceFixture)
+
+BOOST_AUTO_TEST_CASE(InheritedElementsAreResolved)
+{
+    CEGUI::WidgetLookManager& manager = CEGUI::WidgetLookManager::getSingleton();
+    const CEGUI::WidgetLookFeel& base = manager.getWidgetLook("Test/Base");
+    const CEGUI::WidgetLookFeel& derived = manager.getWidgetLook("Test/Derived");
+
+    // the derived look's own definition wins over the inherited one
+    BOOST_CHECK(&derived.getNamedArea("Client") == &derived.getNamedArea("Client", false));
+    BOOST_CHECK(&derived.getNamedArea("Client") != &base.getNamedArea("Client"));
+
+    BOOST_CHECK(&derived.getStateImagery("Enabled") == &base.getStateImagery("Enabled"));
+    BOOST_CHECK(&derived.getImagerySection("frame") == &base.getImagerySection("frame"));
+    BOOST_CHECK(derived.isStateImageryPresent("Enabled"));
+    BOOST_CHECK(!derived.isStateImageryPresent("Enabled", false));
+    BOOST_CHECK(!derived.isWidgetComponentPresent("Missing"));
+    BOOST_CHECK_THROW(derived.getStateImagery("Enabled", false), CEGUI::UnknownObjectException);
+}
+
+BOOST_AUTO_TEST_CASE(ReplacedBaseLookIsResolvedAgain)
+{
+    CEGUI::WidgetLookManager& manager = CEGUI::WidgetLookManager::getSingleton();
+    BOOST_CHECK(manager.getWidgetLook("Test/Derived").isStateImageryPresent("Enabled"));
+
+    manager.parseLookNFeelSpecificationFromString(
+        "<Falagard version=\"7\">"
+        "  <WidgetLook name=\"Test/Base\">"
+        "    <StateImagery name=\"Disabled\"/>"
+        "  </WidgetLook>"
+        "</Falagard>");
+
+    const CEGUI::WidgetLookFeel& derived = manager.getWidgetLook("Test/Derived");
+    BOOST_CHECK(!derived.isStateImageryPresent("Enabled"));
+    BOOST_CHECK(&derived.getStateImagery("Disabled") ==
+                &manager.getWidgetLook("Test/Base").getStateImagery("Disabled"));
+}
+
+BOOST_AUTO_TEST_CASE(RenamedElementsAreFoundUnderTheirNewName)
+{
+    // the manager only hands out const looks, so edit a copy of the base look
+    CEGUI::WidgetLookFeel base(
+        CEGUI::WidgetLookManager::getSingleton().getWidgetLook("Test/Base"));
+
+    base.addImagerySection(CEGUI::ImagerySection("background"));
+    base.renameImagerySection("frame", "border");
+    base.renameNamedArea("Client", "Content");
+
+    BOOST_CHECK(!base.isImagerySectionPresent("frame"));
+    BOOST_CHECK(base.getImagerySection("border").getName() == "border");
+    BOOST_CHECK(base.getImagerySection("background").getName() == "background");
+    BOOST_CHECK(!base.isNamedAreaPresent("Client", false));
+    BOOST_CHECK(base.getNamedArea("Content").getName() == "Content");
+    BOOST_CHECK_THROW(base.renameImagerySection("border", "background"),
+                      CEGUI::UnknownObjectException);
+
+    const CEGUI::WidgetLookFeel::StringSet names = base.getImagerySectionNames();
+    BOOST_CHECK_EQUAL(names.size(), 2u);
+    BOOST_CHECK(names.count("border") && names.count("background"));
+}
+
+BOOST_AUTO_TEST_CASE(RenderStatsAreCollectedPerStateAndSection)
+{
+    CEGUI::WidgetLookManager& manager = CEGUI::WidgetLookManager::getSingleton();
+    const CEGUI::WidgetLookFeel& base = manager.getWidgetLook("Test/Base");
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+
+    manager.resetRenderStats();
+    base.getStateImagery("Enabled").render(*window);
+    BOOST_CHECK(manager.getRenderStats().empty());
+
+    manager.setRenderStatsEnabled(true);
+    base.getStateImagery("Enabled").render(*window);
+    base.getStateImagery("Enabled").render(*window);
+    base.getImagerySection("frame").render(*window);
+    manager.setRenderStatsEnabled(false);
+
+    const CEGUI::WidgetLookManager::RenderStatsMap stats(manager.getRenderStats());
+    BOOST_REQUIRE_EQUAL(stats.size(), 2u);
+
+    CEGUI::FalagardRenderStatsKey stateKey;
+    stateKey.d_look = window->getLookNFeel();
+    stateKey.d_state = "Enabled";
+    BOOST_REQUIRE(stats.count(stateKey));
+    BOOST_CHECK_EQUAL(stats.at(stateKey).d_renderCount, 2u);
+    BOOST_CHECK_EQUAL(stats.at(stateKey).d_bufferCount, 0u);
+
+    // sections not rendered by a state have no state name
+    CEGUI::FalagardRenderStatsKey sectionKey;
+    sectionKey.d_look = window->getLookNFeel();
+    sectionKey.d_section = "frame";
+    BOOST_REQUIRE(stats.count(sectionKey));
+    BOOST_CHECK_EQUAL(stats.at(sectionKey).d_renderCount, 1u);
+
+    manager.resetRenderStats();
+    BOOST_CHECK(manager.getRenderStats().empty());
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+    CEGUI::WindowManager::getSingleton().cleanDeadPool();
+}
+
+BOOST_AUTO_TEST_CASE(PropertyLinkTargetsFollowChildChanges)
+{
+    CEGUI::WidgetLookManager& manager = CEGUI::WidgetLookManager::getSingleton();
+    CEGUI::WindowManager& windowManager = CEGUI::WindowManager::getSingleton();
+    manager.parseLookNFeelSpecificationFromString(s_linkedSource);
+
+    CEGUI::Window* window = windowManager.createWindow("DefaultWindow");
+    window->setWindowRenderer("Core/Default");
+    window->setLookNFeel("Test/Linked");
+
+    CEGUI::Window* child = window->getChild("__auto_child__");
+    BOOST_CHECK_EQUAL(child->getText(), "initial");
+
+    window->setProperty("ChildText", "first");
+    window->setProperty("ChildText", "second");
+    BOOST_CHECK_EQUAL(child->getText(), "second");
+    BOOST_CHECK_EQUAL(window->getProperty("ChildText"), "second");
+
+    // the cached target must not outlive the child it refers to
+    windowManager.destroyWindow(child);
+    child = windowManager.createWindow("DefaultWindow", "__auto_child__");
+    window->addChild(child);
+
+    window->setProperty("ChildText", "third");
+    BOOST_CHECK_EQUAL(child->getText(), "third");
+    BOOST_CHECK_EQUAL(window->getProperty("ChildText"), "third");
+
+    windowManager.destroyWindow(window);
+    windowManager.cleanDeadPool();
+    manager.eraseWidgetLook("Test/Linked");
+}
+
+BOOST_AUTO_TEST_CASE(ReloadReassignsOnlyChangedLooks)
+{
+    const char* const source =
+        "<Falagard version=\"7\">"
+        "  <WidgetLook name=\"Test/Reloaded\">"
+        "    <PropertyLinkDefinition name=\"ChildText\" widget=\"__auto_child__\""
+        "        targetProperty=\"Text\" initialValue=\"%s\" type=\"String\"/>"
+        "    <Child type=\"DefaultWindow\" nameSuffix=\"__auto_child__\"/>"
+        "    <StateImagery name=\"Enabled\"/>"
+        "  </WidgetLook>"
+        "  <WidgetLook name=\"Test/Kept\">"
+        "    <Child type=\"DefaultWindow\" nameSuffix=\"__auto_child__\"/>"
+        "  </WidgetLook>"
+        "</Falagard>";
+    auto writeLooks = [source](const char* initialValue)
+    {
+        char buffer[1024];
+        std::snprintf(buffer, sizeof(buffer), source, initialValue);
+        std::ofstream("HotReload.looknfeel", std::ios::binary) << buffer;
+    };
+
+    auto* rp = static_cast<CEGUI::DefaultResourceProvider*>(
+        CEGUI::System::getSingleton().getResourceProvider());
+    rp->setResourceGroupDirectory("hot_reload", "./");
+
+    CEGUI::WidgetLookManager& manager = CEGUI::WidgetLookManager::getSingleton();
+    CEGUI::WindowManager& windowManager = CEGUI::WindowManager::getSingleton();
+    writeLooks("before");
+    manager.parseLookNFeelSpecificationFromFile("HotReload.looknfeel", "hot_reload");
+
+    CEGUI::Window* reloaded = windowManager.createWindow("DefaultWindow");
+    reloaded->setWindowRenderer("Core/Default");
+    reloaded->setLookNFeel("Test/Reloaded");
+    CEGUI::Window* kept = windowManager.createWindow("DefaultWindow");
+    kept->setWindowRenderer("Core/Default");
+    kept->setLookNFeel("Test/Kept");
+    const CEGUI::Window* const keptChild = kept->getChild("__auto_child__");
+    BOOST_CHECK_EQUAL(reloaded->getChild("__auto_child__")->getText(), "before");
+
+    // reloading an unchanged file changes nothing
+    BOOST_CHECK(manager.reloadLookNFeelSpecificationFromFile(
+        "HotReload.looknfeel", "hot_reload").empty());
+
+    writeLooks("after");
+    const CEGUI::WidgetLookManager::WidgetLookNameSet changed =
+        manager.reloadLookNFeelSpecificationFromFile("HotReload.looknfeel", "hot_reload");
+    BOOST_CHECK_EQUAL(changed.size(), 1u);
+    BOOST_CHECK(changed.count("Test/Reloaded") == 1);
+
+    // the changed look was assigned again, the other window kept its children
+    BOOST_CHECK_EQUAL(reloaded->getLookNFeel(), "Test/Reloaded");
+    BOOST_CHECK_EQUAL(reloaded->getChild("__auto_child__")->getText(), "after");
+    BOOST_CHECK(kept->getChild("__auto_child__") == keptChild);
+
+    windowManager.destroyWindow(reloaded);
+    windowManager.destroyWindow(kept);
+    windowManager.cleanDeadPool();
+    manager.eraseWidgetLook("Test/Reloaded");
+    manager.eraseWidgetLook("Test/Kept");
+    rp->clearResourceGroupDirectory("hot_reload");
+    std::remove("HotReload.looknfeel");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
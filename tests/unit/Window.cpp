@@ -27,9 +27,46 @@
 
 #include "CEGUI/Window.h"
 #include "CEGUI/WindowManager.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/InPlaceRenderEffect.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/widgets/ScrollablePane.h"
+#include "CEGUI/widgets/ScrolledContainer.h"
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+
+namespace
+{
+//! Effect halving the alpha of the geometry and counting its stage calls.
+class HalfAlphaEffect : public CEGUI::InPlaceRenderEffect
+{
+public:
+    Change update(const float, CEGUI::Window&) override { return d_change; }
+
+    void modifyGeometry(CEGUI::Window&, CEGUI::GeometryBuffer&) override
+    {
+        ++d_modifiedBuffers;
+    }
+
+    void prepareGeometry(CEGUI::Window&, CEGUI::GeometryBuffer& buffer) override
+    {
+        buffer.setAlpha(buffer.getAlpha() * 0.5f);
+        ++d_preparedBuffers;
+    }
+
+    bool modifiesGeometry() const override { return true; }
+
+    Change d_change = Change::Nothing;
+    int d_modifiedBuffers = 0;
+    int d_preparedBuffers = 0;
+};
+}
+
 /*
  * Used to bring some Windows up for testing
  *
@@ -54,17 +91,21 @@ struct LayoutSetupFixture
         d_insideInsideRoot->setSize(CEGUI::USize(CEGUI::UDim(0.5f, 0), CEGUI::UDim(0.5f, 0)));
         d_insideRoot->addChild(d_insideInsideRoot);
 
-        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(d_root);
-        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+        CEGUI::System& system = CEGUI::System::getSingleton();
+        d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+        d_context->setRootWindow(d_root);
+        system.notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
     }
 
     ~LayoutSetupFixture()
     {
-        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(nullptr);
+        d_context->setRootWindow(nullptr);
+        CEGUI::System::getSingleton().destroyGUIContext(*d_context);
 
         CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
     }
 
+    CEGUI::GUIContext* d_context;
     CEGUI::Window* d_root;
     CEGUI::Window* d_insideRoot;
     CEGUI::Window* d_insideInsideRoot;
@@ -140,6 +181,24 @@ BOOST_AUTO_TEST_CASE(HitTesting)
     d_root->setDisabled(false);
 }
 
+BOOST_AUTO_TEST_CASE(RotatedGeometryHitTesting)
+{
+    // quarter turn around the z axis and the centre of the window
+    d_insideInsideRoot->setRotationUsingGeometry(true);
+    d_insideInsideRoot->setRotation(glm::quat(0.70710678f, 0.0f, 0.0f, 0.70710678f));
+    BOOST_CHECK(d_insideInsideRoot->isRotatingGeometry());
+
+    // the right edge of the window now points downwards
+    BOOST_CHECK(d_insideInsideRoot->isHit(glm::vec2(300, 265)));
+    BOOST_CHECK(!d_insideInsideRoot->isHit(glm::vec2(390, 175)));
+    BOOST_CHECK(d_insideInsideRoot->isHit(glm::vec2(300, 175)));
+
+    d_insideInsideRoot->setRotation(glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+    BOOST_CHECK(!d_insideInsideRoot->isRotatingGeometry());
+    BOOST_CHECK(d_insideInsideRoot->isHit(glm::vec2(390, 175)));
+    d_insideInsideRoot->setRotationUsingGeometry(false);
+}
+
 BOOST_AUTO_TEST_CASE(Hierarchy)
 {
     CEGUI::Window* child = d_insideInsideRoot->createChild("DefaultWindow");
@@ -153,6 +212,49 @@ BOOST_AUTO_TEST_CASE(Hierarchy)
     CEGUI::WindowManager::getSingleton().destroyWindow(child);
 }
 
+BOOST_AUTO_TEST_CASE(ZOrder)
+{
+    CEGUI::Window* children[4];
+    int zChanges[4] = { 0, 0, 0, 0 };
+    for (int i = 0; i < 4; ++i)
+    {
+        children[i] = d_insideInsideRoot->createChild("DefaultWindow");
+        children[i]->subscribeEvent(CEGUI::Window::EventZOrderChanged,
+            [&zChanges, i]() { ++zChanges[i]; });
+    }
+    children[3]->setAlwaysOnTop(true);
+    children[0]->setAlwaysOnTop(true);
+    BOOST_CHECK_EQUAL(children[0]->getZIndex(), 2u);
+    BOOST_CHECK_EQUAL(children[3]->getZIndex(), 3u);
+
+    // only the moved window and the siblings it passed are notified
+    std::fill(zChanges, zChanges + 4, 0);
+    children[1]->moveToFront();
+    BOOST_CHECK_EQUAL(children[1]->getZIndex(), 1u);
+    BOOST_CHECK_EQUAL(children[2]->getZIndex(), 0u);
+    BOOST_CHECK_EQUAL(zChanges[0] + zChanges[3], 0);
+    BOOST_CHECK_EQUAL(zChanges[1], 1);
+    BOOST_CHECK_EQUAL(zChanges[2], 1);
+
+    children[0]->moveToFront();
+    BOOST_CHECK_EQUAL(children[0]->getZIndex(), 3u);
+    children[0]->moveToBack();
+    BOOST_CHECK_EQUAL(children[0]->getZIndex(), 2u);
+
+    children[2]->moveInFront(children[1]);
+    BOOST_CHECK_EQUAL(children[2]->getZIndex(), 1u);
+    children[2]->moveBehind(children[1]);
+    BOOST_CHECK_EQUAL(children[2]->getZIndex(), 0u);
+
+    children[3]->setAlwaysOnTop(false);
+    BOOST_CHECK_EQUAL(children[3]->getZIndex(), 0u);
+    children[3]->moveToFront();
+    BOOST_CHECK_EQUAL(children[3]->getZIndex(), 2u);
+
+    for (int i = 0; i < 4; ++i)
+        d_insideInsideRoot->destroyChild(children[i]);
+}
+
 BOOST_AUTO_TEST_CASE(RecursiveSearch)
 {
     int previousID[3];
@@ -177,4 +279,202 @@ BOOST_AUTO_TEST_CASE(RecursiveSearch)
     d_insideInsideRoot->setID(previousID[2]);
 }
 
+BOOST_AUTO_TEST_CASE(IDIndex)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+    d_insideRoot->setID(3);
+    d_insideInsideRoot->setID(5);
+    d_root->setIDIndexEnabled(true);
+    BOOST_CHECK(d_root->isIDIndexEnabled());
+
+    BOOST_CHECK_EQUAL(d_root->getChildRecursive(5), d_insideInsideRoot);
+    BOOST_CHECK_EQUAL(d_root->findChild(3), d_insideRoot);
+    BOOST_CHECK(d_root->findChild(5) == nullptr);
+    BOOST_CHECK(d_insideRoot->isChild(5));
+    BOOST_CHECK(d_insideInsideRoot->getChildRecursive(5) == nullptr);
+
+    // changing an ID and attaching a subtree update the index
+    d_insideInsideRoot->setID(7);
+    BOOST_CHECK(d_root->getChildRecursive(5) == nullptr);
+    BOOST_CHECK_EQUAL(d_root->getChildRecursive(7), d_insideInsideRoot);
+
+    CEGUI::Window* const attached = winMgr.createWindow("DefaultWindow");
+    CEGUI::Window* const attachedChild = winMgr.createWindow("DefaultWindow");
+    attached->setID(9);
+    attachedChild->setID(11);
+    attached->addChild(attachedChild);
+    d_insideRoot->addChild(attached);
+    BOOST_CHECK_EQUAL(d_root->getChildRecursive(11), attachedChild);
+    BOOST_CHECK_EQUAL(d_insideRoot->getChild(9), attached);
+
+    // duplicated IDs resolve as a breadth first search would
+    attachedChild->setID(7);
+    BOOST_CHECK_EQUAL(d_root->getChildRecursive(7), d_insideInsideRoot);
+    d_insideRoot->removeChild(d_insideInsideRoot);
+    BOOST_CHECK_EQUAL(d_root->getChildRecursive(7), attachedChild);
+    d_insideRoot->addChild(d_insideInsideRoot);
+
+    d_insideRoot->removeChild(attached);
+    BOOST_CHECK(d_root->getChildRecursive(9) == nullptr);
+    BOOST_CHECK_THROW(d_insideRoot->getChild(9), CEGUI::UnknownObjectException);
+    winMgr.destroyWindow(attached);
+
+    d_root->setIDIndexEnabled(false);
+    BOOST_CHECK_EQUAL(d_root->getChildRecursive(7), d_insideInsideRoot);
+    d_insideRoot->setID(0);
+    d_insideInsideRoot->setID(0);
+}
+
+BOOST_AUTO_TEST_CASE(ScrollablePaneCulling)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+    CEGUI::ScrollablePane* pane = static_cast<CEGUI::ScrollablePane*>(
+        winMgr.createWindow("TaharezLook/ScrollablePane"));
+    pane->setSize(CEGUI::USize(CEGUI::UDim(0, 200), CEGUI::UDim(0, 200)));
+    d_root->addChild(pane);
+
+    CEGUI::Window* nearChild = winMgr.createWindow("DefaultWindow");
+    nearChild->setSize(CEGUI::USize(CEGUI::UDim(0, 50), CEGUI::UDim(0, 50)));
+    pane->addChild(nearChild);
+
+    CEGUI::Window* farChild = winMgr.createWindow("DefaultWindow");
+    farChild->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 0), CEGUI::UDim(0, 10000)));
+    farChild->setSize(CEGUI::USize(CEGUI::UDim(0, 50), CEGUI::UDim(0, 50)));
+    pane->addChild(farChild);
+
+    const CEGUI::ScrolledContainer* container = static_cast<CEGUI::ScrolledContainer*>(
+        pane->getChild(CEGUI::ScrollablePane::ScrolledContainerName));
+    BOOST_CHECK(container->isChildInView(*nearChild));
+    BOOST_CHECK(!container->isChildInView(*farChild));
+
+    pane->setContentCullingEnabled(false);
+    BOOST_CHECK(container->isChildInView(*farChild));
+
+    winMgr.destroyWindow(pane);
+}
+
+BOOST_AUTO_TEST_CASE(CloneCopiesPropertiesAndUserStrings)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+    d_insideRoot->setUserString("Row", "3");
+    d_insideRoot->setAlpha(0.25f);
+    d_insideRoot->setText("Panel");
+
+    CEGUI::Window* copy = d_insideRoot->clone(true);
+
+    BOOST_CHECK_EQUAL(copy->getUserString("Row"), "3");
+    BOOST_CHECK_EQUAL(copy->getAlpha(), 0.25f);
+    BOOST_CHECK_EQUAL(copy->getText(), "Panel");
+    BOOST_CHECK(copy->getPosition() == d_insideRoot->getPosition());
+    BOOST_REQUIRE_EQUAL(copy->getChildCount(), 1u);
+    BOOST_CHECK(copy->getChildAtIndex(0)->getSize() == d_insideInsideRoot->getSize());
+
+    winMgr.destroyWindow(copy);
+}
+
+BOOST_AUTO_TEST_CASE(BulkCalls)
+{
+    d_insideRoot->setName("Inside");
+    d_insideInsideRoot->setName("InsideInside");
+
+    const std::vector<CEGUI::Window*> windows = d_root->getChildrenRecursive();
+    BOOST_REQUIRE_EQUAL(windows.size(), 2u);
+    BOOST_CHECK_EQUAL(windows[0], d_insideRoot);
+    BOOST_CHECK_EQUAL(windows[1], d_insideInsideRoot);
+
+    CEGUI::PropertySet::PropertyValueList values;
+    values.push_back(std::make_pair(CEGUI::String("Alpha"), CEGUI::String("0.5")));
+    values.push_back(std::make_pair(CEGUI::String("Text"), CEGUI::String("Bulk")));
+    d_insideRoot->setProperties(values);
+    BOOST_CHECK_EQUAL(d_insideRoot->getAlpha(), 0.5f);
+    BOOST_CHECK_EQUAL(d_insideRoot->getText(), "Bulk");
+
+    std::vector<CEGUI::Window::PropertyChange> changes(2);
+    changes[0].d_windowPath = "Inside/InsideInside";
+    changes[0].d_propertyName = "Size";
+    changes[0].d_value = "{{0,40},{0,30}}";
+    changes[1].d_propertyName = "Text";
+    changes[1].d_value = "Root";
+    d_root->applyPropertyChanges(changes);
+
+    // the layout was recomputed once the changes were applied
+    BOOST_CHECK(d_insideInsideRoot->getPixelSize() == CEGUI::Sizef(40.0f, 30.0f));
+    BOOST_CHECK_EQUAL(d_root->getText(), "Root");
+
+    changes[1].d_windowPath = "Missing";
+    BOOST_CHECK_THROW(d_root->applyPropertyChanges(changes), CEGUI::UnknownObjectException);
+}
+
+BOOST_AUTO_TEST_CASE(InPlaceRenderEffect)
+{
+    CEGUI::Window* button = CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/Button");
+    button->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+    d_root->addChild(button);
+
+    HalfAlphaEffect effect;
+    button->setInPlaceRenderEffect(&effect);
+    CEGUI::System::getSingleton().renderAllGUIContexts();
+
+    // the effect runs on the geometry itself, without a RenderingWindow
+    BOOST_CHECK(!button->isUsingAutoRenderingSurface());
+    BOOST_CHECK(button->isUpdateRequired());
+    const std::vector<CEGUI::GeometryBuffer*>& buffers = button->getGeometryBuffers();
+    BOOST_REQUIRE(!buffers.empty());
+    BOOST_CHECK_EQUAL(effect.d_modifiedBuffers, static_cast<int>(buffers.size()));
+    BOOST_CHECK_EQUAL(effect.d_preparedBuffers, static_cast<int>(buffers.size()));
+    BOOST_CHECK_EQUAL(buffers.front()->getAlpha(), 0.5f);
+
+    // a parameter change keeps the geometry
+    effect.d_change = CEGUI::InPlaceRenderEffect::Change::Parameters;
+    d_context->injectTimePulse(0.1f);
+    CEGUI::System::getSingleton().renderAllGUIContexts();
+    BOOST_CHECK_EQUAL(effect.d_modifiedBuffers, static_cast<int>(buffers.size()));
+    BOOST_CHECK_EQUAL(effect.d_preparedBuffers, static_cast<int>(buffers.size()) * 2);
+    BOOST_CHECK_EQUAL(buffers.front()->getAlpha(), 0.5f);
+
+    button->setInPlaceRenderEffect(nullptr);
+    CEGUI::System::getSingleton().renderAllGUIContexts();
+    BOOST_CHECK_EQUAL(button->getGeometryBuffers().front()->getAlpha(), 1.0f);
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(button);
+}
+
+BOOST_AUTO_TEST_CASE(RarelyUsedSettingsKeepDefaults)
+{
+    // these settings are only allocated once changed
+    BOOST_CHECK_EQUAL(d_insideRoot->getTooltipText(), "");
+    BOOST_CHECK(d_insideRoot->isUsingDefaultTooltip());
+    BOOST_CHECK_EQUAL(d_insideRoot->getAutoRepeatDelay(), 0.3f);
+    BOOST_CHECK_EQUAL(d_insideRoot->getAutoRepeatRate(), 0.06f);
+    BOOST_CHECK(!d_insideRoot->isUserStringDefined("Missing"));
+    BOOST_CHECK_THROW(d_insideRoot->getUserString("Missing"), CEGUI::UnknownObjectException);
+    BOOST_CHECK(!d_insideRoot->isPropertyBannedFromXML("Alpha"));
+
+    d_root->setTooltipText("Root tip");
+    BOOST_CHECK_EQUAL(d_insideRoot->getTooltipTextIncludingInheritance(), "Root tip");
+    d_insideRoot->setTooltipText("Own tip");
+    BOOST_CHECK_EQUAL(d_insideRoot->getTooltipTextIncludingInheritance(), "Own tip");
+
+    d_insideRoot->setAutoRepeatDelay(0.5f);
+    BOOST_CHECK_EQUAL(d_insideRoot->getAutoRepeatDelay(), 0.5f);
+    BOOST_CHECK_EQUAL(d_insideRoot->getAutoRepeatRate(), 0.06f);
+
+    d_insideRoot->banPropertyFromXML("Alpha");
+    BOOST_CHECK(d_insideRoot->isPropertyBannedFromXML("Alpha"));
+    d_insideRoot->unbanPropertyFromXML("Alpha");
+    BOOST_CHECK(!d_insideRoot->isPropertyBannedFromXML("Alpha"));
+
+    // type and look names are interned, but still read as strings
+    BOOST_CHECK_EQUAL(d_insideRoot->getType(), "DefaultWindow");
+    BOOST_CHECK_EQUAL(d_insideRoot->getLookNFeel(), "");
+}
+
+BOOST_AUTO_TEST_CASE(Footprint)
+{
+    // 1312 bytes with GCC on 64 bit platforms when rarely used members were
+    // moved out of Window. Raise this deliberately when adding members.
+    const std::size_t maxWindowSize = 1360;
+    BOOST_CHECK_LE(sizeof(CEGUI::Window), maxWindowSize);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
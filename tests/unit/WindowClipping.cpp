@@ -0,0 +1,114 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+struct WindowClippingFixture
+{
+    WindowClippingFixture()
+    {
+        CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+        d_root = winMgr.createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 100)));
+
+        d_child = winMgr.createWindow("DefaultWindow");
+        d_child->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 50), CEGUI::UDim(0, 50)));
+        d_child->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 100)));
+        d_root->addChild(d_child);
+
+        d_grandChild = winMgr.createWindow("DefaultWindow");
+        d_grandChild->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 100)));
+        d_child->addChild(d_grandChild);
+
+        CEGUI::System& system = CEGUI::System::getSingleton();
+        d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+        d_context->setRootWindow(d_root);
+    }
+
+    ~WindowClippingFixture()
+    {
+        d_context->setRootWindow(nullptr);
+        CEGUI::System::getSingleton().destroyGUIContext(*d_context);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    CEGUI::GUIContext* d_context;
+    CEGUI::Window* d_root;
+    CEGUI::Window* d_child;
+    CEGUI::Window* d_grandChild;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(WindowClipping, WindowClippingFixture)
+
+BOOST_AUTO_TEST_CASE(KeepsGenerationWhileNothingChanges)
+{
+    const std::uint64_t generation = d_grandChild->getClippingGeneration();
+    d_grandChild->getOuterRectClipper();
+    d_root->getHitTestRect();
+
+    BOOST_CHECK_EQUAL(d_grandChild->getClippingGeneration(), generation);
+}
+
+BOOST_AUTO_TEST_CASE(FollowsAncestorClippingChanges)
+{
+    BOOST_CHECK_EQUAL(d_grandChild->getOuterRectClipper(), CEGUI::Rectf(50, 50, 100, 100));
+    BOOST_CHECK_EQUAL(d_grandChild->getHitTestRect(), CEGUI::Rectf(50, 50, 100, 100));
+
+    const std::uint64_t generation = d_grandChild->getClippingGeneration();
+    d_child->setClippedByParent(false);
+
+    BOOST_CHECK_GT(d_grandChild->getClippingGeneration(), generation);
+    BOOST_CHECK_EQUAL(d_grandChild->getOuterRectClipper(), CEGUI::Rectf(50, 50, 150, 150));
+
+    d_child->setClippedByParent(true);
+    BOOST_CHECK_EQUAL(d_grandChild->getOuterRectClipper(), CEGUI::Rectf(50, 50, 100, 100));
+
+    d_root->setSize(CEGUI::USize(CEGUI::UDim(0, 80), CEGUI::UDim(0, 80)));
+    BOOST_CHECK_EQUAL(d_grandChild->getOuterRectClipper(), CEGUI::Rectf(50, 50, 80, 80));
+    BOOST_CHECK_EQUAL(d_grandChild->getHitTestRect(), CEGUI::Rectf(50, 50, 80, 80));
+}
+
+BOOST_AUTO_TEST_CASE(IgnoresAncestorsItIsNotClippedBy)
+{
+    d_grandChild->setClippedByParent(false);
+    const std::uint64_t generation = d_grandChild->getClippingGeneration();
+
+    d_child->setClippedByParent(false);
+
+    BOOST_CHECK_EQUAL(d_grandChild->getClippingGeneration(), generation);
+    BOOST_CHECK_EQUAL(d_grandChild->getOuterRectClipper(), CEGUI::Rectf(50, 50, 150, 150));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,61 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/WindowFactoryManager.h"
+#include "CEGUI/Exceptions.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(WindowFactoryManager)
+
+BOOST_AUTO_TEST_CASE(ResolvedTypesFollowRegistryChanges)
+{
+    CEGUI::WindowFactoryManager& manager = CEGUI::WindowFactoryManager::getSingleton();
+
+    const CEGUI::WindowFactoryManager::ResolvedWindowType& button =
+        manager.resolveWindowType("TaharezLook/Button");
+    BOOST_CHECK_EQUAL(button.d_factory, manager.getFactory("CEGUI/PushButton"));
+    BOOST_REQUIRE(button.d_mapping != nullptr);
+    BOOST_CHECK_EQUAL(button.d_mapping->d_lookName, "TaharezLook/Button");
+    BOOST_CHECK(manager.resolveWindowType("DefaultWindow").d_mapping == nullptr);
+
+    manager.addWindowTypeAlias("WindowFactoryManagerTest/Alias", "TaharezLook/Button");
+    BOOST_CHECK_EQUAL(manager.resolveWindowType("WindowFactoryManagerTest/Alias").d_mapping->d_lookName,
+                      "TaharezLook/Button");
+
+    // retargeting the alias must not return the cached result
+    manager.addWindowTypeAlias("WindowFactoryManagerTest/Alias", "TaharezLook/Label");
+    BOOST_CHECK_EQUAL(manager.resolveWindowType("WindowFactoryManagerTest/Alias").d_mapping->d_lookName,
+                      "TaharezLook/Label");
+
+    manager.removeWindowTypeAlias("WindowFactoryManagerTest/Alias", "TaharezLook/Label");
+    manager.removeWindowTypeAlias("WindowFactoryManagerTest/Alias", "TaharezLook/Button");
+    BOOST_CHECK_THROW(manager.resolveWindowType("WindowFactoryManagerTest/Alias"),
+                      CEGUI::UnknownObjectException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
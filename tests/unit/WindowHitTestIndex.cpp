@@ -0,0 +1,197 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/WindowHitTestIndex.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+const int GridSize = 10;
+const float ItemSize = 20.0f;
+
+struct WindowHitTestIndexFixture
+{
+    WindowHitTestIndexFixture()
+    {
+        CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+        d_root = winMgr.createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(0, 400), CEGUI::UDim(0, 400)));
+
+        for (int y = 0; y < GridSize; ++y)
+        {
+            for (int x = 0; x < GridSize; ++x)
+            {
+                CEGUI::Window* item = winMgr.createWindow("DefaultWindow");
+                item->setPosition(CEGUI::UVector2(CEGUI::UDim(0, x * ItemSize),
+                                                  CEGUI::UDim(0, y * ItemSize)));
+                item->setSize(CEGUI::USize(CEGUI::UDim(0, ItemSize), CEGUI::UDim(0, ItemSize)));
+                d_root->addChild(item);
+            }
+        }
+
+        CEGUI::System& system = CEGUI::System::getSingleton();
+        d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+        d_context->setRootWindow(d_root);
+    }
+
+    ~WindowHitTestIndexFixture()
+    {
+        d_context->setRootWindow(nullptr);
+        CEGUI::System::getSingleton().destroyGUIContext(*d_context);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    CEGUI::Window* getItem(int x, int y) const
+    {
+        return d_root->getChildAtIndex(y * GridSize + x);
+    }
+
+    //! Checks that the current index gives the same results as scanning the children
+    void checkMatchesLinearScan() const
+    {
+        std::vector<glm::vec2> positions;
+        for (float y = 2.0f; y < GridSize * ItemSize + 20.0f; y += 7.0f)
+            for (float x = 2.0f; x < GridSize * ItemSize + 20.0f; x += 7.0f)
+                positions.push_back(glm::vec2(x, y));
+
+        BOOST_REQUIRE(d_root->isHitTestIndexEnabled());
+        std::vector<CEGUI::Window*> indexed;
+        for (const glm::vec2& position : positions)
+            indexed.push_back(d_root->getTargetChildAtPosition(position));
+
+        d_root->setHitTestIndexEnabled(false);
+        for (std::size_t i = 0; i < positions.size(); ++i)
+            BOOST_CHECK_EQUAL(indexed[i], d_root->getTargetChildAtPosition(positions[i]));
+        d_root->setHitTestIndexEnabled(true);
+    }
+
+    CEGUI::Window* d_root;
+    CEGUI::GUIContext* d_context;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(WindowHitTestIndex, WindowHitTestIndexFixture)
+
+BOOST_AUTO_TEST_CASE(FindsTheChildAtAPosition)
+{
+    d_root->setHitTestIndexEnabled(true);
+
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(5, 5)), getItem(0, 0));
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(75, 45)), getItem(3, 2));
+    BOOST_CHECK(d_root->getTargetChildAtPosition(glm::vec2(300, 300)) == nullptr);
+
+    checkMatchesLinearScan();
+}
+
+BOOST_AUTO_TEST_CASE(OnlyTestsNearbyChildren)
+{
+    CEGUI::WindowHitTestIndex index(*d_root);
+
+    const std::vector<CEGUI::Window*>& candidates = index.getCandidates(glm::vec2(75, 45));
+
+    BOOST_CHECK_EQUAL(index.getCellCount(), 100u);
+    BOOST_REQUIRE_EQUAL(candidates.size(), 1u);
+    BOOST_CHECK_EQUAL(candidates[0], getItem(3, 2));
+}
+
+BOOST_AUTO_TEST_CASE(FollowsMovedAndResizedChildren)
+{
+    d_root->setHitTestIndexEnabled(true);
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(5, 5)), getItem(0, 0));
+
+    getItem(0, 0)->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 250), CEGUI::UDim(0, 250)));
+    BOOST_CHECK(d_root->getTargetChildAtPosition(glm::vec2(5, 5)) == nullptr);
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(255, 255)), getItem(0, 0));
+
+    getItem(1, 1)->setSize(CEGUI::USize(CEGUI::UDim(0, 60), CEGUI::UDim(0, 60)));
+    getItem(1, 1)->setAlwaysOnTop(true);
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(65, 65)), getItem(1, 1));
+
+    checkMatchesLinearScan();
+}
+
+BOOST_AUTO_TEST_CASE(FollowsZOrderChanges)
+{
+    CEGUI::Window* const item = getItem(2, 2);
+    item->setSize(CEGUI::USize(CEGUI::UDim(0, 60), CEGUI::UDim(0, 60)));
+
+    d_root->setHitTestIndexEnabled(true);
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(65, 65)), getItem(3, 3));
+
+    item->moveToFront();
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(65, 65)), item);
+
+    item->moveToBack();
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(65, 65)), getItem(3, 3));
+
+    checkMatchesLinearScan();
+}
+
+BOOST_AUTO_TEST_CASE(FollowsTheOwnerWithoutRebinning)
+{
+    CEGUI::WindowHitTestIndex index(*d_root);
+    BOOST_CHECK_EQUAL(index.getCandidates(glm::vec2(75, 45)).size(), 1u);
+
+    // moving the owner moves all children, like scrolling does
+    d_root->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 30), CEGUI::UDim(0, -10)));
+    const std::vector<CEGUI::Window*>& candidates = index.getCandidates(glm::vec2(105, 35));
+
+    BOOST_CHECK_EQUAL(index.getCellCount(), 100u);
+    BOOST_REQUIRE_EQUAL(candidates.size(), 1u);
+    BOOST_CHECK_EQUAL(candidates[0], getItem(3, 2));
+
+    d_root->setHitTestIndexEnabled(true);
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(105, 35)), getItem(3, 2));
+    checkMatchesLinearScan();
+}
+
+BOOST_AUTO_TEST_CASE(TestsDescendantsOutsideTheirParentEverywhere)
+{
+    CEGUI::Window* const popup = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    popup->setClippedByParent(false);
+    popup->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 250), CEGUI::UDim(0, 0)));
+    popup->setSize(CEGUI::USize(CEGUI::UDim(0, 40), CEGUI::UDim(0, 40)));
+
+    d_root->setHitTestIndexEnabled(true);
+    BOOST_CHECK(d_root->getTargetChildAtPosition(glm::vec2(265, 15)) == nullptr);
+
+    getItem(0, 0)->addChild(popup);
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(265, 15)), popup);
+    checkMatchesLinearScan();
+
+    getItem(0, 0)->removeChild(popup);
+    BOOST_CHECK(d_root->getTargetChildAtPosition(glm::vec2(265, 15)) == nullptr);
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(popup);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
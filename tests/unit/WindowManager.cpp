@@ -0,0 +1,71 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(WindowManagerDeadPool)
+
+BOOST_AUTO_TEST_CASE(DestructionIsSpreadOverCalls)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+    winMgr.cleanDeadPool();
+
+    CEGUI::Window* root = winMgr.createWindow("DefaultWindow");
+    for (int i = 0; i < 50; ++i)
+        root->addChild(winMgr.createWindow("TaharezLook/Button"));
+
+    winMgr.destroyWindow(root);
+    const std::size_t deadCount = winMgr.getDeadPoolSize();
+    BOOST_CHECK_EQUAL(deadCount, 51u);
+
+    // each call destroys at least one window, but not all of them in time
+    winMgr.setDeadPoolTimeBudget(1);
+    winMgr.cleanDeadPoolWithinBudget();
+    BOOST_CHECK(winMgr.getDeadPoolSize() < deadCount);
+
+    std::size_t calls = 1;
+    while (!winMgr.isDeadPoolEmpty() && calls < deadCount)
+    {
+        winMgr.cleanDeadPoolWithinBudget();
+        ++calls;
+    }
+    BOOST_CHECK(winMgr.isDeadPoolEmpty());
+    BOOST_CHECK(calls > 1);
+
+    // without a budget everything goes at once
+    winMgr.setDeadPoolTimeBudget(0);
+    root = winMgr.createWindow("DefaultWindow");
+    root->addChild(winMgr.createWindow("TaharezLook/Button"));
+    winMgr.destroyWindow(root);
+    winMgr.cleanDeadPoolWithinBudget();
+    BOOST_CHECK(winMgr.isDeadPoolEmpty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
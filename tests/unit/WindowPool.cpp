@@ -0,0 +1,125 @@
+/***********************************************************************
+    created:    Wed Oct 14 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+const CEGUI::String PooledType("TaharezLook/StaticText");
+
+struct WindowPoolFixture
+{
+    WindowPoolFixture() :
+        d_recycledCount(0)
+    {
+        CEGUI::WindowManager::getSingleton().setWindowPoolCapacity(PooledType, 2);
+    }
+
+    ~WindowPoolFixture()
+    {
+        CEGUI::WindowManager::getSingleton().setWindowPoolCapacity(PooledType, 0);
+    }
+
+    bool onRecycled(const CEGUI::EventArgs&)
+    {
+        ++d_recycledCount;
+        return true;
+    }
+
+    int d_recycledCount;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(WindowPool, WindowPoolFixture)
+
+BOOST_AUTO_TEST_CASE(DisabledByDefault)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+    BOOST_CHECK_EQUAL(winMgr.getWindowPoolCapacity("TaharezLook/Button"), 0u);
+
+    winMgr.destroyWindow(winMgr.createWindow("TaharezLook/Button"));
+    BOOST_CHECK_EQUAL(winMgr.getPooledWindowCount("TaharezLook/Button"), 0u);
+    BOOST_CHECK(!winMgr.isDeadPoolEmpty());
+    winMgr.cleanDeadPool();
+}
+
+BOOST_AUTO_TEST_CASE(RecycledWindowIsReused)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* window = winMgr.createWindow(PooledType, "First");
+    const size_t autoChildCount = window->getChildCount();
+    CEGUI::Window* child = winMgr.createWindow("DefaultWindow");
+    window->addChild(child);
+    window->subscribeEvent(CEGUI::Window::EventRecycled,
+        CEGUI::Event::Subscriber(&WindowPoolFixture::onRecycled,
+                                 static_cast<WindowPoolFixture*>(this)));
+
+    winMgr.destroyWindow(window);
+    BOOST_CHECK_EQUAL(d_recycledCount, 1);
+    BOOST_CHECK_EQUAL(winMgr.getPooledWindowCount(PooledType), 1u);
+    BOOST_CHECK(!winMgr.isAlive(window));
+    BOOST_CHECK(!winMgr.isAlive(child));
+
+    CEGUI::Window* reused = winMgr.createWindow(PooledType, "Second");
+    BOOST_CHECK_EQUAL(reused, window);
+    BOOST_CHECK(winMgr.isAlive(reused));
+    BOOST_CHECK_EQUAL(reused->getName(), "Second");
+    BOOST_CHECK_EQUAL(reused->getChildCount(), autoChildCount);
+    BOOST_CHECK_EQUAL(winMgr.getPooledWindowCount(PooledType), 0u);
+
+    winMgr.setWindowPoolCapacity(PooledType, 0);
+    winMgr.destroyWindow(reused);
+    BOOST_CHECK_EQUAL(d_recycledCount, 1);
+    winMgr.cleanDeadPool();
+}
+
+BOOST_AUTO_TEST_CASE(CapacityLimitsPooledWindows)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* windows[] =
+    {
+        winMgr.createWindow(PooledType),
+        winMgr.createWindow(PooledType),
+        winMgr.createWindow(PooledType)
+    };
+
+    for (CEGUI::Window* window : windows)
+        winMgr.destroyWindow(window);
+    BOOST_CHECK_EQUAL(winMgr.getPooledWindowCount(PooledType), 2u);
+
+    winMgr.setWindowPoolCapacity(PooledType, 1);
+    BOOST_CHECK_EQUAL(winMgr.getPooledWindowCount(PooledType), 1u);
+
+    winMgr.clearWindowPool();
+    BOOST_CHECK_EQUAL(winMgr.getPooledWindowCount(PooledType), 0u);
+    BOOST_CHECK_EQUAL(winMgr.getWindowPoolCapacity(PooledType), 1u);
+    winMgr.cleanDeadPool();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,131 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/WindowStaticGroup.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+const int ButtonCount = 8;
+
+struct WindowStaticGroupFixture
+{
+    WindowStaticGroupFixture()
+    {
+        CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+        d_root = winMgr.createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(0, 400), CEGUI::UDim(0, 400)));
+
+        for (int i = 0; i < ButtonCount; ++i)
+        {
+            CEGUI::Window* button = winMgr.createWindow("TaharezLook/Button");
+            button->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 10), CEGUI::UDim(0, i * 40.0f)));
+            button->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+            d_root->addChild(button);
+        }
+
+        // imagery outside of the display is culled, which is empty by default
+        CEGUI::System& system = CEGUI::System::getSingleton();
+        system.notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+        d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+        d_context->setRootWindow(d_root);
+    }
+
+    ~WindowStaticGroupFixture()
+    {
+        d_context->setRootWindow(nullptr);
+        CEGUI::System::getSingleton().destroyGUIContext(*d_context);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    //! Returns the number of non empty buffers of the root's children.
+    std::size_t getChildBufferCount() const
+    {
+        std::size_t count = 0;
+        for (size_t i = 0; i < d_root->getChildCount(); ++i)
+            for (const CEGUI::GeometryBuffer* buffer : d_root->getChildAtIndex(i)->getGeometryBuffers())
+                count += buffer->getVertexCount() != 0;
+        return count;
+    }
+
+    CEGUI::Window* d_root;
+    CEGUI::GUIContext* d_context;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(WindowStaticGroup, WindowStaticGroupFixture)
+
+BOOST_AUTO_TEST_CASE(SubtreeIsMerged)
+{
+    d_root->setStaticGroupEnabled(true);
+    d_context->draw();
+
+    const CEGUI::WindowStaticGroup* group = d_root->getStaticGroup();
+    BOOST_REQUIRE(group);
+    BOOST_CHECK(group->isValid());
+    BOOST_CHECK(group->getCombinedBufferCount() > 0u);
+    BOOST_CHECK(group->getBufferCount() < getChildBufferCount());
+}
+
+BOOST_AUTO_TEST_CASE(ChangesRebuildTheGroup)
+{
+    d_root->setStaticGroupEnabled(true);
+    d_context->draw();
+    const CEGUI::WindowStaticGroup* group = d_root->getStaticGroup();
+    BOOST_REQUIRE(group->isValid());
+
+    d_root->getChildAtIndex(3)->setEnabled(false);
+    BOOST_CHECK(!group->isValid());
+    d_context->draw();
+    BOOST_CHECK(group->isValid());
+
+    d_root->getChildAtIndex(5)->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 200), CEGUI::UDim(0, 0)));
+    BOOST_CHECK(!group->isValid());
+    d_context->draw();
+    BOOST_CHECK(group->isValid());
+}
+
+BOOST_AUTO_TEST_CASE(SurfacesPreventFlattening)
+{
+    d_root->setStaticGroupEnabled(true);
+    d_root->getChildAtIndex(0)->setUsingAutoRenderingSurface(true);
+    d_context->draw();
+
+    // the windows are drawn normally if the renderer supports the surface
+    const CEGUI::WindowStaticGroup* group = d_root->getStaticGroup();
+    if (d_root->getChildAtIndex(0)->getRenderingSurface())
+        BOOST_CHECK(!group->isValid());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
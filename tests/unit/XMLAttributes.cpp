@@ -0,0 +1,95 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/Exceptions.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(XMLAttributes)
+
+BOOST_AUTO_TEST_CASE(ViewsAreReadWithoutCopying)
+{
+    char name[] = "Width";
+    char value[] = "42";
+
+    CEGUI::XMLAttributes attrs;
+    attrs.addView(name, value);
+    attrs.addView("Visible", "True");
+    attrs.addView("Alpha", "0.5");
+
+    BOOST_CHECK_EQUAL(attrs.getCount(), 3u);
+    BOOST_CHECK(attrs.exists("Width"));
+    BOOST_CHECK(!attrs.exists("Height"));
+    BOOST_CHECK_EQUAL(attrs.getValueAsInteger("Width"), 42);
+    BOOST_CHECK_EQUAL(attrs.getValueAsBool("Visible"), true);
+    BOOST_CHECK_EQUAL(attrs.getValueAsFloat("Alpha"), 0.5f);
+    BOOST_CHECK_EQUAL(attrs.getValueAsInteger("Height", 7), 7);
+
+    // the views keep pointing into the caller's buffer
+    value[0] = '1';
+    BOOST_CHECK_EQUAL(attrs.getValueAsInteger("Width"), 12);
+
+    BOOST_CHECK_THROW(attrs.getValueAsInteger("Visible"), CEGUI::InvalidRequestException);
+}
+
+BOOST_AUTO_TEST_CASE(CopiesOwnTheirStrings)
+{
+    char name[] = "Type";
+    char value[] = "Button";
+
+    CEGUI::XMLAttributes attrs;
+    attrs.addView(name, value);
+    attrs.add("Name", "OK");
+
+    const CEGUI::XMLAttributes copy(attrs);
+    name[0] = 'X';
+    value[0] = 'X';
+
+    BOOST_CHECK_EQUAL(copy.getName(0), "Type");
+    BOOST_CHECK_EQUAL(copy.getValue("Type"), "Button");
+    BOOST_CHECK_EQUAL(copy.getValue(1), "OK");
+}
+
+BOOST_AUTO_TEST_CASE(AddReplacesExistingValue)
+{
+    CEGUI::XMLAttributes attrs;
+    attrs.addView("Font", "DejaVuSans-10");
+    attrs.add("Font", "DejaVuSans-12");
+    attrs.addView("Text", "a");
+    attrs.addView("Text", "b");
+
+    BOOST_CHECK_EQUAL(attrs.getCount(), 2u);
+    BOOST_CHECK_EQUAL(attrs.getValueAsString("Font"), "DejaVuSans-12");
+    BOOST_CHECK_EQUAL(attrs.getValue("Text"), "b");
+
+    attrs.remove("Font");
+    BOOST_CHECK(!attrs.exists("Font"));
+    BOOST_CHECK_THROW(attrs.getValue("Font"), CEGUI::UnknownObjectException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
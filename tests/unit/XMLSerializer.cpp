@@ -0,0 +1,78 @@
+/***********************************************************************
+    created:    Thu Oct 15 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/XMLSerializer.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+BOOST_AUTO_TEST_SUITE(XMLSerializer)
+
+BOOST_AUTO_TEST_CASE(EscapesSpecialCharacters)
+{
+    std::ostringstream out;
+    {
+        CEGUI::XMLSerializer xml(out, 0);
+        xml.openTag("Item")
+            .attribute("Value", "a<b & \"c\"\nd")
+            .text("x > 'y'")
+            .closeTag();
+        BOOST_CHECK(xml);
+    }
+
+    BOOST_CHECK_EQUAL(out.str(),
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n\n"
+        "<Item Value=\"a&lt;b &amp; &quot;c&quot;\\nd\" >x &gt; &apos;y&apos;</Item>\n");
+}
+
+BOOST_AUTO_TEST_CASE(RollsBackToCheckpoint)
+{
+    std::ostringstream out;
+    {
+        CEGUI::XMLSerializer xml(out, 0);
+        xml.openTag("Root");
+
+        CEGUI::XMLSerializer::Checkpoint point = xml.checkpoint();
+        xml.openTag("Discarded").closeTag();
+        xml.rollBack(point);
+        BOOST_CHECK_EQUAL(xml.getTagCount(), 1u);
+
+        point = xml.checkpoint();
+        xml.openTag("Kept").closeTag();
+        xml.commit(point);
+
+        xml.closeTag();
+        BOOST_CHECK_EQUAL(xml.getTagCount(), 2u);
+    }
+
+    BOOST_CHECK_EQUAL(out.str(),
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n\n"
+        "<Root >\n<Kept />\n</Root>\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()